@@ -0,0 +1,52 @@
+# - Try to find UNICORN
+# Once done, this will define
+#
+#  UNICORN_FOUND - system has UNICORN
+#  UNICORN_INCLUDE_DIRS - the UNICORN include directories
+#  UNICORN_LIBRARIES - link these to use UNICORN
+
+include(LibFindMacros)
+
+# Dependencies
+# libfind_package(UNICORN unicorn)
+
+# Use pkg-config to get hints about paths
+# libfind_pkg_check_modules(UNICORN_PKGCONF unicorn)
+
+if(NOT UNICORN_INCLUDE_DIRS)
+    set(UNICORN_INCLUDE_DIRS "$ENV{UNICORN_INCLUDE_DIRS}")
+endif()
+
+if(NOT UNICORN_LIBRARIES)
+    set(UNICORN_LIBRARIES "$ENV{UNICORN_LIBRARIES}")
+endif()
+
+if(NOT UNICORN_INCLUDE_DIRS AND NOT UNICORN_LIBRARIES)
+    find_path(UNICORN_INCLUDE_DIR
+      NAMES unicorn/unicorn.h
+      PATHS ${UNICORN_PKGCONF_INCLUDE_DIRS}
+    )
+
+    find_library(UNICORN_LIBRARY
+      NAMES unicorn
+      PATHS ${UNICORN_PKGCONF_LIBRARY_DIRS}
+    )
+
+    # Set the include dir variables and the libraries and let libfind_process do the rest.
+    # NOTE: Singular variables for this library, plural for libraries this this lib depends on.
+    set(UNICORN_PROCESS_INCLUDES UNICORN_INCLUDE_DIR UNICORN_INCLUDE_DIRS)
+    set(UNICORN_PROCESS_LIBS UNICORN_LIBRARY UNICORN_LIBRARIES)
+
+    libfind_process(UNICORN)
+
+    if(NOT UNICORN_FOUND)
+        message(FATAL_ERROR "Unicorn not found")
+    else()
+        cmake_path(GET UNICORN_LIBRARY PARENT_PATH UNICORN_LIB_DIR)
+        cmake_path(GET UNICORN_LIBRARY STEM LAST_ONLY UNICORN_LIB_NAME)
+        string(REGEX REPLACE "^lib" "" UNICORN_LIB_NAME ${UNICORN_LIB_NAME})
+    endif()
+else()
+    message(STATUS "Unicorn includes directory defined: ${UNICORN_INCLUDE_DIRS}")
+    message(STATUS "Unicorn libraries defined: ${UNICORN_LIBRARIES}")
+endif()
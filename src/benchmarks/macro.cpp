@@ -0,0 +1,121 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <triton/context.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+/* The return address of the replayed functions, the replay stops there */
+static constexpr triton::uint64 returnAddress = 0xdead0000;
+
+/* The stack and the input of the replayed functions */
+static constexpr triton::uint64 stackAddress = 0x7fff0000;
+static constexpr triton::uint64 inputAddress = 0x10000000;
+
+/* The bound of a replay, in case a sample loops on its unrelocated data */
+static constexpr triton::usize maxInstructions = 1000000;
+
+
+/* A function of a sample of the tree, replayed from its first instruction to its return */
+struct sample {
+  architecture_e arch;
+  const char* path;
+  triton::uint64 function;
+  std::function<void(Context&)> setUp;
+};
+
+
+static void BM_Replay(benchmark::State& state, const sample& s) {
+  std::string path = std::string(TRITON_BENCH_ROOT) + "/" + s.path;
+  std::vector<triton::uint8> input(32, 'A');
+  int64_t instructions = 0;
+
+  /* The NUL terminated input of the crackmes */
+  input.back() = 0;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto ctx = std::make_unique<Context>(s.arch);
+    ctx->loadBinary(path);
+    ctx->setConcreteMemoryAreaValue(inputAddress, input);
+    s.setUp(*ctx);
+    state.ResumeTiming();
+
+    triton::usize count = 0;
+    ctx->run(s.function, maxInstructions, {returnAddress}, {}, &count);
+    instructions += count;
+
+    /* The context is destroyed out of the measure */
+    state.PauseTiming();
+    ctx.reset();
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(instructions);
+  state.counters["instructions"] = benchmark::Counter(static_cast<double>(instructions) / state.iterations());
+}
+
+
+/* The check() function of the IR test suite (gcc -O0), nm: 0x1330 */
+BENCHMARK_CAPTURE(BM_Replay, ir_test_suite_x86_64, sample{
+  ARCH_X86_64, "src/misc/ir_test_suite/ir", 0x1330,
+  [](Context& ctx) {
+    ctx.setConcreteMemoryValue(MemoryAccess(stackAddress, 8), returnAddress);
+    ctx.setConcreteRegisterValue(ctx.registers.x86_rsp, stackAddress);
+    ctx.setConcreteRegisterValue(ctx.registers.x86_rbp, stackAddress);
+  }
+})->Unit(benchmark::kMillisecond);
+
+
+/* The verification function of defcamp-2015-r100, symbolizing the input as the writeup does */
+BENCHMARK_CAPTURE(BM_Replay, r100_x86_64, sample{
+  ARCH_X86_64, "src/examples/python/ctf-writeups/defcamp-2015-r100/r100.bin", 0x4006fd,
+  [](Context& ctx) {
+    ctx.setMode(triton::modes::ALIGNED_MEMORY, true);
+    ctx.setMode(triton::modes::ONLY_ON_SYMBOLIZED, true);
+    ctx.setConcreteMemoryValue(MemoryAccess(stackAddress, 8), returnAddress);
+    ctx.setConcreteRegisterValue(ctx.registers.x86_rsp, stackAddress);
+    ctx.setConcreteRegisterValue(ctx.registers.x86_rbp, stackAddress);
+    ctx.setConcreteRegisterValue(ctx.registers.x86_rdi, inputAddress);
+    for (triton::uint64 index = 0; index < 30; index++)
+      ctx.symbolizeMemory(MemoryAccess(inputAddress + index, 1));
+  }
+})->Unit(benchmark::kMillisecond);
+
+
+/* The check() function of the arm32 hash crackme, nm: 0x103fc */
+BENCHMARK_CAPTURE(BM_Replay, hash_arm32, sample{
+  ARCH_ARM32, "src/examples/python/ctf-writeups/custom-crackmes/arm32-hash/crackme_hash-arm", 0x103fc,
+  [](Context& ctx) {
+    ctx.setConcreteRegisterValue(ctx.registers.arm32_sp, stackAddress);
+    ctx.setConcreteRegisterValue(ctx.registers.arm32_r14, returnAddress);
+    ctx.setConcreteRegisterValue(ctx.registers.arm32_r0, inputAddress);
+    for (triton::uint64 index = 0; index < 31; index++)
+      ctx.symbolizeMemory(MemoryAccess(inputAddress + index, 1));
+  }
+})->Unit(benchmark::kMillisecond);
+
+
+/* The check() function of the aarch64 hash crackme, nm: 0x764 */
+BENCHMARK_CAPTURE(BM_Replay, hash_aarch64, sample{
+  ARCH_AARCH64, "src/examples/python/ctf-writeups/custom-crackmes/aarch64-hash/crackme_hash", 0x764,
+  [](Context& ctx) {
+    ctx.setConcreteRegisterValue(ctx.registers.aarch64_sp, stackAddress);
+    ctx.setConcreteRegisterValue(ctx.registers.aarch64_x30, returnAddress);
+    ctx.setConcreteRegisterValue(ctx.registers.aarch64_x0, inputAddress);
+    for (triton::uint64 index = 0; index < 31; index++)
+      ctx.symbolizeMemory(MemoryAccess(inputAddress + index, 1));
+  }
+})->Unit(benchmark::kMillisecond);
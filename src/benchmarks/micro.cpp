@@ -0,0 +1,168 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <triton/config.hpp>
+#include <triton/context.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+/* A block of common x86-64 instructions reading and writing the stack */
+struct op {
+  unsigned int addr;
+  const void*  inst;
+  unsigned int size;
+};
+
+static struct op block[] = {
+  {0x400000, "\x48\x89\xe5",                 3}, /* mov        rbp, rsp                    */
+  {0x400003, "\x48\x8b\x45\xf8",             4}, /* mov        rax, QWORD PTR [rbp-0x8]    */
+  {0x400007, "\x48\x01\xd8",                 3}, /* add        rax, rbx                    */
+  {0x40000a, "\x48\x31\xc1",                 3}, /* xor        rcx, rax                    */
+  {0x40000d, "\x48\xc1\xe1\x03",             4}, /* shl        rcx, 0x3                    */
+  {0x400011, "\x48\x89\x4d\xf0",             4}, /* mov        QWORD PTR [rbp-0x10], rcx   */
+  {0x400015, "\x48\x8d\x14\xc3",             4}, /* lea        rdx, [rbx+rax*8]            */
+  {0x400019, "\x48\x39\xd0",                 3}, /* cmp        rax, rdx                    */
+  {0x000000, nullptr,                        0}
+};
+
+/* The number of blocks processed before the state is reset, so it does not grow without bound */
+static constexpr int64_t blocksPerReset = 4096;
+
+
+static void setUp(Context& ctx, bool symbolize, bool taint) {
+  ctx.reset();
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rsp, 0x7fff0000);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rbx, 0x1234);
+
+  if (symbolize)
+    ctx.symbolizeRegister(ctx.registers.x86_rbx);
+
+  if (taint) {
+    ctx.setMode(triton::modes::TAINT_ONLY, true);
+    ctx.taintRegister(ctx.registers.x86_rbx);
+  }
+}
+
+
+static void processBlocks(benchmark::State& state, bool symbolize, bool taint) {
+  Context ctx(ARCH_X86_64);
+  int64_t instructions = 0;
+  int64_t blocks = 0;
+
+  setUp(ctx, symbolize, taint);
+  for (auto _ : state) {
+    if (++blocks % blocksPerReset == 0) {
+      state.PauseTiming();
+      setUp(ctx, symbolize, taint);
+      state.ResumeTiming();
+    }
+    for (unsigned int i = 0; block[i].inst; i++) {
+      Instruction inst(block[i].addr, block[i].inst, block[i].size);
+      ctx.processing(inst);
+      instructions++;
+    }
+  }
+
+  state.SetItemsProcessed(instructions);
+}
+
+
+/* Instructions per second of processing() on concrete operands */
+static void BM_ProcessingConcrete(benchmark::State& state) {
+  processBlocks(state, false, false);
+}
+BENCHMARK(BM_ProcessingConcrete);
+
+
+/* Instructions per second of processing() on symbolized operands */
+static void BM_ProcessingSymbolic(benchmark::State& state) {
+  processBlocks(state, true, false);
+}
+BENCHMARK(BM_ProcessingSymbolic);
+
+
+/* Instructions per second of the taint propagation alone */
+static void BM_TaintPropagation(benchmark::State& state) {
+  processBlocks(state, false, true);
+}
+BENCHMARK(BM_TaintPropagation);
+
+
+/* Nodes per second built by the AST context */
+static void BM_AstCreation(benchmark::State& state) {
+  Context ctx(ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+  auto x = actx->variable(ctx.newSymbolicVariable(64, "x"));
+  triton::uint64 value = 0;
+
+  for (auto _ : state) {
+    auto node = actx->bvadd(actx->bvxor(x, actx->bv(value++, 64)), actx->bvmul(x, actx->bv(3, 64)));
+    benchmark::DoNotOptimize(node);
+  }
+
+  /* Five nodes per iteration: two constants and three operations */
+  state.SetItemsProcessed(state.iterations() * 5);
+}
+BENCHMARK(BM_AstCreation);
+
+
+#if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+/* Latency of getModel() on a constraint of growing depth */
+static void BM_GetModel(benchmark::State& state) {
+  Context ctx(ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+  auto x = actx->variable(ctx.newSymbolicVariable(32, "x"));
+  auto node = x;
+
+  for (int64_t i = 0; i < state.range(0); i++)
+    node = actx->bvadd(actx->bvxor(node, actx->bv(0x9e3779b9 + i, 32)), actx->bvshl(node, actx->bv(1, 32)));
+
+  auto constraint = actx->equal(node, actx->bv(0xdeadbeef, 32));
+  ctx.enableQueryCache(false);
+
+  for (auto _ : state) {
+    auto model = ctx.getModel(constraint);
+    benchmark::DoNotOptimize(model);
+  }
+}
+BENCHMARK(BM_GetModel)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMillisecond);
+#endif
+
+
+/* Bytes per second written to the concrete memory */
+static void BM_MemoryWrite(benchmark::State& state) {
+  Context ctx(ARCH_X86_64);
+  std::vector<triton::uint8> area(state.range(0), 0x41);
+
+  for (auto _ : state)
+    ctx.setConcreteMemoryAreaValue(0x10000000, area, false);
+
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MemoryWrite)->Arg(16)->Arg(4096)->Arg(1 << 20);
+
+
+/* Bytes per second read from the concrete memory */
+static void BM_MemoryRead(benchmark::State& state) {
+  Context ctx(ARCH_X86_64);
+  std::vector<triton::uint8> area(state.range(0), 0x41);
+
+  ctx.setConcreteMemoryAreaValue(0x10000000, area, false);
+  for (auto _ : state) {
+    auto values = ctx.getConcreteMemoryAreaValue(0x10000000, state.range(0), false);
+    benchmark::DoNotOptimize(values);
+  }
+
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MemoryRead)->Arg(16)->Arg(4096)->Arg(1 << 20);
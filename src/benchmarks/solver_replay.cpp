@@ -0,0 +1,175 @@
+/*
+** Replays a corpus of solver queries, as dumped by Context::dumpSolverQueries(), and reports the time
+** and the status of each query against the ones recorded.
+**
+** Usage: triton-solver-replay [-s z3|bitwuzla|portfolio] [-t timeout] [-c] [-x] [-i] [-p] [-q] [-v] <corpus>...
+**
+**   -s  the solver (the default one otherwise)
+**   -t  the timeout of a query, in milliseconds
+**   -c  enables the query cache
+**   -x  enables the counterexample cache
+**   -i  enables the constraint independence
+**   -p  enables the presolver
+**   -q  enables the query classification
+**   -v  prints each query
+**
+** A corpus is harvested from an example with:
+**
+**   $ python3 src/scripts/harvest_solver_queries.py <corpus directory> <example.py> [args...]
+**
+*/
+
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <triton/config.hpp>
+#include <triton/context.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/solverCorpus.hpp>
+
+using namespace triton;
+using namespace triton::engines::solver;
+
+
+static const char* statusNames[] = {"UNSAT", "SAT", "TIMEOUT", "OUTOFMEM", "UNKNOWN"};
+
+
+static int usage(const char* name) {
+  std::cerr << "Usage: " << name << " [-s z3|bitwuzla|portfolio] [-t timeout] [-c] [-x] [-i] [-p] [-q] [-v] <corpus>..." << std::endl;
+  return 1;
+}
+
+
+static bool setSolver(Context& ctx, const std::string& name) {
+  #ifdef TRITON_Z3_INTERFACE
+  if (name == "z3") {
+    ctx.setSolver(SOLVER_Z3);
+    return true;
+  }
+  #endif
+  #ifdef TRITON_BITWUZLA_INTERFACE
+  if (name == "bitwuzla") {
+    ctx.setSolver(SOLVER_BITWUZLA);
+    return true;
+  }
+  #endif
+  #if defined(TRITON_Z3_INTERFACE) && defined(TRITON_BITWUZLA_INTERFACE)
+  if (name == "portfolio") {
+    ctx.setSolver(SOLVER_PORTFOLIO);
+    return true;
+  }
+  #endif
+  return false;
+}
+
+
+int main(int ac, const char **av) {
+  std::array<triton::usize, UNKNOWN + 1> statuses = {};
+  std::vector<std::string> corpora;
+  triton::uint64 recordedTime = 0;
+  triton::uint64 replayedTime = 0;
+  triton::usize mismatches = 0;
+  triton::usize queries = 0;
+  triton::uint32 timeout = 0;
+  bool verbose = false;
+
+  /* The architecture does not matter, the queries only need an AST context */
+  Context ctx(triton::arch::ARCH_X86_64);
+
+  for (int i = 1; i < ac; i++) {
+    if (std::strcmp(av[i], "-s") == 0 && i + 1 < ac) {
+      if (!setSolver(ctx, av[++i])) {
+        std::cerr << "Unknown or disabled solver: " << av[i] << std::endl;
+        return 1;
+      }
+    }
+    else if (std::strcmp(av[i], "-t") == 0 && i + 1 < ac)
+      timeout = static_cast<triton::uint32>(std::atoi(av[++i]));
+    else if (std::strcmp(av[i], "-c") == 0)
+      ctx.enableQueryCache(true);
+    else if (std::strcmp(av[i], "-x") == 0)
+      ctx.enableCounterexampleCache(true);
+    else if (std::strcmp(av[i], "-i") == 0)
+      ctx.enableConstraintIndependence(true);
+    else if (std::strcmp(av[i], "-p") == 0)
+      ctx.enablePresolver(true);
+    else if (std::strcmp(av[i], "-q") == 0)
+      ctx.enableQueryClassification(true);
+    else if (std::strcmp(av[i], "-v") == 0)
+      verbose = true;
+    else if (av[i][0] == '-')
+      return usage(av[0]);
+    else
+      corpora.push_back(av[i]);
+  }
+
+  if (corpora.empty())
+    return usage(av[0]);
+
+  if (!ctx.isSolverValid()) {
+    std::cerr << "No solver is available" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Solver: " << ctx.getSolverInstance()->getName() << std::endl;
+
+  try {
+    for (const auto& path : corpora) {
+      std::ifstream stream(path, std::ios::in | std::ios::binary);
+      SolverQuery query;
+
+      if (!stream) {
+        std::cerr << "Cannot open " << path << std::endl;
+        return 1;
+      }
+
+      while (readQuery(stream, ctx.getAstContext(), query)) {
+        status_e status = UNKNOWN;
+        triton::uint32 solvingTime = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        if (query.limit == 0)
+          ctx.isSat(query.node, &status, timeout, &solvingTime);
+        else if (query.limit == 1)
+          ctx.getModel(query.node, &status, timeout, &solvingTime);
+        else
+          ctx.getModels(query.node, query.limit, &status, timeout, &solvingTime);
+        auto time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+        statuses[status]++;
+        recordedTime += query.queryTime;
+        replayedTime += static_cast<triton::uint64>(time);
+        if (status != query.status)
+          mismatches++;
+
+        if (verbose) {
+          std::cout << path << ":" << queries << " " << statusNames[status] << " (recorded " << statusNames[query.status] << ") "
+                    << time << "us (recorded " << query.queryTime << "us)" << std::endl;
+        }
+
+        queries++;
+      }
+    }
+  }
+  catch (const triton::exceptions::Exception& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << "Queries:    " << queries << std::endl;
+  for (triton::usize status = 0; status < statuses.size(); status++)
+    std::cout << "  " << std::left << std::setw(10) << statusNames[status] << statuses[status] << std::endl;
+  std::cout << "Mismatches: " << mismatches << std::endl;
+  std::cout << "Replayed:   " << replayedTime << "us" << std::endl;
+  std::cout << "Recorded:   " << recordedTime << "us" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,176 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <triton/config.hpp>
+#include <triton/uintwide_t.h>
+#include <triton/wideArithmetic.hpp>
+
+#if __has_include(<boost/multiprecision/cpp_int.hpp>)
+  #include <boost/multiprecision/cpp_int.hpp>
+  #define TRITON_BENCH_BOOST
+#endif
+
+using namespace triton;
+
+
+/* The number of operands cycled through, so that the compiler cannot fold them */
+static constexpr size_t operands = 64;
+
+
+/* The mask of `size` bits */
+template <typename T>
+static T maskOf(triton::uint32 size) {
+  return (size == 512) ? T(0) - 1 : (T(1) << size) - 1;
+}
+
+
+/* Builds a value of `size` bits from random limbs */
+template <typename T>
+static T randomValue(std::mt19937_64& rng, triton::uint32 size) {
+  T value = 0;
+  for (triton::uint32 i = 0; i < 8; i++) {
+    value <<= 64;
+    value |= T(rng());
+  }
+  return value & maskOf<T>(size);
+}
+
+
+template <typename T>
+static std::vector<T> randomValues(triton::uint32 size) {
+  std::mt19937_64 rng(size);
+  std::vector<T> values;
+  for (size_t i = 0; i < operands; i++)
+    values.push_back(randomValue<T>(rng, size));
+  return values;
+}
+
+
+/* The fixed-limb kernels, the size dispatched at runtime as in the AST */
+static void BM_WideKernelAdd(benchmark::State& state) {
+  triton::uint32 size = static_cast<triton::uint32>(state.range(0));
+  auto values = randomValues<triton::uint512>(size);
+  size_t i = 0;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(triton::utils::wideAdd(values[i % operands], values[(i + 1) % operands], size));
+    i++;
+  }
+}
+BENCHMARK(BM_WideKernelAdd)->Arg(128)->Arg(256)->Arg(512);
+
+
+static void BM_WideKernelMul(benchmark::State& state) {
+  triton::uint32 size = static_cast<triton::uint32>(state.range(0));
+  auto values = randomValues<triton::uint512>(size);
+  size_t i = 0;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(triton::utils::wideMul(values[i % operands], values[(i + 1) % operands], size));
+    i++;
+  }
+}
+BENCHMARK(BM_WideKernelMul)->Arg(128)->Arg(256)->Arg(512);
+
+
+static void BM_WideKernelShl(benchmark::State& state) {
+  triton::uint32 size = static_cast<triton::uint32>(state.range(0));
+  auto values = randomValues<triton::uint512>(size);
+  size_t i = 0;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(triton::utils::wideShl(values[i % operands], i % size, size));
+    i++;
+  }
+}
+BENCHMARK(BM_WideKernelShl)->Arg(128)->Arg(256)->Arg(512);
+
+
+static void BM_WideKernelUlt(benchmark::State& state) {
+  triton::uint32 size = static_cast<triton::uint32>(state.range(0));
+  auto values = randomValues<triton::uint512>(size);
+  size_t i = 0;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(triton::utils::wideUlt(values[i % operands], values[(i + 1) % operands], size));
+    i++;
+  }
+}
+BENCHMARK(BM_WideKernelUlt)->Arg(128)->Arg(256)->Arg(512);
+
+
+/* The same operations on the 512-bit backends, masked to the size as the AST did */
+template <typename T>
+static void BM_WideBackendAdd(benchmark::State& state) {
+  triton::uint32 size = static_cast<triton::uint32>(state.range(0));
+  auto values = randomValues<T>(size);
+  T mask = maskOf<T>(size);
+  size_t i = 0;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(T((values[i % operands] + values[(i + 1) % operands]) & mask));
+    i++;
+  }
+}
+
+
+template <typename T>
+static void BM_WideBackendMul(benchmark::State& state) {
+  triton::uint32 size = static_cast<triton::uint32>(state.range(0));
+  auto values = randomValues<T>(size);
+  T mask = maskOf<T>(size);
+  size_t i = 0;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(T((values[i % operands] * values[(i + 1) % operands]) & mask));
+    i++;
+  }
+}
+
+
+template <typename T>
+static void BM_WideBackendShl(benchmark::State& state) {
+  triton::uint32 size = static_cast<triton::uint32>(state.range(0));
+  auto values = randomValues<T>(size);
+  T mask = maskOf<T>(size);
+  size_t i = 0;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(T((values[i % operands] << static_cast<unsigned>(i % size)) & mask));
+    i++;
+  }
+}
+
+
+template <typename T>
+static void BM_WideBackendUlt(benchmark::State& state) {
+  triton::uint32 size = static_cast<triton::uint32>(state.range(0));
+  auto values = randomValues<T>(size);
+  size_t i = 0;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(values[i % operands] < values[(i + 1) % operands]);
+    i++;
+  }
+}
+
+
+BENCHMARK_TEMPLATE(BM_WideBackendAdd, math::wide_integer::uint512_t)->Arg(128)->Arg(256)->Arg(512);
+BENCHMARK_TEMPLATE(BM_WideBackendMul, math::wide_integer::uint512_t)->Arg(128)->Arg(256)->Arg(512);
+BENCHMARK_TEMPLATE(BM_WideBackendShl, math::wide_integer::uint512_t)->Arg(128)->Arg(256)->Arg(512);
+BENCHMARK_TEMPLATE(BM_WideBackendUlt, math::wide_integer::uint512_t)->Arg(128)->Arg(256)->Arg(512);
+
+#ifdef TRITON_BENCH_BOOST
+BENCHMARK_TEMPLATE(BM_WideBackendAdd, boost::multiprecision::uint512_t)->Arg(128)->Arg(256)->Arg(512);
+BENCHMARK_TEMPLATE(BM_WideBackendMul, boost::multiprecision::uint512_t)->Arg(128)->Arg(256)->Arg(512);
+BENCHMARK_TEMPLATE(BM_WideBackendShl, boost::multiprecision::uint512_t)->Arg(128)->Arg(256)->Arg(512);
+BENCHMARK_TEMPLATE(BM_WideBackendUlt, boost::multiprecision::uint512_t)->Arg(128)->Arg(256)->Arg(512);
+#endif
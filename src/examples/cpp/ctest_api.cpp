@@ -1,29 +1,59 @@
 /* Used to test the C++ API */
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <sstream>
 #include <list>
+#include <memory_resource>
+#include <set>
+#include <thread>
 
 #include <triton/aarch64Cpu.hpp>
 #include <triton/aarch64Specifications.hpp>
+#include <triton/astProgram.hpp>
+#include <triton/astSerialization.hpp>
+#include <triton/astSmtParser.hpp>
 #include <triton/context.hpp>
 #include <triton/bitsVector.hpp>
+#include <triton/concreteMemory.hpp>
 #include <triton/config.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/explorer.hpp>
+#include <triton/fuzzerSync.hpp>
 #include <triton/immediate.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/operandWrapper.hpp>
+#include <triton/passManager.hpp>
 #include <triton/register.hpp>
+#include <triton/solverCorpus.hpp>
+#include <triton/wideArithmetic.hpp>
 #include <triton/x8664Cpu.hpp>
 #include <triton/x86Cpu.hpp>
 #include <triton/x86Specifications.hpp>
 
+#ifdef TRITON_Z3_INTERFACE
+  #include <triton/tritonToZ3.hpp>
+  #include <triton/z3ToTriton.hpp>
+#endif
+
 #ifdef TRITON_LLVM_INTERFACE
   #include <triton/tritonToLLVM.hpp>
   #include <triton/llvmToTriton.hpp>
 #endif
 
+#ifdef TRITON_REMOTE_INTERFACE
+  #include <triton/remoteWorker.hpp>
+#endif
+
+#ifdef TRITON_UNICORN_INTERFACE
+  #include <triton/unicornEmulator.hpp>
+#endif
+
 
 
 int test_1(void) {
@@ -794,46 +824,4349 @@ int test_13(void) {
   return 0;
 }
 
-int main(int ac, const char **av) {
-  if (test_1())
+
+int test_14(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  std::vector<triton::uint8> area(0x2000, 0x41);
+
+  /* An area which crosses three pages */
+  ctx.setConcreteMemoryAreaValue(0x10ff0, area);
+  ctx.setConcreteMemoryValue(0xfffffffffffffffe, 0x42);
+
+  const triton::arch::ConcreteMemory& memory = ctx.getConcreteMemory();
+  if (memory.size() != area.size() + 1 || memory.getNumberOfPages() != 4) {
+    std::cerr << "test_14: KO (" << memory.size() << " defined bytes in " << memory.getNumberOfPages() << " pages)" << std::endl;
     return 1;
+  }
 
-  if (test_2())
+  if (!ctx.isConcreteMemoryValueDefined(0x10ff0, area.size()) || ctx.isConcreteMemoryValueDefined(0x10fef, 2)) {
+    std::cerr << "test_14: KO (isConcreteMemoryValueDefined)" << std::endl;
     return 1;
+  }
 
-  if (test_3())
+  if (ctx.getConcreteMemoryAreaValue(0x10fee, 4) != std::vector<triton::uint8>({0x00, 0x00, 0x41, 0x41})) {
+    std::cerr << "test_14: KO (getConcreteMemoryAreaValue)" << std::endl;
     return 1;
+  }
 
-  if (test_4())
+  triton::usize count = 0;
+  for (const auto& cell : memory) {
+    if (cell.first != 0xfffffffffffffffe && cell.second != 0x41) {
+      std::cerr << "test_14: KO (iterator)" << std::endl;
+      return 1;
+    }
+    count++;
+  }
+
+  if (count != memory.size()) {
+    std::cerr << "test_14: KO (iterator)" << std::endl;
     return 1;
+  }
 
-  if (test_5())
+  ctx.clearConcreteMemoryValue(0x10ff0, area.size());
+  if (memory.size() != 1 || memory.getNumberOfPages() != 1 || ctx.getConcreteMemoryValue(0x11000) != 0) {
+    std::cerr << "test_14: KO (clearConcreteMemoryValue)" << std::endl;
     return 1;
+  }
 
-  if (test_6())
+  std::cout << "test_14: OK" << std::endl;
+  return 0;
+}
+
+
+int test_15(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  triton::arch::Instruction inst((const unsigned char*)"\x48\x83\xc0\x01", 4); /* add rax, 1 */
+
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rax, 1);
+  ctx.setConcreteMemoryValue(0x1000, 0x11);
+  ctx.symbolizeRegister(ctx.registers.x86_rax);
+  ctx.taintRegister(ctx.registers.x86_rax);
+
+  auto expr = ctx.getSymbolicRegister(ctx.registers.x86_rax);
+  auto id   = ctx.snapshot();
+
+  ctx.processing(inst);
+  ctx.setConcreteMemoryValue(0x1000, 0x22);
+  ctx.untaintRegister(ctx.registers.x86_rax);
+  ctx.pushPathConstraint(ctx.getAstContext()->equal(ctx.getRegisterAst(ctx.registers.x86_rax), ctx.getAstContext()->bv(2, 64)));
+
+  if (ctx.getConcreteRegisterValue(ctx.registers.x86_rax) != 2 || ctx.getSizeOfPathConstraints() != 1) {
+    std::cerr << "test_15: KO (processing)" << std::endl;
     return 1;
+  }
 
-  if (test_7())
+  ctx.restore(id);
+  if (ctx.getConcreteRegisterValue(ctx.registers.x86_rax) != 1 ||
+      ctx.getConcreteMemoryValue(0x1000) != 0x11 ||
+      ctx.getSymbolicRegister(ctx.registers.x86_rax) != expr ||
+      ctx.getSizeOfPathConstraints() != 0 ||
+      ctx.isRegisterTainted(ctx.registers.x86_rax) == false) {
+    std::cerr << "test_15: KO (restore)" << std::endl;
     return 1;
+  }
 
-  if (test_8())
+  auto fork = ctx.fork();
+  fork->setConcreteMemoryValue(0x1000, 0x33);
+  fork->processing(inst);
+  if (ctx.getConcreteMemoryValue(0x1000) != 0x11 ||
+      ctx.getConcreteRegisterValue(ctx.registers.x86_rax) != 1 ||
+      fork->getConcreteMemoryValue(0x1000) != 0x33 ||
+      fork->getConcreteRegisterValue(fork->registers.x86_rax) != 2 ||
+      fork->isRegisterTainted(fork->registers.x86_rax) == false) {
+    std::cerr << "test_15: KO (fork)" << std::endl;
     return 1;
+  }
 
-  if (test_9())
+  /* Both contexts share the AST context, variables must not collide */
+  auto var1 = ctx.newSymbolicVariable(8);
+  auto var2 = fork->newSymbolicVariable(8);
+  if (var1->getName() == var2->getName()) {
+    std::cerr << "test_15: KO (symbolic variables)" << std::endl;
     return 1;
+  }
 
-  #ifdef TRITON_LLVM_INTERFACE
-  if (test_10())
+  ctx.removeSnapshot(id);
+  if (ctx.isSnapshotExists(id)) {
+    std::cerr << "test_15: KO (removeSnapshot)" << std::endl;
     return 1;
-  #endif
+  }
 
-  if (test_11())
+  std::cout << "test_15: OK" << std::endl;
+  return 0;
+}
+
+int test_16(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  std::vector<triton::uint8> elf(0x80, 0x00);
+  const char* path = "ctest_api_test_16.elf";
+
+  auto put = [&](triton::usize offset, triton::uint64 value, triton::usize size) {
+    for (triton::usize i = 0; i < size; i++)
+      elf[offset + i] = (value >> (i * 8)) & 0xff;
+  };
+
+  /* ELF64 header with one PT_LOAD segment of 0x80 bytes in the file and 0x2000 bytes in memory */
+  put(0x00, 0x00010102464c457f, 8);
+  put(0x10, 2, 2);          /* e_type */
+  put(0x20, 0x40, 8);       /* e_phoff */
+  put(0x36, 0x38, 2);       /* e_phentsize */
+  put(0x38, 1, 2);          /* e_phnum */
+  put(0x40, 1, 4);          /* p_type */
+  put(0x50, 0x400000, 8);   /* p_vaddr */
+  put(0x60, 0x80, 8);       /* p_filesz */
+  put(0x68, 0x2000, 8);     /* p_memsz */
+  put(0x78, 0x8877665544332211, 8);
+
+  std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(elf.data()), elf.size());
+
+  ctx.setConcreteMemoryValue(0x401000, 0x42);
+  ctx.symbolizeMemory(triton::arch::MemoryAccess(0x400078, triton::size::byte));
+
+  auto segments = ctx.loadBinary(path);
+  std::remove(path);
+
+  if (segments.size() != 1 || segments[0].address != 0x400000 || segments[0].size != 0x2000) {
+    std::cerr << "test_16: KO (segments)" << std::endl;
     return 1;
+  }
 
-  if (test_12())
+  if (ctx.getConcreteMemoryValue(triton::arch::MemoryAccess(0x400078, triton::size::qword)) != 0x8877665544332211 ||
+      ctx.getConcreteMemoryValue(0x401000) != 0x00 ||
+      ctx.isConcreteMemoryValueDefined(0x400000, 0x2000) == false ||
+      ctx.isMemorySymbolized(0x400078) == true) {
+    std::cerr << "test_16: KO (mapping)" << std::endl;
     return 1;
+  }
 
-  if (test_13())
+  auto id = ctx.snapshot();
+  ctx.setConcreteMemoryValue(0x400078, 0x99);
+  if (ctx.getConcreteMemoryValue(0x400078) != 0x99 || ctx.getConcreteMemoryValue(0x400079) != 0x22) {
+    std::cerr << "test_16: KO (write)" << std::endl;
+    return 1;
+  }
+
+  ctx.restore(id);
+  if (ctx.getConcreteMemoryValue(0x400078) != 0x11) {
+    std::cerr << "test_16: KO (restore)" << std::endl;
+    return 1;
+  }
+
+  try {
+    ctx.loadBinary(path);
+    std::cerr << "test_16: KO (missing file)" << std::endl;
+    return 1;
+  }
+  catch (const triton::exceptions::Loader&) {
+  }
+
+  std::cout << "test_16: OK" << std::endl;
+  return 0;
+}
+
+static triton::usize test_17_loads  = 0;
+static triton::usize test_17_stores = 0;
+void cb_test_17_load(triton::Context&, const triton::arch::MemoryAccess&) { test_17_loads++; };
+void cb_test_17_store(triton::Context&, const triton::arch::MemoryAccess&, const triton::uint512&) { test_17_stores++; };
+
+
+int test_17(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  triton::uint8 src[200];
+  triton::uint8 dst[200];
+
+  for (triton::usize i = 0; i < sizeof(src); i++)
+    src[i] = static_cast<triton::uint8>(i * 7);
+
+  ctx.symbolizeMemory(triton::arch::MemoryAccess(0x1010, triton::size::byte));
+  ctx.addCallback(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, cb_test_17_load);
+  ctx.addCallback(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, cb_test_17_store);
+
+  /* 200 bytes are 3 accesses of 64 bytes and 1 access of 8 bytes */
+  ctx.writeConcreteMemory(0xff0, src, sizeof(src));
+  ctx.readConcreteMemory(0xff0, dst, sizeof(dst));
+
+  if (std::memcmp(src, dst, sizeof(src)) != 0 || test_17_loads != 4 || test_17_stores != 4) {
+    std::cerr << "test_17: KO (bulk)" << std::endl;
+    return 1;
+  }
+
+  if (ctx.isMemorySymbolized(0x1010)) {
+    std::cerr << "test_17: KO (concretization)" << std::endl;
+    return 1;
+  }
+
+  ctx.readConcreteMemory(0xff0, dst, sizeof(dst), false);
+  if (test_17_loads != 4) {
+    std::cerr << "test_17: KO (callbacks)" << std::endl;
+    return 1;
+  }
+
+  ctx.setConcreteMemoryValue(triton::arch::MemoryAccess(0xffc, triton::size::qword), 0x1122334455667788);
+  if (ctx.getConcreteMemoryValue(triton::arch::MemoryAccess(0xffc, triton::size::qword)) != 0x1122334455667788 ||
+      ctx.getConcreteMemoryValue(triton::arch::MemoryAccess(0xffe, triton::size::word)) != 0x5566 ||
+      ctx.getConcreteMemoryValue(0x1003) != 0x11) {
+    std::cerr << "test_17: KO (values)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_17: OK" << std::endl;
+  return 0;
+}
+
+static triton::usize test_18_faults = 0;
+std::vector<triton::uint8> cb_test_18_page(triton::Context&, triton::uint64 addr) {
+  test_18_faults++;
+  if (addr == 0x2000)
+    return {};
+  return std::vector<triton::uint8>(triton::arch::ConcreteMemory::pageSize, static_cast<triton::uint8>(addr >> 12));
+};
+
+
+int test_18(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  ctx.setConcreteMemoryValue(0x3000, 0xaa);
+  ctx.addCallback(triton::callbacks::GET_CONCRETE_MEMORY_PAGE, cb_test_18_page);
+
+  /* Pages 0x1000 and 0x2000 fault, 0x3000 is already defined */
+  if (ctx.getConcreteMemoryValue(triton::arch::MemoryAccess(0x1ffe, triton::size::dword)) != 0x00000101 ||
+      ctx.getConcreteMemoryValue(0x3000) != 0xaa || ctx.getConcreteMemoryValue(0x3001) != 0x00 ||
+      test_18_faults != 2) {
+    std::cerr << "test_18: KO (fault)" << std::endl;
+    return 1;
+  }
+
+  /* Pages fault only once */
+  ctx.getConcreteMemoryAreaValue(0x1000, 0x3000);
+  ctx.setConcreteMemoryValue(0x1000, 0x42);
+  if (test_18_faults != 2 || ctx.getConcreteMemoryValue(0x1000) != 0x42 || ctx.getConcreteMemoryValue(0x1fff) != 0x01) {
+    std::cerr << "test_18: KO (once)" << std::endl;
+    return 1;
+  }
+
+  /* Accesses without callbacks do not fault */
+  if (ctx.getConcreteMemoryValue(0x5000, false) != 0x00 || test_18_faults != 2) {
+    std::cerr << "test_18: KO (execCallbacks)" << std::endl;
+    return 1;
+  }
+
+  ctx.removeCallback(triton::callbacks::GET_CONCRETE_MEMORY_PAGE, cb_test_18_page);
+  if (ctx.getConcreteMemoryValue(0x6000) != 0x00 || test_18_faults != 2) {
+    std::cerr << "test_18: KO (remove)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_18: OK" << std::endl;
+  return 0;
+}
+
+int test_19(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rax, 0x1122334455667788);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_ah, 0xff);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_zf, 1);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_fsw_top, 5);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_xmm1, triton::uint128(0xdeadbeef) << 64);
+
+  /* Sub-registers and flags share the storage of their parent */
+  if (ctx.getConcreteRegisterValue(ctx.registers.x86_rax) != 0x112233445566ff88 ||
+      ctx.getConcreteRegisterValue(ctx.registers.x86_eflags) != 0x40 ||
+      ctx.getConcreteRegisterValue(ctx.registers.x86_fsw) != 0x2800 ||
+      ctx.getConcreteRegisterValue(ctx.registers.x86_zmm1) != (triton::uint512(0xdeadbeef) << 64)) {
+    std::cerr << "test_19: KO (layout)" << std::endl;
+    return 1;
+  }
+
+  const triton::arch::RegisterSlot& slot = ctx.getConcreteRegisterSlot(triton::arch::ID_REG_X86_AH);
+  if (ctx.getConcreteRegisterFile()[slot.offset + slot.low / 8] != 0xff) {
+    std::cerr << "test_19: KO (slot)" << std::endl;
+    return 1;
+  }
+
+  /* The whole register state is saved and restored with one copy */
+  std::vector<triton::uint8> file(ctx.getConcreteRegisterFile(), ctx.getConcreteRegisterFile() + ctx.getConcreteRegisterFileSize());
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rax, 0);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_xmm1, 0);
+  ctx.setConcreteRegisterFile(file.data(), file.size());
+  if (ctx.getConcreteRegisterValue(ctx.registers.x86_rax) != 0x112233445566ff88 ||
+      ctx.getConcreteRegisterValue(ctx.registers.x86_xmm1) != (triton::uint128(0xdeadbeef) << 64)) {
+    std::cerr << "test_19: KO (restore)" << std::endl;
+    return 1;
+  }
+
+  try {
+    ctx.setConcreteRegisterFile(file.data(), file.size() - 1);
+    std::cerr << "test_19: KO (size)" << std::endl;
+    return 1;
+  }
+  catch (const triton::exceptions::Cpu&) {
+  }
+
+  std::cout << "test_19: OK" << std::endl;
+  return 0;
+}
+
+int test_20(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  triton::arch::Instruction push((const unsigned char*)"\x50", 1);             /* push rax */
+  triton::arch::Instruction add((const unsigned char*)"\x48\x83\xc0\x01", 4); /* add rax, 1 */
+  triton::arch::Instruction je((const unsigned char*)"\x74\x00", 2);          /* je 0 */
+
+  ctx.enableUndoJournal(true, 2);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rax, 0x41);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rsp, 0x2000);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rip, 0x1000);
+  ctx.symbolizeRegister(ctx.registers.x86_rax);
+  auto rax = ctx.getSymbolicRegister(ctx.registers.x86_rax);
+
+  push.setAddress(0x1000);
+  add.setAddress(0x1001);
+  je.setAddress(0x1005);
+  ctx.processing(push);
+  ctx.processing(add);
+
+  if (ctx.getUndoJournalSize() != 2 || ctx.getConcreteMemoryValue(0x1ff8) != 0x41) {
+    std::cerr << "test_20: KO (processing)" << std::endl;
+    return 1;
+  }
+
+  ctx.stepBack(2);
+  if (ctx.getConcreteRegisterValue(ctx.registers.x86_rax) != 0x41 ||
+      ctx.getConcreteRegisterValue(ctx.registers.x86_rsp) != 0x2000 ||
+      ctx.getConcreteRegisterValue(ctx.registers.x86_rip) != 0x1000 ||
+      ctx.getSymbolicRegister(ctx.registers.x86_rax) != rax ||
+      ctx.getSymbolicMemory(0x1ff8) != nullptr ||
+      ctx.isConcreteMemoryValueDefined(0x1ff8, 8) == true) {
+    std::cerr << "test_20: KO (stepBack)" << std::endl;
+    return 1;
+  }
+
+  /* The oldest instruction is dropped once the journal is full */
+  ctx.processing(push);
+  ctx.processing(add);
+  ctx.processing(je);
+  if (ctx.getUndoJournalSize() != 2 || ctx.getSizeOfPathConstraints() != 1) {
+    std::cerr << "test_20: KO (ring buffer)" << std::endl;
+    return 1;
+  }
+
+  ctx.stepBack(2);
+  if (ctx.getConcreteRegisterValue(ctx.registers.x86_rax) != 0x41 ||
+      ctx.getConcreteRegisterValue(ctx.registers.x86_rsp) != 0x1ff8 ||
+      ctx.getSizeOfPathConstraints() != 0) {
+    std::cerr << "test_20: KO (stepBack in ring buffer)" << std::endl;
+    return 1;
+  }
+
+  try {
+    ctx.stepBack(1);
+    std::cerr << "test_20: KO (empty journal)" << std::endl;
+    return 1;
+  }
+  catch (const triton::exceptions::SymbolicEngine&) {
+  }
+
+  std::cout << "test_20: OK" << std::endl;
+  return 0;
+}
+
+int test_21(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  triton::arch::Instruction inst1(0x1000, (const unsigned char*)"\x48\x8b\x05\x10\x00\x00\x00", 7); /* mov rax, qword ptr [rip + 0x10] */
+  triton::arch::Instruction inst2(0x1000, (const unsigned char*)"\x48\x8b\x05\x10\x00\x00\x00\x90", 8);
+  triton::arch::Instruction inst3(0x1000, (const unsigned char*)"\x48\x31\xc0", 3); /* xor rax, rax */
+
+  ctx.enableDecodeCache(true);
+  ctx.disassembly(inst1);
+  ctx.disassembly(inst2);
+
+  if (ctx.getCpuInstance()->getDecodeCache().getSize() != 1 ||
+      inst2.getSize() != 7 ||
+      inst2.getDisassembly() != inst1.getDisassembly() ||
+      inst2.operands.size() != 2 ||
+      inst2.operands[1].getConstMemory().getPcRelative() != 0x1007) {
+    std::cerr << "test_21: KO (cached decoding)" << std::endl;
+    return 1;
+  }
+
+  /* The code at 0x1000 changed, it must be decoded again */
+  ctx.disassembly(inst3);
+  if (inst3.getDisassembly() != "xor rax, rax" || inst3.getSize() != 3) {
+    std::cerr << "test_21: KO (modified code)" << std::endl;
+    return 1;
+  }
+
+  ctx.enableDecodeCache(false);
+  if (ctx.isDecodeCacheEnabled() || ctx.getCpuInstance()->getDecodeCache().getSize() != 0) {
+    std::cerr << "test_21: KO (disable)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_21: OK" << std::endl;
+  return 0;
+}
+
+int test_22(void) {
+  const char* code[] = {
+    "\x48\x01\xd8",  /* add rax, rbx */
+    "\x48\x31\xc1",  /* xor rcx, rax */
+    "\xff\xc3",      /* inc ebx */
+    "\x48\x39\xc8",  /* cmp rax, rcx */
+  };
+  triton::uint32 sizes[] = {3, 3, 2, 3};
+
+  triton::Context ref(triton::arch::ARCH_X86_64);
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  ctx.enableSemanticsCache(true);
+  for (auto* c : {&ref, &ctx}) {
+    c->setConcreteRegisterValue(c->registers.x86_rax, 0x1234);
+    c->setConcreteRegisterValue(c->registers.x86_rbx, 0x10);
+    c->symbolizeRegister(c->registers.x86_rbx);
+  }
+
+  for (triton::uint32 round = 0; round < 3; round++) {
+    for (triton::uint32 i = 0; i < 4; i++) {
+      for (auto* c : {&ref, &ctx}) {
+        triton::arch::Instruction inst(0x1000 + i * 4, (const unsigned char*)code[i], sizes[i]);
+        c->processing(inst);
+      }
+    }
+    /* The taint is spread by the semantics, tainted inputs are not replayed */
+    if (round == 1) {
+      ref.taintRegister(ref.registers.x86_rcx);
+      ctx.taintRegister(ctx.registers.x86_rcx);
+    }
+  }
+
+  if (ctx.getSemanticsCacheSize() != 4) {
+    std::cerr << "test_22: KO (cache size)" << std::endl;
+    return 1;
+  }
+
+  for (const auto& reg : {triton::arch::ID_REG_X86_RAX, triton::arch::ID_REG_X86_RBX, triton::arch::ID_REG_X86_RCX, triton::arch::ID_REG_X86_ZF, triton::arch::ID_REG_X86_CF}) {
+    auto expr1 = ref.getSymbolicRegister(ref.getRegister(reg));
+    auto expr2 = ctx.getSymbolicRegister(ctx.getRegister(reg));
+    if (ref.getConcreteRegisterValue(ref.getRegister(reg)) != ctx.getConcreteRegisterValue(ctx.getRegister(reg)) ||
+        ref.isRegisterTainted(ref.getRegister(reg)) != ctx.isRegisterTainted(ctx.getRegister(reg)) ||
+        triton::ast::unroll(expr1->getAst())->getHash() != triton::ast::unroll(expr2->getAst())->getHash()) {
+      std::cerr << "test_22: KO (" << ref.getRegister(reg).getName() << ")" << std::endl;
+      return 1;
+    }
+  }
+
+  ctx.enableSemanticsCache(false);
+  if (ctx.isSemanticsCacheEnabled() || ctx.getSemanticsCacheSize() != 0) {
+    std::cerr << "test_22: KO (disable)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_22: OK" << std::endl;
+  return 0;
+}
+
+int test_23(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  std::vector<triton::uint8> code;
+
+  /* add rax, rbx; xor rcx, rax; ret */
+  for (triton::uint32 i = 0; i < 0x1000; i++)
+    code.insert(code.end(), {0x48, 0x01, 0xd8, 0x48, 0x31, 0xc1, 0xc3});
+  ctx.setConcreteMemoryAreaValue(0x10000, code);
+
+  /* Chunks start in the middle of instructions, the result must not depend on the number of threads */
+  auto serial   = ctx.disassemblyBlocks(0x10000, code.size(), 1);
+  auto parallel = ctx.disassemblyBlocks(0x10000, code.size(), 8);
+
+  if (serial.size() != 0x1000 || parallel.size() != serial.size()) {
+    std::cerr << "test_23: KO (" << serial.size() << " and " << parallel.size() << " blocks)" << std::endl;
+    return 1;
+  }
+
+  for (triton::usize i = 0; i < serial.size(); i++) {
+    if (parallel[i].getSize() != 3 || parallel[i].getFirstAddress() != 0x10000 + i * 7 ||
+        parallel[i].getLastAddress() != serial[i].getLastAddress()) {
+      std::cerr << "test_23: KO (block " << i << ")" << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "test_23: OK" << std::endl;
+  return 0;
+}
+
+int test_24(void) {
+  struct {
+    triton::arch::architecture_e arch;
+    triton::arch::register_e input;
+    std::vector<std::string> code;
+    std::vector<triton::arch::register_e> regs;
+    bool sameAst;
+  } tests[] = {
+    {
+      triton::arch::ARCH_AARCH64,
+      triton::arch::ID_REG_AARCH64_X1,
+      {
+        std::string("\x20\x00\x02\xab", 4), /* adds x0, x1, x2 */
+        std::string("\x03\x00\x01\xeb", 4), /* subs x3, x0, x1 */
+        std::string("\x1f\x00\x03\xeb", 4), /* cmp x0, x3 */
+        std::string("\x40\x00\x00\x54", 4), /* b.eq #8 */
+      },
+      {triton::arch::ID_REG_AARCH64_X0, triton::arch::ID_REG_AARCH64_N, triton::arch::ID_REG_AARCH64_Z, triton::arch::ID_REG_AARCH64_C, triton::arch::ID_REG_AARCH64_V},
+      true,
+    },
+    {
+      triton::arch::ARCH_ARM32,
+      triton::arch::ID_REG_ARM32_R1,
+      {
+        std::string("\x02\x00\x91\xe0", 4), /* adds r0, r1, r2 */
+        std::string("\x01\x30\x50\xe0", 4), /* subs r3, r0, r1 */
+        std::string("\x03\x00\x50\xe1", 4), /* cmp r0, r3 */
+        std::string("\x01\x00\x90\x00", 4), /* addseq r0, r0, r1 */
+      },
+      {triton::arch::ID_REG_ARM32_R0, triton::arch::ID_REG_ARM32_N, triton::arch::ID_REG_ARM32_Z, triton::arch::ID_REG_ARM32_C, triton::arch::ID_REG_ARM32_V},
+      /* Deferred flags of unconditional instructions do not select the previous value */
+      false,
+    },
+  };
+
+  for (const auto& test : tests) {
+    triton::Context ref(test.arch);
+    triton::Context ctx(test.arch);
+
+    ctx.setMode(triton::modes::LAZY_FLAGS, true);
+    for (auto* c : {&ref, &ctx}) {
+      c->setConcreteRegisterValue(c->getRegister(test.input), 0x10);
+      c->symbolizeRegister(c->getRegister(test.input));
+      triton::uint64 addr = 0x1000;
+      for (const auto& opcode : test.code) {
+        triton::arch::Instruction inst(addr, opcode.data(), static_cast<triton::uint32>(opcode.size()));
+        c->processing(inst);
+        addr += inst.getSize();
+      }
+    }
+
+    /* Flags overwritten before being read never get an expression */
+    if (ctx.getSymbolicExpressions().size() >= ref.getSymbolicExpressions().size()) {
+      std::cerr << "test_24: KO (no flag deferred)" << std::endl;
+      return 1;
+    }
+
+    for (const auto& reg : test.regs) {
+      auto expr1 = ref.getSymbolicRegister(ref.getRegister(reg));
+      auto expr2 = ctx.getSymbolicRegister(ctx.getRegister(reg));
+      if (ref.getConcreteRegisterValue(ref.getRegister(reg)) != ctx.getConcreteRegisterValue(ctx.getRegister(reg)) ||
+          ref.isRegisterSymbolized(ref.getRegister(reg)) != ctx.isRegisterSymbolized(ctx.getRegister(reg)) ||
+          (test.sameAst && triton::ast::unroll(expr1->getAst())->getHash() != triton::ast::unroll(expr2->getAst())->getHash())) {
+        std::cerr << "test_24: KO (" << ref.getRegister(reg).getName() << ")" << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  std::cout << "test_24: OK" << std::endl;
+  return 0;
+}
+
+int test_25(void) {
+  /* A loop with loads, stores, calls and branches */
+  std::string code("\x48\xb8\x88\x77\x66\x55\x44\x33\x22\x11\x48\xc7\xc1\x0a\x00\x00\x00\x50\x48\x01\xc8\x35\x34\x12\x00\x00\x48\x83\xec\x10"
+                   "\x48\x89\x04\x24\x8b\x1c\x24\x0f\xb6\x7c\x24\x01\x48\x8d\x54\x88\x08\x48\xf7\xda\x48\x83\xc4\x10\x48\x39\xda\x48\xff"
+                   "\xc9\x75\xd4\x5e\x48\x85\xf6\xe8\x02\x00\x00\x00\xeb\x04\x49\xff\xc0\xc3\x90", 78);
+
+  for (bool symbolic : {false, true}) {
+    triton::Context ref(triton::arch::ARCH_X86_64);
+    triton::Context ctx(triton::arch::ARCH_X86_64);
+
+    ctx.setMode(triton::modes::CONCRETE_FAST_PATH, true);
+    for (auto* c : {&ref, &ctx}) {
+      c->setConcreteRegisterValue(c->registers.x86_rsp, 0x7000);
+      c->setConcreteRegisterValue(c->registers.x86_r8, 0x41);
+      if (symbolic)
+        c->symbolizeRegister(c->registers.x86_r8);
+
+      triton::uint64 pc = 0x1000;
+      while (pc < 0x1000 + code.size()) {
+        triton::uint64 offset = pc - 0x1000;
+        triton::arch::Instruction inst(pc, code.data() + offset, static_cast<triton::uint32>(std::min<triton::uint64>(16, code.size() - offset)));
+        c->processing(inst);
+        pc = static_cast<triton::uint64>(c->getConcreteRegisterValue(c->registers.x86_rip));
+      }
+    }
+
+    for (const auto* reg : {&ref.registers.x86_rax, &ref.registers.x86_rbx, &ref.registers.x86_rcx, &ref.registers.x86_rdx,
+                            &ref.registers.x86_rsi, &ref.registers.x86_rdi, &ref.registers.x86_rsp, &ref.registers.x86_rip,
+                            &ref.registers.x86_r8, &ref.registers.x86_cf, &ref.registers.x86_of, &ref.registers.x86_pf,
+                            &ref.registers.x86_sf, &ref.registers.x86_zf}) {
+      if (ref.getConcreteRegisterValue(*reg) != ctx.getConcreteRegisterValue(*reg) || ref.isRegisterSymbolized(*reg) != ctx.isRegisterSymbolized(*reg)) {
+        std::cerr << "test_25: KO (" << reg->getName() << ")" << std::endl;
+        return 1;
+      }
+    }
+
+    if (ref.getConcreteMemoryAreaValue(0x6fe0, 0x20) != ctx.getConcreteMemoryAreaValue(0x6fe0, 0x20)) {
+      std::cerr << "test_25: KO (stack)" << std::endl;
+      return 1;
+    }
+
+    /* Only the instruction reading the symbolic register goes through the semantics */
+    if (ctx.getSymbolicExpressions().empty() == symbolic || ctx.getSymbolicExpressions().size() >= ref.getSymbolicExpressions().size()) {
+      std::cerr << "test_25: KO (expressions)" << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "test_25: OK" << std::endl;
+  return 0;
+}
+
+#ifdef TRITON_LLVM_INTERFACE
+int test_26(void) {
+  /* add rax, rbx; xor rbx, rax; sub rdx, rax; mov rsi, rdx; dec rcx; jne loop */
+  triton::arch::BasicBlock block({
+    triton::arch::Instruction("\x48\x01\xd8", 3),
+    triton::arch::Instruction("\x48\x31\xc3", 3),
+    triton::arch::Instruction("\x48\x29\xc2", 3),
+    triton::arch::Instruction("\x48\x89\xd6", 3),
+    triton::arch::Instruction("\x48\xff\xc9", 3),
+    triton::arch::Instruction("\x75\xef", 2)
+  });
+
+  triton::Context ref(triton::arch::ARCH_X86_64);
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  ctx.setMode(triton::modes::PC_TRACKING_SYMBOLIC, true);
+  for (auto* c : {&ref, &ctx}) {
+    triton::arch::BasicBlock bb = block;
+
+    c->setConcreteRegisterValue(c->registers.x86_rax, 1);
+    c->setConcreteRegisterValue(c->registers.x86_rbx, 0x1234);
+    c->setConcreteRegisterValue(c->registers.x86_rcx, 100);
+    c->setConcreteRegisterValue(c->registers.x86_rdx, 3);
+
+    /* The second half of the loop runs on a symbolic rbx */
+    for (triton::uint32 index = 0; index < 100; index++) {
+      if (index == 50)
+        c->symbolizeRegister(c->registers.x86_rbx);
+      if (c == &ctx)
+        ctx.processingJit(bb, 0x1000);
+      else
+        ref.processing(bb, 0x1000);
+    }
+  }
+
+  for (const auto* reg : {&ref.registers.x86_rax, &ref.registers.x86_rbx, &ref.registers.x86_rcx, &ref.registers.x86_rdx,
+                          &ref.registers.x86_rsi, &ref.registers.x86_rip, &ref.registers.x86_af, &ref.registers.x86_cf,
+                          &ref.registers.x86_of, &ref.registers.x86_pf, &ref.registers.x86_sf, &ref.registers.x86_zf}) {
+    if (ref.getConcreteRegisterValue(*reg) != ctx.getConcreteRegisterValue(*reg) || ref.isRegisterSymbolized(*reg) != ctx.isRegisterSymbolized(*reg)) {
+      std::cerr << "test_26: KO (" << reg->getName() << ")" << std::endl;
+      return 1;
+    }
+  }
+
+  if (ctx.getJitCacheSize() != 1) {
+    std::cerr << "test_26: KO (cache)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_26: OK" << std::endl;
+  return 0;
+}
+#endif
+
+int test_27(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  triton::arch::BasicBlock block;
+
+  /* Instructions moved into the block keep their state */
+  triton::arch::Instruction inst(0x1000, "\x48\x01\xd8", 3);
+  ctx.processing(inst);
+  block.add(std::move(inst));
+  block.add(triton::arch::Instruction("\x48\x31\xc3", 3));
+
+  triton::arch::BasicBlock moved(std::move(block));
+  auto& insts = moved.getInstructions();
+  if (moved.getSize() != 2 || insts[0].getDisassembly() != "add rax, rbx" || insts[0].getWrittenRegisters().empty() || insts[1].getAddress() != 0x1003) {
+    std::cerr << "test_27: KO (move)" << std::endl;
+    return 1;
+  }
+
+  /* The blocks built from the disassembly of an area own their instructions */
+  ctx.setConcreteMemoryAreaValue(0x2000, reinterpret_cast<const triton::uint8*>("\x48\x01\xd8\xc3\x90"), 5);
+  auto blocks = ctx.disassemblyBlocks(0x2000, 5);
+  if (blocks.size() != 2 || blocks[0].getSize() != 2 || blocks[1].getFirstAddress() != 0x2004 || blocks[0].getInstructions()[1].getDisassembly() != "ret") {
+    std::cerr << "test_27: KO (disassembly)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_27: OK" << std::endl;
+  return 0;
+}
+
+int test_28(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+  auto x   = ast->variable(ctx.newSymbolicVariable(8));
+
+  /* Identical sub-trees are different nodes by default */
+  if (ast->bvadd(x, ast->bv(1, 8)) == ast->bvadd(x, ast->bv(1, 8))) {
+    std::cerr << "test_28: KO (default)" << std::endl;
+    return 1;
+  }
+
+  /* Identical sub-trees are one node once hash-consed */
+  ctx.setMode(triton::modes::AST_HASH_CONSING, true);
+  auto n1 = ast->bvmul(ast->bvadd(x, ast->bv(1, 8)), x);
+  auto n2 = ast->bvmul(ast->bvadd(x, ast->bv(1, 8)), x);
+  auto n3 = ast->bvmul(ast->bvadd(x, ast->bv(2, 8)), x);
+  if (n1 != n2 || n1 == n3 || n1->getChildren()[0] != n2->getChildren()[0] || n1->getChildren()[0] == n3->getChildren()[0]) {
+    std::cerr << "test_28: KO (hash-consing)" << std::endl;
+    return 1;
+  }
+
+  /* The semantics built over shared nodes do not change */
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rax, 5);
+  ctx.symbolizeRegister(ctx.registers.x86_rax);
+  triton::arch::Instruction inst1(0x1000, "\x48\x83\xc0\x01", 4);
+  triton::arch::Instruction inst2(0x1004, "\x48\x83\xc0\x01", 4);
+  ctx.processing(inst1);
+  ctx.processing(inst2);
+  if (ctx.getConcreteRegisterValue(ctx.registers.x86_rax) != 7 || ctx.getSymbolicRegister(ctx.registers.x86_rax)->getAst()->evaluate() != 7) {
+    std::cerr << "test_28: KO (semantics)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_28: OK" << std::endl;
+  return 0;
+}
+
+int test_29(void) {
+  triton::ast::SharedAbstractNode node;
+
+  {
+    triton::Context ctx(triton::arch::ARCH_X86_64);
+    ctx.setMode(triton::modes::AST_SLAB_ALLOCATOR, true);
+    ctx.setConcreteRegisterValue(ctx.registers.x86_rax, 5);
+    ctx.symbolizeRegister(ctx.registers.x86_rax);
+
+    /* The nodes freed by each instruction are reused by the next ones */
+    for (triton::uint64 index = 0; index < 1000; index++) {
+      triton::arch::Instruction inst(0x1000 + index * 4, "\x48\x83\xc0\x01", 4);
+      ctx.processing(inst);
+    }
+
+    node = ctx.getSymbolicRegister(ctx.registers.x86_rax)->getAst();
+    if (node->evaluate() != 1005) {
+      std::cerr << "test_29: KO (semantics)" << std::endl;
+      return 1;
+    }
+  }
+
+  /* The slabs live as long as their nodes */
+  if (node->evaluate() != 1005 || node->getBitvectorSize() != 64) {
+    std::cerr << "test_29: KO (lifetime)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_29: OK" << std::endl;
+  return 0;
+}
+
+int test_30(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+
+  /* Nodes of 64 bits or less are evaluated natively, wider ones keep the multiprecision arithmetic */
+  auto n1 = ast->bvadd(ast->bv(0xffffffffffffffff, 64), ast->bv(2, 64));
+  auto n2 = ast->bvadd(ast->zx(1, ast->bv(0xffffffffffffffff, 64)), ast->bv(2, 65));
+  auto n3 = ast->extract(64, 1, n2);
+  auto n4 = ast->bvashr(ast->bv(0x80, 8), ast->bv(3, 8));
+  auto n5 = ast->bvslt(ast->bv(0xffffffffffffffff, 64), ast->bv(0, 64));
+
+  if (n1->evaluate() != 1 || n1->evaluate64() != 1 || n2->evaluate() != (triton::uint512(1) << 64) + 1 || n2->evaluate64() != 1 ||
+      n3->evaluate() != 0x8000000000000000 || n3->isSigned() == false || n4->evaluate() != 0xf0 || n5->evaluate() != 1) {
+    std::cerr << "test_30: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_30: OK" << std::endl;
+  return 0;
+}
+
+int test_31(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+  auto x   = ast->bv(1, 8);
+  std::vector<triton::ast::SharedAbstractNode> nodes;
+
+  /* A parent using a node twice is listed once, until both uses are removed */
+  auto n = ast->bvxor(x, x);
+  x->removeParent(n.get());
+  if (x->getParents().size() != 1) {
+    std::cerr << "test_31: KO (uses)" << std::endl;
+    return 1;
+  }
+  x->removeParent(n.get());
+
+  /* High fan-in nodes keep all their parents, dead ones excepted */
+  for (triton::uint32 index = 0; index < 20; index++)
+    nodes.push_back(ast->bvadd(x, ast->bv(index, 8)));
+  if (x->getParents().size() != 20) {
+    std::cerr << "test_31: KO (fan-in)" << std::endl;
+    return 1;
+  }
+
+  nodes.resize(5);
+  if (x->getParents().size() != 5) {
+    std::cerr << "test_31: KO (dead parents)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_31: OK" << std::endl;
+  return 0;
+}
+
+int test_32(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+  triton::ast::WeakAbstractNode deep;
+
+  /* Deep ASTs are released without recursion as soon as they die */
+  {
+    triton::ast::SharedAbstractNode node = ast->variable(ctx.newSymbolicVariable(8));
+    while (node->getLevel() < 1000001) {
+      node = ast->bvadd(node, ast->bv(1, 8));
+      if (node->getLevel() == 10000)
+        deep = node;
+    }
+  }
+
+  if (deep.expired() == false) {
+    std::cerr << "test_32: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_32: OK" << std::endl;
+  return 0;
+}
+
+int test_33(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+
+  auto var1 = ctx.newSymbolicVariable(32);
+  auto var2 = ctx.newSymbolicVariable(32);
+  auto x    = ast->variable(var1);
+  auto y    = ast->variable(var2);
+  auto node = ast->bvmul(ast->bvadd(x, y), ast->bvsub(x, y));
+
+  /* The parents are initialized once, after all the updates */
+  ast->updateVariable(var1->getName(), 7, false);
+  ast->updateVariable(var2->getName(), 3, false);
+  ast->initDirtyNodes();
+  if (node->evaluate() != 40) {
+    std::cerr << "test_33: KO (" << node->evaluate() << " != 40)" << std::endl;
+    return 1;
+  }
+
+  node->getChildren()[1]->setChild(1, ast->bv(1, 32), false);
+  ast->initDirtyNodes();
+  if (node->evaluate() != 60) {
+    std::cerr << "test_33: KO (" << node->evaluate() << " != 60)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_33: OK" << std::endl;
+  return 0;
+}
+
+int test_34(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+  triton::uint32 id = 0;
+
+  /* The id of a destroyed node is given to the next one */
+  {
+    auto node = ast->bvadd(ast->variable(ctx.newSymbolicVariable(8)), ast->bv(1, 8));
+    id = node->getId();
+  }
+  auto node = ast->bv(2, 8);
+  if (node->getId() != id || ast->getNodeIdsSize() <= id) {
+    std::cerr << "test_34: KO (" << node->getId() << " != " << id << ")" << std::endl;
+    return 1;
+  }
+
+  /* A copy has its own id */
+  auto copy = triton::ast::newInstance(node.get());
+  if (copy->getId() == node->getId() || triton::ast::search(ast->bvadd(node, copy), triton::ast::BV_NODE).size() != 2) {
+    std::cerr << "test_34: KO (copy)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_34: OK" << std::endl;
+  return 0;
+}
+
+int test_35(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+
+  auto x = ast->variable(ctx.newSymbolicVariable(32));
+  auto y = ast->variable(ctx.newSymbolicVariable(32));
+  auto w = ast->variable(ctx.newSymbolicVariable(128));
+
+  std::vector<std::vector<triton::uint512>> inputs;
+  for (triton::uint64 i = 0; i < 100; i++)
+    inputs.push_back({i, i * 3 + 1, triton::uint512(i) << 100});
+
+  /* Nodes of 64 bits or less are evaluated by lanes, the others by updating the variables */
+  auto node1 = ast->bvadd(ast->bvmul(x, y), ast->bvlshr(x, ast->bv(1, 32)));
+  auto node2 = ast->extract(31, 0, ast->bvlshr(w, ast->bv(100, 128)));
+  auto res1  = ast->evaluateBatch(node1, {x, y, w}, inputs);
+  auto res2  = ast->evaluateBatch(node2, {x, y, w}, inputs);
+
+  for (triton::uint64 i = 0; i < 100; i++) {
+    if (res1[i] != (((i * (i * 3 + 1)) + (i >> 1)) & 0xffffffff) || res2[i] != i) {
+      std::cerr << "test_35: KO (" << res1[i] << ", " << res2[i] << ")" << std::endl;
+      return 1;
+    }
+  }
+
+  /* The variables keep their values */
+  if (node1->evaluate() != 0 || node2->evaluate() != 0) {
+    std::cerr << "test_35: KO (values not restored)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_35: OK" << std::endl;
+  return 0;
+}
+
+int test_36(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+
+  auto var1 = ctx.newSymbolicVariable(64);
+  auto var2 = ctx.newSymbolicVariable(128);
+  auto x    = ast->variable(var1);
+  auto y    = ast->variable(var2);
+  auto t    = ast->bvxor(x, ast->extract(63, 0, y));
+  auto node = ast->concat(ast->bvmul(t, t), ast->bvsdiv(t, ast->bv(3, 64)));
+
+  /* Shared subexpressions are computed once */
+  triton::ast::AstProgram program(node);
+  triton::uint512 initial = node->evaluate();
+  for (triton::uint64 i = 1; i < 100; i++) {
+    triton::uint512 value = program.eval({{var1->getId(), i}, {var2->getId(), triton::uint512(i) << 70 | 5}});
+    ast->updateVariable(var1->getName(), i);
+    ast->updateVariable(var2->getName(), triton::uint512(i) << 70 | 5);
+    if (value != node->evaluate()) {
+      std::cerr << "test_36: KO (" << value << " != " << node->evaluate() << ")" << std::endl;
+      return 1;
+    }
+  }
+
+  /* The variables not given keep their value at compilation */
+  if (program.eval({}) != initial) {
+    std::cerr << "test_36: KO (default values)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_36: OK" << std::endl;
+  return 0;
+}
+
+int test_37(void) {
+  triton::Context ctx1(triton::arch::ARCH_X86_64);
+  triton::Context ctx2(triton::arch::ARCH_X86_64);
+  auto ast = ctx1.getAstContext();
+
+  auto var  = ctx1.newSymbolicVariable(64, "x");
+  auto x    = ast->variable(var);
+  auto e1   = ctx1.newSymbolicExpression(ast->bvmul(x, ast->bv(3, 64)), "e1");
+  auto e2   = ctx1.newSymbolicExpression(ast->bvadd(ast->reference(e1), ast->reference(e1)), "e2");
+
+  ast->updateVariable(var->getName(), 7);
+
+  std::stringstream stream;
+  triton::ast::serialize(stream, std::vector<triton::engines::symbolic::SharedSymbolicExpression>{e2});
+
+  auto exprs = triton::ast::deserializeExpressions(stream, ctx2.getAstContext());
+  if (exprs.size() != 1 || exprs[0]->getId() != e2->getId() || exprs[0]->getComment() != "e2") {
+    std::cerr << "test_37: KO (expressions)" << std::endl;
+    return 1;
+  }
+
+  /* Both references point to the same expression */
+  const auto& children = exprs[0]->getAst()->getChildren();
+  auto r1 = reinterpret_cast<triton::ast::ReferenceNode*>(children[0].get())->getSymbolicExpression();
+  auto r2 = reinterpret_cast<triton::ast::ReferenceNode*>(children[1].get())->getSymbolicExpression();
+  if (r1 != r2 || r1->getComment() != "e1" || exprs[0]->getAst()->evaluate() != 42) {
+    std::cerr << "test_37: KO (references)" << std::endl;
+    return 1;
+  }
+
+  /* Garbage is rejected */
+  std::stringstream garbage("TAS");
+  try {
+    triton::ast::deserializeNodes(garbage, ctx2.getAstContext());
+    std::cerr << "test_37: KO (garbage)" << std::endl;
+    return 1;
+  }
+  catch (const triton::exceptions::Ast&) {
+  }
+
+  std::cout << "test_37: OK" << std::endl;
+  return 0;
+}
+
+int test_38(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+
+  auto x  = ast->variable(ctx.newSymbolicVariable(32));
+  auto y  = ast->variable(ctx.newSymbolicVariable(32));
+  auto t  = ast->bvadd(ast->bvand(x, y), ast->bvor(y, x));
+  auto n1 = ast->bvadd(ast->bvadd(t, ast->bv(1, 32)), ast->bv(2, 32));
+  auto n2 = ast->extract(15, 0, ast->concat(ast->bv(0, 32), ast->bvsub(ast->bvor(t, x), ast->bvand(x, t))));
+
+  ctx.addBuiltinRewriteRules();
+  ctx.addRewriteRule("(bvsub (bvadd x y) y)", "x");
+
+  auto s1 = ctx.simplify(n1);
+  auto s2 = ctx.simplify(n2);
+  auto s3 = ctx.simplify(ast->bvsub(ast->bvadd(x, y), y));
+  if (s1->getType() != triton::ast::BVADD_NODE || triton::ast::search(s1, triton::ast::BVAND_NODE).size() || s1->evaluate() != n1->evaluate()) {
+    std::cerr << "test_38: KO (" << s1 << ")" << std::endl;
+    return 1;
+  }
+
+  if (s2->getType() != triton::ast::EXTRACT_NODE || s2->getChildren()[2]->getType() != triton::ast::BVXOR_NODE) {
+    std::cerr << "test_38: KO (" << s2 << ")" << std::endl;
+    return 1;
+  }
+
+  if (s3 != x) {
+    std::cerr << "test_38: KO (" << s3 << ")" << std::endl;
+    return 1;
+  }
+
+  /* The original nodes are not modified */
+  if (n1->getChildren()[0]->getChildren()[0] != t) {
+    std::cerr << "test_38: KO (original modified)" << std::endl;
+    return 1;
+  }
+
+  try {
+    ctx.addRewriteRule("(bvadd x y)", "z");
+    std::cerr << "test_38: KO (unbound name)" << std::endl;
+    return 1;
+  }
+  catch (const triton::exceptions::Ast&) {
+  }
+
+  ctx.clearRewriteRules();
+  if (ctx.simplify(n1) != n1) {
+    std::cerr << "test_38: KO (clearRewriteRules)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_38: OK" << std::endl;
+  return 0;
+}
+
+int test_39(void) {
+  triton::Context ctx1(triton::arch::ARCH_X86_64);
+  triton::Context ctx2(triton::arch::ARCH_X86_64);
+  triton::arch::Instruction inst((const unsigned char*)"\x48\x01\xc0", 3); /* add rax, rax */
+
+  ctx1.setAstBudget(0, 20);
+  ctx2.setAstBudget(0, 20);
+  ctx2.setAstBudgetPolicy(triton::engines::symbolic::BUDGET_RECORD);
+
+  for (auto* ctx : {&ctx1, &ctx2}) {
+    ctx->setConcreteRegisterValue(ctx->registers.x86_rax, 1);
+    ctx->symbolizeRegister(ctx->registers.x86_rax);
+    for (triton::uint32 i = 0; i < 40; i++) {
+      triton::arch::Instruction copy = inst;
+      ctx->processing(copy);
+    }
+  }
+
+  /* The ASTs stay bounded and the concrete value is kept */
+  const auto& events = ctx1.getAstBudgetEvents();
+  if (events.empty() || events.front().concretized == false ||
+      ctx1.getRegisterAst(ctx1.registers.x86_rax)->getLevel() > 22 ||
+      ctx1.getConcreteRegisterValue(ctx1.registers.x86_rax) != (triton::uint64(1) << 40)) {
+    std::cerr << "test_39: KO (concretize)" << std::endl;
+    return 1;
+  }
+
+  /* The expressions are only recorded */
+  if (ctx2.getAstBudgetEvents().empty() || ctx2.getAstBudgetEvents().front().concretized ||
+      ctx2.isRegisterSymbolized(ctx2.registers.x86_rax) == false ||
+      ctx2.getConcreteRegisterValue(ctx2.registers.x86_rax) != (triton::uint64(1) << 40)) {
+    std::cerr << "test_39: KO (record)" << std::endl;
+    return 1;
+  }
+
+  ctx1.clearAstBudgetEvents();
+  if (ctx1.getAstBudgetEvents().size() != 0) {
+    std::cerr << "test_39: KO (clear)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_39: OK" << std::endl;
+  return 0;
+}
+
+int test_40(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+  auto var   = ast->variable(ctx.newSymbolicVariable(32));
+  auto first = ast->bvxor(var, ast->bvshl(var, ast->bv(1, 32)));
+  auto node  = first;
+
+  /* 2^40 nodes when printed as a tree */
+  for (triton::uint32 i = 1; i < 40; i++)
+    node = ast->bvxor(node, ast->bvshl(node, ast->bv(1, 32)));
+  auto expr = ctx.newSymbolicExpression(node);
+
+  std::ostringstream smt;
+  std::ostringstream python;
+  ctx.liftToSMT(smt, expr);
+  ctx.liftToPython(python, expr);
+
+  if (smt.str().size() > 10000 || smt.str().find("(define-fun tmp!38 () (_ BitVec 32) (bvxor tmp!37 (bvshl tmp!37 (_ bv1 32))))") == std::string::npos) {
+    std::cerr << "test_40: KO (smt)" << std::endl;
+    return 1;
+  }
+
+  if (python.str().size() > 10000 || python.str().find("tmp_38 = (tmp_37 ^ ((tmp_37 << 0x1) & 0x") == std::string::npos) {
+    std::cerr << "test_40: KO (python)" << std::endl;
+    return 1;
+  }
+
+  /* The temporaries are forgotten after the lifting */
+  std::ostringstream plain;
+  plain << first;
+  if (plain.str().find("tmp") != std::string::npos) {
+    std::cerr << "test_40: KO (clear)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_40: OK" << std::endl;
+  return 0;
+}
+
+int test_41(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast  = ctx.getAstContext();
+  auto var  = ctx.newSymbolicVariable(32);
+  auto node = ast->bvadd(ast->variable(var), ast->bv(1, 32));
+
+  /* The variables are mapped by id, the names are a thin wrapper */
+  ast->updateVariable(var->getId(), 41);
+  if (node->evaluate() != 42 || ast->getVariableValue(var->getName()) != 41 || ctx.getConcreteVariableValue(var) != 41) {
+    std::cerr << "test_41: KO (id)" << std::endl;
+    return 1;
+  }
+
+  ast->updateVariable(var->getName(), 9);
+  if (node->evaluate() != 10 || ast->getVariableValue(var->getId()) != 9) {
+    std::cerr << "test_41: KO (name)" << std::endl;
+    return 1;
+  }
+
+  try {
+    ast->getVariableValue(var->getId() + 100);
+    std::cerr << "test_41: KO (unknown)" << std::endl;
+    return 1;
+  }
+  catch (const triton::exceptions::Ast&) {
+  }
+
+  std::cout << "test_41: OK" << std::endl;
+  return 0;
+}
+
+int test_42(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast  = ctx.getAstContext();
+  auto var1 = ctx.newSymbolicVariable(32);
+  auto var2 = ctx.newSymbolicVariable(32);
+  auto x    = ast->variable(var1);
+  auto y    = ast->variable(var2);
+  auto expr = ctx.newSymbolicExpression(ast->bvmul(x, y));
+  auto node = ast->bvadd(ast->reference(expr), x);
+
+  ctx.setConcreteVariableValue(var1, 2);
+  ctx.setConcreteVariableValue(var2, 3);
+
+  /* What if x = 10, y keeping its value */
+  std::unordered_map<triton::usize, triton::uint512> model = {{var1->getId(), 10}};
+  if (ctx.evaluateAstViaModel(node, model) != 40 || ast->evaluate(node, {{var2->getId(), 5}}) != 12) {
+    std::cerr << "test_42: KO (model)" << std::endl;
+    return 1;
+  }
+
+  /* Nothing is modified */
+  if (node->evaluate() != 8 || ctx.getConcreteVariableValue(var1) != 2) {
+    std::cerr << "test_42: KO (modified)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_42: OK" << std::endl;
+  return 0;
+}
+
+
+int test_43(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+  auto vx  = ctx.newSymbolicVariable(32);
+  auto vy  = ctx.newSymbolicVariable(32);
+  auto x   = ast->variable(vx);
+  auto y   = ast->variable(vy);
+
+  /* The order of the operands only matters for the non-commutative operators */
+  auto add1 = ast->bvadd(x, y);
+  auto add2 = ast->bvadd(y, x);
+  auto sub1 = ast->bvsub(x, y);
+  auto sub2 = ast->bvsub(y, x);
+  if (add1->getHash64() != add2->getHash64() || sub1->getHash64() == sub2->getHash64() || add1->getHash() != add1->getHash64()) {
+    std::cerr << "test_43: KO (64-bit hash)" << std::endl;
+    return 1;
+  }
+
+  /* The sizes and the leaf values are hashed */
+  if (ast->bv(1, 8)->getHash64() == ast->bv(1, 16)->getHash64() || ast->bv(1, 8)->getHash64() == ast->bv(2, 8)->getHash64()) {
+    std::cerr << "test_43: KO (leaves)" << std::endl;
+    return 1;
+  }
+
+  ctx.setMode(triton::modes::AST_WIDE_HASH, true);
+  auto add3 = ast->bvadd(x, y);
+  auto add4 = ast->bvadd(y, x);
+  if (add3->getHash() != add4->getHash() || add3->getHash64() != add1->getHash64() || add3->getHash() == add3->getHash64()) {
+    std::cerr << "test_43: KO (512-bit hash)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_43: OK" << std::endl;
+  return 0;
+}
+
+
+int test_44(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+
+  /* The small constants are shared */
+  auto one = ast->bv(1, 8);
+  if (one != ast->bv(1, 8) || one == ast->bv(1, 16) || ast->bv(100, 8) == ast->bv(100, 8) || ast->integer(8) != one->getChildren()[1]) {
+    std::cerr << "test_44: KO (shared)" << std::endl;
+    return 1;
+  }
+
+  /* Once released, a new node is built */
+  triton::ast::WeakAbstractNode weak = one;
+  one = nullptr;
+  if (!weak.expired() || ast->bv(1, 8)->evaluate() != 1) {
+    std::cerr << "test_44: KO (released)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_44: OK" << std::endl;
+  return 0;
+}
+
+
+int test_45(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  ctx.setMode(triton::modes::ALIGNED_MEMORY, true);
+
+  /* A large buffer and an aligned qword */
+  ctx.symbolizeMemory(0x10000, 0x10000);
+  ctx.symbolizeMemory(triton::arch::MemoryAccess(0x30000, triton::size::qword));
+  if (ctx.getSymbolicMemory().size() != 0x10008 || ctx.getMemoryAst(triton::arch::MemoryAccess(0x30000, triton::size::qword))->getType() != triton::ast::VARIABLE_NODE) {
+    std::cerr << "test_45: KO (symbolize)" << std::endl;
+    return 1;
+  }
+
+  /* A partial overwrite drops the aligned qword */
+  ctx.concretizeMemory(0x30003);
+  if (ctx.getSymbolicMemory(0x30003) != nullptr || ctx.getMemoryAst(triton::arch::MemoryAccess(0x30000, triton::size::qword))->getType() != triton::ast::CONCAT_NODE) {
+    std::cerr << "test_45: KO (overwrite)" << std::endl;
+    return 1;
+  }
+
+  /* Writing an area concretizes its cells only */
+  std::vector<triton::uint8> area(0x8000, 0x41);
+  ctx.writeConcreteMemory(0x18000, area.data(), area.size());
+  if (ctx.getSymbolicMemory().size() != 0x8007 || ctx.getSymbolicMemory(0x17fff) == nullptr || ctx.getSymbolicMemory(0x18000) != nullptr) {
+    std::cerr << "test_45: KO (area)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_45: OK" << std::endl;
+  return 0;
+}
+
+
+int test_46(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+  auto e1  = ctx.newSymbolicExpression(ast->variable(ctx.newSymbolicVariable(32)));
+  auto e2  = ctx.newSymbolicExpression(ast->bvadd(ast->reference(e1), ast->bv(1, 32)));
+  auto e3  = ctx.newSymbolicExpression(ast->bvmul(ast->reference(e2), ast->reference(e1)));
+  auto e4  = ctx.newSymbolicExpression(ast->bvxor(ast->reference(e1), ast->bv(5, 32)));
+  auto e5  = ctx.newSymbolicExpression(ast->bv(0, 32));
+
+  /* The union of the slices, the shared history is walked once */
+  auto slice = ctx.sliceExpressions(std::vector<triton::engines::symbolic::SharedSymbolicExpression>{e3, e4});
+  if (slice.size() != 4 || slice.count(e5->getId()) || !slice.count(e1->getId()) || !slice.count(e2->getId())) {
+    std::cerr << "test_46: KO (union)" << std::endl;
+    return 1;
+  }
+
+  if (ctx.sliceExpressions(e4).size() != 2 || ctx.sliceExpressions(e3).size() != 3) {
+    std::cerr << "test_46: KO (single)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_46: OK" << std::endl;
+  return 0;
+}
+
+int test_47(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  triton::arch::Instruction inst(0x1000, "\x48\x01\xd8", 3); /* add rax, rbx */
+  ctx.processing(inst);
+
+  /* One formatted disassembly and one copy of each comment for all the expressions */
+  const auto& exprs = inst.symbolicExpressions;
+  if (exprs.size() < 2 || &exprs[0]->getDisassembly() != &exprs[1]->getDisassembly() || exprs[0]->getDisassembly() != "0x1000: add rax, rbx") {
+    std::cerr << "test_47: KO (disassembly)" << std::endl;
+    return 1;
+  }
+
+  triton::arch::Instruction inst2(0x1003, "\x48\x01\xd8", 3);
+  ctx.processing(inst2);
+  if (&inst.symbolicExpressions[0]->getComment() != &inst2.symbolicExpressions[0]->getComment()) {
+    std::cerr << "test_47: KO (comment)" << std::endl;
+    return 1;
+  }
+
+  auto e = ctx.newSymbolicExpression(ctx.getAstContext()->bv(1, 8));
+  if (!e->getComment().empty() || !e->getDisassembly().empty()) {
+    std::cerr << "test_47: KO (empty)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_47: OK" << std::endl;
+  return 0;
+}
+
+int test_48(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  ctx.setMode(triton::modes::AST_OPTIMIZATIONS, true);
+  auto ast = ctx.getAstContext();
+
+  /* Selects skip the stores to provably distinct indexes */
+  auto v1 = ast->variable(ctx.newSymbolicVariable(8));
+  auto v2 = ast->variable(ctx.newSymbolicVariable(8));
+  auto v3 = ast->variable(ctx.newSymbolicVariable(8));
+  auto x  = ast->variable(ctx.newSymbolicVariable(64));
+  auto s1 = ast->store(ast->array(64), ast->bv(0x10, 64), v1);
+  auto s2 = ast->store(s1, ast->bv(0x11, 64), v2);
+  auto s3 = ast->store(s2, ast->bvadd(x, ast->bv(1, 64)), v3);
+  if (ast->select(s2, ast->bv(0x10, 64)) != v1 || ast->select(s3, ast->bvadd(x, ast->bv(1, 64))) != v3) {
+    std::cerr << "test_48: KO (resolve)" << std::endl;
+    return 1;
+  }
+
+  /* The symbolic index may alias the concrete one */
+  auto sel = ast->select(s3, ast->bv(0x10, 64));
+  if (sel->getType() != triton::ast::SELECT_NODE || sel->getChildren()[0] != s3) {
+    std::cerr << "test_48: KO (alias)" << std::endl;
+    return 1;
+  }
+
+  /* The store chain of the memory array stays bounded by the stored addresses */
+  ctx.setMode(triton::modes::MEMORY_ARRAY, true);
+  for (triton::uint32 i = 0; i < 4000; i++) {
+    auto e = ctx.newSymbolicExpression(ast->bv(i & 0xff, 8));
+    ctx.assignSymbolicExpressionToMemory(e, triton::arch::MemoryAccess(0x1000 + (i & 1), triton::size::byte));
+  }
+
+  auto cell = ctx.getMemoryAst(triton::arch::MemoryAccess(0x1000, triton::size::byte));
+  auto last = ctx.getSymbolicMemory(0x1001);
+  if (cell->evaluate() != (3998 & 0xff) || last == nullptr || last->getAst()->getLevel() > 1100) {
+    std::cerr << "test_48: KO (compaction)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_48: OK" << std::endl;
+  return 0;
+}
+
+int test_49(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  /* The stubs of memcpy and strlen */
+  std::map<std::string, triton::uint64> stubs = {{"memcpy", 0x10}, {"strlen", 0x20}, {"puts", 0x30}};
+  if (ctx.setFunctionSummaries(0x400000, stubs) != 2 || ctx.getFunctionSummaries().at(0x400020) != "strlen") {
+    std::cerr << "test_49: KO (stubs)" << std::endl;
+    return 1;
+  }
+
+  auto call = [&ctx](triton::uint64 stub, triton::uint64 a0, triton::uint64 a1, triton::uint64 a2) {
+    triton::uint64 rsp = static_cast<triton::uint64>(ctx.getConcreteRegisterValue(ctx.registers.x86_rsp)) - 8;
+    ctx.setConcreteMemoryValue(triton::arch::MemoryAccess(rsp, triton::size::qword), 0x401000);
+    ctx.setConcreteRegisterValue(ctx.registers.x86_rsp, rsp);
+    ctx.setConcreteRegisterValue(ctx.registers.x86_rdi, a0);
+    ctx.setConcreteRegisterValue(ctx.registers.x86_rsi, a1);
+    ctx.setConcreteRegisterValue(ctx.registers.x86_rdx, a2);
+    triton::arch::Instruction inst(stub, (const unsigned char*)"\xff\x25\x00\x00\x00\x00", 6); // jmp [rip]
+    ctx.processing(inst);
+  };
+
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rsp, 0x7000);
+  ctx.setConcreteMemoryAreaValue(0x1000, {'a', 'b', 'c', 0});
+  auto var = ctx.symbolizeMemory(triton::arch::MemoryAccess(0x1001, triton::size::byte));
+
+  /* The copied byte keeps its symbolic expression */
+  call(0x400010, 0x2000, 0x1000, 4);
+  if (ctx.getConcreteRegisterValue(ctx.registers.x86_rip) != 0x401000 ||
+      ctx.getConcreteRegisterValue(ctx.registers.x86_rsp) != 0x7000 ||
+      ctx.getConcreteRegisterValue(ctx.registers.x86_rax) != 0x2000 ||
+      ctx.getConcreteMemoryValue(0x2002) != 'c' ||
+      ctx.isMemorySymbolized(0x2001) == false ||
+      ctx.isMemorySymbolized(0x2000) == true) {
+    std::cerr << "test_49: KO (memcpy)" << std::endl;
+    return 1;
+  }
+
+  /* The length is symbolic, and 1 if the copied byte is null */
+  call(0x400020, 0x2000, 0, 0);
+  auto rax = ctx.getRegisterAst(ctx.registers.x86_rax);
+  if (rax->evaluate() != 3 || ctx.isRegisterSymbolized(ctx.registers.x86_rax) == false) {
+    std::cerr << "test_49: KO (strlen)" << std::endl;
+    return 1;
+  }
+
+  ctx.setConcreteVariableValue(var, 0);
+  if (rax->evaluate() != 1) {
+    std::cerr << "test_49: KO (strlen)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_49: OK" << std::endl;
+  return 0;
+}
+
+int test_50(void) {
+  /* inc rax; add rbx, rcx; cmp rax, rdx; jb 0x1000 */
+  std::vector<triton::uint8> code = {0x48, 0xff, 0xc0, 0x48, 0x01, 0xcb, 0x48, 0x39, 0xd0, 0x72, 0xf5};
+
+  auto run = [&code](triton::Context& ctx) {
+    triton::uint64 pc = 0x1000;
+    while (pc != 0x1000 + code.size()) {
+      triton::arch::Instruction inst(pc, code.data() + (pc - 0x1000), static_cast<triton::uint32>(code.size() - (pc - 0x1000)));
+      ctx.processing(inst);
+      pc = static_cast<triton::uint64>(ctx.getConcreteRegisterValue(ctx.registers.x86_rip));
+    }
+  };
+
+  /* A counted loop: one constraint for the iterations, and rbx summarized as rbx + count * rcx */
+  triton::Context ctx1(triton::arch::ARCH_X86_64);
+  ctx1.setMode(triton::modes::LOOP_SUMMARIZATION, true);
+  ctx1.setMode(triton::modes::PC_TRACKING_SYMBOLIC, false);
+  ctx1.setConcreteRegisterValue(ctx1.registers.x86_rcx, 3);
+  ctx1.setConcreteRegisterValue(ctx1.registers.x86_rdx, 10);
+  auto rcx = ctx1.symbolizeRegister(ctx1.registers.x86_rcx);
+  run(ctx1);
+
+  const auto& loops1 = ctx1.getLoopSummaries();
+  if (loops1.size() != 1 || loops1[0].address != 0x1009 || loops1[0].target != 0x1000 || loops1[0].iterations != 9 ||
+      loops1[0].constraints != 8 || loops1[0].concretized || ctx1.getPathConstraints().size() != 2 ||
+      std::find(loops1[0].inductions.begin(), loops1[0].inductions.end(), triton::arch::ID_REG_X86_RBX) == loops1[0].inductions.end()) {
+    std::cerr << "test_50: KO (counted)" << std::endl;
+    return 1;
+  }
+
+  auto rbx = ctx1.getRegisterAst(ctx1.registers.x86_rbx);
+  ctx1.setConcreteVariableValue(rcx, 5);
+  if (rbx->evaluate() != 50) {
+    std::cerr << "test_50: KO (induction)" << std::endl;
+    return 1;
+  }
+
+  /* A loop with a symbolic condition: unrolled 4 times, then its bound is pinned */
+  triton::Context ctx2(triton::arch::ARCH_X86_64);
+  ctx2.setMode(triton::modes::LOOP_SUMMARIZATION, true);
+  ctx2.setLoopUnrollBound(4);
+  ctx2.setConcreteRegisterValue(ctx2.registers.x86_rdx, 30);
+  ctx2.symbolizeRegister(ctx2.registers.x86_rdx);
+  run(ctx2);
+
+  const auto& loops2 = ctx2.getLoopSummaries();
+  if (loops2.size() != 1 || loops2[0].iterations != 29 || loops2[0].constraints != 25 || !loops2[0].concretized ||
+      ctx2.getPathConstraints().size() != 6 || ctx2.getPathConstraints()[4].getComment() != "Loop concretization") {
+    std::cerr << "test_50: KO (unroll)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_50: OK" << std::endl;
+  return 0;
+}
+
+int test_51(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  ctx.setMode(triton::modes::ONLY_ON_SYMBOLIZED, true);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rbx, 5);
+
+  /* mov rax, rbx; add rax, 1 with concrete inputs: no symbolic expression */
+  triton::arch::Instruction mov(0x1000, "\x48\x89\xd8", 3);
+  triton::arch::Instruction add(0x1003, "\x48\x83\xc0\x01", 4);
+  ctx.processing(mov);
+  ctx.processing(add);
+
+  if (ctx.getConcreteRegisterValue(ctx.registers.x86_rax) != 6 || ctx.getSymbolicExpressions().size() != 0) {
+    std::cerr << "test_51: KO (concrete)" << std::endl;
+    return 1;
+  }
+
+  /* Once rbx is symbolized, the semantics are built again */
+  ctx.symbolizeRegister(ctx.registers.x86_rbx);
+  ctx.processing(mov);
+
+  if (!ctx.isRegisterSymbolized(ctx.registers.x86_rax) || ctx.getConcreteRegisterValue(ctx.registers.x86_rax) != 5) {
+    std::cerr << "test_51: KO (symbolic)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_51: OK" << std::endl;
+  return 0;
+}
+
+int test_52(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  ctx.enableProfiling(true);
+  ctx.symbolizeRegister(ctx.registers.x86_rbx);
+
+  /* mov rax, rbx; add rax, 1; mov rax, rbx */
+  triton::arch::Instruction mov(0x1000, "\x48\x89\xd8", 3);
+  triton::arch::Instruction add(0x1003, "\x48\x83\xc0\x01", 4);
+  ctx.processing(mov);
+  ctx.processing(add);
+  ctx.processing(mov);
+
+  const auto& profile = ctx.getProfile();
+  auto imov = profile.find(triton::arch::x86::ID_INS_MOV);
+  auto iadd = profile.find(triton::arch::x86::ID_INS_ADD);
+  if (profile.size() != 2 || imov == profile.end() || iadd == profile.end() ||
+      imov->second.count != 2 || imov->second.expressions < 2 || iadd->second.count != 1 ||
+      iadd->second.expressions < 2 || iadd->second.nodes == 0) {
+    std::cerr << "test_52: KO (profile)" << std::endl;
+    return 1;
+  }
+
+  ctx.enableProfiling(false);
+  ctx.processing(mov);
+  if (!ctx.getProfile().empty()) {
+    std::cerr << "test_52: KO (disabled)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_52: OK" << std::endl;
+  return 0;
+}
+
+int test_53(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+
+  if (!ctx.isSolverValid()) {
+    std::cout << "test_53: OK (no solver)" << std::endl;
+    return 0;
+  }
+
+  auto var = ctx.newSymbolicVariable(32);
+  auto x   = actx->variable(var);
+
+  ctx.enableIncrementalSolving(true);
+  ctx.pushPathConstraint(actx->bvugt(x, actx->bv(10, 32)));
+  ctx.pushPathConstraint(actx->bvult(x, actx->bv(20, 32)));
+
+  /* Queries under prefixes of different sizes */
+  auto model = ctx.getModelOfPath(2, actx->equal(x, actx->bv(15, 32)));
+  if (model.size() != 1 || model.at(var->getId()).getValue() != 15 ||
+      ctx.isSatOfPath(2, actx->equal(x, actx->bv(25, 32))) ||
+      !ctx.isSatOfPath(1, actx->equal(x, actx->bv(25, 32))) ||
+      ctx.isSatOfPath(2, actx->equal(x, actx->bv(5, 32)))) {
+    std::cerr << "test_53: KO (prefix)" << std::endl;
+    return 1;
+  }
+
+  /* The session follows the changes of the path */
+  ctx.popPathConstraint();
+  ctx.pushPathConstraint(actx->bvult(x, actx->bv(30, 32)));
+  if (!ctx.isSatOfPath(2, actx->equal(x, actx->bv(25, 32)))) {
+    std::cerr << "test_53: KO (path)" << std::endl;
+    return 1;
+  }
+
+  /* Same answers without the session */
+  ctx.enableIncrementalSolving(false);
+  if (!ctx.isSatOfPath(2, actx->equal(x, actx->bv(25, 32))) || ctx.isSatOfPath(2, actx->equal(x, actx->bv(35, 32)))) {
+    std::cerr << "test_53: KO (disabled)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_53: OK" << std::endl;
+  return 0;
+}
+
+int test_54(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+
+  if (!ctx.isSolverValid()) {
+    std::cout << "test_54: OK (no solver)" << std::endl;
+    return 0;
+  }
+
+  auto var = ctx.newSymbolicVariable(32);
+  auto x   = actx->variable(var);
+
+  ctx.enableQueryCache(true, 2);
+
+  /* The same query, then an equal one built again */
+  ctx.isSat(actx->equal(x, actx->bv(5, 32)));
+  ctx.isSat(actx->equal(x, actx->bv(5, 32)));
+  ctx.getModel(actx->equal(x, actx->bv(5, 32)));
+  auto model = ctx.getModel(actx->equal(x, actx->bv(5, 32)));
+
+  if (ctx.getQueryCacheHits() != 2 || ctx.getQueryCacheMisses() != 2 || model.at(var->getId()).getValue() != 5) {
+    std::cerr << "test_54: KO (hits)" << std::endl;
+    return 1;
+  }
+
+  /* The least recently used results are evicted */
+  ctx.isSat(actx->equal(x, actx->bv(6, 32)));
+  ctx.isSat(actx->equal(x, actx->bv(7, 32)));
+  ctx.isSat(actx->equal(x, actx->bv(5, 32)));
+
+  if (ctx.getQueryCacheSize() != 2 || ctx.getQueryCacheHits() != 2 || ctx.getQueryCacheMisses() != 5) {
+    std::cerr << "test_54: KO (eviction)" << std::endl;
+    return 1;
+  }
+
+  ctx.enableQueryCache(false);
+  if (ctx.getQueryCacheSize() != 0) {
+    std::cerr << "test_54: KO (disabled)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_54: OK" << std::endl;
+  return 0;
+}
+
+int test_55(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+
+  if (!ctx.isSolverValid()) {
+    std::cout << "test_55: OK (no solver)" << std::endl;
+    return 0;
+  }
+
+  auto var1 = ctx.newSymbolicVariable(32);
+  auto var2 = ctx.newSymbolicVariable(32);
+  auto x    = actx->variable(var1);
+  auto y    = actx->variable(var2);
+
+  ctx.enableQueryCache(true);
+  ctx.enableConstraintIndependence(true);
+
+  /* Two independent clusters, then only the second one changes */
+  ctx.getModel(actx->land(actx->equal(x, actx->bv(5, 32)), actx->equal(y, actx->bv(7, 32))));
+  auto model = ctx.getModel(actx->land(actx->equal(x, actx->bv(5, 32)), actx->equal(y, actx->bv(8, 32))));
+
+  if (ctx.getQueryCacheHits() != 1 || ctx.getQueryCacheMisses() != 3) {
+    std::cerr << "test_55: KO (clusters)" << std::endl;
+    return 1;
+  }
+
+  if (model.at(var1->getId()).getValue() != 5 || model.at(var2->getId()).getValue() != 8) {
+    std::cerr << "test_55: KO (merged model)" << std::endl;
+    return 1;
+  }
+
+  /* An unsatisfiable cluster makes the whole query unsatisfiable */
+  triton::engines::solver::status_e status;
+  auto unsat = actx->land(std::vector<triton::ast::SharedAbstractNode>{
+    actx->equal(x, actx->bv(5, 32)),
+    actx->equal(y, actx->bv(8, 32)),
+    actx->equal(y, actx->bv(9, 32))
+  });
+
+  if (ctx.isSat(unsat, &status) || status != triton::engines::solver::UNSAT || !ctx.getModel(unsat).empty()) {
+    std::cerr << "test_55: KO (unsat)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_55: OK" << std::endl;
+  return 0;
+}
+
+int test_56(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+
+  if (!ctx.isSolverValid()) {
+    std::cout << "test_56: OK (no solver)" << std::endl;
+    return 0;
+  }
+
+  auto var1 = ctx.newSymbolicVariable(32);
+  auto var2 = ctx.newSymbolicVariable(32);
+  auto x    = actx->variable(var1);
+  auto y    = actx->variable(var2);
+
+  ctx.enableCounterexampleCache(true);
+
+  /* The model of the first query satisfies the next ones */
+  ctx.getModel(actx->equal(x, actx->bv(5, 32)));
+  bool sat   = ctx.isSat(actx->bvugt(x, actx->bv(3, 32)));
+  auto model = ctx.getModel(actx->land(actx->bvult(x, actx->bv(10, 32)), actx->equal(y, actx->bv(0, 32))));
+
+  if (!sat || ctx.getCounterexampleCacheHits() != 2 || ctx.getCounterexampleCacheSize() != 1) {
+    std::cerr << "test_56: KO (hits)" << std::endl;
+    return 1;
+  }
+
+  /* The variables missing from the kept model keep their values */
+  if (model.at(var1->getId()).getValue() != 5 || model.at(var2->getId()).getValue() != 0 || ctx.getConcreteVariableValue(var1) != 0) {
+    std::cerr << "test_56: KO (model)" << std::endl;
+    return 1;
+  }
+
+  /* A query which is not satisfied goes to the solver */
+  model = ctx.getModel(actx->equal(x, actx->bv(6, 32)));
+  if (model.at(var1->getId()).getValue() != 6 || ctx.getCounterexampleCacheHits() != 2 || ctx.getCounterexampleCacheSize() != 2) {
+    std::cerr << "test_56: KO (miss)" << std::endl;
+    return 1;
+  }
+
+  ctx.enableCounterexampleCache(false);
+  if (ctx.getCounterexampleCacheSize() != 0) {
+    std::cerr << "test_56: KO (disabled)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_56: OK" << std::endl;
+  return 0;
+}
+
+int test_57(void) {
+  #if defined(TRITON_Z3_INTERFACE) && defined(TRITON_BITWUZLA_INTERFACE)
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+
+  ctx.setSolver(triton::engines::solver::SOLVER_PORTFOLIO);
+
+  auto var = ctx.newSymbolicVariable(32);
+  auto x   = actx->variable(var);
+
+  triton::engines::solver::status_e status;
+  auto model = ctx.getModel(actx->equal(actx->bvmul(x, actx->bv(3, 32)), actx->bv(15, 32)), &status);
+  if (status != triton::engines::solver::SAT || (model.at(var->getId()).getValue() * 3) % 0x100000000 != 15) {
+    std::cerr << "test_57: KO (sat)" << std::endl;
+    return 1;
+  }
+
+  if (ctx.isSat(actx->distinct(x, x), &status) || status != triton::engines::solver::UNSAT) {
+    std::cerr << "test_57: KO (unsat)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_57: OK" << std::endl;
+  #else
+  std::cout << "test_57: OK (no portfolio)" << std::endl;
+  #endif
+  return 0;
+}
+
+int test_58(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  if (!ctx.isSolverValid()) {
+    std::cout << "test_58: OK (no solver)" << std::endl;
+    return 0;
+  }
+
+  auto var = ctx.symbolizeRegister(ctx.registers.x86_eax);
+
+  triton::arch::Instruction cmp1((const unsigned char*)"\x83\xf8\x05", 3); // cmp eax, 5
+  triton::arch::Instruction jz((const unsigned char*)"\x74\x10", 2);        // jz +0x10
+  triton::arch::Instruction cmp2((const unsigned char*)"\x83\xf8\x09", 3); // cmp eax, 9
+  triton::arch::Instruction jb((const unsigned char*)"\x72\x10", 2);        // jb +0x10
+
+  cmp1.setAddress(0x1000);
+  jz.setAddress(0x1003);
+  cmp2.setAddress(0x1005);
+  jb.setAddress(0x1008);
+
+  ctx.processing(cmp1);
+  ctx.processing(jz);
+  ctx.processing(cmp2);
+  ctx.processing(jb);
+
+  /* eax is 0: jz is not taken and jb is taken */
+  triton::usize streamed = 0;
+  auto flips = ctx.solveAllBranchFlips(2, 0, [&streamed](const triton::engines::symbolic::BranchFlip&) { streamed++; });
+
+  if (flips.size() != 2 || streamed != 2) {
+    std::cerr << "test_58: KO (flips)" << std::endl;
+    return 1;
+  }
+
+  for (const auto& flip : flips) {
+    if (flip.status != triton::engines::solver::SAT) {
+      std::cerr << "test_58: KO (status)" << std::endl;
+      return 1;
+    }
+
+    auto value = flip.model.at(var->getId()).getValue();
+    if ((flip.index == 0 && value != 5) || (flip.index == 1 && (value < 9 || value == 5))) {
+      std::cerr << "test_58: KO (model)" << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "test_58: OK" << std::endl;
+  return 0;
+}
+
+int test_59(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  if (!ctx.isSolverValid()) {
+    std::cout << "test_59: OK (no solver)" << std::endl;
+    return 0;
+  }
+
+  auto ast = ctx.getAstContext();
+  auto vx  = ctx.newSymbolicVariable(32);
+  auto vy  = ctx.newSymbolicVariable(32);
+  auto x   = ast->variable(vx);
+  auto y   = ast->variable(vy);
+
+  /* The second query shares the nodes of the first one */
+  auto c1 = ast->equal(x, ast->bv(5, 32));
+  auto c2 = ast->land(c1, ast->equal(y, ast->bvadd(x, ast->bv(3, 32))));
+
+  auto m1 = ctx.getModel(c1);
+  auto m2 = ctx.getModel(c2);
+  if (m1.size() != 1 || m2.size() != 2 || m2.at(vy->getId()).getValue() != 8) {
+    std::cerr << "test_59: KO (shared nodes)" << std::endl;
+    return 1;
+  }
+
+  /* The nodes created after the old ones are released */
+  c1 = nullptr;
+  c2 = nullptr;
+  auto c3 = ast->equal(ast->bvadd(x, y), ast->bv(7, 32));
+  if (!ctx.isSat(c3) || ctx.isSat(ast->land(c3, ast->equal(x, ast->bvadd(x, ast->bv(1, 32)))))) {
+    std::cerr << "test_59: KO (new nodes)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_59: OK" << std::endl;
+  return 0;
+}
+
+int test_60(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  if (!ctx.isSolverValid()) {
+    std::cout << "test_60: OK (no solver)" << std::endl;
+    return 0;
+  }
+
+  auto ast = ctx.getAstContext();
+  auto var = ctx.newSymbolicVariable(32);
+  auto x   = ast->variable(var);
+
+  auto model = ctx.getModelAsync(ast->equal(x, ast->bv(0x1234, 32)));
+  auto unsat = ctx.isSatAsync(ast->land(ast->equal(x, ast->bv(1, 32)), ast->equal(x, ast->bv(2, 32))));
+
+  if (model->getStatus() != triton::engines::solver::SAT || model->getModel().at(var->getId()).getValue() != 0x1234) {
+    std::cerr << "test_60: KO (getModelAsync)" << std::endl;
+    return 1;
+  }
+
+  if (unsat->isSat() || unsat->getStatus() != triton::engines::solver::UNSAT || !unsat->isReady()) {
+    std::cerr << "test_60: KO (isSatAsync)" << std::endl;
+    return 1;
+  }
+
+  /* A cancelled query ends without a model */
+  auto cancelled = ctx.getModelAsync(ast->equal(ast->bvmul(x, x), ast->bv(0x10000, 32)));
+  cancelled->cancel();
+  cancelled->wait();
+  if (cancelled->isCancelled() && (cancelled->getStatus() != triton::engines::solver::UNKNOWN || !cancelled->getModel().empty())) {
+    std::cerr << "test_60: KO (cancel)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_60: OK" << std::endl;
+  return 0;
+}
+
+int test_61(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  if (!ctx.isSolverValid()) {
+    std::cout << "test_61: OK (no solver)" << std::endl;
+    return 0;
+  }
+
+  auto ast  = ctx.getAstContext();
+  auto vx   = ctx.newSymbolicVariable(8);
+  auto vy   = ctx.newSymbolicVariable(128);
+  auto x    = ast->variable(vx);
+  auto y    = ast->variable(vy);
+  auto wide = (triton::uint512(0x1122334455667788) << 64) | triton::uint512(0x99aabbccddeeff00);
+
+  /* The values wider than 64 bits are read word by word */
+  auto model = ctx.getModel(ast->equal(y, ast->bv(wide, 128)));
+  if (model.at(vy->getId()).getValue() != wide) {
+    std::cerr << "test_61: KO (wide value)" << std::endl;
+    return 1;
+  }
+
+  /* Each model is blocked by its own values */
+  auto models = ctx.getModels(ast->bvult(x, ast->bv(10, 8)), 20);
+  std::set<triton::uint512> values;
+  for (const auto& m : models)
+    values.insert(m.at(vx->getId()).getValue());
+
+  if (models.size() != 10 || values.size() != 10 || *values.rbegin() != 9) {
+    std::cerr << "test_61: KO (models)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_61: OK" << std::endl;
+  return 0;
+}
+
+int test_62(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  auto ast = ctx.getAstContext();
+  auto var = ast->variable(ctx.newSymbolicVariable(8));
+
+  /* v > 0, v > 1, ..., v > 39 */
+  for (triton::uint32 i = 0; i < 40; i++)
+    ctx.pushPathConstraint(ast->bvugt(var, ast->bv(i, 8)));
+
+  auto pred = ctx.getPathPredicate();
+  if (pred != ctx.getPathPredicate() || pred->getLevel() > 6) {
+    std::cerr << "test_62: KO (balanced predicate)" << std::endl;
+    return 1;
+  }
+
+  /* Two 16 blocks and 8 constraints, a block and 4 constraints for the prefix of 20 */
+  auto symbolic = ctx.getSymbolicEngine();
+  if (symbolic->getPrefixConjunctions(40).size() != 10 || symbolic->getPrefixConjunctions(20).size() != 5 || !symbolic->getPrefixConjunctions(0).empty()) {
+    std::cerr << "test_62: KO (prefixes)" << std::endl;
+    return 1;
+  }
+
+  /* The blocks are rolled back */
+  for (triton::uint32 i = 0; i < 7; i++)
+    ctx.popPathConstraint();
+
+  pred = ctx.getPathPredicate();
+  if (symbolic->getPrefixConjunctions(33).size() != 3 || pred->getChildren().size() != 4) {
+    std::cerr << "test_62: KO (pop)" << std::endl;
+    return 1;
+  }
+
+  if (ctx.isSolverValid()) {
+    if (!ctx.isSat(ast->land(pred, ast->equal(var, ast->bv(33, 8)))) || ctx.isSat(ast->land(pred, ast->equal(var, ast->bv(32, 8))))) {
+      std::cerr << "test_62: KO (solving)" << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "test_62: OK" << std::endl;
+  return 0;
+}
+
+int test_63(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  if (!ctx.isSolverValid()) {
+    std::cout << "test_63: OK (no solver)" << std::endl;
+    return 0;
+  }
+
+  auto ast = ctx.getAstContext();
+  auto x = ast->variable(ctx.newSymbolicVariable(32));
+  auto y = ast->variable(ctx.newSymbolicVariable(32));
+
+  triton::usize traced = 0;
+  ctx.setSolverTraceCallback([&traced](const triton::engines::solver::SolverQuery& query) {
+    traced++;
+  });
+
+  ctx.enableSolverStatistics(true);
+  ctx.isSat(ast->equal(ast->bvadd(x, y), ast->bv(10, 32)));
+  ctx.isSat(ast->distinct(x, x));
+  ctx.getModel(ast->equal(x, ast->bv(1, 32)));
+  ctx.getModels(ast->bvult(x, ast->bv(4, 32)), 10);
+
+  auto stats = ctx.getSolverStatistics();
+  triton::usize total = 0;
+  for (auto count : stats.histogram)
+    total += count;
+
+  if (stats.queries != 4 || traced != 4 || total != 4 || stats.statuses[triton::engines::solver::SAT] != 3 || stats.statuses[triton::engines::solver::UNSAT] != 1) {
+    std::cerr << "test_63: KO (counts)" << std::endl;
+    return 1;
+  }
+
+  /* x + y == 10 holds 7 nodes, the constant with its two integers */
+  if (stats.variables != 5 || stats.maxNodes != 7 || stats.queryTime != stats.checkTime + stats.translationTime) {
+    std::cerr << "test_63: KO (sizes)" << std::endl;
+    return 1;
+  }
+
+  /* Every query is slower than 0ms */
+  ctx.dumpSlowSolverQueries(".", 0);
+  ctx.isSat(ast->equal(x, ast->bv(2, 32)));
+  ctx.dumpSlowSolverQueries("", 0);
+
+  std::ifstream dump("./query-0.smt2");
+  std::stringstream content;
+  content << dump.rdbuf();
+  dump.close();
+  std::remove("./query-0.smt2");
+
+  if (content.str().find("(check-sat)") == std::string::npos || content.str().find("(declare-fun SymVar_0") == std::string::npos) {
+    std::cerr << "test_63: KO (dump)" << std::endl;
+    return 1;
+  }
+
+  ctx.clearSolverStatistics();
+  if (ctx.getSolverStatistics().queries != 0 || traced != 4) {
+    std::cerr << "test_63: KO (clear)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_63: OK" << std::endl;
+  return 0;
+}
+
+int test_64(void) {
+  #ifdef TRITON_REMOTE_INTERFACE
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  if (!ctx.isSolverValid()) {
+    std::cout << "test_64: OK (no solver)" << std::endl;
+    return 0;
+  }
+
+  triton::engines::solver::RemoteWorker worker(0, 2);
+  std::thread server(&triton::engines::solver::RemoteWorker::serve, &worker);
+
+  auto check = [&]() {
+    ctx.setRemoteSolver({"127.0.0.1:" + std::to_string(worker.getPort())});
+
+    auto ast = ctx.getAstContext();
+    auto vx = ctx.newSymbolicVariable(32);
+    auto vy = ctx.newSymbolicVariable(32);
+    auto x = ast->variable(vx);
+    auto y = ast->variable(vy);
+
+    /* The values come back on the variables of the query */
+    triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+    auto model = ctx.getModel(ast->land(ast->equal(x, ast->bv(0x1234, 32)), ast->equal(y, ast->bvadd(x, ast->bv(1, 32)))), &status);
+    if (status != triton::engines::solver::SAT || model[vx->getId()].getValue() != 0x1234 || model[vy->getId()].getValue() != 0x1235 || model[vy->getId()].getVariable() != vy)
+      return "model";
+
+    if (ctx.isSat(ast->distinct(x, x)) || ctx.getModels(ast->bvult(x, ast->bv(4, 32)), 10).size() != 4)
+      return "queries";
+
+    /* The queries are pipelined to the worker */
+    std::vector<std::shared_ptr<triton::engines::solver::SolverFuture>> futures;
+    for (triton::uint32 i = 0; i < 8; i++)
+      futures.push_back(ctx.getModelAsync(ast->equal(ast->bvmul(x, ast->bv(3, 32)), ast->bv(3 * i, 32))));
+
+    for (triton::uint32 i = 0; i < 8; i++) {
+      auto m = futures[i]->getModel();
+      if (!futures[i]->isSat() || (m[vx->getId()].getValue() * 3) % 0x100000000 != 3 * i)
+        return "pipeline";
+    }
+
+    return "";
+  };
+
+  std::string error;
+  try {
+    error = check();
+  }
+  catch (const triton::exceptions::Exception& e) {
+    error = e.what();
+  }
+
+  worker.stop();
+  server.join();
+
+  if (!error.empty()) {
+    std::cerr << "test_64: KO (" << error << ")" << std::endl;
+    return 1;
+  }
+  #endif
+
+  std::cout << "test_64: OK" << std::endl;
+  return 0;
+}
+
+int test_65(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  auto ast = ctx.getAstContext();
+  auto x = ast->variable(ctx.newSymbolicVariable(8));
+
+  /* The high bits of an extension and the low bits of a shift are known */
+  auto value = ast->getAbstractValue(ast->bvor(ast->bvshl(ast->zx(8, x), ast->bv(4, 16)), ast->bv(1, 16)));
+  if (value.zeros != 0xf00e || value.ones != 0x1 || value.umin != 0x1 || value.umax != 0xff1 || value.isConstant()) {
+    std::cerr << "test_65: KO (known bits)" << std::endl;
+    return 1;
+  }
+
+  auto sign = ast->getAbstractValue(ast->sx(8, ast->bvor(x, ast->bv(0x80, 8))));
+  if (sign.smin != -128 || sign.smax != -1 || sign.umin != 0xff80) {
+    std::cerr << "test_65: KO (ranges)" << std::endl;
+    return 1;
+  }
+
+  /* The optimizations fold the nodes whose bits are all known */
+  ctx.setMode(triton::modes::AST_OPTIMIZATIONS, true);
+  auto folded = ast->bvand(ast->bvshl(x, ast->bv(4, 8)), ast->bv(0x0f, 8));
+  auto chosen = ast->ite(ast->bvult(ast->zx(8, x), ast->bv(0x100, 16)), x, ast->bv(0, 8));
+  ctx.setMode(triton::modes::AST_OPTIMIZATIONS, false);
+
+  if (folded->isSymbolized() || folded->evaluate() != 0 || chosen != x) {
+    std::cerr << "test_65: KO (folding)" << std::endl;
+    return 1;
+  }
+
+  if (!ctx.isSolverValid()) {
+    std::cout << "test_65: OK (no solver)" << std::endl;
+    return 0;
+  }
+
+  /* The presolver decides these constraints without solver */
+  triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+  ctx.enablePresolver(true);
+
+  auto model = ctx.getModel(ast->equal(ast->bvand(x, ast->bv(0x0f, 8)), ast->bv(0x10, 8)), &status);
+  if (!model.empty() || status != triton::engines::solver::UNSAT) {
+    std::cerr << "test_65: KO (unsat)" << std::endl;
+    return 1;
+  }
+
+  if (!ctx.isSat(ast->bvule(ast->zx(8, x), ast->bv(0xff, 16)), &status) || status != triton::engines::solver::SAT) {
+    std::cerr << "test_65: KO (sat)" << std::endl;
+    return 1;
+  }
+
+  /* The others still go to the solver */
+  model = ctx.getModel(ast->equal(x, ast->bv(3, 8)), &status);
+  if (model.size() != 1 || status != triton::engines::solver::SAT || ctx.getPresolverHits() != 2) {
+    std::cerr << "test_65: KO (solver)" << std::endl;
+    return 1;
+  }
+
+  ctx.enablePresolver(false);
+  if (ctx.isPresolverEnabled() || ctx.getPresolverHits() != 0) {
+    std::cerr << "test_65: KO (disable)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_65: OK" << std::endl;
+  return 0;
+}
+
+
+int test_66(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  /* cmp eax, 1; jne +0x10, executed three times as a loop would */
+  auto iteration = [&]() {
+    triton::arch::Instruction cmp(0x1000, "\x83\xf8\x01", 3);
+    triton::arch::Instruction jne(0x1003, "\x75\x10", 2);
+    ctx.processing(cmp);
+    ctx.processing(jne);
+  };
+
+  ctx.symbolizeRegister(ctx.registers.x86_eax);
+  ctx.setMode(triton::modes::PC_DEDUPLICATION, true);
+  for (triton::uint32 i = 0; i < 3; i++)
+    iteration();
+
+  if (ctx.getSizeOfPathConstraints() != 1) {
+    std::cerr << "test_66: KO (deduplication)" << std::endl;
+    return 1;
+  }
+
+  /* A popped constraint is no longer a duplicate */
+  ctx.popPathConstraint();
+  iteration();
+  ctx.setMode(triton::modes::PC_DEDUPLICATION, false);
+  iteration();
+
+  if (ctx.getSizeOfPathConstraints() != 2) {
+    std::cerr << "test_66: KO (pop)" << std::endl;
+    return 1;
+  }
+
+  /* The older constraints are summarized past twice the window */
+  auto ast = ctx.getAstContext();
+  auto x = ast->variable(ctx.newSymbolicVariable(8));
+
+  ctx.clearPathConstraints();
+  ctx.setPathConstraintsWindow(3);
+  for (triton::uint64 i = 0; i < 10; i++)
+    ctx.pushPathConstraint(ast->distinct(x, ast->bv(i, 8)));
+
+  const auto& pcs = ctx.getPathConstraints();
+  if (ctx.getPathConstraintsWindow() != 3 || pcs.size() > 6 || pcs.front().getComment().find("Summary") != 0) {
+    std::cerr << "test_66: KO (window)" << std::endl;
+    return 1;
+  }
+
+  ctx.setPathConstraintsWindow(0);
+  ctx.summarizePathConstraints(ctx.getSizeOfPathConstraints());
+  if (ctx.getSizeOfPathConstraints() != 1) {
+    std::cerr << "test_66: KO (summary)" << std::endl;
+    return 1;
+  }
+
+  /* The summary keeps the path predicate */
+  if (ctx.isSolverValid()) {
+    for (triton::uint64 i = 0; i < 11; i++) {
+      if (ctx.isSat(ast->land(ctx.getPathPredicate(), ast->equal(x, ast->bv(i, 8)))) != (i == 10)) {
+        std::cerr << "test_66: KO (predicate)" << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  std::cout << "test_66: OK" << std::endl;
+  return 0;
+}
+
+
+int test_67(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  auto ast = ctx.getAstContext();
+  auto vx = ctx.newSymbolicVariable(32);
+  auto x = ast->variable(vx);
+
+  auto bytes  = ast->land(ast->equal(ast->extract(7, 0, x), ast->bv(0x41, 8)), ast->equal(ast->extract(31, 24, x), ast->bv(0x42, 8)));
+  auto arith  = ast->bvult(ast->bvmul(x, ast->bv(3, 32)), ast->bv(7, 32));
+  auto memory = ast->equal(ast->select(ast->array(64), ast->zx(32, x)), ast->bv(0x41, 8));
+
+  if (triton::engines::solver::classifyQuery(bytes) != triton::engines::solver::QUERY_EQUALITIES ||
+      triton::engines::solver::classifyQuery(arith) != triton::engines::solver::QUERY_QF_BV ||
+      triton::engines::solver::classifyQuery(memory) != triton::engines::solver::QUERY_QF_ABV ||
+      triton::engines::solver::classifyQuery(ast->land(bytes, arith)) != triton::engines::solver::QUERY_QF_BV) {
+    std::cerr << "test_67: KO (classification)" << std::endl;
+    return 1;
+  }
+
+  if (!ctx.isSolverValid()) {
+    std::cout << "test_67: OK (no solver)" << std::endl;
+    return 0;
+  }
+
+  if (!ctx.isQueryClassificationEnabled() || ctx.getQueryConfiguration(triton::engines::solver::QUERY_QF_BV).logic != "QF_BV") {
+    std::cerr << "test_67: KO (defaults)" << std::endl;
+    return 1;
+  }
+
+  /* Each class is solved with its configuration, and gives the same answers */
+  auto check = [&]() {
+    auto model = ctx.getModel(bytes);
+    if (model.empty() || (model[vx->getId()].getValue() & 0xff0000ff) != 0x42000041)
+      return false;
+    if (ctx.getModels(arith, 10).size() != 7 || ctx.isSat(ast->land(arith, ast->equal(x, ast->bv(3, 32)))))
+      return false;
+    return ctx.isSat(memory);
+  };
+
+  if (!check()) {
+    std::cerr << "test_67: KO (classified)" << std::endl;
+    return 1;
+  }
+
+  ctx.setQueryConfiguration(triton::engines::solver::QUERY_QF_BV, triton::engines::solver::SolverConfiguration("", "simplify;bit-blast;sat"));
+  if (ctx.getQueryConfiguration(triton::engines::solver::QUERY_QF_BV).tactics != "simplify;bit-blast;sat" || !check()) {
+    std::cerr << "test_67: KO (tactics)" << std::endl;
+    return 1;
+  }
+
+  ctx.enableQueryClassification(false);
+  if (ctx.isQueryClassificationEnabled() || !check()) {
+    std::cerr << "test_67: KO (disabled)" << std::endl;
+    return 1;
+  }
+
+  try {
+    ctx.setQueryConfiguration(triton::engines::solver::QUERY_ANY, triton::engines::solver::SolverConfiguration("", "", "", 3));
+    std::cerr << "test_67: KO (rewrite level)" << std::endl;
+    return 1;
+  }
+  catch (const triton::exceptions::SolverEngine&) {
+  }
+
+  std::cout << "test_67: OK" << std::endl;
+  return 0;
+}
+
+
+int test_68(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  if (!ctx.isSolverValid()) {
+    std::cout << "test_68: OK (no solver)" << std::endl;
+    return 0;
+  }
+
+  auto ast = ctx.getAstContext();
+  auto vx = ctx.newSymbolicVariable(8);
+  auto vy = ctx.newSymbolicVariable(8);
+  auto x = ast->variable(vx);
+  auto y = ast->variable(vy);
+
+  /* Every model, streamed and never repeated */
+  triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+  std::set<triton::uint64> seen;
+  auto count = ctx.enumerateModels(ast->bvult(x, ast->bv(200, 8)), {}, [&](const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model) {
+    seen.insert(static_cast<triton::uint64>(model.at(vx->getId()).getValue()));
+    return true;
+  }, 0, &status);
+
+  if (count != 200 || seen.size() != 200 || *seen.rbegin() != 199 || status != triton::engines::solver::UNSAT) {
+    std::cerr << "test_68: KO (all models: " << count << ")" << std::endl;
+    return 1;
+  }
+
+  /* The models are blocked on the projection only, y is left free */
+  seen.clear();
+  bool projected = true;
+  count = ctx.enumerateModels(ast->land(ast->bvult(x, ast->bv(4, 8)), ast->bvugt(y, x)), {vx}, [&](const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model) {
+    projected &= (model.size() == 1 && model.count(vx->getId()) == 1);
+    seen.insert(static_cast<triton::uint64>(model.at(vx->getId()).getValue()));
+    return true;
+  });
+
+  if (count != 4 || seen.size() != 4 || !projected) {
+    std::cerr << "test_68: KO (projection: " << count << ")" << std::endl;
+    return 1;
+  }
+
+  /* The callback and the limit stop the enumeration */
+  triton::usize calls = 0;
+  count = ctx.enumerateModels(ast->bvult(x, ast->bv(200, 8)), {vx}, [&](const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>&) {
+    return ++calls < 3;
+  });
+
+  if (count != 3 || calls != 3) {
+    std::cerr << "test_68: KO (callback)" << std::endl;
+    return 1;
+  }
+
+  count = ctx.enumerateModels(ast->bvult(x, ast->bv(200, 8)), {vx}, [](const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>&) {
+    return true;
+  }, 5, &status);
+
+  if (count != 5 || status != triton::engines::solver::SAT) {
+    std::cerr << "test_68: KO (limit)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_68: OK" << std::endl;
+  return 0;
+}
+
+
+int test_69(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  /* The views are indexed by the id of the parent registers */
+  ctx.taintRegister(ctx.getRegister(triton::arch::ID_REG_X86_AL));
+  ctx.taintRegister(ctx.getRegister(triton::arch::ID_REG_X86_ZF));
+
+  const auto& tainted = ctx.getTaintedRegisterSet();
+  if (!tainted.test(triton::arch::ID_REG_X86_RAX) || !tainted.test(triton::arch::ID_REG_X86_ZF) || tainted.count() != 2 || ctx.getTaintedRegisters().size() != 2) {
+    std::cerr << "test_69: KO (tainted registers)" << std::endl;
+    return 1;
+  }
+
+  ctx.untaintRegister(ctx.getRegister(triton::arch::ID_REG_X86_EAX));
+  if (tainted.test(triton::arch::ID_REG_X86_RAX) || tainted.count() != 1) {
+    std::cerr << "test_69: KO (untainted register)" << std::endl;
+    return 1;
+  }
+
+  /* mov rbx, 1 */
+  triton::arch::Instruction inst((const unsigned char*)"\x48\xc7\xc3\x01\x00\x00\x00", 7);
+  ctx.processing(inst);
+
+  const auto& symbolic = ctx.getSymbolicRegisterArray();
+  if (symbolic.at(triton::arch::ID_REG_X86_RBX) == nullptr || symbolic.at(triton::arch::ID_REG_X86_RCX) != nullptr ||
+      symbolic.at(triton::arch::ID_REG_X86_RBX) != ctx.getSymbolicRegister(ctx.getRegister(triton::arch::ID_REG_X86_RBX))) {
+    std::cerr << "test_69: KO (symbolic registers)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_69: OK" << std::endl;
+  return 0;
+}
+
+extern "C" int cb_test_70_load(void* user, triton::uint64 addr, triton::uint8* value, triton::uint32 size) {
+  (*static_cast<triton::usize*>(user))++;
+  for (triton::uint32 i = 0; i < size; i++)
+    value[i] = static_cast<triton::uint8>(addr + i);
+  return addr < 0x2000;
+}
+
+extern "C" void cb_test_70_store(void* user, triton::uint64 addr, const triton::uint8* value, triton::uint32 size) {
+  *static_cast<triton::uint64*>(user) = addr + value[size - 1];
+}
+
+extern "C" int cb_test_70_get(void* user, triton::uint32 id, triton::uint8* value, triton::uint32 size) {
+  if (id != triton::arch::ID_REG_X86_RCX)
+    return 0;
+  value[0] = 0x34;
+  value[1] = 0x12;
+  return 1;
+}
+
+
+int test_70(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  triton::usize loads = 0;
+  triton::uint64 stored = 0;
+
+  ctx.addCallback(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, triton::callbacks::nativeCallback(cb_test_70_load, &loads));
+  ctx.addCallback(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, triton::callbacks::nativeCallback(cb_test_70_store, &stored));
+  ctx.addCallback(triton::callbacks::GET_CONCRETE_REGISTER_VALUE, triton::callbacks::nativeCallback(cb_test_70_get));
+
+  /* A native getter defines the value it provides, and only it */
+  if (ctx.getConcreteMemoryValue(triton::arch::MemoryAccess(0x1010, triton::size::word)) != 0x1110 || loads != 1 ||
+      ctx.getConcreteMemoryValue(triton::arch::MemoryAccess(0x2010, triton::size::word)) != 0 || loads != 2 ||
+      !ctx.isConcreteMemoryValueDefined(0x1010, 2) || ctx.isConcreteMemoryValueDefined(0x2010)) {
+    std::cerr << "test_70: KO (load)" << std::endl;
+    return 1;
+  }
+
+  ctx.setConcreteMemoryValue(triton::arch::MemoryAccess(0x3000, triton::size::word), 0x4200);
+  if (stored != 0x3042) {
+    std::cerr << "test_70: KO (store)" << std::endl;
+    return 1;
+  }
+
+  if (ctx.getConcreteRegisterValue(ctx.registers.x86_rcx) != 0x1234 || ctx.getConcreteRegisterValue(ctx.registers.x86_rdx) != 0) {
+    std::cerr << "test_70: KO (register)" << std::endl;
+    return 1;
+  }
+
+  /* The native callbacks are removed by their function */
+  ctx.removeCallback(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, triton::callbacks::nativeCallback(cb_test_70_load));
+  ctx.getConcreteMemoryValue(0x1800);
+  if (loads != 2) {
+    std::cerr << "test_70: KO (remove)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_70: OK" << std::endl;
+  return 0;
+}
+
+
+int test_71(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  ctx.symbolizeRegister(ctx.registers.x86_rbx);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rsp, 0x1000);
+
+  /* add rax, rbx; push rax */
+  triton::arch::Instruction add((const unsigned char*)"\x48\x01\xd8", 3);
+  triton::arch::Instruction push((const unsigned char*)"\x50", 1);
+  ctx.processing(add);
+  ctx.processing(push);
+
+  triton::usize exprs = 0;
+  triton::usize vars = 0;
+  triton::usize regs = 0;
+  triton::usize bytes = 0;
+
+  ctx.forEachSymbolicExpression([&exprs](const triton::engines::symbolic::SharedSymbolicExpression&) { exprs++; return true; });
+  ctx.forEachSymbolicVariable([&vars](const triton::engines::symbolic::SharedSymbolicVariable&) { vars++; return true; });
+  ctx.forEachSymbolicRegister([&regs](triton::arch::register_e, const triton::engines::symbolic::SharedSymbolicExpression&) { regs++; return true; });
+  ctx.forEachSymbolicMemory([&bytes](triton::uint64, const triton::engines::symbolic::SharedSymbolicExpression&) { bytes++; return true; });
+
+  if (exprs != ctx.getSymbolicExpressions().size() || vars != 1 || regs != ctx.getSymbolicRegisters().size() || bytes != 8) {
+    std::cerr << "test_71: KO (count)" << std::endl;
+    return 1;
+  }
+
+  /* The walk stops once the function returns false */
+  bytes = 0;
+  if (ctx.forEachSymbolicMemory([&bytes](triton::uint64, const triton::engines::symbolic::SharedSymbolicExpression&) { return ++bytes < 3; }) != false || bytes != 3) {
+    std::cerr << "test_71: KO (stop)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_71: OK" << std::endl;
+  return 0;
+}
+
+int test_72(void) {
+  triton::Context ctx;
+
+  /* The dump is set before the engines, and outlives them */
+  ctx.dumpSolverQueries("./queries.corpus");
+  ctx.setArchitecture(triton::arch::ARCH_X86_64);
+
+  if (!ctx.isSolverValid()) {
+    ctx.dumpSolverQueries("");
+    std::remove("./queries.corpus");
+    std::cout << "test_72: OK (no solver)" << std::endl;
+    return 0;
+  }
+
+  auto ast = ctx.getAstContext();
+  auto x = ast->variable(ctx.newSymbolicVariable(32));
+
+  ctx.isSat(ast->distinct(x, x));
+  ctx.getModel(ast->equal(ast->bvadd(x, ast->bv(1, 32)), ast->bv(10, 32)));
+  ctx.dumpSolverQueries("");
+  ctx.isSat(ast->equal(x, ast->bv(2, 32)));
+
+  /* The queries are read back in another context */
+  triton::Context replay(triton::arch::ARCH_X86_64);
+  std::ifstream corpus("./queries.corpus", std::ios::in | std::ios::binary);
+  std::vector<triton::engines::solver::SolverQuery> queries;
+  triton::engines::solver::SolverQuery query;
+
+  while (triton::engines::solver::readQuery(corpus, replay.getAstContext(), query))
+    queries.push_back(query);
+  corpus.close();
+  std::remove("./queries.corpus");
+
+  if (queries.size() != 2 || queries[0].limit != 0 || queries[0].status != triton::engines::solver::UNSAT || queries[1].limit != 1 || queries[1].status != triton::engines::solver::SAT) {
+    std::cerr << "test_72: KO (corpus)" << std::endl;
+    return 1;
+  }
+
+  auto model = replay.getModel(queries[1].node);
+  if (model.size() != 1 || model.begin()->second.getValue() != 9) {
+    std::cerr << "test_72: KO (replay)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_72: OK" << std::endl;
+  return 0;
+}
+
+
+int test_73(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+
+  ctx.setConcreteMemoryValue(0x1000, 0x41);
+  ctx.symbolizeRegister(ctx.registers.x86_rbx);
+
+  triton::arch::Instruction inst(0x400000, "\x48\x01\xd8", 3); /* add rax, rbx */
+  ctx.processing(inst);
+
+  auto usage = ctx.getMemoryUsage();
+  if (usage.astNodes.empty() || usage.symbolicExpressions == 0 || usage.symbolicRegisters == 0 || usage.concreteMemoryPages != 1 || usage.astChildrenBytes == 0 || usage.totalBytes == 0) {
+    std::cerr << "test_73: KO (usage)" << std::endl;
+    return 1;
+  }
+
+  /* The nodes are counted while they are alive */
+  auto before = ctx.getMemoryUsage().astNodes[triton::ast::BVNAND_NODE];
+  auto node = ast->bvnand(ast->bv(1, 8), ast->bv(2, 8));
+  auto during = ctx.getMemoryUsage().astNodes[triton::ast::BVNAND_NODE];
+  node = nullptr;
+  auto after = ctx.getMemoryUsage().astNodes[triton::ast::BVNAND_NODE];
+
+  if (during != before + 1 || after != before) {
+    std::cerr << "test_73: KO (nodes)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_73: OK" << std::endl;
+  return 0;
+}
+
+
+int test_74(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  #ifndef TRITON_TRACING
+  try {
+    ctx.enableTracing(true);
+    std::cerr << "test_74: KO (tracing)" << std::endl;
+    return 1;
+  }
+  catch (const triton::exceptions::Context&) {
+    std::cout << "test_74: OK (no tracing)" << std::endl;
+    return 0;
+  }
+  #else
+  ctx.clearTrace();
+  ctx.enableTracing(true);
+
+  triton::arch::Instruction inst(0x400000, "\x48\x01\xd8", 3); /* add rax, rbx */
+  ctx.processing(inst);
+  ctx.enableTracing(false);
+
+  auto events = ctx.dumpTrace("./trace.json");
+  ctx.dumpTrace("./trace.pftrace", true);
+
+  std::ifstream stream("./trace.json");
+  std::stringstream json;
+  json << stream.rdbuf();
+  stream.close();
+  std::remove("./trace.json");
+  std::remove("./trace.pftrace");
+  ctx.clearTrace();
+
+  /* The processing, its semantics and its expressions */
+  if (events < 3 || json.str().find("\"name\":\"Context::processing\"") == std::string::npos || json.str().find("\"name\":\"IrBuilder::buildSemantics\"") == std::string::npos) {
+    std::cerr << "test_74: KO (trace)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_74: OK" << std::endl;
+  return 0;
+  #endif
+}
+
+
+int test_75(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+
+  /* The lanes of a vector built from lanes are the same nodes */
+  auto x = ast->variable(ctx.newSymbolicVariable(8, "x"));
+  auto y = ast->variable(ctx.newSymbolicVariable(8, "y"));
+  auto vec = ast->concatLanes({x, y, ast->bv(3, 8), ast->bv(4, 8)});
+  auto lanes = ast->lanes(vec, 8);
+
+  if (vec->getBitvectorSize() != 32 || lanes.size() != 4 || lanes[0] != x || lanes[1] != y || ast->lane(vec, 8, 1) != y) {
+    std::cerr << "test_75: KO (lanes)" << std::endl;
+    return 1;
+  }
+
+  /* Lane 0 is the least significant */
+  auto cst = ast->zipLanes(ast->bv(0x04030201, 32), ast->bv(0x10101010, 32), 8, [&](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+    return ast->bvadd(a, b);
+  });
+  auto ins = ast->insertLane(ast->bv(0x04030201, 32), 2, ast->bv(0xaa, 8));
+  auto spl = ast->splat(ast->bv(0x12, 8), 4);
+
+  if (cst->evaluate() != 0x14131211 || ins->evaluate() != 0x04aa0201 || spl->evaluate() != 0x12121212) {
+    std::cerr << "test_75: KO (values)" << std::endl;
+    return 1;
+  }
+
+  /* The packed semantics are built on the lanes */
+  ctx.setConcreteRegisterValue(ctx.registers.x86_xmm0, triton::uint512("0x000102030405060708090a0b0c0d0e0f"));
+  ctx.setConcreteRegisterValue(ctx.registers.x86_xmm1, triton::uint512("0xffffffffffffffffffffffffffffffff"));
+
+  triton::arch::Instruction inst(0x400000, "\x66\x0f\xfc\xc1", 4); /* paddb xmm0, xmm1 */
+  ctx.processing(inst);
+
+  if (ctx.getConcreteRegisterValue(ctx.registers.x86_xmm0) != triton::uint512("0xff000102030405060708090a0b0c0d0e")) {
+    std::cerr << "test_75: KO (paddb)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_75: OK" << std::endl;
+  return 0;
+}
+
+
+int test_76(void) {
+  /* Byte and word writes: mov al, bl; add al, 3; mov ah, al; inc ax; mov rcx, rax */
+  std::vector<std::string> code = {"\x88\xd8", "\x04\x03", "\x88\xc4", "\x66\xff\xc0", "\x48\x89\xc1"};
+  triton::Context ref(triton::arch::ARCH_X86_64);
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  std::vector<triton::uint32> sizes;
+
+  ctx.setMode(triton::modes::LAZY_SUBREGISTERS, true);
+  for (auto* c : {&ref, &ctx}) {
+    c->setConcreteRegisterValue(c->registers.x86_rax, 0x1122334455667788);
+    c->setConcreteRegisterValue(c->registers.x86_rbx, 0x42);
+    auto var = c->symbolizeRegister(c->registers.x86_rbx);
+    triton::uint64 addr = 0x1000;
+    for (const auto& opcode : code) {
+      triton::arch::Instruction inst(addr, opcode.data(), static_cast<triton::uint32>(opcode.size()));
+      c->processing(inst);
+      sizes.push_back(inst.symbolicExpressions.front()->getAst()->getBitvectorSize());
+      addr += inst.getSize();
+    }
+    /* The AST of rcx is evaluated again with another value of rbx */
+    c->setConcreteVariableValue(var, 0x99);
+  }
+
+  /* The first write of al is kept as a byte slice */
+  if (sizes[0] != 64 || sizes[code.size()] != 8) {
+    std::cerr << "test_76: KO (slice)" << std::endl;
+    return 1;
+  }
+
+  auto expr1 = ref.getSymbolicRegister(ref.registers.x86_rcx);
+  auto expr2 = ctx.getSymbolicRegister(ctx.registers.x86_rcx);
+  if (ctx.getConcreteRegisterValue(ctx.registers.x86_rcx) != 0x1122334455664546 ||
+      ref.getConcreteRegisterValue(ref.registers.x86_rcx) != ctx.getConcreteRegisterValue(ctx.registers.x86_rcx) ||
+      ctx.isRegisterSymbolized(ctx.registers.x86_rax) == false ||
+      triton::ast::unroll(expr1->getAst())->evaluate() != triton::ast::unroll(expr2->getAst())->evaluate()) {
+    std::cerr << "test_76: KO (rcx)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_76: OK" << std::endl;
+  return 0;
+}
+
+
+int test_77(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  ctx.setMode(triton::modes::ALIGNED_MEMORY, true);
+
+  ctx.setConcreteMemoryAreaValue(0x1000, {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88});
+  ctx.setConcreteMemoryAreaValue(0x2000, {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88});
+  ctx.symbolizeMemory(triton::arch::MemoryAccess(0x1000, triton::size::qword));
+  ctx.symbolizeMemory(triton::arch::MemoryAccess(0x2000, triton::size::dword));
+  ctx.symbolizeMemory(triton::arch::MemoryAccess(0x2004, triton::size::dword));
+
+  /* A narrower load is one extraction of the stored cell */
+  auto narrow = ctx.getMemoryAst(triton::arch::MemoryAccess(0x1002, triton::size::dword));
+  if (narrow->getType() != triton::ast::EXTRACT_NODE || narrow->getChildren()[2]->getType() != triton::ast::VARIABLE_NODE || narrow->evaluate() != 0x66554433) {
+    std::cerr << "test_77: KO (narrow)" << std::endl;
+    return 1;
+  }
+
+  /* A wider load is one concatenation of the stored cells, with the bytes out of them */
+  auto wide = ctx.getMemoryAst(triton::arch::MemoryAccess(0x2000, triton::size::qword));
+  auto tail = ctx.getMemoryAst(triton::arch::MemoryAccess(0x2006, triton::size::dword));
+  if (wide->getType() != triton::ast::CONCAT_NODE || wide->getChildren().size() != 2 || wide->evaluate() != 0x8877665544332211 ||
+      tail->getChildren().size() != 3 || tail->evaluate() != 0x00008877) {
+    std::cerr << "test_77: KO (wide)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_77: OK" << std::endl;
+  return 0;
+}
+
+
+int test_78(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  ctx.setMode(triton::modes::EFFECTIVE_ADDRESS_CACHE, true);
+
+  /* mov rax, qword ptr [rbx + 8] */
+  triton::arch::Instruction inst1(0x400000, "\x48\x8b\x43\x08", 4);
+  triton::arch::Instruction inst2(0x400000, "\x48\x8b\x43\x08", 4);
+  triton::arch::Instruction inst3(0x400000, "\x48\x8b\x43\x08", 4);
+
+  /* The same registers give the same effective address */
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rbx, 0x1000);
+  ctx.symbolizeRegister(ctx.registers.x86_rbx);
+  ctx.processing(inst1);
+  ctx.processing(inst2);
+  auto lea1 = inst1.operands[1].getConstMemory().getLeaAst();
+  auto lea2 = inst2.operands[1].getConstMemory().getLeaAst();
+  if (lea1 != lea2 || inst2.operands[1].getConstMemory().getAddress() != 0x1008) {
+    std::cerr << "test_78: KO (symbolic)" << std::endl;
+    return 1;
+  }
+
+  /* A concrete effective address is a constant */
+  ctx.concretizeRegister(ctx.registers.x86_rbx);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rbx, 0x2000);
+  ctx.processing(inst3);
+  auto lea3 = inst3.operands[1].getConstMemory().getLeaAst();
+  if (lea3 == lea1 || lea3->getType() != triton::ast::BV_NODE || lea3->evaluate() != 0x2008) {
+    std::cerr << "test_78: KO (concrete)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_78: OK" << std::endl;
+  return 0;
+}
+
+
+#ifdef TRITON_UNICORN_INTERFACE
+int test_79(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  triton::engines::emulation::UnicornEmulator emulator(ctx);
+
+  /* mov rax, 1; add rbx, rax; mov rcx, 2 */
+  emulator.mapMemory(0x1000, 0x1000);
+  emulator.setMemoryAreaValue(0x1000, {0x48, 0xc7, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x48, 0x01, 0xc3, 0x48, 0xc7, 0xc1, 0x02, 0x00, 0x00, 0x00});
+
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rbx, 5);
+  ctx.symbolizeRegister(ctx.registers.x86_rbx);
+  emulator.synchronizeToUnicorn(0, 0);
+
+  /* Only the instruction reading rbx goes through the semantics */
+  if (emulator.run(0x1000, 0x1011) != 3 || emulator.getProcessedCount() != 1) {
+    std::cerr << "test_79: KO (" << emulator.getExecutedCount() << " executed, " << emulator.getProcessedCount() << " processed)" << std::endl;
+    return 1;
+  }
+
+  emulator.synchronizeToContext();
+  if (!ctx.isRegisterSymbolized(ctx.registers.x86_rbx) || ctx.getConcreteRegisterValue(ctx.registers.x86_rbx) != 6 ||
+      ctx.getConcreteRegisterValue(ctx.registers.x86_rcx) != 2) {
+    std::cerr << "test_79: KO (state)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_79: OK" << std::endl;
+  return 0;
+}
+#endif
+
+
+int test_80(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  /* The header, then mov rax, qword ptr [rbx] with rbx = 0x1000 and the qword at 0x1000 = 42 */
+  std::string trace("TTRC\x01\x00", 6);
+  trace += std::string(1, static_cast<char>(triton::arch::ARCH_X86_64)) + std::string(1, '\0');
+  trace += std::string("\x00\x00\x40\x00\x00\x00\x00\x00\x03\x48\x8b\x03", 12);
+  trace += std::string(1, '\x01') + std::string(1, '\0');
+  trace += std::string(1, static_cast<char>(triton::arch::ID_REG_X86_RBX & 0xff)) + std::string(1, static_cast<char>(triton::arch::ID_REG_X86_RBX >> 8));
+  trace += std::string("\x08\x00\x10\x00\x00\x00\x00\x00\x00", 9);
+  trace += std::string("\x01\x00\x00\x10\x00\x00\x00\x00\x00\x00\x08\x00\x00\x00", 14);
+  trace += std::string("\x2a\x00\x00\x00\x00\x00\x00\x00", 8);
+
+  /* The symbolic register keeps its expression */
+  ctx.symbolizeRegister(ctx.registers.x86_rbx);
+  std::istringstream stream(trace);
+  triton::loaders::TraceReader reader(stream);
+  if (ctx.replayTrace(reader) != 1 || ctx.getConcreteRegisterValue(ctx.registers.x86_rax) != 42 || !ctx.isRegisterSymbolized(ctx.registers.x86_rbx)) {
+    std::cerr << "test_80: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_80: OK" << std::endl;
+  return 0;
+}
+
+
+int test_81(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  /* add rax, 1 with rax symbolized, a page of memory and a tainted byte */
+  ctx.symbolizeRegister(ctx.registers.x86_rax);
+  ctx.setConcreteMemoryAreaValue(0x1000, std::vector<triton::uint8>(0x1000, 0x11));
+  ctx.taintMemory(0x1004);
+  triton::arch::Instruction inst(0x400000, "\x48\x83\xc0\x01", 4);
+  ctx.processing(inst);
+  auto actx = ctx.getAstContext();
+  ctx.pushPathConstraint(actx->equal(ctx.getOperandAst(triton::arch::OperandWrapper(ctx.registers.x86_rax)), actx->bv(10, 64)));
+  ctx.save("./checkpoint.tckp");
+
+  triton::Context other(triton::arch::ARCH_X86_64);
+  other.load("./checkpoint.tckp");
+
+  bool ok = other.getConcreteMemoryValue(0x1fff) == 0x11 &&
+            other.isMemoryTainted(0x1004) && !other.isMemoryTainted(0x1005) &&
+            other.isRegisterSymbolized(other.registers.x86_rax) &&
+            other.getSymbolicRegister(other.registers.x86_rax)->getId() == ctx.getSymbolicRegister(ctx.registers.x86_rax)->getId() &&
+            other.getPathConstraints().size() == 1;
+
+  std::remove("./checkpoint.tckp");
+
+  if (!ok) {
+    std::cerr << "test_81: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_81: OK" << std::endl;
+  return 0;
+}
+
+
+int test_82(void) {
+  /* cmp al, 0x41 ; jne +2 ; nop ; nop ; nop */
+  triton::engines::exploration::Explorer explorer(
+    [](triton::Context& ctx) {
+      ctx.setArchitecture(triton::arch::ARCH_X86_64);
+      ctx.setConcreteMemoryAreaValue(0x1000, reinterpret_cast<const triton::uint8*>("\x3c\x41\x75\x02\x90\x90\x90"), 7);
+    },
+    [](triton::Context& ctx, const std::vector<triton::uint8>& input) {
+      ctx.setConcreteRegisterValue(ctx.registers.x86_al, input[0]);
+      return std::vector<triton::engines::symbolic::SharedSymbolicVariable>{ctx.symbolizeRegister(ctx.registers.x86_al)};
+    });
+
+  explorer.setWorkers(2);
+  explorer.setTerminationHook([](triton::Context& ctx, const triton::arch::Instruction& inst) {
+    return inst.getAddress() == 0x1006;
+  });
+
+  auto runs = explorer.explore(0x1000, {0x00});
+  const auto& inputs = explorer.getInputs();
+  if (runs != 2 || inputs.size() != 2 || inputs[0][0] != 0x00 || inputs[1][0] != 0x41 || explorer.getCoverage().count(0x1004) == 0) {
+    std::cerr << "test_82: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_82: OK" << std::endl;
+  return 0;
+}
+
+
+int test_83(void) {
+  /* cmp al, 0x41 ; jne +2 ; nop ; nop ; nop */
+  triton::engines::exploration::Explorer explorer(
+    [](triton::Context& ctx) {
+      ctx.setArchitecture(triton::arch::ARCH_X86_64);
+      ctx.setConcreteMemoryAreaValue(0x1000, reinterpret_cast<const triton::uint8*>("\x3c\x41\x75\x02\x90\x90\x90"), 7);
+    },
+    [](triton::Context& ctx, const std::vector<triton::uint8>& input) {
+      ctx.setConcreteRegisterValue(ctx.registers.x86_al, input[0]);
+      return std::vector<triton::engines::symbolic::SharedSymbolicVariable>{ctx.symbolizeRegister(ctx.registers.x86_al)};
+    });
+
+  triton::usize calls = 0;
+  explorer.setWorkers(2);
+  explorer.setScheduler(triton::engines::exploration::SCHEDULER_CUSTOM);
+  explorer.setPriorityHook([&calls](const triton::engines::exploration::TaskInfo& info) {
+    calls++;
+    return static_cast<double>(info.edges);
+  });
+  explorer.setTerminationHook([](triton::Context& ctx, const triton::arch::Instruction& inst) {
+    return inst.getAddress() == 0x1006;
+  });
+
+  auto runs = explorer.explore(0x1000, {0x00});
+  if (runs != 2 || calls != 2 || explorer.getEdgeCount() == 0) {
+    std::cerr << "test_83: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_83: OK" << std::endl;
+  return 0;
+}
+
+
+int test_84(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  ctx.setMode(triton::modes::STATE_MERGING, true);
+
+  /* cmp al, 0x41 ; jne +4 ; mov bl, 1 ; jmp +2 ; mov bl, 2 ; nop */
+  ctx.setConcreteMemoryAreaValue(0x1000, reinterpret_cast<const triton::uint8*>("\x3c\x41\x75\x04\xb3\x01\xeb\x02\xb3\x02\x90"), 11);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_al, 0x41);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rip, 0x1000);
+  ctx.symbolizeRegister(ctx.registers.x86_al);
+
+  for (triton::uint64 pc = 0x1000; pc != 0x100a; pc = static_cast<triton::uint64>(ctx.getConcreteRegisterValue(ctx.registers.x86_rip))) {
+    auto opcode = ctx.getConcreteMemoryAreaValue(pc, 16);
+    triton::arch::Instruction inst(pc, opcode.data(), static_cast<triton::uint32>(opcode.size()));
+    ctx.processing(inst);
+  }
+
+  if (ctx.getPathConstraints().size() != 0 || ctx.getMergedPathConstraints().size() != 1 ||
+      ctx.getConcreteRegisterValue(ctx.registers.x86_bl) != 1 || !ctx.isRegisterSymbolized(ctx.registers.x86_bl)) {
+    std::cerr << "test_84: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_84: OK" << std::endl;
+  return 0;
+}
+
+
+int test_85(void) {
+  std::filesystem::path dir = std::filesystem::temp_directory_path() / "triton_test_85";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir / "fuzzer01" / "queue");
+  std::ofstream(dir / "fuzzer01" / "queue" / "id:000000,orig:seed", std::ios::binary).put(0x00);
+
+  /* cmp al, 0x41 ; jne +2 ; nop ; nop ; nop */
+  triton::engines::exploration::FuzzerSync fuzzer(dir.string(), "triton", 0x1000,
+    [](triton::Context& ctx) {
+      ctx.setArchitecture(triton::arch::ARCH_X86_64);
+      ctx.setConcreteMemoryAreaValue(0x1000, reinterpret_cast<const triton::uint8*>("\x3c\x41\x75\x02\x90\x90\x90"), 7);
+    },
+    [](triton::Context& ctx, const std::vector<triton::uint8>& input) {
+      ctx.setConcreteRegisterValue(ctx.registers.x86_al, input[0]);
+      return std::vector<triton::engines::symbolic::SharedSymbolicVariable>{ctx.symbolizeRegister(ctx.registers.x86_al)};
+    });
+  fuzzer.setStopAddresses({0x1006});
+
+  auto first = fuzzer.sync();
+  auto second = fuzzer.sync();
+
+  std::vector<std::filesystem::path> entries;
+  for (const auto& file : std::filesystem::directory_iterator(dir / "triton" / "queue"))
+    entries.push_back(file.path());
+
+  bool ok = (first == 1 && second == 0 && entries.size() == 1 && fuzzer.getCoveredCount() == 1);
+  if (ok) {
+    std::ifstream in(entries[0], std::ios::binary);
+    ok = (in.get() == 0x41 && entries[0].filename().string().compare(0, 26, "id:000000,src:fuzzer01:000") == 0);
+  }
+  std::filesystem::remove_all(dir);
+
+  if (!ok) {
+    std::cerr << "test_85: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_85: OK" << std::endl;
+  return 0;
+}
+
+
+int test_86(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  ctx.setMode(triton::modes::POINTER_RESOLUTION, true);
+
+  /* cmp rax, 3 ; jae +7 ; mov ebx, [rax*4 + 0x2000] */
+  ctx.setConcreteMemoryAreaValue(0x1000, reinterpret_cast<const triton::uint8*>("\x48\x83\xf8\x03\x73\x07\x8b\x1c\x85\x00\x20\x00\x00"), 13);
+  ctx.setConcreteMemoryAreaValue(0x2000, reinterpret_cast<const triton::uint8*>("\x11\x00\x00\x00\x22\x00\x00\x00\x33\x00\x00\x00"), 12);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rax, 1);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rip, 0x1000);
+  auto var = ctx.symbolizeRegister(ctx.registers.x86_rax);
+
+  for (triton::uint64 pc = 0x1000; pc != 0x100d; pc = static_cast<triton::uint64>(ctx.getConcreteRegisterValue(ctx.registers.x86_rip))) {
+    auto opcode = ctx.getConcreteMemoryAreaValue(pc, 16);
+    triton::arch::Instruction inst(pc, opcode.data(), static_cast<triton::uint32>(opcode.size()));
+    ctx.processing(inst);
+  }
+
+  auto actx  = ctx.getAstContext();
+  auto ebx   = ctx.getRegisterAst(ctx.registers.x86_ebx);
+  auto model = ctx.getModel(actx->land(ctx.getPathPredicate(), actx->equal(ebx, actx->bv(0x33, 32))));
+
+  if (ctx.getConcreteRegisterValue(ctx.registers.x86_ebx) != 0x22 || model.size() != 1 || model[var->getId()].getValue() != 2) {
+    std::cerr << "test_86: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_86: OK" << std::endl;
+  return 0;
+}
+
+
+int test_87(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  triton::engines::symbolic::PassManager manager(ctx);
+
+  /* xor eax, eax ; test eax, eax ; jne 0x10 | mov rbx, 1 ; mov rbx, 1 ; ret | mov rbx, 2 ; ret */
+  triton::arch::BasicBlock block1({
+    triton::arch::Instruction(0x0, "\x31\xc0", 2),
+    triton::arch::Instruction(0x2, "\x85\xc0", 2),
+    triton::arch::Instruction(0x4, "\x75\x0a", 2),
+  });
+  triton::arch::BasicBlock block2({
+    triton::arch::Instruction(0x6, "\x48\xc7\xc3\x01\x00\x00\x00", 7),
+    triton::arch::Instruction(0xd, "\x48\xc7\xc3\x01\x00\x00\x00", 7),
+    triton::arch::Instruction(0x14, "\xc3", 1),
+  });
+  triton::arch::BasicBlock block3({
+    triton::arch::Instruction(0x10, "\x48\xc7\xc3\x02\x00\x00\x00", 7),
+    triton::arch::Instruction(0x17, "\xc3", 1),
+  });
+
+  manager.addPass(triton::engines::symbolic::PASS_OPAQUE_PREDICATES);
+  manager.addPass(triton::engines::symbolic::PASS_REDUNDANT_WRITES);
+  manager.addPass(triton::engines::symbolic::PASS_DEAD_STORES);
+  auto blocks = manager.run({block1, block2, block3});
+  const auto& stats = manager.getStatistics();
+
+  if (blocks.size() != 3 || blocks[0].getSize() != 2 || blocks[1].getSize() != 2 || blocks[2].getSize() != 0 ||
+      stats.instructions != 8 || stats.kept != 4 || stats.opaquePredicates != 1 || stats.unreachableBlocks != 1 || stats.redundantWrites != 1) {
+    std::cerr << "test_87: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_87: OK" << std::endl;
+  return 0;
+}
+
+
+int test_88(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  std::vector<triton::callbacks::AccessRecord> records;
+  triton::callbacks::AccessStream stream([&](const triton::callbacks::AccessRecord& record) { records.push_back(record); }, 2);
+
+  /* mov rax, 0x1122 ; mov [rsp], rax ; mov rbx, [rsp] */
+  triton::arch::Instruction inst1(0x1000, "\x48\xc7\xc0\x22\x11\x00\x00", 7);
+  triton::arch::Instruction inst2(0x1007, "\x48\x89\x04\x24", 4);
+  triton::arch::Instruction inst3(0x100b, "\x48\x8b\x1c\x24", 4);
+
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rsp, 0x8000);
+  ctx.setAccessStream(&stream);
+  ctx.processing(inst1);
+  ctx.processing(inst2);
+  ctx.processing(inst3);
+  ctx.setAccessStream(nullptr);
+  stream.flush();
+
+  bool rbx = false;
+  if (records.size() == 3) {
+    for (const auto& reg : records[2].registers)
+      rbx |= (reg.first == triton::arch::ID_REG_X86_RBX && reg.second == 0x1122);
+  }
+
+  if (stream.getCapacity() != 2 || stream.getRecordCount() != 3 || records.size() != 3 || rbx == false ||
+      records[0].address != 0x1000 || records[0].loads.size() != 0 ||
+      records[1].stores.size() != 1 || records[1].stores[0].address != 0x8000 || records[1].stores[0].size != 8 || records[1].stores[0].value != 0x1122 ||
+      records[2].loads.size() != 1 || records[2].loads[0].value != 0x1122) {
+    std::cerr << "test_88: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_88: OK" << std::endl;
+  return 0;
+}
+
+
+int test_89(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  /* mov rax, rbx ; add rax, rcx ; xor rdx, rdx */
+  triton::arch::Instruction inst1(0x1000, "\x48\x89\xd8", 3);
+  triton::arch::Instruction inst2(0x1003, "\x48\x01\xc8", 3);
+  triton::arch::Instruction inst3(0x1006, "\x48\x31\xd2", 3);
+
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rbx, 0x10);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rcx, 0x20);
+  ctx.symbolizeRegister(ctx.registers.x86_rbx);
+  ctx.processing(inst1);
+  ctx.processing(inst2);
+  ctx.processing(inst3);
+
+  auto trace = ctx.getSsaTrace();
+  auto expr  = ctx.getSymbolicRegister(ctx.registers.x86_rax);
+  auto value = trace.getValue(expr->getId());
+  auto ast   = trace.getAst(ctx.getAstContext(), value);
+  auto slice = trace.getSlice(value);
+
+  std::ostringstream stream;
+  stream << trace;
+
+  if (trace.getDefinitions().size() != ctx.getSymbolicExpressions().size() ||
+      ast->evaluate() != 0x30 || !ast->isSymbolized() ||
+      slice.back() != value || slice.size() >= trace.getOperations().size() ||
+      trace.getOperations()[slice.front()].type != triton::ast::VARIABLE_NODE ||
+      stream.str().find("bvadd") == std::string::npos) {
+    std::cerr << "test_89: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_89: OK" << std::endl;
+  return 0;
+}
+
+
+int test_90(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  /* mov rax, rbx ; mov rcx, rbx, the writes of the second one being concretized by the hook */
+  triton::arch::Instruction inst1(0x100, "\x48\x89\xd8", 3);
+  triton::arch::Instruction inst2(0x103, "\x48\x89\xd9", 3);
+
+  ctx.setConcretizationHook([](triton::Context& ctx, const triton::arch::Instruction& inst) {
+    return inst.getAddress() == 0x103;
+  });
+  ctx.symbolizeRegister(ctx.registers.x86_rbx);
+  ctx.processing(inst1);
+  ctx.processing(inst2);
+
+  const auto& events = ctx.getConcretizationEvents();
+  if (!ctx.isRegisterSymbolized(ctx.registers.x86_rax) || ctx.isRegisterSymbolized(ctx.registers.x86_rcx) ||
+      events.size() != 1 || events[0].rule != triton::engines::symbolic::CONCRETIZATION_HOOK ||
+      events[0].reg != triton::arch::ID_REG_X86_RCX || events[0].address != 0x103) {
+    std::cerr << "test_90: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_90: OK" << std::endl;
+  return 0;
+}
+
+
+int test_91(void) {
+  #ifdef TRITON_Z3_INTERFACE
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+
+  /* A deep chain of shared subexpressions, exponential as a tree */
+  auto var = ctx.newSymbolicVariable(64);
+  ctx.setConcreteVariableValue(var, 3);
+  auto node = actx->variable(var);
+  for (triton::uint32 i = 0; i < 20000; i++)
+    node = actx->bvadd(node, node);
+
+  triton::ast::TritonToZ3 z3Ast{false};
+  z3::expr expr = z3Ast.convert(node);
+
+  triton::ast::Z3ToTriton fresh{actx};
+  auto converted = fresh.convert(expr);
+
+  triton::ast::Z3ToTriton back{actx, &z3Ast};
+  auto original = back.convert(expr);
+
+  if (converted->getHash() != node->getHash() || converted->evaluate() != node->evaluate() || original != node || z3Ast.getOrigin(expr) != node) {
+    std::cerr << "test_91: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_91: OK" << std::endl;
+  #else
+  std::cout << "test_91: OK (no z3)" << std::endl;
+  #endif
+  return 0;
+}
+
+
+int test_92(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto cpu = ctx.getCpuInstance();
+
+  /* Unaligned accesses across a page boundary */
+  cpu->storeConcreteMemory<triton::uint64>(0x1ffd, 0x1122334455667788);
+  cpu->storeConcreteMemory<triton::uint128>(0x3ff9, (triton::uint128(0xaabbccddeeff0011) << 64) | 0x2233445566778899);
+
+  if (cpu->loadConcreteMemory<triton::uint64>(0x1ffd) != 0x1122334455667788 ||
+      cpu->loadConcreteMemory<triton::uint32>(0x1ffe) != 0x44556677 ||
+      cpu->loadConcreteMemory<triton::uint16>(0x2002) != 0x2233 ||
+      cpu->loadConcreteMemory<triton::uint8>(0x1ffd) != 0x88 ||
+      ctx.getConcreteMemoryValue(triton::arch::MemoryAccess(0x1ffd, triton::size::qword)) != 0x1122334455667788 ||
+      ctx.getConcreteMemoryValue(triton::arch::MemoryAccess(0x3ff9, triton::size::dqword)) != cpu->loadConcreteMemory<triton::uint128>(0x3ff9) ||
+      ctx.getConcreteMemoryValue(0x4008) != 0xaa) {
+    std::cerr << "test_92: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_92: OK" << std::endl;
+  return 0;
+}
+
+
+int test_93(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto cpu = ctx.getCpuInstance();
+  triton::uint128 xmm = (triton::uint128(0x0123456789abcdef) << 64) | 0xfedcba9876543210;
+
+  cpu->storeConcreteRegister<triton::uint64>(ctx.registers.x86_rax, 0x1122334455667788);
+  cpu->storeConcreteRegister<triton::uint16>(ctx.registers.x86_ax, 0xbeef);
+  cpu->storeConcreteRegister<triton::uint128>(ctx.registers.x86_xmm1, xmm);
+
+  if (cpu->loadConcreteRegister<triton::uint8>(ctx.registers.x86_ah) != 0xbe ||
+      cpu->loadConcreteRegister<triton::uint32>(ctx.registers.x86_eax) != 0x5566beef ||
+      ctx.getConcreteRegisterValue(ctx.registers.x86_rax) != 0x112233445566beef ||
+      cpu->loadConcreteRegister<triton::uint128>(ctx.registers.x86_xmm1) != xmm ||
+      ctx.getConcreteRegisterValue(ctx.registers.x86_xmm1) != xmm) {
+    std::cerr << "test_93: KO (access)" << std::endl;
+    return 1;
+  }
+
+  /* A value too big is still rejected */
+  try {
+    cpu->storeConcreteRegister<triton::uint32>(ctx.registers.x86_ax, 0x10000);
+    std::cerr << "test_93: KO (size)" << std::endl;
+    return 1;
+  }
+  catch (const triton::exceptions::Register&) {
+  }
+
+  /* The callbacks are still called */
+  ctx.addCallback(triton::callbacks::GET_CONCRETE_REGISTER_VALUE, triton::callbacks::nativeCallback(cb_test_70_get));
+  if (cpu->loadConcreteRegister<triton::uint16>(ctx.registers.x86_rcx) != 0x1234) {
+    std::cerr << "test_93: KO (callback)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_93: OK" << std::endl;
+  return 0;
+}
+
+
+int test_94(void) {
+  triton::Context src(triton::arch::ARCH_X86_64);
+  triton::Context dst(triton::arch::ARCH_X86_64);
+  auto sctx = src.getAstContext();
+  auto dctx = dst.getAstContext();
+
+  auto x = src.newSymbolicVariable(32);
+  auto y = src.newSymbolicVariable(32);
+  src.setConcreteVariableValue(x, 5);
+  src.setConcreteVariableValue(y, 7);
+
+  /* A reference and a shared subexpression */
+  auto e = src.newSymbolicExpression(sctx->bvmul(sctx->variable(x), sctx->bv(3, 32)));
+  auto shared = sctx->bvadd(sctx->reference(e), sctx->variable(y));
+  auto node = sctx->equal(sctx->bvxor(shared, shared), sctx->bv(0, 32));
+
+  /* x is mapped to a variable of the destination, y is new there and keeps its value */
+  auto w = dst.newSymbolicVariable(32);
+  dst.setConcreteVariableValue(w, 1);
+  auto copy = dctx->import(shared, {{x->getId(), w}});
+  auto pred = dctx->import(node);
+
+  if (copy->getContext() != dctx || copy->evaluate() != 10 || pred->evaluate() != 1 ||
+      triton::ast::search(copy, triton::ast::REFERENCE_NODE).size() != 0 ||
+      triton::ast::search(pred, triton::ast::BVADD_NODE).size() != 1) {
+    std::cerr << "test_94: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_94: OK" << std::endl;
+  return 0;
+}
+
+
+int test_95(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+
+  actx->setReclamation(true, 4);
+  ctx.symbolizeRegister(ctx.registers.x86_rax);
+
+  /* A chain of references, only owned by rax */
+  for (triton::uint32 i = 0; i < 1000; i++) {
+    triton::arch::Instruction inst(reinterpret_cast<const triton::uint8*>("\x48\xff\xc0"), 3);
+    ctx.processing(inst);
+  }
+
+  triton::usize before = actx->getLiveNodes(triton::ast::REFERENCE_NODE);
+  ctx.concretizeAllRegister();
+  actx->flushReclamation();
+  triton::usize after = actx->getLiveNodes(triton::ast::REFERENCE_NODE);
+
+  if (!actx->isReclamationEnabled() || before < 1000 || after * 10 > before || ctx.getConcreteRegisterValue(ctx.registers.x86_rax) != 1000) {
+    std::cerr << "test_95: KO" << std::endl;
+    return 1;
+  }
+
+  actx->setReclamation(false);
+  if (actx->isReclamationEnabled()) {
+    std::cerr << "test_95: KO (disable)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_95: OK" << std::endl;
+  return 0;
+}
+
+
+int test_96(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+  auto x = actx->variable(ctx.newSymbolicVariable(8, "x"));
+  triton::uint512 value = 0;
+
+  ctx.enableSolverStatistics(true);
+
+  /* Varies on the samples, rejected without query */
+  if (ctx.isOpaquePredicate(actx->equal(x, actx->bv(0x41, 8))) || ctx.getSolverStatistics().queries != 0) {
+    std::cerr << "test_96: KO (rejected)" << std::endl;
+    return 1;
+  }
+
+  /* x * (x + 1) is always even */
+  auto even = actx->bvand(actx->bvmul(x, actx->bvadd(x, actx->bv(1, 8))), actx->bv(1, 8));
+  if (!actx->sampleConstant(even, 256, &value) || value != 0 || !ctx.isOpaquePredicate(even, &value) || value != 0 || ctx.getSolverStatistics().queries != 1) {
+    std::cerr << "test_96: KO (proved)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_96: OK" << std::endl;
+  return 0;
+}
+
+
+int test_97(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+  auto x = actx->variable(ctx.newSymbolicVariable(8, "x"));
+
+  /* Thread 1 takes x == 1 then x != 3, thread 2 takes x != 2 in between */
+  triton::uint32 tids[] = {1, 2, 1};
+  triton::uint64 values[] = {1, 2, 3};
+  for (triton::usize i = 0; i < 3; i++) {
+    triton::engines::symbolic::PathConstraint pco;
+    auto cond = actx->equal(x, actx->bv(values[i], 8));
+    pco.addBranchConstraint(i == 0, 0x10 * (i + 1), 0x10 * (i + 1) + 1, cond);
+    pco.addBranchConstraint(i != 0, 0x10 * (i + 1), 0x10 * (i + 1) + 2, actx->lnot(cond));
+    pco.setThreadId(tids[i]);
+    ctx.pushPathConstraint(pco);
+  }
+
+  auto indexes = ctx.getPathConstraintIndexesOfThread(1);
+  auto threads = ctx.getPathConstraintThreads();
+  if (indexes != std::vector<triton::usize>({0, 2}) || threads != std::vector<triton::uint32>({1, 2}) || ctx.getPathConstraintsOfThread(2).size() != 1) {
+    std::cerr << "test_97: KO (indexes)" << std::endl;
+    return 1;
+  }
+
+  /* Under the whole path, x == 2 contradicts x == 1, not under the constraints of thread 2 */
+  auto all = ctx.solveAllBranchFlips(1);
+  auto flips = ctx.solveAllBranchFlipsOfThread(2, 1);
+  triton::usize sat = 0;
+  for (const auto& flip : all)
+    sat += (flip.status == triton::engines::solver::SAT);
+  if (all.size() != 3 || sat != 1 || flips.size() != 1 || flips[0].index != 1 || flips[0].status != triton::engines::solver::SAT || flips[0].model.begin()->second.getValue() != 2) {
+    std::cerr << "test_97: KO (flips)" << std::endl;
+    return 1;
+  }
+
+  ctx.popPathConstraint();
+  if (ctx.getPathConstraintIndexesOfThread(1) != std::vector<triton::usize>({0}) || ctx.getPathPredicateOfThread(1)->evaluate() != 0) {
+    std::cerr << "test_97: KO (pop)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_97: OK" << std::endl;
+  return 0;
+}
+
+
+int test_98(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+  triton::ast::SharedAbstractNode mem = actx->array(64);
+  triton::ast::SharedAbstractNode half = nullptr;
+
+  /* Each store shares the cells of the previous one */
+  for (triton::uint64 i = 0; i < 10000; i++) {
+    mem = actx->store(mem, actx->bv(0x7fff0000 + i * 3, 64), actx->bv(i & 0xff, 8));
+    if (i == 4999)
+      half = mem;
+  }
+
+  const auto& memory = reinterpret_cast<triton::ast::StoreNode*>(mem.get())->getMemory();
+  const auto& older  = reinterpret_cast<triton::ast::StoreNode*>(half.get())->getMemory();
+  if (memory.size() != 10000 || older.size() != 5000 || older.isDefined(0x7fff0000 + 5000 * 3) || memory.getCells().front().first != 0x7fff0000) {
+    std::cerr << "test_98: KO (cells)" << std::endl;
+    return 1;
+  }
+
+  for (triton::uint64 i = 0; i < 10000; i += 997) {
+    if (actx->select(mem, actx->bv(0x7fff0000 + i * 3, 64))->evaluate() != (i & 0xff) || memory.select(0x7fff0000 + i * 3 + 1) != 0) {
+      std::cerr << "test_98: KO (select)" << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "test_98: OK" << std::endl;
+  return 0;
+}
+
+
+int test_99(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+
+  #ifdef TRITON_BITWUZLA_INTERFACE
+  ctx.setSolver(triton::engines::solver::SOLVER_BITWUZLA);
+  #endif
+
+  if (!ctx.isSolverValid()) {
+    std::cout << "test_99: OK (no solver)" << std::endl;
+    return 0;
+  }
+
+  auto var = ctx.symbolizeRegister(ctx.registers.x86_eax);
+
+  triton::arch::Instruction cmp1((const unsigned char*)"\x83\xf8\x05", 3); // cmp eax, 5
+  triton::arch::Instruction jz((const unsigned char*)"\x74\x10", 2);        // jz +0x10
+  triton::arch::Instruction cmp2((const unsigned char*)"\x83\xf8\x09", 3); // cmp eax, 9
+  triton::arch::Instruction jb((const unsigned char*)"\x72\x10", 2);        // jb +0x10
+
+  cmp1.setAddress(0x1000);
+  jz.setAddress(0x1003);
+  cmp2.setAddress(0x1005);
+  jb.setAddress(0x1008);
+
+  ctx.processing(cmp1);
+  ctx.processing(jz);
+  ctx.processing(cmp2);
+  ctx.processing(jb);
+
+  /* The session solves the flips in the order of the path, twice with the same constraints */
+  ctx.enableIncrementalSolving(true);
+  for (triton::usize round = 0; round < 2; round++) {
+    auto flips = ctx.solveAllBranchFlips();
+    if (flips.size() != 2 || flips[0].index != 0 || flips[1].index != 1) {
+      std::cerr << "test_99: KO (flips)" << std::endl;
+      return 1;
+    }
+
+    for (const auto& flip : flips) {
+      auto value = flip.status == triton::engines::solver::SAT ? flip.model.at(var->getId()).getValue() : 0;
+      if (flip.status != triton::engines::solver::SAT || (flip.index == 0 && value != 5) || (flip.index == 1 && (value < 9 || value == 5))) {
+        std::cerr << "test_99: KO (model)" << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  std::cout << "test_99: OK" << std::endl;
+  return 0;
+}
+
+
+int test_100(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+
+  ctx.symbolizeRegister(ctx.registers.x86_rax);
+  ctx.symbolizeRegister(ctx.registers.x86_rbx);
+
+  triton::arch::Instruction add((const unsigned char*)"\x48\x01\xd8", 3); // add rax, rbx
+  triton::arch::Instruction imul((const unsigned char*)"\x48\x0f\xaf\xc0", 4); // imul rax, rax
+  add.setAddress(0x1000);
+  imul.setAddress(0x1003);
+  ctx.processing(add);
+  ctx.processing(imul);
+
+  auto root = ast->bvadd(ctx.getRegisterAst(ctx.registers.x86_rax), ctx.getRegisterAst(ctx.registers.x86_rbx));
+
+  /* Same order as the extraction, the references being unrolled or not */
+  triton::ast::TopologicalSort sort;
+  for (bool unroll : {false, true}) {
+    auto expected = triton::ast::childrenExtraction(root, unroll, true);
+    const auto& order = sort.sort(root, unroll);
+
+    std::vector<triton::ast::AbstractNode*> streamed;
+    sort.visit({root.get()}, unroll, [&](triton::ast::AbstractNode* node) { streamed.push_back(node); });
+
+    if (order.size() != expected.size() || streamed.size() != expected.size() || order.back() != root.get()) {
+      std::cerr << "test_100: KO (size)" << std::endl;
+      return 1;
+    }
+
+    for (triton::usize index = 0; index < expected.size(); index++) {
+      if (order[index] != expected[index].get() || streamed[index] != expected[index].get()) {
+        std::cerr << "test_100: KO (order)" << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  std::cout << "test_100: OK" << std::endl;
+  return 0;
+}
+
+
+int test_101(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+
+  if (!ctx.isSolverValid()) {
+    std::cout << "test_101: OK (no solver)" << std::endl;
+    return 0;
+  }
+
+  auto x = actx->variable(ctx.newSymbolicVariable(8));
+  auto y = actx->variable(ctx.newSymbolicVariable(8));
+  auto z = actx->variable(ctx.newSymbolicVariable(8));
+
+  ctx.enableUnsatCoreCache(true);
+
+  /* Two contradictory byte checks make the first query unsatisfiable */
+  bool sat = ctx.isSat(actx->land(std::vector<triton::ast::SharedAbstractNode>{actx->equal(x, actx->bv(1, 8)), actx->bvugt(y, actx->bv(3, 8)), actx->equal(x, actx->bv(2, 8))}));
+  if (sat || ctx.getUnsatCoreCacheSize() != 1 || ctx.getUnsatCoreCacheHits() != 0) {
+    std::cerr << "test_101: KO (core)" << std::endl;
+    return 1;
+  }
+
+  /* They recur in another order, with another constraint */
+  triton::engines::solver::status_e status;
+  auto model = ctx.getModel(actx->land(std::vector<triton::ast::SharedAbstractNode>{actx->equal(x, actx->bv(2, 8)), actx->bvugt(y, actx->bv(3, 8)), actx->equal(z, actx->bv(0, 8)), actx->equal(x, actx->bv(1, 8))}), &status);
+  if (!model.empty() || status != triton::engines::solver::UNSAT || ctx.getUnsatCoreCacheHits() != 1 || ctx.getUnsatCoreCacheSize() != 1) {
+    std::cerr << "test_101: KO (hit)" << std::endl;
+    return 1;
+  }
+
+  /* A query without the core goes to the solver */
+  if (!ctx.isSat(actx->land(actx->equal(x, actx->bv(1, 8)), actx->bvugt(y, actx->bv(3, 8)))) || ctx.getUnsatCoreCacheHits() != 1) {
+    std::cerr << "test_101: KO (miss)" << std::endl;
+    return 1;
+  }
+
+  ctx.enableUnsatCoreCache(false);
+  if (ctx.getUnsatCoreCacheSize() != 0 || ctx.getUnsatCoreCacheHits() != 0) {
+    std::cerr << "test_101: KO (disabled)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_101: OK" << std::endl;
+  return 0;
+}
+
+
+triton::usize test_102_calls = 0;
+
+triton::ast::SharedAbstractNode cb_test_102(triton::Context& ctx, const triton::ast::SharedAbstractNode& node) {
+  test_102_calls++;
+  /* (bvxor x x) => 0 */
+  if (node->getType() == triton::ast::BVXOR_NODE && node->getChildren()[0]->equalTo(node->getChildren()[1]))
+    return ctx.getAstContext()->bv(0, node->getBitvectorSize());
+  return node;
+}
+
+
+int test_102(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+
+  auto x = actx->variable(ctx.newSymbolicVariable(8));
+  auto y = actx->variable(ctx.newSymbolicVariable(8));
+  auto z = actx->variable(ctx.newSymbolicVariable(8));
+
+  ctx.addCallback(triton::callbacks::SYMBOLIC_SIMPLIFICATION, cb_test_102);
+
+  /* A subtree shared by both operands is simplified once */
+  auto shared = actx->bvadd(actx->bvxor(x, x), y);
+  auto root = actx->bvor(shared, shared);
+  auto snode = ctx.simplify(root);
+  triton::usize calls = test_102_calls;
+  if (!snode->equalTo(actx->bvor(actx->bvadd(actx->bv(0, 8), y), actx->bvadd(actx->bv(0, 8), y))) || ctx.getSimplificationMemoSize() == 0) {
+    std::cerr << "test_102: KO (simplify)" << std::endl;
+    return 1;
+  }
+
+  /* Simplifying it again is answered by the memo */
+  if (ctx.simplify(root) != snode || test_102_calls != calls || ctx.getSimplificationMemoHits() != 1) {
+    std::cerr << "test_102: KO (hit)" << std::endl;
+    return 1;
+  }
+
+  /* A new expression over the shared subtree only visits its new nodes */
+  auto other = ctx.simplify(actx->bvsub(shared, z));
+  if (test_102_calls != calls + 2 || !other->equalTo(actx->bvsub(actx->bvadd(actx->bv(0, 8), y), z))) {
+    std::cerr << "test_102: KO (shared)" << std::endl;
+    return 1;
+  }
+
+  /* Changing a mode invalidates the memo */
+  calls = test_102_calls;
+  ctx.setMode(triton::modes::CONSTANT_FOLDING, true);
+  ctx.simplify(root);
+  if (test_102_calls == calls) {
+    std::cerr << "test_102: KO (invalidated)" << std::endl;
+    return 1;
+  }
+
+  ctx.clearSimplificationMemo();
+  if (ctx.getSimplificationMemoSize() != 0 || ctx.getSimplificationMemoHits() != 0) {
+    std::cerr << "test_102: KO (clear)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_102: OK" << std::endl;
+  return 0;
+}
+
+
+int test_103(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  ctx.enableHeatMap(true);
+  ctx.symbolizeRegister(ctx.registers.x86_rbx);
+
+  /* loop: mov rax, rbx; add rax, 1; jmp loop */
+  triton::arch::Instruction mov(0x1000, "\x48\x89\xd8", 3);
+  triton::arch::Instruction add(0x1003, "\x48\x83\xc0\x01", 4);
+  triton::arch::Instruction jmp(0x1007, "\xeb\xf7", 2);
+  for (triton::usize i = 0; i < 3; i++) {
+    ctx.processing(mov);
+    ctx.processing(add);
+    ctx.processing(jmp);
+  }
+
+  auto addresses = ctx.getHotSpots();
+  auto blocks = ctx.getHotSpots(true);
+  if (addresses.size() != 3 || blocks.size() != 1 || blocks[0].first != 0x1000 || blocks[0].second.count != 3) {
+    std::cerr << "test_103: KO (heat map)" << std::endl;
+    return 1;
+  }
+
+  for (const auto& spot : addresses) {
+    if (spot.second.count != 3 || (spot.first == 0x1003 && spot.second.nodes == 0)) {
+      std::cerr << "test_103: KO (address)" << std::endl;
+      return 1;
+    }
+  }
+
+  /* Each frame is an address under its block */
+  std::string path = (std::filesystem::temp_directory_path() / "triton_test_103.folded").string();
+  ctx.exportHeatMap(path, true);
+  std::ifstream folded(path);
+  std::string line;
+  triton::usize lines = 0;
+  while (std::getline(folded, line)) {
+    if (line.rfind("0x1000;0x", 0) != 0) {
+      std::cerr << "test_103: KO (flame graph)" << std::endl;
+      return 1;
+    }
+    lines++;
+  }
+  std::filesystem::remove(path);
+  if (lines == 0) {
+    std::cerr << "test_103: KO (flame graph)" << std::endl;
+    return 1;
+  }
+
+  /* One instruction out of three is measured and counts three times */
+  ctx.enableHeatMap(false);
+  ctx.enableHeatMap(true, 3);
+  for (triton::usize i = 0; i < 3; i++) {
+    ctx.processing(mov);
+    ctx.processing(add);
+    ctx.processing(jmp);
+  }
+
+  triton::uint64 total = 0;
+  for (const auto& spot : ctx.getHotSpots())
+    total += spot.second.count;
+  if (total != 9 || ctx.getHotSpots(false, 1).size() != 1) {
+    std::cerr << "test_103: KO (sampling)" << std::endl;
+    return 1;
+  }
+
+  ctx.enableHeatMap(false);
+  if (ctx.isHeatMapEnabled() || !ctx.getHotSpots().empty()) {
+    std::cerr << "test_103: KO (disabled)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_103: OK" << std::endl;
+  return 0;
+}
+
+
+int test_104(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+
+  /* The fixed-limb kernels against the uint512 arithmetic */
+  for (triton::uint32 size : {65, 128, 129, 200, 256, 300, 512}) {
+    triton::uint512 mask = (size == 512) ? triton::uint512(0) - 1 : (triton::uint512(1) << size) - 1;
+    triton::uint512 a = (triton::uint512(0x0123456789abcdefULL) * triton::uint512(0xfedcba9876543210ULL) * 0x1111111111111111ULL) & mask;
+    triton::uint512 b = (a * a + 0xdeadbeef) & mask;
+    triton::uint512 sign = triton::uint512(1) << (size - 1);
+
+    if (triton::utils::wideAdd(a, b, size) != ((a + b) & mask) ||
+        triton::utils::wideSub(a, b, size) != ((a - b) & mask) ||
+        triton::utils::wideMul(a, b, size) != ((a * b) & mask)) {
+      std::cerr << "test_104: KO (arithmetic " << size << ")" << std::endl;
+      return 1;
+    }
+
+    if (triton::utils::wideShl(b, 63, size) != ((b << 63) & mask) ||
+        triton::utils::wideLshr(b, 65, size) != (b >> 65) ||
+        triton::utils::wideShl(b, size, size) != 0 ||
+        triton::utils::wideAshr(sign, size - 1, size) != mask ||
+        triton::utils::wideAshr(sign, size, size) != mask ||
+        triton::utils::wideRol(a, 1, size) != (((a << 1) | (a >> (size - 1))) & mask) ||
+        triton::utils::wideRor(a, 1, size) != (((a >> 1) | (a << (size - 1))) & mask)) {
+      std::cerr << "test_104: KO (shift " << size << ")" << std::endl;
+      return 1;
+    }
+
+    if (triton::utils::wideUlt(a, b, size) != (a < b) ||
+        triton::utils::wideSlt(sign, 0, size) != true ||
+        triton::utils::wideSlt(0, sign, size) != false ||
+        triton::utils::wideExtract(b, size - 1, 64) != (b >> 64)) {
+      std::cerr << "test_104: KO (compare " << size << ")" << std::endl;
+      return 1;
+    }
+  }
+
+  /* The wide nodes are evaluated by the kernels */
+  auto x = ast->bv(triton::uint512(1) << 127, 128);
+  if (ast->bvashr(x, ast->bv(127, 128))->evaluate() != (triton::uint512(1) << 128) - 1 ||
+      ast->bvshl(x, ast->bv(triton::uint512(1) << 100, 128))->evaluate() != 0 ||
+      ast->bvslt(x, ast->bv(0, 128))->evaluate() != 1 ||
+      ast->bvmul(x, ast->bv(2, 128))->evaluate() != 0) {
+    std::cerr << "test_104: KO (ast)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_104: OK" << std::endl;
+  return 0;
+}
+
+
+int test_105(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+
+  /* The declared constants get the variables of the context */
+  auto x = ast->variable(ctx.newSymbolicVariable(32, "x"));
+  auto e = ctx.newSymbolicExpression(ast->bswap(ast->bvadd(x, ast->bv(1, 32))));
+  auto c = ctx.newSymbolicExpression(ast->equal(ast->reference(e), ast->bv(0x44332211, 32)));
+
+  std::stringstream script;
+  ctx.liftToSMT(script, c, true);
+  auto asserts = ctx.parseSmt(script);
+
+  auto model = ctx.getModel(asserts.at(0));
+  if (asserts.size() != 1 || model.size() != 1 || model.begin()->second.getValue() != 0x11223343) {
+    std::cerr << "test_105: KO (round trip)" << std::endl;
+    return 1;
+  }
+
+  /* Without callback, the parser creates its own variables and shares the let bindings */
+  auto ctxt = std::make_shared<triton::ast::AstContext>(std::make_shared<triton::modes::Modes>());
+  triton::ast::AstSmtParser parser(ctxt);
+  std::istringstream in("(declare-fun a () (_ BitVec 8)) (assert (let ((s (bvmul a a))) (= (bvadd s s) #x02)))");
+  auto nodes = parser.parse(in);
+  auto sum = nodes.at(0)->getChildren()[0];
+
+  if (parser.getVariables().size() != 1 || parser.getVariables().at("a")->getAlias() != "a" || sum->getChildren()[0] != sum->getChildren()[1]) {
+    std::cerr << "test_105: KO (parser)" << std::endl;
+    return 1;
+  }
+
+  try {
+    std::istringstream bad("(push 1)");
+    parser.parse(bad);
+    std::cerr << "test_105: KO (push)" << std::endl;
+    return 1;
+  }
+  catch (const triton::exceptions::Ast&) {
+  }
+
+  std::cout << "test_105: OK" << std::endl;
+  return 0;
+}
+
+
+int test_106(void) {
+  triton::Context ctx(triton::arch::ARCH_X86_64);
+  ctx.setMode(triton::modes::AST_CONCURRENT, true);
+  ctx.setMode(triton::modes::AST_HASH_CONSING, true);
+  ctx.setMode(triton::modes::AST_SLAB_ALLOCATOR, true);
+
+  auto ast = ctx.getAstContext();
+  auto x = ast->variable(ctx.newSymbolicVariable(64, "x"));
+  auto live = ast->getLiveNodes(triton::ast::BVADD_NODE);
+
+  auto chain = [&]() {
+    triton::ast::SharedAbstractNode node = x;
+    for (triton::uint64 i = 0; i < 2000; i++)
+      node = ast->bvadd(node, ast->bv(i % 100 + 1, 64));
+    return node;
+  };
+
+  /* The threads build the same chain in the same context, which shares its nodes */
+  std::vector<triton::ast::SharedAbstractNode> roots(4);
+  std::vector<std::thread> threads;
+  for (triton::usize t = 0; t < roots.size(); t++) {
+    threads.emplace_back([&, t]() {
+      roots[t] = ast->bvxor(chain(), ast->bv(t + 1, 64));
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  auto shared = roots[0]->getChildren()[0];
+  auto built = ast->getLiveNodes(triton::ast::BVADD_NODE);
+  if (chain() != shared || ast->getLiveNodes(triton::ast::BVADD_NODE) != built || built == live || shared->getParents().size() != roots.size()) {
+    std::cerr << "test_106: KO (sharing)" << std::endl;
+    return 1;
+  }
+
+  for (triton::usize t = 0; t < roots.size(); t++) {
+    if (roots[t]->getChildren()[0] != shared || roots[t]->evaluate() != (101000 ^ (t + 1))) {
+      std::cerr << "test_106: KO (evaluation)" << std::endl;
+      return 1;
+    }
+  }
+
+  /* The nodes destroyed by another thread than theirs give back their ids and blocks */
+  shared = nullptr;
+  std::thread([&]() { roots.clear(); }).join();
+  if (ast->getLiveNodes(triton::ast::BVADD_NODE) != live || ast->bvadd(x, ast->bv(1, 64))->evaluate() != 1) {
+    std::cerr << "test_106: KO (release)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_106: OK" << std::endl;
+  return 0;
+}
+
+
+/* Counts the bytes taken from the heap through it and not given back yet */
+class CountingResource : public std::pmr::memory_resource {
+  public:
+    triton::usize allocated   = 0;
+    triton::usize outstanding = 0;
+
+  private:
+    void* do_allocate(std::size_t bytes, std::size_t align) override {
+      this->allocated   += bytes;
+      this->outstanding += bytes;
+      return std::pmr::new_delete_resource()->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t align) override {
+      this->outstanding -= bytes;
+      std::pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+      return this == &other;
+    }
+};
+
+
+int test_107(void) {
+  CountingResource counting;
+
+  for (bool slabs : {false, true}) {
+    /* The slabs are taken from an arena released at once */
+    std::pmr::monotonic_buffer_resource arena(&counting);
+    std::pmr::memory_resource* resource = slabs ? static_cast<std::pmr::memory_resource*>(&arena) : &counting;
+
+    {
+      triton::Context ctx(triton::arch::ARCH_X86_64, resource);
+      ctx.setMode(triton::modes::AST_SLAB_ALLOCATOR, slabs);
+
+      ctx.setConcreteRegisterValue(ctx.registers.x86_rax, 0x41);
+      ctx.symbolizeRegister(ctx.registers.x86_rax);
+      ctx.taintRegister(ctx.registers.x86_rax);
+
+      triton::arch::Instruction inst((const unsigned char*)"\x48\x89\x04\x25\x00\x20\x00\x00", 8); // mov [0x2000], rax
+      ctx.processing(inst);
+
+      if (ctx.getMemoryResource() != resource || ctx.getAstContext()->getMemoryResource() != resource) {
+        std::cerr << "test_107: KO (resource)" << std::endl;
+        return 1;
+      }
+
+      if (ctx.getConcreteMemoryValue(0x2000) != 0x41 || ctx.getSymbolicMemory(0x2000) == nullptr || !ctx.isMemoryTainted(0x2000)) {
+        std::cerr << "test_107: KO (processing)" << std::endl;
+        return 1;
+      }
+
+      if (counting.allocated == 0) {
+        std::cerr << "test_107: KO (allocation)" << std::endl;
+        return 1;
+      }
+    }
+
+    /* Without the arena, everything is given back with the context */
+    if (!slabs && counting.outstanding != 0) {
+      std::cerr << "test_107: KO (release)" << std::endl;
+      return 1;
+    }
+  }
+
+  if (counting.outstanding != 0) {
+    std::cerr << "test_107: KO (arena)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_107: OK" << std::endl;
+  return 0;
+}
+
+
+int main(int ac, const char **av) {
+  if (test_1())
+    return 1;
+
+  if (test_2())
+    return 1;
+
+  if (test_3())
+    return 1;
+
+  if (test_4())
+    return 1;
+
+  if (test_5())
+    return 1;
+
+  if (test_6())
+    return 1;
+
+  if (test_7())
+    return 1;
+
+  if (test_8())
+    return 1;
+
+  if (test_9())
+    return 1;
+
+  #ifdef TRITON_LLVM_INTERFACE
+  if (test_10())
+    return 1;
+  #endif
+
+  if (test_11())
+    return 1;
+
+  if (test_12())
+    return 1;
+
+  if (test_13())
+    return 1;
+
+  if (test_14())
+    return 1;
+
+  if (test_15())
+    return 1;
+
+  if (test_16())
+    return 1;
+
+  if (test_17())
+    return 1;
+
+  if (test_18())
+    return 1;
+
+  if (test_19())
+    return 1;
+
+  if (test_20())
+    return 1;
+
+  if (test_21())
+    return 1;
+
+  if (test_22())
+    return 1;
+
+  if (test_23())
+    return 1;
+
+  if (test_24())
+    return 1;
+
+  if (test_25())
+    return 1;
+
+  #ifdef TRITON_LLVM_INTERFACE
+  if (test_26())
+    return 1;
+  #endif
+
+  if (test_27())
+    return 1;
+
+  if (test_28())
+    return 1;
+
+  if (test_29())
+    return 1;
+
+  if (test_30())
+    return 1;
+
+  if (test_31())
+    return 1;
+
+  if (test_32())
+    return 1;
+
+  if (test_33())
+    return 1;
+
+  if (test_34())
+    return 1;
+
+  if (test_35())
+    return 1;
+
+  if (test_36())
+    return 1;
+
+  if (test_37())
+    return 1;
+
+  if (test_38())
+    return 1;
+
+  if (test_39())
+    return 1;
+
+  if (test_40())
+    return 1;
+
+  if (test_41())
+    return 1;
+
+  if (test_42())
+    return 1;
+
+  if (test_43())
+    return 1;
+
+  if (test_44())
+    return 1;
+
+  if (test_45())
+    return 1;
+
+  if (test_46())
+    return 1;
+
+  if (test_47())
+    return 1;
+
+  if (test_48())
+    return 1;
+
+  if (test_49())
+    return 1;
+
+  if (test_50())
+    return 1;
+
+  if (test_51())
+    return 1;
+
+  if (test_52())
+    return 1;
+
+  if (test_53())
+    return 1;
+
+  if (test_54())
+    return 1;
+
+  if (test_55())
+    return 1;
+
+  if (test_56())
+    return 1;
+
+  if (test_57())
+    return 1;
+
+  if (test_58())
+    return 1;
+
+  if (test_59())
+    return 1;
+
+  if (test_60())
+    return 1;
+
+  if (test_61())
+    return 1;
+
+  if (test_62())
+    return 1;
+
+  if (test_63())
+    return 1;
+
+  if (test_64())
+    return 1;
+
+  if (test_65())
+    return 1;
+
+  if (test_66())
+    return 1;
+
+  if (test_67())
+    return 1;
+
+  if (test_68())
+    return 1;
+
+  if (test_69())
+    return 1;
+
+  if (test_70())
+    return 1;
+
+  if (test_71())
+    return 1;
+
+  if (test_72())
+    return 1;
+
+  if (test_73())
+    return 1;
+
+  if (test_74())
+    return 1;
+
+  if (test_75())
+    return 1;
+
+  if (test_76())
+    return 1;
+
+  if (test_77())
+    return 1;
+
+  if (test_78())
+    return 1;
+
+  #ifdef TRITON_UNICORN_INTERFACE
+  if (test_79())
+    return 1;
+  #endif
+
+  if (test_80())
+    return 1;
+
+  if (test_81())
+    return 1;
+
+  if (test_82())
+    return 1;
+
+  if (test_83())
+    return 1;
+
+  if (test_84())
+    return 1;
+
+  if (test_85())
+    return 1;
+
+  if (test_86())
+    return 1;
+
+  if (test_87())
+    return 1;
+
+  if (test_88())
+    return 1;
+
+  if (test_89())
+    return 1;
+
+  if (test_90())
+    return 1;
+
+  if (test_91())
+    return 1;
+
+  if (test_92())
+    return 1;
+
+  if (test_93())
+    return 1;
+
+  if (test_94())
+    return 1;
+
+  if (test_95())
+    return 1;
+
+  if (test_96())
+    return 1;
+
+  if (test_97())
+    return 1;
+
+  if (test_98())
+    return 1;
+
+  if (test_99())
+    return 1;
+
+  if (test_100())
+    return 1;
+
+  if (test_101())
+    return 1;
+
+  if (test_102())
+    return 1;
+
+  if (test_103())
+    return 1;
+
+  if (test_104())
+    return 1;
+
+  if (test_105())
+    return 1;
+
+  if (test_106())
+    return 1;
+
+  if (test_107())
     return 1;
 
   return 0;
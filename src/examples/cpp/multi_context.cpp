@@ -0,0 +1,89 @@
+/*
+ * Stress test of independent contexts running on several threads. Each worker
+ * builds its own context and symbolically executes the same loop, the workers
+ * must all end with the same state.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <triton/context.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+struct Opcode {
+  const char* opcode;
+  triton::uint32 size;
+};
+
+static const std::vector<Opcode> trace = {
+  {"\x48\x01\xd8",     3},  /* add  rax, rbx       */
+  {"\x48\x31\xc3",     3},  /* xor  rbx, rax       */
+  {"\x48\x29\xc2",     3},  /* sub  rdx, rax       */
+  {"\x48\x89\x04\x24", 4},  /* mov  [rsp], rax     */
+  {"\x48\x8b\x0c\x24", 4},  /* mov  rcx, [rsp]     */
+  {"\x48\x0f\xaf\xc1", 4},  /* imul rax, rcx       */
+  {"\x48\xff\xc2",     3},  /* inc  rdx            */
+};
+
+
+static triton::uint64 worker(triton::usize rounds) {
+  triton::Context ctx(ARCH_X86_64);
+
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rsp, 0x7fff0000);
+  ctx.symbolizeRegister(ctx.registers.x86_rax);
+  ctx.symbolizeRegister(ctx.registers.x86_rbx);
+
+  for (triton::usize round = 0; round < rounds; round++) {
+    ctx.setConcreteRegisterValue(ctx.registers.x86_rip, 0x1000);
+    for (const auto& op : trace) {
+      Instruction inst(ctx.getConcreteRegisterValue(ctx.registers.x86_rip).convert_to<triton::uint64>(), op.opcode, op.size);
+      ctx.processing(inst);
+    }
+  }
+
+  return ctx.getConcreteRegisterValue(ctx.registers.x86_rdx).convert_to<triton::uint64>();
+}
+
+
+int main(int ac, const char **av) {
+  triton::uint32 threads = std::max<triton::uint32>(4, std::thread::hardware_concurrency());
+  triton::usize rounds   = 200;
+
+  triton::uint64 expected = worker(rounds);
+  std::vector<triton::uint64> results(threads);
+  std::vector<std::thread> workers;
+
+  auto start = std::chrono::steady_clock::now();
+  for (triton::uint32 i = 0; i < threads; i++)
+    workers.emplace_back([&results, i, rounds]() { results[i] = worker(rounds); });
+
+  for (auto& t : workers)
+    t.join();
+  auto end = std::chrono::steady_clock::now();
+
+  for (triton::uint32 i = 0; i < threads; i++) {
+    if (results[i] != expected) {
+      std::cerr << "multi_context: KO (worker " << i << ")" << std::endl;
+      return 1;
+    }
+  }
+
+  /* The registers specification is built once and shared by all the contexts */
+  triton::Context a(ARCH_X86_64);
+  triton::Context b(ARCH_X86_64);
+  if (&a.getRegister(ID_REG_X86_RAX) != &b.getRegister(ID_REG_X86_RAX)) {
+    std::cerr << "multi_context: KO (shared specification)" << std::endl;
+    return 1;
+  }
+
+  std::cout << threads << " contexts x " << rounds * trace.size() << " instructions: "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+  std::cout << "multi_context: OK" << std::endl;
+  return 0;
+}
@@ -0,0 +1,38 @@
+/*
+** Serves the queries of the remote solver with the local solver.
+**
+** Usage: remote_worker <port> [threads]
+**
+** Clients use it with:
+**
+**   ctx.setRemoteSolver({"host:port"});
+**
+*/
+
+
+#include <cstdlib>
+#include <iostream>
+#include <triton/config.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/remoteWorker.hpp>
+
+
+
+int main(int ac, const char **av) {
+  if (ac < 2) {
+    std::cerr << "Usage: " << av[0] << " <port> [threads]" << std::endl;
+    return 1;
+  }
+
+  try {
+    triton::engines::solver::RemoteWorker worker(std::atoi(av[1]), ac > 2 ? std::atoi(av[2]) : 0);
+    std::cout << "Serving on port " << worker.getPort() << std::endl;
+    worker.serve();
+  }
+  catch (const triton::exceptions::Exception& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -5,7 +5,13 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <deque>
+#include <exception>
 #include <new>
+#include <system_error>
+#include <thread>
+#include <utility>
 
 #include <triton/aarch64Cpu.hpp>
 #include <triton/aarch64Specifications.hpp>
@@ -22,6 +28,53 @@
 namespace triton {
   namespace arch {
 
+    /*
+     * Disassembles the instruction at `offset` of the area and returns the offset of the next one.
+     * Undecodable bytes are skipped by `step`, leaving a gap which ends the current block.
+     */
+    static triton::usize disassemblyAt(const Architecture& worker, const std::vector<triton::uint8>& area, triton::uint64 addr,
+                                       triton::usize offset, triton::usize step, std::vector<triton::arch::Instruction>& insts) {
+      triton::usize size = std::min<triton::usize>(16, area.size() - offset);
+      triton::arch::Instruction inst(addr + offset, area.data() + offset, static_cast<triton::uint32>(size));
+
+      try {
+        worker.disassembly(inst);
+      }
+      catch (const triton::exceptions::Disassembly&) {
+        return std::min(offset + step, area.size());
+      }
+
+      triton::usize next = offset + inst.getSize();
+      insts.push_back(std::move(inst));
+      return next;
+    }
+
+
+    /* Linearly disassembles the area from `begin` to `end` and returns the offset where the sweep stopped */
+    static triton::usize disassemblyChunk(const Architecture& worker, const std::vector<triton::uint8>& area, triton::uint64 addr,
+                                          triton::usize begin, triton::usize end, triton::usize step, std::vector<triton::arch::Instruction>& insts) {
+      triton::usize offset = begin;
+
+      while (offset < end)
+        offset = disassemblyAt(worker, area, addr, offset, step, insts);
+
+      return offset;
+    }
+
+
+    /* Returns the smallest instruction size of the architecture, by which the sweeps skip undecodable bytes */
+    static triton::usize instructionStep(const Architecture& arch) {
+      switch (arch.getArchitecture()) {
+        case triton::arch::ARCH_AARCH64:
+          return 4;
+        case triton::arch::ARCH_ARM32:
+          return arch.isThumb() ? 2 : 4;
+        default:
+          return 1;
+      }
+    }
+
+
     Architecture::Architecture(triton::callbacks::Callbacks* callbacks) {
       this->arch      = triton::arch::ARCH_INVALID;
       this->callbacks = callbacks;
@@ -172,7 +225,7 @@ namespace triton {
       return this->cpu->getAllRegisters();
     }
 
-    const std::unordered_map<triton::uint64, triton::uint8, IdentityHash<triton::uint64>>& Architecture::getConcreteMemory(void) const {
+    const triton::arch::ConcreteMemory& Architecture::getConcreteMemory(void) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getConcreteMemory(): You must define an architecture.");
       return this->cpu->getConcreteMemory();
@@ -258,8 +311,8 @@ namespace triton {
         auto opcodes = this->getConcreteMemoryAreaValue(addr, 16);
         auto inst = triton::arch::Instruction(addr, reinterpret_cast<triton::uint8*>(opcodes.data()), opcodes.size());
         this->disassembly(inst);
-        ret.push_back(inst);
         addr += inst.getSize();
+        ret.push_back(std::move(inst));
       }
 
       return ret;
@@ -277,11 +330,11 @@ namespace triton {
         auto opcodes = this->getConcreteMemoryAreaValue(addr, 16);
         auto inst = triton::arch::Instruction(addr, reinterpret_cast<triton::uint8*>(opcodes.data()), opcodes.size());
         this->disassembly(inst);
-        ret.push_back(inst);
         addr += inst.getSize();
+        ret.push_back(std::move(inst));
       } while (!filterCallback(ret));
 
-      return triton::arch::BasicBlock(ret);
+      return triton::arch::BasicBlock(std::move(ret));
     }
 
 
@@ -290,6 +343,199 @@ namespace triton {
     }
 
 
+    std::vector<triton::arch::BasicBlock> Architecture::disassemblyBlocks(triton::uint64 addr, triton::usize size, triton::uint32 threads) const {
+      std::vector<triton::arch::BasicBlock> ret;
+
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::disassemblyBlocks(): You must define an architecture.");
+
+      if (size == 0)
+        return ret;
+
+      /* The memory is read by the calling thread only, callbacks are not thread safe */
+      const std::vector<triton::uint8> area = this->getConcreteMemoryAreaValue(addr, size);
+
+      /*
+       * `step` is the smallest instruction size. `overlap` is the number of instructions both
+       * sweeps must agree on before adopting the next chunk, IT blocks span up to 4 instructions.
+       */
+      triton::usize step    = instructionStep(*this);
+      triton::usize overlap = (this->arch == triton::arch::ARCH_ARM32 && this->isThumb()) ? 4 : 0;
+
+      /* Small areas are not worth a thread */
+      triton::usize count = threads ? threads : std::thread::hardware_concurrency();
+      count = std::max<triton::usize>(1, std::min<triton::usize>(count, size / 0x1000));
+
+      triton::usize chunk = (size + count - 1) / count;
+      chunk = ((chunk + step - 1) / step) * step;
+      count = (size + chunk - 1) / chunk;
+
+      /* Each worker owns its CPU and so its own Capstone handle */
+      std::deque<triton::arch::Architecture> workers;
+      for (triton::usize i = 0; i < count; i++) {
+        workers.emplace_back(nullptr);
+        workers.back().setArchitecture(this->arch);
+        workers.back().setThumb(this->isThumb());
+      }
+
+      std::vector<std::vector<triton::arch::Instruction>> insts(count);
+      std::vector<triton::usize> stops(count);
+      std::vector<std::exception_ptr> errors(count);
+      std::vector<std::thread> pool;
+
+      auto sweep = [&](triton::usize i) {
+        try {
+          stops[i] = disassemblyChunk(workers[i], area, addr, i * chunk, std::min(size, (i + 1) * chunk), step, insts[i]);
+        }
+        catch (...) {
+          errors[i] = std::current_exception();
+        }
+      };
+
+      for (triton::usize i = 1; i < count; i++) {
+        try {
+          pool.emplace_back(sweep, i);
+        }
+        catch (const std::system_error&) {
+          sweep(i);
+        }
+      }
+
+      sweep(0);
+      for (auto& thread : pool)
+        thread.join();
+
+      for (const auto& error : errors) {
+        if (error)
+          std::rethrow_exception(error);
+      }
+
+      /*
+       * A chunk may start in the middle of an instruction. The sweep of the previous chunk goes on
+       * until it meets an instruction of the next one, from where both sweeps decode the same code.
+       */
+      std::vector<triton::arch::Instruction> list = std::move(insts[0]);
+      const triton::arch::Architecture* serial = &workers[0];
+      triton::usize offset = stops[0];
+
+      for (triton::usize i = 1; i < count; i++) {
+        const auto& next = insts[i];
+        triton::usize matched = 0;
+
+        while (offset < stops[i]) {
+          auto it = std::lower_bound(next.begin(), next.end(), addr + offset, [](const triton::arch::Instruction& inst, triton::uint64 value) {
+            return inst.getAddress() < value;
+          });
+
+          bool found = (it != next.end() && it->getAddress() == addr + offset);
+          if (found && matched >= overlap) {
+            list.insert(list.end(), it, next.end());
+            serial = &workers[i];
+            offset = stops[i];
+            break;
+          }
+
+          triton::usize decoded = list.size();
+          offset  = disassemblyAt(*serial, area, addr, offset, step, list);
+          matched = (found && list.size() != decoded) ? matched + 1 : 0;
+        }
+      }
+
+      /* Cut the instructions into basic blocks at control flow instructions and gaps */
+      std::vector<triton::arch::Instruction> block;
+      for (auto& inst : list) {
+        bool controlFlow = inst.isControlFlow();
+        if (!block.empty() && block.back().getNextAddress() != inst.getAddress()) {
+          ret.push_back(triton::arch::BasicBlock(std::move(block)));
+          block.clear();
+        }
+        block.push_back(std::move(inst));
+        if (controlFlow) {
+          ret.push_back(triton::arch::BasicBlock(std::move(block)));
+          block.clear();
+        }
+      }
+
+      if (!block.empty())
+        ret.push_back(triton::arch::BasicBlock(std::move(block)));
+
+      return ret;
+    }
+
+
+    triton::arch::DecodeInfo Architecture::decode(const triton::uint8* opcode, triton::uint32 size, triton::uint64 addr) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::decode(): You must define an architecture.");
+      return this->cpu->decode(opcode, size, addr);
+    }
+
+
+    std::vector<triton::arch::DecodeInfo> Architecture::decode(triton::uint64 addr, triton::usize size) const {
+      std::vector<triton::arch::DecodeInfo> ret;
+
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::decode(): You must define an architecture.");
+
+      const std::vector<triton::uint8> area = this->getConcreteMemoryAreaValue(addr, size);
+      triton::usize step   = instructionStep(*this);
+      triton::usize offset = 0;
+
+      while (offset < area.size()) {
+        triton::uint32 length = static_cast<triton::uint32>(std::min<triton::usize>(16, area.size() - offset));
+        try {
+          ret.push_back(this->cpu->decode(area.data() + offset, length, addr + offset));
+          offset += ret.back().size;
+        }
+        catch (const triton::exceptions::Disassembly&) {
+          offset += step;
+        }
+      }
+
+      return ret;
+    }
+
+
+    void Architecture::enableDecodeCache(bool flag) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::enableDecodeCache(): You must define an architecture.");
+      this->cpu->getDecodeCache().enable(flag);
+    }
+
+
+    bool Architecture::isDecodeCacheEnabled(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::isDecodeCacheEnabled(): You must define an architecture.");
+      return this->cpu->getDecodeCache().isEnabled();
+    }
+
+
+    void Architecture::clearDecodeCache(void) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::clearDecodeCache(): You must define an architecture.");
+      this->cpu->getDecodeCache().clear();
+    }
+
+
+    void Architecture::openPersistentDecodeCache(const std::string& path, triton::usize slots) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::openPersistentDecodeCache(): You must define an architecture.");
+      #ifdef TRITON_PERSISTENT_CACHE
+      this->cpu->getDecodeCache().openPersistent(path, this->arch, *this->cpu, slots);
+      return;
+      #endif
+      throw triton::exceptions::Architecture("Architecture::openPersistentDecodeCache(): Triton not built with the persistent decode cache");
+    }
+
+
+    void Architecture::closePersistentDecodeCache(void) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::closePersistentDecodeCache(): You must define an architecture.");
+      #ifdef TRITON_PERSISTENT_CACHE
+      this->cpu->getDecodeCache().closePersistent();
+      #endif
+    }
+
+
     triton::uint8 Architecture::getConcreteMemoryValue(triton::uint64 addr, bool execCallbacks) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getConcreteMemoryValue(): You must define an architecture.");
@@ -311,6 +557,13 @@ namespace triton {
     }
 
 
+    void Architecture::readConcreteMemory(triton::uint64 baseAddr, void* area, triton::usize size, bool execCallbacks) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::readConcreteMemory(): You must define an architecture.");
+      this->cpu->readConcreteMemory(baseAddr, area, size, execCallbacks);
+    }
+
+
     triton::uint512 Architecture::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getConcreteRegisterValue(): You must define an architecture.");
@@ -318,6 +571,27 @@ namespace triton {
     }
 
 
+    const triton::arch::RegisterSlot& Architecture::getConcreteRegisterSlot(triton::arch::register_e id) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getConcreteRegisterSlot(): You must define an architecture.");
+      return this->cpu->getConcreteRegisterSlot(id);
+    }
+
+
+    const triton::uint8* Architecture::getConcreteRegisterFile(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getConcreteRegisterFile(): You must define an architecture.");
+      return this->cpu->getConcreteRegisterFile();
+    }
+
+
+    triton::usize Architecture::getConcreteRegisterFileSize(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getConcreteRegisterFileSize(): You must define an architecture.");
+      return this->cpu->getConcreteRegisterFileSize();
+    }
+
+
     void Architecture::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value, bool execCallbacks) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryValue(): You must define an architecture.");
@@ -346,6 +620,20 @@ namespace triton {
     }
 
 
+    void Architecture::writeConcreteMemory(triton::uint64 baseAddr, const void* area, triton::usize size, bool execCallbacks) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::writeConcreteMemory(): You must define an architecture.");
+      this->cpu->writeConcreteMemory(baseAddr, area, size, execCallbacks);
+    }
+
+
+    void Architecture::mapConcreteMemoryArea(triton::uint64 baseAddr, const void* area, triton::usize size, const std::shared_ptr<const void>& owner) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::mapConcreteMemoryArea(): You must define an architecture.");
+      this->cpu->mapConcreteMemoryArea(baseAddr, area, size, owner);
+    }
+
+
     void Architecture::setConcreteRegisterValue(const triton::arch::Register& reg, const triton::uint512& value, bool execCallbacks) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteRegisterValue(): You must define an architecture.");
@@ -353,6 +641,13 @@ namespace triton {
     }
 
 
+    void Architecture::setConcreteRegisterFile(const triton::uint8* file, triton::usize size) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::setConcreteRegisterFile(): You must define an architecture.");
+      this->cpu->setConcreteRegisterFile(file, size);
+    }
+
+
     bool Architecture::isConcreteMemoryValueDefined(const triton::arch::MemoryAccess& mem) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::isConcreteMemoryValueDefined(): You must define an architecture.");
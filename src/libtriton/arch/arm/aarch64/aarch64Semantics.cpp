@@ -394,31 +394,41 @@ namespace triton {
                                                                               triton::ast::SharedAbstractNode& thenNode,
                                                                               triton::ast::SharedAbstractNode& elseNode) {
 
+          auto cond = this->getCodeConditionNode(inst);
+
+          /* The instruction don't use condition, so just return the 'then' node */
+          if (cond == nullptr) {
+            return thenNode;
+          }
+
+          /* A concrete condition selects its branch without building the ite */
+          if (cond->isSymbolized() == false) {
+            return (cond->evaluate() ? thenNode : elseNode);
+          }
+
+          return this->astCtxt->ite(cond, thenNode, elseNode);
+        }
+
+
+        triton::ast::SharedAbstractNode AArch64Semantics::getCodeConditionNode(triton::arch::Instruction& inst) {
+
           switch (inst.getCodeCondition()) {
             // Always. Any flags. This suffix is normally omitted.
             case triton::arch::arm::ID_CONDITION_AL: {
-              return thenNode;
+              return nullptr;
             }
 
             // Equal. Z set.
             case triton::arch::arm::ID_CONDITION_EQ: {
               auto z = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_Z)));
-              auto node = this->astCtxt->ite(
-                          this->astCtxt->equal(z, this->astCtxt->bvtrue()),
-                          thenNode,
-                          elseNode);
-              return node;
+              return this->astCtxt->equal(z, this->astCtxt->bvtrue());
             }
 
             // Signed >=. N and V the same.
             case triton::arch::arm::ID_CONDITION_GE: {
               auto n = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_N)));
               auto v = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_V)));
-              auto node = this->astCtxt->ite(
-                          this->astCtxt->equal(n, v),
-                          thenNode,
-                          elseNode);
-              return node;
+              return this->astCtxt->equal(n, v);
             }
 
             // Signed >. Z clear, N and V the same.
@@ -426,38 +436,26 @@ namespace triton {
               auto z = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_Z)));
               auto n = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_N)));
               auto v = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_V)));
-              auto node = this->astCtxt->ite(
-                          this->astCtxt->land(
-                            this->astCtxt->equal(z, this->astCtxt->bvfalse()),
-                            this->astCtxt->equal(n, v)
-                          ),
-                          thenNode,
-                          elseNode);
-              return node;
+              return this->astCtxt->land(
+                       this->astCtxt->equal(z, this->astCtxt->bvfalse()),
+                       this->astCtxt->equal(n, v)
+                     );
             }
 
             // Higher (unsigned >). C set and Z clear.
             case triton::arch::arm::ID_CONDITION_HI: {
               auto c = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_C)));
               auto z = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_Z)));
-              auto node = this->astCtxt->ite(
-                          this->astCtxt->land(
-                            this->astCtxt->equal(c, this->astCtxt->bvtrue()),
-                            this->astCtxt->equal(z, this->astCtxt->bvfalse())
-                          ),
-                          thenNode,
-                          elseNode);
-              return node;
+              return this->astCtxt->land(
+                       this->astCtxt->equal(c, this->astCtxt->bvtrue()),
+                       this->astCtxt->equal(z, this->astCtxt->bvfalse())
+                     );
             }
 
             // Higher or same (unsigned >=). C set.
             case triton::arch::arm::ID_CONDITION_HS: {
               auto c = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_C)));
-              auto node = this->astCtxt->ite(
-                          this->astCtxt->equal(c, this->astCtxt->bvtrue()),
-                          thenNode,
-                          elseNode);
-              return node;
+              return this->astCtxt->equal(c, this->astCtxt->bvtrue());
             }
 
             // Signed <=. Z set or N and V differ.
@@ -465,104 +463,68 @@ namespace triton {
               auto z = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_Z)));
               auto n = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_N)));
               auto v = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_V)));
-              auto node = this->astCtxt->ite(
-                          this->astCtxt->lor(
-                            this->astCtxt->equal(z, this->astCtxt->bvtrue()),
-                            this->astCtxt->lnot(this->astCtxt->equal(n, v))
-                          ),
-                          thenNode,
-                          elseNode);
-              return node;
+              return this->astCtxt->lor(
+                       this->astCtxt->equal(z, this->astCtxt->bvtrue()),
+                       this->astCtxt->lnot(this->astCtxt->equal(n, v))
+                     );
             }
 
             // Lower (unsigned <). C clear.
             case triton::arch::arm::ID_CONDITION_LO: {
               auto c = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_C)));
-              auto node = this->astCtxt->ite(
-                          this->astCtxt->equal(c, this->astCtxt->bvfalse()),
-                          thenNode,
-                          elseNode);
-              return node;
+              return this->astCtxt->equal(c, this->astCtxt->bvfalse());
             }
 
             // Lower or same (unsigned <=). C clear or Z set.
             case triton::arch::arm::ID_CONDITION_LS: {
               auto c = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_C)));
               auto z = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_Z)));
-              auto node = this->astCtxt->ite(
-                          this->astCtxt->lor(
-                            this->astCtxt->equal(c, this->astCtxt->bvfalse()),
-                            this->astCtxt->equal(z, this->astCtxt->bvtrue())
-                          ),
-                          thenNode,
-                          elseNode);
-              return node;
+              return this->astCtxt->lor(
+                       this->astCtxt->equal(c, this->astCtxt->bvfalse()),
+                       this->astCtxt->equal(z, this->astCtxt->bvtrue())
+                     );
             }
 
             // Signed <. N and V differ.
             case triton::arch::arm::ID_CONDITION_LT: {
               auto n = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_N)));
               auto v = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_V)));
-              auto node = this->astCtxt->ite(
-                          this->astCtxt->lnot(this->astCtxt->equal(n, v)),
-                          thenNode,
-                          elseNode);
-              return node;
+              return this->astCtxt->lnot(this->astCtxt->equal(n, v));
             }
 
             // Negative. N set.
             case triton::arch::arm::ID_CONDITION_MI: {
               auto n = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_N)));
-              auto node = this->astCtxt->ite(
-                          this->astCtxt->equal(n, this->astCtxt->bvtrue()),
-                          thenNode,
-                          elseNode);
-              return node;
+              return this->astCtxt->equal(n, this->astCtxt->bvtrue());
             }
 
             // Not equal. Z clear.
             case triton::arch::arm::ID_CONDITION_NE: {
               auto z = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_Z)));
-              auto node = this->astCtxt->ite(
-                          this->astCtxt->equal(z, this->astCtxt->bvfalse()),
-                          thenNode,
-                          elseNode);
-              return node;
+              return this->astCtxt->equal(z, this->astCtxt->bvfalse());
             }
 
             // Positive or zero. N clear.
             case triton::arch::arm::ID_CONDITION_PL: {
               auto n = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_N)));
-              auto node = this->astCtxt->ite(
-                          this->astCtxt->equal(n, this->astCtxt->bvfalse()),
-                          thenNode,
-                          elseNode);
-              return node;
+              return this->astCtxt->equal(n, this->astCtxt->bvfalse());
             }
 
             // No overflow. V clear.
             case triton::arch::arm::ID_CONDITION_VC: {
               auto v = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_V)));
-              auto node = this->astCtxt->ite(
-                          this->astCtxt->equal(v, this->astCtxt->bvfalse()),
-                          thenNode,
-                          elseNode);
-              return node;
+              return this->astCtxt->equal(v, this->astCtxt->bvfalse());
             }
 
             // Overflow. V set.
             case triton::arch::arm::ID_CONDITION_VS: {
               auto v = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_V)));
-              auto node = this->astCtxt->ite(
-                          this->astCtxt->equal(v, this->astCtxt->bvtrue()),
-                          thenNode,
-                          elseNode);
-              return node;
+              return this->astCtxt->equal(v, this->astCtxt->bvtrue());
             }
 
             default:
-              /* The instruction don't use condition, so just return the 'then' node */
-              return thenNode;
+              /* The instruction don't use condition */
+              return nullptr;
           }
         }
 
@@ -675,13 +637,15 @@ namespace triton {
            * Create the semantic.
            * nf = MSB(result)
            */
-          auto node = this->astCtxt->extract(high, high, this->astCtxt->reference(parent));
-
-          /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, nf, "Negative flag");
+          auto builder = [=, astCtxt = this->astCtxt]() {
+            return astCtxt->extract(high, high, astCtxt->reference(parent));
+          };
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = this->taintEngine->setTaintRegister(nf, parent->isTainted);
+          auto taint = this->taintEngine->setTaintRegister(nf, parent->isTainted);
+
+          /* Create the symbolic expression */
+          this->symbolicEngine->createLazyRegisterExpression(inst, builder, nf, "Negative flag", taint);
         }
 
 
@@ -722,20 +686,22 @@ namespace triton {
            * Create the semantic.
            * zf = 0 == result
            */
-          auto node = this->astCtxt->ite(
-                        this->astCtxt->equal(
-                          this->astCtxt->extract(high, low, this->astCtxt->reference(parent)),
-                          this->astCtxt->bv(0, bvSize)
-                        ),
-                        this->astCtxt->bv(1, 1),
-                        this->astCtxt->bv(0, 1)
-                      );
-
-          /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, zf, "Zero flag");
+          auto builder = [=, astCtxt = this->astCtxt]() {
+            return astCtxt->ite(
+                     astCtxt->equal(
+                       astCtxt->extract(high, low, astCtxt->reference(parent)),
+                       astCtxt->bv(0, bvSize)
+                     ),
+                     astCtxt->bv(1, 1),
+                     astCtxt->bv(0, 1)
+                   );
+          };
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = this->taintEngine->setTaintRegister(zf, parent->isTainted);
+          auto taint = this->taintEngine->setTaintRegister(zf, parent->isTainted);
+
+          /* Create the symbolic expression */
+          this->symbolicEngine->createLazyRegisterExpression(inst, builder, zf, "Zero flag", taint);
         }
 
 
@@ -787,23 +753,25 @@ namespace triton {
            * Create the semantic.
            * cf = MSB((op1 & op2) ^ ((op1 ^ op2 ^ result) & (op1 ^ op2)));
            */
-          auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                        this->astCtxt->bvxor(
-                          this->astCtxt->bvand(op1, op2),
-                          this->astCtxt->bvand(
-                            this->astCtxt->bvxor(
-                              this->astCtxt->bvxor(op1, op2),
-                              this->astCtxt->extract(high, low, this->astCtxt->reference(parent))
-                            ),
-                          this->astCtxt->bvxor(op1, op2))
-                        )
-                      );
-
-          /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, cf, "Carry flag");
+          auto builder = [=, astCtxt = this->astCtxt]() {
+            return astCtxt->extract(bvSize-1, bvSize-1,
+                     astCtxt->bvxor(
+                       astCtxt->bvand(op1, op2),
+                       astCtxt->bvand(
+                         astCtxt->bvxor(
+                           astCtxt->bvxor(op1, op2),
+                           astCtxt->extract(high, low, astCtxt->reference(parent))
+                         ),
+                       astCtxt->bvxor(op1, op2))
+                     )
+                   );
+          };
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = this->taintEngine->setTaintRegister(cf, parent->isTainted);
+          auto taint = this->taintEngine->setTaintRegister(cf, parent->isTainted);
+
+          /* Create the symbolic expression */
+          this->symbolicEngine->createLazyRegisterExpression(inst, builder, cf, "Carry flag", taint);
         }
 
 
@@ -822,24 +790,26 @@ namespace triton {
            * Create the semantic.
            * cf = (MSB(((op1 ^ op2 ^ result) ^ ((op1 ^ result) & (op1 ^ op2))))) ^ 1
            */
-          auto node = this->astCtxt->bvxor(
-                        this->astCtxt->extract(bvSize-1, bvSize-1,
-                          this->astCtxt->bvxor(
-                            this->astCtxt->bvxor(op1, this->astCtxt->bvxor(op2, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))),
-                            this->astCtxt->bvand(
-                              this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent))),
-                              this->astCtxt->bvxor(op1, op2)
-                            )
-                          )
-                        ),
-                        this->astCtxt->bvtrue()
-                      );
-
-          /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, cf, "Carry flag");
+          auto builder = [=, astCtxt = this->astCtxt]() {
+            return astCtxt->bvxor(
+                     astCtxt->extract(bvSize-1, bvSize-1,
+                       astCtxt->bvxor(
+                         astCtxt->bvxor(op1, astCtxt->bvxor(op2, astCtxt->extract(high, low, astCtxt->reference(parent)))),
+                         astCtxt->bvand(
+                           astCtxt->bvxor(op1, astCtxt->extract(high, low, astCtxt->reference(parent))),
+                           astCtxt->bvxor(op1, op2)
+                         )
+                       )
+                     ),
+                     astCtxt->bvtrue()
+                   );
+          };
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = this->taintEngine->setTaintRegister(cf, parent->isTainted);
+          auto taint = this->taintEngine->setTaintRegister(cf, parent->isTainted);
+
+          /* Create the symbolic expression */
+          this->symbolicEngine->createLazyRegisterExpression(inst, builder, cf, "Carry flag", taint);
         }
 
 
@@ -900,18 +870,20 @@ namespace triton {
            * Create the semantic.
            * vf = MSB((op1 ^ ~op2) & (op1 ^ result))
            */
-          auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                        this->astCtxt->bvand(
-                          this->astCtxt->bvxor(op1, this->astCtxt->bvnot(op2)),
-                          this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))
-                        )
-                      );
-
-          /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, vf, "Overflow flag");
+          auto builder = [=, astCtxt = this->astCtxt]() {
+            return astCtxt->extract(bvSize-1, bvSize-1,
+                     astCtxt->bvand(
+                       astCtxt->bvxor(op1, astCtxt->bvnot(op2)),
+                       astCtxt->bvxor(op1, astCtxt->extract(high, low, astCtxt->reference(parent)))
+                     )
+                   );
+          };
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = this->taintEngine->setTaintRegister(vf, parent->isTainted);
+          auto taint = this->taintEngine->setTaintRegister(vf, parent->isTainted);
+
+          /* Create the symbolic expression */
+          this->symbolicEngine->createLazyRegisterExpression(inst, builder, vf, "Overflow flag", taint);
         }
 
 
@@ -930,18 +902,20 @@ namespace triton {
            * Create the semantic.
            * vf = MSB((op1 ^ op2) & (op1 ^ result))
            */
-          auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                        this->astCtxt->bvand(
-                          this->astCtxt->bvxor(op1, op2),
-                          this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))
-                        )
-                      );
-
-          /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, vf, "Overflow flag");
+          auto builder = [=, astCtxt = this->astCtxt]() {
+            return astCtxt->extract(bvSize-1, bvSize-1,
+                     astCtxt->bvand(
+                       astCtxt->bvxor(op1, op2),
+                       astCtxt->bvxor(op1, astCtxt->extract(high, low, astCtxt->reference(parent)))
+                     )
+                   );
+          };
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = this->taintEngine->setTaintRegister(vf, parent->isTainted);
+          auto taint = this->taintEngine->setTaintRegister(vf, parent->isTainted);
+
+          /* Create the symbolic expression */
+          this->symbolicEngine->createLazyRegisterExpression(inst, builder, vf, "Overflow flag", taint);
         }
 
 
@@ -1162,8 +1136,9 @@ namespace triton {
           auto op1 = this->symbolicEngine->getOperandAst(inst, src);
           auto op2 = this->astCtxt->bv(inst.getNextAddress(), dst.getBitSize());
 
-          /* Create the semantics */
-          auto node = this->getCodeConditionAst(inst, op1, op2);
+          /* Create the semantics. The ite is kept even on a concrete condition, it gives both branches to the path constraint */
+          auto cond = this->getCodeConditionNode(inst);
+          auto node = (cond == nullptr ? op1 : this->astCtxt->ite(cond, op1, op2));
 
           /* Create symbolic expression */
           auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "B operation - Program Counter");
@@ -1874,10 +1849,6 @@ namespace triton {
         }
 
         void AArch64Semantics::ld3_s(triton::arch::Instruction& inst) {
-          std::list<triton::ast::SharedAbstractNode> vec0;
-          std::list<triton::ast::SharedAbstractNode> vec1;
-          std::list<triton::ast::SharedAbstractNode> vec2;
-
           triton::arch::OperandWrapper& vt0 = inst.operands[0]; /* vas register */
           triton::arch::OperandWrapper& vt1 = inst.operands[1]; /* vas register */
           triton::arch::OperandWrapper& vt2 = inst.operands[2]; /* vas register */
@@ -1894,151 +1865,53 @@ namespace triton {
            */
           triton::uint32 postIndex = 0;
 
-          auto mem   = src.getConstMemory();
-          auto vas_e = vt0.getConstRegister().getVASType();
+          auto mem      = src.getConstMemory();
+          auto vas_e    = vt0.getConstRegister().getVASType();
+          auto laneSize = 0u; /* the size of a lane in bytes */
 
           switch (vas_e) {
-            /* LD3 multiple structure */
-            case triton::arch::arm::ID_VAS_16B: {
-              for (triton::uint32 i = 0; i != 16; i++) {
-                auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 0, triton::size::byte);
-                auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 1, triton::size::byte);
-                auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 2, triton::size::byte);
-
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-              }
-              postIndex = 48;
-              break;
-            }
-
-            /* LD3 multiple structure */
-            case triton::arch::arm::ID_VAS_8B: {
-              for (triton::uint32 i = 0; i != 8; i++) {
-                auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 0, triton::size::byte);
-                auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 1, triton::size::byte);
-                auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 2, triton::size::byte);
-
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-              }
-              postIndex = 24;
-              break;
-            }
-
-            /* LD3 multiple structure */
-            case triton::arch::arm::ID_VAS_8H: {
-              for (triton::uint32 i = 0; i != 16; i += 2) {
-                auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 0, triton::size::word);
-                auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 2, triton::size::word);
-                auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 4, triton::size::word);
-
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-              }
-              postIndex = 48;
-              break;
-            }
-
-            /* LD3 multiple structure */
-            case triton::arch::arm::ID_VAS_4H: {
-              for (triton::uint32 i = 0; i != 8; i += 2) {
-                auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 0, triton::size::word);
-                auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 2, triton::size::word);
-                auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 4, triton::size::word);
-
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-              }
-              postIndex = 24;
-              break;
-            }
-
-            /* LD3 multiple structure */
-            case triton::arch::arm::ID_VAS_4S: {
-              for (triton::uint32 i = 0; i != 16; i += 4) {
-                auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 0, triton::size::dword);
-                auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 4, triton::size::dword);
-                auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 8, triton::size::dword);
-
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-              }
-              postIndex = 48;
-              break;
-            }
-
-            /* LD3 multiple structure */
-            case triton::arch::arm::ID_VAS_2S: {
-              for (triton::uint32 i = 0; i != 8; i += 4) {
-                auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 0, triton::size::dword);
-                auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 4, triton::size::dword);
-                auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 8, triton::size::dword);
-
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-              }
-              postIndex = 24;
-              break;
-            }
-
-            /* LD3 multiple structure */
-            case triton::arch::arm::ID_VAS_2D: {
-              for (triton::uint32 i = 0; i != 16; i += 8) {
-                auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 0,  triton::size::qword);
-                auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 8,  triton::size::qword);
-                auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3) + 16, triton::size::qword);
-
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-              }
-              postIndex = 48;
-              break;
-            }
-
+            case triton::arch::arm::ID_VAS_16B: [[fallthrough]];
+            case triton::arch::arm::ID_VAS_8B:  laneSize = triton::size::byte;  break;
+            case triton::arch::arm::ID_VAS_8H:  [[fallthrough]];
+            case triton::arch::arm::ID_VAS_4H:  laneSize = triton::size::word;  break;
+            case triton::arch::arm::ID_VAS_4S:  [[fallthrough]];
+            case triton::arch::arm::ID_VAS_2S:  laneSize = triton::size::dword; break;
+            case triton::arch::arm::ID_VAS_2D:  laneSize = triton::size::qword; break;
             default:
               throw triton::exceptions::Semantics("AArch64Semantics::ld3_s(): Invalid VAS encoding.");
           }
 
+          /* The number of lanes of each register */
+          triton::uint32 lanes = vt0.getConstRegister().getVASSize() / laneSize;
+
+          std::vector<triton::ast::SharedAbstractNode> vec0;
+          std::vector<triton::ast::SharedAbstractNode> vec1;
+          std::vector<triton::ast::SharedAbstractNode> vec2;
+          vec0.reserve(lanes);
+          vec1.reserve(lanes);
+          vec2.reserve(lanes);
+
+          /* LD3 multiple structure, the elements are interleaved and lane 0 comes first */
+          for (triton::uint32 i = 0; i != lanes; i++) {
+            auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3 + 0) * laneSize, laneSize);
+            auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3 + 1) * laneSize, laneSize);
+            auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 3 + 2) * laneSize, laneSize);
+
+            vec0.push_back(this->symbolicEngine->getMemoryAst(inst, vt0_m));
+            vec1.push_back(this->symbolicEngine->getMemoryAst(inst, vt1_m));
+            vec2.push_back(this->symbolicEngine->getMemoryAst(inst, vt2_m));
+
+            vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
+            vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
+            vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
+          }
+
+          postIndex = 3 * lanes * laneSize;
+
           /* Create the semantics of the LD3 */
-          auto node0 = this->astCtxt->concat(vec0);
-          auto node1 = this->astCtxt->concat(vec1);
-          auto node2 = this->astCtxt->concat(vec2);
+          auto node0 = this->astCtxt->concatLanes(vec0);
+          auto node1 = this->astCtxt->concatLanes(vec1);
+          auto node2 = this->astCtxt->concatLanes(vec2);
 
           /* Create symbolic expression */
           auto expr0 = this->symbolicEngine->createSymbolicExpression(inst, node0, vt0, "LD3 operation - LOAD access");
@@ -2097,10 +1970,6 @@ namespace triton {
 
 
         void AArch64Semantics::ld3r_s(triton::arch::Instruction& inst) {
-          std::list<triton::ast::SharedAbstractNode> vec0;
-          std::list<triton::ast::SharedAbstractNode> vec1;
-          std::list<triton::ast::SharedAbstractNode> vec2;
-
           triton::arch::OperandWrapper& vt0 = inst.operands[0]; /* vas register */
           triton::arch::OperandWrapper& vt1 = inst.operands[1]; /* vas register */
           triton::arch::OperandWrapper& vt2 = inst.operands[2]; /* vas register */
@@ -2119,170 +1988,41 @@ namespace triton {
            */
           triton::uint32 postIndex = 0;
 
-          auto mem   = src.getConstMemory();
-          auto vas_e = vt0.getConstRegister().getVASType();
+          auto mem      = src.getConstMemory();
+          auto vas_e    = vt0.getConstRegister().getVASType();
+          auto laneSize = 0u; /* the size of a lane in bytes */
 
           switch (vas_e) {
-            case triton::arch::arm::ID_VAS_16B: {
-              auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0, triton::size::byte);
-              auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 1, triton::size::byte);
-              auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 2, triton::size::byte);
-
-              for (triton::uint32 i = 0; i != 16; i++) {
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-              }
-
-              postIndex = 3;
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_8B: {
-              auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0, triton::size::byte);
-              auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 1, triton::size::byte);
-              auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 2, triton::size::byte);
-
-              for (triton::uint32 i = 0; i != 8; i++) {
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-              }
-
-              postIndex = 3;
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_8H: {
-              auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0, triton::size::word);
-              auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 2, triton::size::word);
-              auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 4, triton::size::word);
-
-              for (triton::uint32 i = 0; i != 16; i += 2) {
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-              }
-
-              postIndex = 6;
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_4H: {
-              auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0, triton::size::word);
-              auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 2, triton::size::word);
-              auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 4, triton::size::word);
-
-              for (triton::uint32 i = 0; i != 8; i += 2) {
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-              }
-
-              postIndex = 6;
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_4S: {
-              auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0, triton::size::dword);
-              auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 4, triton::size::dword);
-              auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 8, triton::size::dword);
-
-              for (triton::uint32 i = 0; i != 16; i += 4) {
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-              }
-
-              postIndex = 12;
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_2S: {
-              auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0, triton::size::dword);
-              auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 4, triton::size::dword);
-              auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 8, triton::size::dword);
-
-              for (triton::uint32 i = 0; i != 8; i += 4) {
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-              }
-
-              postIndex = 12;
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_2D: {
-              auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0,  triton::size::qword);
-              auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 8,  triton::size::qword);
-              auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 16, triton::size::qword);
-
-              for (triton::uint32 i = 0; i != 16; i += 8) {
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-              }
-
-              postIndex = 24;
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_1D: {
-              auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0,  triton::size::qword);
-              auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 8,  triton::size::qword);
-              auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 16, triton::size::qword);
+            case triton::arch::arm::ID_VAS_16B: [[fallthrough]];
+            case triton::arch::arm::ID_VAS_8B:  laneSize = triton::size::byte;  break;
+            case triton::arch::arm::ID_VAS_8H:  [[fallthrough]];
+            case triton::arch::arm::ID_VAS_4H:  laneSize = triton::size::word;  break;
+            case triton::arch::arm::ID_VAS_4S:  [[fallthrough]];
+            case triton::arch::arm::ID_VAS_2S:  laneSize = triton::size::dword; break;
+            case triton::arch::arm::ID_VAS_2D:  [[fallthrough]];
+            case triton::arch::arm::ID_VAS_1D:  laneSize = triton::size::qword; break;
+            default:
+              throw triton::exceptions::Semantics("AArch64Semantics::ld3r_s(): Invalid VAS encoding.");
+          }
 
-              for (triton::uint32 i = 0; i != 8; i += 8) {
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
+          /* The number of lanes of each register */
+          triton::uint32 lanes = vt0.getConstRegister().getVASSize() / laneSize;
 
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-              }
+          /* LD3R single structure, replicated to all the lanes */
+          auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0 * laneSize, laneSize);
+          auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 1 * laneSize, laneSize);
+          auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 2 * laneSize, laneSize);
 
-              postIndex = 24;
-              break;
-            }
+          vt0_t = this->taintEngine->isMemoryTainted(vt0_m);
+          vt1_t = this->taintEngine->isMemoryTainted(vt1_m);
+          vt2_t = this->taintEngine->isMemoryTainted(vt2_m);
 
-            default:
-              throw triton::exceptions::Semantics("AArch64Semantics::ld3r_s(): Invalid VAS encoding.");
-          }
+          postIndex = 3 * laneSize;
 
           /* Create the semantics of the LD3R */
-          auto node0 = this->astCtxt->concat(vec0);
-          auto node1 = this->astCtxt->concat(vec1);
-          auto node2 = this->astCtxt->concat(vec2);
+          auto node0 = this->astCtxt->splat(this->symbolicEngine->getMemoryAst(inst, vt0_m), lanes);
+          auto node1 = this->astCtxt->splat(this->symbolicEngine->getMemoryAst(inst, vt1_m), lanes);
+          auto node2 = this->astCtxt->splat(this->symbolicEngine->getMemoryAst(inst, vt2_m), lanes);
 
           /* Create symbolic expression */
           auto expr0 = this->symbolicEngine->createSymbolicExpression(inst, node0, vt0, "LD3R operation - LOAD access");
@@ -2341,11 +2081,6 @@ namespace triton {
 
 
         void AArch64Semantics::ld4_s(triton::arch::Instruction& inst) {
-          std::list<triton::ast::SharedAbstractNode> vec0;
-          std::list<triton::ast::SharedAbstractNode> vec1;
-          std::list<triton::ast::SharedAbstractNode> vec2;
-          std::list<triton::ast::SharedAbstractNode> vec3;
-
           triton::arch::OperandWrapper& vt0 = inst.operands[0]; /* vas register */
           triton::arch::OperandWrapper& vt1 = inst.operands[1]; /* vas register */
           triton::arch::OperandWrapper& vt2 = inst.operands[2]; /* vas register */
@@ -2364,173 +2099,59 @@ namespace triton {
            */
           triton::uint32 postIndex = 0;
 
-          auto mem   = src.getConstMemory();
-          auto vas_e = vt0.getConstRegister().getVASType();
+          auto mem      = src.getConstMemory();
+          auto vas_e    = vt0.getConstRegister().getVASType();
+          auto laneSize = 0u; /* the size of a lane in bytes */
 
           switch (vas_e) {
-            /* LD4 multiple structure */
-            case triton::arch::arm::ID_VAS_16B: {
-              for (triton::uint32 i = 0; i != 16; i++) {
-                auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 0, triton::size::byte);
-                auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 1, triton::size::byte);
-                auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 2, triton::size::byte);
-                auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 3, triton::size::byte);
-
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-                vec3.push_front(this->symbolicEngine->getMemoryAst(inst, vt3_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-                vt3_t |= this->taintEngine->isMemoryTainted(vt3_m);
-              }
-              postIndex = 64;
-              break;
-            }
-
-            /* LD4 multiple structure */
-            case triton::arch::arm::ID_VAS_8B: {
-              for (triton::uint32 i = 0; i != 8; i++) {
-                auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 0, triton::size::byte);
-                auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 1, triton::size::byte);
-                auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 2, triton::size::byte);
-                auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 3, triton::size::byte);
-
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-                vec3.push_front(this->symbolicEngine->getMemoryAst(inst, vt3_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-                vt3_t |= this->taintEngine->isMemoryTainted(vt3_m);
-              }
-              postIndex = 32;
-              break;
-            }
-
-            /* LD4 multiple structure */
-            case triton::arch::arm::ID_VAS_8H: {
-              for (triton::uint32 i = 0; i != 16; i += 2) {
-                auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 0, triton::size::word);
-                auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 2, triton::size::word);
-                auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 4, triton::size::word);
-                auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 6, triton::size::word);
-
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-                vec3.push_front(this->symbolicEngine->getMemoryAst(inst, vt3_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-                vt3_t |= this->taintEngine->isMemoryTainted(vt3_m);
-              }
-              postIndex = 64;
-              break;
-            }
-
-            /* LD4 multiple structure */
-            case triton::arch::arm::ID_VAS_4H: {
-              for (triton::uint32 i = 0; i != 8; i += 2) {
-                auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 0, triton::size::word);
-                auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 2, triton::size::word);
-                auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 4, triton::size::word);
-                auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 6, triton::size::word);
-
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-                vec3.push_front(this->symbolicEngine->getMemoryAst(inst, vt3_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-                vt3_t |= this->taintEngine->isMemoryTainted(vt3_m);
-              }
-              postIndex = 32;
-              break;
-            }
-
-            /* LD4 multiple structure */
-            case triton::arch::arm::ID_VAS_4S: {
-              for (triton::uint32 i = 0; i != 16; i += 4) {
-                auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 0, triton::size::dword);
-                auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 4, triton::size::dword);
-                auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 8, triton::size::dword);
-                auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 12, triton::size::dword);
-
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-                vec3.push_front(this->symbolicEngine->getMemoryAst(inst, vt3_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-                vt3_t |= this->taintEngine->isMemoryTainted(vt3_m);
-              }
-              postIndex = 64;
-              break;
-            }
-
-            /* LD4 multiple structure */
-            case triton::arch::arm::ID_VAS_2S: {
-              for (triton::uint32 i = 0; i != 8; i += 4) {
-                auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 0, triton::size::dword);
-                auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 4, triton::size::dword);
-                auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 8, triton::size::dword);
-                auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 12, triton::size::dword);
-
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-                vec3.push_front(this->symbolicEngine->getMemoryAst(inst, vt3_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-                vt3_t |= this->taintEngine->isMemoryTainted(vt3_m);
-              }
-              postIndex = 32;
-              break;
-            }
-
-            /* LD4 multiple structure */
-            case triton::arch::arm::ID_VAS_2D: {
-              for (triton::uint32 i = 0; i != 16; i += 8) {
-                auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 0,  triton::size::qword);
-                auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 8,  triton::size::qword);
-                auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 16, triton::size::qword);
-                auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4) + 24, triton::size::qword);
-
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-                vec3.push_front(this->symbolicEngine->getMemoryAst(inst, vt3_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-                vt3_t |= this->taintEngine->isMemoryTainted(vt3_m);
-              }
-              postIndex = 64;
-              break;
-            }
-
+            case triton::arch::arm::ID_VAS_16B: [[fallthrough]];
+            case triton::arch::arm::ID_VAS_8B:  laneSize = triton::size::byte;  break;
+            case triton::arch::arm::ID_VAS_8H:  [[fallthrough]];
+            case triton::arch::arm::ID_VAS_4H:  laneSize = triton::size::word;  break;
+            case triton::arch::arm::ID_VAS_4S:  [[fallthrough]];
+            case triton::arch::arm::ID_VAS_2S:  laneSize = triton::size::dword; break;
+            case triton::arch::arm::ID_VAS_2D:  laneSize = triton::size::qword; break;
             default:
               throw triton::exceptions::Semantics("AArch64Semantics::ld4_s(): Invalid VAS encoding.");
           }
 
-          /* Create the semantics of the LD3 */
-          auto node0 = this->astCtxt->concat(vec0);
-          auto node1 = this->astCtxt->concat(vec1);
-          auto node2 = this->astCtxt->concat(vec2);
-          auto node3 = this->astCtxt->concat(vec3);
+          /* The number of lanes of each register */
+          triton::uint32 lanes = vt0.getConstRegister().getVASSize() / laneSize;
+
+          std::vector<triton::ast::SharedAbstractNode> vec0;
+          std::vector<triton::ast::SharedAbstractNode> vec1;
+          std::vector<triton::ast::SharedAbstractNode> vec2;
+          std::vector<triton::ast::SharedAbstractNode> vec3;
+          vec0.reserve(lanes);
+          vec1.reserve(lanes);
+          vec2.reserve(lanes);
+          vec3.reserve(lanes);
+
+          /* LD4 multiple structure, the elements are interleaved and lane 0 comes first */
+          for (triton::uint32 i = 0; i != lanes; i++) {
+            auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4 + 0) * laneSize, laneSize);
+            auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4 + 1) * laneSize, laneSize);
+            auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4 + 2) * laneSize, laneSize);
+            auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + (i * 4 + 3) * laneSize, laneSize);
+
+            vec0.push_back(this->symbolicEngine->getMemoryAst(inst, vt0_m));
+            vec1.push_back(this->symbolicEngine->getMemoryAst(inst, vt1_m));
+            vec2.push_back(this->symbolicEngine->getMemoryAst(inst, vt2_m));
+            vec3.push_back(this->symbolicEngine->getMemoryAst(inst, vt3_m));
+
+            vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
+            vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
+            vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
+            vt3_t |= this->taintEngine->isMemoryTainted(vt3_m);
+          }
+
+          postIndex = 4 * lanes * laneSize;
+
+          /* Create the semantics of the LD4 */
+          auto node0 = this->astCtxt->concatLanes(vec0);
+          auto node1 = this->astCtxt->concatLanes(vec1);
+          auto node2 = this->astCtxt->concatLanes(vec2);
+          auto node3 = this->astCtxt->concatLanes(vec3);
 
           /* Create symbolic expression */
           auto expr0 = this->symbolicEngine->createSymbolicExpression(inst, node0, vt0, "LD4 operation - LOAD access");
@@ -2591,11 +2212,6 @@ namespace triton {
 
 
         void AArch64Semantics::ld4r_s(triton::arch::Instruction& inst) {
-          std::list<triton::ast::SharedAbstractNode> vec0;
-          std::list<triton::ast::SharedAbstractNode> vec1;
-          std::list<triton::ast::SharedAbstractNode> vec2;
-          std::list<triton::ast::SharedAbstractNode> vec3;
-
           triton::arch::OperandWrapper& vt0 = inst.operands[0]; /* vas register */
           triton::arch::OperandWrapper& vt1 = inst.operands[1]; /* vas register */
           triton::arch::OperandWrapper& vt2 = inst.operands[2]; /* vas register */
@@ -2616,195 +2232,44 @@ namespace triton {
            */
           triton::uint32 postIndex = 0;
 
-          auto mem   = src.getConstMemory();
-          auto vas_e = vt0.getConstRegister().getVASType();
+          auto mem      = src.getConstMemory();
+          auto vas_e    = vt0.getConstRegister().getVASType();
+          auto laneSize = 0u; /* the size of a lane in bytes */
 
           switch (vas_e) {
-            case triton::arch::arm::ID_VAS_16B: {
-              auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0, triton::size::byte);
-              auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 1, triton::size::byte);
-              auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 2, triton::size::byte);
-              auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + 3, triton::size::byte);
-
-              for (triton::uint32 i = 0; i != 16; i++) {
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-                vec3.push_front(this->symbolicEngine->getMemoryAst(inst, vt3_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-                vt3_t |= this->taintEngine->isMemoryTainted(vt3_m);
-              }
-
-              postIndex = 4;
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_8B: {
-              auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0, triton::size::byte);
-              auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 1, triton::size::byte);
-              auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 2, triton::size::byte);
-              auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + 3, triton::size::byte);
-
-              for (triton::uint32 i = 0; i != 8; i++) {
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-                vec3.push_front(this->symbolicEngine->getMemoryAst(inst, vt3_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-                vt3_t |= this->taintEngine->isMemoryTainted(vt3_m);
-              }
-
-              postIndex = 4;
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_8H: {
-              auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0, triton::size::word);
-              auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 2, triton::size::word);
-              auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 4, triton::size::word);
-              auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + 6, triton::size::word);
-
-              for (triton::uint32 i = 0; i != 16; i += 2) {
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-                vec3.push_front(this->symbolicEngine->getMemoryAst(inst, vt3_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-                vt3_t |= this->taintEngine->isMemoryTainted(vt3_m);
-              }
-
-              postIndex = 8;
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_4H: {
-              auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0, triton::size::word);
-              auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 2, triton::size::word);
-              auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 4, triton::size::word);
-              auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + 6, triton::size::word);
-
-              for (triton::uint32 i = 0; i != 8; i += 2) {
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-                vec3.push_front(this->symbolicEngine->getMemoryAst(inst, vt3_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-                vt3_t |= this->taintEngine->isMemoryTainted(vt3_m);
-              }
-
-              postIndex = 8;
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_4S: {
-              auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0, triton::size::dword);
-              auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 4, triton::size::dword);
-              auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 8, triton::size::dword);
-              auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + 12, triton::size::dword);
-
-              for (triton::uint32 i = 0; i != 16; i += 4) {
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-                vec3.push_front(this->symbolicEngine->getMemoryAst(inst, vt3_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-                vt3_t |= this->taintEngine->isMemoryTainted(vt3_m);
-              }
-
-              postIndex = 16;
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_2S: {
-              auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0, triton::size::dword);
-              auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 4, triton::size::dword);
-              auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 8, triton::size::dword);
-              auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + 12, triton::size::dword);
-
-              for (triton::uint32 i = 0; i != 8; i += 4) {
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-                vec3.push_front(this->symbolicEngine->getMemoryAst(inst, vt3_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-                vt3_t |= this->taintEngine->isMemoryTainted(vt3_m);
-              }
+            case triton::arch::arm::ID_VAS_16B: [[fallthrough]];
+            case triton::arch::arm::ID_VAS_8B:  laneSize = triton::size::byte;  break;
+            case triton::arch::arm::ID_VAS_8H:  [[fallthrough]];
+            case triton::arch::arm::ID_VAS_4H:  laneSize = triton::size::word;  break;
+            case triton::arch::arm::ID_VAS_4S:  [[fallthrough]];
+            case triton::arch::arm::ID_VAS_2S:  laneSize = triton::size::dword; break;
+            case triton::arch::arm::ID_VAS_2D:  [[fallthrough]];
+            case triton::arch::arm::ID_VAS_1D:  laneSize = triton::size::qword; break;
+            default:
+              throw triton::exceptions::Semantics("AArch64Semantics::ld4r_s(): Invalid VAS encoding.");
+          }
 
-              postIndex = 16;
-              break;
-            }
+          /* The number of lanes of each register */
+          triton::uint32 lanes = vt0.getConstRegister().getVASSize() / laneSize;
 
-            case triton::arch::arm::ID_VAS_2D: {
-              auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0,  triton::size::qword);
-              auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 8,  triton::size::qword);
-              auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 16, triton::size::qword);
-              auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + 24, triton::size::qword);
-
-              for (triton::uint32 i = 0; i != 16; i += 8) {
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-                vec3.push_front(this->symbolicEngine->getMemoryAst(inst, vt3_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-                vt3_t |= this->taintEngine->isMemoryTainted(vt3_m);
-              }
+          /* LD4R single structure, replicated to all the lanes */
+          auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0 * laneSize, laneSize);
+          auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 1 * laneSize, laneSize);
+          auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 2 * laneSize, laneSize);
+          auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + 3 * laneSize, laneSize);
 
-              postIndex = 32;
-              break;
-            }
+          vt0_t = this->taintEngine->isMemoryTainted(vt0_m);
+          vt1_t = this->taintEngine->isMemoryTainted(vt1_m);
+          vt2_t = this->taintEngine->isMemoryTainted(vt2_m);
+          vt3_t = this->taintEngine->isMemoryTainted(vt3_m);
 
-            case triton::arch::arm::ID_VAS_1D: {
-              auto vt0_m = triton::arch::MemoryAccess(mem.getAddress() + 0,  triton::size::qword);
-              auto vt1_m = triton::arch::MemoryAccess(mem.getAddress() + 8,  triton::size::qword);
-              auto vt2_m = triton::arch::MemoryAccess(mem.getAddress() + 16, triton::size::qword);
-              auto vt3_m = triton::arch::MemoryAccess(mem.getAddress() + 24, triton::size::qword);
-
-              for (triton::uint32 i = 0; i != 8; i += 8) {
-                vec0.push_front(this->symbolicEngine->getMemoryAst(inst, vt0_m));
-                vec1.push_front(this->symbolicEngine->getMemoryAst(inst, vt1_m));
-                vec2.push_front(this->symbolicEngine->getMemoryAst(inst, vt2_m));
-                vec3.push_front(this->symbolicEngine->getMemoryAst(inst, vt3_m));
-
-                vt0_t |= this->taintEngine->isMemoryTainted(vt0_m);
-                vt1_t |= this->taintEngine->isMemoryTainted(vt1_m);
-                vt2_t |= this->taintEngine->isMemoryTainted(vt2_m);
-                vt3_t |= this->taintEngine->isMemoryTainted(vt3_m);
-              }
+          postIndex = 4 * laneSize;
 
-              postIndex = 32;
-              break;
-            }
-
-            default:
-              throw triton::exceptions::Semantics("AArch64Semantics::ld4r_s(): Invalid VAS encoding.");
-          }
-
-          /* Create the semantics of the LD3R */
-          auto node0 = this->astCtxt->concat(vec0);
-          auto node1 = this->astCtxt->concat(vec1);
-          auto node2 = this->astCtxt->concat(vec2);
-          auto node3 = this->astCtxt->concat(vec3);
+          /* Create the semantics of the LD4R */
+          auto node0 = this->astCtxt->splat(this->symbolicEngine->getMemoryAst(inst, vt0_m), lanes);
+          auto node1 = this->astCtxt->splat(this->symbolicEngine->getMemoryAst(inst, vt1_m), lanes);
+          auto node2 = this->astCtxt->splat(this->symbolicEngine->getMemoryAst(inst, vt2_m), lanes);
+          auto node3 = this->astCtxt->splat(this->symbolicEngine->getMemoryAst(inst, vt3_m), lanes);
 
           /* Create symbolic expression */
           auto expr0 = this->symbolicEngine->createSymbolicExpression(inst, node0, vt0, "LD4R operation - LOAD access");
@@ -3927,78 +3392,30 @@ namespace triton {
 
 
         void AArch64Semantics::movi_s(triton::arch::Instruction& inst) {
-          std::list<triton::ast::SharedAbstractNode> vec;
-
           triton::arch::OperandWrapper& dst = inst.operands[0]; /* vas register */
           triton::arch::OperandWrapper& src = inst.operands[1]; /* imm */
 
           /* Create symbolic operands */
-          auto imm = this->symbolicEngine->getOperandAst(inst, src);
-          auto vas_e = dst.getConstRegister().getVASType();
+          auto imm      = this->symbolicEngine->getOperandAst(inst, src);
+          auto vas_e    = dst.getConstRegister().getVASType();
+          auto laneSize = 0u; /* the size of a lane in bytes */
 
           switch (vas_e) {
-            case triton::arch::arm::ID_VAS_16B: {
-              for (triton::uint32 i = 0; i != 16; i++) {
-                vec.push_front(this->astCtxt->extract(7, 0, imm));
-              }
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_8B: {
-              for (triton::uint32 i = 0; i != 8; i++) {
-                vec.push_front(this->astCtxt->extract(7, 0, imm));
-              }
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_8H: {
-              for (triton::uint32 i = 0; i != 16; i += 2) {
-                vec.push_front(this->astCtxt->extract(15, 0, imm));
-              }
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_4H: {
-              for (triton::uint32 i = 0; i != 8; i += 2) {
-                vec.push_front(this->astCtxt->extract(15, 0, imm));
-              }
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_4S: {
-              for (triton::uint32 i = 0; i != 16; i += 4) {
-                vec.push_front(this->astCtxt->extract(31, 0, imm));
-              }
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_2S: {
-              for (triton::uint32 i = 0; i != 8; i += 4) {
-                vec.push_front(this->astCtxt->extract(31, 0, imm));
-              }
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_2D: {
-              for (triton::uint32 i = 0; i != 16; i += 8) {
-                vec.push_front(this->astCtxt->extract(63, 0, imm));
-              }
-              break;
-            }
-
-            case triton::arch::arm::ID_VAS_1D: {
-              for (triton::uint32 i = 0; i != 8; i += 8) {
-                vec.push_front(this->astCtxt->extract(63, 0, imm));
-              }
-              break;
-            }
-
+            case triton::arch::arm::ID_VAS_16B: [[fallthrough]];
+            case triton::arch::arm::ID_VAS_8B:  laneSize = triton::size::byte;  break;
+            case triton::arch::arm::ID_VAS_8H:  [[fallthrough]];
+            case triton::arch::arm::ID_VAS_4H:  laneSize = triton::size::word;  break;
+            case triton::arch::arm::ID_VAS_4S:  [[fallthrough]];
+            case triton::arch::arm::ID_VAS_2S:  laneSize = triton::size::dword; break;
+            case triton::arch::arm::ID_VAS_2D:  [[fallthrough]];
+            case triton::arch::arm::ID_VAS_1D:  laneSize = triton::size::qword; break;
             default:
               throw triton::exceptions::Semantics("AArch64Semantics::movi_s(): Invalid VAS encoding.");
           }
 
           /* Create the semantics */
-          auto node = this->astCtxt->concat(vec);
+          auto lane = this->astCtxt->extract(laneSize * triton::bitsize::byte - 1, 0, imm);
+          auto node = this->astCtxt->splat(lane, dst.getConstRegister().getVASSize() / laneSize);
 
           /* Create symbolic expression */
           auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "MOVI operation");
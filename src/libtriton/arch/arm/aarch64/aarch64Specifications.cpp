@@ -18,9 +18,15 @@ namespace triton {
     namespace arm {
       namespace aarch64 {
 
-        AArch64Specifications::AArch64Specifications(triton::arch::architecture_e arch) {
+        const AArch64Specifications::RegisterTables& AArch64Specifications::getRegisterTables(triton::arch::architecture_e arch) {
           if (arch != triton::arch::ARCH_AARCH64)
-              throw triton::exceptions::Architecture("AArch64Specifications::AArch64Specifications(): Invalid architecture.");
+            throw triton::exceptions::Architecture("AArch64Specifications::AArch64Specifications(): Invalid architecture.");
+
+          /* Initialized once, even if several threads create a CPU at the same time */
+          static const RegisterTables aarch64Tables = [] {
+            RegisterTables tables;
+            auto& id2reg  = tables.id2reg;
+            auto& name2id = tables.name2id;
 
             // Fill id2reg and name2id with those available in AArch64 from spec
             #define REG_SPEC(UPPER_NAME, LOWER_NAME, AARCH64_UPPER, AARCH64_LOWER, AARCH64_PARENT, MUTABLE) \
@@ -37,6 +43,23 @@ namespace triton {
             #define REG_SPEC_NO_CAPSTONE REG_SPEC
             #define SYS_REG_SPEC REG_SPEC
             #include "triton/aarch64.spec"
+
+            /* Index the registers by id, the lookups of the CPU do not hash */
+            tables.id2ptr.resize(triton::arch::ID_REG_LAST_ITEM, nullptr);
+            for (const auto& kv : id2reg)
+              tables.id2ptr[kv.first] = &kv.second;
+
+            return tables;
+          }();
+
+          return aarch64Tables;
+        }
+
+
+        AArch64Specifications::AArch64Specifications(triton::arch::architecture_e arch)
+          : id2reg(getRegisterTables(arch).id2reg),
+            name2id(getRegisterTables(arch).name2id),
+            id2ptr(getRegisterTables(arch).id2ptr) {
         }
 
 
@@ -40,7 +40,12 @@ namespace triton {
 
 
         Arm32Cpu::Arm32Cpu(const Arm32Cpu& other) : Arm32Specifications(ARCH_ARM32) {
+          this->callbacks   = other.callbacks;
+          this->handleArm   = 0;
+          this->handleThumb = 0;
+
           this->copy(other);
+          this->disassInit();
         }
 
 
@@ -82,27 +87,10 @@ namespace triton {
 
 
         void Arm32Cpu::copy(const Arm32Cpu& other) {
-          this->callbacks           = other.callbacks;
           this->exclusiveMemoryTags = other.exclusiveMemoryTags;
           this->memory              = other.memory;
 
-          std::memcpy(this->r0,   other.r0,   sizeof(this->r0));
-          std::memcpy(this->r1,   other.r1,   sizeof(this->r1));
-          std::memcpy(this->r2,   other.r2,   sizeof(this->r2));
-          std::memcpy(this->r3,   other.r3,   sizeof(this->r3));
-          std::memcpy(this->r4,   other.r4,   sizeof(this->r4));
-          std::memcpy(this->r5,   other.r5,   sizeof(this->r5));
-          std::memcpy(this->r6,   other.r6,   sizeof(this->r6));
-          std::memcpy(this->r7,   other.r7,   sizeof(this->r7));
-          std::memcpy(this->r8,   other.r8,   sizeof(this->r8));
-          std::memcpy(this->r9,   other.r9,   sizeof(this->r9));
-          std::memcpy(this->r10,  other.r10,  sizeof(this->r10));
-          std::memcpy(this->r11,  other.r11,  sizeof(this->r11));
-          std::memcpy(this->r12,  other.r12,  sizeof(this->r12));
-          std::memcpy(this->sp,   other.sp,   sizeof(this->sp));
-          std::memcpy(this->r14,  other.r14,  sizeof(this->r14));
-          std::memcpy(this->pc,   other.pc,   sizeof(this->pc));
-          std::memcpy(this->apsr, other.apsr, sizeof(this->apsr));
+          std::memcpy(this->registerFile, other.registerFile, sizeof(this->registerFile));
         }
 
 
@@ -111,23 +99,10 @@ namespace triton {
           this->memory.clear();
 
           /* Clear registers */
-          std::memset(this->r0,   0x00, sizeof(this->r0));
-          std::memset(this->r1,   0x00, sizeof(this->r1));
-          std::memset(this->r2,   0x00, sizeof(this->r2));
-          std::memset(this->r3,   0x00, sizeof(this->r3));
-          std::memset(this->r4,   0x00, sizeof(this->r4));
-          std::memset(this->r5,   0x00, sizeof(this->r5));
-          std::memset(this->r6,   0x00, sizeof(this->r6));
-          std::memset(this->r7,   0x00, sizeof(this->r7));
-          std::memset(this->r8,   0x00, sizeof(this->r8));
-          std::memset(this->r9,   0x00, sizeof(this->r9));
-          std::memset(this->r10,  0x00, sizeof(this->r10));
-          std::memset(this->r11,  0x00, sizeof(this->r11));
-          std::memset(this->r12,  0x00, sizeof(this->r12));
-          std::memset(this->sp,   0x00, sizeof(this->sp));
-          std::memset(this->r14,  0x00, sizeof(this->r14));
-          std::memset(this->pc,   0x00, sizeof(this->pc));
-          std::memset(this->apsr, 0x00, sizeof(this->apsr));
+          std::memset(this->registerFile, 0x00, sizeof(this->registerFile));
+
+          /* Clear the decoded instructions */
+          this->decodeCache.clear();
         }
 
 
@@ -181,11 +156,48 @@ namespace triton {
           return this->id2reg;
         }
 
-        const std::unordered_map<triton::uint64, triton::uint8, IdentityHash<triton::uint64>>& Arm32Cpu::getConcreteMemory(void) const {
+        const triton::arch::ConcreteMemory& Arm32Cpu::getConcreteMemory(void) const {
           return this->memory;
         }
 
 
+        const triton::arch::RegisterSlot& Arm32Cpu::getConcreteRegisterSlot(triton::arch::register_e id) const {
+          return Arm32Cpu::layout.getSlot(id);
+        }
+
+
+        const triton::uint8* Arm32Cpu::getConcreteRegisterFile(void) const {
+          return this->registerFile;
+        }
+
+
+        bool Arm32Cpu::isDirectConcreteRegister(const triton::arch::Register& reg, triton::callbacks::callback_e kind, bool execCallbacks) const {
+          if (execCallbacks && this->callbacks && this->callbacks->isDefined(kind))
+            return false;
+
+          /* Writing the program counter may switch to Thumb */
+          if (reg.getId() == triton::arch::ID_REG_ARM32_PC)
+            return false;
+
+          return Arm32Cpu::layout.getSlot(reg.getId()).size != 0;
+        }
+
+
+        triton::uint8* Arm32Cpu::getWritableConcreteRegisterFile(void) {
+          return this->registerFile;
+        }
+
+
+        triton::usize Arm32Cpu::getConcreteRegisterFileSize(void) const {
+          return sizeof(this->registerFile);
+        }
+
+
+        triton::arch::DecodeCache& Arm32Cpu::getDecodeCache(void) {
+          return this->decodeCache;
+        }
+
+
         std::set<const triton::arch::Register*> Arm32Cpu::getParentRegisters(void) const {
           std::set<const triton::arch::Register*> ret;
 
@@ -207,22 +219,19 @@ namespace triton {
 
 
         const triton::arch::Register& Arm32Cpu::getRegister(triton::arch::register_e id) const {
-          try {
-            return this->id2reg.at(id);
-          } catch (const std::out_of_range&) {
+          if (id >= this->id2ptr.size() || this->id2ptr[id] == nullptr)
             throw triton::exceptions::Cpu("Arm32Cpu::getRegister(): Invalid register for this architecture.");
-          }
+          return *this->id2ptr[id];
         }
 
 
         const triton::arch::Register& Arm32Cpu::getRegister(const std::string& name) const {
-        std::string lower = name;
-        std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c){ return std::tolower(c); });
-          try {
-            return this->getRegister(this->name2id.at(lower));
-          } catch (const std::out_of_range&) {
+          std::string lower = name;
+          std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c){ return std::tolower(c); });
+          auto it = this->name2id.find(lower);
+          if (it == this->name2id.end())
             throw triton::exceptions::Cpu("Arm32Cpu::getRegister(): Invalid register for this architecture.");
-          }
+          return this->getRegister(it->second);
         }
 
 
@@ -266,6 +275,13 @@ namespace triton {
             inst.setAddress(static_cast<triton::uint64>(this->getConcreteRegisterValue(this->getProgramCounter())));
           }
 
+          /* Instructions of an IT block depend on the IT state, they are never cached */
+          bool cacheable = (this->itInstrsCount == 0);
+
+          /* Reuse the decoding of an instruction already seen */
+          if (cacheable && this->decodeCache.load(inst, this->thumb))
+            return;
+
           /* Let's disass and build our operands */
           count = triton::extlibs::capstone::cs_disasm(handle, inst.getOpcode(), inst.getSize(), inst.getAddress(), 0, &insn);
           if (count > 0) {
@@ -516,6 +532,10 @@ namespace triton {
             /* Post process instruction */
             this->postDisassembly(inst);
 
+            /* Keep the decoding for the next time */
+            if (cacheable && inst.getType() != ID_INS_IT)
+              this->decodeCache.store(inst, this->thumb);
+
             /* Free capstone stuffs */
             triton::extlibs::capstone::cs_free(insn, count);
           }
@@ -526,6 +546,85 @@ namespace triton {
         }
 
 
+        triton::arch::DecodeInfo Arm32Cpu::decode(const triton::uint8* opcode, triton::uint32 size, triton::uint64 addr) {
+          triton::extlibs::capstone::cs_insn* insn;
+          triton::usize count = 0;
+          triton::arch::DecodeInfo info;
+
+          /* Check if the opcode and opcode' size are defined */
+          if (opcode == nullptr || size == 0)
+            throw triton::exceptions::Disassembly("Arm32Cpu::decode(): Opcode and opcodeSize must be defined.");
+
+          /*
+           * The detail is still needed for the groups and the target, but no operand is built.
+           * The IT state is neither used nor updated, so the condition of an instruction of an
+           * IT block is not known.
+           */
+          count = triton::extlibs::capstone::cs_disasm((this->thumb ? this->handleThumb : this->handleArm), opcode, size, addr, 1, &insn);
+          if (count == 0)
+            throw triton::exceptions::Disassembly("Arm32Cpu::decode(): Failed to disassemble the given code.");
+
+          triton::extlibs::capstone::cs_detail* detail = insn->detail;
+
+          info.address = addr;
+          info.size    = insn[0].size;
+          info.type    = this->capstoneInstructionToTritonInstruction(insn[0].id);
+
+          for (triton::uint32 n = 0; n < detail->groups_count; n++) {
+            if (detail->groups[n] == triton::extlibs::capstone::ARM_GRP_JUMP)
+              info.branch = true;
+          }
+
+          if (info.branch) {
+            triton::arch::arm::condition_e cc = this->capstoneConditionToTritonCondition(detail->arm.cc);
+            bool lr = (detail->arm.op_count == 1 && detail->arm.operands[0].type == triton::extlibs::capstone::ARM_OP_REG &&
+                       this->capstoneRegisterToTritonRegister(detail->arm.operands[0].reg) == ID_REG_ARM32_R14);
+
+            switch (info.type) {
+              case ID_INS_BL:
+              case ID_INS_BLX:
+                info.flow = triton::arch::FLOW_CALL;
+                break;
+              case ID_INS_CBNZ:
+              case ID_INS_CBZ:
+                info.flow = triton::arch::FLOW_COND_JUMP;
+                break;
+              default:
+                if (cc != triton::arch::arm::ID_CONDITION_INVALID && cc != triton::arch::arm::ID_CONDITION_AL)
+                  info.flow = triton::arch::FLOW_COND_JUMP;
+                else if (info.type == ID_INS_BX && lr)
+                  info.flow = triton::arch::FLOW_RETURN;
+                else
+                  info.flow = triton::arch::FLOW_JUMP;
+                break;
+            }
+
+            /* The target is the last operand, after the register tested if any */
+            triton::uint8 last = detail->arm.op_count;
+            if (info.flow != triton::arch::FLOW_RETURN && last && detail->arm.operands[last - 1].type == triton::extlibs::capstone::ARM_OP_IMM) {
+              info.direct = true;
+              info.target = static_cast<triton::uint32>(detail->arm.operands[last - 1].imm);
+            }
+          }
+
+          /* A POP of PC changes the control flow, as in postDisassembly() */
+          if (info.type == ID_INS_POP) {
+            for (triton::uint32 n = 0; n < detail->arm.op_count; n++) {
+              if (detail->arm.operands[n].type == triton::extlibs::capstone::ARM_OP_REG &&
+                  this->capstoneRegisterToTritonRegister(detail->arm.operands[n].reg) == this->pcId) {
+                info.flow = triton::arch::FLOW_RETURN;
+                break;
+              }
+            }
+          }
+          info.controlFlow = (info.flow != triton::arch::FLOW_NONE);
+
+          triton::extlibs::capstone::cs_free(insn, count);
+
+          return info;
+        }
+
+
         void Arm32Cpu::postDisassembly(triton::arch::Instruction& inst) const {
           /* Fix update flag */
           /* NOTE: Quick (and super ugly) hack. Capstone is reporting
@@ -590,24 +689,23 @@ namespace triton {
 
 
         triton::uint8 Arm32Cpu::getConcreteMemoryValue(triton::uint64 addr, bool execCallbacks) const {
-          if (execCallbacks && this->callbacks)
+          if (execCallbacks && this->callbacks) {
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_PAGE, this->memory, addr, triton::size::byte);
             this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, triton::size::byte));
+          }
 
-          auto it = this->memory.find(addr);
-          if (it == this->memory.end())
-            return 0x00;
-
-          return it->second;
+          return this->memory.read(addr);
         }
 
 
         triton::uint512 Arm32Cpu::getConcreteMemoryValue(const triton::arch::MemoryAccess& mem, bool execCallbacks) const {
-          triton::uint512 ret = 0;
           triton::uint64 addr = 0;
           triton::uint32 size = 0;
 
-          if (execCallbacks && this->callbacks)
+          if (execCallbacks && this->callbacks) {
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_PAGE, this->memory, mem.getAddress(), mem.getSize());
             this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, mem);
+          }
 
           addr = mem.getAddress();
           size = mem.getSize();
@@ -615,103 +713,112 @@ namespace triton {
           if (size == 0 || size > triton::size::dqqword)
             throw triton::exceptions::Cpu("Arm32Cpu::getConcreteMemoryValue(): Invalid size memory.");
 
-          for (triton::sint32 i = size-1; i >= 0; i--)
-            ret = ((ret << triton::bitsize::byte) | this->getConcreteMemoryValue(addr+i, false));
-
-          return ret;
+          return this->memory.readValue(addr, size);
         }
 
 
         std::vector<triton::uint8> Arm32Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
-          std::vector<triton::uint8> area;
+          std::vector<triton::uint8> area(size);
 
-          for (triton::usize index = 0; index < size; index++)
-            area.push_back(this->getConcreteMemoryValue(baseAddr+index, execCallbacks));
+          if (execCallbacks && this->callbacks) {
+            for (triton::usize index = 0; index < size; index++)
+              area[index] = this->getConcreteMemoryValue(baseAddr+index, execCallbacks);
+          }
+          else {
+            this->memory.read(baseAddr, area.data(), size);
+          }
 
           return area;
         }
 
 
-        triton::uint512 Arm32Cpu::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
-          triton::uint512 value = 0;
+        void Arm32Cpu::readConcreteMemory(triton::uint64 baseAddr, void* area, triton::usize size, bool execCallbacks) const {
+          if (execCallbacks && this->callbacks) {
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_PAGE, this->memory, baseAddr, size);
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, baseAddr, size);
+          }
+
+          this->memory.read(baseAddr, reinterpret_cast<triton::uint8*>(area), size);
+        }
 
+
+        triton::uint512 Arm32Cpu::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
           if (execCallbacks && this->callbacks)
             this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_REGISTER_VALUE, reg);
 
-          switch (reg.getId()) {
-            case triton::arch::ID_REG_ARM32_R0:   return (*((triton::uint32*)(this->r0)));
-            case triton::arch::ID_REG_ARM32_R1:   return (*((triton::uint32*)(this->r1)));
-            case triton::arch::ID_REG_ARM32_R2:   return (*((triton::uint32*)(this->r2)));
-            case triton::arch::ID_REG_ARM32_R3:   return (*((triton::uint32*)(this->r3)));
-            case triton::arch::ID_REG_ARM32_R4:   return (*((triton::uint32*)(this->r4)));
-            case triton::arch::ID_REG_ARM32_R5:   return (*((triton::uint32*)(this->r5)));
-            case triton::arch::ID_REG_ARM32_R6:   return (*((triton::uint32*)(this->r6)));
-            case triton::arch::ID_REG_ARM32_R7:   return (*((triton::uint32*)(this->r7)));
-            case triton::arch::ID_REG_ARM32_R8:   return (*((triton::uint32*)(this->r8)));
-            case triton::arch::ID_REG_ARM32_R9:   return (*((triton::uint32*)(this->r9)));
-            case triton::arch::ID_REG_ARM32_R10:  return (*((triton::uint32*)(this->r10)));
-            case triton::arch::ID_REG_ARM32_R11:  return (*((triton::uint32*)(this->r11)));
-            case triton::arch::ID_REG_ARM32_R12:  return (*((triton::uint32*)(this->r12)));
-            case triton::arch::ID_REG_ARM32_SP:   return (*((triton::uint32*)(this->sp)));
-            case triton::arch::ID_REG_ARM32_R14:  return (*((triton::uint32*)(this->r14)));
-            case triton::arch::ID_REG_ARM32_PC:   return (*((triton::uint32*)(this->pc)));
-            case triton::arch::ID_REG_ARM32_APSR: return (*((triton::uint32*)(this->apsr)));
-            case triton::arch::ID_REG_ARM32_N:    return (((*((triton::uint32*)(this->apsr))) >> 31) & 1);
-            case triton::arch::ID_REG_ARM32_Z:    return (((*((triton::uint32*)(this->apsr))) >> 30) & 1);
-            case triton::arch::ID_REG_ARM32_C:    return (((*((triton::uint32*)(this->apsr))) >> 29) & 1);
-            case triton::arch::ID_REG_ARM32_V:    return (((*((triton::uint32*)(this->apsr))) >> 28) & 1);
-            default:
-              throw triton::exceptions::Cpu("Arm32Cpu::getConcreteRegisterValue(): Invalid register.");
-          }
+          const triton::arch::RegisterSlot& slot = Arm32Cpu::layout.getSlot(reg.getId());
+          if (slot.size == 0)
+            throw triton::exceptions::Cpu("Arm32Cpu::getConcreteRegisterValue(): Invalid register.");
 
-          return value;
+          return slot.read(this->registerFile);
         }
 
 
         void Arm32Cpu::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value, bool execCallbacks) {
-          if (execCallbacks && this->callbacks)
+          if (execCallbacks && this->callbacks) {
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_PAGE, this->memory, addr, triton::size::byte);
             this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, triton::size::byte), value);
-          this->memory[addr] = value;
+          }
+          this->memory.write(addr, value);
         }
 
 
         void Arm32Cpu::setConcreteMemoryValue(const triton::arch::MemoryAccess& mem, const triton::uint512& value, bool execCallbacks) {
           triton::uint64 addr = mem.getAddress();
           triton::uint32 size = mem.getSize();
-          triton::uint512 cv  = value;
 
-          if (cv > mem.getMaxValue())
+          if (value > mem.getMaxValue())
             throw triton::exceptions::Register("Arm32Cpu::setConcreteMemoryValue(): You cannot set this concrete value (too big) to this memory access.");
 
           if (size == 0 || size > triton::size::dqqword)
             throw triton::exceptions::Cpu("Arm32Cpu::setConcreteMemoryValue(): Invalid size memory.");
 
-          if (execCallbacks && this->callbacks)
+          if (execCallbacks && this->callbacks) {
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_PAGE, this->memory, mem.getAddress(), mem.getSize());
             this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, mem, value);
-
-          for (triton::uint32 i = 0; i < size; i++) {
-            this->memory[addr+i] = static_cast<triton::uint8>((cv & 0xff));
-            cv >>= 8;
           }
+
+          this->memory.writeValue(addr, value, size);
         }
 
 
         void Arm32Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values, bool execCallbacks) {
-          this->memory.reserve(values.size() + this->memory.size());
-          for (triton::usize index = 0; index < values.size(); index++) {
-            this->setConcreteMemoryValue(baseAddr+index, values[index], execCallbacks);
+          if (execCallbacks && this->callbacks) {
+            for (triton::usize index = 0; index < values.size(); index++)
+              this->setConcreteMemoryValue(baseAddr+index, values[index], execCallbacks);
+          }
+          else {
+            this->memory.write(baseAddr, values.data(), values.size());
           }
         }
 
 
         void Arm32Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const void* area, triton::usize size, bool execCallbacks) {
-          this->memory.reserve(size + this->memory.size());
-          for (triton::usize index = 0; index < size; index++) {
-            this->setConcreteMemoryValue(baseAddr+index, reinterpret_cast<const triton::uint8*>(area)[index], execCallbacks);
+          if (execCallbacks && this->callbacks) {
+            for (triton::usize index = 0; index < size; index++)
+              this->setConcreteMemoryValue(baseAddr+index, reinterpret_cast<const triton::uint8*>(area)[index], execCallbacks);
+          }
+          else {
+            this->memory.write(baseAddr, reinterpret_cast<const triton::uint8*>(area), size);
           }
         }
 
 
+        void Arm32Cpu::mapConcreteMemoryArea(triton::uint64 baseAddr, const void* area, triton::usize size, const std::shared_ptr<const void>& owner) {
+          this->memory.map(baseAddr, reinterpret_cast<const triton::uint8*>(area), size, owner);
+        }
+
+
+        void Arm32Cpu::writeConcreteMemory(triton::uint64 baseAddr, const void* area, triton::usize size, bool execCallbacks) {
+          if (execCallbacks && this->callbacks) {
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_PAGE, this->memory, baseAddr, size);
+            this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, baseAddr, reinterpret_cast<const triton::uint8*>(area), size);
+          }
+
+          this->memory.write(baseAddr, reinterpret_cast<const triton::uint8*>(area), size);
+        }
+
+
         void Arm32Cpu::setConcreteRegisterValue(const triton::arch::Register& reg, const triton::uint512& value, bool execCallbacks) {
           if (value > reg.getMaxValue())
             throw triton::exceptions::Register("Arm32Cpu::setConcreteRegisterValue(): You cannot set this concrete value (too big) to this register.");
@@ -719,61 +826,40 @@ namespace triton {
           if (execCallbacks && this->callbacks)
             this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_REGISTER_VALUE, reg, value);
 
-          switch (reg.getId()) {
-            case triton::arch::ID_REG_ARM32_R0:   (*((triton::uint32*)(this->r0)))   = static_cast<triton::uint32>(value); break;
-            case triton::arch::ID_REG_ARM32_R1:   (*((triton::uint32*)(this->r1)))   = static_cast<triton::uint32>(value); break;
-            case triton::arch::ID_REG_ARM32_R2:   (*((triton::uint32*)(this->r2)))   = static_cast<triton::uint32>(value); break;
-            case triton::arch::ID_REG_ARM32_R3:   (*((triton::uint32*)(this->r3)))   = static_cast<triton::uint32>(value); break;
-            case triton::arch::ID_REG_ARM32_R4:   (*((triton::uint32*)(this->r4)))   = static_cast<triton::uint32>(value); break;
-            case triton::arch::ID_REG_ARM32_R5:   (*((triton::uint32*)(this->r5)))   = static_cast<triton::uint32>(value); break;
-            case triton::arch::ID_REG_ARM32_R6:   (*((triton::uint32*)(this->r6)))   = static_cast<triton::uint32>(value); break;
-            case triton::arch::ID_REG_ARM32_R7:   (*((triton::uint32*)(this->r7)))   = static_cast<triton::uint32>(value); break;
-            case triton::arch::ID_REG_ARM32_R8:   (*((triton::uint32*)(this->r8)))   = static_cast<triton::uint32>(value); break;
-            case triton::arch::ID_REG_ARM32_R9:   (*((triton::uint32*)(this->r9)))   = static_cast<triton::uint32>(value); break;
-            case triton::arch::ID_REG_ARM32_R10:  (*((triton::uint32*)(this->r10)))  = static_cast<triton::uint32>(value); break;
-            case triton::arch::ID_REG_ARM32_R11:  (*((triton::uint32*)(this->r11)))  = static_cast<triton::uint32>(value); break;
-            case triton::arch::ID_REG_ARM32_R12:  (*((triton::uint32*)(this->r12)))  = static_cast<triton::uint32>(value); break;
-            case triton::arch::ID_REG_ARM32_SP:   (*((triton::uint32*)(this->sp)))   = static_cast<triton::uint32>(value); break;
-            case triton::arch::ID_REG_ARM32_R14:  (*((triton::uint32*)(this->r14)))  = static_cast<triton::uint32>(value); break;
-            case triton::arch::ID_REG_ARM32_PC: {
-              /* NOTE: Once in Thumb mode only switch to ARM through a Branch
-               * and Exchange instruction. The reason for this is that after
-               * switching to Thumb the ISB (instruction set selection bit) is
-               * cleared. Therefore, if we allow to switch back to ARM through
-               * these mechanism we would have a problem processing Thumb
-               * instructions.
-               */
-              auto pc = static_cast<triton::uint32>(value);
-              if (this->isThumb() == false && (pc & 0x1) == 0x1) {
-                this->setThumb(true);
-              }
-              (*((triton::uint32*)(this->pc))) = pc & ~0x1;
-              break;
+          const triton::arch::RegisterSlot& slot = Arm32Cpu::layout.getSlot(reg.getId());
+          if (slot.size == 0)
+            throw triton::exceptions::Cpu("Arm32Cpu:setConcreteRegisterValue(): Invalid register.");
+
+          if (reg.getId() == triton::arch::ID_REG_ARM32_PC) {
+            /* NOTE: Once in Thumb mode only switch to ARM through a Branch
+             * and Exchange instruction. The reason for this is that after
+             * switching to Thumb the ISB (instruction set selection bit) is
+             * cleared. Therefore, if we allow to switch back to ARM through
+             * these mechanism we would have a problem processing Thumb
+             * instructions.
+             */
+            auto pc = static_cast<triton::uint32>(value);
+            if (this->isThumb() == false && (pc & 0x1) == 0x1) {
+              this->setThumb(true);
             }
-            case triton::arch::ID_REG_ARM32_APSR: (*((triton::uint32*)(this->apsr))) = static_cast<triton::uint32>(value); break;
-            case triton::arch::ID_REG_ARM32_N: {
-              triton::uint32 b = (*((triton::uint32*)(this->apsr)));
-              (*((triton::uint32*)(this->apsr))) = !value.is_zero() ? b | (1 << 31) : b & ~(1 << 31);
-              break;
-            }
-            case triton::arch::ID_REG_ARM32_Z: {
-              triton::uint32 b = (*((triton::uint32*)(this->apsr)));
-              (*((triton::uint32*)(this->apsr))) = !value.is_zero() ? b | (1 << 30) : b & ~(1 << 30);
-              break;
-            }
-            case triton::arch::ID_REG_ARM32_C: {
-              triton::uint32 b = (*((triton::uint32*)(this->apsr)));
-              (*((triton::uint32*)(this->apsr))) = !value.is_zero() ? b | (1 << 29) : b & ~(1 << 29);
-              break;
-            }
-            case triton::arch::ID_REG_ARM32_V: {
-              triton::uint32 b = (*((triton::uint32*)(this->apsr)));
-              (*((triton::uint32*)(this->apsr))) = !value.is_zero() ? b | (1 << 28) : b & ~(1 << 28);
-              break;
-            }
-            default:
-              throw triton::exceptions::Cpu("Arm32Cpu:setConcreteRegisterValue(): Invalid register.");
+            slot.write(this->registerFile, pc & ~0x1);
+            return;
           }
+
+          slot.write(this->registerFile, value);
+        }
+
+
+        void Arm32Cpu::setConcreteRegisterFile(const triton::uint8* file, triton::usize size) {
+          if (size != sizeof(this->registerFile))
+            throw triton::exceptions::Cpu("Arm32Cpu::setConcreteRegisterFile(): Invalid size of register file.");
+
+          std::memcpy(this->registerFile, file, size);
+        }
+
+
+        void Arm32Cpu::swapConcreteMemory(triton::arch::ConcreteMemory& memory) {
+          this->memory.swap(memory);
         }
 
 
@@ -820,11 +906,7 @@ namespace triton {
 
 
         bool Arm32Cpu::isConcreteMemoryValueDefined(triton::uint64 baseAddr, triton::usize size) const {
-          for (triton::usize index = 0; index < size; index++) {
-            if (this->memory.find(baseAddr + index) == this->memory.end())
-              return false;
-          }
-          return true;
+          return this->memory.isDefined(baseAddr, size);
         }
 
 
@@ -834,11 +916,7 @@ namespace triton {
 
 
         void Arm32Cpu::clearConcreteMemoryValue(triton::uint64 baseAddr, triton::usize size) {
-          for (triton::usize index = 0; index < size; index++) {
-            if (this->memory.find(baseAddr + index) != this->memory.end()) {
-              this->memory.erase(baseAddr + index);
-            }
-          }
+          this->memory.clear(baseAddr, size);
         }
 
 
@@ -112,7 +112,8 @@ namespace triton {
         Arm32Semantics::Arm32Semantics(triton::arch::Architecture* architecture,
                                        triton::engines::symbolic::SymbolicEngine* symbolicEngine,
                                        triton::engines::taint::TaintEngine* taintEngine,
-                                       const triton::ast::SharedAstContext& astCtxt) : astCtxt(astCtxt) {
+                                       const triton::modes::SharedModes& modes,
+                                       const triton::ast::SharedAstContext& astCtxt) : modes(modes), astCtxt(astCtxt) {
 
           this->architecture    = architecture;
           this->exception       = triton::arch::NO_FAULT;
@@ -132,6 +133,13 @@ namespace triton {
 
         triton::arch::exception_e Arm32Semantics::buildSemantics(triton::arch::Instruction& inst) {
           this->exception = triton::arch::NO_FAULT;
+
+          /* An instruction which is concretely not executed only moves to the next one */
+          if (this->isConcretelyNotExecuted(inst)) {
+            this->controlFlow_s(inst);
+            return this->exception;
+          }
+
           switch (inst.getType()) {
             case ID_INS_ADC:       this->adc_s(inst);           break;
             case ID_INS_ADD:       this->add_s(inst);           break;
@@ -229,16 +237,60 @@ namespace triton {
            */
           auto condNode = this->getCodeConditionAst(inst);
           auto thenNode = opNode;
-          auto elseNode = this->symbolicEngine->getOperandAst(inst, dst);
 
           if (dst.getRegister().getId() == ID_REG_ARM32_PC) {
             thenNode = this->clearISSB(opNode);
           }
 
+          /* A concrete condition selects its branch without building the ite */
+          if (condNode->isSymbolized() == false) {
+            if (condNode->evaluate()) {
+              return thenNode;
+            }
+            return this->symbolicEngine->getOperandAst(inst, dst);
+          }
+
+          auto elseNode = this->symbolicEngine->getOperandAst(inst, dst);
+
           return this->astCtxt->ite(condNode, thenNode, elseNode);
         }
 
 
+        bool Arm32Semantics::isConcretelyNotExecuted(triton::arch::Instruction& inst) {
+          switch (inst.getCodeCondition()) {
+            case triton::arch::arm::ID_CONDITION_INVALID:
+            case triton::arch::arm::ID_CONDITION_AL:
+              return false;
+            default:
+              break;
+          }
+
+          /* IT sets up its block, and the branches keep their path constraints even when not taken */
+          switch (inst.getType()) {
+            case ID_INS_B:
+            case ID_INS_BL:
+            case ID_INS_BLX:
+            case ID_INS_BX:
+            case ID_INS_CBNZ:
+            case ID_INS_CBZ:
+            case ID_INS_IT:
+            case ID_INS_TBB:
+            case ID_INS_TBH:
+              return false;
+            default:
+              break;
+          }
+
+          /* Tainted flags taint the destinations even when the condition does not hold */
+          if (this->getCodeConditionTaintState(inst)) {
+            return false;
+          }
+
+          auto cond = this->getCodeConditionAst(inst);
+          return (cond->isSymbolized() == false && cond->evaluate() == false);
+        }
+
+
         inline void Arm32Semantics::updateExecutionState(triton::arch::OperandWrapper& dst, const triton::ast::SharedAbstractNode& node) {
           /* NOTE: In case the PC register is used as the destination operand,
            * check whether there is a mode switch.
@@ -681,6 +733,38 @@ namespace triton {
         }
 
 
+        void Arm32Semantics::flag_s(triton::arch::Instruction& inst,
+                                    const triton::ast::SharedAbstractNode& cond,
+                                    const triton::engines::symbolic::SharedSymbolicExpression& parent,
+                                    triton::arch::OperandWrapper& flag,
+                                    const std::function<triton::ast::SharedAbstractNode(void)>& builder,
+                                    const std::string& comment) {
+
+          /* An unconditional instruction never selects the previous value of the flag, it can be deferred */
+          if (inst.getCodeCondition() == triton::arch::arm::ID_CONDITION_AL && this->symbolicEngine->isDeferringFlags()) {
+            auto taint = this->taintEngine->setTaint(flag, parent->isTainted);
+            inst.setConditionTaken(true);
+            this->symbolicEngine->createLazyRegisterExpression(inst, builder, flag.getConstRegister(), comment, taint);
+            return;
+          }
+
+          /* A concrete condition selects the new or the previous value of the flag without building the ite */
+          triton::ast::SharedAbstractNode node;
+          if (cond->isSymbolized() == false) {
+            node = (cond->evaluate() ? builder() : this->symbolicEngine->getOperandAst(flag));
+          }
+          else {
+            node = this->astCtxt->ite(cond, builder(), this->symbolicEngine->getOperandAst(flag));
+          }
+
+          /* Create the symbolic expression */
+          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, flag, comment);
+
+          /* Spread the taint from the parent to the child */
+          this->spreadTaint(inst, cond, expr, flag, parent->isTainted);
+        }
+
+
         void Arm32Semantics::nf_s(triton::arch::Instruction& inst,
                                   const triton::ast::SharedAbstractNode& cond,
                                   const triton::engines::symbolic::SharedSymbolicExpression& parent,
@@ -693,15 +777,12 @@ namespace triton {
            * Create the semantic, considering conditional execution.
            * nf = MSB(result)
            */
-          auto node1 = this->astCtxt->extract(high, high, this->astCtxt->reference(parent));
-          auto node2 = this->symbolicEngine->getOperandAst(nf);
-          auto node3 = this->astCtxt->ite(cond, node1, node2);
+          auto builder = [=, astCtxt = this->astCtxt]() {
+            return astCtxt->extract(high, high, astCtxt->reference(parent));
+          };
 
           /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node3, nf, "Negative flag");
-
-          /* Spread the taint from the parent to the child */
-          this->spreadTaint(inst, cond, expr, nf, parent->isTainted);
+          this->flag_s(inst, cond, parent, nf, builder, "Negative flag");
         }
 
 
@@ -719,22 +800,19 @@ namespace triton {
            * Create the semantic, considering conditional execution.
            * zf = 0 == result
            */
-          auto node1 = this->astCtxt->ite(
-                         this->astCtxt->equal(
-                           this->astCtxt->extract(high, low, this->astCtxt->reference(parent)),
-                           this->astCtxt->bv(0, bvSize)
-                         ),
-                         this->astCtxt->bv(1, 1),
-                         this->astCtxt->bv(0, 1)
-                       );
-          auto node2 = this->symbolicEngine->getOperandAst(zf);
-          auto node3 = this->astCtxt->ite(cond, node1, node2);
+          auto builder = [=, astCtxt = this->astCtxt]() {
+            return astCtxt->ite(
+                     astCtxt->equal(
+                       astCtxt->extract(high, low, astCtxt->reference(parent)),
+                       astCtxt->bv(0, bvSize)
+                     ),
+                     astCtxt->bv(1, 1),
+                     astCtxt->bv(0, 1)
+                   );
+          };
 
           /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node3, zf, "Zero flag");
-
-          /* Spread the taint from the parent to the child */
-          this->spreadTaint(inst, cond, expr, zf, parent->isTainted);
+          this->flag_s(inst, cond, parent, zf, builder, "Zero flag");
         }
 
 
@@ -754,25 +832,22 @@ namespace triton {
            * Create the semantic, considering conditional execution.
            * cf = MSB((op1 & op2) ^ ((op1 ^ op2 ^ result) & (op1 ^ op2)));
            */
-          auto node1 = this->astCtxt->extract(bvSize-1, bvSize-1,
-                         this->astCtxt->bvxor(
-                           this->astCtxt->bvand(op1, op2),
-                           this->astCtxt->bvand(
-                             this->astCtxt->bvxor(
-                               this->astCtxt->bvxor(op1, op2),
-                               this->astCtxt->extract(high, low, this->astCtxt->reference(parent))
-                             ),
-                           this->astCtxt->bvxor(op1, op2))
-                         )
-                       );
-          auto node2 = this->symbolicEngine->getOperandAst(cf);
-          auto node3 = this->astCtxt->ite(cond, node1, node2);
+          auto builder = [=, astCtxt = this->astCtxt]() {
+            return astCtxt->extract(bvSize-1, bvSize-1,
+                     astCtxt->bvxor(
+                       astCtxt->bvand(op1, op2),
+                       astCtxt->bvand(
+                         astCtxt->bvxor(
+                           astCtxt->bvxor(op1, op2),
+                           astCtxt->extract(high, low, astCtxt->reference(parent))
+                         ),
+                       astCtxt->bvxor(op1, op2))
+                     )
+                   );
+          };
 
           /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node3, cf, "Carry flag");
-
-          /* Spread the taint from the parent to the child */
-          this->spreadTaint(inst, cond, expr, cf, parent->isTainted);
+          this->flag_s(inst, cond, parent, cf, builder, "Carry flag");
         }
 
 
@@ -792,26 +867,23 @@ namespace triton {
            * Create the semantic.
            * cf = (MSB(((op1 ^ op2 ^ result) ^ ((op1 ^ result) & (op1 ^ op2))))) ^ 1
            */
-          auto node1 = this->astCtxt->bvxor(
-                         this->astCtxt->extract(bvSize-1, bvSize-1,
-                           this->astCtxt->bvxor(
-                             this->astCtxt->bvxor(op1, this->astCtxt->bvxor(op2, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))),
-                             this->astCtxt->bvand(
-                               this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent))),
-                               this->astCtxt->bvxor(op1, op2)
-                             )
-                           )
-                         ),
-                         this->astCtxt->bvtrue()
-                       );
-          auto node2 = this->symbolicEngine->getOperandAst(cf);
-          auto node3 = this->astCtxt->ite(cond, node1, node2);
+          auto builder = [=, astCtxt = this->astCtxt]() {
+            return astCtxt->bvxor(
+                     astCtxt->extract(bvSize-1, bvSize-1,
+                       astCtxt->bvxor(
+                         astCtxt->bvxor(op1, astCtxt->bvxor(op2, astCtxt->extract(high, low, astCtxt->reference(parent)))),
+                         astCtxt->bvand(
+                           astCtxt->bvxor(op1, astCtxt->extract(high, low, astCtxt->reference(parent))),
+                           astCtxt->bvxor(op1, op2)
+                         )
+                       )
+                     ),
+                     astCtxt->bvtrue()
+                   );
+          };
 
           /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node3, cf, "Carry flag");
-
-          /* Spread the taint from the parent to the child */
-          this->spreadTaint(inst, cond, expr, cf, parent->isTainted);
+          this->flag_s(inst, cond, parent, cf, builder, "Carry flag");
         }
 
 
@@ -898,20 +970,17 @@ namespace triton {
            * Create the semantic, considering conditional execution.
            * vf = MSB((op1 ^ ~op2) & (op1 ^ result))
            */
-          auto node1 = this->astCtxt->extract(bvSize-1, bvSize-1,
-                         this->astCtxt->bvand(
-                           this->astCtxt->bvxor(op1, this->astCtxt->bvnot(op2)),
-                           this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))
-                         )
-                       );
-          auto node2 = this->symbolicEngine->getOperandAst(vf);
-          auto node3 = this->astCtxt->ite(cond, node1, node2);
+          auto builder = [=, astCtxt = this->astCtxt]() {
+            return astCtxt->extract(bvSize-1, bvSize-1,
+                     astCtxt->bvand(
+                       astCtxt->bvxor(op1, astCtxt->bvnot(op2)),
+                       astCtxt->bvxor(op1, astCtxt->extract(high, low, astCtxt->reference(parent)))
+                     )
+                   );
+          };
 
           /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node3, vf, "Overflow flag");
-
-          /* Spread the taint from the parent to the child */
-          this->spreadTaint(inst, cond, expr, vf, parent->isTainted);
+          this->flag_s(inst, cond, parent, vf, builder, "Overflow flag");
         }
 
 
@@ -931,20 +1000,17 @@ namespace triton {
            * Create the semantic.
            * vf = MSB((op1 ^ op2) & (op1 ^ result))
            */
-          auto node1 = this->astCtxt->extract(bvSize-1, bvSize-1,
-                         this->astCtxt->bvand(
-                           this->astCtxt->bvxor(op1, op2),
-                           this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))
-                         )
-                       );
-          auto node2 = this->symbolicEngine->getOperandAst(vf);
-          auto node3 = this->astCtxt->ite(cond, node1, node2);
+          auto builder = [=, astCtxt = this->astCtxt]() {
+            return astCtxt->extract(bvSize-1, bvSize-1,
+                     astCtxt->bvand(
+                       astCtxt->bvxor(op1, op2),
+                       astCtxt->bvxor(op1, astCtxt->extract(high, low, astCtxt->reference(parent)))
+                     )
+                   );
+          };
 
           /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node3, vf, "Overflow flag");
-
-          /* Spread the taint from the parent to the child */
-          this->spreadTaint(inst, cond, expr, vf, parent->isTainted);
+          this->flag_s(inst, cond, parent, vf, builder, "Overflow flag");
         }
 
 
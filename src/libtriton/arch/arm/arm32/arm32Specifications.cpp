@@ -18,9 +18,15 @@ namespace triton {
     namespace arm {
       namespace arm32 {
 
-        Arm32Specifications::Arm32Specifications(triton::arch::architecture_e arch) {
+        const Arm32Specifications::RegisterTables& Arm32Specifications::getRegisterTables(triton::arch::architecture_e arch) {
           if (arch != triton::arch::ARCH_ARM32)
-              throw triton::exceptions::Architecture("ARM32Specifications::ARM32Specifications(): Invalid architecture.");
+            throw triton::exceptions::Architecture("ARM32Specifications::ARM32Specifications(): Invalid architecture.");
+
+          /* Initialized once, even if several threads create a CPU at the same time */
+          static const RegisterTables arm32Tables = [] {
+            RegisterTables tables;
+            auto& id2reg  = tables.id2reg;
+            auto& name2id = tables.name2id;
 
             // Fill id2reg and name2id with those available in Arm32 from spec
             #define REG_SPEC(UPPER_NAME, LOWER_NAME, ARM32_UPPER, ARM32_LOWER, ARM32_PARENT, MUTABLE) \
@@ -36,6 +42,23 @@ namespace triton {
             // Handle register not available in capstone as normal registers
             #define REG_SPEC_NO_CAPSTONE REG_SPEC
             #include "triton/arm32.spec"
+
+            /* Index the registers by id, the lookups of the CPU do not hash */
+            tables.id2ptr.resize(triton::arch::ID_REG_LAST_ITEM, nullptr);
+            for (const auto& kv : id2reg)
+              tables.id2ptr[kv.first] = &kv.second;
+
+            return tables;
+          }();
+
+          return arm32Tables;
+        }
+
+
+        Arm32Specifications::Arm32Specifications(triton::arch::architecture_e arch)
+          : id2reg(getRegisterTables(arch).id2reg),
+            name2id(getRegisterTables(arch).name2id),
+            id2ptr(getRegisterTables(arch).id2ptr) {
         }
 
 
@@ -27,31 +27,6 @@ namespace triton {
       }
 
 
-      ArmOperandProperties::ArmOperandProperties(const ArmOperandProperties& other) {
-        this->extendSize          = other.extendSize;
-        this->extendType          = other.extendType;
-        this->shiftType           = other.shiftType;
-        this->shiftValueImmediate = other.shiftValueImmediate;
-        this->shiftValueRegister  = other.shiftValueRegister;
-        this->subtracted          = other.subtracted;
-        this->vasType             = other.vasType;
-        this->vectorIndex         = other.vectorIndex;
-      }
-
-
-      ArmOperandProperties& ArmOperandProperties::operator=(const ArmOperandProperties& other) {
-        this->extendSize          = other.extendSize;
-        this->extendType          = other.extendType;
-        this->shiftType           = other.shiftType;
-        this->shiftValueImmediate = other.shiftValueImmediate;
-        this->shiftValueRegister  = other.shiftValueRegister;
-        this->subtracted          = other.subtracted;
-        this->vasType             = other.vasType;
-        this->vectorIndex         = other.vectorIndex;
-        return *this;
-      }
-
-
       triton::arch::arm::shift_e ArmOperandProperties::getShiftType(void) const {
         return this->shiftType;
       }
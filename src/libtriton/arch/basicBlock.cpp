@@ -5,6 +5,8 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <utility>
+
 #include <triton/exceptions.hpp>
 #include <triton/basicBlock.hpp>
 
@@ -22,28 +24,48 @@ namespace triton {
     }
 
 
+    BasicBlock::BasicBlock(std::vector<triton::arch::Instruction>&& instructions)
+      : instructions(std::move(instructions)) {
+    }
+
+
     BasicBlock::BasicBlock(const BasicBlock& other) {
       this->instructions = other.instructions;
     }
 
 
+    BasicBlock::BasicBlock(BasicBlock&& other) noexcept
+      : instructions(std::move(other.instructions)) {
+    }
+
+
     BasicBlock& BasicBlock::operator=(const BasicBlock& other) {
       this->instructions = other.instructions;
       return *this;
     }
 
 
+    BasicBlock& BasicBlock::operator=(BasicBlock&& other) noexcept {
+      this->instructions = std::move(other.instructions);
+      return *this;
+    }
+
+
     BasicBlock::~BasicBlock() {
       this->instructions.clear();
     }
 
 
     void BasicBlock::add(const Instruction& instruction) {
-      Instruction copy = instruction;
+      this->add(Instruction(instruction));
+    }
+
+
+    void BasicBlock::add(Instruction&& instruction) {
       if (this->instructions.size()) {
-        copy.setAddress(this->instructions.back().getNextAddress());
+        instruction.setAddress(this->instructions.back().getNextAddress());
       }
-      this->instructions.push_back(copy);
+      this->instructions.push_back(std::move(instruction));
     }
 
 
@@ -25,12 +25,6 @@ namespace triton {
     }
 
 
-    BitsVector::BitsVector(const BitsVector &other) {
-      this->high = other.high;
-      this->low  = other.low;
-    }
-
-
     triton::uint32 BitsVector::getHigh(void) const {
       return this->high;
     }
@@ -81,13 +75,6 @@ namespace triton {
     }
 
 
-    BitsVector& BitsVector::operator=(const BitsVector& other) {
-      this->high = other.high;
-      this->low  = other.low;
-      return *this;
-    }
-
-
     std::ostream& operator<<(std::ostream& stream, const BitsVector& bv) {
       stream << "bv[" << bv.getHigh() << ".." << bv.getLow() << "]";
       return stream;
@@ -0,0 +1,372 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+
+#include <triton/aarch64Specifications.hpp>
+#include <triton/arm32Specifications.hpp>
+#include <triton/concreteMemo.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/x86Specifications.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    ConcreteMemo::ConcreteMemo(triton::arch::Architecture* architecture,
+                               const triton::modes::SharedModes& modes,
+                               triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                               triton::engines::taint::TaintEngine* taintEngine)
+      : modes(modes) {
+      this->architecture   = architecture;
+      this->symbolicEngine = symbolicEngine;
+      this->taintEngine    = taintEngine;
+      this->enabled        = false;
+      this->found          = nullptr;
+    }
+
+
+    void ConcreteMemo::enable(bool flag, triton::usize capacity) {
+      if (flag && capacity == 0)
+        throw triton::exceptions::IrBuilder("ConcreteMemo::enable(): The capacity must not be null.");
+
+      this->enabled = flag;
+      this->clear();
+      this->stats.capacity = flag ? capacity : 0;
+    }
+
+
+    bool ConcreteMemo::isEnabled(void) const {
+      return this->enabled;
+    }
+
+
+    bool ConcreteMemo::isMemoizable(const triton::arch::Instruction& inst) const {
+      /* Branches add path constraints, and a fault has no output to replay */
+      if (inst.isControlFlow() || inst.isBranch() || inst.getSize() == 0 || inst.getSize() > sizeof(Entry::opcode))
+        return false;
+
+      /* Instructions reading a state outside of the registers and memory cells, or changing it */
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_X86:
+        case triton::arch::ARCH_X86_64:
+          switch (inst.getType()) {
+            case triton::arch::x86::ID_INS_INVALID:
+            case triton::arch::x86::ID_INS_HLT:
+            case triton::arch::x86::ID_INS_INT:
+            case triton::arch::x86::ID_INS_INT3:
+            case triton::arch::x86::ID_INS_RDRAND:
+            case triton::arch::x86::ID_INS_RDSEED:
+            case triton::arch::x86::ID_INS_RDTSC:
+            case triton::arch::x86::ID_INS_RDTSCP:
+            case triton::arch::x86::ID_INS_SYSCALL:
+            case triton::arch::x86::ID_INS_SYSENTER:
+            case triton::arch::x86::ID_INS_UD2:
+              return false;
+            default:
+              return true;
+          }
+
+        case triton::arch::ARCH_AARCH64:
+          switch (inst.getType()) {
+            case triton::arch::arm::aarch64::ID_INS_INVALID:
+            case triton::arch::arm::aarch64::ID_INS_BRK:
+            case triton::arch::arm::aarch64::ID_INS_CLREX:
+            case triton::arch::arm::aarch64::ID_INS_HLT:
+            case triton::arch::arm::aarch64::ID_INS_LDAXP:
+            case triton::arch::arm::aarch64::ID_INS_LDAXR:
+            case triton::arch::arm::aarch64::ID_INS_LDAXRB:
+            case triton::arch::arm::aarch64::ID_INS_LDAXRH:
+            case triton::arch::arm::aarch64::ID_INS_LDXP:
+            case triton::arch::arm::aarch64::ID_INS_LDXR:
+            case triton::arch::arm::aarch64::ID_INS_LDXRB:
+            case triton::arch::arm::aarch64::ID_INS_LDXRH:
+            case triton::arch::arm::aarch64::ID_INS_STLXP:
+            case triton::arch::arm::aarch64::ID_INS_STLXR:
+            case triton::arch::arm::aarch64::ID_INS_STLXRB:
+            case triton::arch::arm::aarch64::ID_INS_STLXRH:
+            case triton::arch::arm::aarch64::ID_INS_STXP:
+            case triton::arch::arm::aarch64::ID_INS_STXR:
+            case triton::arch::arm::aarch64::ID_INS_STXRB:
+            case triton::arch::arm::aarch64::ID_INS_STXRH:
+            case triton::arch::arm::aarch64::ID_INS_SVC:
+              return false;
+            default:
+              return true;
+          }
+
+        case triton::arch::ARCH_ARM32:
+          switch (inst.getType()) {
+            case triton::arch::arm::arm32::ID_INS_INVALID:
+            case triton::arch::arm::arm32::ID_INS_CLREX:
+            case triton::arch::arm::arm32::ID_INS_LDREX:
+            case triton::arch::arm::arm32::ID_INS_LDREXB:
+            case triton::arch::arm::arm32::ID_INS_LDREXD:
+            case triton::arch::arm::arm32::ID_INS_LDREXH:
+            case triton::arch::arm::arm32::ID_INS_STREX:
+            case triton::arch::arm::arm32::ID_INS_STREXB:
+            case triton::arch::arm::arm32::ID_INS_STREXD:
+            case triton::arch::arm::arm32::ID_INS_STREXH:
+            case triton::arch::arm::arm32::ID_INS_SVC:
+              return false;
+            default:
+              return true;
+          }
+
+        default:
+          return false;
+      }
+    }
+
+
+    void ConcreteMemo::prepare(const triton::arch::Instruction& inst) {
+      this->prepared.clear();
+
+      auto keep = [this](const triton::arch::Register& reg) {
+        if (this->architecture->isRegisterValid(reg))
+          this->prepared.push_back(std::make_pair(reg, this->architecture->getConcreteRegisterValue(reg)));
+      };
+
+      for (const auto& operand : inst.operands) {
+        switch (operand.getType()) {
+          case triton::arch::OP_REG:
+            keep(this->architecture->getParentRegister(operand.getConstRegister()));
+            break;
+
+          case triton::arch::OP_MEM: {
+            const triton::arch::MemoryAccess& mem = operand.getConstMemory();
+            keep(mem.getConstBaseRegister());
+            keep(mem.getConstIndexRegister());
+            keep(mem.getConstSegmentRegister());
+            break;
+          }
+
+          default:
+            break;
+        }
+      }
+    }
+
+
+    const triton::uint512* ConcreteMemo::getPrepared(const triton::arch::Register& reg) const {
+      for (const auto& item : this->prepared) {
+        if (item.first.getId() == reg.getId())
+          return &item.second;
+      }
+      return nullptr;
+    }
+
+
+    ConcreteMemo::Entry* ConcreteMemo::getEntry(const triton::arch::Instruction& inst) {
+      auto it = this->entries.find(inst.getAddress());
+      if (it == this->entries.end())
+        return nullptr;
+
+      const Entry& entry = it->second;
+      if (entry.size != inst.getSize() || std::memcmp(entry.opcode, inst.getOpcode(), entry.size) != 0)
+        return nullptr;
+
+      /* The condition of an instruction of an IT block is not part of its opcode */
+      if (entry.codeCondition != inst.getCodeCondition() || entry.thumb != inst.isThumb())
+        return nullptr;
+
+      return &it->second;
+    }
+
+
+    bool ConcreteMemo::matches(const Execution& execution) const {
+      for (const auto* registers : {&execution.reads, &execution.operands}) {
+        for (const auto& item : *registers) {
+          if (this->architecture->getConcreteRegisterValue(item.first) != item.second)
+            return false;
+        }
+      }
+
+      for (const auto& item : execution.loads) {
+        if (this->architecture->getConcreteMemoryValue(item.first) != item.second)
+          return false;
+      }
+
+      /* Same values, but they must still be concrete */
+      for (const auto* registers : {&execution.reads, &execution.operands}) {
+        for (const auto& item : *registers) {
+          if (this->symbolicEngine->isRegisterSymbolized(item.first) || this->taintEngine->isRegisterTainted(item.first))
+            return false;
+        }
+      }
+
+      for (const auto& item : execution.loads) {
+        if (this->symbolicEngine->isMemorySymbolized(item.first) || this->taintEngine->isMemoryTainted(item.first))
+          return false;
+      }
+
+      return true;
+    }
+
+
+    bool ConcreteMemo::lookup(const triton::arch::Instruction& inst) {
+      this->found = nullptr;
+
+      const Entry* entry = this->getEntry(inst);
+      if (entry != nullptr) {
+        for (const auto& execution : entry->executions) {
+          if (this->matches(execution)) {
+            this->found = &execution;
+            this->stats.hits++;
+            return true;
+          }
+        }
+      }
+
+      this->stats.misses++;
+      return false;
+    }
+
+
+    void ConcreteMemo::replay(triton::arch::Instruction& inst) {
+      if (this->found == nullptr)
+        throw triton::exceptions::IrBuilder("ConcreteMemo::replay(): No execution has been found.");
+
+      const Execution& execution = *this->found;
+      this->found = nullptr;
+
+      for (const auto& item : execution.reads)
+        inst.setReadRegister(item.first, nullptr);
+
+      for (const auto& item : execution.loads)
+        inst.setLoadAccess(item.first, nullptr);
+
+      for (const auto& item : execution.outputs) {
+        const triton::arch::Register& parent = this->architecture->getParentRegister(item.first);
+
+        this->architecture->setConcreteRegisterValue(item.first, item.second);
+        this->symbolicEngine->concretizeRegister(parent);
+        this->taintEngine->setTaintRegister(parent, triton::engines::taint::UNTAINTED);
+        inst.setWrittenRegister(item.first, nullptr);
+      }
+
+      for (const auto& item : execution.stores) {
+        const triton::arch::MemoryAccess& mem = item.first;
+
+        this->architecture->setConcreteMemoryValue(mem, item.second);
+        for (triton::uint32 index = 0; index < mem.getSize(); index++) {
+          if (this->symbolicEngine->getSymbolicMemory(mem.getAddress() + index)) {
+            this->symbolicEngine->concretizeMemory(mem);
+            break;
+          }
+        }
+        this->taintEngine->setTaintMemory(mem, triton::engines::taint::UNTAINTED);
+        inst.setStoreAccess(mem, nullptr);
+      }
+
+      /* Same as the undefined registers of the semantics */
+      for (const auto& reg : execution.undefined) {
+        if (this->modes->isModeEnabled(triton::modes::CONCRETIZE_UNDEFINED_REGISTERS)) {
+          this->symbolicEngine->concretizeRegister(reg);
+        }
+        inst.setUndefinedRegister(reg);
+        this->taintEngine->setTaintRegister(reg, triton::engines::taint::UNTAINTED);
+      }
+    }
+
+
+    void ConcreteMemo::record(triton::arch::Instruction& inst) {
+      Execution execution;
+
+      /* The nodes hold the values read */
+      for (const auto& item : inst.getReadRegisters()) {
+        if (item.second == nullptr)
+          return;
+        execution.reads.push_back(std::make_pair(item.first, item.second->evaluate()));
+      }
+
+      for (const auto& item : inst.getLoadAccess()) {
+        if (item.second == nullptr)
+          return;
+        triton::arch::MemoryAccess mem = item.first;
+        mem.setLeaAst(nullptr);
+        execution.loads.push_back(std::make_pair(mem, item.second->evaluate()));
+      }
+
+      execution.operands = this->prepared;
+
+      for (const auto& item : inst.getWrittenRegisters()) {
+        const triton::arch::Register& parent = this->architecture->getParentRegister(item.first);
+
+        if (item.first.isMutable() == false)
+          continue;
+
+        /* The bits of a sub-register parent which are not written come from its previous value */
+        if (item.first.getBitSize() < parent.getBitSize() && this->architecture->isFlag(item.first) == false) {
+          if (this->getPrepared(parent) == nullptr)
+            return;
+          execution.outputs.push_back(std::make_pair(parent, this->architecture->getConcreteRegisterValue(parent, false)));
+        }
+        else {
+          execution.outputs.push_back(std::make_pair(item.first, this->architecture->getConcreteRegisterValue(item.first, false)));
+        }
+      }
+
+      for (const auto& item : inst.getStoreAccess()) {
+        triton::arch::MemoryAccess mem = item.first;
+        mem.setLeaAst(nullptr);
+        execution.stores.push_back(std::make_pair(mem, this->architecture->getConcreteMemoryValue(mem, false)));
+      }
+
+      execution.undefined.assign(inst.getUndefinedRegisters().begin(), inst.getUndefinedRegisters().end());
+
+      /* A full memo is flushed, keeping the executions of the working set */
+      if (this->stats.size >= this->stats.capacity) {
+        this->entries.clear();
+        this->stats.size = 0;
+        this->stats.flushes++;
+      }
+
+      Entry* entry = this->getEntry(inst);
+      if (entry == nullptr) {
+        entry = &this->entries[inst.getAddress()];
+        this->stats.size -= entry->executions.size();
+
+        std::memcpy(entry->opcode, inst.getOpcode(), inst.getSize());
+        entry->size          = inst.getSize();
+        entry->codeCondition = inst.getCodeCondition();
+        entry->thumb         = inst.isThumb();
+        entry->next          = 0;
+        entry->executions.clear();
+      }
+
+      if (entry->executions.size() < ConcreteMemo::maxExecutions) {
+        entry->executions.push_back(std::move(execution));
+        this->stats.size++;
+      }
+      else {
+        entry->executions[entry->next] = std::move(execution);
+        entry->next = (entry->next + 1) % ConcreteMemo::maxExecutions;
+      }
+
+      this->stats.records++;
+    }
+
+
+    ConcreteMemoStats ConcreteMemo::getStats(void) const {
+      return this->stats;
+    }
+
+
+    void ConcreteMemo::clear(void) {
+      triton::usize capacity = this->stats.capacity;
+
+      this->entries.clear();
+      this->prepared.clear();
+      this->found = nullptr;
+      this->stats = ConcreteMemoStats();
+      this->stats.capacity = capacity;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -0,0 +1,683 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <vector>
+
+#include <triton/concreteMemory.hpp>
+#include <triton/coreUtils.hpp>
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/memoryResource.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    /* Returns the mask of `count` bits starting at `bit` in a 64-bit word */
+    static inline triton::uint64 bitmapMask(triton::usize bit, triton::usize count) {
+      if (count >= 64)
+        return ~static_cast<triton::uint64>(0);
+      return ((static_cast<triton::uint64>(1) << count) - 1) << bit;
+    }
+
+
+    /* Returns the number of bits set in a 64-bit word */
+    static inline triton::usize bitmapCount(triton::uint64 word) {
+      return std::bitset<64>(word).count();
+    }
+
+
+    /* Calls `fn(pn)` for each allocated page whose number is between `first` and `last` (included) */
+    template <typename F>
+    static void forEachPage(const ConcreteMemory::PageMap& pages, triton::uint64 first, triton::uint64 last, F fn) {
+      /* Look up page numbers if there are less of them than allocated pages */
+      if (last - first < pages.size()) {
+        for (triton::uint64 pn = first;; pn++) {
+          if (pages.find(pn) != pages.end())
+            fn(pn);
+          if (pn == last)
+            break;
+        }
+      }
+      else {
+        for (const auto& it : pages) {
+          if (it.first >= first && it.first <= last)
+            fn(it.first);
+        }
+      }
+    }
+
+
+    /* Calls `fn(addr, region, offset, size)` for each part of a region between `addr` and `last` (included) */
+    template <typename F>
+    static void forEachRegion(const ConcreteMemory::RegionMap& regions, triton::uint64 addr, triton::uint64 last, F fn) {
+      auto it = regions.upper_bound(addr);
+      if (it != regions.begin())
+        it--;
+
+      for (; it != regions.end() && it->first <= last; it++) {
+        triton::uint64 rlast = it->first + (it->second.size - 1);
+        if (rlast < addr)
+          continue;
+        triton::uint64 start = std::max(addr, it->first);
+        triton::uint64 end   = std::min(last, rlast);
+        fn(start, it->second, static_cast<triton::usize>(start - it->first), static_cast<triton::usize>(end - start + 1));
+      }
+    }
+
+
+    ConcreteMemory::Page::Page() {
+      std::memset(this->data, 0x00, sizeof(this->data));
+      std::memset(this->defined, 0x00, sizeof(this->defined));
+      this->count = 0;
+    }
+
+
+    ConcreteMemory::const_iterator::const_iterator(const ConcreteMemory* memory, bool end) {
+      this->memory = memory;
+      this->page   = end ? memory->pages->end() : memory->pages->begin();
+      this->offset = 0;
+      this->region = end ? memory->regions->end() : memory->regions->begin();
+      this->delta  = 0;
+      this->seek();
+    }
+
+
+    void ConcreteMemory::const_iterator::seek(void) {
+      while (this->page != this->memory->pages->end()) {
+        const Page* p = this->page->second.get();
+        while (this->offset < pageSize) {
+          triton::uint64 word = p->defined[this->offset / 64] >> (this->offset % 64);
+          if (word & 1)
+            return;
+          /* Skip the whole word if there is no more bit set */
+          if (word == 0)
+            this->offset = (this->offset / 64 + 1) * 64;
+          else
+            this->offset++;
+        }
+        this->offset = 0;
+        this->page++;
+      }
+
+      /* Then visit the bytes of regions which are not shadowed by a page */
+      while (this->region != this->memory->regions->end()) {
+        while (this->delta < this->region->second.size) {
+          triton::uint64 addr = this->region->first + this->delta;
+          if (this->memory->getPage(addr) == nullptr)
+            return;
+          this->delta += std::min(pageSize - ConcreteMemory::pageOffset(addr), this->region->second.size - this->delta);
+        }
+        this->delta = 0;
+        this->region++;
+      }
+    }
+
+
+    ConcreteMemory::const_iterator::value_type ConcreteMemory::const_iterator::operator*(void) const {
+      if (this->page != this->memory->pages->end()) {
+        triton::uint64 addr = this->page->first * pageSize + this->offset;
+        return std::make_pair(addr, this->page->second->data[this->offset]);
+      }
+      const Region& region = this->region->second;
+      return std::make_pair(this->region->first + this->delta, region.data ? region.data[this->delta] : static_cast<triton::uint8>(0x00));
+    }
+
+
+    ConcreteMemory::const_iterator& ConcreteMemory::const_iterator::operator++(void) {
+      if (this->page != this->memory->pages->end())
+        this->offset++;
+      else
+        this->delta++;
+      this->seek();
+      return *this;
+    }
+
+
+    ConcreteMemory::const_iterator ConcreteMemory::const_iterator::operator++(int) {
+      const_iterator old = *this;
+      ++(*this);
+      return old;
+    }
+
+
+    bool ConcreteMemory::const_iterator::operator==(const const_iterator& other) const {
+      return this->page == other.page && this->offset == other.offset && this->region == other.region && this->delta == other.delta;
+    }
+
+
+    bool ConcreteMemory::const_iterator::operator!=(const const_iterator& other) const {
+      return !(*this == other);
+    }
+
+
+    ConcreteMemory::ConcreteMemory() {
+      this->definedBytes = 0;
+      this->regionBytes  = 0;
+      this->resource     = nullptr;
+      this->tracking     = false;
+      this->untracked    = false;
+    }
+
+
+    ConcreteMemory::ConcreteMemory(const ConcreteMemory& other)
+      : ConcreteMemory() {
+      *this = other;
+    }
+
+
+    ConcreteMemory& ConcreteMemory::operator=(const ConcreteMemory& other) {
+      if (this == &other)
+        return *this;
+
+      this->pages        = other.pages;
+      this->regions      = other.regions;
+      this->touchedPages = other.touchedPages;
+      this->definedBytes = other.definedBytes;
+      this->regionBytes  = other.regionBytes;
+      this->resource     = other.resource;
+      this->untracked    = this->tracking;
+
+      return *this;
+    }
+
+
+    void ConcreteMemory::swap(ConcreteMemory& other) {
+      std::swap(this->pages,        other.pages);
+      std::swap(this->regions,      other.regions);
+      std::swap(this->touchedPages, other.touchedPages);
+      std::swap(this->definedBytes, other.definedBytes);
+      std::swap(this->regionBytes,  other.regionBytes);
+      std::swap(this->resource,     other.resource);
+      std::swap(this->tracking,     other.tracking);
+      std::swap(this->untracked,    other.untracked);
+      this->changedPages.swap(other.changedPages);
+    }
+
+
+    const ConcreteMemory::Page* ConcreteMemory::getPage(triton::uint64 addr) const {
+      auto it = this->pages->find(ConcreteMemory::pageNumber(addr));
+      if (it == this->pages->end())
+        return nullptr;
+      return it->second.get();
+    }
+
+
+    ConcreteMemory::Page* ConcreteMemory::getOrCreatePage(triton::uint64 addr) {
+      triton::uint64 pn           = ConcreteMemory::pageNumber(addr);
+      std::shared_ptr<Page>& page = this->pages.mutate()[pn];
+      this->markChanged(pn);
+      if (page == nullptr) {
+        page = triton::utils::allocateShared<Page>(this->resource);
+        this->fillPage(pn, page.get());
+      }
+      return this->getWritablePage(page);
+    }
+
+
+    ConcreteMemory::Page* ConcreteMemory::getWritablePage(std::shared_ptr<Page>& page) {
+      if (page.use_count() > 1)
+        page = triton::utils::allocateShared<Page>(this->resource, *page);
+      return page.get();
+    }
+
+
+    void ConcreteMemory::fillPage(triton::uint64 pn, Page* page) {
+      if (this->regions->empty())
+        return;
+
+      triton::uint64 base = pn * pageSize;
+      forEachRegion(*this->regions, base, base + (pageSize - 1), [&](triton::uint64 addr, const Region& region, triton::usize offset, triton::usize size) {
+        triton::usize start = static_cast<triton::usize>(addr - base);
+        if (region.data)
+          std::memcpy(page->data + start, region.data + offset, size);
+        for (triton::usize bit = start; bit < start + size;) {
+          triton::usize n = std::min(64 - (bit % 64), start + size - bit);
+          page->defined[bit / 64] |= bitmapMask(bit % 64, n);
+          bit += n;
+        }
+        page->count        += size;
+        this->definedBytes += size;
+        this->regionBytes  -= size;
+      });
+    }
+
+
+    triton::usize ConcreteMemory::getRegionBytes(triton::uint64 addr, triton::uint64 last) const {
+      triton::usize count = 0;
+      forEachRegion(*this->regions, addr, last, [&](triton::uint64, const Region&, triton::usize, triton::usize size) {
+        count += size;
+      });
+      return count;
+    }
+
+
+    triton::usize ConcreteMemory::getShadowedBytes(triton::uint64 addr, triton::uint64 last) const {
+      triton::usize count = 0;
+      forEachPage(*this->pages, ConcreteMemory::pageNumber(addr), ConcreteMemory::pageNumber(last), [&](triton::uint64 pn) {
+        triton::uint64 base = pn * pageSize;
+        count += this->getRegionBytes(std::max(addr, base), std::min(last, base + (pageSize - 1)));
+      });
+      return count;
+    }
+
+
+    void ConcreteMemory::readRegions(triton::uint64 addr, triton::uint8* dst, triton::usize size) const {
+      std::memset(dst, 0x00, size);
+      forEachRegion(*this->regions, addr, addr + (size - 1), [&](triton::uint64 start, const Region& region, triton::usize offset, triton::usize n) {
+        if (region.data)
+          std::memcpy(dst + (start - addr), region.data + offset, n);
+      });
+    }
+
+
+    void ConcreteMemory::unmapRegions(triton::uint64 addr, triton::uint64 last) {
+      triton::usize count = this->getRegionBytes(addr, last);
+      if (count == 0)
+        return;
+
+      this->untracked    = this->tracking;
+      this->regionBytes -= count - this->getShadowedBytes(addr, last);
+
+      std::vector<std::pair<triton::uint64, Region>> removed;
+      forEachRegion(*this->regions, addr, last, [&](triton::uint64 start, const Region& region, triton::usize offset, triton::usize) {
+        removed.emplace_back(start - offset, region);
+      });
+
+      RegionMap& regions = this->regions.mutate();
+      for (const auto& it : removed) {
+        const Region& region = it.second;
+        triton::uint64 rlast = it.first + (region.size - 1);
+
+        regions.erase(it.first);
+
+        /* Keep the parts of the region which are outside of the area */
+        if (it.first < addr)
+          regions[it.first] = Region{region.data, static_cast<triton::usize>(addr - it.first), region.owner};
+        if (rlast > last) {
+          triton::usize skip = static_cast<triton::usize>(last + 1 - it.first);
+          regions[last + 1]  = Region{region.data ? region.data + skip : nullptr, region.size - skip, region.owner};
+        }
+      }
+    }
+
+
+    triton::uint8 ConcreteMemory::read(triton::uint64 addr) const {
+      const Page* page = this->getPage(addr);
+      if (page == nullptr) {
+        triton::uint8 value = 0x00;
+        if (!this->regions->empty())
+          this->readRegions(addr, &value, 1);
+        return value;
+      }
+      return page->data[ConcreteMemory::pageOffset(addr)];
+    }
+
+
+    void ConcreteMemory::read(triton::uint64 addr, triton::uint8* dst, triton::usize size) const {
+      while (size) {
+        triton::usize offset = ConcreteMemory::pageOffset(addr);
+        triton::usize chunk  = std::min(size, pageSize - offset);
+        const Page* page     = this->getPage(addr);
+
+        if (page == nullptr)
+          this->readRegions(addr, dst, chunk);
+        else
+          std::memcpy(dst, page->data + offset, chunk);
+
+        dst  += chunk;
+        addr += chunk;
+        size -= chunk;
+      }
+    }
+
+
+    triton::uint512 ConcreteMemory::readValue(triton::uint64 addr, triton::uint32 size) const {
+      triton::uint8 buffer[triton::size::dqqword] = {0};
+
+      if (size > triton::size::dqqword)
+        throw triton::exceptions::Architecture("ConcreteMemory::readValue(): Invalid size memory.");
+
+      this->read(addr, buffer, size);
+
+      /* Fast path for loads which fit in a 64-bit word */
+      if (size <= triton::size::qword) {
+        triton::uint64 value = 0;
+        for (triton::uint32 i = size; i > 0; i--)
+          value = (value << triton::bitsize::byte) | buffer[i - 1];
+        return value;
+      }
+
+      return triton::utils::cast<triton::uint512>(buffer);
+    }
+
+
+    void ConcreteMemory::write(triton::uint64 addr, triton::uint8 value) {
+      Page* page           = this->getOrCreatePage(addr);
+      triton::usize offset = ConcreteMemory::pageOffset(addr);
+      triton::uint64 mask  = static_cast<triton::uint64>(1) << (offset % 64);
+
+      if ((page->defined[offset / 64] & mask) == 0) {
+        page->defined[offset / 64] |= mask;
+        page->count++;
+        this->definedBytes++;
+      }
+
+      page->data[offset] = value;
+    }
+
+
+    void ConcreteMemory::write(triton::uint64 addr, const triton::uint8* src, triton::usize size) {
+      while (size) {
+        triton::usize offset = ConcreteMemory::pageOffset(addr);
+        triton::usize chunk  = std::min(size, pageSize - offset);
+        Page* page           = this->getOrCreatePage(addr);
+
+        std::memcpy(page->data + offset, src, chunk);
+
+        /* Mark bytes as defined */
+        for (triton::usize bit = offset; bit < offset + chunk;) {
+          triton::usize n     = std::min(64 - (bit % 64), offset + chunk - bit);
+          triton::uint64 mask = bitmapMask(bit % 64, n);
+          triton::usize added = bitmapCount(mask & ~page->defined[bit / 64]);
+          page->defined[bit / 64] |= mask;
+          page->count        += added;
+          this->definedBytes += added;
+          bit += n;
+        }
+
+        src  += chunk;
+        addr += chunk;
+        size -= chunk;
+      }
+    }
+
+
+    void ConcreteMemory::writeValue(triton::uint64 addr, const triton::uint512& value, triton::uint32 size) {
+      triton::uint8 buffer[triton::size::dqqword];
+
+      if (size > triton::size::dqqword)
+        throw triton::exceptions::Architecture("ConcreteMemory::writeValue(): Invalid size memory.");
+
+      /* Fast path for stores which fit in a 64-bit word */
+      if (size <= triton::size::qword) {
+        triton::uint64 cv = static_cast<triton::uint64>(value);
+        for (triton::uint32 i = 0; i < size; i++) {
+          buffer[i] = static_cast<triton::uint8>(cv & 0xff);
+          cv >>= triton::bitsize::byte;
+        }
+      }
+      else {
+        triton::utils::fromUintToBuffer(value, buffer);
+      }
+
+      this->write(addr, buffer, size);
+    }
+
+
+    void ConcreteMemory::map(triton::uint64 addr, const triton::uint8* data, triton::usize size, const std::shared_ptr<const void>& owner) {
+      if (size == 0)
+        return;
+
+      triton::uint64 last = addr + (size - 1);
+      if (last < addr)
+        throw triton::exceptions::Architecture("ConcreteMemory::map(): The region wraps around the address space.");
+
+      this->unmapRegions(addr, last);
+
+      /* Release the pages which are fully covered by the region */
+      triton::uint64 first = ConcreteMemory::pageNumber(addr) + (ConcreteMemory::pageOffset(addr) != 0);
+      triton::uint64 next  = ConcreteMemory::pageNumber(last) + (ConcreteMemory::pageOffset(last) == pageSize - 1);
+
+      if (first < next) {
+        std::vector<triton::uint64> released;
+        forEachPage(*this->pages, first, next - 1, [&](triton::uint64 pn) {
+          released.push_back(pn);
+        });
+        if (!released.empty()) {
+          PageMap& pages = this->pages.mutate();
+          for (triton::uint64 pn : released) {
+            this->markChanged(pn);
+            this->definedBytes -= pages[pn]->count;
+            pages.erase(pn);
+          }
+        }
+      }
+
+      /* Pages partially covered by the region shadow it, so they hold its bytes */
+      triton::usize shadowed = 0;
+      forEachPage(*this->pages, ConcreteMemory::pageNumber(addr), ConcreteMemory::pageNumber(last), [&](triton::uint64 pn) {
+        triton::uint64 start = std::max(addr, pn * pageSize);
+        triton::usize n      = static_cast<triton::usize>(std::min(last, pn * pageSize + (pageSize - 1)) - start + 1);
+        shadowed += n;
+        if (data) {
+          this->write(start, data + (start - addr), n);
+        }
+        else {
+          static const triton::uint8 zeros[pageSize] = {};
+          this->write(start, zeros, n);
+        }
+      });
+
+      this->regions.mutate()[addr] = Region{data, size, owner};
+      this->regionBytes += size - shadowed;
+      this->untracked    = this->tracking;
+    }
+
+
+    bool ConcreteMemory::isDefined(triton::uint64 addr, triton::usize size) const {
+      while (size) {
+        triton::usize offset = ConcreteMemory::pageOffset(addr);
+        triton::usize chunk  = std::min(size, pageSize - offset);
+        const Page* page     = this->getPage(addr);
+
+        if (page == nullptr) {
+          if (this->getRegionBytes(addr, addr + (chunk - 1)) != chunk)
+            return false;
+          addr += chunk;
+          size -= chunk;
+          continue;
+        }
+
+        for (triton::usize bit = offset; bit < offset + chunk;) {
+          triton::usize n     = std::min(64 - (bit % 64), offset + chunk - bit);
+          triton::uint64 mask = bitmapMask(bit % 64, n);
+          if ((page->defined[bit / 64] & mask) != mask)
+            return false;
+          bit += n;
+        }
+
+        addr += chunk;
+        size -= chunk;
+      }
+      return true;
+    }
+
+
+    std::vector<triton::uint64> ConcreteMemory::touchUndefinedPages(triton::uint64 addr, triton::usize size) const {
+      std::vector<triton::uint64> ret;
+
+      if (size == 0)
+        return ret;
+
+      triton::uint64 last = addr + (size - 1);
+      if (last < addr)
+        last = ~static_cast<triton::uint64>(0);
+
+      for (triton::uint64 pn = ConcreteMemory::pageNumber(addr); pn <= ConcreteMemory::pageNumber(last); pn++) {
+        triton::uint64 base = pn * pageSize;
+        if (this->pages->find(pn) == this->pages->end() &&
+            this->touchedPages->find(pn) == this->touchedPages->end() &&
+            this->getRegionBytes(base, base + (pageSize - 1)) == 0) {
+          this->touchedPages.mutate().insert(pn);
+          ret.push_back(base);
+        }
+        if (pn == ConcreteMemory::pageNumber(~static_cast<triton::uint64>(0)))
+          break;
+      }
+
+      return ret;
+    }
+
+
+    void ConcreteMemory::clear(triton::uint64 addr, triton::usize size) {
+      if (size == 0)
+        return;
+
+      if (!this->regions->empty()) {
+        triton::uint64 last = addr + (size - 1);
+        this->unmapRegions(addr, last < addr ? ~static_cast<triton::uint64>(0) : last);
+      }
+
+      while (size) {
+        triton::usize offset = ConcreteMemory::pageOffset(addr);
+        triton::usize chunk  = std::min(size, pageSize - offset);
+
+        if (this->getPage(addr) != nullptr) {
+          PageMap& pages = this->pages.mutate();
+          auto it        = pages.find(ConcreteMemory::pageNumber(addr));
+          Page* page     = this->getWritablePage(it->second);
+
+          this->markChanged(it->first);
+
+          /* Undefined bytes must be read as 0 */
+          std::memset(page->data + offset, 0x00, chunk);
+
+          for (triton::usize bit = offset; bit < offset + chunk;) {
+            triton::usize n       = std::min(64 - (bit % 64), offset + chunk - bit);
+            triton::uint64 mask   = bitmapMask(bit % 64, n);
+            triton::usize removed = bitmapCount(mask & page->defined[bit / 64]);
+            page->defined[bit / 64] &= ~mask;
+            page->count        -= removed;
+            this->definedBytes -= removed;
+            bit += n;
+          }
+
+          if (page->count == 0)
+            pages.erase(it);
+        }
+
+        addr += chunk;
+        size -= chunk;
+      }
+    }
+
+
+    void ConcreteMemory::clear(void) {
+      this->pages.clear();
+      this->regions.clear();
+      this->touchedPages.clear();
+      this->definedBytes = 0;
+      this->regionBytes  = 0;
+      this->untracked    = this->tracking;
+    }
+
+
+    void ConcreteMemory::setMemoryResource(std::pmr::memory_resource* resource) {
+      this->resource = resource;
+    }
+
+
+    triton::usize ConcreteMemory::size(void) const {
+      return this->definedBytes + this->regionBytes;
+    }
+
+
+    bool ConcreteMemory::empty(void) const {
+      return this->size() == 0;
+    }
+
+
+    triton::usize ConcreteMemory::getNumberOfPages(void) const {
+      return this->pages->size();
+    }
+
+
+    void ConcreteMemory::trackChanges(bool flag) {
+      this->tracking  = flag;
+      this->untracked = false;
+      this->changedPages.clear();
+    }
+
+
+    bool ConcreteMemory::isTrackingChanges(void) const {
+      return this->tracking;
+    }
+
+
+    triton::usize ConcreteMemory::getNumberOfChangedPages(void) const {
+      return this->changedPages.size();
+    }
+
+
+    bool ConcreteMemory::restoreChanges(const ConcreteMemory& base) {
+      if (!this->tracking || this->untracked)
+        return false;
+
+      if (!this->changedPages.empty()) {
+        PageMap& pages = this->pages.mutate();
+
+        for (triton::uint64 pn : this->changedPages) {
+          auto cur  = pages.find(pn);
+          auto from = base.pages->find(pn);
+          bool had  = (cur != pages.end());
+          bool has  = (from != base.pages->end());
+
+          /* The regions are the same on both sides, only their shadowing by a page differs */
+          if (had != has && !this->regions->empty()) {
+            triton::uint64 start = pn * pageSize;
+            triton::usize bytes  = this->getRegionBytes(start, start + (pageSize - 1));
+            if (had) this->regionBytes += bytes;
+            else     this->regionBytes -= bytes;
+          }
+
+          if (had) {
+            this->definedBytes -= cur->second->count;
+            if (has) cur->second = from->second;
+            else     pages.erase(cur);
+          }
+          else if (has) {
+            pages.emplace(pn, from->second);
+          }
+
+          if (has)
+            this->definedBytes += from->second->count;
+        }
+      }
+
+      this->touchedPages = base.touchedPages;
+      this->changedPages.clear();
+
+      return true;
+    }
+
+
+    const ConcreteMemory::PageMap& ConcreteMemory::getPages(void) const {
+      return this->pages.get();
+    }
+
+
+    const ConcreteMemory::RegionMap& ConcreteMemory::getRegions(void) const {
+      return this->regions.get();
+    }
+
+
+    ConcreteMemory::const_iterator ConcreteMemory::begin(void) const {
+      return const_iterator(this, false);
+    }
+
+
+    ConcreteMemory::const_iterator ConcreteMemory::end(void) const {
+      return const_iterator(this, true);
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
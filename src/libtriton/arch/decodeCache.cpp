@@ -0,0 +1,140 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+
+#include <triton/decodeCache.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    DecodeCache::DecodeCache() {
+      this->enabled = false;
+    }
+
+
+    void DecodeCache::enable(bool flag) {
+      this->enabled = flag;
+      if (flag == false)
+        this->clear();
+    }
+
+
+    bool DecodeCache::isEnabled(void) const {
+      return this->enabled;
+    }
+
+
+    triton::usize DecodeCache::getSize(void) const {
+      return this->entries.size();
+    }
+
+
+    bool DecodeCache::loadEntry(triton::arch::Instruction& inst, bool thumb) const {
+      if (this->enabled == false)
+        return false;
+
+      auto it = this->entries.find(inst.getAddress());
+      if (it == this->entries.end())
+        return false;
+
+      /* The code at this address may have changed since it was decoded */
+      const Entry& entry = it->second;
+      if (entry.thumb != thumb || entry.size > inst.getSize() || std::memcmp(entry.opcode, inst.getOpcode(), entry.size) != 0)
+        return false;
+
+      inst.setSize(entry.size);
+      inst.setArchitecture(entry.arch);
+      inst.setType(entry.type);
+      inst.setPrefix(entry.prefix);
+      inst.setCodeCondition(entry.codeCondition);
+      inst.setBranch(entry.branch);
+      inst.setControlFlow(entry.controlFlow);
+      inst.setWriteBack(entry.writeBack);
+      inst.setUpdateFlag(entry.updateFlag);
+      inst.setThumb(entry.thumb);
+      inst.setDisassembly(entry.disassembly);
+      inst.operands = entry.operands;
+
+      return true;
+    }
+
+
+    void DecodeCache::storeEntry(const triton::arch::Instruction& inst, bool thumb) {
+      if (this->enabled == false || inst.getSize() > sizeof(Entry::opcode))
+        return;
+
+      Entry& entry = this->entries[inst.getAddress()];
+
+      std::memcpy(entry.opcode, inst.getOpcode(), inst.getSize());
+      entry.size          = inst.getSize();
+      entry.arch          = inst.getArchitecture();
+      entry.type          = inst.getType();
+      entry.prefix        = inst.getPrefix();
+      entry.codeCondition = inst.getCodeCondition();
+      entry.branch        = inst.isBranch();
+      entry.controlFlow   = inst.isControlFlow();
+      entry.writeBack     = inst.isWriteBack();
+      entry.updateFlag    = inst.isUpdateFlag();
+      entry.thumb         = thumb;
+      entry.disassembly   = inst.getDisassembly();
+      entry.operands      = inst.operands;
+    }
+
+
+    bool DecodeCache::load(triton::arch::Instruction& inst, bool thumb) {
+      if (this->loadEntry(inst, thumb))
+        return true;
+
+      #ifdef TRITON_PERSISTENT_CACHE
+      /* Decoded by a previous run or another process, kept in memory for the next time */
+      if (this->persistent && this->persistent->load(inst, thumb)) {
+        this->storeEntry(inst, thumb);
+        return true;
+      }
+      #endif
+
+      return false;
+    }
+
+
+    void DecodeCache::store(const triton::arch::Instruction& inst, bool thumb) {
+      this->storeEntry(inst, thumb);
+
+      #ifdef TRITON_PERSISTENT_CACHE
+      if (this->persistent)
+        this->persistent->store(inst, thumb);
+      #endif
+    }
+
+
+    void DecodeCache::clear(void) {
+      this->entries.clear();
+    }
+
+
+    #ifdef TRITON_PERSISTENT_CACHE
+    void DecodeCache::openPersistent(const std::string& path, triton::arch::architecture_e arch, const triton::arch::CpuInterface& cpu, triton::usize slots) {
+      this->persistent.reset();
+      this->persistent.reset(new triton::arch::PersistentDecodeCache(path, arch, cpu, slots));
+    }
+
+
+    void DecodeCache::closePersistent(void) {
+      this->persistent.reset();
+    }
+
+
+    bool DecodeCache::isPersistentOpen(void) const {
+      return this->persistent != nullptr;
+    }
+    #endif
+
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -0,0 +1,422 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <limits>
+
+#include <triton/astContext.hpp>
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/functionSummaries.hpp>
+#include <triton/memoryAccess.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    /* The names of the summarized functions, as in the symbols of the stubs */
+    static const std::map<std::string, FunctionSummaries::summary_e> summaryNames = {
+      {"memcmp",  FunctionSummaries::SUMMARY_MEMCMP},
+      {"memcpy",  FunctionSummaries::SUMMARY_MEMCPY},
+      {"memmove", FunctionSummaries::SUMMARY_MEMMOVE},
+      {"memset",  FunctionSummaries::SUMMARY_MEMSET},
+      {"strcmp",  FunctionSummaries::SUMMARY_STRCMP},
+      {"strcpy",  FunctionSummaries::SUMMARY_STRCPY},
+      {"strlen",  FunctionSummaries::SUMMARY_STRLEN},
+      {"strncmp", FunctionSummaries::SUMMARY_STRNCMP},
+    };
+
+
+    FunctionSummaries::FunctionSummaries(triton::arch::Architecture* architecture,
+                                         const triton::modes::SharedModes& modes,
+                                         const triton::ast::SharedAstContext& astCtxt,
+                                         triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                         triton::engines::taint::TaintEngine* taintEngine)
+      : modes(modes), astCtxt(astCtxt) {
+
+      this->architecture   = architecture;
+      this->current        = nullptr;
+      this->symbolicEngine = symbolicEngine;
+      this->taintEngine    = taintEngine;
+    }
+
+
+    bool FunctionSummaries::getSummary(const std::string& name, summary_e& summary) {
+      auto it = summaryNames.find(name);
+      if (it == summaryNames.end())
+        return false;
+      summary = it->second;
+      return true;
+    }
+
+
+    void FunctionSummaries::setFunctionSummary(triton::uint64 addr, const std::string& name, bool msAbi) {
+      Hook hook;
+
+      if (getSummary(name, hook.summary) == false)
+        throw triton::exceptions::Architecture("FunctionSummaries::setFunctionSummary(): No summary for this function.");
+
+      hook.msAbi = msAbi;
+      this->hooks[addr] = hook;
+    }
+
+
+    triton::usize FunctionSummaries::setFunctionSummaries(triton::uint64 base, const std::map<std::string, triton::uint64>& symbols, bool msAbi) {
+      triton::usize count = 0;
+
+      for (const auto& symbol : symbols) {
+        Hook hook;
+        if (getSummary(symbol.first, hook.summary)) {
+          hook.msAbi = msAbi;
+          this->hooks[base + symbol.second] = hook;
+          count++;
+        }
+      }
+
+      return count;
+    }
+
+
+    void FunctionSummaries::removeFunctionSummary(triton::uint64 addr) {
+      this->hooks.erase(addr);
+    }
+
+
+    std::map<triton::uint64, std::string> FunctionSummaries::getFunctionSummaries(void) const {
+      std::map<triton::uint64, std::string> ret;
+
+      for (const auto& hook : this->hooks) {
+        for (const auto& name : summaryNames) {
+          if (name.second == hook.second.summary)
+            ret[hook.first] = name.first;
+        }
+      }
+
+      return ret;
+    }
+
+
+    bool FunctionSummaries::isSummarized(triton::uint64 addr) const {
+      return this->hooks.find(addr) != this->hooks.end();
+    }
+
+
+    const triton::arch::Register* FunctionSummaries::getArgumentRegister(triton::uint32 index) const {
+      static const triton::arch::register_e aarch64[] = {ID_REG_AARCH64_X0, ID_REG_AARCH64_X1, ID_REG_AARCH64_X2};
+      static const triton::arch::register_e ms[]      = {ID_REG_X86_RCX, ID_REG_X86_RDX, ID_REG_X86_R8};
+      static const triton::arch::register_e systemv[] = {ID_REG_X86_RDI, ID_REG_X86_RSI, ID_REG_X86_RDX};
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_AARCH64:
+          return &this->architecture->getRegister(aarch64[index]);
+
+        case triton::arch::ARCH_X86_64:
+          return &this->architecture->getRegister(this->current->msAbi ? ms[index] : systemv[index]);
+
+        default:
+          return nullptr;
+      }
+    }
+
+
+    triton::uint64 FunctionSummaries::getArgument(triton::uint32 index) {
+      const triton::arch::Register* reg = this->getArgumentRegister(index);
+
+      if (reg != nullptr)
+        return static_cast<triton::uint64>(this->architecture->getConcreteRegisterValue(*reg));
+
+      /* cdecl: the arguments follow the return address */
+      triton::uint64 sp = static_cast<triton::uint64>(this->architecture->getConcreteRegisterValue(this->architecture->getStackPointer()));
+      return static_cast<triton::uint64>(this->architecture->getConcreteMemoryValue(MemoryAccess(sp + (index + 1) * triton::size::dword, triton::size::dword)));
+    }
+
+
+    triton::ast::SharedAbstractNode FunctionSummaries::getArgumentAst(triton::uint32 index) {
+      const triton::arch::Register* reg = this->getArgumentRegister(index);
+
+      if (reg != nullptr)
+        return this->symbolicEngine->getRegisterAst(*reg);
+
+      triton::uint64 sp = static_cast<triton::uint64>(this->architecture->getConcreteRegisterValue(this->architecture->getStackPointer()));
+      return this->symbolicEngine->getMemoryAst(MemoryAccess(sp + (index + 1) * triton::size::dword, triton::size::dword));
+    }
+
+
+    triton::ast::SharedAbstractNode FunctionSummaries::getSymbolicByte(triton::uint64 addr) {
+      const auto& expr = this->symbolicEngine->getSymbolicMemory(addr);
+      if (expr == nullptr)
+        return nullptr;
+      return this->astCtxt->reference(expr);
+    }
+
+
+    void FunctionSummaries::setReturnValue(const triton::ast::SharedAbstractNode& node, bool tainted) {
+      const triton::arch::Register& reg = (this->architecture->getArchitecture() == triton::arch::ARCH_AARCH64)
+                                          ? this->architecture->getRegister(ID_REG_AARCH64_X0)
+                                          : this->architecture->getParentRegister(ID_REG_X86_EAX);
+
+      triton::ast::SharedAbstractNode value = this->astCtxt->zx(reg.getBitSize() - node->getBitvectorSize(), node);
+      if (value->isSymbolized()) {
+        const auto& expr = this->symbolicEngine->newSymbolicExpression(value, triton::engines::symbolic::REGISTER_EXPRESSION, "Function summary");
+        this->symbolicEngine->assignSymbolicExpressionToRegister(expr, reg);
+      }
+      else {
+        this->architecture->setConcreteRegisterValue(reg, value->evaluate());
+        this->symbolicEngine->concretizeRegister(reg);
+      }
+
+      this->taintEngine->setTaintRegister(reg, tainted);
+    }
+
+
+    void FunctionSummaries::returnToCaller(void) {
+      const triton::arch::Register& pc = this->architecture->getProgramCounter();
+      triton::uint64 target = 0;
+
+      if (this->architecture->getArchitecture() == triton::arch::ARCH_AARCH64) {
+        target = static_cast<triton::uint64>(this->architecture->getConcreteRegisterValue(this->architecture->getRegister(ID_REG_AARCH64_X30)));
+      }
+      else {
+        const triton::arch::Register& sp = this->architecture->getStackPointer();
+        triton::uint64 stack = static_cast<triton::uint64>(this->architecture->getConcreteRegisterValue(sp));
+        target = static_cast<triton::uint64>(this->architecture->getConcreteMemoryValue(MemoryAccess(stack, this->architecture->gprSize())));
+        this->architecture->setConcreteRegisterValue(sp, stack + this->architecture->gprSize());
+        this->symbolicEngine->concretizeRegister(sp);
+      }
+
+      this->architecture->setConcreteRegisterValue(pc, target);
+      this->symbolicEngine->concretizeRegister(pc);
+    }
+
+
+    void FunctionSummaries::copyMemory(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+      bool taint = !this->taintEngine->getTaintedMemory().empty();
+      std::vector<std::pair<triton::uint64, triton::engines::symbolic::SharedSymbolicExpression>> cells;
+      std::vector<bool> tainted;
+
+      /* The whole source is read before anything is written, so the areas may overlap */
+      std::vector<triton::uint8> data = this->architecture->getConcreteMemoryAreaValue(src, size);
+
+      for (triton::uint64 addr : this->symbolicEngine->getSymbolicMemoryAddresses(src, size))
+        cells.push_back({addr - src, this->symbolicEngine->getSymbolicMemory(addr)});
+
+      if (taint) {
+        tainted.resize(size);
+        for (triton::usize index = 0; index < size; index++)
+          tainted[index] = this->taintEngine->isMemoryTainted(src + index);
+      }
+
+      this->architecture->setConcreteMemoryAreaValue(dst, data);
+
+      for (triton::uint64 addr : this->symbolicEngine->getSymbolicMemoryAddresses(dst, size))
+        this->symbolicEngine->concretizeMemory(addr);
+
+      /* The copied bytes share the expressions of the source */
+      for (const auto& cell : cells)
+        this->symbolicEngine->assignSymbolicExpressionToMemory(cell.second, MemoryAccess(dst + cell.first, triton::size::byte));
+
+      if (taint) {
+        for (triton::usize index = 0; index < size; index++)
+          this->taintEngine->setTaintMemory(MemoryAccess(dst + index, triton::size::byte), tainted[index]);
+      }
+    }
+
+
+    triton::usize FunctionSummaries::getStringLength(triton::uint64 addr) {
+      triton::usize length = 0;
+
+      while (this->architecture->getConcreteMemoryValue(addr + length) != 0)
+        length++;
+
+      return length;
+    }
+
+
+    triton::ast::SharedAbstractNode FunctionSummaries::compareMemory(triton::uint64 s1, triton::uint64 s2, triton::usize size, bool string, bool& tainted) {
+      triton::usize length = 0;
+
+      /* The concrete comparison stops at the first difference, or at the end of the strings */
+      while (length < size) {
+        triton::uint8 c1 = this->architecture->getConcreteMemoryValue(s1 + length);
+        triton::uint8 c2 = this->architecture->getConcreteMemoryValue(s2 + length);
+        if (c1 != c2 || (string && c1 == 0))
+          break;
+        length++;
+      }
+
+      auto byte = [this](triton::uint64 addr) {
+        triton::ast::SharedAbstractNode node = this->getSymbolicByte(addr);
+        if (node == nullptr)
+          node = this->astCtxt->bv(this->architecture->getConcreteMemoryValue(addr), triton::bitsize::byte);
+        return node;
+      };
+
+      auto difference = [this](const triton::ast::SharedAbstractNode& b1, const triton::ast::SharedAbstractNode& b2) {
+        return this->astCtxt->bvsub(this->astCtxt->zx(triton::bitsize::dword - triton::bitsize::byte, b1),
+                                    this->astCtxt->zx(triton::bitsize::dword - triton::bitsize::byte, b2));
+      };
+
+      triton::ast::SharedAbstractNode result = this->astCtxt->bv(0, triton::bitsize::dword);
+      if (length < size)
+        result = difference(byte(s1 + length), byte(s2 + length));
+
+      /* The bytes before are concretely equal, only the symbolic ones may end the comparison sooner */
+      for (triton::usize index = length; index-- > 0;) {
+        triton::ast::SharedAbstractNode b1 = this->getSymbolicByte(s1 + index);
+        triton::ast::SharedAbstractNode b2 = this->getSymbolicByte(s2 + index);
+        if (b1 == nullptr && b2 == nullptr)
+          continue;
+
+        if (b1 == nullptr) b1 = byte(s1 + index);
+        if (b2 == nullptr) b2 = byte(s2 + index);
+
+        if (string)
+          result = this->astCtxt->ite(this->astCtxt->equal(b1, this->astCtxt->bv(0, triton::bitsize::byte)), this->astCtxt->bv(0, triton::bitsize::dword), result);
+        result = this->astCtxt->ite(this->astCtxt->distinct(b1, b2), difference(b1, b2), result);
+      }
+
+      if (!this->taintEngine->getTaintedMemory().empty()) {
+        for (triton::usize index = 0; index <= length && index < size && !tainted; index++)
+          tainted = this->taintEngine->isMemoryTainted(s1 + index) || this->taintEngine->isMemoryTainted(s2 + index);
+      }
+
+      return result;
+    }
+
+
+    void FunctionSummaries::memcmp(void) {
+      bool tainted = false;
+      triton::ast::SharedAbstractNode result = this->compareMemory(this->getArgument(0), this->getArgument(1), this->getArgument(2), false, tainted);
+      this->setReturnValue(result, tainted);
+    }
+
+
+    void FunctionSummaries::memcpy(void) {
+      triton::uint64 dst = this->getArgument(0);
+      this->copyMemory(dst, this->getArgument(1), this->getArgument(2));
+      this->setReturnValue(this->astCtxt->bv(dst, this->architecture->gprBitSize()), false);
+    }
+
+
+    void FunctionSummaries::memset(void) {
+      triton::uint64 dst  = this->getArgument(0);
+      triton::usize size  = this->getArgument(2);
+      triton::ast::SharedAbstractNode value = this->astCtxt->extract(triton::bitsize::byte - 1, 0, this->getArgumentAst(1));
+      const triton::arch::Register* reg = this->getArgumentRegister(1);
+
+      bool tainted = false;
+      if (reg != nullptr)
+        tainted = this->taintEngine->isRegisterTainted(*reg);
+
+      this->architecture->setConcreteMemoryAreaValue(dst, std::vector<triton::uint8>(size, static_cast<triton::uint8>(value->evaluate())));
+
+      for (triton::uint64 addr : this->symbolicEngine->getSymbolicMemoryAddresses(dst, size))
+        this->symbolicEngine->concretizeMemory(addr);
+
+      /* Every byte shares the expression of the value */
+      if (value->isSymbolized()) {
+        const auto& expr = this->symbolicEngine->newSymbolicExpression(value, triton::engines::symbolic::MEMORY_EXPRESSION, "Function summary");
+        for (triton::usize index = 0; index < size; index++)
+          this->symbolicEngine->assignSymbolicExpressionToMemory(expr, MemoryAccess(dst + index, triton::size::byte));
+      }
+
+      if (tainted || !this->taintEngine->getTaintedMemory().empty()) {
+        for (triton::usize index = 0; index < size; index++)
+          this->taintEngine->setTaintMemory(MemoryAccess(dst + index, triton::size::byte), tainted);
+      }
+
+      this->setReturnValue(this->astCtxt->bv(dst, this->architecture->gprBitSize()), false);
+    }
+
+
+    void FunctionSummaries::strcmp(void) {
+      bool tainted = false;
+      triton::ast::SharedAbstractNode result = this->compareMemory(this->getArgument(0), this->getArgument(1), std::numeric_limits<triton::usize>::max(), true, tainted);
+      this->setReturnValue(result, tainted);
+    }
+
+
+    void FunctionSummaries::strcpy(void) {
+      triton::uint64 dst = this->getArgument(0);
+      triton::uint64 src = this->getArgument(1);
+      this->copyMemory(dst, src, this->getStringLength(src) + 1);
+      this->setReturnValue(this->astCtxt->bv(dst, this->architecture->gprBitSize()), false);
+    }
+
+
+    void FunctionSummaries::strlen(void) {
+      triton::uint64 s      = this->getArgument(0);
+      triton::usize length  = this->getStringLength(s);
+      triton::uint32 size   = this->architecture->gprBitSize();
+      bool tainted          = false;
+
+      /* The length is the first null byte, only the symbolic bytes before the concrete one may be it */
+      triton::ast::SharedAbstractNode result = this->astCtxt->bv(length, size);
+      for (triton::usize index = length; index-- > 0;) {
+        triton::ast::SharedAbstractNode byte = this->getSymbolicByte(s + index);
+        if (byte != nullptr)
+          result = this->astCtxt->ite(this->astCtxt->equal(byte, this->astCtxt->bv(0, triton::bitsize::byte)), this->astCtxt->bv(index, size), result);
+      }
+
+      if (!this->taintEngine->getTaintedMemory().empty()) {
+        for (triton::usize index = 0; index <= length && !tainted; index++)
+          tainted = this->taintEngine->isMemoryTainted(s + index);
+      }
+
+      this->setReturnValue(result, tainted);
+    }
+
+
+    void FunctionSummaries::strncmp(void) {
+      bool tainted = false;
+      triton::ast::SharedAbstractNode result = this->compareMemory(this->getArgument(0), this->getArgument(1), this->getArgument(2), true, tainted);
+      this->setReturnValue(result, tainted);
+    }
+
+
+    bool FunctionSummaries::apply(triton::arch::Instruction& inst) {
+      if (this->hooks.empty())
+        return false;
+
+      auto it = this->hooks.find(inst.getAddress());
+      if (it == this->hooks.end())
+        return false;
+
+      /* The summaries write the bitvector memory model, and the journal only records the semantics */
+      if (this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY) || this->symbolicEngine->isUndoJournalEnabled())
+        return false;
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_AARCH64:
+        case triton::arch::ARCH_X86:
+        case triton::arch::ARCH_X86_64:
+          break;
+        default:
+          return false;
+      }
+
+      this->current = &it->second;
+
+      switch (it->second.summary) {
+        case SUMMARY_MEMCMP:  this->memcmp();  break;
+        case SUMMARY_MEMCPY:  this->memcpy();  break;
+        case SUMMARY_MEMMOVE: this->memcpy();  break;
+        case SUMMARY_MEMSET:  this->memset();  break;
+        case SUMMARY_STRCMP:  this->strcmp();  break;
+        case SUMMARY_STRCPY:  this->strcpy();  break;
+        case SUMMARY_STRLEN:  this->strlen();  break;
+        case SUMMARY_STRNCMP: this->strncmp(); break;
+      }
+
+      this->returnToCaller();
+      this->current = nullptr;
+
+      return true;
+    }
+
+  };
+};
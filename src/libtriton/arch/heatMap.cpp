@@ -0,0 +1,159 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <iomanip>
+
+#include <triton/exceptions.hpp>
+#include <triton/heatMap.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    HeatMap::HeatMap() {
+      this->block     = 0;
+      this->countdown = 1;
+      this->enabled   = false;
+      this->leader    = true;
+      this->next      = 0;
+      this->period    = 1;
+    }
+
+
+    void HeatMap::enable(bool flag, triton::uint32 period) {
+      if (period == 0)
+        throw triton::exceptions::IrBuilder("HeatMap::enable(): The sampling period cannot be 0.");
+
+      this->enabled   = flag;
+      this->period    = period;
+      this->countdown = period;
+      if (flag == false)
+        this->clear();
+    }
+
+
+    bool HeatMap::isEnabled(void) const {
+      return this->enabled;
+    }
+
+
+    triton::uint32 HeatMap::getPeriod(void) const {
+      return this->period;
+    }
+
+
+    void HeatMap::follow(const triton::arch::Instruction& inst) {
+      if (this->enabled == false)
+        return;
+
+      if (this->leader || inst.getAddress() != this->next)
+        this->block = inst.getAddress();
+
+      this->next   = inst.getNextAddress();
+      this->leader = inst.isControlFlow();
+    }
+
+
+    void HeatMap::record(const triton::arch::Instruction& inst, triton::uint64 time, triton::uint64 nodes, triton::uint64 expressions) {
+      bool first = (this->leader || inst.getAddress() != this->next);
+
+      this->follow(inst);
+
+      /* A measured instruction stands for the whole period */
+      Entry& entry = this->addresses[inst.getAddress()];
+      entry.block = this->block;
+      entry.spot.count       += this->period;
+      entry.spot.time        += time * this->period;
+      entry.spot.nodes       += nodes * this->period;
+      entry.spot.expressions += expressions * this->period;
+
+      /* A block is executed each time its first instruction is */
+      HotSpot& spot = this->blocks[this->block];
+      if (first)
+        spot.count += this->period;
+      spot.time        += time * this->period;
+      spot.nodes       += nodes * this->period;
+      spot.expressions += expressions * this->period;
+    }
+
+
+    std::vector<std::pair<triton::uint64, HotSpot>> HeatMap::getHotSpots(bool blocks, triton::usize count) const {
+      std::vector<std::pair<triton::uint64, HotSpot>> ret;
+
+      if (blocks) {
+        ret.assign(this->blocks.begin(), this->blocks.end());
+      }
+      else {
+        ret.reserve(this->addresses.size());
+        for (const auto& it : this->addresses)
+          ret.push_back({it.first, it.second.spot});
+      }
+
+      /* The hottest first, then by address so the report is stable */
+      std::sort(ret.begin(), ret.end(), [](const std::pair<triton::uint64, HotSpot>& a, const std::pair<triton::uint64, HotSpot>& b) {
+        if (a.second.time != b.second.time)
+          return a.second.time > b.second.time;
+        if (a.second.count != b.second.count)
+          return a.second.count > b.second.count;
+        return a.first < b.first;
+      });
+
+      if (count != 0 && ret.size() > count)
+        ret.resize(count);
+
+      return ret;
+    }
+
+
+    void HeatMap::exportReport(std::ostream& stream) const {
+      std::ios_base::fmtflags flags = stream.flags();
+
+      for (bool blocks : {true, false}) {
+        stream << (blocks ? "# blocks" : "# addresses") << " (period " << std::dec << this->period << ")" << std::endl;
+        stream << "# address            count                time (ns)            nodes                expressions" << std::endl;
+        for (const auto& it : this->getHotSpots(blocks)) {
+          stream << "0x" << std::hex << std::setfill('0') << std::setw(16) << it.first << " " << std::dec << std::setfill(' ')
+                 << std::setw(20) << std::left << it.second.count << " "
+                 << std::setw(20) << it.second.time << " "
+                 << std::setw(20) << it.second.nodes << " "
+                 << it.second.expressions << std::right << std::endl;
+        }
+        if (blocks)
+          stream << std::endl;
+      }
+
+      stream.flags(flags);
+    }
+
+
+    void HeatMap::exportFlameGraph(std::ostream& stream) const {
+      std::ios_base::fmtflags flags = stream.flags();
+
+      for (const auto& it : this->getHotSpots(false)) {
+        /* The frames without time would not be drawn */
+        if (it.second.time == 0)
+          continue;
+        stream << "0x" << std::hex << this->addresses.at(it.first).block << ";0x" << it.first << " " << std::dec << it.second.time << std::endl;
+      }
+
+      stream.flags(flags);
+    }
+
+
+    void HeatMap::clear(void) {
+      this->addresses.clear();
+      this->blocks.clear();
+      this->block     = 0;
+      this->countdown = this->period;
+      this->leader    = true;
+      this->next      = 0;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
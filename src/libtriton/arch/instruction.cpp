@@ -54,6 +54,11 @@ namespace triton {
     }
 
 
+    Instruction::Instruction(Instruction&& other) noexcept {
+      this->move(other);
+    }
+
+
     Instruction::~Instruction() {
       /* See #828: Release ownership before calling container destructor */
       this->loadAccess.clear();
@@ -71,33 +76,70 @@ namespace triton {
     }
 
 
+    Instruction& Instruction::operator=(Instruction&& other) noexcept {
+      if (this != &other)
+        this->move(other);
+      return *this;
+    }
+
+
     void Instruction::copy(const Instruction& other) {
-      this->address             = other.address;
-      this->arch                = other.arch;
-      this->branch              = other.branch;
-      this->codeCondition       = other.codeCondition;
-      this->conditionTaken      = other.conditionTaken;
-      this->controlFlow         = other.controlFlow;
-      this->loadAccess          = other.loadAccess;
-      this->operands            = other.operands;
-      this->prefix              = other.prefix;
-      this->readImmediates      = other.readImmediates;
-      this->readRegisters       = other.readRegisters;
-      this->size                = other.size;
-      this->storeAccess         = other.storeAccess;
-      this->symbolicExpressions = other.symbolicExpressions;
-      this->tainted             = other.tainted;
-      this->tid                 = other.tid;
-      this->type                = other.type;
-      this->undefinedRegisters  = other.undefinedRegisters;
-      this->updateFlag          = other.updateFlag;
-      this->writeBack           = other.writeBack;
-      this->writtenRegisters    = other.writtenRegisters;
+      this->address              = other.address;
+      this->arch                 = other.arch;
+      this->branch               = other.branch;
+      this->codeCondition        = other.codeCondition;
+      this->conditionTaken       = other.conditionTaken;
+      this->controlFlow          = other.controlFlow;
+      this->loadAccess           = other.loadAccess;
+      this->operands             = other.operands;
+      this->prefix               = other.prefix;
+      this->readImmediates       = other.readImmediates;
+      this->readRegisters        = other.readRegisters;
+      this->size                 = other.size;
+      this->storeAccess          = other.storeAccess;
+      this->symbolicExpressions  = other.symbolicExpressions;
+      this->tainted              = other.tainted;
+      this->thumb                = other.thumb;
+      this->tid                  = other.tid;
+      this->type                 = other.type;
+      this->undefinedRegisters   = other.undefinedRegisters;
+      this->updateFlag           = other.updateFlag;
+      this->writeBack            = other.writeBack;
+      this->writtenRegisters     = other.writtenRegisters;
+      this->disassembly          = other.disassembly;
+      this->formattedDisassembly = other.formattedDisassembly;
 
       std::memcpy(this->opcode, other.opcode, sizeof(this->opcode));
+    }
 
-      this->disassembly.clear();
-      this->disassembly.str(other.disassembly.str());
+
+    void Instruction::move(Instruction& other) {
+      this->address              = other.address;
+      this->arch                 = other.arch;
+      this->branch               = other.branch;
+      this->codeCondition        = other.codeCondition;
+      this->conditionTaken       = other.conditionTaken;
+      this->controlFlow          = other.controlFlow;
+      this->loadAccess           = std::move(other.loadAccess);
+      this->operands             = std::move(other.operands);
+      this->prefix               = other.prefix;
+      this->readImmediates       = std::move(other.readImmediates);
+      this->readRegisters        = std::move(other.readRegisters);
+      this->size                 = other.size;
+      this->storeAccess          = std::move(other.storeAccess);
+      this->symbolicExpressions  = std::move(other.symbolicExpressions);
+      this->tainted              = other.tainted;
+      this->thumb                = other.thumb;
+      this->tid                  = other.tid;
+      this->type                 = other.type;
+      this->undefinedRegisters   = std::move(other.undefinedRegisters);
+      this->updateFlag           = other.updateFlag;
+      this->writeBack            = other.writeBack;
+      this->writtenRegisters     = std::move(other.writtenRegisters);
+      this->disassembly          = std::move(other.disassembly);
+      this->formattedDisassembly = std::move(other.formattedDisassembly);
+
+      std::memcpy(this->opcode, other.opcode, sizeof(this->opcode));
     }
 
 
@@ -123,11 +165,12 @@ namespace triton {
 
     void Instruction::setAddress(triton::uint64 addr) {
       this->address = addr;
+      this->formattedDisassembly = nullptr;
     }
 
 
     std::string Instruction::getDisassembly(void) const {
-      return this->disassembly.str();
+      return this->disassembly;
     }
 
 
@@ -335,8 +378,8 @@ namespace triton {
 
 
     void Instruction::setDisassembly(const std::string& str) {
-      this->disassembly.clear();
-      this->disassembly.str(str);
+      this->disassembly = str;
+      this->formattedDisassembly = nullptr;
     }
 
 
@@ -358,7 +401,10 @@ namespace triton {
     void Instruction::addSymbolicExpression(const triton::engines::symbolic::SharedSymbolicExpression& expr) {
       if (expr == nullptr)
         throw triton::exceptions::Instruction("Instruction::addSymbolicExpression(): Cannot add a null expression.");
-      expr->writeBackDisassembly(triton::utils::toString(*this));
+      /* Formatted once, then shared by all the expressions of the instruction */
+      if (this->formattedDisassembly == nullptr)
+        this->formattedDisassembly = std::make_shared<const std::string>(triton::utils::toString(*this));
+      expr->writeBackDisassembly(this->formattedDisassembly);
       expr->setAddress(this->getAddress());
       this->symbolicExpressions.push_back(expr);
     }
@@ -530,8 +576,8 @@ namespace triton {
       this->updateFlag      = false;
       this->writeBack       = false;
 
-      /* Clear the stringstream (See #975) */
-      std::stringstream().swap(this->disassembly);
+      this->disassembly.clear();
+      this->formattedDisassembly = nullptr;
 
       this->loadAccess.clear();
       this->operands.clear();
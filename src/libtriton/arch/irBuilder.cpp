@@ -5,6 +5,8 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <chrono>
+#include <fstream>
 #include <new>
 
 #include <triton/aarch64Semantics.hpp>
@@ -15,7 +17,10 @@
 #include <triton/memoryAccess.hpp>
 #include <triton/operandWrapper.hpp>
 #include <triton/register.hpp>
+#include <triton/tracing.hpp>
+#include <triton/x86ConcreteSemantics.hpp>
 #include <triton/x86Semantics.hpp>
+#include <triton/x86Specifications.hpp>
 
 
 
@@ -38,14 +43,21 @@ namespace triton {
       if (taintEngine == nullptr)
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): The taint engines API must be defined.");
 
-      this->architecture         = architecture;
-      this->symbolicEngine       = symbolicEngine;
-      this->taintEngine          = taintEngine;
+      this->architecture          = architecture;
+      this->symbolicEngine        = symbolicEngine;
+      this->taintEngine           = taintEngine;
+      this->profilingEnabled      = false;
+      this->semanticsCacheEnabled = false;
       this->aarch64Isa           = new(std::nothrow) triton::arch::arm::aarch64::AArch64Semantics(architecture, symbolicEngine, taintEngine, astCtxt);
-      this->arm32Isa             = new(std::nothrow) triton::arch::arm::arm32::Arm32Semantics(architecture, symbolicEngine, taintEngine, astCtxt);
+      this->arm32Isa             = new(std::nothrow) triton::arch::arm::arm32::Arm32Semantics(architecture, symbolicEngine, taintEngine, modes, astCtxt);
       this->x86Isa               = new(std::nothrow) triton::arch::x86::x86Semantics(architecture, symbolicEngine, taintEngine, modes, astCtxt);
+      this->x86ConcreteIsa       = new(std::nothrow) triton::arch::x86::x86ConcreteSemantics(architecture, symbolicEngine, taintEngine, modes);
+      this->x86TaintIsa          = new(std::nothrow) triton::arch::x86::x86TaintSemantics(architecture, taintEngine);
+      this->summaries            = new(std::nothrow) triton::arch::FunctionSummaries(architecture, modes, astCtxt, symbolicEngine, taintEngine);
+      this->syscalls             = new(std::nothrow) triton::arch::SyscallEmulator(architecture, astCtxt, symbolicEngine, taintEngine);
+      this->concreteMemo         = new(std::nothrow) triton::arch::ConcreteMemo(architecture, modes, symbolicEngine, taintEngine);
 
-      if (this->x86Isa == nullptr || this->aarch64Isa == nullptr || this->arm32Isa == nullptr)
+      if (this->x86Isa == nullptr || this->x86ConcreteIsa == nullptr || this->x86TaintIsa == nullptr || this->aarch64Isa == nullptr || this->arm32Isa == nullptr || this->summaries == nullptr || this->syscalls == nullptr || this->concreteMemo == nullptr)
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): Not enough memory.");
     }
 
@@ -54,20 +66,101 @@ namespace triton {
       delete this->aarch64Isa;
       delete this->arm32Isa;
       delete this->x86Isa;
+      delete this->x86ConcreteIsa;
+      delete this->x86TaintIsa;
+      delete this->summaries;
+      delete this->syscalls;
+      delete this->concreteMemo;
     }
 
 
     triton::arch::exception_e IrBuilder::buildSemantics(triton::arch::Instruction& inst) {
+      TRITON_TRACE("semantics", "IrBuilder::buildSemantics");
+
+      bool sampled = this->heatMap.sample();
+
+      if (this->profilingEnabled == false && sampled == false) {
+        triton::arch::exception_e ret = this->processSemantics(inst);
+
+        /* The system call is emulated once its instruction went to the next one */
+        if (ret == triton::arch::NO_FAULT)
+          this->syscalls->apply(inst);
+
+        this->heatMap.follow(inst);
+        return ret;
+      }
+
+      triton::uint64 nodes = this->astCtxt->getAllocatedNodes();
+      triton::usize expressions = this->symbolicEngine->getNextSymbolicExpressionId();
+      auto start = std::chrono::steady_clock::now();
+
+      triton::arch::exception_e ret = this->processSemantics(inst);
+      if (ret == triton::arch::NO_FAULT)
+        this->syscalls->apply(inst);
+
+      auto end = std::chrono::steady_clock::now();
+      triton::uint64 time = static_cast<triton::uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+      nodes = this->astCtxt->getAllocatedNodes() - nodes;
+
+      /* The undo journal may give back the ids of the expressions */
+      triton::usize next = this->symbolicEngine->getNextSymbolicExpressionId();
+      expressions = (next > expressions) ? next - expressions : 0;
+
+      if (this->profilingEnabled) {
+        auto& entry = this->profile[inst.getType()];
+        entry.count++;
+        entry.time        += time;
+        entry.nodes       += nodes;
+        entry.expressions += expressions;
+      }
+
+      if (sampled)
+        this->heatMap.record(inst, time, nodes, expressions);
+      else
+        this->heatMap.follow(inst);
+
+      return ret;
+    }
+
+
+    triton::arch::exception_e IrBuilder::processSemantics(triton::arch::Instruction& inst) {
       triton::arch::architecture_e arch = this->architecture->getArchitecture();
       triton::arch::exception_e ret = triton::arch::NO_FAULT;
 
       if (arch == triton::arch::ARCH_INVALID)
         throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): You must define an architecture.");
 
+      /* Summarized functions are applied at once instead of being emulated */
+      if (this->summaries->apply(inst))
+        return ret;
+
+      /* Only the taint is spread when the expressions are not needed */
+      if (this->propagateTaint(inst))
+        return ret;
+
+      /* Instructions which only touch concrete values do not need their semantics */
+      if (this->emulateSemantics(inst))
+        return ret;
+
+      /* Deterministic instructions already met with the same concrete inputs replay their outputs */
+      bool memoizing = this->isMemoizing(inst);
+      if (memoizing) {
+        if (this->concreteMemo->lookup(inst)) {
+          this->preIrInit(inst);
+          this->concreteMemo->replay(inst);
+          this->postIrInit(inst);
+          return ret;
+        }
+        this->concreteMemo->prepare(inst);
+      }
+
+      /* Open the undo record of the instruction when journaling */
+      this->symbolicEngine->openUndoRecord();
+
       /* Initialize the target address of memory operands */
-      for (auto& operand : inst.operands) {
-        if (operand.getType() == triton::arch::OP_MEM) {
-          this->symbolicEngine->initLeaAst(operand.getMemory());
+      for (triton::uint32 index = 0; index < inst.operands.size(); index++) {
+        if (inst.operands[index].getType() == triton::arch::OP_MEM) {
+          this->symbolicEngine->initLeaAst(inst, index, inst.operands[index].getMemory());
         }
       }
 
@@ -75,28 +168,50 @@ namespace triton {
       this->preIrInit(inst);
 
       /* Processing */
-      switch (arch) {
-        case triton::arch::ARCH_AARCH64:
-          ret = this->aarch64Isa->buildSemantics(inst);
-          break;
+      if (this->replaySemantics(inst) == false) {
+        bool recording = this->recordSemantics(inst);
+
+        switch (arch) {
+          case triton::arch::ARCH_AARCH64:
+            ret = this->aarch64Isa->buildSemantics(inst);
+            break;
+
+          case triton::arch::ARCH_ARM32:
+            ret = this->arm32Isa->buildSemantics(inst);
+            break;
+
+          case triton::arch::ARCH_X86:
+          case triton::arch::ARCH_X86_64:
+            ret = this->x86Isa->buildSemantics(inst);
+            break;
+
+          default:
+            throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): Architecture not supported.");
+            break;
+        }
 
-        case triton::arch::ARCH_ARM32:
-          ret = this->arm32Isa->buildSemantics(inst);
-          break;
+        if (recording)
+          this->storeSemantics(inst, ret);
+      }
 
-        case triton::arch::ARCH_X86:
-        case triton::arch::ARCH_X86_64:
-          ret = this->x86Isa->buildSemantics(inst);
-          break;
+      /* Before the post IR processing, which may collect the nodes read */
+      if (memoizing)
+        this->memoizeSemantics(inst, ret);
 
-        default:
-          throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): Architecture not supported.");
-          break;
-      }
+      /* Deferred flags are built at the end of a basic block, or at once when journaling. The written sub-registers wait for a read */
+      if (inst.isControlFlow() || this->symbolicEngine->isUndoJournalEnabled())
+        this->symbolicEngine->materializeLazyRegisters(false);
 
       /* Post IR processing */
       this->postIrInit(inst);
 
+      /* Back-edges of the trace summarize their loop */
+      if (inst.isControlFlow() && this->modes->isModeEnabled(triton::modes::LOOP_SUMMARIZATION))
+        this->symbolicEngine->summarizeLoop(inst);
+
+      /* Assignments done after the semantics do not belong to the instruction */
+      this->symbolicEngine->closeUndoRecord();
+
       return ret;
     }
 
@@ -105,21 +220,56 @@ namespace triton {
       triton::arch::exception_e ret = triton::arch::NO_FAULT;
       triton::usize count = block.getSize();
 
-      for (auto& inst : block.getInstructions()) {
-        ret = this->buildSemantics(inst);
-        if (ret != triton::arch::NO_FAULT) {
-          return ret;
-        }
-        count--;
-        if (inst.isControlFlow() && count) {
-          throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): Do not add instructions in a block after a branch instruction.");
+      /* The flags overwritten before being read in the block are never built */
+      bool deferring = this->isDeferringBlockFlags();
+      if (deferring)
+        this->symbolicEngine->deferFlags(true);
+
+      try {
+        for (auto& inst : block.getInstructions()) {
+          ret = this->buildSemantics(inst);
+          if (ret != triton::arch::NO_FAULT) {
+            break;
+          }
+          count--;
+          if (inst.isControlFlow() && count) {
+            throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): Do not add instructions in a block after a branch instruction.");
+          }
         }
       }
+      catch (const triton::exceptions::Exception&) {
+        if (deferring)
+          this->endBlockFlags();
+        throw;
+      }
+
+      if (deferring)
+        this->endBlockFlags();
 
       return ret;
     }
 
 
+    bool IrBuilder::isDeferringBlockFlags(void) const {
+      /* Already deferred by the mode, or the expressions must be assigned by each instruction */
+      if (this->symbolicEngine->isDeferringFlags() ||
+          this->symbolicEngine->isUndoJournalEnabled() ||
+          this->semanticsCacheEnabled ||
+          this->concreteMemo->isEnabled()) {
+        return false;
+      }
+
+      return true;
+    }
+
+
+    void IrBuilder::endBlockFlags(void) {
+      /* The flags live at the end of the block are built from the state they were written in */
+      this->symbolicEngine->materializeLazyRegisters(false);
+      this->symbolicEngine->deferFlags(false);
+    }
+
+
     void IrBuilder::preIrInit(triton::arch::Instruction& inst) {
       /* Clear previous expressions if exist */
       inst.symbolicExpressions.clear();
@@ -139,8 +289,6 @@ namespace triton {
 
 
     void IrBuilder::postIrInit(triton::arch::Instruction& inst) {
-      std::vector<triton::engines::symbolic::SharedSymbolicExpression> newVector;
-
       /* Set the taint */
       inst.setTaint();
 
@@ -150,64 +298,412 @@ namespace triton {
        * concrete expressions and their AST nodes.
        */
       if (this->modes->isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED)) {
-        /* Clear memory operands */
-        this->collectUnsymbolizedNodes(inst.operands);
+        /* Nothing built from concrete inputs is symbolized, the nodes are dropped without being checked */
+        if (this->hasSymbolizedInputs(inst) == false) {
+          this->collectAllNodes(inst);
+        }
+        else {
+          this->collectUnsymbolizedNodes(inst);
+        }
+      }
 
-        /* Clear implicit and explicit semantics - MEM */
-        this->collectUnsymbolizedNodes(inst.getLoadAccess());
+      /*
+       * If the symbolic engine is defined to process symbolic
+       * execution only on tainted instructions, we delete all
+       * expressions untainted and their AST nodes.
+       */
+      else if (this->modes->isModeEnabled(triton::modes::ONLY_ON_TAINTED) && !inst.isTainted()) {
+        this->collectAllNodes(inst);
+      }
 
-        /* Clear implicit and explicit semantics - REG */
-        this->collectUnsymbolizedNodes(inst.getReadRegisters());
+      /* Index the expressions kept, their taint being known */
+      this->symbolicEngine->indexSymbolicExpressions(inst);
+    }
 
-        /* Clear implicit and explicit semantics - IMM */
-        this->collectUnsymbolizedNodes(inst.getReadImmediates());
 
-        /* Clear implicit and explicit semantics - MEM */
-        this->collectUnsymbolizedNodes(inst.getStoreAccess());
+    void IrBuilder::enableSemanticsCache(bool flag) {
+      this->semanticsCacheEnabled = flag;
+      if (flag == false) {
+        this->symbolicEngine->setSemanticRecorder(nullptr);
+        this->clearSemanticsCache();
+      }
+    }
+
+
+    bool IrBuilder::isSemanticsCacheEnabled(void) const {
+      return this->semanticsCacheEnabled;
+    }
+
+
+    triton::usize IrBuilder::getSemanticsCacheSize(void) const {
+      return this->semanticsCache.size();
+    }
+
+
+    void IrBuilder::clearSemanticsCache(void) {
+      this->semanticsCache.clear();
+    }
+
+
+    void IrBuilder::enableProfiling(bool flag) {
+      this->profilingEnabled = flag;
+      if (flag == false)
+        this->clearProfile();
+    }
+
+
+    bool IrBuilder::isProfilingEnabled(void) const {
+      return this->profilingEnabled;
+    }
+
+
+    const std::map<triton::uint32, InstructionProfile>& IrBuilder::getProfile(void) const {
+      return this->profile;
+    }
+
+
+    void IrBuilder::clearProfile(void) {
+      this->profile.clear();
+    }
+
+
+    void IrBuilder::enableHeatMap(bool flag, triton::uint32 period) {
+      this->heatMap.enable(flag, period);
+    }
+
+
+    bool IrBuilder::isHeatMapEnabled(void) const {
+      return this->heatMap.isEnabled();
+    }
+
+
+    std::vector<std::pair<triton::uint64, triton::arch::HotSpot>> IrBuilder::getHotSpots(bool blocks, triton::usize count) const {
+      return this->heatMap.getHotSpots(blocks, count);
+    }
+
+
+    void IrBuilder::exportHeatMap(const std::string& path, bool flameGraph) const {
+      std::ofstream stream(path, std::ios::out | std::ios::trunc);
+      if (!stream.is_open())
+        throw triton::exceptions::IrBuilder("IrBuilder::exportHeatMap(): Cannot open " + path);
+
+      if (flameGraph)
+        this->heatMap.exportFlameGraph(stream);
+      else
+        this->heatMap.exportReport(stream);
+    }
+
+
+    void IrBuilder::clearHeatMap(void) {
+      this->heatMap.clear();
+    }
 
-        /* Clear implicit and explicit semantics - REG */
-        this->collectUnsymbolizedNodes(inst.getWrittenRegisters());
 
-        /* Clear symbolic expressions */
-        for (const auto& se : inst.symbolicExpressions) {
-          if (se->isSymbolized() == false) {
-            this->symbolicEngine->removeSymbolicExpression(se);
+    void IrBuilder::enableConcreteMemo(bool flag, triton::usize capacity) {
+      this->concreteMemo->enable(flag, capacity);
+    }
+
+
+    bool IrBuilder::isConcreteMemoEnabled(void) const {
+      return this->concreteMemo->isEnabled();
+    }
+
+
+    triton::arch::ConcreteMemoStats IrBuilder::getConcreteMemoStats(void) const {
+      return this->concreteMemo->getStats();
+    }
+
+
+    void IrBuilder::clearConcreteMemo(void) {
+      this->concreteMemo->clear();
+    }
+
+
+    void IrBuilder::reset(void) {
+      this->recording.clear();
+      this->profile.clear();
+      this->heatMap.clear();
+      this->concreteMemo->clear();
+      this->syscalls->reset();
+    }
+
+
+    triton::arch::FunctionSummaries& IrBuilder::getSummaries(void) {
+      return *this->summaries;
+    }
+
+
+    triton::arch::SyscallEmulator& IrBuilder::getSyscalls(void) {
+      return *this->syscalls;
+    }
+
+
+    bool IrBuilder::isTemplatable(const triton::arch::Instruction& inst) const {
+      /* These modes rewrite the ASTs depending on the concrete values, or defer some of them */
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS) ||
+          this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING) ||
+          this->modes->isModeEnabled(triton::modes::CONCRETIZE_UNDEFINED_REGISTERS) ||
+          this->symbolicEngine->isDeferringFlags() ||
+          this->modes->isModeEnabled(triton::modes::LAZY_SUBREGISTERS)) {
+        return false;
+      }
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_X86:
+        case triton::arch::ARCH_X86_64:
+          break;
+        default:
+          return false;
+      }
+
+      if (inst.isControlFlow() || inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID)
+        return false;
+
+      /* Effective addresses are computed from concrete values */
+      for (const auto& operand : inst.operands) {
+        if (operand.getType() == triton::arch::OP_MEM)
+          return false;
+      }
+
+      /* Semantics which do not look at concrete values */
+      switch (inst.getType()) {
+        case triton::arch::x86::ID_INS_ADC:
+        case triton::arch::x86::ID_INS_ADD:
+        case triton::arch::x86::ID_INS_AND:
+        case triton::arch::x86::ID_INS_CBW:
+        case triton::arch::x86::ID_INS_CDQ:
+        case triton::arch::x86::ID_INS_CDQE:
+        case triton::arch::x86::ID_INS_CLC:
+        case triton::arch::x86::ID_INS_CLD:
+        case triton::arch::x86::ID_INS_CMC:
+        case triton::arch::x86::ID_INS_CMP:
+        case triton::arch::x86::ID_INS_CQO:
+        case triton::arch::x86::ID_INS_CWD:
+        case triton::arch::x86::ID_INS_CWDE:
+        case triton::arch::x86::ID_INS_DEC:
+        case triton::arch::x86::ID_INS_INC:
+        case triton::arch::x86::ID_INS_MOV:
+        case triton::arch::x86::ID_INS_MOVSX:
+        case triton::arch::x86::ID_INS_MOVSXD:
+        case triton::arch::x86::ID_INS_MOVZX:
+        case triton::arch::x86::ID_INS_NEG:
+        case triton::arch::x86::ID_INS_NOP:
+        case triton::arch::x86::ID_INS_NOT:
+        case triton::arch::x86::ID_INS_OR:
+        case triton::arch::x86::ID_INS_SBB:
+        case triton::arch::x86::ID_INS_STC:
+        case triton::arch::x86::ID_INS_STD:
+        case triton::arch::x86::ID_INS_SUB:
+        case triton::arch::x86::ID_INS_TEST:
+        case triton::arch::x86::ID_INS_XCHG:
+        case triton::arch::x86::ID_INS_XOR:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
+    bool IrBuilder::isCompilable(const triton::arch::Instruction& inst) const {
+      if (this->isTemplatable(inst))
+        return true;
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_X86:
+        case triton::arch::ARCH_X86_64:
+          break;
+        default:
+          return false;
+      }
+
+      /* The targets of direct branches are immediates, the conditions are flags */
+      if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID || inst.operands.size() != 1 || inst.operands[0].getType() != triton::arch::OP_IMM)
+        return false;
+
+      switch (inst.getType()) {
+        case triton::arch::x86::ID_INS_JA:
+        case triton::arch::x86::ID_INS_JAE:
+        case triton::arch::x86::ID_INS_JB:
+        case triton::arch::x86::ID_INS_JBE:
+        case triton::arch::x86::ID_INS_JE:
+        case triton::arch::x86::ID_INS_JG:
+        case triton::arch::x86::ID_INS_JGE:
+        case triton::arch::x86::ID_INS_JL:
+        case triton::arch::x86::ID_INS_JLE:
+        case triton::arch::x86::ID_INS_JMP:
+        case triton::arch::x86::ID_INS_JNE:
+        case triton::arch::x86::ID_INS_JNO:
+        case triton::arch::x86::ID_INS_JNP:
+        case triton::arch::x86::ID_INS_JNS:
+        case triton::arch::x86::ID_INS_JO:
+        case triton::arch::x86::ID_INS_JP:
+        case triton::arch::x86::ID_INS_JS:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
+    bool IrBuilder::isInputDependent(const triton::arch::Instruction& inst) const {
+      /* Untainted expressions are dropped anyway when only the tainted ones are kept */
+      bool symbolic = (this->modes->isModeEnabled(triton::modes::ONLY_ON_TAINTED) == false);
+
+      auto isDependent = [this, symbolic](const triton::arch::Register& reg) {
+        if (this->architecture->isRegisterValid(reg) == false)
+          return false;
+        return (symbolic && this->symbolicEngine->isRegisterSymbolized(reg)) || this->taintEngine->isRegisterTainted(reg);
+      };
+
+      for (const auto& operand : inst.operands) {
+        switch (operand.getType()) {
+          case triton::arch::OP_REG:
+            if (isDependent(operand.getConstRegister()))
+              return true;
+            break;
+
+          case triton::arch::OP_MEM: {
+            const triton::arch::MemoryAccess& mem = operand.getConstMemory();
+            if (isDependent(mem.getConstBaseRegister()) || isDependent(mem.getConstIndexRegister()) || isDependent(mem.getConstSegmentRegister()))
+              return true;
+            break;
           }
-          else
-            newVector.push_back(se);
+
+          default:
+            break;
         }
-        inst.symbolicExpressions = newVector;
       }
 
-      /*
-       * If the symbolic engine is defined to process symbolic
-       * execution only on tainted instructions, we delete all
-       * expressions untainted and their AST nodes.
-       */
-      else if (this->modes->isModeEnabled(triton::modes::ONLY_ON_TAINTED) && !inst.isTainted()) {
-        /* Memory operands */
-        this->collectNodes(inst.operands);
+      return false;
+    }
+
+
+    bool IrBuilder::emulateSemantics(triton::arch::Instruction& inst) {
+      /* The expressions of the concrete instructions are also dropped when only the symbolized or tainted ones are kept */
+      if (this->modes->isModeEnabled(triton::modes::CONCRETE_FAST_PATH) == false &&
+          this->modes->isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED) == false &&
+          this->modes->isModeEnabled(triton::modes::ONLY_ON_TAINTED) == false) {
+        return false;
+      }
+
+      /* The journal records the expressions, and the array memory model a store per byte */
+      if (this->symbolicEngine->isUndoJournalEnabled() || this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY))
+        return false;
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_X86:
+        case triton::arch::ARCH_X86_64:
+          break;
+        default:
+          return false;
+      }
+
+      /* Cheap filter on the registers of the operands and of their effective addresses, the memory cells are checked by the emulation */
+      if (this->isInputDependent(inst))
+        return false;
+
+      this->preIrInit(inst);
+      if (this->x86ConcreteIsa->emulate(inst) == false)
+        return false;
+
+      /* Same as the semantics, deferred flags are built at the end of a basic block */
+      if (inst.isControlFlow())
+        this->symbolicEngine->materializeLazyRegisters(false);
+
+      this->postIrInit(inst);
+      return true;
+    }
+
+
+    bool IrBuilder::isMemoizing(const triton::arch::Instruction& inst) const {
+      if (this->concreteMemo->isEnabled() == false)
+        return false;
+
+      /* The journal records the expressions, and the deferred registers are not assigned by the semantics */
+      if (this->symbolicEngine->isUndoJournalEnabled() ||
+          this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY) ||
+          this->symbolicEngine->isDeferringFlags() ||
+          this->modes->isModeEnabled(triton::modes::LAZY_SUBREGISTERS)) {
+        return false;
+      }
+
+      return this->concreteMemo->isMemoizable(inst);
+    }
+
+
+    void IrBuilder::memoizeSemantics(triton::arch::Instruction& inst, triton::arch::exception_e ret) {
+      if (ret != triton::arch::NO_FAULT || this->hasSymbolizedInputs(inst))
+        return;
+
+      /* The replay untaints the outputs */
+      for (const auto& se : inst.symbolicExpressions) {
+        if (se->isTainted)
+          return;
+      }
 
-        /* Implicit and explicit semantics - MEM */
-        this->collectNodes(inst.getLoadAccess());
+      this->concreteMemo->record(inst);
+    }
+
+
+    bool IrBuilder::propagateTaint(triton::arch::Instruction& inst) {
+      if (this->modes->isModeEnabled(triton::modes::TAINT_ONLY) == false)
+        return false;
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_X86:
+        case triton::arch::ARCH_X86_64:
+          break;
+        default:
+          return false;
+      }
 
-        /* Implicit and explicit semantics - REG */
-        this->collectNodes(inst.getReadRegisters());
+      this->preIrInit(inst);
+      return this->x86TaintIsa->propagate(inst);
+    }
 
-        /* Implicit and explicit semantics - IMM */
-        this->collectNodes(inst.getReadImmediates());
 
-        /* Implicit and explicit semantics - MEM */
-        this->collectNodes(inst.getStoreAccess());
+    bool IrBuilder::replaySemantics(triton::arch::Instruction& inst) {
+      if (this->semanticsCacheEnabled == false || this->isTemplatable(inst) == false)
+        return false;
 
-        /* Implicit and explicit semantics - REG */
-        this->collectNodes(inst.getWrittenRegisters());
+      auto it = this->semanticsCache.find(inst.getAddress());
+      if (it == this->semanticsCache.end() || it->second.matches(inst, this->architecture->getArchitecture()) == false)
+        return false;
 
-        /* Symbolic Expressions */
-        this->removeSymbolicExpressions(inst);
+      /* The taint is spread by the semantics, replay only on untainted registers */
+      for (const auto& reg : it->second.getRegisters()) {
+        if (this->taintEngine->isRegisterTainted(reg))
+          return false;
       }
 
-      this->astCtxt->garbage();
+      this->symbolicEngine->setSemanticRecorder(nullptr);
+      it->second.bind(inst, this->symbolicEngine);
+      return true;
+    }
+
+
+    bool IrBuilder::recordSemantics(const triton::arch::Instruction& inst) {
+      if (this->semanticsCacheEnabled == false)
+        return false;
+
+      if (this->isTemplatable(inst) == false) {
+        this->symbolicEngine->setSemanticRecorder(nullptr);
+        return false;
+      }
+
+      this->recording.clear();
+      this->symbolicEngine->setSemanticRecorder(&this->recording);
+      return true;
+    }
+
+
+    void IrBuilder::storeSemantics(triton::arch::Instruction& inst, triton::arch::exception_e ret) {
+      this->symbolicEngine->setSemanticRecorder(nullptr);
+
+      if (ret == triton::arch::NO_FAULT && this->recording.build(inst, this->architecture->getArchitecture())) {
+        this->semanticsCache[inst.getAddress()] = std::move(this->recording);
+      }
+      this->recording.clear();
     }
 
 
@@ -219,6 +715,87 @@ namespace triton {
     }
 
 
+    void IrBuilder::collectUnsymbolizedNodes(triton::arch::Instruction& inst) {
+      std::vector<triton::engines::symbolic::SharedSymbolicExpression> newVector;
+
+      /* Clear memory operands */
+      this->collectUnsymbolizedNodes(inst.operands);
+
+      /* Clear implicit and explicit semantics - MEM */
+      this->collectUnsymbolizedNodes(inst.getLoadAccess());
+
+      /* Clear implicit and explicit semantics - REG */
+      this->collectUnsymbolizedNodes(inst.getReadRegisters());
+
+      /* Clear implicit and explicit semantics - IMM */
+      this->collectUnsymbolizedNodes(inst.getReadImmediates());
+
+      /* Clear implicit and explicit semantics - MEM */
+      this->collectUnsymbolizedNodes(inst.getStoreAccess());
+
+      /* Clear implicit and explicit semantics - REG */
+      this->collectUnsymbolizedNodes(inst.getWrittenRegisters());
+
+      /* Clear symbolic expressions */
+      for (const auto& se : inst.symbolicExpressions) {
+        if (se->isSymbolized() == false) {
+          this->symbolicEngine->removeSymbolicExpression(se);
+        }
+        else
+          newVector.push_back(se);
+      }
+      inst.symbolicExpressions = newVector;
+    }
+
+
+    void IrBuilder::collectAllNodes(triton::arch::Instruction& inst) {
+      /* Memory operands */
+      this->collectNodes(inst.operands);
+
+      /* Implicit and explicit semantics - MEM */
+      this->collectNodes(inst.getLoadAccess());
+
+      /* Implicit and explicit semantics - REG */
+      this->collectNodes(inst.getReadRegisters());
+
+      /* Implicit and explicit semantics - IMM */
+      this->collectNodes(inst.getReadImmediates());
+
+      /* Implicit and explicit semantics - MEM */
+      this->collectNodes(inst.getStoreAccess());
+
+      /* Implicit and explicit semantics - REG */
+      this->collectNodes(inst.getWrittenRegisters());
+
+      /* Symbolic Expressions */
+      this->removeSymbolicExpressions(inst);
+    }
+
+
+    template <typename T>
+    bool IrBuilder::hasSymbolizedNodes(const T& items) const {
+      for (const auto& item : items) {
+        if (std::get<1>(item) && std::get<1>(item)->isSymbolized())
+          return true;
+      }
+      return false;
+    }
+
+
+    bool IrBuilder::hasSymbolizedInputs(triton::arch::Instruction& inst) const {
+      /* The registers of the effective addresses are read registers as well */
+      for (const auto& operand : inst.operands) {
+        if (operand.getType() == triton::arch::OP_MEM) {
+          const auto& lea = operand.getConstMemory().getLeaAst();
+          if (lea && lea->isSymbolized())
+            return true;
+        }
+      }
+
+      return this->hasSymbolizedNodes(inst.getLoadAccess()) || this->hasSymbolizedNodes(inst.getReadRegisters());
+    }
+
+
     template <typename T>
     void IrBuilder::collectNodes(T& items) const {
       items.clear();
@@ -236,15 +813,13 @@ namespace triton {
 
     template <typename T>
     void IrBuilder::collectUnsymbolizedNodes(T& items) const {
-      T newItems;
-
-      for (const auto& item : items) {
-        if (std::get<1>(item) && std::get<1>(item)->isSymbolized() == true)
-          newItems.insert(item);
+      /* Erased in place, the set is not built again */
+      for (auto it = items.begin(); it != items.end();) {
+        if (std::get<1>(*it) && std::get<1>(*it)->isSymbolized() == true)
+          ++it;
+        else
+          it = items.erase(it);
       }
-
-      items.clear();
-      items = newItems;
     }
 
 
@@ -0,0 +1,455 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <triton/cpuInterface.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/persistentDecodeCache.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    /* The layout of the file */
+    static constexpr char           FILE_MAGIC[8] = {'T', 'R', 'I', 'T', 'O', 'N', 'D', 'C'};
+    static constexpr triton::uint32 FILE_VERSION  = 1;
+    static constexpr triton::usize  SLOT_SIZE     = 512;
+    static constexpr triton::usize  MAX_PROBES    = 16;
+
+    /* The states of a slot */
+    static constexpr triton::uint32 SLOT_EMPTY   = 0;
+    static constexpr triton::uint32 SLOT_WRITING = 1;
+    static constexpr triton::uint32 SLOT_READY   = 2;
+
+    /* The flags of a record */
+    static constexpr triton::uint8 FLAG_BRANCH       = (1 << 0);
+    static constexpr triton::uint8 FLAG_CONTROL_FLOW = (1 << 1);
+    static constexpr triton::uint8 FLAG_WRITE_BACK   = (1 << 2);
+    static constexpr triton::uint8 FLAG_UPDATE_FLAG  = (1 << 3);
+
+    struct FileHeader {
+      char           magic[8];
+      triton::uint32 version;
+      triton::uint32 slotSize;
+      triton::uint64 slots;
+      triton::uint32 propertiesSize;
+      triton::uint32 reserved;
+    };
+
+    struct SlotHeader {
+      std::atomic<triton::uint32> state;
+      triton::uint16 payloadSize;
+      triton::uint8  size;
+      triton::uint8  thumb;
+      triton::uint32 arch;
+      triton::uint32 reserved;
+      triton::uint64 address;
+      triton::uint8  opcode[16];
+    };
+
+    static constexpr triton::usize HEADER_SIZE  = 64;
+    static constexpr triton::usize PAYLOAD_SIZE = SLOT_SIZE - sizeof(SlotHeader);
+
+    static_assert(sizeof(FileHeader) <= HEADER_SIZE, "The file header does not fit");
+    static_assert(std::atomic<triton::uint32>::is_always_lock_free, "The slots are shared by processes");
+    static_assert(std::is_trivially_copyable<triton::arch::arm::ArmOperandProperties>::value, "The properties are copied as bytes");
+
+
+    /* Appends the fields of a record to its payload, fails once it does not fit anymore */
+    class PayloadWriter {
+      private:
+        triton::uint8* data;
+        triton::usize offset;
+        bool overflow;
+
+      public:
+        PayloadWriter(triton::uint8* data) : data(data), offset(0), overflow(false) {}
+
+        void bytes(const void* src, triton::usize n) {
+          if (this->overflow || n > PAYLOAD_SIZE - this->offset) {
+            this->overflow = true;
+            return;
+          }
+          std::memcpy(this->data + this->offset, src, n);
+          this->offset += n;
+        }
+
+        template <typename T> void value(T v) {
+          this->bytes(&v, sizeof(T));
+        }
+
+        void properties(const triton::arch::arm::ArmOperandProperties& props) {
+          this->bytes(&props, sizeof(props));
+        }
+
+        void bits(const triton::arch::BitsVector& bv) {
+          this->value<triton::uint32>(bv.getHigh());
+          this->value<triton::uint32>(bv.getLow());
+        }
+
+        void reg(const triton::arch::Register& reg) {
+          this->value<triton::uint32>(reg.getId());
+          this->bits(reg);
+          this->properties(reg);
+        }
+
+        void imm(const triton::arch::Immediate& imm) {
+          this->value<triton::uint64>(imm.getValue());
+          this->bits(imm);
+          this->properties(imm);
+        }
+
+        bool failed(void) const {
+          return this->overflow;
+        }
+
+        triton::usize getSize(void) const {
+          return this->offset;
+        }
+    };
+
+
+    /* Reads back the fields of a payload, fails if it is truncated */
+    class PayloadReader {
+      private:
+        const triton::uint8* data;
+        triton::usize size;
+        triton::usize offset;
+        bool underflow;
+        const triton::arch::CpuInterface& cpu;
+
+      public:
+        PayloadReader(const triton::uint8* data, triton::usize size, const triton::arch::CpuInterface& cpu)
+          : data(data), size(size), offset(0), underflow(false), cpu(cpu) {}
+
+        void bytes(void* dst, triton::usize n) {
+          if (this->underflow || n > this->size - this->offset) {
+            this->underflow = true;
+            std::memset(dst, 0, n);
+            return;
+          }
+          std::memcpy(dst, this->data + this->offset, n);
+          this->offset += n;
+        }
+
+        template <typename T> T value(void) {
+          T v;
+          this->bytes(&v, sizeof(T));
+          return v;
+        }
+
+        void properties(triton::arch::arm::ArmOperandProperties& props) {
+          triton::arch::arm::ArmOperandProperties read;
+          this->bytes(&read, sizeof(read));
+          if (!this->underflow)
+            props = read;
+        }
+
+        void bits(triton::arch::BitsVector& bv) {
+          triton::uint32 high = this->value<triton::uint32>();
+          triton::uint32 low  = this->value<triton::uint32>();
+          if (!this->underflow)
+            bv.setBits(high, low);
+        }
+
+        triton::arch::Register reg(void) {
+          auto id = static_cast<triton::arch::register_e>(this->value<triton::uint32>());
+          triton::arch::Register reg;
+          if (!this->underflow && (id == triton::arch::ID_REG_INVALID || this->cpu.isRegisterValid(id)))
+            reg = triton::arch::Register(this->cpu, id);
+          else
+            this->underflow = true;
+          this->bits(reg);
+          this->properties(reg);
+          return reg;
+        }
+
+        triton::arch::Immediate imm(void) {
+          triton::arch::Immediate imm;
+          triton::uint64 value = this->value<triton::uint64>();
+          imm.setValue(value, triton::size::qword);
+          this->bits(imm);
+          this->properties(imm);
+          return imm;
+        }
+
+        bool failed(void) const {
+          return this->underflow;
+        }
+    };
+
+
+    /* The slot probed first for an instruction */
+    static triton::uint64 hashKey(triton::uint64 address, triton::arch::architecture_e arch, bool thumb) {
+      triton::uint64 h = address ^ (static_cast<triton::uint64>(arch) << 56) ^ (static_cast<triton::uint64>(thumb) << 63);
+      h ^= h >> 33;
+      h *= 0xff51afd7ed558ccdULL;
+      h ^= h >> 33;
+      h *= 0xc4ceb9fe1a85ec53ULL;
+      h ^= h >> 33;
+      return h;
+    }
+
+
+    PersistentDecodeCache::PersistentDecodeCache(const std::string& path, triton::arch::architecture_e arch, const triton::arch::CpuInterface& cpu, triton::usize slots)
+      : cpu(cpu) {
+      this->data  = nullptr;
+      this->size  = 0;
+      this->slots = slots;
+      this->arch  = arch;
+
+      if (slots == 0)
+        throw triton::exceptions::Architecture("PersistentDecodeCache::PersistentDecodeCache(): The cache needs at least one slot.");
+
+      int fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+      if (fd < 0)
+        throw triton::exceptions::Architecture("PersistentDecodeCache::PersistentDecodeCache(): Cannot open " + path);
+
+      /* The first process creates the file, the others wait for its header */
+      if (flock(fd, LOCK_EX) != 0) {
+        close(fd);
+        throw triton::exceptions::Architecture("PersistentDecodeCache::PersistentDecodeCache(): Cannot lock " + path);
+      }
+
+      struct stat st;
+      if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw triton::exceptions::Architecture("PersistentDecodeCache::PersistentDecodeCache(): Cannot get the size of " + path);
+      }
+
+      FileHeader header = {};
+      if (st.st_size == 0) {
+        std::memcpy(header.magic, FILE_MAGIC, sizeof(header.magic));
+        header.version        = FILE_VERSION;
+        header.slotSize       = SLOT_SIZE;
+        header.slots          = slots;
+        header.propertiesSize = sizeof(triton::arch::arm::ArmOperandProperties);
+        /* The slots are zeros, i.e. empty, until they are written */
+        if (ftruncate(fd, HEADER_SIZE + slots * SLOT_SIZE) != 0 || pwrite(fd, &header, sizeof(header), 0) != sizeof(header)) {
+          close(fd);
+          throw triton::exceptions::Architecture("PersistentDecodeCache::PersistentDecodeCache(): Cannot initialize " + path);
+        }
+      }
+      else if (pread(fd, &header, sizeof(header), 0) != sizeof(header) ||
+               std::memcmp(header.magic, FILE_MAGIC, sizeof(header.magic)) != 0 ||
+               header.version != FILE_VERSION ||
+               header.slotSize != SLOT_SIZE ||
+               header.propertiesSize != sizeof(triton::arch::arm::ArmOperandProperties) ||
+               header.slots == 0 ||
+               static_cast<triton::uint64>(st.st_size) != HEADER_SIZE + header.slots * SLOT_SIZE) {
+        close(fd);
+        throw triton::exceptions::Architecture("PersistentDecodeCache::PersistentDecodeCache(): " + path + " is not a decode cache of this build.");
+      }
+
+      /* An existing file keeps its own number of slots */
+      this->slots = static_cast<triton::usize>(header.slots);
+      this->size  = HEADER_SIZE + this->slots * SLOT_SIZE;
+
+      void* area = mmap(nullptr, this->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      close(fd);
+
+      if (area == MAP_FAILED)
+        throw triton::exceptions::Architecture("PersistentDecodeCache::PersistentDecodeCache(): Cannot map " + path);
+      this->data = static_cast<triton::uint8*>(area);
+    }
+
+
+    PersistentDecodeCache::~PersistentDecodeCache() {
+      if (this->data)
+        munmap(this->data, this->size);
+    }
+
+
+    triton::uint8* PersistentDecodeCache::getSlot(triton::usize index) const {
+      return this->data + HEADER_SIZE + (index % this->slots) * SLOT_SIZE;
+    }
+
+
+    triton::usize PersistentDecodeCache::getCapacity(void) const {
+      return this->slots;
+    }
+
+
+    bool PersistentDecodeCache::load(triton::arch::Instruction& inst, bool thumb) const {
+      triton::uint64 hash = hashKey(inst.getAddress(), this->arch, thumb);
+
+      for (triton::usize probe = 0; probe < MAX_PROBES && probe < this->slots; probe++) {
+        triton::uint8* slot = this->getSlot(hash + probe);
+        SlotHeader* entry   = reinterpret_cast<SlotHeader*>(slot);
+
+        triton::uint32 state = entry->state.load(std::memory_order_acquire);
+        if (state == SLOT_EMPTY)
+          return false;
+
+        /* The code at this address may have changed since it was decoded */
+        if (state != SLOT_READY || entry->address != inst.getAddress() || entry->arch != this->arch || entry->thumb != thumb)
+          continue;
+        if (entry->size > inst.getSize() || std::memcmp(entry->opcode, inst.getOpcode(), entry->size) != 0)
+          continue;
+
+        PayloadReader reader(slot + sizeof(SlotHeader), std::min<triton::usize>(entry->payloadSize, PAYLOAD_SIZE), this->cpu);
+
+        triton::uint32 type          = reader.value<triton::uint32>();
+        triton::uint32 prefix        = reader.value<triton::uint32>();
+        triton::uint32 codeCondition = reader.value<triton::uint32>();
+        triton::uint8  flags         = reader.value<triton::uint8>();
+
+        std::string disassembly(reader.value<triton::uint16>(), '\0');
+        reader.bytes(&disassembly[0], disassembly.size());
+
+        std::vector<triton::arch::OperandWrapper> operands;
+        triton::uint8 count = reader.value<triton::uint8>();
+        for (triton::uint8 i = 0; i < count && !reader.failed(); i++) {
+          switch (reader.value<triton::uint8>()) {
+            case triton::arch::OP_IMM:
+              operands.push_back(triton::arch::OperandWrapper(reader.imm()));
+              break;
+
+            case triton::arch::OP_REG:
+              operands.push_back(triton::arch::OperandWrapper(reader.reg()));
+              break;
+
+            case triton::arch::OP_MEM: {
+              triton::arch::MemoryAccess mem;
+              reader.bits(mem);
+              triton::uint64 pcRelative = reader.value<triton::uint64>();
+              if (pcRelative)
+                mem.setPcRelative(pcRelative);
+              mem.setSegmentRegister(reader.reg());
+              mem.setBaseRegister(reader.reg());
+              mem.setIndexRegister(reader.reg());
+              mem.setDisplacement(reader.imm());
+              mem.setScale(reader.imm());
+              operands.push_back(triton::arch::OperandWrapper(mem));
+              break;
+            }
+
+            default:
+              return false;
+          }
+        }
+
+        /* A corrupted record is ignored */
+        if (reader.failed())
+          return false;
+
+        inst.setSize(entry->size);
+        inst.setArchitecture(this->arch);
+        inst.setType(type);
+        inst.setPrefix(static_cast<triton::arch::x86::prefix_e>(prefix));
+        inst.setCodeCondition(static_cast<triton::arch::arm::condition_e>(codeCondition));
+        inst.setBranch(flags & FLAG_BRANCH);
+        inst.setControlFlow(flags & FLAG_CONTROL_FLOW);
+        inst.setWriteBack(flags & FLAG_WRITE_BACK);
+        inst.setUpdateFlag(flags & FLAG_UPDATE_FLAG);
+        inst.setThumb(thumb);
+        inst.setDisassembly(disassembly);
+        inst.operands = std::move(operands);
+
+        return true;
+      }
+
+      return false;
+    }
+
+
+    void PersistentDecodeCache::store(const triton::arch::Instruction& inst, bool thumb) {
+      triton::uint8 payload[PAYLOAD_SIZE];
+      PayloadWriter writer(payload);
+
+      if (inst.getSize() > sizeof(SlotHeader::opcode) || inst.operands.size() > 0xff || inst.getDisassembly().size() > 0xffff)
+        return;
+
+      triton::uint8 flags = 0;
+      flags |= inst.isBranch()      ? FLAG_BRANCH       : 0;
+      flags |= inst.isControlFlow() ? FLAG_CONTROL_FLOW : 0;
+      flags |= inst.isWriteBack()   ? FLAG_WRITE_BACK   : 0;
+      flags |= inst.isUpdateFlag()  ? FLAG_UPDATE_FLAG  : 0;
+
+      writer.value<triton::uint32>(inst.getType());
+      writer.value<triton::uint32>(inst.getPrefix());
+      writer.value<triton::uint32>(inst.getCodeCondition());
+      writer.value<triton::uint8>(flags);
+      writer.value<triton::uint16>(static_cast<triton::uint16>(inst.getDisassembly().size()));
+      writer.bytes(inst.getDisassembly().data(), inst.getDisassembly().size());
+
+      writer.value<triton::uint8>(static_cast<triton::uint8>(inst.operands.size()));
+      for (const auto& op : inst.operands) {
+        writer.value<triton::uint8>(static_cast<triton::uint8>(op.getType()));
+        switch (op.getType()) {
+          case triton::arch::OP_IMM:
+            writer.imm(op.getConstImmediate());
+            break;
+
+          case triton::arch::OP_REG:
+            writer.reg(op.getConstRegister());
+            break;
+
+          case triton::arch::OP_MEM: {
+            const triton::arch::MemoryAccess& mem = op.getConstMemory();
+            writer.bits(mem);
+            writer.value<triton::uint64>(mem.getPcRelative());
+            writer.reg(mem.getConstSegmentRegister());
+            writer.reg(mem.getConstBaseRegister());
+            writer.reg(mem.getConstIndexRegister());
+            writer.imm(mem.getConstDisplacement());
+            writer.imm(mem.getConstScale());
+            break;
+          }
+
+          default:
+            return;
+        }
+      }
+
+      /* Too large to be kept */
+      if (writer.failed())
+        return;
+
+      triton::uint64 hash = hashKey(inst.getAddress(), this->arch, thumb);
+
+      for (triton::usize probe = 0; probe < MAX_PROBES && probe < this->slots; probe++) {
+        triton::uint8* slot = this->getSlot(hash + probe);
+        SlotHeader* entry   = reinterpret_cast<SlotHeader*>(slot);
+
+        triton::uint32 state = entry->state.load(std::memory_order_acquire);
+
+        /* Already recorded, by this process or another one */
+        if (state == SLOT_READY && entry->address == inst.getAddress() && entry->arch == this->arch && entry->thumb == thumb &&
+            entry->size == inst.getSize() && std::memcmp(entry->opcode, inst.getOpcode(), entry->size) == 0)
+          return;
+
+        if (state != SLOT_EMPTY || !entry->state.compare_exchange_strong(state, SLOT_WRITING, std::memory_order_acquire))
+          continue;
+
+        entry->payloadSize = static_cast<triton::uint16>(writer.getSize());
+        entry->size        = static_cast<triton::uint8>(inst.getSize());
+        entry->thumb       = thumb;
+        entry->arch        = this->arch;
+        entry->address     = inst.getAddress();
+        std::memcpy(entry->opcode, inst.getOpcode(), inst.getSize());
+        std::memcpy(slot + sizeof(SlotHeader), payload, writer.getSize());
+
+        /* Published once complete */
+        entry->state.store(SLOT_READY, std::memory_order_release);
+        return;
+      }
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
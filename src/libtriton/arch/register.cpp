@@ -5,6 +5,10 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <mutex>
+#include <type_traits>
+#include <unordered_set>
+
 #include <triton/cpuInterface.hpp>
 #include <triton/register.hpp>
 
@@ -13,40 +17,46 @@
 namespace triton {
   namespace arch {
 
-    Register::Register()
-      : Register(triton::arch::ID_REG_INVALID, "unknown", triton::arch::ID_REG_INVALID, 0, 0, true) {
+    static_assert(std::is_trivially_copyable<Register>::value, "Register must be trivially copyable.");
+
+
+    /* Returns the interned name, which lives until the end of the program */
+    static const std::string* internName(const std::string& name) {
+      static std::mutex lock;
+      static std::unordered_set<std::string> names;
+
+      std::lock_guard<std::mutex> guard(lock);
+      return &*names.insert(name).first;
     }
 
 
-    Register::Register(triton::arch::register_e regId, std::string name, triton::arch::register_e parent, triton::uint32 high, triton::uint32 low, bool vmutable)
-      : BitsVector(high, low),
-        name(name),
-        id(regId),
-        parent(parent),
-        vmutable(vmutable) {
+    /* The name of the invalid register, built by every default register */
+    static const std::string* unknownName(void) {
+      static const std::string* name = internName("unknown");
+      return name;
     }
 
 
-    Register::Register(const triton::arch::CpuInterface& cpu, triton::arch::register_e regId)
-      : Register(
-          (regId == triton::arch::ID_REG_INVALID) ?
-          triton::arch::Register(triton::arch::ID_REG_INVALID, "unknown", triton::arch::ID_REG_INVALID, 0, 0, true) : cpu.getRegister(regId)
-        ) {
+    Register::Register()
+      : BitsVector(0, 0),
+        name(unknownName()),
+        id(triton::arch::ID_REG_INVALID),
+        parent(triton::arch::ID_REG_INVALID),
+        vmutable(true) {
     }
 
 
-    Register::Register(const Register& other)
-      : BitsVector(other),
-        ArmOperandProperties(other) {
-      this->copy(other);
+    Register::Register(triton::arch::register_e regId, const std::string& name, triton::arch::register_e parent, triton::uint32 high, triton::uint32 low, bool vmutable)
+      : BitsVector(high, low),
+        name(internName(name)),
+        id(regId),
+        parent(parent),
+        vmutable(vmutable) {
     }
 
 
-    void Register::copy(const Register& other) {
-      this->id       = other.id;
-      this->name     = other.name;
-      this->parent   = other.parent;
-      this->vmutable = other.vmutable;
+    Register::Register(const triton::arch::CpuInterface& cpu, triton::arch::register_e regId)
+      : Register((regId == triton::arch::ID_REG_INVALID) ? triton::arch::Register() : cpu.getRegister(regId)) {
     }
 
 
@@ -72,9 +82,9 @@ namespace triton {
 
     std::string Register::getName(void) const {
       if (this->getVASType()) {
-        return this->name + "." + this->getVASName();
+        return *this->name + "." + this->getVASName();
       }
-      return this->name;
+      return *this->name;
     }
 
 
@@ -107,14 +117,6 @@ namespace triton {
     }
 
 
-    Register& Register::operator=(const Register& other) {
-      ArmOperandProperties::operator=(other);
-      BitsVector::operator=(other);
-      this->copy(other);
-      return *this;
-    }
-
-
     std::ostream& operator<<(std::ostream& stream, const Register& reg) {
       stream << reg.getName()
              << ":"
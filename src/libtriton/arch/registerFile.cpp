@@ -0,0 +1,72 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+
+#include <triton/cpuSize.hpp>
+#include <triton/registerFile.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    /* Returns the mask of the `bitSize` lowest bits of a 64-bit word */
+    static inline triton::uint64 lowMask(triton::uint32 bitSize) {
+      if (bitSize >= triton::bitsize::qword)
+        return ~static_cast<triton::uint64>(0);
+      return (static_cast<triton::uint64>(1) << bitSize) - 1;
+    }
+
+
+    triton::uint512 RegisterSlot::read(const triton::uint8* file) const {
+      /* Registers stored in at most 64 bits are read with a single native load */
+      if (this->size <= triton::size::qword) {
+        triton::uint64 value = 0;
+        std::memcpy(&value, file + this->offset, this->size);
+        return (value >> this->low) & lowMask(this->bitSize);
+      }
+
+      /* Wider registers are byte aligned in their parent and are read by 64-bit limbs */
+      triton::uint64 limbs[triton::size::dqqword / triton::size::qword] = {0};
+      triton::uint32 bytes = this->bitSize / triton::bitsize::byte;
+      std::memcpy(limbs, file + this->offset + this->low / triton::bitsize::byte, bytes);
+
+      triton::uint512 value = 0;
+      for (triton::uint32 i = (bytes + triton::size::qword - 1) / triton::size::qword; i > 0; i--) {
+        value <<= triton::bitsize::qword;
+        value |= limbs[i - 1];
+      }
+
+      return value;
+    }
+
+
+    void RegisterSlot::write(triton::uint8* file, const triton::uint512& value) const {
+      if (this->size <= triton::size::qword) {
+        triton::uint64 mask = lowMask(this->bitSize) << this->low;
+        triton::uint64 area = 0;
+        std::memcpy(&area, file + this->offset, this->size);
+        area = (area & ~mask) | ((static_cast<triton::uint64>(value) << this->low) & mask);
+        std::memcpy(file + this->offset, &area, this->size);
+        return;
+      }
+
+      triton::uint64 limbs[triton::size::dqqword / triton::size::qword] = {0};
+      triton::uint32 bytes = this->bitSize / triton::bitsize::byte;
+      triton::uint512 tmp = value;
+
+      for (triton::uint32 i = 0; i < (bytes + triton::size::qword - 1) / triton::size::qword; i++) {
+        limbs[i] = static_cast<triton::uint64>(tmp);
+        tmp >>= triton::bitsize::qword;
+      }
+
+      std::memcpy(file + this->offset + this->low / triton::bitsize::byte, limbs, bytes);
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
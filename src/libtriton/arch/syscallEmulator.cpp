@@ -0,0 +1,652 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+
+#include <triton/aarch64Specifications.hpp>
+#include <triton/astContext.hpp>
+#include <triton/concreteMemory.hpp>
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/memoryAccess.hpp>
+#include <triton/syscallEmulator.hpp>
+#include <triton/x86Specifications.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    /* The numbers of the emulated calls, as in the Linux headers of each ABI */
+    static const std::unordered_map<triton::uint64, SyscallEmulator::syscall_e> x8664Numbers = {
+      {0,   SyscallEmulator::SYSCALL_READ},
+      {1,   SyscallEmulator::SYSCALL_WRITE},
+      {2,   SyscallEmulator::SYSCALL_OPEN},
+      {3,   SyscallEmulator::SYSCALL_CLOSE},
+      {8,   SyscallEmulator::SYSCALL_LSEEK},
+      {9,   SyscallEmulator::SYSCALL_MMAP},
+      {10,  SyscallEmulator::SYSCALL_MPROTECT},
+      {11,  SyscallEmulator::SYSCALL_MUNMAP},
+      {12,  SyscallEmulator::SYSCALL_BRK},
+      {39,  SyscallEmulator::SYSCALL_GETPID},
+      {60,  SyscallEmulator::SYSCALL_EXIT},
+      {96,  SyscallEmulator::SYSCALL_GETTIMEOFDAY},
+      {102, SyscallEmulator::SYSCALL_GETUID},
+      {104, SyscallEmulator::SYSCALL_GETGID},
+      {107, SyscallEmulator::SYSCALL_GETEUID},
+      {108, SyscallEmulator::SYSCALL_GETEGID},
+      {201, SyscallEmulator::SYSCALL_TIME},
+      {228, SyscallEmulator::SYSCALL_CLOCK_GETTIME},
+      {231, SyscallEmulator::SYSCALL_EXIT_GROUP},
+      {257, SyscallEmulator::SYSCALL_OPENAT},
+    };
+
+    static const std::unordered_map<triton::uint64, SyscallEmulator::syscall_e> i386Numbers = {
+      {1,   SyscallEmulator::SYSCALL_EXIT},
+      {3,   SyscallEmulator::SYSCALL_READ},
+      {4,   SyscallEmulator::SYSCALL_WRITE},
+      {5,   SyscallEmulator::SYSCALL_OPEN},
+      {6,   SyscallEmulator::SYSCALL_CLOSE},
+      {13,  SyscallEmulator::SYSCALL_TIME},
+      {19,  SyscallEmulator::SYSCALL_LSEEK},
+      {20,  SyscallEmulator::SYSCALL_GETPID},
+      {45,  SyscallEmulator::SYSCALL_BRK},
+      {78,  SyscallEmulator::SYSCALL_GETTIMEOFDAY},
+      {91,  SyscallEmulator::SYSCALL_MUNMAP},
+      {125, SyscallEmulator::SYSCALL_MPROTECT},
+      {192, SyscallEmulator::SYSCALL_MMAP2},
+      {199, SyscallEmulator::SYSCALL_GETUID},
+      {200, SyscallEmulator::SYSCALL_GETGID},
+      {201, SyscallEmulator::SYSCALL_GETEUID},
+      {202, SyscallEmulator::SYSCALL_GETEGID},
+      {252, SyscallEmulator::SYSCALL_EXIT_GROUP},
+      {265, SyscallEmulator::SYSCALL_CLOCK_GETTIME},
+      {295, SyscallEmulator::SYSCALL_OPENAT},
+    };
+
+    static const std::unordered_map<triton::uint64, SyscallEmulator::syscall_e> aarch64Numbers = {
+      {56,  SyscallEmulator::SYSCALL_OPENAT},
+      {57,  SyscallEmulator::SYSCALL_CLOSE},
+      {62,  SyscallEmulator::SYSCALL_LSEEK},
+      {63,  SyscallEmulator::SYSCALL_READ},
+      {64,  SyscallEmulator::SYSCALL_WRITE},
+      {93,  SyscallEmulator::SYSCALL_EXIT},
+      {94,  SyscallEmulator::SYSCALL_EXIT_GROUP},
+      {113, SyscallEmulator::SYSCALL_CLOCK_GETTIME},
+      {169, SyscallEmulator::SYSCALL_GETTIMEOFDAY},
+      {172, SyscallEmulator::SYSCALL_GETPID},
+      {174, SyscallEmulator::SYSCALL_GETUID},
+      {175, SyscallEmulator::SYSCALL_GETEUID},
+      {176, SyscallEmulator::SYSCALL_GETGID},
+      {177, SyscallEmulator::SYSCALL_GETEGID},
+      {214, SyscallEmulator::SYSCALL_BRK},
+      {215, SyscallEmulator::SYSCALL_MUNMAP},
+      {222, SyscallEmulator::SYSCALL_MMAP},
+      {226, SyscallEmulator::SYSCALL_MPROTECT},
+    };
+
+    /* The errors and flags of the calls, the same on the three ABIs */
+    static const triton::uint64 LINUX_ENOENT        = 2;
+    static const triton::uint64 LINUX_EBADF         = 9;
+    static const triton::uint64 LINUX_EINVAL        = 22;
+    static const triton::uint64 LINUX_ENOSYS        = 38;
+    static const triton::uint64 LINUX_O_CREAT       = 0x40;
+    static const triton::uint64 LINUX_O_TRUNC       = 0x200;
+    static const triton::uint64 LINUX_O_APPEND      = 0x400;
+    static const triton::uint64 LINUX_MAP_FIXED     = 0x10;
+    static const triton::uint64 LINUX_MAP_ANONYMOUS = 0x20;
+    static const triton::uint64 LINUX_SEEK_SET      = 0;
+    static const triton::uint64 LINUX_SEEK_CUR      = 1;
+    static const triton::uint64 LINUX_SEEK_END      = 2;
+
+    /* The identity of the emulated process */
+    static const triton::uint64 PROCESS_ID          = 1000;
+    static const triton::uint64 USER_ID             = 1000;
+
+    /* The default heap and mappings, when not set by the loader */
+    static const triton::uint64 HEAP_BASE           = 0x10000000;
+    static const triton::uint64 MMAP_BASE_32        = 0x40000000;
+    static const triton::uint64 MMAP_BASE_64        = 0x7fff00000000;
+
+    /* Rounds up to the next page */
+    static triton::uint64 pageUp(triton::uint64 value) {
+      return (value + ConcreteMemory::pageSize - 1) & ~static_cast<triton::uint64>(ConcreteMemory::pageSize - 1);
+    }
+
+
+    SyscallEmulator::SyscallEmulator(triton::arch::Architecture* architecture,
+                                     const triton::ast::SharedAstContext& astCtxt,
+                                     triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                     triton::engines::taint::TaintEngine* taintEngine)
+      : astCtxt(astCtxt) {
+
+      this->architecture   = architecture;
+      this->enabled        = false;
+      this->symbolicEngine = symbolicEngine;
+      this->taintEngine    = taintEngine;
+
+      this->files["/dev/stdin"].symbolic  = false;
+      this->files["/dev/stdout"].symbolic = false;
+      this->files["/dev/stderr"].symbolic = false;
+
+      this->reset();
+    }
+
+
+    void SyscallEmulator::enable(bool flag) {
+      this->enabled = flag;
+    }
+
+
+    bool SyscallEmulator::isEnabled(void) const {
+      return this->enabled;
+    }
+
+
+    void SyscallEmulator::addFile(const std::string& path, const std::vector<triton::uint8>& data, bool symbolic) {
+      File& file    = this->files[path];
+      file.data     = data;
+      file.symbolic = symbolic;
+      file.variables.clear();
+    }
+
+
+    const std::vector<triton::uint8>& SyscallEmulator::getFile(const std::string& path) const {
+      auto it = this->files.find(path);
+      if (it == this->files.end())
+        throw triton::exceptions::Architecture("SyscallEmulator::getFile(): No such file.");
+      return it->second.data;
+    }
+
+
+    std::vector<std::string> SyscallEmulator::getFiles(void) const {
+      std::vector<std::string> ret;
+
+      for (const auto& file : this->files)
+        ret.push_back(file.first);
+
+      return ret;
+    }
+
+
+    void SyscallEmulator::setHandler(triton::uint64 number, const Handler& handler) {
+      this->handlers[number] = handler;
+    }
+
+
+    void SyscallEmulator::removeHandler(triton::uint64 number) {
+      this->handlers.erase(number);
+    }
+
+
+    void SyscallEmulator::setProgramBreak(triton::uint64 addr) {
+      this->heapBase     = addr;
+      this->programBreak = addr;
+    }
+
+
+    triton::uint64 SyscallEmulator::getProgramBreak(void) const {
+      return this->programBreak;
+    }
+
+
+    bool SyscallEmulator::hasExited(void) const {
+      return this->exited;
+    }
+
+
+    triton::uint64 SyscallEmulator::getExitStatus(void) const {
+      return this->exitStatus;
+    }
+
+
+    void SyscallEmulator::reset(void) {
+      this->descriptors.clear();
+      this->descriptors[0] = {"/dev/stdin", 0, false};
+      this->descriptors[1] = {"/dev/stdout", 0, true};
+      this->descriptors[2] = {"/dev/stderr", 0, true};
+
+      this->heapBase     = 0;
+      this->programBreak = 0;
+      this->mmapBase     = 0;
+      this->clock        = 0;
+      this->exited       = false;
+      this->exitStatus   = 0;
+    }
+
+
+    bool SyscallEmulator::getSyscall(triton::uint64 number, syscall_e& syscall) const {
+      const std::unordered_map<triton::uint64, syscall_e>* numbers = nullptr;
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_AARCH64: numbers = &aarch64Numbers; break;
+        case triton::arch::ARCH_X86:     numbers = &i386Numbers;    break;
+        case triton::arch::ARCH_X86_64:  numbers = &x8664Numbers;   break;
+        default:
+          return false;
+      }
+
+      auto it = numbers->find(number);
+      if (it == numbers->end())
+        return false;
+
+      syscall = it->second;
+      return true;
+    }
+
+
+    const triton::arch::Register& SyscallEmulator::getNumberRegister(void) const {
+      if (this->architecture->getArchitecture() == triton::arch::ARCH_AARCH64)
+        return this->architecture->getRegister(ID_REG_AARCH64_X8);
+      return this->architecture->getParentRegister(ID_REG_X86_EAX);
+    }
+
+
+    triton::uint64 SyscallEmulator::getArgument(triton::uint32 index) const {
+      static const triton::arch::register_e aarch64[] = {ID_REG_AARCH64_X0, ID_REG_AARCH64_X1, ID_REG_AARCH64_X2, ID_REG_AARCH64_X3, ID_REG_AARCH64_X4, ID_REG_AARCH64_X5};
+      static const triton::arch::register_e i386[]    = {ID_REG_X86_EBX, ID_REG_X86_ECX, ID_REG_X86_EDX, ID_REG_X86_ESI, ID_REG_X86_EDI, ID_REG_X86_EBP};
+      static const triton::arch::register_e x8664[]   = {ID_REG_X86_RDI, ID_REG_X86_RSI, ID_REG_X86_RDX, ID_REG_X86_R10, ID_REG_X86_R8, ID_REG_X86_R9};
+
+      triton::arch::register_e reg = ID_REG_INVALID;
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_AARCH64: reg = aarch64[index]; break;
+        case triton::arch::ARCH_X86:     reg = i386[index];    break;
+        default:                         reg = x8664[index];   break;
+      }
+
+      return static_cast<triton::uint64>(this->architecture->getConcreteRegisterValue(this->architecture->getRegister(reg)));
+    }
+
+
+    void SyscallEmulator::setResult(triton::uint64 value) {
+      const triton::arch::Register& reg = (this->architecture->getArchitecture() == triton::arch::ARCH_AARCH64)
+                                          ? this->architecture->getRegister(ID_REG_AARCH64_X0)
+                                          : this->architecture->getParentRegister(ID_REG_X86_EAX);
+
+      if (reg.getBitSize() < triton::bitsize::qword)
+        value &= (static_cast<triton::uint64>(1) << reg.getBitSize()) - 1;
+
+      this->architecture->setConcreteRegisterValue(reg, value);
+      this->symbolicEngine->concretizeRegister(reg);
+      this->taintEngine->untaintRegister(reg);
+    }
+
+
+    triton::uint64 SyscallEmulator::getError(triton::uint64 error) const {
+      /* Masked to the return register by setResult() */
+      return static_cast<triton::uint64>(0) - error;
+    }
+
+
+    std::string SyscallEmulator::getString(triton::uint64 addr) const {
+      std::string ret;
+
+      for (triton::uint8 c = this->architecture->getConcreteMemoryValue(addr); c != 0; c = this->architecture->getConcreteMemoryValue(++addr))
+        ret.push_back(static_cast<char>(c));
+
+      return ret;
+    }
+
+
+    void SyscallEmulator::loadFile(const std::string& path, triton::uint64 offset, triton::uint64 addr, triton::usize size) {
+      File& file = this->files[path];
+
+      this->architecture->setConcreteMemoryAreaValue(addr, file.data.data() + offset, size);
+
+      for (triton::uint64 cell : this->symbolicEngine->getSymbolicMemoryAddresses(addr, size))
+        this->symbolicEngine->concretizeMemory(cell);
+
+      if (file.symbolic == false) {
+        this->taintEngine->untaintMemoryRange(addr, size);
+        return;
+      }
+
+      /* A byte read again keeps the variable of its first read */
+      for (triton::usize index = 0; index < size; index++) {
+        triton::arch::MemoryAccess mem(addr + index, triton::size::byte);
+        auto it = file.variables.find(offset + index);
+
+        if (it == file.variables.end()) {
+          auto var = this->symbolicEngine->symbolizeMemory(mem);
+          var->setComment(path + "[" + std::to_string(offset + index) + "]");
+          file.variables[offset + index] = var;
+        }
+        else {
+          const auto& expr = this->symbolicEngine->newSymbolicExpression(this->astCtxt->variable(it->second), triton::engines::symbolic::MEMORY_EXPRESSION, "Read from " + path);
+          this->symbolicEngine->assignSymbolicExpressionToMemory(expr, mem);
+        }
+      }
+
+      this->taintEngine->taintMemoryRange(addr, size);
+    }
+
+
+    void SyscallEmulator::mapZero(triton::uint64 addr, triton::usize size) {
+      this->architecture->mapConcreteMemoryArea(addr, nullptr, size, nullptr);
+
+      for (triton::uint64 cell : this->symbolicEngine->getSymbolicMemoryAddresses(addr, size))
+        this->symbolicEngine->concretizeMemory(cell);
+
+      this->taintEngine->untaintMemoryRange(addr, size);
+    }
+
+
+    triton::uint64 SyscallEmulator::getFreeDescriptor(void) const {
+      triton::uint64 fd = 0;
+
+      for (const auto& descriptor : this->descriptors) {
+        if (descriptor.first != fd)
+          break;
+        fd++;
+      }
+
+      return fd;
+    }
+
+
+    triton::uint64 SyscallEmulator::brk(void) {
+      triton::uint64 addr = this->getArgument(0);
+
+      if (this->heapBase == 0)
+        this->setProgramBreak(HEAP_BASE);
+
+      /* brk(0) and the breaks below the heap only query the current one */
+      if (addr < this->heapBase)
+        return this->programBreak;
+
+      triton::uint64 end = pageUp(this->programBreak);
+      if (pageUp(addr) > end)
+        this->mapZero(end, pageUp(addr) - end);
+
+      this->programBreak = addr;
+      return addr;
+    }
+
+
+    triton::uint64 SyscallEmulator::clockGettime(void) {
+      triton::uint64 tp   = this->getArgument(1);
+      triton::uint32 size = this->architecture->gprSize();
+      triton::uint64 now  = this->clock++;
+
+      /* struct timespec { time_t tv_sec; long tv_nsec; } */
+      this->architecture->setConcreteMemoryValue(MemoryAccess(tp, size), now / 1000000);
+      this->architecture->setConcreteMemoryValue(MemoryAccess(tp + size, size), (now % 1000000) * 1000);
+      this->symbolicEngine->concretizeMemory(MemoryAccess(tp, 2 * size));
+      this->taintEngine->untaintMemoryRange(tp, 2 * size);
+
+      return 0;
+    }
+
+
+    triton::uint64 SyscallEmulator::close(void) {
+      if (this->descriptors.erase(this->getArgument(0)) == 0)
+        return this->getError(LINUX_EBADF);
+      return 0;
+    }
+
+
+    triton::uint64 SyscallEmulator::gettimeofday(void) {
+      triton::uint64 tv   = this->getArgument(0);
+      triton::uint32 size = this->architecture->gprSize();
+      triton::uint64 now  = this->clock++;
+
+      /* struct timeval { time_t tv_sec; suseconds_t tv_usec; } */
+      if (tv != 0) {
+        this->architecture->setConcreteMemoryValue(MemoryAccess(tv, size), now / 1000000);
+        this->architecture->setConcreteMemoryValue(MemoryAccess(tv + size, size), now % 1000000);
+        this->symbolicEngine->concretizeMemory(MemoryAccess(tv, 2 * size));
+        this->taintEngine->untaintMemoryRange(tv, 2 * size);
+      }
+
+      return 0;
+    }
+
+
+    triton::uint64 SyscallEmulator::lseek(void) {
+      auto it = this->descriptors.find(this->getArgument(0));
+      if (it == this->descriptors.end())
+        return this->getError(LINUX_EBADF);
+
+      triton::uint64 offset = this->getArgument(1);
+      triton::uint64 whence = this->getArgument(2);
+      triton::uint64 base   = 0;
+
+      /* The offset is signed, in the size of the registers */
+      if (this->architecture->gprSize() == triton::size::dword)
+        offset = static_cast<triton::uint64>(static_cast<triton::sint64>(static_cast<triton::sint32>(offset)));
+
+      switch (whence) {
+        case LINUX_SEEK_SET: base = 0;                                            break;
+        case LINUX_SEEK_CUR: base = it->second.offset;                            break;
+        case LINUX_SEEK_END: base = this->files[it->second.path].data.size();     break;
+        default:
+          return this->getError(LINUX_EINVAL);
+      }
+
+      if (static_cast<triton::sint64>(base + offset) < 0)
+        return this->getError(LINUX_EINVAL);
+
+      it->second.offset = base + offset;
+      return it->second.offset;
+    }
+
+
+    triton::uint64 SyscallEmulator::mmap(triton::uint64 pageOffset) {
+      triton::uint64 addr   = this->getArgument(0);
+      triton::uint64 length = this->getArgument(1);
+      triton::uint64 flags  = this->getArgument(3);
+      triton::uint64 fd     = this->getArgument(4);
+      triton::uint64 offset = this->getArgument(5) * pageOffset;
+      triton::uint64 size   = pageUp(length);
+      triton::uint64 base   = 0;
+
+      if (length == 0)
+        return this->getError(LINUX_EINVAL);
+
+      const Descriptor* descriptor = nullptr;
+      if ((flags & LINUX_MAP_ANONYMOUS) == 0) {
+        auto it = this->descriptors.find(fd);
+        if (it == this->descriptors.end())
+          return this->getError(LINUX_EBADF);
+        descriptor = &it->second;
+      }
+
+      if (flags & LINUX_MAP_FIXED) {
+        if (addr % ConcreteMemory::pageSize)
+          return this->getError(LINUX_EINVAL);
+        base = addr;
+      }
+      else {
+        if (this->mmapBase == 0)
+          this->mmapBase = (this->architecture->gprSize() == triton::size::qword) ? MMAP_BASE_64 : MMAP_BASE_32;
+        base = this->mmapBase;
+        this->mmapBase += size;
+      }
+
+      this->mapZero(base, size);
+
+      /* The file is read from the offset, the rest of the mapping stays zero */
+      if (descriptor != nullptr) {
+        const File& file = this->files[descriptor->path];
+        if (offset < file.data.size())
+          this->loadFile(descriptor->path, offset, base, std::min<triton::uint64>(length, file.data.size() - offset));
+      }
+
+      return base;
+    }
+
+
+    triton::uint64 SyscallEmulator::munmap(void) {
+      triton::uint64 addr = this->getArgument(0);
+      triton::uint64 size = pageUp(this->getArgument(1));
+
+      if (addr % ConcreteMemory::pageSize)
+        return this->getError(LINUX_EINVAL);
+
+      for (triton::uint64 cell : this->symbolicEngine->getSymbolicMemoryAddresses(addr, size))
+        this->symbolicEngine->concretizeMemory(cell);
+
+      this->architecture->clearConcreteMemoryValue(addr, size);
+      this->taintEngine->untaintMemoryRange(addr, size);
+
+      return 0;
+    }
+
+
+    triton::uint64 SyscallEmulator::open(const std::string& path, triton::uint64 flags) {
+      auto it = this->files.find(path);
+
+      if (it == this->files.end()) {
+        if ((flags & LINUX_O_CREAT) == 0)
+          return this->getError(LINUX_ENOENT);
+        it = this->files.emplace(path, File{{}, false, {}}).first;
+      }
+      else if (flags & LINUX_O_TRUNC) {
+        it->second.data.clear();
+      }
+
+      triton::uint64 fd = this->getFreeDescriptor();
+      this->descriptors[fd] = {path, 0, (flags & LINUX_O_APPEND) != 0};
+
+      return fd;
+    }
+
+
+    triton::uint64 SyscallEmulator::read(void) {
+      auto it = this->descriptors.find(this->getArgument(0));
+      if (it == this->descriptors.end())
+        return this->getError(LINUX_EBADF);
+
+      Descriptor& descriptor = it->second;
+      triton::uint64 buf     = this->getArgument(1);
+      triton::uint64 count   = this->getArgument(2);
+      const File& file       = this->files[descriptor.path];
+
+      if (descriptor.offset >= file.data.size())
+        return 0;
+
+      triton::uint64 size = std::min<triton::uint64>(count, file.data.size() - descriptor.offset);
+      this->loadFile(descriptor.path, descriptor.offset, buf, size);
+      descriptor.offset += size;
+
+      return size;
+    }
+
+
+    triton::uint64 SyscallEmulator::time(void) {
+      triton::uint64 tloc = this->getArgument(0);
+      triton::uint64 now  = (this->clock++) / 1000000;
+
+      if (tloc != 0) {
+        MemoryAccess mem(tloc, this->architecture->gprSize());
+        this->architecture->setConcreteMemoryValue(mem, now);
+        this->symbolicEngine->concretizeMemory(mem);
+        this->taintEngine->untaintMemory(mem);
+      }
+
+      return now;
+    }
+
+
+    triton::uint64 SyscallEmulator::write(void) {
+      auto it = this->descriptors.find(this->getArgument(0));
+      if (it == this->descriptors.end())
+        return this->getError(LINUX_EBADF);
+
+      Descriptor& descriptor = it->second;
+      triton::uint64 count   = this->getArgument(2);
+      File& file             = this->files[descriptor.path];
+
+      /* The concrete values of the symbolic bytes are written */
+      std::vector<triton::uint8> data = this->architecture->getConcreteMemoryAreaValue(this->getArgument(1), count);
+
+      if (descriptor.append)
+        descriptor.offset = file.data.size();
+
+      if (file.data.size() < descriptor.offset + count)
+        file.data.resize(descriptor.offset + count);
+
+      std::copy(data.begin(), data.end(), file.data.begin() + descriptor.offset);
+      descriptor.offset += count;
+
+      return count;
+    }
+
+
+    bool SyscallEmulator::apply(const triton::arch::Instruction& inst) {
+      if (this->enabled == false)
+        return false;
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_AARCH64:
+          if (inst.getType() != triton::arch::arm::aarch64::ID_INS_SVC)
+            return false;
+          break;
+
+        case triton::arch::ARCH_X86:
+          if (inst.getType() != triton::arch::x86::ID_INS_INT || inst.operands.size() != 1 || inst.operands[0].getType() != triton::arch::OP_IMM || inst.operands[0].getConstImmediate().getValue() != 0x80)
+            return false;
+          break;
+
+        case triton::arch::ARCH_X86_64:
+          if (inst.getType() != triton::arch::x86::ID_INS_SYSCALL)
+            return false;
+          break;
+
+        default:
+          return false;
+      }
+
+      triton::uint64 number = static_cast<triton::uint64>(this->architecture->getConcreteRegisterValue(this->getNumberRegister()));
+
+      /* Only the overridden calls leave the native code */
+      auto handler = this->handlers.find(number);
+      if (handler != this->handlers.end()) {
+        this->setResult(handler->second(number));
+        return true;
+      }
+
+      syscall_e syscall;
+      if (this->getSyscall(number, syscall) == false) {
+        this->setResult(this->getError(LINUX_ENOSYS));
+        return true;
+      }
+
+      switch (syscall) {
+        case SYSCALL_BRK:           this->setResult(this->brk());                                                break;
+        case SYSCALL_CLOCK_GETTIME: this->setResult(this->clockGettime());                                       break;
+        case SYSCALL_CLOSE:         this->setResult(this->close());                                              break;
+        case SYSCALL_GETEGID:       this->setResult(USER_ID);                                                    break;
+        case SYSCALL_GETEUID:       this->setResult(USER_ID);                                                    break;
+        case SYSCALL_GETGID:        this->setResult(USER_ID);                                                    break;
+        case SYSCALL_GETPID:        this->setResult(PROCESS_ID);                                                 break;
+        case SYSCALL_GETTIMEOFDAY:  this->setResult(this->gettimeofday());                                       break;
+        case SYSCALL_GETUID:        this->setResult(USER_ID);                                                    break;
+        case SYSCALL_LSEEK:         this->setResult(this->lseek());                                              break;
+        case SYSCALL_MMAP:          this->setResult(this->mmap(1));                                              break;
+        case SYSCALL_MMAP2:         this->setResult(this->mmap(ConcreteMemory::pageSize));                       break;
+        case SYSCALL_MPROTECT:      this->setResult(0);                                                          break;
+        case SYSCALL_MUNMAP:        this->setResult(this->munmap());                                             break;
+        case SYSCALL_OPEN:          this->setResult(this->open(this->getString(this->getArgument(0)), this->getArgument(1))); break;
+        case SYSCALL_OPENAT:        this->setResult(this->open(this->getString(this->getArgument(1)), this->getArgument(2))); break;
+        case SYSCALL_READ:          this->setResult(this->read());                                               break;
+        case SYSCALL_TIME:          this->setResult(this->time());                                               break;
+        case SYSCALL_WRITE:         this->setResult(this->write());                                              break;
+
+        /* The process stops, the return register is left as is */
+        case SYSCALL_EXIT:
+        case SYSCALL_EXIT_GROUP:
+          this->exited     = true;
+          this->exitStatus = this->getArgument(0);
+          break;
+      }
+
+      return true;
+    }
+
+  };
+};
@@ -0,0 +1,825 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/x86ConcreteSemantics.hpp>
+#include <triton/x86Specifications.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+    namespace x86 {
+
+      /* Returns the mask of a value of bitSize bits */
+      static inline triton::uint64 maskOf(triton::uint32 bitSize) {
+        return (bitSize >= triton::bitsize::qword) ? static_cast<triton::uint64>(-1) : ((static_cast<triton::uint64>(1) << bitSize) - 1);
+      }
+
+
+      /* Returns the most significant bit of a value of bitSize bits */
+      static inline bool msbOf(triton::uint64 value, triton::uint32 bitSize) {
+        return ((value >> (bitSize - 1)) & 1) != 0;
+      }
+
+
+      /* Sign extends a value of bitSize bits to 64 bits */
+      static inline triton::uint64 signExtend(triton::uint64 value, triton::uint32 bitSize) {
+        if (bitSize >= triton::bitsize::qword || msbOf(value, bitSize) == false)
+          return value;
+        return value | ~maskOf(bitSize);
+      }
+
+
+      x86ConcreteSemantics::x86ConcreteSemantics(triton::arch::Architecture* architecture,
+                                                 triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                                 triton::engines::taint::TaintEngine* taintEngine,
+                                                 const triton::modes::SharedModes& modes) : modes(modes) {
+
+        this->architecture    = architecture;
+        this->symbolicEngine  = symbolicEngine;
+        this->taintEngine     = taintEngine;
+
+        if (architecture == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The architecture API must be defined.");
+
+        if (this->symbolicEngine == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The symbolic engine API must be defined.");
+
+        if (this->taintEngine == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The taint engines API must be defined.");
+      }
+
+
+      bool x86ConcreteSemantics::emulate(triton::arch::Instruction& inst) {
+        bool emulated = false;
+        bool branch   = true;
+
+        /* Concrete path constraints are only dropped by the path manager when tracking the symbolic or tainted ones */
+        bool tracking = this->modes->isModeEnabled(triton::modes::PC_TRACKING_SYMBOLIC) || this->modes->isModeEnabled(triton::modes::ONLY_ON_TAINTED);
+
+        /* Repeated and locked instructions go through the semantics */
+        if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID)
+          return false;
+
+        this->registers.clear();
+        this->stores.clear();
+        this->undefined.clear();
+
+        /* Branches write the program counter themselves */
+        switch (inst.getType()) {
+          case ID_INS_JA:
+          case ID_INS_JAE:
+          case ID_INS_JB:
+          case ID_INS_JBE:
+          case ID_INS_JE:
+          case ID_INS_JG:
+          case ID_INS_JGE:
+          case ID_INS_JL:
+          case ID_INS_JLE:
+          case ID_INS_JNE:
+          case ID_INS_JNO:
+          case ID_INS_JNP:
+          case ID_INS_JNS:
+          case ID_INS_JO:
+          case ID_INS_JP:
+          case ID_INS_JS:
+            emulated = tracking && this->jcc_s(inst);
+            break;
+
+          case ID_INS_CALL: emulated = tracking && this->call_s(inst); break;
+          case ID_INS_JMP:  emulated = tracking && this->jmp_s(inst);  break;
+          case ID_INS_RET:  emulated = tracking && this->ret_s(inst);  break;
+
+          default:
+            branch = false;
+            break;
+        }
+
+        if (branch == false) {
+          switch (inst.getType()) {
+            case ID_INS_ADD:
+            case ID_INS_AND:
+            case ID_INS_CMP:
+            case ID_INS_OR:
+            case ID_INS_SUB:
+            case ID_INS_TEST:
+            case ID_INS_XOR:
+              emulated = this->alu_s(inst);
+              break;
+
+            case ID_INS_DEC:
+            case ID_INS_INC:
+            case ID_INS_NEG:
+            case ID_INS_NOT:
+              emulated = this->unary_s(inst);
+              break;
+
+            case ID_INS_MOV:
+            case ID_INS_MOVSX:
+            case ID_INS_MOVSXD:
+            case ID_INS_MOVZX:
+              emulated = this->mov_s(inst);
+              break;
+
+            case ID_INS_LEA:  emulated = this->lea_s(inst);  break;
+            case ID_INS_NOP:  emulated = true;               break;
+            case ID_INS_POP:  emulated = this->pop_s(inst);  break;
+            case ID_INS_PUSH: emulated = this->push_s(inst); break;
+
+            default:
+              break;
+          }
+
+          /* Then the program counter moves to the next instruction */
+          if (emulated)
+            this->writeRegister(this->architecture->getProgramCounter(), inst.getNextAddress());
+        }
+
+        if (emulated == false)
+          return false;
+
+        this->commit(inst);
+        return true;
+      }
+
+
+      bool x86ConcreteSemantics::isGpr(const triton::arch::Register& reg) const {
+        if (reg.getLow() != 0)
+          return false;
+
+        switch (reg.getParent()) {
+          case triton::arch::ID_REG_X86_RAX:
+          case triton::arch::ID_REG_X86_RBX:
+          case triton::arch::ID_REG_X86_RCX:
+          case triton::arch::ID_REG_X86_RDX:
+          case triton::arch::ID_REG_X86_RDI:
+          case triton::arch::ID_REG_X86_RSI:
+          case triton::arch::ID_REG_X86_RBP:
+          case triton::arch::ID_REG_X86_RSP:
+          case triton::arch::ID_REG_X86_R8:
+          case triton::arch::ID_REG_X86_R9:
+          case triton::arch::ID_REG_X86_R10:
+          case triton::arch::ID_REG_X86_R11:
+          case triton::arch::ID_REG_X86_R12:
+          case triton::arch::ID_REG_X86_R13:
+          case triton::arch::ID_REG_X86_R14:
+          case triton::arch::ID_REG_X86_R15:
+          case triton::arch::ID_REG_X86_EAX:
+          case triton::arch::ID_REG_X86_EBX:
+          case triton::arch::ID_REG_X86_ECX:
+          case triton::arch::ID_REG_X86_EDX:
+          case triton::arch::ID_REG_X86_EDI:
+          case triton::arch::ID_REG_X86_ESI:
+          case triton::arch::ID_REG_X86_EBP:
+          case triton::arch::ID_REG_X86_ESP:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
+      bool x86ConcreteSemantics::isSymbolic(void) const {
+        /* Untainted expressions are dropped anyway when only the tainted ones are kept */
+        return this->modes->isModeEnabled(triton::modes::ONLY_ON_TAINTED) == false;
+      }
+
+
+      bool x86ConcreteSemantics::isConcrete(const triton::arch::Register& reg) {
+        /* A deferred flag must be built to know its value */
+        this->symbolicEngine->materializeLazyRegister(reg);
+
+        if (this->isSymbolic() && this->symbolicEngine->isRegisterSymbolized(reg))
+          return false;
+
+        return this->taintEngine->isRegisterTainted(reg) == false;
+      }
+
+
+      bool x86ConcreteSemantics::read(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op, triton::uint64& value) {
+        if (op.getBitSize() > triton::bitsize::qword)
+          return false;
+
+        switch (op.getType()) {
+          case triton::arch::OP_IMM:
+            value = op.getImmediate().getValue() & maskOf(op.getBitSize());
+            inst.setReadImmediate(op.getImmediate(), nullptr);
+            return true;
+
+          case triton::arch::OP_MEM:
+            if (this->initAddress(inst, op.getMemory()) == false)
+              return false;
+            return this->readMemory(inst, op.getMemory(), value);
+
+          case triton::arch::OP_REG:
+            if (this->isGpr(op.getRegister()) == false)
+              return false;
+            return this->readRegister(inst, op.getRegister(), value);
+
+          default:
+            return false;
+        }
+      }
+
+
+      bool x86ConcreteSemantics::readRegister(triton::arch::Instruction& inst, const triton::arch::Register& reg, triton::uint64& value) {
+        if (this->isConcrete(reg) == false)
+          return false;
+
+        value = this->architecture->loadConcreteRegister<triton::uint64>(reg);
+        inst.setReadRegister(reg, nullptr);
+        return true;
+      }
+
+
+      bool x86ConcreteSemantics::readMemory(triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem, triton::uint64& value) {
+        if (mem.getBitSize() > triton::bitsize::qword)
+          return false;
+
+        if ((this->isSymbolic() && this->symbolicEngine->isMemorySymbolized(mem)) || this->taintEngine->isMemoryTainted(mem.getAddress(), mem.getSize()))
+          return false;
+
+        switch (mem.getSize()) {
+          case triton::size::byte:  value = this->architecture->loadConcreteMemory<triton::uint8>(mem.getAddress());  break;
+          case triton::size::word:  value = this->architecture->loadConcreteMemory<triton::uint16>(mem.getAddress()); break;
+          case triton::size::dword: value = this->architecture->loadConcreteMemory<triton::uint32>(mem.getAddress()); break;
+          case triton::size::qword: value = this->architecture->loadConcreteMemory<triton::uint64>(mem.getAddress()); break;
+          default:
+            value = static_cast<triton::uint64>(this->architecture->getConcreteMemoryValue(mem));
+            break;
+        }
+        inst.setLoadAccess(mem, nullptr);
+        return true;
+      }
+
+
+      bool x86ConcreteSemantics::readFlag(triton::arch::Instruction& inst, triton::arch::register_e id, bool& value) {
+        triton::uint64 flag = 0;
+
+        if (this->readRegister(inst, this->architecture->getRegister(id), flag) == false)
+          return false;
+
+        value = (flag != 0);
+        return true;
+      }
+
+
+      bool x86ConcreteSemantics::initAddress(triton::arch::Instruction& inst, triton::arch::MemoryAccess& mem) {
+        const triton::arch::Register& base  = mem.getConstBaseRegister();
+        const triton::arch::Register& index = mem.getConstIndexRegister();
+        const triton::arch::Register& seg   = mem.getConstSegmentRegister();
+        triton::uint64 baseValue            = 0;
+        triton::uint64 indexValue           = 0;
+        triton::uint64 segValue             = 0;
+
+        /* Same size as the effective address built by the symbolic engine */
+        triton::uint32 bitSize = (this->architecture->isRegisterValid(base) ? base.getBitSize() :
+                                   (this->architecture->isRegisterValid(index) ? index.getBitSize() :
+                                     (mem.getConstDisplacement().getBitSize() ? mem.getConstDisplacement().getBitSize() :
+                                       this->architecture->gprBitSize()
+                                     )
+                                   )
+                                 );
+
+        if (mem.getBitSize() < triton::bitsize::byte || bitSize > triton::bitsize::qword)
+          return false;
+
+        if (mem.getPcRelative())
+          baseValue = mem.getPcRelative();
+        else if (this->architecture->isRegisterValid(base) && this->readRegister(inst, base, baseValue) == false)
+          return false;
+
+        if (this->architecture->isRegisterValid(index) && this->readRegister(inst, index, indexValue) == false)
+          return false;
+
+        /* ((pc + base) + (index * scale) + disp) */
+        triton::uint64 offset  = indexValue * mem.getConstScale().getValue();
+        triton::uint64 address = index.isSubtracted() ? (baseValue - offset) : (baseValue + offset);
+        address = (address + mem.getConstDisplacement().getValue()) & maskOf(bitSize);
+
+        /* Segments are used as base address */
+        if (this->architecture->isRegisterValid(seg)) {
+          if (seg.getBitSize() > triton::bitsize::qword || this->readRegister(inst, seg, segValue) == false)
+            return false;
+          address = (segValue + signExtend(address, bitSize)) & maskOf(seg.getBitSize());
+        }
+
+        /* Initialize the address only if it is not already defined */
+        if (!mem.getAddress())
+          mem.setAddress(address);
+
+        return true;
+      }
+
+
+      bool x86ConcreteSemantics::write(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op, triton::uint64 value) {
+        switch (op.getType()) {
+          case triton::arch::OP_MEM:
+            if (op.getBitSize() > triton::bitsize::qword || this->initAddress(inst, op.getMemory()) == false)
+              return false;
+            this->writeMemory(op.getMemory(), value);
+            return true;
+
+          case triton::arch::OP_REG:
+            if (this->isGpr(op.getRegister()) == false)
+              return false;
+            return this->writeRegister(op.getRegister(), value);
+
+          default:
+            return false;
+        }
+      }
+
+
+      bool x86ConcreteSemantics::writeRegister(const triton::arch::Register& reg, triton::uint64 value) {
+        const triton::arch::Register& parent = this->architecture->getParentRegister(reg);
+        triton::uint64 mask = maskOf(reg.getBitSize());
+
+        value &= mask;
+
+        /* On x86-64, writing a 32-bit register clears the upper bits of its parent */
+        bool zx = (this->architecture->getArchitecture() == triton::arch::ARCH_X86_64 && reg.getBitSize() == triton::bitsize::dword);
+
+        /* Otherwise the upper bits of the parent are kept and must be concrete */
+        if (reg.getBitSize() < parent.getBitSize() && zx == false) {
+          if (this->isConcrete(parent) == false)
+            return false;
+          value |= static_cast<triton::uint64>(this->architecture->getConcreteRegisterValue(parent)) & ~mask;
+        }
+
+        this->registers.push_back(std::make_pair(reg, value));
+        return true;
+      }
+
+
+      void x86ConcreteSemantics::writeMemory(const triton::arch::MemoryAccess& mem, triton::uint64 value) {
+        this->stores.push_back(std::make_pair(mem, value & maskOf(mem.getBitSize())));
+      }
+
+
+      void x86ConcreteSemantics::writeFlag(triton::arch::register_e id, bool value) {
+        this->registers.push_back(std::make_pair(this->architecture->getRegister(id), static_cast<triton::uint64>(value)));
+      }
+
+
+      void x86ConcreteSemantics::writeResultFlags(triton::uint64 result, triton::uint32 bitSize) {
+        triton::uint8 parity = static_cast<triton::uint8>(result);
+
+        /* pf is set to one if there is an even number of bit set to 1 in the least significant byte */
+        parity ^= parity >> 4;
+        parity ^= parity >> 2;
+        parity ^= parity >> 1;
+
+        this->writeFlag(ID_REG_X86_PF, (parity & 1) == 0);
+        this->writeFlag(ID_REG_X86_SF, msbOf(result, bitSize));
+        this->writeFlag(ID_REG_X86_ZF, (result & maskOf(bitSize)) == 0);
+      }
+
+
+      void x86ConcreteSemantics::commit(triton::arch::Instruction& inst) {
+        for (const auto& item : this->registers) {
+          const triton::arch::Register& parent = this->architecture->getParentRegister(item.first);
+
+          this->architecture->storeConcreteRegister<triton::uint64>(parent, item.second);
+          this->symbolicEngine->concretizeRegister(parent);
+          this->taintEngine->setTaintRegister(parent, triton::engines::taint::UNTAINTED);
+          inst.setWrittenRegister(item.first, nullptr);
+        }
+
+        for (const auto& item : this->stores) {
+          const triton::arch::MemoryAccess& mem = item.first;
+
+          switch (mem.getSize()) {
+            case triton::size::byte:  this->architecture->storeConcreteMemory<triton::uint8>(mem.getAddress(), static_cast<triton::uint8>(item.second));   break;
+            case triton::size::word:  this->architecture->storeConcreteMemory<triton::uint16>(mem.getAddress(), static_cast<triton::uint16>(item.second)); break;
+            case triton::size::dword: this->architecture->storeConcreteMemory<triton::uint32>(mem.getAddress(), static_cast<triton::uint32>(item.second)); break;
+            case triton::size::qword: this->architecture->storeConcreteMemory<triton::uint64>(mem.getAddress(), item.second); break;
+            default:
+              this->architecture->setConcreteMemoryValue(mem, item.second);
+              break;
+          }
+          for (triton::uint32 index = 0; index < mem.getSize(); index++) {
+            if (this->symbolicEngine->getSymbolicMemory(mem.getAddress() + index)) {
+              this->symbolicEngine->concretizeMemory(mem);
+              break;
+            }
+          }
+          this->taintEngine->setTaintMemory(mem, triton::engines::taint::UNTAINTED);
+          inst.setStoreAccess(mem, nullptr);
+        }
+
+        /* Same as the undefined registers of the semantics */
+        for (const auto& reg : this->undefined) {
+          if (this->modes->isModeEnabled(triton::modes::CONCRETIZE_UNDEFINED_REGISTERS)) {
+            this->symbolicEngine->concretizeRegister(reg);
+          }
+          inst.setUndefinedRegister(reg);
+          this->taintEngine->setTaintRegister(reg, triton::engines::taint::UNTAINTED);
+        }
+      }
+
+
+      bool x86ConcreteSemantics::alu_s(triton::arch::Instruction& inst) {
+        triton::uint64 op1 = 0;
+        triton::uint64 op2 = 0;
+        triton::uint64 res = 0;
+
+        if (inst.operands.size() != 2)
+          return false;
+
+        auto& dst      = inst.operands[0];
+        auto& src      = inst.operands[1];
+        auto  type     = inst.getType();
+        auto  bitSize  = dst.getBitSize();
+
+        /* CMP sign extends its source, the others work on operands of the same size */
+        if (src.getBitSize() != bitSize && (type != ID_INS_CMP || src.getBitSize() > bitSize))
+          return false;
+
+        if (this->read(inst, dst, op1) == false || this->read(inst, src, op2) == false)
+          return false;
+
+        op2 = signExtend(op2, src.getBitSize()) & maskOf(bitSize);
+
+        switch (type) {
+          case ID_INS_ADD:
+            res = (op1 + op2) & maskOf(bitSize);
+            this->writeFlag(ID_REG_X86_CF, msbOf((op1 & op2) ^ ((op1 ^ op2 ^ res) & (op1 ^ op2)), bitSize));
+            this->writeFlag(ID_REG_X86_OF, msbOf((op1 ^ ~op2) & (op1 ^ res), bitSize));
+            this->writeFlag(ID_REG_X86_AF, ((res ^ op1 ^ op2) & 0x10) != 0);
+            break;
+
+          case ID_INS_CMP:
+          case ID_INS_SUB:
+            res = (op1 - op2) & maskOf(bitSize);
+            this->writeFlag(ID_REG_X86_CF, msbOf((op1 ^ op2 ^ res) ^ ((op1 ^ res) & (op1 ^ op2)), bitSize));
+            this->writeFlag(ID_REG_X86_OF, msbOf((op1 ^ op2) & (op1 ^ res), bitSize));
+            this->writeFlag(ID_REG_X86_AF, ((res ^ op1 ^ op2) & 0x10) != 0);
+            break;
+
+          case ID_INS_AND:
+          case ID_INS_TEST:
+            res = op1 & op2;
+            break;
+
+          case ID_INS_OR:
+            res = op1 | op2;
+            break;
+
+          case ID_INS_XOR:
+            res = op1 ^ op2;
+            break;
+
+          default:
+            return false;
+        }
+
+        /* Logical instructions clear CF and OF, and leave AF undefined */
+        if (type != ID_INS_ADD && type != ID_INS_CMP && type != ID_INS_SUB) {
+          this->writeFlag(ID_REG_X86_CF, false);
+          this->writeFlag(ID_REG_X86_OF, false);
+          this->undefined.push_back(this->architecture->getRegister(ID_REG_X86_AF));
+        }
+
+        this->writeResultFlags(res, bitSize);
+
+        if (type == ID_INS_CMP || type == ID_INS_TEST)
+          return true;
+
+        return this->write(inst, dst, res);
+      }
+
+
+      bool x86ConcreteSemantics::unary_s(triton::arch::Instruction& inst) {
+        triton::uint64 op1 = 0;
+        triton::uint64 res = 0;
+
+        if (inst.operands.size() != 1)
+          return false;
+
+        auto& dst     = inst.operands[0];
+        auto  bitSize = dst.getBitSize();
+
+        if (this->read(inst, dst, op1) == false)
+          return false;
+
+        switch (inst.getType()) {
+          case ID_INS_DEC:
+            res = (op1 - 1) & maskOf(bitSize);
+            this->writeFlag(ID_REG_X86_AF, ((res ^ op1 ^ 1) & 0x10) != 0);
+            this->writeFlag(ID_REG_X86_OF, msbOf((op1 ^ 1) & (op1 ^ res), bitSize));
+            this->writeResultFlags(res, bitSize);
+            break;
+
+          case ID_INS_INC:
+            res = (op1 + 1) & maskOf(bitSize);
+            this->writeFlag(ID_REG_X86_AF, ((res ^ op1 ^ 1) & 0x10) != 0);
+            this->writeFlag(ID_REG_X86_OF, msbOf((op1 ^ ~static_cast<triton::uint64>(1)) & (op1 ^ res), bitSize));
+            this->writeResultFlags(res, bitSize);
+            break;
+
+          case ID_INS_NEG:
+            res = (0 - op1) & maskOf(bitSize);
+            this->writeFlag(ID_REG_X86_AF, ((op1 ^ res) & 0x10) != 0);
+            this->writeFlag(ID_REG_X86_CF, op1 != 0);
+            this->writeFlag(ID_REG_X86_OF, msbOf(res & op1, bitSize));
+            this->writeResultFlags(res, bitSize);
+            break;
+
+          case ID_INS_NOT:
+            res = ~op1 & maskOf(bitSize);
+            break;
+
+          default:
+            return false;
+        }
+
+        return this->write(inst, dst, res);
+      }
+
+
+      bool x86ConcreteSemantics::mov_s(triton::arch::Instruction& inst) {
+        triton::uint64 value = 0;
+
+        if (inst.operands.size() != 2)
+          return false;
+
+        auto& dst = inst.operands[0];
+        auto& src = inst.operands[1];
+
+        if (src.getBitSize() > dst.getBitSize() || (inst.getType() == ID_INS_MOV && src.getBitSize() != dst.getBitSize()))
+          return false;
+
+        if (this->read(inst, src, value) == false)
+          return false;
+
+        if (inst.getType() == ID_INS_MOVSX || inst.getType() == ID_INS_MOVSXD)
+          value = signExtend(value, src.getBitSize());
+
+        return this->write(inst, dst, value);
+      }
+
+
+      bool x86ConcreteSemantics::lea_s(triton::arch::Instruction& inst) {
+        triton::uint64 baseValue  = 0;
+        triton::uint64 indexValue = 0;
+        triton::uint32 leaSize    = 0;
+
+        if (inst.operands.size() != 2 || inst.operands[1].getType() != triton::arch::OP_MEM)
+          return false;
+
+        auto& dst   = inst.operands[0];
+        auto& mem   = inst.operands[1].getMemory();
+        auto& disp  = mem.getDisplacement();
+        auto& base  = mem.getBaseRegister();
+        auto& index = mem.getIndexRegister();
+        auto& scale = mem.getScale();
+
+        /* Setup LEA size */
+        if (this->architecture->isRegisterValid(base))
+          leaSize = base.getBitSize();
+        else if (this->architecture->isRegisterValid(index))
+          leaSize = index.getBitSize();
+        else
+          leaSize = disp.getBitSize();
+
+        if (leaSize == 0 || leaSize > triton::bitsize::qword || disp.getBitSize() > leaSize || scale.getBitSize() > leaSize)
+          return false;
+
+        /* Addresses relative to the program counter go through the semantics */
+        if (this->architecture->isRegisterValid(base) && this->architecture->getParentRegister(base) == this->architecture->getProgramCounter())
+          return false;
+
+        if (this->architecture->isRegisterValid(base) && this->readRegister(inst, base, baseValue) == false)
+          return false;
+
+        if (this->architecture->isRegisterValid(index) && this->readRegister(inst, index, indexValue) == false)
+          return false;
+
+        inst.setReadImmediate(disp, nullptr);
+        inst.setReadImmediate(scale, nullptr);
+
+        /* Effective address = Displacement + BaseReg + IndexReg * Scale */
+        triton::uint64 ea = (disp.getValue() & maskOf(disp.getBitSize())) + baseValue + indexValue * (scale.getValue() & maskOf(scale.getBitSize()));
+
+        return this->write(inst, dst, ea & maskOf(leaSize));
+      }
+
+
+      bool x86ConcreteSemantics::push_s(triton::arch::Instruction& inst) {
+        triton::uint64 value      = 0;
+        triton::uint64 stackValue = 0;
+
+        if (inst.operands.size() != 1)
+          return false;
+
+        auto& src           = inst.operands[0];
+        auto  stack         = this->architecture->getStackPointer();
+        triton::uint32 size = stack.getSize();
+
+        /* If it's an immediate source, the memory access is always based on the arch size */
+        if (src.getType() != triton::arch::OP_IMM)
+          size = src.getSize();
+
+        if (this->read(inst, src, value) == false || this->readRegister(inst, stack, stackValue) == false)
+          return false;
+
+        stackValue = (stackValue - size) & maskOf(stack.getBitSize());
+
+        this->writeRegister(stack, stackValue);
+        this->writeMemory(triton::arch::MemoryAccess(stackValue, size), value);
+
+        return true;
+      }
+
+
+      bool x86ConcreteSemantics::pop_s(triton::arch::Instruction& inst) {
+        triton::uint64 value      = 0;
+        triton::uint64 stackValue = 0;
+
+        if (inst.operands.size() != 1 || inst.operands[0].getType() != triton::arch::OP_REG)
+          return false;
+
+        auto& dst   = inst.operands[0];
+        auto  stack = this->architecture->getStackPointer();
+
+        /* The stack pointer is not incremented if it is the destination */
+        if (this->architecture->getParentRegister(dst.getRegister()) == stack)
+          return false;
+
+        if (this->readRegister(inst, stack, stackValue) == false)
+          return false;
+
+        if (this->readMemory(inst, triton::arch::MemoryAccess(stackValue, dst.getSize()), value) == false)
+          return false;
+
+        if (this->write(inst, dst, value) == false)
+          return false;
+
+        return this->writeRegister(stack, stackValue + dst.getSize());
+      }
+
+
+      bool x86ConcreteSemantics::call_s(triton::arch::Instruction& inst) {
+        triton::uint64 target     = 0;
+        triton::uint64 stackValue = 0;
+
+        if (inst.operands.size() != 1)
+          return false;
+
+        auto& src   = inst.operands[0];
+        auto  stack = this->architecture->getStackPointer();
+        auto  pc    = this->architecture->getProgramCounter();
+
+        if (src.getBitSize() != pc.getBitSize())
+          return false;
+
+        if (this->read(inst, src, target) == false || this->readRegister(inst, stack, stackValue) == false)
+          return false;
+
+        stackValue = (stackValue - stack.getSize()) & maskOf(stack.getBitSize());
+
+        this->writeRegister(stack, stackValue);
+        this->writeMemory(triton::arch::MemoryAccess(stackValue, stack.getSize()), inst.getNextAddress());
+
+        return this->writeRegister(pc, target);
+      }
+
+
+      bool x86ConcreteSemantics::ret_s(triton::arch::Instruction& inst) {
+        triton::uint64 target     = 0;
+        triton::uint64 offset     = 0;
+        triton::uint64 stackValue = 0;
+
+        auto stack = this->architecture->getStackPointer();
+        auto pc    = this->architecture->getProgramCounter();
+
+        if (inst.operands.size() > 1 || (inst.operands.size() == 1 && inst.operands[0].getType() != triton::arch::OP_IMM))
+          return false;
+
+        if (this->readRegister(inst, stack, stackValue) == false)
+          return false;
+
+        if (this->readMemory(inst, triton::arch::MemoryAccess(stackValue, stack.getSize()), target) == false)
+          return false;
+
+        if (inst.operands.size() == 1 && this->read(inst, inst.operands[0], offset) == false)
+          return false;
+
+        this->writeRegister(stack, stackValue + stack.getSize() + offset);
+
+        return this->writeRegister(pc, target);
+      }
+
+
+      bool x86ConcreteSemantics::jmp_s(triton::arch::Instruction& inst) {
+        triton::uint64 target = 0;
+
+        if (inst.operands.size() != 1 || inst.operands[0].getBitSize() != this->architecture->getProgramCounter().getBitSize())
+          return false;
+
+        if (this->read(inst, inst.operands[0], target) == false)
+          return false;
+
+        inst.setConditionTaken(true);
+
+        return this->writeRegister(this->architecture->getProgramCounter(), target);
+      }
+
+
+      bool x86ConcreteSemantics::jcc_s(triton::arch::Instruction& inst) {
+        triton::uint64 target = 0;
+        bool cf = false, of = false, pf = false, sf = false, zf = false;
+        bool taken = false;
+
+        if (inst.operands.size() != 1 || inst.operands[0].getType() != triton::arch::OP_IMM)
+          return false;
+
+        if (this->read(inst, inst.operands[0], target) == false)
+          return false;
+
+        switch (inst.getType()) {
+          case ID_INS_JA:
+            if (this->readFlag(inst, ID_REG_X86_CF, cf) == false || this->readFlag(inst, ID_REG_X86_ZF, zf) == false)
+              return false;
+            taken = (cf == false && zf == false);
+            break;
+
+          case ID_INS_JAE:
+            if (this->readFlag(inst, ID_REG_X86_CF, cf) == false)
+              return false;
+            taken = (cf == false);
+            break;
+
+          case ID_INS_JB:
+            if (this->readFlag(inst, ID_REG_X86_CF, cf) == false)
+              return false;
+            taken = cf;
+            break;
+
+          case ID_INS_JBE:
+            if (this->readFlag(inst, ID_REG_X86_CF, cf) == false || this->readFlag(inst, ID_REG_X86_ZF, zf) == false)
+              return false;
+            taken = (cf || zf);
+            break;
+
+          case ID_INS_JE:
+          case ID_INS_JNE:
+            if (this->readFlag(inst, ID_REG_X86_ZF, zf) == false)
+              return false;
+            taken = (zf == (inst.getType() == ID_INS_JE));
+            break;
+
+          case ID_INS_JG:
+          case ID_INS_JLE:
+            if (this->readFlag(inst, ID_REG_X86_SF, sf) == false || this->readFlag(inst, ID_REG_X86_OF, of) == false || this->readFlag(inst, ID_REG_X86_ZF, zf) == false)
+              return false;
+            taken = (((sf != of) || zf) == (inst.getType() == ID_INS_JLE));
+            break;
+
+          case ID_INS_JGE:
+          case ID_INS_JL:
+            if (this->readFlag(inst, ID_REG_X86_SF, sf) == false || this->readFlag(inst, ID_REG_X86_OF, of) == false)
+              return false;
+            taken = ((sf != of) == (inst.getType() == ID_INS_JL));
+            break;
+
+          case ID_INS_JNO:
+          case ID_INS_JO:
+            if (this->readFlag(inst, ID_REG_X86_OF, of) == false)
+              return false;
+            taken = (of == (inst.getType() == ID_INS_JO));
+            break;
+
+          case ID_INS_JNP:
+          case ID_INS_JP:
+            if (this->readFlag(inst, ID_REG_X86_PF, pf) == false)
+              return false;
+            taken = (pf == (inst.getType() == ID_INS_JP));
+            break;
+
+          case ID_INS_JNS:
+          case ID_INS_JS:
+            if (this->readFlag(inst, ID_REG_X86_SF, sf) == false)
+              return false;
+            taken = (sf == (inst.getType() == ID_INS_JS));
+            break;
+
+          default:
+            return false;
+        }
+
+        inst.setConditionTaken(taken);
+
+        return this->writeRegister(this->architecture->getProgramCounter(), taken ? target : inst.getNextAddress());
+      }
+
+    }; /* x86 namespace */
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -99,6 +99,7 @@ EXTRACTPS                    | sse4.1     | Extract Packed Single Precision Floa
 IDIV                         |            | Signed Divide
 IMUL                         |            | Signed Multiply
 INC                          |            | Increment by 1
+INT                          |            | Call to Interrupt Procedure
 INVD                         |            | Invalidate Internal Caches
 INVLPG                       |            | Invalidate TLB Entry
 JA                           |            | Jump if not below (Jump if above)
@@ -554,6 +555,7 @@ namespace triton {
           case ID_INS_LODSW:          this->lodsw_s(inst);        break;
           case ID_INS_LOOP:           this->loop_s(inst);         break;
           case ID_INS_LZCNT:          this->lzcnt_s(inst);        break;
+          case ID_INS_INT:            this->int_s(inst);          break;
           case ID_INS_INT3:           this->int3_s(inst);         break;
           case ID_INS_MFENCE:         this->mfence_s(inst);       break;
           case ID_INS_MOV:            this->mov_s(inst);          break;
@@ -1027,6 +1029,206 @@ namespace triton {
       }
 
 
+      bool x86Semantics::repString_s(triton::arch::Instruction& inst) {
+        auto pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto counter = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_CX));
+        auto si      = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_SI));
+        auto di      = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_DI));
+        auto df      = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_DF));
+        bool compare = false;
+        bool source  = false;
+
+        if (this->modes->isModeEnabled(triton::modes::BULK_STRING_INSTRUCTIONS) == false)
+          return false;
+
+        if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_INVALID || inst.operands.size() != 2)
+          return false;
+
+        /* The journal records the expressions, and the array memory model a store per byte */
+        if (this->symbolicEngine->isUndoJournalEnabled() || this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY))
+          return false;
+
+        switch (inst.getType()) {
+          case ID_INS_MOVSB:
+          case ID_INS_MOVSD:
+          case ID_INS_MOVSQ:
+          case ID_INS_MOVSW:
+            source = true;
+            break;
+          case ID_INS_STOSB:
+          case ID_INS_STOSD:
+          case ID_INS_STOSQ:
+          case ID_INS_STOSW:
+            break;
+          case ID_INS_CMPSB:
+          case ID_INS_CMPSD:
+          case ID_INS_CMPSQ:
+          case ID_INS_CMPSW:
+            source  = true;
+            compare = true;
+            break;
+          case ID_INS_SCASB:
+          case ID_INS_SCASD:
+          case ID_INS_SCASQ:
+          case ID_INS_SCASW:
+            compare = true;
+            break;
+          default:
+            return false;
+        }
+
+        /* The string operands are memory, except the accumulator of STOS and SCAS (not the SSE forms of MOVSD and CMPSD) */
+        auto& op0 = inst.operands[0];
+        auto& op1 = inst.operands[1];
+        if (op0.getType() != triton::arch::OP_MEM && op1.getType() != triton::arch::OP_MEM)
+          return false;
+        if (source && (op0.getType() != triton::arch::OP_MEM || op1.getType() != triton::arch::OP_MEM))
+          return false;
+
+        /* The counter, the indexes and the direction must be concrete, and the counter untainted as it drives PC */
+        auto cxNode = this->symbolicEngine->getOperandAst(counter);
+        auto siNode = this->symbolicEngine->getOperandAst(si);
+        auto diNode = this->symbolicEngine->getOperandAst(di);
+        auto dfNode = this->symbolicEngine->getOperandAst(df);
+        if (cxNode->isSymbolized() || siNode->isSymbolized() || diNode->isSymbolized() || dfNode->isSymbolized() || this->taintEngine->isTainted(counter))
+          return false;
+
+        triton::uint64 count = static_cast<triton::uint64>(cxNode->evaluate());
+        if (count == 0)
+          return false;
+
+        triton::uint32 size  = (op0.getType() == triton::arch::OP_MEM ? op0.getSize() : op1.getSize());
+        triton::uint64 mask  = (counter.getBitSize() == triton::bitsize::qword ? static_cast<triton::uint64>(-1) : ((static_cast<triton::uint64>(1) << counter.getBitSize()) - 1));
+        triton::uint64 step  = (dfNode->evaluate().is_zero() ? size : -static_cast<triton::uint64>(size));
+        triton::uint64 index = 0;
+        bool done = true;
+
+        auto at = [&](const triton::arch::OperandWrapper& op) {
+          return triton::arch::MemoryAccess((op.getConstMemory().getAddress() + index * step) & mask, size);
+        };
+
+        if (compare == false) {
+          /* STOS stores the same accumulator at each address */
+          triton::ast::SharedAbstractNode value = nullptr;
+          if (source == false && op1.getType() == triton::arch::OP_REG && this->symbolicEngine->isRegisterSymbolized(op1.getConstRegister()))
+            value = this->symbolicEngine->getOperandAst(inst, op1);
+
+          /* The elements are copied in order, as an overlapping source reads the previous stores */
+          for (index = 0; index < count; index++) {
+            auto dst = at(op0);
+
+            if (source) {
+              auto src = at(op1);
+              if (this->symbolicEngine->isMemorySymbolized(src.getAddress(), size)) {
+                auto node = this->symbolicEngine->getMemoryAst(inst, src);
+                auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "MOVS operation");
+                expr->isTainted = this->taintEngine->taintAssignment(dst, src);
+              }
+              else {
+                auto cv = this->architecture->getConcreteMemoryValue(src);
+                this->symbolicEngine->concretizeMemory(dst);
+                this->architecture->setConcreteMemoryValue(dst, cv);
+                this->taintEngine->taintAssignment(dst, src);
+              }
+            }
+
+            else if (value != nullptr) {
+              auto expr = this->symbolicEngine->createSymbolicExpression(inst, value, dst, "STOS operation");
+              expr->isTainted = this->taintEngine->taintAssignment(dst, op1.getConstRegister());
+            }
+
+            else {
+              this->symbolicEngine->concretizeMemory(dst);
+              this->architecture->setConcreteMemoryValue(dst, this->symbolicEngine->getOperandAst(op1)->evaluate());
+              this->taintEngine->taintAssignment(dst, op1.getConstRegister());
+            }
+          }
+        }
+
+        else {
+          /* The accumulator of SCAS is compared to each element */
+          if (op0.getType() == triton::arch::OP_REG && this->symbolicEngine->isRegisterSymbolized(op0.getConstRegister()))
+            return false;
+
+          triton::uint512 a = 0;
+          triton::uint512 b = 0;
+          bool tainted = false;
+          done = false;
+
+          /* Stops before the first symbolic element, left to the semantics of the next processing */
+          for (index = 0; index < count && done == false; index++) {
+            if (op0.getType() == triton::arch::OP_MEM) {
+              auto mem = at(op0);
+              if (this->symbolicEngine->isMemorySymbolized(mem.getAddress(), size))
+                break;
+              a = this->architecture->getConcreteMemoryValue(mem);
+              tainted = this->taintEngine->isMemoryTainted(mem);
+            }
+            else {
+              a = this->symbolicEngine->getOperandAst(op0)->evaluate();
+              tainted = this->taintEngine->isTainted(op0);
+            }
+
+            auto mem = at(op1);
+            if (this->symbolicEngine->isMemorySymbolized(mem.getAddress(), size))
+              break;
+            b = this->architecture->getConcreteMemoryValue(mem);
+            tainted |= this->taintEngine->isMemoryTainted(mem);
+
+            /* REPE stops on the first mismatch, REPNE on the first match */
+            done = ((inst.getPrefix() == triton::arch::x86::ID_PREFIX_REPE) != (a == b));
+          }
+
+          if (index == 0)
+            return false;
+
+          /* The flags of the last comparison */
+          triton::uint32 bits = size * triton::bitsize::byte;
+          triton::uint512 sign = (triton::uint512(1) << (bits - 1));
+          triton::uint512 res  = (a - b) & ((triton::uint512(1) << bits) - 1);
+          triton::uint8 parity = static_cast<triton::uint8>(triton::uint512(res & 0xff));
+          parity ^= parity >> 4;
+          parity ^= parity >> 2;
+          parity ^= parity >> 1;
+
+          std::vector<std::pair<triton::arch::register_e, std::pair<bool, std::string>>> flags = {
+            {ID_REG_X86_AF, {triton::uint512((a ^ b ^ res) & 0x10) != 0,      "Adjust flag"}},
+            {ID_REG_X86_CF, {a < b,                                           "Carry flag"}},
+            {ID_REG_X86_OF, {triton::uint512((a ^ b) & (a ^ res) & sign) != 0, "Overflow flag"}},
+            {ID_REG_X86_PF, {(parity & 1) == 0,                               "Parity flag"}},
+            {ID_REG_X86_SF, {triton::uint512(res & sign) != 0,                "Sign flag"}},
+            {ID_REG_X86_ZF, {res == 0,                                        "Zero flag"}},
+          };
+
+          for (const auto& flag : flags) {
+            const auto& reg = this->architecture->getRegister(flag.first);
+            auto expr = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->bv(flag.second.first, 1), reg, flag.second.second);
+            expr->isTainted = this->taintEngine->setTaintRegister(reg, tainted);
+          }
+        }
+
+        /* The indexes advance by the processed elements */
+        auto advance = [&](const triton::arch::OperandWrapper& reg, const triton::ast::SharedAbstractNode& node, const std::string& comment) {
+          auto expr = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->bv((static_cast<triton::uint64>(node->evaluate()) + index * step) & mask, reg.getBitSize()), reg, comment);
+          expr->isTainted = this->taintEngine->taintUnion(reg, reg);
+        };
+
+        if (source)
+          advance(si, siNode, "Index (SI) operation");
+        advance(di, diNode, "Index (DI) operation");
+
+        /* The loop goes on at the next processing if it stopped on a symbolic element */
+        auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->bv(count - index, counter.getBitSize()), counter, "Counter operation");
+        auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->bv(done || index == count ? inst.getNextAddress() : inst.getAddress(), pc.getBitSize()), pc, "Program Counter");
+
+        /* Spread taint */
+        expr1->isTainted = this->taintEngine->taintUnion(counter, counter);
+        expr2->isTainted = this->taintEngine->taintAssignment(pc, counter);
+
+        return true;
+      }
+
+
       //! Update the FPU x87 Tag Word (whenever an STX register changes)
       void x86Semantics::updateFTW(triton::arch::Instruction& inst, const triton::engines::symbolic::SharedSymbolicExpression& parent) {
         /* Fetch the STX registers */
@@ -1270,26 +1472,28 @@ namespace triton {
          * Create the semantic.
          * af = 0x10 == (0x10 & (regDst ^ op1 ^ op2))
          */
-        auto node = this->astCtxt->ite(
-                      this->astCtxt->equal(
-                        this->astCtxt->bv(0x10, bvSize),
-                        this->astCtxt->bvand(
-                          this->astCtxt->bv(0x10, bvSize),
-                          this->astCtxt->bvxor(
-                            this->astCtxt->extract(high, low, this->astCtxt->reference(parent)),
-                            this->astCtxt->bvxor(op1, op2)
-                          )
-                        )
-                      ),
-                      this->astCtxt->bv(1, 1),
-                      this->astCtxt->bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_AF), "Adjust flag");
+        auto builder = [=, astCtxt = this->astCtxt]() {
+          return astCtxt->ite(
+                   astCtxt->equal(
+                     astCtxt->bv(0x10, bvSize),
+                     astCtxt->bvand(
+                       astCtxt->bv(0x10, bvSize),
+                       astCtxt->bvxor(
+                         astCtxt->extract(high, low, astCtxt->reference(parent)),
+                         astCtxt->bvxor(op1, op2)
+                       )
+                     )
+                   ),
+                   astCtxt->bv(1, 1),
+                   astCtxt->bv(0, 1)
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_AF), parent->isTainted);
+        auto taint = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_AF), parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazyRegisterExpression(inst, builder, this->architecture->getRegister(ID_REG_X86_AF), "Adjust flag", taint);
       }
 
 
@@ -1340,26 +1544,28 @@ namespace triton {
          * Create the semantic.
          * af = 0x10 == (0x10 & (op1 ^ regDst))
          */
-        auto node = this->astCtxt->ite(
-                      this->astCtxt->equal(
-                        this->astCtxt->bv(0x10, bvSize),
-                        this->astCtxt->bvand(
-                          this->astCtxt->bv(0x10, bvSize),
-                          this->astCtxt->bvxor(
-                            op1,
-                            this->astCtxt->extract(high, low, this->astCtxt->reference(parent))
-                          )
-                        )
-                      ),
-                      this->astCtxt->bv(1, 1),
-                      this->astCtxt->bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_AF), "Adjust flag");
+        auto builder = [=, astCtxt = this->astCtxt]() {
+          return astCtxt->ite(
+                   astCtxt->equal(
+                     astCtxt->bv(0x10, bvSize),
+                     astCtxt->bvand(
+                       astCtxt->bv(0x10, bvSize),
+                       astCtxt->bvxor(
+                         op1,
+                         astCtxt->extract(high, low, astCtxt->reference(parent))
+                       )
+                     )
+                   ),
+                   astCtxt->bv(1, 1),
+                   astCtxt->bv(0, 1)
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_AF), parent->isTainted);
+        auto taint = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_AF), parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazyRegisterExpression(inst, builder, this->architecture->getRegister(ID_REG_X86_AF), "Adjust flag", taint);
       }
 
 
@@ -1411,23 +1617,25 @@ namespace triton {
          * Create the semantic.
          * cf = MSB((op1 & op2) ^ ((op1 ^ op2 ^ parent) & (op1 ^ op2)));
          */
-        auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                      this->astCtxt->bvxor(
-                        this->astCtxt->bvand(op1, op2),
-                        this->astCtxt->bvand(
-                          this->astCtxt->bvxor(
-                            this->astCtxt->bvxor(op1, op2),
-                            this->astCtxt->extract(high, low, this->astCtxt->reference(parent))
-                          ),
-                        this->astCtxt->bvxor(op1, op2))
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag");
+        auto builder = [=, astCtxt = this->astCtxt]() {
+          return astCtxt->extract(bvSize-1, bvSize-1,
+                   astCtxt->bvxor(
+                     astCtxt->bvand(op1, op2),
+                     astCtxt->bvand(
+                       astCtxt->bvxor(
+                         astCtxt->bvxor(op1, op2),
+                         astCtxt->extract(high, low, astCtxt->reference(parent))
+                       ),
+                     astCtxt->bvxor(op1, op2))
+                   )
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+        auto taint = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazyRegisterExpression(inst, builder, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag", taint);
       }
 
 
@@ -1604,24 +1812,28 @@ namespace triton {
                                  const triton::ast::SharedAbstractNode& op1,
                                  bool vol) {
 
+        auto bvSize = dst.getBitSize();
+
         /*
          * Create the semantic.
          * cf = 0 if op1 == 0 else 1
          */
-        auto node = this->astCtxt->ite(
-                      this->astCtxt->equal(
-                        op1,
-                        this->astCtxt->bv(0, dst.getBitSize())
-                      ),
-                      this->astCtxt->bv(0, 1),
-                      this->astCtxt->bv(1, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag");
+        auto builder = [=, astCtxt = this->astCtxt]() {
+          return astCtxt->ite(
+                   astCtxt->equal(
+                     op1,
+                     astCtxt->bv(0, bvSize)
+                   ),
+                   astCtxt->bv(0, 1),
+                   astCtxt->bv(1, 1)
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+        auto taint = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazyRegisterExpression(inst, builder, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag", taint);
       }
 
 
@@ -1994,21 +2206,23 @@ namespace triton {
          * Create the semantic.
          * cf = extract(bvSize, bvSize (((op1 ^ op2 ^ res) ^ ((op1 ^ res) & (op1 ^ op2)))))
          */
-        auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                      this->astCtxt->bvxor(
-                        this->astCtxt->bvxor(op1, this->astCtxt->bvxor(op2, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))),
-                        this->astCtxt->bvand(
-                          this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent))),
-                          this->astCtxt->bvxor(op1, op2)
-                        )
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag");
+        auto builder = [=, astCtxt = this->astCtxt]() {
+          return astCtxt->extract(bvSize-1, bvSize-1,
+                   astCtxt->bvxor(
+                     astCtxt->bvxor(op1, astCtxt->bvxor(op2, astCtxt->extract(high, low, astCtxt->reference(parent)))),
+                     astCtxt->bvand(
+                       astCtxt->bvxor(op1, astCtxt->extract(high, low, astCtxt->reference(parent))),
+                       astCtxt->bvxor(op1, op2)
+                     )
+                   )
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+        auto taint = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazyRegisterExpression(inst, builder, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag", taint);
       }
 
 
@@ -2058,18 +2272,20 @@ namespace triton {
          * Create the semantic.
          * of = MSB((op1 ^ ~op2) & (op1 ^ regDst))
          */
-        auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                      this->astCtxt->bvand(
-                        this->astCtxt->bvxor(op1, this->astCtxt->bvnot(op2)),
-                        this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_OF), "Overflow flag");
+        auto builder = [=, astCtxt = this->astCtxt]() {
+          return astCtxt->extract(bvSize-1, bvSize-1,
+                   astCtxt->bvand(
+                     astCtxt->bvxor(op1, astCtxt->bvnot(op2)),
+                     astCtxt->bvxor(op1, astCtxt->extract(high, low, astCtxt->reference(parent)))
+                   )
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), parent->isTainted);
+        auto taint = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazyRegisterExpression(inst, builder, this->architecture->getRegister(ID_REG_X86_OF), "Overflow flag", taint);
       }
 
 
@@ -2141,18 +2357,20 @@ namespace triton {
          * Create the semantic.
          * of = (res & op1) >> (bvSize - 1) & 1
          */
-        auto node = this->astCtxt->extract(0, 0,
-                      this->astCtxt->bvlshr(
-                        this->astCtxt->bvand(this->astCtxt->extract(high, low, this->astCtxt->reference(parent)), op1),
-                        this->astCtxt->bvsub(this->astCtxt->bv(bvSize, bvSize), this->astCtxt->bv(1, bvSize))
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_OF), "Overflow flag");
+        auto builder = [=, astCtxt = this->astCtxt]() {
+          return astCtxt->extract(0, 0,
+                   astCtxt->bvlshr(
+                     astCtxt->bvand(astCtxt->extract(high, low, astCtxt->reference(parent)), op1),
+                     astCtxt->bvsub(astCtxt->bv(bvSize, bvSize), astCtxt->bv(1, bvSize))
+                   )
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), parent->isTainted);
+        auto taint = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazyRegisterExpression(inst, builder, this->architecture->getRegister(ID_REG_X86_OF), "Overflow flag", taint);
       }
 
 
@@ -2486,18 +2704,20 @@ namespace triton {
          * Create the semantic.
          * of = high:bool((op1 ^ op2) & (op1 ^ regDst))
          */
-        auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                      this->astCtxt->bvand(
-                        this->astCtxt->bvxor(op1, op2),
-                        this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_OF), "Overflow flag");
+        auto builder = [=, astCtxt = this->astCtxt]() {
+          return astCtxt->extract(bvSize-1, bvSize-1,
+                   astCtxt->bvand(
+                     astCtxt->bvxor(op1, op2),
+                     astCtxt->bvxor(op1, astCtxt->extract(high, low, astCtxt->reference(parent)))
+                   )
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), parent->isTainted);
+        auto taint = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazyRegisterExpression(inst, builder, this->architecture->getRegister(ID_REG_X86_OF), "Overflow flag", taint);
       }
 
 
@@ -2515,16 +2735,19 @@ namespace triton {
          * pf is set to one if there is an even number of bit set to 1 in the least
          * significant byte of the result.
          */
-        auto node = this->astCtxt->bv(1, 1);
-        for (triton::uint32 counter = 0; counter <= triton::bitsize::byte-1; counter++) {
-          node = this->astCtxt->bvxor(node, this->astCtxt->extract(counter, counter, this->astCtxt->reference(parent)));
-        }
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_PF), "Parity flag");
+        auto builder = [=, astCtxt = this->astCtxt]() {
+          auto node = astCtxt->bv(1, 1);
+          for (triton::uint32 counter = 0; counter <= triton::bitsize::byte-1; counter++) {
+            node = astCtxt->bvxor(node, astCtxt->extract(counter, counter, astCtxt->reference(parent)));
+          }
+          return node;
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_PF), parent->isTainted);
+        auto taint = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_PF), parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazyRegisterExpression(inst, builder, this->architecture->getRegister(ID_REG_X86_PF), "Parity flag", taint);
       }
 
 
@@ -2579,13 +2802,15 @@ namespace triton {
          * Create the semantic.
          * sf = high:bool(regDst)
          */
-        auto node = this->astCtxt->extract(high, high, this->astCtxt->reference(parent));
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_SF), "Sign flag");
+        auto builder = [=, astCtxt = this->astCtxt]() {
+          return astCtxt->extract(high, high, astCtxt->reference(parent));
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_SF), parent->isTainted);
+        auto taint = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_SF), parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazyRegisterExpression(inst, builder, this->architecture->getRegister(ID_REG_X86_SF), "Sign flag", taint);
       }
 
 
@@ -2721,20 +2946,22 @@ namespace triton {
          * Create the semantic.
          * zf = 0 == regDst
          */
-        auto node = this->astCtxt->ite(
-                      this->astCtxt->equal(
-                        this->astCtxt->extract(high, low, this->astCtxt->reference(parent)),
-                        this->astCtxt->bv(0, bvSize)
-                      ),
-                      this->astCtxt->bv(1, 1),
-                      this->astCtxt->bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_ZF), "Zero flag");
+        auto builder = [=, astCtxt = this->astCtxt]() {
+          return astCtxt->ite(
+                   astCtxt->equal(
+                     astCtxt->extract(high, low, astCtxt->reference(parent)),
+                     astCtxt->bv(0, bvSize)
+                   ),
+                   astCtxt->bv(1, 1),
+                   astCtxt->bv(0, 1)
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_ZF), parent->isTainted);
+        auto taint = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_ZF), parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazyRegisterExpression(inst, builder, this->architecture->getRegister(ID_REG_X86_ZF), "Zero flag", taint);
       }
 
 
@@ -4764,6 +4991,10 @@ namespace triton {
         if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REP)
           inst.setPrefix(triton::arch::x86::ID_PREFIX_REPE);
 
+        /* Execute the whole loop at once if its counter is concrete */
+        if (this->repString_s(inst))
+          return;
+
         /* Check if there is a REP prefix and a counter to zero */
         if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && this->symbolicEngine->getOperandAst(cx)->evaluate().is_zero()) {
           this->controlFlow_s(inst);
@@ -4825,6 +5056,10 @@ namespace triton {
         if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REP)
           inst.setPrefix(triton::arch::x86::ID_PREFIX_REPE);
 
+        /* Execute the whole loop at once if its counter is concrete */
+        if (this->repString_s(inst))
+          return;
+
         /* Check if there is a REP prefix and a counter to zero */
         if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && this->symbolicEngine->getOperandAst(cx)->evaluate().is_zero()) {
           this->controlFlow_s(inst);
@@ -4886,6 +5121,10 @@ namespace triton {
         if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REP)
           inst.setPrefix(triton::arch::x86::ID_PREFIX_REPE);
 
+        /* Execute the whole loop at once if its counter is concrete */
+        if (this->repString_s(inst))
+          return;
+
         /* Check if there is a REP prefix and a counter to zero */
         if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && this->symbolicEngine->getOperandAst(cx)->evaluate().is_zero()) {
           this->controlFlow_s(inst);
@@ -4947,6 +5186,10 @@ namespace triton {
         if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REP)
           inst.setPrefix(triton::arch::x86::ID_PREFIX_REPE);
 
+        /* Execute the whole loop at once if its counter is concrete */
+        if (this->repString_s(inst))
+          return;
+
         /* Check if there is a REP prefix and a counter to zero */
         if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && this->symbolicEngine->getOperandAst(cx)->evaluate().is_zero()) {
           this->controlFlow_s(inst);
@@ -8593,6 +8836,17 @@ namespace triton {
       }
 
 
+      void x86Semantics::int_s(triton::arch::Instruction& inst) {
+        auto& src = inst.operands[0];
+
+        /* Link the immediate to the instruction, the interrupt itself is left to the caller */
+        this->symbolicEngine->getOperandAst(inst, src);
+
+        /* Update the symbolic control flow */
+        this->controlFlow_s(inst);
+      }
+
+
       void x86Semantics::int3_s(triton::arch::Instruction& inst) {
         /* Return a breakpoint fault */
         this->exception = triton::arch::FAULT_BP;
@@ -9345,6 +9599,10 @@ namespace triton {
         auto  cx     = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_CX));
         auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_DF));
 
+        /* Execute the whole loop at once if its counter is concrete */
+        if (this->repString_s(inst))
+          return;
+
         /* Check if there is a REP prefix and a counter to zero */
         if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && this->symbolicEngine->getOperandAst(cx)->evaluate().is_zero()) {
           this->controlFlow_s(inst);
@@ -9393,6 +9651,10 @@ namespace triton {
         auto  cx     = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_CX));
         auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_DF));
 
+        /* Execute the whole loop at once if its counter is concrete */
+        if (this->repString_s(inst))
+          return;
+
         /* Check if there is a REP prefix and a counter to zero */
         if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && this->symbolicEngine->getOperandAst(cx)->evaluate().is_zero()) {
           this->controlFlow_s(inst);
@@ -9536,6 +9798,10 @@ namespace triton {
         auto  cx     = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_CX));
         auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_DF));
 
+        /* Execute the whole loop at once if its counter is concrete */
+        if (this->repString_s(inst))
+          return;
+
         /* Check if there is a REP prefix and a counter to zero */
         if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && this->symbolicEngine->getOperandAst(cx)->evaluate().is_zero()) {
           this->controlFlow_s(inst);
@@ -9584,6 +9850,10 @@ namespace triton {
         auto  cx     = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_CX));
         auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_DF));
 
+        /* Execute the whole loop at once if its counter is concrete */
+        if (this->repString_s(inst))
+          return;
+
         /* Check if there is a REP prefix and a counter to zero */
         if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && this->symbolicEngine->getOperandAst(cx)->evaluate().is_zero()) {
           this->controlFlow_s(inst);
@@ -10138,40 +10408,12 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> packed;
-        packed.reserve(16);
-
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case triton::bitsize::dqword:
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(127, 120, op1), this->astCtxt->extract(127, 120, op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(119, 112, op1), this->astCtxt->extract(119, 112, op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(111, 104, op1), this->astCtxt->extract(111, 104, op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(103, 96,  op1), this->astCtxt->extract(103, 96,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(95,  88,  op1), this->astCtxt->extract(95,  88,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(87,  80,  op1), this->astCtxt->extract(87,  80,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(79,  72,  op1), this->astCtxt->extract(79,  72,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(71,  64,  op1), this->astCtxt->extract(71,  64,  op2)));
-
-          /* MMX */
-          case triton::bitsize::qword:
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(63,  56,  op1), this->astCtxt->extract(63,  56,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(55,  48,  op1), this->astCtxt->extract(55,  48,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(47,  40,  op1), this->astCtxt->extract(47,  40,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(39,  32,  op1), this->astCtxt->extract(39,  32,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(31,  24,  op1), this->astCtxt->extract(31,  24,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(23,  16,  op1), this->astCtxt->extract(23,  16,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(15,  8,   op1), this->astCtxt->extract(15,  8,   op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(7,   0,   op1), this->astCtxt->extract(7,   0,   op2)));
-            break;
-
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::paddb_s(): Invalid operand size.");
-
-        }
+        if (dst.getBitSize() != triton::bitsize::dqword && dst.getBitSize() != triton::bitsize::qword)
+          throw triton::exceptions::Semantics("x86Semantics::paddb_s(): Invalid operand size.");
 
-        auto node = this->astCtxt->concat(packed);
+        auto node = this->astCtxt->zipLanes(op1, op2, triton::bitsize::byte, [this](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->bvadd(a, b);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDB operation");
@@ -10198,28 +10440,12 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> packed;
-        packed.reserve(4);
-
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case triton::bitsize::dqword:
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(127, 96, op1), this->astCtxt->extract(127, 96, op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(95,  64, op1), this->astCtxt->extract(95,  64, op2)));
-
-          /* MMX */
-          case triton::bitsize::qword:
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(63,  32, op1), this->astCtxt->extract(63,  32, op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(31,  0,  op1), this->astCtxt->extract(31,  0,  op2)));
-            break;
-
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::paddd_s(): Invalid operand size.");
-
-        }
+        if (dst.getBitSize() != triton::bitsize::dqword && dst.getBitSize() != triton::bitsize::qword)
+          throw triton::exceptions::Semantics("x86Semantics::paddd_s(): Invalid operand size.");
 
-        auto node = this->astCtxt->concat(packed);
+        auto node = this->astCtxt->zipLanes(op1, op2, triton::bitsize::dword, [this](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->bvadd(a, b);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDD operation");
@@ -10246,29 +10472,15 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> packed;
-        packed.reserve(2);
+        if (dst.getBitSize() != triton::bitsize::dqword && dst.getBitSize() != triton::bitsize::qword)
+          throw triton::exceptions::Semantics("x86Semantics::paddq_s(): Invalid operand size.");
 
-        switch (dst.getBitSize()) {
+        auto node = this->astCtxt->zipLanes(op1, op2, triton::bitsize::qword, [this](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->bvadd(a, b);
+        });
 
-          /* XMM */
-          case triton::bitsize::dqword:
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(127, 64, op1), this->astCtxt->extract(127, 64, op2)));
-
-          /* MMX */
-          case triton::bitsize::qword:
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(63,  0,  op1), this->astCtxt->extract(63,  0,  op2)));
-            break;
-
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::paddq_s(): Invalid operand size.");
-
-        }
-
-        auto node = this->astCtxt->concat(packed);
-
-        /* Create symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDQ operation");
+        /* Create symbolic expression */
+        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDQ operation");
 
         /* Update the x87 FPU Tag Word */
         if (dst.getBitSize() == triton::bitsize::qword) {
@@ -10292,32 +10504,12 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> packed;
-        packed.reserve(8);
-
-        switch (dst.getBitSize()) {
+        if (dst.getBitSize() != triton::bitsize::dqword && dst.getBitSize() != triton::bitsize::qword)
+          throw triton::exceptions::Semantics("x86Semantics::paddw_s(): Invalid operand size.");
 
-          /* XMM */
-          case triton::bitsize::dqword:
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(127, 112, op1), this->astCtxt->extract(127, 112, op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(111, 96,  op1), this->astCtxt->extract(111, 96,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(95,  80,  op1), this->astCtxt->extract(95,  80,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(79,  64,  op1), this->astCtxt->extract(79,  64,  op2)));
-
-          /* MMX */
-          case triton::bitsize::qword:
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(63,  48,  op1), this->astCtxt->extract(63,  48,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(47,  32,  op1), this->astCtxt->extract(47,  32,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(31,  16,  op1), this->astCtxt->extract(31,  16,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(15,  0,   op1), this->astCtxt->extract(15,  0,   op2)));
-            break;
-
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::paddw_s(): Invalid operand size.");
-
-        }
-
-        auto node = this->astCtxt->concat(packed);
+        auto node = this->astCtxt->zipLanes(op1, op2, triton::bitsize::word, [this](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->bvadd(a, b);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDW operation");
@@ -10523,22 +10715,11 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize());
-
-        for (triton::uint32 index = 0; index < dst.getSize(); index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::byte);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::byte) - (index * triton::bitsize::byte);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->equal(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xff, triton::bitsize::byte),
-                          this->astCtxt->bv(0x00, triton::bitsize::byte))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto ones  = this->astCtxt->bv(0xff, triton::bitsize::byte);
+        auto zeros = this->astCtxt->bv(0x00, triton::bitsize::byte);
+        auto node  = this->astCtxt->zipLanes(op1, op2, triton::bitsize::byte, [&](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->ite(this->astCtxt->equal(a, b), ones, zeros);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPEQB operation");
@@ -10560,22 +10741,11 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::dword);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::dword; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::dword);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::dword) - (index * triton::bitsize::dword);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->equal(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xffffffff, triton::bitsize::dword),
-                          this->astCtxt->bv(0x00000000, triton::bitsize::dword))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto ones  = this->astCtxt->bv(0xffffffff, triton::bitsize::dword);
+        auto zeros = this->astCtxt->bv(0x00000000, triton::bitsize::dword);
+        auto node  = this->astCtxt->zipLanes(op1, op2, triton::bitsize::dword, [&](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->ite(this->astCtxt->equal(a, b), ones, zeros);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPEQD operation");
@@ -10597,22 +10767,11 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::word);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::word; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::word);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::word) - (index * triton::bitsize::word);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->equal(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xffff, triton::bitsize::word),
-                          this->astCtxt->bv(0x0000, triton::bitsize::word))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto ones  = this->astCtxt->bv(0xffff, triton::bitsize::word);
+        auto zeros = this->astCtxt->bv(0x0000, triton::bitsize::word);
+        auto node  = this->astCtxt->zipLanes(op1, op2, triton::bitsize::word, [&](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->ite(this->astCtxt->equal(a, b), ones, zeros);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPEQW operation");
@@ -13289,40 +13448,12 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> packed;
-        packed.reserve(16);
+        if (dst.getBitSize() != triton::bitsize::dqword && dst.getBitSize() != triton::bitsize::qword)
+          throw triton::exceptions::Semantics("x86Semantics::psubb_s(): Invalid operand size.");
 
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case triton::bitsize::dqword:
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(127, 120, op1), this->astCtxt->extract(127, 120, op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(119, 112, op1), this->astCtxt->extract(119, 112, op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(111, 104, op1), this->astCtxt->extract(111, 104, op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(103, 96,  op1), this->astCtxt->extract(103, 96,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(95,  88,  op1), this->astCtxt->extract(95,  88,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(87,  80,  op1), this->astCtxt->extract(87,  80,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(79,  72,  op1), this->astCtxt->extract(79,  72,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(71,  64,  op1), this->astCtxt->extract(71,  64,  op2)));
-
-          /* MMX */
-          case triton::bitsize::qword:
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(63,  56,  op1), this->astCtxt->extract(63,  56,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(55,  48,  op1), this->astCtxt->extract(55,  48,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(47,  40,  op1), this->astCtxt->extract(47,  40,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(39,  32,  op1), this->astCtxt->extract(39,  32,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(31,  24,  op1), this->astCtxt->extract(31,  24,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(23,  16,  op1), this->astCtxt->extract(23,  16,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(15,  8,   op1), this->astCtxt->extract(15,  8,   op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(7,   0,   op1), this->astCtxt->extract(7,   0,   op2)));
-            break;
-
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::psubb_s(): Invalid operand size.");
-
-        }
-
-        auto node = this->astCtxt->concat(packed);
+        auto node = this->astCtxt->zipLanes(op1, op2, triton::bitsize::byte, [this](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->bvsub(a, b);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PSUBB operation");
@@ -13349,28 +13480,12 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> packed;
-        packed.reserve(4);
-
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case triton::bitsize::dqword:
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(127, 96, op1), this->astCtxt->extract(127, 96, op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(95,  64, op1), this->astCtxt->extract(95,  64, op2)));
-
-          /* MMX */
-          case triton::bitsize::qword:
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(63,  32, op1), this->astCtxt->extract(63,  32, op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(31,  0,  op1), this->astCtxt->extract(31,  0,  op2)));
-            break;
+        if (dst.getBitSize() != triton::bitsize::dqword && dst.getBitSize() != triton::bitsize::qword)
+          throw triton::exceptions::Semantics("x86Semantics::psubd_s(): Invalid operand size.");
 
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::psubd_s(): Invalid operand size.");
-
-        }
-
-        auto node = this->astCtxt->concat(packed);
+        auto node = this->astCtxt->zipLanes(op1, op2, triton::bitsize::dword, [this](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->bvsub(a, b);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PSUBD operation");
@@ -13397,26 +13512,12 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> packed;
-        packed.reserve(2);
-
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case triton::bitsize::dqword:
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(127, 64, op1), this->astCtxt->extract(127, 64, op2)));
-
-          /* MMX */
-          case triton::bitsize::qword:
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(63,  0,  op1), this->astCtxt->extract(63,  0,  op2)));
-            break;
-
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::psubq_s(): Invalid operand size.");
+        if (dst.getBitSize() != triton::bitsize::dqword && dst.getBitSize() != triton::bitsize::qword)
+          throw triton::exceptions::Semantics("x86Semantics::psubq_s(): Invalid operand size.");
 
-        }
-
-        auto node = this->astCtxt->concat(packed);
+        auto node = this->astCtxt->zipLanes(op1, op2, triton::bitsize::qword, [this](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->bvsub(a, b);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PSUBQ operation");
@@ -13443,32 +13544,12 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> packed;
-        packed.reserve(8);
-
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case triton::bitsize::dqword:
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(127, 112, op1), this->astCtxt->extract(127, 112, op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(111, 96,  op1), this->astCtxt->extract(111, 96,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(95,  80,  op1), this->astCtxt->extract(95,  80,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(79,  64,  op1), this->astCtxt->extract(79,  64,  op2)));
-
-          /* MMX */
-          case triton::bitsize::qword:
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(63,  48,  op1), this->astCtxt->extract(63,  48,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(47,  32,  op1), this->astCtxt->extract(47,  32,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(31,  16,  op1), this->astCtxt->extract(31,  16,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(15,  0,   op1), this->astCtxt->extract(15,  0,   op2)));
-            break;
-
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::psubw_s(): Invalid operand size.");
+        if (dst.getBitSize() != triton::bitsize::dqword && dst.getBitSize() != triton::bitsize::qword)
+          throw triton::exceptions::Semantics("x86Semantics::psubw_s(): Invalid operand size.");
 
-        }
-
-        auto node = this->astCtxt->concat(packed);
+        auto node = this->astCtxt->zipLanes(op1, op2, triton::bitsize::word, [this](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->bvsub(a, b);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PSUBW operation");
@@ -14813,6 +14894,10 @@ namespace triton {
         if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REP)
           inst.setPrefix(triton::arch::x86::ID_PREFIX_REPE);
 
+        /* Execute the whole loop at once if its counter is concrete */
+        if (this->repString_s(inst))
+          return;
+
         /* Check if there is a REP prefix and a counter to zero */
         if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && this->symbolicEngine->getOperandAst(cx)->evaluate().is_zero()) {
           this->controlFlow_s(inst);
@@ -14865,6 +14950,10 @@ namespace triton {
         if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REP)
           inst.setPrefix(triton::arch::x86::ID_PREFIX_REPE);
 
+        /* Execute the whole loop at once if its counter is concrete */
+        if (this->repString_s(inst))
+          return;
+
         /* Check if there is a REP prefix and a counter to zero */
         if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && this->symbolicEngine->getOperandAst(cx)->evaluate().is_zero()) {
           this->controlFlow_s(inst);
@@ -14917,6 +15006,10 @@ namespace triton {
         if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REP)
           inst.setPrefix(triton::arch::x86::ID_PREFIX_REPE);
 
+        /* Execute the whole loop at once if its counter is concrete */
+        if (this->repString_s(inst))
+          return;
+
         /* Check if there is a REP prefix and a counter to zero */
         if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && this->symbolicEngine->getOperandAst(cx)->evaluate().is_zero()) {
           this->controlFlow_s(inst);
@@ -14969,6 +15062,10 @@ namespace triton {
         if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REP)
           inst.setPrefix(triton::arch::x86::ID_PREFIX_REPE);
 
+        /* Execute the whole loop at once if its counter is concrete */
+        if (this->repString_s(inst))
+          return;
+
         /* Check if there is a REP prefix and a counter to zero */
         if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && this->symbolicEngine->getOperandAst(cx)->evaluate().is_zero()) {
           this->controlFlow_s(inst);
@@ -15919,6 +16016,10 @@ namespace triton {
         auto  cx     = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_CX));
         auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_DF));
 
+        /* Execute the whole loop at once if its counter is concrete */
+        if (this->repString_s(inst))
+          return;
+
         /* Check if there is a REP prefix and a counter to zero */
         if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && this->symbolicEngine->getOperandAst(cx)->evaluate().is_zero()) {
           this->controlFlow_s(inst);
@@ -15958,6 +16059,10 @@ namespace triton {
         auto  cx     = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_CX));
         auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_DF));
 
+        /* Execute the whole loop at once if its counter is concrete */
+        if (this->repString_s(inst))
+          return;
+
         /* Check if there is a REP prefix and a counter to zero */
         if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && this->symbolicEngine->getOperandAst(cx)->evaluate().is_zero()) {
           this->controlFlow_s(inst);
@@ -15997,6 +16102,10 @@ namespace triton {
         auto  cx     = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_CX));
         auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_DF));
 
+        /* Execute the whole loop at once if its counter is concrete */
+        if (this->repString_s(inst))
+          return;
+
         /* Check if there is a REP prefix and a counter to zero */
         if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && this->symbolicEngine->getOperandAst(cx)->evaluate().is_zero()) {
           this->controlFlow_s(inst);
@@ -16036,6 +16145,10 @@ namespace triton {
         auto  cx     = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_CX));
         auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_DF));
 
+        /* Execute the whole loop at once if its counter is concrete */
+        if (this->repString_s(inst))
+          return;
+
         /* Check if there is a REP prefix and a counter to zero */
         if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && this->symbolicEngine->getOperandAst(cx)->evaluate().is_zero()) {
           this->controlFlow_s(inst);
@@ -16877,15 +16990,9 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::byte);
-
-        for (triton::uint32 i = 0; i < dst.getSize() / triton::size::byte; ++i) {
-          uint32 high = (dst.getBitSize() - 1) - (i * triton::bitsize::byte);
-          uint32 low = (dst.getBitSize() - triton::bitsize::byte) - (i * triton::bitsize::byte);
-          pck.push_back(this->astCtxt->bvadd(this->astCtxt->extract(high, low, op1), this->astCtxt->extract(high, low, op2)));
-        }
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->zipLanes(op1, op2, triton::bitsize::byte, [this](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->bvadd(a, b);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPADDB operation");
@@ -16908,15 +17015,9 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::dword);
-
-        for (triton::uint32 i = 0; i < dst.getSize() / triton::size::dword; ++i) {
-          uint32 high = (dst.getBitSize() - 1) - (i * triton::bitsize::dword);
-          uint32 low = (dst.getBitSize() - triton::bitsize::dword) - (i * triton::bitsize::dword);
-          pck.push_back(this->astCtxt->bvadd(this->astCtxt->extract(high, low, op1), this->astCtxt->extract(high, low, op2)));
-        }
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->zipLanes(op1, op2, triton::bitsize::dword, [this](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->bvadd(a, b);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPADDD operation");
@@ -16939,15 +17040,9 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::word);
-
-        for (triton::uint32 i = 0; i < dst.getSize() / triton::size::word; ++i) {
-          uint32 high = (dst.getBitSize() - 1) - (i * triton::bitsize::word);
-          uint32 low = (dst.getBitSize() - triton::bitsize::word) - (i * triton::bitsize::word);
-          pck.push_back(this->astCtxt->bvadd(this->astCtxt->extract(high, low, op1), this->astCtxt->extract(high, low, op2)));
-        }
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->zipLanes(op1, op2, triton::bitsize::word, [this](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->bvadd(a, b);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPADDW operation");
@@ -17264,22 +17359,11 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize());
-
-        for (triton::uint32 index = 0; index < src1.getSize(); index++) {
-          uint32 high = (src1.getBitSize() - 1) - (index * triton::bitsize::byte);
-          uint32 low  = (src1.getBitSize() - triton::bitsize::byte) - (index * triton::bitsize::byte);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->equal(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xff, triton::bitsize::byte),
-                          this->astCtxt->bv(0x00, triton::bitsize::byte))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto ones  = this->astCtxt->bv(0xff, triton::bitsize::byte);
+        auto zeros = this->astCtxt->bv(0x00, triton::bitsize::byte);
+        auto node  = this->astCtxt->zipLanes(op1, op2, triton::bitsize::byte, [&](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->ite(this->astCtxt->equal(a, b), ones, zeros);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPCMPEQB operation");
@@ -17302,22 +17386,11 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::dword);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::dword; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::dword);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::dword) - (index * triton::bitsize::dword);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->equal(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xffffffff, triton::bitsize::dword),
-                          this->astCtxt->bv(0x00000000, triton::bitsize::dword))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto ones  = this->astCtxt->bv(0xffffffff, triton::bitsize::dword);
+        auto zeros = this->astCtxt->bv(0x00000000, triton::bitsize::dword);
+        auto node  = this->astCtxt->zipLanes(op1, op2, triton::bitsize::dword, [&](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->ite(this->astCtxt->equal(a, b), ones, zeros);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPCMPEQD operation");
@@ -17340,22 +17413,11 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::qword);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::qword; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::qword);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::qword) - (index * triton::bitsize::qword);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->equal(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xffffffffffffffff, triton::bitsize::qword),
-                          this->astCtxt->bv(0x0000000000000000, triton::bitsize::qword))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto ones  = this->astCtxt->bv(0xffffffffffffffff, triton::bitsize::qword);
+        auto zeros = this->astCtxt->bv(0x0000000000000000, triton::bitsize::qword);
+        auto node  = this->astCtxt->zipLanes(op1, op2, triton::bitsize::qword, [&](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->ite(this->astCtxt->equal(a, b), ones, zeros);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPCMPEQQ operation");
@@ -17378,22 +17440,11 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::word);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::word; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::word);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::word) - (index * triton::bitsize::word);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->equal(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xffff, triton::bitsize::word),
-                          this->astCtxt->bv(0x0000, triton::bitsize::word))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto ones  = this->astCtxt->bv(0xffff, triton::bitsize::word);
+        auto zeros = this->astCtxt->bv(0x0000, triton::bitsize::word);
+        auto node  = this->astCtxt->zipLanes(op1, op2, triton::bitsize::word, [&](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->ite(this->astCtxt->equal(a, b), ones, zeros);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPCMPEQW operation");
@@ -18203,19 +18254,9 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize());
-
-        for (triton::uint32 index = 0; index < dst.getSize(); index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::byte);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::byte) - (index * triton::bitsize::byte);
-          pck.push_back(this->astCtxt->bvsub(
-                          this->astCtxt->extract(high, low, op1),
-                          this->astCtxt->extract(high, low, op2))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->zipLanes(op1, op2, triton::bitsize::byte, [this](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->bvsub(a, b);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPSUBB operation");
@@ -18238,19 +18279,9 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::dword);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::dword; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::dword);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::dword) - (index * triton::bitsize::dword);
-          pck.push_back(this->astCtxt->bvsub(
-                         this->astCtxt->extract(high, low, op1),
-                         this->astCtxt->extract(high, low, op2))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->zipLanes(op1, op2, triton::bitsize::dword, [this](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->bvsub(a, b);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPSUBD operation");
@@ -18273,19 +18304,9 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::qword);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::qword; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::qword);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::qword) - (index * triton::bitsize::qword);
-          pck.push_back(this->astCtxt->bvsub(
-                         this->astCtxt->extract(high, low, op1),
-                         this->astCtxt->extract(high, low, op2))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->zipLanes(op1, op2, triton::bitsize::qword, [this](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->bvsub(a, b);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPSUBQ operation");
@@ -18308,19 +18329,9 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::word);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::word; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::word);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::word) - (index * triton::bitsize::word);
-          pck.push_back(this->astCtxt->bvsub(
-                         this->astCtxt->extract(high, low, op1),
-                         this->astCtxt->extract(high, low, op2))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->zipLanes(op1, op2, triton::bitsize::word, [this](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+          return this->astCtxt->bvsub(a, b);
+        });
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPSUBW operation");
@@ -5,8 +5,6 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
-#include <cassert>
-
 #include <triton/architecture.hpp>
 #include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
@@ -19,44 +17,81 @@ namespace triton {
   namespace arch {
     namespace x86 {
 
-      x86Specifications::x86Specifications(triton::arch::architecture_e arch) {
-        if (arch != triton::arch::ARCH_X86 && arch != triton::arch::ARCH_X86_64)
-            throw triton::exceptions::Architecture("x86Specifications::x86Specifications(): Invalid architecture.");
-
+      const x86Specifications::RegisterTables& x86Specifications::getRegisterTables(triton::arch::architecture_e arch) {
         if (arch == triton::arch::ARCH_X86_64) {
-          // Fill id2reg and name2id with those available in X86_64 from spec
-          #define REG_SPEC(UPPER_NAME, LOWER_NAME, X86_64_UPPER, X86_64_LOWER, X86_64_PARENT, X86_UPPER, X86_LOWER, X86_PARENT, X86_AVAIL)  \
-            id2reg.emplace(ID_REG_X86_##UPPER_NAME,                                                       \
-                               triton::arch::Register(triton::arch::ID_REG_X86_##UPPER_NAME,              \
-                                                      #LOWER_NAME,                                        \
-                                                      triton::arch::ID_REG_X86_##X86_64_PARENT,           \
-                                                      X86_64_UPPER,                                       \
-                                                      X86_64_LOWER,                                       \
-                                                      true)                                               \
-                              );                                                                          \
-            name2id.emplace(#LOWER_NAME, ID_REG_X86_##UPPER_NAME);
-          // Handle register not available in capstone as normal registers
-          #define REG_SPEC_NO_CAPSTONE REG_SPEC
-          #include "triton/x86.spec"
+          /* Initialized once, even if several threads create a CPU at the same time */
+          static const RegisterTables x8664Tables = [] {
+            RegisterTables tables;
+            auto& id2reg  = tables.id2reg;
+            auto& name2id = tables.name2id;
+
+            // Fill id2reg and name2id with those available in X86_64 from spec
+            #define REG_SPEC(UPPER_NAME, LOWER_NAME, X86_64_UPPER, X86_64_LOWER, X86_64_PARENT, X86_UPPER, X86_LOWER, X86_PARENT, X86_AVAIL)  \
+              id2reg.emplace(ID_REG_X86_##UPPER_NAME,                                                       \
+                                 triton::arch::Register(triton::arch::ID_REG_X86_##UPPER_NAME,              \
+                                                        #LOWER_NAME,                                        \
+                                                        triton::arch::ID_REG_X86_##X86_64_PARENT,           \
+                                                        X86_64_UPPER,                                       \
+                                                        X86_64_LOWER,                                       \
+                                                        true)                                               \
+                                );                                                                          \
+              name2id.emplace(#LOWER_NAME, ID_REG_X86_##UPPER_NAME);
+            // Handle register not available in capstone as normal registers
+            #define REG_SPEC_NO_CAPSTONE REG_SPEC
+            #include "triton/x86.spec"
+
+            /* Index the registers by id, the lookups of the CPU do not hash */
+            tables.id2ptr.resize(triton::arch::ID_REG_LAST_ITEM, nullptr);
+            for (const auto& kv : id2reg)
+              tables.id2ptr[kv.first] = &kv.second;
+
+            return tables;
+          }();
+
+          return x8664Tables;
         }
-        else {
-          assert(arch == triton::arch::ARCH_X86);
-          // Fill id2reg and name2id with those available in X86 from spec
-          #define REG_SPEC(UPPER_NAME, LOWER_NAME, _1, _2, _3, X86_UPPER, X86_LOWER, X86_PARENT, X86_AVAIL) \
-          if (X86_AVAIL)                                                                                    \
-            id2reg.emplace(ID_REG_X86_##UPPER_NAME,                                                         \
-                               triton::arch::Register(triton::arch::ID_REG_X86_##UPPER_NAME,                \
-                                                      #LOWER_NAME,                                          \
-                                                      triton::arch::ID_REG_X86_##X86_PARENT,                \
-                                                      X86_UPPER,                                            \
-                                                      X86_LOWER,                                            \
-                                                      true)                                                 \
-                              );                                                                            \
-          name2id.emplace(#LOWER_NAME, ID_REG_X86_##UPPER_NAME);
-          // Handle register not available in capstone as normal registers
-          #define REG_SPEC_NO_CAPSTONE REG_SPEC
-          #include "triton/x86.spec"
+
+        if (arch == triton::arch::ARCH_X86) {
+          static const RegisterTables x86Tables = [] {
+            RegisterTables tables;
+            auto& id2reg  = tables.id2reg;
+            auto& name2id = tables.name2id;
+
+            // Fill id2reg and name2id with those available in X86 from spec
+            #define REG_SPEC(UPPER_NAME, LOWER_NAME, _1, _2, _3, X86_UPPER, X86_LOWER, X86_PARENT, X86_AVAIL) \
+            if (X86_AVAIL)                                                                                    \
+              id2reg.emplace(ID_REG_X86_##UPPER_NAME,                                                         \
+                                 triton::arch::Register(triton::arch::ID_REG_X86_##UPPER_NAME,                \
+                                                        #LOWER_NAME,                                          \
+                                                        triton::arch::ID_REG_X86_##X86_PARENT,                \
+                                                        X86_UPPER,                                            \
+                                                        X86_LOWER,                                            \
+                                                        true)                                                 \
+                                );                                                                            \
+            name2id.emplace(#LOWER_NAME, ID_REG_X86_##UPPER_NAME);
+            // Handle register not available in capstone as normal registers
+            #define REG_SPEC_NO_CAPSTONE REG_SPEC
+            #include "triton/x86.spec"
+
+            /* Index the registers by id, the lookups of the CPU do not hash */
+            tables.id2ptr.resize(triton::arch::ID_REG_LAST_ITEM, nullptr);
+            for (const auto& kv : id2reg)
+              tables.id2ptr[kv.first] = &kv.second;
+
+            return tables;
+          }();
+
+          return x86Tables;
         }
+
+        throw triton::exceptions::Architecture("x86Specifications::x86Specifications(): Invalid architecture.");
+      }
+
+
+      x86Specifications::x86Specifications(triton::arch::architecture_e arch)
+        : id2reg(getRegisterTables(arch).id2reg),
+          name2id(getRegisterTables(arch).name2id),
+          id2ptr(getRegisterTables(arch).id2ptr) {
       }
 
 
@@ -83,6 +118,22 @@ namespace triton {
 
 
       triton::uint32 x86Specifications::capstoneInstructionToTritonInstruction(triton::uint32 id) const {
+        /* The cases of convertInstruction() are flattened once into a table indexed by the capstone's ids */
+        static const std::vector<triton::uint32> instructions = [] {
+          std::vector<triton::uint32> instructions(triton::extlibs::capstone::X86_INS_ENDING);
+          for (triton::uint32 i = 0; i < instructions.size(); i++)
+            instructions[i] = convertInstruction(i);
+          return instructions;
+        }();
+
+        if (id >= instructions.size())
+          return triton::arch::x86::ID_INS_INVALID;
+
+        return instructions[id];
+      }
+
+
+      triton::uint32 x86Specifications::convertInstruction(triton::uint32 id) {
         triton::uint32 tritonId = triton::arch::x86::ID_INS_INVALID;
 
         switch (id) {
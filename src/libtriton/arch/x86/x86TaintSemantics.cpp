@@ -0,0 +1,425 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/x86Specifications.hpp>
+#include <triton/x86TaintSemantics.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+    namespace x86 {
+
+      /* Returns the mask of a value of bitSize bits */
+      static inline triton::uint64 maskOf(triton::uint32 bitSize) {
+        return (bitSize >= triton::bitsize::qword) ? static_cast<triton::uint64>(-1) : ((static_cast<triton::uint64>(1) << bitSize) - 1);
+      }
+
+
+      /* Sign extends a value of bitSize bits to 64 bits */
+      static inline triton::uint64 signExtend(triton::uint64 value, triton::uint32 bitSize) {
+        if (bitSize >= triton::bitsize::qword || ((value >> (bitSize - 1)) & 1) == 0)
+          return value;
+        return value | ~maskOf(bitSize);
+      }
+
+
+      /* Returns true if both operands are the same register */
+      static inline bool isSameRegister(const triton::arch::OperandWrapper& op1, const triton::arch::OperandWrapper& op2) {
+        return op1.getType() == triton::arch::OP_REG && op2.getType() == triton::arch::OP_REG && op1.getConstRegister() == op2.getConstRegister();
+      }
+
+
+      x86TaintSemantics::x86TaintSemantics(triton::arch::Architecture* architecture, triton::engines::taint::TaintEngine* taintEngine) {
+        this->architecture = architecture;
+        this->taintEngine  = taintEngine;
+
+        if (architecture == nullptr)
+          throw triton::exceptions::Semantics("x86TaintSemantics::x86TaintSemantics(): The architecture API must be defined.");
+
+        if (this->taintEngine == nullptr)
+          throw triton::exceptions::Semantics("x86TaintSemantics::x86TaintSemantics(): The taint engines API must be defined.");
+      }
+
+
+      bool x86TaintSemantics::propagate(triton::arch::Instruction& inst) {
+        bool propagated = false;
+
+        /* Repeated and locked instructions go through the semantics */
+        if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID)
+          return false;
+
+        for (const auto& operand : inst.operands) {
+          if (operand.getType() != triton::arch::OP_IMM && operand.getType() != triton::arch::OP_MEM && operand.getType() != triton::arch::OP_REG)
+            return false;
+        }
+
+        /* The rules only read the addresses, which are needed before checking the taint of a memory operand */
+        for (auto& operand : inst.operands) {
+          if (operand.getType() == triton::arch::OP_MEM && inst.getType() != ID_INS_LEA)
+            this->initAddress(operand.getMemory());
+        }
+
+        switch (inst.getType()) {
+          case ID_INS_MOV:
+          case ID_INS_MOVAPD:
+          case ID_INS_MOVAPS:
+          case ID_INS_MOVD:
+          case ID_INS_MOVDQA:
+          case ID_INS_MOVDQU:
+          case ID_INS_MOVQ:
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+          case ID_INS_MOVUPD:
+          case ID_INS_MOVUPS:
+          case ID_INS_MOVZX:
+            propagated = this->mov_s(inst);
+            break;
+
+          case ID_INS_ADD:
+          case ID_INS_SAL:
+          case ID_INS_SAR:
+          case ID_INS_SHL:
+          case ID_INS_SHR:
+          case ID_INS_SUB:
+            propagated = this->arith_s(inst, false);
+            break;
+
+          case ID_INS_ADC:
+          case ID_INS_SBB:
+            propagated = this->arith_s(inst, true);
+            break;
+
+          case ID_INS_AND:
+          case ID_INS_OR:
+          case ID_INS_PXOR:
+          case ID_INS_XOR:
+          case ID_INS_XORPD:
+          case ID_INS_XORPS:
+            propagated = this->logic_s(inst);
+            break;
+
+          case ID_INS_CMOVA:
+          case ID_INS_CMOVAE:
+          case ID_INS_CMOVB:
+          case ID_INS_CMOVBE:
+          case ID_INS_CMOVE:
+          case ID_INS_CMOVG:
+          case ID_INS_CMOVGE:
+          case ID_INS_CMOVL:
+          case ID_INS_CMOVLE:
+          case ID_INS_CMOVNE:
+          case ID_INS_CMOVNO:
+          case ID_INS_CMOVNP:
+          case ID_INS_CMOVNS:
+          case ID_INS_CMOVO:
+          case ID_INS_CMOVP:
+          case ID_INS_CMOVS:
+            propagated = this->cmov_s(inst);
+            break;
+
+          case ID_INS_CMP:  propagated = this->compare_s(inst, false); break;
+          case ID_INS_TEST: propagated = this->compare_s(inst, true);  break;
+
+          case ID_INS_DEC:
+          case ID_INS_INC:
+          case ID_INS_NEG:
+            propagated = this->unary_s(inst, true);
+            break;
+
+          case ID_INS_NOT:  propagated = this->unary_s(inst, false); break;
+          case ID_INS_CALL: propagated = this->call_s();             break;
+          case ID_INS_IMUL: propagated = this->imul_s(inst);         break;
+          case ID_INS_LEA:  propagated = this->lea_s(inst);          break;
+          case ID_INS_POP:  propagated = this->pop_s(inst);          break;
+          case ID_INS_PUSH: propagated = this->push_s(inst);         break;
+          case ID_INS_XCHG: propagated = this->xchg_s(inst);         break;
+
+          /* The taint of the program counter is not changed by the branches */
+          case ID_INS_JA:
+          case ID_INS_JAE:
+          case ID_INS_JB:
+          case ID_INS_JBE:
+          case ID_INS_JE:
+          case ID_INS_JG:
+          case ID_INS_JGE:
+          case ID_INS_JL:
+          case ID_INS_JLE:
+          case ID_INS_JMP:
+          case ID_INS_JNE:
+          case ID_INS_JNO:
+          case ID_INS_JNP:
+          case ID_INS_JNS:
+          case ID_INS_JO:
+          case ID_INS_JP:
+          case ID_INS_JS:
+          case ID_INS_NOP:
+          case ID_INS_RET:
+            propagated = true;
+            break;
+
+          default:
+            break;
+        }
+
+        if (propagated == false)
+          return false;
+
+        /* There is no expression to carry the taint of the instruction, it is tainted if one of its operands is */
+        for (const auto& operand : inst.operands) {
+          if (operand.getType() != triton::arch::OP_IMM && this->isTainted(operand)) {
+            inst.setTaint(true);
+            break;
+          }
+        }
+
+        return true;
+      }
+
+
+      bool x86TaintSemantics::isTainted(const triton::arch::OperandWrapper& op) const {
+        return this->taintEngine->isTainted(op);
+      }
+
+
+      void x86TaintSemantics::initAddress(triton::arch::MemoryAccess& mem) const {
+        const triton::arch::Register& base  = mem.getConstBaseRegister();
+        const triton::arch::Register& index = mem.getConstIndexRegister();
+        const triton::arch::Register& seg   = mem.getConstSegmentRegister();
+        triton::uint64 baseValue            = 0;
+        triton::uint64 indexValue           = 0;
+
+        /* Keep the address if it is already defined */
+        if (mem.getAddress())
+          return;
+
+        /* Same size as the effective address built by the symbolic engine */
+        triton::uint32 bitSize = (this->architecture->isRegisterValid(base) ? base.getBitSize() :
+                                   (this->architecture->isRegisterValid(index) ? index.getBitSize() :
+                                     (mem.getConstDisplacement().getBitSize() ? mem.getConstDisplacement().getBitSize() :
+                                       this->architecture->gprBitSize()
+                                     )
+                                   )
+                                 );
+
+        if (mem.getPcRelative())
+          baseValue = mem.getPcRelative();
+        else if (this->architecture->isRegisterValid(base))
+          baseValue = static_cast<triton::uint64>(this->architecture->getConcreteRegisterValue(base));
+
+        if (this->architecture->isRegisterValid(index))
+          indexValue = static_cast<triton::uint64>(this->architecture->getConcreteRegisterValue(index));
+
+        /* ((pc + base) + (index * scale) + disp) */
+        triton::uint64 offset  = indexValue * mem.getConstScale().getValue();
+        triton::uint64 address = index.isSubtracted() ? (baseValue - offset) : (baseValue + offset);
+        address = (address + mem.getConstDisplacement().getValue()) & maskOf(bitSize);
+
+        /* Segments are used as base address */
+        if (this->architecture->isRegisterValid(seg)) {
+          triton::uint64 segValue = static_cast<triton::uint64>(this->architecture->getConcreteRegisterValue(seg));
+          address = (segValue + signExtend(address, bitSize)) & maskOf(std::min(seg.getBitSize(), static_cast<triton::uint32>(triton::bitsize::qword)));
+        }
+
+        mem.setAddress(address);
+      }
+
+
+      triton::arch::MemoryAccess x86TaintSemantics::getStack(triton::uint32 size, triton::sint64 offset) const {
+        const triton::arch::Register& stack = this->architecture->getStackPointer();
+        triton::uint64 stackValue = static_cast<triton::uint64>(this->architecture->getConcreteRegisterValue(stack));
+        return triton::arch::MemoryAccess((stackValue + offset) & maskOf(stack.getBitSize()), size);
+      }
+
+
+      void x86TaintSemantics::setFlags(bool tainted, bool logical) {
+        this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_PF), tainted);
+        this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_SF), tainted);
+        this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_ZF), tainted);
+        this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_AF), logical ? false : tainted);
+        this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), logical ? false : tainted);
+        this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), logical ? false : tainted);
+      }
+
+
+      bool x86TaintSemantics::mov_s(triton::arch::Instruction& inst) {
+        if (inst.operands.size() != 2 || inst.operands[0].getType() == triton::arch::OP_IMM)
+          return false;
+
+        this->taintEngine->taintAssignment(inst.operands[0], inst.operands[1]);
+        return true;
+      }
+
+
+      bool x86TaintSemantics::arith_s(triton::arch::Instruction& inst, bool carry) {
+        if (inst.operands.size() != 2 || inst.operands[0].getType() == triton::arch::OP_IMM)
+          return false;
+
+        auto& dst = inst.operands[0];
+        auto& src = inst.operands[1];
+
+        this->taintEngine->taintUnion(dst, src);
+        if (carry)
+          this->taintEngine->taintUnion(dst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_CF)));
+
+        this->setFlags(this->isTainted(dst));
+        return true;
+      }
+
+
+      bool x86TaintSemantics::logic_s(triton::arch::Instruction& inst) {
+        if (inst.operands.size() != 2 || inst.operands[0].getType() == triton::arch::OP_IMM)
+          return false;
+
+        auto& dst = inst.operands[0];
+        auto& src = inst.operands[1];
+        bool flags = (inst.getType() == ID_INS_AND || inst.getType() == ID_INS_OR || inst.getType() == ID_INS_XOR);
+
+        /* Clear the taint if the registers are the same, as with `xor eax, eax` */
+        if (inst.getType() != ID_INS_AND && inst.getType() != ID_INS_OR && isSameRegister(dst, src))
+          this->taintEngine->setTaint(dst, false);
+        else
+          this->taintEngine->taintUnion(dst, src);
+
+        if (flags)
+          this->setFlags(this->isTainted(dst), true);
+
+        return true;
+      }
+
+
+      bool x86TaintSemantics::call_s(void) {
+        const triton::arch::Register& stack = this->architecture->getStackPointer();
+
+        /* The return address is not tainted */
+        this->taintEngine->untaintMemory(this->getStack(stack.getSize(), -static_cast<triton::sint64>(stack.getSize())));
+        return true;
+      }
+
+
+      bool x86TaintSemantics::cmov_s(triton::arch::Instruction& inst) {
+        if (inst.operands.size() != 2 || inst.operands[0].getType() != triton::arch::OP_REG)
+          return false;
+
+        /* The destination keeps its taint or gets the one of the source */
+        this->taintEngine->taintUnion(inst.operands[0], inst.operands[1]);
+        return true;
+      }
+
+
+      bool x86TaintSemantics::compare_s(triton::arch::Instruction& inst, bool logical) {
+        if (inst.operands.size() != 2)
+          return false;
+
+        this->setFlags(this->isTainted(inst.operands[0]) || this->isTainted(inst.operands[1]), logical);
+        return true;
+      }
+
+
+      bool x86TaintSemantics::imul_s(triton::arch::Instruction& inst) {
+        /* The one operand form writes the double-sized product in two registers */
+        if (inst.operands.size() != 2 && inst.operands.size() != 3)
+          return false;
+
+        auto& dst = inst.operands[0];
+
+        if (inst.operands.size() == 2)
+          this->taintEngine->taintUnion(dst, inst.operands[1]);
+        else
+          this->taintEngine->taintAssignment(dst, inst.operands[1]);
+
+        this->setFlags(this->isTainted(dst));
+        return true;
+      }
+
+
+      bool x86TaintSemantics::lea_s(triton::arch::Instruction& inst) {
+        if (inst.operands.size() != 2 || inst.operands[1].getType() != triton::arch::OP_MEM)
+          return false;
+
+        auto& mem   = inst.operands[1].getConstMemory();
+        bool  taint = false;
+
+        if (this->architecture->isRegisterValid(mem.getConstBaseRegister()))
+          taint |= this->taintEngine->isRegisterTainted(mem.getConstBaseRegister());
+
+        if (this->architecture->isRegisterValid(mem.getConstIndexRegister()))
+          taint |= this->taintEngine->isRegisterTainted(mem.getConstIndexRegister());
+
+        this->taintEngine->setTaint(inst.operands[0], taint);
+        return true;
+      }
+
+
+      bool x86TaintSemantics::pop_s(triton::arch::Instruction& inst) {
+        if (inst.operands.size() != 1 || inst.operands[0].getType() == triton::arch::OP_IMM)
+          return false;
+
+        auto& dst = inst.operands[0];
+
+        this->taintEngine->taintAssignment(dst, triton::arch::OperandWrapper(this->getStack(dst.getSize(), 0)));
+        return true;
+      }
+
+
+      bool x86TaintSemantics::push_s(triton::arch::Instruction& inst) {
+        if (inst.operands.size() != 1)
+          return false;
+
+        auto& src           = inst.operands[0];
+        triton::uint32 size = this->architecture->getStackPointer().getSize();
+
+        /* If it's an immediate source, the memory access is always based on the arch size */
+        if (src.getType() != triton::arch::OP_IMM)
+          size = src.getSize();
+
+        this->taintEngine->taintAssignment(triton::arch::OperandWrapper(this->getStack(size, -static_cast<triton::sint64>(size))), src);
+        return true;
+      }
+
+
+      bool x86TaintSemantics::unary_s(triton::arch::Instruction& inst, bool flags) {
+        if (inst.operands.size() != 1 || inst.operands[0].getType() == triton::arch::OP_IMM)
+          return false;
+
+        if (flags == false)
+          return true;
+
+        bool taint = this->isTainted(inst.operands[0]);
+        bool carry = this->taintEngine->isRegisterTainted(this->architecture->getRegister(ID_REG_X86_CF));
+
+        /* INC and DEC do not write CF */
+        this->setFlags(taint);
+        if (inst.getType() != ID_INS_NEG)
+          this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), carry);
+
+        return true;
+      }
+
+
+      bool x86TaintSemantics::xchg_s(triton::arch::Instruction& inst) {
+        if (inst.operands.size() != 2)
+          return false;
+
+        auto& dst = inst.operands[0];
+        auto& src = inst.operands[1];
+        bool dstT = this->isTainted(dst);
+        bool srcT = this->isTainted(src);
+
+        this->taintEngine->setTaint(dst, srcT);
+        this->taintEngine->setTaint(src, dstT);
+
+        return true;
+      }
+
+    };
+  };
+};
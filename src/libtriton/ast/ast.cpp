@@ -7,6 +7,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <iterator>
+#include <limits>
 #include <list>
 #include <new>
 #include <stack>
@@ -20,38 +22,363 @@
 #include <triton/exceptions.hpp>
 #include <triton/symbolicExpression.hpp>
 #include <triton/symbolicVariable.hpp>
+#include <triton/wideArithmetic.hpp>
 
 
 
 namespace triton {
   namespace ast {
 
+    /* Returns the value of a node of 64 bits or less, sign extended to 64 bits */
+    static triton::sint64 signExtend64(const AbstractNode* node) {
+      triton::uint32 shift = triton::bitsize::qword - node->getBitvectorSize();
+      return (static_cast<triton::sint64>(node->evaluate64() << shift) >> shift);
+    }
+
+
+    /* Mixes a 64-bit value into a hash, as a round of xxHash64 */
+    static inline triton::uint64 hashRound(triton::uint64 acc, triton::uint64 value) {
+      acc += value * 0xc2b2ae3d27d4eb4fULL;
+      acc  = (acc << 31) | (acc >> 33);
+      return acc * 0x9e3779b185ebca87ULL;
+    }
+
+
+    /* Spreads every bit of a hash over all its bits, as the xxHash64 finalizer */
+    static inline triton::uint64 hashAvalanche(triton::uint64 h) {
+      h ^= h >> 33;
+      h *= 0xc2b2ae3d27d4eb4fULL;
+      h ^= h >> 29;
+      h *= 0x165667b19e3779f9ULL;
+      h ^= h >> 32;
+      return h;
+    }
+
+
+    /* ====== Node parents */
+
+
+    NodeParents::NodeParents() {
+    }
+
+
+    NodeParents::NodeParents(const NodeParents& other) {
+      *this = other;
+    }
+
+
+    NodeParents& NodeParents::operator=(const NodeParents& other) {
+      if (this == &other)
+        return *this;
+
+      this->inlineParents = other.inlineParents;
+      this->mappedParents.reset();
+      if (other.mappedParents != nullptr)
+        this->mappedParents.reset(new std::unordered_map<AbstractNode*, Entry>(*other.mappedParents));
+
+      return *this;
+    }
+
+
+    NodeParents::Entry* NodeParents::find(AbstractNode* p) {
+      if (this->mappedParents != nullptr) {
+        auto it = this->mappedParents->find(p);
+        return (it != this->mappedParents->end() ? &it->second : nullptr);
+      }
+
+      for (auto& item : this->inlineParents) {
+        if (item.first == p)
+          return &item.second;
+      }
+
+      return nullptr;
+    }
+
+
+    void NodeParents::add(AbstractNode* p) {
+      Entry* entry = this->find(p);
+
+      if (entry != nullptr) {
+        /* The pointer may have been reused by a new node */
+        if (entry->second.expired())
+          *entry = std::make_pair(1, WeakAbstractNode(p->shared_from_this()));
+        // Ptr already in, add it for the counter
+        else
+          entry->first += 1;
+        return;
+      }
+
+      if (this->mappedParents != nullptr) {
+        this->mappedParents->emplace(p, std::make_pair(1, WeakAbstractNode(p->shared_from_this())));
+        return;
+      }
+
+      /* Drop the dead parents before growing */
+      if (this->inlineParents.size() >= NodeParents::maxInlineParents) {
+        this->inlineParents.erase(std::remove_if(this->inlineParents.begin(), this->inlineParents.end(),
+          [](const std::pair<AbstractNode*, Entry>& item) {
+            return item.second.second.expired();
+          }), this->inlineParents.end()
+        );
+      }
+
+      /* High fan-in node, use a map from now on */
+      if (this->inlineParents.size() >= NodeParents::maxInlineParents) {
+        this->mappedParents.reset(new std::unordered_map<AbstractNode*, Entry>(this->inlineParents.begin(), this->inlineParents.end()));
+        this->mappedParents->emplace(p, std::make_pair(1, WeakAbstractNode(p->shared_from_this())));
+        this->inlineParents.clear();
+        this->inlineParents.shrink_to_fit();
+        return;
+      }
+
+      this->inlineParents.emplace_back(p, std::make_pair(1, WeakAbstractNode(p->shared_from_this())));
+    }
+
+
+    void NodeParents::remove(AbstractNode* p) {
+      if (this->mappedParents != nullptr) {
+        auto it = this->mappedParents->find(p);
+        if (it != this->mappedParents->end() && --it->second.first == 0)
+          this->mappedParents->erase(it);
+        return;
+      }
+
+      for (auto it = this->inlineParents.begin(); it != this->inlineParents.end(); ++it) {
+        if (it->first == p) {
+          if (--it->second.first == 0)
+            this->inlineParents.erase(it);
+          return;
+        }
+      }
+    }
+
+
+    std::vector<SharedAbstractNode> NodeParents::get(void) {
+      std::vector<SharedAbstractNode> res;
+
+      if (this->mappedParents != nullptr) {
+        for (auto it = this->mappedParents->begin(); it != this->mappedParents->end();) {
+          if (auto sp = it->second.second.lock()) {
+            res.push_back(sp);
+            ++it;
+          }
+          else
+            it = this->mappedParents->erase(it);
+        }
+        return res;
+      }
+
+      for (auto it = this->inlineParents.begin(); it != this->inlineParents.end();) {
+        if (auto sp = it->second.second.lock()) {
+          res.push_back(sp);
+          ++it;
+        }
+        else
+          it = this->inlineParents.erase(it);
+      }
+
+      return res;
+    }
+
+
+    /* ====== Node children */
+
+
+    NodeChildren::NodeChildren() {
+      this->count = 0;
+    }
+
+
+    NodeChildren::NodeChildren(const NodeChildren& other) {
+      this->count = 0;
+      *this = other;
+    }
+
+
+    NodeChildren& NodeChildren::operator=(const NodeChildren& other) {
+      if (this == &other)
+        return *this;
+
+      this->clear();
+      this->reserve(other.count);
+      for (const auto& child : other)
+        this->push_back(child);
+
+      return *this;
+    }
+
+
+    NodeChildren::operator std::vector<SharedAbstractNode>(void) const {
+      return std::vector<SharedAbstractNode>(this->begin(), this->end());
+    }
+
+
+    void NodeChildren::push_back(const SharedAbstractNode& child) {
+      if (this->spilledChildren.empty()) {
+        if (this->count < maxInlineChildren) {
+          this->inlineChildren[this->count++] = child;
+          return;
+        }
+        /* The inline children move into the vector once there are too many of them */
+        this->reserve(2 * maxInlineChildren);
+      }
+
+      this->spilledChildren.push_back(child);
+      this->count++;
+    }
+
+
+    void NodeChildren::reserve(triton::usize n) {
+      if (n <= maxInlineChildren)
+        return;
+
+      if (this->spilledChildren.empty()) {
+        this->spilledChildren.reserve(n);
+        for (triton::uint32 i = 0; i < this->count; i++)
+          this->spilledChildren.push_back(std::move(this->inlineChildren[i]));
+        return;
+      }
+
+      this->spilledChildren.reserve(n);
+    }
+
+
+    void NodeChildren::clear(void) {
+      for (triton::uint32 i = 0; i < this->count && i < maxInlineChildren; i++)
+        this->inlineChildren[i].reset();
+      this->spilledChildren.clear();
+      this->count = 0;
+    }
+
+
     /* ====== Abstract node */
 
     AbstractNode::AbstractNode(triton::ast::ast_e type, const SharedAstContext& ctxt) {
       this->array       = false;
       this->ctxt        = ctxt;
       this->eval        = 0;
+      this->eval64      = 0;
       this->hash        = 0;
+      this->hash64      = 0;
+      this->id          = ctxt->newNodeId(type);
       this->logical     = false;
       this->level       = 1;
       this->size        = 0;
       this->symbolized  = false;
       this->type        = type;
+
+      this->dagSize           = 1;
+      this->variablesMask     = 0;
+      this->variablesOverflow = false;
+      this->withArray         = false;
     }
 
 
+    AbstractNode::AbstractNode(const AbstractNode& other)
+      : std::enable_shared_from_this<AbstractNode>(other),
+        children(other.children),
+        parents(other.parents) {
+      this->array       = other.array;
+      this->ctxt        = other.ctxt;
+      this->eval        = other.eval;
+      this->eval64      = other.eval64;
+      this->hash        = other.hash;
+      this->hash64      = other.hash64;
+      this->id          = this->ctxt->newNodeId(other.type);
+      this->logical     = other.logical;
+      this->level       = other.level;
+      this->size        = other.size;
+      this->symbolized  = other.symbolized;
+      this->type        = other.type;
+
+      this->dagSize           = other.dagSize;
+      this->variables         = other.variables;
+      this->variablesMask     = other.variablesMask;
+      this->variablesOverflow = other.variablesOverflow;
+      this->withArray         = other.withArray;
+
+      this->ctxt->countChildren(this->children.size());
+    }
+
+
+    /* The children of the dying nodes, released by the outermost destructor */
+    static thread_local std::vector<SharedAbstractNode>* dyingNodes = nullptr;
+
+
     AbstractNode::~AbstractNode() {
+      /*
+       * Releasing the children from the destructor would destroy a deep
+       * chain recursively and overflow the stack (see #753). The nested
+       * destructors only hand their children to the outermost one, which
+       * releases them in a loop. References are handled the same way, their
+       * expression releasing its AST from a nested destructor.
+       */
+      triton::usize count = this->children.size();
+
+      if (dyingNodes != nullptr) {
+        for (auto& child : this->children)
+          dyingNodes->push_back(std::move(child));
+      }
+      else {
+        std::vector<SharedAbstractNode> worklist;
+        worklist.reserve(count);
+        for (auto& child : this->children)
+          worklist.push_back(std::move(child));
+        dyingNodes = &worklist;
+        while (!worklist.empty()) {
+          SharedAbstractNode node = std::move(worklist.back());
+          worklist.pop_back();
+          node.reset();
+        }
+        dyingNodes = nullptr;
+      }
+
       /* See #828: Release ownership before calling container destructor */
       this->children.clear();
+      this->ctxt->releaseNodeId(this->id, this->type, count);
     }
 
 
-    SharedAstContext AbstractNode::getContext(void) const {
+    AbstractNode& AbstractNode::operator=(const AbstractNode& other) {
+      /* The id given back is taken again if both nodes share their context */
+      this->ctxt->releaseNodeId(this->id, this->type, this->children.size());
+      this->id = other.ctxt->newNodeId(other.type);
+      other.ctxt->countChildren(other.children.size());
+
+      this->array       = other.array;
+      this->children    = other.children;
+      this->ctxt        = other.ctxt;
+      this->eval        = other.eval;
+      this->eval64      = other.eval64;
+      this->hash        = other.hash;
+      this->hash64      = other.hash64;
+      this->logical     = other.logical;
+      this->level       = other.level;
+      this->parents     = other.parents;
+      this->size        = other.size;
+      this->symbolized  = other.symbolized;
+      this->type        = other.type;
+
+      this->dagSize           = other.dagSize;
+      this->variables         = other.variables;
+      this->variablesMask     = other.variablesMask;
+      this->variablesOverflow = other.variablesOverflow;
+      this->withArray         = other.withArray;
+
+      return *this;
+    }
+
+
+    const SharedAstContext& AbstractNode::getContext(void) const {
       return this->ctxt;
     }
 
 
+    triton::uint32 AbstractNode::getId(void) const {
+      return this->id;
+    }
+
+
     triton::ast::ast_e AbstractNode::getType(void) const {
       return this->type;
     }
@@ -69,7 +396,20 @@ namespace triton {
     }
 
 
+    triton::uint64 AbstractNode::getBitvectorMask64(void) const {
+      if (this->size >= triton::bitsize::qword)
+        return static_cast<triton::uint64>(-1);
+      return ((static_cast<triton::uint64>(1) << this->size) - 1);
+    }
+
+
     bool AbstractNode::isSigned(void) const {
+      if (this->size == 0)
+        return false;
+
+      if (this->size <= triton::bitsize::qword)
+        return ((this->eval64 >> (this->size-1)) & 1);
+
       if ((this->eval >> (this->size-1)) & 1)
         return true;
       return false;
@@ -135,6 +475,104 @@ namespace triton {
     }
 
 
+    bool AbstractNode::containsArray(void) const {
+      return this->withArray;
+    }
+
+
+    std::vector<triton::usize> AbstractNode::getVariableIds(void) const {
+      if (!this->variablesOverflow)
+        return this->variables ? *this->variables : std::vector<triton::usize>();
+
+      /* Past the limit, the sets of the subtrees which have one are merged */
+      std::unordered_set<triton::usize> ids;
+      std::stack<const AbstractNode*> worklist;
+      VisitedNodes visited(this->ctxt);
+
+      worklist.push(this);
+      while (!worklist.empty()) {
+        const AbstractNode* current = worklist.top();
+        worklist.pop();
+
+        if (!visited.insert(current))
+          continue;
+
+        if (!current->variablesOverflow) {
+          if (current->variables)
+            ids.insert(current->variables->begin(), current->variables->end());
+        }
+        else if (current->type == REFERENCE_NODE) {
+          worklist.push(reinterpret_cast<const ReferenceNode*>(current)->getSymbolicExpression()->getAst().get());
+        }
+        else {
+          for (const auto& child : current->children)
+            worklist.push(child.get());
+        }
+      }
+
+      std::vector<triton::usize> ret(ids.begin(), ids.end());
+      std::sort(ret.begin(), ret.end());
+      return ret;
+    }
+
+
+    triton::uint64 AbstractNode::getVariablesMask(void) const {
+      return this->variablesMask;
+    }
+
+
+    bool AbstractNode::hasVariable(triton::usize id) const {
+      if ((this->variablesMask & (static_cast<triton::uint64>(1) << (id % 64))) == 0)
+        return false;
+
+      if (!this->variablesOverflow)
+        return std::binary_search(this->variables->begin(), this->variables->end(), id);
+
+      auto ids = this->getVariableIds();
+      return std::binary_search(ids.begin(), ids.end(), id);
+    }
+
+
+    bool AbstractNode::sharesVariablesWith(const AbstractNode& other) const {
+      if ((this->variablesMask & other.variablesMask) == 0)
+        return false;
+
+      if (this->variables == other.variables && this->variables != nullptr)
+        return true;
+
+      /* The masks intersect, so both trees have variables */
+      std::vector<triton::usize> copyA, copyB;
+      const std::vector<triton::usize>* a = this->variables.get();
+      const std::vector<triton::usize>* b = other.variables.get();
+
+      if (this->variablesOverflow) {
+        copyA = this->getVariableIds();
+        a = &copyA;
+      }
+
+      if (other.variablesOverflow) {
+        copyB = other.getVariableIds();
+        b = &copyB;
+      }
+
+      for (auto i = a->begin(), j = b->begin(); i != a->end() && j != b->end();) {
+        if (*i == *j)
+          return true;
+        if (*i < *j)
+          i++;
+        else
+          j++;
+      }
+
+      return false;
+    }
+
+
+    triton::uint64 AbstractNode::getDagSizeEstimate(void) const {
+      return this->dagSize;
+    }
+
+
     bool AbstractNode::hasSameConcreteValueAndTypeAs(const SharedAbstractNode& other) const {
       return (this->evaluate() == other->evaluate()) &&
              (this->getBitvectorSize() == other->getBitvectorSize()) &&
@@ -143,8 +581,23 @@ namespace triton {
 
 
     bool AbstractNode::canReplaceNodeWithoutUpdate(const SharedAbstractNode& other) const {
-      return (this->hasSameConcreteValueAndTypeAs(other)) &&
-             (this->isSymbolized() == other->isSymbolized());
+      if (!this->hasSameConcreteValueAndTypeAs(other) || this->isSymbolized() != other->isSymbolized())
+        return false;
+
+      /* The summaries kept by the parents must still hold: no new variable or array, and no bigger tree */
+      if (other->withArray && !this->withArray)
+        return false;
+
+      if (other->dagSize > this->dagSize || (other->variablesMask & ~this->variablesMask) != 0)
+        return false;
+
+      if (other->variables == this->variables || other->variables == nullptr)
+        return !other->variablesOverflow || this->variablesOverflow;
+
+      if (this->variables == nullptr)
+        return this->variablesOverflow;
+
+      return std::includes(this->variables->begin(), this->variables->end(), other->variables->begin(), other->variables->end());
     }
 
 
@@ -157,7 +610,24 @@ namespace triton {
 
 
     triton::uint512 AbstractNode::evaluate(void) const {
-      return this->eval;
+      if (this->size > triton::bitsize::qword)
+        return this->eval;
+      return this->eval64;
+    }
+
+
+    triton::uint64 AbstractNode::evaluate64(void) const {
+      if (this->size > triton::bitsize::qword)
+        return static_cast<triton::uint64>(this->eval);
+      return this->eval64;
+    }
+
+
+    void AbstractNode::setEvaluation(const triton::uint512& value) {
+      if (this->size > triton::bitsize::qword)
+        this->eval = value;
+      else
+        this->eval64 = static_cast<triton::uint64>(value);
     }
 
 
@@ -166,72 +636,193 @@ namespace triton {
     }
 
 
-    triton::uint32 AbstractNode::getLevel(void) const {
-      return this->level;
+    triton::uint64 AbstractNode::getHash64(void) const {
+      return this->hash64;
     }
 
 
-    void AbstractNode::initParents(void) {
-      auto ancestors = parentsExtraction(this->shared_from_this(), false);
-      for (auto& sp : ancestors) {
-        sp->init();
+    void AbstractNode::computeHash(void) {
+      triton::uint64 h = hashRound(static_cast<triton::uint64>(this->type), this->size);
+
+      switch (this->type) {
+        case INTEGER_NODE: {
+          triton::uint512 value = reinterpret_cast<IntegerNode*>(this)->getInteger();
+          do {
+            h = hashRound(h, static_cast<triton::uint64>(value));
+            value >>= 64;
+          } while (value != 0);
+          break;
+        }
+
+        case REFERENCE_NODE:
+          h = reinterpret_cast<ReferenceNode*>(this)->getSymbolicExpression()->getAst()->getHash64();
+          break;
+
+        case STRING_NODE:
+          h = hashRound(h, std::hash<std::string>{}(reinterpret_cast<StringNode*>(this)->getString()));
+          break;
+
+        case VARIABLE_NODE:
+          h = hashRound(h, reinterpret_cast<VariableNode*>(this)->getSymbolicVariable()->getId());
+          break;
+
+        /* The order of the operands does not change the hash of the commutative operators */
+        case BVADD_NODE:
+        case BVAND_NODE:
+        case BVMUL_NODE:
+        case BVNAND_NODE:
+        case BVNOR_NODE:
+        case BVOR_NODE:
+        case BVXNOR_NODE:
+        case BVXOR_NODE:
+        case DISTINCT_NODE:
+        case EQUAL_NODE:
+        case LAND_NODE:
+        case LOR_NODE:
+        case LXOR_NODE: {
+          triton::uint64 sum = 0;
+          for (const auto& child : this->children)
+            sum += hashAvalanche(child->getHash64());
+          h = hashRound(hashRound(h, this->children.size()), sum);
+          break;
+        }
+
+        default:
+          h = hashRound(h, this->children.size());
+          for (const auto& child : this->children)
+            h = hashRound(h, child->getHash64());
+          break;
       }
+
+      this->hash64 = hashAvalanche(h);
+
+      if (this->ctxt->isWideHashEnabled())
+        this->initHash();
+      else
+        this->hash = this->hash64;
+
+      /* The node is initialized again, its abstract value as well */
+      this->ctxt->forgetAbstractValue(this->id);
     }
 
 
-    std::vector<SharedAbstractNode>& AbstractNode::getChildren(void) {
-      return this->children;
+    triton::uint32 AbstractNode::getLevel(void) const {
+      return this->level;
     }
 
 
-    std::vector<SharedAbstractNode> AbstractNode::getParents(void) {
-      std::vector<SharedAbstractNode> res;
-      std::vector<AbstractNode*> toRemove;
+    void AbstractNode::computeSummaries(void) {
+      this->dagSize           = 1;
+      this->variables         = nullptr;
+      this->variablesMask     = 0;
+      this->variablesOverflow = false;
+      this->withArray         = (this->type == ARRAY_NODE);
 
-      for (auto& kv: parents) {
-        if (auto sp = kv.second.second.lock())
-          res.push_back(sp);
-        else
-          toRemove.push_back(kv.first);
+      if (this->type == VARIABLE_NODE) {
+        triton::usize id = reinterpret_cast<VariableNode*>(this)->getSymbolicVariable()->getId();
+        this->variables = std::make_shared<const std::vector<triton::usize>>(1, id);
+        this->variablesMask = (static_cast<triton::uint64>(1) << (id % 64));
+        return;
       }
 
-      for(auto* an: toRemove)
-        parents.erase(an);
+      /* A reference stands for the tree of its expression */
+      const SharedAbstractNode* begin = this->children.begin();
+      const SharedAbstractNode* end   = this->children.end();
+      SharedAbstractNode expr;
 
-      return res;
-    }
+      if (this->type == REFERENCE_NODE) {
+        expr  = reinterpret_cast<ReferenceNode*>(this)->getSymbolicExpression()->getAst();
+        begin = &expr;
+        end   = &expr + 1;
+      }
 
+      const AbstractNode* widest = nullptr;
+      for (const SharedAbstractNode* it = begin; it != end; it++) {
+        const AbstractNode* child = it->get();
 
-    void AbstractNode::setParent(AbstractNode* p) {
-      auto it = parents.find(p);
+        /* The same operand twice, as in (bvxor x x), is counted once */
+        if (it != begin && (it - 1)->get() == child)
+          continue;
+
+        triton::uint64 room = std::numeric_limits<triton::uint64>::max() - this->dagSize;
+        this->dagSize = (child->dagSize > room) ? std::numeric_limits<triton::uint64>::max() : this->dagSize + child->dagSize;
 
-      if (it == parents.end()) {
-        SharedAbstractNode A = p->shared_from_this();
-        this->parents.insert(std::make_pair(p, std::make_pair(1, WeakAbstractNode(A))));
+        this->variablesMask     |= child->variablesMask;
+        this->variablesOverflow |= child->variablesOverflow;
+        this->withArray         |= child->withArray;
+
+        if (child->variables && (widest == nullptr || child->variables->size() > widest->variables->size()))
+          widest = child;
       }
-      else {
-        if (it->second.second.expired()) {
-          parents.erase(it);
-          SharedAbstractNode A = p->shared_from_this();
-          this->parents.insert(std::make_pair(p, std::make_pair(1, WeakAbstractNode(A))));
+
+      if (this->variablesOverflow || widest == nullptr)
+        return;
+
+      /* The set of the widest child is shared if it holds the variables of all the others */
+      std::vector<triton::usize> ids;
+      bool covered = true;
+
+      for (const SharedAbstractNode* it = begin; it != end; it++) {
+        const AbstractNode* child = it->get();
+        if (child->variables == nullptr || child->variables == widest->variables)
+          continue;
+
+        const auto& set = *child->variables;
+        if (covered && (child->variablesMask & ~widest->variablesMask) == 0 &&
+            std::includes(widest->variables->begin(), widest->variables->end(), set.begin(), set.end()))
+          continue;
+
+        if (covered) {
+          covered = false;
+          ids = *widest->variables;
         }
-        // Ptr already in, add it for the counter
-        else {
-          it->second.first += 1;
+
+        std::vector<triton::usize> merged;
+        merged.reserve(ids.size() + set.size());
+        std::set_union(ids.begin(), ids.end(), set.begin(), set.end(), std::back_inserter(merged));
+        ids.swap(merged);
+
+        if (ids.size() > maxSummarizedVariables) {
+          this->variablesOverflow = true;
+          return;
         }
       }
+
+      if (covered)
+        this->variables = widest->variables;
+      else
+        this->variables = std::make_shared<const std::vector<triton::usize>>(std::move(ids));
+    }
+
+
+    void AbstractNode::initParents(void) {
+      auto ancestors = parentsExtraction(this->shared_from_this(), false);
+      for (auto& sp : ancestors) {
+        sp->init();
+      }
     }
 
 
-    void AbstractNode::removeParent(AbstractNode* p) {
-      auto it = this->parents.find(p);
+    NodeChildren& AbstractNode::getChildren(void) {
+      return this->children;
+    }
 
-      if (it == parents.end())
-        return;
 
-      it->second.first--;
-      if (it->second.first == 0)
-        this->parents.erase(it);
+    std::vector<SharedAbstractNode> AbstractNode::getParents(void) {
+      auto guard = this->ctxt->lockParents(this);
+      return this->parents.get();
+    }
+
+
+    void AbstractNode::setParent(AbstractNode* p) {
+      auto guard = this->ctxt->lockParents(this);
+      this->parents.add(p);
+    }
+
+
+    void AbstractNode::removeParent(AbstractNode* p) {
+      auto guard = this->ctxt->lockParents(this);
+      this->parents.remove(p);
     }
 
 
@@ -244,10 +835,11 @@ namespace triton {
 
     void AbstractNode::addChild(const SharedAbstractNode& child) {
       this->children.push_back(child);
+      this->ctxt->countChildren(1);
     }
 
 
-    void AbstractNode::setChild(triton::uint32 index, const SharedAbstractNode& child) {
+    void AbstractNode::setChild(triton::uint32 index, const SharedAbstractNode& child, bool withParents) {
       if (index >= this->children.size())
         throw triton::exceptions::Ast("AbstractNode::setChild(): Invalid index.");
 
@@ -264,14 +856,26 @@ namespace triton {
         /* Setup the child of the parent */
         this->children[index] = child;
 
-        /* Init parents */
-        child->initParents();
+        /* Init parents now, or once for all the dirty nodes */
+        if (withParents) {
+          child->initParents();
+        }
+        else {
+          /* The parents keep their abstract values until they are initialized */
+          this->ctxt->setDirtyNode(this->shared_from_this());
+          this->ctxt->forgetAbstractValues();
+        }
       }
     }
 
 
     void AbstractNode::setBitvectorSize(triton::uint32 size) {
+      triton::uint512 value = this->evaluate();
+
+      /* Keep the value in the representation of the new size */
       this->size = size;
+      this->setEvaluation(value);
+      this->ctxt->forgetAbstractValues();
     }
 
 
@@ -296,7 +900,7 @@ namespace triton {
     void ArrayNode::init(bool withParents) {
       /* Init attributes. */
       this->size       = 0; // Array do not have size.
-      this->eval       = 0; // Array cannot be evaluated.
+      this->setEvaluation(0); // Array cannot be evaluated.
       this->level      = 1;
       this->symbolized = false;
 
@@ -307,12 +911,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -330,15 +935,12 @@ namespace triton {
 
 
     void ArrayNode::store(triton::uint64 addr, triton::uint8 value) {
-      this->memory[addr] = value;
+      this->memory.store(addr, value);
     }
 
 
     triton::uint8 ArrayNode::select(triton::uint64 addr) const {
-      if (this->memory.find(addr) != this->memory.end()) {
-        return this->memory.at(addr);
-      }
-      return 0;
+      return this->memory.select(addr);
     }
 
 
@@ -352,7 +954,7 @@ namespace triton {
     }
 
 
-    std::unordered_map<triton::uint64, triton::uint8>& ArrayNode::getMemory(void) {
+    triton::ast::ArrayMemory& ArrayNode::getMemory(void) {
       return this->memory;
     }
 
@@ -379,7 +981,7 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = ((this->children[0]->evaluate()) & this->getBitvectorMask());
+      this->setEvaluation(((this->children[0]->evaluate()) & this->getBitvectorMask()));
       this->level      = 1;
       this->symbolized = false;
 
@@ -390,12 +992,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -432,14 +1035,25 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = this->children[0]->evaluate() & 0xff;
       this->level      = 1;
       this->symbolized = false;
 
       /* Init eval */
-      for (triton::uint32 index = 8 ; index != this->size ; index += triton::bitsize::byte) {
-        this->eval <<= triton::bitsize::byte;
-        this->eval |= ((this->children[0]->evaluate() >> index) & 0xff);
+      if (this->size <= triton::bitsize::qword) {
+        triton::uint64 value = this->children[0]->evaluate64();
+        this->eval64 = value & 0xff;
+        for (triton::uint32 index = 8 ; index != this->size ; index += triton::bitsize::byte) {
+          this->eval64 <<= triton::bitsize::byte;
+          this->eval64 |= ((value >> index) & 0xff);
+        }
+      }
+      else {
+        triton::uint512 value = this->children[0]->evaluate();
+        this->eval = value & 0xff;
+        for (triton::uint32 index = 8 ; index != this->size ; index += triton::bitsize::byte) {
+          this->eval <<= triton::bitsize::byte;
+          this->eval |= ((value >> index) & 0xff);
+        }
       }
 
       /* Init children and spread information */
@@ -449,12 +1063,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -492,10 +1107,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = ((this->children[0]->evaluate() + this->children[1]->evaluate()) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = ((this->children[0]->evaluate64() + this->children[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->eval = triton::utils::wideAdd(this->children[0]->evaluate(), this->children[1]->evaluate(), this->size);
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -503,12 +1123,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -546,10 +1167,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = (this->children[0]->evaluate() & this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = (this->children[0]->evaluate64() & this->children[1]->evaluate64());
+      else
+        this->eval = (this->children[0]->evaluate() & this->children[1]->evaluate());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -557,12 +1183,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -589,9 +1216,7 @@ namespace triton {
 
 
     void BvashrNode::init(bool withParents) {
-      triton::uint32 shift  = 0;
-      triton::uint512 mask  = 0;
-      triton::uint512 value = 0;
+      triton::uint32 shift = 0;
 
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvashrNode::init(): Must take at least two children.");
@@ -602,38 +1227,29 @@ namespace triton {
       if (this->children[0]->isArray() || this->children[1]->isArray())
         throw triton::exceptions::Ast("BvashrNode::init(): Cannot take an array as argument.");
 
-      value = this->children[0]->evaluate();
-      shift = static_cast<triton::uint32>(this->children[1]->evaluate());
+      shift = static_cast<triton::uint32>(this->children[1]->evaluate64());
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
       this->level      = 1;
       this->symbolized = false;
 
-      /* Mask based on the sign */
-      if (this->children[0]->isSigned()) {
-        mask = 1;
-        mask = ((mask << (this->size-1)) & this->getBitvectorMask());
-      }
-
-      if (shift >= this->size && this->children[0]->isSigned()) {
-        this->eval = -1;
-        this->eval &= this->getBitvectorMask();
-      }
+      /* Native shift, the vacated bits are filled with the sign */
+      if (this->size <= triton::bitsize::qword) {
+        triton::uint64 value64 = this->children[0]->evaluate64();
+        triton::uint64 mask64  = this->getBitvectorMask64();
+        bool sign              = this->children[0]->isSigned();
 
-      else if (shift >= this->size && !this->children[0]->isSigned()) {
-        this->eval = 0;
-      }
-
-      else if (shift == 0) {
-        this->eval = value;
+        if (shift >= this->size)
+          this->eval64 = (sign ? mask64 : 0);
+        else if (sign && shift)
+          this->eval64 = (((value64 >> shift) | (~(mask64 >> shift))) & mask64);
+        else
+          this->eval64 = (value64 >> shift);
       }
 
       else {
-        this->eval = value & this->getBitvectorMask();
-        for (triton::uint32 index = 0; index < shift; index++) {
-          this->eval = (((this->eval >> 1) | mask) & this->getBitvectorMask());
-        }
+        this->eval = triton::utils::wideAshr(this->children[0]->evaluate(), this->children[1]->evaluate(), this->size);
       }
 
       /* Init children and spread information */
@@ -643,12 +1259,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -686,10 +1303,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = (this->children[0]->evaluate() >> static_cast<triton::uint32>(this->children[1]->evaluate()));
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = (static_cast<triton::uint32>(this->children[1]->evaluate64()) >= this->size ? 0 : (this->children[0]->evaluate64() >> static_cast<triton::uint32>(this->children[1]->evaluate64())));
+      else
+        this->eval = triton::utils::wideLshr(this->children[0]->evaluate(), this->children[1]->evaluate(), this->size);
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -697,12 +1319,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -740,10 +1363,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = ((this->children[0]->evaluate() * this->children[1]->evaluate()) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = ((this->children[0]->evaluate64() * this->children[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->eval = triton::utils::wideMul(this->children[0]->evaluate(), this->children[1]->evaluate(), this->size);
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -751,12 +1379,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -794,10 +1423,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = (~(this->children[0]->evaluate() & this->children[1]->evaluate()) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = (~(this->children[0]->evaluate64() & this->children[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->eval = (~(this->children[0]->evaluate() & this->children[1]->evaluate()) & this->getBitvectorMask());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -805,12 +1439,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -844,10 +1479,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = (static_cast<triton::uint512>((-(static_cast<triton::sint512>(this->children[0]->evaluate())))) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = ((~this->children[0]->evaluate64() + 1) & this->getBitvectorMask64());
+      else
+        this->eval = (static_cast<triton::uint512>((-(static_cast<triton::sint512>(this->children[0]->evaluate())))) & this->getBitvectorMask());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -855,12 +1495,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -898,10 +1539,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = (~(this->children[0]->evaluate() | this->children[1]->evaluate()) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = (~(this->children[0]->evaluate64() | this->children[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->eval = (~(this->children[0]->evaluate() | this->children[1]->evaluate()) & this->getBitvectorMask());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -909,12 +1555,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -948,10 +1595,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = (~this->children[0]->evaluate() & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = (~this->children[0]->evaluate64() & this->getBitvectorMask64());
+      else
+        this->eval = (~this->children[0]->evaluate() & this->getBitvectorMask());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -959,12 +1611,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1002,10 +1655,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = (this->children[0]->evaluate() | this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = (this->children[0]->evaluate64() | this->children[1]->evaluate64());
+      else
+        this->eval = (this->children[0]->evaluate() | this->children[1]->evaluate());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1013,12 +1671,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1049,8 +1708,7 @@ namespace triton {
 
 
     void BvrolNode::init(bool withParents) {
-      triton::uint32 rot    = 0;
-      triton::uint512 value = 0;
+      triton::uint32 rot = 0;
 
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvrolNode::init(): Must take at least two children.");
@@ -1059,15 +1717,22 @@ namespace triton {
         throw triton::exceptions::Ast("BvrolNode::init(): Cannot take an array as argument.");
 
       rot   = triton::ast::getInteger<triton::uint32>(this->children[1]);
-      value = this->children[0]->evaluate();
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
       rot             %= this->size;
-      this->eval       = (((value << rot) | (value >> (this->size - rot))) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval, a rotation by zero keeps the value */
+      if (this->size <= triton::bitsize::qword) {
+        triton::uint64 value64 = this->children[0]->evaluate64();
+        this->eval64 = (rot == 0 ? value64 : (((value64 << rot) | (value64 >> (this->size - rot))) & this->getBitvectorMask64()));
+      }
+      else {
+        this->eval = triton::utils::wideRol(this->children[0]->evaluate(), rot, this->size);
+      }
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1075,12 +1740,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1111,8 +1777,7 @@ namespace triton {
 
 
     void BvrorNode::init(bool withParents) {
-      triton::uint32 rot    = 0;
-      triton::uint512 value = 0;
+      triton::uint32 rot = 0;
 
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvrorNode::init(): Must take at least two children.");
@@ -1121,15 +1786,22 @@ namespace triton {
         throw triton::exceptions::Ast("BvrorNode::init(): Cannot take an array as argument.");
 
       rot   = triton::ast::getInteger<triton::uint32>(this->children[1]);
-      value = this->children[0]->evaluate();
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
       rot             %= this->size;
-      this->eval       = (((value >> rot) | (value << (this->size - rot))) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval, a rotation by zero keeps the value */
+      if (this->size <= triton::bitsize::qword) {
+        triton::uint64 value64 = this->children[0]->evaluate64();
+        this->eval64 = (rot == 0 ? value64 : (((value64 >> rot) | (value64 << (this->size - rot))) & this->getBitvectorMask64()));
+      }
+      else {
+        this->eval = triton::utils::wideRor(this->children[0]->evaluate(), rot, this->size);
+      }
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1137,12 +1809,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1190,12 +1863,10 @@ namespace triton {
       this->level      = 1;
       this->symbolized = false;
 
-      if (op2Signed == 0) {
-        this->eval = (op1Signed < 0 ? 1 : -1);
-        this->eval &= this->getBitvectorMask();
-      }
+      if (op2Signed == 0)
+        this->setEvaluation(static_cast<triton::uint512>(op1Signed < 0 ? 1 : -1) & this->getBitvectorMask());
       else
-        this->eval = (static_cast<triton::uint512>((op1Signed / op2Signed)) & this->getBitvectorMask());
+        this->setEvaluation((static_cast<triton::uint512>((op1Signed / op2Signed)) & this->getBitvectorMask()));
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1204,12 +1875,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1236,9 +1908,6 @@ namespace triton {
 
 
     void BvsgeNode::init(bool withParents) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvsgeNode::init(): Must take at least two children.");
 
@@ -1248,16 +1917,19 @@ namespace triton {
       if (this->children[0]->isArray() || this->children[1]->isArray())
         throw triton::exceptions::Ast("BvsgeNode::init(): Cannot take an array as argument.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size       = 1;
-      this->eval       = (op1Signed >= op2Signed);
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword) {
+        this->eval64 = (signExtend64(this->children[0].get()) >= signExtend64(this->children[1].get()));
+      }
+      else {
+        this->eval64 = !triton::utils::wideSlt(this->children[0]->evaluate(), this->children[1]->evaluate(), this->children[0]->getBitvectorSize());
+      }
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1265,12 +1937,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1297,9 +1970,6 @@ namespace triton {
 
 
     void BvsgtNode::init(bool withParents) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvsgtNode::init(): Must take at least two children.");
 
@@ -1309,16 +1979,19 @@ namespace triton {
       if (this->children[0]->isArray() || this->children[1]->isArray())
         throw triton::exceptions::Ast("BvsgtNode::init(): Cannot take an array as argument.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size       = 1;
-      this->eval       = (op1Signed > op2Signed);
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword) {
+        this->eval64 = (signExtend64(this->children[0].get()) > signExtend64(this->children[1].get()));
+      }
+      else {
+        this->eval64 = triton::utils::wideSlt(this->children[1]->evaluate(), this->children[0]->evaluate(), this->children[0]->getBitvectorSize());
+      }
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1326,12 +1999,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1369,10 +2043,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = ((this->children[0]->evaluate() << static_cast<triton::uint32>(this->children[1]->evaluate())) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = (static_cast<triton::uint32>(this->children[1]->evaluate64()) >= this->size ? 0 : ((this->children[0]->evaluate64() << static_cast<triton::uint32>(this->children[1]->evaluate64())) & this->getBitvectorMask64()));
+      else
+        this->eval = triton::utils::wideShl(this->children[0]->evaluate(), this->children[1]->evaluate(), this->size);
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1380,12 +2059,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1412,28 +2092,28 @@ namespace triton {
 
 
     void BvsleNode::init(bool withParents) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvsleNode::init(): Must take at least two children.");
 
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsleNode::init(): Must take two nodes of same size.");
 
-      if (this->children[0]->isArray() || this->children[1]->isArray())
-        throw triton::exceptions::Ast("BvsleNode::init(): Cannot take an array as argument.");
-
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
+      if (this->children[0]->isArray() || this->children[1]->isArray())
+        throw triton::exceptions::Ast("BvsleNode::init(): Cannot take an array as argument.");
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = (op1Signed <= op2Signed);
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword) {
+        this->eval64 = (signExtend64(this->children[0].get()) <= signExtend64(this->children[1].get()));
+      }
+      else {
+        this->eval64 = !triton::utils::wideSlt(this->children[1]->evaluate(), this->children[0]->evaluate(), this->children[0]->getBitvectorSize());
+      }
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1441,12 +2121,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1473,9 +2154,6 @@ namespace triton {
 
 
     void BvsltNode::init(bool withParents) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvsltNode::init(): Must take at least two children.");
 
@@ -1485,16 +2163,19 @@ namespace triton {
       if (this->children[0]->isArray() || this->children[1]->isArray())
         throw triton::exceptions::Ast("BvsltNode::init(): Cannot take an array as argument.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size       = 1;
-      this->eval       = (op1Signed < op2Signed);
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword) {
+        this->eval64 = (signExtend64(this->children[0].get()) < signExtend64(this->children[1].get()));
+      }
+      else {
+        this->eval64 = triton::utils::wideSlt(this->children[0]->evaluate(), this->children[1]->evaluate(), this->children[0]->getBitvectorSize());
+      }
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1502,12 +2183,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1556,9 +2238,9 @@ namespace triton {
       this->symbolized = false;
 
       if (this->children[1]->evaluate() == 0)
-        this->eval = this->children[0]->evaluate();
+        this->setEvaluation(this->children[0]->evaluate());
       else
-        this->eval = (static_cast<triton::uint512>((((op1Signed % op2Signed) + op2Signed) % op2Signed)) & this->getBitvectorMask());
+        this->setEvaluation((static_cast<triton::uint512>((((op1Signed % op2Signed) + op2Signed) % op2Signed)) & this->getBitvectorMask()));
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1567,12 +2249,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1621,9 +2304,9 @@ namespace triton {
       this->symbolized = false;
 
       if (this->children[1]->evaluate() == 0)
-        this->eval = this->children[0]->evaluate();
+        this->setEvaluation(this->children[0]->evaluate());
       else
-        this->eval = (static_cast<triton::uint512>((op1Signed - ((op1Signed / op2Signed) * op2Signed))) & this->getBitvectorMask());
+        this->setEvaluation((static_cast<triton::uint512>((op1Signed - ((op1Signed / op2Signed) * op2Signed))) & this->getBitvectorMask()));
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1632,12 +2315,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1675,10 +2359,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = ((this->children[0]->evaluate() - this->children[1]->evaluate()) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = ((this->children[0]->evaluate64() - this->children[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->eval = triton::utils::wideSub(this->children[0]->evaluate(), this->children[1]->evaluate(), this->size);
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1686,12 +2375,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1732,10 +2422,18 @@ namespace triton {
       this->level      = 1;
       this->symbolized = false;
 
-      if (this->children[1]->evaluate() == 0)
-        this->eval = (-1 & this->getBitvectorMask());
-      else
-        this->eval = (this->children[0]->evaluate() / this->children[1]->evaluate());
+      if (this->size <= triton::bitsize::qword) {
+        if (this->children[1]->evaluate64() == 0)
+          this->eval64 = this->getBitvectorMask64();
+        else
+          this->eval64 = (this->children[0]->evaluate64() / this->children[1]->evaluate64());
+      }
+      else {
+        if (this->children[1]->evaluate() == 0)
+          this->eval = (-1 & this->getBitvectorMask());
+        else
+          this->eval = (this->children[0]->evaluate() / this->children[1]->evaluate());
+      }
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1744,12 +2442,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1787,10 +2486,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = (this->children[0]->evaluate() >= this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword)
+        this->eval64 = (this->children[0]->evaluate64() >= this->children[1]->evaluate64());
+      else
+        this->eval64 = !triton::utils::wideUlt(this->children[0]->evaluate(), this->children[1]->evaluate(), this->children[0]->getBitvectorSize());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1798,12 +2502,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1841,10 +2546,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = (this->children[0]->evaluate() > this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword)
+        this->eval64 = (this->children[0]->evaluate64() > this->children[1]->evaluate64());
+      else
+        this->eval64 = triton::utils::wideUlt(this->children[1]->evaluate(), this->children[0]->evaluate(), this->children[0]->getBitvectorSize());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1852,12 +2562,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1895,10 +2606,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = (this->children[0]->evaluate() <= this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword)
+        this->eval64 = (this->children[0]->evaluate64() <= this->children[1]->evaluate64());
+      else
+        this->eval64 = !triton::utils::wideUlt(this->children[1]->evaluate(), this->children[0]->evaluate(), this->children[0]->getBitvectorSize());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1906,12 +2622,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -1949,10 +2666,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = (this->children[0]->evaluate() < this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword)
+        this->eval64 = (this->children[0]->evaluate64() < this->children[1]->evaluate64());
+      else
+        this->eval64 = triton::utils::wideUlt(this->children[0]->evaluate(), this->children[1]->evaluate(), this->children[0]->getBitvectorSize());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1960,12 +2682,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2006,10 +2729,18 @@ namespace triton {
       this->level      = 1;
       this->symbolized = false;
 
-      if (this->children[1]->evaluate() == 0)
-        this->eval = this->children[0]->evaluate();
-      else
-        this->eval = (this->children[0]->evaluate() % this->children[1]->evaluate());
+      if (this->size <= triton::bitsize::qword) {
+        if (this->children[1]->evaluate64() == 0)
+          this->eval64 = this->children[0]->evaluate64();
+        else
+          this->eval64 = (this->children[0]->evaluate64() % this->children[1]->evaluate64());
+      }
+      else {
+        if (this->children[1]->evaluate() == 0)
+          this->eval = this->children[0]->evaluate();
+        else
+          this->eval = (this->children[0]->evaluate() % this->children[1]->evaluate());
+      }
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -2018,12 +2749,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2061,10 +2793,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = (~(this->children[0]->evaluate() ^ this->children[1]->evaluate()) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = (~(this->children[0]->evaluate64() ^ this->children[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->eval = (~(this->children[0]->evaluate() ^ this->children[1]->evaluate()) & this->getBitvectorMask());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -2072,12 +2809,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2115,10 +2853,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = (this->children[0]->evaluate() ^ this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = (this->children[0]->evaluate64() ^ this->children[1]->evaluate64());
+      else
+        this->eval = (this->children[0]->evaluate() ^ this->children[1]->evaluate());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -2126,12 +2869,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2176,10 +2920,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = size;
-      this->eval       = (value & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = (static_cast<triton::uint64>(value) & this->getBitvectorMask64());
+      else
+        this->eval = (value & this->getBitvectorMask());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -2187,12 +2936,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2217,8 +2967,8 @@ namespace triton {
         throw triton::exceptions::Ast("CompoundNode::init(): Must take at least one child.");
 
       /* Init attributes */
-      this->eval       = 0;
       this->size       = 0;
+      this->setEvaluation(0);
       this->level      = 1;
       this->symbolized = false;
 
@@ -2229,12 +2979,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2275,9 +3026,16 @@ namespace triton {
       if (this->size > triton::bitsize::max_supported)
         throw triton::exceptions::Ast("ConcatNode::init(): Size cannot be greater than triton::bitsize::max_supported.");
 
-      this->eval = this->children[0]->evaluate();
-      for (triton::uint32 index = 0; index < this->children.size()-1; index++)
-        this->eval = ((this->eval << this->children[index+1]->getBitvectorSize()) | this->children[index+1]->evaluate());
+      if (this->size <= triton::bitsize::qword) {
+        this->eval64 = this->children[0]->evaluate64();
+        for (triton::uint32 index = 0; index < this->children.size()-1; index++)
+          this->eval64 = ((this->eval64 << this->children[index+1]->getBitvectorSize()) | this->children[index+1]->evaluate64());
+      }
+      else {
+        this->eval = this->children[0]->evaluate();
+        for (triton::uint32 index = 0; index < this->children.size()-1; index++)
+          this->eval = ((this->eval << this->children[index+1]->getBitvectorSize()) | this->children[index+1]->evaluate());
+      }
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -2289,12 +3047,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2328,7 +3087,7 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = this->children[0]->evaluate();
+      this->setEvaluation(this->children[0]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
@@ -2339,12 +3098,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2382,10 +3142,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = (this->children[0]->evaluate() != this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword)
+        this->eval64 = (this->children[0]->evaluate64() != this->children[1]->evaluate64());
+      else
+        this->eval64 = (this->children[0]->evaluate() != this->children[1]->evaluate());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -2393,12 +3158,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2436,10 +3202,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = (this->children[0]->evaluate() == this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword)
+        this->eval64 = (this->children[0]->evaluate64() == this->children[1]->evaluate64());
+      else
+        this->eval64 = (this->children[0]->evaluate() == this->children[1]->evaluate());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -2447,12 +3218,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2497,10 +3269,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = ((high - low) + 1);
-      this->eval       = ((this->children[2]->evaluate() >> low) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[2]->getBitvectorSize() <= triton::bitsize::qword)
+        this->eval64 = ((this->children[2]->evaluate64() >> low) & this->getBitvectorMask64());
+      else
+        this->setEvaluation(triton::utils::wideExtract(this->children[2]->evaluate(), high, low));
+
       if (this->size > this->children[2]->getBitvectorSize() || high >= this->children[2]->getBitvectorSize())
         throw triton::exceptions::Ast("ExtractNode::init(): The size of the extraction is higher than the child expression.");
 
@@ -2511,12 +3288,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2551,7 +3329,7 @@ namespace triton {
         throw triton::exceptions::Ast("ForallNode::init(): Must take a logical node as body.");
 
       this->size       = 1;
-      this->eval       = 0;
+      this->eval64     = 0;
       this->level      = 1;
       this->symbolized = false;
 
@@ -2562,12 +3340,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2608,7 +3387,7 @@ namespace triton {
       triton::uint512 Q = this->children[1]->evaluate();
 
       this->size       = 1;
-      this->eval       = (P && Q) || (!P && !Q);
+      this->setEvaluation((P && Q) || (!P && !Q));
       this->level      = 1;
       this->symbolized = false;
 
@@ -2619,12 +3398,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2651,17 +3431,18 @@ namespace triton {
 
     void IntegerNode::init(bool withParents) {
       /* Init attributes */
-      this->eval        = 0;
       this->size        = 0;
+      this->setEvaluation(0);
       this->level       = 1;
       this->symbolized  = false;
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2708,11 +3489,16 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[1]->getBitvectorSize();
-      this->eval       = this->children[0]->evaluate() ? this->children[1]->evaluate() : this->children[2]->evaluate();
       this->logical    = this->children[1]->isLogical();
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = (this->children[0]->evaluate64() ? this->children[1]->evaluate64() : this->children[2]->evaluate64());
+      else
+        this->eval = this->children[0]->evaluate() ? this->children[1]->evaluate() : this->children[2]->evaluate();
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -2726,12 +3512,13 @@ namespace triton {
         this->symbolized = true;
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2763,7 +3550,7 @@ namespace triton {
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = 1;
+      this->eval64     = 1;
       this->level      = 1;
       this->symbolized = false;
 
@@ -2774,16 +3561,17 @@ namespace triton {
         }
         this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
-        this->eval = this->eval && this->children[index]->evaluate();
+        this->eval64 = this->eval64 && this->children[index]->evaluate64();
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2819,7 +3607,7 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[2]->getBitvectorSize();
-      this->eval       = this->children[2]->evaluate();
+      this->setEvaluation(this->children[2]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
@@ -2830,12 +3618,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2866,7 +3655,7 @@ namespace triton {
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = !(this->children[0]->evaluate());
+      this->eval64     = !(this->children[0]->evaluate64());
       this->level      = 1;
       this->symbolized = false;
 
@@ -2880,12 +3669,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2917,7 +3707,7 @@ namespace triton {
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = 0;
+      this->eval64     = 0;
       this->level      = 1;
       this->symbolized = false;
 
@@ -2928,16 +3718,17 @@ namespace triton {
         }
         this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
-        this->eval = this->eval || this->children[index]->evaluate();
+        this->eval64 = this->eval64 || this->children[index]->evaluate64();
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -2969,7 +3760,7 @@ namespace triton {
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = 0;
+      this->eval64     = 0;
       this->level      = 1;
       this->symbolized = false;
 
@@ -2980,16 +3771,17 @@ namespace triton {
         }
         this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
-        this->eval = !this->eval != !this->children[index]->evaluate();
+        this->eval64 = !this->eval64 != !this->children[index]->evaluate64();
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -3018,20 +3810,25 @@ namespace triton {
     void ReferenceNode::init(bool withParents) {
       /* Init attributes */
       this->array       = this->expr->getAst()->isArray();
-      this->eval        = this->expr->getAst()->evaluate();
       this->logical     = this->expr->getAst()->isLogical();
       this->size        = this->expr->getAst()->getBitvectorSize();
       this->symbolized  = this->expr->getAst()->isSymbolized();
       this->level       = 1 + this->expr->getAst()->getLevel();
 
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = this->expr->getAst()->evaluate64();
+      else
+        this->eval = this->expr->getAst()->evaluate();
+
       this->expr->getAst()->setParent(this);
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -3077,10 +3874,10 @@ namespace triton {
       auto node = triton::ast::dereference(this->children[0]);
       switch(node->getType()) {
         case ARRAY_NODE:
-          this->eval = reinterpret_cast<ArrayNode*>(node.get())->select(this->children[1]);
+          this->setEvaluation(reinterpret_cast<ArrayNode*>(node.get())->select(this->children[1]));
           break;
         case STORE_NODE:
-          this->eval = reinterpret_cast<StoreNode*>(node.get())->select(this->children[1]);
+          this->setEvaluation(reinterpret_cast<StoreNode*>(node.get())->select(this->children[1]));
           break;
         default:
           throw triton::exceptions::Ast("SelectNode::init(): Invalid sort");
@@ -3093,12 +3890,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -3146,12 +3944,12 @@ namespace triton {
         throw triton::exceptions::Ast("StoreNode::init(): The stored node must be 8-bit long");
 
       /* Init attributes */
-      this->eval       = this->children[2]->evaluate();
       this->size       = 0; // Array do not have size.
+      this->setEvaluation(this->children[2]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
-      /* Spread the memory array from previous level */
+      /* Spread the memory array from previous level, the copy shares its cells */
       auto node = triton::ast::dereference(this->children[0]);
       switch(node->getType()) {
         case ARRAY_NODE:
@@ -3167,7 +3965,7 @@ namespace triton {
       }
 
       /* Store the value to the memory array */
-      this->memory[static_cast<triton::uint64>(this->children[1]->evaluate())] = static_cast<triton::uint8>(this->eval);
+      this->memory.store(static_cast<triton::uint64>(this->children[1]->evaluate()), static_cast<triton::uint8>(this->evaluate64()));
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -3176,12 +3974,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -3199,10 +3998,7 @@ namespace triton {
 
 
     triton::uint8 StoreNode::select(triton::uint64 addr) const {
-      if (this->memory.find(addr) != this->memory.end()) {
-        return this->memory.at(addr);
-      }
-      return 0;
+      return this->memory.select(addr);
     }
 
 
@@ -3216,7 +4012,7 @@ namespace triton {
     }
 
 
-    std::unordered_map<triton::uint64, triton::uint8>& StoreNode::getMemory(void) {
+    const triton::ast::ArrayMemory& StoreNode::getMemory(void) const {
       return this->memory;
     }
 
@@ -3236,17 +4032,18 @@ namespace triton {
 
     void StringNode::init(bool withParents) {
       /* Init attributes */
-      this->eval        = 0;
       this->size        = 0;
+      this->setEvaluation(0);
       this->level       = 1;
       this->symbolized  = false;
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -3294,8 +4091,15 @@ namespace triton {
 
       this->level      = 1;
       this->symbolized = false;
-      this->eval       = ((((this->children[1]->evaluate() >> (this->children[1]->getBitvectorSize()-1)) == 0) ?
-                          this->children[1]->evaluate() : (this->children[1]->evaluate() | ~(this->children[1]->getBitvectorMask()))) & this->getBitvectorMask());
+
+      if (this->size <= triton::bitsize::qword) {
+        triton::uint64 value = this->children[1]->evaluate64();
+        this->eval64 = (((this->children[1]->isSigned() == false) ? value : (value | ~(this->children[1]->getBitvectorMask64()))) & this->getBitvectorMask64());
+      }
+      else {
+        this->eval = ((((this->children[1]->evaluate() >> (this->children[1]->getBitvectorSize()-1)) == 0) ?
+                     this->children[1]->evaluate() : (this->children[1]->evaluate() | ~(this->children[1]->getBitvectorMask()))) & this->getBitvectorMask());
+      }
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -3304,12 +4108,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -3337,16 +4142,17 @@ namespace triton {
 
     void VariableNode::init(bool withParents) {
       this->size        = this->symVar->getSize();
-      this->eval        = this->ctxt->getVariableValue(this->symVar->getName()) & this->getBitvectorMask();
+      this->setEvaluation(this->ctxt->getVariableValue(this->symVar->getId()) & this->getBitvectorMask());
       this->symbolized  = true;
       this->level       = 1;
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -3393,10 +4199,15 @@ namespace triton {
       if (size > triton::bitsize::max_supported)
         throw triton::exceptions::Ast("ZxNode::init(): Size cannot be greater than triton::bitsize::max_supported.");
 
-      this->eval       = (this->children[1]->evaluate() & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval64 = (this->children[1]->evaluate64() & this->getBitvectorMask64());
+      else
+        this->eval = (this->children[1]->evaluate() & this->getBitvectorMask());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -3404,12 +4215,13 @@ namespace triton {
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
+      this->computeHash();
+      this->computeSummaries();
+
       /* Init parents if needed */
       if (withParents) {
         this->initParents();
       }
-
-      this->initHash();
     }
 
 
@@ -3601,6 +4413,62 @@ namespace triton {
     }
 
 
+    VisitedNodes::VisitedNodes(const SharedAstContext& ctxt) {
+      if (ctxt == nullptr)
+        throw triton::exceptions::Ast("VisitedNodes::VisitedNodes(): The context cannot be null.");
+
+      this->ctxt = ctxt;
+      std::tie(this->stamps, this->epoch) = this->ctxt->acquireVisitStamps();
+    }
+
+
+    VisitedNodes::~VisitedNodes() {
+      this->ctxt->releaseVisitStamps(std::move(this->stamps), this->epoch);
+    }
+
+
+    bool VisitedNodes::insert(const AbstractNode* node) {
+      if (node->getContext() != this->ctxt)
+        return this->others.insert(node).second;
+
+      triton::uint32 id = node->getId();
+      if (id >= this->stamps.size())
+        this->stamps.resize(std::max<triton::usize>(id + 1, this->ctxt->getNodeIdsSize()), 0);
+
+      if (this->stamps[id] == this->epoch)
+        return false;
+
+      this->stamps[id] = this->epoch;
+      return true;
+    }
+
+
+    bool VisitedNodes::contains(const AbstractNode* node) const {
+      if (node->getContext() != this->ctxt)
+        return this->others.find(node) != this->others.end();
+
+      triton::uint32 id = node->getId();
+      return id < this->stamps.size() && this->stamps[id] == this->epoch;
+    }
+
+
+    AbstractNode* TopologicalSort::getReferencedNode(AbstractNode* node) {
+      return reinterpret_cast<ReferenceNode*>(node)->getSymbolicExpression()->getAst().get();
+    }
+
+
+    const std::vector<AbstractNode*>& TopologicalSort::sort(const std::vector<AbstractNode*>& roots, bool unroll) {
+      this->order.clear();
+      this->visit(roots, unroll, [this](AbstractNode* node) { this->order.push_back(node); });
+      return this->order;
+    }
+
+
+    const std::vector<AbstractNode*>& TopologicalSort::sort(const SharedAbstractNode& root, bool unroll) {
+      return this->sort(std::vector<AbstractNode*>{root.get()}, unroll);
+    }
+
+
     SharedAbstractNode newInstance(AbstractNode* node, bool unroll) {
       std::unordered_map<AbstractNode*, SharedAbstractNode> exprs;
       auto nodes = childrenExtraction(node->shared_from_this(), unroll, true);
@@ -3623,6 +4491,51 @@ namespace triton {
     }
 
 
+    SharedAbstractNode newInstance(AbstractNode* node, const std::unordered_map<AbstractNode*, SharedAbstractNode>& bindings) {
+      std::unordered_map<AbstractNode*, SharedAbstractNode> exprs;
+      std::stack<std::pair<AbstractNode*, bool>> worklist;
+
+      worklist.push({node, false});
+      while (!worklist.empty()) {
+        auto item = worklist.top();
+        worklist.pop();
+
+        if (exprs.find(item.first) != exprs.end())
+          continue;
+
+        /* Bound nodes are used as they are */
+        auto it = bindings.find(item.first);
+        if (it != bindings.end()) {
+          exprs[item.first] = it->second;
+          continue;
+        }
+
+        /* Copy the node once all its children are copied */
+        if (item.second == false) {
+          worklist.push({item.first, true});
+          for (const auto& child : item.first->getChildren()) {
+            if (exprs.find(child.get()) == exprs.end())
+              worklist.push({child.get(), false});
+          }
+          continue;
+        }
+
+        const auto& newNode = shallowCopy(item.first, false);
+        if (newNode.get() != item.first) {
+          for (auto& child : newNode->getChildren()) {
+            child = exprs.at(child.get());
+            child->setParent(newNode.get());
+          }
+          /* Children may evaluate differently */
+          newNode->init();
+        }
+        exprs[item.first] = newNode;
+      }
+
+      return exprs.at(node);
+    }
+
+
     SharedAbstractNode unroll(const triton::ast::SharedAbstractNode& node) {
       return triton::ast::newInstance(node.get(), true);
     }
@@ -3638,19 +4551,29 @@ namespace triton {
      * @revert - reverses the result
      * @descent - if true we traverse through children of nodes, otherwise parents
      */
-    static std::vector<SharedAbstractNode> nodesExtraction(const SharedAbstractNode& node, bool unroll, bool revert, bool descend) {
+    static std::vector<SharedAbstractNode> nodesExtraction(const std::vector<SharedAbstractNode>& nodes, bool unroll, bool revert, bool descend) {
       std::vector<SharedAbstractNode> result;
-      std::unordered_set<AbstractNode*> visited;
       std::stack<std::pair<SharedAbstractNode, bool>> worklist;
 
-      if (node == nullptr)
+      if (nodes.empty())
+        return result;
+
+      if (nodes.front() == nullptr)
         throw triton::exceptions::Ast("triton::ast::nodesExtraction(): Node cannot be null.");
 
+      VisitedNodes visited(nodes.front()->getContext());
+
       /*
        *  We use a worklist strategy to avoid recursive calls
        *  and so stack overflow when going through a big AST.
+       *  The roots share the visited set, so a node reachable
+       *  from several of them is extracted once.
        */
-      worklist.push({node, false});
+      for (auto it = nodes.rbegin(); it != nodes.rend(); it++) {
+        if (*it == nullptr)
+          throw triton::exceptions::Ast("triton::ast::nodesExtraction(): Node cannot be null.");
+        worklist.push({*it, false});
+      }
 
       while (!worklist.empty()) {
         SharedAbstractNode ast;
@@ -3664,7 +4587,7 @@ namespace triton {
           continue;
         }
 
-        if (!visited.insert(ast.get()).second) {
+        if (!visited.insert(ast.get())) {
           continue;
         }
 
@@ -3674,7 +4597,7 @@ namespace triton {
 
         /* Proceed relatives */
         for (const auto& r : relatives) {
-          if (visited.find(r.get()) == visited.end()) {
+          if (!visited.contains(r.get())) {
             worklist.push({r, false});
           }
         }
@@ -3682,7 +4605,7 @@ namespace triton {
         /* If unroll is true, we unroll all references */
         if (unroll && ast->getType() == REFERENCE_NODE) {
           const SharedAbstractNode& ref = reinterpret_cast<ReferenceNode*>(ast.get())->getSymbolicExpression()->getAst();
-          if (visited.find(ref.get()) == visited.end()) {
+          if (!visited.contains(ref.get())) {
             worklist.push({ref, false});
           }
         }
@@ -3698,19 +4621,52 @@ namespace triton {
 
 
     std::vector<SharedAbstractNode> childrenExtraction(const SharedAbstractNode& node, bool unroll, bool revert) {
-      return nodesExtraction(node, unroll, revert, true);
+      return childrenExtraction(std::vector<SharedAbstractNode>{node}, unroll, revert);
+    }
+
+
+    std::vector<SharedAbstractNode> childrenExtraction(const std::vector<SharedAbstractNode>& nodes, bool unroll, bool revert) {
+      std::vector<AbstractNode*> roots;
+      std::vector<SharedAbstractNode> result;
+      TopologicalSort sort;
+
+      roots.reserve(nodes.size());
+      for (const auto& node : nodes) {
+        if (node == nullptr)
+          throw triton::exceptions::Ast("triton::ast::childrenExtraction(): Node cannot be null.");
+        roots.push_back(node.get());
+      }
+
+      /* The nodes are only shared once sorted */
+      const auto& order = sort.sort(roots, unroll);
+      result.reserve(order.size());
+      if (revert) {
+        for (auto* node : order)
+          result.push_back(node->shared_from_this());
+      }
+      else {
+        for (auto it = order.rbegin(); it != order.rend(); it++)
+          result.push_back((*it)->shared_from_this());
+      }
+
+      return result;
     }
 
 
     std::vector<SharedAbstractNode> parentsExtraction(const SharedAbstractNode& node, bool revert) {
-      return nodesExtraction(node, false, revert, false);
+      return nodesExtraction({node}, false, revert, false);
+    }
+
+
+    std::vector<SharedAbstractNode> parentsExtraction(const std::vector<SharedAbstractNode>& nodes, bool revert) {
+      return nodesExtraction(nodes, false, revert, false);
     }
 
 
     std::deque<SharedAbstractNode> search(const SharedAbstractNode& node, triton::ast::ast_e match) {
-      std::stack<AbstractNode*>                worklist;
-      std::deque<SharedAbstractNode>           result;
-      std::unordered_set<const AbstractNode*>  visited;
+      std::stack<AbstractNode*>       worklist;
+      std::deque<SharedAbstractNode>  result;
+      VisitedNodes                    visited(node->getContext());
 
       worklist.push(node.get());
       while (!worklist.empty()) {
@@ -3718,11 +4674,10 @@ namespace triton {
         worklist.pop();
 
         // This means that node is already visited and we will not need to visited it second time
-        if (visited.find(current) != visited.end()) {
+        if (!visited.insert(current)) {
           continue;
         }
 
-        visited.insert(current);
         if (match == triton::ast::ANY_NODE || current->getType() == match)
           result.push_front(current->shared_from_this());
 
@@ -3740,6 +4695,99 @@ namespace triton {
     }
 
 
+    triton::usize getNodeSize(triton::ast::ast_e type) {
+      switch (type) {
+        case ARRAY_NODE:      return sizeof(ArrayNode);
+        case ASSERT_NODE:     return sizeof(AssertNode);
+        case BSWAP_NODE:      return sizeof(BswapNode);
+        case BVADD_NODE:      return sizeof(BvaddNode);
+        case BVAND_NODE:      return sizeof(BvandNode);
+        case BVASHR_NODE:     return sizeof(BvashrNode);
+        case BVLSHR_NODE:     return sizeof(BvlshrNode);
+        case BVMUL_NODE:      return sizeof(BvmulNode);
+        case BVNAND_NODE:     return sizeof(BvnandNode);
+        case BVNEG_NODE:      return sizeof(BvnegNode);
+        case BVNOR_NODE:      return sizeof(BvnorNode);
+        case BVNOT_NODE:      return sizeof(BvnotNode);
+        case BVOR_NODE:       return sizeof(BvorNode);
+        case BVROL_NODE:      return sizeof(BvrolNode);
+        case BVROR_NODE:      return sizeof(BvrorNode);
+        case BVSDIV_NODE:     return sizeof(BvsdivNode);
+        case BVSGE_NODE:      return sizeof(BvsgeNode);
+        case BVSGT_NODE:      return sizeof(BvsgtNode);
+        case BVSHL_NODE:      return sizeof(BvshlNode);
+        case BVSLE_NODE:      return sizeof(BvsleNode);
+        case BVSLT_NODE:      return sizeof(BvsltNode);
+        case BVSMOD_NODE:     return sizeof(BvsmodNode);
+        case BVSREM_NODE:     return sizeof(BvsremNode);
+        case BVSUB_NODE:      return sizeof(BvsubNode);
+        case BVUDIV_NODE:     return sizeof(BvudivNode);
+        case BVUGE_NODE:      return sizeof(BvugeNode);
+        case BVUGT_NODE:      return sizeof(BvugtNode);
+        case BVULE_NODE:      return sizeof(BvuleNode);
+        case BVULT_NODE:      return sizeof(BvultNode);
+        case BVUREM_NODE:     return sizeof(BvuremNode);
+        case BVXNOR_NODE:     return sizeof(BvxnorNode);
+        case BVXOR_NODE:      return sizeof(BvxorNode);
+        case BV_NODE:         return sizeof(BvNode);
+        case COMPOUND_NODE:   return sizeof(CompoundNode);
+        case CONCAT_NODE:     return sizeof(ConcatNode);
+        case DECLARE_NODE:    return sizeof(DeclareNode);
+        case DISTINCT_NODE:   return sizeof(DistinctNode);
+        case EQUAL_NODE:      return sizeof(EqualNode);
+        case EXTRACT_NODE:    return sizeof(ExtractNode);
+        case FORALL_NODE:     return sizeof(ForallNode);
+        case IFF_NODE:        return sizeof(IffNode);
+        case INTEGER_NODE:    return sizeof(IntegerNode);
+        case ITE_NODE:        return sizeof(IteNode);
+        case LAND_NODE:       return sizeof(LandNode);
+        case LET_NODE:        return sizeof(LetNode);
+        case LNOT_NODE:       return sizeof(LnotNode);
+        case LOR_NODE:        return sizeof(LorNode);
+        case LXOR_NODE:       return sizeof(LxorNode);
+        case REFERENCE_NODE:  return sizeof(ReferenceNode);
+        case SELECT_NODE:     return sizeof(SelectNode);
+        case STORE_NODE:      return sizeof(StoreNode);
+        case STRING_NODE:     return sizeof(StringNode);
+        case SX_NODE:         return sizeof(SxNode);
+        case VARIABLE_NODE:   return sizeof(VariableNode);
+        case ZX_NODE:         return sizeof(ZxNode);
+        default:
+          throw triton::exceptions::Ast("triton::ast::getNodeSize(): Invalid type node.");
+      }
+    }
+
+
+    triton::usize countNodes(const SharedAbstractNode& node, triton::usize limit) {
+      std::stack<AbstractNode*> worklist;
+      VisitedNodes              visited(node->getContext());
+      triton::usize             count = 0;
+
+      worklist.push(node.get());
+      while (!worklist.empty() && count <= limit) {
+        AbstractNode* current = worklist.top();
+        worklist.pop();
+
+        if (!visited.insert(current)) {
+          continue;
+        }
+
+        count++;
+
+        if (current->getType() == REFERENCE_NODE) {
+          worklist.push(reinterpret_cast<triton::ast::ReferenceNode*>(current)->getSymbolicExpression()->getAst().get());
+        }
+        else {
+          for (const SharedAbstractNode& child : current->getChildren()) {
+            worklist.push(child.get());
+          }
+        }
+      }
+
+      return count;
+    }
+
+
     SharedAbstractNode dereference(const SharedAbstractNode& node) {
       AbstractNode* ptr = node.get();
 
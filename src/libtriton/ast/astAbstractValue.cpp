@@ -0,0 +1,794 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <limits>
+
+#include <triton/ast.hpp>
+#include <triton/astAbstractValue.hpp>
+#include <triton/cpuSize.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* Returns the mask of the `size` low bits */
+    static triton::uint64 lowMask(triton::uint32 size) {
+      if (size >= triton::bitsize::qword)
+        return std::numeric_limits<triton::uint64>::max();
+      return (static_cast<triton::uint64>(1) << size) - 1;
+    }
+
+
+    /* Sign-extends a value of `size` bits */
+    static triton::sint64 signExtend(triton::uint64 value, triton::uint32 size) {
+      if (size >= triton::bitsize::qword)
+        return static_cast<triton::sint64>(value);
+      triton::uint64 sign = static_cast<triton::uint64>(1) << (size - 1);
+      return static_cast<triton::sint64>(((value & lowMask(size)) ^ sign) - sign);
+    }
+
+
+    /* Returns the lowest signed value of `size` bits */
+    static triton::sint64 signedMin(triton::uint32 size) {
+      if (size >= triton::bitsize::qword)
+        return std::numeric_limits<triton::sint64>::min();
+      return -(static_cast<triton::sint64>(1) << (size - 1));
+    }
+
+
+    /* Returns the highest signed value of `size` bits */
+    static triton::sint64 signedMax(triton::uint32 size) {
+      if (size >= triton::bitsize::qword)
+        return std::numeric_limits<triton::sint64>::max();
+      return (static_cast<triton::sint64>(1) << (size - 1)) - 1;
+    }
+
+
+    /* Returns the number of low bits known to be 0 */
+    static triton::uint32 trailingZeros(const AbstractValue& value) {
+      triton::uint32 count = 0;
+      while (count < value.size && ((value.zeros >> count) & 1))
+        count++;
+      return count;
+    }
+
+
+    /* Returns the index of the highest bit set, `value` must not be 0 */
+    static triton::uint32 highestBit(triton::uint64 value) {
+      triton::uint32 index = 0;
+      while (value >>= 1)
+        index++;
+      return index;
+    }
+
+
+    /* Returns the known result of a logical node, or the unknown one */
+    static AbstractValue logical(bool known, bool value) {
+      return known ? AbstractValue::constant(value, 1) : AbstractValue::top(1);
+    }
+
+
+    /* Returns true if the operands from `first` are tracked, with the size of the first one of them */
+    static bool isTracked(const std::vector<AbstractValue>& operands, triton::usize first = 0) {
+      if (operands.size() <= first)
+        return false;
+
+      for (triton::usize index = first; index < operands.size(); index++) {
+        if (!operands[index].isTracked() || operands[index].size != operands[first].size)
+          return false;
+      }
+
+      return true;
+    }
+
+
+    /* The known bits of a + b + carry, from the lowest and highest sums they allow */
+    static void addKnownBits(AbstractValue& ret, const AbstractValue& a, const AbstractValue& b, triton::uint64 carry) {
+      triton::uint64 mask     = ret.getMask();
+      triton::uint64 sumZero  = ((~a.zeros & mask) + (~b.zeros & mask) + carry) & mask;
+      triton::uint64 sumOne   = (a.ones + b.ones + carry) & mask;
+      triton::uint64 carryOff = ~(sumZero ^ a.zeros ^ b.zeros) & mask;
+      triton::uint64 carryOn  = (sumOne ^ a.ones ^ b.ones) & mask;
+      triton::uint64 known    = (a.zeros | a.ones) & (b.zeros | b.ones) & (carryOff | carryOn);
+
+      ret.zeros = ~sumZero & known & mask;
+      ret.ones  = sumOne & known;
+    }
+
+
+    static AbstractValue notValue(const AbstractValue& a) {
+      AbstractValue ret = AbstractValue::top(a.size);
+      triton::uint64 mask = ret.getMask();
+
+      ret.zeros = a.ones;
+      ret.ones  = a.zeros;
+      ret.umin  = mask - a.umax;
+      ret.umax  = mask - a.umin;
+      ret.smin  = -1 - a.smax;
+      ret.smax  = -1 - a.smin;
+
+      return ret;
+    }
+
+
+    static AbstractValue addValue(const AbstractValue& a, const AbstractValue& b) {
+      AbstractValue ret = AbstractValue::top(a.size);
+      triton::uint64 mask = ret.getMask();
+
+      addKnownBits(ret, a, b, 0);
+
+      /* The ranges hold while the sum does not wrap, the signed one below 64 bits */
+      if (a.umax <= mask - b.umax) {
+        ret.umin = a.umin + b.umin;
+        ret.umax = a.umax + b.umax;
+      }
+
+      if (a.size < triton::bitsize::qword) {
+        triton::sint64 low  = a.smin + b.smin;
+        triton::sint64 high = a.smax + b.smax;
+        if (low >= signedMin(a.size) && high <= signedMax(a.size)) {
+          ret.smin = low;
+          ret.smax = high;
+        }
+      }
+
+      return ret;
+    }
+
+
+    static AbstractValue subValue(const AbstractValue& a, const AbstractValue& b) {
+      AbstractValue ret = AbstractValue::top(a.size);
+
+      /* a - b = a + ~b + 1 */
+      AbstractValue nb = notValue(b);
+      addKnownBits(ret, a, nb, 1);
+
+      if (a.umin >= b.umax) {
+        ret.umin = a.umin - b.umax;
+        ret.umax = a.umax - b.umin;
+      }
+
+      if (a.size < triton::bitsize::qword) {
+        triton::sint64 low  = a.smin - b.smax;
+        triton::sint64 high = a.smax - b.smin;
+        if (low >= signedMin(a.size) && high <= signedMax(a.size)) {
+          ret.smin = low;
+          ret.smax = high;
+        }
+      }
+
+      return ret;
+    }
+
+
+    static AbstractValue mulValue(const AbstractValue& a, const AbstractValue& b) {
+      AbstractValue ret = AbstractValue::top(a.size);
+      triton::uint64 mask = ret.getMask();
+
+      ret.zeros = lowMask(std::min(a.size, trailingZeros(a) + trailingZeros(b)));
+
+      if (a.umax == 0 || b.umax <= mask / a.umax) {
+        ret.umin = a.umin * b.umin;
+        ret.umax = a.umax * b.umax;
+      }
+
+      return ret;
+    }
+
+
+    static AbstractValue shlValue(const AbstractValue& a, const AbstractValue& b) {
+      AbstractValue ret = AbstractValue::top(a.size);
+      triton::uint64 mask = ret.getMask();
+
+      if (b.umin >= a.size)
+        return AbstractValue::constant(0, a.size);
+
+      if (b.isConstant()) {
+        triton::uint32 shift = static_cast<triton::uint32>(b.getConstant());
+        ret.ones  = (a.ones << shift) & mask;
+        ret.zeros = ((a.zeros << shift) | lowMask(shift)) & mask;
+        if (a.umax <= (mask >> shift)) {
+          ret.umin = a.umin << shift;
+          ret.umax = a.umax << shift;
+        }
+      }
+      else {
+        ret.zeros = lowMask(static_cast<triton::uint32>(std::min<triton::uint64>(a.size, trailingZeros(a) + b.umin)));
+      }
+
+      return ret;
+    }
+
+
+    static AbstractValue lshrValue(const AbstractValue& a, const AbstractValue& b) {
+      AbstractValue ret = AbstractValue::top(a.size);
+      triton::uint64 mask = ret.getMask();
+
+      if (b.umin >= a.size)
+        return AbstractValue::constant(0, a.size);
+
+      if (b.isConstant()) {
+        triton::uint32 shift = static_cast<triton::uint32>(b.getConstant());
+        ret.ones  = a.ones >> shift;
+        ret.zeros = (a.zeros >> shift) | (~(mask >> shift) & mask);
+        ret.umin  = a.umin >> shift;
+        ret.umax  = a.umax >> shift;
+      }
+      else {
+        ret.umin = (b.umax >= a.size) ? 0 : (a.umin >> b.umax);
+        ret.umax = a.umax >> b.umin;
+      }
+
+      return ret;
+    }
+
+
+    static AbstractValue ashrValue(const AbstractValue& a, const AbstractValue& b) {
+      AbstractValue ret = AbstractValue::top(a.size);
+      triton::uint64 mask = ret.getMask();
+      triton::uint64 sign = static_cast<triton::uint64>(1) << (a.size - 1);
+
+      /* The shifts from the size on give the sign in every bit */
+      triton::uint32 low  = static_cast<triton::uint32>(std::min<triton::uint64>(b.umin, a.size - 1));
+      triton::uint32 high = static_cast<triton::uint32>(std::min<triton::uint64>(b.umax, a.size - 1));
+
+      ret.smin = std::min(a.smin >> low, a.smin >> high);
+      ret.smax = std::max(a.smax >> low, a.smax >> high);
+
+      if (low == high) {
+        triton::uint64 fill = ~(mask >> low) & mask;
+        ret.ones  = a.ones >> low;
+        ret.zeros = a.zeros >> low;
+        if (a.zeros & sign)
+          ret.zeros |= fill;
+        if (a.ones & sign)
+          ret.ones |= fill;
+      }
+
+      return ret;
+    }
+
+
+    static AbstractValue udivValue(const AbstractValue& a, const AbstractValue& b) {
+      AbstractValue ret = AbstractValue::top(a.size);
+
+      /* A division by zero gives all ones */
+      if (b.umax == 0)
+        return AbstractValue::constant(ret.getMask(), a.size);
+
+      if (b.umin > 0) {
+        ret.umin = a.umin / b.umax;
+        ret.umax = a.umax / b.umin;
+      }
+
+      return ret;
+    }
+
+
+    static AbstractValue uremValue(const AbstractValue& a, const AbstractValue& b) {
+      AbstractValue ret = AbstractValue::top(a.size);
+
+      /* The remainder is never above the dividend, a remainder by zero being the dividend */
+      ret.umax = a.umax;
+      if (b.umin > 0) {
+        if (a.umax < b.umin)
+          return a;
+        ret.umax = std::min(a.umax, b.umax - 1);
+      }
+
+      return ret;
+    }
+
+
+    static AbstractValue rotlValue(const AbstractValue& a, triton::uint32 rot) {
+      AbstractValue ret = AbstractValue::top(a.size);
+      triton::uint64 mask = ret.getMask();
+
+      rot %= a.size;
+      if (rot == 0)
+        return a;
+
+      ret.ones  = ((a.ones << rot) | (a.ones >> (a.size - rot))) & mask;
+      ret.zeros = ((a.zeros << rot) | (a.zeros >> (a.size - rot))) & mask;
+
+      return ret;
+    }
+
+
+    static AbstractValue bswapValue(const AbstractValue& a) {
+      AbstractValue ret = AbstractValue::top(a.size);
+      triton::uint32 bytes = a.size / triton::bitsize::byte;
+
+      ret.ones  = 0;
+      ret.zeros = 0;
+      for (triton::uint32 index = 0; index < bytes; index++) {
+        triton::uint32 from = index * triton::bitsize::byte;
+        triton::uint32 to   = (bytes - 1 - index) * triton::bitsize::byte;
+        ret.ones  |= ((a.ones >> from) & 0xff) << to;
+        ret.zeros |= ((a.zeros >> from) & 0xff) << to;
+      }
+
+      return ret;
+    }
+
+
+    static AbstractValue equalValue(const AbstractValue& a, const AbstractValue& b) {
+      if (!a.isTracked() || a.size != b.size)
+        return AbstractValue::top(1);
+
+      if (a.isConstant() && b.isConstant())
+        return AbstractValue::constant(a.getConstant() == b.getConstant(), 1);
+
+      /* A bit known on both sides differs, or the ranges do not meet */
+      if ((a.ones & b.zeros) || (a.zeros & b.ones))
+        return AbstractValue::constant(false, 1);
+
+      if (a.umax < b.umin || b.umax < a.umin || a.smax < b.smin || b.smax < a.smin)
+        return AbstractValue::constant(false, 1);
+
+      return AbstractValue::top(1);
+    }
+
+
+    static AbstractValue ultValue(const AbstractValue& a, const AbstractValue& b) {
+      if (a.umax < b.umin)
+        return AbstractValue::constant(true, 1);
+      return logical(a.umin >= b.umax, false);
+    }
+
+
+    static AbstractValue uleValue(const AbstractValue& a, const AbstractValue& b) {
+      if (a.umax <= b.umin)
+        return AbstractValue::constant(true, 1);
+      return logical(a.umin > b.umax, false);
+    }
+
+
+    static AbstractValue sltValue(const AbstractValue& a, const AbstractValue& b) {
+      if (a.smax < b.smin)
+        return AbstractValue::constant(true, 1);
+      return logical(a.smin >= b.smax, false);
+    }
+
+
+    static AbstractValue sleValue(const AbstractValue& a, const AbstractValue& b) {
+      if (a.smax <= b.smin)
+        return AbstractValue::constant(true, 1);
+      return logical(a.smin > b.smax, false);
+    }
+
+
+
+    /* ====== Abstract value */
+
+    AbstractValue::AbstractValue(void) {
+      this->ones  = 0;
+      this->size  = 0;
+      this->smax  = 0;
+      this->smin  = 0;
+      this->umax  = 0;
+      this->umin  = 0;
+      this->zeros = 0;
+    }
+
+
+    AbstractValue AbstractValue::top(triton::uint32 size) {
+      AbstractValue ret;
+
+      if (size == 0 || size > triton::bitsize::qword)
+        return ret;
+
+      ret.size = size;
+      ret.umax = lowMask(size);
+      ret.smin = signedMin(size);
+      ret.smax = signedMax(size);
+
+      return ret;
+    }
+
+
+    AbstractValue AbstractValue::constant(triton::uint64 value, triton::uint32 size) {
+      AbstractValue ret = AbstractValue::top(size);
+
+      if (!ret.isTracked())
+        return ret;
+
+      value     &= ret.getMask();
+      ret.ones  = value;
+      ret.zeros = ~value & ret.getMask();
+      ret.umin  = value;
+      ret.umax  = value;
+      ret.smin  = signExtend(value, size);
+      ret.smax  = ret.smin;
+
+      return ret;
+    }
+
+
+    bool AbstractValue::isTracked(void) const {
+      return this->size != 0;
+    }
+
+
+    bool AbstractValue::isConstant(void) const {
+      return this->size != 0 && (this->zeros | this->ones) == this->getMask();
+    }
+
+
+    triton::uint64 AbstractValue::getConstant(void) const {
+      return this->ones;
+    }
+
+
+    bool AbstractValue::isTrue(void) const {
+      return this->size == 1 && this->ones == 1;
+    }
+
+
+    bool AbstractValue::isFalse(void) const {
+      return this->size == 1 && this->zeros == 1;
+    }
+
+
+    triton::uint64 AbstractValue::getMask(void) const {
+      return lowMask(this->size);
+    }
+
+
+    void AbstractValue::refine(void) {
+      if (this->size == 0)
+        return;
+
+      triton::uint64 mask = this->getMask();
+      triton::uint64 sign = static_cast<triton::uint64>(1) << (this->size - 1);
+
+      /* Twice, so that the known bits from the ranges narrow the ranges in turn */
+      for (triton::uint32 round = 0; round < 2; round++) {
+        /* The ranges from the known bits */
+        this->umin = std::max(this->umin, this->ones);
+        this->umax = std::min(this->umax, ~this->zeros & mask);
+        if (this->zeros & sign)
+          this->smin = std::max<triton::sint64>(this->smin, 0);
+        if (this->ones & sign)
+          this->smax = std::min<triton::sint64>(this->smax, -1);
+
+        /* The unsigned range from the signed one, once the sign is known */
+        if (this->smin >= 0) {
+          this->umin = std::max(this->umin, static_cast<triton::uint64>(this->smin));
+          this->umax = std::min(this->umax, static_cast<triton::uint64>(this->smax));
+        }
+        else if (this->smax < 0) {
+          this->umin = std::max(this->umin, static_cast<triton::uint64>(this->smin) & mask);
+          this->umax = std::min(this->umax, static_cast<triton::uint64>(this->smax) & mask);
+        }
+
+        /* The signed range from the unsigned one, once the sign is known */
+        if (this->umax < sign) {
+          this->smin = std::max(this->smin, static_cast<triton::sint64>(this->umin));
+          this->smax = std::min(this->smax, static_cast<triton::sint64>(this->umax));
+        }
+        else if (this->umin >= sign) {
+          this->smin = std::max(this->smin, signExtend(this->umin, this->size));
+          this->smax = std::min(this->smax, signExtend(this->umax, this->size));
+        }
+
+        /* The known bits from the unsigned range, the high bits its bounds share */
+        if (this->umin <= this->umax) {
+          triton::uint64 diff   = this->umin ^ this->umax;
+          triton::uint64 common = diff ? (mask & ~lowMask(highestBit(diff) + 1)) : mask;
+          this->ones  |= this->umin & common;
+          this->zeros |= ~this->umin & common;
+        }
+      }
+
+      /* A sound analysis does not reach a contradiction, nothing is assumed if it does */
+      if ((this->zeros & this->ones) || this->umin > this->umax || this->smin > this->smax)
+        *this = AbstractValue::top(this->size);
+    }
+
+
+    AbstractValue AbstractValue::join(const AbstractValue& other) const {
+      if (!this->isTracked() || this->size != other.size)
+        return AbstractValue();
+
+      AbstractValue ret = *this;
+      ret.zeros = this->zeros & other.zeros;
+      ret.ones  = this->ones & other.ones;
+      ret.umin  = std::min(this->umin, other.umin);
+      ret.umax  = std::max(this->umax, other.umax);
+      ret.smin  = std::min(this->smin, other.smin);
+      ret.smax  = std::max(this->smax, other.smax);
+      ret.refine();
+
+      return ret;
+    }
+
+
+    AbstractValue transferAbstractValue(AbstractNode* node, const std::vector<AbstractValue>& operands) {
+      triton::uint32 size = node->getBitvectorSize();
+
+      if (node->isArray() || size == 0 || size > triton::bitsize::qword)
+        return AbstractValue();
+
+      /* A node without variable has a single value */
+      if (!node->isSymbolized())
+        return AbstractValue::constant(node->evaluate64(), size);
+
+      AbstractValue ret = AbstractValue::top(size);
+      auto& children    = node->getChildren();
+
+      switch (node->getType()) {
+        case REFERENCE_NODE:
+          if (isTracked(operands) && operands[0].size == size)
+            ret = operands[0];
+          break;
+
+        case BVADD_NODE:
+          if (isTracked(operands))
+            ret = addValue(operands[0], operands[1]);
+          break;
+
+        case BVSUB_NODE:
+          if (isTracked(operands))
+            ret = subValue(operands[0], operands[1]);
+          break;
+
+        case BVNEG_NODE:
+          if (isTracked(operands))
+            ret = subValue(AbstractValue::constant(0, size), operands[0]);
+          break;
+
+        case BVMUL_NODE:
+          if (isTracked(operands))
+            ret = mulValue(operands[0], operands[1]);
+          break;
+
+        case BVAND_NODE:
+        case BVNAND_NODE:
+          if (isTracked(operands)) {
+            ret.ones  = operands[0].ones & operands[1].ones;
+            ret.zeros = operands[0].zeros | operands[1].zeros;
+            ret.umax  = std::min(operands[0].umax, operands[1].umax);
+            if (node->getType() == BVNAND_NODE) {
+              ret.refine();
+              ret = notValue(ret);
+            }
+          }
+          break;
+
+        case BVOR_NODE:
+        case BVNOR_NODE:
+          if (isTracked(operands)) {
+            ret.ones  = operands[0].ones | operands[1].ones;
+            ret.zeros = operands[0].zeros & operands[1].zeros;
+            ret.umin  = std::max(operands[0].umin, operands[1].umin);
+            if (node->getType() == BVNOR_NODE) {
+              ret.refine();
+              ret = notValue(ret);
+            }
+          }
+          break;
+
+        case BVXOR_NODE:
+        case BVXNOR_NODE:
+          if (isTracked(operands)) {
+            ret.ones  = (operands[0].ones & operands[1].zeros) | (operands[0].zeros & operands[1].ones);
+            ret.zeros = (operands[0].zeros & operands[1].zeros) | (operands[0].ones & operands[1].ones);
+            if (node->getType() == BVXNOR_NODE) {
+              ret.refine();
+              ret = notValue(ret);
+            }
+          }
+          break;
+
+        case BVNOT_NODE:
+          if (isTracked(operands))
+            ret = notValue(operands[0]);
+          break;
+
+        case BVSHL_NODE:
+          if (isTracked(operands))
+            ret = shlValue(operands[0], operands[1]);
+          break;
+
+        case BVLSHR_NODE:
+          if (isTracked(operands))
+            ret = lshrValue(operands[0], operands[1]);
+          break;
+
+        case BVASHR_NODE:
+          if (isTracked(operands))
+            ret = ashrValue(operands[0], operands[1]);
+          break;
+
+        case BVUDIV_NODE:
+          if (isTracked(operands))
+            ret = udivValue(operands[0], operands[1]);
+          break;
+
+        case BVUREM_NODE:
+          if (isTracked(operands))
+            ret = uremValue(operands[0], operands[1]);
+          break;
+
+        case BVROL_NODE:
+          if (operands.size() == 2 && operands[0].size == size)
+            ret = rotlValue(operands[0], triton::ast::getInteger<triton::uint32>(children[1]));
+          break;
+
+        case BVROR_NODE:
+          if (operands.size() == 2 && operands[0].size == size)
+            ret = rotlValue(operands[0], size - (triton::ast::getInteger<triton::uint32>(children[1]) % size));
+          break;
+
+        case BSWAP_NODE:
+          if (isTracked(operands))
+            ret = bswapValue(operands[0]);
+          break;
+
+        case CONCAT_NODE: {
+          triton::uint64 ones  = 0;
+          triton::uint64 zeros = 0;
+          bool tracked = true;
+
+          /* The first operand is the highest part */
+          for (const auto& operand : operands) {
+            if (!operand.isTracked()) {
+              tracked = false;
+              break;
+            }
+            ones  = ((operand.size >= triton::bitsize::qword) ? 0 : (ones << operand.size)) | operand.ones;
+            zeros = ((operand.size >= triton::bitsize::qword) ? 0 : (zeros << operand.size)) | operand.zeros;
+          }
+
+          if (tracked) {
+            ret.ones  = ones;
+            ret.zeros = zeros;
+          }
+          break;
+        }
+
+        case EXTRACT_NODE:
+          if (operands.size() == 3 && operands[2].isTracked()) {
+            triton::uint32 low = triton::ast::getInteger<triton::uint32>(children[1]);
+            ret.ones  = (operands[2].ones >> low) & ret.getMask();
+            ret.zeros = (operands[2].zeros >> low) & ret.getMask();
+          }
+          break;
+
+        case ZX_NODE:
+          if (operands.size() == 2 && operands[1].isTracked()) {
+            ret.ones  = operands[1].ones;
+            ret.zeros = operands[1].zeros | (ret.getMask() & ~operands[1].getMask());
+            ret.umin  = operands[1].umin;
+            ret.umax  = operands[1].umax;
+          }
+          break;
+
+        case SX_NODE:
+          if (operands.size() == 2 && operands[1].isTracked()) {
+            triton::uint64 fill = ret.getMask() & ~operands[1].getMask();
+            triton::uint64 sign = static_cast<triton::uint64>(1) << (operands[1].size - 1);
+            ret.ones  = operands[1].ones | ((operands[1].ones & sign) ? fill : 0);
+            ret.zeros = operands[1].zeros | ((operands[1].zeros & sign) ? fill : 0);
+            ret.smin  = operands[1].smin;
+            ret.smax  = operands[1].smax;
+          }
+          break;
+
+        case ITE_NODE:
+          if (operands.size() == 3) {
+            const AbstractValue* branch = operands[0].isTrue() ? &operands[1] : (operands[0].isFalse() ? &operands[2] : nullptr);
+            AbstractValue value = branch ? *branch : operands[1].join(operands[2]);
+            if (value.size == size)
+              ret = value;
+          }
+          break;
+
+        case EQUAL_NODE:
+          if (operands.size() == 2)
+            ret = equalValue(operands[0], operands[1]);
+          break;
+
+        case DISTINCT_NODE:
+          if (operands.size() == 2)
+            ret = notValue(equalValue(operands[0], operands[1]));
+          break;
+
+        case BVULT_NODE:
+          if (isTracked(operands))
+            ret = ultValue(operands[0], operands[1]);
+          break;
+
+        case BVULE_NODE:
+          if (isTracked(operands))
+            ret = uleValue(operands[0], operands[1]);
+          break;
+
+        case BVUGT_NODE:
+          if (isTracked(operands))
+            ret = ultValue(operands[1], operands[0]);
+          break;
+
+        case BVUGE_NODE:
+          if (isTracked(operands))
+            ret = uleValue(operands[1], operands[0]);
+          break;
+
+        case BVSLT_NODE:
+          if (isTracked(operands))
+            ret = sltValue(operands[0], operands[1]);
+          break;
+
+        case BVSLE_NODE:
+          if (isTracked(operands))
+            ret = sleValue(operands[0], operands[1]);
+          break;
+
+        case BVSGT_NODE:
+          if (isTracked(operands))
+            ret = sltValue(operands[1], operands[0]);
+          break;
+
+        case BVSGE_NODE:
+          if (isTracked(operands))
+            ret = sleValue(operands[1], operands[0]);
+          break;
+
+        case LAND_NODE: {
+          bool all = true;
+          for (const auto& operand : operands) {
+            if (operand.isFalse())
+              return AbstractValue::constant(false, 1);
+            all &= operand.isTrue();
+          }
+          ret = logical(all, true);
+          break;
+        }
+
+        case LOR_NODE: {
+          bool none = true;
+          for (const auto& operand : operands) {
+            if (operand.isTrue())
+              return AbstractValue::constant(true, 1);
+            none &= operand.isFalse();
+          }
+          ret = logical(none, false);
+          break;
+        }
+
+        case LNOT_NODE:
+          if (operands.size() == 1 && operands[0].size == 1)
+            ret = notValue(operands[0]);
+          break;
+
+        case LXOR_NODE:
+        case IFF_NODE: {
+          bool known = true;
+          bool value = false;
+          for (const auto& operand : operands) {
+            known &= operand.isConstant() && operand.size == 1;
+            value ^= operand.isTrue();
+          }
+          if (node->getType() == IFF_NODE)
+            value = !value;
+          ret = logical(known, value);
+          break;
+        }
+
+        default:
+          break;
+      }
+
+      ret.refine();
+      return ret;
+    }
+
+  };
+};
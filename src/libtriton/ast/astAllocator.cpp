@@ -0,0 +1,144 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <atomic>
+#include <new>
+#include <thread>
+
+#include <triton/astAllocator.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* The blocks given back by a reclamation thread, the free lists being owned by the emulation one */
+    static thread_local std::vector<AstArena::Block>* deferredBlocks = nullptr;
+
+
+    AstArena::AstArena(bool owned, std::pmr::memory_resource* resource)
+      : resource(resource),
+        owned(owned),
+        owner(std::this_thread::get_id()),
+        remoteBlocks(nullptr) {
+      this->freeLists.resize(AstArena::maxBlockSize / AstArena::granularity, nullptr);
+    }
+
+
+    AstArena::~AstArena() {
+      for (const auto& slab : this->slabs) {
+        if (this->resource)
+          this->resource->deallocate(slab.first, slab.second, AstArena::granularity);
+        else
+          delete[] slab.first;
+      }
+    }
+
+
+    void AstArena::allocateSlab(triton::usize sizeClass) {
+      triton::usize blockSize = (sizeClass + 1) * AstArena::granularity;
+
+      triton::usize slabSize = blockSize * AstArena::blocksPerSlab;
+      triton::uint8* slab    = nullptr;
+
+      if (this->resource)
+        slab = static_cast<triton::uint8*>(this->resource->allocate(slabSize, AstArena::granularity));
+      else
+        slab = new(std::nothrow) triton::uint8[slabSize];
+
+      if (slab == nullptr)
+        throw triton::exceptions::Ast("AstArena::allocateSlab(): Not enough memory.");
+
+      this->slabs.emplace_back(slab, slabSize);
+
+      /* Thread the blocks of the slab into the free list */
+      for (triton::usize index = AstArena::blocksPerSlab; index > 0; index--) {
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + (index - 1) * blockSize);
+        block->next = this->freeLists[sizeClass];
+        this->freeLists[sizeClass] = block;
+      }
+    }
+
+
+    void AstArena::takeRemoteBlocks(void) {
+      FreeBlock* block = this->remoteBlocks.exchange(nullptr, std::memory_order_acquire);
+
+      while (block != nullptr) {
+        FreeBlock* next = block->next;
+        block->next = this->freeLists[block->sizeClass];
+        this->freeLists[block->sizeClass] = block;
+        block = next;
+      }
+    }
+
+
+    void* AstArena::allocate(triton::usize size, triton::usize align) {
+      if (size == 0 || size > AstArena::maxBlockSize || align > AstArena::granularity) {
+        if (this->resource)
+          return this->resource->allocate(size, align);
+        void* ptr = ::operator new(size, std::nothrow);
+        if (ptr == nullptr)
+          throw triton::exceptions::Ast("AstArena::allocate(): Not enough memory.");
+        return ptr;
+      }
+
+      triton::usize sizeClass = (size - 1) / AstArena::granularity;
+      if (this->freeLists[sizeClass] == nullptr && this->owned)
+        this->takeRemoteBlocks();
+
+      if (this->freeLists[sizeClass] == nullptr)
+        this->allocateSlab(sizeClass);
+
+      FreeBlock* block = this->freeLists[sizeClass];
+      this->freeLists[sizeClass] = block->next;
+
+      return block;
+    }
+
+
+    void AstArena::deallocate(void* ptr, triton::usize size, triton::usize align) {
+      if (size == 0 || size > AstArena::maxBlockSize || align > AstArena::granularity) {
+        if (this->resource)
+          this->resource->deallocate(ptr, size, align);
+        else
+          ::operator delete(ptr);
+        return;
+      }
+
+      if (deferredBlocks != nullptr) {
+        deferredBlocks->push_back({this, ptr, size, align});
+        return;
+      }
+
+      triton::usize sizeClass = (size - 1) / AstArena::granularity;
+      FreeBlock* block = static_cast<FreeBlock*>(ptr);
+
+      /* The free lists are only touched by their owner */
+      if (this->owned && std::this_thread::get_id() != this->owner) {
+        block->sizeClass = sizeClass;
+        block->next = this->remoteBlocks.load(std::memory_order_relaxed);
+        while (!this->remoteBlocks.compare_exchange_weak(block->next, block, std::memory_order_release, std::memory_order_relaxed));
+        return;
+      }
+
+      block->next = this->freeLists[sizeClass];
+      this->freeLists[sizeClass] = block;
+    }
+
+
+    void AstArena::deferDeallocations(std::vector<Block>* blocks) {
+      deferredBlocks = blocks;
+    }
+
+
+    triton::usize AstArena::getSlabsSize(void) const {
+      return this->slabs.size();
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
@@ -5,12 +5,19 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <atomic>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/astContext.hpp>
+#include <triton/astProgram.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/symbolicExpression.hpp>
 #include <triton/symbolicVariable.hpp>
@@ -20,59 +27,525 @@
 namespace triton {
   namespace ast {
 
-    AstContext::AstContext(const triton::modes::SharedModes& modes)
+    /* The number of input vectors evaluated together by evaluateBatch() */
+    static const triton::usize batchLanes = 64;
+
+    /* The id of the next context, see AstContext::getThreadState() */
+    static std::atomic<triton::uint64> nextContextUid(1);
+
+    /* True while the chains are balanced by this thread, so that the nodes they are built from are not rotated again */
+    static thread_local bool balancing = false;
+
+
+    /* Adds to a counter only written by the calling thread, but read by the others */
+    template <typename T> static inline void addRelaxed(std::atomic<T>& counter, T value) {
+      counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+
+    /* Returns true if the lanes of a node can be evaluated with native integers */
+    static bool isBatchNative(AbstractNode* node) {
+      switch (node->getType()) {
+        case INTEGER_NODE:
+          return true;
+
+        case BVSGE_NODE:
+        case BVSGT_NODE:
+        case BVSLE_NODE:
+        case BVSLT_NODE:
+        case BVUGE_NODE:
+        case BVUGT_NODE:
+        case BVULE_NODE:
+        case BVULT_NODE:
+        case DISTINCT_NODE:
+        case EQUAL_NODE:
+          return node->getChildren()[0]->getBitvectorSize() <= triton::bitsize::qword;
+
+        case BSWAP_NODE:
+        case BVADD_NODE:
+        case BVAND_NODE:
+        case BVASHR_NODE:
+        case BVLSHR_NODE:
+        case BVMUL_NODE:
+        case BVNAND_NODE:
+        case BVNEG_NODE:
+        case BVNOR_NODE:
+        case BVNOT_NODE:
+        case BVOR_NODE:
+        case BVROL_NODE:
+        case BVROR_NODE:
+        case BVSHL_NODE:
+        case BVSUB_NODE:
+        case BVUDIV_NODE:
+        case BVUREM_NODE:
+        case BVXNOR_NODE:
+        case BVXOR_NODE:
+        case BV_NODE:
+        case CONCAT_NODE:
+        case IFF_NODE:
+        case ITE_NODE:
+        case LAND_NODE:
+        case LNOT_NODE:
+        case LOR_NODE:
+        case LXOR_NODE:
+        case REFERENCE_NODE:
+        case SX_NODE:
+        case VARIABLE_NODE:
+        case ZX_NODE:
+          return node->getBitvectorSize() <= triton::bitsize::qword;
+
+        case EXTRACT_NODE:
+          return node->getChildren()[2]->getBitvectorSize() <= triton::bitsize::qword;
+
+        default:
+          return false;
+      }
+    }
+
+
+    /* Returns the lane `i` of `x` sign extended from `size` bits */
+    static inline triton::sint64 signExtendLane(const triton::uint64* x, triton::usize i, triton::uint32 size) {
+      triton::uint32 shift = triton::bitsize::qword - size;
+      return (static_cast<triton::sint64>(x[i] << shift) >> shift);
+    }
+
+
+    /*
+     * Evaluates `n` lanes of a node from the lanes of its children (`args`), with
+     * the semantics of the native paths of AbstractNode::init(). The loops are kept
+     * simple so that the compiler vectorizes them.
+     */
+    static void evaluateLanes(AbstractNode* node, const std::vector<const triton::uint64*>& args, triton::uint64* out, triton::usize n) {
+      const triton::uint64 m = node->getBitvectorMask64();
+      const triton::uint32 size = node->getBitvectorSize();
+      const triton::uint64* x = args.size() > 0 ? args[0] : nullptr;
+      const triton::uint64* y = args.size() > 1 ? args[1] : nullptr;
+      const triton::uint64* z = args.size() > 2 ? args[2] : nullptr;
+
+      switch (node->getType()) {
+        case BVADD_NODE:  for (triton::usize i = 0; i < n; i++) out[i] = (x[i] + y[i]) & m;    break;
+        case BVAND_NODE:  for (triton::usize i = 0; i < n; i++) out[i] = (x[i] & y[i]);        break;
+        case BVMUL_NODE:  for (triton::usize i = 0; i < n; i++) out[i] = (x[i] * y[i]) & m;    break;
+        case BVNAND_NODE: for (triton::usize i = 0; i < n; i++) out[i] = ~(x[i] & y[i]) & m;   break;
+        case BVNEG_NODE:  for (triton::usize i = 0; i < n; i++) out[i] = (0 - x[i]) & m;       break;
+        case BVNOR_NODE:  for (triton::usize i = 0; i < n; i++) out[i] = ~(x[i] | y[i]) & m;   break;
+        case BVNOT_NODE:  for (triton::usize i = 0; i < n; i++) out[i] = ~x[i] & m;            break;
+        case BVOR_NODE:   for (triton::usize i = 0; i < n; i++) out[i] = (x[i] | y[i]);        break;
+        case BVSUB_NODE:  for (triton::usize i = 0; i < n; i++) out[i] = (x[i] - y[i]) & m;    break;
+        case BVXNOR_NODE: for (triton::usize i = 0; i < n; i++) out[i] = ~(x[i] ^ y[i]) & m;   break;
+        case BVXOR_NODE:  for (triton::usize i = 0; i < n; i++) out[i] = (x[i] ^ y[i]);        break;
+
+        case BVSHL_NODE:
+          for (triton::usize i = 0; i < n; i++) {
+            triton::uint32 shift = static_cast<triton::uint32>(y[i]);
+            out[i] = (shift >= size ? 0 : ((x[i] << shift) & m));
+          }
+          break;
+
+        case BVLSHR_NODE:
+          for (triton::usize i = 0; i < n; i++) {
+            triton::uint32 shift = static_cast<triton::uint32>(y[i]);
+            out[i] = (shift >= size ? 0 : (x[i] >> shift));
+          }
+          break;
+
+        case BVASHR_NODE:
+          for (triton::usize i = 0; i < n; i++) {
+            triton::uint32 shift = static_cast<triton::uint32>(y[i]);
+            bool sign = ((x[i] >> (size - 1)) & 1);
+            if (shift >= size)
+              out[i] = (sign ? m : 0);
+            else if (sign && shift)
+              out[i] = (((x[i] >> shift) | (~(m >> shift))) & m);
+            else
+              out[i] = (x[i] >> shift);
+          }
+          break;
+
+        case BVROL_NODE:
+        case BVROR_NODE: {
+          triton::uint32 rot = triton::ast::getInteger<triton::uint32>(node->getChildren()[1]) % size;
+          if (rot == 0)
+            std::copy(x, x + n, out);
+          else if (node->getType() == BVROL_NODE)
+            for (triton::usize i = 0; i < n; i++) out[i] = ((x[i] << rot) | (x[i] >> (size - rot))) & m;
+          else
+            for (triton::usize i = 0; i < n; i++) out[i] = ((x[i] >> rot) | (x[i] << (size - rot))) & m;
+          break;
+        }
+
+        case BVUDIV_NODE: for (triton::usize i = 0; i < n; i++) out[i] = (y[i] == 0 ? m : x[i] / y[i]);      break;
+        case BVUREM_NODE: for (triton::usize i = 0; i < n; i++) out[i] = (y[i] == 0 ? x[i] : x[i] % y[i]);   break;
+
+        case BVUGE_NODE:  for (triton::usize i = 0; i < n; i++) out[i] = (x[i] >= y[i]);  break;
+        case BVUGT_NODE:  for (triton::usize i = 0; i < n; i++) out[i] = (x[i] > y[i]);   break;
+        case BVULE_NODE:  for (triton::usize i = 0; i < n; i++) out[i] = (x[i] <= y[i]);  break;
+        case BVULT_NODE:  for (triton::usize i = 0; i < n; i++) out[i] = (x[i] < y[i]);   break;
+        case DISTINCT_NODE: for (triton::usize i = 0; i < n; i++) out[i] = (x[i] != y[i]); break;
+        case EQUAL_NODE:  for (triton::usize i = 0; i < n; i++) out[i] = (x[i] == y[i]);  break;
+
+        case BVSGE_NODE:
+        case BVSGT_NODE:
+        case BVSLE_NODE:
+        case BVSLT_NODE: {
+          triton::uint32 csize = node->getChildren()[0]->getBitvectorSize();
+          for (triton::usize i = 0; i < n; i++) {
+            triton::sint64 a = signExtendLane(x, i, csize);
+            triton::sint64 b = signExtendLane(y, i, csize);
+            switch (node->getType()) {
+              case BVSGE_NODE: out[i] = (a >= b); break;
+              case BVSGT_NODE: out[i] = (a > b);  break;
+              case BVSLE_NODE: out[i] = (a <= b); break;
+              default:         out[i] = (a < b);  break;
+            }
+          }
+          break;
+        }
+
+        case BSWAP_NODE:
+          for (triton::usize i = 0; i < n; i++) {
+            triton::uint64 value = x[i] & 0xff;
+            for (triton::uint32 index = 8; index != size; index += triton::bitsize::byte)
+              value = (value << triton::bitsize::byte) | ((x[i] >> index) & 0xff);
+            out[i] = value;
+          }
+          break;
+
+        case BV_NODE:
+          std::fill(out, out + n, node->evaluate64());
+          break;
+
+        case CONCAT_NODE: {
+          std::copy(x, x + n, out);
+          for (triton::usize index = 1; index < args.size(); index++) {
+            triton::uint32 shift = node->getChildren()[index]->getBitvectorSize();
+            for (triton::usize i = 0; i < n; i++) out[i] = (out[i] << shift) | args[index][i];
+          }
+          break;
+        }
+
+        case EXTRACT_NODE: {
+          triton::uint32 low = triton::ast::getInteger<triton::uint32>(node->getChildren()[1]);
+          for (triton::usize i = 0; i < n; i++) out[i] = (z[i] >> low) & m;
+          break;
+        }
+
+        case IFF_NODE:   for (triton::usize i = 0; i < n; i++) out[i] = (!x[i] == !y[i]);        break;
+        case ITE_NODE:   for (triton::usize i = 0; i < n; i++) out[i] = (x[i] ? y[i] : z[i]);    break;
+        case LNOT_NODE:  for (triton::usize i = 0; i < n; i++) out[i] = !x[i];                  break;
+
+        case LAND_NODE:
+        case LOR_NODE:
+        case LXOR_NODE: {
+          std::fill(out, out + n, (node->getType() == LAND_NODE ? 1 : 0));
+          for (const auto* arg : args) {
+            switch (node->getType()) {
+              case LAND_NODE: for (triton::usize i = 0; i < n; i++) out[i] = (out[i] && arg[i]);   break;
+              case LOR_NODE:  for (triton::usize i = 0; i < n; i++) out[i] = (out[i] || arg[i]);   break;
+              default:        for (triton::usize i = 0; i < n; i++) out[i] = (!out[i] != !arg[i]); break;
+            }
+          }
+          break;
+        }
+
+        /* The first child is the size of the extension */
+        case SX_NODE: {
+          triton::uint32 csize = node->getChildren()[1]->getBitvectorSize();
+          for (triton::usize i = 0; i < n; i++) out[i] = static_cast<triton::uint64>(signExtendLane(y, i, csize)) & m;
+          break;
+        }
+
+        case ZX_NODE:
+          std::copy(y, y + n, out);
+          break;
+
+        case REFERENCE_NODE:
+          std::copy(x, x + n, out);
+          break;
+
+        default:
+          throw triton::exceptions::Ast("AstContext::evaluateBatch(): Invalid type node.");
+      }
+    }
+
+
+    AstContext::AstContext(const triton::modes::SharedModes& modes, std::pmr::memory_resource* resource)
       : modes(modes) {
+      this->abstractGeneration = 1;
+      this->allocatedNodes     = 0;
+      this->arena              = std::make_shared<AstArena>(false, resource);
+      this->liveChildren       = 0;
+      this->nextNodeId         = 0;
+      this->resource           = resource;
+      this->uid                = nextContextUid++;
+      this->liveNodes.fill(0);
+      this->integerPool.resize(maxPooledInteger + 1);
+      this->bvPool.resize(triton::bitsize::qword * pooledBvValues);
     }
 
 
     AstContext::~AstContext() {
+      this->dirtyNodes.clear();
       this->valueMapping.clear();
-      this->nodes.clear();
+      this->variableIds.clear();
+      for (auto& shard : this->internedNodes)
+        shard.nodes.clear();
+      this->integerPool.clear();
+      this->bvPool.clear();
+    }
+
+
+    void AstContext::reset(void) {
+      /* The nodes queued by the previous state go back to the arenas */
+      this->flushReclamation();
+
+      {
+        auto guard = this->lockIfConcurrent(this->variablesLock);
+        for (auto& entry : this->valueMapping)
+          entry = VariableValue();
+        this->variableIds.clear();
+        this->dirtyNodes.clear();
+      }
+
+      /* The ids of the variables start again, a node of the previous state must not be shared */
+      for (triton::usize shard = 0; shard < internedShards; shard++) {
+        auto guard = this->lockIfConcurrent(this->internedLocks[shard]);
+        this->internedNodes[shard].nodes.clear();
+      }
+
+      this->forgetAbstractValues();
+      this->clearTemporaries();
+      this->setRepresentationMode(triton::ast::representations::SMT_REPRESENTATION);
     }
 
 
     AstContext& AstContext::operator=(const AstContext& other) {
       std::enable_shared_from_this<AstContext>::operator=(other);
 
-      this->astRepresentation = other.astRepresentation;
-      this->modes             = other.modes;
-      this->nodes             = other.nodes;
-      this->valueMapping      = other.valueMapping;
+      this->abstractGeneration = other.abstractGeneration;
+      this->abstractValues     = other.abstractValues;
+      this->allocatedNodes     = other.allocatedNodes;
+      this->arena              = other.arena;
+      this->astRepresentation  = other.astRepresentation;
+      this->bvPool             = other.bvPool;
+      this->dirtyNodes         = other.dirtyNodes;
+      this->freeNodeIds        = other.freeNodeIds;
+      this->internedNodes      = other.internedNodes;
+      this->integerPool        = other.integerPool;
+      this->liveChildren       = other.liveChildren;
+      this->liveNodes          = other.liveNodes;
+      this->modes              = other.modes;
+      this->nextNodeId         = other.nextNodeId;
+      this->resource           = other.resource;
+      this->valueMapping       = other.valueMapping;
+      this->variableIds        = other.variableIds;
 
       return *this;
     }
 
 
-    SharedAbstractNode AstContext::collect(const SharedAbstractNode& node) {
-      /*
-       * We keep references to nodes which belong to a depth in the AST which is
-       * a multiple of 10000. Thus, when the root node is destroyed, the stack recursivity
-       * stops when the depth level of 10000 is reached, because the nodes there still
-       * have a reference to them in the AST manager. The destruction will continue at the
-       * next allocation of nodes and so on. So, it means that ASTs are destroyed by steps
-       * of depth of 10000 which avoids the overflow while keeping a good scale.
-       *
-       * See: #753.
-       */
-      triton::uint32 lvl = node->getLevel();
-      if (lvl != 0 && (lvl % 10000) == 0) {
-        this->nodes.push_front(node);
+    SharedAbstractNode AstContext::collect(const SharedAbstractNode& n) {
+      /* Share the node if an identical one already exists */
+      SharedAbstractNode node = n;
+      if (this->modes->isModeEnabled(triton::modes::AST_HASH_CONSING)) {
+        node = this->intern(n);
+      }
+
+      return node;
+    }
+
+
+    bool AstContext::isStructurallyEqual(const SharedAbstractNode& node1, const SharedAbstractNode& node2) const {
+      if (node1->getType() != node2->getType() || node1->getBitvectorSize() != node2->getBitvectorSize() || node1->getHash64() != node2->getHash64())
+        return false;
+
+      switch (node1->getType()) {
+        case INTEGER_NODE:
+          return reinterpret_cast<IntegerNode*>(node1.get())->getInteger() == reinterpret_cast<IntegerNode*>(node2.get())->getInteger();
+
+        case REFERENCE_NODE:
+          return reinterpret_cast<ReferenceNode*>(node1.get())->getSymbolicExpression() == reinterpret_cast<ReferenceNode*>(node2.get())->getSymbolicExpression();
+
+        case STRING_NODE:
+          return reinterpret_cast<StringNode*>(node1.get())->getString() == reinterpret_cast<StringNode*>(node2.get())->getString();
+
+        case VARIABLE_NODE:
+          return reinterpret_cast<VariableNode*>(node1.get())->getSymbolicVariable() == reinterpret_cast<VariableNode*>(node2.get())->getSymbolicVariable();
+
+        default:
+          break;
+      }
+
+      /* Children are interned first, so identical children are the same nodes */
+      const auto& children1 = node1->getChildren();
+      const auto& children2 = node2->getChildren();
+      if (children1.size() != children2.size())
+        return false;
+
+      for (triton::usize index = 0; index < children1.size(); index++) {
+        if (children1[index] != children2[index])
+          return false;
+      }
+
+      return true;
+    }
+
+
+    /* Splits an index into a base and a concrete offset, the base is nullptr if the index is concrete */
+    static std::pair<SharedAbstractNode, triton::uint512> splitIndex(const SharedAbstractNode& index) {
+      if (!index->isSymbolized())
+        return {nullptr, index->evaluate()};
+
+      SharedAbstractNode node = triton::ast::dereference(index);
+      if (node->getType() == BVADD_NODE) {
+        const auto& children = node->getChildren();
+        if (!children[0]->isSymbolized())
+          return {triton::ast::dereference(children[1]), children[0]->evaluate()};
+        if (!children[1]->isSymbolized())
+          return {triton::ast::dereference(children[0]), children[1]->evaluate()};
+      }
+
+      return {node, 0};
+    }
+
+
+    AstContext::index_relation_e AstContext::compareIndexes(const SharedAbstractNode& index1, const SharedAbstractNode& index2) const {
+      auto split1 = splitIndex(index1);
+      auto split2 = splitIndex(index2);
+
+      /* Nothing can be said about offsets from different bases */
+      if (split1.first != split2.first) {
+        if (split1.first == nullptr || split2.first == nullptr || !this->isStructurallyEqual(split1.first, split2.first))
+          return INDEX_UNKNOWN;
+      }
+
+      /* Offsets are already reduced modulo the size of the indexes */
+      return (split1.second == split2.second) ? INDEX_EQUAL : INDEX_DISTINCT;
+    }
+
+
+    SharedAbstractNode AstContext::intern(const SharedAbstractNode& node) {
+      /* Arrays hold a memory state, they can not be shared */
+      switch (node->getType()) {
+        case ARRAY_NODE:
+        case SELECT_NODE:
+        case STORE_NODE:
+          return node;
+        default:
+          break;
+      }
+
+      triton::uint64 key = node->getHash64();
+      triton::usize index = key % AstContext::internedShards;
+      auto& shard = this->internedNodes[index];
+      auto guard = this->lockIfConcurrent(this->internedLocks[index]);
+
+      auto range = shard.nodes.equal_range(key);
+      for (auto it = range.first; it != range.second;) {
+        SharedAbstractNode interned = it->second.lock();
+        if (interned == nullptr) {
+          it = shard.nodes.erase(it);
+          continue;
+        }
+        /* Nodes modified in place since they have been interned are compared with their current state */
+        if (interned == node || this->isStructurallyEqual(interned, node))
+          return interned;
+        ++it;
+      }
+
+      shard.nodes.emplace(key, node);
+
+      /* Remove the expired nodes once the shard has doubled */
+      if (shard.nodes.size() >= shard.threshold) {
+        for (auto it = shard.nodes.begin(); it != shard.nodes.end();) {
+          if (it->second.expired())
+            it = shard.nodes.erase(it);
+          else
+            ++it;
+        }
+        shard.threshold = std::max<triton::usize>(16, shard.nodes.size() * 2);
       }
+
       return node;
     }
 
 
     void AstContext::garbage(void) {
-      this->nodes.erase(std::remove_if(this->nodes.begin(), this->nodes.end(),
-        [](const SharedAbstractNode& n) {
-          return (n.use_count() == 1 ? true : false);
-        }), this->nodes.end()
-      );
+      /* The nodes are released by their destructor, see AbstractNode::~AbstractNode() */
+    }
+
+
+    void AstContext::setReclamation(bool enable, triton::usize capacity) {
+      if (enable) {
+        if (this->reclaimer)
+          return;
+        this->reclaimer = std::make_unique<AstReclaimer>(capacity);
+        this->reclaimerOwner = this->shared_from_this();
+        return;
+      }
+
+      if (!this->reclaimer)
+        return;
+
+      this->reclaimer->flush();
+      this->collectReclaimed();
+
+      /* The thread is idle, the nodes destroyed from now on give back their ids at once */
+      std::unique_ptr<AstReclaimer> stopped = std::move(this->reclaimer);
+      stopped.reset();
+
+      /* May be the last owner of the context, released last */
+      std::shared_ptr<AstContext> owner = std::move(this->reclaimerOwner);
+    }
+
+
+    bool AstContext::isReclamationEnabled(void) const {
+      return this->reclaimer != nullptr;
+    }
+
+
+    void AstContext::reclaim(std::shared_ptr<void>&& object) {
+      /* Only the last owner destroys something, the others just drop their reference */
+      if (!this->reclaimer || object == nullptr || object.use_count() > 1) {
+        object.reset();
+        return;
+      }
+
+      this->collectReclaimed();
+      this->reclaimer->submit(std::move(object));
+    }
+
+
+    void AstContext::flushReclamation(void) {
+      if (!this->reclaimer)
+        return;
+
+      this->reclaimer->flush();
+      this->collectReclaimed();
+    }
+
+
+    triton::usize AstContext::getReclamationStalls(void) const {
+      return this->reclaimer ? this->reclaimer->getStalls() : 0;
+    }
+
+
+    void AstContext::collectReclaimed(void) {
+      std::vector<AstReclaimer::Release> ids;
+      std::vector<AstArena::Block> blocks;
+
+      this->reclaimer->collect(ids, blocks);
+
+      for (const auto& release : ids)
+        this->releaseNodeId(release.id, release.type, release.children);
+
+      for (const auto& block : blocks)
+        block.arena->deallocate(block.ptr, block.size, block.align);
     }
 
 
     SharedAbstractNode AstContext::array(triton::uint32 indexSize) {
-      SharedAbstractNode node = std::make_shared<ArrayNode>(indexSize, this->shared_from_this());
+      SharedAbstractNode node = this->allocate<ArrayNode>(indexSize, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::array(): Not enough memory.");
       node->init();
@@ -81,7 +554,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::assert_(const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<AssertNode>(expr);
+      SharedAbstractNode node = this->allocate<AssertNode>(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::assert_(): Not enough memory.");
       node->init();
@@ -90,7 +563,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bswap(const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<BswapNode>(expr);
+      SharedAbstractNode node = this->allocate<BswapNode>(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bswap(): Not enough memory.");
       node->init();
@@ -99,11 +572,27 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bv(const triton::uint512& value, triton::uint32 size) {
-      SharedAbstractNode node = std::make_shared<BvNode>(value, size, this->shared_from_this());
+      /* The small constants are shared, as the semantics build them for every instruction */
+      WeakAbstractNode* pooled = nullptr;
+      if (size && size <= triton::bitsize::qword && value < pooledBvValues) {
+        auto guard = this->lockIfConcurrent(this->poolsLock);
+        pooled = &this->bvPool[(size - 1) * pooledBvValues + static_cast<triton::uint32>(value)];
+        if (auto node = pooled->lock())
+          return node;
+      }
+
+      SharedAbstractNode node = this->allocate<BvNode>(value, size, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bv(): Not enough memory.");
       node->init();
-      return this->collect(node);
+      node = this->collect(node);
+
+      if (pooled) {
+        auto guard = this->lockIfConcurrent(this->poolsLock);
+        *pooled = node;
+      }
+
+      return node;
     }
 
 
@@ -118,7 +607,12 @@ namespace triton {
           return expr1;
       }
 
-      SharedAbstractNode node = std::make_shared<BvaddNode>(expr1, expr2);
+      if (this->modes->isModeEnabled(triton::modes::AST_BALANCING)) {
+        if (SharedAbstractNode n = this->rotate(BVADD_NODE, expr1, expr2))
+          return n;
+      }
+
+      SharedAbstractNode node = this->allocate<BvaddNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvadd(): Not enough memory.");
       node->init();
@@ -156,7 +650,12 @@ namespace triton {
           return expr1;
       }
 
-      SharedAbstractNode node = std::make_shared<BvandNode>(expr1, expr2);
+      if (this->modes->isModeEnabled(triton::modes::AST_BALANCING)) {
+        if (SharedAbstractNode n = this->rotate(BVAND_NODE, expr1, expr2))
+          return n;
+      }
+
+      SharedAbstractNode node = this->allocate<BvandNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvand(): Not enough memory.");
       node->init();
@@ -167,6 +666,12 @@ namespace triton {
         }
       }
 
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
+        /* Optimization: the known bits give the value */
+        if (SharedAbstractNode n = this->simplify_known(node))
+          return n;
+      }
+
       return this->collect(node);
     }
 
@@ -182,7 +687,7 @@ namespace triton {
           return expr1;
       }
 
-      SharedAbstractNode node = std::make_shared<BvashrNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvashrNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvashr(): Not enough memory.");
       node->init();
@@ -193,12 +698,18 @@ namespace triton {
         }
       }
 
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
+        /* Optimization: the known bits give the value */
+        if (SharedAbstractNode n = this->simplify_known(node))
+          return n;
+      }
+
       return this->collect(node);
     }
 
 
     SharedAbstractNode AstContext::bvfalse(void) {
-      SharedAbstractNode node = std::make_shared<BvNode>(0, 1, this->shared_from_this());
+      SharedAbstractNode node = this->allocate<BvNode>(0, 1, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvfalse(): Not enough memory.");
       node->init();
@@ -221,7 +732,7 @@ namespace triton {
           return this->bv(0, expr1->getBitvectorSize());
       }
 
-      SharedAbstractNode node = std::make_shared<BvlshrNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvlshrNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvlshr(): Not enough memory.");
       node->init();
@@ -232,6 +743,12 @@ namespace triton {
         }
       }
 
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
+        /* Optimization: the known bits give the value */
+        if (SharedAbstractNode n = this->simplify_known(node))
+          return n;
+      }
+
       return this->collect(node);
     }
 
@@ -255,7 +772,12 @@ namespace triton {
           return expr1;
       }
 
-      SharedAbstractNode node = std::make_shared<BvmulNode>(expr1, expr2);
+      if (this->modes->isModeEnabled(triton::modes::AST_BALANCING)) {
+        if (SharedAbstractNode n = this->rotate(BVMUL_NODE, expr1, expr2))
+          return n;
+      }
+
+      SharedAbstractNode node = this->allocate<BvmulNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvmul(): Not enough memory.");
       node->init();
@@ -266,12 +788,18 @@ namespace triton {
         }
       }
 
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
+        /* Optimization: the known bits give the value */
+        if (SharedAbstractNode n = this->simplify_known(node))
+          return n;
+      }
+
       return this->collect(node);
     }
 
 
     SharedAbstractNode AstContext::bvnand(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvnandNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvnandNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvnand(): Not enough memory.");
       node->init();
@@ -287,7 +815,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvneg(const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<BvnegNode>(expr);
+      SharedAbstractNode node = this->allocate<BvnegNode>(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvneg(): Not enough memory.");
       node->init();
@@ -303,7 +831,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvnor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvnorNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvnorNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvnor(): Not enough memory.");
       node->init();
@@ -319,7 +847,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvnot(const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<BvnotNode>(expr);
+      SharedAbstractNode node = this->allocate<BvnotNode>(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvnot(): Not enough memory.");
       node->init();
@@ -357,7 +885,12 @@ namespace triton {
           return expr1;
       }
 
-      SharedAbstractNode node = std::make_shared<BvorNode>(expr1, expr2);
+      if (this->modes->isModeEnabled(triton::modes::AST_BALANCING)) {
+        if (SharedAbstractNode n = this->rotate(BVOR_NODE, expr1, expr2))
+          return n;
+      }
+
+      SharedAbstractNode node = this->allocate<BvorNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvor(): Not enough memory.");
       node->init();
@@ -368,12 +901,18 @@ namespace triton {
         }
       }
 
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
+        /* Optimization: the known bits give the value */
+        if (SharedAbstractNode n = this->simplify_known(node))
+          return n;
+      }
+
       return this->collect(node);
     }
 
 
     SharedAbstractNode AstContext::bvrol(const SharedAbstractNode& expr, triton::uint32 rot) {
-      SharedAbstractNode node = std::make_shared<BvrolNode>(expr, rot);
+      SharedAbstractNode node = this->allocate<BvrolNode>(expr, rot);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvrol(): Not enough memory.");
       node->init();
@@ -407,7 +946,7 @@ namespace triton {
       }
 
       /* Otherwise, we concretize the index rotation */
-      SharedAbstractNode node = std::make_shared<BvrolNode>(expr, this->integer(rot->evaluate()));
+      SharedAbstractNode node = this->allocate<BvrolNode>(expr, this->integer(rot->evaluate()));
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvrol(): Not enough memory.");
       node->init();
@@ -423,7 +962,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvror(const SharedAbstractNode& expr, triton::uint32 rot) {
-      SharedAbstractNode node = std::make_shared<BvrorNode>(expr, rot);
+      SharedAbstractNode node = this->allocate<BvrorNode>(expr, rot);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvror(): Not enough memory.");
       node->init();
@@ -457,7 +996,7 @@ namespace triton {
       }
 
       /* Otherwise, we concretize the index rotation */
-      SharedAbstractNode node = std::make_shared<BvrorNode>(expr, this->integer(rot->evaluate()));
+      SharedAbstractNode node = this->allocate<BvrorNode>(expr, this->integer(rot->evaluate()));
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvror(): Not enough memory.");
       node->init();
@@ -479,7 +1018,7 @@ namespace triton {
           return expr1;
       }
 
-      SharedAbstractNode node = std::make_shared<BvsdivNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvsdivNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsdiv(): Not enough memory.");
       node->init();
@@ -495,7 +1034,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvsge(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsgeNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvsgeNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsge(): Not enough memory.");
       node->init();
@@ -504,7 +1043,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvsgt(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsgtNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvsgtNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsgt(): Not enough memory.");
       node->init();
@@ -527,7 +1066,7 @@ namespace triton {
           return this->bv(0, expr1->getBitvectorSize());
       }
 
-      SharedAbstractNode node = std::make_shared<BvshlNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvshlNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvshl(): Not enough memory.");
       node->init();
@@ -538,12 +1077,18 @@ namespace triton {
         }
       }
 
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
+        /* Optimization: the known bits give the value */
+        if (SharedAbstractNode n = this->simplify_known(node))
+          return n;
+      }
+
       return this->collect(node);
     }
 
 
     SharedAbstractNode AstContext::bvsle(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsleNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvsleNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsle(): Not enough memory.");
       node->init();
@@ -552,7 +1097,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvslt(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsltNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvsltNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvslt(): Not enough memory.");
       node->init();
@@ -561,7 +1106,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvsmod(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsmodNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvsmodNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsmod(): Not enough memory.");
       node->init();
@@ -577,7 +1122,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvsrem(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsremNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvsremNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsrem(): Not enough memory.");
       node->init();
@@ -607,7 +1152,7 @@ namespace triton {
           return this->bv(0, expr1->getBitvectorSize());
       }
 
-      SharedAbstractNode node = std::make_shared<BvsubNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvsubNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsub(): Not enough memory.");
       node->init();
@@ -623,7 +1168,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvtrue(void) {
-      SharedAbstractNode node = std::make_shared<BvNode>(1, 1, this->shared_from_this());
+      SharedAbstractNode node = this->allocate<BvNode>(1, 1, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvtrue(): Not enough memory.");
       node->init();
@@ -638,7 +1183,7 @@ namespace triton {
           return expr1;
       }
 
-      SharedAbstractNode node = std::make_shared<BvudivNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvudivNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvudiv(): Not enough memory.");
       node->init();
@@ -649,12 +1194,18 @@ namespace triton {
         }
       }
 
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
+        /* Optimization: the known bits give the value */
+        if (SharedAbstractNode n = this->simplify_known(node))
+          return n;
+      }
+
       return this->collect(node);
     }
 
 
     SharedAbstractNode AstContext::bvuge(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvugeNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvugeNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvuge(): Not enough memory.");
       node->init();
@@ -663,7 +1214,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvugt(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvugtNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvugtNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvugt(): Not enough memory.");
       node->init();
@@ -672,7 +1223,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvule(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvuleNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvuleNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvule(): Not enough memory.");
       node->init();
@@ -681,7 +1232,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvult(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvultNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvultNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvult(): Not enough memory.");
       node->init();
@@ -690,7 +1241,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvurem(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvuremNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvuremNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvurem(): Not enough memory.");
       node->init();
@@ -701,12 +1252,18 @@ namespace triton {
         }
       }
 
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
+        /* Optimization: the known bits give the value */
+        if (SharedAbstractNode n = this->simplify_known(node))
+          return n;
+      }
+
       return this->collect(node);
     }
 
 
      SharedAbstractNode AstContext::bvxnor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvxnorNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<BvxnorNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvxnor(): Not enough memory.");
       node->init();
@@ -736,7 +1293,12 @@ namespace triton {
           return this->bv(0, expr1->getBitvectorSize());
       }
 
-      SharedAbstractNode node = std::make_shared<BvxorNode>(expr1, expr2);
+      if (this->modes->isModeEnabled(triton::modes::AST_BALANCING)) {
+        if (SharedAbstractNode n = this->rotate(BVXOR_NODE, expr1, expr2))
+          return n;
+      }
+
+      SharedAbstractNode node = this->allocate<BvxorNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvxor(): Not enough memory.");
       node->init();
@@ -756,7 +1318,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::concat(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<ConcatNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<ConcatNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::concat(): Not enough memory.");
       node->init();
@@ -784,7 +1346,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::declare(const SharedAbstractNode& var) {
-      SharedAbstractNode node = std::make_shared<DeclareNode>(var);
+      SharedAbstractNode node = this->allocate<DeclareNode>(var);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::declare(): Not enough memory.");
       node->init();
@@ -793,7 +1355,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::distinct(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<DistinctNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<DistinctNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::distinct(): Not enough memory.");
       node->init();
@@ -802,7 +1364,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::equal(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<EqualNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<EqualNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::equal(): Not enough memory.");
       node->init();
@@ -822,7 +1384,7 @@ namespace triton {
         }
       }
 
-      SharedAbstractNode node = std::make_shared<ExtractNode>(high, low, expr);
+      SharedAbstractNode node = this->allocate<ExtractNode>(high, low, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::extract(): Not enough memory.");
       node->init();
@@ -833,6 +1395,12 @@ namespace triton {
         }
       }
 
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
+        /* Optimization: the known bits give the value */
+        if (SharedAbstractNode n = this->simplify_known(node))
+          return n;
+      }
+
       return this->collect(node);
     }
 
@@ -842,7 +1410,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::iff(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<IffNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<IffNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::iff(): Not enough memory.");
       node->init();
@@ -851,11 +1419,27 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::integer(const triton::uint512& value) {
-      SharedAbstractNode node = std::make_shared<IntegerNode>(value, this->shared_from_this());
+      /* The integers of the sizes and indexes are shared */
+      WeakAbstractNode* pooled = nullptr;
+      if (value <= maxPooledInteger) {
+        auto guard = this->lockIfConcurrent(this->poolsLock);
+        pooled = &this->integerPool[static_cast<triton::uint32>(value)];
+        if (auto node = pooled->lock())
+          return node;
+      }
+
+      SharedAbstractNode node = this->allocate<IntegerNode>(value, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::integer(): Not enough memory.");
       node->init();
-      return this->collect(node);
+      node = this->collect(node);
+
+      if (pooled) {
+        auto guard = this->lockIfConcurrent(this->poolsLock);
+        *pooled = node;
+      }
+
+      return node;
     }
 
 
@@ -868,7 +1452,15 @@ namespace triton {
         }
       }
 
-      SharedAbstractNode node = std::make_shared<IteNode>(ifExpr, thenExpr, elseExpr);
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
+        /* Optimization: the known bits of the condition decide it */
+        AbstractValue condition = this->getAbstractValue(ifExpr);
+        if (condition.isConstant()) {
+          return condition.isTrue() ? thenExpr : elseExpr;
+        }
+      }
+
+      SharedAbstractNode node = this->allocate<IteNode>(ifExpr, thenExpr, elseExpr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::ite(): Not enough memory.");
       node->init();
@@ -878,7 +1470,12 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::land(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<LandNode>(expr1, expr2);
+      if (this->modes->isModeEnabled(triton::modes::AST_BALANCING)) {
+        if (SharedAbstractNode n = this->rotate(LAND_NODE, expr1, expr2))
+          return n;
+      }
+
+      SharedAbstractNode node = this->allocate<LandNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::land(): Not enough memory.");
       node->init();
@@ -891,7 +1488,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::let(std::string alias, const SharedAbstractNode& expr2, const SharedAbstractNode& expr3) {
-      SharedAbstractNode node = std::make_shared<LetNode>(alias, expr2, expr3);
+      SharedAbstractNode node = this->allocate<LetNode>(alias, expr2, expr3);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::let(): Not enough memory.");
       node->init();
@@ -900,7 +1497,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::lnot(const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<LnotNode>(expr);
+      SharedAbstractNode node = this->allocate<LnotNode>(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::lnot(): Not enough memory.");
       node->init();
@@ -909,7 +1506,12 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::lor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<LorNode>(expr1, expr2);
+      if (this->modes->isModeEnabled(triton::modes::AST_BALANCING)) {
+        if (SharedAbstractNode n = this->rotate(LOR_NODE, expr1, expr2))
+          return n;
+      }
+
+      SharedAbstractNode node = this->allocate<LorNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::lor(): Not enough memory.");
       node->init();
@@ -922,7 +1524,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::lxor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<LxorNode>(expr1, expr2);
+      SharedAbstractNode node = this->allocate<LxorNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::lxor(): Not enough memory");
       node->init();
@@ -935,7 +1537,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::reference(const triton::engines::symbolic::SharedSymbolicExpression& expr) {
-      SharedAbstractNode node = std::make_shared<ReferenceNode>(expr);
+      SharedAbstractNode node = this->allocate<ReferenceNode>(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::reference(): Not enough memory.");
       node->init();
@@ -944,7 +1546,10 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::select(const SharedAbstractNode& array, triton::usize index) {
-      SharedAbstractNode node = std::make_shared<SelectNode>(array, index);
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS))
+        return this->select(array, this->bv(index, triton::ast::getIndexSize(array)));
+
+      SharedAbstractNode node = this->allocate<SelectNode>(array, index);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::select(): Not enough memory.");
       node->init();
@@ -953,7 +1558,30 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::select(const SharedAbstractNode& array, const SharedAbstractNode& index) {
-      SharedAbstractNode node = std::make_shared<SelectNode>(array, index);
+      SharedAbstractNode from = array;
+
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
+        /*
+         * Optimization: select(store(A, i, v), j) = v if i = j, and select(A, j) if i != j.
+         * The store chain is walked down to the first store which may alias the index.
+         */
+        while (true) {
+          SharedAbstractNode store = triton::ast::dereference(from);
+          if (store->getType() != STORE_NODE)
+            break;
+
+          const auto& children = store->getChildren();
+          index_relation_e relation = this->compareIndexes(children[1], index);
+          if (relation == INDEX_EQUAL)
+            return children[2];
+          if (relation == INDEX_UNKNOWN)
+            break;
+
+          from = children[0];
+        }
+      }
+
+      SharedAbstractNode node = this->allocate<SelectNode>(from, index);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::select(): Not enough memory.");
       node->init();
@@ -962,7 +1590,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::store(const SharedAbstractNode& array, triton::usize index, const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<StoreNode>(array, index, expr);
+      SharedAbstractNode node = this->allocate<StoreNode>(array, index, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::store(): Not enough memory.");
       node->init();
@@ -971,7 +1599,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::store(const SharedAbstractNode& array, const SharedAbstractNode& index, const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<StoreNode>(array, index, expr);
+      SharedAbstractNode node = this->allocate<StoreNode>(array, index, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::store(): Not enough memory.");
       node->init();
@@ -980,7 +1608,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::string(std::string value) {
-      SharedAbstractNode node = std::make_shared<StringNode>(value, this->shared_from_this());
+      SharedAbstractNode node = this->allocate<StringNode>(value, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::string(): Not enough memory.");
       node->init();
@@ -993,7 +1621,7 @@ namespace triton {
       if (sizeExt == 0)
         return expr;
 
-      SharedAbstractNode node = std::make_shared<SxNode>(sizeExt, expr);
+      SharedAbstractNode node = this->allocate<SxNode>(sizeExt, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::sx(): Not enough memory.");
       node->init();
@@ -1009,10 +1637,11 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::variable(const triton::engines::symbolic::SharedSymbolicVariable& symVar) {
-      // try to get node from variable pool
-      auto it = this->valueMapping.find(symVar->getName());
-      if (it != this->valueMapping.end()) {
-        if (auto node = it->second.first.lock()) {
+      // try to get node from variable pool, the node is initialized before other threads may find it
+      auto guard = this->lockIfConcurrent(this->variablesLock);
+      triton::usize id = symVar->getId();
+      if (id < this->valueMapping.size() && this->valueMapping[id].initialized) {
+        if (auto node = this->valueMapping[id].node.lock()) {
           if (node->getBitvectorSize() != symVar->getSize()) {
             throw triton::exceptions::Ast("AstContext::variable(): Missmatching variable size.");
           }
@@ -1023,11 +1652,11 @@ namespace triton {
       }
       else {
         // if not found, create a new variable node
-        SharedAbstractNode node = std::make_shared<VariableNode>(symVar, this->shared_from_this());
-        this->initVariable(symVar->getName(), 0, node);
+        SharedAbstractNode node = this->allocate<VariableNode>(symVar, this->shared_from_this());
         if (node == nullptr) {
           throw triton::exceptions::Ast("AstContext::variable(): Not enough memory");
         }
+        this->initVariable(symVar->getName(), 0, node);
         node->init();
         return this->collect(node);
       }
@@ -1039,7 +1668,7 @@ namespace triton {
       if (sizeExt == 0)
         return expr;
 
-      SharedAbstractNode node = std::make_shared<ZxNode>(sizeExt, expr);
+      SharedAbstractNode node = this->allocate<ZxNode>(sizeExt, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::zx(): Not enough memory.");
       node->init();
@@ -1054,76 +1683,1152 @@ namespace triton {
     }
 
 
-    void AstContext::initVariable(const std::string& name, const triton::uint512& value, const SharedAbstractNode& node) {
-      auto it = this->valueMapping.find(name);
-      if (it == this->valueMapping.end()) {
-        this->valueMapping.insert(std::make_pair(name, std::make_pair(node, value)));
-      }
-      else {
-        throw triton::exceptions::Ast("AstContext::initVariable(): Ast variable already initialized.");
+    /* Returns true if the nodes of `type` are associative, see AST_BALANCING */
+    static bool isChainOperator(triton::ast::ast_e type) {
+      switch (type) {
+        case BVADD_NODE:
+        case BVAND_NODE:
+        case BVMUL_NODE:
+        case BVOR_NODE:
+        case BVXOR_NODE:
+        case LAND_NODE:
+        case LOR_NODE:
+          return true;
+        default:
+          return false;
       }
     }
 
 
-    void AstContext::updateVariable(const std::string& name, const triton::uint512& value) {
-      auto it = this->valueMapping.find(name);
-      if (it != this->valueMapping.end()) {
-        if (auto node = it->second.first.lock()) {
-          it->second.second = value;
-          node->initParents();
-        }
-        else {
-          throw triton::exceptions::Ast("AstContext::updateVariable(): This symbolic variable is dead.");
-        }
+    /* Returns the operands of the node, in order, the ones of a chain through the chain and the references */
+    static std::vector<SharedAbstractNode> getChainOperands(const SharedAbstractNode& node) {
+      std::vector<SharedAbstractNode> operands;
+
+      if (node->getType() == REFERENCE_NODE) {
+        operands.push_back(reinterpret_cast<ReferenceNode*>(node.get())->getSymbolicExpression()->getAst());
+        return operands;
       }
-      else {
-        throw triton::exceptions::Ast("AstContext::updateVariable(): This symbolic variable is not assigned at any AbstractNode or does not exist.");
+
+      if (!isChainOperator(node->getType())) {
+        operands.assign(node->getChildren().begin(), node->getChildren().end());
+        return operands;
       }
-    }
 
+      std::vector<SharedAbstractNode> worklist(node->getChildren().rbegin(), node->getChildren().rend());
+      while (!worklist.empty()) {
+        SharedAbstractNode current = worklist.back();
+        worklist.pop_back();
 
-    SharedAbstractNode AstContext::getVariableNode(const std::string& name) {
-      auto it = this->valueMapping.find(name);
-      if (it != this->valueMapping.end()) {
-        if (auto node = it->second.first.lock())
-          return node;
+        const SharedAbstractNode& target = triton::ast::dereference(current);
+        if (target->getType() == node->getType())
+          worklist.insert(worklist.end(), target->getChildren().rbegin(), target->getChildren().rend());
         else
-          throw triton::exceptions::Ast("AstContext::getVariableNode(): This symbolic variable is dead.");
+          operands.push_back(current);
       }
 
-      return nullptr;
+      return operands;
     }
 
 
-    const triton::uint512& AstContext::getVariableValue(const std::string& name) const {
-      auto it = this->valueMapping.find(name);
-      if (it != this->valueMapping.end()) {
-        if (auto node = it->second.first.lock())
-          return it->second.second;
-        else
-          throw triton::exceptions::Ast("AstContext::getVariableValue(): This symbolic variable is dead.");
-      }
+    SharedAbstractNode AstContext::balance(const SharedAbstractNode& node) {
+      std::unordered_map<const AbstractNode*, SharedAbstractNode> results;
+      std::vector<std::pair<SharedAbstractNode, bool>> worklist;
+      std::vector<SharedAbstractNode> children;
 
-      throw triton::exceptions::Ast("AstContext::updateVariable(): Variable does not exist.");
-    }
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::balance(): The node cannot be null.");
 
+      /* The nodes built from the balanced operands are not rotated */
+      bool saved = balancing;
+      balancing = true;
 
-    void AstContext::setRepresentationMode(triton::ast::representations::mode_e mode) {
-      this->astRepresentation.setMode(mode);
-    }
+      try {
+        worklist.push_back({node, false});
+        while (!worklist.empty()) {
+          std::pair<SharedAbstractNode, bool> item = std::move(worklist.back());
+          worklist.pop_back();
 
+          const SharedAbstractNode& current = item.first;
+          if (results.find(current.get()) != results.end())
+            continue;
 
-    triton::ast::representations::mode_e AstContext::getRepresentationMode(void) const {
-      return this->astRepresentation.getMode();
+          /* The inner nodes of a chain are only visited if they are used out of it */
+          std::vector<SharedAbstractNode> operands = getChainOperands(current);
+          if (item.second == false) {
+            worklist.push_back({current, true});
+            for (auto it = operands.rbegin(); it != operands.rend(); it++) {
+              if (results.find(it->get()) == results.end())
+                worklist.push_back({*it, false});
+            }
+            continue;
+          }
+
+          bool changed = false;
+          children.clear();
+          for (const auto& operand : operands) {
+            children.push_back(results.at(operand.get()));
+            changed |= (children.back() != operand);
+          }
+
+          SharedAbstractNode result = current;
+          triton::ast::ast_e type = current->getType();
+
+          if (type == REFERENCE_NODE)
+            result = children.front();
+
+          else if (type == LAND_NODE || type == LOR_NODE) {
+            if (changed || children.size() != current->getChildren().size())
+              result = this->build(type, children);
+          }
+
+          else if (isChainOperator(type)) {
+            if (changed || children.size() != 2) {
+              /* The adjacent operands are paired level by level, which keeps their order */
+              while (children.size() > 1) {
+                std::vector<SharedAbstractNode> level;
+                for (triton::usize i = 0; i + 1 < children.size(); i += 2)
+                  level.push_back(this->build(type, {children[i], children[i + 1]}));
+                if (children.size() % 2)
+                  level.push_back(children.back());
+                children.swap(level);
+              }
+              result = children.front();
+            }
+          }
+
+          else if (changed)
+            result = this->build(type, children);
+
+          results[current.get()] = result;
+        }
+      }
+      catch (...) {
+        balancing = saved;
+        throw;
+      }
+
+      balancing = saved;
+      return results.at(node.get());
+    }
+
+
+    SharedAbstractNode AstContext::build(triton::ast::ast_e type, const std::vector<SharedAbstractNode>& c) {
+      auto need = [&](triton::usize count) {
+        if (c.size() < count)
+          throw triton::exceptions::Ast("AstContext::build(): Missing children.");
+      };
+
+      switch (type) {
+        case ASSERT_NODE:     need(1); return this->assert_(c[0]);
+        case BSWAP_NODE:      need(1); return this->bswap(c[0]);
+        case BVADD_NODE:      need(2); return this->bvadd(c[0], c[1]);
+        case BVAND_NODE:      need(2); return this->bvand(c[0], c[1]);
+        case BVASHR_NODE:     need(2); return this->bvashr(c[0], c[1]);
+        case BVLSHR_NODE:     need(2); return this->bvlshr(c[0], c[1]);
+        case BVMUL_NODE:      need(2); return this->bvmul(c[0], c[1]);
+        case BVNAND_NODE:     need(2); return this->bvnand(c[0], c[1]);
+        case BVNEG_NODE:      need(1); return this->bvneg(c[0]);
+        case BVNOR_NODE:      need(2); return this->bvnor(c[0], c[1]);
+        case BVNOT_NODE:      need(1); return this->bvnot(c[0]);
+        case BVOR_NODE:       need(2); return this->bvor(c[0], c[1]);
+        case BVROL_NODE:      need(2); return this->bvrol(c[0], triton::ast::getInteger<triton::uint32>(c[1]));
+        case BVROR_NODE:      need(2); return this->bvror(c[0], triton::ast::getInteger<triton::uint32>(c[1]));
+        case BVSDIV_NODE:     need(2); return this->bvsdiv(c[0], c[1]);
+        case BVSGE_NODE:      need(2); return this->bvsge(c[0], c[1]);
+        case BVSGT_NODE:      need(2); return this->bvsgt(c[0], c[1]);
+        case BVSHL_NODE:      need(2); return this->bvshl(c[0], c[1]);
+        case BVSLE_NODE:      need(2); return this->bvsle(c[0], c[1]);
+        case BVSLT_NODE:      need(2); return this->bvslt(c[0], c[1]);
+        case BVSMOD_NODE:     need(2); return this->bvsmod(c[0], c[1]);
+        case BVSREM_NODE:     need(2); return this->bvsrem(c[0], c[1]);
+        case BVSUB_NODE:      need(2); return this->bvsub(c[0], c[1]);
+        case BVUDIV_NODE:     need(2); return this->bvudiv(c[0], c[1]);
+        case BVUGE_NODE:      need(2); return this->bvuge(c[0], c[1]);
+        case BVUGT_NODE:      need(2); return this->bvugt(c[0], c[1]);
+        case BVULE_NODE:      need(2); return this->bvule(c[0], c[1]);
+        case BVULT_NODE:      need(2); return this->bvult(c[0], c[1]);
+        case BVUREM_NODE:     need(2); return this->bvurem(c[0], c[1]);
+        case BVXNOR_NODE:     need(2); return this->bvxnor(c[0], c[1]);
+        case BVXOR_NODE:      need(2); return this->bvxor(c[0], c[1]);
+        case BV_NODE:         need(2); return this->bv(triton::ast::getInteger<triton::uint512>(c[0]), triton::ast::getInteger<triton::uint32>(c[1]));
+        case COMPOUND_NODE:   need(1); return this->compound(c);
+        case CONCAT_NODE:     need(1); return this->concat(c);
+        case DECLARE_NODE:    need(1); return this->declare(c[0]);
+        case DISTINCT_NODE:   need(2); return this->distinct(c[0], c[1]);
+        case EQUAL_NODE:      need(2); return this->equal(c[0], c[1]);
+        case EXTRACT_NODE:    need(3); return this->extract(triton::ast::getInteger<triton::uint32>(c[0]), triton::ast::getInteger<triton::uint32>(c[1]), c[2]);
+        case IFF_NODE:        need(2); return this->iff(c[0], c[1]);
+        case ITE_NODE:        need(3); return this->ite(c[0], c[1], c[2]);
+        case LAND_NODE:       need(1); return this->land(c);
+        case LNOT_NODE:       need(1); return this->lnot(c[0]);
+        case LOR_NODE:        need(1); return this->lor(c);
+        case LXOR_NODE:       need(1); return this->lxor(c);
+        case SELECT_NODE:     need(2); return this->select(c[0], c[1]);
+        case STORE_NODE:      need(3); return this->store(c[0], c[1], c[2]);
+        case SX_NODE:         need(2); return this->sx(triton::ast::getInteger<triton::uint32>(c[0]), c[1]);
+        case ZX_NODE:         need(2); return this->zx(triton::ast::getInteger<triton::uint32>(c[0]), c[1]);
+
+        case FORALL_NODE: {
+          need(2);
+          std::vector<SharedAbstractNode> vars(c.begin(), c.end() - 1);
+          return this->forall(vars, c.back());
+        }
+
+        case LET_NODE:
+          need(3);
+          if (c[0]->getType() != STRING_NODE)
+            throw triton::exceptions::Ast("AstContext::build(): The alias of a let must be a string.");
+          return this->let(reinterpret_cast<StringNode*>(c[0].get())->getString(), c[1], c[2]);
+
+        default:
+          throw triton::exceptions::Ast("AstContext::build(): Leaves and invalid nodes cannot be built.");
+      }
     }
 
 
-    std::ostream& AstContext::print(std::ostream& stream, AbstractNode* node) {
-      return this->astRepresentation.print(stream, node);
+    SharedAbstractNode AstContext::import(const SharedAbstractNode& node, const std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable>& variables) {
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::import(): The node cannot be null.");
+
+      return this->transplant({node}, variables, {}).front();
     }
 
 
-    SharedAbstractNode AstContext::simplify_concat(std::vector<SharedAbstractNode> exprs) {
+    std::vector<SharedAbstractNode> AstContext::import(const std::vector<SharedAbstractNode>& nodes, const std::unordered_map<triton::usize, SharedAbstractNode>& substitutions) {
+      for (const auto& node : nodes) {
+        if (node == nullptr)
+          throw triton::exceptions::Ast("AstContext::import(): The nodes cannot be null.");
+      }
+
+      for (const auto& it : substitutions) {
+        if (it.second == nullptr || it.second->getContext().get() != this)
+          throw triton::exceptions::Ast("AstContext::import(): A substitution must be a node of this context.");
+      }
+
+      return this->transplant(nodes, {}, substitutions);
+    }
+
+
+    std::vector<SharedAbstractNode> AstContext::transplant(const std::vector<SharedAbstractNode>& nodes,
+                                                           const std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable>& variables,
+                                                           const std::unordered_map<triton::usize, SharedAbstractNode>& substitutions) {
+      std::unordered_map<const AbstractNode*, SharedAbstractNode> copies;
+      std::vector<SharedAbstractNode> children;
+      std::vector<SharedAbstractNode> ret;
+
+      if (nodes.empty())
+        return ret;
+
+      /* Children first, so that a child is copied before its parents */
+      for (const auto& current : childrenExtraction(nodes, true, true)) {
+        SharedAbstractNode copy = nullptr;
+
+        switch (current->getType()) {
+          case REFERENCE_NODE:
+            copy = copies.at(reinterpret_cast<ReferenceNode*>(current.get())->getSymbolicExpression()->getAst().get());
+            break;
+
+          case ARRAY_NODE:
+            copy = this->array(reinterpret_cast<ArrayNode*>(current.get())->getIndexSize());
+            reinterpret_cast<ArrayNode*>(copy.get())->getMemory() = reinterpret_cast<ArrayNode*>(current.get())->getMemory();
+            break;
+
+          case INTEGER_NODE:
+            copy = this->integer(reinterpret_cast<IntegerNode*>(current.get())->getInteger());
+            break;
+
+          case STRING_NODE:
+            copy = this->string(reinterpret_cast<StringNode*>(current.get())->getString());
+            break;
+
+          case VARIABLE_NODE: {
+            triton::engines::symbolic::SharedSymbolicVariable symVar = reinterpret_cast<VariableNode*>(current.get())->getSymbolicVariable();
+
+            auto substitution = substitutions.find(symVar->getId());
+            if (substitution != substitutions.end()) {
+              if (substitution->second->getBitvectorSize() != symVar->getSize())
+                throw triton::exceptions::Ast("AstContext::import(): The substitution of a variable must have its size.");
+              copy = substitution->second;
+              break;
+            }
+
+            auto it = variables.find(symVar->getId());
+
+            if (it != variables.end()) {
+              if (it->second == nullptr || it->second->getSize() != symVar->getSize())
+                throw triton::exceptions::Ast("AstContext::import(): The mapping of a variable must have its size.");
+              symVar = it->second;
+            }
+
+            /* A variable already known keeps its value */
+            bool known = (this->getVariableNode(symVar->getId()) != nullptr);
+            copy = this->variable(symVar);
+            if (!known)
+              this->updateVariable(symVar->getId(), current->evaluate());
+            break;
+          }
+
+          default:
+            children.clear();
+            for (const auto& child : current->getChildren())
+              children.push_back(copies.at(child.get()));
+            copy = this->build(current->getType(), children);
+            break;
+        }
+
+        copies[current.get()] = copy;
+      }
+
+      ret.reserve(nodes.size());
+      for (const auto& node : nodes)
+        ret.push_back(copies.at(node.get()));
+
+      return ret;
+    }
+
+
+    SharedAbstractNode AstContext::substitute(const SharedAbstractNode& node, const std::unordered_map<SharedAbstractNode, SharedAbstractNode>& mapping, bool inplace) {
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::substitute(): The node cannot be null.");
+
+      return this->substitute(std::vector<SharedAbstractNode>{node}, mapping, inplace).front();
+    }
+
+
+    std::vector<SharedAbstractNode> AstContext::substitute(const std::vector<SharedAbstractNode>& nodes, const std::unordered_map<SharedAbstractNode, SharedAbstractNode>& mapping, bool inplace) {
+      std::unordered_map<const AbstractNode*, SharedAbstractNode> copies;
+      std::unordered_set<const AbstractNode*> owned;
+      std::vector<SharedAbstractNode> children;
+      std::vector<SharedAbstractNode> ret;
+
+      for (const auto& node : nodes) {
+        if (node == nullptr)
+          throw triton::exceptions::Ast("AstContext::substitute(): The nodes cannot be null.");
+      }
+
+      for (const auto& it : mapping) {
+        if (it.first == nullptr || it.second == nullptr)
+          throw triton::exceptions::Ast("AstContext::substitute(): The mapping cannot contain null nodes.");
+        if (it.first->getBitvectorSize() != it.second->getBitvectorSize() || it.first->isLogical() != it.second->isLogical())
+          throw triton::exceptions::Ast("AstContext::substitute(): A mapping must have the size of its key.");
+      }
+
+      if (nodes.empty())
+        return ret;
+
+      /* The nodes of the expressions belong to the symbolic engine, only those before a reference are owned */
+      if (inplace && !this->modes->isModeEnabled(triton::modes::AST_HASH_CONSING)) {
+        for (const auto& current : childrenExtraction(nodes, false, true))
+          owned.insert(current.get());
+      }
+
+      /* Children first, so that a child is substituted before its parents */
+      for (const auto& current : childrenExtraction(nodes, true, true)) {
+        auto it = mapping.find(current);
+        if (it != mapping.end()) {
+          copies[current.get()] = it->second;
+          continue;
+        }
+
+        if (current->getType() == REFERENCE_NODE) {
+          const SharedAbstractNode& ast  = reinterpret_cast<ReferenceNode*>(current.get())->getSymbolicExpression()->getAst();
+          const SharedAbstractNode& copy = copies.at(ast.get());
+          copies[current.get()] = (copy == ast) ? current : copy;
+          continue;
+        }
+
+        bool changed = false;
+        for (const auto& child : current->getChildren()) {
+          if (copies.at(child.get()) != child) {
+            changed = true;
+            break;
+          }
+        }
+
+        if (changed == false) {
+          copies[current.get()] = current;
+        }
+        else if (owned.find(current.get()) != owned.end()) {
+          /* The parents are initialized once, by initDirtyNodes() */
+          for (triton::uint32 index = 0; index < current->getChildren().size(); index++)
+            current->setChild(index, copies.at(current->getChildren()[index].get()), false);
+          copies[current.get()] = current;
+        }
+        else {
+          children.clear();
+          for (const auto& child : current->getChildren())
+            children.push_back(copies.at(child.get()));
+          copies[current.get()] = this->build(current->getType(), children);
+        }
+      }
+
+      if (!owned.empty())
+        this->initDirtyNodes();
+
+      ret.reserve(nodes.size());
+      for (const auto& node : nodes)
+        ret.push_back(copies.at(node.get()));
+
+      return ret;
+    }
+
+
+    std::vector<SharedAbstractNode> AstContext::lanes(const SharedAbstractNode& vec, triton::uint32 size) {
+      if (vec == nullptr)
+        throw triton::exceptions::Ast("AstContext::lanes(): The vector cannot be null.");
+
+      triton::uint32 vsize = vec->getBitvectorSize();
+      if (size == 0 || vsize % size != 0)
+        throw triton::exceptions::Ast("AstContext::lanes(): The size of the vector must be a multiple of the size of the lanes.");
+
+      std::vector<SharedAbstractNode> lanes;
+      lanes.reserve(vsize / size);
+
+      /*
+       * The parts of a concatenation aligned on the lanes are split on their own,
+       * so that a vector built by concatLanes() gives back its lanes without any
+       * new extraction. The references are only followed with AST_OPTIMIZATIONS,
+       * like simplify_extract() does.
+       */
+      SharedAbstractNode node = vec;
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS))
+        node = triton::ast::dereference(vec);
+
+      if (node->getType() == CONCAT_NODE) {
+        const auto& parts = node->getChildren();
+        bool aligned = true;
+
+        for (const auto& part : parts) {
+          if (part->getBitvectorSize() % size != 0) {
+            aligned = false;
+            break;
+          }
+        }
+
+        if (aligned) {
+          for (auto part = parts.rbegin(); part != parts.rend(); part++) {
+            triton::uint32 psize = (*part)->getBitvectorSize();
+            for (triton::uint32 low = 0; low != psize; low += size)
+              lanes.push_back(this->extract(low + size - 1, low, *part));
+          }
+          return lanes;
+        }
+      }
+
+      for (triton::uint32 low = 0; low != vsize; low += size)
+        lanes.push_back(this->extract(low + size - 1, low, vec));
+
+      return lanes;
+    }
+
+
+    SharedAbstractNode AstContext::lane(const SharedAbstractNode& vec, triton::uint32 size, triton::uint32 index) {
+      if (vec == nullptr)
+        throw triton::exceptions::Ast("AstContext::lane(): The vector cannot be null.");
+
+      if (size == 0 || (static_cast<triton::uint64>(index) + 1) * size > vec->getBitvectorSize())
+        throw triton::exceptions::Ast("AstContext::lane(): The lane is out of the vector.");
+
+      return this->extract((index + 1) * size - 1, index * size, vec);
+    }
+
+
+    SharedAbstractNode AstContext::insertLane(const SharedAbstractNode& vec, triton::uint32 index, const SharedAbstractNode& value) {
+      if (vec == nullptr || value == nullptr)
+        throw triton::exceptions::Ast("AstContext::insertLane(): The vector and the lane cannot be null.");
+
+      triton::uint32 vsize = vec->getBitvectorSize();
+      triton::uint32 size  = value->getBitvectorSize();
+
+      if ((static_cast<triton::uint64>(index) + 1) * size > vsize)
+        throw triton::exceptions::Ast("AstContext::insertLane(): The lane is out of the vector.");
+
+      triton::uint32 low  = index * size;
+      triton::uint32 high = low + size;
+
+      std::vector<SharedAbstractNode> parts;
+      parts.reserve(3);
+
+      if (high != vsize)
+        parts.push_back(this->extract(vsize - 1, high, vec));
+      parts.push_back(value);
+      if (low != 0)
+        parts.push_back(this->extract(low - 1, 0, vec));
+
+      return this->concat(parts);
+    }
+
+
+    SharedAbstractNode AstContext::concatLanes(const std::vector<SharedAbstractNode>& lanes) {
+      if (lanes.empty())
+        throw triton::exceptions::Ast("AstContext::concatLanes(): There must be at least one lane.");
+
+      /* The concatenation takes the most significant part first */
+      return this->concat(std::vector<SharedAbstractNode>(lanes.rbegin(), lanes.rend()));
+    }
+
+
+    SharedAbstractNode AstContext::splat(const SharedAbstractNode& lane, triton::uint32 count) {
+      if (lane == nullptr || count == 0)
+        throw triton::exceptions::Ast("AstContext::splat(): There must be at least one lane.");
+
+      return this->concat(std::vector<SharedAbstractNode>(count, lane));
+    }
+
+
+    SharedAbstractNode AstContext::mapLanes(const SharedAbstractNode& vec, triton::uint32 size, const std::function<SharedAbstractNode(const SharedAbstractNode&)>& fn) {
+      std::vector<SharedAbstractNode> lanes = this->lanes(vec, size);
+
+      for (auto& lane : lanes)
+        lane = fn(lane);
+
+      return this->concatLanes(lanes);
+    }
+
+
+    SharedAbstractNode AstContext::zipLanes(const SharedAbstractNode& vec1, const SharedAbstractNode& vec2, triton::uint32 size, const std::function<SharedAbstractNode(const SharedAbstractNode&, const SharedAbstractNode&)>& fn) {
+      std::vector<SharedAbstractNode> lanes1 = this->lanes(vec1, size);
+      std::vector<SharedAbstractNode> lanes2 = this->lanes(vec2, size);
+
+      if (lanes1.size() != lanes2.size())
+        throw triton::exceptions::Ast("AstContext::zipLanes(): The vectors must have the same size.");
+
+      for (triton::usize i = 0; i < lanes1.size(); i++)
+        lanes1[i] = fn(lanes1[i], lanes2[i]);
+
+      return this->concatLanes(lanes1);
+    }
+
+
+    void AstContext::initVariable(const std::string& name, const triton::uint512& value, const SharedAbstractNode& node) {
+      if (node == nullptr || node->getType() != VARIABLE_NODE)
+        throw triton::exceptions::Ast("AstContext::initVariable(): Expects a variable node.");
+
+      auto guard = this->lockIfConcurrent(this->variablesLock);
+      triton::usize id = reinterpret_cast<VariableNode*>(node.get())->getSymbolicVariable()->getId();
+      if (this->variableIds.find(name) != this->variableIds.end() || (id < this->valueMapping.size() && this->valueMapping[id].initialized))
+        throw triton::exceptions::Ast("AstContext::initVariable(): Ast variable already initialized.");
+
+      if (id >= this->valueMapping.size())
+        this->valueMapping.resize(id + 1);
+
+      this->valueMapping[id].node        = node;
+      this->valueMapping[id].value       = value;
+      this->valueMapping[id].initialized = true;
+      this->variableIds[name]            = id;
+    }
+
+
+    void AstContext::updateVariable(const std::string& name, const triton::uint512& value, bool withParents) {
+      auto it = this->variableIds.find(name);
+      if (it == this->variableIds.end())
+        throw triton::exceptions::Ast("AstContext::updateVariable(): This symbolic variable is not assigned at any AbstractNode or does not exist.");
+      this->updateVariable(it->second, value, withParents);
+    }
+
+
+    void AstContext::updateVariable(triton::usize id, const triton::uint512& value, bool withParents) {
+      if (id >= this->valueMapping.size() || !this->valueMapping[id].initialized)
+        throw triton::exceptions::Ast("AstContext::updateVariable(): This symbolic variable is not assigned at any AbstractNode or does not exist.");
+
+      auto& entry = this->valueMapping[id];
+      if (auto node = entry.node.lock()) {
+        entry.value = value;
+        if (withParents)
+          node->initParents();
+        else
+          this->setDirtyNode(node);
+      }
+      else {
+        throw triton::exceptions::Ast("AstContext::updateVariable(): This symbolic variable is dead.");
+      }
+    }
+
+
+    void AstContext::setDirtyNode(const SharedAbstractNode& node) {
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::setDirtyNode(): node cannot be null.");
+      this->dirtyNodes.push_back(node);
+    }
+
+
+    void AstContext::initDirtyNodes(void) {
+      std::vector<SharedAbstractNode> roots;
+
+      /* Dead nodes have no parent left to update */
+      roots.reserve(this->dirtyNodes.size());
+      for (const auto& weak : this->dirtyNodes) {
+        if (auto node = weak.lock())
+          roots.push_back(node);
+      }
+      this->dirtyNodes.clear();
+
+      if (roots.empty())
+        return;
+
+      for (auto& node : parentsExtraction(roots, false)) {
+        node->init();
+      }
+    }
+
+
+    AstContext::ThreadState& AstContext::getThreadState(void) {
+      /* The states of the calling thread <context uid : state>, the uids are never reused */
+      static thread_local std::unordered_map<triton::uint64, std::weak_ptr<ThreadState>> states;
+      static thread_local triton::uint64 lastUid = 0;
+      static thread_local ThreadState* last = nullptr;
+
+      /* The context is alive, so is its state */
+      if (lastUid == this->uid)
+        return *last;
+
+      std::shared_ptr<ThreadState> state;
+      auto it = states.find(this->uid);
+      if (it != states.end())
+        state = it->second.lock();
+
+      if (state == nullptr) {
+        state = std::make_shared<ThreadState>();
+        state->arena = std::make_shared<AstArena>(true, this->resource);
+
+        std::lock_guard<std::mutex> guard(this->threadStatesLock);
+        this->threadStates.push_back(state);
+
+        /* Forget the states of the dead contexts */
+        for (auto i = states.begin(); i != states.end();) {
+          if (i->second.expired())
+            i = states.erase(i);
+          else
+            ++i;
+        }
+        states[this->uid] = state;
+      }
+
+      lastUid = this->uid;
+      last    = state.get();
+
+      return *last;
+    }
+
+
+    void AstContext::reserveNodeIds(ThreadState& state) {
+      std::lock_guard<std::mutex> guard(this->threadStatesLock);
+
+      /* The ids given back by the threads first, then new ones */
+      triton::usize count = std::min<triton::usize>(this->freeNodeIds.size(), AstContext::nodeIdsBatch);
+      if (count) {
+        state.freeNodeIds.insert(state.freeNodeIds.end(), this->freeNodeIds.end() - count, this->freeNodeIds.end());
+        this->freeNodeIds.resize(this->freeNodeIds.size() - count);
+        return;
+      }
+
+      for (triton::usize index = AstContext::nodeIdsBatch; index > 0; index--)
+        state.freeNodeIds.push_back(this->nextNodeId + static_cast<triton::uint32>(index - 1));
+      this->nextNodeId += AstContext::nodeIdsBatch;
+    }
+
+
+    triton::uint32 AstContext::newNodeId(triton::ast::ast_e type) {
+      if (this->modes->isModeEnabled(triton::modes::AST_CONCURRENT)) {
+        ThreadState& state = this->getThreadState();
+        addRelaxed<triton::uint64>(state.allocatedNodes, 1);
+        addRelaxed<triton::usize>(state.liveNodes[type], 1);
+
+        if (state.freeNodeIds.empty())
+          this->reserveNodeIds(state);
+
+        triton::uint32 id = state.freeNodeIds.back();
+        state.freeNodeIds.pop_back();
+        return id;
+      }
+
+      this->allocatedNodes++;
+      this->liveNodes[type]++;
+
+      if (this->freeNodeIds.empty())
+        return this->nextNodeId++;
+
+      triton::uint32 id = this->freeNodeIds.back();
+      this->freeNodeIds.pop_back();
+      return id;
+    }
+
+
+    void AstContext::releaseNodeId(triton::uint32 id, triton::ast::ast_e type, triton::usize children) {
+      /* A node destroyed by the reclamation thread gives back its id later, see collectReclaimed() */
+      if (this->reclaimer && this->reclaimer->defer(id, type, children))
+        return;
+
+      this->forgetAbstractValue(id);
+
+      if (this->modes->isModeEnabled(triton::modes::AST_CONCURRENT)) {
+        ThreadState& state = this->getThreadState();
+        addRelaxed<triton::usize>(state.liveNodes[type], static_cast<triton::usize>(-1));
+        addRelaxed<triton::usize>(state.liveChildren, 0 - children);
+        state.freeNodeIds.push_back(id);
+
+        /* A thread destroying more nodes than it builds gives its ids back */
+        if (state.freeNodeIds.size() >= 4 * AstContext::nodeIdsBatch) {
+          std::lock_guard<std::mutex> guard(this->threadStatesLock);
+          triton::usize keep = 2 * AstContext::nodeIdsBatch;
+          this->freeNodeIds.insert(this->freeNodeIds.end(), state.freeNodeIds.begin() + keep, state.freeNodeIds.end());
+          state.freeNodeIds.resize(keep);
+        }
+        return;
+      }
+
+      this->freeNodeIds.push_back(id);
+      this->liveNodes[type]--;
+      this->liveChildren -= children;
+    }
+
+
+    void AstContext::countChildren(triton::usize count) {
+      if (this->modes->isModeEnabled(triton::modes::AST_CONCURRENT)) {
+        addRelaxed<triton::usize>(this->getThreadState().liveChildren, count);
+        return;
+      }
+      this->liveChildren += count;
+    }
+
+
+    std::unique_lock<std::mutex> AstContext::lockParents(const AbstractNode* node) {
+      return this->lockIfConcurrent(this->parentsLocks[(reinterpret_cast<std::uintptr_t>(node) >> 4) % AstContext::parentsShards]);
+    }
+
+
+    const AbstractValue* AstContext::findAbstractValue(const AbstractNode* node) const {
+      triton::uint32 id = node->getId();
+
+      if (id < this->abstractValues.size() && this->abstractValues[id].generation == this->abstractGeneration)
+        return &this->abstractValues[id].value;
+
+      return nullptr;
+    }
+
+
+    AbstractValue AstContext::getAbstractValue(const SharedAbstractNode& node) {
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::getAbstractValue(): node cannot be null.");
+
+      /* The operands of a node, none if its value does not depend on them */
+      auto operandsOf = [](AbstractNode* current, std::vector<AbstractNode*>& operands) {
+        operands.clear();
+
+        if (!current->isSymbolized() || current->isArray() || current->getBitvectorSize() > triton::bitsize::qword)
+          return;
+
+        if (current->getType() == REFERENCE_NODE) {
+          operands.push_back(reinterpret_cast<ReferenceNode*>(current)->getSymbolicExpression()->getAst().get());
+          return;
+        }
+
+        for (const auto& child : current->getChildren())
+          operands.push_back(child.get());
+      };
+
+      /* Post-order walk, the operands are analyzed before their node */
+      auto guard = this->lockIfConcurrent(this->abstractValuesLock);
+      std::vector<std::pair<AbstractNode*, bool>> worklist = {{node.get(), false}};
+      std::vector<AbstractNode*> operands;
+      std::vector<AbstractValue> values;
+
+      while (!worklist.empty()) {
+        AbstractNode* current = worklist.back().first;
+
+        if (this->findAbstractValue(current)) {
+          worklist.pop_back();
+          continue;
+        }
+
+        operandsOf(current, operands);
+
+        if (worklist.back().second == false) {
+          worklist.back().second = true;
+          for (AbstractNode* operand : operands) {
+            if (!this->findAbstractValue(operand))
+              worklist.push_back({operand, false});
+          }
+          continue;
+        }
+
+        worklist.pop_back();
+
+        values.clear();
+        for (AbstractNode* operand : operands)
+          values.push_back(*this->findAbstractValue(operand));
+
+        triton::uint32 id = current->getId();
+        if (id >= this->abstractValues.size())
+          this->abstractValues.resize(std::max(id + 1, this->getNodeIdsSize()));
+
+        this->abstractValues[id].value      = triton::ast::transferAbstractValue(current, values);
+        this->abstractValues[id].generation = this->abstractGeneration;
+      }
+
+      return *this->findAbstractValue(node.get());
+    }
+
+
+    void AstContext::forgetAbstractValue(triton::uint32 id) {
+      auto guard = this->lockIfConcurrent(this->abstractValuesLock);
+      if (id < this->abstractValues.size())
+        this->abstractValues[id].generation = 0;
+    }
+
+
+    void AstContext::forgetAbstractValues(void) {
+      auto guard = this->lockIfConcurrent(this->abstractValuesLock);
+      this->abstractGeneration++;
+    }
+
+
+    bool AstContext::isWideHashEnabled(void) const {
+      return this->modes->isModeEnabled(triton::modes::AST_WIDE_HASH);
+    }
+
+
+    triton::uint32 AstContext::getNodeIdsSize(void) const {
+      auto guard = this->lockIfConcurrent(this->threadStatesLock);
+      return this->nextNodeId;
+    }
+
+
+    triton::uint64 AstContext::getAllocatedNodes(void) const {
+      std::lock_guard<std::mutex> guard(this->threadStatesLock);
+      triton::uint64 count = this->allocatedNodes;
+
+      for (const auto& state : this->threadStates)
+        count += state->allocatedNodes.load(std::memory_order_relaxed);
+
+      return count;
+    }
+
+
+    triton::usize AstContext::getLiveNodes(triton::ast::ast_e type) const {
+      std::lock_guard<std::mutex> guard(this->threadStatesLock);
+      triton::usize count = this->liveNodes[type];
+
+      /* A thread may destroy the nodes of another one, only the sum makes sense */
+      for (const auto& state : this->threadStates)
+        count += state->liveNodes[type].load(std::memory_order_relaxed);
+
+      return count;
+    }
+
+
+    triton::usize AstContext::getLiveChildren(void) const {
+      std::lock_guard<std::mutex> guard(this->threadStatesLock);
+      triton::usize count = this->liveChildren;
+
+      for (const auto& state : this->threadStates)
+        count += state->liveChildren.load(std::memory_order_relaxed);
+
+      return count;
+    }
+
+
+    std::pair<std::vector<triton::uint32>, triton::uint32> AstContext::acquireVisitStamps(void) {
+      std::pair<std::vector<triton::uint32>, triton::uint32> stamps;
+      std::lock_guard<std::mutex> guard(this->visitStampsLock);
+
+      /* Nested and concurrent traversals take their own stamps */
+      if (!this->visitStamps.empty()) {
+        stamps = std::move(this->visitStamps.back());
+        this->visitStamps.pop_back();
+      }
+      else {
+        stamps.second = 0;
+      }
+
+      /* A stamp of a previous epoch does not mark a node, unless the epochs wrapped around */
+      if (++stamps.second == 0) {
+        std::fill(stamps.first.begin(), stamps.first.end(), 0);
+        stamps.second = 1;
+      }
+
+      return stamps;
+    }
+
+
+    void AstContext::releaseVisitStamps(std::vector<triton::uint32>&& stamps, triton::uint32 epoch) {
+      std::lock_guard<std::mutex> guard(this->visitStampsLock);
+      this->visitStamps.emplace_back(std::move(stamps), epoch);
+    }
+
+
+    std::vector<triton::uint512> AstContext::evaluateBatch(const SharedAbstractNode& node, const std::vector<SharedAbstractNode>& vars, const std::vector<std::vector<triton::uint512>>& inputs) {
+      std::unordered_map<std::string, triton::usize> varsIndex;
+      std::unordered_map<const AbstractNode*, triton::usize> slots;
+      std::vector<triton::uint512> results;
+      std::vector<const triton::uint64*> args;
+      std::vector<triton::uint64> lanes;
+
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::evaluateBatch(): node cannot be null.");
+
+      for (triton::usize index = 0; index < vars.size(); index++) {
+        if (vars[index] == nullptr || vars[index]->getType() != VARIABLE_NODE)
+          throw triton::exceptions::Ast("AstContext::evaluateBatch(): vars must be variable nodes.");
+        varsIndex[reinterpret_cast<VariableNode*>(vars[index].get())->getSymbolicVariable()->getName()] = index;
+      }
+
+      for (const auto& input : inputs) {
+        if (input.size() != vars.size())
+          throw triton::exceptions::Ast("AstContext::evaluateBatch(): Each input must give a value to each variable.");
+      }
+
+      /* Children go before parents, references are followed */
+      auto nodes = childrenExtraction(node, true, true);
+      for (const auto& n : nodes) {
+        if (!isBatchNative(n.get()))
+          return this->evaluateBatchScalar(node, vars, inputs);
+      }
+
+      for (triton::usize index = 0; index < nodes.size(); index++)
+        slots[nodes[index].get()] = index;
+
+      /*
+       *  The input vectors are evaluated by groups of batchLanes, so that
+       *  the lanes of the whole DAG stay small whatever the number of inputs.
+       */
+      results.reserve(inputs.size());
+      lanes.resize(nodes.size() * batchLanes);
+
+      for (triton::usize first = 0; first < inputs.size(); first += batchLanes) {
+        triton::usize n = std::min(batchLanes, inputs.size() - first);
+
+        for (triton::usize index = 0; index < nodes.size(); index++) {
+          AbstractNode* current = nodes[index].get();
+          triton::uint64* out   = &lanes[index * batchLanes];
+
+          switch (current->getType()) {
+            case INTEGER_NODE:
+              break;
+
+            case VARIABLE_NODE: {
+              auto it = varsIndex.find(reinterpret_cast<VariableNode*>(current)->getSymbolicVariable()->getName());
+              if (it == varsIndex.end()) {
+                std::fill(out, out + n, current->evaluate64());
+              }
+              else {
+                for (triton::usize i = 0; i < n; i++)
+                  out[i] = static_cast<triton::uint64>(inputs[first + i][it->second] & current->getBitvectorMask());
+              }
+              break;
+            }
+
+            default: {
+              args.clear();
+              if (current->getType() == REFERENCE_NODE) {
+                args.push_back(&lanes[slots.at(reinterpret_cast<ReferenceNode*>(current)->getSymbolicExpression()->getAst().get()) * batchLanes]);
+              }
+              else {
+                for (const auto& child : current->getChildren())
+                  args.push_back(&lanes[slots.at(child.get()) * batchLanes]);
+              }
+              evaluateLanes(current, args, out, n);
+              break;
+            }
+          }
+        }
+
+        const triton::uint64* root = &lanes[slots.at(node.get()) * batchLanes];
+        for (triton::usize i = 0; i < n; i++)
+          results.push_back(root[i]);
+      }
+
+      return results;
+    }
+
+
+    /* The pseudo random generator of sampleConstant(), from a fixed seed so that the samples are reproducible */
+    static triton::uint64 nextSample(triton::uint64& state) {
+      triton::uint64 z = (state += 0x9e3779b97f4a7c15);
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+      return z ^ (z >> 31);
+    }
+
+
+    bool AstContext::sampleConstant(const SharedAbstractNode& node, triton::usize samples, triton::uint512* value) {
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::sampleConstant(): node cannot be null.");
+
+      auto found = search(node, VARIABLE_NODE);
+      std::vector<SharedAbstractNode> vars(found.begin(), found.end());
+
+      if (vars.empty() || samples == 0) {
+        if (value)
+          *value = node->evaluate();
+        return true;
+      }
+
+      /* The first samples are the extreme values of the variables, then random ones */
+      std::vector<std::vector<triton::uint512>> inputs(samples, std::vector<triton::uint512>(vars.size()));
+      triton::uint64 state = 0;
+
+      for (triton::usize i = 0; i < samples; i++) {
+        for (triton::usize v = 0; v < vars.size(); v++) {
+          triton::uint512 mask = vars[v]->getBitvectorMask();
+          if (i == 0) {
+            inputs[i][v] = 0;
+          }
+          else if (i == 1) {
+            inputs[i][v] = mask;
+          }
+          else {
+            triton::uint512 random = 0;
+            for (triton::uint32 bits = 0; bits < vars[v]->getBitvectorSize(); bits += 64)
+              random = (random << 64) | nextSample(state);
+            inputs[i][v] = random & mask;
+          }
+        }
+      }
+
+      auto outputs = this->evaluateBatch(node, vars, inputs);
+      for (const auto& output : outputs) {
+        if (output != outputs[0])
+          return false;
+      }
+
+      if (value)
+        *value = outputs[0];
+
+      return true;
+    }
+
+
+    triton::uint512 AstContext::evaluate(const SharedAbstractNode& node, const std::unordered_map<triton::usize, triton::uint512>& model) const {
+      /* The registers of the program are the scratch memo of this evaluation */
+      AstProgram program(node);
+      return program.eval(model);
+    }
+
+
+    bool AstContext::isBatchEvaluationNative(const SharedAbstractNode& node) {
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::isBatchEvaluationNative(): node cannot be null.");
+
+      for (const auto& n : childrenExtraction(node, true, true)) {
+        if (!isBatchNative(n.get()))
+          return false;
+      }
+
+      return true;
+    }
+
+
+    std::vector<triton::uint512> AstContext::evaluateBatchScalar(const SharedAbstractNode& node, const std::vector<SharedAbstractNode>& vars, const std::vector<std::vector<triton::uint512>>& inputs) {
+      std::vector<triton::uint512> results;
+      std::vector<triton::uint512> saved;
+      std::vector<triton::usize> ids;
+
+      for (const auto& var : vars) {
+        ids.push_back(reinterpret_cast<VariableNode*>(var.get())->getSymbolicVariable()->getId());
+        saved.push_back(this->getVariableValue(ids.back()));
+      }
+
+      results.reserve(inputs.size());
+      for (const auto& input : inputs) {
+        for (triton::usize index = 0; index < ids.size(); index++)
+          this->updateVariable(ids[index], input[index], false);
+        this->initDirtyNodes();
+        results.push_back(node->evaluate());
+      }
+
+      /* Restore the values of the variables */
+      for (triton::usize index = 0; index < ids.size(); index++)
+        this->updateVariable(ids[index], saved[index], false);
+      this->initDirtyNodes();
+
+      return results;
+    }
+
+
+    SharedAbstractNode AstContext::getVariableNode(const std::string& name) {
+      auto guard = this->lockIfConcurrent(this->variablesLock);
+      auto it = this->variableIds.find(name);
+      if (it == this->variableIds.end())
+        return nullptr;
+      return this->getVariableNode(it->second);
+    }
+
+
+    SharedAbstractNode AstContext::getVariableNode(triton::usize id) {
+      auto guard = this->lockIfConcurrent(this->variablesLock);
+      if (id >= this->valueMapping.size() || !this->valueMapping[id].initialized)
+        return nullptr;
+
+      if (auto node = this->valueMapping[id].node.lock())
+        return node;
+
+      throw triton::exceptions::Ast("AstContext::getVariableNode(): This symbolic variable is dead.");
+    }
+
+
+    const triton::uint512& AstContext::getVariableValue(const std::string& name) const {
+      auto guard = this->lockIfConcurrent(this->variablesLock);
+      auto it = this->variableIds.find(name);
+      if (it == this->variableIds.end())
+        throw triton::exceptions::Ast("AstContext::getVariableValue(): Variable does not exist.");
+      return this->getVariableValue(it->second);
+    }
+
+
+    const triton::uint512& AstContext::getVariableValue(triton::usize id) const {
+      auto guard = this->lockIfConcurrent(this->variablesLock);
+      if (id >= this->valueMapping.size() || !this->valueMapping[id].initialized)
+        throw triton::exceptions::Ast("AstContext::getVariableValue(): Variable does not exist.");
+
+      if (this->valueMapping[id].node.expired())
+        throw triton::exceptions::Ast("AstContext::getVariableValue(): This symbolic variable is dead.");
+
+      return this->valueMapping[id].value;
+    }
+
+
+    void AstContext::setRepresentationMode(triton::ast::representations::mode_e mode) {
+      this->astRepresentation.setMode(mode);
+    }
+
+
+    triton::ast::representations::mode_e AstContext::getRepresentationMode(void) const {
+      return this->astRepresentation.getMode();
+    }
+
+
+    const triton::modes::SharedModes& AstContext::getModes(void) const {
+      return this->modes;
+    }
+
+
+    std::pmr::memory_resource* AstContext::getMemoryResource(void) const {
+      return this->resource;
+    }
+
+
+    std::ostream& AstContext::print(std::ostream& stream, AbstractNode* node) {
+      return this->astRepresentation.print(stream, node);
+    }
+
+
+    void AstContext::shareTemporaries(const std::vector<SharedAbstractNode>& roots) {
+      this->astRepresentation.shareTemporaries(roots);
+    }
+
+
+    std::ostream& AstContext::printTemporaries(std::ostream& stream, const SharedAbstractNode& node) {
+      return this->astRepresentation.printTemporaries(stream, node);
+    }
+
+
+    void AstContext::clearTemporaries(void) {
+      this->astRepresentation.clearTemporaries();
+    }
+
+
+    SharedAbstractNode AstContext::simplify_concat(std::vector<SharedAbstractNode> exprs) {
       /*
        * Optimization: concatenate extractions in one if possible. We are
        * trying to find out whether this is a concatenation of sequential
@@ -1304,5 +3009,59 @@ namespace triton {
       return node == expr ? 0 : this->extract(high, low, node);
     }
 
+
+    SharedAbstractNode AstContext::simplify_known(const SharedAbstractNode& node) {
+      if (!node->isSymbolized() || node->getBitvectorSize() > triton::bitsize::qword)
+        return nullptr;
+
+      AbstractValue value = this->getAbstractValue(node);
+      if (!value.isConstant())
+        return nullptr;
+
+      return this->bv(value.getConstant(), node->getBitvectorSize());
+    }
+
+
+    SharedAbstractNode AstContext::rotate(triton::ast::ast_e type, const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
+      SharedAbstractNode left  = expr1;
+      SharedAbstractNode right = expr2;
+      SharedAbstractNode node  = nullptr;
+
+      if (balancing)
+        return nullptr;
+
+      /*
+       * (a1 op a2) op b = a1 op (a2 op b) when a2 and b have about the same level, which carries on
+       * down the left operands. A chain built one operand at a time is then kept as a binary counter
+       * of balanced subtrees, whose depth is logarithmic. The inner nodes are not rotated again.
+       */
+      balancing = true;
+
+      try {
+        while (true) {
+          const SharedAbstractNode& target = triton::ast::dereference(left);
+          if (target->getType() != type || target->getChildren().size() != 2)
+            break;
+
+          SharedAbstractNode a2 = target->getChildren()[1];
+          if (a2->getLevel() > right->getLevel() || a2->getLevel() + 1 < right->getLevel())
+            break;
+
+          right = this->build(type, {a2, right});
+          left  = target->getChildren()[0];
+        }
+
+        if (right != expr2)
+          node = this->build(type, {left, right});
+      }
+      catch (...) {
+        balancing = false;
+        throw;
+      }
+
+      balancing = false;
+      return node;
+    }
+
   }; /* ast namespace */
 }; /* triton namespace */
@@ -0,0 +1,167 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <bitset>
+
+#include <triton/astMemory.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* The number of bits of the address consumed by each level */
+    static const triton::uint32 levelBits = 6;
+
+
+    /* The children of an inner node, or the cells of a leaf, in the order of the bits of `bitmap` */
+    struct ArrayMemory::Node {
+      triton::uint64 bitmap = 0;
+      std::vector<std::shared_ptr<const Node>> children;
+      std::vector<triton::uint8> cells;
+    };
+
+
+    /* Returns the bit of the slot of `addr` at `level` */
+    static inline triton::uint64 slotBit(triton::uint64 addr, triton::uint32 level) {
+      return static_cast<triton::uint64>(1) << ((addr >> (level * levelBits)) & ((1 << levelBits) - 1));
+    }
+
+
+    /* Returns the position of the slot `bit` among the slots used in `bitmap` */
+    static inline triton::usize slotPosition(triton::uint64 bitmap, triton::uint64 bit) {
+      return std::bitset<64>(bitmap & (bit - 1)).count();
+    }
+
+
+    ArrayMemory::ArrayMemory()
+      : levels(0), cells(0) {
+    }
+
+
+    bool ArrayMemory::fits(triton::uint64 addr) const {
+      triton::uint32 shift = (this->levels + 1) * levelBits;
+      return shift >= 64 || (addr >> shift) == 0;
+    }
+
+
+    const triton::uint8* ArrayMemory::find(triton::uint64 addr) const {
+      if (this->root == nullptr || this->fits(addr) == false)
+        return nullptr;
+
+      const Node* node = this->root.get();
+      for (triton::uint32 level = this->levels; ; level--) {
+        triton::uint64 bit = slotBit(addr, level);
+        if ((node->bitmap & bit) == 0)
+          return nullptr;
+
+        triton::usize pos = slotPosition(node->bitmap, bit);
+        if (level == 0)
+          return &node->cells[pos];
+
+        node = node->children[pos].get();
+      }
+    }
+
+
+    std::shared_ptr<const ArrayMemory::Node> ArrayMemory::store(const Node* node, triton::uint32 level, triton::uint64 addr, triton::uint8 value) {
+      auto copy = node ? std::make_shared<Node>(*node) : std::make_shared<Node>();
+      triton::uint64 bit = slotBit(addr, level);
+      triton::usize pos  = slotPosition(copy->bitmap, bit);
+      bool used          = (copy->bitmap & bit) != 0;
+
+      copy->bitmap |= bit;
+
+      if (level == 0) {
+        if (used)
+          copy->cells[pos] = value;
+        else
+          copy->cells.insert(copy->cells.begin() + pos, value);
+      }
+      else {
+        if (used)
+          copy->children[pos] = ArrayMemory::store(copy->children[pos].get(), level - 1, addr, value);
+        else
+          copy->children.insert(copy->children.begin() + pos, ArrayMemory::store(nullptr, level - 1, addr, value));
+      }
+
+      return copy;
+    }
+
+
+    void ArrayMemory::store(triton::uint64 addr, triton::uint8 value) {
+      const triton::uint8* cell = this->find(addr);
+
+      /* Nothing to copy if the cell already holds the value */
+      if (cell != nullptr) {
+        if (*cell == value)
+          return;
+      }
+      else {
+        this->cells++;
+      }
+
+      /* Grow the tree until it covers the address, the old root being the first child */
+      while (this->fits(addr) == false) {
+        if (this->root) {
+          auto parent = std::make_shared<Node>();
+          parent->bitmap = 1;
+          parent->children.push_back(this->root);
+          this->root = parent;
+        }
+        this->levels++;
+      }
+
+      this->root = ArrayMemory::store(this->root.get(), this->levels, addr, value);
+    }
+
+
+    triton::uint8 ArrayMemory::select(triton::uint64 addr) const {
+      const triton::uint8* cell = this->find(addr);
+      return cell ? *cell : 0;
+    }
+
+
+    bool ArrayMemory::isDefined(triton::uint64 addr) const {
+      return this->find(addr) != nullptr;
+    }
+
+
+    triton::usize ArrayMemory::size(void) const {
+      return this->cells;
+    }
+
+
+    void ArrayMemory::collect(const Node* node, triton::uint32 level, triton::uint64 prefix, std::vector<std::pair<triton::uint64, triton::uint8>>& out) {
+      triton::usize pos = 0;
+
+      for (triton::uint32 slot = 0; slot < 64; slot++) {
+        if ((node->bitmap & (static_cast<triton::uint64>(1) << slot)) == 0)
+          continue;
+
+        triton::uint64 addr = prefix | (static_cast<triton::uint64>(slot) << (level * levelBits));
+        if (level == 0)
+          out.push_back({addr, node->cells[pos]});
+        else
+          ArrayMemory::collect(node->children[pos].get(), level - 1, addr, out);
+        pos++;
+      }
+    }
+
+
+    std::vector<std::pair<triton::uint64, triton::uint8>> ArrayMemory::getCells(void) const {
+      std::vector<std::pair<triton::uint64, triton::uint8>> out;
+
+      out.reserve(this->cells);
+      if (this->root)
+        ArrayMemory::collect(this->root.get(), this->levels, 0, out);
+
+      return out;
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
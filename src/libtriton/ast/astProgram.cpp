@@ -0,0 +1,343 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <triton/astProgram.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    AstProgram::AstProgram(const SharedAbstractNode& node) {
+      std::unordered_map<const AbstractNode*, triton::uint32> regs;
+      std::unordered_map<triton::usize, triton::uint32> vars;
+
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstProgram::AstProgram(): node cannot be null.");
+
+      /*
+       * Children go before parents, references are followed. The visit stamps
+       * of the context are not used, so that the same AST may be compiled by
+       * several threads.
+       */
+      std::vector<AbstractNode*> order;
+      std::unordered_set<const AbstractNode*> visited;
+      std::vector<std::pair<AbstractNode*, bool>> worklist = {{node.get(), false}};
+
+      while (!worklist.empty()) {
+        auto item = worklist.back();
+        worklist.pop_back();
+
+        if (item.second) {
+          order.push_back(item.first);
+          continue;
+        }
+
+        if (!visited.insert(item.first).second)
+          continue;
+
+        worklist.push_back({item.first, true});
+        if (item.first->getType() == REFERENCE_NODE) {
+          AbstractNode* ast = reinterpret_cast<ReferenceNode*>(item.first)->getSymbolicExpression()->getAst().get();
+          if (visited.find(ast) == visited.end())
+            worklist.push_back({ast, false});
+          continue;
+        }
+
+        for (const auto& child : item.first->getChildren()) {
+          if (visited.find(child.get()) == visited.end())
+            worklist.push_back({child.get(), false});
+        }
+      }
+
+      for (AbstractNode* current : order) {
+
+        /* A reference shares the register of its expression */
+        if (current->getType() == REFERENCE_NODE) {
+          regs[current] = regs.at(reinterpret_cast<ReferenceNode*>(current)->getSymbolicExpression()->getAst().get());
+          continue;
+        }
+
+        triton::uint32 reg = static_cast<triton::uint32>(this->registers.size());
+        regs[current] = reg;
+        this->sizes.push_back(current->getBitvectorSize());
+
+        switch (current->getType()) {
+          case ARRAY_NODE:
+          case SELECT_NODE:
+          case STORE_NODE:
+            throw triton::exceptions::Ast("AstProgram::AstProgram(): Arrays cannot be compiled.");
+
+          case BV_NODE:
+            this->registers.push_back(current->evaluate());
+            continue;
+
+          case INTEGER_NODE:
+            this->registers.push_back(reinterpret_cast<IntegerNode*>(current)->getInteger());
+            continue;
+
+          case STRING_NODE:
+            this->registers.push_back(0);
+            continue;
+
+          default:
+            this->registers.push_back(0);
+            break;
+        }
+
+        const auto& children = current->getChildren();
+
+        Instruction inst;
+        inst.type        = current->getType();
+        inst.dst         = reg;
+        inst.size        = current->getBitvectorSize();
+        inst.first       = static_cast<triton::uint32>(this->operands.size());
+        inst.count       = static_cast<triton::uint32>(children.size());
+        inst.imm         = 0;
+        inst.mask        = current->getBitvectorMask();
+
+        for (const auto& child : children)
+          this->operands.push_back(regs.at(child.get()));
+
+        switch (inst.type) {
+          case BVROL_NODE:
+          case BVROR_NODE:
+            inst.imm = triton::ast::getInteger<triton::uint32>(children[1]) % inst.size;
+            break;
+
+          case EXTRACT_NODE:
+            inst.imm = triton::ast::getInteger<triton::uint32>(children[1]);
+            break;
+
+          case VARIABLE_NODE: {
+            const auto& symVar = reinterpret_cast<VariableNode*>(current)->getSymbolicVariable();
+            auto it = vars.find(symVar->getId());
+            if (it == vars.end()) {
+              it = vars.insert({symVar->getId(), static_cast<triton::uint32>(this->variables.size())}).first;
+              this->variables.push_back(symVar->getId());
+              this->defaults.push_back(current->evaluate());
+            }
+            inst.imm = it->second;
+            break;
+          }
+
+          default:
+            break;
+        }
+
+        this->instructions.push_back(inst);
+      }
+
+      this->root = regs.at(node.get());
+    }
+
+
+    triton::sint512 AstProgram::signExtend(triton::uint32 reg) const {
+      triton::uint32 size   = this->sizes[reg];
+      triton::sint512 value = 0;
+
+      if ((this->registers[reg] >> (size - 1)) & 1) {
+        value = -1;
+        value = ((value << size) | static_cast<triton::sint512>(this->registers[reg]));
+      }
+      else {
+        value = this->registers[reg];
+      }
+
+      return value;
+    }
+
+
+    triton::uint512 AstProgram::eval(const std::unordered_map<triton::usize, triton::uint512>& values) {
+      auto& r = this->registers;
+
+      for (const auto& inst : this->instructions) {
+        const triton::uint32* op = this->operands.data() + inst.first;
+        triton::uint512& dst = r[inst.dst];
+
+        switch (inst.type) {
+          case ASSERT_NODE:   dst = r[op[0]] & inst.mask;                    break;
+          case BVADD_NODE:    dst = (r[op[0]] + r[op[1]]) & inst.mask;       break;
+          case BVAND_NODE:    dst = (r[op[0]] & r[op[1]]);                   break;
+          case BVMUL_NODE:    dst = (r[op[0]] * r[op[1]]) & inst.mask;       break;
+          case BVNAND_NODE:   dst = (~(r[op[0]] & r[op[1]]) & inst.mask);    break;
+          case BVNEG_NODE:    dst = ((~r[op[0]] + 1) & inst.mask);           break;
+          case BVNOR_NODE:    dst = (~(r[op[0]] | r[op[1]]) & inst.mask);    break;
+          case BVNOT_NODE:    dst = (~r[op[0]] & inst.mask);                 break;
+          case BVOR_NODE:     dst = (r[op[0]] | r[op[1]]);                   break;
+          case BVSUB_NODE:    dst = (r[op[0]] - r[op[1]]) & inst.mask;       break;
+          case BVXNOR_NODE:   dst = (~(r[op[0]] ^ r[op[1]]) & inst.mask);    break;
+          case BVXOR_NODE:    dst = (r[op[0]] ^ r[op[1]]);                   break;
+          case COMPOUND_NODE: dst = 0;                                       break;
+          case DECLARE_NODE:  dst = r[op[0]];                                break;
+          case FORALL_NODE:   dst = 0;                                       break;
+          case LET_NODE:      dst = r[op[2]];                                break;
+
+          case BVSHL_NODE: {
+            triton::uint32 shift = static_cast<triton::uint32>(r[op[1]]);
+            dst = (shift >= inst.size ? triton::uint512(0) : triton::uint512((r[op[0]] << shift) & inst.mask));
+            break;
+          }
+
+          case BVLSHR_NODE: {
+            triton::uint32 shift = static_cast<triton::uint32>(r[op[1]]);
+            dst = (shift >= inst.size ? triton::uint512(0) : triton::uint512(r[op[0]] >> shift));
+            break;
+          }
+
+          case BVASHR_NODE: {
+            triton::uint32 shift = static_cast<triton::uint32>(r[op[1]]);
+            bool sign = ((r[op[0]] >> (inst.size - 1)) & 1) != 0;
+            if (shift >= inst.size)
+              dst = (sign ? inst.mask : triton::uint512(0));
+            else if (sign)
+              dst = ((r[op[0]] >> shift) | (inst.mask & ~(inst.mask >> shift)));
+            else
+              dst = (r[op[0]] >> shift);
+            break;
+          }
+
+          case BVROL_NODE:
+            dst = (((r[op[0]] << inst.imm) | (r[op[0]] >> (inst.size - inst.imm))) & inst.mask);
+            break;
+
+          case BVROR_NODE:
+            dst = (((r[op[0]] >> inst.imm) | (r[op[0]] << (inst.size - inst.imm))) & inst.mask);
+            break;
+
+          case BVSDIV_NODE: {
+            triton::sint512 op1Signed = this->signExtend(op[0]);
+            triton::sint512 op2Signed = this->signExtend(op[1]);
+            if (op2Signed == 0)
+              dst = (static_cast<triton::uint512>(op1Signed < 0 ? 1 : -1) & inst.mask);
+            else
+              dst = (static_cast<triton::uint512>((op1Signed / op2Signed)) & inst.mask);
+            break;
+          }
+
+          case BVSMOD_NODE: {
+            triton::sint512 op1Signed = this->signExtend(op[0]);
+            triton::sint512 op2Signed = this->signExtend(op[1]);
+            if (r[op[1]] == 0)
+              dst = r[op[0]];
+            else
+              dst = (static_cast<triton::uint512>((((op1Signed % op2Signed) + op2Signed) % op2Signed)) & inst.mask);
+            break;
+          }
+
+          case BVSREM_NODE: {
+            triton::sint512 op1Signed = this->signExtend(op[0]);
+            triton::sint512 op2Signed = this->signExtend(op[1]);
+            if (r[op[1]] == 0)
+              dst = r[op[0]];
+            else
+              dst = (static_cast<triton::uint512>((op1Signed - ((op1Signed / op2Signed) * op2Signed))) & inst.mask);
+            break;
+          }
+
+          case BVUDIV_NODE:   dst = (r[op[1]] == 0 ? inst.mask : triton::uint512(r[op[0]] / r[op[1]]));   break;
+          case BVUREM_NODE:   dst = (r[op[1]] == 0 ? r[op[0]] : triton::uint512(r[op[0]] % r[op[1]]));    break;
+
+          case BVSGE_NODE:    dst = (this->signExtend(op[0]) >= this->signExtend(op[1]));  break;
+          case BVSGT_NODE:    dst = (this->signExtend(op[0]) >  this->signExtend(op[1]));  break;
+          case BVSLE_NODE:    dst = (this->signExtend(op[0]) <= this->signExtend(op[1]));  break;
+          case BVSLT_NODE:    dst = (this->signExtend(op[0]) <  this->signExtend(op[1]));  break;
+          case BVUGE_NODE:    dst = (r[op[0]] >= r[op[1]]);  break;
+          case BVUGT_NODE:    dst = (r[op[0]] >  r[op[1]]);  break;
+          case BVULE_NODE:    dst = (r[op[0]] <= r[op[1]]);  break;
+          case BVULT_NODE:    dst = (r[op[0]] <  r[op[1]]);  break;
+          case DISTINCT_NODE: dst = (r[op[0]] != r[op[1]]);  break;
+          case EQUAL_NODE:    dst = (r[op[0]] == r[op[1]]);  break;
+
+          case BSWAP_NODE: {
+            const triton::uint512& value = r[op[0]];
+            dst = value & 0xff;
+            for (triton::uint32 index = 8; index != inst.size; index += triton::bitsize::byte) {
+              dst <<= triton::bitsize::byte;
+              dst |= ((value >> index) & 0xff);
+            }
+            break;
+          }
+
+          case CONCAT_NODE:
+            dst = r[op[0]];
+            for (triton::uint32 index = 1; index < inst.count; index++) {
+              dst = ((dst << this->sizes[op[index]]) | r[op[index]]);
+            }
+            break;
+
+          case EXTRACT_NODE:
+            dst = ((r[op[2]] >> inst.imm) & inst.mask);
+            break;
+
+          case IFF_NODE:
+            dst = ((r[op[0]] != 0) == (r[op[1]] != 0));
+            break;
+
+          case ITE_NODE:
+            dst = (r[op[0]] != 0 ? r[op[1]] : r[op[2]]);
+            break;
+
+          case LAND_NODE:
+            dst = 1;
+            for (triton::uint32 index = 0; index < inst.count && dst != 0; index++)
+              dst = (r[op[index]] != 0);
+            break;
+
+          case LOR_NODE:
+            dst = 0;
+            for (triton::uint32 index = 0; index < inst.count && dst == 0; index++)
+              dst = (r[op[index]] != 0);
+            break;
+
+          case LXOR_NODE:
+            dst = 0;
+            for (triton::uint32 index = 0; index < inst.count; index++)
+              dst = ((dst != 0) != (r[op[index]] != 0));
+            break;
+
+          case LNOT_NODE:
+            dst = (r[op[0]] == 0);
+            break;
+
+          case SX_NODE:
+            dst = (static_cast<triton::uint512>(this->signExtend(op[1])) & inst.mask);
+            break;
+
+          case ZX_NODE:
+            dst = r[op[1]];
+            break;
+
+          case VARIABLE_NODE: {
+            auto it = values.find(this->variables[inst.imm]);
+            dst = (it == values.end() ? this->defaults[inst.imm] : triton::uint512(it->second & inst.mask));
+            break;
+          }
+
+          default:
+            throw triton::exceptions::Ast("AstProgram::eval(): Invalid type node.");
+        }
+      }
+
+      return r[this->root];
+    }
+
+
+    triton::usize AstProgram::getInstructionsSize(void) const {
+      return this->instructions.size();
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
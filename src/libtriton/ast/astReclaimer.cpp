@@ -0,0 +1,128 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/astReclaimer.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* The reclaimer whose thread is the calling one, if any */
+    static thread_local AstReclaimer* reclaiming = nullptr;
+
+
+    AstReclaimer::AstReclaimer(triton::usize capacity)
+      : busy(false), stopping(false) {
+      if (capacity == 0)
+        throw triton::exceptions::Ast("AstReclaimer::AstReclaimer(): The capacity must not be null.");
+
+      this->capacity = capacity;
+      this->stalls   = 0;
+      this->thread   = std::thread(&AstReclaimer::run, this);
+    }
+
+
+    AstReclaimer::~AstReclaimer() {
+      {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->stopping = true;
+      }
+      this->ready.notify_one();
+
+      if (this->thread.joinable())
+        this->thread.join();
+    }
+
+
+    void AstReclaimer::run(void) {
+      std::vector<std::shared_ptr<void>> batch;
+      std::vector<AstArena::Block> freed;
+
+      reclaiming = this;
+      AstArena::deferDeallocations(&freed);
+
+      while (true) {
+        {
+          std::unique_lock<std::mutex> guard(this->lock);
+          this->ready.wait(guard, [this] { return this->stopping || !this->queue.empty(); });
+          if (this->queue.empty())
+            break;
+          batch.swap(this->queue);
+          this->busy = true;
+        }
+        this->done.notify_all();
+
+        /* The destructors run here, giving back their ids to `batchIds` and their blocks to `freed` */
+        batch.clear();
+
+        {
+          std::lock_guard<std::mutex> guard(this->lock);
+          this->released.insert(this->released.end(), this->batchIds.begin(), this->batchIds.end());
+          this->blocks.insert(this->blocks.end(), freed.begin(), freed.end());
+          this->busy = false;
+        }
+        this->done.notify_all();
+
+        this->batchIds.clear();
+        freed.clear();
+      }
+
+      AstArena::deferDeallocations(nullptr);
+      reclaiming = nullptr;
+    }
+
+
+    void AstReclaimer::submit(std::shared_ptr<void>&& object) {
+      std::unique_lock<std::mutex> guard(this->lock);
+
+      if (this->queue.size() >= this->capacity) {
+        this->stalls++;
+        this->done.wait(guard, [this] { return this->queue.size() < this->capacity; });
+      }
+
+      this->queue.push_back(std::move(object));
+      if (this->queue.size() == 1)
+        this->ready.notify_one();
+    }
+
+
+    bool AstReclaimer::defer(triton::uint32 id, triton::ast::ast_e type, triton::usize children) {
+      if (reclaiming != this)
+        return false;
+
+      this->batchIds.push_back({id, type, children});
+      return true;
+    }
+
+
+    void AstReclaimer::collect(std::vector<Release>& ids, std::vector<AstArena::Block>& freed) {
+      std::lock_guard<std::mutex> guard(this->lock);
+      ids.swap(this->released);
+      freed.swap(this->blocks);
+    }
+
+
+    void AstReclaimer::flush(void) {
+      std::unique_lock<std::mutex> guard(this->lock);
+      this->done.wait(guard, [this] { return this->queue.empty() && !this->busy; });
+    }
+
+
+    triton::usize AstReclaimer::getPending(void) {
+      std::lock_guard<std::mutex> guard(this->lock);
+      return this->queue.size();
+    }
+
+
+    triton::usize AstReclaimer::getStalls(void) const {
+      return this->stalls;
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
@@ -0,0 +1,569 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <utility>
+
+#include <triton/astContext.hpp>
+#include <triton/astRewriter.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* The operators of the declarative rules */
+    static const struct {
+      const char* name;
+      triton::ast::ast_e type;
+      triton::usize arity;
+      bool commutative;
+    } operators[] = {
+      {"bvadd",  BVADD_NODE,  2, true},
+      {"bvand",  BVAND_NODE,  2, true},
+      {"bvashr", BVASHR_NODE, 2, false},
+      {"bvlshr", BVLSHR_NODE, 2, false},
+      {"bvmul",  BVMUL_NODE,  2, true},
+      {"bvnand", BVNAND_NODE, 2, true},
+      {"bvneg",  BVNEG_NODE,  1, false},
+      {"bvnor",  BVNOR_NODE,  2, true},
+      {"bvnot",  BVNOT_NODE,  1, false},
+      {"bvor",   BVOR_NODE,   2, true},
+      {"bvsdiv", BVSDIV_NODE, 2, false},
+      {"bvshl",  BVSHL_NODE,  2, false},
+      {"bvsmod", BVSMOD_NODE, 2, false},
+      {"bvsrem", BVSREM_NODE, 2, false},
+      {"bvsub",  BVSUB_NODE,  2, false},
+      {"bvudiv", BVUDIV_NODE, 2, false},
+      {"bvurem", BVUREM_NODE, 2, false},
+      {"bvxnor", BVXNOR_NODE, 2, true},
+      {"bvxor",  BVXOR_NODE,  2, true},
+    };
+
+
+    static bool isCommutative(triton::ast::ast_e type) {
+      for (const auto& op : operators) {
+        if (op.type == type)
+          return op.commutative;
+      }
+      return false;
+    }
+
+
+    /* Returns a number of a pattern on the size of a node */
+    static triton::uint512 toValue(const triton::sint512& value, const SharedAbstractNode& node) {
+      triton::uint512 mask = node->getBitvectorMask();
+
+      if (value < 0)
+        return ((mask - static_cast<triton::uint512>(-value)) + 1) & mask;
+
+      return static_cast<triton::uint512>(value) & mask;
+    }
+
+
+    SharedAbstractNode AstRewriter::Memo::get(const SharedAbstractNode& node) const {
+      triton::uint32 id = node->getId();
+
+      if (id < this->results.size() && this->results[id].first.get() == node.get())
+        return this->results[id].second;
+
+      if (this->others.empty())
+        return nullptr;
+
+      auto it = this->others.find(node.get());
+      if (it == this->others.end())
+        return nullptr;
+
+      return it->second.second;
+    }
+
+
+    void AstRewriter::Memo::set(const SharedAbstractNode& node, const SharedAbstractNode& result) {
+      triton::uint32 id = node->getId();
+
+      if (id >= this->results.size())
+        this->results.resize(id + 1);
+
+      if (this->results[id].first == nullptr || this->results[id].first.get() == node.get())
+        this->results[id] = std::make_pair(node, result);
+      else
+        this->others[node.get()] = std::make_pair(node, result);
+    }
+
+
+    AstRewriter::Pattern AstRewriter::parse(const std::string& text, triton::usize& position) {
+      Pattern pattern;
+      std::string token;
+
+      pattern.type  = INVALID_NODE;
+      pattern.value = 0;
+
+      while (position < text.size() && std::isspace(static_cast<unsigned char>(text[position])))
+        position++;
+
+      if (position >= text.size())
+        throw triton::exceptions::Ast("AstRewriter::parse(): Unexpected end of pattern.");
+
+      if (text[position] == '(') {
+        position++;
+        while (position < text.size() && std::isalnum(static_cast<unsigned char>(text[position])))
+          token += text[position++];
+
+        triton::usize arity = 0;
+        for (const auto& op : operators) {
+          if (token == op.name) {
+            pattern.type = op.type;
+            arity = op.arity;
+          }
+        }
+
+        if (pattern.type == INVALID_NODE)
+          throw triton::exceptions::Ast("AstRewriter::parse(): Unknown operator \"" + token + "\".");
+
+        while (true) {
+          while (position < text.size() && std::isspace(static_cast<unsigned char>(text[position])))
+            position++;
+          if (position < text.size() && text[position] == ')')
+            break;
+          pattern.children.push_back(AstRewriter::parse(text, position));
+        }
+        position++;
+
+        if (pattern.children.size() != arity)
+          throw triton::exceptions::Ast("AstRewriter::parse(): Wrong number of operands for \"" + token + "\".");
+
+        return pattern;
+      }
+
+      while (position < text.size() && (std::isalnum(static_cast<unsigned char>(text[position])) || text[position] == '_' || text[position] == '#' || text[position] == '-'))
+        token += text[position++];
+
+      if (token.empty() || token == "#")
+        throw triton::exceptions::Ast("AstRewriter::parse(): Invalid pattern.");
+
+      /* A name */
+      if (!std::isdigit(static_cast<unsigned char>(token[0])) && token[0] != '-') {
+        pattern.name = token;
+        return pattern;
+      }
+
+      /* A number */
+      bool negative = (token[0] == '-');
+      std::string digits = token.substr(negative ? 1 : 0);
+      triton::uint32 base = 10;
+
+      if (digits.size() > 2 && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X')) {
+        digits = digits.substr(2);
+        base = 16;
+      }
+
+      if (digits.empty())
+        throw triton::exceptions::Ast("AstRewriter::parse(): Invalid number \"" + token + "\".");
+
+      for (char c : digits) {
+        if (!std::isxdigit(static_cast<unsigned char>(c)) || (base == 10 && !std::isdigit(static_cast<unsigned char>(c))))
+          throw triton::exceptions::Ast("AstRewriter::parse(): Invalid number \"" + token + "\".");
+        pattern.value = pattern.value * base + (std::isdigit(static_cast<unsigned char>(c)) ? c - '0' : std::tolower(c) - 'a' + 10);
+      }
+
+      if (negative)
+        pattern.value = -pattern.value;
+
+      return pattern;
+    }
+
+
+    bool AstRewriter::match(std::vector<std::pair<const Pattern*, SharedAbstractNode>> goals, Bindings& bindings) {
+      while (!goals.empty()) {
+        const Pattern* p = goals.back().first;
+        SharedAbstractNode n = goals.back().second;
+        goals.pop_back();
+
+        /* A number */
+        if (p->type == INVALID_NODE && p->name.empty()) {
+          if (n->isSymbolized() || n->getBitvectorSize() == 0 || n->evaluate() != toValue(p->value, n))
+            return false;
+          continue;
+        }
+
+        /* A name */
+        if (p->type == INVALID_NODE) {
+          if (p->name[0] == '#' && (n->isSymbolized() || n->getBitvectorSize() == 0))
+            return false;
+
+          bool bound = false;
+          for (const auto& binding : bindings) {
+            if (binding.first == p->name) {
+              if (binding.second != n && !binding.second->equalTo(n))
+                return false;
+              bound = true;
+              break;
+            }
+          }
+
+          if (!bound)
+            bindings.push_back({p->name, n});
+          continue;
+        }
+
+        /* An operator */
+        const auto& children = n->getChildren();
+        if (n->getType() != p->type || children.size() != p->children.size())
+          return false;
+
+        if (children.size() == 2 && isCommutative(p->type)) {
+          auto others = goals;
+          auto mark = bindings.size();
+          others.push_back({&p->children[1], children[0]});
+          others.push_back({&p->children[0], children[1]});
+          if (AstRewriter::match(std::move(others), bindings))
+            return true;
+          bindings.resize(mark);
+        }
+
+        for (triton::usize index = children.size(); index > 0; index--)
+          goals.push_back({&p->children[index - 1], children[index - 1]});
+      }
+
+      return true;
+    }
+
+
+    SharedAbstractNode AstRewriter::instantiate(const Pattern& pattern, const SharedAbstractNode& root, const Bindings& bindings) {
+      const SharedAstContext& ctxt = root->getContext();
+
+      if (pattern.type == INVALID_NODE && pattern.name.empty())
+        return ctxt->bv(toValue(pattern.value, root), root->getBitvectorSize());
+
+      if (pattern.type == INVALID_NODE) {
+        for (const auto& binding : bindings) {
+          if (binding.first == pattern.name)
+            return binding.second;
+        }
+        throw triton::exceptions::Ast("AstRewriter::instantiate(): Unbound name \"" + pattern.name + "\".");
+      }
+
+      std::vector<SharedAbstractNode> children;
+      for (const auto& child : pattern.children)
+        children.push_back(AstRewriter::instantiate(child, root, bindings));
+
+      /* Constants are folded, e.g. (bvadd #a #b) */
+      SharedAbstractNode node = ctxt->build(pattern.type, children);
+      if (node->isSymbolized() == false && node->getType() != BV_NODE)
+        return ctxt->bv(node->evaluate(), node->getBitvectorSize());
+
+      return node;
+    }
+
+
+    SharedAbstractNode AstRewriter::process(const SharedAbstractNode& root, Memo& memo, triton::usize depth) const {
+      std::vector<std::pair<SharedAbstractNode, bool>> worklist = {{root, false}};
+
+      /* Post-order without recursion, the children are rewritten before their parent */
+      while (!worklist.empty()) {
+        SharedAbstractNode node = worklist.back().first;
+
+        if (memo.get(node) != nullptr) {
+          worklist.pop_back();
+          continue;
+        }
+
+        if (worklist.back().second == false) {
+          worklist.back().second = true;
+          const auto& children = node->getChildren();
+          for (auto it = children.rbegin(); it != children.rend(); it++) {
+            if (memo.get(*it) == nullptr)
+              worklist.push_back({*it, false});
+          }
+          continue;
+        }
+
+        worklist.pop_back();
+        memo.set(node, this->apply(node, memo, depth));
+      }
+
+      return memo.get(root);
+    }
+
+
+    SharedAbstractNode AstRewriter::apply(const SharedAbstractNode& node, Memo& memo, triton::usize depth) const {
+      SharedAbstractNode current = node;
+      std::vector<SharedAbstractNode> children;
+      bool changed = false;
+
+      for (const auto& child : node->getChildren()) {
+        children.push_back(memo.get(child));
+        changed |= (children.back() != child);
+      }
+
+      if (changed)
+        current = node->getContext()->build(node->getType(), children);
+
+      auto it = this->rules.find(current->getType());
+      if (it == this->rules.end())
+        return current;
+
+      for (const auto& rule : it->second) {
+        SharedAbstractNode result = rule(current);
+        if (result == nullptr || result == current)
+          continue;
+
+        /* The nodes built by the rule are rewritten in turn */
+        if (depth >= AstRewriter::maxRewrites)
+          return result;
+
+        return this->process(result, memo, depth + 1);
+      }
+
+      return current;
+    }
+
+
+    void AstRewriter::addRule(triton::ast::ast_e type, const Rule& rule) {
+      if (rule == nullptr)
+        throw triton::exceptions::Ast("AstRewriter::addRule(): rule cannot be null.");
+
+      this->rules[type].push_back(rule);
+      this->version++;
+    }
+
+
+    void AstRewriter::addRule(const std::string& pattern, const std::string& replacement) {
+      triton::usize position = 0;
+      Pattern lhs = AstRewriter::parse(pattern, position);
+
+      if (pattern.find_first_not_of(" \t\r\n", position) != std::string::npos)
+        throw triton::exceptions::Ast("AstRewriter::addRule(): Unexpected characters after the pattern.");
+
+      position = 0;
+      Pattern rhs = AstRewriter::parse(replacement, position);
+
+      if (replacement.find_first_not_of(" \t\r\n", position) != std::string::npos)
+        throw triton::exceptions::Ast("AstRewriter::addRule(): Unexpected characters after the replacement.");
+
+      if (lhs.type == INVALID_NODE)
+        throw triton::exceptions::Ast("AstRewriter::addRule(): The pattern must be an operator.");
+
+      /* The names of the replacement must be bound by the pattern */
+      std::vector<const Pattern*> worklist = {&rhs};
+      while (!worklist.empty()) {
+        const Pattern* p = worklist.back();
+        worklist.pop_back();
+
+        if (!p->name.empty()) {
+          bool found = false;
+          std::vector<const Pattern*> others = {&lhs};
+          while (!others.empty() && !found) {
+            const Pattern* q = others.back();
+            others.pop_back();
+            found = (q->name == p->name);
+            for (const auto& child : q->children)
+              others.push_back(&child);
+          }
+          if (!found)
+            throw triton::exceptions::Ast("AstRewriter::addRule(): Unbound name \"" + p->name + "\" in the replacement.");
+        }
+
+        for (const auto& child : p->children)
+          worklist.push_back(&child);
+      }
+
+      this->addRule(lhs.type, [lhs, rhs](const SharedAbstractNode& node) -> SharedAbstractNode {
+        Bindings bindings;
+        if (!AstRewriter::match({{&lhs, node}}, bindings))
+          return nullptr;
+        return AstRewriter::instantiate(rhs, node, bindings);
+      });
+    }
+
+
+    void AstRewriter::addBuiltinRules(void) {
+      static const char* declaratives[][2] = {
+        /* Identities */
+        {"(bvadd x 0)",                                  "x"},
+        {"(bvand x 0)",                                  "0"},
+        {"(bvand x -1)",                                 "x"},
+        {"(bvand x x)",                                  "x"},
+        {"(bvand x (bvnot x))",                          "0"},
+        {"(bvmul x 0)",                                  "0"},
+        {"(bvmul x 1)",                                  "x"},
+        {"(bvneg (bvneg x))",                            "x"},
+        {"(bvnot (bvnot x))",                            "x"},
+        {"(bvor x 0)",                                   "x"},
+        {"(bvor x -1)",                                  "-1"},
+        {"(bvor x x)",                                   "x"},
+        {"(bvor x (bvnot x))",                           "-1"},
+        {"(bvsub x 0)",                                  "x"},
+        {"(bvsub x x)",                                  "0"},
+        {"(bvxor x 0)",                                  "x"},
+        {"(bvxor x x)",                                  "0"},
+        {"(bvxor x (bvnot x))",                          "-1"},
+        {"(bvadd (bvnot x) 1)",                          "(bvneg x)"},
+        {"(bvadd x (bvneg y))",                          "(bvsub x y)"},
+
+        /* MBA identities */
+        {"(bvadd (bvand x y) (bvor x y))",               "(bvadd x y)"},
+        {"(bvadd (bvand x y) (bvxor x y))",              "(bvor x y)"},
+        {"(bvadd (bvxor x y) (bvmul 2 (bvand x y)))",    "(bvadd x y)"},
+        {"(bvor (bvand x (bvnot y)) (bvand (bvnot x) y))", "(bvxor x y)"},
+        {"(bvsub (bvadd x y) (bvand x y))",              "(bvor x y)"},
+        {"(bvsub (bvadd x y) (bvmul 2 (bvand x y)))",    "(bvxor x y)"},
+        {"(bvsub (bvadd x y) (bvor x y))",               "(bvand x y)"},
+        {"(bvsub (bvmul 2 (bvor x y)) (bvxor x y))",     "(bvadd x y)"},
+        {"(bvsub (bvor x y) (bvand x y))",               "(bvxor x y)"},
+        {"(bvsub (bvor x y) (bvxor x y))",               "(bvand x y)"},
+        {"(bvsub (bvxor x y) (bvmul 2 (bvand (bvnot x) y)))", "(bvsub x y)"},
+
+        /* Constant reassociation */
+        {"(bvadd (bvadd x #a) #b)",                      "(bvadd x (bvadd #a #b))"},
+        {"(bvadd (bvsub x #a) #b)",                      "(bvadd x (bvsub #b #a))"},
+        {"(bvand (bvand x #a) #b)",                      "(bvand x (bvand #a #b))"},
+        {"(bvmul (bvmul x #a) #b)",                      "(bvmul x (bvmul #a #b))"},
+        {"(bvor (bvor x #a) #b)",                        "(bvor x (bvor #a #b))"},
+        {"(bvsub (bvadd x #a) #b)",                      "(bvadd x (bvsub #a #b))"},
+        {"(bvsub (bvsub x #a) #b)",                      "(bvsub x (bvadd #a #b))"},
+        {"(bvxor (bvxor x #a) #b)",                      "(bvxor x (bvxor #a #b))"},
+      };
+
+      for (const auto& rule : declaratives)
+        this->addRule(rule[0], rule[1]);
+
+      /* Extract fusion */
+      this->addRule(EXTRACT_NODE, [](const SharedAbstractNode& node) -> SharedAbstractNode {
+        const SharedAstContext& ctxt = node->getContext();
+        const auto& children = node->getChildren();
+        triton::uint32 high = triton::ast::getInteger<triton::uint32>(children[0]);
+        triton::uint32 low  = triton::ast::getInteger<triton::uint32>(children[1]);
+        const auto& expr    = children[2];
+
+        /* ((_ extract n-1 0) x) = x */
+        if (low == 0 && high + 1 == expr->getBitvectorSize())
+          return expr;
+
+        switch (expr->getType()) {
+          /* ((_ extract h l) ((_ extract h' l') x)) = ((_ extract h+l' l+l') x) */
+          case EXTRACT_NODE: {
+            triton::uint32 offset = triton::ast::getInteger<triton::uint32>(expr->getChildren()[1]);
+            return ctxt->extract(high + offset, low + offset, expr->getChildren()[2]);
+          }
+
+          /* Only the extracted parts of a concatenation are kept */
+          case CONCAT_NODE: {
+            std::vector<SharedAbstractNode> parts;
+            triton::uint32 offset = 0;
+            const auto& operands = expr->getChildren();
+            for (auto it = operands.rbegin(); it != operands.rend(); it++) {
+              triton::uint32 size = (*it)->getBitvectorSize();
+              if (low < offset + size && high >= offset) {
+                triton::uint32 h = std::min(high, offset + size - 1) - offset;
+                triton::uint32 l = std::max(low, offset) - offset;
+                parts.insert(parts.begin(), (l == 0 && h + 1 == size) ? *it : ctxt->extract(h, l, *it));
+              }
+              offset += size;
+            }
+            return ctxt->concat(parts);
+          }
+
+          /* The extension is dropped, or the extraction is zero */
+          case ZX_NODE: {
+            const auto& inner = expr->getChildren()[1];
+            if (high < inner->getBitvectorSize())
+              return ctxt->extract(high, low, inner);
+            if (low >= inner->getBitvectorSize())
+              return ctxt->bv(0, high - low + 1);
+            return nullptr;
+          }
+
+          default:
+            return nullptr;
+        }
+      });
+
+      /* Concat fusion */
+      this->addRule(CONCAT_NODE, [](const SharedAbstractNode& node) -> SharedAbstractNode {
+        const SharedAstContext& ctxt = node->getContext();
+        std::vector<SharedAbstractNode> parts;
+        bool changed = false;
+
+        for (const auto& child : node->getChildren()) {
+          /* Nested concatenations are flattened */
+          if (child->getType() == CONCAT_NODE) {
+            for (const auto& part : child->getChildren())
+              parts.push_back(part);
+            changed = true;
+            continue;
+          }
+
+          if (!parts.empty()) {
+            const auto& last = parts.back();
+
+            /* (concat ((_ extract h m) x) ((_ extract m-1 l) x)) = ((_ extract h l) x) */
+            if (last->getType() == EXTRACT_NODE && child->getType() == EXTRACT_NODE) {
+              const auto& lc = last->getChildren();
+              const auto& cc = child->getChildren();
+              if ((lc[2] == cc[2] || lc[2]->equalTo(cc[2])) &&
+                  triton::ast::getInteger<triton::uint32>(lc[1]) == triton::ast::getInteger<triton::uint32>(cc[0]) + 1) {
+                parts.back() = ctxt->extract(triton::ast::getInteger<triton::uint32>(lc[0]), triton::ast::getInteger<triton::uint32>(cc[1]), lc[2]);
+                changed = true;
+                continue;
+              }
+            }
+
+            /* Constants are merged */
+            if (last->getType() == BV_NODE && child->getType() == BV_NODE) {
+              triton::uint32 size = last->getBitvectorSize() + child->getBitvectorSize();
+              parts.back() = ctxt->bv((last->evaluate() << child->getBitvectorSize()) | child->evaluate(), size);
+              changed = true;
+              continue;
+            }
+          }
+
+          parts.push_back(child);
+        }
+
+        if (!changed)
+          return nullptr;
+
+        return ctxt->concat(parts);
+      });
+    }
+
+
+    void AstRewriter::clearRules(void) {
+      this->rules.clear();
+      this->version++;
+    }
+
+
+    triton::usize AstRewriter::getRulesSize(void) const {
+      triton::usize size = 0;
+
+      for (const auto& item : this->rules)
+        size += item.second.size();
+
+      return size;
+    }
+
+
+    triton::usize AstRewriter::getVersion(void) const {
+      return this->version;
+    }
+
+
+    SharedAbstractNode AstRewriter::rewrite(const SharedAbstractNode& node) const {
+      Memo memo;
+
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstRewriter::rewrite(): node cannot be null.");
+
+      return this->process(node, memo, 0);
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
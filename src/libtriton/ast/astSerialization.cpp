@@ -0,0 +1,373 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <triton/astContext.hpp>
+#include <triton/astSerialization.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* The header of the format */
+    static const char magic[4] = {'T', 'A', 'S', 'T'};
+    static const triton::uint32 version = 1;
+
+    /* The records which are not nodes, node types are never 1 or 2 */
+    static const triton::uint32 expressionRecord = 1;
+    static const triton::uint32 endRecord        = 2;
+
+
+    static void writeNumber(std::ostream& stream, triton::uint512 value) {
+      do {
+        triton::uint8 byte = static_cast<triton::uint8>(value & 0x7f);
+        value >>= 7;
+        if (value != 0)
+          byte |= 0x80;
+        stream.put(static_cast<char>(byte));
+      } while (value != 0);
+    }
+
+
+    static void writeString(std::ostream& stream, const std::string& value) {
+      writeNumber(stream, value.size());
+      stream.write(value.data(), value.size());
+    }
+
+
+    static triton::uint512 readNumber(std::istream& stream) {
+      triton::uint512 value = 0;
+      triton::uint32 shift  = 0;
+
+      while (true) {
+        int byte = stream.get();
+        if (byte == std::char_traits<char>::eof())
+          throw triton::exceptions::Ast("triton::ast::deserialize(): Unexpected end of stream.");
+
+        if (shift >= 512)
+          throw triton::exceptions::Ast("triton::ast::deserialize(): Invalid number.");
+
+        value |= (triton::uint512(byte & 0x7f) << shift);
+        shift += 7;
+
+        if ((byte & 0x80) == 0)
+          return value;
+      }
+    }
+
+
+    template <typename T> static T readNumber(std::istream& stream) {
+      triton::uint512 value = readNumber(stream);
+
+      if (value > std::numeric_limits<T>::max())
+        throw triton::exceptions::Ast("triton::ast::deserialize(): Number out of range.");
+
+      return static_cast<T>(value);
+    }
+
+
+    static std::string readString(std::istream& stream) {
+      std::string value(readNumber<triton::usize>(stream), '\0');
+
+      if (!stream.read(&value[0], value.size()))
+        throw triton::exceptions::Ast("triton::ast::deserialize(): Unexpected end of stream.");
+
+      return value;
+    }
+
+
+    static void writeExpression(std::ostream& stream, triton::engines::symbolic::SymbolicExpression* expr, const std::unordered_map<const AbstractNode*, triton::usize>& index) {
+      writeNumber(stream, expressionRecord);
+      writeNumber(stream, expr->getId());
+      writeNumber(stream, static_cast<triton::uint32>(expr->getType()));
+      writeNumber(stream, index.at(expr->getAst().get()));
+      writeNumber(stream, expr->getAddress());
+      writeNumber(stream, expr->isTainted);
+      writeString(stream, expr->getComment());
+      writeString(stream, expr->getDisassembly());
+    }
+
+
+    static void write(std::ostream& stream, const std::vector<SharedAbstractNode>& nodes, const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs) {
+      std::unordered_map<const AbstractNode*, triton::usize> index;
+      std::unordered_set<triton::usize> written;
+      std::vector<SharedAbstractNode> roots = nodes;
+
+      for (const auto& expr : exprs) {
+        if (expr == nullptr)
+          throw triton::exceptions::Ast("triton::ast::serialize(): Expression cannot be null.");
+        roots.push_back(expr->getAst());
+      }
+
+      stream.write(magic, sizeof(magic));
+      writeNumber(stream, version);
+
+      /* Children first, so that a child is known when its parent is read */
+      for (const auto& node : childrenExtraction(roots, true, true)) {
+        triton::usize position = index.size();
+
+        if (node->getType() == REFERENCE_NODE) {
+          const auto& expr = reinterpret_cast<ReferenceNode*>(node.get())->getSymbolicExpression();
+          if (written.insert(expr->getId()).second)
+            writeExpression(stream, expr.get(), index);
+          writeNumber(stream, static_cast<triton::uint32>(REFERENCE_NODE));
+          writeNumber(stream, expr->getId());
+          index[node.get()] = position;
+          continue;
+        }
+
+        writeNumber(stream, static_cast<triton::uint32>(node->getType()));
+
+        switch (node->getType()) {
+          case ARRAY_NODE: {
+            auto& memory = reinterpret_cast<ArrayNode*>(node.get())->getMemory();
+            writeNumber(stream, reinterpret_cast<ArrayNode*>(node.get())->getIndexSize());
+            writeNumber(stream, memory.size());
+            for (const auto& cell : memory.getCells()) {
+              writeNumber(stream, cell.first);
+              writeNumber(stream, cell.second);
+            }
+            break;
+          }
+
+          case INTEGER_NODE:
+            writeNumber(stream, reinterpret_cast<IntegerNode*>(node.get())->getInteger());
+            break;
+
+          case STRING_NODE:
+            writeString(stream, reinterpret_cast<StringNode*>(node.get())->getString());
+            break;
+
+          case VARIABLE_NODE: {
+            const auto& symVar = reinterpret_cast<VariableNode*>(node.get())->getSymbolicVariable();
+            writeNumber(stream, static_cast<triton::uint32>(symVar->getType()));
+            writeNumber(stream, symVar->getOrigin());
+            writeNumber(stream, symVar->getId());
+            writeNumber(stream, symVar->getSize());
+            writeString(stream, symVar->getAlias());
+            writeString(stream, symVar->getComment());
+            writeNumber(stream, node->evaluate());
+            break;
+          }
+
+          default:
+            break;
+        }
+
+        /* The children are written as distances to their parent */
+        writeNumber(stream, node->getChildren().size());
+        for (const auto& child : node->getChildren())
+          writeNumber(stream, position - index.at(child.get()));
+
+        index[node.get()] = position;
+      }
+
+      for (const auto& expr : exprs) {
+        if (written.insert(expr->getId()).second)
+          writeExpression(stream, expr.get(), index);
+      }
+
+      writeNumber(stream, endRecord);
+
+      writeNumber(stream, nodes.size());
+      for (const auto& node : nodes)
+        writeNumber(stream, index.at(node.get()));
+
+      writeNumber(stream, exprs.size());
+      for (const auto& expr : exprs)
+        writeNumber(stream, expr->getId());
+
+      if (!stream)
+        throw triton::exceptions::Ast("triton::ast::serialize(): Cannot write the stream.");
+    }
+
+
+    static void read(std::istream& stream, const SharedAstContext& ctxt, std::vector<SharedAbstractNode>& roots, std::vector<triton::engines::symbolic::SharedSymbolicExpression>& rootExprs) {
+      std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> exprs;
+      std::vector<SharedAbstractNode> nodes;
+      std::vector<SharedAbstractNode> children;
+      char header[sizeof(magic)];
+
+      if (ctxt == nullptr)
+        throw triton::exceptions::Ast("triton::ast::deserialize(): The context cannot be null.");
+
+      if (!stream.read(header, sizeof(header)) || std::memcmp(header, magic, sizeof(magic)) != 0)
+        throw triton::exceptions::Ast("triton::ast::deserialize(): Invalid header.");
+
+      if (readNumber<triton::uint32>(stream) != version)
+        throw triton::exceptions::Ast("triton::ast::deserialize(): Unsupported version.");
+
+      while (true) {
+        triton::uint32 record = readNumber<triton::uint32>(stream);
+
+        if (record == endRecord)
+          break;
+
+        if (record == expressionRecord) {
+          auto id      = readNumber<triton::usize>(stream);
+          auto type    = static_cast<triton::engines::symbolic::expression_e>(readNumber<triton::uint32>(stream));
+          auto ast     = readNumber<triton::usize>(stream);
+          auto address = readNumber<triton::uint64>(stream);
+          auto tainted = readNumber<triton::uint8>(stream);
+          auto comment = readString(stream);
+          auto disassembly = readString(stream);
+
+          if (ast >= nodes.size())
+            throw triton::exceptions::Ast("triton::ast::deserialize(): Invalid node index.");
+
+          auto expr = std::make_shared<triton::engines::symbolic::SymbolicExpression>(nodes[ast], id, type, comment);
+          expr->setAddress(address);
+          expr->writeBackDisassembly(disassembly);
+          expr->isTainted = (tainted != 0);
+          exprs[id] = expr;
+          continue;
+        }
+
+        SharedAbstractNode node = nullptr;
+        auto type = static_cast<triton::ast::ast_e>(record);
+
+        switch (type) {
+          case REFERENCE_NODE: {
+            auto it = exprs.find(readNumber<triton::usize>(stream));
+            if (it == exprs.end())
+              throw triton::exceptions::Ast("triton::ast::deserialize(): Reference to an unknown expression.");
+            nodes.push_back(ctxt->reference(it->second));
+            continue;
+          }
+
+          case ARRAY_NODE: {
+            node = ctxt->array(readNumber<triton::uint32>(stream));
+            auto& memory = reinterpret_cast<ArrayNode*>(node.get())->getMemory();
+            for (auto size = readNumber<triton::usize>(stream); size > 0; size--) {
+              auto addr = readNumber<triton::uint64>(stream);
+              memory.store(addr, readNumber<triton::uint8>(stream));
+            }
+            break;
+          }
+
+          case INTEGER_NODE:
+            node = ctxt->integer(readNumber(stream));
+            break;
+
+          case STRING_NODE:
+            node = ctxt->string(readString(stream));
+            break;
+
+          case VARIABLE_NODE: {
+            auto varType = static_cast<triton::engines::symbolic::variable_e>(readNumber<triton::uint32>(stream));
+            auto origin  = readNumber<triton::uint64>(stream);
+            auto id      = readNumber<triton::usize>(stream);
+            auto size    = readNumber<triton::uint32>(stream);
+            auto alias   = readString(stream);
+            auto comment = readString(stream);
+            auto value   = readNumber(stream);
+
+            auto symVar = std::make_shared<triton::engines::symbolic::SymbolicVariable>(varType, origin, id, size, alias);
+            symVar->setComment(comment);
+
+            /* A variable already known keeps its value */
+            bool known = (ctxt->getVariableNode(symVar->getId()) != nullptr);
+            node = ctxt->variable(symVar);
+            if (!known)
+              ctxt->updateVariable(symVar->getId(), value);
+            break;
+          }
+
+          default:
+            break;
+        }
+
+        children.clear();
+        for (auto count = readNumber<triton::usize>(stream); count > 0; count--) {
+          auto distance = readNumber<triton::usize>(stream);
+          if (distance == 0 || distance > nodes.size())
+            throw triton::exceptions::Ast("triton::ast::deserialize(): Invalid node index.");
+          children.push_back(nodes[nodes.size() - distance]);
+        }
+
+        if (node == nullptr)
+          node = ctxt->build(type, children);
+
+        nodes.push_back(node);
+      }
+
+      for (auto count = readNumber<triton::usize>(stream); count > 0; count--) {
+        auto position = readNumber<triton::usize>(stream);
+        if (position >= nodes.size())
+          throw triton::exceptions::Ast("triton::ast::deserialize(): Invalid node index.");
+        roots.push_back(nodes[position]);
+      }
+
+      for (auto count = readNumber<triton::usize>(stream); count > 0; count--) {
+        auto it = exprs.find(readNumber<triton::usize>(stream));
+        if (it == exprs.end())
+          throw triton::exceptions::Ast("triton::ast::deserialize(): Unknown expression.");
+        rootExprs.push_back(it->second);
+      }
+    }
+
+
+    void serialize(std::ostream& stream, const std::vector<SharedAbstractNode>& nodes) {
+      for (const auto& node : nodes) {
+        if (node == nullptr)
+          throw triton::exceptions::Ast("triton::ast::serialize(): Node cannot be null.");
+      }
+      write(stream, nodes, {});
+    }
+
+
+    void serialize(std::ostream& stream, const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs) {
+      write(stream, {}, exprs);
+    }
+
+
+    void serialize(std::ostream& stream, const std::vector<SharedAbstractNode>& nodes, const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs) {
+      for (const auto& node : nodes) {
+        if (node == nullptr)
+          throw triton::exceptions::Ast("triton::ast::serialize(): Node cannot be null.");
+      }
+      write(stream, nodes, exprs);
+    }
+
+
+    std::vector<SharedAbstractNode> deserializeNodes(std::istream& stream, const SharedAstContext& ctxt) {
+      std::vector<SharedAbstractNode> nodes;
+      std::vector<triton::engines::symbolic::SharedSymbolicExpression> exprs;
+
+      read(stream, ctxt, nodes, exprs);
+
+      return nodes;
+    }
+
+
+    std::vector<triton::engines::symbolic::SharedSymbolicExpression> deserializeExpressions(std::istream& stream, const SharedAstContext& ctxt) {
+      std::vector<SharedAbstractNode> nodes;
+      std::vector<triton::engines::symbolic::SharedSymbolicExpression> exprs;
+
+      read(stream, ctxt, nodes, exprs);
+
+      return exprs;
+    }
+
+
+    void deserialize(std::istream& stream, const SharedAstContext& ctxt, std::vector<SharedAbstractNode>& nodes, std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs) {
+      nodes.clear();
+      exprs.clear();
+      read(stream, ctxt, nodes, exprs);
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
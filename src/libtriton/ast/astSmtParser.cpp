@@ -0,0 +1,810 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cctype>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+#include <triton/astContext.hpp>
+#include <triton/astSmtParser.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicEnums.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /*! \class SmtLexer
+     *  \brief Splits a stream, or replays the tokens of a function body.
+     */
+    class SmtLexer {
+      private:
+        std::streambuf* buffer;
+        const std::vector<SmtToken>* tokens;
+        triton::usize position;
+        bool peeked;
+        SmtToken lookahead;
+
+        static bool isDelimiter(int c) {
+          return std::isspace(c) || c == '(' || c == ')' || c == ';' || c == '|' || c == '"';
+        }
+
+        SmtToken read(void) {
+          using traits = std::char_traits<char>;
+
+          if (this->tokens != nullptr) {
+            if (this->position < this->tokens->size())
+              return (*this->tokens)[this->position++];
+            return {SmtToken::END, ""};
+          }
+
+          /* Skips blanks and comments */
+          int c = traits::eof();
+          while ((c = this->buffer->sbumpc()) != traits::eof()) {
+            if (c == ';') {
+              while ((c = this->buffer->sbumpc()) != traits::eof() && c != '\n');
+              continue;
+            }
+            if (!std::isspace(c))
+              break;
+          }
+
+          if (c == traits::eof())
+            return {SmtToken::END, ""};
+
+          if (c == '(')
+            return {SmtToken::LPAREN, "("};
+
+          if (c == ')')
+            return {SmtToken::RPAREN, ")"};
+
+          SmtToken token = {SmtToken::ATOM, ""};
+
+          /* |quoted symbol| */
+          if (c == '|') {
+            while ((c = this->buffer->sbumpc()) != traits::eof() && c != '|')
+              token.text.push_back(static_cast<char>(c));
+            if (c == traits::eof())
+              throw triton::exceptions::Ast("SmtLexer::read(): Unterminated quoted symbol.");
+            return token;
+          }
+
+          /* "string literal", where "" is a quote */
+          if (c == '"') {
+            token.text.push_back('"');
+            while (true) {
+              if ((c = this->buffer->sbumpc()) == traits::eof())
+                throw triton::exceptions::Ast("SmtLexer::read(): Unterminated string literal.");
+              token.text.push_back(static_cast<char>(c));
+              if (c == '"' && this->buffer->sgetc() != '"')
+                break;
+              if (c == '"')
+                this->buffer->sbumpc();
+            }
+            return token;
+          }
+
+          token.text.push_back(static_cast<char>(c));
+          while ((c = this->buffer->sgetc()) != traits::eof() && !isDelimiter(c))
+            token.text.push_back(static_cast<char>(this->buffer->sbumpc()));
+
+          return token;
+        }
+
+      public:
+        SmtLexer(std::istream& stream)
+          : buffer(stream.rdbuf()), tokens(nullptr), position(0), peeked(false) {
+        }
+
+        SmtLexer(const std::vector<SmtToken>& tokens)
+          : buffer(nullptr), tokens(&tokens), position(0), peeked(false) {
+        }
+
+        const SmtToken& peek(void) {
+          if (!this->peeked) {
+            this->lookahead = this->read();
+            this->peeked = true;
+          }
+          return this->lookahead;
+        }
+
+        SmtToken next(void) {
+          if (this->peeked) {
+            this->peeked = false;
+            return std::move(this->lookahead);
+          }
+          return this->read();
+        }
+
+        void expect(SmtToken::kind_e kind) {
+          SmtToken token = this->next();
+          if (token.kind != kind)
+            throw triton::exceptions::Ast(std::string("SmtLexer::expect(): Expected '") + (kind == SmtToken::LPAREN ? "(" : ")") + "' instead of '" + token.text + "'.");
+        }
+
+        std::string atom(void) {
+          SmtToken token = this->next();
+          if (token.kind != SmtToken::ATOM)
+            throw triton::exceptions::Ast("SmtLexer::atom(): Expected a symbol instead of '" + token.text + "'.");
+          return std::move(token.text);
+        }
+
+        triton::uint32 numeral(void) {
+          std::string text = this->atom();
+          if (text.empty() || text.size() > 9 || text.find_first_not_of("0123456789") != std::string::npos)
+            throw triton::exceptions::Ast("SmtLexer::numeral(): Expected a numeral instead of '" + text + "'.");
+          return static_cast<triton::uint32>(std::stoul(text));
+        }
+
+        /* Skips the end of the current list, its '(' being read */
+        void skip(void) {
+          triton::usize depth = 1;
+          while (depth) {
+            SmtToken token = this->next();
+            if (token.kind == SmtToken::END)
+              throw triton::exceptions::Ast("SmtLexer::skip(): Unexpected end of script.");
+            if (token.kind == SmtToken::LPAREN)
+              depth++;
+            else if (token.kind == SmtToken::RPAREN)
+              depth--;
+          }
+        }
+
+        /* Reads the tokens of a whole term */
+        void capture(std::vector<SmtToken>& out) {
+          triton::usize depth = 0;
+          do {
+            SmtToken token = this->next();
+            if (token.kind == SmtToken::END || (token.kind == SmtToken::RPAREN && depth == 0))
+              throw triton::exceptions::Ast("SmtLexer::capture(): Expected a term.");
+            if (token.kind == SmtToken::LPAREN)
+              depth++;
+            else if (token.kind == SmtToken::RPAREN)
+              depth--;
+            out.push_back(std::move(token));
+          } while (depth);
+        }
+    };
+
+
+    /* A term being built: an application, a let or an annotation */
+    struct AstSmtParser::Frame {
+      enum kind_e { APPLY, LET, ANNOTATION } kind;
+
+      /* The applied function and its indices, such as (_ extract 7 0) */
+      std::string op;
+      std::vector<triton::uint32> indices;
+      std::vector<SharedAbstractNode> args;
+
+      /* The bindings of a let, and the name of the one being read */
+      std::unordered_map<std::string, SharedAbstractNode> bindings;
+      std::string name;
+      bool body;
+    };
+
+
+    /* The functions of the logic */
+    enum operator_e {
+      OP_AND, OP_BVADD, OP_BVAND, OP_BVASHR, OP_BVCOMP, OP_BVLSHR, OP_BVMUL, OP_BVNAND, OP_BVNEG,
+      OP_BVNOR, OP_BVNOT, OP_BVOR, OP_BVSDIV, OP_BVSGE, OP_BVSGT, OP_BVSHL, OP_BVSLE, OP_BVSLT,
+      OP_BVSMOD, OP_BVSREM, OP_BVSUB, OP_BVUDIV, OP_BVUGE, OP_BVUGT, OP_BVULE, OP_BVULT, OP_BVUREM,
+      OP_BVXNOR, OP_BVXOR, OP_CONCAT, OP_CONST, OP_DISTINCT, OP_EQUAL, OP_EXTRACT, OP_IFF, OP_IMPLIES,
+      OP_ITE, OP_NOT, OP_OR, OP_REPEAT, OP_ROTATE_LEFT, OP_ROTATE_RIGHT, OP_SELECT, OP_SIGN_EXTEND,
+      OP_STORE, OP_XOR, OP_ZERO_EXTEND,
+    };
+
+
+    static const std::unordered_map<std::string, operator_e> operators = {
+      {"and", OP_AND}, {"bvadd", OP_BVADD}, {"bvand", OP_BVAND}, {"bvashr", OP_BVASHR}, {"bvcomp", OP_BVCOMP},
+      {"bvlshr", OP_BVLSHR}, {"bvmul", OP_BVMUL}, {"bvnand", OP_BVNAND}, {"bvneg", OP_BVNEG}, {"bvnor", OP_BVNOR},
+      {"bvnot", OP_BVNOT}, {"bvor", OP_BVOR}, {"bvsdiv", OP_BVSDIV}, {"bvsge", OP_BVSGE}, {"bvsgt", OP_BVSGT},
+      {"bvshl", OP_BVSHL}, {"bvsle", OP_BVSLE}, {"bvslt", OP_BVSLT}, {"bvsmod", OP_BVSMOD}, {"bvsrem", OP_BVSREM},
+      {"bvsub", OP_BVSUB}, {"bvudiv", OP_BVUDIV}, {"bvuge", OP_BVUGE}, {"bvugt", OP_BVUGT}, {"bvule", OP_BVULE},
+      {"bvult", OP_BVULT}, {"bvurem", OP_BVUREM}, {"bvxnor", OP_BVXNOR}, {"bvxor", OP_BVXOR}, {"concat", OP_CONCAT},
+      {"const", OP_CONST}, {"distinct", OP_DISTINCT}, {"=", OP_EQUAL}, {"extract", OP_EXTRACT}, {"iff", OP_IFF},
+      {"=>", OP_IMPLIES}, {"ite", OP_ITE}, {"not", OP_NOT}, {"or", OP_OR}, {"repeat", OP_REPEAT},
+      {"rotate_left", OP_ROTATE_LEFT}, {"rotate_right", OP_ROTATE_RIGHT}, {"select", OP_SELECT},
+      {"sign_extend", OP_SIGN_EXTEND}, {"store", OP_STORE}, {"xor", OP_XOR}, {"zero_extend", OP_ZERO_EXTEND},
+    };
+
+
+    /* Returns the size of a bswapN function, 0 for other names */
+    static triton::uint32 bswapSize(const std::string& name) {
+      if (name.size() <= 5 || name.compare(0, 5, "bswap") != 0 || name.find_first_not_of("0123456789", 5) != std::string::npos || name.size() > 8)
+        return 0;
+      return static_cast<triton::uint32>(std::stoul(name.substr(5)));
+    }
+
+
+    AstSmtParser::AstSmtParser(const SharedAstContext& ctxt, const VariableCallback& newVariable)
+      : ctxt(ctxt), newVariable(newVariable), nextId(0) {
+    }
+
+
+    std::vector<SharedAbstractNode> AstSmtParser::parse(std::istream& stream) {
+      std::vector<SharedAbstractNode> asserts;
+      SmtLexer lexer(stream);
+
+      while (lexer.peek().kind != SmtToken::END) {
+        this->scopes.clear();
+        lexer.expect(SmtToken::LPAREN);
+        std::string command = lexer.atom();
+
+        if (command == "assert") {
+          SharedAbstractNode node = this->term(lexer);
+          if (!node->isLogical())
+            throw triton::exceptions::Ast("AstSmtParser::parse(): An assertion must be a boolean term.");
+          asserts.push_back(node);
+          lexer.expect(SmtToken::RPAREN);
+        }
+
+        else if (command == "declare-fun" || command == "declare-const") {
+          std::string name = lexer.atom();
+          if (command == "declare-fun") {
+            lexer.expect(SmtToken::LPAREN);
+            if (lexer.peek().kind != SmtToken::RPAREN)
+              throw triton::exceptions::Ast("AstSmtParser::parse(): Uninterpreted functions are not supported: " + name);
+            lexer.expect(SmtToken::RPAREN);
+          }
+          this->declare(name, this->sort(lexer));
+          lexer.expect(SmtToken::RPAREN);
+        }
+
+        else if (command == "define-fun") {
+          std::string name = lexer.atom();
+          Function function;
+
+          lexer.expect(SmtToken::LPAREN);
+          while (lexer.peek().kind == SmtToken::LPAREN) {
+            lexer.next();
+            function.params.push_back(lexer.atom());
+            function.sorts.push_back(this->sort(lexer));
+            lexer.expect(SmtToken::RPAREN);
+          }
+          lexer.expect(SmtToken::RPAREN);
+          function.sort = this->sort(lexer);
+
+          /* A constant is built once, a function at each application */
+          if (function.params.empty()) {
+            SharedAbstractNode node = this->term(lexer);
+            if (function.sort.kind == Sort::BITVEC && node->isLogical() && function.sort.size == 1)
+              node = this->ctxt->ite(node, this->ctxt->bvtrue(), this->ctxt->bvfalse());
+            this->globals[name] = node;
+          }
+          else {
+            lexer.capture(function.body);
+            this->functions[name] = std::move(function);
+          }
+          lexer.expect(SmtToken::RPAREN);
+        }
+
+        else if (command == "set-logic" || command == "set-option" || command == "set-info" || command == "check-sat" ||
+                 command == "get-model" || command == "get-value" || command == "get-info" || command == "echo" || command == "exit") {
+          lexer.skip();
+        }
+
+        else {
+          throw triton::exceptions::Ast("AstSmtParser::parse(): Unsupported command: " + command);
+        }
+      }
+
+      return asserts;
+    }
+
+
+    SharedAbstractNode AstSmtParser::parseTerm(const std::string& term) {
+      std::istringstream stream(term);
+      SmtLexer lexer(stream);
+
+      this->scopes.clear();
+      SharedAbstractNode node = this->term(lexer);
+      if (lexer.peek().kind != SmtToken::END)
+        throw triton::exceptions::Ast("AstSmtParser::parseTerm(): Unexpected tokens after the term.");
+
+      return node;
+    }
+
+
+    const std::map<std::string, triton::engines::symbolic::SharedSymbolicVariable>& AstSmtParser::getVariables(void) const {
+      return this->variables;
+    }
+
+
+    triton::engines::symbolic::SharedSymbolicVariable AstSmtParser::defaultVariable(const std::string& name, triton::uint32 size) {
+      /* Declared again by a later script */
+      auto it = this->variables.find(name);
+      if (it != this->variables.end())
+        return it->second;
+
+      /* Already known by the context */
+      try {
+        if (SharedAbstractNode node = this->ctxt->getVariableNode(name))
+          return reinterpret_cast<VariableNode*>(node.get())->getSymbolicVariable();
+      }
+      catch (const triton::exceptions::Ast&) {
+      }
+
+      auto isFree = [this](triton::usize id) {
+        try {
+          return this->ctxt->getVariableNode(id) == nullptr;
+        }
+        catch (const triton::exceptions::Ast&) {
+          return false;
+        }
+      };
+
+      /* Keeps the id of a SymVar_N name when it is free */
+      triton::usize id = 0;
+      bool named = false;
+      const std::string prefix = TRITON_SYMVAR_NAME;
+      if (name.size() > prefix.size() && name.size() < prefix.size() + 10 && name.compare(0, prefix.size(), prefix) == 0 &&
+          name.find_first_not_of("0123456789", prefix.size()) == std::string::npos) {
+        id = std::stoull(name.substr(prefix.size()));
+        named = isFree(id);
+      }
+
+      if (!named) {
+        while (!isFree(this->nextId))
+          this->nextId++;
+        id = this->nextId++;
+      }
+
+      return std::make_shared<triton::engines::symbolic::SymbolicVariable>(
+               triton::engines::symbolic::UNDEFINED_VARIABLE, 0, id, size, named ? "" : name);
+    }
+
+
+    void AstSmtParser::declare(const std::string& name, const Sort& sort) {
+      if (sort.kind == Sort::ARRAY) {
+        this->globals[name] = this->ctxt->array(sort.size);
+        return;
+      }
+
+      /* A boolean is a variable of one bit, true when set */
+      triton::uint32 size = (sort.kind == Sort::BOOL) ? 1 : sort.size;
+      auto symVar = this->newVariable ? this->newVariable(name, size) : this->defaultVariable(name, size);
+      if (symVar == nullptr || symVar->getSize() != size)
+        throw triton::exceptions::Ast("AstSmtParser::declare(): The variable of " + name + " does not have the declared size.");
+
+      SharedAbstractNode node = this->ctxt->variable(symVar);
+      this->variables[name] = symVar;
+
+      if (sort.kind == Sort::BOOL)
+        node = this->ctxt->equal(node, this->ctxt->bvtrue());
+
+      this->globals[name] = node;
+    }
+
+
+    AstSmtParser::Sort AstSmtParser::sort(SmtLexer& lexer) {
+      SmtToken token = lexer.next();
+
+      if (token.kind == SmtToken::ATOM && token.text == "Bool")
+        return {Sort::BOOL, 0};
+
+      if (token.kind == SmtToken::LPAREN) {
+        std::string head = lexer.atom();
+
+        if (head == "_" && lexer.atom() == "BitVec") {
+          triton::uint32 size = lexer.numeral();
+          lexer.expect(SmtToken::RPAREN);
+          if (size == 0 || size > triton::bitsize::max_supported)
+            throw triton::exceptions::Ast("AstSmtParser::sort(): Unsupported bitvector size.");
+          return {Sort::BITVEC, size};
+        }
+
+        if (head == "Array") {
+          Sort index = this->sort(lexer);
+          Sort value = this->sort(lexer);
+          lexer.expect(SmtToken::RPAREN);
+          if (index.kind != Sort::BITVEC || value.kind != Sort::BITVEC || value.size != triton::bitsize::byte)
+            throw triton::exceptions::Ast("AstSmtParser::sort(): Only the arrays of bytes indexed by bitvectors are supported.");
+          return {Sort::ARRAY, index.size};
+        }
+      }
+
+      throw triton::exceptions::Ast("AstSmtParser::sort(): Unsupported sort.");
+    }
+
+
+    SharedAbstractNode AstSmtParser::term(SmtLexer& lexer) {
+      std::vector<Frame> stack;
+      SharedAbstractNode value;
+
+      while (true) {
+        /* Reads a leaf, or opens a frame */
+        SmtToken token = lexer.next();
+
+        if (token.kind == SmtToken::ATOM) {
+          value = this->atom(token.text);
+        }
+
+        else if (token.kind == SmtToken::LPAREN) {
+          SmtToken head = lexer.next();
+          Frame frame = {Frame::APPLY, "", {}, {}, {}, "", false};
+
+          /* (_ bvN size) */
+          if (head.kind == SmtToken::ATOM && head.text == "_") {
+            std::string literal = lexer.atom();
+            triton::uint32 size = lexer.numeral();
+            lexer.expect(SmtToken::RPAREN);
+
+            if (literal.size() <= 2 || literal.compare(0, 2, "bv") != 0 || literal.find_first_not_of("0123456789", 2) != std::string::npos)
+              throw triton::exceptions::Ast("AstSmtParser::term(): Unsupported indexed constant: " + literal);
+            if (size == 0 || size > triton::bitsize::max_supported)
+              throw triton::exceptions::Ast("AstSmtParser::term(): Unsupported bitvector size.");
+
+            triton::uint512 v = 0;
+            for (triton::usize i = 2; i < literal.size(); i++)
+              v = v * 10 + (literal[i] - '0');
+            value = this->ctxt->bv(v, size);
+          }
+
+          /* ((_ extract 7 0) e) or ((as const (Array ...)) e) */
+          else if (head.kind == SmtToken::LPAREN) {
+            std::string kind = lexer.atom();
+            if (kind == "_") {
+              frame.op = lexer.atom();
+              while (lexer.peek().kind != SmtToken::RPAREN)
+                frame.indices.push_back(lexer.numeral());
+              lexer.expect(SmtToken::RPAREN);
+            }
+            else if (kind == "as" && lexer.atom() == "const") {
+              Sort array = this->sort(lexer);
+              lexer.expect(SmtToken::RPAREN);
+              if (array.kind != Sort::ARRAY)
+                throw triton::exceptions::Ast("AstSmtParser::term(): A constant array must have an array sort.");
+              frame.op = "const";
+              frame.indices.push_back(array.size);
+            }
+            else {
+              throw triton::exceptions::Ast("AstSmtParser::term(): Unsupported function: " + kind);
+            }
+            stack.push_back(std::move(frame));
+          }
+
+          else if (head.kind == SmtToken::ATOM && head.text == "let") {
+            lexer.expect(SmtToken::LPAREN);
+            lexer.expect(SmtToken::LPAREN);
+            frame.kind = Frame::LET;
+            frame.name = lexer.atom();
+            stack.push_back(std::move(frame));
+          }
+
+          else if (head.kind == SmtToken::ATOM && head.text == "!") {
+            frame.kind = Frame::ANNOTATION;
+            stack.push_back(std::move(frame));
+          }
+
+          else if (head.kind == SmtToken::ATOM && (head.text == "forall" || head.text == "exists")) {
+            throw triton::exceptions::Ast("AstSmtParser::term(): Quantifiers are not supported.");
+          }
+
+          else if (head.kind == SmtToken::ATOM) {
+            frame.op = std::move(head.text);
+            stack.push_back(std::move(frame));
+          }
+
+          else {
+            throw triton::exceptions::Ast("AstSmtParser::term(): Unexpected '" + head.text + "'.");
+          }
+        }
+
+        else {
+          throw triton::exceptions::Ast("AstSmtParser::term(): Unexpected '" + token.text + "'.");
+        }
+
+        /* Gives the value to the frames it completes */
+        while (value != nullptr) {
+          if (stack.empty())
+            return value;
+
+          Frame& top = stack.back();
+          switch (top.kind) {
+            case Frame::APPLY:
+              top.args.push_back(std::move(value));
+              value = nullptr;
+              if (lexer.peek().kind == SmtToken::RPAREN) {
+                lexer.next();
+                value = this->apply(top);
+                stack.pop_back();
+              }
+              break;
+
+            case Frame::LET:
+              if (!top.body) {
+                top.bindings[top.name] = std::move(value);
+                value = nullptr;
+                lexer.expect(SmtToken::RPAREN);
+                if (lexer.peek().kind == SmtToken::LPAREN) {
+                  lexer.next();
+                  top.name = lexer.atom();
+                }
+                else {
+                  lexer.expect(SmtToken::RPAREN);
+                  this->scopes.push_back(std::move(top.bindings));
+                  top.body = true;
+                }
+              }
+              else {
+                this->scopes.pop_back();
+                lexer.expect(SmtToken::RPAREN);
+                stack.pop_back();
+              }
+              break;
+
+            case Frame::ANNOTATION:
+              lexer.skip();
+              stack.pop_back();
+              break;
+          }
+        }
+      }
+    }
+
+
+    SharedAbstractNode AstSmtParser::atom(const std::string& text) {
+      for (auto it = this->scopes.rbegin(); it != this->scopes.rend(); it++) {
+        auto binding = it->find(text);
+        if (binding != it->end())
+          return binding->second;
+      }
+
+      auto global = this->globals.find(text);
+      if (global != this->globals.end())
+        return global->second;
+
+      if (text == "true")
+        return this->ctxt->equal(this->ctxt->bvtrue(), this->ctxt->bvtrue());
+
+      if (text == "false")
+        return this->ctxt->equal(this->ctxt->bvtrue(), this->ctxt->bvfalse());
+
+      /* #b0101 and #x0f */
+      if (text.size() > 2 && text[0] == '#' && (text[1] == 'b' || text[1] == 'x')) {
+        triton::uint32 bits = (text[1] == 'b') ? 1 : 4;
+        triton::uint32 size = static_cast<triton::uint32>(text.size() - 2) * bits;
+        triton::uint512 v = 0;
+
+        if (size > triton::bitsize::max_supported)
+          throw triton::exceptions::Ast("AstSmtParser::atom(): Unsupported bitvector size.");
+
+        for (triton::usize i = 2; i < text.size(); i++) {
+          char c = static_cast<char>(std::tolower(text[i]));
+          triton::uint32 digit = 0;
+          if (c >= '0' && c <= '9')
+            digit = c - '0';
+          else if (bits == 4 && c >= 'a' && c <= 'f')
+            digit = c - 'a' + 10;
+          else
+            throw triton::exceptions::Ast("AstSmtParser::atom(): Invalid literal: " + text);
+          if (digit >> bits)
+            throw triton::exceptions::Ast("AstSmtParser::atom(): Invalid literal: " + text);
+          v = (v << bits) | digit;
+        }
+
+        return this->ctxt->bv(v, size);
+      }
+
+      /* The variables of the context may be used undeclared */
+      if (SharedAbstractNode node = this->ctxt->getVariableNode(text))
+        return node;
+
+      throw triton::exceptions::Ast("AstSmtParser::atom(): Unknown symbol: " + text);
+    }
+
+
+    SharedAbstractNode AstSmtParser::expand(const std::string& name, const Function& function, std::vector<SharedAbstractNode>& args) {
+      if (args.size() != function.params.size())
+        throw triton::exceptions::Ast("AstSmtParser::expand(): Wrong number of arguments for " + name);
+
+      /* The bswapN functions of the SMT representation */
+      triton::uint32 size = bswapSize(name);
+      if (size && size % triton::bitsize::byte == 0 && args.size() == 1 && function.sorts[0].kind == Sort::BITVEC &&
+          function.sorts[0].size == size && !args[0]->isLogical() && args[0]->getBitvectorSize() == size) {
+        return this->ctxt->bswap(args[0]);
+      }
+
+      /* The body only sees the parameters and the globals */
+      std::unordered_map<std::string, SharedAbstractNode> bindings;
+      for (triton::usize i = 0; i < args.size(); i++)
+        bindings[function.params[i]] = args[i];
+
+      auto outer = std::move(this->scopes);
+      this->scopes.clear();
+      this->scopes.push_back(std::move(bindings));
+
+      SmtLexer lexer(function.body);
+      SharedAbstractNode node = this->term(lexer);
+
+      this->scopes = std::move(outer);
+      return node;
+    }
+
+
+    SharedAbstractNode AstSmtParser::apply(Frame& frame) {
+      auto& args = frame.args;
+      auto& c = this->ctxt;
+
+      if (frame.indices.empty()) {
+        auto function = this->functions.find(frame.op);
+        if (function != this->functions.end())
+          return this->expand(frame.op, function->second, args);
+      }
+
+      auto it = operators.find(frame.op);
+      if (it == operators.end()) {
+        /* bswapN used without its definition */
+        triton::uint32 size = bswapSize(frame.op);
+        if (size && args.size() == 1 && frame.indices.empty() && !args[0]->isLogical() && args[0]->getBitvectorSize() == size)
+          return c->bswap(args[0]);
+        throw triton::exceptions::Ast("AstSmtParser::apply(): Unknown function: " + frame.op);
+      }
+
+      auto arity = [&](triton::usize args_, triton::usize indices) {
+        if (args.size() != args_ || frame.indices.size() != indices)
+          throw triton::exceptions::Ast("AstSmtParser::apply(): Wrong number of arguments for " + frame.op);
+      };
+
+      /* The left-associative operators */
+      auto fold = [&](SharedAbstractNode (AstContext::*op)(const SharedAbstractNode&, const SharedAbstractNode&)) {
+        if (args.size() < 2 || !frame.indices.empty())
+          throw triton::exceptions::Ast("AstSmtParser::apply(): Wrong number of arguments for " + frame.op);
+        SharedAbstractNode node = ((*c).*op)(args[0], args[1]);
+        for (triton::usize i = 2; i < args.size(); i++)
+          node = ((*c).*op)(node, args[i]);
+        return node;
+      };
+
+      auto binary = [&](SharedAbstractNode (AstContext::*op)(const SharedAbstractNode&, const SharedAbstractNode&)) {
+        arity(2, 0);
+        return ((*c).*op)(args[0], args[1]);
+      };
+
+      switch (it->second) {
+        case OP_BVADD:    return fold(&AstContext::bvadd);
+        case OP_BVAND:    return fold(&AstContext::bvand);
+        case OP_BVMUL:    return fold(&AstContext::bvmul);
+        case OP_BVOR:     return fold(&AstContext::bvor);
+        case OP_BVSUB:    return fold(&AstContext::bvsub);
+        case OP_BVXOR:    return fold(&AstContext::bvxor);
+        case OP_BVASHR:   return binary(&AstContext::bvashr);
+        case OP_BVLSHR:   return binary(&AstContext::bvlshr);
+        case OP_BVNAND:   return binary(&AstContext::bvnand);
+        case OP_BVNOR:    return binary(&AstContext::bvnor);
+        case OP_BVSDIV:   return binary(&AstContext::bvsdiv);
+        case OP_BVSGE:    return binary(&AstContext::bvsge);
+        case OP_BVSGT:    return binary(&AstContext::bvsgt);
+        case OP_BVSHL:    return binary(&AstContext::bvshl);
+        case OP_BVSLE:    return binary(&AstContext::bvsle);
+        case OP_BVSLT:    return binary(&AstContext::bvslt);
+        case OP_BVSMOD:   return binary(&AstContext::bvsmod);
+        case OP_BVSREM:   return binary(&AstContext::bvsrem);
+        case OP_BVUDIV:   return binary(&AstContext::bvudiv);
+        case OP_BVUGE:    return binary(&AstContext::bvuge);
+        case OP_BVUGT:    return binary(&AstContext::bvugt);
+        case OP_BVULE:    return binary(&AstContext::bvule);
+        case OP_BVULT:    return binary(&AstContext::bvult);
+        case OP_BVUREM:   return binary(&AstContext::bvurem);
+        case OP_BVXNOR:   return binary(&AstContext::bvxnor);
+        case OP_IFF:      return binary(&AstContext::iff);
+        case OP_SELECT:   return binary(&AstContext::select);
+
+        case OP_BVNEG:
+          arity(1, 0);
+          return c->bvneg(args[0]);
+
+        case OP_BVNOT:
+          arity(1, 0);
+          return c->bvnot(args[0]);
+
+        case OP_NOT:
+          arity(1, 0);
+          return c->lnot(args[0]);
+
+        case OP_BVCOMP:
+          arity(2, 0);
+          return c->ite(c->equal(args[0], args[1]), c->bv(1, 1), c->bv(0, 1));
+
+        case OP_AND:
+        case OP_OR:
+        case OP_XOR:
+          if (args.empty() || !frame.indices.empty())
+            throw triton::exceptions::Ast("AstSmtParser::apply(): Wrong number of arguments for " + frame.op);
+          if (args.size() == 1)
+            return args[0];
+          if (it->second == OP_AND)
+            return c->land(args);
+          if (it->second == OP_OR)
+            return c->lor(args);
+          return c->lxor(args);
+
+        case OP_IMPLIES: {
+          /* Right-associative */
+          if (args.size() < 2 || !frame.indices.empty())
+            throw triton::exceptions::Ast("AstSmtParser::apply(): Wrong number of arguments for " + frame.op);
+          SharedAbstractNode node = args.back();
+          for (triton::usize i = args.size() - 1; i-- > 0;)
+            node = c->lor(c->lnot(args[i]), node);
+          return node;
+        }
+
+        case OP_EQUAL:
+        case OP_DISTINCT: {
+          if (args.size() < 2 || !frame.indices.empty())
+            throw triton::exceptions::Ast("AstSmtParser::apply(): Wrong number of arguments for " + frame.op);
+          std::vector<SharedAbstractNode> pairs;
+          for (triton::usize i = 0; i < args.size(); i++) {
+            for (triton::usize j = i + 1; j < args.size(); j++) {
+              if (it->second == OP_DISTINCT)
+                pairs.push_back(c->distinct(args[i], args[j]));
+              /* = is chainable, a boolean equality is an iff */
+              else if (j == i + 1)
+                pairs.push_back(args[i]->isLogical() ? c->iff(args[i], args[j]) : c->equal(args[i], args[j]));
+            }
+          }
+          return (pairs.size() == 1) ? pairs[0] : c->land(pairs);
+        }
+
+        case OP_ITE:
+          arity(3, 0);
+          return c->ite(args[0], args[1], args[2]);
+
+        case OP_CONCAT:
+          if (args.size() < 2 || !frame.indices.empty())
+            throw triton::exceptions::Ast("AstSmtParser::apply(): Wrong number of arguments for " + frame.op);
+          return c->concat(args);
+
+        case OP_STORE:
+          arity(3, 0);
+          return c->store(args[0], args[1], args[2]);
+
+        case OP_CONST:
+          arity(1, 1);
+          if (!args[0]->isSymbolized() && args[0]->evaluate() == 0)
+            return c->array(frame.indices[0]);
+          throw triton::exceptions::Ast("AstSmtParser::apply(): Only the constant arrays of zeros are supported.");
+
+        case OP_EXTRACT:
+          arity(1, 2);
+          return c->extract(frame.indices[0], frame.indices[1], args[0]);
+
+        case OP_ZERO_EXTEND:
+          arity(1, 1);
+          return frame.indices[0] ? c->zx(frame.indices[0], args[0]) : args[0];
+
+        case OP_SIGN_EXTEND:
+          arity(1, 1);
+          return frame.indices[0] ? c->sx(frame.indices[0], args[0]) : args[0];
+
+        case OP_ROTATE_LEFT:
+          arity(1, 1);
+          return c->bvrol(args[0], frame.indices[0] % args[0]->getBitvectorSize());
+
+        case OP_ROTATE_RIGHT:
+          arity(1, 1);
+          return c->bvror(args[0], frame.indices[0] % args[0]->getBitvectorSize());
+
+        case OP_REPEAT: {
+          arity(1, 1);
+          if (frame.indices[0] == 0)
+            throw triton::exceptions::Ast("AstSmtParser::apply(): repeat needs a positive index.");
+          if (frame.indices[0] == 1)
+            return args[0];
+          std::vector<SharedAbstractNode> copies(frame.indices[0], args[0]);
+          return c->concat(copies);
+        }
+      }
+
+      throw triton::exceptions::Ast("AstSmtParser::apply(): Unknown function: " + frame.op);
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
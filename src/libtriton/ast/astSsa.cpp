@@ -0,0 +1,385 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <triton/astContext.hpp>
+#include <triton/astSsa.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* Returns the mnemonic of an operation */
+    static const char* getMnemonic(triton::ast::ast_e type) {
+      switch (type) {
+        case ASSERT_NODE:     return "assert";
+        case BSWAP_NODE:      return "bswap";
+        case BVADD_NODE:      return "bvadd";
+        case BVAND_NODE:      return "bvand";
+        case BVASHR_NODE:     return "bvashr";
+        case BVLSHR_NODE:     return "bvlshr";
+        case BVMUL_NODE:      return "bvmul";
+        case BVNAND_NODE:     return "bvnand";
+        case BVNEG_NODE:      return "bvneg";
+        case BVNOR_NODE:      return "bvnor";
+        case BVNOT_NODE:      return "bvnot";
+        case BVOR_NODE:       return "bvor";
+        case BVROL_NODE:      return "bvrol";
+        case BVROR_NODE:      return "bvror";
+        case BVSDIV_NODE:     return "bvsdiv";
+        case BVSGE_NODE:      return "bvsge";
+        case BVSGT_NODE:      return "bvsgt";
+        case BVSHL_NODE:      return "bvshl";
+        case BVSLE_NODE:      return "bvsle";
+        case BVSLT_NODE:      return "bvslt";
+        case BVSMOD_NODE:     return "bvsmod";
+        case BVSREM_NODE:     return "bvsrem";
+        case BVSUB_NODE:      return "bvsub";
+        case BVUDIV_NODE:     return "bvudiv";
+        case BVUGE_NODE:      return "bvuge";
+        case BVUGT_NODE:      return "bvugt";
+        case BVULE_NODE:      return "bvule";
+        case BVULT_NODE:      return "bvult";
+        case BVUREM_NODE:     return "bvurem";
+        case BVXNOR_NODE:     return "bvxnor";
+        case BVXOR_NODE:      return "bvxor";
+        case BV_NODE:         return "bv";
+        case COMPOUND_NODE:   return "compound";
+        case CONCAT_NODE:     return "concat";
+        case DECLARE_NODE:    return "declare";
+        case DISTINCT_NODE:   return "distinct";
+        case EQUAL_NODE:      return "equal";
+        case EXTRACT_NODE:    return "extract";
+        case FORALL_NODE:     return "forall";
+        case IFF_NODE:        return "iff";
+        case INTEGER_NODE:    return "integer";
+        case ITE_NODE:        return "ite";
+        case LAND_NODE:       return "land";
+        case LET_NODE:        return "let";
+        case LNOT_NODE:       return "lnot";
+        case LOR_NODE:        return "lor";
+        case LXOR_NODE:       return "lxor";
+        case SELECT_NODE:     return "select";
+        case STORE_NODE:      return "store";
+        case STRING_NODE:     return "string";
+        case SX_NODE:         return "sx";
+        case VARIABLE_NODE:   return "variable";
+        case ZX_NODE:         return "zx";
+        default:              return "invalid";
+      }
+    }
+
+
+    SsaTrace::SsaTrace(const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs) {
+      std::unordered_map<const AbstractNode*, triton::uint32> values;
+      std::vector<AbstractNode*> roots;
+
+      for (const auto& expr : exprs) {
+        if (expr == nullptr)
+          throw triton::exceptions::Ast("SsaTrace::SsaTrace(): Expression cannot be null.");
+        roots.push_back(expr->getAst().get());
+      }
+
+      this->convert(roots, values);
+
+      for (const auto& expr : exprs) {
+        if (this->index.find(expr->getId()) != this->index.end())
+          continue;
+
+        Definition def;
+        def.id      = expr->getId();
+        def.value   = values.at(expr->getAst().get());
+        def.type    = expr->getType();
+        def.origin  = 0;
+        def.address = expr->getAddress();
+
+        if (expr->getType() == triton::engines::symbolic::REGISTER_EXPRESSION)
+          def.origin = expr->getOriginRegister().getId();
+        else if (expr->getType() == triton::engines::symbolic::MEMORY_EXPRESSION)
+          def.origin = expr->getOriginMemory().getAddress();
+
+        this->index[def.id] = this->definitions.size();
+        this->definitions.push_back(def);
+      }
+    }
+
+
+    SsaTrace::SsaTrace(const std::vector<SharedAbstractNode>& nodes) {
+      std::unordered_map<const AbstractNode*, triton::uint32> values;
+      std::vector<AbstractNode*> roots;
+
+      for (const auto& node : nodes) {
+        if (node == nullptr)
+          throw triton::exceptions::Ast("SsaTrace::SsaTrace(): Node cannot be null.");
+        roots.push_back(node.get());
+      }
+
+      this->convert(roots, values);
+    }
+
+
+    void SsaTrace::convert(const std::vector<AbstractNode*>& roots, std::unordered_map<const AbstractNode*, triton::uint32>& values) {
+      /*
+       * Children go before parents, references are followed. As for AstProgram,
+       * the visit stamps of the context are not used. A BV_NODE is a leaf, its
+       * integer children being held by its constant.
+       */
+      std::vector<AbstractNode*> order;
+      std::unordered_set<const AbstractNode*> visited;
+      std::vector<std::pair<AbstractNode*, bool>> worklist;
+
+      for (auto it = roots.rbegin(); it != roots.rend(); it++)
+        worklist.push_back({*it, false});
+
+      while (!worklist.empty()) {
+        auto item = worklist.back();
+        worklist.pop_back();
+
+        if (item.second) {
+          order.push_back(item.first);
+          continue;
+        }
+
+        if (!visited.insert(item.first).second)
+          continue;
+
+        worklist.push_back({item.first, true});
+        if (item.first->getType() == REFERENCE_NODE) {
+          AbstractNode* ast = reinterpret_cast<ReferenceNode*>(item.first)->getSymbolicExpression()->getAst().get();
+          if (visited.find(ast) == visited.end())
+            worklist.push_back({ast, false});
+          continue;
+        }
+
+        if (item.first->getType() == BV_NODE)
+          continue;
+
+        const auto& children = item.first->getChildren();
+        for (auto it = children.rbegin(); it != children.rend(); it++) {
+          if (visited.find(it->get()) == visited.end())
+            worklist.push_back({it->get(), false});
+        }
+      }
+
+      for (AbstractNode* current : order) {
+
+        /* A reference shares the value of its expression */
+        if (current->getType() == REFERENCE_NODE) {
+          values[current] = values.at(reinterpret_cast<ReferenceNode*>(current)->getSymbolicExpression()->getAst().get());
+          continue;
+        }
+
+        Operation op;
+        op.type  = current->getType();
+        op.size  = current->getBitvectorSize();
+        op.first = static_cast<triton::uint32>(this->operands.size());
+        op.count = 0;
+        op.imm   = 0;
+
+        switch (op.type) {
+          case ARRAY_NODE:
+            throw triton::exceptions::Ast("SsaTrace::convert(): Arrays cannot be converted.");
+
+          case BV_NODE:
+            op.imm = static_cast<triton::uint32>(this->constants.size());
+            this->constants.push_back(current->evaluate());
+            break;
+
+          case INTEGER_NODE:
+            op.imm = static_cast<triton::uint32>(this->constants.size());
+            this->constants.push_back(reinterpret_cast<IntegerNode*>(current)->getInteger());
+            break;
+
+          case STRING_NODE:
+            op.imm = static_cast<triton::uint32>(this->strings.size());
+            this->strings.push_back(reinterpret_cast<StringNode*>(current)->getString());
+            break;
+
+          case VARIABLE_NODE:
+            op.imm = static_cast<triton::uint32>(this->variables.size());
+            this->variables.push_back(reinterpret_cast<VariableNode*>(current)->getSymbolicVariable());
+            break;
+
+          default:
+            op.count = static_cast<triton::uint32>(current->getChildren().size());
+            for (const auto& child : current->getChildren())
+              this->operands.push_back(values.at(child.get()));
+            break;
+        }
+
+        values[current] = static_cast<triton::uint32>(this->operations.size());
+        this->operations.push_back(op);
+      }
+    }
+
+
+    const std::vector<SsaTrace::Operation>& SsaTrace::getOperations(void) const {
+      return this->operations;
+    }
+
+
+    const std::vector<triton::uint32>& SsaTrace::getOperands(void) const {
+      return this->operands;
+    }
+
+
+    const std::vector<SsaTrace::Definition>& SsaTrace::getDefinitions(void) const {
+      return this->definitions;
+    }
+
+
+    const triton::uint512& SsaTrace::getConstant(triton::uint32 value) const {
+      if (value >= this->operations.size() || (this->operations[value].type != BV_NODE && this->operations[value].type != INTEGER_NODE))
+        throw triton::exceptions::Ast("SsaTrace::getConstant(): The value is not a constant.");
+      return this->constants[this->operations[value].imm];
+    }
+
+
+    const triton::engines::symbolic::SharedSymbolicVariable& SsaTrace::getVariable(triton::uint32 value) const {
+      if (value >= this->operations.size() || this->operations[value].type != VARIABLE_NODE)
+        throw triton::exceptions::Ast("SsaTrace::getVariable(): The value is not a variable.");
+      return this->variables[this->operations[value].imm];
+    }
+
+
+    triton::uint32 SsaTrace::getValue(triton::usize id) const {
+      auto it = this->index.find(id);
+      if (it == this->index.end())
+        throw triton::exceptions::Ast("SsaTrace::getValue(): The expression is not defined by the trace.");
+      return this->definitions[it->second].value;
+    }
+
+
+    std::vector<triton::uint32> SsaTrace::getSlice(triton::uint32 value) const {
+      std::vector<triton::uint32> slice;
+
+      if (value >= this->operations.size())
+        throw triton::exceptions::Ast("SsaTrace::getSlice(): Invalid value.");
+
+      /* The operands are lower values, one backward sweep is enough */
+      std::vector<bool> marked(value + 1, false);
+      marked[value] = true;
+
+      for (triton::uint32 v = value + 1; v-- > 0;) {
+        if (!marked[v])
+          continue;
+        const Operation& op = this->operations[v];
+        for (triton::uint32 i = 0; i < op.count; i++)
+          marked[this->operands[op.first + i]] = true;
+      }
+
+      for (triton::uint32 v = 0; v <= value; v++) {
+        if (marked[v])
+          slice.push_back(v);
+      }
+
+      return slice;
+    }
+
+
+    SharedAbstractNode SsaTrace::getAst(const SharedAstContext& ctxt, triton::uint32 value) const {
+      std::unordered_map<triton::uint32, SharedAbstractNode> nodes;
+      std::vector<SharedAbstractNode> children;
+
+      if (ctxt == nullptr)
+        throw triton::exceptions::Ast("SsaTrace::getAst(): The context cannot be null.");
+
+      for (triton::uint32 v : this->getSlice(value)) {
+        const Operation& op = this->operations[v];
+
+        switch (op.type) {
+          case BV_NODE:
+            nodes[v] = ctxt->bv(this->constants[op.imm], op.size);
+            break;
+
+          case INTEGER_NODE:
+            nodes[v] = ctxt->integer(this->constants[op.imm]);
+            break;
+
+          case STRING_NODE:
+            nodes[v] = ctxt->string(this->strings[op.imm]);
+            break;
+
+          case VARIABLE_NODE:
+            nodes[v] = ctxt->variable(this->variables[op.imm]);
+            break;
+
+          default:
+            children.clear();
+            for (triton::uint32 i = 0; i < op.count; i++)
+              children.push_back(nodes.at(this->operands[op.first + i]));
+            nodes[v] = ctxt->build(op.type, children);
+            break;
+        }
+      }
+
+      return nodes.at(value);
+    }
+
+
+    triton::usize SsaTrace::getMemoryUsage(void) const {
+      triton::usize size = sizeof(SsaTrace);
+
+      size += this->operations.capacity() * sizeof(Operation);
+      size += this->operands.capacity() * sizeof(triton::uint32);
+      size += this->constants.capacity() * sizeof(triton::uint512);
+      size += this->strings.capacity() * sizeof(std::string);
+      size += this->variables.capacity() * sizeof(triton::engines::symbolic::SharedSymbolicVariable);
+      size += this->definitions.capacity() * sizeof(Definition);
+      size += this->index.size() * (sizeof(triton::usize) * 2 + sizeof(void*));
+
+      for (const auto& str : this->strings)
+        size += str.capacity();
+
+      return size;
+    }
+
+
+    std::ostream& operator<<(std::ostream& stream, const SsaTrace& trace) {
+      const auto& operations = trace.getOperations();
+      const auto& operands   = trace.getOperands();
+
+      for (triton::uint32 v = 0; v < operations.size(); v++) {
+        const auto& op = operations[v];
+
+        stream << "%" << v << " = " << getMnemonic(op.type);
+        switch (op.type) {
+          case BV_NODE:
+          case INTEGER_NODE:
+            stream << " 0x" << std::hex << trace.getConstant(v) << std::dec;
+            break;
+
+          case VARIABLE_NODE:
+            stream << " " << trace.getVariable(v)->getName();
+            break;
+
+          default:
+            for (triton::uint32 i = 0; i < op.count; i++)
+              stream << (i ? ", %" : " %") << operands[op.first + i];
+            break;
+        }
+        if (op.size)
+          stream << " : " << op.size;
+        stream << std::endl;
+      }
+
+      for (const auto& def : trace.getDefinitions())
+        stream << "ref!" << def.id << " = %" << def.value << std::endl;
+
+      return stream;
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
@@ -42,11 +42,12 @@ namespace triton {
 
 
     BitwuzlaTerm TritonToBitwuzla::convert(const SharedAbstractNode& node, Bitwuzla* bzla) {
-      auto nodes = childrenExtraction(node, true /* unroll*/, true /* revert */);
-
-      for (auto&& n : nodes) {
+      /* Streamed in topological order, children first */
+      TopologicalSort sort;
+      sort.visit({node.get()}, true /* unroll */, [&](AbstractNode* current) {
+        const SharedAbstractNode n = current->shared_from_this();
         this->translatedNodes[n] = translate(n, bzla);
-      }
+      });
 
       return this->translatedNodes.at(node);
     }
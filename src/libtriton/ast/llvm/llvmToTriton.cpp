@@ -23,6 +23,17 @@ namespace triton {
 
 
     triton::ast::SharedAbstractNode LLVMToTriton::do_convert(llvm::Value* value) {
+      auto it = this->values.find(value);
+      if (it != this->values.end())
+        return it->second;
+
+      auto node = this->convertValue(value);
+      this->values[value] = node;
+      return node;
+    }
+
+
+    triton::ast::SharedAbstractNode LLVMToTriton::convertValue(llvm::Value* value) {
       llvm::Argument* argument       = llvm::dyn_cast_or_null<llvm::Argument>(value);
       llvm::CallInst* call           = llvm::dyn_cast_or_null<llvm::CallInst>(value);
       llvm::ConstantInt* constant    = llvm::dyn_cast_or_null<llvm::ConstantInt>(value);
@@ -276,12 +287,14 @@ namespace triton {
       /* Get the return of the function */
       llvm::Instruction* returnInstruction = entryBlock.getTerminator();
 
-      /* Let's convert everything */
+      /* Let's convert everything, the values of another function or module are not reachable */
+      this->values.clear();
       return this->do_convert(returnInstruction);
     }
 
 
     SharedAbstractNode LLVMToTriton::convert(llvm::Value* instruction) {
+      this->values.clear();
       return this->do_convert(instruction);
     }
 
@@ -23,7 +23,7 @@ namespace triton {
   namespace ast {
 
     TritonToLLVM::TritonToLLVM(llvm::LLVMContext& llvmContext)
-      : llvmContext(llvmContext), llvmIR(this->llvmContext) {
+      : llvmContext(llvmContext), llvmIR(this->llvmContext), llvmMemory(nullptr) {
       this->llvmModule = std::make_shared<llvm::Module>("tritonModule", this->llvmContext);
       if (llvmModule == nullptr) {
         triton::exceptions::LiftingEngine("TritonToLLVM::TritonToLLVM: Failed to allocate the LLVM Module");
@@ -32,6 +32,10 @@ namespace triton {
 
 
     void TritonToLLVM::createFunction(const triton::ast::SharedAbstractNode& node, const char* fname) {
+      // The variables of the previous functions of the module are not reachable
+      this->llvmVars.clear();
+      this->llvmMemory = nullptr;
+
       // Collect used symbolic variables.
       auto vars = triton::ast::search(node, triton::ast::VARIABLE_NODE);
 
@@ -81,6 +85,48 @@ namespace triton {
     }
 
 
+    void TritonToLLVM::createFunction(const std::vector<triton::ast::SharedAbstractNode>& vars, const char* fname, bool memory) {
+      auto* i64      = llvm::Type::getInt64Ty(this->llvmContext);
+      auto* ptrType  = llvm::PointerType::getUnqual(i64);
+
+      std::vector<llvm::Type*> argsType = {ptrType, ptrType};
+      if (memory) {
+        argsType.push_back(llvm::Type::getInt8PtrTy(this->llvmContext));
+      }
+
+      auto* funcType = llvm::FunctionType::get(llvm::Type::getVoidTy(this->llvmContext), argsType, false /* isVarArg */);
+      auto* llvmFunc = llvm::Function::Create(funcType, llvm::Function::ExternalLinkage, fname, this->llvmModule.get());
+
+      this->llvmVars.clear();
+      this->llvmMemory = nullptr;
+
+      auto* inputs = llvmFunc->getArg(0);
+      inputs->setName("inputs");
+      llvmFunc->getArg(1)->setName("outputs");
+
+      if (memory) {
+        this->llvmMemory = llvmFunc->getArg(2);
+        this->llvmMemory->setName("memory");
+      }
+
+      auto* llvmBasicBlock = llvm::BasicBlock::Create(this->llvmContext, "entry", llvmFunc);
+      this->llvmIR.SetInsertPoint(llvmBasicBlock);
+
+      /* Each symbolic variable is loaded from the inputs */
+      for (triton::usize index = 0; index < vars.size(); index++) {
+        const auto& node = vars[index];
+
+        if (node->getType() != triton::ast::VARIABLE_NODE || node->getBitvectorSize() > triton::bitsize::qword)
+          throw triton::exceptions::AstLifting("TritonToLLVM::createFunction(): Inputs must be symbolic variables up to 64 bits.");
+
+        auto var   = reinterpret_cast<triton::ast::VariableNode*>(node.get())->getSymbolicVariable();
+        auto* ptr  = this->llvmIR.CreateConstGEP1_64(i64, inputs, index);
+        auto* load = this->llvmIR.CreateLoad(i64, ptr);
+        this->llvmVars[node] = this->llvmIR.CreateTrunc(load, llvm::IntegerType::get(this->llvmContext, node->getBitvectorSize()), var->getName());
+      }
+    }
+
+
     std::shared_ptr<llvm::Module> TritonToLLVM::convert(const triton::ast::SharedAbstractNode& node, const char* fname, bool optimize) {
       std::unordered_map<triton::ast::SharedAbstractNode, llvm::Value*> results;
 
@@ -88,30 +134,94 @@ namespace triton {
       this->createFunction(node, fname);
 
       /* Lift Triton AST to LLVM IR */
-      auto nodes = triton::ast::childrenExtraction(node, true /* unroll*/, true /* revert */);
-      for (const auto& node : nodes) {
-        if (node->getBitvectorSize()) {
-          results.insert(std::make_pair(node, this->do_convert(node, &results)));
+      triton::ast::TopologicalSort sort;
+      sort.visit({node.get()}, true /* unroll */, [&](triton::ast::AbstractNode* current) {
+        if (current->getBitvectorSize()) {
+          const triton::ast::SharedAbstractNode n = current->shared_from_this();
+          results.insert(std::make_pair(n, this->do_convert(n, &results)));
         }
-      }
+      });
 
       /* Create the return instruction */
       this->llvmIR.CreateRet(results.at(node));
 
       /* Apply LLVM optimizations (-03 -Oz) if enabled */
       if (optimize) {
-        llvm::legacy::PassManager pm;
-        llvm::PassManagerBuilder pmb;
-        pmb.OptLevel = 3;
-        pmb.SizeLevel = 2;
-        pmb.populateModulePassManager(pm);
-        pm.run(*this->llvmModule);
+        this->optimizeModule();
+      }
+
+      return this->llvmModule;
+    }
+
+
+    std::shared_ptr<llvm::Module> TritonToLLVM::convert(const std::vector<triton::ast::SharedAbstractNode>& nodes, const std::vector<triton::ast::SharedAbstractNode>& vars, const char* fname, bool optimize, bool memory) {
+      std::unordered_map<triton::ast::SharedAbstractNode, llvm::Value*> results;
+
+      /* Create the LLVM function */
+      this->createFunction(vars, fname, memory);
+
+      auto* i64 = llvm::Type::getInt64Ty(this->llvmContext);
+      auto* outputs = this->llvmIR.GetInsertBlock()->getParent()->getArg(1);
+      triton::ast::TopologicalSort sort;
+
+      for (triton::usize index = 0; index < nodes.size(); index++) {
+        const auto& root = nodes[index];
+
+        if (root->getBitvectorSize() > triton::bitsize::qword)
+          throw triton::exceptions::AstLifting("TritonToLLVM::convert(): Outputs must be up to 64 bits.");
+
+        /* Lift Triton AST to LLVM IR, sub-trees shared by outputs are lifted once */
+        sort.visit({root.get()}, true /* unroll */, [&](triton::ast::AbstractNode* current) {
+          const triton::ast::SharedAbstractNode node = current->shared_from_this();
+          if (node->getBitvectorSize() && results.find(node) == results.end()) {
+            if (node->getType() == triton::ast::VARIABLE_NODE && this->llvmVars.find(node) == this->llvmVars.end())
+              throw triton::exceptions::AstLifting("TritonToLLVM::convert(): Symbolic variable not provided as input.");
+            results.insert(std::make_pair(node, this->do_convert(node, &results)));
+          }
+        });
+
+        /* Store the result as a 64-bit value */
+        auto* ptr = this->llvmIR.CreateConstGEP1_64(i64, outputs, index);
+        this->llvmIR.CreateStore(this->llvmIR.CreateZExtOrTrunc(results.at(root), i64), ptr);
+      }
+
+      /* Create the return instruction */
+      this->llvmIR.CreateRetVoid();
+
+      /* Apply LLVM optimizations (-03 -Oz) if enabled */
+      if (optimize) {
+        this->optimizeModule();
       }
 
       return this->llvmModule;
     }
 
 
+    void TritonToLLVM::optimizeModule(void) {
+      llvm::legacy::PassManager pm;
+      llvm::PassManagerBuilder pmb;
+      pmb.OptLevel = 3;
+      pmb.SizeLevel = 2;
+      pmb.populateModulePassManager(pm);
+      pm.run(*this->llvmModule);
+    }
+
+
+    std::shared_ptr<llvm::Module> TritonToLLVM::getModule(void) const {
+      return this->llvmModule;
+    }
+
+
+    llvm::Value* TritonToLLVM::getMemoryPointer(llvm::Value* address) {
+      /* The address is an offset from the memory argument */
+      if (this->llvmMemory != nullptr) {
+        auto* offset = this->llvmIR.CreateZExtOrTrunc(address, llvm::Type::getInt64Ty(this->llvmContext));
+        return this->llvmIR.CreateGEP(llvm::Type::getInt8Ty(this->llvmContext), this->llvmMemory, offset);
+      }
+      return this->llvmIR.CreateIntToPtr(address, llvm::Type::getInt8PtrTy(this->llvmContext));
+    }
+
+
     llvm::Value* TritonToLLVM::do_convert(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::ast::SharedAbstractNode, llvm::Value*>* results) {
       if (node == nullptr)
         throw triton::exceptions::AstLifting("TritonToLLVM::do_convert(): node cannot be null.");
@@ -310,12 +420,12 @@ namespace triton {
           return results->at(reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst());
 
         case triton::ast::SELECT_NODE: {
-          auto* ptr = this->llvmIR.CreateIntToPtr(children[1], llvm::Type::getInt8PtrTy(this->llvmContext));
+          auto* ptr = this->getMemoryPointer(children[1]);
           return this->llvmIR.CreateLoad(llvm::Type::getInt8Ty(this->llvmContext), ptr);
         }
 
         case triton::ast::STORE_NODE: {
-          auto* ptr = this->llvmIR.CreateIntToPtr(children[1], llvm::Type::getInt8PtrTy(this->llvmContext));
+          auto* ptr = this->getMemoryPointer(children[1]);
           return this->llvmIR.CreateStore(children[2], ptr);
         }
 
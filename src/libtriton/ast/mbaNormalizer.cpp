@@ -0,0 +1,458 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <set>
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/mbaNormalizer.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* The smallest bitwise expression of a truth table */
+    struct BitwiseEntry {
+      triton::ast::ast_e type;
+      triton::usize left;
+      triton::usize right;
+      triton::usize size;
+    };
+
+
+    /* Returns true if `type` is a bitwise operator */
+    static bool isBitwise(triton::ast::ast_e type) {
+      switch (type) {
+        case BVAND_NODE:
+        case BVNAND_NODE:
+        case BVNOR_NODE:
+        case BVNOT_NODE:
+        case BVOR_NODE:
+        case BVXNOR_NODE:
+        case BVXOR_NODE:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
+    /* Returns true if `node` may be the root of a linear MBA subtree */
+    static bool isLinearRoot(const SharedAbstractNode& node) {
+      switch (node->getType()) {
+        case BVADD_NODE:
+        case BVNEG_NODE:
+        case BVSUB_NODE:
+          return true;
+        case BVMUL_NODE:
+          return node->getChildren()[0]->getType() == BV_NODE || node->getChildren()[1]->getType() == BV_NODE;
+        default:
+          return isBitwise(node->getType());
+      }
+    }
+
+
+    /*
+     * Returns the smallest bitwise expressions of the truth tables of `count` atoms (from 1 to 3), indexed by
+     * truth table. The bit `i` of a truth table is the value of the expression when the atoms whose bit is set
+     * in `i` are true. The expressions are enumerated once by increasing size.
+     */
+    static const std::vector<BitwiseEntry>& getBitwiseTable(triton::usize count) {
+      static const std::array<std::vector<BitwiseEntry>, 4> tables = []() {
+        std::array<std::vector<BitwiseEntry>, 4> tables;
+
+        for (triton::usize atoms = 1; atoms <= 3; atoms++) {
+          triton::usize width = static_cast<triton::usize>(1) << atoms;
+          triton::usize functions = static_cast<triton::usize>(1) << width;
+          triton::usize full = functions - 1;
+          triton::usize found = 0;
+          std::vector<BitwiseEntry>& table = tables[atoms];
+          std::vector<std::vector<triton::usize>> bySize(2);
+
+          table.assign(functions, {INVALID_NODE, 0, 0, 0});
+          for (triton::usize atom = 0; atom < atoms; atom++) {
+            triton::usize tt = 0;
+            for (triton::usize inputs = 0; inputs < width; inputs++)
+              tt |= ((inputs >> atom) & 1) << inputs;
+            table[tt] = {VARIABLE_NODE, atom, 0, 1};
+            bySize[1].push_back(tt);
+            found++;
+          }
+
+          for (triton::usize size = 2; found < functions; size++) {
+            bySize.emplace_back();
+            auto add = [&](triton::usize tt, triton::ast::ast_e type, triton::usize left, triton::usize right) {
+              if (table[tt].size == 0) {
+                table[tt] = {type, left, right, size};
+                bySize[size].push_back(tt);
+                found++;
+              }
+            };
+
+            for (triton::usize tt : bySize[size - 1])
+              add(~tt & full, BVNOT_NODE, tt, 0);
+
+            for (triton::usize leftSize = 1; leftSize + 1 < size; leftSize++) {
+              for (triton::usize left : bySize[leftSize]) {
+                for (triton::usize right : bySize[size - 1 - leftSize]) {
+                  add(left & right, BVAND_NODE, left, right);
+                  add(left | right, BVOR_NODE,  left, right);
+                  add(left ^ right, BVXOR_NODE, left, right);
+                }
+              }
+            }
+          }
+        }
+
+        return tables;
+      }();
+
+      return tables[count];
+    }
+
+
+    /* Builds the bitwise expression of a truth table */
+    static SharedAbstractNode buildBitwise(const std::vector<BitwiseEntry>& table, triton::usize tt, const std::vector<SharedAbstractNode>& atoms) {
+      const BitwiseEntry& entry = table[tt];
+      auto actx = atoms[0]->getContext();
+
+      switch (entry.type) {
+        case VARIABLE_NODE: return atoms[entry.left];
+        case BVNOT_NODE:    return actx->bvnot(buildBitwise(table, entry.left, atoms));
+        case BVAND_NODE:    return actx->bvand(buildBitwise(table, entry.left, atoms), buildBitwise(table, entry.right, atoms));
+        case BVOR_NODE:     return actx->bvor(buildBitwise(table, entry.left, atoms), buildBitwise(table, entry.right, atoms));
+        case BVXOR_NODE:    return actx->bvxor(buildBitwise(table, entry.left, atoms), buildBitwise(table, entry.right, atoms));
+        default:
+          throw triton::exceptions::Ast("MbaNormalizer::buildBitwise(): Invalid truth table.");
+      }
+    }
+
+
+    /* Returns the number of nodes of the tree of `node`, an atom counting as one node, or more than `limit` */
+    static triton::usize countNodes(const SharedAbstractNode& node, const std::vector<SharedAbstractNode>& atoms, triton::usize limit) {
+      if (node->getType() == BV_NODE || std::find(atoms.begin(), atoms.end(), node) != atoms.end())
+        return 1;
+
+      triton::usize count = 1;
+      for (const auto& child : node->getChildren()) {
+        count += countNodes(child, atoms, limit - std::min(count, limit));
+        if (count > limit)
+          break;
+      }
+
+      return count;
+    }
+
+
+    /* Returns `coefficient * node`, the coefficient being in the size of the node */
+    static SharedAbstractNode multiply(triton::uint64 coefficient, const SharedAbstractNode& node) {
+      if (coefficient == 1)
+        return node;
+      return node->getContext()->bvmul(node->getContext()->bv(coefficient, node->getBitvectorSize()), node);
+    }
+
+
+    /* Returns `sum + coefficient * node`, or `sum - (-coefficient) * node` if the opposite is smaller. `sum` may be null. */
+    static SharedAbstractNode accumulate(const SharedAbstractNode& sum, triton::uint64 coefficient, const SharedAbstractNode& node, triton::uint64 mask) {
+      auto actx = node->getContext();
+      triton::uint64 opposite = (0 - coefficient) & mask;
+
+      if (sum == nullptr)
+        return (opposite == 1) ? actx->bvneg(node) : multiply(coefficient, node);
+
+      if (opposite < coefficient)
+        return actx->bvsub(sum, multiply(opposite, node));
+
+      return actx->bvadd(sum, multiply(coefficient, node));
+    }
+
+
+    /* Returns `expr + constant`, `expr` being null for 0 */
+    static SharedAbstractNode addConstant(const SharedAbstractNode& expr, triton::uint64 constant, triton::uint64 mask, const SharedAstContext& actx, triton::uint32 bits) {
+      triton::uint64 opposite = (0 - constant) & mask;
+
+      if (expr == nullptr)
+        return actx->bv(constant, bits);
+
+      if (constant == 0)
+        return expr;
+
+      if (opposite < constant)
+        return actx->bvsub(expr, actx->bv(opposite, bits));
+
+      return actx->bvadd(expr, actx->bv(constant, bits));
+    }
+
+
+    bool MbaNormalizer::compile(const SharedAbstractNode& node, bool bitwise, Program& program, triton::usize& index) {
+      auto it = program.compiled[bitwise].find(node.get());
+      if (it != program.compiled[bitwise].end()) {
+        index = it->second;
+        return true;
+      }
+
+      if (program.operations.size() >= MbaNormalizer::maxOperations)
+        return false;
+
+      Operation operation = {node->getType(), {}, 0};
+      const auto& children = node->getChildren();
+      bool atom = false;
+
+      switch (node->getType()) {
+        case BV_NODE:
+          operation.value = static_cast<triton::uint64>(node->evaluate());
+          atom = bitwise;
+          break;
+
+        case BVADD_NODE:
+        case BVNEG_NODE:
+        case BVSUB_NODE:
+          atom = bitwise;
+          break;
+
+        case BVMUL_NODE:
+          /* Only a multiplication by a constant is linear */
+          if (!bitwise && children[0]->getType() == BV_NODE) {
+            operation.value = static_cast<triton::uint64>(children[0]->evaluate());
+            operation.operands.push_back(1);
+          }
+          else if (!bitwise && children[1]->getType() == BV_NODE) {
+            operation.value = static_cast<triton::uint64>(children[1]->evaluate());
+            operation.operands.push_back(0);
+          }
+          else {
+            atom = true;
+          }
+          break;
+
+        default:
+          atom = !isBitwise(node->getType());
+          break;
+      }
+
+      /* An atom is a variable of the expression, the equal atoms are the same variable */
+      if (atom) {
+        triton::usize position = 0;
+        while (position < program.atoms.size() && program.atoms[position] != node && !program.atoms[position]->equalTo(node))
+          position++;
+
+        if (position == program.atoms.size()) {
+          if (position == MbaNormalizer::maxAtoms)
+            return false;
+          program.atoms.push_back(node);
+        }
+
+        operation.type  = VARIABLE_NODE;
+        operation.value = position;
+      }
+      else if (node->getType() == BVMUL_NODE) {
+        triton::usize operand = 0;
+        if (!MbaNormalizer::compile(children[operation.operands[0]], false, program, operand))
+          return false;
+        operation.operands[0] = operand;
+      }
+      else if (node->getType() != BV_NODE) {
+        for (const auto& child : children) {
+          triton::usize operand = 0;
+          if (!MbaNormalizer::compile(child, isBitwise(node->getType()), program, operand))
+            return false;
+          operation.operands.push_back(operand);
+        }
+      }
+
+      index = program.operations.size();
+      program.operations.push_back(operation);
+      program.compiled[bitwise][node.get()] = index;
+      return true;
+    }
+
+
+    triton::uint64 MbaNormalizer::run(const Program& program, triton::usize inputs, std::vector<triton::uint64>& values) {
+      triton::uint64 mask = program.mask;
+
+      for (triton::usize i = 0; i < program.operations.size(); i++) {
+        const Operation& operation = program.operations[i];
+        const auto& operands = operation.operands;
+        triton::uint64 value = 0;
+
+        switch (operation.type) {
+          case VARIABLE_NODE: value = (inputs >> operation.value) & 1; break;
+          case BV_NODE:       value = operation.value; break;
+          case BVMUL_NODE:    value = operation.value * values[operands[0]]; break;
+          case BVNEG_NODE:    value = 0 - values[operands[0]]; break;
+          case BVNOT_NODE:    value = ~values[operands[0]]; break;
+          case BVSUB_NODE:    value = values[operands[0]] - values[operands[1]]; break;
+          case BVADD_NODE:    for (auto o : operands) value += values[o]; break;
+          case BVXOR_NODE:    for (auto o : operands) value ^= values[o]; break;
+          case BVXNOR_NODE:   for (auto o : operands) value ^= values[o]; value = ~value; break;
+          case BVAND_NODE:
+          case BVNAND_NODE:
+            value = mask;
+            for (auto o : operands)
+              value &= values[o];
+            if (operation.type == BVNAND_NODE)
+              value = ~value;
+            break;
+          case BVOR_NODE:
+          case BVNOR_NODE:
+            for (auto o : operands)
+              value |= values[o];
+            if (operation.type == BVNOR_NODE)
+              value = ~value;
+            break;
+          default:
+            throw triton::exceptions::Ast("MbaNormalizer::run(): Invalid operation.");
+        }
+
+        values[i] = value & mask;
+      }
+
+      return values.back();
+    }
+
+
+    SharedAbstractNode MbaNormalizer::normalizeLinear(const SharedAbstractNode& node) {
+      triton::uint32 bits = node->getBitvectorSize();
+      auto actx = node->getContext();
+      triton::usize root = 0;
+      Program program;
+
+      if (bits == 0 || bits > 64)
+        return nullptr;
+
+      program.mask = (bits == 64) ? std::numeric_limits<triton::uint64>::max() : ((static_cast<triton::uint64>(1) << bits) - 1);
+      if (!MbaNormalizer::compile(node, false, program, root))
+        return nullptr;
+
+      /* The values on the inputs where each atom is 0 or 1 */
+      triton::usize count = program.atoms.size();
+      triton::usize inputs = static_cast<triton::usize>(1) << count;
+      std::vector<triton::uint64> values(program.operations.size());
+      std::vector<triton::uint64> coefficients(inputs);
+
+      for (triton::usize i = 0; i < inputs; i++)
+        coefficients[i] = MbaNormalizer::run(program, i, values);
+
+      /*
+       * The constant is the value on the zero input. The others, minus the constant, are
+       * the sums of the coefficients of the conjunctions they satisfy: the coefficients
+       * are given back by the inverse Möbius transform.
+       */
+      triton::uint64 constant = coefficients[0];
+      std::set<triton::uint64> distinct;
+      triton::usize tt = 0;
+
+      for (triton::usize i = 1; i < inputs; i++) {
+        coefficients[i] = (coefficients[i] - constant) & program.mask;
+        if (coefficients[i])
+          distinct.insert(coefficients[i]);
+      }
+
+      /* A constant times a bitwise expression of the truth table of the non zero values */
+      SharedAbstractNode best = nullptr;
+      if (distinct.size() == 1 && count <= 3) {
+        triton::uint64 factor = *distinct.begin();
+        for (triton::usize i = 1; i < inputs; i++)
+          tt |= static_cast<triton::usize>(coefficients[i] == factor) << i;
+
+        auto bitwise = buildBitwise(getBitwiseTable(count), tt, program.atoms);
+        if (factor == program.mask && constant == program.mask)
+          best = actx->bvnot(bitwise);
+        else if (factor == program.mask && constant != 0)
+          best = actx->bvsub(actx->bv(constant, bits), bitwise);
+        else
+          best = addConstant(accumulate(nullptr, factor, bitwise, program.mask), constant, program.mask, actx, bits);
+      }
+
+      for (triton::usize atom = 0; atom < count; atom++) {
+        for (triton::usize i = 0; i < inputs; i++) {
+          if ((i >> atom) & 1)
+            coefficients[i] = (coefficients[i] - coefficients[i ^ (static_cast<triton::usize>(1) << atom)]) & program.mask;
+        }
+      }
+
+      /* The sum of the conjunctions */
+      SharedAbstractNode sum = nullptr;
+      for (triton::usize i = 1; i < inputs; i++) {
+        if (coefficients[i] == 0)
+          continue;
+
+        SharedAbstractNode conjunction = nullptr;
+        for (triton::usize atom = 0; atom < count; atom++) {
+          if ((i >> atom) & 1)
+            conjunction = conjunction ? actx->bvand(conjunction, program.atoms[atom]) : program.atoms[atom];
+        }
+        sum = accumulate(sum, coefficients[i], conjunction, program.mask);
+      }
+      sum = addConstant(sum, constant, program.mask, actx, bits);
+
+      triton::usize limit = std::numeric_limits<triton::usize>::max();
+      if (best == nullptr || countNodes(sum, program.atoms, limit) < countNodes(best, program.atoms, limit))
+        best = sum;
+
+      /* The tree of the subtree may be much larger than its DAG */
+      triton::usize size = countNodes(best, program.atoms, limit);
+      if (countNodes(node, program.atoms, size) > size)
+        return best;
+
+      return nullptr;
+    }
+
+
+    SharedAbstractNode MbaNormalizer::normalize(const SharedAbstractNode& node) const {
+      std::unordered_map<const AbstractNode*, SharedAbstractNode> results;
+      std::vector<std::pair<SharedAbstractNode, bool>> worklist = {{node, false}};
+
+      if (node == nullptr)
+        throw triton::exceptions::Ast("MbaNormalizer::normalize(): node cannot be null.");
+
+      /* Post-order without recursion, the children are normalized before their parent */
+      while (!worklist.empty()) {
+        SharedAbstractNode current = worklist.back().first;
+
+        if (results.find(current.get()) != results.end()) {
+          worklist.pop_back();
+          continue;
+        }
+
+        if (worklist.back().second == false) {
+          worklist.back().second = true;
+          const auto& children = current->getChildren();
+          for (auto it = children.rbegin(); it != children.rend(); it++) {
+            if (results.find(it->get()) == results.end())
+              worklist.push_back({*it, false});
+          }
+          continue;
+        }
+
+        worklist.pop_back();
+
+        std::vector<SharedAbstractNode> children;
+        bool changed = false;
+        for (const auto& child : current->getChildren()) {
+          children.push_back(results[child.get()]);
+          changed |= (children.back() != child);
+        }
+
+        SharedAbstractNode output = changed ? current->getContext()->build(current->getType(), children) : current;
+        if (isLinearRoot(output)) {
+          if (auto linear = MbaNormalizer::normalizeLinear(output))
+            output = linear;
+        }
+
+        results[current.get()] = output;
+      }
+
+      return results[node.get()];
+    }
+
+  };
+};
@@ -0,0 +1,642 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/astCRepresentation.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+    namespace representations {
+
+      AstCRepresentation::AstCRepresentation() {
+      }
+
+
+      triton::uint32 AstCRepresentation::getWidth(const triton::ast::AbstractNode* node) {
+        if (node->isArray())
+          throw triton::exceptions::AstRepresentation("AstCRepresentation::getWidth(): Arrays are not supported.");
+
+        if (node->getBitvectorSize() <= triton::bitsize::qword)
+          return triton::bitsize::qword;
+
+        if (node->getBitvectorSize() <= triton::bitsize::dqword)
+          return triton::bitsize::dqword;
+
+        throw triton::exceptions::AstRepresentation("AstCRepresentation::getWidth(): Bitvectors wider than 128 bits are not supported.");
+      }
+
+
+      std::string AstCRepresentation::getComputeType(const triton::ast::AbstractNode* node) {
+        return (AstCRepresentation::getWidth(node) == triton::bitsize::qword ? "uint64_t" : "triton_uint128");
+      }
+
+
+      std::ostream& AstCRepresentation::printMask(std::ostream& stream, const triton::ast::AbstractNode* node) {
+        triton::uint32 size = node->getBitvectorSize();
+
+        if (size == AstCRepresentation::getWidth(node))
+          return stream;
+
+        if (size <= triton::bitsize::qword)
+          stream << " & 0x" << std::hex << node->getBitvectorMask64() << std::dec << "ull";
+        else
+          stream << " & triton_mask128(" << size << ")";
+
+        return stream;
+      }
+
+
+      std::string AstCRepresentation::getType(const triton::ast::AbstractNode* node) {
+        if (node->isLogical())
+          return "bool";
+
+        switch (AstCRepresentation::getWidth(node)) {
+          case triton::bitsize::qword:
+            if (node->getBitvectorSize() <= triton::bitsize::byte)
+              return "uint8_t";
+            if (node->getBitvectorSize() <= triton::bitsize::word)
+              return "uint16_t";
+            if (node->getBitvectorSize() <= triton::bitsize::dword)
+              return "uint32_t";
+            return "uint64_t";
+
+          default:
+            return "triton_uint128";
+        }
+      }
+
+
+      /* Representation dispatcher from an abstract node */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::AbstractNode* node) {
+        switch (node->getType()) {
+          case ARRAY_NODE:                return this->print(stream, reinterpret_cast<triton::ast::ArrayNode*>(node)); break;
+          case ASSERT_NODE:               return this->print(stream, reinterpret_cast<triton::ast::AssertNode*>(node)); break;
+          case BSWAP_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BswapNode*>(node)); break;
+          case BVADD_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvaddNode*>(node)); break;
+          case BVAND_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvandNode*>(node)); break;
+          case BVASHR_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvashrNode*>(node)); break;
+          case BVLSHR_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvlshrNode*>(node)); break;
+          case BVMUL_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvmulNode*>(node)); break;
+          case BVNAND_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvnandNode*>(node)); break;
+          case BVNEG_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvnegNode*>(node)); break;
+          case BVNOR_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvnorNode*>(node)); break;
+          case BVNOT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvnotNode*>(node)); break;
+          case BVOR_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::BvorNode*>(node)); break;
+          case BVROL_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvrolNode*>(node)); break;
+          case BVROR_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvrorNode*>(node)); break;
+          case BVSDIV_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvsdivNode*>(node)); break;
+          case BVSGE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvsgeNode*>(node)); break;
+          case BVSGT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvsgtNode*>(node)); break;
+          case BVSHL_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvshlNode*>(node)); break;
+          case BVSLE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvsleNode*>(node)); break;
+          case BVSLT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvsltNode*>(node)); break;
+          case BVSMOD_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvsmodNode*>(node)); break;
+          case BVSREM_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvsremNode*>(node)); break;
+          case BVSUB_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvsubNode*>(node)); break;
+          case BVUDIV_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvudivNode*>(node)); break;
+          case BVUGE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvugeNode*>(node)); break;
+          case BVUGT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvugtNode*>(node)); break;
+          case BVULE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvuleNode*>(node)); break;
+          case BVULT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvultNode*>(node)); break;
+          case BVUREM_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvuremNode*>(node)); break;
+          case BVXNOR_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvxnorNode*>(node)); break;
+          case BVXOR_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvxorNode*>(node)); break;
+          case BV_NODE:                   return this->print(stream, reinterpret_cast<triton::ast::BvNode*>(node)); break;
+          case COMPOUND_NODE:             return this->print(stream, reinterpret_cast<triton::ast::CompoundNode*>(node)); break;
+          case CONCAT_NODE:               return this->print(stream, reinterpret_cast<triton::ast::ConcatNode*>(node)); break;
+          case DECLARE_NODE:              return this->print(stream, reinterpret_cast<triton::ast::DeclareNode*>(node)); break;
+          case DISTINCT_NODE:             return this->print(stream, reinterpret_cast<triton::ast::DistinctNode*>(node)); break;
+          case EQUAL_NODE:                return this->print(stream, reinterpret_cast<triton::ast::EqualNode*>(node)); break;
+          case EXTRACT_NODE:              return this->print(stream, reinterpret_cast<triton::ast::ExtractNode*>(node)); break;
+          case FORALL_NODE:               return this->print(stream, reinterpret_cast<triton::ast::ForallNode*>(node)); break;
+          case IFF_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::IffNode*>(node)); break;
+          case INTEGER_NODE:              return this->print(stream, reinterpret_cast<triton::ast::IntegerNode*>(node)); break;
+          case ITE_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::IteNode*>(node)); break;
+          case LAND_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::LandNode*>(node)); break;
+          case LET_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::LetNode*>(node)); break;
+          case LNOT_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::LnotNode*>(node)); break;
+          case LOR_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::LorNode*>(node)); break;
+          case LXOR_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::LxorNode*>(node)); break;
+          case REFERENCE_NODE:            return this->print(stream, reinterpret_cast<triton::ast::ReferenceNode*>(node)); break;
+          case SELECT_NODE:               return this->print(stream, reinterpret_cast<triton::ast::SelectNode*>(node)); break;
+          case STORE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::StoreNode*>(node)); break;
+          case STRING_NODE:               return this->print(stream, reinterpret_cast<triton::ast::StringNode*>(node)); break;
+          case SX_NODE:                   return this->print(stream, reinterpret_cast<triton::ast::SxNode*>(node)); break;
+          case VARIABLE_NODE:             return this->print(stream, reinterpret_cast<triton::ast::VariableNode*>(node)); break;
+          case ZX_NODE:                   return this->print(stream, reinterpret_cast<triton::ast::ZxNode*>(node)); break;
+          default:
+            throw triton::exceptions::AstRepresentation("AstCRepresentation::print(AbstractNode): Invalid kind node.");
+        }
+        return stream;
+      }
+
+
+      /* array representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::ArrayNode* node) {
+        throw triton::exceptions::AstRepresentation("AstCRepresentation::print(ArrayNode): Arrays are not supported.");
+        return stream;
+      }
+
+
+      /* assert representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::AssertNode* node) {
+        throw triton::exceptions::AstRepresentation("AstCRepresentation::print(AssertNode): Assertions are not supported.");
+        return stream;
+      }
+
+
+      /* bswap representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BswapNode* node) {
+        stream << "triton_bswap" << AstCRepresentation::getWidth(node) << "(" << node->getChildren()[0] << ", " << node->getBitvectorSize() << ")";
+        return stream;
+      }
+
+
+      /* bvadd representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvaddNode* node) {
+        stream << "(((" << AstCRepresentation::getComputeType(node) << ")" << node->getChildren()[0] << " + " << node->getChildren()[1] << ")";
+        AstCRepresentation::printMask(stream, node) << ")";
+
+        return stream;
+      }
+
+
+      /* bvand representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvandNode* node) {
+        stream << "(" << node->getChildren()[0] << " & " << node->getChildren()[1] << ")";
+        return stream;
+      }
+
+
+      /* bvashr representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvashrNode* node) {
+        stream << "triton_ashr" << AstCRepresentation::getWidth(node) << "(" << node->getChildren()[0] << ", " << node->getChildren()[1] << ", " << node->getBitvectorSize() << ")";
+        return stream;
+      }
+
+
+      /* bvlshr representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvlshrNode* node) {
+        stream << "triton_lshr" << AstCRepresentation::getWidth(node) << "(" << node->getChildren()[0] << ", " << node->getChildren()[1] << ", " << node->getBitvectorSize() << ")";
+        return stream;
+      }
+
+
+      /* bvmul representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvmulNode* node) {
+        stream << "(((" << AstCRepresentation::getComputeType(node) << ")" << node->getChildren()[0] << " * " << node->getChildren()[1] << ")";
+        AstCRepresentation::printMask(stream, node) << ")";
+
+        return stream;
+      }
+
+
+      /* bvnand representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvnandNode* node) {
+        stream << "(~((" << AstCRepresentation::getComputeType(node) << ")" << node->getChildren()[0] << " & " << node->getChildren()[1] << ")";
+        AstCRepresentation::printMask(stream, node) << ")";
+
+        return stream;
+      }
+
+
+      /* bvneg representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvnegNode* node) {
+        stream << "((-(" << AstCRepresentation::getComputeType(node) << ")" << node->getChildren()[0] << ")";
+        AstCRepresentation::printMask(stream, node) << ")";
+
+        return stream;
+      }
+
+
+      /* bvnor representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvnorNode* node) {
+        stream << "(~((" << AstCRepresentation::getComputeType(node) << ")" << node->getChildren()[0] << " | " << node->getChildren()[1] << ")";
+        AstCRepresentation::printMask(stream, node) << ")";
+
+        return stream;
+      }
+
+
+      /* bvnot representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvnotNode* node) {
+        stream << "(~(" << AstCRepresentation::getComputeType(node) << ")" << node->getChildren()[0];
+        AstCRepresentation::printMask(stream, node) << ")";
+
+        return stream;
+      }
+
+
+      /* bvor representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvorNode* node) {
+        stream << "(" << node->getChildren()[0] << " | " << node->getChildren()[1] << ")";
+        return stream;
+      }
+
+
+      /* bvrol representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvrolNode* node) {
+        triton::uint32 rot = triton::ast::getInteger<triton::uint32>(node->getChildren()[1]) % node->getBitvectorSize();
+
+        if (rot == 0)
+          stream << node->getChildren()[0];
+        else
+          stream << "triton_rol" << AstCRepresentation::getWidth(node) << "(" << node->getChildren()[0] << ", " << rot << ", " << node->getBitvectorSize() << ")";
+
+        return stream;
+      }
+
+
+      /* bvror representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvrorNode* node) {
+        triton::uint32 rot = triton::ast::getInteger<triton::uint32>(node->getChildren()[1]) % node->getBitvectorSize();
+
+        if (rot == 0)
+          stream << node->getChildren()[0];
+        else
+          stream << "triton_ror" << AstCRepresentation::getWidth(node) << "(" << node->getChildren()[0] << ", " << rot << ", " << node->getBitvectorSize() << ")";
+
+        return stream;
+      }
+
+
+      /* bvsdiv representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvsdivNode* node) {
+        stream << "triton_sdiv" << AstCRepresentation::getWidth(node) << "(" << node->getChildren()[0] << ", " << node->getChildren()[1] << ", " << node->getBitvectorSize() << ")";
+        return stream;
+      }
+
+
+      /* bvsge representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvsgeNode* node) {
+        triton::uint32 width = AstCRepresentation::getWidth(node->getChildren()[0].get());
+        triton::uint32 size  = node->getChildren()[0]->getBitvectorSize();
+
+        stream << "(triton_sx" << width << "(" << node->getChildren()[0] << ", " << size << ") >= triton_sx" << width << "(" << node->getChildren()[1] << ", " << size << "))";
+
+        return stream;
+      }
+
+
+      /* bvsgt representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvsgtNode* node) {
+        triton::uint32 width = AstCRepresentation::getWidth(node->getChildren()[0].get());
+        triton::uint32 size  = node->getChildren()[0]->getBitvectorSize();
+
+        stream << "(triton_sx" << width << "(" << node->getChildren()[0] << ", " << size << ") > triton_sx" << width << "(" << node->getChildren()[1] << ", " << size << "))";
+
+        return stream;
+      }
+
+
+      /* bvshl representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvshlNode* node) {
+        stream << "triton_shl" << AstCRepresentation::getWidth(node) << "(" << node->getChildren()[0] << ", " << node->getChildren()[1] << ", " << node->getBitvectorSize() << ")";
+        return stream;
+      }
+
+
+      /* bvsle representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvsleNode* node) {
+        triton::uint32 width = AstCRepresentation::getWidth(node->getChildren()[0].get());
+        triton::uint32 size  = node->getChildren()[0]->getBitvectorSize();
+
+        stream << "(triton_sx" << width << "(" << node->getChildren()[0] << ", " << size << ") <= triton_sx" << width << "(" << node->getChildren()[1] << ", " << size << "))";
+
+        return stream;
+      }
+
+
+      /* bvslt representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvsltNode* node) {
+        triton::uint32 width = AstCRepresentation::getWidth(node->getChildren()[0].get());
+        triton::uint32 size  = node->getChildren()[0]->getBitvectorSize();
+
+        stream << "(triton_sx" << width << "(" << node->getChildren()[0] << ", " << size << ") < triton_sx" << width << "(" << node->getChildren()[1] << ", " << size << "))";
+
+        return stream;
+      }
+
+
+      /* bvsmod representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvsmodNode* node) {
+        stream << "triton_smod" << AstCRepresentation::getWidth(node) << "(" << node->getChildren()[0] << ", " << node->getChildren()[1] << ", " << node->getBitvectorSize() << ")";
+        return stream;
+      }
+
+
+      /* bvsrem representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvsremNode* node) {
+        stream << "triton_srem" << AstCRepresentation::getWidth(node) << "(" << node->getChildren()[0] << ", " << node->getChildren()[1] << ", " << node->getBitvectorSize() << ")";
+        return stream;
+      }
+
+
+      /* bvsub representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvsubNode* node) {
+        stream << "(((" << AstCRepresentation::getComputeType(node) << ")" << node->getChildren()[0] << " - " << node->getChildren()[1] << ")";
+        AstCRepresentation::printMask(stream, node) << ")";
+
+        return stream;
+      }
+
+
+      /* bvudiv representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvudivNode* node) {
+        stream << "triton_udiv" << AstCRepresentation::getWidth(node) << "(" << node->getChildren()[0] << ", " << node->getChildren()[1] << ", " << node->getBitvectorSize() << ")";
+        return stream;
+      }
+
+
+      /* bvuge representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvugeNode* node) {
+        stream << "(" << node->getChildren()[0] << " >= " << node->getChildren()[1] << ")";
+        return stream;
+      }
+
+
+      /* bvugt representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvugtNode* node) {
+        stream << "(" << node->getChildren()[0] << " > " << node->getChildren()[1] << ")";
+        return stream;
+      }
+
+
+      /* bvule representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvuleNode* node) {
+        stream << "(" << node->getChildren()[0] << " <= " << node->getChildren()[1] << ")";
+        return stream;
+      }
+
+
+      /* bvult representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvultNode* node) {
+        stream << "(" << node->getChildren()[0] << " < " << node->getChildren()[1] << ")";
+        return stream;
+      }
+
+
+      /* bvurem representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvuremNode* node) {
+        stream << "triton_urem" << AstCRepresentation::getWidth(node) << "(" << node->getChildren()[0] << ", " << node->getChildren()[1] << ", " << node->getBitvectorSize() << ")";
+        return stream;
+      }
+
+
+      /* bvxnor representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvxnorNode* node) {
+        stream << "(~((" << AstCRepresentation::getComputeType(node) << ")" << node->getChildren()[0] << " ^ " << node->getChildren()[1] << ")";
+        AstCRepresentation::printMask(stream, node) << ")";
+
+        return stream;
+      }
+
+
+      /* bvxor representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvxorNode* node) {
+        stream << "(" << node->getChildren()[0] << " ^ " << node->getChildren()[1] << ")";
+        return stream;
+      }
+
+
+      /* bv representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::BvNode* node) {
+        triton::uint512 value = node->evaluate();
+        triton::uint64 high   = static_cast<triton::uint64>(value >> triton::bitsize::qword);
+        triton::uint64 low    = static_cast<triton::uint64>(value & 0xffffffffffffffff);
+
+        if (AstCRepresentation::getWidth(node) == triton::bitsize::qword)
+          stream << "0x" << std::hex << low << std::dec << "ull";
+        else if (high == 0)
+          stream << "((triton_uint128)0x" << std::hex << low << std::dec << "ull)";
+        else
+          stream << "(((triton_uint128)0x" << std::hex << high << "ull << 64) | 0x" << low << std::dec << "ull)";
+
+        return stream;
+      }
+
+
+      /* compound representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::CompoundNode* node) {
+        throw triton::exceptions::AstRepresentation("AstCRepresentation::print(CompoundNode): Compounds are not supported.");
+        return stream;
+      }
+
+
+      /* concat representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::ConcatNode* node) {
+        triton::usize size = node->getChildren().size();
+
+        for (triton::usize index = 1; index < size; index++)
+          stream << "(";
+
+        stream << "((" << AstCRepresentation::getComputeType(node) << ")" << node->getChildren()[0];
+        for (triton::usize index = 1; index < size; index++)
+          stream << " << " << node->getChildren()[index]->getBitvectorSize() << " | " << node->getChildren()[index] << ")";
+        stream << ")";
+
+        return stream;
+      }
+
+
+      /* declare representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::DeclareNode* node) {
+        if (node->getChildren()[0]->getType() != VARIABLE_NODE)
+          throw triton::exceptions::AstRepresentation("AstCRepresentation::print(DeclareNode): Invalid sort.");
+
+        stream << AstCRepresentation::getType(node->getChildren()[0].get()) << " " << node->getChildren()[0];
+
+        return stream;
+      }
+
+
+      /* distinct representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::DistinctNode* node) {
+        stream << "(" << node->getChildren()[0] << " != " << node->getChildren()[1] << ")";
+        return stream;
+      }
+
+
+      /* equal representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::EqualNode* node) {
+        stream << "(" << node->getChildren()[0] << " == " << node->getChildren()[1] << ")";
+        return stream;
+      }
+
+
+      /* extract representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::ExtractNode* node) {
+        triton::uint32 low = triton::ast::getInteger<triton::uint32>(node->getChildren()[1]);
+
+        stream << "(((" << AstCRepresentation::getComputeType(node) << ")";
+        if (low == 0)
+          stream << node->getChildren()[2];
+        else
+          stream << "(" << node->getChildren()[2] << " >> " << low << ")";
+        stream << ")";
+        AstCRepresentation::printMask(stream, node) << ")";
+
+        return stream;
+      }
+
+
+      /* forall representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::ForallNode* node) {
+        throw triton::exceptions::AstRepresentation("AstCRepresentation::print(ForallNode): Quantifiers are not supported.");
+        return stream;
+      }
+
+
+      /* iff representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::IffNode* node) {
+        stream << "(" << node->getChildren()[0] << " == " << node->getChildren()[1] << ")";
+        return stream;
+      }
+
+
+      /* integer representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::IntegerNode* node) {
+        stream << std::dec << node->getInteger();
+        return stream;
+      }
+
+
+      /* ite representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::IteNode* node) {
+        stream << "(" << node->getChildren()[0] << " ? " << node->getChildren()[1] << " : " << node->getChildren()[2] << ")";
+        return stream;
+      }
+
+
+      /* land representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::LandNode* node) {
+        triton::usize size = node->getChildren().size();
+
+        stream << "(" << node->getChildren()[0];
+        for (triton::usize index = 1; index < size; index++)
+          stream << " && " << node->getChildren()[index];
+        stream << ")";
+
+        return stream;
+      }
+
+
+      /* let representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::LetNode* node) {
+        throw triton::exceptions::AstRepresentation("AstCRepresentation::print(LetNode): Let bindings are not supported.");
+        return stream;
+      }
+
+
+      /* lnot representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::LnotNode* node) {
+        stream << "(!" << node->getChildren()[0] << ")";
+        return stream;
+      }
+
+
+      /* lor representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::LorNode* node) {
+        triton::usize size = node->getChildren().size();
+
+        stream << "(" << node->getChildren()[0];
+        for (triton::usize index = 1; index < size; index++)
+          stream << " || " << node->getChildren()[index];
+        stream << ")";
+
+        return stream;
+      }
+
+
+      /* lxor representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::LxorNode* node) {
+        triton::usize size = node->getChildren().size();
+
+        stream << "(" << node->getChildren()[0];
+        for (triton::usize index = 1; index < size; index++)
+          stream << " ^ " << node->getChildren()[index];
+        stream << ")";
+
+        return stream;
+      }
+
+
+      /* reference representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::ReferenceNode* node) {
+        stream << node->getSymbolicExpression()->getFormattedId();
+        return stream;
+      }
+
+
+      /* select representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::SelectNode* node) {
+        throw triton::exceptions::AstRepresentation("AstCRepresentation::print(SelectNode): Arrays are not supported.");
+        return stream;
+      }
+
+
+      /* store representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::StoreNode* node) {
+        throw triton::exceptions::AstRepresentation("AstCRepresentation::print(StoreNode): Arrays are not supported.");
+        return stream;
+      }
+
+
+      /* string representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::StringNode* node) {
+        throw triton::exceptions::AstRepresentation("AstCRepresentation::print(StringNode): Strings are not supported.");
+        return stream;
+      }
+
+
+      /* sx representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::SxNode* node) {
+        triton::uint32 extend = triton::ast::getInteger<triton::uint32>(node->getChildren()[0]);
+        const auto& child     = node->getChildren()[1];
+
+        if (extend == 0) {
+          stream << child;
+          return stream;
+        }
+
+        stream << "(((" << AstCRepresentation::getComputeType(node) << ")triton_sx" << AstCRepresentation::getWidth(child.get()) << "(" << child << ", " << child->getBitvectorSize() << "))";
+        AstCRepresentation::printMask(stream, node) << ")";
+
+        return stream;
+      }
+
+
+      /* variable representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::VariableNode* node) {
+        if (node->getSymbolicVariable()->getAlias().empty())
+          stream << node->getSymbolicVariable()->getName();
+        else
+          stream << node->getSymbolicVariable()->getAlias();
+
+        return stream;
+      }
+
+
+      /* zx representation */
+      std::ostream& AstCRepresentation::print(std::ostream& stream, triton::ast::ZxNode* node) {
+        const auto& child = node->getChildren()[1];
+
+        if (AstCRepresentation::getWidth(child.get()) == AstCRepresentation::getWidth(node))
+          stream << child;
+        else
+          stream << "((" << AstCRepresentation::getComputeType(node) << ")" << child << ")";
+
+        return stream;
+      }
+
+    };
+  };
+};
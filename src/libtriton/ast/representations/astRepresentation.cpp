@@ -5,9 +5,12 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
 #include <new>
 #include <memory>
+#include <unordered_set>
 
+#include <triton/astCRepresentation.hpp>
 #include <triton/astPcodeRepresentation.hpp>
 #include <triton/astPythonRepresentation.hpp>
 #include <triton/astRepresentation.hpp>
@@ -22,12 +25,15 @@ namespace triton {
 
       AstRepresentation::AstRepresentation() {
         /* Set the default representation */
-        this->mode = SMT_REPRESENTATION;
+        this->mode    = SMT_REPRESENTATION;
+        this->printed = 0;
+        this->scopes  = 0;
 
         /* Init representations interface */
         this->representations[SMT_REPRESENTATION]    = std::unique_ptr<AstSmtRepresentation>(new(std::nothrow) AstSmtRepresentation());
         this->representations[PYTHON_REPRESENTATION] = std::unique_ptr<AstPythonRepresentation>(new(std::nothrow) AstPythonRepresentation());
         this->representations[PCODE_REPRESENTATION]  = std::unique_ptr<AstPcodeRepresentation>(new(std::nothrow) AstPcodeRepresentation());
+        this->representations[C_REPRESENTATION]      = std::unique_ptr<AstCRepresentation>(new(std::nothrow) AstCRepresentation());
 
         if (this->representations[SMT_REPRESENTATION] == nullptr)
           throw triton::exceptions::AstRepresentation("AstRepresentation::AstRepresentation(): Cannot allocate a new representation instance.");
@@ -37,6 +43,9 @@ namespace triton {
 
         if (this->representations[PCODE_REPRESENTATION] == nullptr)
           throw triton::exceptions::AstRepresentation("AstRepresentation::AstRepresentation(): Cannot allocate a new representation instance.");
+
+        if (this->representations[C_REPRESENTATION] == nullptr)
+          throw triton::exceptions::AstRepresentation("AstRepresentation::AstRepresentation(): Cannot allocate a new representation instance.");
       }
 
 
@@ -65,7 +74,174 @@ namespace triton {
 
 
       std::ostream& AstRepresentation::print(std::ostream& stream, AbstractNode* node) {
-        return this->representations[this->mode]->print(stream, node);
+        if (this->scopes == 0 && !this->temporaries.empty()) {
+          auto it = this->temporaries.find(node);
+          if (it != this->temporaries.end() && !it->second.second.empty())
+            return stream << it->second.second;
+        }
+
+        if (node->getType() != LET_NODE && node->getType() != FORALL_NODE)
+          return this->representations[this->mode]->print(stream, node);
+
+        /* The bound names may be used by the temporaries */
+        this->scopes++;
+        try {
+          this->representations[this->mode]->print(stream, node);
+        }
+        catch (...) {
+          this->scopes--;
+          throw;
+        }
+        this->scopes--;
+
+        return stream;
+      }
+
+
+      bool AstRepresentation::isTemporary(const SharedAbstractNode& node) const {
+        switch (node->getType()) {
+          case ARRAY_NODE:
+          case ASSERT_NODE:
+          case BV_NODE:
+          case COMPOUND_NODE:
+          case DECLARE_NODE:
+          case FORALL_NODE:
+          case INTEGER_NODE:
+          case LET_NODE:
+          case REFERENCE_NODE:
+          case STRING_NODE:
+          case VARIABLE_NODE:
+            return false;
+
+          default:
+            break;
+        }
+
+        /* The memory of the Python and pseudo code representations is modified by store */
+        if (node->isArray())
+          return (this->mode == SMT_REPRESENTATION);
+
+        return true;
+      }
+
+
+      void AstRepresentation::shareTemporaries(const std::vector<SharedAbstractNode>& roots) {
+        std::unordered_map<const AbstractNode*, triton::usize> uses;
+        std::unordered_map<const AbstractNode*, triton::uint32> depths;
+        std::vector<std::pair<SharedAbstractNode, triton::usize>> worklist;
+        std::vector<SharedAbstractNode> order;
+
+        /* Count the uses of the nodes and sort them children first */
+        for (const auto& root : roots) {
+          if (uses[root.get()]++ != 0)
+            continue;
+
+          worklist.push_back({root, 0});
+          while (!worklist.empty()) {
+            SharedAbstractNode node = worklist.back().first;
+            triton::usize index = worklist.back().second++;
+            const auto& children = node->getChildren();
+
+            if (node->getType() == LET_NODE || node->getType() == FORALL_NODE || index >= children.size()) {
+              order.push_back(node);
+              worklist.pop_back();
+              continue;
+            }
+
+            if (uses[children[index].get()]++ == 0)
+              worklist.push_back({children[index], 0});
+          }
+        }
+
+        /* The depths are counted from the last temporary */
+        for (const auto& node : order) {
+          triton::uint32 depth = 0;
+
+          if (this->temporaries.find(node.get()) != this->temporaries.end()) {
+            depths[node.get()] = 0;
+            continue;
+          }
+
+          for (const auto& child : node->getChildren()) {
+            auto it = depths.find(child.get());
+            if (it != depths.end())
+              depth = std::max(depth, it->second);
+          }
+          depth++;
+
+          if (this->isTemporary(node) && (uses[node.get()] > 1 || depth >= this->maxDepth)) {
+            this->temporaries[node.get()] = {node, ""};
+            depth = 0;
+          }
+
+          depths[node.get()] = depth;
+        }
+      }
+
+
+      std::ostream& AstRepresentation::printTemporaries(std::ostream& stream, const SharedAbstractNode& node) {
+        std::unordered_set<const AbstractNode*> visited;
+        std::vector<std::pair<SharedAbstractNode, triton::usize>> worklist;
+
+        if (this->temporaries.empty())
+          return stream;
+
+        worklist.push_back({node, 0});
+        visited.insert(node.get());
+
+        while (!worklist.empty()) {
+          SharedAbstractNode top = worklist.back().first;
+          triton::usize index = worklist.back().second++;
+          const auto& children = top->getChildren();
+          auto it = this->temporaries.find(top.get());
+          bool defined = (it != this->temporaries.end() && !it->second.second.empty());
+
+          if (!defined && top->getType() != LET_NODE && top->getType() != FORALL_NODE && index < children.size()) {
+            if (visited.insert(children[index].get()).second)
+              worklist.push_back({children[index], 0});
+            continue;
+          }
+
+          worklist.pop_back();
+          if (it == this->temporaries.end() || defined)
+            continue;
+
+          /* The children are defined, print the definition */
+          std::string name = (this->mode == SMT_REPRESENTATION ? "tmp!" : "tmp_") + std::to_string(this->printed++);
+
+          if (this->mode == SMT_REPRESENTATION) {
+            stream << "(define-fun " << name << " () ";
+            if (top->isArray())
+              stream << "(Array (_ BitVec " << std::dec << triton::ast::getIndexSize(top) << ") (_ BitVec 8))";
+            else if (top->isLogical())
+              stream << "Bool";
+            else
+              stream << "(_ BitVec " << std::dec << top->getBitvectorSize() << ")";
+            stream << " ";
+            this->representations[this->mode]->print(stream, top.get());
+            stream << ")" << std::endl;
+          }
+          else if (this->mode == C_REPRESENTATION) {
+            stream << "const " << AstCRepresentation::getType(top.get()) << " " << name << " = ";
+            this->representations[this->mode]->print(stream, top.get());
+            stream << ";" << std::endl;
+          }
+          else {
+            stream << name << " = ";
+            this->representations[this->mode]->print(stream, top.get());
+            stream << std::endl;
+          }
+
+          it->second.second = name;
+        }
+
+        return stream;
+      }
+
+
+      void AstRepresentation::clearTemporaries(void) {
+        this->temporaries.clear();
+        this->printed = 0;
       }
 
     };
@@ -5,11 +5,15 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <stack>
+#include <tuple>
 #include <vector>
 
 #include <triton/coreUtils.hpp>
 #include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/astContext.hpp>
 #include <triton/symbolicExpression.hpp>
 #include <triton/symbolicVariable.hpp>
 #include <triton/tritonToZ3.hpp>
@@ -21,12 +25,15 @@ namespace triton {
 
     TritonToZ3::TritonToZ3(bool eval)
       : context() {
-      this->isEval = eval;
+      this->isEval    = eval;
+      this->sweepSize = 1024;
     }
 
 
     TritonToZ3::~TritonToZ3() {
       /* See #828: Release ownership before calling container destructor */
+      this->origins.clear();
+      this->translations.clear();
       this->symbols.clear();
       this->variables.clear();
     }
@@ -39,17 +46,153 @@ namespace triton {
 
     z3::expr TritonToZ3::convert(const triton::ast::SharedAbstractNode& node) {
       std::unordered_map<triton::ast::SharedAbstractNode, z3::expr> results;
+      std::vector<triton::ast::SharedAbstractNode> order;
+      bool let = false;
 
-      auto nodes = triton::ast::childrenExtraction(node, true /* unroll*/, true /* revert */);
+      if (node == nullptr)
+        throw triton::exceptions::AstLifting("TritonToZ3::convert(): node cannot be null.");
+
+      /*
+       * When not evaluating, a node converted by a previous call is not visited
+       * again, unless it died or changed since. Children go before parents.
+       */
+      if (!this->isEval) {
+        std::stack<std::pair<triton::ast::SharedAbstractNode, bool>> worklist;
+        triton::ast::VisitedNodes visited(node->getContext());
+
+        worklist.push({node, false});
+        while (!worklist.empty() && !let) {
+          triton::ast::SharedAbstractNode current;
+          bool postOrder;
+          std::tie(current, postOrder) = worklist.top();
+          worklist.pop();
+
+          if (postOrder) {
+            order.push_back(current);
+            continue;
+          }
 
-      for (auto&& n : nodes) {
-        results.insert(std::make_pair(n, this->do_convert(n, &results)));
+          if (!visited.insert(current.get()))
+            continue;
+
+          auto it = this->translations.find(current.get());
+          if (it != this->translations.end()) {
+            if (it->second.node.lock() == current && it->second.hash == current->getHash()) {
+              results.insert(std::make_pair(current, it->second.expr));
+              continue;
+            }
+            this->forget(it);
+          }
+
+          /* The conversion of a let depends on the bindings of the query */
+          if (current->getType() == LET_NODE) {
+            let = true;
+            continue;
+          }
+
+          worklist.push({current, true});
+          for (const auto& child : current->getChildren()) {
+            if (!visited.contains(child.get()))
+              worklist.push({child, false});
+          }
+
+          if (current->getType() == REFERENCE_NODE) {
+            const auto& ast = reinterpret_cast<triton::ast::ReferenceNode*>(current.get())->getSymbolicExpression()->getAst();
+            if (!visited.contains(ast.get()))
+              worklist.push({ast, false});
+          }
+        }
+
+        if (!let) {
+          for (auto&& n : order) {
+            z3::expr expr = this->do_convert(n, &results);
+            results.insert(std::make_pair(n, expr));
+            this->translations.emplace(n.get(), Translation{n, n->getHash(), expr});
+            this->origins[Z3_get_ast_id(this->context, expr)] = n.get();
+          }
+
+          this->sweep();
+          return results.at(node);
+        }
+
+        results.clear();
       }
 
+      /* Streamed in topological order, children first */
+      triton::ast::TopologicalSort sort;
+      sort.visit({node.get()}, true /* unroll */, [&](triton::ast::AbstractNode* current) {
+        const SharedAbstractNode n = current->shared_from_this();
+        results.insert(std::make_pair(n, this->do_convert(n, &results)));
+      });
+
       return results.at(node);
     }
 
 
+    void TritonToZ3::sweep(void) {
+      if (this->translations.size() < 2 * this->sweepSize)
+        return;
+
+      for (auto it = this->translations.begin(); it != this->translations.end();) {
+        if (it->second.node.expired())
+          it = this->forget(it);
+        else
+          it++;
+      }
+
+      /* A variable only referenced here has no node left */
+      for (auto it = this->variables.begin(); it != this->variables.end();) {
+        if (it->second.use_count() == 1)
+          it = this->variables.erase(it);
+        else
+          it++;
+      }
+
+      this->sweepSize = std::max<triton::usize>(this->translations.size(), 1024);
+    }
+
+
+    std::unordered_map<const triton::ast::AbstractNode*, TritonToZ3::Translation>::iterator TritonToZ3::forget(std::unordered_map<const triton::ast::AbstractNode*, Translation>::iterator it) {
+      /* Several nodes may share a z3's expression, the last one converted is kept */
+      auto origin = this->origins.find(Z3_get_ast_id(this->context, it->second.expr));
+      if (origin != this->origins.end() && origin->second == it->first)
+        this->origins.erase(origin);
+
+      return this->translations.erase(it);
+    }
+
+
+    triton::ast::SharedAbstractNode TritonToZ3::getOrigin(const z3::expr& expr) const {
+      if (&expr.ctx() != &this->context)
+        return nullptr;
+
+      auto origin = this->origins.find(Z3_get_ast_id(this->context, expr));
+      if (origin == this->origins.end())
+        return nullptr;
+
+      auto it = this->translations.find(origin->second);
+      if (it == this->translations.end())
+        return nullptr;
+
+      /* The node may have died or changed since its conversion */
+      triton::ast::SharedAbstractNode node = it->second.node.lock();
+      if (node == nullptr || node->getHash() != it->second.hash)
+        return nullptr;
+
+      return node;
+    }
+
+
+    triton::usize TritonToZ3::getTranslationsSize(void) const {
+      return this->translations.size();
+    }
+
+
+    z3::context& TritonToZ3::getContext(void) {
+      return this->context;
+    }
+
+
     z3::expr TritonToZ3::do_convert(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::ast::SharedAbstractNode, z3::expr>* results) {
       if (node == nullptr)
         throw triton::exceptions::AstLifting("TritonToZ3::do_convert(): node cannot be null.");
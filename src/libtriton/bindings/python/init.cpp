@@ -86,6 +86,12 @@ namespace triton {
         initConditionsNamespace(conditionsDict);
         PyObject* idConditionsClass = xPyClass_New(nullptr, conditionsDict, xPyString_FromString("CONDITION"));
 
+        /* Create the CONCRETIZATION namespace ======================================================= */
+
+        PyObject* concretizationDict = xPyDict_New();
+        initConcretizationNamespace(concretizationDict);
+        PyObject* idConcretizationClass = xPyClass_New(nullptr, concretizationDict, xPyString_FromString("CONCRETIZATION"));
+
         /* Create the CPUSIZE namespace ============================================================== */
 
         PyObject* cpuSizeDict = xPyDict_New();
@@ -104,6 +110,12 @@ namespace triton {
         initExtendNamespace(extendDict);
         PyObject* idExtendClass = xPyClass_New(nullptr, extendDict, xPyString_FromString("EXTEND"));
 
+        /* Create the FLOW namespace ================================================================= */
+
+        PyObject* flowDict = xPyDict_New();
+        initFlowNamespace(flowDict);
+        PyObject* idFlowClass = xPyClass_New(nullptr, flowDict, xPyString_FromString("FLOW"));
+
         /* Create the VAS namespace ================================================================== */
 
         PyObject* vasDict = xPyDict_New();
@@ -122,6 +134,12 @@ namespace triton {
         initOperandNamespace(operandDict);
         PyObject* idOperandClass = xPyClass_New(nullptr, operandDict, xPyString_FromString("OPERAND"));
 
+        /* Create the PASS namespace ================================================================= */
+
+        PyObject* passDict = xPyDict_New();
+        initPassNamespace(passDict);
+        PyObject* idPassClass = xPyClass_New(nullptr, passDict, xPyString_FromString("PASS"));
+
         /* Create the OPTIMIZATION namespace ========================================================= */
 
         PyObject* modeDict = xPyDict_New();
@@ -134,12 +152,24 @@ namespace triton {
         initPrefixesNamespace(prefixesDict);
         PyObject* idPrefixesClass = xPyClass_New(nullptr, prefixesDict, xPyString_FromString("PREFIX"));
 
+        /* Create the QUERY namespace ================================================================ */
+
+        PyObject* queryDict = xPyDict_New();
+        initQueryNamespace(queryDict);
+        PyObject* idQueryClass = xPyClass_New(nullptr, queryDict, xPyString_FromString("QUERY"));
+
         /* Create the REG namespace ================================================================== */
 
         PyObject* registersDict = xPyDict_New();
         initRegNamespace(registersDict);
         PyObject* idRegClass = xPyClass_New(nullptr, registersDict, xPyString_FromString("REG"));
 
+        /* Create the SCHEDULER namespace ============================================================ */
+
+        PyObject* schedulerDict = xPyDict_New();
+        initSchedulerNamespace(schedulerDict);
+        PyObject* idSchedulerClass = xPyClass_New(nullptr, schedulerDict, xPyString_FromString("SCHEDULER"));
+
         /* Create the SHIFT namespace ================================================================ */
 
         PyObject* shiftsDict = xPyDict_New();
@@ -184,15 +214,20 @@ namespace triton {
         PyModule_AddObject(triton::bindings::python::tritonModule, "AST_NODE",            idAstNodeClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "AST_REPRESENTATION",  idAstRepresentationClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "CALLBACK",            idCallbackClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "CONCRETIZATION",      idConcretizationClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "CONDITION",           idConditionsClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "CPUSIZE",             idCpuSizeClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "EXCEPTION",           idExceptionClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "EXTEND",              idExtendClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "FLOW",                idFlowClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "MODE",                idModeClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "OPCODE",              idOpcodesClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "OPERAND",             idOperandClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "PASS",                idPassClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "PREFIX",              idPrefixesClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "QUERY",               idQueryClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "REG",                 idRegClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "SCHEDULER",           idSchedulerClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "SHIFT",               idShiftsClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "SOLVER",              idSolverClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "SOLVER_STATE",        idSolverStateClass);
@@ -35,13 +35,16 @@ to wrap more generic concepts.
 - \ref py_AstNode_page
 - \ref py_BasicBlock_page
 - \ref py_BitsVector_page
+- \ref py_Explorer_page
 - \ref py_Immediate_page
 - \ref py_Instruction_page
 - \ref py_MemoryAccess_page
 - \ref py_PathConstraint_page
 - \ref py_Register_page
+- \ref py_SolverFuture_page
 - \ref py_SolverModel_page
 - \ref py_SymbolicExpression_page
+- \ref py_SymbolicIterator_page
 - \ref py_SymbolicVariable_page
 - \ref py_TritonContext_page
 
@@ -52,15 +55,20 @@ to wrap more generic concepts.
 - \ref py_AST_NODE_page
 - \ref py_AST_REPRESENTATION_page
 - \ref py_CALLBACK_page
+- \ref py_CONCRETIZATION_page
 - \ref py_CONDITION_page
 - \ref py_CPUSIZE_page
 - \ref py_EXCEPTION_page
 - \ref py_EXTEND_page
+- \ref py_FLOW_page
 - \ref py_MODE_page
 - \ref py_OPCODE_page
 - \ref py_OPERAND_page
+- \ref py_PASS_page
 - \ref py_PREFIX_page
+- \ref py_QUERY_page
 - \ref py_REG_page
+- \ref py_SCHEDULER_page
 - \ref py_SHIFT_page
 - \ref py_SOLVER_STATE_page
 - \ref py_SOLVER_page
@@ -115,6 +123,21 @@ namespace triton {
         }
       }
 
+      static PyObject* triton_Explorer(PyObject* self, PyObject* args) {
+        PyObject* setup  = nullptr;
+        PyObject* inject = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &setup, &inject) == false) {
+          return PyErr_Format(PyExc_TypeError, "Explorer(): Invalid constructor.");
+        }
+
+        if (setup == nullptr || !PyCallable_Check(setup) || inject == nullptr || !PyCallable_Check(inject))
+          return PyErr_Format(PyExc_TypeError, "Explorer(): Expects a setup and an inject function as arguments.");
+
+        return PyExplorer(setup, inject);
+      }
+
       static PyObject* triton_Immediate(PyObject* self, PyObject* args) {
         PyObject* value = nullptr;
         PyObject* size  = nullptr;
@@ -233,6 +256,7 @@ namespace triton {
 
       PyMethodDef tritonCallbacks[] = {
         {"BasicBlock",      (PyCFunction)triton_BasicBlock,       METH_VARARGS,   ""},
+        {"Explorer",        (PyCFunction)triton_Explorer,         METH_VARARGS,   ""},
         {"Immediate",       (PyCFunction)triton_Immediate,        METH_VARARGS,   ""},
         {"Instruction",     (PyCFunction)triton_Instruction,      METH_VARARGS,   ""},
         {"MemoryAccess",    (PyCFunction)triton_MemoryAccess,     METH_VARARGS,   ""},
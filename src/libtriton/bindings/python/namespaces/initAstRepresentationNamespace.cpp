@@ -28,6 +28,9 @@ The AST_REPRESENTATION namespace contains all kinds of AST representations.
 - **AST_REPRESENTATION.SMT**<br>
 Enabled, AST expressions will be represented in the SMT2-Lib syntax. This is the default mode.
 
+- **AST_REPRESENTATION.C**<br>
+Enabled, AST expressions will be represented in the C syntax.
+
 - **AST_REPRESENTATION.PCODE**<br>
 Enabled, AST expressions will be represented in a pseudo code syntax.
 
@@ -104,6 +107,7 @@ namespace triton {
 
       void initAstRepresentationNamespace(PyObject* astRepresentationDict) {
         xPyDict_SetItemString(astRepresentationDict, "SMT",    PyLong_FromUint32(triton::ast::representations::SMT_REPRESENTATION));
+        xPyDict_SetItemString(astRepresentationDict, "C",      PyLong_FromUint32(triton::ast::representations::C_REPRESENTATION));
         xPyDict_SetItemString(astRepresentationDict, "PCODE", PyLong_FromUint32(triton::ast::representations::PCODE_REPRESENTATION));
         xPyDict_SetItemString(astRepresentationDict, "PYTHON", PyLong_FromUint32(triton::ast::representations::PYTHON_REPRESENTATION));
       }
@@ -31,6 +31,12 @@ The CALLBACK namespace contains all kinds of callbacks.
 \section CALLBACK_py_api Python API - Items of the CALLBACK namespace
 <hr>
 
+- **CALLBACK.GET_CONCRETE_MEMORY_PAGE**<br>
+The callback takes as arguments a \ref py_TritonContext_page and the base address of a page. Callbacks will be called once, the first time
+that the Triton library will touch a page (4096 bytes) of memory which has no defined concrete value. The callback must return the content
+of the page as bytes (at most 4096 bytes), or None if it does not provide the page. The provided bytes are concrete values only, they are
+not concretized in the symbolic memory and do not trigger the other callbacks.
+
 - **CALLBACK.GET_CONCRETE_MEMORY_VALUE**<br>
 The callback takes as arguments a \ref py_TritonContext_page and a \ref py_MemoryAccess_page. Callbacks will be called each time that the
 Triton library will need to LOAD a concrete memory value. The callback must return nothing.
@@ -61,6 +67,7 @@ namespace triton {
     namespace python {
 
       void initCallbackNamespace(PyObject* callbackDict) {
+        xPyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_PAGE",    PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_PAGE));
         xPyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_VALUE",   PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_VALUE));
         xPyDict_SetItemString(callbackDict, "GET_CONCRETE_REGISTER_VALUE", PyLong_FromUint32(triton::callbacks::GET_CONCRETE_REGISTER_VALUE));
         xPyDict_SetItemString(callbackDict, "SET_CONCRETE_MEMORY_VALUE",   PyLong_FromUint32(triton::callbacks::SET_CONCRETE_MEMORY_VALUE));
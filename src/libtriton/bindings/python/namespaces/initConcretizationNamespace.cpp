@@ -0,0 +1,68 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/pythonBindings.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+#include <triton/symbolicEnums.hpp>
+
+
+
+/*! \page py_CONCRETIZATION_page CONCRETIZATION
+    \brief [**python api**] All information about the CONCRETIZATION Python namespace.
+
+\tableofcontents
+
+\section CONCRETIZATION_py_description Description
+<hr>
+
+The CONCRETIZATION namespace contains all the rules concretizing the registers and memory cells written by the
+instructions, evaluated after the processing of each instruction. Each concretization is recorded and returned
+by `TritonContext.getConcretizationEvents()`.
+
+~~~~~~~~~~~~~{.py}
+>>> ctx.addConcretizationRule(CONCRETIZATION.LARGE_EXPRESSIONS, 1000)
+>>> ctx.addConcretizationRule(CONCRETIZATION.HOT_ADDRESSES, 64)
+>>> ctx.addConcretizationRule(CONCRETIZATION.OUTSIDE_REGIONS)
+>>> ctx.addSymbolicRegion(0x1000, 0x100)
+~~~~~~~~~~~~~
+
+\section CONCRETIZATION_py_api Python API - Items of the CONCRETIZATION namespace
+<hr>
+
+- **CONCRETIZATION.HOOK**<br>
+Concretizes the writes of the instructions for which the hook returns true. The hook is only set from C++.
+
+- **CONCRETIZATION.HOT_ADDRESSES**<br>
+Concretizes the writes of an instruction processed more times than the threshold.
+
+- **CONCRETIZATION.LARGE_EXPRESSIONS**<br>
+Concretizes the registers written whose AST has more nodes than the threshold.
+
+- **CONCRETIZATION.OUTSIDE_REGIONS**<br>
+Concretizes the memory cells written outside the symbolic regions declared with `TritonContext.addSymbolicRegion()`.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initConcretizationNamespace(PyObject* concretizationDict) {
+        PyDict_Clear(concretizationDict);
+
+        xPyDict_SetItemString(concretizationDict, "HOOK",              PyLong_FromUint32(triton::engines::symbolic::CONCRETIZATION_HOOK));
+        xPyDict_SetItemString(concretizationDict, "HOT_ADDRESSES",     PyLong_FromUint32(triton::engines::symbolic::CONCRETIZATION_HOT_ADDRESSES));
+        xPyDict_SetItemString(concretizationDict, "LARGE_EXPRESSIONS", PyLong_FromUint32(triton::engines::symbolic::CONCRETIZATION_LARGE_EXPRESSIONS));
+        xPyDict_SetItemString(concretizationDict, "OUTSIDE_REGIONS",   PyLong_FromUint32(triton::engines::symbolic::CONCRETIZATION_OUTSIDE_REGIONS));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
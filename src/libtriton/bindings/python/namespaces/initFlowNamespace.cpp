@@ -0,0 +1,72 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/archEnums.hpp>
+#include <triton/pythonBindings.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+
+
+
+/*! \page py_FLOW_page FLOW
+    \brief [**python api**] All information about the FLOW Python namespace.
+
+\tableofcontents
+
+\section FLOW_py_description Description
+<hr>
+
+The FLOW namespace contains the classes of control flow returned by `TritonContext.decode()`.
+
+~~~~~~~~~~~~~{.py}
+>>> ctx.setArchitecture(ARCH.X86_64)
+>>> info = ctx.decode(b"\x74\x10", 0x1000)
+>>> info['flow'] == FLOW.COND_JUMP
+True
+>>> hex(info['target'])
+'0x1012'
+~~~~~~~~~~~~~
+
+\section FLOW_py_api Python API - Items of the FLOW namespace
+<hr>
+
+- **FLOW.CALL**<br>
+A call.
+
+- **FLOW.COND_JUMP**<br>
+A conditional jump.
+
+- **FLOW.JUMP**<br>
+An unconditional jump.
+
+- **FLOW.NONE**<br>
+The execution goes on with the next instruction.
+
+- **FLOW.RETURN**<br>
+A return.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initFlowNamespace(PyObject* flowDict) {
+        PyDict_Clear(flowDict);
+
+        xPyDict_SetItemString(flowDict, "CALL",      PyLong_FromUint32(triton::arch::FLOW_CALL));
+        xPyDict_SetItemString(flowDict, "COND_JUMP", PyLong_FromUint32(triton::arch::FLOW_COND_JUMP));
+        xPyDict_SetItemString(flowDict, "JUMP",      PyLong_FromUint32(triton::arch::FLOW_JUMP));
+        xPyDict_SetItemString(flowDict, "NONE",      PyLong_FromUint32(triton::arch::FLOW_NONE));
+        xPyDict_SetItemString(flowDict, "RETURN",    PyLong_FromUint32(triton::arch::FLOW_RETURN));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
@@ -34,8 +34,50 @@ The MODE namespace contains all kinds of modes.
 - **MODE.ALIGNED_MEMORY**<br>
 Keeps a map of aligned memory to reduce the symbolic memory explosion of `LOAD` and `STORE` accesses.
 
+- **MODE.AST_BALANCING**<br>
+Keeps the chains of `bvadd`, `bvand`, `bvmul`, `bvor`, `bvxor`, `land` and `lor` balanced while they are built one operand
+at a time, e.g. the sums accumulated by a loop: `(a + b) + c` is built as `a + (b + c)` when `b` and `c` have about the same
+depth, through the references. The queries given to the solver are also flattened by `AstContext.balance()`. The depth of
+such chains becomes logarithmic in their length.
+
+- **MODE.AST_CONCURRENT**<br>
+Lets several threads build nodes in the same AST context, e.g. to lift the basic blocks of a function in parallel or to
+run simplification passes over one expression store. Each thread takes the ids of its nodes by batches, and their slabs
+in `AST_SLAB_ALLOCATOR` mode, from its own state. The interned nodes of `AST_HASH_CONSING` are sharded, each shard with its
+own lock, and the shared constants, the variables and the abstract values are locked. The nodes must still not be modified
+in place while other threads use them, and the modes must not change while nodes are built. The ids of the symbolic
+expressions and variables are atomic whatever the mode.
+
+- **MODE.AST_HASH_CONSING**<br>
+Shares the structurally identical nodes built by the AST context, so that an identical sub-tree is one node. Nodes are
+interned when built, nodes created before the mode is enabled are not. A shared node must not be modified in place
+(e.g. `setChild`) unless the change keeps its semantics, as every AST sharing it sees the change.
+
 - **MODE.AST_OPTIMIZATIONS**<br>
-Reduces the depth of the trees using classical arithmetic optimisations.
+Reduces the depth of the trees using classical arithmetic optimisations. Selects also skip the stores to provably distinct
+indexes, and the store chain of the MEMORY_ARRAY mode is periodically compacted to the last store of each address. The bitvector
+nodes whose bits are all known, from the known bits and ranges of their operands, are replaced by their constant.
+
+- **MODE.AST_SLAB_ALLOCATOR**<br>
+Allocates the nodes in slabs owned by the AST context, one free list per node size, instead of one heap allocation
+per node. Freed nodes are reused by the next ones and the slabs are released all at once with the last node of the
+context, e.g. after a `reset()`. The mode applies to the nodes built while it is enabled.
+
+- **MODE.AST_WIDE_HASH**<br>
+Computes the 512-bit hash of the nodes in addition to their 64-bit structural hash, and returns it from
+`getHash()`. The 64-bit hash is much cheaper to compute but may collide, enable this mode when the hashes are used
+to tell ASTs apart (e.g. `equalTo()`). The mode applies to the nodes built while it is enabled.
+
+- **MODE.BULK_STRING_INSTRUCTIONS**<br>
+Executes all the iterations of the x86 `movs`, `stos`, `cmps` and `scas` instructions with a REP prefix in one
+`processing()`, when the counter, the indexes and the direction flag are concrete. The concrete elements are copied
+natively and concretized, and only the symbolic ones get an expression. `cmps` and `scas` stop at the first symbolic
+element, which is left to the semantics of one iteration at the next `processing()`, or after the one ending the loop.
+The instruction only records the memory accesses of the symbolic elements. This mode is ignored while the undo journal
+or `MEMORY_ARRAY` is enabled.
+
+- **MODE.CONCRETE_FAST_PATH**<br>
+Emulates natively the common x86 ALU, load/store and branch instructions whose registers and memory cells are neither symbolized nor tainted. They update the concrete state only, without building their expressions, and overwritten registers and memory cells are concretized. The other instructions go through the semantics. This mode is ignored while the undo journal or `MEMORY_ARRAY` is enabled, and conditional branches are only emulated with `PC_TRACKING_SYMBOLIC`.
 
 - **MODE.CONCRETIZE_UNDEFINED_REGISTERS**<br>
 Concretizes every register tagged as undefined (see #750).
@@ -43,18 +85,57 @@ Concretizes every register tagged as undefined (see #750).
 - **MODE.CONSTANT_FOLDING**<br>
 Performs a constant folding optimization of sub ASTs which do not contain symbolic variables.
 
+- **MODE.EFFECTIVE_ADDRESS_CACHE**<br>
+Keeps the effective address AST of each memory operand of the processed instructions, and reuses it as long as the expressions of its base, index and segment registers are unchanged. The effective addresses built from concrete registers only are folded into a constant.
+
+- **MODE.LAZY_FLAGS**<br>
+Builds the flag expressions of arithmetic instructions only once a flag is read or the basic block ends. Flags overwritten before being read never get an expression, and are not listed in the written registers of their instruction.
+
+- **MODE.LAZY_SUBREGISTERS**<br>
+Keeps the writes of the byte and word sub-registers (`al`, `ah`, `ax`, ...) as slices apart from the expression of their parent, instead of rebuilding the parent with a concatenation on each write. A read inside a slice takes its expression, and a read beside the slices takes the previous expression of the parent. The parent gets a merged expression only once it is read across a slice, or once its expression is queried. Disabled while the undo journal is enabled.
+
+- **MODE.LOOP_SUMMARIZATION**<br>
+Detects the loops of the trace closed by a branch going back to a previous address. From the second iteration, the path constraints of the iterations implied by the previous ones (concrete conditions) are dropped, and the registers incremented by the same value on each iteration are rewritten as `base + count * step` instead of a chain of additions. Once a loop with a symbolic condition is unrolled up to the bound of `setLoopUnrollBound()`, the variables of its condition are pinned to their concrete value by path constraints, and the registers only over pinned variables are concretized. The loops are reported by `getLoopSummaries()`.
+
+- **MODE.MBA_SIMPLIFICATION**<br>
+Normalizes in `simplify()` the linear mixed boolean-arithmetic subtrees: the sums of bitwise expressions multiplied by constants.
+The operands of the bitwise operators that are not bitwise, up to 6 of them, are the atoms of the subtree. Its coefficients over
+the conjunctions of its atoms are computed by evaluating it on the inputs where each atom is 0 or 1, and the subtree is replaced
+by the smallest of their sum and, if it has at most 3 atoms, of a bitwise expression multiplied by a constant, when it has fewer
+nodes. For example, `(x ^ y) + 2 * (x & y)` is simplified into `x + y`.
+
 - **MODE.MEMORY_ARRAY**<br>
 Enables symbolic pointers reasoning (QF_ABV logic). When this mode is not enabled, which is the case by default, the QF_BV memory model is applied.
 
 - **MODE.ONLY_ON_SYMBOLIZED**<br>
-Removes symbolic expressions that does not contain symbolic variable.
+Removes symbolic expressions that does not contain symbolic variable. The instructions whose registers and memory cells are neither symbolized nor tainted are emulated as with `CONCRETE_FAST_PATH`, without building their expressions.
 
 - **MODE.ONLY_ON_TAINTED**<br>
-Removes symbolic expressions that are not tainted.
+Removes symbolic expressions that are not tainted. The instructions whose registers and memory cells are not tainted, symbolized or not, are emulated as with `CONCRETE_FAST_PATH`, without building their expressions.
+
+- **MODE.PC_DEDUPLICATION**<br>
+Does not push a path constraint which takes the same branch, from the same address, as a constraint of the path under a structurally
+equal predicate, the references being compared by their expressions. As the path predicate is a conjunction, it does not change, and
+the loops of a long trace do not repeat the same constraints. Disabled by default.
 
 - **MODE.PC_TRACKING_SYMBOLIC**<br>
 Tracks path constraints only if they are symbolized. This mode is enabled by default.
 
+- **MODE.POINTER_RESOLUTION**<br>
+Resolves the symbolic pointers of the loads and stores to their addresses instead of concretizing them. The addresses are
+computed from a strided interval of the pointer, given by the ranges of its variables and the known bits of its masks, or
+else enumerated by the solver under the path predicate, up to `getPointerResolutionBound()` addresses. A load is an `ite`
+chain on the pointer over the cells of its addresses, and a store writes each address under the condition that the pointer
+is equal to it. The pointers with more addresses are concretized, or kept symbolic through the array with `MEMORY_ARRAY` and
+`SYMBOLIZE_LOAD`/`SYMBOLIZE_STORE`. Disabled by default.
+
+- **MODE.STATE_MERGING**<br>
+Merges the sides of the short forward branches with a symbolic condition, the ones of an if-then or of an if-then-else of
+straight-line code up to `getMergeDistance()` bytes each. The side not taken runs apart on a fork of the context, then, once the
+side taken reaches the join point, the registers and memory cells written by both sides get an `ite` on the predicate of the side
+taken, and one state continues. The path constraint of the branch is moved to `getMergedPathConstraints()`. Only the instructions
+processed one by one are merged, the diamonds being detected on x86 only. Disabled by default.
+
 - **MODE.SYMBOLIZE_INDEX_ROTATION**<br>
 Symbolizes the index of rotation for `bvror` and `bvrol` nodes. This mode increases the complexity of solving.
 
@@ -64,6 +145,11 @@ Keeps symbolic expressions on load indexes (concretize them otherwise).
 - **MODE.SYMBOLIZE_STORE**<br>
 Keeps symbolic expressions on store indexes (concretize them otherwise).
 
+- **MODE.TAINT_ONLY**<br>
+Spreads the taint of the common x86 instructions from their operands, without building their semantics nor updating the
+concrete state, which is expected to be synchronized by the caller (e.g. from a trace). The addresses of the memory operands
+are computed from the concrete registers. The other instructions go through their semantics.
+
 - **MODE.TAINT_THROUGH_POINTERS**<br>
 Spreads taint in non `MEMORY_ARRAY` mode if an index pointer is tainted (see #725).
 
@@ -77,16 +163,32 @@ namespace triton {
 
       void initModeNamespace(PyObject* modeDict) {
         xPyDict_SetItemString(modeDict, "ALIGNED_MEMORY",                 PyLong_FromUint32(triton::modes::ALIGNED_MEMORY));
+        xPyDict_SetItemString(modeDict, "AST_BALANCING",                  PyLong_FromUint32(triton::modes::AST_BALANCING));
+        xPyDict_SetItemString(modeDict, "AST_CONCURRENT",                 PyLong_FromUint32(triton::modes::AST_CONCURRENT));
+        xPyDict_SetItemString(modeDict, "AST_HASH_CONSING",               PyLong_FromUint32(triton::modes::AST_HASH_CONSING));
         xPyDict_SetItemString(modeDict, "AST_OPTIMIZATIONS",              PyLong_FromUint32(triton::modes::AST_OPTIMIZATIONS));
+        xPyDict_SetItemString(modeDict, "AST_SLAB_ALLOCATOR",             PyLong_FromUint32(triton::modes::AST_SLAB_ALLOCATOR));
+        xPyDict_SetItemString(modeDict, "AST_WIDE_HASH",                  PyLong_FromUint32(triton::modes::AST_WIDE_HASH));
+        xPyDict_SetItemString(modeDict, "BULK_STRING_INSTRUCTIONS",       PyLong_FromUint32(triton::modes::BULK_STRING_INSTRUCTIONS));
+        xPyDict_SetItemString(modeDict, "CONCRETE_FAST_PATH",             PyLong_FromUint32(triton::modes::CONCRETE_FAST_PATH));
         xPyDict_SetItemString(modeDict, "CONCRETIZE_UNDEFINED_REGISTERS", PyLong_FromUint32(triton::modes::CONCRETIZE_UNDEFINED_REGISTERS));
         xPyDict_SetItemString(modeDict, "CONSTANT_FOLDING",               PyLong_FromUint32(triton::modes::CONSTANT_FOLDING));
+        xPyDict_SetItemString(modeDict, "EFFECTIVE_ADDRESS_CACHE",        PyLong_FromUint32(triton::modes::EFFECTIVE_ADDRESS_CACHE));
+        xPyDict_SetItemString(modeDict, "LAZY_FLAGS",                     PyLong_FromUint32(triton::modes::LAZY_FLAGS));
+        xPyDict_SetItemString(modeDict, "LAZY_SUBREGISTERS",              PyLong_FromUint32(triton::modes::LAZY_SUBREGISTERS));
+        xPyDict_SetItemString(modeDict, "LOOP_SUMMARIZATION",             PyLong_FromUint32(triton::modes::LOOP_SUMMARIZATION));
+        xPyDict_SetItemString(modeDict, "MBA_SIMPLIFICATION",             PyLong_FromUint32(triton::modes::MBA_SIMPLIFICATION));
         xPyDict_SetItemString(modeDict, "MEMORY_ARRAY",                   PyLong_FromUint32(triton::modes::MEMORY_ARRAY));
         xPyDict_SetItemString(modeDict, "ONLY_ON_SYMBOLIZED",             PyLong_FromUint32(triton::modes::ONLY_ON_SYMBOLIZED));
         xPyDict_SetItemString(modeDict, "ONLY_ON_TAINTED",                PyLong_FromUint32(triton::modes::ONLY_ON_TAINTED));
+        xPyDict_SetItemString(modeDict, "PC_DEDUPLICATION",               PyLong_FromUint32(triton::modes::PC_DEDUPLICATION));
         xPyDict_SetItemString(modeDict, "PC_TRACKING_SYMBOLIC",           PyLong_FromUint32(triton::modes::PC_TRACKING_SYMBOLIC));
+        xPyDict_SetItemString(modeDict, "POINTER_RESOLUTION",             PyLong_FromUint32(triton::modes::POINTER_RESOLUTION));
+        xPyDict_SetItemString(modeDict, "STATE_MERGING",                  PyLong_FromUint32(triton::modes::STATE_MERGING));
         xPyDict_SetItemString(modeDict, "SYMBOLIZE_INDEX_ROTATION",       PyLong_FromUint32(triton::modes::SYMBOLIZE_INDEX_ROTATION));
         xPyDict_SetItemString(modeDict, "SYMBOLIZE_LOAD",                 PyLong_FromUint32(triton::modes::SYMBOLIZE_LOAD));
         xPyDict_SetItemString(modeDict, "SYMBOLIZE_STORE",                PyLong_FromUint32(triton::modes::SYMBOLIZE_STORE));
+        xPyDict_SetItemString(modeDict, "TAINT_ONLY",                     PyLong_FromUint32(triton::modes::TAINT_ONLY));
         xPyDict_SetItemString(modeDict, "TAINT_THROUGH_POINTERS",         PyLong_FromUint32(triton::modes::TAINT_THROUGH_POINTERS));
       }
 
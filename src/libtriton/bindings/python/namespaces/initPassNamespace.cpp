@@ -0,0 +1,59 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/pythonBindings.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+#include <triton/symbolicEnums.hpp>
+
+
+
+/*! \page py_PASS_page PASS
+    \brief [**python api**] All information about the PASS Python namespace.
+
+\tableofcontents
+
+\section PASS_py_description Description
+<hr>
+
+The PASS namespace contains all the passes of the basic block optimizations run by `TritonContext.optimize()`.
+
+~~~~~~~~~~~~~{.py}
+>>> blocks, stats = ctx.optimize([block1, block2], [PASS.OPAQUE_PREDICATES, PASS.REDUNDANT_WRITES, PASS.DEAD_STORES])
+~~~~~~~~~~~~~
+
+\section PASS_py_api Python API - Items of the PASS namespace
+<hr>
+
+- **PASS.DEAD_STORES**<br>
+Removes the instructions whose writes are dead, the flags included.
+
+- **PASS.OPAQUE_PREDICATES**<br>
+Resolves the conditional branches whose condition is constant. A branch never taken is removed, a branch always taken is kept.
+
+- **PASS.REDUNDANT_WRITES**<br>
+Removes the instructions writing the values already held, constants and copies included.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initPassNamespace(PyObject* passDict) {
+        PyDict_Clear(passDict);
+
+        xPyDict_SetItemString(passDict, "DEAD_STORES",       PyLong_FromUint32(triton::engines::symbolic::PASS_DEAD_STORES));
+        xPyDict_SetItemString(passDict, "OPAQUE_PREDICATES", PyLong_FromUint32(triton::engines::symbolic::PASS_OPAQUE_PREDICATES));
+        xPyDict_SetItemString(passDict, "REDUNDANT_WRITES",  PyLong_FromUint32(triton::engines::symbolic::PASS_REDUNDANT_WRITES));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
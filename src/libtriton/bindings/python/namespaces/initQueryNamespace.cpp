@@ -0,0 +1,61 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/pythonBindings.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+#include <triton/solverEnums.hpp>
+
+
+
+/*! \page py_QUERY_page QUERY
+    \brief [**python api**] All information about the QUERY Python namespace.
+
+\tableofcontents
+
+\section QUERY_py_description Description
+<hr>
+
+The QUERY namespace contains the classes of solver queries, each solved with its own configuration (see
+`TritonContext.setQueryConfiguration()`).
+
+\section QUERY_py_api Python API - Items of the QUERY namespace
+<hr>
+
+- **QUERY.ANY**<br>
+Any query, e.g. with quantifiers, or every query if they are not classified. By default, the solvers detect its logic.
+
+- **QUERY.EQUALITIES**<br>
+The equalities of variables, constants, extractions and concatenations. By default, z3 bit-blasts them with the
+`simplify;solve-eqs;bit-blast;sat` tactics.
+
+- **QUERY.QF_ABV**<br>
+The quantifier-free bit-vectors over the memory array. By default, z3 uses its `QF_ABV` solver.
+
+- **QUERY.QF_BV**<br>
+The quantifier-free bit-vectors. By default, z3 uses its `QF_BV` solver.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initQueryNamespace(PyObject* queryDict) {
+        PyDict_Clear(queryDict);
+
+        xPyDict_SetItemString(queryDict, "ANY",        PyLong_FromUint32(triton::engines::solver::QUERY_ANY));
+        xPyDict_SetItemString(queryDict, "EQUALITIES", PyLong_FromUint32(triton::engines::solver::QUERY_EQUALITIES));
+        xPyDict_SetItemString(queryDict, "QF_ABV",     PyLong_FromUint32(triton::engines::solver::QUERY_QF_ABV));
+        xPyDict_SetItemString(queryDict, "QF_BV",      PyLong_FromUint32(triton::engines::solver::QUERY_QF_BV));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
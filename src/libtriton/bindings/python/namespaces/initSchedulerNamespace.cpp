@@ -0,0 +1,67 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/explorerEnums.hpp>
+#include <triton/pythonBindings.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+
+
+
+/*! \page py_SCHEDULER_page SCHEDULER
+    \brief [**python api**] All information about the SCHEDULER Python namespace.
+
+\tableofcontents
+
+\section SCHEDULER_py_description Description
+<hr>
+
+The SCHEDULER namespace contains all the orders of the tasks of an \ref py_Explorer_page.
+
+~~~~~~~~~~~~~{.py}
+>>> explorer.setScheduler(SCHEDULER.COVERAGE)
+~~~~~~~~~~~~~
+
+\section SCHEDULER_py_api Python API - Items of the SCHEDULER namespace
+<hr>
+
+- **SCHEDULER.BFS**<br>
+The inputs of the lowest generation first.
+
+- **SCHEDULER.COST**<br>
+The flips whose path prefix timed out the least first, the others being deferred.
+
+- **SCHEDULER.COVERAGE**<br>
+The inputs of the runs which covered the most new edges first.
+
+- **SCHEDULER.CUSTOM**<br>
+The order of the priority hook.
+
+- **SCHEDULER.DFS**<br>
+The most recent inputs first, on the work-stealing queues of the workers (default).
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initSchedulerNamespace(PyObject* schedulerDict) {
+        PyDict_Clear(schedulerDict);
+
+        xPyDict_SetItemString(schedulerDict, "BFS",      PyLong_FromUint32(triton::engines::exploration::SCHEDULER_BFS));
+        xPyDict_SetItemString(schedulerDict, "COST",     PyLong_FromUint32(triton::engines::exploration::SCHEDULER_COST));
+        xPyDict_SetItemString(schedulerDict, "COVERAGE", PyLong_FromUint32(triton::engines::exploration::SCHEDULER_COVERAGE));
+        xPyDict_SetItemString(schedulerDict, "CUSTOM",   PyLong_FromUint32(triton::engines::exploration::SCHEDULER_CUSTOM));
+        xPyDict_SetItemString(schedulerDict, "DFS",      PyLong_FromUint32(triton::engines::exploration::SCHEDULER_DFS));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
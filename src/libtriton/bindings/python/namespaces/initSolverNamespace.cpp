@@ -27,6 +27,9 @@ The SOLVER namespace contains all kinds of solver status.
 
 - **SOLVER.Z3**
 - **SOLVER.BITWUZLA**
+- **SOLVER.PORTFOLIO**: z3 and Bitwuzla race on each query, the first definitive answer is returned.
+- **SOLVER.REMOTE**: the queries are solved by remote workers, see `TritonContext.setRemoteSolver()`.
+- **SOLVER.BITBLAST**: the queries are bit-blasted to an embedded SAT solver, without arrays nor quantifiers.
 
 */
 
@@ -45,6 +48,13 @@ namespace triton {
         #if defined(TRITON_BITWUZLA_INTERFACE)
         xPyDict_SetItemString(solverDict, "BITWUZLA", PyLong_FromUint32(triton::engines::solver::SOLVER_BITWUZLA));
         #endif
+        #if defined(TRITON_Z3_INTERFACE) && defined(TRITON_BITWUZLA_INTERFACE)
+        xPyDict_SetItemString(solverDict, "PORTFOLIO", PyLong_FromUint32(triton::engines::solver::SOLVER_PORTFOLIO));
+        #endif
+        #if defined(TRITON_REMOTE_INTERFACE)
+        xPyDict_SetItemString(solverDict, "REMOTE", PyLong_FromUint32(triton::engines::solver::SOLVER_REMOTE));
+        #endif
+        xPyDict_SetItemString(solverDict, "BITBLAST", PyLong_FromUint32(triton::engines::solver::SOLVER_BITBLAST));
       }
 
     }; /* python namespace */
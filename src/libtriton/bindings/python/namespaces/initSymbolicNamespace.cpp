@@ -20,11 +20,13 @@
 \section SYMBOLIC_py_description Description
 <hr>
 
-The SYMBOLIC namespace contains all types of symbolic expressions and variables.
+The SYMBOLIC namespace contains all types of symbolic expressions and variables, and the policies of the AST budget.
 
 \section SYMBOLIC_py_api Python API - Items of the SYMBOLIC namespace
 <hr>
 
+- **SYMBOLIC.BUDGET_CONCRETIZE**
+- **SYMBOLIC.BUDGET_RECORD**
 - **SYMBOLIC.MEMORY_EXPRESSION**
 - **SYMBOLIC.MEMORY_VARIABLE**
 - **SYMBOLIC.REGISTER_EXPRESSION**
@@ -41,6 +43,8 @@ namespace triton {
     namespace python {
 
       void initSymbolicNamespace(PyObject* symbolicDict) {
+        xPyDict_SetItemString(symbolicDict, "BUDGET_CONCRETIZE",     PyLong_FromUint32(triton::engines::symbolic::BUDGET_CONCRETIZE));
+        xPyDict_SetItemString(symbolicDict, "BUDGET_RECORD",         PyLong_FromUint32(triton::engines::symbolic::BUDGET_RECORD));
         xPyDict_SetItemString(symbolicDict, "MEMORY_EXPRESSION",     PyLong_FromUint32(triton::engines::symbolic::MEMORY_EXPRESSION));
         xPyDict_SetItemString(symbolicDict, "MEMORY_VARIABLE",       PyLong_FromUint32(triton::engines::symbolic::MEMORY_VARIABLE));
         xPyDict_SetItemString(symbolicDict, "REGISTER_EXPRESSION",   PyLong_FromUint32(triton::engines::symbolic::REGISTER_EXPRESSION));
@@ -66,12 +66,18 @@ e.g: `(Array (_ BitVec addrSize) (_ BitVec 8))`.
 Creates a `assert` node.
 e.g: `(assert node)`.
 
+- <b>\ref py_AstNode_page balance(\ref py_AstNode_page node)</b><br>
+Returns `node` with its chains of `bvadd`, `bvand`, `bvmul`, `bvor`, `bvxor`, `land` and `lor` flattened, through the references.
+The chains of `land` and `lor` become one n-ary node, the others a balanced tree of their operands in the same order.
+`node` is not modified.
+
 - <b>\ref py_AstNode_page bswap(\ref py_AstNode_page node)</b><br>
 Creates a `bswap` node.
 e.g: `(bswap node)`.
 
 - <b>\ref py_AstNode_page bv(integer value, integer size)</b><br>
-Creates a `bv` node (bitvector). The `size` must be in bits.<br>
+Creates a `bv` node (bitvector). The `size` must be in bits. The nodes of the small values are shared by the context,
+they must not be modified.<br>
 e.g: `(_ bv<balue> size)`.
 
 - <b>\ref py_AstNode_page bvadd(\ref py_AstNode_page node1, \ref py_AstNode_page node2)</b><br>
@@ -286,6 +292,12 @@ Duplicates the node and returns a new instance as \ref py_AstNode_page.
 - <b>[\ref py_AstNode_page, ...] search(\ref py_AstNode_page node, \ref py_AST_NODE_page match)</b><br>
 Returns a list of collected matched nodes via a depth-first pre order traversal.
 
+- <b>\ref py_AstNode_page substitute(\ref py_AstNode_page node, [(\ref py_AstNode_page, \ref py_AstNode_page), ...] mapping, bool inplace=False)</b><br>
+Rebuilds `node` with each node of the first elements of `mapping` replaced by the second element, sharing the unchanged
+subtrees. A variable is replaced through its node (e.g: `variable(symVar)`). If `node` is a list of nodes, returns the list
+of their results. If `inplace` is true, the nodes are changed in place instead of being rebuilt, which must only be done on
+nodes not used elsewhere.
+
 - <b>z3.ExprRef tritonToZ3(\ref py_AstNode_page node)</b><br>
 Convert a Triton AST to a Z3 AST.
 
@@ -396,6 +408,19 @@ namespace triton {
       }
 
 
+      static PyObject* AstContext_balance(PyObject* self, PyObject* op1) {
+        if (!PyAstNode_Check(op1))
+          return PyErr_Format(PyExc_TypeError, "balance(): expected a AstNode as first argument");
+
+        try {
+          return PyAstNode(PyAstContext_AsAstContext(self)->balance(PyAstNode_AsAstNode(op1)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstContext_bswap(PyObject* self, PyObject* op1) {
         if (!PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bswap(): expected a AstNode as first argument");
@@ -1608,6 +1633,65 @@ namespace triton {
       }
 
 
+      static PyObject* AstContext_substitute(PyObject* self, PyObject* args) {
+        std::unordered_map<triton::ast::SharedAbstractNode, triton::ast::SharedAbstractNode> mapping;
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+        PyObject* op1 = nullptr;
+        PyObject* op2 = nullptr;
+        PyObject* op3 = nullptr;
+        PyObject* ret = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &op1, &op2, &op3) == false) {
+          return PyErr_Format(PyExc_TypeError, "substitute(): Invalid number of arguments");
+        }
+
+        if (op1 == nullptr || (!PyAstNode_Check(op1) && !PyList_Check(op1)))
+          return PyErr_Format(PyExc_TypeError, "substitute(): expected a AstNode or a list of AstNodes as first argument");
+
+        if (op2 == nullptr || !PyList_Check(op2))
+          return PyErr_Format(PyExc_TypeError, "substitute(): expected a list of (AstNode, AstNode) as second argument");
+
+        if (op3 != nullptr && !PyBool_Check(op3))
+          return PyErr_Format(PyExc_TypeError, "substitute(): expected a boolean as third argument");
+
+        if (PyList_Check(op1)) {
+          for (Py_ssize_t i = 0; i < PyList_Size(op1); i++) {
+            PyObject* item = PyList_GetItem(op1, i);
+            if (!PyAstNode_Check(item))
+              return PyErr_Format(PyExc_TypeError, "substitute(): Each element of the first argument must be a AstNode");
+            nodes.push_back(PyAstNode_AsAstNode(item));
+          }
+        }
+
+        for (Py_ssize_t i = 0; i < PyList_Size(op2); i++) {
+          PyObject* item = PyList_GetItem(op2, i);
+          if (!PyTuple_Check(item) || PyTuple_Size(item) != 2 || !PyAstNode_Check(PyTuple_GetItem(item, 0)) || !PyAstNode_Check(PyTuple_GetItem(item, 1)))
+            return PyErr_Format(PyExc_TypeError, "substitute(): Each element of the mapping must be a tuple of two AstNodes");
+          mapping[PyAstNode_AsAstNode(PyTuple_GetItem(item, 0))] = PyAstNode_AsAstNode(PyTuple_GetItem(item, 1));
+        }
+
+        try {
+          bool inplace = (op3 != nullptr) ? PyLong_AsBool(op3) : false;
+
+          if (PyAstNode_Check(op1))
+            return PyAstNode(PyAstContext_AsAstContext(self)->substitute(PyAstNode_AsAstNode(op1), mapping, inplace));
+
+          auto results = PyAstContext_AsAstContext(self)->substitute(nodes, mapping, inplace);
+          ret = xPyList_New(results.size());
+
+          triton::uint32 index = 0;
+          for (auto&& node : results)
+            PyList_SetItem(ret, index++, PyAstNode(node));
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstContext_sx(PyObject* self, PyObject* args) {
         PyObject* op1 = nullptr;
         PyObject* op2 = nullptr;
@@ -1777,6 +1861,7 @@ namespace triton {
       PyMethodDef AstContext_callbacks[] = {
         {"array",           AstContext_array,           METH_O,           ""},
         {"assert_",         AstContext_assert,          METH_O,           ""},
+        {"balance",         AstContext_balance,         METH_O,           ""},
         {"bswap",           AstContext_bswap,           METH_O,           ""},
         {"bv",              AstContext_bv,              METH_VARARGS,     ""},
         {"bvadd",           AstContext_bvadd,           METH_VARARGS,     ""},
@@ -1831,6 +1916,7 @@ namespace triton {
         {"store",           AstContext_store,           METH_VARARGS,     ""},
         {"search",          AstContext_search,          METH_VARARGS,     ""},
         {"string",          AstContext_string,          METH_O,           ""},
+        {"substitute",      AstContext_substitute,      METH_VARARGS,     ""},
         {"sx",              AstContext_sx,              METH_VARARGS,     ""},
         {"unroll",          AstContext_unroll,          METH_O,           ""},
         {"variable",        AstContext_variable,        METH_O,           ""},
@@ -13,6 +13,8 @@
 #include <triton/coreUtils.hpp>
 #include <triton/exceptions.hpp>
 
+#include <unordered_map>
+
 #include <iostream>
 
 
@@ -33,7 +35,8 @@
 \section py_AstNode_description Description
 <hr>
 
-This object is used to represent each AST node of an expression.
+This object is used to represent each AST node of an expression. A node has a single AstNode object while it is referenced from Python,
+so walking an AST does not build new objects for the nodes already reached.
 
 ~~~~~~~~~~~~~{.py}
 >>> astCtxt = ctxt.getAstContext()
@@ -54,6 +57,9 @@ This object is used to represent each AST node of an expression.
 \section AstNode_py_api Python API - Methods of the AstNode class
 <hr>
 
+- <b>bool containsArray(void)</b><br>
+Returns true if the tree, its references included, contains an array node.
+
 - <b>bool equalTo(\ref py_AstNode_page)</b><br>
 Compares the current tree to another one.
 
@@ -67,8 +73,12 @@ e.g: `0xffffffff`
 - <b>integer getBitvectorSize(void)</b><br>
 Returns the node vector size.
 
-- <b>[\ref py_AstNode_page, ...] getChildren(void)</b><br>
-Returns the list of child nodes.
+- <b>(\ref py_AstNode_page, ...) getChildren(void)</b><br>
+Returns the tuple of child nodes.
+
+- <b>integer getDagSizeEstimate(void)</b><br>
+Returns an upper bound of the number of distinct nodes of the tree, its references included, without walking it. It is exact for a tree
+without shared subtrees.
 
 - <b>integer getHash(void)</b><br>
 Returns the hash (signature) of the AST.
@@ -95,6 +105,10 @@ Returns the symbolic variable of the node. Only available on `VARIABLE_NODE`, ra
 Returns the type of the node.<br>
 e.g: `AST_NODE.BVADD`
 
+- <b>[integer, ...] getVariableIds(void)</b><br>
+Returns the sorted ids of the symbolic variables of the tree, its references included. The set is kept by the node, so this does not
+walk the tree unless it has more than 256 variables.
+
 - <b>bool isArray(void)</b><br>
 Returns true if it's an array node.
 e.g: `AST_NODE.ARRAY` and `AST_NODE.STORE`.
@@ -109,9 +123,16 @@ According to the size of the expression, returns true if the MSB is 1.
 - <b>bool isSymbolized(void)</b><br>
 Returns true if the tree (and its sub-trees) contains a symbolic variable.
 
+- <b>bool sharesVariablesWith(\ref py_AstNode_page node)</b><br>
+Returns true if both trees contain a same symbolic variable.
+
 - <b>void setChild(integer index, \ref py_AstNode_page node)</b><br>
 Replaces a child node.
 
+- <b>(\ref py_AstNode_page, ...) walk(bool revert=False, bool unroll=False)</b><br>
+Returns the node and all its sub-nodes, each once and sorted topologically: the node first, or its leaves first if `revert` is true.
+If `unroll` is true, the references are walked through. The walk is native, so a Python pass visits each node without recursing.
+
 \section AstNode_operator_py_api Python API - Operators
 <hr>
 
@@ -146,14 +167,33 @@ namespace triton {
   namespace bindings {
     namespace python {
 
+      //! The AstNode objects alive, by node. An object is removed from the map when it is destroyed, so the map does not keep it alive.
+      static std::unordered_map<const triton::ast::AbstractNode*, PyObject*> wrappers;
+
+
       //! AstNode destructor.
       void AstNode_dealloc(PyObject* self) {
         std::cout << std::flush;
+        auto it = wrappers.find(PyAstNode_AsAstNode(self).get());
+        if (it != wrappers.end() && it->second == self)
+          wrappers.erase(it);
         PyAstNode_AsAstNode(self) = nullptr; // decref the shared_ptr
         Py_TYPE(self)->tp_free((PyObject*)self);
       }
 
 
+      static PyObject* AstNode_containsArray(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyAstNode_AsAstNode(self)->containsArray())
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_equalTo(PyObject* self, PyObject* other) {
         try {
           if (other == nullptr || !PyAstNode_Check(other))
@@ -206,9 +246,9 @@ namespace triton {
           triton::ast::SharedAbstractNode node = PyAstNode_AsAstNode(self);
 
           triton::usize size = node->getChildren().size();
-          children = xPyList_New(size);
+          children = xPyTuple_New(size);
           for (triton::usize index = 0; index < size; index++)
-            PyList_SetItem(children, index, PyAstNode(node->getChildren()[index]));
+            PyTuple_SetItem(children, index, PyAstNode(node->getChildren()[index]));
 
           return children;
         }
@@ -218,6 +258,16 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_getDagSizeEstimate(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint64(PyAstNode_AsAstNode(self)->getDagSizeEstimate());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_getHash(PyObject* self, PyObject* noarg) {
         try {
           return PyLong_FromUint512(PyAstNode_AsAstNode(self)->getHash());
@@ -324,6 +374,20 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_getVariableIds(PyObject* self, PyObject* noarg) {
+        try {
+          auto ids = PyAstNode_AsAstNode(self)->getVariableIds();
+          PyObject* ret = xPyList_New(ids.size());
+          for (triton::usize index = 0; index < ids.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUsize(ids[index]));
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_isArray(PyObject* self, PyObject* noarg) {
         try {
           if (PyAstNode_AsAstNode(self)->isArray())
@@ -372,6 +436,21 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_sharesVariablesWith(PyObject* self, PyObject* other) {
+        if (!PyAstNode_Check(other))
+          return PyErr_Format(PyExc_TypeError, "AstNode::sharesVariablesWith(): Expected a AstNode as argument.");
+
+        try {
+          if (PyAstNode_AsAstNode(self)->sharesVariablesWith(*PyAstNode_AsAstNode(other)))
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_setChild(PyObject* self, PyObject* args) {
         try {
           PyObject* index = nullptr;
@@ -402,6 +481,37 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_walk(PyObject* self, PyObject* args) {
+        PyObject* revert = nullptr;
+        PyObject* unroll = nullptr;
+
+        if (PyArg_ParseTuple(args, "|OO", &revert, &unroll) == false) {
+          return PyErr_Format(PyExc_TypeError, "AstNode::walk(): Invalid number of arguments");
+        }
+
+        if (revert != nullptr && !PyBool_Check(revert))
+          return PyErr_Format(PyExc_TypeError, "AstNode::walk(): Expects a boolean as first argument.");
+
+        if (unroll != nullptr && !PyBool_Check(unroll))
+          return PyErr_Format(PyExc_TypeError, "AstNode::walk(): Expects a boolean as second argument.");
+
+        try {
+          bool revert_c = (revert != nullptr && PyLong_AsBool(revert));
+          bool unroll_c = (unroll != nullptr && PyLong_AsBool(unroll));
+          auto nodes    = triton::ast::childrenExtraction(PyAstNode_AsAstNode(self), unroll_c, revert_c);
+
+          PyObject* ret = xPyTuple_New(nodes.size());
+          for (triton::usize index = 0; index < nodes.size(); index++)
+            PyTuple_SetItem(ret, index, PyAstNode(nodes[index]));
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       #if !defined(IS_PY3_8) || !IS_PY3_8
       static int AstNode_print(PyObject* self, void* io, int s) {
         std::cout << PyAstNode_AsAstNode(self);
@@ -837,11 +947,13 @@ namespace triton {
 
       //! AstNode methods.
       PyMethodDef AstNode_callbacks[] = {
+        {"containsArray",           AstNode_containsArray,          METH_NOARGS,     ""},
         {"equalTo",                 AstNode_equalTo,                METH_O,          ""},
         {"evaluate",                AstNode_evaluate,               METH_NOARGS,     ""},
         {"getBitvectorMask",        AstNode_getBitvectorMask,       METH_NOARGS,     ""},
         {"getBitvectorSize",        AstNode_getBitvectorSize,       METH_NOARGS,     ""},
         {"getChildren",             AstNode_getChildren,            METH_NOARGS,     ""},
+        {"getDagSizeEstimate",      AstNode_getDagSizeEstimate,     METH_NOARGS,     ""},
         {"getHash",                 AstNode_getHash,                METH_NOARGS,     ""},
         {"getInteger",              AstNode_getInteger,             METH_NOARGS,     ""},
         {"getLevel",                AstNode_getLevel,               METH_NOARGS,     ""},
@@ -850,11 +962,14 @@ namespace triton {
         {"getSymbolicExpression",   AstNode_getSymbolicExpression,  METH_NOARGS,     ""},
         {"getSymbolicVariable",     AstNode_getSymbolicVariable,    METH_NOARGS,     ""},
         {"getType",                 AstNode_getType,                METH_NOARGS,     ""},
+        {"getVariableIds",          AstNode_getVariableIds,         METH_NOARGS,     ""},
         {"isArray",                 AstNode_isArray,                METH_NOARGS,     ""},
         {"isLogical",               AstNode_isLogical,              METH_NOARGS,     ""},
         {"isSigned",                AstNode_isSigned,               METH_NOARGS,     ""},
         {"isSymbolized",            AstNode_isSymbolized,           METH_NOARGS,     ""},
+        {"sharesVariablesWith",     AstNode_sharesVariablesWith,    METH_O,          ""},
         {"setChild",                AstNode_setChild,               METH_VARARGS,    ""},
+        {"walk",                    AstNode_walk,                   METH_VARARGS,    ""},
         {nullptr,                   nullptr,                        0,               nullptr}
       };
 
@@ -991,12 +1106,20 @@ namespace triton {
           return Py_None;
         }
 
+        /* The node already has an object */
+        auto it = wrappers.find(node.get());
+        if (it != wrappers.end()) {
+          Py_INCREF(it->second);
+          return it->second;
+        }
+
         PyType_Ready(&AstNode_Type);
         // Build the new object the python way (calling operator() on the type) as
         // it crash otherwise (certainly due to incorrect shared_ptr initialization).
         auto* object = (triton::bindings::python::AstNode_Object*)PyObject_CallObject((PyObject*) &AstNode_Type, nullptr);
         if (object != NULL) {
           object->node = node;
+          wrappers[node.get()] = (PyObject*)object;
         }
 
         return (PyObject*)object;
@@ -168,7 +168,7 @@ namespace triton {
         triton::usize index = 0;
 
         try {
-          auto insts = PyBasicBlock_AsBasicBlock(self)->getInstructions();
+          const auto& insts = PyBasicBlock_AsBasicBlock(self)->getInstructions();
           ret = xPyList_New(insts.size());
           for (auto& inst : insts)
             PyList_SetItem(ret, index++, PyInstruction(inst));
@@ -0,0 +1,544 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/pythonObjects.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/explorer.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+
+
+/*! \page py_Explorer_page Explorer
+    \brief [**python api**] All information about the Explorer Python object.
+
+\tableofcontents
+
+\section py_Explorer_description Description
+<hr>
+
+This object explores the paths of a program concolically on a pool of worker contexts (see triton::engines::exploration::Explorer).
+Each worker is a TritonContext initialized by the `setup` function, and restored to this state before each run. The
+`inject` function writes an input (bytes) into a worker and returns its symbolic variables in order, each one covering
+its size in bytes of the input. The branches not taken by a run are solved, each model giving a new input. A branch is only
+flipped once by all the workers.
+
+The functions are called by the workers, which take the GIL while they run Python code. The exploration releases the GIL.
+
+~~~~~~~~~~~~~{.py}
+>>> from triton import *
+
+>>> def setup(ctx):
+...     ctx.setArchitecture(ARCH.X86_64)
+...     # cmp al, 0x41 ; jne +2 ; nop ; nop ; nop
+...     ctx.setConcreteMemoryAreaValue(0x1000, b"\x3c\x41\x75\x02\x90\x90\x90")
+
+>>> def inject(ctx, data):
+...     ctx.setConcreteRegisterValue(ctx.registers.al, data[0])
+...     return [ctx.symbolizeRegister(ctx.registers.al)]
+
+>>> explorer = Explorer(setup, inject)
+>>> explorer.setWorkers(2)
+>>> explorer.setTerminationHook(lambda ctx, inst: inst.getAddress() == 0x1006)
+>>> explorer.explore(0x1000, b"\x00")
+2
+>>> sorted(explorer.getInputs())
+[b'\x00', b'A']
+
+~~~~~~~~~~~~~
+
+\section Explorer_py_api Python API - Methods of the Explorer class
+<hr>
+
+- <b>integer explore(integer entry, bytes input)</b><br>
+Explores the program from `entry`, starting with `input`. Returns the number of runs.
+
+- <b>[integer, ...] getCoverage(void)</b><br>
+Returns the sorted addresses of the instructions covered by the last exploration.
+
+- <b>integer getEdgeCount(void)</b><br>
+Returns the number of entries of the edge bitmap covered by the last exploration.
+
+- <b>[bytes, ...] getInputs(void)</b><br>
+Returns the inputs run by the last exploration, in the order of the runs.
+
+- <b>void setInputHook(function cb)</b><br>
+Calls `cb(input, coverage)` once per run with its input and True if it covered new instructions or edges. The exploration ends if it returns False.
+
+- <b>void setMaxDepth(integer depth)</b><br>
+Sets the number of path constraints which may be flipped from the start of a path, 0 for all.
+
+- <b>void setMaxInstructions(integer count)</b><br>
+Sets the maximum number of instructions of a run.
+
+- <b>void setMaxRuns(integer count)</b><br>
+Sets the maximum number of runs, 0 for unlimited.
+
+- <b>void setPriorityHook(function cb)</b><br>
+Calls `cb(info)` with the dictionary of the properties of a task (`depth`, `bound`, `edges`, `cost` and `deferred`) to get its
+priority with \ref py_SCHEDULER_page `CUSTOM`, the highest being run first.
+
+- <b>void setScheduler(\ref py_SCHEDULER_page scheduler)</b><br>
+Sets the order of the tasks, \ref py_SCHEDULER_page `DFS` by default.
+
+- <b>void setTerminationHook(function cb)</b><br>
+Calls `cb(ctx, inst)` after the processing of each instruction of a run. The run ends if it returns True.
+
+- <b>void setTimeout(integer ms)</b><br>
+Sets the timeout of a query in milliseconds, 0 for none.
+
+- <b>void setWorkers(integer count)</b><br>
+Sets the number of workers, 0 for one per hardware thread.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      //! Throws the pending Python error as an exception, the error state being lost with the thread state of the worker.
+      static void Explorer_raise(void) {
+        PyObject* type      = nullptr;
+        PyObject* value     = nullptr;
+        PyObject* traceback = nullptr;
+        std::string message = "Explorer: A Python hook failed.";
+
+        PyErr_Fetch(&type, &value, &traceback);
+        if (value != nullptr) {
+          PyObject* str = PyObject_Str(value);
+          if (str != nullptr) {
+            message = PyStr_AsString(str);
+            Py_DECREF(str);
+          }
+        }
+
+        Py_XDECREF(type);
+        Py_XDECREF(value);
+        Py_XDECREF(traceback);
+        throw triton::exceptions::Callbacks(message);
+      }
+
+
+      //! Calls a Python hook with the GIL. Returns a new reference.
+      static PyObject* Explorer_call(PyObject* cb, PyObject* args) {
+        PyObject* ret = PyObject_CallObject(cb, args);
+        Py_DECREF(args);
+        if (ret == nullptr)
+          Explorer_raise();
+        return ret;
+      }
+
+
+      //! Explorer destructor.
+      void Explorer_dealloc(PyObject* self) {
+        std::cout << std::flush;
+        Explorer_Object* object = reinterpret_cast<Explorer_Object*>(self);
+        delete object->explorer;
+        Py_XDECREF(object->setup);
+        Py_XDECREF(object->inject);
+        Py_XDECREF(object->termination);
+        Py_XDECREF(object->input);
+        Py_XDECREF(object->priority);
+        Py_TYPE(self)->tp_free((PyObject*)self);
+      }
+
+
+      static PyObject* Explorer_explore(PyObject* self, PyObject* args) {
+        PyObject* entry = nullptr;
+        PyObject* input = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &entry, &input) == false) {
+          return PyErr_Format(PyExc_TypeError, "Explorer::explore(): Invalid number of arguments");
+        }
+
+        if (entry == nullptr || (!PyLong_Check(entry) && !PyInt_Check(entry)))
+          return PyErr_Format(PyExc_TypeError, "Explorer::explore(): Expects an integer as first argument.");
+
+        if (input == nullptr || !PyBytes_Check(input))
+          return PyErr_Format(PyExc_TypeError, "Explorer::explore(): Expects bytes as second argument.");
+
+        const triton::uint8* data = reinterpret_cast<const triton::uint8*>(PyBytes_AsString(input));
+        std::vector<triton::uint8> seed(data, data + PyBytes_Size(input));
+        triton::uint64 addr = PyLong_AsUint64(entry);
+        triton::usize runs = 0;
+        std::string error;
+
+        /* The workers take the GIL to call the hooks */
+        Py_BEGIN_ALLOW_THREADS
+        try {
+          runs = PyExplorer_AsExplorer(self)->explore(addr, seed);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          error = e.what();
+        }
+        Py_END_ALLOW_THREADS
+
+        if (!error.empty())
+          return PyErr_Format(PyExc_TypeError, "%s", error.c_str());
+
+        return PyLong_FromUsize(runs);
+      }
+
+
+      static PyObject* Explorer_getCoverage(PyObject* self, PyObject* noarg) {
+        try {
+          const auto& coverage = PyExplorer_AsExplorer(self)->getCoverage();
+          std::vector<triton::uint64> addresses(coverage.begin(), coverage.end());
+          std::sort(addresses.begin(), addresses.end());
+
+          PyObject* ret = xPyList_New(addresses.size());
+          for (triton::usize index = 0; index < addresses.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUint64(addresses[index]));
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* Explorer_getEdgeCount(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyExplorer_AsExplorer(self)->getEdgeCount());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* Explorer_getInputs(PyObject* self, PyObject* noarg) {
+        try {
+          const auto& inputs = PyExplorer_AsExplorer(self)->getInputs();
+          PyObject* ret = xPyList_New(inputs.size());
+
+          for (triton::usize index = 0; index < inputs.size(); index++)
+            PyList_SetItem(ret, index, PyBytes_FromStringAndSize(reinterpret_cast<const char*>(inputs[index].data()), inputs[index].size()));
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* Explorer_setInputHook(PyObject* self, PyObject* cb) {
+        Explorer_Object* object = reinterpret_cast<Explorer_Object*>(self);
+
+        if (cb == nullptr || !PyCallable_Check(cb))
+          return PyErr_Format(PyExc_TypeError, "Explorer::setInputHook(): Expects a function as argument.");
+
+        Py_INCREF(cb);
+        Py_XDECREF(object->input);
+        object->input = cb;
+
+        object->explorer->setInputHook([cb](const std::vector<triton::uint8>& input, bool coverage) {
+          triton::bindings::python::PyAcquireGil gil;
+
+          PyObject* args = triton::bindings::python::xPyTuple_New(2);
+          PyTuple_SetItem(args, 0, PyBytes_FromStringAndSize(reinterpret_cast<const char*>(input.data()), input.size()));
+          PyTuple_SetItem(args, 1, PyBool_FromLong(coverage));
+
+          PyObject* ret = Explorer_call(cb, args);
+          bool flag = (ret == Py_None) || PyObject_IsTrue(ret);
+          Py_DECREF(ret);
+
+          return flag;
+        });
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* Explorer_setMaxDepth(PyObject* self, PyObject* depth) {
+        if (depth == nullptr || (!PyLong_Check(depth) && !PyInt_Check(depth)))
+          return PyErr_Format(PyExc_TypeError, "Explorer::setMaxDepth(): Expects an integer as argument.");
+
+        PyExplorer_AsExplorer(self)->setMaxDepth(PyLong_AsUsize(depth));
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* Explorer_setMaxInstructions(PyObject* self, PyObject* count) {
+        if (count == nullptr || (!PyLong_Check(count) && !PyInt_Check(count)))
+          return PyErr_Format(PyExc_TypeError, "Explorer::setMaxInstructions(): Expects an integer as argument.");
+
+        PyExplorer_AsExplorer(self)->setMaxInstructions(PyLong_AsUsize(count));
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* Explorer_setMaxRuns(PyObject* self, PyObject* count) {
+        if (count == nullptr || (!PyLong_Check(count) && !PyInt_Check(count)))
+          return PyErr_Format(PyExc_TypeError, "Explorer::setMaxRuns(): Expects an integer as argument.");
+
+        PyExplorer_AsExplorer(self)->setMaxRuns(PyLong_AsUsize(count));
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* Explorer_setPriorityHook(PyObject* self, PyObject* cb) {
+        Explorer_Object* object = reinterpret_cast<Explorer_Object*>(self);
+
+        if (cb == nullptr || !PyCallable_Check(cb))
+          return PyErr_Format(PyExc_TypeError, "Explorer::setPriorityHook(): Expects a function as argument.");
+
+        Py_INCREF(cb);
+        Py_XDECREF(object->priority);
+        object->priority = cb;
+
+        object->explorer->setPriorityHook([cb](const triton::engines::exploration::TaskInfo& info) {
+          triton::bindings::python::PyAcquireGil gil;
+
+          PyObject* dict = triton::bindings::python::xPyDict_New();
+          triton::bindings::python::xPyDict_SetItemString(dict, "depth",    PyLong_FromUsize(info.depth));
+          triton::bindings::python::xPyDict_SetItemString(dict, "bound",    PyLong_FromUsize(info.bound));
+          triton::bindings::python::xPyDict_SetItemString(dict, "edges",    PyLong_FromUsize(info.edges));
+          triton::bindings::python::xPyDict_SetItemString(dict, "cost",     PyLong_FromUsize(info.cost));
+          triton::bindings::python::xPyDict_SetItemString(dict, "deferred", PyBool_FromLong(info.deferred));
+
+          PyObject* args = triton::bindings::python::xPyTuple_New(1);
+          PyTuple_SetItem(args, 0, dict);
+
+          PyObject* ret = Explorer_call(cb, args);
+          double priority = PyFloat_AsDouble(ret);
+          Py_DECREF(ret);
+
+          if (PyErr_Occurred())
+            Explorer_raise();
+
+          return priority;
+        });
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* Explorer_setScheduler(PyObject* self, PyObject* scheduler) {
+        if (scheduler == nullptr || (!PyLong_Check(scheduler) && !PyInt_Check(scheduler)))
+          return PyErr_Format(PyExc_TypeError, "Explorer::setScheduler(): Expects a SCHEDULER as argument.");
+
+        try {
+          PyExplorer_AsExplorer(self)->setScheduler(static_cast<triton::engines::exploration::scheduler_e>(PyLong_AsUint32(scheduler)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* Explorer_setTerminationHook(PyObject* self, PyObject* cb) {
+        Explorer_Object* object = reinterpret_cast<Explorer_Object*>(self);
+
+        if (cb == nullptr || !PyCallable_Check(cb))
+          return PyErr_Format(PyExc_TypeError, "Explorer::setTerminationHook(): Expects a function as argument.");
+
+        Py_INCREF(cb);
+        Py_XDECREF(object->termination);
+        object->termination = cb;
+
+        object->explorer->setTerminationHook([cb](triton::Context& ctx, const triton::arch::Instruction& inst) {
+          triton::bindings::python::PyAcquireGil gil;
+
+          PyObject* args = triton::bindings::python::xPyTuple_New(2);
+          PyTuple_SetItem(args, 0, triton::bindings::python::PyTritonContextRef(ctx));
+          PyTuple_SetItem(args, 1, triton::bindings::python::PyInstruction(inst));
+
+          PyObject* ret = Explorer_call(cb, args);
+          bool flag = PyObject_IsTrue(ret);
+          Py_DECREF(ret);
+
+          return flag;
+        });
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* Explorer_setTimeout(PyObject* self, PyObject* ms) {
+        if (ms == nullptr || (!PyLong_Check(ms) && !PyInt_Check(ms)))
+          return PyErr_Format(PyExc_TypeError, "Explorer::setTimeout(): Expects an integer as argument.");
+
+        PyExplorer_AsExplorer(self)->setTimeout(PyLong_AsUint32(ms));
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* Explorer_setWorkers(PyObject* self, PyObject* count) {
+        if (count == nullptr || (!PyLong_Check(count) && !PyInt_Check(count)))
+          return PyErr_Format(PyExc_TypeError, "Explorer::setWorkers(): Expects an integer as argument.");
+
+        PyExplorer_AsExplorer(self)->setWorkers(PyLong_AsUsize(count));
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      //! Explorer methods.
+      PyMethodDef Explorer_callbacks[] = {
+        {"explore",             Explorer_explore,             METH_VARARGS,   ""},
+        {"getCoverage",         Explorer_getCoverage,         METH_NOARGS,    ""},
+        {"getEdgeCount",        Explorer_getEdgeCount,        METH_NOARGS,    ""},
+        {"getInputs",           Explorer_getInputs,           METH_NOARGS,    ""},
+        {"setInputHook",        Explorer_setInputHook,        METH_O,         ""},
+        {"setMaxDepth",         Explorer_setMaxDepth,         METH_O,         ""},
+        {"setMaxInstructions",  Explorer_setMaxInstructions,  METH_O,         ""},
+        {"setMaxRuns",          Explorer_setMaxRuns,          METH_O,         ""},
+        {"setPriorityHook",     Explorer_setPriorityHook,     METH_O,         ""},
+        {"setScheduler",        Explorer_setScheduler,        METH_O,         ""},
+        {"setTerminationHook",  Explorer_setTerminationHook,  METH_O,         ""},
+        {"setTimeout",          Explorer_setTimeout,          METH_O,         ""},
+        {"setWorkers",          Explorer_setWorkers,          METH_O,         ""},
+        {nullptr,               nullptr,                      0,              nullptr}
+      };
+
+
+      PyTypeObject Explorer_Type = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+        "Explorer",                                 /* tp_name */
+        sizeof(Explorer_Object),                    /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)Explorer_dealloc,               /* tp_dealloc */
+        0,                                          /* tp_print or tp_vectorcall_offset */
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        0,                                          /* tp_repr */
+        0,                                          /* tp_as_number */
+        0,                                          /* tp_as_sequence */
+        0,                                          /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        0,                                          /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "Explorer objects",                         /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        0,                                          /* tp_iter */
+        0,                                          /* tp_iternext */
+        Explorer_callbacks,                         /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        #if IS_PY3
+          0,                                        /* tp_version_tag */
+          0,                                        /* tp_finalize */
+          #if IS_PY3_8
+            0,                                      /* tp_vectorcall */
+            #if !IS_PY3_9
+              0,                                    /* bpo-37250: kept for backwards compatibility in CPython 3.8 only */
+            #endif
+          #endif
+        #else
+          0                                         /* tp_version_tag */
+        #endif
+      };
+
+
+      PyObject* PyExplorer(PyObject* setup, PyObject* inject) {
+        Explorer_Object* object;
+
+        PyType_Ready(&Explorer_Type);
+        object = PyObject_NEW(Explorer_Object, &Explorer_Type);
+        if (object == NULL)
+          return nullptr;
+
+        object->explorer    = nullptr;
+        object->setup       = setup;
+        object->inject      = inject;
+        object->termination = nullptr;
+        object->input       = nullptr;
+        object->priority    = nullptr;
+        Py_INCREF(setup);
+        Py_INCREF(inject);
+
+        try {
+          object->explorer = new triton::engines::exploration::Explorer(
+            [setup](triton::Context& ctx) {
+              triton::bindings::python::PyAcquireGil gil;
+
+              PyObject* args = triton::bindings::python::xPyTuple_New(1);
+              PyTuple_SetItem(args, 0, triton::bindings::python::PyTritonContextRef(ctx));
+              Py_DECREF(Explorer_call(setup, args));
+            },
+            [inject](triton::Context& ctx, const std::vector<triton::uint8>& input) {
+              triton::bindings::python::PyAcquireGil gil;
+              std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+
+              PyObject* args = triton::bindings::python::xPyTuple_New(2);
+              PyTuple_SetItem(args, 0, triton::bindings::python::PyTritonContextRef(ctx));
+              PyTuple_SetItem(args, 1, PyBytes_FromStringAndSize(reinterpret_cast<const char*>(input.data()), input.size()));
+
+              PyObject* ret = Explorer_call(inject, args);
+              if (!PyList_Check(ret)) {
+                Py_DECREF(ret);
+                throw triton::exceptions::Callbacks("Explorer: The inject function must return a list of SymbolicVariable.");
+              }
+
+              for (Py_ssize_t i = 0; i < PyList_Size(ret); i++) {
+                PyObject* item = PyList_GetItem(ret, i);
+                if (!PySymbolicVariable_Check(item)) {
+                  Py_DECREF(ret);
+                  throw triton::exceptions::Callbacks("Explorer: The inject function must return a list of SymbolicVariable.");
+                }
+                variables.push_back(PySymbolicVariable_AsSymbolicVariable(item));
+              }
+
+              Py_DECREF(ret);
+              return variables;
+            });
+        }
+        catch (const triton::exceptions::Exception& e) {
+          Py_DECREF(object);
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return (PyObject*)object;
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
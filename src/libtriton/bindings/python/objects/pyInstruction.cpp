@@ -221,7 +221,7 @@ Returns true if at least one of its \ref py_SymbolicExpression_page is tainted.
 Returns true if the instruction performs a write back. Mainly used for AArch64 instructions like LDR.
 
 - <b>bool isUpdateFlag(void)</b><br>
-Returns true if the instruction updates flags. Mainly used for AArch64 instructions like ADDS.
+Returns true if the instruction updates flags (e.g AArch64: ADDS, x86: ADD, CMP, ...).
 
 - <b>bool isThumb(void)</b><br>
 Returns true if the instruction is a Thumb instruction.
@@ -0,0 +1,347 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/pythonObjects.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/solverFuture.hpp>
+
+#include <iostream>
+
+
+
+/*! \page py_SolverFuture_page SolverFuture
+    \brief [**python api**] All information about the SolverFuture Python object.
+
+\tableofcontents
+
+\section py_SolverFuture_description Description
+<hr>
+
+This object is the handle of a query solved in the background, as returned by `getModelAsync()` and `isSatAsync()`.
+The emulation keeps running while the query is solved, and the handle is polled or waited for. The waits release
+the GIL.
+
+~~~~~~~~~~~~~{.py}
+>>> from triton import TritonContext, ARCH, SOLVER_STATE
+
+>>> ctxt = TritonContext(ARCH.X86_64)
+>>> ast = ctxt.getAstContext()
+>>> x = ast.variable(ctxt.newSymbolicVariable(32))
+
+>>> future = ctxt.getModelAsync(x == 0x1234)
+>>> # ... keep emulating ...
+>>> future.wait()
+True
+>>> future.getStatus() == SOLVER_STATE.SAT
+True
+>>> hex(future.getModel()[0].getValue())
+'0x1234'
+
+~~~~~~~~~~~~~
+
+\section SolverFuture_py_api Python API - Methods of the SolverFuture class
+<hr>
+
+- <b>void cancel(void)</b><br>
+Cancels the query. A pending query ends at once, a running one once its solver is interrupted. A cancelled query ends
+with an unknown status and no model.
+
+- <b>dict getModel(void)</b><br>
+Waits for the query and returns its model as a dictionary of {integer symVarId : \ref py_SolverModel_page model}.
+
+- <b>[dict, ...] getModels(void)</b><br>
+Waits for the query and returns its models.
+
+- <b>integer getSolvingTime(void)</b><br>
+Waits for the query and returns its solving time.
+
+- <b>\ref py_SOLVER_STATE_page getStatus(void)</b><br>
+Waits for the query and returns its status.
+
+- <b>bool isCancelled(void)</b><br>
+Returns true if the query is cancelled.
+
+- <b>bool isReady(void)</b><br>
+Returns true if the query is ended.
+
+- <b>bool isSat(void)</b><br>
+Waits for the query and returns true if the constraint is satisfiable.
+
+- <b>bool wait(integer timeout=None)</b><br>
+Waits for the query, at most `timeout` milliseconds if defined. Returns true if it is ended.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      //! Waits for the end of the query without holding the GIL.
+      static void SolverFuture_join(PyObject* self) {
+        Py_BEGIN_ALLOW_THREADS
+        (*PySolverFuture_AsSolverFuture(self))->wait();
+        Py_END_ALLOW_THREADS
+      }
+
+
+      //! SolverFuture destructor.
+      void SolverFuture_dealloc(PyObject* self) {
+        std::cout << std::flush;
+        delete PySolverFuture_AsSolverFuture(self);
+        Py_TYPE(self)->tp_free((PyObject*)self);
+      }
+
+
+      static PyObject* SolverFuture_cancel(PyObject* self, PyObject* noarg) {
+        try {
+          (*PySolverFuture_AsSolverFuture(self))->cancel();
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* SolverFuture_getModel(PyObject* self, PyObject* noarg) {
+        PyObject* dict = nullptr;
+
+        try {
+          SolverFuture_join(self);
+          dict = xPyDict_New();
+          auto model = (*PySolverFuture_AsSolverFuture(self))->getModel();
+          for (auto it = model.begin(); it != model.end(); it++) {
+            xPyDict_SetItem(dict, PyLong_FromUsize(it->first), PySolverModel(it->second));
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          Py_XDECREF(dict);
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return dict;
+      }
+
+
+      static PyObject* SolverFuture_getModels(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          SolverFuture_join(self);
+          const auto& models = (*PySolverFuture_AsSolverFuture(self))->getModels();
+          triton::uint32 index = 0;
+
+          ret = xPyList_New(models.size());
+          for (const auto& model : models) {
+            PyObject* mdict = xPyDict_New();
+            for (auto it = model.begin(); it != model.end(); it++) {
+              xPyDict_SetItem(mdict, PyLong_FromUsize(it->first), PySolverModel(it->second));
+            }
+            PyList_SetItem(ret, index++, mdict);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          Py_XDECREF(ret);
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* SolverFuture_getSolvingTime(PyObject* self, PyObject* noarg) {
+        try {
+          SolverFuture_join(self);
+          return PyLong_FromUint32((*PySolverFuture_AsSolverFuture(self))->getSolvingTime());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* SolverFuture_getStatus(PyObject* self, PyObject* noarg) {
+        try {
+          SolverFuture_join(self);
+          return PyLong_FromUint32((*PySolverFuture_AsSolverFuture(self))->getStatus());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* SolverFuture_isCancelled(PyObject* self, PyObject* noarg) {
+        try {
+          if ((*PySolverFuture_AsSolverFuture(self))->isCancelled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* SolverFuture_isReady(PyObject* self, PyObject* noarg) {
+        try {
+          if ((*PySolverFuture_AsSolverFuture(self))->isReady() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* SolverFuture_isSat(PyObject* self, PyObject* noarg) {
+        try {
+          SolverFuture_join(self);
+          if ((*PySolverFuture_AsSolverFuture(self))->isSat() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* SolverFuture_wait(PyObject* self, PyObject* args) {
+        PyObject* timeout = nullptr;
+        bool ready = false;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|O", &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "SolverFuture::wait(): Invalid number of arguments");
+        }
+
+        if (timeout != nullptr && timeout != Py_None && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "SolverFuture::wait(): Expects an integer as timeout argument.");
+        }
+
+        try {
+          auto& future = *PySolverFuture_AsSolverFuture(self);
+
+          if (timeout == nullptr || timeout == Py_None) {
+            SolverFuture_join(self);
+            ready = true;
+          }
+          else {
+            triton::uint32 ms = PyLong_AsUint32(timeout);
+            Py_BEGIN_ALLOW_THREADS
+            ready = future->waitFor(ms);
+            Py_END_ALLOW_THREADS
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        if (ready == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
+      //! SolverFuture methods.
+      PyMethodDef SolverFuture_callbacks[] = {
+        {"cancel",          SolverFuture_cancel,          METH_NOARGS,    ""},
+        {"getModel",        SolverFuture_getModel,        METH_NOARGS,    ""},
+        {"getModels",       SolverFuture_getModels,       METH_NOARGS,    ""},
+        {"getSolvingTime",  SolverFuture_getSolvingTime,  METH_NOARGS,    ""},
+        {"getStatus",       SolverFuture_getStatus,       METH_NOARGS,    ""},
+        {"isCancelled",     SolverFuture_isCancelled,     METH_NOARGS,    ""},
+        {"isReady",         SolverFuture_isReady,         METH_NOARGS,    ""},
+        {"isSat",           SolverFuture_isSat,           METH_NOARGS,    ""},
+        {"wait",            SolverFuture_wait,            METH_VARARGS,   ""},
+        {nullptr,           nullptr,                      0,              nullptr}
+      };
+
+
+      PyTypeObject SolverFuture_Type = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+        "SolverFuture",                             /* tp_name */
+        sizeof(SolverFuture_Object),                /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)SolverFuture_dealloc,           /* tp_dealloc */
+        0,                                          /* tp_print or tp_vectorcall_offset */
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        0,                                          /* tp_repr */
+        0,                                          /* tp_as_number */
+        0,                                          /* tp_as_sequence */
+        0,                                          /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        0,                                          /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "SolverFuture objects",                     /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        0,                                          /* tp_iter */
+        0,                                          /* tp_iternext */
+        SolverFuture_callbacks,                     /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        #if IS_PY3
+          0,                                        /* tp_version_tag */
+          0,                                        /* tp_finalize */
+          #if IS_PY3_8
+            0,                                      /* tp_vectorcall */
+            #if !IS_PY3_9
+              0,                                    /* bpo-37250: kept for backwards compatibility in CPython 3.8 only */
+            #endif
+          #endif
+        #else
+          0                                         /* tp_version_tag */
+        #endif
+      };
+
+
+      PyObject* PySolverFuture(const std::shared_ptr<triton::engines::solver::SolverFuture>& future) {
+        SolverFuture_Object* object;
+
+        PyType_Ready(&SolverFuture_Type);
+        object = PyObject_NEW(SolverFuture_Object, &SolverFuture_Type);
+        if (object != NULL)
+          object->future = new std::shared_ptr<triton::engines::solver::SolverFuture>(future);
+
+        return (PyObject*)object;
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
@@ -0,0 +1,238 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/pythonObjects.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+#include <triton/context.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+/*! \page py_SymbolicIterator_page SymbolicIterator
+    \brief [**python api**] All information about the SymbolicIterator Python object.
+
+\tableofcontents
+
+\section py_SymbolicIterator_description Description
+<hr>
+
+This object is the lazy iterator returned by `iterSymbolicExpressions()`, `iterSymbolicVariables()`, `iterSymbolicRegisters()` and
+`iterSymbolicMemory()`. It only holds the keys of the entries when it is created and wraps an entry into a Python object when it is
+reached, so a large trace is walked without building a dictionary of all its entries. The entries removed in the meantime are skipped,
+the ones created in the meantime are not visited.
+
+~~~~~~~~~~~~~{.py}
+>>> from triton import TritonContext, ARCH, Instruction
+>>> ctxt = TritonContext(ARCH.X86_64)
+>>> ctxt.processing(Instruction(b"\x48\x31\xc0"))
+0
+>>> ids = [expr.getId() for expr in ctxt.iterSymbolicExpressions()]
+>>> sorted(ids) == sorted(ctxt.getSymbolicExpressions())
+True
+>>> len(list(ctxt.iterSymbolicRegisters())) == len(ctxt.getSymbolicRegisters())
+True
+
+~~~~~~~~~~~~~
+
+\section SymbolicIterator_py_api Python API - Items of the SymbolicIterator class
+<hr>
+
+- `iterSymbolicExpressions()` yields the \ref py_SymbolicExpression_page expressions, in no particular order.
+- `iterSymbolicVariables()` yields the \ref py_SymbolicVariable_page variables, in no particular order.
+- `iterSymbolicRegisters()` yields the (\ref py_REG_page reg, \ref py_SymbolicExpression_page expr) pairs, by increasing register id.
+- `iterSymbolicMemory()` yields the (integer address, \ref py_SymbolicExpression_page expr) pairs, in no particular order.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      //! SymbolicIterator destructor.
+      void SymbolicIterator_dealloc(PyObject* self) {
+        auto* object = reinterpret_cast<SymbolicIterator_Object*>(self);
+        delete object->keys;
+        Py_XDECREF(object->ctx);
+        Py_TYPE(self)->tp_free((PyObject*)self);
+      }
+
+
+      static PyObject* SymbolicIterator_iter(PyObject* self) {
+        Py_INCREF(self);
+        return self;
+      }
+
+
+      static PyObject* SymbolicIterator_next(PyObject* self) {
+        auto* object = reinterpret_cast<SymbolicIterator_Object*>(self);
+        triton::Context* ctx = PyTritonContext_AsTritonContext(object->ctx);
+
+        try {
+          while (object->index < object->keys->size()) {
+            triton::uint64 key = (*object->keys)[object->index++];
+
+            switch (object->kind) {
+              case SYMBOLIC_ITERATOR_EXPRESSIONS: {
+                if (ctx->isSymbolicExpressionExists(static_cast<triton::usize>(key)))
+                  return PySymbolicExpression(ctx->getSymbolicExpression(static_cast<triton::usize>(key)));
+                break;
+              }
+
+              case SYMBOLIC_ITERATOR_VARIABLES: {
+                triton::engines::symbolic::SharedSymbolicVariable var = nullptr;
+                try {
+                  var = ctx->getSymbolicVariable(static_cast<triton::usize>(key));
+                }
+                catch (const triton::exceptions::SymbolicEngine&) {
+                  /* The variable is dead */
+                }
+                if (var != nullptr)
+                  return PySymbolicVariable(var);
+                break;
+              }
+
+              case SYMBOLIC_ITERATOR_REGISTERS: {
+                const auto& symbolic = ctx->getSymbolicRegisterArray();
+                if (key < symbolic.size() && symbolic[key] != nullptr) {
+                  PyObject* item = xPyTuple_New(2);
+                  PyTuple_SetItem(item, 0, PyLong_FromUint64(key));
+                  PyTuple_SetItem(item, 1, PySymbolicExpression(symbolic[key]));
+                  return item;
+                }
+                break;
+              }
+
+              case SYMBOLIC_ITERATOR_MEMORY: {
+                triton::engines::symbolic::SharedSymbolicExpression expr = ctx->getSymbolicMemory(key);
+                if (expr != nullptr) {
+                  PyObject* item = xPyTuple_New(2);
+                  PyTuple_SetItem(item, 0, PyLong_FromUint64(key));
+                  PyTuple_SetItem(item, 1, PySymbolicExpression(expr));
+                  return item;
+                }
+                break;
+              }
+
+              default:
+                return PyErr_Format(PyExc_TypeError, "SymbolicIterator::next(): Invalid kind of iterator.");
+            }
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        /* The end of the iteration */
+        return nullptr;
+      }
+
+
+      static Py_ssize_t SymbolicIterator_len(PyObject* self) {
+        auto* object = reinterpret_cast<SymbolicIterator_Object*>(self);
+        return static_cast<Py_ssize_t>(object->keys->size() - object->index);
+      }
+
+
+      //! SymbolicIterator length hint, an upper bound as the removed entries are skipped.
+      static PyObject* SymbolicIterator_lengthHint(PyObject* self, PyObject* noarg) {
+        return PyLong_FromUsize(static_cast<triton::usize>(SymbolicIterator_len(self)));
+      }
+
+
+      //! SymbolicIterator methods.
+      PyMethodDef SymbolicIterator_callbacks[] = {
+        {"__length_hint__", SymbolicIterator_lengthHint,  METH_NOARGS,    ""},
+        {nullptr,           nullptr,                      0,              nullptr}
+      };
+
+
+      PyTypeObject SymbolicIterator_Type = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+        "SymbolicIterator",                         /* tp_name */
+        sizeof(SymbolicIterator_Object),            /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)SymbolicIterator_dealloc,       /* tp_dealloc */
+        0,                                          /* tp_print or tp_vectorcall_offset */
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        0,                                          /* tp_repr */
+        0,                                          /* tp_as_number */
+        0,                                          /* tp_as_sequence */
+        0,                                          /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        0,                                          /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "SymbolicIterator objects",                 /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        (getiterfunc)SymbolicIterator_iter,         /* tp_iter */
+        (iternextfunc)SymbolicIterator_next,        /* tp_iternext */
+        SymbolicIterator_callbacks,                 /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        #if IS_PY3
+          0,                                        /* tp_version_tag */
+          0,                                        /* tp_finalize */
+          #if IS_PY3_8
+            0,                                      /* tp_vectorcall */
+            #if !IS_PY3_9
+              0,                                    /* bpo-37250: kept for backwards compatibility in CPython 3.8 only */
+            #endif
+          #endif
+        #else
+          0                                         /* tp_version_tag */
+        #endif
+      };
+
+
+
+
+      PyObject* PySymbolicIterator(PyObject* ctx, symbolic_iterator_e kind, std::vector<triton::uint64>&& keys) {
+        SymbolicIterator_Object* object;
+
+        PyType_Ready(&SymbolicIterator_Type);
+        object = PyObject_NEW(SymbolicIterator_Object, &SymbolicIterator_Type);
+        if (object != NULL) {
+          Py_INCREF(ctx);
+          object->ctx   = ctx;
+          object->kind  = kind;
+          object->index = 0;
+          object->keys  = new std::vector<triton::uint64>(std::move(keys));
+        }
+
+        return (PyObject*)object;
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
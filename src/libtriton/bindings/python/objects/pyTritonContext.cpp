@@ -11,6 +11,7 @@
 #include <triton/arm32Cpu.hpp>
 #include <triton/context.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/passManager.hpp>
 #include <triton/register.hpp>
 
 
@@ -34,13 +35,47 @@ libTriton offers Python bindings on top of its C++ API which allow you to build
 
 ~~~~~~~~~~~~~
 
+The GIL is released during `getModel()`, `getModels()`, `isSat()`, `liftToLLVM()`, `simplify()` on AstNodes and `synthesize()`, and taken
+back only to run the Python callbacks, so the threads driving other contexts keep running. A context must not be used by two threads at once.
+
 \section tritonContext_py_api Python API - Methods of the TritonContext class
 <hr>
 
 \subsection TritonContext_py_api_methods Methods
 
-- <b>void addCallback(\ref py_CALLBACK_page kind, function cb)</b><br>
-Adds a callback at specific internal points. Your callback will be called each time the point is reached.
+- <b>void addBuiltinRewriteRules(void)</b><br>
+Adds the built-in native rewrite rules applied by `simplify()`: MBA identities, constant reassociation and extract/concat fusion.
+
+- <b>void addCallback(\ref py_CALLBACK_page kind, function cb, list watch=None)</b><br>
+Adds a callback at specific internal points. Your callback will be called each time the point is reached. If `watch` is a list of
+\ref py_Register_page, \ref py_MemoryAccess_page or (integer addr, integer size), the callback is only called for the registers (and their
+sub-registers) or the memory accesses overlapping a watched range, which are looked up natively before the interpreter is taken.
+
+- <b>void addConcretizationRule(\ref py_CONCRETIZATION_page rule, integer threshold=0)</b><br>
+Enables a rule concretizing the registers and memory cells written by the instructions, evaluated after each instruction. `threshold` is
+the number of nodes of `CONCRETIZATION.LARGE_EXPRESSIONS` or the number of iterations of `CONCRETIZATION.HOT_ADDRESSES`.
+
+- <b>void addNativeCallback(\ref py_CALLBACK_page kind, integer function, integer user=0, list watch=None)</b><br>
+Adds a callback which is a C function at the address `function`, e.g. `ctypes.cast(lib.hook, ctypes.c_void_p).value` of a shared library,
+called with the user data `user` and without going through the interpreter. The C prototypes are described in `triton/callbacks.hpp`: a getter
+writes the little-endian value into the given buffer and returns non-zero if it did, a page callback returns the number of bytes of the page it wrote,
+a setter receives the little-endian value. `SYMBOLIC_SIMPLIFICATION` has no native prototype. The `watch` list filters the calls as for addCallback().
+
+- <b>void addRewriteRule(string pattern, string replacement)</b><br>
+Adds a native rewrite rule applied by `simplify()` before the simplification callbacks, e.g. `addRewriteRule('(bvsub (bvor x y) (bvand x y))', '(bvxor x y)')`.
+A name matches any node and a name starting with `#` matches a concrete node.
+
+- <b>void addSymbolicRegion(integer addr, integer size)</b><br>
+Declares a symbolic region of the memory, whose cells are kept symbolic by `CONCRETIZATION.OUTSIDE_REGIONS`.
+
+- <b>void addVirtualFile(string path, bytes data, bool symbolic=False)</b><br>
+Adds or replaces a file of the virtual filesystem of the system calls (see enableSyscallEmulation()). The bytes read from a
+symbolic file are symbolic variables, one per byte of the file, and are tainted.
+
+- <b>integer applyModelToBuffer(model, integer addr, buffer)</b><br>
+Writes the values of the memory variables of `model` lying at `addr` and above into the writable contiguous bytes-like object `buffer`,
+in little endian, as many bytes as its size. The other bytes are left untouched. The `model` is either a dictionary returned by getModel()
+or a list returned by getDenseModel(). Returns the number of bytes written.
 
 - <b>void assignSymbolicExpressionToMemory(\ref py_SymbolicExpression_page symExpr, \ref py_MemoryAccess_page mem)</b><br>
 Assigns a \ref py_SymbolicExpression_page to a \ref py_MemoryAccess_page area. **Be careful**, use this function only if you know what you are doing.
@@ -50,12 +85,35 @@ The symbolic expression (`symExpr`) must be aligned to the memory access.
 Assigns a \ref py_SymbolicExpression_page to a \ref py_Register_page. **Be careful**, use this function only if you know what you are doing.
 The symbolic expression (`symExpr`) must be aligned to the targeted size register. The register must be a parent register.
 
+- <b>void attachGdbRemote(string endpoint, integer prefetch=4)</b><br>
+Attaches to a stopped target (gdbserver, QEMU gdb stub...) through the GDB remote protocol at `host:port`. The general purpose registers,
+the program counter and the flags are set from the target, then each page of memory is fetched the first time it is touched, along with the
+`prefetch` pages following it. An attached target is detached first.
+
 - <b>\ref py_EXCEPTION_page buildSemantics(\ref py_Instruction_page inst)</b><br>
 Builds the instruction semantics. Returns `EXCEPTION.NO_FAULT` if the instruction is supported.
 
+- <b>void cancelAsync(void)</b><br>
+Cancels the pending and running queries of getModelAsync() and isSatAsync().
+
+- <b>void clearAstBudgetEvents(void)</b><br>
+Clears the events recorded by the AST budget.
+
 - <b>void clearCallbacks(void)</b><br>
 Clears recorded callbacks.
 
+- <b>void clearConcreteMemo(void)</b><br>
+Removes all executions of the concrete memo and resets its statistics.
+
+- <b>void clearConcretizationEvents(void)</b><br>
+Clears the recorded concretizations of the rules.
+
+- <b>void clearConcretizationPolicy(void)</b><br>
+Disables the concretization rules, and clears the symbolic regions and the recorded concretizations.
+
+- <b>void clearHeatMap(void)</b><br>
+Clears the heat map of the processed code.
+
 - <b>void clearModes(void)</b><br>
 Clears recorded modes.
 
@@ -65,9 +123,60 @@ Clears concrete values assigned to the memory cells.
 - <b>void clearConcreteMemoryValue(integer addr, integer size)</b><br>
 Clears concrete values assigned to the memory cells from `addr` to `addr + size`.
 
+- <b>void clearCounterexampleCache(void)</b><br>
+Clears the models kept by the counterexample cache and its statistics.
+
+- <b>void clearDecodeCache(void)</b><br>
+Clears the cache of disassembled instructions.
+
+- <b>void clearJitCache(void)</b><br>
+Clears the blocks cached by `processingJit()`.
+
+- <b>void clearLoopSummaries(void)</b><br>
+Clears the loops detected by the `LOOP_SUMMARIZATION` mode.
+
 - <b>void clearPathConstraints(void)</b><br>
 Clears the current path predicate.
 
+- <b>void clearProfile(void)</b><br>
+Clears the profile of the semantics.
+
+- <b>void clearQueryCache(void)</b><br>
+Clears the cache of the query results and its statistics.
+
+- <b>void clearRewriteRules(void)</b><br>
+Removes all native rewrite rules.
+
+- <b>void clearSemanticsCache(void)</b><br>
+Clears the cache of lifted semantics.
+
+- <b>void clearSimplificationMemo(void)</b><br>
+Removes the results memoized by `simplify()`.
+
+- <b>void clearSnapshots(void)</b><br>
+Removes all snapshots.
+
+- <b>void clearSolverStatistics(void)</b><br>
+Clears the statistics of the solver queries.
+
+- <b>void clearSynthesisCache(void)</b><br>
+Clears the memo of the synthesis results and its statistics.
+
+- <b>void clearSynthesisDatabases(void)</b><br>
+Unmaps the databases of precomputed expressions.
+
+- <b>void clearTrace(void)</b><br>
+Drops the recorded timeline of the engines.
+
+- <b>void clearUnsatCoreCache(void)</b><br>
+Clears the cores kept by the unsat core cache and its statistics.
+
+- <b>void closePersistentDecodeCache(void)</b><br>
+Closes the file opened by openPersistentDecodeCache(), the cache in memory is kept.
+
+- <b>void closeSharedQueryCache(void)</b><br>
+Closes the file opened by openSharedQueryCache(), the cache in memory is kept.
+
 - <b>void concretizeAllMemory(void)</b><br>
 Concretizes all symbolic memory references.
 
@@ -92,6 +201,15 @@ Returns the new symbolic register expression and links this expression to the in
 - <b>\ref py_SymbolicExpression_page createSymbolicVolatileExpression (\ref py_Instruction_page inst, \ref py_AstNode_page node, string comment)</b><br>
 Returns the new symbolic volatile expression and links this expression to the instruction.
 
+- <b>dict decode(bytes opcode, integer addr=0)</b><br>
+Decodes an instruction without building its operands nor its disassembly, which is much cheaper than `disassembly()`. Returns a dict of its `address`, `size`, `type` (\ref py_OPCODE_page), `flow` (\ref py_FLOW_page), `branch` and `controlFlow` flags, and `target` if `direct` is true. Raises an exception if the opcode is undecodable.
+
+- <b>[dict, ...] decode(integer addr, integer size)</b><br>
+Linearly decodes the concrete memory area [addr, addr + size) as `decode(bytes opcode, integer addr)`, undecodable bytes being skipped.
+
+- <b>void detachGdbRemote(void)</b><br>
+Detaches from the target attached by attachGdbRemote(), the pages already fetched are kept.
+
 - <b>void disassembly(\ref py_Instruction_page inst)</b><br>
 Disassembles the instruction and sets up operands.
 
@@ -104,21 +222,153 @@ Disassembles a concrete memory area from `addr` and returns a list of at most `c
 - <b>\ref py_BasicBlock_page disassembly(integer addr)</b><br>
 Disassembles a concrete memory area from `addr` to control flow instruction and returns a \ref py_BasicBlock_page.
 
+- <b>[\ref py_BasicBlock_page, ...] disassemblyBlocks(integer addr, integer size, integer threads=0)</b><br>
+Disassembles the concrete memory area [addr, addr + size) with `threads` workers (0 for one per hardware thread) and returns its basic blocks in address order.
+
+- <b>void dumpSlowSolverQueries(string directory, integer threshold)</b><br>
+Dumps the solver queries lasting at least `threshold` milliseconds into `directory`, as SMT-LIB files named `query-<n>.smt2`.
+An empty directory stops the dump.
+
+- <b>void dumpSolverQueries(string path)</b><br>
+Writes every solver query into the corpus file `path`, to be replayed by the `triton-solver-replay` tool of the benchmarks.
+An empty path stops the dump.
+
+- <b>integer dumpTrace(string path, bool perfetto=False)</b><br>
+Writes the recorded timeline of the engines to `path`, as a Chrome trace (JSON) or, if `perfetto` is True, as a Perfetto trace (protobuf).
+Returns the number of events. The traces are opened by chrome://tracing or https://ui.perfetto.dev.
+
+- <b>(\ref py_EXCEPTION_page, integer) emulate(integer addr, integer count=0, [integer, ...] stops=[], {integer: function, ...} hooks={})</b><br>
+Processes the instructions from `addr`, fetched from the concrete memory, and follows the program counter, without coming back to Python at each
+instruction. It stops after `count` instructions (0 for no limit), on an address of `stops`, on an address whose memory is not defined, or on a fault.
+Before the instruction of an address of `hooks` is processed, its hook is called as `hook(ctx, addr)`: it returns False to stop, and may move the
+program counter. Returns the fault and the number of processed instructions.
+
+- <b>void enableAdaptiveTimeout(bool flag)</b><br>
+Enables or disables the adaptive timeouts. The queries without explicit timeout receive a few times their solving time predicted from their
+features (nodes, variables, multiplications, memory array) and from the previous solves of similar queries, within the bounds of a query
+and out of the budget of the current round.
+
+- <b>void enableBitBlasting(bool flag, integer maxNodes=512)</b><br>
+Enables or disables the bit-blasting of the small queries. A query of at most `maxNodes` nodes, without arrays, quantifiers, nor multiplications
+or divisions wider than 64 bits, is solved by an embedded SAT solver instead of the current solver.
+
+- <b>void enableConcreteMemo(bool flag, integer capacity=0x10000)</b><br>
+Enables or disables the memo replaying the outputs of the deterministic instructions met again with the same concrete inputs,
+without building their semantics. At most `capacity` executions are kept, the memo being flushed when it is full. Disabling clears it.
+The instructions reading symbolized or tainted values, the undo journal, the array memory model and the lazy modes go through the semantics.
+
+- <b>void enableConstraintIndependence(bool flag)</b><br>
+Enables or disables the split of the queries into clusters of constraints which do not share any variable. The clusters are solved
+separately by getModel() and isSat() and their models are merged. With the query cache, the clusters already solved are answered by the cache.
+
+- <b>void enableCounterexampleCache(bool flag, integer capacity=64)</b><br>
+Enables or disables the counterexample cache. The `capacity` most recently used models are kept and, before a query goes to the solver,
+the query is evaluated under each of them. A satisfying model answers the query. Disabling clears it.
+
+- <b>void enableDecodeCache(bool flag)</b><br>
+Enables or disables the cache of disassembled instructions, keyed by address and opcode. Disabling clears it.
+
+- <b>void enableHeatMap(bool flag, integer period=1)</b><br>
+Enables or disables the heat map of the processed code per address and per basic block. Each instruction adds its execution, the time
+spent in its semantics and the AST nodes and symbolic expressions it created to its address and to its basic block. With a `period` of `n`,
+only one instruction out of `n` is measured and counts `n` times, which keeps the heat map cheap enough to stay enabled. Disabling clears it.
+
+- <b>void enableIncrementalSolving(bool flag)</b><br>
+Enables or disables the incremental solving of the path. A live solver keeps the path constraints asserted between the queries of `getModelOfPath()`
+and `isSatOfPath()`, so that a query only asserts the constraints which changed since the previous one.
+
+- <b>void enablePresolver(bool flag)</b><br>
+Enables or disables the presolver. The known bits and the ranges of the nodes of a constraint are computed before it goes to the solver:
+a constraint proved false is unsatisfiable and, for isSat(), a constraint proved true is satisfiable.
+
+- <b>void enableProfiling(bool flag)</b><br>
+Enables or disables the profiling of the semantics per instruction type. Disabling clears the profile.
+
+- <b>void enableQueryCache(bool flag, integer capacity=1024)</b><br>
+Enables or disables the cache of the query results, keyed by the canonical hash of the query, its timeout and its number of models.
+The canonical form follows the references, sorts the operands of the commutative operators, puts the constants of the comparisons on the
+right and numbers the variables by position, so that a query hits the results of the same query on other variables.
+The `capacity` least recently used results are kept. Disabling clears it.
+
+- <b>void enableQueryClassification(bool flag)</b><br>
+Enables or disables the classification of the solver queries, enabled by default. A classified query is solved with the configuration
+of its \ref py_QUERY_page class, otherwise with the one of `QUERY.ANY`.
+
+- <b>void enableSemanticsCache(bool flag)</b><br>
+Enables or disables the cache of lifted semantics, keyed by address and opcode. Disabling clears it.
+
+- <b>void enableSolverStatistics(bool flag)</b><br>
+Enables or disables the statistics of the solver queries, see getSolverStatistics(). The asynchronous queries are not recorded.
+
+- <b>void enableSynthesisCache(bool flag)</b><br>
+Enables or disables the memo of the synthesis results. A subtree is keyed by its structure regardless of its variables, so the same gadget
+is synthesized once, even on other variables, and the results are kept across the calls and the resets. Disabling keeps the results.
+
+- <b>void enableSyscallEmulation(bool flag)</b><br>
+Enables or disables the native emulation of the Linux system calls. Once a `syscall` (x86-64), `int 0x80` (i386) or `svc` (AArch64)
+instruction is processed, the call is applied on the concrete, symbolic and taint states and its result written into the return
+register. The emulated calls are `brk`, `clock_gettime`, `close`, `exit`, `exit_group`, `getegid`, `geteuid`, `getgid`, `getpid`,
+`gettimeofday`, `getuid`, `lseek`, `mmap`, `mmap2`, `mprotect`, `munmap`, `open`, `openat`, `read`, `time` and `write`, the
+others return `-ENOSYS`. The files are kept in a virtual filesystem where `/dev/stdin`, `/dev/stdout` and `/dev/stderr` are
+opened on the descriptors 0, 1 and 2, and the clock is virtual.
+
+- <b>void enableTracing(bool flag)</b><br>
+Enables or disables the recording of the timeline of the engines (processing, semantics, symbolic expressions, solver queries and
+simplifications), for every context of the process. Triton must be built with the `TRACING` option.
+
+- <b>void enableUndoJournal(bool flag, integer capacity=1024)</b><br>
+Enables or disables the undo journal of processing(). The last `capacity` instructions processed can then be undone with stepBack().
+The taint state is not journaled.
+
+- <b>void enableUnsatCoreCache(bool flag, integer capacity=256)</b><br>
+Enables or disables the unsat core cache. Once a query is unsatisfiable, the solver extracts a subset of its constraints which is
+unsatisfiable as well (a core), kept as their structural hashes. A later query containing all the constraints of one of the `capacity`
+most recently used cores is unsatisfiable without solver. Disabling clears it.
+
+- <b>integer enumerateModels(\ref py_AstNode_page node, function callback, [\ref py_SymbolicVariable_page, ...] projection=[], integer limit=0, bool status=False, integer timeout=0)</b><br>
+Enumerates the models of a symbolic constraint and streams them to `callback`, which receives each model as a dictionary of
+{integer symVarId : \ref py_SolverModel_page model} and stops the enumeration by returning False. The models are distinct on the `projection`
+variables only, all the variables of `node` if it is empty, and only the projection is in a model. The enumeration also stops once `limit`
+models are found (0 for unlimited). The `timeout` applies to each check. Returns the number of models. If status is True, returns a tuple of
+(integer count, \ref py_SOLVER_STATE_page status, integer solvingTime), the status being UNSAT once every model is enumerated.
+
+- <b>integer evaluateAstViaModel(\ref py_AstNode_page node, dict model)</b><br>
+Evaluates an AST with the values of a model, as returned by getModel(). The values of the dictionary may also be integers, indexed by symbolic
+variable id. The other variables keep their values. Neither the AST nor the variables are modified.
+
 - <b>integer evaluateAstViaSolver(\ref py_AstNode_page node)</b><br>
 Evaluates an AST via the solver and returns the concrete value.
 
+- <b>void exportHeatMap(string path, bool flameGraph=False)</b><br>
+Writes the heat map to the file `path`, as a report of the basic blocks and of the addresses, the hottest first, or as the folded stacks
+of the addresses under their basic blocks, weighted by their time, as read by `flamegraph.pl`.
+
+- <b>\ref py_TritonContext_page fork(void)</b><br>
+Returns a new context which starts from the current concrete, symbolic and taint states. Both contexts share the modes and the AST context,
+states are shared copy-on-write. Callbacks are not inherited.
+
 - <b>[\ref py_Register_page, ...] getAllRegisters(void)</b><br>
 Returns the list of all registers. Each item of this list is a \ref py_Register_page.
 
 - <b>\ref py_ARCH_page getArchitecture(void)</b><br>
 Returns the current architecture used.
 
+- <b>[dict, ...] getAstBudgetEvents(void)</b><br>
+Returns the ASTs which exceeded the budget, in order. Each event is a dictionary with the `address` of the instruction, the `id` of
+the first symbolic expression created, the `level` of the AST, its number of `nodes` counted up to the budget and `concretized`.
+
 - <b>\ref py_AstContext_page getAstContext(void)</b><br>
 Returns the AST context to create and modify nodes.
 
 - <b>\ref py_AST_REPRESENTATION_page getAstRepresentationMode(void)</b><br>
 Returns the current AST representation mode.
 
+- <b>integer getAsyncSize(void)</b><br>
+Returns the number of pending and running queries of getModelAsync() and isSatAsync().
+
+- <b>dict getConcreteMemoStats(void)</b><br>
+Returns the statistics of the concrete memo: the `hits`, `misses`, `records` and `flushes` counters, the `size` in executions and the `capacity`.
+
 - <b>bytes getConcreteMemoryAreaValue(integer addr, integer size, bool callbacks=True)</b><br>
 Returns the concrete value of a memory area.
 
@@ -128,50 +378,161 @@ Returns the concrete value of a memory cell.
 - <b>integer getConcreteMemoryValue(\ref py_MemoryAccess_page mem, bool callbacks=True)</b><br>
 Returns the concrete value of memory cells.
 
+- <b>bytes getConcreteRegisterFile(void)</b><br>
+Returns a copy of the concrete register file, in which the concrete values of all registers are stored contiguously.
+
 - <b>integer getConcreteRegisterValue(\ref py_Register_page reg, bool callbacks=True)</b><br>
 Returns the concrete value of a register.
 
 - <b>integer getConcreteVariableValue(\ref py_SymbolicVariable_page symVar)</b><br>
 Returns the concrete value of a symbolic variable.
 
+- <b>[dict, ...] getConcretizationEvents(void)</b><br>
+Returns the concretizations of the rules, in order. Each event is a dictionary with the `address` of the instruction, the
+\ref py_CONCRETIZATION_page `rule`, the parent `register` concretized or None, and the `memory` address and `size` of a memory area.
+
+- <b>integer getCounterexampleCacheHits(void)</b><br>
+Returns the number of queries satisfied by a model of the counterexample cache.
+
+- <b>integer getCounterexampleCacheSize(void)</b><br>
+Returns the number of models kept by the counterexample cache.
+
+- <b>[(integer symVarId, integer value), ...] getDenseModel(\ref py_AstNode_page node, bool status=False, integer timeout=0)</b><br>
+Computes and returns a model from a symbolic constraint as a list of (symVarId, value) tuples sorted by symVarId, without creating any
+\ref py_SolverModel_page. If status is True, returns a tuple of (list model, \ref py_SOLVER_STATE_page status, integer solvingTime).
+
+- <b>dict getFunctionSummaries(void)</b><br>
+Returns the summarized addresses as a dictionary of {integer addr : string name}.
+
+- <b>dict getGdbRemoteStats(void)</b><br>
+Returns the statistics of the target attached by attachGdbRemote() as a dictionary of {string name : integer value}: `packets` sent and
+`pages` fetched. Returns None if no target is attached.
+
 - <b>integer getGprBitSize(void)</b><br>
 Returns the size in bits of the General Purpose Registers.
 
 - <b>integer getGprSize(void)</b><br>
 Returns the size in bytes of the General Purpose Registers.
 
+- <b>[(integer addr, dict spot), ...] getHotSpots(bool blocks=False, integer count=0)</b><br>
+Returns the heat of the addresses, or of the basic blocks, the hottest first. Only the `count` hottest are returned, all if 0. Each spot
+gives the `count` of executions, the cumulative `time` spent in their semantics in nanoseconds, and the number of AST `nodes` and symbolic
+`expressions` created.
+
 - <b>\ref py_AstNode_page getImmediateAst(\ref py_Immediate_page imm)</b><br>
 Returns the AST corresponding to the \ref py_Immediate_page.
 
+- <b>integer getJitCacheSize(void)</b><br>
+Returns the number of blocks cached by `processingJit()`, the ones which can not be compiled included.
+
+- <b>[dict, ...] getLoopSummaries(void)</b><br>
+Returns the loops detected by the `LOOP_SUMMARIZATION` mode, in order. Each loop is a dictionary with the `address` of its back-edge
+branch, the `target` head, the number of `iterations`, the number of path `constraints` dropped, the `inductions` registers ids
+and `concretized`.
+
+- <b>integer getLoopUnrollBound(void)</b><br>
+Returns the number of iterations of a loop with a symbolic condition recorded before it is concretized.
+
 - <b>\ref py_AstNode_page getMemoryAst(\ref py_MemoryAccess_page mem)</b><br>
 Returns the AST corresponding to the \ref py_MemoryAccess_page with the SSA form.
 
+- <b>[integer, ...] getMemoryTaintLabels(integer addr, integer size=1)</b><br>
+Returns the sorted labels of the inputs which reach `size` bytes from an address.
+
+- <b>[integer, ...] getMemoryTaintLabels(\ref py_MemoryAccess_page mem)</b><br>
+Returns the sorted labels of the inputs which reach a memory.
+
+- <b>dict getMemoryUsage(void)</b><br>
+Returns an estimate of the memory held by the engines, cheap enough to be polled after each instruction. The dictionary maps the figures
+of `MemoryUsage` (e.g. `symbolicExpressions`, `concreteMemoryBytes`, `totalBytes`) to integers, and `astNodes` and `astNodesBytes`
+to a dictionary of {\ref py_AST_NODE_page type : integer}.
+
+- <b>integer getMergeDistance(void)</b><br>
+Returns the maximum number of bytes of each side of a branch merged by MODE.STATE_MERGING (64 by default).
+
+- <b>[\ref py_PathConstraint_page, ...] getMergedPathConstraints(void)</b><br>
+Returns the path constraints of the branches whose sides were merged by MODE.STATE_MERGING, in order.
+
 - <b>dict getModel(\ref py_AstNode_page node, bool status=False, integer timeout=0)</b><br>
 Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from a symbolic constraint.
 If status is True, returns a tuple of (dict model, \ref py_SOLVER_STATE_page status, integer solvingTime).
 
+- <b>\ref py_SolverFuture_page getModelAsync(\ref py_AstNode_page node, integer timeout=0)</b><br>
+Queues the computation of a model of `node` and returns its \ref py_SolverFuture_page handle. The query is solved by a background
+worker while the emulation keeps running, and the constraint must not be modified until it ends.
+
+- <b>dict getModelOfPath(integer index, \ref py_AstNode_page node, bool status=False, integer timeout=0)</b><br>
+Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} of `node` under the first `index` path
+constraints, e.g. the negation of the branch `index`. If status is True, returns a tuple of (dict model, \ref py_SOLVER_STATE_page status, integer solvingTime).
+
 - <b>[dict, ...] getModels(\ref py_AstNode_page node, integer limit, bool status=False, integer timeout=0)</b><br>
 Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
 If status is True, returns a tuple of ([dict model, ...], \ref py_SOLVER_STATE_page status, integer solvingTime).
 
+- <b>[dict, ...] getModelsToReachAddresses([integer, ...] addrs, integer threads=0, integer timeout=0)</b><br>
+Solves the predicates of getPredicatesToReachAddresses() in a batch on `threads` threads (0 for one per core), and returns for each address
+the model of its first satisfiable predicate as a dictionary of {integer SymVarId : \ref py_SolverModel_page model}, empty if there is none.
+
 - <b>\ref py_Register_page getParentRegister(\ref py_Register_page reg)</b><br>
 Returns the parent \ref py_Register_page from a \ref py_Register_page.
 
 - <b>[\ref py_Register_page, ...] getParentRegisters(void)</b><br>
 Returns the list of parent registers. Each item of this list is a \ref py_Register_page.
 
+- <b>[integer, ...] getPathConstraintThreads(void)</b><br>
+Returns the sorted ids of the threads of the path constraints.
+
 - <b>[\ref py_PathConstraint_page, ...] getPathConstraints(void)</b><br>
 Returns the logical conjunction vector of path constraints as a list of \ref py_PathConstraint_page.
 
+- <b>[\ref py_PathConstraint_page, ...] getPathConstraintsOfThread(integer threadId)</b><br>
+Returns the path constraints of a given thread, in order, as a list of \ref py_PathConstraint_page.
+
+- <b>integer getPathConstraintsWindow(void)</b><br>
+Returns the number of recent path constraints kept by `setPathConstraintsWindow()`, 0 if the path is not windowed.
+
 - <b>\ref py_AstNode_page getPathPredicate(void)</b><br>
 Returns the current path predicate as an AST of logical conjunction of each taken branch.
 
+- <b>\ref py_AstNode_page getPathPredicateOfThread(integer threadId)</b><br>
+Returns the logical conjunction of the taken branches of a given thread, the constraints of the other threads being ignored.
+
 - <b>integer getPathPredicateSize(void)</b><br>
 Returns the size of the path predicate (number of constraints).
 
+- <b>integer getPointerResolutionBound(void)</b><br>
+Returns the maximum number of addresses a symbolic pointer is resolved to with MODE.POINTER_RESOLUTION, 16 by default.
+
 - <b>[\ref py_AstNode_page, ...] getPredicatesToReachAddress(integer addr)</b><br>
 Returns path predicates which may reach the targeted address.
 
+- <b>[[\ref py_AstNode_page, ...], ...] getPredicatesToReachAddresses([integer, ...] addrs)</b><br>
+Returns the path predicates which may reach each targeted address, in the order of `addrs`.
+
+- <b>integer getPresolverHits(void)</b><br>
+Returns the number of queries decided by the presolver.
+
+- <b>dict getProfile(void)</b><br>
+Returns the profile of the semantics as a dictionary of {integer \ref py_OPCODE_page : dict profile}. Each profile gives the `count` of
+instructions processed, the cumulative `time` spent in their semantics in nanoseconds, and the number of AST `nodes` and symbolic
+`expressions` created.
+
+- <b>integer getProgramExitStatus(void)</b><br>
+Returns the status given to the `exit` or `exit_group` system call.
+
+- <b>integer getQueryCacheHits(void)</b><br>
+Returns the number of queries answered by the cache.
+
+- <b>integer getQueryCacheMisses(void)</b><br>
+Returns the number of queries sent to the solver while the cache is enabled.
+
+- <b>integer getQueryCacheSize(void)</b><br>
+Returns the number of cached query results.
+
+- <b>dict getQueryConfiguration(\ref py_QUERY_page query)</b><br>
+Returns the configuration of the solvers for a class of queries, as a dictionary of {"logic": string, "tactics": string,
+"satSolver": string, "rewriteLevel": integer}, see `setQueryConfiguration()`.
+
 - <b>\ref py_Register_page getRegister(\ref py_REG_page id)</b><br>
 Returns the \ref py_Register_page class corresponding to a \ref py_REG_page id.
 
@@ -181,14 +542,35 @@ Returns the \ref py_Register_page class corresponding to a string.
 - <b>\ref py_AstNode_page getRegisterAst(\ref py_Register_page reg)</b><br>
 Returns the AST corresponding to the \ref py_Register_page with the SSA form.
 
+- <b>[integer, ...] getRegisterTaintLabels(\ref py_Register_page reg)</b><br>
+Returns the sorted labels of the inputs which reach a register.
+
+- <b>integer getSemanticsCacheSize(void)</b><br>
+Returns the number of instructions in the cache of lifted semantics.
+
+- <b>integer getSimplificationMemoHits(void)</b><br>
+Returns the number of results given back by the memo of `simplify()` instead of simplifying the nodes again.
+
+- <b>integer getSimplificationMemoSize(void)</b><br>
+Returns the number of results memoized by `simplify()`, the ones of the nodes which died since included. The results are memoized by node, while the node and its result are alive and unmodified, until the simplification callbacks, the rewrite rules or the modes change.
+
 - <b>\ref py_SOLVER_page getSolver(void)</b><br>
 Returns the SMT solver engine currently used.
 
+- <b>dict getSolverStatistics(void)</b><br>
+Returns the statistics of the solver queries: `queries`, `statuses` (a dictionary of {\ref py_SOLVER_STATE_page : count}),
+`histogram` (the count of queries under 1ms, 10ms, 100ms, 1s, 10s and beyond), `nodes`, `maxNodes` and `variables` (the sizes
+of the constraints), `queryTime`, `checkTime`, `translationTime` and `maxQueryTime` (in microseconds), and the hits of the caches
+`queryCacheHits`, `queryCacheMisses` and `counterexampleHits`, and the queries decided by the presolver `presolverHits`.
+
 - <b>\ref py_SymbolicExpression_page getSymbolicExpression(integer symExprId)</b><br>
 Returns the symbolic expression corresponding to an id.
 
-- <b>dict getSymbolicExpressions(void)</b><br>
-Returns all symbolic expressions as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
+- <b>dict getSymbolicExpressions([\ref py_SYMBOLIC_page type])</b><br>
+Returns all symbolic expressions, or those of a type from its index, as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
+
+- <b>[\ref py_SymbolicExpression_page, ...] getSymbolicExpressionsAt(integer addr)</b><br>
+Returns the symbolic expressions of the instructions processed at an address, in creation order.
 
 - <b>dict getSymbolicMemory(void)</b><br>
 Returns the map of symbolic memory as {integer address : \ref py_SymbolicExpression_page expr}.
@@ -217,38 +599,95 @@ Returns the symbolic variable corresponding to a symbolic variable id.
 - <b>\ref py_SymbolicVariable_page getSymbolicVariable(string symVarName)</b><br>
 Returns the symbolic variable corresponding to a symbolic variable name.
 
-- <b>dict getSymbolicVariables(void)</b><br>
-Returns all symbolic variables as a dictionary of {integer SymVarId : \ref py_SymbolicVariable_page var}.
+- <b>dict getSymbolicVariables([\ref py_SYMBOLIC_page type, [integer origin]])</b><br>
+Returns all symbolic variables, or those of a type, optionally assigned to an origin (memory address or register id), as a dictionary of {integer SymVarId : \ref py_SymbolicVariable_page var}.
+
+- <b>integer getSynthesisCacheHits(void)</b><br>
+Returns the number of subtrees answered by the memo of the synthesis results.
+
+- <b>integer getSynthesisCacheSize(void)</b><br>
+Returns the number of subtrees held by the memo of the synthesis results.
+
+- <b>integer getSynthesisDatabasesSize(void)</b><br>
+Returns the number of databases of precomputed expressions.
 
 - <b>[integer, ...] getTaintedMemory(void)</b><br>
 Returns the list of all tainted addresses.
 
+- <b>[(integer addr, integer size), ...] getTaintedRanges(void)</b><br>
+Returns the tainted addresses as sorted and coalesced intervals of (addr, size).
+
 - <b>[\ref py_Register_page, ...] getTaintedRegisters(void)</b><br>
 Returns the list of all tainted registers.
 
 - <b>[\ref py_SymbolicExpression_page, ...] getTaintedSymbolicExpressions(void)</b><br>
 Returns the list of all tainted symbolic expressions.
 
+- <b>integer getTimeoutRoundRemaining(void)</b><br>
+Returns the time left in the current round of the adaptive timeouts, in milliseconds. Returns 0 for an unlimited round.
+
+- <b>integer getUndoJournalSize(void)</b><br>
+Returns the number of instructions which can be undone.
+
+- <b>integer getUnsatCoreCacheHits(void)</b><br>
+Returns the number of queries contradicted by a core of the unsat core cache.
+
+- <b>integer getUnsatCoreCacheSize(void)</b><br>
+Returns the number of cores kept by the unsat core cache.
+
+- <b>bytes getVirtualFile(string path)</b><br>
+Returns the content of a file of the virtual filesystem of the system calls, e.g. `/dev/stdout`.
+
+- <b>bool hasProgramExited(void)</b><br>
+Returns true once the program called the `exit` or `exit_group` system call.
+
+- <b>bool isAdaptiveTimeoutEnabled(void)</b><br>
+Returns true if the timeouts are adaptive.
+
+- <b>bool isAnyTainted(integer addr, integer size)</b><br>
+Returns true if one of the `size` bytes from an address is tainted.
+
 - <b>bool isArchitectureValid(void)</b><br>
 Returns true if the architecture is valid.
 
+- <b>bool isBitBlastingEnabled(void)</b><br>
+Returns true if the small queries are bit-blasted.
+
+- <b>bool isConcreteMemoEnabled(void)</b><br>
+Returns true if the concrete memo is enabled.
+
 - <b>bool isConcreteMemoryValueDefined(\ref py_MemoryAccess_page mem)</b><br>
 Returns true if memory cells have a defined concrete value.
 
 - <b>bool isConcreteMemoryValueDefined(integer addr, integer size)</b><br>
 Returns true if memory cells have a defined concrete value.
 
+- <b>bool isConstraintIndependenceEnabled(void)</b><br>
+Returns true if the queries are split into independent clusters of constraints before solving.
+
+- <b>bool isCounterexampleCacheEnabled(void)</b><br>
+Returns true if the counterexample cache is enabled.
+
+- <b>bool isDecodeCacheEnabled(void)</b><br>
+Returns true if the cache of disassembled instructions is enabled.
+
 - <b>bool isFlag(\ref py_Register_page reg)</b><br>
 Returns true if the register is a flag.
 
+- <b>bool isHeatMapEnabled(void)</b><br>
+Returns true if the heat map is enabled.
+
+- <b>bool isIncrementalSolvingEnabled(void)</b><br>
+Returns true if the path is solved incrementally.
+
 - <b>bool isMemorySymbolized(integer addr)</b><br>
 Returns true if the memory cell expression contains a symbolic variable.
 
 - <b>bool isMemorySymbolized(\ref py_MemoryAccess_page mem)</b><br>
 Returns true if memory cell expressions contain symbolic variables.
 
-- <b>bool isMemoryTainted(integer addr)</b><br>
-Returns true if the address is tainted.
+- <b>bool isMemoryTainted(integer addr, integer size=1)</b><br>
+Returns true if one of the `size` bytes from the address is tainted.
 
 - <b>bool isMemoryTainted(\ref py_MemoryAccess_page mem)</b><br>
 Returns true if the memory is tainted.
@@ -256,6 +695,22 @@ Returns true if the memory is tainted.
 - <b>bool isModeEnabled(\ref py_MODE_page mode)</b><br>
 Returns true if the mode is enabled.
 
+- <b>bool isOpaquePredicate(\ref py_AstNode_page node, integer samples=4096, integer timeout=0)</b><br>
+Returns true if `node` has the same value for any input, e.g. an opaque predicate. The node is evaluated on `samples` inputs first,
+and only the nodes which do not vary on them are proved by the solver.
+
+- <b>bool isPresolverEnabled(void)</b><br>
+Returns true if the presolver is enabled.
+
+- <b>bool isProfilingEnabled(void)</b><br>
+Returns true if the semantics are profiled.
+
+- <b>bool isQueryCacheEnabled(void)</b><br>
+Returns true if the cache of the query results is enabled.
+
+- <b>bool isQueryClassificationEnabled(void)</b><br>
+Returns true if the solver queries are classified.
+
 - <b>bool isRegister(\ref py_Register_page reg)</b><br>
 Returns true if the register is a register (see also isFlag()).
 
@@ -268,32 +723,121 @@ Returns true if the register is tainted.
 - <b>bool isRegisterValid(\ref py_Register_page reg)</b><br>
 Returns true if the register is valid.
 
+- <b>bool isSatOfPath(integer index, \ref py_AstNode_page node)</b><br>
+Returns true if `node` is satisfiable under the first `index` path constraints.
+
 - <b>bool isSat(\ref py_AstNode_page node)</b><br>
 Returns true if an expression is satisfiable.
 
+- <b>\ref py_SolverFuture_page isSatAsync(\ref py_AstNode_page node, integer timeout=0)</b><br>
+Queues the satisfiability check of `node` and returns its \ref py_SolverFuture_page handle, see getModelAsync().
+
+- <b>bool isSemanticsCacheEnabled(void)</b><br>
+Returns true if the cache of lifted semantics is enabled.
+
+- <b>bool isSharedQueryCacheOpen(void)</b><br>
+Returns true if a file has been opened by openSharedQueryCache().
+
+- <b>bool isSmtStreamEnabled(void)</b><br>
+Returns true if the SMT export of the trace is being written.
+
+- <b>bool isSnapshotExists(integer id)</b><br>
+Returns true if the snapshot exists.
+
+- <b>bool isSolverStatisticsEnabled(void)</b><br>
+Returns true if the statistics of the solver queries are recorded.
+
 - <b>bool isSymbolicExpressionExists(integer symExprId)</b><br>
 Returns true if the symbolic expression id exists.
 
+- <b>bool isSynthesisCacheEnabled(void)</b><br>
+Returns true if the memo of the synthesis results is enabled.
+
+- <b>bool isSyscallEmulationEnabled(void)</b><br>
+Returns true if the system calls are emulated.
+
 - <b>bool isThumb(void)</b><br>
 Returns true if execution mode is Thumb (only valid for ARM32).
 
+- <b>bool isTracingEnabled(void)</b><br>
+Returns true if the timeline of the engines is recorded.
+
+- <b>bool isUndoJournalEnabled(void)</b><br>
+Returns true if the undo journal is enabled.
+
+- <b>bool isUnsatCoreCacheEnabled(void)</b><br>
+Returns true if the unsat core cache is enabled.
+
+- <b>\ref py_SymbolicIterator_page iterSymbolicExpressions(void)</b><br>
+Returns a lazy iterator over the symbolic expressions, which are wrapped only once reached. Unlike getSymbolicExpressions(), no dictionary is built.
+
+- <b>\ref py_SymbolicIterator_page iterSymbolicMemory(void)</b><br>
+Returns a lazy iterator over the symbolic memory, as (integer address, \ref py_SymbolicExpression_page expr) pairs.
+
+- <b>\ref py_SymbolicIterator_page iterSymbolicRegisters(void)</b><br>
+Returns a lazy iterator over the symbolic registers, as (\ref py_REG_page reg, \ref py_SymbolicExpression_page expr) pairs.
+
+- <b>\ref py_SymbolicIterator_page iterSymbolicVariables(void)</b><br>
+Returns a lazy iterator over the symbolic variables, which are wrapped only once reached.
+
+- <b>string liftToBTOR2(\ref py_AstNode_page node)</b><br>
+Lifts an AST or the AST of a symbolic expression, and all its references, to BTOR2 format, one line per node shared. The symbolic variables
+are inputs and the arrays are states initialized to zero. A logical AST is a `bad` property, reachable iff it is satisfiable, otherwise it is an `output`.
+
+- <b>string liftToC(\ref py_AstNode_page node, string fname="triton_expr", bool icomment=False)</b><br>
+Lifts an AST node or a symbolic expression, and all its references, to a self-contained C function `fname` returning its value. The symbolic
+variables are the arguments, in order of their ids, in the smallest unsigned type holding them. The bitvectors are computed in `uint64_t`, or in
+`unsigned __int128` whose helpers are only defined when a bitvector is wider than 64 bits. If `icomment` is true, then print instructions assembly
+in expression comments. The subexpressions used several times are printed once, as temporaries. The arrays are not supported.
+
+- <b>string liftToC([\ref py_SymbolicExpression_page or \ref py_AstNode_page, ...] nodes, string fname="triton_expr", bool icomment=False)</b><br>
+Lifts a trace of symbolic expressions or AST nodes to one C function `void fname(<variables>, <type>* out_0, ...)`, `out_i` receiving the value of `nodes[i]`.
+
+- <b>string liftToC(\ref py_BasicBlock_page block, string fname="triton_expr", bool icomment=False)</b><br>
+Lifts a processed basic block to one C function (see above) whose outputs are the last values of the registers, then of the memory cells, written by the block (up to 128 bits).
+
 - <b>string liftToDot(\ref py_AstNode_page node)</b><br>
 Lifts an AST and all its references to Dot format.
 
 - <b>string liftToDot(\ref py_SymbolicExpression_page expr)</b><br>
 Lifts a symbolic expression and all its references to Dot format.
 
+- <b>string liftToDot(\ref py_AstNode_page node, integer maxNodes=0, integer maxDepth=0)</b><br>
+Lifts an AST or the AST of a symbolic expression to Dot format, streamed breadth-first with at most `maxNodes` nodes expanded (0 for
+unlimited) down to `maxDepth` (0 for unlimited). The subtrees beyond are collapsed into summary nodes, and the shared nodes are emitted once.
+
 - <b>string liftToLLVM(\ref py_AstNode_page node, string fname="__triton", bool optimize=False)</b><br>
 Lifts an AST node and all its references to LLVM IR. `fname` is the name of the LLVM function, by default it's `__triton`. If `optimize` is true, perform optimizations (-O3 -Oz).
 
 - <b>string liftToLLVM(\ref py_SymbolicExpression_page expr, string fname="__triton", bool optimize=False)</b><br>
 Lifts a symbolic expression and all its references to LLVM IR. `fname` is the name of the LLVM function, by default it's `__triton`. If `optimize` is true, perform optimizations (-O3 -Oz).
 
+- <b>string liftToLLVM([\ref py_SymbolicExpression_page or \ref py_AstNode_page, ...] nodes, string fname="__triton", bool optimize=False)</b><br>
+Lifts a trace of symbolic expressions or AST nodes to one LLVM function `void fname(i64* inputs, i64* outputs, i8* memory)`. The symbolic variables
+are read from `inputs` in order of appearance, `outputs[i]` receives the value of `nodes[i]`, and the memory accesses are offsets from `memory`.
+
+- <b>string liftToLLVM(\ref py_BasicBlock_page block, string fname="__triton", bool optimize=False)</b><br>
+Lifts a processed basic block to one LLVM function (see above) whose outputs are the last values of the registers, then of the memory cells, written by the block (up to 64 bits).
+
 - <b>string liftToPython(\ref py_SymbolicExpression_page expr, bool icomment=False)</b><br>
-Lifts a symbolic expression and all its references to Python format. If `icomment` is true, then print instructions assembly in expression comments.
+Lifts a symbolic expression and all its references to Python format. If `icomment` is true, then print instructions assembly in expression comments. The subexpressions used several times are printed once, as temporaries.
 
 - <b>string liftToSMT(\ref py_SymbolicExpression_page expr, bool assert_=False, bool icomment=False)</b><br>
-Lifts a symbolic expression and all its references to SMT format. If `assert_` is true, then (assert <expr>). If `icomment` is true, then print instructions assembly in expression comments.
+Lifts a symbolic expression and all its references to SMT format. If `assert_` is true, then (assert <expr>). If `icomment` is true, then print instructions assembly in expression comments. The subexpressions used several times are printed once, as temporaries.
+
+- <b>void load(string path)</b><br>
+Replaces the modes and the concrete, symbolic and taint states by the ones of the checkpoint at `path`, written by save(). The file is mapped in memory and the saved pages are read in place until they are written. The context must be of the architecture of the checkpoint.
+
+- <b>[tuple, ...] loadBinary(string path)</b><br>
+Maps the segments of an ELF, PE, Mach-O or minidump file in the concrete memory without copying them. Pages are copied the first time they are written. Returns the mapped segments as a list of (address, size) tuples.
+
+- <b>void loadSynthesisCache(string path)</b><br>
+Loads the results of the file `path`, written by saveSynthesisCache(), into the memo of the synthesis results.
+
+- <b>void loadSynthesisDatabase(string path)</b><br>
+Maps the database of precomputed expressions at `path`, written by writeSynthesisDatabase() (see `src/scripts/gen_synthesis_database.py`).
+The synthesis looks up the outputs of a subtree on the inputs of the database after the oracles of the operators, so deeper expressions are synthesized
+without being enumerated. The memo of the synthesis results forgets the subtrees which could not be synthesized.
 
 - <b>\ref py_SymbolicExpression_page newSymbolicExpression(\ref py_AstNode_page node, string comment)</b><br>
 Returns a new symbolic expression. Note that if there are simplification passes recorded, simplifications will be applied.
@@ -301,27 +845,109 @@ Returns a new symbolic expression. Note that if there are simplification passes
 - <b>\ref py_SymbolicVariable_page newSymbolicVariable(integer varSize, string alias)</b><br>
 Returns a new symbolic variable.
 
+- <b>void openPersistentDecodeCache(string path, integer slots=65536)</b><br>
+Opens the file at `path` as a cache of disassembled instructions shared by the processes analyzing the same code, creating it with
+`slots` slots if it does not exist. The instructions missing from the cache in memory are looked up in the file, and the ones decoded
+are recorded in it. Triton must be built with `-DPERSISTENT_CACHE=ON`.
+
+- <b>void openSharedQueryCache(string path, integer slots=65536)</b><br>
+Opens the file at `path` as a cache of solver results shared by the processes analyzing the same target, creating it with `slots`
+slots if it does not exist. While the query cache is enabled (see enableQueryCache()), the queries missing from memory are looked up
+in the file, and the solved ones are recorded in it. Triton must be built with `-DPERSISTENT_CACHE=ON`.
+
+- <b>(\ref py_BasicBlock_page or [\ref py_BasicBlock_page, ...], dict) optimize(\ref py_BasicBlock_page or [\ref py_BasicBlock_page, ...] obj, [\ref py_PASS_page, ...] passes, bool padding=False, integer timeout=0)</b><br>
+Runs the `passes` in order on a block or on a region of blocks, the first block being the entry of the region. The region is lifted
+once from the current concrete state, its registers and loaded memory being symbolized so that the passes hold for any input. The
+`timeout` in milliseconds bounds each query proving an opaque predicate. If `padding` is true, keep addresses aligned and padds with
+NOP instructions. Returns the optimized block or blocks and a dict of statistics: `instructions`, `kept`, `deadStores`,
+`opaquePredicates`, `sampledPredicates` (the conditions varying on random inputs, rejected without solver query),
+`unreachableBlocks` and `redundantWrites`.
+
+- <b>[\ref py_AstNode_page, ...] parseSmt(string script)</b><br>
+Reads an SMT-LIB2 script, such as the one of liftToSMT(), without any solver and returns its assertions. The declared constants are
+the symbolic variables of the same name or alias, new ones being created for the others.
+
 - <b>void popPathConstraint(void)</b><br>
 Pops the last constraints added to the path predicate.
 
+- <b>integer predictSolvingTime(\ref py_AstNode_page node)</b><br>
+Returns the predicted solving time of a query, in milliseconds.
+
+- <b>integer processTrace(string path, integer segmentSize=0x10000, integer threads=0)</b><br>
+Symbolically executes the records of the binary execution trace at `path`, giving the symbolic state and the path constraints of
+replayTrace(). The segments of `segmentSize` records are summarized over fresh variables on `threads` threads (0 means the number of
+cores), then composed in order with the symbolic state, with one expression per changed location and segment. Returns the number of
+records processed.
+
 - <b>\ref py_EXCEPTION_page processing(\ref py_Instruction_page inst)</b><br>
 Processes an instruction and updates engines according to the instruction semantics. Returns `EXCEPTION.NO_FAULT` if the instruction is supported.
 
 - <b>\ref py_EXCEPTION_page processing(\ref py_BasicBlock_page block, integer addr=0)</b><br>
 Processes a basic block with a potential given base address and updates engines according to the instructions semantics.
+The flags are built once read or at the end of the block, so that the flags overwritten before being read get no expression.
+
+- <b>\ref py_EXCEPTION_page processingJit(\ref py_BasicBlock_page block, integer addr=0)</b><br>
+Processes a basic block through native code. The first time, the block goes through `processing()` and is compiled by the LLVM JIT at `addr`.
+Then, while its registers are neither symbolized nor tainted, it runs on the concrete registers without being disassembled. Only blocks of
+register instructions whose semantics do not depend on concrete values, ended by a direct branch or not, are compiled. Requires Triton built with LLVM.
 
 - <b>void pushPathConstraint(\ref py_AstNode_page node, string comment="")</b><br>
 Pushs constraints to the current path predicate.
 
+- <b>integer readConcreteMemoryInto(integer addr, buffer, bool callbacks=True)</b><br>
+Reads the concrete memory from `addr` into the writable contiguous bytes-like object `buffer` (bytearray, memoryview, mmap, numpy array...),
+as many bytes as its size, without allocating. Returns the number of bytes read.
+
 - <b>void removeCallback(\ref py_CALLBACK_page kind, function cb)</b><br>
 Removes a recorded callback.
 
+- <b>void removeConcretizationRule(\ref py_CONCRETIZATION_page rule)</b><br>
+Disables a concretization rule.
+
+- <b>void removeFunctionSummary(integer addr)</b><br>
+Removes the summary at `addr`.
+
+- <b>void removeNativeCallback(\ref py_CALLBACK_page kind, integer function)</b><br>
+Removes the native callback at the address `function`.
+
+- <b>void removeSnapshot(integer id)</b><br>
+Removes a snapshot.
+
+- <b>void removeSyscallHandler(integer number)</b><br>
+Removes the override of the system call `number`.
+
+- <b>integer replayTrace(string path, integer count=0)</b><br>
+Processes the records of the binary execution trace at `path` written by an external tracer (see triton::loaders::TraceReader for the format). The register and memory deltas of a record are set in the concrete state without concretizing nor calling the callbacks, then its instruction is processed. The trace is mapped in memory and the next records are decoded in the background. Stops after `count` records if not 0. Returns the number of records processed.
+
 - <b>void reset(void)</b><br>
 Resets everything.
 
+- <b>void resetToSnapshot(integer id)</b><br>
+Same as `restore()`, but only the memory pages changed since the last snapshot, restore or reset of `id` are copied back. Meant for
+fuzzing loops running from the same snapshot many times.
+
+- <b>void restore(integer id)</b><br>
+Restores the concrete, symbolic and taint states recorded by a snapshot. The snapshot is kept and can be restored again.
+
+- <b>void save(string path)</b><br>
+Saves the modes and the concrete, symbolic and taint states, with the path constraints, into the checkpoint at `path`. The loops, the undo journal and the snapshots are not saved.
+
+- <b>void saveSynthesisCache(string path)</b><br>
+Saves the memo of the synthesis results to the file `path`, so another process or run can load it.
+
+- <b>void setAdaptiveTimeoutBounds(integer minTimeout, integer maxTimeout)</b><br>
+Sets the smallest and the largest adaptive timeout of a query, in milliseconds.
+
 - <b>void setArchitecture(\ref py_ARCH_page arch)</b><br>
 Initializes an architecture. This function must be called before any call to the rest of the API.
 
+- <b>void setAstBudget(integer maxNodes, integer maxLevel)</b><br>
+Bounds the ASTs assigned by the semantics to `maxNodes` nodes and `maxLevel` levels, references unrolled. 0 means unbounded.
+An AST exceeding the budget falls back to its concrete value or is only recorded, according to the budget policy.
+
+- <b>void setAstBudgetPolicy(\ref py_SYMBOLIC_page policy)</b><br>
+Sets the policy applied to the ASTs exceeding the budget: `SYMBOLIC.BUDGET_CONCRETIZE` (default) or `SYMBOLIC.BUDGET_RECORD`.
+
 - <b>void setAstRepresentationMode(\ref py_AST_REPRESENTATION_page mode)</b><br>
 Sets the AST representation.
 
@@ -331,7 +957,8 @@ the symbolic state (if it exists). You should probably use the concretize functi
 
 - <b>void setConcreteMemoryAreaValue(integer addr, bytes opcodes, bool callbacks=True)</b><br>
 Sets the concrete value of a memory area. Note that setting a concrete value will probably imply a desynchronization with
-the symbolic state (if it exists). You should probably use the concretize functions after this.
+the symbolic state (if it exists). You should probably use the concretize functions after this. Any contiguous bytes-like
+object (bytes, bytearray, memoryview, mmap, numpy array...) is read in place, without an intermediate copy.
 
 - <b>void setConcreteMemoryValue(integer addr, integer value, bool callbacks=True)</b><br>
 Sets the concrete value of a memory cell. Note that setting a concrete value will probably imply a desynchronization with
@@ -341,6 +968,10 @@ the symbolic state (if it exists). You should probably use the concretize functi
 Sets the concrete value of memory cells. Note that setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
+- <b>void setConcreteRegisterFile(bytes file)</b><br>
+Replaces the concrete register file by `file`, which must come from getConcreteRegisterFile() of the same architecture.
+Callbacks are not called and the symbolic expressions of all registers are concretized.
+
 - <b>void setConcreteRegisterValue(\ref py_Register_page reg, integer value, bool callbacks=True)</b><br>
 Sets the concrete value of a register. Note that setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
@@ -348,9 +979,46 @@ the symbolic state (if it exists). You should probably use the concretize functi
 - <b>void setConcreteVariableValue(\ref py_SymbolicVariable_page symVar, integer value)</b><br>
 Sets the concrete value of a symbolic variable.
 
+- <b>integer setFunctionSummaries(integer base, dict symbols, bool msAbi=False)</b><br>
+Summarizes the functions of a stubs symbols mapping {string name : integer offset} loaded at `base`, the ones without
+summary are ignored. Returns the number of summarized functions.
+
+- <b>void setFunctionSummary(integer addr, string name, bool msAbi=False)</b><br>
+Summarizes the libc function `name` at `addr`: when the instruction at `addr` is processed, the function is applied natively on
+the concrete, symbolic and taint states instead of emulating its stub, then it returns to its caller. The summarized functions
+are `memcmp`, `memcpy`, `memmove`, `memset`, `strcmp`, `strcpy`, `strlen` and `strncmp`. Pointers and sizes are taken concrete.
+`msAbi` selects the Microsoft x64 calling convention. The summaries are not applied with the MEMORY_ARRAY mode or the undo journal.
+
+- <b>void setLoopUnrollBound(integer bound)</b><br>
+Sets the number of iterations of a loop with a symbolic condition recorded before it is concretized by the `LOOP_SUMMARIZATION`
+mode. The default bound is 16.
+
+- <b>void setMergeDistance(integer distance)</b><br>
+Sets the maximum number of bytes of each side of a branch merged by MODE.STATE_MERGING.
+
 - <b>void setMode(\ref py_MODE_page mode, bool flag)</b><br>
 Enables or disables a specific mode.
 
+- <b>void setPathConstraintsWindow(integer size)</b><br>
+Sets the number of recent path constraints kept, 0 to disable, which is the default. Once the path holds twice as many, the older
+ones are summarized into its first constraint as with `summarizePathConstraints()`, so that a long trace keeps a bounded number of
+constraints to flip while its path predicate is the same.
+
+- <b>void setPointerResolutionBound(integer bound)</b><br>
+Sets the maximum number of addresses a symbolic pointer is resolved to with MODE.POINTER_RESOLUTION. The pointers with more addresses are concretized.
+
+- <b>void setProgramBreak(integer addr)</b><br>
+Sets the start of the heap grown by the `brk` system call.
+
+- <b>void setQueryConfiguration(\ref py_QUERY_page query, dict config)</b><br>
+Sets the configuration of the solvers for a class of queries. The `config` may define the z3 `logic` (e.g. "QF_BV"), the z3 `tactics`
+applied in sequence, separated by `;`, which replace the solver of the logic, the `satSolver` of Bitwuzla (e.g. "kissat") and its
+`rewriteLevel`, from 0 to 2. A missing or empty item, or a level of -1, keeps the default of the solver.
+
+- <b>void setRemoteSolver([string, ...] endpoints)</b><br>
+Initializes the remote solver with the workers `host:port`, at least one must be reachable. The queries are pipelined to the workers,
+which solve them with their own solver.
+
 - <b>void setSolver(\ref py_SOLVER_page solver)</b><br>
 Defines an SMT solver
 
@@ -360,6 +1028,10 @@ Defines a solver memory consumption limit (in megabytes)
 - <b>void setSolverTimeout(integer ms)</b><br>
 Defines a solver timeout (in milliseconds)
 
+- <b>void setSyscallHandler(integer number, function cb)</b><br>
+Overrides the system call `number` of the current architecture. The callback takes the context and the number of the call,
+reads its arguments from the concrete registers and returns its result as an integer, written into the return register.
+
 - <b>bool setTaintMemory(\ref py_MemoryAccess_page mem, bool flag)</b><br>
 Sets the targeted memory as tainted or not. Returns true if the memory is still tainted.
 
@@ -369,16 +1041,62 @@ Sets the targeted register as tainted or not. Returns true if the register is st
 - <b>void setThumb(bool state)</b><br>
 Sets CPU state to Thumb mode (only valid for ARM32).
 
+- <b>void setTimeoutRetryCallback(function cb, integer retries=2)</b><br>
+Sets the callback deciding if a query which timed out with its adaptive timeout is retried with twice its timeout, at most `retries` times.
+It is called as `cb(node, timeout)` and returns a boolean. A None callback disables the retries.
+
 - <b>\ref py_AstNode_page simplify(\ref py_AstNode_page node, bool solver=False, bool llvm=False)</b><br>
 Calls all simplification callbacks recorded and returns a new simplified node. If the `solver` flag is
 set to True, Triton will use the current solver instance to simplify the given `node`. If `llvm` is true,
 we use LLVM to simplify node.
 
+- <b>[\ref py_AstNode_page, ...] simplify([\ref py_AstNode_page, ...] nodes, bool solver=False, bool llvm=False)</b><br>
+Simplifies each node as above. If `llvm` is true, the nodes are lifted into one LLVM module, which is optimized once.
+
 - <b>\ref py_BasicBlock_page simplify(\ref py_BasicBlock_page block, bool padding=False)</b><br>
 Performs a dead store elimination simplification on a given block. If `padding` is true, keep addresses aligned and padds with NOP instructions.
 
+- <b>[\ref py_BasicBlock_page, ...] simplify([\ref py_BasicBlock_page, ...] region, bool padding=False)</b><br>
+Performs a dead store elimination simplification on a region of blocks, the live locations flowing through the branches between
+the blocks. A region already processed is analyzed in place. Returns the simplified blocks in order.
+
 - <b>dict sliceExpressions(\ref py_SymbolicExpression_page expr)</b><br>
 Slices expressions from a given one (backward slicing) and returns all symbolic expressions as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
+A list of expressions may be given instead, the union of their slices is then computed in one pass.
+
+- <b>integer snapshot(void)</b><br>
+Takes a snapshot of the concrete, symbolic and taint states and returns its id. Memory pages and symbolic maps are shared copy-on-write with the current state.
+
+- <b>[dict, ...] solveAllBranchFlips(integer threads=0, integer timeout=0, function callback=None, integer threadId=None)</b><br>
+Solves, on `threads` threads (0 for one per core), the path prefix and the negated branch of each branch not taken by the path. The flips
+are returned in the order they finish as dictionaries of {"index", "srcAddr", "dstAddr", "status", "model", "solvingTime"}, where "index"
+is the index of the path constraint and "model" is a dictionary of {integer SymVarId : \ref py_SolverModel_page model}. The `callback`
+receives each flip as it finishes, and must not build new nodes while the other queries are running. If `threadId` is defined, only the
+branches of this thread are flipped, each one under the prefix of the constraints of this thread only. Otherwise, with incremental solving,
+the flips are solved in the order of the path by the session, each branch as an assumption.
+
+- <b>void startSmtStream(string path)</b><br>
+Starts writing the SMT export of the trace to the file `path`: the required functions, the current variables, expressions and path constraints,
+then each new symbolic variable as a `declare-fun`, symbolic expression as a `define-fun` and path constraint as an `assert`, exactly once as they
+are created. The references are written as names, so the export is a single linear pass. A popped path constraint is not retracted.
+
+- <b>void startTimeoutRound(integer budget)</b><br>
+Starts an exploration round with `budget` milliseconds to hand out to the queries with adaptive timeouts, 0 for an unlimited round.
+Once the round is spent, the queries time out without solver.
+
+- <b>void stepBack(integer count=1)</b><br>
+Undoes the concrete and symbolic register and memory assignments, and the path constraints, of the last `count` processed instructions.
+
+- <b>void stopSmtStream(void)</b><br>
+Stops writing the SMT export of the trace and closes its file.
+
+- <b>void summarizePathConstraints(integer count)</b><br>
+Replaces the first `count` path constraints by a single one, whose taken predicate is the conjunction of theirs. The path predicate
+is the same, but the branches of these constraints can no longer be flipped, and the undo journal does not restore them.
+
+- <b>[\ref py_SymbolicVariable_page, ...] symbolizeBuffer(integer addr, integer size, string symVarAlias="")</b><br>
+Converts a memory buffer to symbolic variables of up to 512 bits, one per chunk of 64 bytes or less, by increasing address, instead of
+one variable per byte. The aliases are suffixed with the index of the chunk. A model is written back to the buffer by applyModelToBuffer().
 
 - <b>\ref py_SymbolicVariable_page symbolizeExpression(integer symExprId, integer symVarSize, string symVarAlias)</b><br>
 Converts a symbolic expression to a symbolic variable. `symVarSize` must be in bits. This function returns the new symbolic variable created.
@@ -389,8 +1107,11 @@ Converts a symbolic memory expression to a symbolic variable. This function retu
 - <b>\ref py_SymbolicVariable_page symbolizeRegister(\ref py_Register_page reg, string symVarAlias)</b><br>
 Converts a symbolic register expression to a symbolic variable. This function returns the new symbolic variable created.
 
-- <b>\ref py_AstNode_page synthesize(\ref py_AstNode_page node, bool constant=True, bool subexpr=True, bool opaque=False)</b><br>
-Synthesizes a given node. If `constant` is defined to True, performs a constant synthesis. If `opaque` is true, perform opaque constant synthesis. If `subexpr` is defined to True, performs synthesis on sub-expressions.
+- <b>\ref py_AstNode_page synthesize(\ref py_AstNode_page node, bool constant=True, bool subexpr=True, bool opaque=False, integer threads=1)</b><br>
+Synthesizes a given node. If `constant` is defined to True, performs a constant synthesis. If `opaque` is true, perform opaque constant synthesis. If `subexpr` is defined to True, performs synthesis on sub-expressions, the sub-expressions of a same depth being synthesized concurrently on `threads` threads (0 for one per core) when `threads` is not 1.
+
+- <b>\ref py_AstNode_page synthesizeByEnumeration(\ref py_AstNode_page node, integer maxSize=7, integer timeout=1000, integer threads=1)</b><br>
+Synthesizes the smallest expression of at most `maxSize` nodes equivalent to `node`, by a bottom-up enumeration over the variables of `node`, the constant 1 and the arithmetic and bitwise operators. The expressions giving the same outputs on the sampled inputs are enumerated once, the one found is proven by the solver. The enumeration stops after `timeout` milliseconds (0 for no limit) and runs on `threads` threads (0 for one per core). Returns None if no expression is found.
 
 - <b>bool taintAssignment(\ref py_MemoryAccess_page memDst, \ref py_Immediate_page immSrc)</b><br>
 Taints `memDst` from `immSrc` with an assignment - `memDst` is untained. Returns true if the `memDst` is still tainted.
@@ -414,15 +1135,31 @@ Taints `regDst` from `MemSrc` with an assignment - `regDst` is tainted if `memSr
 Taints `regDst` from `regSrc` with an assignment - `regDst` is tainted if `regSrc` is tainted, otherwise
 `regDst` is untained. Return true if `regDst` is tainted.
 
-- <b>bool taintMemory(integer addr)</b><br>
-Taints an address. Returns true if the address is tainted.
+- <b>bool taintMemory(integer addr, integer size=1)</b><br>
+Taints `size` bytes from an address. Returns true if the addresses are tainted.
 
 - <b>bool taintMemory(\ref py_MemoryAccess_page mem)</b><br>
 Taints a memory. Returns true if the memory is tainted.
 
+- <b>bool taintMemoryRange(integer addr, integer size)</b><br>
+Taints the interval of `size` bytes from an address at once. Returns true if the addresses are tainted.
+
+- <b>bool taintMemoryWithLabel(integer addr, integer size, integer label)</b><br>
+Taints `size` bytes from an address and adds `label` to their labels. Labels are propagated along with the taint
+once one of them has been set. Returns true if the addresses are tainted.
+
+- <b>bool taintMemoryWithLabel(\ref py_MemoryAccess_page mem, integer label)</b><br>
+Taints a memory and adds `label` to its labels. Returns true if the memory is tainted.
+
 - <b>bool taintRegister(\ref py_Register_page reg)</b><br>
 Taints a register. Returns true if the register is tainted.
 
+- <b>bool taintRegisterWithLabel(\ref py_Register_page reg, integer label)</b><br>
+Taints a register and adds `label` to its labels. Returns true if the register is tainted.
+
+- <b>integer taintTrace(string path, integer chunkSize=0x10000, integer threads=0)</b><br>
+Propagates the taint through the records of the binary execution trace at `path`, like replayTrace() but without updating the symbolic state. The chunks of `chunkSize` records are summarized on `threads` threads (0 means the number of cores), then the summaries are applied in order. Only the taint bits are propagated, not the labels. Returns the number of records processed.
+
 - <b>bool taintUnion(\ref py_MemoryAccess_page memDst, \ref py_Immediate_page immSrc)</b><br>
 Taints `memDst` from `immSrc` with an union - `memDst` does not changes. Returns true if `memDst` is tainted.
 
@@ -445,15 +1182,27 @@ tainted. Returns true if `regDst` is tainted.
 Taints `regDst` from `regSrc` with an union - `regDst` is tainted if `regDst` or `regSrc` are
 tainted. Returns true if `regDst` is tainted.
 
-- <b>bool untaintMemory(integer addr)</b><br>
-Untaints an address. Returns true if the address is still tainted.
+- <b>bool untaintMemory(integer addr, integer size=1)</b><br>
+Untaints `size` bytes from an address. Returns true if the addresses are still tainted.
 
 - <b>bool untaintMemory(\ref py_MemoryAccess_page mem)</b><br>
 Untaints a memory. Returns true if the memory is still tainted.
 
+- <b>bool untaintMemoryRange(integer addr, integer size)</b><br>
+Untaints the interval of `size` bytes from an address at once. Returns true if the addresses are still tainted.
+
 - <b>bool untaintRegister(\ref py_Register_page reg)</b><br>
 Untaints a register. Returns true if the register is still tainted.
 
+- <b>void warmReset(void)</b><br>
+Resets everything like `reset()`, but keeps the engines, their allocations, the disassembler, the cache of lifted semantics and the solver.
+The nodes built before must not be used after it. Meant for pools of contexts running many short tasks. A forked context gets its own
+modes, AST context and engines instead, so that the other side of the fork is left untouched.
+
+- <b>integer writeSynthesisDatabase(string path, [\ref py_AstNode_page, ...] vars, [[integer, ...], ...] inputs, [\ref py_AstNode_page, ...] exprs)</b><br>
+Writes to `path` the database of the expressions `exprs` on the variable nodes `vars`, each expression being indexed by its outputs on the vectors
+of `inputs`. The first expression of each signature is kept. Returns the number of expressions written.
+
 */
 
 
@@ -483,14 +1232,73 @@ namespace triton {
       }
 
 
+      /* Fills the filter of a callback from a list of Register, MemoryAccess or (integer addr, integer size) */
+      static bool TritonContext_fillCallbackFilter(PyObject* watch, triton::callbacks::CallbackFilter& filter) {
+        if (!PyList_Check(watch))
+          return false;
+
+        for (Py_ssize_t i = 0; i < PyList_Size(watch); i++) {
+          PyObject* item = PyList_GetItem(watch, i);
+
+          if (PyRegister_Check(item)) {
+            filter.addRegister(*PyRegister_AsRegister(item));
+          }
+          else if (PyMemoryAccess_Check(item)) {
+            filter.addRange(PyMemoryAccess_AsMemoryAccess(item)->getAddress(), PyMemoryAccess_AsMemoryAccess(item)->getSize());
+          }
+          else if (PyTuple_Check(item) && PyTuple_Size(item) == 2) {
+            PyObject* addr = PyTuple_GetItem(item, 0);
+            PyObject* size = PyTuple_GetItem(item, 1);
+            if ((!PyLong_Check(addr) && !PyInt_Check(addr)) || (!PyLong_Check(size) && !PyInt_Check(size)))
+              return false;
+            filter.addRange(PyLong_AsUint64(addr), PyLong_AsUsize(size));
+          }
+          else {
+            return false;
+          }
+        }
+
+        return true;
+      }
+
+
+      /* Adds a callback, filtered if `filter` is not null */
+      template <typename T>
+      static void TritonContext_addWatchedCallback(PyObject* self, triton::callbacks::callback_e kind, T cb, const triton::callbacks::CallbackFilter* filter) {
+        if (filter != nullptr)
+          PyTritonContext_AsTritonContext(self)->addCallback(kind, cb, *filter);
+        else
+          PyTritonContext_AsTritonContext(self)->addCallback(kind, cb);
+      }
+
+
+      static PyObject* TritonContext_addBuiltinRewriteRules(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->addBuiltinRewriteRules();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_addCallback(PyObject* self, PyObject* args) {
         PyObject* function = nullptr;
         PyObject* mode     = nullptr;
         PyObject* cb       = nullptr;
         PyObject* cb_self  = nullptr;
+        PyObject* watch    = nullptr;
+        triton::callbacks::CallbackFilter filter;
+        triton::callbacks::CallbackFilter* filter_c = nullptr;
 
         /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &mode, &function) == false) {
+        if (PyArg_ParseTuple(args, "|OOO", &mode, &function, &watch) == false) {
           return PyErr_Format(PyExc_TypeError, "TritonContext::addCallback(): Invalid number of arguments");
         }
 
@@ -500,6 +1308,17 @@ namespace triton {
         if (function == nullptr || !PyCallable_Check(function))
           return PyErr_Format(PyExc_TypeError, "TritonContext::addCallback(): Expects a function as second argument.");
 
+        if (watch != nullptr && watch != Py_None) {
+          try {
+            if (TritonContext_fillCallbackFilter(watch, filter) == false)
+              return PyErr_Format(PyExc_TypeError, "TritonContext::addCallback(): Expects a list of Register, MemoryAccess or (addr, size) as third argument.");
+          }
+          catch (const triton::exceptions::Exception& e) {
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+          filter_c = &filter;
+        }
+
         if (PyMethod_Check(function)) {
           cb_self = PyMethod_GET_SELF(function);
           cb = PyMethod_GET_FUNCTION(function);
@@ -512,8 +1331,9 @@ namespace triton {
           switch (static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode))) {
 
             case callbacks::GET_CONCRETE_MEMORY_VALUE:
-              PyTritonContext_AsTritonContext(self)->addCallback(callbacks::GET_CONCRETE_MEMORY_VALUE, callbacks::getConcreteMemoryValueCallback([cb_self, cb](triton::Context& ctx, const triton::arch::MemoryAccess& mem) {
+              TritonContext_addWatchedCallback(self, callbacks::GET_CONCRETE_MEMORY_VALUE, callbacks::getConcreteMemoryValueCallback([cb_self, cb](triton::Context& ctx, const triton::arch::MemoryAccess& mem) {
                 /********* Lambda *********/
+                triton::bindings::python::PyAcquireGil gil;
                 PyObject* args = nullptr;
 
                 /* Create function args */
@@ -541,26 +1361,28 @@ namespace triton {
                   throw triton::exceptions::PyCallbacks();
                 }
                 /********* End of lambda *********/
-              }, cb));
+              }, cb), filter_c);
               break;
 
-            case callbacks::GET_CONCRETE_REGISTER_VALUE:
-              PyTritonContext_AsTritonContext(self)->addCallback(callbacks::GET_CONCRETE_REGISTER_VALUE, callbacks::getConcreteRegisterValueCallback([cb_self, cb](triton::Context& ctx, const triton::arch::Register& reg){
+            case callbacks::GET_CONCRETE_MEMORY_PAGE:
+              TritonContext_addWatchedCallback(self, callbacks::GET_CONCRETE_MEMORY_PAGE, callbacks::getConcreteMemoryPageCallback([cb_self, cb](triton::Context& ctx, triton::uint64 addr) {
                 /********* Lambda *********/
+                triton::bindings::python::PyAcquireGil gil;
                 PyObject* args = nullptr;
+                std::vector<triton::uint8> page;
 
                 /* Create function args */
                 if (cb_self) {
                   args = triton::bindings::python::xPyTuple_New(3);
                   PyTuple_SetItem(args, 0, cb_self);
                   PyTuple_SetItem(args, 1, triton::bindings::python::PyTritonContextRef(ctx));
-                  PyTuple_SetItem(args, 2, triton::bindings::python::PyRegister(reg));
+                  PyTuple_SetItem(args, 2, triton::bindings::python::PyLong_FromUint64(addr));
                   Py_INCREF(cb_self);
                 }
                 else {
                   args = triton::bindings::python::xPyTuple_New(2);
                   PyTuple_SetItem(args, 0, triton::bindings::python::PyTritonContextRef(ctx));
-                  PyTuple_SetItem(args, 1, triton::bindings::python::PyRegister(reg));
+                  PyTuple_SetItem(args, 1, triton::bindings::python::PyLong_FromUint64(addr));
                 }
 
                 /* Call the callback */
@@ -573,29 +1395,45 @@ namespace triton {
                 if (ret == nullptr) {
                   throw triton::exceptions::PyCallbacks();
                 }
+
+                /* Check if the callback has returned the content of the page */
+                if (PyBytes_Check(ret)) {
+                  triton::uint8* area = reinterpret_cast<triton::uint8*>(PyBytes_AsString(ret));
+                  page.assign(area, area + PyBytes_Size(ret));
+                }
+                else if (PyByteArray_Check(ret)) {
+                  triton::uint8* area = reinterpret_cast<triton::uint8*>(PyByteArray_AsString(ret));
+                  page.assign(area, area + PyByteArray_Size(ret));
+                }
+                else if (ret != Py_None) {
+                  Py_DECREF(ret);
+                  throw triton::exceptions::Callbacks("Callbacks::processCallbacks(GET_CONCRETE_MEMORY_PAGE): You must return bytes, a bytearray or None.");
+                }
+
+                Py_DECREF(ret);
+                return page;
                 /********* End of lambda *********/
-              }, cb));
+              }, cb), filter_c);
               break;
 
-            case callbacks::SET_CONCRETE_MEMORY_VALUE:
-              PyTritonContext_AsTritonContext(self)->addCallback(callbacks::SET_CONCRETE_MEMORY_VALUE, callbacks::setConcreteMemoryValueCallback([cb_self, cb](triton::Context& ctx, const triton::arch::MemoryAccess& mem, const triton::uint512& value) {
+            case callbacks::GET_CONCRETE_REGISTER_VALUE:
+              TritonContext_addWatchedCallback(self, callbacks::GET_CONCRETE_REGISTER_VALUE, callbacks::getConcreteRegisterValueCallback([cb_self, cb](triton::Context& ctx, const triton::arch::Register& reg){
                 /********* Lambda *********/
+                triton::bindings::python::PyAcquireGil gil;
                 PyObject* args = nullptr;
 
                 /* Create function args */
                 if (cb_self) {
-                  args = triton::bindings::python::xPyTuple_New(4);
+                  args = triton::bindings::python::xPyTuple_New(3);
                   PyTuple_SetItem(args, 0, cb_self);
                   PyTuple_SetItem(args, 1, triton::bindings::python::PyTritonContextRef(ctx));
-                  PyTuple_SetItem(args, 2, triton::bindings::python::PyMemoryAccess(mem));
-                  PyTuple_SetItem(args, 3, triton::bindings::python::PyLong_FromUint512(value));
+                  PyTuple_SetItem(args, 2, triton::bindings::python::PyRegister(reg));
                   Py_INCREF(cb_self);
                 }
                 else {
-                  args = triton::bindings::python::xPyTuple_New(3);
+                  args = triton::bindings::python::xPyTuple_New(2);
                   PyTuple_SetItem(args, 0, triton::bindings::python::PyTritonContextRef(ctx));
-                  PyTuple_SetItem(args, 1, triton::bindings::python::PyMemoryAccess(mem));
-                  PyTuple_SetItem(args, 2, triton::bindings::python::PyLong_FromUint512(value));
+                  PyTuple_SetItem(args, 1, triton::bindings::python::PyRegister(reg));
                 }
 
                 /* Call the callback */
@@ -609,12 +1447,13 @@ namespace triton {
                   throw triton::exceptions::PyCallbacks();
                 }
                 /********* End of lambda *********/
-              }, cb));
+              }, cb), filter_c);
               break;
 
-            case callbacks::SET_CONCRETE_REGISTER_VALUE:
-              PyTritonContext_AsTritonContext(self)->addCallback(callbacks::SET_CONCRETE_REGISTER_VALUE, callbacks::setConcreteRegisterValueCallback([cb_self, cb](triton::Context& ctx, const triton::arch::Register& reg, const triton::uint512& value){
+            case callbacks::SET_CONCRETE_MEMORY_VALUE:
+              TritonContext_addWatchedCallback(self, callbacks::SET_CONCRETE_MEMORY_VALUE, callbacks::setConcreteMemoryValueCallback([cb_self, cb](triton::Context& ctx, const triton::arch::MemoryAccess& mem, const triton::uint512& value) {
                 /********* Lambda *********/
+                triton::bindings::python::PyAcquireGil gil;
                 PyObject* args = nullptr;
 
                 /* Create function args */
@@ -622,14 +1461,14 @@ namespace triton {
                   args = triton::bindings::python::xPyTuple_New(4);
                   PyTuple_SetItem(args, 0, cb_self);
                   PyTuple_SetItem(args, 1, triton::bindings::python::PyTritonContextRef(ctx));
-                  PyTuple_SetItem(args, 2, triton::bindings::python::PyRegister(reg));
+                  PyTuple_SetItem(args, 2, triton::bindings::python::PyMemoryAccess(mem));
                   PyTuple_SetItem(args, 3, triton::bindings::python::PyLong_FromUint512(value));
                   Py_INCREF(cb_self);
                 }
                 else {
                   args = triton::bindings::python::xPyTuple_New(3);
                   PyTuple_SetItem(args, 0, triton::bindings::python::PyTritonContextRef(ctx));
-                  PyTuple_SetItem(args, 1, triton::bindings::python::PyRegister(reg));
+                  PyTuple_SetItem(args, 1, triton::bindings::python::PyMemoryAccess(mem));
                   PyTuple_SetItem(args, 2, triton::bindings::python::PyLong_FromUint512(value));
                 }
 
@@ -644,17 +1483,56 @@ namespace triton {
                   throw triton::exceptions::PyCallbacks();
                 }
                 /********* End of lambda *********/
-              }, cb));
+              }, cb), filter_c);
               break;
 
-            case callbacks::SYMBOLIC_SIMPLIFICATION:
-              PyTritonContext_AsTritonContext(self)->addCallback(callbacks::SYMBOLIC_SIMPLIFICATION, callbacks::symbolicSimplificationCallback([cb_self, cb](triton::Context& ctx, triton::ast::SharedAbstractNode node) {
+            case callbacks::SET_CONCRETE_REGISTER_VALUE:
+              TritonContext_addWatchedCallback(self, callbacks::SET_CONCRETE_REGISTER_VALUE, callbacks::setConcreteRegisterValueCallback([cb_self, cb](triton::Context& ctx, const triton::arch::Register& reg, const triton::uint512& value){
                 /********* Lambda *********/
+                triton::bindings::python::PyAcquireGil gil;
                 PyObject* args = nullptr;
 
                 /* Create function args */
                 if (cb_self) {
-                  args = triton::bindings::python::xPyTuple_New(3);
+                  args = triton::bindings::python::xPyTuple_New(4);
+                  PyTuple_SetItem(args, 0, cb_self);
+                  PyTuple_SetItem(args, 1, triton::bindings::python::PyTritonContextRef(ctx));
+                  PyTuple_SetItem(args, 2, triton::bindings::python::PyRegister(reg));
+                  PyTuple_SetItem(args, 3, triton::bindings::python::PyLong_FromUint512(value));
+                  Py_INCREF(cb_self);
+                }
+                else {
+                  args = triton::bindings::python::xPyTuple_New(3);
+                  PyTuple_SetItem(args, 0, triton::bindings::python::PyTritonContextRef(ctx));
+                  PyTuple_SetItem(args, 1, triton::bindings::python::PyRegister(reg));
+                  PyTuple_SetItem(args, 2, triton::bindings::python::PyLong_FromUint512(value));
+                }
+
+                /* Call the callback */
+                PyObject* ret = PyObject_CallObject(cb, args);
+
+                /* Release args */
+                Py_DECREF(args);
+
+                /* Check the call */
+                if (ret == nullptr) {
+                  throw triton::exceptions::PyCallbacks();
+                }
+                /********* End of lambda *********/
+              }, cb), filter_c);
+              break;
+
+            case callbacks::SYMBOLIC_SIMPLIFICATION:
+              if (filter_c != nullptr)
+                return PyErr_Format(PyExc_TypeError, "TritonContext::addCallback(): SYMBOLIC_SIMPLIFICATION cannot be filtered.");
+              PyTritonContext_AsTritonContext(self)->addCallback(callbacks::SYMBOLIC_SIMPLIFICATION, callbacks::symbolicSimplificationCallback([cb_self, cb](triton::Context& ctx, triton::ast::SharedAbstractNode node) {
+                /********* Lambda *********/
+                triton::bindings::python::PyAcquireGil gil;
+                PyObject* args = nullptr;
+
+                /* Create function args */
+                if (cb_self) {
+                  args = triton::bindings::python::xPyTuple_New(3);
                   PyTuple_SetItem(args, 0, cb_self);
                   PyTuple_SetItem(args, 1, triton::bindings::python::PyTritonContextRef(ctx));
                   PyTuple_SetItem(args, 2, triton::bindings::python::PyAstNode(node));
@@ -704,26 +1582,24 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_assignSymbolicExpressionToMemory(PyObject* self, PyObject* args) {
-        PyObject* se  = nullptr;
-        PyObject* mem = nullptr;
+      static PyObject* TritonContext_addConcretizationRule(PyObject* self, PyObject* args) {
+        PyObject* rule      = nullptr;
+        PyObject* threshold = nullptr;
 
         /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &se, &mem) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToMemory(): Invalid number of arguments");
+        if (PyArg_ParseTuple(args, "|OO", &rule, &threshold) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addConcretizationRule(): Invalid number of arguments");
         }
 
-        if (se == nullptr || (!PySymbolicExpression_Check(se)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToMemory(): Expects a SymbolicExpression as first argument.");
-
-        if (mem == nullptr || (!PyMemoryAccess_Check(mem)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToMemory(): Expects a MemoryAccess as second argument.");
+        if (rule == nullptr || (!PyLong_Check(rule) && !PyInt_Check(rule)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addConcretizationRule(): Expects a CONCRETIZATION rule as first argument.");
 
-        const triton::engines::symbolic::SharedSymbolicExpression& arg1 = PySymbolicExpression_AsSymbolicExpression(se);
-        triton::arch::MemoryAccess arg2 = *PyMemoryAccess_AsMemoryAccess(mem);
+        if (threshold != nullptr && (!PyLong_Check(threshold) && !PyInt_Check(threshold)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addConcretizationRule(): Expects an integer as second argument.");
 
         try {
-          PyTritonContext_AsTritonContext(self)->assignSymbolicExpressionToMemory(arg1, arg2);
+          auto kind = static_cast<triton::engines::symbolic::concretization_e>(PyLong_AsUint32(rule));
+          PyTritonContext_AsTritonContext(self)->addConcretizationRule(kind, threshold ? PyLong_AsUsize(threshold) : 0);
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -736,27 +1612,63 @@ namespace triton {
         return Py_None;
       }
 
-
-      static PyObject* TritonContext_assignSymbolicExpressionToRegister(PyObject* self, PyObject* args) {
-        PyObject* se  = nullptr;
-        PyObject* reg = nullptr;
+      static PyObject* TritonContext_addNativeCallback(PyObject* self, PyObject* args) {
+        PyObject* mode     = nullptr;
+        PyObject* function = nullptr;
+        PyObject* user     = nullptr;
+        PyObject* watch    = nullptr;
+        void* function_c   = nullptr;
+        void* user_c       = nullptr;
+        triton::callbacks::CallbackFilter filter;
+        triton::callbacks::CallbackFilter* filter_c = nullptr;
 
         /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &se, &reg) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToRegister(): Invalid number of arguments");
+        if (PyArg_ParseTuple(args, "|OOOO", &mode, &function, &user, &watch) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addNativeCallback(): Invalid number of arguments");
         }
 
-        if (se == nullptr || (!PySymbolicExpression_Check(se)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToRegister(): Expects a SymbolicExpression as first argument.");
+        if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addNativeCallback(): Expects a CALLBACK as first argument.");
 
-        if (reg == nullptr || (!PyRegister_Check(reg)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToRegister(): Expects a Register as second argument.");
+        if (function == nullptr || (!PyLong_Check(function) && !PyInt_Check(function)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addNativeCallback(): Expects the address of a function as second argument.");
 
-        const triton::engines::symbolic::SharedSymbolicExpression& arg1 = PySymbolicExpression_AsSymbolicExpression(se);
-        triton::arch::Register arg2 = *PyRegister_AsRegister(reg);
+        if (user != nullptr && (!PyLong_Check(user) && !PyInt_Check(user)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addNativeCallback(): Expects an integer as third argument.");
 
         try {
-          PyTritonContext_AsTritonContext(self)->assignSymbolicExpressionToRegister(arg1, arg2);
+          if (watch != nullptr && watch != Py_None) {
+            if (TritonContext_fillCallbackFilter(watch, filter) == false)
+              return PyErr_Format(PyExc_TypeError, "TritonContext::addNativeCallback(): Expects a list of Register, MemoryAccess or (addr, size) as fourth argument.");
+            filter_c = &filter;
+          }
+
+          function_c = reinterpret_cast<void*>(static_cast<std::uintptr_t>(PyLong_AsUint64(function)));
+          if (user != nullptr)
+            user_c = reinterpret_cast<void*>(static_cast<std::uintptr_t>(PyLong_AsUint64(user)));
+
+          if (function_c == nullptr)
+            return PyErr_Format(PyExc_TypeError, "TritonContext::addNativeCallback(): Expects the address of a function as second argument.");
+
+          switch (static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode))) {
+            case callbacks::GET_CONCRETE_MEMORY_VALUE:
+              TritonContext_addWatchedCallback(self, callbacks::GET_CONCRETE_MEMORY_VALUE, callbacks::nativeCallback(reinterpret_cast<callbacks::nativeGetConcreteMemoryValueCallback>(function_c), user_c), filter_c);
+              break;
+            case callbacks::GET_CONCRETE_MEMORY_PAGE:
+              TritonContext_addWatchedCallback(self, callbacks::GET_CONCRETE_MEMORY_PAGE, callbacks::nativeCallback(reinterpret_cast<callbacks::nativeGetConcreteMemoryPageCallback>(function_c), user_c), filter_c);
+              break;
+            case callbacks::GET_CONCRETE_REGISTER_VALUE:
+              TritonContext_addWatchedCallback(self, callbacks::GET_CONCRETE_REGISTER_VALUE, callbacks::nativeCallback(reinterpret_cast<callbacks::nativeGetConcreteRegisterValueCallback>(function_c), user_c), filter_c);
+              break;
+            case callbacks::SET_CONCRETE_MEMORY_VALUE:
+              TritonContext_addWatchedCallback(self, callbacks::SET_CONCRETE_MEMORY_VALUE, callbacks::nativeCallback(reinterpret_cast<callbacks::nativeSetConcreteMemoryValueCallback>(function_c), user_c), filter_c);
+              break;
+            case callbacks::SET_CONCRETE_REGISTER_VALUE:
+              TritonContext_addWatchedCallback(self, callbacks::SET_CONCRETE_REGISTER_VALUE, callbacks::nativeCallback(reinterpret_cast<callbacks::nativeSetConcreteRegisterValueCallback>(function_c), user_c), filter_c);
+              break;
+            default:
+              return PyErr_Format(PyExc_TypeError, "TritonContext::addNativeCallback(): Invalid kind of native callback.");
+          }
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -770,12 +1682,23 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_buildSemantics(PyObject* self, PyObject* inst) {
-        if (!PyInstruction_Check(inst))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::buildSemantics(): Expects an Instruction as argument.");
+      static PyObject* TritonContext_addRewriteRule(PyObject* self, PyObject* args) {
+        PyObject* pattern     = nullptr;
+        PyObject* replacement = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &pattern, &replacement) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addRewriteRule(): Invalid number of arguments");
+        }
+
+        if (pattern == nullptr || !PyStr_Check(pattern))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addRewriteRule(): Expects a string as first argument.");
+
+        if (replacement == nullptr || !PyStr_Check(replacement))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addRewriteRule(): Expects a string as second argument.");
 
         try {
-          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->buildSemantics(*PyInstruction_AsInstruction(inst)));
+          PyTritonContext_AsTritonContext(self)->addRewriteRule(PyStr_AsString(pattern), PyStr_AsString(replacement));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -783,12 +1706,29 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_clearCallbacks(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_addSymbolicRegion(PyObject* self, PyObject* args) {
+        PyObject* addr = nullptr;
+        PyObject* size = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &addr, &size) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addSymbolicRegion(): Invalid number of arguments");
+        }
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addSymbolicRegion(): Expects an integer as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addSymbolicRegion(): Expects an integer as second argument.");
+
         try {
-          PyTritonContext_AsTritonContext(self)->clearCallbacks();
+          PyTritonContext_AsTritonContext(self)->addSymbolicRegion(PyLong_AsUint64(addr), PyLong_AsUsize(size));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -801,10 +1741,36 @@ namespace triton {
         return Py_None;
       }
 
+      static PyObject* TritonContext_addVirtualFile(PyObject* self, PyObject* args) {
+        PyObject* path     = nullptr;
+        PyObject* data     = nullptr;
+        PyObject* symbolic = nullptr;
+        std::vector<triton::uint8> content;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &path, &data, &symbolic) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addVirtualFile(): Invalid number of arguments");
+        }
+
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addVirtualFile(): Expects a string as first argument.");
+
+        if (data != nullptr && PyBytes_Check(data)) {
+          triton::uint8* area = reinterpret_cast<triton::uint8*>(PyBytes_AsString(data));
+          content.assign(area, area + PyBytes_Size(data));
+        }
+        else if (data != nullptr && PyByteArray_Check(data)) {
+          triton::uint8* area = reinterpret_cast<triton::uint8*>(PyByteArray_AsString(data));
+          content.assign(area, area + PyByteArray_Size(data));
+        }
+        else
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addVirtualFile(): Expects bytes or a bytearray as second argument.");
+
+        if (symbolic != nullptr && !PyBool_Check(symbolic))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addVirtualFile(): Expects a boolean as third argument.");
 
-      static PyObject* TritonContext_clearModes(PyObject* self, PyObject* noarg) {
         try {
-          PyTritonContext_AsTritonContext(self)->clearModes();
+          PyTritonContext_AsTritonContext(self)->addVirtualFile(PyStr_AsString(path), content, symbolic != nullptr && PyLong_AsBool(symbolic));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -818,29 +1784,72 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_clearConcreteMemoryValue(PyObject* self, PyObject* args) {
-        PyObject* baseAddr        = nullptr;
-        PyObject* size            = nullptr;
+      static PyObject* TritonContext_applyModelToBuffer(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::engines::solver::DenseModel dense;
+        triton::usize written = 0;
 
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &baseAddr, &size) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::clearConcreteMemoryValue(): Invalid number of arguments");
+        PyObject* model  = nullptr;
+        PyObject* addr   = nullptr;
+        PyObject* buffer = nullptr;
+        Py_buffer view;
+
+        static char* keywords[] = {
+          (char*)"model",
+          (char*)"addr",
+          (char*)"buffer",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "OOO", keywords, &model, &addr, &buffer) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::applyModelToBuffer(): Invalid keyword argument.");
+        }
+
+        if (model == nullptr || (!PyDict_Check(model) && !PyList_Check(model))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::applyModelToBuffer(): Expects a dict or a list as model argument.");
+        }
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::applyModelToBuffer(): Expects an integer as addr argument.");
+        }
+
+        if (buffer == nullptr || !PyObject_CheckBuffer(buffer)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::applyModelToBuffer(): Expects a writable bytes-like object as buffer argument.");
         }
 
         try {
-          if (baseAddr && PyMemoryAccess_Check(baseAddr)) {
-            PyTritonContext_AsTritonContext(self)->clearConcreteMemoryValue(*PyMemoryAccess_AsMemoryAccess(baseAddr));
-          }
-          else if (baseAddr && (PyLong_Check(baseAddr) || PyInt_Check(baseAddr))) {
-            if (size && (PyLong_Check(size) || PyInt_Check(size))) {
-              PyTritonContext_AsTritonContext(self)->clearConcreteMemoryValue(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size));
-            }
-            else {
-              return PyErr_Format(PyExc_TypeError, "TritonContext::clearConcreteMemoryValue(): Expects a size (integer) as second argument.");
+          triton::Context* ctx = PyTritonContext_AsTritonContext(self);
+
+          if (PyDict_Check(model)) {
+            PyObject* key   = nullptr;
+            PyObject* value = nullptr;
+            Py_ssize_t pos  = 0;
+
+            while (PyDict_Next(model, &pos, &key, &value)) {
+              if (!PySolverModel_Check(value)) {
+                return PyErr_Format(PyExc_TypeError, "TritonContext::applyModelToBuffer(): Expects SolverModel as values of the model.");
+              }
+              const triton::engines::solver::SolverModel& sm = *PySolverModel_AsSolverModel(value);
+              dense.set(sm.getVariable(), sm.getValue());
             }
           }
           else {
-            return PyErr_Format(PyExc_TypeError, "TritonContext::clearConcreteMemoryValue(): Expects a base address (integer) as arguments or a memory cells.");
+            for (Py_ssize_t i = 0; i < PyList_Size(model); i++) {
+              PyObject* item = PyList_GetItem(model, i);
+
+              if (!PyTuple_Check(item) || PyTuple_Size(item) != 2) {
+                return PyErr_Format(PyExc_TypeError, "TritonContext::applyModelToBuffer(): Expects (integer id, integer value) tuples as items of the model.");
+              }
+
+              PyObject* id    = PyTuple_GetItem(item, 0);
+              PyObject* value = PyTuple_GetItem(item, 1);
+
+              if ((!PyLong_Check(id) && !PyInt_Check(id)) || (!PyLong_Check(value) && !PyInt_Check(value))) {
+                return PyErr_Format(PyExc_TypeError, "TritonContext::applyModelToBuffer(): Expects (integer id, integer value) tuples as items of the model.");
+              }
+
+              dense.set(ctx->getSymbolicVariable(PyLong_AsUsize(id)), PyLong_AsUint512(value));
+            }
           }
         }
         catch (const triton::exceptions::PyCallbacks&) {
@@ -850,27 +1859,43 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        Py_INCREF(Py_None);
-        return Py_None;
-      }
-
+        if (PyObject_GetBuffer(buffer, &view, PyBUF_WRITABLE) != 0) {
+          PyErr_Clear();
+          return PyErr_Format(PyExc_TypeError, "TritonContext::applyModelToBuffer(): Expects a writable contiguous bytes-like object as buffer argument.");
+        }
 
-      static PyObject* TritonContext_clearPathConstraints(PyObject* self, PyObject* noarg) {
         try {
-          PyTritonContext_AsTritonContext(self)->clearPathConstraints();
+          written = triton::engines::solver::applyModelToBuffer(dense, PyLong_AsUint64(addr), static_cast<triton::usize>(view.len), static_cast<triton::uint8*>(view.buf));
         }
         catch (const triton::exceptions::Exception& e) {
+          PyBuffer_Release(&view);
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        Py_INCREF(Py_None);
-        return Py_None;
+        PyBuffer_Release(&view);
+        return PyLong_FromUsize(written);
       }
 
+      static PyObject* TritonContext_assignSymbolicExpressionToMemory(PyObject* self, PyObject* args) {
+        PyObject* se  = nullptr;
+        PyObject* mem = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &se, &mem) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToMemory(): Invalid number of arguments");
+        }
+
+        if (se == nullptr || (!PySymbolicExpression_Check(se)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToMemory(): Expects a SymbolicExpression as first argument.");
+
+        if (mem == nullptr || (!PyMemoryAccess_Check(mem)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToMemory(): Expects a MemoryAccess as second argument.");
+
+        const triton::engines::symbolic::SharedSymbolicExpression& arg1 = PySymbolicExpression_AsSymbolicExpression(se);
+        triton::arch::MemoryAccess arg2 = *PyMemoryAccess_AsMemoryAccess(mem);
 
-      static PyObject* TritonContext_concretizeAllMemory(PyObject* self, PyObject* noarg) {
         try {
-          PyTritonContext_AsTritonContext(self)->concretizeAllMemory();
+          PyTritonContext_AsTritonContext(self)->assignSymbolicExpressionToMemory(arg1, arg2);
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -884,9 +1909,26 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_concretizeAllRegister(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_assignSymbolicExpressionToRegister(PyObject* self, PyObject* args) {
+        PyObject* se  = nullptr;
+        PyObject* reg = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &se, &reg) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToRegister(): Invalid number of arguments");
+        }
+
+        if (se == nullptr || (!PySymbolicExpression_Check(se)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToRegister(): Expects a SymbolicExpression as first argument.");
+
+        if (reg == nullptr || (!PyRegister_Check(reg)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToRegister(): Expects a Register as second argument.");
+
+        const triton::engines::symbolic::SharedSymbolicExpression& arg1 = PySymbolicExpression_AsSymbolicExpression(se);
+        triton::arch::Register arg2 = *PyRegister_AsRegister(reg);
+
         try {
-          PyTritonContext_AsTritonContext(self)->concretizeAllRegister();
+          PyTritonContext_AsTritonContext(self)->assignSymbolicExpressionToRegister(arg1, arg2);
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -900,48 +1942,36 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_concretizeMemory(PyObject* self, PyObject* mem) {
-        /* If mem is an address */
-        if (PyLong_Check(mem) || PyInt_Check(mem)) {
-          try {
-            PyTritonContext_AsTritonContext(self)->concretizeMemory(PyLong_AsUint64(mem));
-          }
-          catch (const triton::exceptions::PyCallbacks&) {
-            return nullptr;
-          }
-          catch (const triton::exceptions::Exception& e) {
-            return PyErr_Format(PyExc_TypeError, "%s", e.what());
-          }
-        }
+      static PyObject* TritonContext_attachGdbRemote(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* endpoint = nullptr;
+        PyObject* prefetch = nullptr;
+        triton::usize prefetch_c = 4;
 
-        /* If mem is a MemoryAccess */
-        else if (PyMemoryAccess_Check(mem)) {
-          try {
-            PyTritonContext_AsTritonContext(self)->concretizeMemory(*PyMemoryAccess_AsMemoryAccess(mem));
-          }
-          catch (const triton::exceptions::PyCallbacks&) {
-            return nullptr;
-          }
-          catch (const triton::exceptions::Exception& e) {
-            return PyErr_Format(PyExc_TypeError, "%s", e.what());
-          }
-        }
+        static char* keywords[] = {
+          (char*)"endpoint",
+          (char*)"prefetch",
+          nullptr
+        };
 
-        /* Invalid parameter */
-        else
-          return PyErr_Format(PyExc_TypeError, "TritonContext::concretizeMemory(): Expects an integer or MemoryAccess as argument.");
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &endpoint, &prefetch) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::attachGdbRemote(): Invalid keyword argument.");
+        }
 
-        Py_INCREF(Py_None);
-        return Py_None;
-      }
+        if (endpoint == nullptr || !PyStr_Check(endpoint)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::attachGdbRemote(): Expects a string as endpoint argument.");
+        }
 
+        if (prefetch != nullptr && (!PyLong_Check(prefetch) && !PyInt_Check(prefetch))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::attachGdbRemote(): Expects an integer as prefetch argument.");
+        }
 
-      static PyObject* TritonContext_concretizeRegister(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::concretizeRegister(): Expects a Register as argument.");
+        if (prefetch != nullptr) {
+          prefetch_c = PyLong_AsUsize(prefetch);
+        }
 
         try {
-          PyTritonContext_AsTritonContext(self)->concretizeRegister(*PyRegister_AsRegister(reg));
+          PyTritonContext_AsTritonContext(self)->attachGdbRemote(PyStr_AsString(endpoint), prefetch_c);
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -954,40 +1984,41 @@ namespace triton {
         return Py_None;
       }
 
+      static PyObject* TritonContext_buildSemantics(PyObject* self, PyObject* inst) {
+        if (!PyInstruction_Check(inst))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::buildSemantics(): Expects an Instruction as argument.");
 
-      static PyObject* TritonContext_createSymbolicMemoryExpression(PyObject* self, PyObject* args) {
-        PyObject* inst          = nullptr;
-        PyObject* node          = nullptr;
-        PyObject* mem           = nullptr;
-        PyObject* comment       = nullptr;
-        std::string ccomment    = "";
-
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OOOO", &inst, &node, &mem, &comment) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicMemoryExpression(): Invalid number of arguments");
+        try {
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->buildSemantics(*PyInstruction_AsInstruction(inst)));
         }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
 
-        if (inst == nullptr || (!PyInstruction_Check(inst)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicMemoryExpression(): Expects an Instruction as first argument.");
-
-        if (node == nullptr || (!PyAstNode_Check(node)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicMemoryExpression(): Expects a AstNode as second argument.");
-
-        if (mem == nullptr || (!PyMemoryAccess_Check(mem)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicMemoryExpression(): Expects a MemoryAccess as third argument.");
 
-        if (comment != nullptr && !PyStr_Check(comment))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicMemoryExpression(): Expects a sting as fourth argument.");
+      static PyObject* TritonContext_cancelAsync(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->cancelAsync();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
 
-        if (comment != nullptr)
-          ccomment = PyStr_AsString(comment);
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-        triton::arch::Instruction& arg1 = *PyInstruction_AsInstruction(inst);
-        triton::ast::SharedAbstractNode arg2 = PyAstNode_AsAstNode(node);
-        triton::arch::MemoryAccess arg3 = *PyMemoryAccess_AsMemoryAccess(mem);
 
+      static PyObject* TritonContext_clearAstBudgetEvents(PyObject* self, PyObject* noarg) {
         try {
-          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->createSymbolicMemoryExpression(arg1, arg2, arg3, ccomment));
+          PyTritonContext_AsTritonContext(self)->clearAstBudgetEvents();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -995,42 +2026,46 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-      }
 
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-      static PyObject* TritonContext_createSymbolicRegisterExpression(PyObject* self, PyObject* args) {
-        PyObject* inst          = nullptr;
-        PyObject* node          = nullptr;
-        PyObject* reg           = nullptr;
-        PyObject* comment       = nullptr;
-        std::string ccomment    = "";
 
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OOOO", &inst, &node, &reg, &comment) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicRegisterExpression(): Invalid number of arguments");
+      static PyObject* TritonContext_clearCallbacks(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearCallbacks();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        if (inst == nullptr || (!PyInstruction_Check(inst)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicRegisterExpression(): Expects an Instruction as first argument.");
-
-        if (node == nullptr || (!PyAstNode_Check(node)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicRegisterExpression(): Expects a AstNode as second argument.");
-
-        if (reg == nullptr || (!PyRegister_Check(reg)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicRegisterExpression(): Expects a Register as third argument.");
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-        if (comment != nullptr && !PyStr_Check(comment))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicRegisterExpression(): Expects a sting as fourth argument.");
 
-        if (comment != nullptr)
-          ccomment = PyStr_AsString(comment);
+      static PyObject* TritonContext_clearConcreteMemo(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearConcreteMemo();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
 
-        triton::arch::Instruction& arg1 = *PyInstruction_AsInstruction(inst);
-        triton::ast::SharedAbstractNode arg2 = PyAstNode_AsAstNode(node);
-        triton::arch::Register arg3 = *PyRegister_AsRegister(reg);
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
+      static PyObject* TritonContext_clearConcretizationEvents(PyObject* self, PyObject* noarg) {
         try {
-          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->createSymbolicRegisterExpression(arg1, arg2, arg3, ccomment));
+          PyTritonContext_AsTritonContext(self)->clearConcretizationEvents();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1038,37 +2073,43 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-      }
 
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-      static PyObject* TritonContext_createSymbolicVolatileExpression(PyObject* self, PyObject* args) {
-        PyObject* inst          = nullptr;
-        PyObject* node          = nullptr;
-        PyObject* comment       = nullptr;
-        std::string ccomment    = "";
 
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OOO", &inst, &node, &comment) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicVolatileExpression(): Invalid number of arguments");
+      static PyObject* TritonContext_clearConcretizationPolicy(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearConcretizationPolicy();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        if (inst == nullptr || (!PyInstruction_Check(inst)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicVolatileExpression(): Expects an Instruction as first argument.");
-
-        if (node == nullptr || (!PyAstNode_Check(node)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicVolatileExpression(): Expects a AstNode as second argument.");
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-        if (comment != nullptr && !PyStr_Check(comment))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicVolatileExpression(): Expects a sting as third argument.");
+      static PyObject* TritonContext_clearHeatMap(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearHeatMap();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
 
-        if (comment != nullptr)
-          ccomment = PyStr_AsString(comment);
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-        triton::arch::Instruction& arg1 = *PyInstruction_AsInstruction(inst);
-        triton::ast::SharedAbstractNode arg2 = PyAstNode_AsAstNode(node);
 
+      static PyObject* TritonContext_clearModes(PyObject* self, PyObject* noarg) {
         try {
-          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->createSymbolicVolatileExpression(arg1, arg2, ccomment));
+          PyTritonContext_AsTritonContext(self)->clearModes();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1076,52 +2117,35 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_disassembly(PyObject* self, PyObject* args) {
-        PyObject* arg0 = nullptr;
-        PyObject* arg1 = nullptr;
-        PyObject* ret  = nullptr;
-        triton::usize index = 0;
+      static PyObject* TritonContext_clearConcreteMemoryValue(PyObject* self, PyObject* args) {
+        PyObject* baseAddr        = nullptr;
+        PyObject* size            = nullptr;
 
         /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &arg0, &arg1) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::disassembly(): Invalid number of arguments.");
+        if (PyArg_ParseTuple(args, "|OO", &baseAddr, &size) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::clearConcreteMemoryValue(): Invalid number of arguments");
         }
 
         try {
-          if (arg0 != nullptr && PyInstruction_Check(arg0)) {
-            PyTritonContext_AsTritonContext(self)->disassembly(*PyInstruction_AsInstruction(arg0));
-            Py_INCREF(Py_None);
-            return Py_None;
-          }
-          if (arg0 != nullptr && PyBasicBlock_Check(arg0)) {
-            triton::uint64 base = 0;
-            if (arg1 != nullptr && (PyLong_Check(arg1) || PyInt_Check(arg1))) {
-              base = PyLong_AsUint64(arg1);
-            }
-            PyTritonContext_AsTritonContext(self)->disassembly(*PyBasicBlock_AsBasicBlock(arg0), base);
-            Py_INCREF(Py_None);
-            return Py_None;
+          if (baseAddr && PyMemoryAccess_Check(baseAddr)) {
+            PyTritonContext_AsTritonContext(self)->clearConcreteMemoryValue(*PyMemoryAccess_AsMemoryAccess(baseAddr));
           }
-          if ((arg0 != nullptr && (PyLong_Check(arg0) || PyInt_Check(arg0))) &&
-              (arg1 == nullptr || PyLong_Check(arg1) || PyInt_Check(arg1))) {
-
-            std::vector<triton::arch::Instruction> insts;
-            if (arg1) {
-              insts = PyTritonContext_AsTritonContext(self)->disassembly(PyLong_AsUint64(arg0), PyLong_AsUsize(arg1));
-              ret = xPyList_New(insts.size());
-              for (auto& inst : insts)
-                PyList_SetItem(ret, index++, PyInstruction(inst));
+          else if (baseAddr && (PyLong_Check(baseAddr) || PyInt_Check(baseAddr))) {
+            if (size && (PyLong_Check(size) || PyInt_Check(size))) {
+              PyTritonContext_AsTritonContext(self)->clearConcreteMemoryValue(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size));
             }
             else {
-              ret = PyBasicBlock(PyTritonContext_AsTritonContext(self)->disassembly(PyLong_AsUint64(arg0)));
+              return PyErr_Format(PyExc_TypeError, "TritonContext::clearConcreteMemoryValue(): Expects a size (integer) as second argument.");
             }
-            return ret;
           }
           else {
-            return PyErr_Format(PyExc_TypeError, "TritonContext::disassembly(): Expects an Instruction or two integers as arguments.");
+            return PyErr_Format(PyExc_TypeError, "TritonContext::clearConcreteMemoryValue(): Expects a base address (integer) as arguments or a memory cells.");
           }
         }
         catch (const triton::exceptions::PyCallbacks&) {
@@ -1130,15 +2154,15 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-      }
 
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-      static PyObject* TritonContext_evaluateAstViaSolver(PyObject* self, PyObject* node) {
-        if (!PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::evaluateAstViaSolver(): Expects a AstNode as argument.");
 
+      static PyObject* TritonContext_clearCounterexampleCache(PyObject* self, PyObject* noarg) {
         try {
-          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->evaluateAstViaSolver(PyAstNode_AsAstNode(node)));
+          PyTritonContext_AsTritonContext(self)->clearCounterexampleCache();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1151,17 +2175,9 @@ namespace triton {
         return Py_None;
       }
 
-
-      static PyObject* TritonContext_getAllRegisters(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-
+      static PyObject* TritonContext_clearDecodeCache(PyObject* self, PyObject* noarg) {
         try {
-          triton::uint32 index = 0;
-          auto& regs = PyTritonContext_AsTritonContext(self)->getAllRegisters();
-
-          ret = xPyList_New(regs.size());
-          for (auto& reg: regs)
-            PyList_SetItem(ret, index++, PyRegister(reg.second));
+          PyTritonContext_AsTritonContext(self)->clearDecodeCache();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1170,13 +2186,13 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        return ret;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
-
-      static PyObject* TritonContext_getArchitecture(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_clearJitCache(PyObject* self, PyObject* noarg) {
         try {
-          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getArchitecture());
+          PyTritonContext_AsTritonContext(self)->clearJitCache();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1184,12 +2200,15 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_getAstContext(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_clearLoopSummaries(PyObject* self, PyObject* noarg) {
         try {
-          return PyAstContext(PyTritonContext_AsTritonContext(self)->getAstContext());
+          PyTritonContext_AsTritonContext(self)->clearLoopSummaries();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1197,68 +2216,44 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_getAstRepresentationMode(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_clearPathConstraints(PyObject* self, PyObject* noarg) {
         try {
-          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getAstRepresentationMode());
-        }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+          PyTritonContext_AsTritonContext(self)->clearPathConstraints();
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-      }
-
 
-      static PyObject* TritonContext_getConcreteMemoryAreaValue(PyObject* self, PyObject* args, PyObject* kwargs) {
-        triton::uint8*  area          = nullptr;
-        PyObject*       ret           = nullptr;
-        PyObject*       addr          = nullptr;
-        PyObject*       size          = nullptr;
-        PyObject*       execCallbacks = nullptr;
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-        static char* keywords[] = {
-          (char*)"addr",
-          (char*)"size",
-          (char*)"callbacks",
-          nullptr
-        };
 
-        /* Extract keywords */
-        if (PyArg_ParseTupleAndKeywords(args, kwargs, "OO|O", keywords, &addr, &size, &execCallbacks) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryAreaValue(): Invalid keyword argument");
+      static PyObject* TritonContext_clearProfile(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearProfile();
         }
-
-        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr))) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryAreaValue(): Expects an integer as addr keyword.");
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
         }
-
-        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size))) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryAreaValue(): Expects an integer as size keyword.");
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        if (execCallbacks != nullptr && !PyBool_Check(execCallbacks)) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryAreaValue(): Expects a boolean as execCallbacks keyword.");
-        }
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-        if (execCallbacks == nullptr) {
-          execCallbacks = PyLong_FromUint32(true);
-        }
 
+      static PyObject* TritonContext_clearQueryCache(PyObject* self, PyObject* noarg) {
         try {
-          std::vector<triton::uint8> vv = PyTritonContext_AsTritonContext(self)->getConcreteMemoryAreaValue(PyLong_AsUint64(addr), PyLong_AsUsize(size), PyLong_AsBool(execCallbacks));
-          area = new triton::uint8[vv.size()];
-
-          for (triton::usize index = 0; index < vv.size(); index++)
-            area[index] = vv[index];
-
-          ret = PyBytes_FromStringAndSize(reinterpret_cast<const char*>(area), vv.size());
-          delete[] area;
-          return ret;
-
+          PyTritonContext_AsTritonContext(self)->clearQueryCache();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1267,44 +2262,14 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        return ret;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_getConcreteMemoryValue(PyObject* self, PyObject* args, PyObject* kwargs) {
-        PyObject* mem           = nullptr;
-        PyObject* execCallbacks = nullptr;
-
-        static char* keywords[] = {
-          (char*)"mem",
-          (char*)"callbacks",
-          nullptr
-        };
-
-        /* Extract keywords */
-        if (PyArg_ParseTupleAndKeywords(args, kwargs, "O|O", keywords, &mem, &execCallbacks) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryValue(): Invalid keyword argument");
-        }
-
-        if (mem == nullptr || (!PyLong_Check(mem) && !PyInt_Check(mem) && !PyMemoryAccess_Check(mem))) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryValue(): Expects a MemoryAccess or an integer as mem keyword.");
-        }
-
-        if (execCallbacks != nullptr && !PyBool_Check(execCallbacks)) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryValue(): Expects a boolean as execCallbacks keyword.");
-        }
-
-        if (execCallbacks == nullptr) {
-          execCallbacks = PyLong_FromUint32(true);
-        }
-
+      static PyObject* TritonContext_clearRewriteRules(PyObject* self, PyObject* noarg) {
         try {
-          if (PyLong_Check(mem) || PyInt_Check(mem))
-              return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getConcreteMemoryValue(PyLong_AsUint64(mem), PyLong_AsBool(execCallbacks)));
-          else if (PyMemoryAccess_Check(mem))
-              return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getConcreteMemoryValue(*PyMemoryAccess_AsMemoryAccess(mem), PyLong_AsBool(execCallbacks)));
-          else
-            return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryValue(): Something wrong.");
+          PyTritonContext_AsTritonContext(self)->clearRewriteRules();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1312,38 +2277,31 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-      }
 
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-      static PyObject* TritonContext_getConcreteRegisterValue(PyObject* self, PyObject* args, PyObject* kwargs) {
-        PyObject* reg           = nullptr;
-        PyObject* execCallbacks = nullptr;
-
-        static char* keywords[] = {
-          (char*)"reg",
-          (char*)"callbacks",
-          nullptr
-        };
 
-        /* Extract keywords */
-        if (PyArg_ParseTupleAndKeywords(args, kwargs, "O|O", keywords, &reg, &execCallbacks) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteRegisterValue(): Invalid keyword argument");
+      static PyObject* TritonContext_clearSemanticsCache(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearSemanticsCache();
         }
-
-        if (reg == nullptr || !PyRegister_Check(reg)) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteRegisterValue(): Expects a Register as reg keyword.");
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
         }
-
-        if (execCallbacks != nullptr && !PyBool_Check(execCallbacks)) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteRegisterValue(): Expects a boolean as execCallbacks keyword.");
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        if (execCallbacks == nullptr) {
-          execCallbacks = PyLong_FromUint32(true);
-        }
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
+
+      static PyObject* TritonContext_clearSimplificationMemo(PyObject* self, PyObject* noarg) {
         try {
-          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getConcreteRegisterValue(*PyRegister_AsRegister(reg), PyLong_AsBool(execCallbacks)));
+          PyTritonContext_AsTritonContext(self)->clearSimplificationMemo();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1351,28 +2309,27 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-      }
-
 
-      static PyObject* TritonContext_getConcreteVariableValue(PyObject* self, PyObject* symVar) {
-        if (!PySymbolicVariable_Check(symVar))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteVariableValue(): Expects a SymbolicVariable as argument.");
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
+      static PyObject* TritonContext_clearSnapshots(PyObject* self, PyObject* noarg) {
         try {
-          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getConcreteVariableValue(PySymbolicVariable_AsSymbolicVariable(symVar)));
-        }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+          PyTritonContext_AsTritonContext(self)->clearSnapshots();
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_getGprBitSize(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_clearSolverStatistics(PyObject* self, PyObject* noarg) {
         try {
-          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getGprBitSize());
+          PyTritonContext_AsTritonContext(self)->clearSolverStatistics();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1380,12 +2337,14 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-      }
 
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-      static PyObject* TritonContext_getGprSize(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_clearSynthesisCache(PyObject* self, PyObject* noarg) {
         try {
-          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getGprSize());
+          PyTritonContext_AsTritonContext(self)->clearSynthesisCache();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1393,15 +2352,15 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-      }
 
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-      static PyObject* TritonContext_getImmediateAst(PyObject* self, PyObject* imm) {
-        if (!PyImmediate_Check(imm))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getImmediateAst(): Expects an Immediate as argument.");
 
+      static PyObject* TritonContext_clearSynthesisDatabases(PyObject* self, PyObject* noarg) {
         try {
-          return PyAstNode(PyTritonContext_AsTritonContext(self)->getImmediateAst(*PyImmediate_AsImmediate(imm)));
+          PyTritonContext_AsTritonContext(self)->clearSynthesisDatabases();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1409,15 +2368,15 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-      }
 
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-      static PyObject* TritonContext_getMemoryAst(PyObject* self, PyObject* mem) {
-        if (!PyMemoryAccess_Check(mem))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getMemoryAst(): Expects an MemoryAccess as argument.");
 
+      static PyObject* TritonContext_clearTrace(PyObject* self, PyObject* noarg) {
         try {
-          return PyAstNode(PyTritonContext_AsTritonContext(self)->getMemoryAst(*PyMemoryAccess_AsMemoryAccess(mem)));
+          PyTritonContext_AsTritonContext(self)->clearTrace();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1425,53 +2384,29 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-      }
-
-
-      static PyObject* TritonContext_getModel(PyObject* self, PyObject* args, PyObject* kwargs) {
-        triton::engines::solver::status_e status;
-        triton::uint32 solvingTime = 0;
-        triton::uint32 timeout_c = 0;
-
-        PyObject* dict    = nullptr;
-        PyObject* node    = nullptr;
-        PyObject* wb      = nullptr;
-        PyObject* timeout = nullptr;
-
-        static char* keywords[] = {
-          (char*)"node",
-          (char*)"status",
-          (char*)"timeout",
-          nullptr
-        };
 
-        /* Extract Keywords */
-        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOO", keywords, &node, &wb, &timeout) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getModel(): Invalid keyword argument.");
-        }
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-        if (node == nullptr || !PyAstNode_Check(node)) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getModel(): Expects a AstNode as node argument.");
+      static PyObject* TritonContext_clearUnsatCoreCache(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearUnsatCoreCache();
         }
-
-        if (wb != nullptr && !PyBool_Check(wb)) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getModel(): Expects a boolean as status keyword.");
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
         }
-
-        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getModel(): Expects a integer as timeout keyword.");
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        if (timeout != nullptr) {
-          timeout_c = PyLong_AsUint32(timeout);
-        }
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
+      static PyObject* TritonContext_closePersistentDecodeCache(PyObject* self, PyObject* noarg) {
         try {
-          dict = triton::bindings::python::xPyDict_New();
-          auto model = PyTritonContext_AsTritonContext(self)->getModel(PyAstNode_AsAstNode(node), &status, timeout_c, &solvingTime);
-          for (auto it = model.begin(); it != model.end(); it++) {
-            xPyDict_SetItem(dict, PyLong_FromUsize(it->first), PySolverModel(it->second));
-          }
+          PyTritonContext_AsTritonContext(self)->closePersistentDecodeCache();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1480,77 +2415,30 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        if (wb != nullptr && PyLong_AsBool(wb) == true) {
-          PyObject* tuple = triton::bindings::python::xPyTuple_New(3);
-          PyTuple_SetItem(tuple, 0, dict);
-          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
-          PyTuple_SetItem(tuple, 2, PyLong_FromUint32(solvingTime));
-          return tuple;
-        }
-
-        return dict;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_getModels(PyObject* self, PyObject* args, PyObject* kwargs) {
-        triton::engines::solver::status_e status;
-        triton::uint32 solvingTime = 0;
-        triton::uint32 timeout_c = 0;
-
-        PyObject* ret     = nullptr;
-        PyObject* node    = nullptr;
-        PyObject* limit   = nullptr;
-        PyObject* wb      = nullptr;
-        PyObject* timeout = nullptr;
-
-        static char* keywords[] = {
-          (char*)"node",
-          (char*)"limit",
-          (char*)"status",
-          (char*)"timeout",
-          nullptr
-        };
-
-        /* Extract Keywords */
-        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOO", keywords, &node, &limit, &wb, &timeout) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Invalid keyword argument.");
-        }
-
-        if (node == nullptr || !PyAstNode_Check(node)) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects a AstNode as node argument.");
+      static PyObject* TritonContext_closeSharedQueryCache(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->closeSharedQueryCache();
         }
-
-        if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit))) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects an integer as limit argument.");
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
         }
-
-        if (wb != nullptr && !PyBool_Check(wb)) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects a boolean as status keyword.");
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects a integer as timeout keyword.");
-        }
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-        if (timeout != nullptr) {
-          timeout_c = PyLong_AsUint32(timeout);
-        }
 
+      static PyObject* TritonContext_concretizeAllMemory(PyObject* self, PyObject* noarg) {
         try {
-          auto models = PyTritonContext_AsTritonContext(self)->getModels(PyAstNode_AsAstNode(node), PyLong_AsUint32(limit), &status, timeout_c, &solvingTime);
-          triton::uint32 index = 0;
-
-          ret = xPyList_New(models.size());
-          for (auto it = models.begin(); it != models.end(); it++) {
-            PyObject* mdict = xPyDict_New();
-            auto model = *it;
-
-            for (auto it2 = model.begin(); it2 != model.end(); it2++) {
-              xPyDict_SetItem(mdict, PyLong_FromUsize(it2->first), PySolverModel(it2->second));
-            }
-            if (model.size() > 0)
-              PyList_SetItem(ret, index++, mdict);
-          }
+          PyTritonContext_AsTritonContext(self)->concretizeAllMemory();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1559,29 +2447,14 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        if (wb != nullptr && PyLong_AsBool(wb) == true) {
-          PyObject* tuple = triton::bindings::python::xPyTuple_New(3);
-          PyTuple_SetItem(tuple, 0, ret);
-          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
-          PyTuple_SetItem(tuple, 2, PyLong_FromUint32(solvingTime));
-          return tuple;
-        }
-
-        return ret;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_getParentRegisters(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-
+      static PyObject* TritonContext_concretizeAllRegister(PyObject* self, PyObject* noarg) {
         try {
-          triton::uint32 index = 0;
-          auto regs = PyTritonContext_AsTritonContext(self)->getParentRegisters();
-
-          ret = xPyList_New(regs.size());
-          for (const auto* reg: regs) {
-            PyList_SetItem(ret, index++, PyRegister(*reg));
-          }
+          PyTritonContext_AsTritonContext(self)->concretizeAllRegister();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1590,21 +2463,3933 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        return ret;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
+      static PyObject* TritonContext_concretizeMemory(PyObject* self, PyObject* mem) {
+        /* If mem is an address */
+        if (PyLong_Check(mem) || PyInt_Check(mem)) {
+          try {
+            PyTritonContext_AsTritonContext(self)->concretizeMemory(PyLong_AsUint64(mem));
+          }
+          catch (const triton::exceptions::PyCallbacks&) {
+            return nullptr;
+          }
+          catch (const triton::exceptions::Exception& e) {
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+        }
+
+        /* If mem is a MemoryAccess */
+        else if (PyMemoryAccess_Check(mem)) {
+          try {
+            PyTritonContext_AsTritonContext(self)->concretizeMemory(*PyMemoryAccess_AsMemoryAccess(mem));
+          }
+          catch (const triton::exceptions::PyCallbacks&) {
+            return nullptr;
+          }
+          catch (const triton::exceptions::Exception& e) {
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+        }
+
+        /* Invalid parameter */
+        else
+          return PyErr_Format(PyExc_TypeError, "TritonContext::concretizeMemory(): Expects an integer or MemoryAccess as argument.");
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_concretizeRegister(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::concretizeRegister(): Expects a Register as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->concretizeRegister(*PyRegister_AsRegister(reg));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_createSymbolicMemoryExpression(PyObject* self, PyObject* args) {
+        PyObject* inst          = nullptr;
+        PyObject* node          = nullptr;
+        PyObject* mem           = nullptr;
+        PyObject* comment       = nullptr;
+        std::string ccomment    = "";
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOOO", &inst, &node, &mem, &comment) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicMemoryExpression(): Invalid number of arguments");
+        }
+
+        if (inst == nullptr || (!PyInstruction_Check(inst)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicMemoryExpression(): Expects an Instruction as first argument.");
+
+        if (node == nullptr || (!PyAstNode_Check(node)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicMemoryExpression(): Expects a AstNode as second argument.");
+
+        if (mem == nullptr || (!PyMemoryAccess_Check(mem)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicMemoryExpression(): Expects a MemoryAccess as third argument.");
+
+        if (comment != nullptr && !PyStr_Check(comment))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicMemoryExpression(): Expects a sting as fourth argument.");
+
+        if (comment != nullptr)
+          ccomment = PyStr_AsString(comment);
+
+        triton::arch::Instruction& arg1 = *PyInstruction_AsInstruction(inst);
+        triton::ast::SharedAbstractNode arg2 = PyAstNode_AsAstNode(node);
+        triton::arch::MemoryAccess arg3 = *PyMemoryAccess_AsMemoryAccess(mem);
+
+        try {
+          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->createSymbolicMemoryExpression(arg1, arg2, arg3, ccomment));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_createSymbolicRegisterExpression(PyObject* self, PyObject* args) {
+        PyObject* inst          = nullptr;
+        PyObject* node          = nullptr;
+        PyObject* reg           = nullptr;
+        PyObject* comment       = nullptr;
+        std::string ccomment    = "";
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOOO", &inst, &node, &reg, &comment) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicRegisterExpression(): Invalid number of arguments");
+        }
+
+        if (inst == nullptr || (!PyInstruction_Check(inst)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicRegisterExpression(): Expects an Instruction as first argument.");
+
+        if (node == nullptr || (!PyAstNode_Check(node)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicRegisterExpression(): Expects a AstNode as second argument.");
+
+        if (reg == nullptr || (!PyRegister_Check(reg)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicRegisterExpression(): Expects a Register as third argument.");
+
+        if (comment != nullptr && !PyStr_Check(comment))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicRegisterExpression(): Expects a sting as fourth argument.");
+
+        if (comment != nullptr)
+          ccomment = PyStr_AsString(comment);
+
+        triton::arch::Instruction& arg1 = *PyInstruction_AsInstruction(inst);
+        triton::ast::SharedAbstractNode arg2 = PyAstNode_AsAstNode(node);
+        triton::arch::Register arg3 = *PyRegister_AsRegister(reg);
+
+        try {
+          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->createSymbolicRegisterExpression(arg1, arg2, arg3, ccomment));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_createSymbolicVolatileExpression(PyObject* self, PyObject* args) {
+        PyObject* inst          = nullptr;
+        PyObject* node          = nullptr;
+        PyObject* comment       = nullptr;
+        std::string ccomment    = "";
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &inst, &node, &comment) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicVolatileExpression(): Invalid number of arguments");
+        }
+
+        if (inst == nullptr || (!PyInstruction_Check(inst)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicVolatileExpression(): Expects an Instruction as first argument.");
+
+        if (node == nullptr || (!PyAstNode_Check(node)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicVolatileExpression(): Expects a AstNode as second argument.");
+
+        if (comment != nullptr && !PyStr_Check(comment))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::createSymbolicVolatileExpression(): Expects a sting as third argument.");
+
+        if (comment != nullptr)
+          ccomment = PyStr_AsString(comment);
+
+        triton::arch::Instruction& arg1 = *PyInstruction_AsInstruction(inst);
+        triton::ast::SharedAbstractNode arg2 = PyAstNode_AsAstNode(node);
+
+        try {
+          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->createSymbolicVolatileExpression(arg1, arg2, ccomment));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      /* Returns the dict of a decoded instruction */
+      static PyObject* TritonContext_decodeInfo(const triton::arch::DecodeInfo& info) {
+        PyObject* dict = xPyDict_New();
+        xPyDict_SetItemString(dict, "address",     PyLong_FromUint64(info.address));
+        xPyDict_SetItemString(dict, "size",        PyLong_FromUint32(info.size));
+        xPyDict_SetItemString(dict, "type",        PyLong_FromUint32(info.type));
+        xPyDict_SetItemString(dict, "flow",        PyLong_FromUint32(info.flow));
+        xPyDict_SetItemString(dict, "branch",      PyBool_FromLong(info.branch));
+        xPyDict_SetItemString(dict, "controlFlow", PyBool_FromLong(info.controlFlow));
+        xPyDict_SetItemString(dict, "direct",      PyBool_FromLong(info.direct));
+        xPyDict_SetItemString(dict, "target",      PyLong_FromUint64(info.target));
+        return dict;
+      }
+
+
+      static PyObject* TritonContext_decode(PyObject* self, PyObject* args) {
+        PyObject* arg0 = nullptr;
+        PyObject* arg1 = nullptr;
+        PyObject* ret  = nullptr;
+        triton::usize index = 0;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &arg0, &arg1) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::decode(): Invalid number of arguments.");
+        }
+
+        if (arg1 != nullptr && (!PyLong_Check(arg1) && !PyInt_Check(arg1)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::decode(): Expects an integer as second argument.");
+
+        try {
+          if (arg0 != nullptr && PyBytes_Check(arg0)) {
+            const triton::uint8* opcode = reinterpret_cast<const triton::uint8*>(PyBytes_AsString(arg0));
+            triton::uint32 size = static_cast<triton::uint32>(PyBytes_Size(arg0));
+            return TritonContext_decodeInfo(PyTritonContext_AsTritonContext(self)->decode(opcode, size, arg1 ? PyLong_AsUint64(arg1) : 0));
+          }
+
+          if (arg0 != nullptr && (PyLong_Check(arg0) || PyInt_Check(arg0)) && arg1 != nullptr) {
+            auto infos = PyTritonContext_AsTritonContext(self)->decode(PyLong_AsUint64(arg0), PyLong_AsUsize(arg1));
+            ret = xPyList_New(infos.size());
+            for (const auto& info : infos)
+              PyList_SetItem(ret, index++, TritonContext_decodeInfo(info));
+            return ret;
+          }
+
+          return PyErr_Format(PyExc_TypeError, "TritonContext::decode(): Expects bytes or two integers as arguments.");
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_detachGdbRemote(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->detachGdbRemote();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+      static PyObject* TritonContext_disassembly(PyObject* self, PyObject* args) {
+        PyObject* arg0 = nullptr;
+        PyObject* arg1 = nullptr;
+        PyObject* ret  = nullptr;
+        triton::usize index = 0;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &arg0, &arg1) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::disassembly(): Invalid number of arguments.");
+        }
+
+        try {
+          if (arg0 != nullptr && PyInstruction_Check(arg0)) {
+            PyTritonContext_AsTritonContext(self)->disassembly(*PyInstruction_AsInstruction(arg0));
+            Py_INCREF(Py_None);
+            return Py_None;
+          }
+          if (arg0 != nullptr && PyBasicBlock_Check(arg0)) {
+            triton::uint64 base = 0;
+            if (arg1 != nullptr && (PyLong_Check(arg1) || PyInt_Check(arg1))) {
+              base = PyLong_AsUint64(arg1);
+            }
+            PyTritonContext_AsTritonContext(self)->disassembly(*PyBasicBlock_AsBasicBlock(arg0), base);
+            Py_INCREF(Py_None);
+            return Py_None;
+          }
+          if ((arg0 != nullptr && (PyLong_Check(arg0) || PyInt_Check(arg0))) &&
+              (arg1 == nullptr || PyLong_Check(arg1) || PyInt_Check(arg1))) {
+
+            std::vector<triton::arch::Instruction> insts;
+            if (arg1) {
+              insts = PyTritonContext_AsTritonContext(self)->disassembly(PyLong_AsUint64(arg0), PyLong_AsUsize(arg1));
+              ret = xPyList_New(insts.size());
+              for (auto& inst : insts)
+                PyList_SetItem(ret, index++, PyInstruction(inst));
+            }
+            else {
+              ret = PyBasicBlock(PyTritonContext_AsTritonContext(self)->disassembly(PyLong_AsUint64(arg0)));
+            }
+            return ret;
+          }
+          else {
+            return PyErr_Format(PyExc_TypeError, "TritonContext::disassembly(): Expects an Instruction or two integers as arguments.");
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_disassemblyBlocks(PyObject* self, PyObject* args) {
+        PyObject* addr    = nullptr;
+        PyObject* size    = nullptr;
+        PyObject* threads = nullptr;
+        PyObject* ret     = nullptr;
+        triton::usize index = 0;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &addr, &size, &threads) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::disassemblyBlocks(): Invalid number of arguments.");
+        }
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::disassemblyBlocks(): Expects an integer as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::disassemblyBlocks(): Expects an integer as second argument.");
+
+        if (threads != nullptr && (!PyLong_Check(threads) && !PyInt_Check(threads)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::disassemblyBlocks(): Expects an integer as third argument.");
+
+        try {
+          auto blocks = PyTritonContext_AsTritonContext(self)->disassemblyBlocks(PyLong_AsUint64(addr), PyLong_AsUsize(size), threads ? PyLong_AsUint32(threads) : 0);
+          ret = xPyList_New(blocks.size());
+          for (auto& block : blocks)
+            PyList_SetItem(ret, index++, PyBasicBlock(block));
+          return ret;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_dumpSlowSolverQueries(PyObject* self, PyObject* args) {
+        PyObject* directory = nullptr;
+        PyObject* threshold = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &directory, &threshold) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::dumpSlowSolverQueries(): Invalid number of arguments");
+        }
+
+        if (directory == nullptr || !PyStr_Check(directory))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::dumpSlowSolverQueries(): Expects a string as first argument.");
+
+        if (threshold == nullptr || (!PyLong_Check(threshold) && !PyInt_Check(threshold)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::dumpSlowSolverQueries(): Expects an integer as second argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->dumpSlowSolverQueries(PyStr_AsString(directory), PyLong_AsUint32(threshold));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_dumpSolverQueries(PyObject* self, PyObject* path) {
+        if (!PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::dumpSolverQueries(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->dumpSolverQueries(PyStr_AsString(path));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_dumpTrace(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* path     = nullptr;
+        PyObject* perfetto = nullptr;
+
+        static char* keywords[] = {
+          (char*)"path",
+          (char*)"perfetto",
+          nullptr
+        };
+
+        /* Extract arguments */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &path, &perfetto) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::dumpTrace(): Invalid keyword argument");
+        }
+
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::dumpTrace(): Expects a string as path.");
+
+        if (perfetto != nullptr && !PyBool_Check(perfetto))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::dumpTrace(): Expects a boolean as perfetto.");
+
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->dumpTrace(PyStr_AsString(path), perfetto != nullptr && PyLong_AsBool(perfetto)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_emulate(PyObject* self, PyObject* args, PyObject* kwargs) {
+        std::unordered_map<triton::uint64, std::function<bool(triton::Context&, triton::uint64)>> callbacks;
+        std::unordered_set<triton::uint64> stopAddresses;
+        triton::arch::exception_e fault = triton::arch::NO_FAULT;
+        triton::usize maxInstructions = 0;
+        triton::usize executed = 0;
+        PyObject* addr  = nullptr;
+        PyObject* count = nullptr;
+        PyObject* stops = nullptr;
+        PyObject* hooks = nullptr;
+
+        static char* keywords[] = {
+          (char*)"addr",
+          (char*)"count",
+          (char*)"stops",
+          (char*)"hooks",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "O|OOO", keywords, &addr, &count, &stops, &hooks) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Invalid keyword argument");
+        }
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Expects an integer as addr keyword.");
+        }
+
+        if (count != nullptr && (!PyLong_Check(count) && !PyInt_Check(count))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Expects an integer as count keyword.");
+        }
+
+        if (hooks != nullptr && !PyDict_Check(hooks)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Expects a dict as hooks keyword.");
+        }
+
+        try {
+          if (count != nullptr)
+            maxInstructions = PyLong_AsUsize(count);
+
+          if (stops != nullptr) {
+            PyObject* iterator = PyObject_GetIter(stops);
+            if (iterator == nullptr) {
+              PyErr_Clear();
+              return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Expects a list of integers as stops keyword.");
+            }
+            while (PyObject* item = PyIter_Next(iterator)) {
+              if (!PyLong_Check(item) && !PyInt_Check(item)) {
+                Py_DECREF(item);
+                Py_DECREF(iterator);
+                return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Expects a list of integers as stops keyword.");
+              }
+              stopAddresses.insert(PyLong_AsUint64(item));
+              Py_DECREF(item);
+            }
+            Py_DECREF(iterator);
+          }
+
+          if (hooks != nullptr) {
+            PyObject* key   = nullptr;
+            PyObject* value = nullptr;
+            Py_ssize_t pos  = 0;
+
+            while (PyDict_Next(hooks, &pos, &key, &value)) {
+              if ((!PyLong_Check(key) && !PyInt_Check(key)) || !PyCallable_Check(value)) {
+                return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Expects a dict of {integer: function} as hooks keyword.");
+              }
+              /* The dict holds the functions during the call */
+              callbacks[PyLong_AsUint64(key)] = [self, value](triton::Context& ctx, triton::uint64 address) -> bool {
+                /********* Lambda *********/
+                triton::bindings::python::PyAcquireGil gil;
+                PyObject* pyAddr = PyLong_FromUint64(address);
+                PyObject* ret    = PyObject_CallFunctionObjArgs(value, self, pyAddr, nullptr);
+
+                Py_DECREF(pyAddr);
+
+                /* Check the call */
+                if (ret == nullptr) {
+                  throw triton::exceptions::PyCallbacks();
+                }
+
+                /* Only False stops the loop */
+                bool proceed = (ret != Py_False);
+                Py_DECREF(ret);
+
+                return proceed;
+                /********* End of lambda *********/
+              };
+            }
+          }
+
+          fault = PyTritonContext_AsTritonContext(self)->run(PyLong_AsUint64(addr), maxInstructions, stopAddresses, callbacks, &executed);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        PyObject* ret = triton::bindings::python::xPyTuple_New(2);
+        PyTuple_SetItem(ret, 0, PyLong_FromUint32(fault));
+        PyTuple_SetItem(ret, 1, PyLong_FromUsize(executed));
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_enableAdaptiveTimeout(PyObject* self, PyObject* flag) {
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableAdaptiveTimeout(): Expects a boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enableAdaptiveTimeout(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_enableBitBlasting(PyObject* self, PyObject* args) {
+        PyObject* flag     = nullptr;
+        PyObject* maxNodes = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &flag, &maxNodes) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableBitBlasting(): Invalid number of arguments");
+        }
+
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableBitBlasting(): Expects a boolean as first argument.");
+
+        if (maxNodes != nullptr && (!PyLong_Check(maxNodes) && !PyInt_Check(maxNodes)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableBitBlasting(): Expects an integer as second argument.");
+
+        try {
+          if (maxNodes != nullptr)
+            PyTritonContext_AsTritonContext(self)->enableBitBlasting(PyLong_AsBool(flag), PyLong_AsUsize(maxNodes));
+          else
+            PyTritonContext_AsTritonContext(self)->enableBitBlasting(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_enableConcreteMemo(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* flag     = nullptr;
+        PyObject* capacity = nullptr;
+
+        static char* keywords[] = {
+          (char*)"flag",
+          (char*)"capacity",
+          nullptr
+        };
+
+        /* Extract arguments */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "O|O", keywords, &flag, &capacity) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableConcreteMemo(): Invalid keyword argument");
+        }
+
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableConcreteMemo(): Expects a boolean as flag.");
+
+        if (capacity != nullptr && (!PyLong_Check(capacity) && !PyInt_Check(capacity)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableConcreteMemo(): Expects an integer as capacity.");
+
+        try {
+          if (capacity != nullptr)
+            PyTritonContext_AsTritonContext(self)->enableConcreteMemo(PyLong_AsBool(flag), PyLong_AsUsize(capacity));
+          else
+            PyTritonContext_AsTritonContext(self)->enableConcreteMemo(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+      static PyObject* TritonContext_enableConstraintIndependence(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableConstraintIndependence(): Expects a boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enableConstraintIndependence(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+      static PyObject* TritonContext_enableCounterexampleCache(PyObject* self, PyObject* args) {
+        PyObject* flag     = nullptr;
+        PyObject* capacity = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &flag, &capacity) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableCounterexampleCache(): Invalid number of arguments");
+        }
+
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableCounterexampleCache(): Expects a boolean as first argument.");
+
+        if (capacity != nullptr && (!PyLong_Check(capacity) && !PyInt_Check(capacity)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableCounterexampleCache(): Expects an integer as second argument.");
+
+        try {
+          if (capacity != nullptr)
+            PyTritonContext_AsTritonContext(self)->enableCounterexampleCache(PyLong_AsBool(flag), PyLong_AsUsize(capacity));
+          else
+            PyTritonContext_AsTritonContext(self)->enableCounterexampleCache(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+      static PyObject* TritonContext_enableDecodeCache(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableDecodeCache(): Expects a boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enableDecodeCache(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+      static PyObject* TritonContext_enableHeatMap(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* flag   = nullptr;
+        PyObject* period = nullptr;
+
+        static char* keywords[] = {
+          (char*)"flag",
+          (char*)"period",
+          nullptr
+        };
+
+        /* Extract arguments */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "O|O", keywords, &flag, &period) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableHeatMap(): Invalid keyword argument");
+        }
+
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableHeatMap(): Expects a boolean as flag.");
+
+        if (period != nullptr && (!PyLong_Check(period) && !PyInt_Check(period)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableHeatMap(): Expects an integer as period.");
+
+        try {
+          if (period != nullptr)
+            PyTritonContext_AsTritonContext(self)->enableHeatMap(PyLong_AsBool(flag), PyLong_AsUint32(period));
+          else
+            PyTritonContext_AsTritonContext(self)->enableHeatMap(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_enableIncrementalSolving(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableIncrementalSolving(): Expects a boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enableIncrementalSolving(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_enablePresolver(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enablePresolver(): Expects a boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enablePresolver(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_enableProfiling(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableProfiling(): Expects a boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enableProfiling(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_enableQueryCache(PyObject* self, PyObject* args) {
+        PyObject* flag     = nullptr;
+        PyObject* capacity = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &flag, &capacity) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableQueryCache(): Invalid number of arguments");
+        }
+
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableQueryCache(): Expects a boolean as first argument.");
+
+        if (capacity != nullptr && (!PyLong_Check(capacity) && !PyInt_Check(capacity)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableQueryCache(): Expects an integer as second argument.");
+
+        try {
+          if (capacity != nullptr)
+            PyTritonContext_AsTritonContext(self)->enableQueryCache(PyLong_AsBool(flag), PyLong_AsUsize(capacity));
+          else
+            PyTritonContext_AsTritonContext(self)->enableQueryCache(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_enableQueryClassification(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableQueryClassification(): Expects a boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enableQueryClassification(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+      static PyObject* TritonContext_enableSemanticsCache(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableSemanticsCache(): Expects a boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enableSemanticsCache(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+      static PyObject* TritonContext_enableSolverStatistics(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableSolverStatistics(): Expects a boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enableSolverStatistics(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+      static PyObject* TritonContext_enableSynthesisCache(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableSynthesisCache(): Expects a boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enableSynthesisCache(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_enableSyscallEmulation(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableSyscallEmulation(): Expects a boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enableSyscallEmulation(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_enableTracing(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableTracing(): Expects a boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enableTracing(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+      static PyObject* TritonContext_enableUndoJournal(PyObject* self, PyObject* args) {
+        PyObject* flag     = nullptr;
+        PyObject* capacity = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &flag, &capacity) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableUndoJournal(): Invalid number of arguments");
+        }
+
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableUndoJournal(): Expects a boolean as first argument.");
+
+        if (capacity != nullptr && (!PyLong_Check(capacity) && !PyInt_Check(capacity)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableUndoJournal(): Expects an integer as second argument.");
+
+        try {
+          if (capacity != nullptr)
+            PyTritonContext_AsTritonContext(self)->enableUndoJournal(PyLong_AsBool(flag), PyLong_AsUsize(capacity));
+          else
+            PyTritonContext_AsTritonContext(self)->enableUndoJournal(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+      static PyObject* TritonContext_enableUnsatCoreCache(PyObject* self, PyObject* args) {
+        PyObject* flag     = nullptr;
+        PyObject* capacity = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &flag, &capacity) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableUnsatCoreCache(): Invalid number of arguments");
+        }
+
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableUnsatCoreCache(): Expects a boolean as first argument.");
+
+        if (capacity != nullptr && (!PyLong_Check(capacity) && !PyInt_Check(capacity)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableUnsatCoreCache(): Expects an integer as second argument.");
+
+        try {
+          if (capacity != nullptr)
+            PyTritonContext_AsTritonContext(self)->enableUnsatCoreCache(PyLong_AsBool(flag), PyLong_AsUsize(capacity));
+          else
+            PyTritonContext_AsTritonContext(self)->enableUnsatCoreCache(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+      static PyObject* TritonContext_enumerateModels(PyObject* self, PyObject* args, PyObject* kwargs) {
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> vars;
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        triton::uint32 solvingTime = 0;
+        triton::uint32 timeout_c = 0;
+        triton::uint32 limit_c = 0;
+        triton::usize count = 0;
+
+        PyObject* node       = nullptr;
+        PyObject* callback   = nullptr;
+        PyObject* projection = nullptr;
+        PyObject* limit      = nullptr;
+        PyObject* wb         = nullptr;
+        PyObject* timeout    = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"callback",
+          (char*)"projection",
+          (char*)"limit",
+          (char*)"status",
+          (char*)"timeout",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOOOO", keywords, &node, &callback, &projection, &limit, &wb, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enumerateModels(): Invalid keyword argument.");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enumerateModels(): Expects a AstNode as node argument.");
+        }
+
+        if (callback == nullptr || !PyCallable_Check(callback)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enumerateModels(): Expects a function as callback argument.");
+        }
+
+        if (projection != nullptr && !PyList_Check(projection)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enumerateModels(): Expects a list of SymbolicVariable as projection keyword.");
+        }
+
+        if (limit != nullptr && (!PyLong_Check(limit) && !PyInt_Check(limit))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enumerateModels(): Expects an integer as limit keyword.");
+        }
+
+        if (wb != nullptr && !PyBool_Check(wb)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enumerateModels(): Expects a boolean as status keyword.");
+        }
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enumerateModels(): Expects an integer as timeout keyword.");
+        }
+
+        if (projection != nullptr) {
+          for (Py_ssize_t i = 0; i < PyList_Size(projection); i++) {
+            PyObject* item = PyList_GetItem(projection, i);
+            if (!PySymbolicVariable_Check(item)) {
+              return PyErr_Format(PyExc_TypeError, "TritonContext::enumerateModels(): Expects a list of SymbolicVariable as projection keyword.");
+            }
+            vars.push_back(PySymbolicVariable_AsSymbolicVariable(item));
+          }
+        }
+
+        if (limit != nullptr) {
+          limit_c = PyLong_AsUint32(limit);
+        }
+
+        if (timeout != nullptr) {
+          timeout_c = PyLong_AsUint32(timeout);
+        }
+
+        try {
+          auto cb = [callback](const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model) {
+            triton::bindings::python::PyAcquireGil gil;
+            PyObject* mdict = xPyDict_New();
+            for (auto it = model.begin(); it != model.end(); it++) {
+              xPyDict_SetItem(mdict, PyLong_FromUsize(it->first), PySolverModel(it->second));
+            }
+
+            PyObject* res = PyObject_CallFunctionObjArgs(callback, mdict, nullptr);
+            Py_DECREF(mdict);
+            if (res == nullptr) {
+              throw triton::exceptions::PyCallbacks();
+            }
+
+            /* Only False stops the enumeration */
+            bool next = (res != Py_False);
+            Py_DECREF(res);
+            return next;
+          };
+
+          count = PyTritonContext_AsTritonContext(self)->enumerateModels(PyAstNode_AsAstNode(node), vars, cb, limit_c, &status, timeout_c, &solvingTime);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        if (wb != nullptr && PyLong_AsBool(wb) == true) {
+          PyObject* tuple = triton::bindings::python::xPyTuple_New(3);
+          PyTuple_SetItem(tuple, 0, PyLong_FromUsize(count));
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
+          PyTuple_SetItem(tuple, 2, PyLong_FromUint32(solvingTime));
+          return tuple;
+        }
+
+        return PyLong_FromUsize(count);
+      }
+
+      static PyObject* TritonContext_evaluateAstViaModel(PyObject* self, PyObject* args) {
+        std::unordered_map<triton::usize, triton::uint512> values;
+        PyObject* node  = nullptr;
+        PyObject* model = nullptr;
+        PyObject* key   = nullptr;
+        PyObject* value = nullptr;
+        Py_ssize_t pos  = 0;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &node, &model) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::evaluateAstViaModel(): Invalid number of arguments");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::evaluateAstViaModel(): Expects a AstNode as first argument.");
+
+        if (model == nullptr || !PyDict_Check(model))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::evaluateAstViaModel(): Expects a dict as second argument.");
+
+        try {
+          while (PyDict_Next(model, &pos, &key, &value)) {
+            if (!PyLong_Check(key) && !PyInt_Check(key))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::evaluateAstViaModel(): Expects symbolic variable ids as keys.");
+
+            if (PySolverModel_Check(value))
+              values[PyLong_AsUsize(key)] = PySolverModel_AsSolverModel(value)->getValue();
+            else if (PyLong_Check(value) || PyInt_Check(value))
+              values[PyLong_AsUsize(key)] = PyLong_AsUint512(value);
+            else
+              return PyErr_Format(PyExc_TypeError, "TritonContext::evaluateAstViaModel(): Expects SolverModel or integers as values.");
+          }
+
+          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->evaluateAstViaModel(PyAstNode_AsAstNode(node), values));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_evaluateAstViaSolver(PyObject* self, PyObject* node) {
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::evaluateAstViaSolver(): Expects a AstNode as argument.");
+
+        try {
+          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->evaluateAstViaSolver(PyAstNode_AsAstNode(node)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_exportHeatMap(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* path       = nullptr;
+        PyObject* flameGraph = nullptr;
+
+        static char* keywords[] = {
+          (char*)"path",
+          (char*)"flameGraph",
+          nullptr
+        };
+
+        /* Extract arguments */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "O|O", keywords, &path, &flameGraph) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::exportHeatMap(): Invalid keyword argument");
+        }
+
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::exportHeatMap(): Expects a string as path.");
+
+        if (flameGraph != nullptr && !PyBool_Check(flameGraph))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::exportHeatMap(): Expects a boolean as flameGraph.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->exportHeatMap(PyStr_AsString(path), flameGraph != nullptr && PyLong_AsBool(flameGraph));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_fork(PyObject* self, PyObject* noarg) {
+        try {
+          return PyTritonContext(PyTritonContext_AsTritonContext(self)->fork().release());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getAllRegisters(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          triton::uint32 index = 0;
+          auto& regs = PyTritonContext_AsTritonContext(self)->getAllRegisters();
+
+          ret = xPyList_New(regs.size());
+          for (auto& reg: regs)
+            PyList_SetItem(ret, index++, PyRegister(reg.second));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getArchitecture(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getArchitecture());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getAstBudgetEvents(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& events = PyTritonContext_AsTritonContext(self)->getAstBudgetEvents();
+          triton::usize index = 0;
+
+          ret = xPyList_New(events.size());
+          for (const auto& event : events) {
+            PyObject* dict = xPyDict_New();
+            xPyDict_SetItemString(dict, "address",     PyLong_FromUint64(event.address));
+            xPyDict_SetItemString(dict, "id",          PyLong_FromUsize(event.id));
+            xPyDict_SetItemString(dict, "level",       PyLong_FromUint32(event.level));
+            xPyDict_SetItemString(dict, "nodes",       PyLong_FromUsize(event.nodes));
+            xPyDict_SetItemString(dict, "concretized", PyBool_FromLong(event.concretized));
+            PyList_SetItem(ret, index++, dict);
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getAstContext(PyObject* self, PyObject* noarg) {
+        try {
+          return PyAstContext(PyTritonContext_AsTritonContext(self)->getAstContext());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getAstRepresentationMode(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getAstRepresentationMode());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getAsyncSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getAsyncSize());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getConcreteMemoStats(PyObject* self, PyObject* noarg) {
+        try {
+          auto stats = PyTritonContext_AsTritonContext(self)->getConcreteMemoStats();
+          PyObject* ret = xPyDict_New();
+
+          xPyDict_SetItemString(ret, "hits",     PyLong_FromUint64(stats.hits));
+          xPyDict_SetItemString(ret, "misses",   PyLong_FromUint64(stats.misses));
+          xPyDict_SetItemString(ret, "records",  PyLong_FromUint64(stats.records));
+          xPyDict_SetItemString(ret, "flushes",  PyLong_FromUint64(stats.flushes));
+          xPyDict_SetItemString(ret, "size",     PyLong_FromUsize(stats.size));
+          xPyDict_SetItemString(ret, "capacity", PyLong_FromUsize(stats.capacity));
+
+          return ret;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_getConcreteMemoryAreaValue(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* ret           = nullptr;
+        PyObject* addr          = nullptr;
+        PyObject* size          = nullptr;
+        PyObject* execCallbacks = nullptr;
+
+        static char* keywords[] = {
+          (char*)"addr",
+          (char*)"size",
+          (char*)"callbacks",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "OO|O", keywords, &addr, &size, &execCallbacks) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryAreaValue(): Invalid keyword argument");
+        }
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryAreaValue(): Expects an integer as addr keyword.");
+        }
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryAreaValue(): Expects an integer as size keyword.");
+        }
+
+        if (execCallbacks != nullptr && !PyBool_Check(execCallbacks)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryAreaValue(): Expects a boolean as execCallbacks keyword.");
+        }
+
+        if (execCallbacks == nullptr) {
+          execCallbacks = PyLong_FromUint32(true);
+        }
+
+        try {
+          /* The callbacks are processed byte by byte, as the area is read */
+          if (PyLong_AsBool(execCallbacks)) {
+            std::vector<triton::uint8> vv = PyTritonContext_AsTritonContext(self)->getConcreteMemoryAreaValue(PyLong_AsUint64(addr), PyLong_AsUsize(size), true);
+            return PyBytes_FromStringAndSize(reinterpret_cast<const char*>(vv.data()), vv.size());
+          }
+
+          /* Otherwise the area is read straight into the bytes object */
+          ret = PyBytes_FromStringAndSize(nullptr, PyLong_AsUsize(size));
+          if (ret == nullptr)
+            return nullptr;
+
+          PyTritonContext_AsTritonContext(self)->readConcreteMemory(PyLong_AsUint64(addr), PyBytes_AsString(ret), PyLong_AsUsize(size), false);
+          return ret;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          Py_XDECREF(ret);
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          Py_XDECREF(ret);
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getConcreteMemoryValue(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* mem           = nullptr;
+        PyObject* execCallbacks = nullptr;
+
+        static char* keywords[] = {
+          (char*)"mem",
+          (char*)"callbacks",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "O|O", keywords, &mem, &execCallbacks) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryValue(): Invalid keyword argument");
+        }
+
+        if (mem == nullptr || (!PyLong_Check(mem) && !PyInt_Check(mem) && !PyMemoryAccess_Check(mem))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryValue(): Expects a MemoryAccess or an integer as mem keyword.");
+        }
+
+        if (execCallbacks != nullptr && !PyBool_Check(execCallbacks)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryValue(): Expects a boolean as execCallbacks keyword.");
+        }
+
+        if (execCallbacks == nullptr) {
+          execCallbacks = PyLong_FromUint32(true);
+        }
+
+        try {
+          if (PyLong_Check(mem) || PyInt_Check(mem))
+              return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getConcreteMemoryValue(PyLong_AsUint64(mem), PyLong_AsBool(execCallbacks)));
+          else if (PyMemoryAccess_Check(mem))
+              return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getConcreteMemoryValue(*PyMemoryAccess_AsMemoryAccess(mem), PyLong_AsBool(execCallbacks)));
+          else
+            return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryValue(): Something wrong.");
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getConcreteRegisterFile(PyObject* self, PyObject* noarg) {
+        try {
+          triton::Context* ctx = PyTritonContext_AsTritonContext(self);
+          return PyBytes_FromStringAndSize(reinterpret_cast<const char*>(ctx->getConcreteRegisterFile()), ctx->getConcreteRegisterFileSize());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getConcreteRegisterValue(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* reg           = nullptr;
+        PyObject* execCallbacks = nullptr;
+
+        static char* keywords[] = {
+          (char*)"reg",
+          (char*)"callbacks",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "O|O", keywords, &reg, &execCallbacks) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteRegisterValue(): Invalid keyword argument");
+        }
+
+        if (reg == nullptr || !PyRegister_Check(reg)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteRegisterValue(): Expects a Register as reg keyword.");
+        }
+
+        if (execCallbacks != nullptr && !PyBool_Check(execCallbacks)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteRegisterValue(): Expects a boolean as execCallbacks keyword.");
+        }
+
+        if (execCallbacks == nullptr) {
+          execCallbacks = PyLong_FromUint32(true);
+        }
+
+        try {
+          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getConcreteRegisterValue(*PyRegister_AsRegister(reg), PyLong_AsBool(execCallbacks)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getConcreteVariableValue(PyObject* self, PyObject* symVar) {
+        if (!PySymbolicVariable_Check(symVar))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteVariableValue(): Expects a SymbolicVariable as argument.");
+
+        try {
+          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getConcreteVariableValue(PySymbolicVariable_AsSymbolicVariable(symVar)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getConcretizationEvents(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          triton::Context* ctx = PyTritonContext_AsTritonContext(self);
+          const auto& events = ctx->getConcretizationEvents();
+          triton::usize index = 0;
+
+          ret = xPyList_New(events.size());
+          for (const auto& event : events) {
+            PyObject* dict = xPyDict_New();
+            xPyDict_SetItemString(dict, "address", PyLong_FromUint64(event.address));
+            xPyDict_SetItemString(dict, "rule",    PyLong_FromUint32(event.rule));
+            if (event.reg != triton::arch::ID_REG_INVALID) {
+              xPyDict_SetItemString(dict, "register", PyRegister(ctx->getRegister(event.reg)));
+            }
+            else {
+              Py_INCREF(Py_None);
+              xPyDict_SetItemString(dict, "register", Py_None);
+            }
+            xPyDict_SetItemString(dict, "memory",  PyLong_FromUint64(event.memory));
+            xPyDict_SetItemString(dict, "size",    PyLong_FromUint32(event.size));
+            PyList_SetItem(ret, index++, dict);
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+      static PyObject* TritonContext_getCounterexampleCacheHits(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getCounterexampleCacheHits());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getCounterexampleCacheSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getCounterexampleCacheSize());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_getDenseModel(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::engines::solver::status_e status;
+        triton::uint32 solvingTime = 0;
+        triton::uint32 timeout_c = 0;
+
+        PyObject* list    = nullptr;
+        PyObject* node    = nullptr;
+        PyObject* wb      = nullptr;
+        PyObject* timeout = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"status",
+          (char*)"timeout",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOO", keywords, &node, &wb, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getDenseModel(): Invalid keyword argument.");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getDenseModel(): Expects a AstNode as node argument.");
+        }
+
+        if (wb != nullptr && !PyBool_Check(wb)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getDenseModel(): Expects a boolean as status keyword.");
+        }
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getDenseModel(): Expects a integer as timeout keyword.");
+        }
+
+        if (timeout != nullptr) {
+          timeout_c = PyLong_AsUint32(timeout);
+        }
+
+        try {
+          triton::ast::SharedAbstractNode ast = PyAstNode_AsAstNode(node);
+          triton::engines::solver::DenseModel model;
+          {
+            triton::bindings::python::PyAllowThreads allow;
+            model = PyTritonContext_AsTritonContext(self)->getDenseModel(ast, &status, timeout_c, &solvingTime);
+          }
+          list = triton::bindings::python::xPyList_New(model.size());
+          for (triton::usize index = 0; index < model.size(); index++) {
+            PyObject* item = triton::bindings::python::xPyTuple_New(2);
+            PyTuple_SetItem(item, 0, PyLong_FromUsize(model.getId(index)));
+            PyTuple_SetItem(item, 1, PyLong_FromUint512(model.getValue(index)));
+            PyList_SetItem(list, index, item);
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        if (wb != nullptr && PyLong_AsBool(wb) == true) {
+          PyObject* tuple = triton::bindings::python::xPyTuple_New(3);
+          PyTuple_SetItem(tuple, 0, list);
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
+          PyTuple_SetItem(tuple, 2, PyLong_FromUint32(solvingTime));
+          return tuple;
+        }
+
+        return list;
+      }
+
+      static PyObject* TritonContext_getFunctionSummaries(PyObject* self, PyObject* noarg) {
+        try {
+          PyObject* ret = xPyDict_New();
+          for (const auto& summary : PyTritonContext_AsTritonContext(self)->getFunctionSummaries())
+            xPyDict_SetItem(ret, PyLong_FromUint64(summary.first), xPyString_FromString(summary.second.c_str()));
+          return ret;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getGdbRemoteStats(PyObject* self, PyObject* noarg) {
+        try {
+          const triton::loaders::GdbRemote* remote = PyTritonContext_AsTritonContext(self)->getGdbRemote();
+          if (remote == nullptr) {
+            Py_INCREF(Py_None);
+            return Py_None;
+          }
+
+          PyObject* ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "packets", PyLong_FromUsize(remote->getNumberOfPackets()));
+          xPyDict_SetItemString(ret, "pages", PyLong_FromUsize(remote->getNumberOfFetchedPages()));
+          return ret;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_getGprBitSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getGprBitSize());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getGprSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getGprSize());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getHotSpots(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* blocks = nullptr;
+        PyObject* count  = nullptr;
+        PyObject* ret    = nullptr;
+
+        static char* keywords[] = {
+          (char*)"blocks",
+          (char*)"count",
+          nullptr
+        };
+
+        /* Extract arguments */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &blocks, &count) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getHotSpots(): Invalid keyword argument");
+        }
+
+        if (blocks != nullptr && !PyBool_Check(blocks))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getHotSpots(): Expects a boolean as blocks.");
+
+        if (count != nullptr && (!PyLong_Check(count) && !PyInt_Check(count)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getHotSpots(): Expects an integer as count.");
+
+        try {
+          auto spots = PyTritonContext_AsTritonContext(self)->getHotSpots(blocks != nullptr && PyLong_AsBool(blocks), count != nullptr ? PyLong_AsUsize(count) : 0);
+          triton::usize index = 0;
+
+          ret = xPyList_New(spots.size());
+          for (const auto& spot : spots) {
+            PyObject* dict = xPyDict_New();
+            xPyDict_SetItemString(dict, "count",       PyLong_FromUint64(spot.second.count));
+            xPyDict_SetItemString(dict, "time",        PyLong_FromUint64(spot.second.time));
+            xPyDict_SetItemString(dict, "nodes",       PyLong_FromUint64(spot.second.nodes));
+            xPyDict_SetItemString(dict, "expressions", PyLong_FromUint64(spot.second.expressions));
+
+            PyObject* item = xPyTuple_New(2);
+            PyTuple_SetItem(item, 0, PyLong_FromUint64(spot.first));
+            PyTuple_SetItem(item, 1, dict);
+            PyList_SetItem(ret, index++, item);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getImmediateAst(PyObject* self, PyObject* imm) {
+        if (!PyImmediate_Check(imm))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getImmediateAst(): Expects an Immediate as argument.");
+
+        try {
+          return PyAstNode(PyTritonContext_AsTritonContext(self)->getImmediateAst(*PyImmediate_AsImmediate(imm)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getJitCacheSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getJitCacheSize());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getLoopSummaries(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& loops = PyTritonContext_AsTritonContext(self)->getLoopSummaries();
+          triton::usize index = 0;
+
+          ret = xPyList_New(loops.size());
+          for (const auto& loop : loops) {
+            PyObject* dict = xPyDict_New();
+            PyObject* inductions = xPyList_New(loop.inductions.size());
+            for (triton::usize i = 0; i < loop.inductions.size(); i++)
+              PyList_SetItem(inductions, i, PyLong_FromUint32(loop.inductions[i]));
+            xPyDict_SetItemString(dict, "address",     PyLong_FromUint64(loop.address));
+            xPyDict_SetItemString(dict, "target",      PyLong_FromUint64(loop.target));
+            xPyDict_SetItemString(dict, "iterations",  PyLong_FromUsize(loop.iterations));
+            xPyDict_SetItemString(dict, "constraints", PyLong_FromUsize(loop.constraints));
+            xPyDict_SetItemString(dict, "inductions",  inductions);
+            xPyDict_SetItemString(dict, "concretized", PyBool_FromLong(loop.concretized));
+            PyList_SetItem(ret, index++, dict);
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getLoopUnrollBound(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getLoopUnrollBound());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getMemoryAst(PyObject* self, PyObject* mem) {
+        if (!PyMemoryAccess_Check(mem))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getMemoryAst(): Expects an MemoryAccess as argument.");
+
+        try {
+          return PyAstNode(PyTritonContext_AsTritonContext(self)->getMemoryAst(*PyMemoryAccess_AsMemoryAccess(mem)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getMemoryTaintLabels(PyObject* self, PyObject* args) {
+        PyObject* mem  = nullptr;
+        PyObject* size = nullptr;
+        std::vector<triton::uint32> labels;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &mem, &size) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getMemoryTaintLabels(): Invalid number of arguments");
+        }
+
+        if (size != nullptr && (!PyLong_Check(size) && !PyInt_Check(size))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getMemoryTaintLabels(): Expects an integer as second argument.");
+        }
+
+        try {
+          if (mem != nullptr && PyMemoryAccess_Check(mem))
+            labels = PyTritonContext_AsTritonContext(self)->getMemoryTaintLabels(*PyMemoryAccess_AsMemoryAccess(mem));
+
+          else if (mem != nullptr && (PyLong_Check(mem) || PyInt_Check(mem)))
+            labels = PyTritonContext_AsTritonContext(self)->getMemoryTaintLabels(PyLong_AsUint64(mem), size != nullptr ? PyLong_AsUsize(size) : 1);
+
+          else
+            return PyErr_Format(PyExc_TypeError, "TritonContext::getMemoryTaintLabels(): Expects a MemoryAccess or an integer as argument.");
+
+          PyObject* ret = xPyList_New(labels.size());
+          triton::usize index = 0;
+          for (triton::uint32 label : labels)
+            PyList_SetItem(ret, index++, PyLong_FromUint32(label));
+          return ret;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_getMemoryUsage(PyObject* self, PyObject* noarg) {
+        try {
+          auto usage = PyTritonContext_AsTritonContext(self)->getMemoryUsage();
+          PyObject* ret = xPyDict_New();
+          PyObject* nodes = xPyDict_New();
+          PyObject* nodesBytes = xPyDict_New();
+
+          for (const auto& kv : usage.astNodes)
+            xPyDict_SetItem(nodes, PyLong_FromUint32(kv.first), PyLong_FromUsize(kv.second));
+
+          for (const auto& kv : usage.astNodesBytes)
+            xPyDict_SetItem(nodesBytes, PyLong_FromUint32(kv.first), PyLong_FromUsize(kv.second));
+
+          xPyDict_SetItemString(ret, "astNodes",                 nodes);
+          xPyDict_SetItemString(ret, "astNodesBytes",            nodesBytes);
+          xPyDict_SetItemString(ret, "astChildrenBytes",         PyLong_FromUsize(usage.astChildrenBytes));
+          xPyDict_SetItemString(ret, "astParentsBytes",          PyLong_FromUsize(usage.astParentsBytes));
+          xPyDict_SetItemString(ret, "symbolicExpressions",      PyLong_FromUsize(usage.symbolicExpressions));
+          xPyDict_SetItemString(ret, "symbolicExpressionsBytes", PyLong_FromUsize(usage.symbolicExpressionsBytes));
+          xPyDict_SetItemString(ret, "symbolicVariables",        PyLong_FromUsize(usage.symbolicVariables));
+          xPyDict_SetItemString(ret, "symbolicRegisters",        PyLong_FromUsize(usage.symbolicRegisters));
+          xPyDict_SetItemString(ret, "symbolicMemory",           PyLong_FromUsize(usage.symbolicMemory));
+          xPyDict_SetItemString(ret, "symbolicMemoryBytes",      PyLong_FromUsize(usage.symbolicMemoryBytes));
+          xPyDict_SetItemString(ret, "pathConstraints",          PyLong_FromUsize(usage.pathConstraints));
+          xPyDict_SetItemString(ret, "concreteMemoryPages",      PyLong_FromUsize(usage.concreteMemoryPages));
+          xPyDict_SetItemString(ret, "concreteMemoryBytes",      PyLong_FromUsize(usage.concreteMemoryBytes));
+          xPyDict_SetItemString(ret, "taintedMemory",            PyLong_FromUsize(usage.taintedMemory));
+          xPyDict_SetItemString(ret, "taintedMemoryBytes",       PyLong_FromUsize(usage.taintedMemoryBytes));
+          xPyDict_SetItemString(ret, "taintedRegisters",         PyLong_FromUsize(usage.taintedRegisters));
+          xPyDict_SetItemString(ret, "queryCache",               PyLong_FromUsize(usage.queryCache));
+          xPyDict_SetItemString(ret, "counterexampleCache",      PyLong_FromUsize(usage.counterexampleCache));
+          xPyDict_SetItemString(ret, "semanticsCache",           PyLong_FromUsize(usage.semanticsCache));
+          xPyDict_SetItemString(ret, "concreteMemo",             PyLong_FromUsize(usage.concreteMemo));
+          xPyDict_SetItemString(ret, "totalBytes",               PyLong_FromUsize(usage.totalBytes));
+
+          return ret;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getMergeDistance(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getMergeDistance());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getMergedPathConstraints(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          triton::uint32 index = 0;
+          const auto& pc = PyTritonContext_AsTritonContext(self)->getMergedPathConstraints();
+
+          ret = xPyList_New(pc.size());
+          for (auto it = pc.begin(); it != pc.end(); it++) {
+            PyList_SetItem(ret, index++, PyPathConstraint(*it));
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getModel(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::engines::solver::status_e status;
+        triton::uint32 solvingTime = 0;
+        triton::uint32 timeout_c = 0;
+
+        PyObject* dict    = nullptr;
+        PyObject* node    = nullptr;
+        PyObject* wb      = nullptr;
+        PyObject* timeout = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"status",
+          (char*)"timeout",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOO", keywords, &node, &wb, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModel(): Invalid keyword argument.");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModel(): Expects a AstNode as node argument.");
+        }
+
+        if (wb != nullptr && !PyBool_Check(wb)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModel(): Expects a boolean as status keyword.");
+        }
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModel(): Expects a integer as timeout keyword.");
+        }
+
+        if (timeout != nullptr) {
+          timeout_c = PyLong_AsUint32(timeout);
+        }
+
+        try {
+          triton::ast::SharedAbstractNode ast = PyAstNode_AsAstNode(node);
+          std::unordered_map<triton::usize, triton::engines::solver::SolverModel> model;
+          {
+            triton::bindings::python::PyAllowThreads allow;
+            model = PyTritonContext_AsTritonContext(self)->getModel(ast, &status, timeout_c, &solvingTime);
+          }
+          dict = triton::bindings::python::xPyDict_New();
+          for (auto it = model.begin(); it != model.end(); it++) {
+            xPyDict_SetItem(dict, PyLong_FromUsize(it->first), PySolverModel(it->second));
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        if (wb != nullptr && PyLong_AsBool(wb) == true) {
+          PyObject* tuple = triton::bindings::python::xPyTuple_New(3);
+          PyTuple_SetItem(tuple, 0, dict);
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
+          PyTuple_SetItem(tuple, 2, PyLong_FromUint32(solvingTime));
+          return tuple;
+        }
+
+        return dict;
+      }
+
+
+      static PyObject* TritonContext_getModelAsync(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::uint32 timeout_c = 0;
+
+        PyObject* node    = nullptr;
+        PyObject* timeout = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"timeout",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &node, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelAsync(): Invalid keyword argument.");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelAsync(): Expects a AstNode as node argument.");
+        }
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelAsync(): Expects a integer as timeout keyword.");
+        }
+
+        if (timeout != nullptr) {
+          timeout_c = PyLong_AsUint32(timeout);
+        }
+
+        try {
+          return PySolverFuture(PyTritonContext_AsTritonContext(self)->getModelAsync(PyAstNode_AsAstNode(node), timeout_c));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getModelOfPath(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::engines::solver::status_e status;
+        triton::uint32 solvingTime = 0;
+        triton::uint32 timeout_c = 0;
+
+        PyObject* dict    = nullptr;
+        PyObject* index   = nullptr;
+        PyObject* node    = nullptr;
+        PyObject* wb      = nullptr;
+        PyObject* timeout = nullptr;
+
+        static char* keywords[] = {
+          (char*)"index",
+          (char*)"node",
+          (char*)"status",
+          (char*)"timeout",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOO", keywords, &index, &node, &wb, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelOfPath(): Invalid keyword argument.");
+        }
+
+        if (index == nullptr || (!PyLong_Check(index) && !PyInt_Check(index))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelOfPath(): Expects an integer as index argument.");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelOfPath(): Expects a AstNode as node argument.");
+        }
+
+        if (wb != nullptr && !PyBool_Check(wb)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelOfPath(): Expects a boolean as status keyword.");
+        }
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelOfPath(): Expects a integer as timeout keyword.");
+        }
+
+        if (timeout != nullptr) {
+          timeout_c = PyLong_AsUint32(timeout);
+        }
+
+        try {
+          dict = triton::bindings::python::xPyDict_New();
+          auto model = PyTritonContext_AsTritonContext(self)->getModelOfPath(PyLong_AsUsize(index), PyAstNode_AsAstNode(node), &status, timeout_c, &solvingTime);
+          for (auto it = model.begin(); it != model.end(); it++) {
+            xPyDict_SetItem(dict, PyLong_FromUsize(it->first), PySolverModel(it->second));
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        if (wb != nullptr && PyLong_AsBool(wb) == true) {
+          PyObject* tuple = triton::bindings::python::xPyTuple_New(3);
+          PyTuple_SetItem(tuple, 0, dict);
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
+          PyTuple_SetItem(tuple, 2, PyLong_FromUint32(solvingTime));
+          return tuple;
+        }
+
+        return dict;
+      }
+
+
+      static PyObject* TritonContext_getModels(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::engines::solver::status_e status;
+        triton::uint32 solvingTime = 0;
+        triton::uint32 timeout_c = 0;
+
+        PyObject* ret     = nullptr;
+        PyObject* node    = nullptr;
+        PyObject* limit   = nullptr;
+        PyObject* wb      = nullptr;
+        PyObject* timeout = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"limit",
+          (char*)"status",
+          (char*)"timeout",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOO", keywords, &node, &limit, &wb, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Invalid keyword argument.");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects a AstNode as node argument.");
+        }
+
+        if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects an integer as limit argument.");
+        }
+
+        if (wb != nullptr && !PyBool_Check(wb)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects a boolean as status keyword.");
+        }
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects a integer as timeout keyword.");
+        }
+
+        if (timeout != nullptr) {
+          timeout_c = PyLong_AsUint32(timeout);
+        }
+
+        try {
+          triton::ast::SharedAbstractNode ast = PyAstNode_AsAstNode(node);
+          triton::uint32 limit_c = PyLong_AsUint32(limit);
+          std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> models;
+          {
+            triton::bindings::python::PyAllowThreads allow;
+            models = PyTritonContext_AsTritonContext(self)->getModels(ast, limit_c, &status, timeout_c, &solvingTime);
+          }
+          triton::uint32 index = 0;
+
+          ret = xPyList_New(models.size());
+          for (auto it = models.begin(); it != models.end(); it++) {
+            PyObject* mdict = xPyDict_New();
+            auto model = *it;
+
+            for (auto it2 = model.begin(); it2 != model.end(); it2++) {
+              xPyDict_SetItem(mdict, PyLong_FromUsize(it2->first), PySolverModel(it2->second));
+            }
+            if (model.size() > 0)
+              PyList_SetItem(ret, index++, mdict);
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        if (wb != nullptr && PyLong_AsBool(wb) == true) {
+          PyObject* tuple = triton::bindings::python::xPyTuple_New(3);
+          PyTuple_SetItem(tuple, 0, ret);
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
+          PyTuple_SetItem(tuple, 2, PyLong_FromUint32(solvingTime));
+          return tuple;
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getModelsToReachAddresses(PyObject* self, PyObject* args) {
+        PyObject* addrs   = nullptr;
+        PyObject* ret     = nullptr;
+        PyObject* threads = nullptr;
+        PyObject* timeout = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &addrs, &threads, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelsToReachAddresses(): Invalid number of arguments");
+        }
+
+        if (addrs == nullptr || !PyList_Check(addrs))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelsToReachAddresses(): Expects a list of addresses as first argument.");
+
+        std::vector<triton::uint64> addrs_c;
+        for (Py_ssize_t i = 0; i < PyList_Size(addrs); i++) {
+          PyObject* item = PyList_GetItem(addrs, i);
+          if (!PyLong_Check(item) && !PyInt_Check(item))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::getModelsToReachAddresses(): Expects a list of addresses as first argument.");
+          addrs_c.push_back(PyLong_AsUint64(item));
+        }
+
+        if (threads != nullptr && (!PyLong_Check(threads) && !PyInt_Check(threads)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelsToReachAddresses(): Expects an integer as second argument.");
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelsToReachAddresses(): Expects an integer as third argument.");
+
+        try {
+          std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> models;
+          {
+            triton::bindings::python::PyAllowThreads allow;
+            models = PyTritonContext_AsTritonContext(self)->getModelsToReachAddresses(addrs_c, threads ? PyLong_AsUsize(threads) : 0, timeout ? PyLong_AsUint32(timeout) : 0);
+          }
+
+          ret = xPyList_New(models.size());
+          for (triton::usize i = 0; i < models.size(); i++) {
+            PyObject* dict = xPyDict_New();
+            for (auto it = models[i].begin(); it != models[i].end(); it++)
+              xPyDict_SetItem(dict, PyLong_FromUsize(it->first), PySolverModel(it->second));
+            PyList_SetItem(ret, i, dict);
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+      static PyObject* TritonContext_getParentRegisters(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          triton::uint32 index = 0;
+          auto regs = PyTritonContext_AsTritonContext(self)->getParentRegisters();
+
+          ret = xPyList_New(regs.size());
+          for (const auto* reg: regs) {
+            PyList_SetItem(ret, index++, PyRegister(*reg));
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getPathConstraintThreads(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          triton::uint32 index = 0;
+          auto tids = PyTritonContext_AsTritonContext(self)->getPathConstraintThreads();
+
+          ret = xPyList_New(tids.size());
+          for (auto it = tids.begin(); it != tids.end(); it++) {
+            PyList_SetItem(ret, index++, PyLong_FromUint32(*it));
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
       static PyObject* TritonContext_getPathConstraints(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
 
         try {
-          triton::uint32 index = 0;
-          const auto& pc = PyTritonContext_AsTritonContext(self)->getPathConstraints();
+          triton::uint32 index = 0;
+          const auto& pc = PyTritonContext_AsTritonContext(self)->getPathConstraints();
+
+          ret = xPyList_New(pc.size());
+          for (auto it = pc.begin(); it != pc.end(); it++) {
+            PyList_SetItem(ret, index++, PyPathConstraint(*it));
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getPathConstraintsOfThread(PyObject* self, PyObject* threadId) {
+        PyObject* ret = nullptr;
+
+        if (threadId == nullptr || (!PyLong_Check(threadId) && !PyInt_Check(threadId)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getPathConstraintsOfThread(): Expects an integer as argument.");
+
+        try {
+          triton::uint32 index = 0;
+          auto pc = PyTritonContext_AsTritonContext(self)->getPathConstraintsOfThread(PyLong_AsUint32(threadId));
+
+          ret = xPyList_New(pc.size());
+          for (auto it = pc.begin(); it != pc.end(); it++) {
+            PyList_SetItem(ret, index++, PyPathConstraint(*it));
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+      static PyObject* TritonContext_getPathConstraintsWindow(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getPathConstraintsWindow());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_getPathPredicate(PyObject* self, PyObject* noarg) {
+        try {
+          return PyAstNode(PyTritonContext_AsTritonContext(self)->getPathPredicate());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getPathPredicateOfThread(PyObject* self, PyObject* threadId) {
+        if (threadId == nullptr || (!PyLong_Check(threadId) && !PyInt_Check(threadId)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getPathPredicateOfThread(): Expects an integer as argument.");
+
+        try {
+          return PyAstNode(PyTritonContext_AsTritonContext(self)->getPathPredicateOfThread(PyLong_AsUint32(threadId)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_getPathPredicateSize(PyObject* self, PyObject* noarg) {
+        try {
+          const auto& pc = PyTritonContext_AsTritonContext(self)->getPathConstraints();
+          return PyLong_FromUsize(pc.size());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getPointerResolutionBound(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getPointerResolutionBound());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getPredicatesToReachAddress(PyObject* self, PyObject* addr) {
+        PyObject* ret = nullptr;
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getPredicatesToReachAddress(): Expects an address as argument.");
+
+        try {
+          triton::uint32 index = 0;
+          auto preds = PyTritonContext_AsTritonContext(self)->getPredicatesToReachAddress(PyLong_AsUint64(addr));
+
+          ret = xPyList_New(preds.size());
+          for (auto it = preds.begin(); it != preds.end(); it++) {
+            PyList_SetItem(ret, index++, PyAstNode(*it));
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getPredicatesToReachAddresses(PyObject* self, PyObject* addrs) {
+        PyObject* ret = nullptr;
+
+        if (addrs == nullptr || !PyList_Check(addrs))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getPredicatesToReachAddresses(): Expects a list of addresses as first argument.");
+
+        std::vector<triton::uint64> addrs_c;
+        for (Py_ssize_t i = 0; i < PyList_Size(addrs); i++) {
+          PyObject* item = PyList_GetItem(addrs, i);
+          if (!PyLong_Check(item) && !PyInt_Check(item))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::getPredicatesToReachAddresses(): Expects a list of addresses as first argument.");
+          addrs_c.push_back(PyLong_AsUint64(item));
+        }
+
+        try {
+          auto preds = PyTritonContext_AsTritonContext(self)->getPredicatesToReachAddresses(addrs_c);
+
+          ret = xPyList_New(preds.size());
+          for (triton::usize i = 0; i < preds.size(); i++) {
+            PyObject* list = xPyList_New(preds[i].size());
+            for (triton::usize j = 0; j < preds[i].size(); j++)
+              PyList_SetItem(list, j, PyAstNode(preds[i][j]));
+            PyList_SetItem(ret, i, list);
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+      static PyObject* TritonContext_getPresolverHits(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getPresolverHits());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getProfile(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          ret = xPyDict_New();
+          for (const auto& entry : PyTritonContext_AsTritonContext(self)->getProfile()) {
+            PyObject* dict = xPyDict_New();
+            xPyDict_SetItemString(dict, "count",       PyLong_FromUint64(entry.second.count));
+            xPyDict_SetItemString(dict, "time",        PyLong_FromUint64(entry.second.time));
+            xPyDict_SetItemString(dict, "nodes",       PyLong_FromUint64(entry.second.nodes));
+            xPyDict_SetItemString(dict, "expressions", PyLong_FromUint64(entry.second.expressions));
+            xPyDict_SetItem(ret, PyLong_FromUint32(entry.first), dict);
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getProgramExitStatus(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint64(PyTritonContext_AsTritonContext(self)->getProgramExitStatus());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getQueryCacheHits(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getQueryCacheHits());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getQueryCacheMisses(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getQueryCacheMisses());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getQueryCacheSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getQueryCacheSize());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getQueryConfiguration(PyObject* self, PyObject* query) {
+        if (!PyLong_Check(query) && !PyInt_Check(query))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getQueryConfiguration(): Expects a QUERY as argument.");
+
+        try {
+          const auto& config = PyTritonContext_AsTritonContext(self)->getQueryConfiguration(static_cast<triton::engines::solver::query_e>(PyLong_AsUint32(query)));
+          PyObject* ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "logic",        xPyString_FromString(config.logic.c_str()));
+          xPyDict_SetItemString(ret, "rewriteLevel", PyLong_FromLong(config.rewriteLevel));
+          xPyDict_SetItemString(ret, "satSolver",    xPyString_FromString(config.satSolver.c_str()));
+          xPyDict_SetItemString(ret, "tactics",      xPyString_FromString(config.tactics.c_str()));
+          return ret;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_getRegister(PyObject* self, PyObject* regIn) {
+        try {
+          if (regIn != nullptr && (PyLong_Check(regIn) || PyInt_Check(regIn))) {
+            triton::arch::register_e rid = static_cast<triton::arch::register_e>(PyLong_AsUint32(regIn));
+            triton::arch::Register regOut(PyTritonContext_AsTritonContext(self)->getRegister(rid));
+            return PyRegister(regOut);
+          }
+
+          else if (regIn != nullptr && (PyStr_Check(regIn))) {
+            std::string name = std::string(PyStr_AsString(regIn));
+            triton::arch::Register regOut(PyTritonContext_AsTritonContext(self)->getRegister(name));
+            return PyRegister(regOut);
+          }
+
+          else {
+            return PyErr_Format(PyExc_TypeError, "TritonContext::getRegister(): Expects an integer or a string as argument.");
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getRegisterAst(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getRegisterAst(): Expects an Register as argument.");
+
+        try {
+          return PyAstNode(PyTritonContext_AsTritonContext(self)->getRegisterAst(*PyRegister_AsRegister(reg)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getRegisterTaintLabels(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getRegisterTaintLabels(): Expects a Register as argument.");
+
+        try {
+          std::vector<triton::uint32> labels = PyTritonContext_AsTritonContext(self)->getRegisterTaintLabels(*PyRegister_AsRegister(reg));
+          PyObject* ret = xPyList_New(labels.size());
+          triton::usize index = 0;
+          for (triton::uint32 label : labels)
+            PyList_SetItem(ret, index++, PyLong_FromUint32(label));
+          return ret;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_getSemanticsCacheSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSemanticsCacheSize());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSimplificationMemoHits(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSimplificationMemoHits());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_getSimplificationMemoSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSimplificationMemoSize());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_getSolver(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getSolver());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSolverStatistics(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          auto stats = PyTritonContext_AsTritonContext(self)->getSolverStatistics();
+
+          PyObject* statuses = xPyDict_New();
+          for (triton::usize status = 0; status < stats.statuses.size(); status++)
+            xPyDict_SetItem(statuses, PyLong_FromUsize(status), PyLong_FromUsize(stats.statuses[status]));
+
+          PyObject* histogram = xPyList_New(stats.histogram.size());
+          for (triton::usize bucket = 0; bucket < stats.histogram.size(); bucket++)
+            PyList_SetItem(histogram, bucket, PyLong_FromUsize(stats.histogram[bucket]));
+
+          ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "checkTime",           PyLong_FromUint64(stats.checkTime));
+          xPyDict_SetItemString(ret, "counterexampleHits",  PyLong_FromUsize(stats.counterexampleHits));
+          xPyDict_SetItemString(ret, "histogram",           histogram);
+          xPyDict_SetItemString(ret, "maxNodes",            PyLong_FromUsize(stats.maxNodes));
+          xPyDict_SetItemString(ret, "maxQueryTime",        PyLong_FromUint64(stats.maxQueryTime));
+          xPyDict_SetItemString(ret, "nodes",               PyLong_FromUsize(stats.nodes));
+          xPyDict_SetItemString(ret, "presolverHits",       PyLong_FromUsize(stats.presolverHits));
+          xPyDict_SetItemString(ret, "queries",             PyLong_FromUsize(stats.queries));
+          xPyDict_SetItemString(ret, "queryCacheHits",      PyLong_FromUsize(stats.queryCacheHits));
+          xPyDict_SetItemString(ret, "queryCacheMisses",    PyLong_FromUsize(stats.queryCacheMisses));
+          xPyDict_SetItemString(ret, "queryTime",           PyLong_FromUint64(stats.queryTime));
+          xPyDict_SetItemString(ret, "statuses",            statuses);
+          xPyDict_SetItemString(ret, "translationTime",     PyLong_FromUint64(stats.translationTime));
+          xPyDict_SetItemString(ret, "variables",           PyLong_FromUsize(stats.variables));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          Py_XDECREF(ret);
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+      static PyObject* TritonContext_getSymbolicExpression(PyObject* self, PyObject* symExprId) {
+        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicExpression(): Expects an integer as argument.");
+
+        try {
+          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicExpression(PyLong_AsUsize(symExprId)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSymbolicExpressions(PyObject* self, PyObject* args) {
+        PyObject* ret  = nullptr;
+        PyObject* type = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|O", &type) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicExpressions(): Invalid number of arguments");
+        }
+
+        if (type != nullptr && (!PyLong_Check(type) && !PyInt_Check(type)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicExpressions(): Expects a SYMBOLIC expression type or nothing as argument.");
+
+        try {
+          std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> expressions;
+          if (type == nullptr)
+            expressions = PyTritonContext_AsTritonContext(self)->getSymbolicExpressions();
+          else
+            expressions = PyTritonContext_AsTritonContext(self)->getSymbolicExpressions(static_cast<triton::engines::symbolic::expression_e>(PyLong_AsUint32(type)));
+
+          ret = xPyDict_New();
+          for (auto it = expressions.begin(); it != expressions.end(); it++)
+            xPyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicExpression(it->second));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSymbolicExpressionsAt(PyObject* self, PyObject* addr) {
+        PyObject* ret = nullptr;
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicExpressionsAt(): Expects an integer as argument.");
+
+        try {
+          auto expressions = PyTritonContext_AsTritonContext(self)->getSymbolicExpressionsAt(PyLong_AsUint64(addr));
+
+          ret = xPyList_New(expressions.size());
+          triton::uint32 index = 0;
+          for (auto&& expr : expressions)
+            PyList_SetItem(ret, index++, PySymbolicExpression(expr));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSymbolicMemory(PyObject* self, PyObject* args) {
+        PyObject* ret  = nullptr;
+        PyObject* addr = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|O", &addr) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicMemory(): Invalid number of arguments");
+        }
+
+        try {
+          if (addr == nullptr) {
+            auto regs = PyTritonContext_AsTritonContext(self)->getSymbolicMemory();
+
+            ret = xPyDict_New();
+            for (auto it = regs.begin(); it != regs.end(); it++) {
+              xPyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
+            }
+          }
+          else if (addr != nullptr && (PyLong_Check(addr) || PyInt_Check(addr))) {
+            ret = PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicMemory(PyLong_AsUint64(addr)));
+          }
+          else
+            return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicMemory(): Expects an integer or nothing as argument.");
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSymbolicMemoryValue(PyObject* self, PyObject* mem) {
+        if (!PyLong_Check(mem) && !PyInt_Check(mem) && !PyMemoryAccess_Check(mem))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicMemoryValue(): Expects an integer or a MemoryAccess as argument.");
+
+        try {
+          if (PyLong_Check(mem) || PyInt_Check(mem))
+            return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicMemoryValue(PyLong_AsUint64(mem)));
+          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicMemoryValue(*PyMemoryAccess_AsMemoryAccess(mem)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSymbolicRegisters(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          auto regs = PyTritonContext_AsTritonContext(self)->getSymbolicRegisters();
+
+          ret = xPyDict_New();
+          for (auto it = regs.begin(); it != regs.end(); it++) {
+            xPyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSymbolicRegister(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicRegister(): Expects a Register as argument.");
+
+        try {
+          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicRegister(*PyRegister_AsRegister(reg)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSymbolicRegisterValue(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicRegisterValue(): Expects a Register as argument.");
+
+        try {
+          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicRegisterValue(*PyRegister_AsRegister(reg)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSymbolicVariable(PyObject* self, PyObject* arg) {
+        try {
+          if (PyLong_Check(arg) || PyInt_Check(arg))
+            return PySymbolicVariable(PyTritonContext_AsTritonContext(self)->getSymbolicVariable(PyLong_AsUsize(arg)));
+
+          else if (PyStr_Check(arg))
+            return PySymbolicVariable(PyTritonContext_AsTritonContext(self)->getSymbolicVariable(PyStr_AsString(arg)));
+
+          else
+            return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicVariable(): Expects an integer or a string as argument.");
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSymbolicVariables(PyObject* self, PyObject* args) {
+        PyObject* ret    = nullptr;
+        PyObject* type   = nullptr;
+        PyObject* origin = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &type, &origin) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicVariables(): Invalid number of arguments");
+        }
+
+        if (type != nullptr && (!PyLong_Check(type) && !PyInt_Check(type)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicVariables(): Expects a SYMBOLIC variable type as first argument.");
+
+        if (origin != nullptr && (!PyLong_Check(origin) && !PyInt_Check(origin)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicVariables(): Expects an integer as second argument.");
+
+        try {
+          std::map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> variables;
+          if (type == nullptr)
+            variables = PyTritonContext_AsTritonContext(self)->getSymbolicVariables();
+          else if (origin == nullptr)
+            variables = PyTritonContext_AsTritonContext(self)->getSymbolicVariables(static_cast<triton::engines::symbolic::variable_e>(PyLong_AsUint32(type)));
+          else
+            variables = PyTritonContext_AsTritonContext(self)->getSymbolicVariables(static_cast<triton::engines::symbolic::variable_e>(PyLong_AsUint32(type)), PyLong_AsUint64(origin));
+
+          ret = xPyDict_New();
+          for (auto sv: variables)
+            xPyDict_SetItem(ret, PyLong_FromUsize(sv.first), PySymbolicVariable(sv.second));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSynthesisCacheHits(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSynthesisCacheHits());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSynthesisCacheSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSynthesisCacheSize());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSynthesisDatabasesSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSynthesisDatabasesSize());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getTaintedMemory(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+        triton::usize size = 0, index = 0;
+
+        try {
+          const auto& addresses = PyTritonContext_AsTritonContext(self)->getTaintedMemory();
+
+          size = addresses.size();
+          ret = xPyList_New(size);
+          for (auto it = addresses.begin(); it != addresses.end(); it++) {
+            PyList_SetItem(ret, index, PyLong_FromUint64(*it));
+            index++;
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getTaintedRanges(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          auto ranges = PyTritonContext_AsTritonContext(self)->getTaintedRanges();
+          triton::usize index = 0;
+
+          ret = xPyList_New(ranges.size());
+          for (const auto& range : ranges) {
+            PyObject* item = xPyTuple_New(2);
+            PyTuple_SetItem(item, 0, PyLong_FromUint64(range.first));
+            PyTuple_SetItem(item, 1, PyLong_FromUsize(range.second));
+            PyList_SetItem(ret, index++, item);
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+      static PyObject* TritonContext_getTaintedRegisters(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+        triton::usize size = 0, index = 0;
+
+        try {
+          std::unordered_set<const triton::arch::Register*> registers = PyTritonContext_AsTritonContext(self)->getTaintedRegisters();
+
+          size = registers.size();
+          ret = xPyList_New(size);
+          for (const auto* reg: registers) {
+            PyList_SetItem(ret, index, PyRegister(*reg));
+            index++;
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getTaintedSymbolicExpressions(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+        triton::usize size = 0, index = 0;
+
+        try {
+          auto expressions = PyTritonContext_AsTritonContext(self)->getTaintedSymbolicExpressions();
+
+          size = expressions.size();
+          ret = xPyList_New(size);
+          for (auto it = expressions.begin(); it != expressions.end(); it++) {
+            PyList_SetItem(ret, index, PySymbolicExpression(*it));
+            index++;
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getTimeoutRoundRemaining(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint64(PyTritonContext_AsTritonContext(self)->getTimeoutRoundRemaining());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getUndoJournalSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getUndoJournalSize());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_getUnsatCoreCacheHits(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getUnsatCoreCacheHits());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_getUnsatCoreCacheSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getUnsatCoreCacheSize());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_getVirtualFile(PyObject* self, PyObject* path) {
+        if (!PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getVirtualFile(): Expects a string as argument.");
+
+        try {
+          const auto& data = PyTritonContext_AsTritonContext(self)->getVirtualFile(PyStr_AsString(path));
+          return PyBytes_FromStringAndSize(reinterpret_cast<const char*>(data.data()), data.size());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_hasProgramExited(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->hasProgramExited() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isAdaptiveTimeoutEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isAdaptiveTimeoutEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isAnyTainted(PyObject* self, PyObject* args) {
+        PyObject* addr = nullptr;
+        PyObject* size = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &addr, &size) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isAnyTainted(): Invalid number of arguments");
+        }
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isAnyTainted(): Expects an integer as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isAnyTainted(): Expects an integer as second argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isAnyTainted(PyLong_AsUint64(addr), PyLong_AsUsize(size)) == true)
+            Py_RETURN_TRUE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+        Py_RETURN_FALSE;
+      }
+
+      static PyObject* TritonContext_isArchitectureValid(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isArchitectureValid() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isBitBlastingEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isBitBlastingEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isConcreteMemoEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isConcreteMemoEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_isConcreteMemoryValueDefined(PyObject* self, PyObject* args) {
+        PyObject* baseAddr        = nullptr;
+        PyObject* size            = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &baseAddr, &size) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isConcreteMemoryValueDefined(): Invalid number of arguments");
+        }
+
+        try {
+          if (baseAddr && PyMemoryAccess_Check(baseAddr)) {
+            if (PyTritonContext_AsTritonContext(self)->isConcreteMemoryValueDefined(*PyMemoryAccess_AsMemoryAccess(baseAddr)) == true)
+              Py_RETURN_TRUE;
+            Py_RETURN_FALSE;
+          }
+          else if (baseAddr && (PyLong_Check(baseAddr) || PyInt_Check(baseAddr))) {
+            if (size && (PyLong_Check(size) || PyInt_Check(size))) {
+              if (PyTritonContext_AsTritonContext(self)->isConcreteMemoryValueDefined(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size)) == true)
+                Py_RETURN_TRUE;
+              Py_RETURN_FALSE;
+            }
+            else {
+              return PyErr_Format(PyExc_TypeError, "TritonContext::isConcreteMemoryValueDefined(): Expects a size (integer) as second argument.");
+            }
+          }
+          else {
+            return PyErr_Format(PyExc_TypeError, "TritonContext::isConcreteMemoryValueDefined(): Expects a base address (integer) as arguments or a memory cells.");
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isConstraintIndependenceEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isConstraintIndependenceEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_isCounterexampleCacheEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isCounterexampleCacheEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_isDecodeCacheEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isDecodeCacheEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_isFlag(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isFlag(): Expects a Register as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isFlag(*PyRegister_AsRegister(reg)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isHeatMapEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isHeatMapEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isIncrementalSolvingEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isIncrementalSolvingEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isMemorySymbolized(PyObject* self, PyObject* mem) {
+        try {
+          if (PyMemoryAccess_Check(mem)) {
+            if (PyTritonContext_AsTritonContext(self)->isMemorySymbolized(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
+              Py_RETURN_TRUE;
+          }
+
+          else if (PyLong_Check(mem) || PyInt_Check(mem)) {
+            if (PyTritonContext_AsTritonContext(self)->isMemorySymbolized(PyLong_AsUint64(mem)) == true)
+              Py_RETURN_TRUE;
+          }
+
+          else
+            return PyErr_Format(PyExc_TypeError, "TritonContext::isMemorySymbolized(): Expects a MemoryAccess or an integer as argument.");
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* TritonContext_isMemoryTainted(PyObject* self, PyObject* args) {
+        PyObject* mem  = nullptr;
+        PyObject* size = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &mem, &size) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isMemoryTainted(): Invalid number of arguments");
+        }
+
+        if (size != nullptr && (!PyLong_Check(size) && !PyInt_Check(size))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isMemoryTainted(): Expects an integer as second argument.");
+        }
+
+        try {
+          if (mem != nullptr && PyMemoryAccess_Check(mem)) {
+            if (PyTritonContext_AsTritonContext(self)->isMemoryTainted(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
+              Py_RETURN_TRUE;
+          }
+
+          else if (mem != nullptr && (PyLong_Check(mem) || PyInt_Check(mem))) {
+            if (PyTritonContext_AsTritonContext(self)->isMemoryTainted(PyLong_AsUint64(mem), size != nullptr ? PyLong_AsUsize(size) : 1) == true)
+              Py_RETURN_TRUE;
+          }
+
+          else
+            return PyErr_Format(PyExc_TypeError, "TritonContext::isMemoryTainted(): Expects a MemoryAccess or an integer as argument.");
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* TritonContext_isOpaquePredicate(PyObject* self, PyObject* args) {
+        PyObject* node    = nullptr;
+        PyObject* samples = nullptr;
+        PyObject* timeout = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &node, &samples, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isOpaquePredicate(): Invalid number of arguments");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isOpaquePredicate(): Expects a AstNode as first argument.");
+
+        if (samples != nullptr && (!PyLong_Check(samples) && !PyInt_Check(samples)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isOpaquePredicate(): Expects an integer as second argument.");
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isOpaquePredicate(): Expects an integer as third argument.");
+
+        try {
+          triton::ast::SharedAbstractNode ast = PyAstNode_AsAstNode(node);
+          triton::usize samples_c = samples ? PyLong_AsUsize(samples) : 4096;
+          triton::uint32 timeout_c = timeout ? PyLong_AsUint32(timeout) : 0;
+          bool opaque = false;
+          {
+            triton::bindings::python::PyAllowThreads allow;
+            opaque = PyTritonContext_AsTritonContext(self)->isOpaquePredicate(ast, nullptr, samples_c, timeout_c);
+          }
+          if (opaque == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_isPresolverEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isPresolverEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isProfilingEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isProfilingEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isQueryCacheEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isQueryCacheEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isQueryClassificationEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isQueryClassificationEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_isRegister(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isRegister(): Expects a Register as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isRegister(*PyRegister_AsRegister(reg)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isRegisterSymbolized(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isRegisterSymbolized(): Expects a Register as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isRegisterSymbolized(*PyRegister_AsRegister(reg)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isRegisterTainted(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isRegisterTainted(): Expects a Register as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isRegisterTainted(*PyRegister_AsRegister(reg)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isRegisterValid(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isRegisterValid(): Expects a Register as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isRegisterValid(*PyRegister_AsRegister(reg)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSat(PyObject* self, PyObject* node) {
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isSat(): Expects a AstNode as argument.");
+
+        try {
+          triton::ast::SharedAbstractNode ast = PyAstNode_AsAstNode(node);
+          bool sat = false;
+          {
+            triton::bindings::python::PyAllowThreads allow;
+            sat = PyTritonContext_AsTritonContext(self)->isSat(ast);
+          }
+          if (sat == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSatAsync(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::uint32 timeout_c = 0;
+
+        PyObject* node    = nullptr;
+        PyObject* timeout = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"timeout",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &node, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isSatAsync(): Invalid keyword argument.");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isSatAsync(): Expects a AstNode as node argument.");
+        }
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isSatAsync(): Expects a integer as timeout keyword.");
+        }
+
+        if (timeout != nullptr) {
+          timeout_c = PyLong_AsUint32(timeout);
+        }
+
+        try {
+          return PySolverFuture(PyTritonContext_AsTritonContext(self)->isSatAsync(PyAstNode_AsAstNode(node), timeout_c));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSatOfPath(PyObject* self, PyObject* args) {
+        PyObject* index = nullptr;
+        PyObject* node  = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &index, &node) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isSatOfPath(): Invalid number of arguments");
+        }
+
+        if (index == nullptr || (!PyLong_Check(index) && !PyInt_Check(index)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isSatOfPath(): Expects an integer as first argument.");
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isSatOfPath(): Expects a AstNode as second argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSatOfPath(PyLong_AsUsize(index), PyAstNode_AsAstNode(node)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSemanticsCacheEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSemanticsCacheEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSharedQueryCacheOpen(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSharedQueryCacheOpen() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSmtStreamEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSmtStreamEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSnapshotExists(PyObject* self, PyObject* id) {
+        if (!PyInt_Check(id) && !PyLong_Check(id))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isSnapshotExists(): Expects an integer as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSnapshotExists(PyLong_AsUsize(id)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSolverStatisticsEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSolverStatisticsEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_isSymbolicExpressionExists(PyObject* self, PyObject* symExprId) {
+        if (!PyInt_Check(symExprId) && !PyLong_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isSymbolicExpressionExists(): Expects an integer as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSymbolicExpressionExists(PyLong_AsUsize(symExprId)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isModeEnabled(PyObject* self, PyObject* mode) {
+        if (!PyInt_Check(mode) && !PyLong_Check(mode))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isModeEnabled(): Expects a MODE as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isModeEnabled(static_cast<triton::modes::mode_e>(PyLong_AsUint32(mode))) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSynthesisCacheEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSynthesisCacheEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSyscallEmulationEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSyscallEmulationEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isThumb(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isThumb() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isTracingEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isTracingEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
 
-          ret = xPyList_New(pc.size());
-          for (auto it = pc.begin(); it != pc.end(); it++) {
-            PyList_SetItem(ret, index++, PyPathConstraint(*it));
-          }
+      static PyObject* TritonContext_isUndoJournalEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isUndoJournalEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1612,14 +6397,32 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+      }
 
-        return ret;
+      static PyObject* TritonContext_isUnsatCoreCacheEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isUnsatCoreCacheEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
       }
 
+      static PyObject* TritonContext_iterSymbolicExpressions(PyObject* self, PyObject* noarg) {
+        std::vector<triton::uint64> keys;
 
-      static PyObject* TritonContext_getPathPredicate(PyObject* self, PyObject* noarg) {
         try {
-          return PyAstNode(PyTritonContext_AsTritonContext(self)->getPathPredicate());
+          /* Only the keys are copied, the entries are wrapped by the iterator */
+          PyTritonContext_AsTritonContext(self)->forEachSymbolicExpression([&keys](const triton::engines::symbolic::SharedSymbolicExpression& expr) {
+            keys.push_back(expr->getId());
+            return true;
+          });
+          return PySymbolicIterator(self, SYMBOLIC_ITERATOR_EXPRESSIONS, std::move(keys));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1630,10 +6433,16 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getPathPredicateSize(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_iterSymbolicMemory(PyObject* self, PyObject* noarg) {
+        std::vector<triton::uint64> keys;
+
         try {
-          const auto& pc = PyTritonContext_AsTritonContext(self)->getPathConstraints();
-          return PyLong_FromUsize(pc.size());
+          /* Only the keys are copied, the entries are wrapped by the iterator */
+          PyTritonContext_AsTritonContext(self)->forEachSymbolicMemory([&keys](triton::uint64 addr, const triton::engines::symbolic::SharedSymbolicExpression&) {
+            keys.push_back(addr);
+            return true;
+          });
+          return PySymbolicIterator(self, SYMBOLIC_ITERATOR_MEMORY, std::move(keys));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1644,20 +6453,128 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getPredicatesToReachAddress(PyObject* self, PyObject* addr) {
-        PyObject* ret = nullptr;
+      static PyObject* TritonContext_iterSymbolicRegisters(PyObject* self, PyObject* noarg) {
+        std::vector<triton::uint64> keys;
 
-        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getPredicatesToReachAddress(): Expects an address as argument.");
+        try {
+          /* Only the keys are copied, the entries are wrapped by the iterator */
+          PyTritonContext_AsTritonContext(self)->forEachSymbolicRegister([&keys](triton::arch::register_e id, const triton::engines::symbolic::SharedSymbolicExpression&) {
+            keys.push_back(id);
+            return true;
+          });
+          return PySymbolicIterator(self, SYMBOLIC_ITERATOR_REGISTERS, std::move(keys));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_iterSymbolicVariables(PyObject* self, PyObject* noarg) {
+        std::vector<triton::uint64> keys;
 
         try {
-          triton::uint32 index = 0;
-          auto preds = PyTritonContext_AsTritonContext(self)->getPredicatesToReachAddress(PyLong_AsUint64(addr));
+          /* Only the keys are copied, the entries are wrapped by the iterator */
+          PyTritonContext_AsTritonContext(self)->forEachSymbolicVariable([&keys](const triton::engines::symbolic::SharedSymbolicVariable& var) {
+            keys.push_back(var->getId());
+            return true;
+          });
+          return PySymbolicIterator(self, SYMBOLIC_ITERATOR_VARIABLES, std::move(keys));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
 
-          ret = xPyList_New(preds.size());
-          for (auto it = preds.begin(); it != preds.end(); it++) {
-            PyList_SetItem(ret, index++, PyAstNode(*it));
+
+      static PyObject* TritonContext_liftToBTOR2(PyObject* self, PyObject* node) {
+        if (!PyAstNode_Check(node) && !PySymbolicExpression_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToBTOR2(): Expects an AstNode or a SymbolicExpression as first argument.");
+
+        try {
+          std::ostringstream stream;
+
+          if (PyAstNode_Check(node))
+            PyTritonContext_AsTritonContext(self)->liftToBTOR2(stream, PyAstNode_AsAstNode(node));
+          else
+            PyTritonContext_AsTritonContext(self)->liftToBTOR2(stream, PySymbolicExpression_AsSymbolicExpression(node));
+
+          return xPyString_FromString(stream.str().c_str());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_liftToC(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* node      = nullptr;
+        PyObject* fname     = nullptr;
+        PyObject* icomment  = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"fname",
+          (char*)"icomment",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOO", keywords, &node, &fname, &icomment) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToC(): Invalid number of arguments");
+        }
+
+        if (node == nullptr || (!PySymbolicExpression_Check(node) && !PyAstNode_Check(node) && !PyList_Check(node) && !PyBasicBlock_Check(node)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToC(): Expects a SymbolicExpression, a AstNode, a list of them or a BasicBlock as node argument.");
+
+        if (fname != nullptr && !PyStr_Check(fname))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToC(): Expects a string as fname argument.");
+
+        if (icomment != nullptr && !PyBool_Check(icomment))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToC(): Expects a boolean as icomment argument.");
+
+        if (fname == nullptr)
+          fname = PyStr_FromString("triton_expr");
+
+        if (icomment == nullptr)
+          icomment = PyLong_FromUint32(false);
+
+        try {
+          std::ostringstream stream;
+          std::string name = PyStr_AsString(fname);
+          bool icomment_c  = PyLong_AsBool(icomment);
+
+          if (PySymbolicExpression_Check(node)) {
+            PyTritonContext_AsTritonContext(self)->liftToC(stream, PySymbolicExpression_AsSymbolicExpression(node), name, icomment_c);
+          }
+          else if (PyBasicBlock_Check(node)) {
+            PyTritonContext_AsTritonContext(self)->liftToC(stream, *PyBasicBlock_AsBasicBlock(node), name, icomment_c);
+          }
+          else if (PyList_Check(node)) {
+            std::vector<triton::ast::SharedAbstractNode> nodes;
+            for (Py_ssize_t i = 0; i < PyList_Size(node); i++) {
+              PyObject* item = PyList_GetItem(node, i);
+              if (PySymbolicExpression_Check(item))
+                nodes.push_back(PySymbolicExpression_AsSymbolicExpression(item)->getAst());
+              else if (PyAstNode_Check(item))
+                nodes.push_back(PyAstNode_AsAstNode(item));
+              else
+                return PyErr_Format(PyExc_TypeError, "TritonContext::liftToC(): Each item of the list must be a SymbolicExpression or a AstNode.");
+            }
+            PyTritonContext_AsTritonContext(self)->liftToC(stream, nodes, name, icomment_c);
+          }
+          else {
+            PyTritonContext_AsTritonContext(self)->liftToC(stream, PyAstNode_AsAstNode(node), name, icomment_c);
           }
+          return xPyString_FromString(stream.str().c_str());
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1666,27 +6583,173 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        return ret;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
+      static PyObject* TritonContext_liftToDot(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* node     = nullptr;
+        PyObject* maxNodes = nullptr;
+        PyObject* maxDepth = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"maxNodes",
+          (char*)"maxDepth",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOO", keywords, &node, &maxNodes, &maxDepth) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToDot(): Invalid number of arguments");
+        }
+
+        if (node == nullptr || (!PyAstNode_Check(node) && !PySymbolicExpression_Check(node)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToDot(): Expects an AstNode or a SymbolicExpression as first argument.");
+
+        if (maxNodes != nullptr && (!PyLong_Check(maxNodes) && !PyInt_Check(maxNodes)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToDot(): Expects an integer as maxNodes argument.");
+
+        if (maxDepth != nullptr && (!PyLong_Check(maxDepth) && !PyInt_Check(maxDepth)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToDot(): Expects an integer as maxDepth argument.");
 
-      static PyObject* TritonContext_getRegister(PyObject* self, PyObject* regIn) {
         try {
-          if (regIn != nullptr && (PyLong_Check(regIn) || PyInt_Check(regIn))) {
-            triton::arch::register_e rid = static_cast<triton::arch::register_e>(PyLong_AsUint32(regIn));
-            triton::arch::Register regOut(PyTritonContext_AsTritonContext(self)->getRegister(rid));
-            return PyRegister(regOut);
-          }
+          std::ostringstream stream;
 
-          else if (regIn != nullptr && (PyStr_Check(regIn))) {
-            std::string name = std::string(PyStr_AsString(regIn));
-            triton::arch::Register regOut(PyTritonContext_AsTritonContext(self)->getRegister(name));
-            return PyRegister(regOut);
+          /* The budgeted export is used once a limit is given */
+          if (maxNodes != nullptr || maxDepth != nullptr) {
+            auto ast = PyAstNode_Check(node) ? PyAstNode_AsAstNode(node) : PySymbolicExpression_AsSymbolicExpression(node)->getAst();
+            PyTritonContext_AsTritonContext(self)->liftToDot(stream, ast, maxNodes ? PyLong_AsUsize(maxNodes) : 0, maxDepth ? PyLong_AsUint32(maxDepth) : 0);
+          }
+          else if (PyAstNode_Check(node)) {
+            PyTritonContext_AsTritonContext(self)->liftToDot(stream, PyAstNode_AsAstNode(node));
+          }
+          else {
+            PyTritonContext_AsTritonContext(self)->liftToDot(stream, PySymbolicExpression_AsSymbolicExpression(node));
           }
 
+          return xPyString_FromString(stream.str().c_str());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_liftToLLVM(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* node      = nullptr;
+        PyObject* fname     = nullptr;
+        PyObject* optimize  = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"fname",
+          (char*)"optimize",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOO", keywords, &node, &fname, &optimize) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Invalid number of arguments");
+        }
+
+        if (node == nullptr || (!PySymbolicExpression_Check(node) && !PyAstNode_Check(node) && !PyList_Check(node) && !PyBasicBlock_Check(node)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Expects a SymbolicExpression, a AstNode, a list of them or a BasicBlock as node argument.");
+
+        if (fname != nullptr && !PyStr_Check(fname))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Expects a string as fname argument.");
+
+        if (optimize != nullptr && !PyBool_Check(optimize))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Expects a boolean as optimize argument.");
+
+        if (fname == nullptr)
+          fname = PyStr_FromString("__triton");
+
+        if (optimize == nullptr)
+          optimize = PyLong_FromUint32(false);
+
+        try {
+          std::ostringstream stream;
+          std::string name = PyStr_AsString(fname);
+          bool optimize_c  = PyLong_AsBool(optimize);
+
+          if (PySymbolicExpression_Check(node)) {
+            triton::engines::symbolic::SharedSymbolicExpression expr = PySymbolicExpression_AsSymbolicExpression(node);
+            triton::bindings::python::PyAllowThreads allow;
+            PyTritonContext_AsTritonContext(self)->liftToLLVM(stream, expr, name.c_str(), optimize_c);
+          }
+          else if (PyBasicBlock_Check(node)) {
+            triton::arch::BasicBlock& block = *PyBasicBlock_AsBasicBlock(node);
+            triton::bindings::python::PyAllowThreads allow;
+            PyTritonContext_AsTritonContext(self)->liftToLLVM(stream, block, name.c_str(), optimize_c);
+          }
+          else if (PyList_Check(node)) {
+            std::vector<triton::ast::SharedAbstractNode> nodes;
+            for (Py_ssize_t i = 0; i < PyList_Size(node); i++) {
+              PyObject* item = PyList_GetItem(node, i);
+              if (PySymbolicExpression_Check(item))
+                nodes.push_back(PySymbolicExpression_AsSymbolicExpression(item)->getAst());
+              else if (PyAstNode_Check(item))
+                nodes.push_back(PyAstNode_AsAstNode(item));
+              else
+                return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Each item of the list must be a SymbolicExpression or a AstNode.");
+            }
+            triton::bindings::python::PyAllowThreads allow;
+            PyTritonContext_AsTritonContext(self)->liftToLLVM(stream, nodes, name.c_str(), optimize_c);
+          }
           else {
-            return PyErr_Format(PyExc_TypeError, "TritonContext::getRegister(): Expects an integer or a string as argument.");
+            triton::ast::SharedAbstractNode ast = PyAstNode_AsAstNode(node);
+            triton::bindings::python::PyAllowThreads allow;
+            PyTritonContext_AsTritonContext(self)->liftToLLVM(stream, ast, name.c_str(), optimize_c);
           }
+          return xPyString_FromString(stream.str().c_str());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_liftToPython(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* expr     = nullptr;
+        PyObject* icomment = nullptr;
+
+        static char* keywords[] = {
+          (char*)"expr",
+          (char*)"icomment",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &expr, &icomment) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToPython(): Invalid number of arguments");
+        }
+
+        if (expr == nullptr || !PySymbolicExpression_Check(expr))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToPython(): Expects a SymbolicExpression as expr argument.");
+
+        if (icomment != nullptr && !PyBool_Check(icomment))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToPython(): Expects a boolean as icomment argument.");
+
+        if (icomment == nullptr)
+          icomment = PyLong_FromUint32(false);
+
+        try {
+          std::ostringstream stream;
+          PyTritonContext_AsTritonContext(self)->liftToPython(stream, PySymbolicExpression_AsSymbolicExpression(expr), PyLong_AsBool(icomment));
+          return xPyString_FromString(stream.str().c_str());
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1694,15 +6757,48 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_getRegisterAst(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getRegisterAst(): Expects an Register as argument.");
+      static PyObject* TritonContext_liftToSMT(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* expr     = nullptr;
+        PyObject* assert   = nullptr;
+        PyObject* icomment = nullptr;
+
+        static char* keywords[] = {
+          (char*)"expr",
+          (char*)"assert_",
+          (char*)"icomment",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &expr, &assert, &icomment) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToSMT(): Invalid number of arguments");
+        }
+
+        if (expr == nullptr || !PySymbolicExpression_Check(expr))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToSMT(): Expects a SymbolicExpression as expr argument.");
+
+        if (assert != nullptr && !PyBool_Check(assert))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToSMT(): Expects a boolean as assert_ argument.");
+
+        if (assert == nullptr)
+          assert = PyLong_FromUint32(false);
+
+        if (icomment != nullptr && !PyBool_Check(icomment))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToSMT(): Expects a boolean as icomment argument.");
+
+        if (icomment == nullptr)
+          icomment = PyLong_FromUint32(false);
 
         try {
-          return PyAstNode(PyTritonContext_AsTritonContext(self)->getRegisterAst(*PyRegister_AsRegister(reg)));
+          std::ostringstream stream;
+          PyTritonContext_AsTritonContext(self)->liftToSMT(stream, PySymbolicExpression_AsSymbolicExpression(expr), PyLong_AsBool(assert), PyLong_AsBool(icomment));
+          return xPyString_FromString(stream.str().c_str());
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1710,12 +6806,18 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_getSolver(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_load(PyObject* self, PyObject* path) {
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::load(): Expects a string as argument.");
+
         try {
-          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getSolver());
+          PyTritonContext_AsTritonContext(self)->load(PyStr_AsString(path));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1723,15 +6825,27 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_getSymbolicExpression(PyObject* self, PyObject* symExprId) {
-        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicExpression(): Expects an integer as argument.");
+      static PyObject* TritonContext_loadBinary(PyObject* self, PyObject* path) {
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::loadBinary(): Expects a string as argument.");
 
         try {
-          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicExpression(PyLong_AsUsize(symExprId)));
+          auto segments = PyTritonContext_AsTritonContext(self)->loadBinary(PyStr_AsString(path));
+          PyObject* ret = xPyList_New(segments.size());
+          triton::usize index = 0;
+          for (const auto& segment : segments) {
+            PyObject* tuple = triton::bindings::python::xPyTuple_New(2);
+            PyTuple_SetItem(tuple, 0, PyLong_FromUint64(segment.address));
+            PyTuple_SetItem(tuple, 1, PyLong_FromUint64(segment.size));
+            PyList_SetItem(ret, index++, tuple);
+          }
+          return ret;
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1742,15 +6856,12 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getSymbolicExpressions(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
+      static PyObject* TritonContext_loadSynthesisCache(PyObject* self, PyObject* path) {
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::loadSynthesisCache(): Expects a string as argument.");
 
         try {
-          const auto& expressions = PyTritonContext_AsTritonContext(self)->getSymbolicExpressions();
-
-          ret = xPyDict_New();
-          for (auto it = expressions.begin(); it != expressions.end(); it++)
-            xPyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicExpression(it->second));
+          PyTritonContext_AsTritonContext(self)->loadSynthesisCache(PyStr_AsString(path));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1759,33 +6870,17 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        return ret;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_getSymbolicMemory(PyObject* self, PyObject* args) {
-        PyObject* ret  = nullptr;
-        PyObject* addr = nullptr;
-
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|O", &addr) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicMemory(): Invalid number of arguments");
-        }
+      static PyObject* TritonContext_loadSynthesisDatabase(PyObject* self, PyObject* path) {
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::loadSynthesisDatabase(): Expects a string as argument.");
 
         try {
-          if (addr == nullptr) {
-            auto regs = PyTritonContext_AsTritonContext(self)->getSymbolicMemory();
-
-            ret = xPyDict_New();
-            for (auto it = regs.begin(); it != regs.end(); it++) {
-              xPyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
-            }
-          }
-          else if (addr != nullptr && (PyLong_Check(addr) || PyInt_Check(addr))) {
-            ret = PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicMemory(PyLong_AsUint64(addr)));
-          }
-          else
-            return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicMemory(): Expects an integer or nothing as argument.");
+          PyTritonContext_AsTritonContext(self)->loadSynthesisDatabase(PyStr_AsString(path));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1794,18 +6889,32 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        return ret;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_getSymbolicMemoryValue(PyObject* self, PyObject* mem) {
-        if (!PyLong_Check(mem) && !PyInt_Check(mem) && !PyMemoryAccess_Check(mem))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicMemoryValue(): Expects an integer or a MemoryAccess as argument.");
+      static PyObject* TritonContext_newSymbolicExpression(PyObject* self, PyObject* args) {
+        PyObject* node          = nullptr;
+        PyObject* comment       = nullptr;
+        std::string ccomment    = "";
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &node, &comment) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicExpression(): Invalid number of arguments");
+        }
+
+        if (node == nullptr || (!PyAstNode_Check(node)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicExpression(): Expects a AstNode as first argument.");
+
+        if (comment != nullptr && !PyStr_Check(comment))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicExpression(): Expects a sting as second argument.");
+
+        if (comment != nullptr)
+          ccomment = PyStr_AsString(comment);
 
         try {
-          if (PyLong_Check(mem) || PyInt_Check(mem))
-            return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicMemoryValue(PyLong_AsUint64(mem)));
-          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicMemoryValue(*PyMemoryAccess_AsMemoryAccess(mem)));
+          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->newSymbolicExpression(PyAstNode_AsAstNode(node), ccomment));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1816,34 +6925,27 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getSymbolicRegisters(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-
-        try {
-          auto regs = PyTritonContext_AsTritonContext(self)->getSymbolicRegisters();
+      static PyObject* TritonContext_newSymbolicVariable(PyObject* self, PyObject* args) {
+        PyObject* size      = nullptr;
+        PyObject* alias     = nullptr;
+        std::string calias  = "";
 
-          ret = xPyDict_New();
-          for (auto it = regs.begin(); it != regs.end(); it++) {
-            xPyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
-          }
-        }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
-        }
-        catch (const triton::exceptions::Exception& e) {
-          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &size, &alias) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicVariable(): Invalid number of arguments");
         }
 
-        return ret;
-      }
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicVariable(): Expects an integer as first argument.");
 
+        if (alias != nullptr && !PyStr_Check(alias))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicVariable(): Expects a sting as second  argument.");
 
-      static PyObject* TritonContext_getSymbolicRegister(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicRegister(): Expects a Register as argument.");
+        if (alias != nullptr)
+          calias = PyStr_AsString(alias);
 
         try {
-          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicRegister(*PyRegister_AsRegister(reg)));
+          return PySymbolicVariable(PyTritonContext_AsTritonContext(self)->newSymbolicVariable(PyLong_AsUint32(size), calias));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1854,32 +6956,36 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getSymbolicRegisterValue(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicRegisterValue(): Expects a Register as argument.");
+      static PyObject* TritonContext_openPersistentDecodeCache(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* path = nullptr;
+        PyObject* slots = nullptr;
+        triton::usize slots_c = 65536;
 
-        try {
-          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicRegisterValue(*PyRegister_AsRegister(reg)));
+        static char* keywords[] = {
+          (char*)"path",
+          (char*)"slots",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &path, &slots) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::openPersistentDecodeCache(): Invalid keyword argument.");
         }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+
+        if (path == nullptr || !PyStr_Check(path)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::openPersistentDecodeCache(): Expects a string as path argument.");
         }
-        catch (const triton::exceptions::Exception& e) {
-          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+
+        if (slots != nullptr && (!PyLong_Check(slots) && !PyInt_Check(slots))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::openPersistentDecodeCache(): Expects an integer as slots argument.");
         }
-      }
 
+        if (slots != nullptr) {
+          slots_c = PyLong_AsUsize(slots);
+        }
 
-      static PyObject* TritonContext_getSymbolicVariable(PyObject* self, PyObject* arg) {
         try {
-          if (PyLong_Check(arg) || PyInt_Check(arg))
-            return PySymbolicVariable(PyTritonContext_AsTritonContext(self)->getSymbolicVariable(PyLong_AsUsize(arg)));
-
-          else if (PyStr_Check(arg))
-            return PySymbolicVariable(PyTritonContext_AsTritonContext(self)->getSymbolicVariable(PyStr_AsString(arg)));
-
-          else
-            return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicVariable(): Expects an integer or a string as argument.");
+          PyTritonContext_AsTritonContext(self)->openPersistentDecodeCache(PyStr_AsString(path), slots_c);
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1887,43 +6993,42 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_getSymbolicVariables(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
+      static PyObject* TritonContext_openSharedQueryCache(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* path = nullptr;
+        PyObject* slots = nullptr;
+        triton::usize slots_c = 65536;
 
-        try {
-          const auto& variables = PyTritonContext_AsTritonContext(self)->getSymbolicVariables();
+        static char* keywords[] = {
+          (char*)"path",
+          (char*)"slots",
+          nullptr
+        };
 
-          ret = xPyDict_New();
-          for (auto sv: variables)
-            xPyDict_SetItem(ret, PyLong_FromUsize(sv.first), PySymbolicVariable(sv.second));
-        }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
-        }
-        catch (const triton::exceptions::Exception& e) {
-          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &path, &slots) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::openSharedQueryCache(): Invalid keyword argument.");
         }
 
-        return ret;
-      }
+        if (path == nullptr || !PyStr_Check(path)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::openSharedQueryCache(): Expects a string as path argument.");
+        }
 
+        if (slots != nullptr && (!PyLong_Check(slots) && !PyInt_Check(slots))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::openSharedQueryCache(): Expects an integer as slots argument.");
+        }
 
-      static PyObject* TritonContext_getTaintedMemory(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-        triton::usize size = 0, index = 0;
+        if (slots != nullptr) {
+          slots_c = PyLong_AsUsize(slots);
+        }
 
         try {
-          std::unordered_set<triton::uint64> addresses = PyTritonContext_AsTritonContext(self)->getTaintedMemory();
-
-          size = addresses.size();
-          ret = xPyList_New(size);
-          for (auto it = addresses.begin(); it != addresses.end(); it++) {
-            PyList_SetItem(ret, index, PyLong_FromUint64(*it));
-            index++;
-          }
+          PyTritonContext_AsTritonContext(self)->openSharedQueryCache(PyStr_AsString(path), slots_c);
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1932,48 +7037,72 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        return ret;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_getTaintedRegisters(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-        triton::usize size = 0, index = 0;
+      static PyObject* TritonContext_optimize(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* obj     = nullptr;
+        PyObject* passes  = nullptr;
+        PyObject* padding = nullptr;
+        PyObject* timeout = nullptr;
+        std::vector<triton::arch::BasicBlock> region;
+        std::vector<triton::arch::BasicBlock> blocks;
+        triton::engines::symbolic::PassStatistics stats;
 
-        try {
-          std::unordered_set<const triton::arch::Register*> registers = PyTritonContext_AsTritonContext(self)->getTaintedRegisters();
+        static char* keywords[] = {
+          (char*)"obj",
+          (char*)"passes",
+          (char*)"padding",
+          (char*)"timeout",
+          nullptr
+        };
 
-          size = registers.size();
-          ret = xPyList_New(size);
-          for (const auto* reg: registers) {
-            PyList_SetItem(ret, index, PyRegister(*reg));
-            index++;
-          }
-        }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
-        }
-        catch (const triton::exceptions::Exception& e) {
-          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOO", keywords, &obj, &passes, &padding, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::optimize(): Invalid number of arguments");
         }
 
-        return ret;
-      }
+        if (obj == nullptr || (!PyBasicBlock_Check(obj) && !PyList_Check(obj)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::optimize(): Expects a BasicBlock or a list of BasicBlock as obj argument.");
 
+        if (passes == nullptr || !PyList_Check(passes))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::optimize(): Expects a list of PASS as passes argument.");
 
-      static PyObject* TritonContext_getTaintedSymbolicExpressions(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-        triton::usize size = 0, index = 0;
+        if (padding != nullptr && !PyBool_Check(padding))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::optimize(): Expects a boolean as padding argument.");
 
-        try {
-          auto expressions = PyTritonContext_AsTritonContext(self)->getTaintedSymbolicExpressions();
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::optimize(): Expects an integer as timeout argument.");
 
-          size = expressions.size();
-          ret = xPyList_New(size);
-          for (auto it = expressions.begin(); it != expressions.end(); it++) {
-            PyList_SetItem(ret, index, PySymbolicExpression(*it));
-            index++;
+        if (PyBasicBlock_Check(obj)) {
+          region.push_back(*PyBasicBlock_AsBasicBlock(obj));
+        }
+        else {
+          for (Py_ssize_t i = 0; i < PyList_Size(obj); i++) {
+            PyObject* item = PyList_GetItem(obj, i);
+            if (!PyBasicBlock_Check(item))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::optimize(): Each item of the list must be a BasicBlock.");
+            region.push_back(*PyBasicBlock_AsBasicBlock(item));
+          }
+        }
+
+        try {
+          triton::engines::symbolic::PassManager manager(*PyTritonContext_AsTritonContext(self));
+
+          for (Py_ssize_t i = 0; i < PyList_Size(passes); i++) {
+            PyObject* item = PyList_GetItem(passes, i);
+            if (!PyLong_Check(item) && !PyInt_Check(item))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::optimize(): Each item of passes must be a PASS.");
+            manager.addPass(static_cast<triton::engines::symbolic::pass_e>(PyLong_AsUint32(item)));
           }
+
+          if (timeout != nullptr)
+            manager.setTimeout(PyLong_AsUint32(timeout));
+
+          blocks = manager.run(region, padding != nullptr && PyLong_AsBool(padding));
+          stats  = manager.getStatistics();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1982,15 +7111,42 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
+        PyObject* dict = xPyDict_New();
+        xPyDict_SetItemString(dict, "instructions",      PyLong_FromUsize(stats.instructions));
+        xPyDict_SetItemString(dict, "kept",              PyLong_FromUsize(stats.kept));
+        xPyDict_SetItemString(dict, "deadStores",        PyLong_FromUsize(stats.deadStores));
+        xPyDict_SetItemString(dict, "opaquePredicates",  PyLong_FromUsize(stats.opaquePredicates));
+        xPyDict_SetItemString(dict, "sampledPredicates", PyLong_FromUsize(stats.sampledPredicates));
+        xPyDict_SetItemString(dict, "unreachableBlocks", PyLong_FromUsize(stats.unreachableBlocks));
+        xPyDict_SetItemString(dict, "redundantWrites",   PyLong_FromUsize(stats.redundantWrites));
+
+        PyObject* ret = triton::bindings::python::xPyTuple_New(2);
+        if (PyBasicBlock_Check(obj)) {
+          PyTuple_SetItem(ret, 0, PyBasicBlock(blocks.front()));
+        }
+        else {
+          PyObject* list = xPyList_New(blocks.size());
+          for (triton::usize i = 0; i < blocks.size(); i++)
+            PyList_SetItem(list, i, PyBasicBlock(blocks[i]));
+          PyTuple_SetItem(ret, 0, list);
+        }
+        PyTuple_SetItem(ret, 1, dict);
+
         return ret;
       }
 
 
-      static PyObject* TritonContext_isArchitectureValid(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_parseSmt(PyObject* self, PyObject* script) {
+        if (script == nullptr || !PyStr_Check(script))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::parseSmt(): Expects a string as argument.");
+
         try {
-          if (PyTritonContext_AsTritonContext(self)->isArchitectureValid() == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          std::istringstream stream(PyStr_AsString(script));
+          auto asserts = PyTritonContext_AsTritonContext(self)->parseSmt(stream);
+          PyObject* ret = xPyList_New(asserts.size());
+          for (triton::usize i = 0; i < asserts.size(); i++)
+            PyList_SetItem(ret, i, PyAstNode(asserts[i]));
+          return ret;
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2001,34 +7157,9 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_isConcreteMemoryValueDefined(PyObject* self, PyObject* args) {
-        PyObject* baseAddr        = nullptr;
-        PyObject* size            = nullptr;
-
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &baseAddr, &size) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isConcreteMemoryValueDefined(): Invalid number of arguments");
-        }
-
+      static PyObject* TritonContext_popPathConstraint(PyObject* self, PyObject* noarg) {
         try {
-          if (baseAddr && PyMemoryAccess_Check(baseAddr)) {
-            if (PyTritonContext_AsTritonContext(self)->isConcreteMemoryValueDefined(*PyMemoryAccess_AsMemoryAccess(baseAddr)) == true)
-              Py_RETURN_TRUE;
-            Py_RETURN_FALSE;
-          }
-          else if (baseAddr && (PyLong_Check(baseAddr) || PyInt_Check(baseAddr))) {
-            if (size && (PyLong_Check(size) || PyInt_Check(size))) {
-              if (PyTritonContext_AsTritonContext(self)->isConcreteMemoryValueDefined(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size)) == true)
-                Py_RETURN_TRUE;
-              Py_RETURN_FALSE;
-            }
-            else {
-              return PyErr_Format(PyExc_TypeError, "TritonContext::isConcreteMemoryValueDefined(): Expects a size (integer) as second argument.");
-            }
-          }
-          else {
-            return PyErr_Format(PyExc_TypeError, "TritonContext::isConcreteMemoryValueDefined(): Expects a base address (integer) as arguments or a memory cells.");
-          }
+          PyTritonContext_AsTritonContext(self)->popPathConstraint();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2036,20 +7167,17 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_isFlag(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isFlag(): Expects a Register as argument.");
+      static PyObject* TritonContext_predictSolvingTime(PyObject* self, PyObject* node) {
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::predictSolvingTime(): Expects an AstNode as argument.");
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->isFlag(*PyRegister_AsRegister(reg)) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
-        }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->predictSolvingTime(PyAstNode_AsAstNode(node)));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2057,46 +7185,36 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_isMemorySymbolized(PyObject* self, PyObject* mem) {
-        try {
-          if (PyMemoryAccess_Check(mem)) {
-            if (PyTritonContext_AsTritonContext(self)->isMemorySymbolized(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
-              Py_RETURN_TRUE;
-          }
+      static PyObject* TritonContext_processTrace(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* path        = nullptr;
+        PyObject* segmentSize = nullptr;
+        PyObject* threads     = nullptr;
 
-          else if (PyLong_Check(mem) || PyInt_Check(mem)) {
-            if (PyTritonContext_AsTritonContext(self)->isMemorySymbolized(PyLong_AsUint64(mem)) == true)
-              Py_RETURN_TRUE;
-          }
+        static char* keywords[] = {
+          (char*)"path",
+          (char*)"segmentSize",
+          (char*)"threads",
+          nullptr
+        };
 
-          else
-            return PyErr_Format(PyExc_TypeError, "TritonContext::isMemorySymbolized(): Expects a MemoryAccess or an integer as argument.");
-        }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
-        }
-        catch (const triton::exceptions::Exception& e) {
-          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        /* Extract arguments */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOO", keywords, &path, &segmentSize, &threads) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::processTrace(): Invalid keyword argument");
         }
 
-        Py_RETURN_FALSE;
-      }
-
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::processTrace(): Expects a string as path.");
 
-      static PyObject* TritonContext_isMemoryTainted(PyObject* self, PyObject* mem) {
-        try {
-          if (PyMemoryAccess_Check(mem)) {
-            if (PyTritonContext_AsTritonContext(self)->isMemoryTainted(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
-              Py_RETURN_TRUE;
-          }
+        if (segmentSize != nullptr && !PyLong_Check(segmentSize) && !PyInt_Check(segmentSize))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::processTrace(): Expects an integer as segmentSize.");
 
-          else if (PyLong_Check(mem) || PyInt_Check(mem)) {
-            if (PyTritonContext_AsTritonContext(self)->isMemoryTainted(PyLong_AsUint64(mem)) == true)
-              Py_RETURN_TRUE;
-          }
+        if (threads != nullptr && !PyLong_Check(threads) && !PyInt_Check(threads))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::processTrace(): Expects an integer as threads.");
 
-          else
-            return PyErr_Format(PyExc_TypeError, "TritonContext::isMemoryTainted(): Expects a MemoryAccess or an integer as argument.");
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->processTrace(PyStr_AsString(path),
+                                                                                      segmentSize != nullptr ? PyLong_AsUsize(segmentSize) : 0x10000,
+                                                                                      threads != nullptr ? PyLong_AsUint32(threads) : 0));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2104,19 +7222,30 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-
-        Py_RETURN_FALSE;
       }
 
 
-      static PyObject* TritonContext_isRegister(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isRegister(): Expects a Register as argument.");
+      static PyObject* TritonContext_processing(PyObject* self, PyObject* args) {
+        PyObject* obj  = nullptr;
+        PyObject* addr = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &obj, &addr) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::processing(): Invalid number of arguments");
+        }
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->isRegister(*PyRegister_AsRegister(reg)) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          if (PyInstruction_Check(obj)) {
+            return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->processing(*PyInstruction_AsInstruction(obj)));
+          }
+          else if (PyBasicBlock_Check(obj)) {
+            triton::uint64 base = 0;
+            if (addr != nullptr && (PyLong_Check(addr) || PyInt_Check(addr))) {
+              base = PyLong_AsUint64(addr);
+            }
+            return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->processing(*PyBasicBlock_AsBasicBlock(obj), base));
+          }
+          return PyErr_Format(PyExc_TypeError, "TritonContext::processing(): Expects an Instruction or a BasicBlock as argument.");
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2127,14 +7256,27 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_isRegisterSymbolized(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isRegisterSymbolized(): Expects a Register as argument.");
+      static PyObject* TritonContext_processingJit(PyObject* self, PyObject* args) {
+        PyObject* obj  = nullptr;
+        PyObject* addr = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &obj, &addr) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::processingJit(): Invalid number of arguments");
+        }
+
+        if (obj == nullptr || !PyBasicBlock_Check(obj))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::processingJit(): Expects a BasicBlock as first argument.");
+
+        if (addr != nullptr && (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::processingJit(): Expects an integer as second argument.");
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->isRegisterSymbolized(*PyRegister_AsRegister(reg)) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          triton::uint64 base = 0;
+          if (addr != nullptr) {
+            base = PyLong_AsUint64(addr);
+          }
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->processingJit(*PyBasicBlock_AsBasicBlock(obj), base));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2145,14 +7287,33 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_isRegisterTainted(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isRegisterTainted(): Expects a Register as argument.");
+      static PyObject* TritonContext_pushPathConstraint(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* node       = nullptr;
+        PyObject* comment    = nullptr;
+        std::string ccomment = "";
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"comment",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &node, &comment) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::pushPathConstraint(): Invalid keyword argument.");
+        }
+
+        if (node == nullptr || (!PyAstNode_Check(node)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::pushPathConstraint(): Expects an AstNode as first argument.");
+
+        if (comment != nullptr && !PyStr_Check(comment))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::pushPathConstraint(): Expects a string as second argument.");
+
+        if (comment != nullptr)
+          ccomment = PyStr_AsString(comment);
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->isRegisterTainted(*PyRegister_AsRegister(reg)) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          PyTritonContext_AsTritonContext(self)->pushPathConstraint(PyAstNode_AsAstNode(node), ccomment);
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2160,53 +7321,117 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_isRegisterValid(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isRegisterValid(): Expects a Register as argument.");
+      static PyObject* TritonContext_readConcreteMemoryInto(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* addr          = nullptr;
+        PyObject* buffer        = nullptr;
+        PyObject* execCallbacks = nullptr;
+        Py_buffer view;
 
-        try {
-          if (PyTritonContext_AsTritonContext(self)->isRegisterValid(*PyRegister_AsRegister(reg)) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+        static char* keywords[] = {
+          (char*)"addr",
+          (char*)"buffer",
+          (char*)"callbacks",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "OO|O", keywords, &addr, &buffer, &execCallbacks) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::readConcreteMemoryInto(): Invalid keyword argument");
         }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::readConcreteMemoryInto(): Expects an integer as addr keyword.");
         }
-        catch (const triton::exceptions::Exception& e) {
-          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+
+        if (buffer == nullptr || !PyObject_CheckBuffer(buffer)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::readConcreteMemoryInto(): Expects a writable bytes-like object as buffer keyword.");
         }
-      }
 
+        if (execCallbacks != nullptr && !PyBool_Check(execCallbacks)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::readConcreteMemoryInto(): Expects a boolean as execCallbacks keyword.");
+        }
 
-      static PyObject* TritonContext_isSat(PyObject* self, PyObject* node) {
-        if (!PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isSat(): Expects a AstNode as argument.");
+        if (execCallbacks == nullptr) {
+          execCallbacks = PyLong_FromUint32(true);
+        }
+
+        if (PyObject_GetBuffer(buffer, &view, PyBUF_WRITABLE) != 0) {
+          PyErr_Clear();
+          return PyErr_Format(PyExc_TypeError, "TritonContext::readConcreteMemoryInto(): Expects a writable contiguous bytes-like object as buffer keyword.");
+        }
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->isSat(PyAstNode_AsAstNode(node)) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          PyTritonContext_AsTritonContext(self)->readConcreteMemory(PyLong_AsUint64(addr), view.buf, static_cast<triton::usize>(view.len), PyLong_AsBool(execCallbacks));
         }
         catch (const triton::exceptions::PyCallbacks&) {
+          PyBuffer_Release(&view);
           return nullptr;
         }
         catch (const triton::exceptions::Exception& e) {
+          PyBuffer_Release(&view);
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        PyBuffer_Release(&view);
+        return PyLong_FromUsize(static_cast<triton::usize>(view.len));
       }
 
 
-      static PyObject* TritonContext_isSymbolicExpressionExists(PyObject* self, PyObject* symExprId) {
-        if (!PyInt_Check(symExprId) && !PyLong_Check(symExprId))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isSymbolicExpressionExists(): Expects an integer as argument.");
+      static PyObject* TritonContext_removeCallback(PyObject* self, PyObject* args) {
+        PyObject* cb       = nullptr;
+        PyObject* cb_self  = nullptr;
+        PyObject* function = nullptr;
+        PyObject* mode     = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &mode, &function) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeCallback(): Invalid number of arguments");
+        }
+
+        if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeCallback(): Expects a CALLBACK as first argument.");
+
+        if (function == nullptr || !PyCallable_Check(function))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeCallback(): Expects a function as second argument.");
+
+        /* Get the callback (class or static) */
+        if (PyMethod_Check(function)) {
+          cb_self = PyMethod_GET_SELF(function);
+          cb = PyMethod_GET_FUNCTION(function);
+        }
+        else {
+          cb = function;
+        }
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->isSymbolicExpressionExists(PyLong_AsUsize(symExprId)) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          switch (static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode))) {
+            case callbacks::GET_CONCRETE_MEMORY_VALUE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::GET_CONCRETE_MEMORY_VALUE, callbacks::getConcreteMemoryValueCallback(nullptr, cb));
+              break;
+            case callbacks::GET_CONCRETE_MEMORY_PAGE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::GET_CONCRETE_MEMORY_PAGE, callbacks::getConcreteMemoryPageCallback(nullptr, cb));
+              break;
+            case callbacks::GET_CONCRETE_REGISTER_VALUE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::GET_CONCRETE_REGISTER_VALUE, callbacks::getConcreteRegisterValueCallback(nullptr, cb));
+              break;
+            case callbacks::SET_CONCRETE_MEMORY_VALUE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SET_CONCRETE_MEMORY_VALUE, callbacks::setConcreteMemoryValueCallback(nullptr, cb));
+              break;
+            case callbacks::SET_CONCRETE_REGISTER_VALUE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SET_CONCRETE_REGISTER_VALUE, callbacks::setConcreteRegisterValueCallback(nullptr, cb));
+              break;
+            case callbacks::SYMBOLIC_SIMPLIFICATION:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SYMBOLIC_SIMPLIFICATION, callbacks::symbolicSimplificationCallback(nullptr, cb));
+              break;
+            default:
+              return PyErr_Format(PyExc_TypeError, "TritonContext::removeCallback(): Invalid kind of callback.");
+          }
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2214,17 +7439,18 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_isModeEnabled(PyObject* self, PyObject* mode) {
-        if (!PyInt_Check(mode) && !PyLong_Check(mode))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isModeEnabled(): Expects a MODE as argument.");
+      static PyObject* TritonContext_removeConcretizationRule(PyObject* self, PyObject* rule) {
+        if (rule == nullptr || (!PyLong_Check(rule) && !PyInt_Check(rule)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeConcretizationRule(): Expects a CONCRETIZATION rule as argument.");
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->isModeEnabled(static_cast<triton::modes::mode_e>(PyLong_AsUint32(mode))) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          PyTritonContext_AsTritonContext(self)->removeConcretizationRule(static_cast<triton::engines::symbolic::concretization_e>(PyLong_AsUint32(rule)));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2232,42 +7458,17 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-      }
 
-
-      static PyObject* TritonContext_isThumb(PyObject* self, PyObject* noarg) {
-        try {
-          if (PyTritonContext_AsTritonContext(self)->isThumb() == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
-        }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
-        }
-        catch (const triton::exceptions::Exception& e) {
-          return PyErr_Format(PyExc_TypeError, "%s", e.what());
-        }
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
-
-      static PyObject* TritonContext_liftToDot(PyObject* self, PyObject* node) {
-        if (!PyAstNode_Check(node) && !PySymbolicExpression_Check(node))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToDot(): Expects an AstNode or a SymbolicExpression as first argument.");
+      static PyObject* TritonContext_removeFunctionSummary(PyObject* self, PyObject* addr) {
+        if (!PyInt_Check(addr) && !PyLong_Check(addr))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeFunctionSummary(): Expects an integer as argument.");
 
         try {
-          std::ostringstream stream;
-
-          if (PyAstNode_Check(node)) {
-            PyTritonContext_AsTritonContext(self)->liftToDot(stream, PyAstNode_AsAstNode(node));
-          }
-          else {
-            PyTritonContext_AsTritonContext(self)->liftToDot(stream, PySymbolicExpression_AsSymbolicExpression(node));
-          }
-
-          return xPyString_FromString(stream.str().c_str());
-        }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+          PyTritonContext_AsTritonContext(self)->removeFunctionSummary(PyLong_AsUint64(addr));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2278,47 +7479,54 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_liftToLLVM(PyObject* self, PyObject* args, PyObject* kwargs) {
-        PyObject* node      = nullptr;
-        PyObject* fname     = nullptr;
-        PyObject* optimize  = nullptr;
-
-        static char* keywords[] = {
-          (char*)"node",
-          (char*)"fname",
-          (char*)"optimize",
-          nullptr
-        };
+      static PyObject* TritonContext_removeNativeCallback(PyObject* self, PyObject* args) {
+        PyObject* mode     = nullptr;
+        PyObject* function = nullptr;
+        PyObject* user     = nullptr;
+        void* function_c   = nullptr;
+        void* user_c       = nullptr;
 
-        /* Extract keywords */
-        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOO", keywords, &node, &fname, &optimize) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Invalid number of arguments");
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &mode, &function, &user) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeNativeCallback(): Invalid number of arguments");
         }
 
-        if (node == nullptr || (!PySymbolicExpression_Check(node) && !PyAstNode_Check(node)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Expects a SymbolicExpression or a AstNode as node argument.");
+        if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeNativeCallback(): Expects a CALLBACK as first argument.");
 
-        if (fname != nullptr && !PyStr_Check(fname))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Expects a string as fname argument.");
+        if (function == nullptr || (!PyLong_Check(function) && !PyInt_Check(function)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeNativeCallback(): Expects the address of a function as second argument.");
 
-        if (optimize != nullptr && !PyBool_Check(optimize))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Expects a boolean as optimize argument.");
+        if (user != nullptr && (!PyLong_Check(user) && !PyInt_Check(user)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeNativeCallback(): Expects an integer as third argument.");
 
-        if (fname == nullptr)
-          fname = PyStr_FromString("__triton");
+        try {
+          function_c = reinterpret_cast<void*>(static_cast<std::uintptr_t>(PyLong_AsUint64(function)));
+          if (user != nullptr)
+            user_c = reinterpret_cast<void*>(static_cast<std::uintptr_t>(PyLong_AsUint64(user)));
 
-        if (optimize == nullptr)
-          optimize = PyLong_FromUint32(false);
+          if (function_c == nullptr)
+            return PyErr_Format(PyExc_TypeError, "TritonContext::removeNativeCallback(): Expects the address of a function as second argument.");
 
-        try {
-          std::ostringstream stream;
-          if (PySymbolicExpression_Check(node)) {
-            PyTritonContext_AsTritonContext(self)->liftToLLVM(stream, PySymbolicExpression_AsSymbolicExpression(node), PyStr_AsString(fname), PyLong_AsBool(optimize));
-          }
-          else {
-            PyTritonContext_AsTritonContext(self)->liftToLLVM(stream, PyAstNode_AsAstNode(node), PyStr_AsString(fname), PyLong_AsBool(optimize));
+          switch (static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode))) {
+            case callbacks::GET_CONCRETE_MEMORY_VALUE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::GET_CONCRETE_MEMORY_VALUE, callbacks::nativeCallback(reinterpret_cast<callbacks::nativeGetConcreteMemoryValueCallback>(function_c), user_c));
+              break;
+            case callbacks::GET_CONCRETE_MEMORY_PAGE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::GET_CONCRETE_MEMORY_PAGE, callbacks::nativeCallback(reinterpret_cast<callbacks::nativeGetConcreteMemoryPageCallback>(function_c), user_c));
+              break;
+            case callbacks::GET_CONCRETE_REGISTER_VALUE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::GET_CONCRETE_REGISTER_VALUE, callbacks::nativeCallback(reinterpret_cast<callbacks::nativeGetConcreteRegisterValueCallback>(function_c), user_c));
+              break;
+            case callbacks::SET_CONCRETE_MEMORY_VALUE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SET_CONCRETE_MEMORY_VALUE, callbacks::nativeCallback(reinterpret_cast<callbacks::nativeSetConcreteMemoryValueCallback>(function_c), user_c));
+              break;
+            case callbacks::SET_CONCRETE_REGISTER_VALUE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SET_CONCRETE_REGISTER_VALUE, callbacks::nativeCallback(reinterpret_cast<callbacks::nativeSetConcreteRegisterValueCallback>(function_c), user_c));
+              break;
+            default:
+              return PyErr_Format(PyExc_TypeError, "TritonContext::removeNativeCallback(): Invalid kind of native callback.");
           }
-          return xPyString_FromString(stream.str().c_str());
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2332,34 +7540,28 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_liftToPython(PyObject* self, PyObject* args, PyObject* kwargs) {
-        PyObject* expr     = nullptr;
-        PyObject* icomment = nullptr;
-
-        static char* keywords[] = {
-          (char*)"expr",
-          (char*)"icomment",
-          nullptr
-        };
+      static PyObject* TritonContext_removeSnapshot(PyObject* self, PyObject* id) {
+        if (!PyInt_Check(id) && !PyLong_Check(id))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeSnapshot(): Expects an integer as argument.");
 
-        /* Extract keywords */
-        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &expr, &icomment) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToPython(): Invalid number of arguments");
+        try {
+          PyTritonContext_AsTritonContext(self)->removeSnapshot(PyLong_AsUsize(id));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        if (expr == nullptr || !PySymbolicExpression_Check(expr))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToPython(): Expects a SymbolicExpression as expr argument.");
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-        if (icomment != nullptr && !PyBool_Check(icomment))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToPython(): Expects a boolean as icomment argument.");
 
-        if (icomment == nullptr)
-          icomment = PyLong_FromUint32(false);
+      static PyObject* TritonContext_removeSyscallHandler(PyObject* self, PyObject* number) {
+        if (!PyLong_Check(number) && !PyInt_Check(number))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeSyscallHandler(): Expects an integer as argument.");
 
         try {
-          std::ostringstream stream;
-          PyTritonContext_AsTritonContext(self)->liftToPython(stream, PySymbolicExpression_AsSymbolicExpression(expr), PyLong_AsBool(icomment));
-          return xPyString_FromString(stream.str().c_str());
+          PyTritonContext_AsTritonContext(self)->removeSyscallHandler(PyLong_AsUint64(number));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2373,42 +7575,29 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_liftToSMT(PyObject* self, PyObject* args, PyObject* kwargs) {
-        PyObject* expr     = nullptr;
-        PyObject* assert   = nullptr;
-        PyObject* icomment = nullptr;
+      static PyObject* TritonContext_replayTrace(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* path  = nullptr;
+        PyObject* count = nullptr;
 
         static char* keywords[] = {
-          (char*)"expr",
-          (char*)"assert_",
-          (char*)"icomment",
+          (char*)"path",
+          (char*)"count",
           nullptr
         };
 
-        /* Extract keywords */
-        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &expr, &assert, &icomment) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToSMT(): Invalid number of arguments");
+        /* Extract arguments */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &path, &count) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::replayTrace(): Invalid keyword argument");
         }
 
-        if (expr == nullptr || !PySymbolicExpression_Check(expr))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToSMT(): Expects a SymbolicExpression as expr argument.");
-
-        if (assert != nullptr && !PyBool_Check(assert))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToSMT(): Expects a boolean as assert_ argument.");
-
-        if (assert == nullptr)
-          assert = PyLong_FromUint32(false);
-
-        if (icomment != nullptr && !PyBool_Check(icomment))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToSMT(): Expects a boolean as icomment argument.");
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::replayTrace(): Expects a string as path.");
 
-        if (icomment == nullptr)
-          icomment = PyLong_FromUint32(false);
+        if (count != nullptr && !PyLong_Check(count) && !PyInt_Check(count))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::replayTrace(): Expects an integer as count.");
 
         try {
-          std::ostringstream stream;
-          PyTritonContext_AsTritonContext(self)->liftToSMT(stream, PySymbolicExpression_AsSymbolicExpression(expr), PyLong_AsBool(assert), PyLong_AsBool(icomment));
-          return xPyString_FromString(stream.str().c_str());
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->replayTrace(PyStr_AsString(path), count != nullptr ? PyLong_AsUsize(count) : 0));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2416,33 +7605,11 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-
-        Py_INCREF(Py_None);
-        return Py_None;
       }
 
-
-      static PyObject* TritonContext_newSymbolicExpression(PyObject* self, PyObject* args) {
-        PyObject* node          = nullptr;
-        PyObject* comment       = nullptr;
-        std::string ccomment    = "";
-
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &node, &comment) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicExpression(): Invalid number of arguments");
-        }
-
-        if (node == nullptr || (!PyAstNode_Check(node)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicExpression(): Expects a AstNode as first argument.");
-
-        if (comment != nullptr && !PyStr_Check(comment))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicExpression(): Expects a sting as second argument.");
-
-        if (comment != nullptr)
-          ccomment = PyStr_AsString(comment);
-
+      static PyObject* TritonContext_reset(PyObject* self, PyObject* noarg) {
         try {
-          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->newSymbolicExpression(PyAstNode_AsAstNode(node), ccomment));
+          PyTritonContext_AsTritonContext(self)->reset();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2450,30 +7617,18 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-      }
-
-
-      static PyObject* TritonContext_newSymbolicVariable(PyObject* self, PyObject* args) {
-        PyObject* size      = nullptr;
-        PyObject* alias     = nullptr;
-        std::string calias  = "";
-
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &size, &alias) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicVariable(): Invalid number of arguments");
-        }
 
-        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicVariable(): Expects an integer as first argument.");
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-        if (alias != nullptr && !PyStr_Check(alias))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicVariable(): Expects a sting as second  argument.");
 
-        if (alias != nullptr)
-          calias = PyStr_AsString(alias);
+      static PyObject* TritonContext_resetToSnapshot(PyObject* self, PyObject* id) {
+        if (!PyInt_Check(id) && !PyLong_Check(id))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::resetToSnapshot(): Expects an integer as argument.");
 
         try {
-          return PySymbolicVariable(PyTritonContext_AsTritonContext(self)->newSymbolicVariable(PyLong_AsUint32(size), calias));
+          PyTritonContext_AsTritonContext(self)->resetToSnapshot(PyLong_AsUsize(id));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2481,12 +7636,17 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
+      static PyObject* TritonContext_restore(PyObject* self, PyObject* id) {
+        if (!PyInt_Check(id) && !PyLong_Check(id))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::restore(): Expects an integer as argument.");
 
-      static PyObject* TritonContext_popPathConstraint(PyObject* self, PyObject* noarg) {
         try {
-          PyTritonContext_AsTritonContext(self)->popPathConstraint();
+          PyTritonContext_AsTritonContext(self)->restore(PyLong_AsUsize(id));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2494,32 +7654,18 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
         Py_INCREF(Py_None);
         return Py_None;
       }
 
 
-      static PyObject* TritonContext_processing(PyObject* self, PyObject* args) {
-        PyObject* obj  = nullptr;
-        PyObject* addr = nullptr;
-
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &obj, &addr) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::processing(): Invalid number of arguments");
-        }
+      static PyObject* TritonContext_save(PyObject* self, PyObject* path) {
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::save(): Expects a string as argument.");
 
         try {
-          if (PyInstruction_Check(obj)) {
-            return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->processing(*PyInstruction_AsInstruction(obj)));
-          }
-          else if (PyBasicBlock_Check(obj)) {
-            triton::uint64 base = 0;
-            if (addr != nullptr && (PyLong_Check(addr) || PyInt_Check(addr))) {
-              base = PyLong_AsUint64(addr);
-            }
-            return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->processing(*PyBasicBlock_AsBasicBlock(obj), base));
-          }
-          return PyErr_Format(PyExc_TypeError, "TritonContext::processing(): Expects an Instruction or a BasicBlock as argument.");
+          PyTritonContext_AsTritonContext(self)->save(PyStr_AsString(path));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2527,36 +7673,18 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-      }
-
-
-      static PyObject* TritonContext_pushPathConstraint(PyObject* self, PyObject* args, PyObject* kwargs) {
-        PyObject* node       = nullptr;
-        PyObject* comment    = nullptr;
-        std::string ccomment = "";
-
-        static char* keywords[] = {
-          (char*)"node",
-          (char*)"comment",
-          nullptr
-        };
-
-        /* Extract Keywords */
-        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &node, &comment) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::pushPathConstraint(): Invalid keyword argument.");
-        }
 
-        if (node == nullptr || (!PyAstNode_Check(node)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::pushPathConstraint(): Expects an AstNode as first argument.");
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-        if (comment != nullptr && !PyStr_Check(comment))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::pushPathConstraint(): Expects a string as second argument.");
 
-        if (comment != nullptr)
-          ccomment = PyStr_AsString(comment);
+      static PyObject* TritonContext_saveSynthesisCache(PyObject* self, PyObject* path) {
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::saveSynthesisCache(): Expects a string as argument.");
 
         try {
-          PyTritonContext_AsTritonContext(self)->pushPathConstraint(PyAstNode_AsAstNode(node), ccomment);
+          PyTritonContext_AsTritonContext(self)->saveSynthesisCache(PyStr_AsString(path));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2570,52 +7698,41 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_removeCallback(PyObject* self, PyObject* args) {
-        PyObject* cb       = nullptr;
-        PyObject* cb_self  = nullptr;
-        PyObject* function = nullptr;
-        PyObject* mode     = nullptr;
+      static PyObject* TritonContext_setAdaptiveTimeoutBounds(PyObject* self, PyObject* args) {
+        PyObject* minTimeout = nullptr;
+        PyObject* maxTimeout = nullptr;
 
         /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &mode, &function) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::removeCallback(): Invalid number of arguments");
+        if (PyArg_ParseTuple(args, "|OO", &minTimeout, &maxTimeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setAdaptiveTimeoutBounds(): Invalid number of arguments");
         }
 
-        if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::removeCallback(): Expects a CALLBACK as first argument.");
-
-        if (function == nullptr || !PyCallable_Check(function))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::removeCallback(): Expects a function as second argument.");
+        if (minTimeout == nullptr || (!PyLong_Check(minTimeout) && !PyInt_Check(minTimeout)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setAdaptiveTimeoutBounds(): Expects an integer as first argument.");
 
-        /* Get the callback (class or static) */
-        if (PyMethod_Check(function)) {
-          cb_self = PyMethod_GET_SELF(function);
-          cb = PyMethod_GET_FUNCTION(function);
+        if (maxTimeout == nullptr || (!PyLong_Check(maxTimeout) && !PyInt_Check(maxTimeout)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setAdaptiveTimeoutBounds(): Expects an integer as second argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setAdaptiveTimeoutBounds(PyLong_AsUint32(minTimeout), PyLong_AsUint32(maxTimeout));
         }
-        else {
-          cb = function;
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setArchitecture(PyObject* self, PyObject* arg) {
+        if (!PyLong_Check(arg) && !PyInt_Check(arg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setArchitecture(): Expects an ARCH as argument.");
+
         try {
-          switch (static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode))) {
-            case callbacks::GET_CONCRETE_MEMORY_VALUE:
-              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::GET_CONCRETE_MEMORY_VALUE, callbacks::getConcreteMemoryValueCallback(nullptr, cb));
-              break;
-            case callbacks::GET_CONCRETE_REGISTER_VALUE:
-              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::GET_CONCRETE_REGISTER_VALUE, callbacks::getConcreteRegisterValueCallback(nullptr, cb));
-              break;
-            case callbacks::SET_CONCRETE_MEMORY_VALUE:
-              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SET_CONCRETE_MEMORY_VALUE, callbacks::setConcreteMemoryValueCallback(nullptr, cb));
-              break;
-            case callbacks::SET_CONCRETE_REGISTER_VALUE:
-              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SET_CONCRETE_REGISTER_VALUE, callbacks::setConcreteRegisterValueCallback(nullptr, cb));
-              break;
-            case callbacks::SYMBOLIC_SIMPLIFICATION:
-              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SYMBOLIC_SIMPLIFICATION, callbacks::symbolicSimplificationCallback(nullptr, cb));
-              break;
-            default:
-              return PyErr_Format(PyExc_TypeError, "TritonContext::removeCallback(): Invalid kind of callback.");
-          }
+          /* Set the architecture */
+          PyTritonContext_AsTritonContext(self)->setArchitecture(static_cast<triton::arch::architecture_e>(PyLong_AsUint32(arg)));
+          TritonContext_fillRegistersAttribute(self);
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2629,9 +7746,23 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_reset(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_setAstBudget(PyObject* self, PyObject* args) {
+        PyObject* maxNodes = nullptr;
+        PyObject* maxLevel = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &maxNodes, &maxLevel) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setAstBudget(): Invalid number of arguments");
+        }
+
+        if (maxNodes == nullptr || (!PyLong_Check(maxNodes) && !PyInt_Check(maxNodes)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setAstBudget(): Expects an integer as first argument.");
+
+        if (maxLevel == nullptr || (!PyLong_Check(maxLevel) && !PyInt_Check(maxLevel)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setAstBudget(): Expects an integer as second argument.");
+
         try {
-          PyTritonContext_AsTritonContext(self)->reset();
+          PyTritonContext_AsTritonContext(self)->setAstBudget(PyLong_AsUsize(maxNodes), PyLong_AsUint32(maxLevel));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2645,14 +7776,12 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_setArchitecture(PyObject* self, PyObject* arg) {
-        if (!PyLong_Check(arg) && !PyInt_Check(arg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setArchitecture(): Expects an ARCH as argument.");
+      static PyObject* TritonContext_setAstBudgetPolicy(PyObject* self, PyObject* policy) {
+        if (policy == nullptr || (!PyLong_Check(policy) && !PyInt_Check(policy)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setAstBudgetPolicy(): Expects a SYMBOLIC policy as argument.");
 
         try {
-          /* Set the architecture */
-          PyTritonContext_AsTritonContext(self)->setArchitecture(static_cast<triton::arch::architecture_e>(PyLong_AsUint32(arg)));
-          TritonContext_fillRegistersAttribute(self);
+          PyTritonContext_AsTritonContext(self)->setAstBudgetPolicy(static_cast<triton::engines::symbolic::budget_e>(PyLong_AsUint32(policy)));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2707,8 +7836,8 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Expects an integer as baseAddr keyword.");
         }
 
-        if (values == nullptr || (!PyList_Check(values) && !PyBytes_Check(values) && !PyByteArray_Check(values))) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Expects a list or bytes as values keyword.");
+        if (values == nullptr || (!PyList_Check(values) && !PyObject_CheckBuffer(values))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Expects a list or a bytes-like object as values keyword.");
         }
 
         if (execCallbacks != nullptr && !PyBool_Check(execCallbacks)) {
@@ -2741,41 +7870,29 @@ namespace triton {
           }
         }
 
-        // Python object: Bytes
-        else if (PyBytes_Check(values)) {
-          triton::uint8* area = reinterpret_cast<triton::uint8*>(PyBytes_AsString(values));
-          triton::usize  size = static_cast<triton::usize>(PyBytes_Size(values));
+        // Python object: bytes-like (bytes, bytearray, memoryview, mmap, array...), read in place
+        else {
+          Py_buffer view;
 
-          try {
-            PyTritonContext_AsTritonContext(self)->setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), area, size, PyLong_AsBool(execCallbacks));
-          }
-          catch (const triton::exceptions::PyCallbacks&) {
-            return nullptr;
+          if (PyObject_GetBuffer(values, &view, PyBUF_SIMPLE) != 0) {
+            PyErr_Clear();
+            return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Expects a contiguous bytes-like object as values keyword.");
           }
-          catch (const triton::exceptions::Exception& e) {
-            return PyErr_Format(PyExc_TypeError, "%s", e.what());
-          }
-        }
-
-        // Python object: ByteArray
-        else if (PyByteArray_Check(values)) {
-          triton::uint8* area = reinterpret_cast<triton::uint8*>(PyByteArray_AsString(values));
-          triton::usize  size = static_cast<triton::usize>(PyByteArray_Size(values));
 
           try {
-            PyTritonContext_AsTritonContext(self)->setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), area, size, PyLong_AsBool(execCallbacks));
+            PyTritonContext_AsTritonContext(self)->setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), view.buf, static_cast<triton::usize>(view.len), PyLong_AsBool(execCallbacks));
           }
           catch (const triton::exceptions::PyCallbacks&) {
+            PyBuffer_Release(&view);
             return nullptr;
           }
           catch (const triton::exceptions::Exception& e) {
+            PyBuffer_Release(&view);
             return PyErr_Format(PyExc_TypeError, "%s", e.what());
           }
-        }
 
-        // Invalid Python object
-        else
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Something wrong.");
+          PyBuffer_Release(&view);
+        }
 
         Py_INCREF(Py_None);
         return Py_None;
@@ -2858,6 +7975,28 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_setConcreteRegisterFile(PyObject* self, PyObject* file) {
+        if (file == nullptr || (!PyBytes_Check(file) && !PyByteArray_Check(file)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteRegisterFile(): Expects bytes as argument.");
+
+        try {
+          if (PyBytes_Check(file))
+            PyTritonContext_AsTritonContext(self)->setConcreteRegisterFile(reinterpret_cast<triton::uint8*>(PyBytes_AsString(file)), static_cast<triton::usize>(PyBytes_Size(file)));
+          else
+            PyTritonContext_AsTritonContext(self)->setConcreteRegisterFile(reinterpret_cast<triton::uint8*>(PyByteArray_AsString(file)), static_cast<triton::usize>(PyByteArray_Size(file)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_setConcreteRegisterValue(PyObject* self, PyObject* args, PyObject* kwargs) {
         PyObject* reg           = nullptr;
         PyObject* value         = nullptr;
@@ -2907,23 +8046,278 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_setConcreteVariableValue(PyObject* self, PyObject* args) {
-        PyObject* symVar = nullptr;
-        PyObject* value  = nullptr;
+      static PyObject* TritonContext_setConcreteVariableValue(PyObject* self, PyObject* args) {
+        PyObject* symVar = nullptr;
+        PyObject* value  = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &symVar, &value) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteVariableValue(): Invalid number of arguments");
+        }
+
+        if (symVar == nullptr || !PySymbolicVariable_Check(symVar))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteVariableValue(): Bad argument type.");
+
+        if (value == nullptr)
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteVariableValue(): Expects a second argument as integer value.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setConcreteVariableValue(PySymbolicVariable_AsSymbolicVariable(symVar), PyLong_AsUint512(value));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setFunctionSummaries(PyObject* self, PyObject* args) {
+        std::map<std::string, triton::uint64> symbols;
+        PyObject* base    = nullptr;
+        PyObject* key     = nullptr;
+        PyObject* msAbi   = nullptr;
+        PyObject* offsets = nullptr;
+        PyObject* value   = nullptr;
+        Py_ssize_t pos    = 0;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &base, &offsets, &msAbi) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setFunctionSummaries(): Invalid number of arguments");
+        }
+
+        if (base == nullptr || (!PyLong_Check(base) && !PyInt_Check(base)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setFunctionSummaries(): Expects an integer as first argument.");
+
+        if (offsets == nullptr || !PyDict_Check(offsets))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setFunctionSummaries(): Expects a dict as second argument.");
+
+        if (msAbi != nullptr && !PyBool_Check(msAbi))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setFunctionSummaries(): Expects a boolean as third argument.");
+
+        while (PyDict_Next(offsets, &pos, &key, &value)) {
+          if (!PyStr_Check(key) || (!PyLong_Check(value) && !PyInt_Check(value)))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::setFunctionSummaries(): Expects a dict of {string : integer}.");
+          symbols[PyStr_AsString(key)] = PyLong_AsUint64(value);
+        }
+
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->setFunctionSummaries(PyLong_AsUint64(base), symbols, msAbi != nullptr && PyLong_AsBool(msAbi)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_setFunctionSummary(PyObject* self, PyObject* args) {
+        PyObject* addr  = nullptr;
+        PyObject* msAbi = nullptr;
+        PyObject* name  = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &addr, &name, &msAbi) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setFunctionSummary(): Invalid number of arguments");
+        }
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setFunctionSummary(): Expects an integer as first argument.");
+
+        if (name == nullptr || !PyStr_Check(name))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setFunctionSummary(): Expects a string as second argument.");
+
+        if (msAbi != nullptr && !PyBool_Check(msAbi))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setFunctionSummary(): Expects a boolean as third argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setFunctionSummary(PyLong_AsUint64(addr), PyStr_AsString(name), msAbi != nullptr && PyLong_AsBool(msAbi));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setLoopUnrollBound(PyObject* self, PyObject* bound) {
+        if (!PyLong_Check(bound) && !PyInt_Check(bound))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setLoopUnrollBound(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setLoopUnrollBound(PyLong_AsUsize(bound));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setMergeDistance(PyObject* self, PyObject* distance) {
+        if (!PyLong_Check(distance) && !PyInt_Check(distance))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setMergeDistance(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setMergeDistance(PyLong_AsUsize(distance));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setMode(PyObject* self, PyObject* args) {
+        PyObject* mode = nullptr;
+        PyObject* flag = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &mode, &flag) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setMode(): Invalid number of arguments");
+        }
+
+        if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setMode(): Expects a MODE as argument.");
+
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setMode(): Expects an boolean flag as second argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setMode(static_cast<triton::modes::mode_e>(PyLong_AsUint32(mode)), PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setPathConstraintsWindow(PyObject* self, PyObject* size) {
+        if (!PyLong_Check(size) && !PyInt_Check(size))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setPathConstraintsWindow(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setPathConstraintsWindow(PyLong_AsUsize(size));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+      static PyObject* TritonContext_setPointerResolutionBound(PyObject* self, PyObject* bound) {
+        if (!PyLong_Check(bound) && !PyInt_Check(bound))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setPointerResolutionBound(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setPointerResolutionBound(PyLong_AsUsize(bound));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setProgramBreak(PyObject* self, PyObject* addr) {
+        if (!PyLong_Check(addr) && !PyInt_Check(addr))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setProgramBreak(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setProgramBreak(PyLong_AsUint64(addr));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setQueryConfiguration(PyObject* self, PyObject* args) {
+        triton::engines::solver::SolverConfiguration cconfig;
+        PyObject* query  = nullptr;
+        PyObject* config = nullptr;
 
         /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &symVar, &value) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteVariableValue(): Invalid number of arguments");
+        if (PyArg_ParseTuple(args, "|OO", &query, &config) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setQueryConfiguration(): Invalid number of arguments");
         }
 
-        if (symVar == nullptr || !PySymbolicVariable_Check(symVar))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteVariableValue(): Bad argument type.");
+        if (query == nullptr || (!PyLong_Check(query) && !PyInt_Check(query)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setQueryConfiguration(): Expects a QUERY as first argument.");
 
-        if (value == nullptr)
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteVariableValue(): Expects a second argument as integer value.");
+        if (config == nullptr || !PyDict_Check(config))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setQueryConfiguration(): Expects a dictionary as second argument.");
+
+        PyObject* key   = nullptr;
+        PyObject* value = nullptr;
+        Py_ssize_t pos  = 0;
+
+        while (PyDict_Next(config, &pos, &key, &value)) {
+          if (!PyStr_Check(key))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::setQueryConfiguration(): Expects strings as keys.");
+
+          std::string name = PyStr_AsString(key);
+          if (name == "rewriteLevel") {
+            if (!PyLong_Check(value) && !PyInt_Check(value))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::setQueryConfiguration(): Expects an integer as rewriteLevel.");
+            cconfig.rewriteLevel = static_cast<triton::sint32>(PyLong_AsLong(value));
+          }
+          else if (name == "logic" || name == "satSolver" || name == "tactics") {
+            if (!PyStr_Check(value))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::setQueryConfiguration(): Expects a string as %s.", name.c_str());
+            std::string& field = (name == "logic") ? cconfig.logic : (name == "satSolver") ? cconfig.satSolver : cconfig.tactics;
+            field = PyStr_AsString(value);
+          }
+          else {
+            return PyErr_Format(PyExc_TypeError, "TritonContext::setQueryConfiguration(): Unknown item %s.", name.c_str());
+          }
+        }
 
         try {
-          PyTritonContext_AsTritonContext(self)->setConcreteVariableValue(PySymbolicVariable_AsSymbolicVariable(symVar), PyLong_AsUint512(value));
+          PyTritonContext_AsTritonContext(self)->setQueryConfiguration(static_cast<triton::engines::solver::query_e>(PyLong_AsUint32(query)), cconfig);
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2936,27 +8330,21 @@ namespace triton {
         return Py_None;
       }
 
+      static PyObject* TritonContext_setRemoteSolver(PyObject* self, PyObject* endpoints) {
+        std::vector<std::string> ret;
 
-      static PyObject* TritonContext_setMode(PyObject* self, PyObject* args) {
-        PyObject* mode = nullptr;
-        PyObject* flag = nullptr;
+        if (endpoints == nullptr || !PyList_Check(endpoints))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setRemoteSolver(): Expects a list of strings as argument.");
 
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &mode, &flag) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setMode(): Invalid number of arguments");
+        for (Py_ssize_t i = 0; i < PyList_Size(endpoints); i++) {
+          PyObject* item = PyList_GetItem(endpoints, i);
+          if (!PyStr_Check(item))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::setRemoteSolver(): Each item of the list must be a string.");
+          ret.push_back(PyStr_AsString(item));
         }
 
-        if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setMode(): Expects a MODE as argument.");
-
-        if (flag == nullptr || !PyBool_Check(flag))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setMode(): Expects an boolean flag as second argument.");
-
         try {
-          PyTritonContext_AsTritonContext(self)->setMode(static_cast<triton::modes::mode_e>(PyLong_AsUint32(mode)), PyLong_AsBool(flag));
-        }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+          PyTritonContext_AsTritonContext(self)->setRemoteSolver(ret);
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2966,7 +8354,6 @@ namespace triton {
         return Py_None;
       }
 
-
       static PyObject* TritonContext_setSolver(PyObject* self, PyObject* solver) {
         if (solver == nullptr || (!PyLong_Check(solver) && !PyInt_Check(solver)))
           return PyErr_Format(PyExc_TypeError, "TritonContext::setSolver(): Expects a SOLVER as argument.");
@@ -3015,6 +8402,65 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_setSyscallHandler(PyObject* self, PyObject* args) {
+        PyObject* number   = nullptr;
+        PyObject* function = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &number, &function) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSyscallHandler(): Invalid number of arguments");
+        }
+
+        if (number == nullptr || (!PyLong_Check(number) && !PyInt_Check(number)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSyscallHandler(): Expects an integer as first argument.");
+
+        if (function == nullptr || !PyCallable_Check(function))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSyscallHandler(): Expects a function as second argument.");
+
+        try {
+          /* The handler outlives the call, keep a reference on the function */
+          Py_INCREF(function);
+          PyTritonContext_AsTritonContext(self)->setSyscallHandler(PyLong_AsUint64(number), [function](triton::Context& ctx, triton::uint64 number) {
+            /********* Lambda *********/
+            triton::bindings::python::PyAcquireGil gil;
+            PyObject* args = triton::bindings::python::xPyTuple_New(2);
+            PyTuple_SetItem(args, 0, triton::bindings::python::PyTritonContextRef(ctx));
+            PyTuple_SetItem(args, 1, triton::bindings::python::PyLong_FromUint64(number));
+
+            /* Call the handler */
+            PyObject* ret = PyObject_CallObject(function, args);
+
+            /* Release args */
+            Py_DECREF(args);
+
+            /* Check the call */
+            if (ret == nullptr) {
+              throw triton::exceptions::PyCallbacks();
+            }
+
+            if (!PyLong_Check(ret) && !PyInt_Check(ret)) {
+              Py_DECREF(ret);
+              throw triton::exceptions::Callbacks("TritonContext::setSyscallHandler(): The handler must return an integer.");
+            }
+
+            triton::uint64 result = PyLong_AsUint64(ret);
+            Py_DECREF(ret);
+            return result;
+            /********* End of lambda *********/
+          });
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_setTaintMemory(PyObject* self, PyObject* args) {
         PyObject* mem  = nullptr;
         PyObject* flag = nullptr;
@@ -3089,6 +8535,67 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_setTimeoutRetryCallback(PyObject* self, PyObject* args) {
+        PyObject* function = nullptr;
+        PyObject* retries  = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &function, &retries) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setTimeoutRetryCallback(): Invalid number of arguments");
+        }
+
+        if (function == nullptr || (function != Py_None && !PyCallable_Check(function)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setTimeoutRetryCallback(): Expects a function or None as first argument.");
+
+        if (retries != nullptr && (!PyLong_Check(retries) && !PyInt_Check(retries)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setTimeoutRetryCallback(): Expects an integer as second argument.");
+
+        try {
+          triton::uint32 count = (retries != nullptr) ? PyLong_AsUint32(retries) : 2;
+
+          if (function == Py_None) {
+            PyTritonContext_AsTritonContext(self)->setTimeoutRetryCallback(nullptr, count);
+          }
+          else {
+            /* The callback outlives the call, keep a reference on the function */
+            Py_INCREF(function);
+            PyTritonContext_AsTritonContext(self)->setTimeoutRetryCallback([function](const triton::ast::SharedAbstractNode& node, triton::uint32 timeout) {
+              /********* Lambda *********/
+              triton::bindings::python::PyAcquireGil gil;
+              PyObject* args = triton::bindings::python::xPyTuple_New(2);
+              PyTuple_SetItem(args, 0, triton::bindings::python::PyAstNode(node));
+              PyTuple_SetItem(args, 1, triton::bindings::python::PyLong_FromUint32(timeout));
+
+              /* Call the callback */
+              PyObject* ret = PyObject_CallObject(function, args);
+
+              /* Release args */
+              Py_DECREF(args);
+
+              /* Check the call */
+              if (ret == nullptr) {
+                throw triton::exceptions::PyCallbacks();
+              }
+
+              bool retry = (PyObject_IsTrue(ret) == 1);
+              Py_DECREF(ret);
+              return retry;
+              /********* End of lambda *********/
+            }, count);
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_simplify(PyObject* self, PyObject* args, PyObject* kwargs) {
         PyObject* obj     = nullptr;
         PyObject* solver  = nullptr;
@@ -3108,8 +8615,8 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "TritonContext::simplify(): Invalid number of arguments");
         }
 
-        if (obj == nullptr || (!PyAstNode_Check(obj) && !PyBasicBlock_Check(obj)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::simplify(): Expects a AstNode or a BasicBlock as obj argument.");
+        if (obj == nullptr || (!PyAstNode_Check(obj) && !PyBasicBlock_Check(obj) && !PyList_Check(obj)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::simplify(): Expects a AstNode, a list of AstNode, a BasicBlock or a list of BasicBlock as obj argument.");
 
         if (solver != nullptr && !PyBool_Check(solver))
           return PyErr_Format(PyExc_TypeError, "TritonContext::simplify(): Expects a boolean as solver argument.");
@@ -3120,24 +8627,308 @@ namespace triton {
         if (padding != nullptr && !PyBool_Check(padding))
           return PyErr_Format(PyExc_TypeError, "TritonContext::simplify(): Expects a boolean as padding argument.");
 
-        if (solver == nullptr)
-          solver = PyLong_FromUint32(false);
+        if (solver == nullptr)
+          solver = PyLong_FromUint32(false);
+
+        if (llvm == nullptr)
+          llvm = PyLong_FromUint32(false);
+
+        if (padding == nullptr)
+          padding = PyLong_FromUint32(false);
+
+        try {
+          bool usingSolver = PyLong_AsBool(solver);
+          bool usingLLVM   = PyLong_AsBool(llvm);
+
+          if (PyAstNode_Check(obj)) {
+            triton::ast::SharedAbstractNode node = PyAstNode_AsAstNode(obj);
+            {
+              triton::bindings::python::PyAllowThreads allow;
+              node = PyTritonContext_AsTritonContext(self)->simplify(node, usingSolver, usingLLVM);
+            }
+            return PyAstNode(node);
+          }
+
+          else if (PyBasicBlock_Check(obj))
+            return PyBasicBlock(PyTritonContext_AsTritonContext(self)->simplify(*PyBasicBlock_AsBasicBlock(obj), PyLong_AsBool(padding)));
+
+          else if (PyList_Check(obj) && PyList_Size(obj) > 0 && PyBasicBlock_Check(PyList_GetItem(obj, 0))) {
+            std::vector<triton::arch::BasicBlock> region;
+            for (Py_ssize_t i = 0; i < PyList_Size(obj); i++) {
+              PyObject* item = PyList_GetItem(obj, i);
+              if (!PyBasicBlock_Check(item))
+                return PyErr_Format(PyExc_TypeError, "TritonContext::simplify(): Each item of the list must be a BasicBlock.");
+              region.push_back(*PyBasicBlock_AsBasicBlock(item));
+            }
+
+            std::vector<triton::arch::BasicBlock> simplified = PyTritonContext_AsTritonContext(self)->simplify(region, PyLong_AsBool(padding));
+            PyObject* ret = xPyList_New(simplified.size());
+            for (triton::usize i = 0; i < simplified.size(); i++)
+              PyList_SetItem(ret, i, PyBasicBlock(simplified[i]));
+            return ret;
+          }
+
+          else if (PyList_Check(obj)) {
+            std::vector<triton::ast::SharedAbstractNode> nodes;
+            for (Py_ssize_t i = 0; i < PyList_Size(obj); i++) {
+              PyObject* item = PyList_GetItem(obj, i);
+              if (!PyAstNode_Check(item))
+                return PyErr_Format(PyExc_TypeError, "TritonContext::simplify(): Each item of the list must be a AstNode.");
+              nodes.push_back(PyAstNode_AsAstNode(item));
+            }
+
+            std::vector<triton::ast::SharedAbstractNode> simplified;
+            {
+              triton::bindings::python::PyAllowThreads allow;
+              simplified = PyTritonContext_AsTritonContext(self)->simplify(nodes, usingSolver, usingLLVM);
+            }
+            PyObject* ret = xPyList_New(simplified.size());
+            for (triton::usize i = 0; i < simplified.size(); i++)
+              PyList_SetItem(ret, i, PyAstNode(simplified[i]));
+            return ret;
+          }
+
+          else
+            return PyErr_Format(PyExc_TypeError, "TritonContext::simplify(): Something wrong.");
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_sliceExpressions(PyObject* self, PyObject* expr) {
+        std::vector<triton::engines::symbolic::SharedSymbolicExpression> roots;
+        PyObject* ret = nullptr;
+
+        if (PyList_Check(expr)) {
+          for (Py_ssize_t i = 0; i < PyList_Size(expr); i++) {
+            PyObject* item = PyList_GetItem(expr, i);
+            if (!PySymbolicExpression_Check(item))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::sliceExpressions(): Each item of the list must be a SymbolicExpression.");
+            roots.push_back(PySymbolicExpression_AsSymbolicExpression(item));
+          }
+        }
+        else if (PySymbolicExpression_Check(expr)) {
+          roots.push_back(PySymbolicExpression_AsSymbolicExpression(expr));
+        }
+        else {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::sliceExpressions(): Expects a SymbolicExpression or a list of SymbolicExpression as argument.");
+        }
+
+        try {
+          auto exprs = PyTritonContext_AsTritonContext(self)->sliceExpressions(roots);
+
+          ret = xPyDict_New();
+          for (auto it = exprs.begin(); it != exprs.end(); it++)
+            xPyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicExpression(it->second));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_snapshot(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->snapshot());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_solveAllBranchFlips(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::uint32 timeout_c = 0;
+        triton::usize threads_c  = 0;
+
+        PyObject* callback = nullptr;
+        PyObject* ret      = nullptr;
+        PyObject* threadId = nullptr;
+        PyObject* threads  = nullptr;
+        PyObject* timeout  = nullptr;
+
+        static char* keywords[] = {
+          (char*)"threads",
+          (char*)"timeout",
+          (char*)"callback",
+          (char*)"threadId",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOO", keywords, &threads, &timeout, &callback, &threadId) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::solveAllBranchFlips(): Invalid keyword argument.");
+        }
+
+        if (threads != nullptr && (!PyLong_Check(threads) && !PyInt_Check(threads))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::solveAllBranchFlips(): Expects an integer as threads keyword.");
+        }
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::solveAllBranchFlips(): Expects an integer as timeout keyword.");
+        }
+
+        if (callback != nullptr && callback != Py_None && !PyCallable_Check(callback)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::solveAllBranchFlips(): Expects a function as callback keyword.");
+        }
+
+        if (threadId != nullptr && threadId != Py_None && (!PyLong_Check(threadId) && !PyInt_Check(threadId))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::solveAllBranchFlips(): Expects an integer as threadId keyword.");
+        }
+
+        if (threads != nullptr) {
+          threads_c = PyLong_AsUsize(threads);
+        }
+
+        if (timeout != nullptr) {
+          timeout_c = PyLong_AsUint32(timeout);
+        }
+
+        auto toDict = [](const triton::engines::symbolic::BranchFlip& flip) {
+          PyObject* model = xPyDict_New();
+          for (auto it = flip.model.begin(); it != flip.model.end(); it++) {
+            xPyDict_SetItem(model, PyLong_FromUsize(it->first), PySolverModel(it->second));
+          }
+
+          PyObject* dict = xPyDict_New();
+          xPyDict_SetItemString(dict, "index",       PyLong_FromUsize(flip.index));
+          xPyDict_SetItemString(dict, "srcAddr",     PyLong_FromUint64(flip.srcAddr));
+          xPyDict_SetItemString(dict, "dstAddr",     PyLong_FromUint64(flip.dstAddr));
+          xPyDict_SetItemString(dict, "status",      PyLong_FromUint32(flip.status));
+          xPyDict_SetItemString(dict, "model",       model);
+          xPyDict_SetItemString(dict, "solvingTime", PyLong_FromUint32(flip.solvingTime));
+          return dict;
+        };
+
+        try {
+          std::function<void(const triton::engines::symbolic::BranchFlip&)> cb = nullptr;
+          if (callback != nullptr && callback != Py_None) {
+            cb = [callback, &toDict](const triton::engines::symbolic::BranchFlip& flip) {
+              triton::bindings::python::PyAcquireGil gil;
+              PyObject* dict = toDict(flip);
+              PyObject* res  = PyObject_CallFunctionObjArgs(callback, dict, nullptr);
+
+              Py_DECREF(dict);
+              if (res == nullptr) {
+                throw triton::exceptions::PyCallbacks();
+              }
+              Py_DECREF(res);
+            };
+          }
+
+          std::vector<triton::engines::symbolic::BranchFlip> flips;
+          if (threadId != nullptr && threadId != Py_None)
+            flips = PyTritonContext_AsTritonContext(self)->solveAllBranchFlipsOfThread(PyLong_AsUint32(threadId), threads_c, timeout_c, cb);
+          else
+            flips = PyTritonContext_AsTritonContext(self)->solveAllBranchFlips(threads_c, timeout_c, cb);
+
+          ret = xPyList_New(flips.size());
+          for (triton::usize index = 0; index < flips.size(); index++) {
+            PyList_SetItem(ret, index, toDict(flips[index]));
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+      static PyObject* TritonContext_startSmtStream(PyObject* self, PyObject* path) {
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::startSmtStream(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->startSmtStream(std::string(PyStr_AsString(path)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_startTimeoutRound(PyObject* self, PyObject* budget) {
+        if (budget == nullptr || (!PyLong_Check(budget) && !PyInt_Check(budget)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::startTimeoutRound(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->startTimeoutRound(PyLong_AsUint64(budget));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_stepBack(PyObject* self, PyObject* args) {
+        PyObject* count = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|O", &count) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::stepBack(): Invalid number of arguments");
+        }
+
+        if (count != nullptr && (!PyLong_Check(count) && !PyInt_Check(count)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::stepBack(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->stepBack(count != nullptr ? PyLong_AsUsize(count) : 1);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+      static PyObject* TritonContext_stopSmtStream(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->stopSmtStream();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-        if (llvm == nullptr)
-          llvm = PyLong_FromUint32(false);
 
-        if (padding == nullptr)
-          padding = PyLong_FromUint32(false);
+      static PyObject* TritonContext_summarizePathConstraints(PyObject* self, PyObject* count) {
+        if (!PyLong_Check(count) && !PyInt_Check(count))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::summarizePathConstraints(): Expects an integer as argument.");
 
         try {
-          if (PyAstNode_Check(obj))
-            return PyAstNode(PyTritonContext_AsTritonContext(self)->simplify(PyAstNode_AsAstNode(obj), PyLong_AsBool(solver), PyLong_AsBool(llvm)));
-
-          else if (PyBasicBlock_Check(obj))
-            return PyBasicBlock(PyTritonContext_AsTritonContext(self)->simplify(*PyBasicBlock_AsBasicBlock(obj), PyLong_AsBool(padding)));
-
-          else
-            return PyErr_Format(PyExc_TypeError, "TritonContext::simplify(): Something wrong.");
+          PyTritonContext_AsTritonContext(self)->summarizePathConstraints(PyLong_AsUsize(count));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -3145,21 +8936,41 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
+      static PyObject* TritonContext_symbolizeBuffer(PyObject* self, PyObject* args) {
+        PyObject* addr        = nullptr;
+        PyObject* size        = nullptr;
+        PyObject* symVarAlias = nullptr;
+        PyObject* ret         = nullptr;
+        std::string calias    = "";
 
-      static PyObject* TritonContext_sliceExpressions(PyObject* self, PyObject* expr) {
-        PyObject* ret = nullptr;
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &addr, &size, &symVarAlias) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::symbolizeBuffer(): Invalid number of arguments");
+        }
 
-        if (!PySymbolicExpression_Check(expr))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::sliceExpressions(): Expects a SymbolicExpression as argument.");
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::symbolizeBuffer(): Expects an integer as first argument.");
 
-        try {
-          auto exprs = PyTritonContext_AsTritonContext(self)->sliceExpressions(PySymbolicExpression_AsSymbolicExpression(expr));
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::symbolizeBuffer(): Expects an integer as second argument.");
 
-          ret = xPyDict_New();
-          for (auto it = exprs.begin(); it != exprs.end(); it++)
-            xPyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicExpression(it->second));
+        if (symVarAlias != nullptr && !PyStr_Check(symVarAlias))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::symbolizeBuffer(): Expects a sting as third argument.");
+
+        if (symVarAlias != nullptr)
+          calias = PyStr_AsString(symVarAlias);
+
+        try {
+          auto buffer = PyTritonContext_AsTritonContext(self)->symbolizeBuffer(PyLong_AsUint64(addr), PyLong_AsUsize(size), calias);
+          ret = xPyList_New(buffer.size());
+          for (triton::usize index = 0; index < buffer.size(); index++)
+            PyList_SetItem(ret, index, PySymbolicVariable(buffer[index]));
+          return ret;
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -3167,8 +8978,6 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-
-        return ret;
       }
 
 
@@ -3274,17 +9083,19 @@ namespace triton {
         PyObject* constant = nullptr;
         PyObject* subexpr  = nullptr;
         PyObject* opaque   = nullptr;
+        PyObject* threads  = nullptr;
 
         static char* keywords[] = {
           (char*)"node",
           (char*)"constant",
           (char*)"subexpr",
           (char*)"opaque",
+          (char*)"threads",
           nullptr
         };
 
         /* Extract keywords */
-        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOO", keywords, &node, &constant, &subexpr, &opaque) == false) {
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOOO", keywords, &node, &constant, &subexpr, &opaque, &threads) == false) {
           return PyErr_Format(PyExc_TypeError, "TritonContext::synthesize(): Invalid number of arguments");
         }
 
@@ -3300,6 +9111,9 @@ namespace triton {
         if (opaque != nullptr && !PyBool_Check(opaque))
           return PyErr_Format(PyExc_TypeError, "TritonContext::synthesize(): Expects a boolean as opaque argument.");
 
+        if (threads != nullptr && (!PyLong_Check(threads) && !PyInt_Check(threads)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::synthesize(): Expects an integer as threads argument.");
+
         if (constant == nullptr)
           constant = PyLong_FromUint32(true);
 
@@ -3309,8 +9123,20 @@ namespace triton {
         if (opaque == nullptr)
           opaque = PyLong_FromUint32(false);
 
+        if (threads == nullptr)
+          threads = PyLong_FromUint32(1);
+
         try {
-          auto result = PyTritonContext_AsTritonContext(self)->synthesize(PyAstNode_AsAstNode(node), PyLong_AsBool(constant), PyLong_AsBool(subexpr), PyLong_AsBool(opaque));
+          triton::ast::SharedAbstractNode ast = PyAstNode_AsAstNode(node);
+          triton::engines::synthesis::SynthesisResult result;
+          bool constant_c   = PyLong_AsBool(constant);
+          bool subexpr_c    = PyLong_AsBool(subexpr);
+          bool opaque_c     = PyLong_AsBool(opaque);
+          triton::usize threads_c = PyLong_AsUsize(threads);
+          {
+            triton::bindings::python::PyAllowThreads allow;
+            result = PyTritonContext_AsTritonContext(self)->synthesize(ast, constant_c, subexpr_c, opaque_c, threads_c);
+          }
           if (result.successful()) {
             return PyAstNode(result.getOutput());
           }
@@ -3328,6 +9154,63 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_synthesizeByEnumeration(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* node    = nullptr;
+        PyObject* maxSize = nullptr;
+        PyObject* timeout = nullptr;
+        PyObject* threads = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"maxSize",
+          (char*)"timeout",
+          (char*)"threads",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOO", keywords, &node, &maxSize, &timeout, &threads) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::synthesizeByEnumeration(): Invalid number of arguments");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::synthesizeByEnumeration(): Expects a AstNode as node argument.");
+
+        if (maxSize != nullptr && (!PyLong_Check(maxSize) && !PyInt_Check(maxSize)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::synthesizeByEnumeration(): Expects an integer as maxSize argument.");
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::synthesizeByEnumeration(): Expects an integer as timeout argument.");
+
+        if (threads != nullptr && (!PyLong_Check(threads) && !PyInt_Check(threads)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::synthesizeByEnumeration(): Expects an integer as threads argument.");
+
+        try {
+          triton::ast::SharedAbstractNode ast = PyAstNode_AsAstNode(node);
+          triton::engines::synthesis::SynthesisResult result;
+          triton::usize maxSize_c = maxSize ? PyLong_AsUsize(maxSize) : 7;
+          triton::usize timeout_c = timeout ? PyLong_AsUsize(timeout) : 1000;
+          triton::usize threads_c = threads ? PyLong_AsUsize(threads) : 1;
+          {
+            triton::bindings::python::PyAllowThreads allow;
+            result = PyTritonContext_AsTritonContext(self)->synthesizeByEnumeration(ast, maxSize_c, timeout_c, threads_c);
+          }
+          if (result.successful()) {
+            return PyAstNode(result.getOutput());
+          }
+          else {
+            Py_INCREF(Py_None);
+            return Py_None;
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
       static PyObject* TritonContext_taintAssignment(PyObject* self, PyObject* args) {
         PyObject* op1 = nullptr;
         PyObject* op2 = nullptr;
@@ -3374,15 +9257,27 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_taintMemory(PyObject* self, PyObject* mem) {
+      static PyObject* TritonContext_taintMemory(PyObject* self, PyObject* args) {
+        PyObject* mem  = nullptr;
+        PyObject* size = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &mem, &size) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintMemory(): Invalid number of arguments");
+        }
+
+        if (size != nullptr && (!PyLong_Check(size) && !PyInt_Check(size))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintMemory(): Expects an integer as second argument.");
+        }
+
         try {
-          if (PyMemoryAccess_Check(mem)) {
+          if (mem != nullptr && PyMemoryAccess_Check(mem)) {
             if (PyTritonContext_AsTritonContext(self)->taintMemory(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
               Py_RETURN_TRUE;
           }
 
-          else if (PyLong_Check(mem) || PyInt_Check(mem)) {
-            if (PyTritonContext_AsTritonContext(self)->taintMemory(PyLong_AsUint64(mem)) == true)
+          else if (mem != nullptr && (PyLong_Check(mem) || PyInt_Check(mem))) {
+            if (PyTritonContext_AsTritonContext(self)->taintMemory(PyLong_AsUint64(mem), size != nullptr ? PyLong_AsUsize(size) : 1) == true)
               Py_RETURN_TRUE;
           }
 
@@ -3399,6 +9294,73 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_taintMemoryRange(PyObject* self, PyObject* args) {
+        PyObject* addr = nullptr;
+        PyObject* size = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &addr, &size) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintMemoryRange(): Invalid number of arguments");
+        }
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintMemoryRange(): Expects an integer as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintMemoryRange(): Expects an integer as second argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->taintMemoryRange(PyLong_AsUint64(addr), PyLong_AsUsize(size)) == true)
+            Py_RETURN_TRUE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+        Py_RETURN_FALSE;
+      }
+
+      static PyObject* TritonContext_taintMemoryWithLabel(PyObject* self, PyObject* args) {
+        PyObject* mem   = nullptr;
+        PyObject* arg1  = nullptr;
+        PyObject* arg2  = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &mem, &arg1, &arg2) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintMemoryWithLabel(): Invalid number of arguments");
+        }
+
+        try {
+          if (mem != nullptr && PyMemoryAccess_Check(mem)) {
+            if (arg1 == nullptr || arg2 != nullptr || (!PyLong_Check(arg1) && !PyInt_Check(arg1)))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::taintMemoryWithLabel(): Expects an integer label as second argument.");
+            if (PyTritonContext_AsTritonContext(self)->taintMemoryWithLabel(*PyMemoryAccess_AsMemoryAccess(mem), PyLong_AsUint32(arg1)) == true)
+              Py_RETURN_TRUE;
+          }
+
+          else if (mem != nullptr && (PyLong_Check(mem) || PyInt_Check(mem))) {
+            if (arg1 == nullptr || (!PyLong_Check(arg1) && !PyInt_Check(arg1)))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::taintMemoryWithLabel(): Expects an integer size as second argument.");
+            if (arg2 == nullptr || (!PyLong_Check(arg2) && !PyInt_Check(arg2)))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::taintMemoryWithLabel(): Expects an integer label as third argument.");
+            if (PyTritonContext_AsTritonContext(self)->taintMemoryWithLabel(PyLong_AsUint64(mem), PyLong_AsUsize(arg1), PyLong_AsUint32(arg2)) == true)
+              Py_RETURN_TRUE;
+          }
+
+          else
+            return PyErr_Format(PyExc_TypeError, "TritonContext::taintMemoryWithLabel(): Expects a MemoryAccess or an integer as first argument.");
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+        Py_RETURN_FALSE;
+      }
+
       static PyObject* TritonContext_taintRegister(PyObject* self, PyObject* reg) {
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "TritonContext::taintRegister(): Expects a Register as argument.");
@@ -3417,6 +9379,74 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_taintRegisterWithLabel(PyObject* self, PyObject* args) {
+        PyObject* reg   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &reg, &label) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintRegisterWithLabel(): Invalid number of arguments");
+        }
+
+        if (reg == nullptr || !PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintRegisterWithLabel(): Expects a Register as first argument.");
+
+        if (label == nullptr || (!PyLong_Check(label) && !PyInt_Check(label)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintRegisterWithLabel(): Expects an integer as second argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->taintRegisterWithLabel(*PyRegister_AsRegister(reg), PyLong_AsUint32(label)) == true)
+            Py_RETURN_TRUE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+        Py_RETURN_FALSE;
+      }
+
+      static PyObject* TritonContext_taintTrace(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* path      = nullptr;
+        PyObject* chunkSize = nullptr;
+        PyObject* threads   = nullptr;
+
+        static char* keywords[] = {
+          (char*)"path",
+          (char*)"chunkSize",
+          (char*)"threads",
+          nullptr
+        };
+
+        /* Extract arguments */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOO", keywords, &path, &chunkSize, &threads) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintTrace(): Invalid keyword argument");
+        }
+
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintTrace(): Expects a string as path.");
+
+        if (chunkSize != nullptr && !PyLong_Check(chunkSize) && !PyInt_Check(chunkSize))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintTrace(): Expects an integer as chunkSize.");
+
+        if (threads != nullptr && !PyLong_Check(threads) && !PyInt_Check(threads))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintTrace(): Expects an integer as threads.");
+
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->taintTrace(PyStr_AsString(path),
+                                                                                    chunkSize != nullptr ? PyLong_AsUsize(chunkSize) : 0x10000,
+                                                                                    threads != nullptr ? PyLong_AsUint32(threads) : 0));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_taintUnion(PyObject* self, PyObject* args) {
         PyObject* op1 = nullptr;
         PyObject* op2 = nullptr;
@@ -3463,15 +9493,27 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_untaintMemory(PyObject* self, PyObject* mem) {
+      static PyObject* TritonContext_untaintMemory(PyObject* self, PyObject* args) {
+        PyObject* mem  = nullptr;
+        PyObject* size = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &mem, &size) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::untaintMemory(): Invalid number of arguments");
+        }
+
+        if (size != nullptr && (!PyLong_Check(size) && !PyInt_Check(size))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::untaintMemory(): Expects an integer as second argument.");
+        }
+
         try {
-          if (PyMemoryAccess_Check(mem)) {
+          if (mem != nullptr && PyMemoryAccess_Check(mem)) {
             if (PyTritonContext_AsTritonContext(self)->untaintMemory(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
               Py_RETURN_TRUE;
           }
 
-          else if (PyLong_Check(mem) || PyInt_Check(mem)) {
-            if (PyTritonContext_AsTritonContext(self)->untaintMemory(PyLong_AsUint64(mem)) == true)
+          else if (mem != nullptr && (PyLong_Check(mem) || PyInt_Check(mem))) {
+            if (PyTritonContext_AsTritonContext(self)->untaintMemory(PyLong_AsUint64(mem), size != nullptr ? PyLong_AsUsize(size) : 1) == true)
               Py_RETURN_TRUE;
           }
 
@@ -3488,6 +9530,34 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_untaintMemoryRange(PyObject* self, PyObject* args) {
+        PyObject* addr = nullptr;
+        PyObject* size = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &addr, &size) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::untaintMemoryRange(): Invalid number of arguments");
+        }
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::untaintMemoryRange(): Expects an integer as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::untaintMemoryRange(): Expects an integer as second argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->untaintMemoryRange(PyLong_AsUint64(addr), PyLong_AsUsize(size)) == true)
+            Py_RETURN_TRUE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+        Py_RETURN_FALSE;
+      }
+
       static PyObject* TritonContext_untaintRegister(PyObject* self, PyObject* reg) {
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "TritonContext::untaintRegister(): Expects a Register as argument.");
@@ -3506,6 +9576,88 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_warmReset(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->warmReset();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_writeSynthesisDatabase(PyObject* self, PyObject* args) {
+        std::vector<std::vector<triton::uint512>> inputs_c;
+        std::vector<triton::ast::SharedAbstractNode> vars_c;
+        std::vector<triton::ast::SharedAbstractNode> exprs_c;
+        PyObject* path   = nullptr;
+        PyObject* vars   = nullptr;
+        PyObject* inputs = nullptr;
+        PyObject* exprs  = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOOO", &path, &vars, &inputs, &exprs) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::writeSynthesisDatabase(): Invalid number of arguments");
+        }
+
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::writeSynthesisDatabase(): Expects a string as first argument.");
+
+        if (vars == nullptr || !PyList_Check(vars))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::writeSynthesisDatabase(): Expects a list of AstNode as second argument.");
+
+        if (inputs == nullptr || !PyList_Check(inputs))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::writeSynthesisDatabase(): Expects a list of lists of integers as third argument.");
+
+        if (exprs == nullptr || !PyList_Check(exprs))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::writeSynthesisDatabase(): Expects a list of AstNode as fourth argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(vars); i++) {
+          PyObject* item = PyList_GetItem(vars, i);
+          if (!PyAstNode_Check(item))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::writeSynthesisDatabase(): Each variable must be an AstNode.");
+          vars_c.push_back(PyAstNode_AsAstNode(item));
+        }
+
+        for (Py_ssize_t i = 0; i < PyList_Size(exprs); i++) {
+          PyObject* item = PyList_GetItem(exprs, i);
+          if (!PyAstNode_Check(item))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::writeSynthesisDatabase(): Each expression must be an AstNode.");
+          exprs_c.push_back(PyAstNode_AsAstNode(item));
+        }
+
+        try {
+          for (Py_ssize_t i = 0; i < PyList_Size(inputs); i++) {
+            PyObject* item = PyList_GetItem(inputs, i);
+            std::vector<triton::uint512> input;
+            if (!PyList_Check(item))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::writeSynthesisDatabase(): Each input must be a list of integers.");
+            for (Py_ssize_t j = 0; j < PyList_Size(item); j++) {
+              PyObject* value = PyList_GetItem(item, j);
+              if (!PyLong_Check(value) && !PyInt_Check(value))
+                return PyErr_Format(PyExc_TypeError, "TritonContext::writeSynthesisDatabase(): Each input must be a list of integers.");
+              input.push_back(PyLong_AsUint512(value));
+            }
+            inputs_c.push_back(std::move(input));
+          }
+
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->writeSynthesisDatabase(PyStr_AsString(path), vars_c, inputs_c, exprs_c));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_getParentRegister(PyObject* self, PyObject* reg) {
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "TritonContext::getParentRegister(): Expects a Register as argument.");
@@ -3552,14 +9704,45 @@ namespace triton {
 
       //! TritonContext methods.
       PyMethodDef TritonContext_callbacks[] = {
+        {"addBuiltinRewriteRules",              (PyCFunction)TritonContext_addBuiltinRewriteRules,                                      METH_NOARGS,                   ""},
         {"addCallback",                         (PyCFunction)TritonContext_addCallback,                                                 METH_VARARGS,                  ""},
+        {"addConcretizationRule",               (PyCFunction)TritonContext_addConcretizationRule,                                       METH_VARARGS,                  ""},
+        {"addNativeCallback",                   (PyCFunction)TritonContext_addNativeCallback,                                           METH_VARARGS,                  ""},
+        {"addRewriteRule",                      (PyCFunction)TritonContext_addRewriteRule,                                              METH_VARARGS,                  ""},
+        {"addSymbolicRegion",                   (PyCFunction)TritonContext_addSymbolicRegion,                                           METH_VARARGS,                  ""},
+        {"addVirtualFile",                      (PyCFunction)TritonContext_addVirtualFile,                                              METH_VARARGS,                  ""},
+        {"applyModelToBuffer",                  (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_applyModelToBuffer,          METH_VARARGS | METH_KEYWORDS,  ""},
         {"assignSymbolicExpressionToMemory",    (PyCFunction)TritonContext_assignSymbolicExpressionToMemory,                            METH_VARARGS,                  ""},
         {"assignSymbolicExpressionToRegister",  (PyCFunction)TritonContext_assignSymbolicExpressionToRegister,                          METH_VARARGS,                  ""},
+        {"attachGdbRemote",                     (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_attachGdbRemote,             METH_VARARGS | METH_KEYWORDS,  ""},
         {"buildSemantics",                      (PyCFunction)TritonContext_buildSemantics,                                              METH_O,                        ""},
+        {"cancelAsync",                         (PyCFunction)TritonContext_cancelAsync,                                                 METH_NOARGS,                   ""},
+        {"clearAstBudgetEvents",                (PyCFunction)TritonContext_clearAstBudgetEvents,                                        METH_NOARGS,                   ""},
         {"clearCallbacks",                      (PyCFunction)TritonContext_clearCallbacks,                                              METH_NOARGS,                   ""},
+        {"clearConcreteMemo",                   (PyCFunction)TritonContext_clearConcreteMemo,                                           METH_NOARGS,                   ""},
+        {"clearConcretizationEvents",           (PyCFunction)TritonContext_clearConcretizationEvents,                                   METH_NOARGS,                   ""},
+        {"clearConcretizationPolicy",           (PyCFunction)TritonContext_clearConcretizationPolicy,                                   METH_NOARGS,                   ""},
+        {"clearHeatMap",                        (PyCFunction)TritonContext_clearHeatMap,                                                METH_NOARGS,                   ""},
         {"clearModes",                          (PyCFunction)TritonContext_clearModes,                                                  METH_NOARGS,                   ""},
         {"clearConcreteMemoryValue",            (PyCFunction)TritonContext_clearConcreteMemoryValue,                                    METH_VARARGS,                  ""},
+        {"clearCounterexampleCache",            (PyCFunction)TritonContext_clearCounterexampleCache,                                    METH_NOARGS,                   ""},
+        {"clearDecodeCache",                    (PyCFunction)TritonContext_clearDecodeCache,                                            METH_NOARGS,                   ""},
+        {"clearJitCache",                       (PyCFunction)TritonContext_clearJitCache,                                               METH_NOARGS,                   ""},
+        {"clearLoopSummaries",                  (PyCFunction)TritonContext_clearLoopSummaries,                                          METH_NOARGS,                   ""},
         {"clearPathConstraints",                (PyCFunction)TritonContext_clearPathConstraints,                                        METH_NOARGS,                   ""},
+        {"clearProfile",                        (PyCFunction)TritonContext_clearProfile,                                                METH_NOARGS,                   ""},
+        {"clearQueryCache",                     (PyCFunction)TritonContext_clearQueryCache,                                             METH_NOARGS,                   ""},
+        {"clearRewriteRules",                   (PyCFunction)TritonContext_clearRewriteRules,                                           METH_NOARGS,                   ""},
+        {"clearSemanticsCache",                 (PyCFunction)TritonContext_clearSemanticsCache,                                         METH_NOARGS,                   ""},
+        {"clearSimplificationMemo",             (PyCFunction)TritonContext_clearSimplificationMemo,                                     METH_NOARGS,                   ""},
+        {"clearSnapshots",                      (PyCFunction)TritonContext_clearSnapshots,                                              METH_NOARGS,                   ""},
+        {"clearSolverStatistics",               (PyCFunction)TritonContext_clearSolverStatistics,                                       METH_NOARGS,                   ""},
+        {"clearSynthesisCache",                 (PyCFunction)TritonContext_clearSynthesisCache,                                         METH_NOARGS,                   ""},
+        {"clearSynthesisDatabases",             (PyCFunction)TritonContext_clearSynthesisDatabases,                                     METH_NOARGS,                   ""},
+        {"clearTrace",                          (PyCFunction)TritonContext_clearTrace,                                                  METH_NOARGS,                   ""},
+        {"clearUnsatCoreCache",                 (PyCFunction)TritonContext_clearUnsatCoreCache,                                         METH_NOARGS,                   ""},
+        {"closePersistentDecodeCache",          (PyCFunction)TritonContext_closePersistentDecodeCache,                                  METH_NOARGS,                   ""},
+        {"closeSharedQueryCache",               (PyCFunction)TritonContext_closeSharedQueryCache,                                       METH_NOARGS,                   ""},
         {"concretizeAllMemory",                 (PyCFunction)TritonContext_concretizeAllMemory,                                         METH_NOARGS,                   ""},
         {"concretizeAllRegister",               (PyCFunction)TritonContext_concretizeAllRegister,                                       METH_NOARGS,                   ""},
         {"concretizeMemory",                    (PyCFunction)TritonContext_concretizeMemory,                                            METH_O,                        ""},
@@ -3567,92 +9750,257 @@ namespace triton {
         {"createSymbolicMemoryExpression",      (PyCFunction)TritonContext_createSymbolicMemoryExpression,                              METH_VARARGS,                  ""},
         {"createSymbolicRegisterExpression",    (PyCFunction)TritonContext_createSymbolicRegisterExpression,                            METH_VARARGS,                  ""},
         {"createSymbolicVolatileExpression",    (PyCFunction)TritonContext_createSymbolicVolatileExpression,                            METH_VARARGS,                  ""},
+        {"decode",                              (PyCFunction)TritonContext_decode,                                                      METH_VARARGS,                  ""},
+        {"detachGdbRemote",                     (PyCFunction)TritonContext_detachGdbRemote,                                             METH_NOARGS,                   ""},
         {"disassembly",                         (PyCFunction)TritonContext_disassembly,                                                 METH_VARARGS,                  ""},
+        {"disassemblyBlocks",                   (PyCFunction)TritonContext_disassemblyBlocks,                                           METH_VARARGS,                  ""},
+        {"dumpSlowSolverQueries",               (PyCFunction)TritonContext_dumpSlowSolverQueries,                                       METH_VARARGS,                  ""},
+        {"dumpSolverQueries",                   (PyCFunction)TritonContext_dumpSolverQueries,                                           METH_O,                        ""},
+        {"dumpTrace",                           (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_dumpTrace,                   METH_VARARGS | METH_KEYWORDS,  ""},
+        {"emulate",                             (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_emulate,                     METH_VARARGS | METH_KEYWORDS,  ""},
+        {"enableAdaptiveTimeout",               (PyCFunction)TritonContext_enableAdaptiveTimeout,                                       METH_O,                        ""},
+        {"enableBitBlasting",                   (PyCFunction)TritonContext_enableBitBlasting,                                           METH_VARARGS,                  ""},
+        {"enableConcreteMemo",                  (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_enableConcreteMemo,          METH_VARARGS | METH_KEYWORDS,  ""},
+        {"enableConstraintIndependence",        (PyCFunction)TritonContext_enableConstraintIndependence,                                METH_O,                        ""},
+        {"enableCounterexampleCache",           (PyCFunction)TritonContext_enableCounterexampleCache,                                   METH_VARARGS,                  ""},
+        {"enableDecodeCache",                   (PyCFunction)TritonContext_enableDecodeCache,                                           METH_O,                        ""},
+        {"enableHeatMap",                       (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_enableHeatMap,               METH_VARARGS | METH_KEYWORDS,  ""},
+        {"enableIncrementalSolving",            (PyCFunction)TritonContext_enableIncrementalSolving,                                    METH_O,                        ""},
+        {"enablePresolver",                     (PyCFunction)TritonContext_enablePresolver,                                             METH_O,                        ""},
+        {"enableProfiling",                     (PyCFunction)TritonContext_enableProfiling,                                             METH_O,                        ""},
+        {"enableQueryCache",                    (PyCFunction)TritonContext_enableQueryCache,                                            METH_VARARGS,                  ""},
+        {"enableQueryClassification",           (PyCFunction)TritonContext_enableQueryClassification,                                   METH_O,                        ""},
+        {"enableSemanticsCache",                (PyCFunction)TritonContext_enableSemanticsCache,                                        METH_O,                        ""},
+        {"enableSolverStatistics",              (PyCFunction)TritonContext_enableSolverStatistics,                                      METH_O,                        ""},
+        {"enableSynthesisCache",                (PyCFunction)TritonContext_enableSynthesisCache,                                        METH_O,                        ""},
+        {"enableSyscallEmulation",              (PyCFunction)TritonContext_enableSyscallEmulation,                                      METH_O,                        ""},
+        {"enableTracing",                       (PyCFunction)TritonContext_enableTracing,                                               METH_O,                        ""},
+        {"enableUndoJournal",                   (PyCFunction)TritonContext_enableUndoJournal,                                           METH_VARARGS,                  ""},
+        {"enableUnsatCoreCache",                (PyCFunction)TritonContext_enableUnsatCoreCache,                                        METH_VARARGS,                  ""},
+        {"enumerateModels",                     (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_enumerateModels,             METH_VARARGS | METH_KEYWORDS,  ""},
+        {"evaluateAstViaModel",                 (PyCFunction)TritonContext_evaluateAstViaModel,                                         METH_VARARGS,                  ""},
         {"evaluateAstViaSolver",                (PyCFunction)TritonContext_evaluateAstViaSolver,                                        METH_O,                        ""},
+        {"exportHeatMap",                       (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_exportHeatMap,               METH_VARARGS | METH_KEYWORDS,  ""},
+        {"fork",                                (PyCFunction)TritonContext_fork,                                                        METH_NOARGS,                   ""},
         {"getAllRegisters",                     (PyCFunction)TritonContext_getAllRegisters,                                             METH_NOARGS,                   ""},
         {"getArchitecture",                     (PyCFunction)TritonContext_getArchitecture,                                             METH_NOARGS,                   ""},
+        {"getAstBudgetEvents",                  (PyCFunction)TritonContext_getAstBudgetEvents,                                          METH_NOARGS,                   ""},
         {"getAstContext",                       (PyCFunction)TritonContext_getAstContext,                                               METH_NOARGS,                   ""},
         {"getAstRepresentationMode",            (PyCFunction)TritonContext_getAstRepresentationMode,                                    METH_NOARGS,                   ""},
+        {"getAsyncSize",                        (PyCFunction)TritonContext_getAsyncSize,                                                METH_NOARGS,                   ""},
+        {"getConcreteMemoStats",                (PyCFunction)TritonContext_getConcreteMemoStats,                                        METH_NOARGS,                   ""},
         {"getConcreteMemoryAreaValue",          (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getConcreteMemoryAreaValue,  METH_VARARGS | METH_KEYWORDS,  ""},
         {"getConcreteMemoryValue",              (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getConcreteMemoryValue,      METH_VARARGS | METH_KEYWORDS,  ""},
+        {"getConcreteRegisterFile",             (PyCFunction)TritonContext_getConcreteRegisterFile,                                     METH_NOARGS,                   ""},
         {"getConcreteRegisterValue",            (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getConcreteRegisterValue,    METH_VARARGS | METH_KEYWORDS,  ""},
         {"getConcreteVariableValue",            (PyCFunction)TritonContext_getConcreteVariableValue,                                    METH_O,                        ""},
+        {"getConcretizationEvents",             (PyCFunction)TritonContext_getConcretizationEvents,                                     METH_NOARGS,                   ""},
+        {"getCounterexampleCacheHits",          (PyCFunction)TritonContext_getCounterexampleCacheHits,                                  METH_NOARGS,                   ""},
+        {"getCounterexampleCacheSize",          (PyCFunction)TritonContext_getCounterexampleCacheSize,                                  METH_NOARGS,                   ""},
+        {"getDenseModel",                       (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getDenseModel,               METH_VARARGS | METH_KEYWORDS,  ""},
+        {"getFunctionSummaries",                (PyCFunction)TritonContext_getFunctionSummaries,                                        METH_NOARGS,                   ""},
+        {"getGdbRemoteStats",                   (PyCFunction)TritonContext_getGdbRemoteStats,                                           METH_NOARGS,                   ""},
         {"getGprBitSize",                       (PyCFunction)TritonContext_getGprBitSize,                                               METH_NOARGS,                   ""},
         {"getGprSize",                          (PyCFunction)TritonContext_getGprSize,                                                  METH_NOARGS,                   ""},
+        {"getHotSpots",                         (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getHotSpots,                 METH_VARARGS | METH_KEYWORDS,  ""},
         {"getImmediateAst",                     (PyCFunction)TritonContext_getImmediateAst,                                             METH_O,                        ""},
+        {"getJitCacheSize",                     (PyCFunction)TritonContext_getJitCacheSize,                                             METH_NOARGS,                   ""},
+        {"getLoopSummaries",                    (PyCFunction)TritonContext_getLoopSummaries,                                            METH_NOARGS,                   ""},
+        {"getLoopUnrollBound",                  (PyCFunction)TritonContext_getLoopUnrollBound,                                          METH_NOARGS,                   ""},
         {"getMemoryAst",                        (PyCFunction)TritonContext_getMemoryAst,                                                METH_O,                        ""},
+        {"getMemoryTaintLabels",                (PyCFunction)TritonContext_getMemoryTaintLabels,                                        METH_VARARGS,                  ""},
+        {"getMemoryUsage",                      (PyCFunction)TritonContext_getMemoryUsage,                                              METH_NOARGS,                   ""},
+        {"getMergeDistance",                    (PyCFunction)TritonContext_getMergeDistance,                                            METH_NOARGS,                   ""},
+        {"getMergedPathConstraints",            (PyCFunction)TritonContext_getMergedPathConstraints,                                    METH_NOARGS,                   ""},
         {"getModel",                            (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getModel,                    METH_VARARGS | METH_KEYWORDS,  ""},
+        {"getModelAsync",                       (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getModelAsync,               METH_VARARGS | METH_KEYWORDS,  ""},
+        {"getModelOfPath",                      (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getModelOfPath,              METH_VARARGS | METH_KEYWORDS,  ""},
         {"getModels",                           (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getModels,                   METH_VARARGS | METH_KEYWORDS,  ""},
+        {"getModelsToReachAddresses",           (PyCFunction)TritonContext_getModelsToReachAddresses,                                   METH_VARARGS,                  ""},
         {"getParentRegister",                   (PyCFunction)TritonContext_getParentRegister,                                           METH_O,                        ""},
         {"getParentRegisters",                  (PyCFunction)TritonContext_getParentRegisters,                                          METH_NOARGS,                   ""},
+        {"getPathConstraintThreads",            (PyCFunction)TritonContext_getPathConstraintThreads,                                    METH_NOARGS,                   ""},
         {"getPathConstraints",                  (PyCFunction)TritonContext_getPathConstraints,                                          METH_NOARGS,                   ""},
+        {"getPathConstraintsOfThread",          (PyCFunction)TritonContext_getPathConstraintsOfThread,                                  METH_O,                        ""},
+        {"getPathConstraintsWindow",            (PyCFunction)TritonContext_getPathConstraintsWindow,                                    METH_NOARGS,                   ""},
         {"getPathPredicate",                    (PyCFunction)TritonContext_getPathPredicate,                                            METH_NOARGS,                   ""},
+        {"getPathPredicateOfThread",            (PyCFunction)TritonContext_getPathPredicateOfThread,                                    METH_O,                        ""},
         {"getPathPredicateSize",                (PyCFunction)TritonContext_getPathPredicateSize,                                        METH_NOARGS,                   ""},
+        {"getPointerResolutionBound",           (PyCFunction)TritonContext_getPointerResolutionBound,                                   METH_NOARGS,                   ""},
         {"getPredicatesToReachAddress",         (PyCFunction)TritonContext_getPredicatesToReachAddress,                                 METH_O,                        ""},
+        {"getPredicatesToReachAddresses",       (PyCFunction)TritonContext_getPredicatesToReachAddresses,                               METH_O,                        ""},
+        {"getPresolverHits",                    (PyCFunction)TritonContext_getPresolverHits,                                            METH_NOARGS,                   ""},
+        {"getProfile",                          (PyCFunction)TritonContext_getProfile,                                                  METH_NOARGS,                   ""},
+        {"getProgramExitStatus",                (PyCFunction)TritonContext_getProgramExitStatus,                                        METH_NOARGS,                   ""},
+        {"getQueryCacheHits",                   (PyCFunction)TritonContext_getQueryCacheHits,                                           METH_NOARGS,                   ""},
+        {"getQueryCacheMisses",                 (PyCFunction)TritonContext_getQueryCacheMisses,                                         METH_NOARGS,                   ""},
+        {"getQueryCacheSize",                   (PyCFunction)TritonContext_getQueryCacheSize,                                           METH_NOARGS,                   ""},
+        {"getQueryConfiguration",               (PyCFunction)TritonContext_getQueryConfiguration,                                       METH_O,                        ""},
         {"getRegister",                         (PyCFunction)TritonContext_getRegister,                                                 METH_O,                        ""},
         {"getRegisterAst",                      (PyCFunction)TritonContext_getRegisterAst,                                              METH_O,                        ""},
+        {"getRegisterTaintLabels",              (PyCFunction)TritonContext_getRegisterTaintLabels,                                      METH_O,                        ""},
+        {"getSemanticsCacheSize",               (PyCFunction)TritonContext_getSemanticsCacheSize,                                       METH_NOARGS,                   ""},
+        {"getSimplificationMemoHits",           (PyCFunction)TritonContext_getSimplificationMemoHits,                                   METH_NOARGS,                   ""},
+        {"getSimplificationMemoSize",           (PyCFunction)TritonContext_getSimplificationMemoSize,                                   METH_NOARGS,                   ""},
         {"getSolver",                           (PyCFunction)TritonContext_getSolver,                                                   METH_NOARGS,                   ""},
+        {"getSolverStatistics",                 (PyCFunction)TritonContext_getSolverStatistics,                                         METH_NOARGS,                   ""},
         {"getSymbolicExpression",               (PyCFunction)TritonContext_getSymbolicExpression,                                       METH_O,                        ""},
-        {"getSymbolicExpressions",              (PyCFunction)TritonContext_getSymbolicExpressions,                                      METH_NOARGS,                   ""},
+        {"getSymbolicExpressions",              (PyCFunction)TritonContext_getSymbolicExpressions,                                      METH_VARARGS,                  ""},
+        {"getSymbolicExpressionsAt",            (PyCFunction)TritonContext_getSymbolicExpressionsAt,                                    METH_O,                        ""},
         {"getSymbolicMemory",                   (PyCFunction)TritonContext_getSymbolicMemory,                                           METH_VARARGS,                  ""},
         {"getSymbolicMemoryValue",              (PyCFunction)TritonContext_getSymbolicMemoryValue,                                      METH_O,                        ""},
         {"getSymbolicRegister",                 (PyCFunction)TritonContext_getSymbolicRegister,                                         METH_O,                        ""},
         {"getSymbolicRegisterValue",            (PyCFunction)TritonContext_getSymbolicRegisterValue,                                    METH_O,                        ""},
         {"getSymbolicRegisters",                (PyCFunction)TritonContext_getSymbolicRegisters,                                        METH_NOARGS,                   ""},
         {"getSymbolicVariable",                 (PyCFunction)TritonContext_getSymbolicVariable,                                         METH_O,                        ""},
-        {"getSymbolicVariables",                (PyCFunction)TritonContext_getSymbolicVariables,                                        METH_NOARGS,                   ""},
+        {"getSymbolicVariables",                (PyCFunction)TritonContext_getSymbolicVariables,                                        METH_VARARGS,                  ""},
+        {"getSynthesisCacheHits",               (PyCFunction)TritonContext_getSynthesisCacheHits,                                       METH_NOARGS,                   ""},
+        {"getSynthesisCacheSize",               (PyCFunction)TritonContext_getSynthesisCacheSize,                                       METH_NOARGS,                   ""},
+        {"getSynthesisDatabasesSize",           (PyCFunction)TritonContext_getSynthesisDatabasesSize,                                   METH_NOARGS,                   ""},
         {"getTaintedMemory",                    (PyCFunction)TritonContext_getTaintedMemory,                                            METH_NOARGS,                   ""},
+        {"getTaintedRanges",                    (PyCFunction)TritonContext_getTaintedRanges,                                            METH_NOARGS,                   ""},
         {"getTaintedRegisters",                 (PyCFunction)TritonContext_getTaintedRegisters,                                         METH_NOARGS,                   ""},
         {"getTaintedSymbolicExpressions",       (PyCFunction)TritonContext_getTaintedSymbolicExpressions,                               METH_NOARGS,                   ""},
+        {"getTimeoutRoundRemaining",            (PyCFunction)TritonContext_getTimeoutRoundRemaining,                                    METH_NOARGS,                   ""},
+        {"getUndoJournalSize",                  (PyCFunction)TritonContext_getUndoJournalSize,                                          METH_NOARGS,                   ""},
+        {"getUnsatCoreCacheHits",               (PyCFunction)TritonContext_getUnsatCoreCacheHits,                                       METH_NOARGS,                   ""},
+        {"getUnsatCoreCacheSize",               (PyCFunction)TritonContext_getUnsatCoreCacheSize,                                       METH_NOARGS,                   ""},
+        {"getVirtualFile",                      (PyCFunction)TritonContext_getVirtualFile,                                              METH_O,                        ""},
+        {"hasProgramExited",                    (PyCFunction)TritonContext_hasProgramExited,                                            METH_NOARGS,                   ""},
+        {"isAdaptiveTimeoutEnabled",            (PyCFunction)TritonContext_isAdaptiveTimeoutEnabled,                                    METH_NOARGS,                   ""},
+        {"isAnyTainted",                        (PyCFunction)TritonContext_isAnyTainted,                                                METH_VARARGS,                  ""},
         {"isArchitectureValid",                 (PyCFunction)TritonContext_isArchitectureValid,                                         METH_NOARGS,                   ""},
+        {"isBitBlastingEnabled",                (PyCFunction)TritonContext_isBitBlastingEnabled,                                        METH_NOARGS,                   ""},
+        {"isConcreteMemoEnabled",               (PyCFunction)TritonContext_isConcreteMemoEnabled,                                       METH_NOARGS,                   ""},
         {"isConcreteMemoryValueDefined",        (PyCFunction)TritonContext_isConcreteMemoryValueDefined,                                METH_VARARGS,                  ""},
+        {"isConstraintIndependenceEnabled",     (PyCFunction)TritonContext_isConstraintIndependenceEnabled,                             METH_NOARGS,                   ""},
+        {"isCounterexampleCacheEnabled",        (PyCFunction)TritonContext_isCounterexampleCacheEnabled,                                METH_NOARGS,                   ""},
+        {"isDecodeCacheEnabled",                (PyCFunction)TritonContext_isDecodeCacheEnabled,                                        METH_NOARGS,                   ""},
         {"isFlag",                              (PyCFunction)TritonContext_isFlag,                                                      METH_O,                        ""},
+        {"isHeatMapEnabled",                    (PyCFunction)TritonContext_isHeatMapEnabled,                                            METH_NOARGS,                   ""},
+        {"isIncrementalSolvingEnabled",         (PyCFunction)TritonContext_isIncrementalSolvingEnabled,                                 METH_NOARGS,                   ""},
         {"isMemorySymbolized",                  (PyCFunction)TritonContext_isMemorySymbolized,                                          METH_O,                        ""},
-        {"isMemoryTainted",                     (PyCFunction)TritonContext_isMemoryTainted,                                             METH_O,                        ""},
+        {"isMemoryTainted",                     (PyCFunction)TritonContext_isMemoryTainted,                                             METH_VARARGS,                  ""},
         {"isModeEnabled",                       (PyCFunction)TritonContext_isModeEnabled,                                               METH_O,                        ""},
+        {"isOpaquePredicate",                   (PyCFunction)TritonContext_isOpaquePredicate,                                           METH_VARARGS,                  ""},
+        {"isPresolverEnabled",                  (PyCFunction)TritonContext_isPresolverEnabled,                                          METH_NOARGS,                   ""},
+        {"isProfilingEnabled",                  (PyCFunction)TritonContext_isProfilingEnabled,                                          METH_NOARGS,                   ""},
+        {"isQueryCacheEnabled",                 (PyCFunction)TritonContext_isQueryCacheEnabled,                                         METH_NOARGS,                   ""},
+        {"isQueryClassificationEnabled",        (PyCFunction)TritonContext_isQueryClassificationEnabled,                                METH_NOARGS,                   ""},
         {"isRegister",                          (PyCFunction)TritonContext_isRegister,                                                  METH_O,                        ""},
         {"isRegisterSymbolized",                (PyCFunction)TritonContext_isRegisterSymbolized,                                        METH_O,                        ""},
         {"isRegisterTainted",                   (PyCFunction)TritonContext_isRegisterTainted,                                           METH_O,                        ""},
         {"isRegisterValid",                     (PyCFunction)TritonContext_isRegisterValid,                                             METH_O,                        ""},
         {"isSat",                               (PyCFunction)TritonContext_isSat,                                                       METH_O,                        ""},
+        {"isSatAsync",                          (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_isSatAsync,                  METH_VARARGS | METH_KEYWORDS,  ""},
+        {"isSatOfPath",                         (PyCFunction)TritonContext_isSatOfPath,                                                 METH_VARARGS,                  ""},
+        {"isSemanticsCacheEnabled",             (PyCFunction)TritonContext_isSemanticsCacheEnabled,                                     METH_NOARGS,                   ""},
+        {"isSharedQueryCacheOpen",              (PyCFunction)TritonContext_isSharedQueryCacheOpen,                                      METH_NOARGS,                   ""},
+        {"isSmtStreamEnabled",                  (PyCFunction)TritonContext_isSmtStreamEnabled,                                          METH_NOARGS,                   ""},
+        {"isSnapshotExists",                    (PyCFunction)TritonContext_isSnapshotExists,                                            METH_O,                        ""},
+        {"isSolverStatisticsEnabled",           (PyCFunction)TritonContext_isSolverStatisticsEnabled,                                   METH_NOARGS,                   ""},
         {"isSymbolicExpressionExists",          (PyCFunction)TritonContext_isSymbolicExpressionExists,                                  METH_O,                        ""},
+        {"isSynthesisCacheEnabled",             (PyCFunction)TritonContext_isSynthesisCacheEnabled,                                     METH_NOARGS,                   ""},
+        {"isSyscallEmulationEnabled",           (PyCFunction)TritonContext_isSyscallEmulationEnabled,                                   METH_NOARGS,                   ""},
         {"isThumb",                             (PyCFunction)TritonContext_isThumb,                                                     METH_NOARGS,                   ""},
-        {"liftToDot",                           (PyCFunction)TritonContext_liftToDot,                                                   METH_O,                        ""},
+        {"isTracingEnabled",                    (PyCFunction)TritonContext_isTracingEnabled,                                            METH_NOARGS,                   ""},
+        {"isUndoJournalEnabled",                (PyCFunction)TritonContext_isUndoJournalEnabled,                                        METH_NOARGS,                   ""},
+        {"isUnsatCoreCacheEnabled",             (PyCFunction)TritonContext_isUnsatCoreCacheEnabled,                                     METH_NOARGS,                   ""},
+        {"iterSymbolicExpressions",             (PyCFunction)TritonContext_iterSymbolicExpressions,                                     METH_NOARGS,                   ""},
+        {"iterSymbolicMemory",                  (PyCFunction)TritonContext_iterSymbolicMemory,                                          METH_NOARGS,                   ""},
+        {"iterSymbolicRegisters",               (PyCFunction)TritonContext_iterSymbolicRegisters,                                       METH_NOARGS,                   ""},
+        {"iterSymbolicVariables",               (PyCFunction)TritonContext_iterSymbolicVariables,                                       METH_NOARGS,                   ""},
+        {"liftToBTOR2",                         (PyCFunction)TritonContext_liftToBTOR2,                                                 METH_O,                        ""},
+        {"liftToC",                             (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_liftToC,                     METH_VARARGS | METH_KEYWORDS,  ""},
+        {"liftToDot",                           (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_liftToDot,                   METH_VARARGS | METH_KEYWORDS,  ""},
         {"liftToLLVM",                          (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_liftToLLVM,                  METH_VARARGS | METH_KEYWORDS,  ""},
         {"liftToPython",                        (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_liftToPython,                METH_VARARGS | METH_KEYWORDS,  ""},
         {"liftToSMT",                           (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_liftToSMT,                   METH_VARARGS | METH_KEYWORDS,  ""},
+        {"load",                                (PyCFunction)TritonContext_load,                                                        METH_O,                        ""},
+        {"loadBinary",                          (PyCFunction)TritonContext_loadBinary,                                                  METH_O,                        ""},
+        {"loadSynthesisCache",                  (PyCFunction)TritonContext_loadSynthesisCache,                                          METH_O,                        ""},
+        {"loadSynthesisDatabase",               (PyCFunction)TritonContext_loadSynthesisDatabase,                                       METH_O,                        ""},
         {"newSymbolicExpression",               (PyCFunction)TritonContext_newSymbolicExpression,                                       METH_VARARGS,                  ""},
         {"newSymbolicVariable",                 (PyCFunction)TritonContext_newSymbolicVariable,                                         METH_VARARGS,                  ""},
+        {"openPersistentDecodeCache",           (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_openPersistentDecodeCache,   METH_VARARGS | METH_KEYWORDS,  ""},
+        {"openSharedQueryCache",                (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_openSharedQueryCache,        METH_VARARGS | METH_KEYWORDS,  ""},
+        {"optimize",                            (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_optimize,                    METH_VARARGS | METH_KEYWORDS,  ""},
+        {"parseSmt",                            (PyCFunction)TritonContext_parseSmt,                                                    METH_O,                        ""},
         {"popPathConstraint",                   (PyCFunction)TritonContext_popPathConstraint,                                           METH_NOARGS,                   ""},
+        {"predictSolvingTime",                  (PyCFunction)TritonContext_predictSolvingTime,                                          METH_O,                        ""},
+        {"processTrace",                        (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_processTrace,                METH_VARARGS | METH_KEYWORDS,  ""},
         {"processing",                          (PyCFunction)TritonContext_processing,                                                  METH_VARARGS,                  ""},
+        {"processingJit",                       (PyCFunction)TritonContext_processingJit,                                               METH_VARARGS,                  ""},
         {"pushPathConstraint",                  (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_pushPathConstraint,          METH_VARARGS | METH_KEYWORDS,  ""},
+        {"readConcreteMemoryInto",              (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_readConcreteMemoryInto,      METH_VARARGS | METH_KEYWORDS,  ""},
         {"removeCallback",                      (PyCFunction)TritonContext_removeCallback,                                              METH_VARARGS,                  ""},
+        {"removeConcretizationRule",            (PyCFunction)TritonContext_removeConcretizationRule,                                    METH_O,                        ""},
+        {"removeFunctionSummary",               (PyCFunction)TritonContext_removeFunctionSummary,                                       METH_O,                        ""},
+        {"removeNativeCallback",                (PyCFunction)TritonContext_removeNativeCallback,                                        METH_VARARGS,                  ""},
+        {"removeSnapshot",                      (PyCFunction)TritonContext_removeSnapshot,                                              METH_O,                        ""},
+        {"removeSyscallHandler",                (PyCFunction)TritonContext_removeSyscallHandler,                                        METH_O,                        ""},
+        {"replayTrace",                         (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_replayTrace,                 METH_VARARGS | METH_KEYWORDS,  ""},
         {"reset",                               (PyCFunction)TritonContext_reset,                                                       METH_NOARGS,                   ""},
+        {"resetToSnapshot",                     (PyCFunction)TritonContext_resetToSnapshot,                                             METH_O,                        ""},
+        {"restore",                             (PyCFunction)TritonContext_restore,                                                     METH_O,                        ""},
+        {"save",                                (PyCFunction)TritonContext_save,                                                        METH_O,                        ""},
+        {"saveSynthesisCache",                  (PyCFunction)TritonContext_saveSynthesisCache,                                          METH_O,                        ""},
+        {"setAdaptiveTimeoutBounds",            (PyCFunction)TritonContext_setAdaptiveTimeoutBounds,                                    METH_VARARGS,                  ""},
         {"setArchitecture",                     (PyCFunction)TritonContext_setArchitecture,                                             METH_O,                        ""},
+        {"setAstBudget",                        (PyCFunction)TritonContext_setAstBudget,                                                METH_VARARGS,                  ""},
+        {"setAstBudgetPolicy",                  (PyCFunction)TritonContext_setAstBudgetPolicy,                                          METH_O,                        ""},
         {"setAstRepresentationMode",            (PyCFunction)TritonContext_setAstRepresentationMode,                                    METH_O,                        ""},
         {"setConcreteMemoryAreaValue",          (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_setConcreteMemoryAreaValue,  METH_VARARGS | METH_KEYWORDS,  ""},
         {"setConcreteMemoryValue",              (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_setConcreteMemoryValue,      METH_VARARGS | METH_KEYWORDS,  ""},
+        {"setConcreteRegisterFile",             (PyCFunction)TritonContext_setConcreteRegisterFile,                                     METH_O,                        ""},
         {"setConcreteRegisterValue",            (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_setConcreteRegisterValue,    METH_VARARGS | METH_KEYWORDS,  ""},
         {"setConcreteVariableValue",            (PyCFunction)TritonContext_setConcreteVariableValue,                                    METH_VARARGS,                  ""},
+        {"setFunctionSummaries",                (PyCFunction)TritonContext_setFunctionSummaries,                                        METH_VARARGS,                  ""},
+        {"setFunctionSummary",                  (PyCFunction)TritonContext_setFunctionSummary,                                          METH_VARARGS,                  ""},
+        {"setLoopUnrollBound",                  (PyCFunction)TritonContext_setLoopUnrollBound,                                          METH_O,                        ""},
+        {"setMergeDistance",                    (PyCFunction)TritonContext_setMergeDistance,                                            METH_O,                        ""},
         {"setMode",                             (PyCFunction)TritonContext_setMode,                                                     METH_VARARGS,                  ""},
+        {"setPathConstraintsWindow",            (PyCFunction)TritonContext_setPathConstraintsWindow,                                    METH_O,                        ""},
+        {"setPointerResolutionBound",           (PyCFunction)TritonContext_setPointerResolutionBound,                                   METH_O,                        ""},
+        {"setProgramBreak",                     (PyCFunction)TritonContext_setProgramBreak,                                             METH_O,                        ""},
+        {"setQueryConfiguration",               (PyCFunction)TritonContext_setQueryConfiguration,                                       METH_VARARGS,                  ""},
+        {"setRemoteSolver",                     (PyCFunction)TritonContext_setRemoteSolver,                                             METH_O,                        ""},
         {"setSolver",                           (PyCFunction)TritonContext_setSolver,                                                   METH_O,                        ""},
         {"setSolverMemoryLimit",                (PyCFunction)TritonContext_setSolverMemoryLimit,                                        METH_O,                        ""},
         {"setSolverTimeout",                    (PyCFunction)TritonContext_setSolverTimeout,                                            METH_O,                        ""},
+        {"setSyscallHandler",                   (PyCFunction)TritonContext_setSyscallHandler,                                           METH_VARARGS,                  ""},
         {"setTaintMemory",                      (PyCFunction)TritonContext_setTaintMemory,                                              METH_VARARGS,                  ""},
         {"setTaintRegister",                    (PyCFunction)TritonContext_setTaintRegister,                                            METH_VARARGS,                  ""},
         {"setThumb",                            (PyCFunction)TritonContext_setThumb,                                                    METH_O,                        ""},
+        {"setTimeoutRetryCallback",             (PyCFunction)TritonContext_setTimeoutRetryCallback,                                     METH_VARARGS,                  ""},
         {"simplify",                            (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_simplify,                    METH_VARARGS | METH_KEYWORDS,  ""},
         {"sliceExpressions",                    (PyCFunction)TritonContext_sliceExpressions,                                            METH_O,                        ""},
+        {"snapshot",                            (PyCFunction)TritonContext_snapshot,                                                    METH_NOARGS,                   ""},
+        {"solveAllBranchFlips",                 (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_solveAllBranchFlips,         METH_VARARGS | METH_KEYWORDS,  ""},
+        {"startSmtStream",                      (PyCFunction)TritonContext_startSmtStream,                                              METH_O,                        ""},
+        {"startTimeoutRound",                   (PyCFunction)TritonContext_startTimeoutRound,                                           METH_O,                        ""},
+        {"stepBack",                            (PyCFunction)TritonContext_stepBack,                                                    METH_VARARGS,                  ""},
+        {"stopSmtStream",                       (PyCFunction)TritonContext_stopSmtStream,                                               METH_NOARGS,                   ""},
+        {"summarizePathConstraints",            (PyCFunction)TritonContext_summarizePathConstraints,                                    METH_O,                        ""},
+        {"symbolizeBuffer",                     (PyCFunction)TritonContext_symbolizeBuffer,                                             METH_VARARGS,                  ""},
         {"symbolizeExpression",                 (PyCFunction)TritonContext_symbolizeExpression,                                         METH_VARARGS,                  ""},
         {"symbolizeMemory",                     (PyCFunction)TritonContext_symbolizeMemory,                                             METH_VARARGS,                  ""},
         {"symbolizeRegister",                   (PyCFunction)TritonContext_symbolizeRegister,                                           METH_VARARGS,                  ""},
         {"synthesize",                          (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_synthesize,                  METH_VARARGS | METH_KEYWORDS,  ""},
+        {"synthesizeByEnumeration",             (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_synthesizeByEnumeration,     METH_VARARGS | METH_KEYWORDS,  ""},
         {"taintAssignment",                     (PyCFunction)TritonContext_taintAssignment,                                             METH_VARARGS,                  ""},
-        {"taintMemory",                         (PyCFunction)TritonContext_taintMemory,                                                 METH_O,                        ""},
+        {"taintMemory",                         (PyCFunction)TritonContext_taintMemory,                                                 METH_VARARGS,                  ""},
+        {"taintMemoryRange",                    (PyCFunction)TritonContext_taintMemoryRange,                                            METH_VARARGS,                  ""},
+        {"taintMemoryWithLabel",                (PyCFunction)TritonContext_taintMemoryWithLabel,                                        METH_VARARGS,                  ""},
         {"taintRegister",                       (PyCFunction)TritonContext_taintRegister,                                               METH_O,                        ""},
+        {"taintRegisterWithLabel",              (PyCFunction)TritonContext_taintRegisterWithLabel,                                      METH_VARARGS,                  ""},
+        {"taintTrace",                          (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_taintTrace,                  METH_VARARGS | METH_KEYWORDS,  ""},
         {"taintUnion",                          (PyCFunction)TritonContext_taintUnion,                                                  METH_VARARGS,                  ""},
-        {"untaintMemory",                       (PyCFunction)TritonContext_untaintMemory,                                               METH_O,                        ""},
+        {"untaintMemory",                       (PyCFunction)TritonContext_untaintMemory,                                               METH_VARARGS,                  ""},
+        {"untaintMemoryRange",                  (PyCFunction)TritonContext_untaintMemoryRange,                                          METH_VARARGS,                  ""},
         {"untaintRegister",                     (PyCFunction)TritonContext_untaintRegister,                                             METH_O,                        ""},
+        {"warmReset",                           (PyCFunction)TritonContext_warmReset,                                                   METH_NOARGS,                   ""},
+        {"writeSynthesisDatabase",              (PyCFunction)TritonContext_writeSynthesisDatabase,                                      METH_VARARGS,                  ""},
         {nullptr,                               nullptr,                                                                                0,                             nullptr}
       };
 
@@ -3748,6 +10096,23 @@ namespace triton {
       }
 
 
+      PyObject* PyTritonContext(triton::Context* ctx) {
+        PyType_Ready(&TritonContext_Type);
+        TritonContext_Object* object = PyObject_NEW(TritonContext_Object, &TritonContext_Type);
+
+        if (object != nullptr) {
+          object->ctx = ctx;
+          object->ref = false;
+          object->regAttr = nullptr;
+        }
+        else {
+          delete ctx;
+        }
+
+        return (PyObject*)object;
+      }
+
+
       PyObject* PyTritonContextRef(triton::Context& ctx) {
         PyType_Ready(&TritonContext_Type);
         TritonContext_Object* object = PyObject_NEW(TritonContext_Object, &TritonContext_Type);
@@ -0,0 +1,157 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <chrono>
+
+#include <triton/accessStream.hpp>
+#include <triton/context.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+namespace triton {
+  namespace callbacks {
+
+    AccessStream::AccessStream(const AccessObserver& observer, triton::usize capacity)
+      : head(0), tail(0), stopping(false), failed(false) {
+      if (capacity == 0)
+        throw triton::exceptions::Callbacks("AccessStream::AccessStream(): The capacity must not be null.");
+
+      if (!observer)
+        throw triton::exceptions::Callbacks("AccessStream::AccessStream(): The observer is not defined.");
+
+      triton::usize size = 1;
+      while (size < capacity)
+        size <<= 1;
+
+      this->slots.resize(size);
+      this->mask     = size - 1;
+      this->stalls   = 0;
+      this->observer = observer;
+      this->consumer = std::thread(&AccessStream::drain, this);
+    }
+
+
+    AccessStream::~AccessStream() {
+      this->stopping.store(true, std::memory_order_release);
+      if (this->consumer.joinable())
+        this->consumer.join();
+    }
+
+
+    void AccessStream::drain(void) {
+      triton::usize idle = 0;
+
+      while (true) {
+        triton::usize t = this->tail.load(std::memory_order_relaxed);
+
+        if (t == this->head.load(std::memory_order_acquire)) {
+          /* The head is read again, a record may have been written before the stop */
+          if (this->stopping.load(std::memory_order_acquire) && t == this->head.load(std::memory_order_acquire))
+            return;
+          /* Spins a while, then sleeps to leave the core while the emulation is idle */
+          if (++idle < 64)
+            std::this_thread::yield();
+          else
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+          continue;
+        }
+
+        idle = 0;
+        if (this->failed.load(std::memory_order_relaxed) == false) {
+          try {
+            this->observer(this->slots[t & this->mask]);
+          }
+          catch (...) {
+            this->error = std::current_exception();
+            this->failed.store(true, std::memory_order_release);
+          }
+        }
+
+        this->tail.store(t + 1, std::memory_order_release);
+      }
+    }
+
+
+    void AccessStream::rethrow(void) {
+      if (this->failed.load(std::memory_order_acquire) && this->error) {
+        std::exception_ptr e = this->error;
+        this->error = nullptr;
+        std::rethrow_exception(e);
+      }
+    }
+
+
+    void AccessStream::record(const triton::Context& ctx, triton::arch::Instruction& inst) {
+      if (this->stopping.load(std::memory_order_relaxed))
+        throw triton::exceptions::Callbacks("AccessStream::record(): The stream is stopped.");
+
+      triton::usize h = this->head.load(std::memory_order_relaxed);
+
+      if (h - this->tail.load(std::memory_order_acquire) > this->mask) {
+        this->stalls++;
+        while (h - this->tail.load(std::memory_order_acquire) > this->mask)
+          std::this_thread::yield();
+      }
+
+      AccessRecord& record = this->slots[h & this->mask];
+      record.address = inst.getAddress();
+      record.loads.clear();
+      record.stores.clear();
+      record.registers.clear();
+
+      for (const auto& load : inst.getLoadAccess()) {
+        const triton::arch::MemoryAccess& mem = load.first;
+        record.loads.push_back({mem.getAddress(), mem.getSize(), load.second ? load.second->evaluate() : ctx.getConcreteMemoryValue(mem, false)});
+      }
+
+      for (const auto& store : inst.getStoreAccess()) {
+        const triton::arch::MemoryAccess& mem = store.first;
+        record.stores.push_back({mem.getAddress(), mem.getSize(), store.second ? store.second->evaluate() : ctx.getConcreteMemoryValue(mem, false)});
+      }
+
+      for (const auto& reg : inst.getWrittenRegisters())
+        record.registers.push_back({reg.first.getId(), reg.second ? reg.second->evaluate() : ctx.getConcreteRegisterValue(reg.first, false)});
+
+      this->head.store(h + 1, std::memory_order_release);
+    }
+
+
+    void AccessStream::flush(void) {
+      triton::usize h = this->head.load(std::memory_order_relaxed);
+
+      while (this->tail.load(std::memory_order_acquire) != h)
+        std::this_thread::yield();
+
+      this->rethrow();
+    }
+
+
+    void AccessStream::stop(void) {
+      this->stopping.store(true, std::memory_order_release);
+      if (this->consumer.joinable())
+        this->consumer.join();
+      this->rethrow();
+    }
+
+
+    triton::usize AccessStream::getCapacity(void) const {
+      return this->slots.size();
+    }
+
+
+    triton::usize AccessStream::getRecordCount(void) const {
+      return this->head.load(std::memory_order_relaxed);
+    }
+
+
+    triton::usize AccessStream::getStalls(void) const {
+      return this->stalls;
+    }
+
+  }; /* callbacks namespace */
+}; /* triton namespace */
@@ -5,8 +5,15 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
+
 #include <triton/context.hpp>
 #include <triton/callbacks.hpp>
+#include <triton/coreUtils.hpp>
+#include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
 
 
@@ -18,8 +25,10 @@ namespace triton {
       this->defined   = false;
       this->mget      = false;
       this->mload     = false;
+      this->mpage     = false;
       this->mput      = false;
       this->mstore    = false;
+      this->simplificationVersion = 0;
     }
 
 
@@ -36,6 +45,19 @@ namespace triton {
     }
 
 
+    void Callbacks::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<std::vector<triton::uint8>(triton::Context&, triton::uint64 addr)> cb) {
+      switch (kind) {
+        case triton::callbacks::GET_CONCRETE_MEMORY_PAGE:
+          this->getConcreteMemoryPageCallbacks.push_back(cb);
+          break;
+
+        default:
+          return;
+      }
+      this->defined = true;
+    }
+
+
     void Callbacks::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::Register&)> cb) {
       switch (kind) {
         case triton::callbacks::GET_CONCRETE_REGISTER_VALUE:
@@ -79,6 +101,7 @@ namespace triton {
       switch (kind) {
         case triton::callbacks::SYMBOLIC_SIMPLIFICATION:
           this->symbolicSimplificationCallbacks.push_back(cb);
+          this->simplificationVersion++;
           break;
 
         default:
@@ -90,10 +113,12 @@ namespace triton {
 
     void Callbacks::clearCallbacks(void) {
       this->getConcreteMemoryValueCallbacks.clear();
+      this->getConcreteMemoryPageCallbacks.clear();
       this->getConcreteRegisterValueCallbacks.clear();
       this->setConcreteMemoryValueCallbacks.clear();
       this->setConcreteRegisterValueCallbacks.clear();
       this->symbolicSimplificationCallbacks.clear();
+      this->simplificationVersion++;
       this->defined = false;
     }
 
@@ -126,6 +151,22 @@ namespace triton {
     }
 
 
+    void Callbacks::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<std::vector<triton::uint8>(triton::Context&, triton::uint64 addr)> cb) {
+      switch (kind) {
+        case triton::callbacks::GET_CONCRETE_MEMORY_PAGE:
+          this->removeSingleCallback(this->getConcreteMemoryPageCallbacks, cb);
+          break;
+
+        default:
+          throw triton::exceptions::Exception("Incorrect callback kind for removal");
+      }
+
+      if (this->countCallbacks() == 0) {
+        this->defined = false;
+      }
+    }
+
+
     void Callbacks::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::Register&)> cb) {
       switch (kind) {
         case triton::callbacks::GET_CONCRETE_REGISTER_VALUE:
@@ -178,6 +219,7 @@ namespace triton {
       switch (kind) {
         case triton::callbacks::SYMBOLIC_SIMPLIFICATION:
           this->removeSingleCallback(this->symbolicSimplificationCallbacks, cb);
+          this->simplificationVersion++;
           break;
 
         default:
@@ -234,6 +276,99 @@ namespace triton {
     }
 
 
+    void Callbacks::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::ConcreteMemory& memory, triton::uint64 baseAddr, triton::usize size) {
+      switch (kind) {
+        case triton::callbacks::GET_CONCRETE_MEMORY_PAGE: {
+          /* Check if we are already in the callback to avoid infinite recursion */
+          if (this->mpage || this->getConcreteMemoryPageCallbacks.empty()) {
+            break;
+          }
+
+          for (triton::uint64 addr : memory.touchUndefinedPages(baseAddr, size)) {
+            for (auto& function: this->getConcreteMemoryPageCallbacks) {
+              this->mpage = true;
+              std::vector<triton::uint8> page = function(this->ctx, addr);
+              this->mpage = false;
+
+              if (page.empty())
+                continue;
+
+              if (page.size() > triton::arch::ConcreteMemory::pageSize)
+                throw triton::exceptions::Callbacks("Callbacks::processCallbacks(GET_CONCRETE_MEMORY_PAGE): The page is too big.");
+
+              this->ctx.getCpuInstance()->setConcreteMemoryAreaValue(addr, page.data(), page.size(), false);
+              break;
+            }
+          }
+
+          break;
+        }
+
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+      };
+    }
+
+
+    /* Returns the size of the largest memory access which fits in `size` bytes */
+    static triton::uint32 getAccessSize(triton::usize size) {
+      triton::uint32 access = triton::size::dqqword;
+      while (access > size)
+        access >>= 1;
+      return access;
+    }
+
+
+    void Callbacks::processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size) {
+      switch (kind) {
+        case triton::callbacks::GET_CONCRETE_MEMORY_VALUE: {
+          if (this->mload || this->getConcreteMemoryValueCallbacks.empty()) {
+            break;
+          }
+
+          while (size) {
+            triton::uint32 access = getAccessSize(size);
+            this->processCallbacks(kind, triton::arch::MemoryAccess(baseAddr, access));
+            baseAddr += access;
+            size     -= access;
+          }
+
+          break;
+        }
+
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+      };
+    }
+
+
+    void Callbacks::processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
+      switch (kind) {
+        case triton::callbacks::SET_CONCRETE_MEMORY_VALUE: {
+          if (this->mstore || this->setConcreteMemoryValueCallbacks.empty()) {
+            break;
+          }
+
+          while (size) {
+            triton::uint32 access = getAccessSize(size);
+            triton::uint512 value = 0;
+            for (triton::uint32 i = access; i > 0; i--)
+              value = (value << triton::bitsize::byte) | area[i - 1];
+            this->processCallbacks(kind, triton::arch::MemoryAccess(baseAddr, access), value);
+            baseAddr += access;
+            area     += access;
+            size     -= access;
+          }
+
+          break;
+        }
+
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+      };
+    }
+
+
     void Callbacks::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) {
       switch (kind) {
         case triton::callbacks::GET_CONCRETE_REGISTER_VALUE: {
@@ -307,6 +442,7 @@ namespace triton {
       triton::usize count = 0;
 
       count += this->getConcreteMemoryValueCallbacks.size();
+      count += this->getConcreteMemoryPageCallbacks.size();
       count += this->getConcreteRegisterValueCallbacks.size();
       count += this->setConcreteMemoryValueCallbacks.size();
       count += this->setConcreteRegisterValueCallbacks.size();
@@ -319,6 +455,7 @@ namespace triton {
     bool Callbacks::isDefined(triton::callbacks::callback_e kind) const {
       switch (kind) {
         case GET_CONCRETE_MEMORY_VALUE:   return !this->getConcreteMemoryValueCallbacks.empty();
+        case GET_CONCRETE_MEMORY_PAGE:    return !this->getConcreteMemoryPageCallbacks.empty();
         case GET_CONCRETE_REGISTER_VALUE: return !this->getConcreteRegisterValueCallbacks.empty();
         case SET_CONCRETE_MEMORY_VALUE:   return !this->setConcreteMemoryValueCallbacks.empty();
         case SET_CONCRETE_REGISTER_VALUE: return !this->setConcreteRegisterValueCallbacks.empty();
@@ -334,5 +471,169 @@ namespace triton {
       return this->defined;
     }
 
+
+    triton::usize Callbacks::getSymbolicSimplificationVersion(void) const {
+      return this->simplificationVersion;
+    }
+
+
+    void CallbackFilter::addRange(triton::uint64 addr, triton::usize size) {
+      if (size == 0)
+        return;
+
+      triton::uint64 first = addr;
+      triton::uint64 last  = addr + (size - 1);
+
+      if (last < first)
+        throw triton::exceptions::Callbacks("CallbackFilter::addRange(): The range wraps around the address space.");
+
+      /* Merges the ranges overlapping or adjacent to [first, last] */
+      auto it = this->ranges.upper_bound(first);
+      if (it != this->ranges.begin()) {
+        auto prev = std::prev(it);
+        if (prev->second == std::numeric_limits<triton::uint64>::max() || prev->second + 1 >= first)
+          it = prev;
+      }
+
+      while (it != this->ranges.end() && (last == std::numeric_limits<triton::uint64>::max() || it->first <= last + 1)) {
+        first = std::min(first, it->first);
+        last  = std::max(last, it->second);
+        it    = this->ranges.erase(it);
+      }
+
+      this->ranges[first] = last;
+    }
+
+
+    void CallbackFilter::addRegister(const triton::arch::Register& reg) {
+      this->registers.insert(reg.getId());
+    }
+
+
+    bool CallbackFilter::isWatched(triton::uint64 addr, triton::usize size) const {
+      if (size == 0 || this->ranges.empty())
+        return false;
+
+      triton::uint64 last = addr + (size - 1);
+      if (last < addr)
+        last = std::numeric_limits<triton::uint64>::max();
+
+      /* The last range starting at or before the last byte of the access */
+      auto it = this->ranges.upper_bound(last);
+      if (it == this->ranges.begin())
+        return false;
+
+      return std::prev(it)->second >= addr;
+    }
+
+
+    bool CallbackFilter::isWatched(const triton::arch::Register& reg, const triton::arch::Register& parent) const {
+      if (this->registers.empty())
+        return false;
+      return this->registers.find(reg.getId()) != this->registers.end() || this->registers.find(parent.getId()) != this->registers.end();
+    }
+
+
+    triton::usize CallbackFilter::getNumberOfRanges(void) const {
+      return this->ranges.size();
+    }
+
+
+    triton::usize CallbackFilter::getNumberOfRegisters(void) const {
+      return this->registers.size();
+    }
+
+
+    getConcreteMemoryValueCallback filteredCallback(const getConcreteMemoryValueCallback& cb, const CallbackFilter& filter) {
+      auto watch = std::make_shared<const CallbackFilter>(filter);
+      return getConcreteMemoryValueCallback([cb, watch](triton::Context& ctx, const triton::arch::MemoryAccess& mem) {
+        if (watch->isWatched(mem.getAddress(), mem.getSize()))
+          cb(ctx, mem);
+      }, cb.getId());
+    }
+
+
+    getConcreteMemoryPageCallback filteredCallback(const getConcreteMemoryPageCallback& cb, const CallbackFilter& filter) {
+      auto watch = std::make_shared<const CallbackFilter>(filter);
+      return getConcreteMemoryPageCallback([cb, watch](triton::Context& ctx, triton::uint64 addr) {
+        if (watch->isWatched(addr, triton::arch::ConcreteMemory::pageSize))
+          return cb(ctx, addr);
+        return std::vector<triton::uint8>();
+      }, cb.getId());
+    }
+
+
+    getConcreteRegisterValueCallback filteredCallback(const getConcreteRegisterValueCallback& cb, const CallbackFilter& filter) {
+      auto watch = std::make_shared<const CallbackFilter>(filter);
+      return getConcreteRegisterValueCallback([cb, watch](triton::Context& ctx, const triton::arch::Register& reg) {
+        if (watch->isWatched(reg, ctx.getParentRegister(reg)))
+          cb(ctx, reg);
+      }, cb.getId());
+    }
+
+
+    setConcreteMemoryValueCallback filteredCallback(const setConcreteMemoryValueCallback& cb, const CallbackFilter& filter) {
+      auto watch = std::make_shared<const CallbackFilter>(filter);
+      return setConcreteMemoryValueCallback([cb, watch](triton::Context& ctx, const triton::arch::MemoryAccess& mem, const triton::uint512& value) {
+        if (watch->isWatched(mem.getAddress(), mem.getSize()))
+          cb(ctx, mem, value);
+      }, cb.getId());
+    }
+
+
+    setConcreteRegisterValueCallback filteredCallback(const setConcreteRegisterValueCallback& cb, const CallbackFilter& filter) {
+      auto watch = std::make_shared<const CallbackFilter>(filter);
+      return setConcreteRegisterValueCallback([cb, watch](triton::Context& ctx, const triton::arch::Register& reg, const triton::uint512& value) {
+        if (watch->isWatched(reg, ctx.getParentRegister(reg)))
+          cb(ctx, reg, value);
+      }, cb.getId());
+    }
+
+
+    getConcreteMemoryValueCallback nativeCallback(nativeGetConcreteMemoryValueCallback function, void* user) {
+      return getConcreteMemoryValueCallback([function, user](triton::Context& ctx, const triton::arch::MemoryAccess& mem) {
+        triton::uint8 value[triton::size::dqqword] = {0};
+        if (function(user, mem.getAddress(), value, mem.getSize()) != 0)
+          ctx.setConcreteMemoryAreaValue(mem.getAddress(), value, mem.getSize(), false);
+      }, reinterpret_cast<void*>(function));
+    }
+
+
+    getConcreteMemoryPageCallback nativeCallback(nativeGetConcreteMemoryPageCallback function, void* user) {
+      return getConcreteMemoryPageCallback([function, user](triton::Context& ctx, triton::uint64 addr) {
+        std::vector<triton::uint8> page(triton::arch::ConcreteMemory::pageSize);
+        triton::uint32 size = function(user, addr, page.data(), static_cast<triton::uint32>(page.size()));
+        page.resize(std::min<triton::usize>(size, page.size()));
+        return page;
+      }, reinterpret_cast<void*>(function));
+    }
+
+
+    getConcreteRegisterValueCallback nativeCallback(nativeGetConcreteRegisterValueCallback function, void* user) {
+      return getConcreteRegisterValueCallback([function, user](triton::Context& ctx, const triton::arch::Register& reg) {
+        triton::uint8 value[triton::size::dqqword] = {0};
+        if (function(user, reg.getId(), value, reg.getSize()) != 0)
+          ctx.setConcreteRegisterValue(reg, triton::utils::cast<triton::uint512>(value), false);
+      }, reinterpret_cast<void*>(function));
+    }
+
+
+    setConcreteMemoryValueCallback nativeCallback(nativeSetConcreteMemoryValueCallback function, void* user) {
+      return setConcreteMemoryValueCallback([function, user](triton::Context& ctx, const triton::arch::MemoryAccess& mem, const triton::uint512& value) {
+        triton::uint8 buffer[triton::size::dqqword] = {0};
+        triton::utils::fromUintToBuffer(value, buffer);
+        function(user, mem.getAddress(), buffer, mem.getSize());
+      }, reinterpret_cast<void*>(function));
+    }
+
+
+    setConcreteRegisterValueCallback nativeCallback(nativeSetConcreteRegisterValueCallback function, void* user) {
+      return setConcreteRegisterValueCallback([function, user](triton::Context& ctx, const triton::arch::Register& reg, const triton::uint512& value) {
+        triton::uint8 buffer[triton::size::dqqword] = {0};
+        triton::utils::fromUintToBuffer(value, buffer);
+        function(user, reg.getId(), buffer, reg.getSize());
+      }, reinterpret_cast<void*>(function));
+    }
+
   }; /* callbacks namespace */
 }; /* triton namespace */
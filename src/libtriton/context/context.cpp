@@ -7,16 +7,32 @@
 
 #include <triton/aarch64Cpu.hpp>
 #include <triton/arm32Cpu.hpp>
+#include <triton/astSmtParser.hpp>
 #include <triton/config.hpp>
 #include <triton/context.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/solverCorpus.hpp>
+#include <triton/symbolicSummary.hpp>
+#include <triton/taintSummary.hpp>
+#include <triton/tracing.hpp>
 #include <triton/x8664Cpu.hpp>
 #include <triton/x86Cpu.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
 #include <list>
 #include <map>
 #include <memory>
 #include <new>
+#include <set>
+#include <sstream>
+#include <streambuf>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 
 /*!
@@ -168,6 +184,164 @@ automate reverse engineering, perform software verification or just emulate code
 
 namespace triton {
 
+  /* Returns a copy of a CPU of the given architecture */
+  static triton::arch::CpuInterface* copyCpu(triton::arch::architecture_e arch, const triton::arch::CpuInterface* cpu) {
+    switch (arch) {
+      case triton::arch::ARCH_X86_64:  return new(std::nothrow) triton::arch::x86::x8664Cpu(*static_cast<const triton::arch::x86::x8664Cpu*>(cpu));
+      case triton::arch::ARCH_X86:     return new(std::nothrow) triton::arch::x86::x86Cpu(*static_cast<const triton::arch::x86::x86Cpu*>(cpu));
+      case triton::arch::ARCH_ARM32:   return new(std::nothrow) triton::arch::arm::arm32::Arm32Cpu(*static_cast<const triton::arch::arm::arm32::Arm32Cpu*>(cpu));
+      case triton::arch::ARCH_AARCH64: return new(std::nothrow) triton::arch::arm::aarch64::AArch64Cpu(*static_cast<const triton::arch::arm::aarch64::AArch64Cpu*>(cpu));
+      default:
+        throw triton::exceptions::Context("Context::copyCpu(): Invalid architecture.");
+    }
+  }
+
+
+  /* Checkpoint constants */
+  static constexpr triton::uint32 CHECKPOINT_MAGIC   = 0x504b4354; /* "TCKP" */
+  static constexpr triton::uint32 CHECKPOINT_VERSION = 2;
+  static constexpr triton::usize  CHECKPOINT_HEADER  = 24;
+
+
+  /* The modes are stored by name, their ids follow the alphabetical order of the enum and move when a mode is added */
+  static const std::pair<triton::modes::mode_e, const char*> checkpointModes[] = {
+    {triton::modes::ALIGNED_MEMORY,                 "ALIGNED_MEMORY"},
+    {triton::modes::AST_BALANCING,                  "AST_BALANCING"},
+    {triton::modes::AST_CONCURRENT,                 "AST_CONCURRENT"},
+    {triton::modes::AST_HASH_CONSING,               "AST_HASH_CONSING"},
+    {triton::modes::AST_OPTIMIZATIONS,              "AST_OPTIMIZATIONS"},
+    {triton::modes::AST_SLAB_ALLOCATOR,             "AST_SLAB_ALLOCATOR"},
+    {triton::modes::AST_WIDE_HASH,                  "AST_WIDE_HASH"},
+    {triton::modes::BULK_STRING_INSTRUCTIONS,       "BULK_STRING_INSTRUCTIONS"},
+    {triton::modes::CONCRETE_FAST_PATH,             "CONCRETE_FAST_PATH"},
+    {triton::modes::CONCRETIZE_UNDEFINED_REGISTERS, "CONCRETIZE_UNDEFINED_REGISTERS"},
+    {triton::modes::CONSTANT_FOLDING,               "CONSTANT_FOLDING"},
+    {triton::modes::EFFECTIVE_ADDRESS_CACHE,        "EFFECTIVE_ADDRESS_CACHE"},
+    {triton::modes::LAZY_FLAGS,                     "LAZY_FLAGS"},
+    {triton::modes::LAZY_SUBREGISTERS,              "LAZY_SUBREGISTERS"},
+    {triton::modes::LOOP_SUMMARIZATION,             "LOOP_SUMMARIZATION"},
+    {triton::modes::MBA_SIMPLIFICATION,             "MBA_SIMPLIFICATION"},
+    {triton::modes::MEMORY_ARRAY,                   "MEMORY_ARRAY"},
+    {triton::modes::ONLY_ON_SYMBOLIZED,             "ONLY_ON_SYMBOLIZED"},
+    {triton::modes::ONLY_ON_TAINTED,                "ONLY_ON_TAINTED"},
+    {triton::modes::PC_DEDUPLICATION,               "PC_DEDUPLICATION"},
+    {triton::modes::PC_TRACKING_SYMBOLIC,           "PC_TRACKING_SYMBOLIC"},
+    {triton::modes::POINTER_RESOLUTION,             "POINTER_RESOLUTION"},
+    {triton::modes::STATE_MERGING,                  "STATE_MERGING"},
+    {triton::modes::SYMBOLIZE_INDEX_ROTATION,       "SYMBOLIZE_INDEX_ROTATION"},
+    {triton::modes::SYMBOLIZE_LOAD,                 "SYMBOLIZE_LOAD"},
+    {triton::modes::SYMBOLIZE_STORE,                "SYMBOLIZE_STORE"},
+    {triton::modes::TAINT_ONLY,                     "TAINT_ONLY"},
+    {triton::modes::TAINT_THROUGH_POINTERS,         "TAINT_THROUGH_POINTERS"},
+  };
+
+  static_assert(sizeof(checkpointModes) / sizeof(checkpointModes[0]) == triton::modes::TAINT_THROUGH_POINTERS + 1, "Every mode needs a name in the checkpoints.");
+
+
+  /* The kinds of the memory entries of a checkpoint */
+  enum checkpoint_memory_e : triton::uint64 {
+    CHECKPOINT_DATA    = 0,   /* `size` bytes at `offset` */
+    CHECKPOINT_ZEROS   = 1,   /* `size` zeros */
+    CHECKPOINT_PARTIAL = 2,   /* a page at `offset`, followed by its bitmap of defined bytes */
+  };
+
+
+  static void writeWord(std::ostream& stream, triton::uint64 value) {
+    char bytes[8];
+    for (triton::uint32 i = 0; i < 8; i++)
+      bytes[i] = static_cast<char>((value >> (i * 8)) & 0xff);
+    stream.write(bytes, sizeof(bytes));
+  }
+
+
+  static triton::uint64 readWord(std::istream& stream) {
+    char bytes[8];
+    triton::uint64 value = 0;
+
+    if (!stream.read(bytes, sizeof(bytes)))
+      throw triton::exceptions::Context("Context::load(): Truncated checkpoint.");
+
+    for (triton::uint32 i = 0; i < 8; i++)
+      value |= static_cast<triton::uint64>(static_cast<triton::uint8>(bytes[i])) << (i * 8);
+
+    return value;
+  }
+
+
+  static void writeString(std::ostream& stream, const std::string& value) {
+    writeWord(stream, value.size());
+    stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+  }
+
+
+  static std::string readString(std::istream& stream) {
+    std::string value(readWord(stream), '\0');
+
+    if (!stream.read(&value[0], static_cast<std::streamsize>(value.size())))
+      throw triton::exceptions::Context("Context::load(): Truncated checkpoint.");
+
+    return value;
+  }
+
+
+  /* The digest of the layout of the register file: the name and the slot of each register, by name */
+  static triton::uint64 registerLayoutDigest(const triton::Context& ctx, triton::usize* count) {
+    std::map<std::string, triton::arch::register_e> registers;
+    triton::uint64 digest = 0xcbf29ce484222325ULL;
+
+    for (const auto& item : ctx.getAllRegisters())
+      registers[item.second.getName()] = item.first;
+
+    auto mix = [&digest](triton::uint64 value) {
+      digest = (digest ^ value) * 0x100000001b3ULL;
+    };
+
+    for (const auto& item : registers) {
+      const auto& slot = ctx.getConcreteRegisterSlot(item.second);
+      for (char c : item.first)
+        mix(static_cast<triton::uint8>(c));
+      mix(slot.offset);
+      mix(slot.size);
+      mix(slot.low);
+      mix(slot.bitSize);
+    }
+
+    *count = registers.size();
+    return digest;
+  }
+
+
+  /* Reads the mapped bytes of a checkpoint as a stream, without copying them */
+  class CheckpointBuffer : public std::streambuf {
+    public:
+      CheckpointBuffer(const triton::uint8* data, triton::usize size) {
+        char* base = const_cast<char*>(reinterpret_cast<const char*>(data));
+        this->setg(base, base, base + size);
+      }
+  };
+
+
+  /* Copies the concrete state (registers and memory) of a CPU into another CPU of the same architecture */
+  static void copyCpuState(triton::arch::architecture_e arch, triton::arch::CpuInterface* dst, const triton::arch::CpuInterface* src) {
+    switch (arch) {
+      case triton::arch::ARCH_X86_64:
+        *static_cast<triton::arch::x86::x8664Cpu*>(dst) = *static_cast<const triton::arch::x86::x8664Cpu*>(src);
+        break;
+      case triton::arch::ARCH_X86:
+        *static_cast<triton::arch::x86::x86Cpu*>(dst) = *static_cast<const triton::arch::x86::x86Cpu*>(src);
+        break;
+      case triton::arch::ARCH_ARM32:
+        *static_cast<triton::arch::arm::arm32::Arm32Cpu*>(dst) = *static_cast<const triton::arch::arm::arm32::Arm32Cpu*>(src);
+        break;
+      case triton::arch::ARCH_AARCH64:
+        *static_cast<triton::arch::arm::aarch64::AArch64Cpu*>(dst) = *static_cast<const triton::arch::arm::aarch64::AArch64Cpu*>(src);
+        break;
+      default:
+        throw triton::exceptions::Context("Context::copyCpuState(): Invalid architecture.");
+    }
+  }
+
+
   Context::Context() :
     callbacks(*this),
     arch(&this->callbacks) {
@@ -182,6 +356,14 @@ namespace triton {
   }
 
 
+  Context::Context(triton::arch::architecture_e arch, std::pmr::memory_resource* resource) :
+    Context() {
+    this->resource = resource;
+    this->astCtxt  = std::make_shared<triton::ast::AstContext>(this->modes, resource);
+    this->setArchitecture(arch);
+  }
+
+
   Context::~Context() {
     this->removeEngines();
   }
@@ -252,6 +434,13 @@ namespace triton {
     /* Setup and init the targeted architecture */
     this->arch.setArchitecture(arch);
 
+    /* The pages of the concrete memory come from the memory resource */
+    if (this->resource) {
+      triton::arch::ConcreteMemory memory;
+      memory.setMemoryResource(this->resource);
+      this->getCpuInstance()->swapConcreteMemory(memory);
+    }
+
     /* remove and re-init previous engines (when setArchitecture() has been called twice) */
     this->removeEngines();
     this->initEngines();
@@ -349,7 +538,7 @@ namespace triton {
     return this->arch.getAllRegisters();
   }
 
-  const std::unordered_map<triton::uint64, triton::uint8, IdentityHash<triton::uint64>>& Context::getConcreteMemory(void) const {
+  const triton::arch::ConcreteMemory& Context::getConcreteMemory(void) const {
     this->checkArchitecture();
     return this->arch.getConcreteMemory();
   }
@@ -379,12 +568,39 @@ namespace triton {
   }
 
 
+  void Context::readConcreteMemory(triton::uint64 baseAddr, void* area, triton::usize size, bool execCallbacks) const {
+    this->checkArchitecture();
+    this->arch.readConcreteMemory(baseAddr, area, size, execCallbacks);
+  }
+
+
   triton::uint512 Context::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
     this->checkArchitecture();
+    /* Synchronize the concrete value of a deferred flag */
+    if (this->symbolic)
+      this->symbolic->materializeLazyRegister(reg);
     return this->arch.getConcreteRegisterValue(reg, execCallbacks);
   }
 
 
+  const triton::arch::RegisterSlot& Context::getConcreteRegisterSlot(triton::arch::register_e id) const {
+    this->checkArchitecture();
+    return this->arch.getConcreteRegisterSlot(id);
+  }
+
+
+  const triton::uint8* Context::getConcreteRegisterFile(void) const {
+    this->checkArchitecture();
+    return this->arch.getConcreteRegisterFile();
+  }
+
+
+  triton::usize Context::getConcreteRegisterFileSize(void) const {
+    this->checkArchitecture();
+    return this->arch.getConcreteRegisterFileSize();
+  }
+
+
   void Context::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value, bool execCallbacks) {
     this->checkArchitecture();
     this->arch.setConcreteMemoryValue(addr, value, execCallbacks);
@@ -433,6 +649,334 @@ namespace triton {
   }
 
 
+  void Context::writeConcreteMemory(triton::uint64 baseAddr, const void* area, triton::usize size, bool execCallbacks) {
+    this->checkArchitecture();
+    this->arch.writeConcreteMemory(baseAddr, area, size, execCallbacks);
+    /*
+     * In order to synchronize the concrete state with the symbolic
+     * one, the symbolic expressions are concretized.
+     */
+    this->concretizeMemoryArea(baseAddr, size);
+  }
+
+
+  void Context::concretizeMemoryArea(triton::uint64 baseAddr, triton::uint64 size, bool array) {
+    this->checkSymbolic();
+
+    /* The memory array must record every concretized cell */
+    if (array && this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY)) {
+      for (triton::uint64 index = 0; index < size; index++)
+        this->symbolic->concretizeMemory(baseAddr + index, array);
+      return;
+    }
+
+    /* Otherwise only visit the symbolic cells */
+    for (triton::uint64 addr : this->symbolic->getSymbolicMemoryAddresses(baseAddr, size)) {
+      this->concretizeMemory(addr);
+    }
+  }
+
+
+  std::vector<triton::loaders::Segment> Context::loadBinary(const std::string& path) {
+    this->checkArchitecture();
+    this->checkSymbolic();
+
+    triton::loaders::BinaryLoader loader(path);
+    const auto& file     = loader.getFile();
+    const auto& segments = loader.getSegments();
+
+    for (const auto& segment : segments) {
+      this->arch.mapConcreteMemoryArea(segment.address, file->getData() + segment.offset, segment.fileSize, file);
+      if (segment.size > segment.fileSize)
+        this->arch.mapConcreteMemoryArea(segment.address + segment.fileSize, nullptr, segment.size - segment.fileSize, nullptr);
+    }
+
+    /*
+     * In order to synchronize the concrete state with the symbolic
+     * one, the symbolic expressions of mapped cells are concretized.
+     */
+    for (const auto& segment : segments) {
+      this->concretizeMemoryArea(segment.address, segment.size, false);
+    }
+
+    return segments;
+  }
+
+
+  triton::usize Context::replayTrace(const std::string& path, triton::usize count) {
+    triton::loaders::TraceReader reader(path);
+    return this->replayTrace(reader, count);
+  }
+
+
+  triton::usize Context::replayTrace(triton::loaders::TraceReader& reader, triton::usize count) {
+    this->checkArchitecture();
+
+    if (reader.getArchitecture() != this->getArchitecture())
+      throw triton::exceptions::Context("Context::replayTrace(): The trace is not of the architecture of the context.");
+
+    triton::usize replayed = 0;
+    while (count == 0 || replayed < count) {
+      const triton::loaders::TraceRecord* record = reader.next();
+      if (record == nullptr)
+        break;
+
+      /* The deltas are the concrete state of the tracer, the symbolic one is kept */
+      for (const auto& delta : record->registers)
+        this->arch.setConcreteRegisterValue(this->getRegister(delta.first), delta.second, false);
+
+      for (const auto& delta : record->memory)
+        this->arch.setConcreteMemoryAreaValue(delta.address, record->bytes.data() + delta.offset, delta.size, false);
+
+      triton::arch::Instruction inst(record->address, record->opcode.data(), static_cast<triton::uint32>(record->opcode.size()));
+      this->processing(inst);
+      replayed++;
+    }
+
+    return replayed;
+  }
+
+
+  triton::usize Context::taintTrace(const std::string& path, triton::usize chunkSize, triton::uint32 threads) {
+    triton::loaders::TraceReader reader(path);
+    return this->taintTrace(reader, chunkSize, threads);
+  }
+
+
+  triton::usize Context::taintTrace(triton::loaders::TraceReader& reader, triton::usize chunkSize, triton::uint32 threads) {
+    this->checkArchitecture();
+    this->checkTaint();
+
+    if (reader.getArchitecture() != this->getArchitecture())
+      throw triton::exceptions::Context("Context::taintTrace(): The trace is not of the architecture of the context.");
+
+    triton::usize count = threads ? threads : std::thread::hardware_concurrency();
+    count     = std::max<triton::usize>(1, count);
+    chunkSize = std::max<triton::usize>(1, chunkSize);
+
+    /* The concrete memory is only read by the workers while the chunks are summarized */
+    auto memory = [this](triton::uint64 addr) {
+      return this->arch.getConcreteMemoryValue(addr, false);
+    };
+
+    std::vector<triton::loaders::TraceRecord> records;
+    triton::usize processed = 0;
+
+    while (true) {
+      records.clear();
+      while (records.size() < count * chunkSize) {
+        const triton::loaders::TraceRecord* record = reader.next();
+        if (record == nullptr)
+          break;
+        records.push_back(*record);
+      }
+
+      if (records.empty())
+        break;
+
+      std::vector<std::pair<triton::arch::register_e, triton::uint512>> registers;
+      for (const auto* reg : this->getParentRegisters())
+        registers.push_back({reg->getId(), this->arch.getConcreteRegisterValue(*reg, false)});
+
+      triton::usize chunks = (records.size() + chunkSize - 1) / chunkSize;
+      std::vector<triton::engines::taint::TaintSummary> summaries(chunks);
+      std::vector<std::exception_ptr> errors(chunks);
+      std::vector<std::thread> pool;
+
+      auto summarize = [&](triton::usize i) {
+        try {
+          triton::usize end = std::min(records.size(), (i + 1) * chunkSize);
+          summaries[i] = triton::engines::taint::TaintSummary::compute(this->getArchitecture(), records, i * chunkSize, end, registers, memory);
+        }
+        catch (...) {
+          errors[i] = std::current_exception();
+        }
+      };
+
+      for (triton::usize i = 1; i < chunks; i++) {
+        try {
+          pool.emplace_back(summarize, i);
+        }
+        catch (const std::system_error&) {
+          summarize(i);
+        }
+      }
+
+      summarize(0);
+      for (auto& thread : pool)
+        thread.join();
+
+      for (const auto& error : errors) {
+        if (error)
+          std::rethrow_exception(error);
+      }
+
+      for (const auto& summary : summaries)
+        summary.apply(*this->taint, *this->arch.getCpuInstance());
+
+      /* The concrete state follows the trace */
+      for (const auto& record : records) {
+        for (const auto& delta : record.registers)
+          this->arch.setConcreteRegisterValue(this->getRegister(delta.first), delta.second, false);
+
+        for (const auto& delta : record.memory)
+          this->arch.setConcreteMemoryAreaValue(delta.address, record.bytes.data() + delta.offset, delta.size, false);
+      }
+
+      processed += records.size();
+    }
+
+    return processed;
+  }
+
+
+  triton::usize Context::processTrace(const std::string& path, triton::usize segmentSize, triton::uint32 threads) {
+    triton::loaders::TraceReader reader(path);
+    return this->processTrace(reader, segmentSize, threads);
+  }
+
+
+  triton::usize Context::processTrace(triton::loaders::TraceReader& reader, triton::usize segmentSize, triton::uint32 threads) {
+    this->checkArchitecture();
+    this->checkSymbolic();
+
+    if (reader.getArchitecture() != this->getArchitecture())
+      throw triton::exceptions::Context("Context::processTrace(): The trace is not of the architecture of the context.");
+
+    if (this->isModeEnabled(triton::modes::MEMORY_ARRAY))
+      throw triton::exceptions::Context("Context::processTrace(): The MEMORY_ARRAY mode is not supported.");
+
+    triton::usize count = threads ? threads : std::thread::hardware_concurrency();
+    count       = std::max<triton::usize>(1, count);
+    segmentSize = std::max<triton::usize>(1, segmentSize);
+
+    /* The concrete memory is only read by the workers while the segments are summarized */
+    auto memory = [this](triton::uint64 addr) {
+      return this->arch.getConcreteMemoryValue(addr, false);
+    };
+
+    auto setDeltas = [this](const triton::loaders::TraceRecord& record) {
+      for (const auto& delta : record.registers)
+        this->arch.setConcreteRegisterValue(this->getRegister(delta.first), delta.second, false);
+
+      for (const auto& delta : record.memory)
+        this->arch.setConcreteMemoryAreaValue(delta.address, record.bytes.data() + delta.offset, delta.size, false);
+    };
+
+    std::vector<triton::loaders::TraceRecord> records;
+    triton::usize processed = 0;
+
+    while (true) {
+      records.clear();
+      while (records.size() < count * segmentSize) {
+        const triton::loaders::TraceRecord* record = reader.next();
+        if (record == nullptr)
+          break;
+        records.push_back(*record);
+      }
+
+      if (records.empty())
+        break;
+
+      std::vector<std::pair<triton::arch::register_e, triton::uint512>> registers;
+      for (const auto* reg : this->getParentRegisters())
+        registers.push_back({reg->getId(), this->arch.getConcreteRegisterValue(*reg, false)});
+
+      triton::usize segments = (records.size() + segmentSize - 1) / segmentSize;
+      std::vector<triton::engines::symbolic::SymbolicSummary> summaries(segments);
+      std::vector<std::exception_ptr> errors(segments);
+      std::vector<std::thread> pool;
+
+      auto summarize = [&](triton::usize i) {
+        try {
+          triton::usize end = std::min(records.size(), (i + 1) * segmentSize);
+          summaries[i] = triton::engines::symbolic::SymbolicSummary::compute(this->getArchitecture(), this->modes, records, i * segmentSize, end, registers, memory);
+        }
+        catch (...) {
+          errors[i] = std::current_exception();
+        }
+      };
+
+      for (triton::usize i = 1; i < segments; i++) {
+        try {
+          pool.emplace_back(summarize, i);
+        }
+        catch (const std::system_error&) {
+          summarize(i);
+        }
+      }
+
+      summarize(0);
+      for (auto& thread : pool)
+        thread.join();
+
+      for (const auto& error : errors) {
+        if (error)
+          std::rethrow_exception(error);
+      }
+
+      /*
+       * A summary starts after the deltas of its first record, and
+       * gives the concrete values of the locations changed by the
+       * deltas of its other records.
+       */
+      triton::usize next = 0;
+      for (const auto& summary : summaries) {
+        for (; next <= summary.getFirstRecord(); next++)
+          setDeltas(records[next]);
+        summary.apply(*this->symbolic, this->arch, this->astCtxt);
+        next = summary.getFirstRecord() + summary.getNumberOfRecords();
+      }
+
+      processed += records.size();
+    }
+
+    return processed;
+  }
+
+
+  void Context::attachGdbRemote(const std::string& endpoint, triton::usize prefetch) {
+    this->checkArchitecture();
+
+    #ifdef TRITON_REMOTE_INTERFACE
+    this->detachGdbRemote();
+
+    auto remote = std::make_shared<triton::loaders::GdbRemote>(endpoint, prefetch);
+    remote->syncRegisters(*this);
+
+    this->addCallback(triton::callbacks::GET_CONCRETE_MEMORY_PAGE, triton::callbacks::getConcreteMemoryPageCallback([remote](triton::Context& ctx, triton::uint64 addr) {
+      return remote->fetchPage(addr);
+    }, remote.get()));
+
+    this->gdbRemote = remote;
+    return;
+    #endif
+    throw triton::exceptions::Context("Context::attachGdbRemote(): Triton not built with the remote interface");
+  }
+
+
+  void Context::detachGdbRemote(void) {
+    if (this->gdbRemote == nullptr)
+      return;
+
+    /* The callbacks may have been cleared since the attachment */
+    if (this->callbacks.isDefined(triton::callbacks::GET_CONCRETE_MEMORY_PAGE)) {
+      try {
+        this->removeCallback(triton::callbacks::GET_CONCRETE_MEMORY_PAGE, triton::callbacks::getConcreteMemoryPageCallback(nullptr, this->gdbRemote.get()));
+      }
+      catch (const triton::exceptions::Exception&) {
+      }
+    }
+
+    this->gdbRemote = nullptr;
+  }
+
+
+  triton::loaders::GdbRemote* Context::getGdbRemote(void) const {
+    return this->gdbRemote.get();
+  }
+
+
   void Context::setConcreteRegisterValue(const triton::arch::Register& reg, const triton::uint512& value, bool execCallbacks) {
     this->checkArchitecture();
     this->arch.setConcreteRegisterValue(reg, value, execCallbacks);
@@ -444,33 +988,35 @@ namespace triton {
   }
 
 
+  void Context::setConcreteRegisterFile(const triton::uint8* file, triton::usize size) {
+    this->checkArchitecture();
+    this->arch.setConcreteRegisterFile(file, size);
+    /*
+     * In order to synchronize the concrete state with the symbolic
+     * one, the symbolic expressions of all registers are concretized.
+     */
+    this->concretizeAllRegister();
+  }
+
+
   void Context::setConcreteState(triton::arch::Architecture& other) {
     if (this->getArchitecture() != other.getArchitecture()) {
       throw triton::exceptions::Engines("Context::setConcreteState(): Not the same architecture.");
     }
 
-    switch (this->getArchitecture()) {
-      case triton::arch::ARCH_X86_64:
-        *static_cast<triton::arch::x86::x8664Cpu*>(this->getCpuInstance()) = *static_cast<triton::arch::x86::x8664Cpu*>(other.getCpuInstance());
-        break;
-      case triton::arch::ARCH_X86:
-        *static_cast<triton::arch::x86::x86Cpu*>(this->getCpuInstance()) = *static_cast<triton::arch::x86::x86Cpu*>(other.getCpuInstance());
-        break;
-      case triton::arch::ARCH_ARM32:
-        *static_cast<triton::arch::arm::arm32::Arm32Cpu*>(this->getCpuInstance()) = *static_cast<triton::arch::arm::arm32::Arm32Cpu*>(other.getCpuInstance());
-        break;
-      case triton::arch::ARCH_AARCH64:
-        *static_cast<triton::arch::arm::aarch64::AArch64Cpu*>(this->getCpuInstance()) = *static_cast<triton::arch::arm::aarch64::AArch64Cpu*>(other.getCpuInstance());
-        break;
-      default:
-        throw triton::exceptions::Engines("Context::setConcreteState(): Invalid architecture.");
-    }
+    copyCpuState(this->getArchitecture(), this->getCpuInstance(), other.getCpuInstance());
 
     this->concretizeAllMemory();
     this->concretizeAllRegister();
   }
 
 
+  void Context::setConcreteState(triton::Context& other) {
+    other.checkArchitecture();
+    this->setConcreteState(other.arch);
+  }
+
+
   bool Context::isConcreteMemoryValueDefined(const triton::arch::MemoryAccess& mem) const {
     this->checkArchitecture();
     return this->arch.isConcreteMemoryValueDefined(mem);
@@ -525,6 +1071,54 @@ namespace triton {
   }
 
 
+  std::vector<triton::arch::BasicBlock> Context::disassemblyBlocks(triton::uint64 addr, triton::usize size, triton::uint32 threads) const {
+    this->checkArchitecture();
+    return this->arch.disassemblyBlocks(addr, size, threads);
+  }
+
+
+  triton::arch::DecodeInfo Context::decode(const triton::uint8* opcode, triton::uint32 size, triton::uint64 addr) const {
+    this->checkArchitecture();
+    return this->arch.decode(opcode, size, addr);
+  }
+
+
+  std::vector<triton::arch::DecodeInfo> Context::decode(triton::uint64 addr, triton::usize size) const {
+    this->checkArchitecture();
+    return this->arch.decode(addr, size);
+  }
+
+
+  void Context::enableDecodeCache(bool flag) {
+    this->checkArchitecture();
+    this->arch.enableDecodeCache(flag);
+  }
+
+
+  bool Context::isDecodeCacheEnabled(void) const {
+    this->checkArchitecture();
+    return this->arch.isDecodeCacheEnabled();
+  }
+
+
+  void Context::clearDecodeCache(void) {
+    this->checkArchitecture();
+    this->arch.clearDecodeCache();
+  }
+
+
+  void Context::openPersistentDecodeCache(const std::string& path, triton::usize slots) {
+    this->checkArchitecture();
+    this->arch.openPersistentDecodeCache(path, slots);
+  }
+
+
+  void Context::closePersistentDecodeCache(void) {
+    this->checkArchitecture();
+    this->arch.closePersistentDecodeCache();
+  }
+
+
 
   /* Processing Context ================================================================================ */
 
@@ -535,11 +1129,16 @@ namespace triton {
     if (this->symbolic == nullptr)
       throw triton::exceptions::Context("Context::initEngines(): Not enough memory.");
 
+    /* The symbolic pointers are resolved by the solver of the context (see POINTER_RESOLUTION) */
+    this->symbolic->setPointerResolver([this](const triton::ast::SharedAbstractNode& address, triton::usize limit) {
+      return this->resolvePointer(address, limit);
+    });
+
     this->solver = new(std::nothrow) triton::engines::solver::SolverEngine();
     if (this->solver == nullptr)
       throw triton::exceptions::Context("Context::initEngines(): Not enough memory.");
 
-    this->taint = new(std::nothrow) triton::engines::taint::TaintEngine(this->modes, this->symbolic, *this->getCpuInstance());
+    this->taint = new(std::nothrow) triton::engines::taint::TaintEngine(this->modes, this->symbolic, *this->getCpuInstance(), this->resource);
     if (this->taint == nullptr)
       throw triton::exceptions::Context("Context::initEngines(): Not enough memory.");
 
@@ -551,12 +1150,32 @@ namespace triton {
     if (this->irBuilder == nullptr)
       throw triton::exceptions::Context("Context::initEngines(): Not enough memory.");
 
+    /* The corpus of dumpSolverQueries() outlives the engines */
+    if (this->queryCorpus != nullptr)
+      this->traceQueryCorpus();
+
     /* Setup registers shortcut */
     this->registers.init(this->arch.getArchitecture());
   }
 
 
   void Context::removeEngines(void) {
+    TRITON_TRACE("context", "Context::removeEngines");
+
+    /* Snapshots and the side of a merge refer to the engines */
+    this->snapshots.clear();
+    this->merge = nullptr;
+
+    /* The reclamation thread keeps the AST context alive */
+    if (this->astCtxt)
+      this->astCtxt->setReclamation(false);
+
+    /* The SMT stream is held by the symbolic engine */
+    this->smtFile = nullptr;
+
+    /* The AST context is only replaced once the engines used it */
+    bool used = (this->symbolic != nullptr);
+
     if (this->isArchitectureValid()) {
       delete this->irBuilder;
       delete this->lifting;
@@ -564,7 +1183,6 @@ namespace triton {
       delete this->symbolic;
       delete this->taint;
 
-      this->astCtxt   = nullptr;
       this->irBuilder = nullptr;
       this->lifting   = nullptr;
       this->solver    = nullptr;
@@ -573,7 +1191,8 @@ namespace triton {
     }
 
     // Clean up the ast context
-    this->astCtxt = std::make_shared<triton::ast::AstContext>(this->modes);
+    if (used || this->astCtxt == nullptr)
+      this->astCtxt = std::make_shared<triton::ast::AstContext>(this->modes, this->resource);
 
     // Clean up the registers shortcut
     this->registers.clear();
@@ -587,537 +1206,2469 @@ namespace triton {
       this->clearArchitecture();
       this->clearCallbacks();
       this->clearModes();
+      this->concretization.clear();
     }
   }
 
 
-  triton::arch::exception_e Context::processing(triton::arch::Instruction& inst) {
-    this->checkArchitecture();
-    this->arch.disassembly(inst);
-    return this->irBuilder->buildSemantics(inst);
-  }
-
-
-  triton::arch::exception_e Context::processing(triton::arch::BasicBlock& block, triton::uint64 addr) {
-    this->checkArchitecture();
-    this->arch.disassembly(block, addr);
-    return this->irBuilder->buildSemantics(block);
-  }
-
-
-
-  /* IR builder Context ================================================================================= */
+  void Context::warmReset(void) {
+    if (!this->isArchitectureValid())
+      return;
 
-  triton::arch::exception_e Context::buildSemantics(triton::arch::Instruction& inst) {
     this->checkIrBuilder();
-    return this->irBuilder->buildSemantics(inst);
+    this->checkSolver();
+    this->checkSymbolic();
+    this->checkTaint();
+
+    /*
+     * A fork shares its modes and its AST context with the other side, whose
+     * variables would be wiped by a reset in place. This context gets its own
+     * ones instead, and new engines built on them as in reset().
+     */
+    if (this->forks.use_count() > 1) {
+      this->forks   = nullptr;
+      this->modes   = std::make_shared<triton::modes::Modes>();
+      this->astCtxt = nullptr;
+      this->removeEngines();
+      this->initEngines();
+      this->clearArchitecture();
+      this->clearCallbacks();
+      this->concretization.clear();
+      return;
+    }
+
+    /* Snapshots and the side of a merge refer to the dropped state */
+    this->snapshots.clear();
+    this->merge = nullptr;
+
+    /* The engines are kept, only their state is dropped */
+    this->symbolic->reset();
+    this->taint->reset();
+    this->irBuilder->reset();
+    this->solver->clearCounterexampleCache();
+    this->astCtxt->reset();
+    this->smtFile = nullptr;
+
+    this->clearArchitecture();
+    this->clearCallbacks();
+    this->clearModes();
+    this->concretization.clear();
   }
 
 
-  triton::arch::exception_e Context::buildSemantics(triton::arch::BasicBlock& block) {
+  triton::MemoryUsage Context::getMemoryUsage(void) const {
+    this->checkArchitecture();
     this->checkIrBuilder();
-    return this->irBuilder->buildSemantics(block);
+    this->checkSolver();
+    this->checkSymbolic();
+    this->checkTaint();
+
+    triton::MemoryUsage usage;
+
+    for (triton::usize type = 0; type <= triton::ast::STORE_NODE; type++) {
+      auto kind = static_cast<triton::ast::ast_e>(type);
+      auto count = this->astCtxt->getLiveNodes(kind);
+      if (count != 0) {
+        usage.astNodes[kind] = count;
+        usage.astNodesBytes[kind] = count * triton::ast::getNodeSize(kind);
+        usage.totalBytes += usage.astNodesBytes[kind];
+      }
+    }
+
+    /* A child edge is a pointer in the children of a node and an entry in the parents of its child */
+    usage.astChildrenBytes = this->astCtxt->getLiveChildren() * sizeof(triton::ast::SharedAbstractNode);
+    usage.astParentsBytes  = this->astCtxt->getLiveChildren() * (sizeof(triton::ast::AbstractNode*) + sizeof(std::pair<triton::uint32, triton::ast::WeakAbstractNode>));
+
+    this->symbolic->getMemoryUsage(usage);
+
+    const auto& memory = this->arch.getConcreteMemory();
+    usage.concreteMemoryPages = memory.getNumberOfPages();
+    usage.concreteMemoryBytes = usage.concreteMemoryPages * sizeof(triton::arch::ConcreteMemory::Page);
+
+    const auto& tainted = this->taint->getTaintedMemory();
+    usage.taintedMemory      = tainted.size();
+    usage.taintedMemoryBytes = tainted.getNumberOfPages() * sizeof(triton::engines::taint::TaintBitmap::Page);
+    usage.taintedRegisters   = this->taint->getTaintedRegisters().size();
+
+    usage.queryCache          = this->solver->getQueryCacheSize();
+    usage.counterexampleCache = this->solver->getCounterexampleCacheSize();
+    usage.semanticsCache      = this->irBuilder->getSemanticsCacheSize();
+    usage.concreteMemo        = this->irBuilder->getConcreteMemoStats().size;
+
+    usage.totalBytes += usage.astChildrenBytes + usage.astParentsBytes + usage.symbolicExpressionsBytes +
+                        usage.symbolicMemoryBytes + usage.concreteMemoryBytes + usage.taintedMemoryBytes;
+
+    return usage;
   }
 
 
-  triton::ast::SharedAstContext Context::getAstContext(void) {
-    return this->astCtxt;
+  void Context::enableTracing(bool flag) {
+    #ifdef TRITON_TRACING
+    triton::utils::enableTracing(flag);
+    #else
+    throw triton::exceptions::Context("Context::enableTracing(): Triton not built with tracing");
+    #endif
   }
 
 
+  bool Context::isTracingEnabled(void) const {
+    return triton::utils::isTracingEnabled();
+  }
 
-  /* AST representation Context ========================================================================= */
 
-  triton::ast::representations::mode_e Context::getAstRepresentationMode(void) const {
-    return this->astCtxt->getRepresentationMode();
+  triton::usize Context::dumpTrace(const std::string& path, bool perfetto) const {
+    std::ofstream stream(path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!stream.is_open())
+      throw triton::exceptions::Context("Context::dumpTrace(): Cannot open " + path);
+
+    if (perfetto)
+      triton::utils::writePerfettoTrace(stream);
+    else
+      triton::utils::writeChromeTrace(stream);
+
+    if (!stream.good())
+      throw triton::exceptions::Context("Context::dumpTrace(): Cannot write " + path);
+
+    return triton::utils::getTraceSize();
   }
 
 
-  void Context::setAstRepresentationMode(triton::ast::representations::mode_e mode) {
-    this->astCtxt->setRepresentationMode(mode);
+  void Context::clearTrace(void) {
+    triton::utils::clearTrace();
   }
 
 
+  triton::usize Context::snapshot(void) {
+    this->checkSymbolic();
+    this->checkTaint();
 
-  /* Callbacks Context ================================================================================= */
+    Snapshot snap;
+    snap.cpu.reset(copyCpu(this->getArchitecture(), this->getCpuInstance()));
+    snap.symbolic.reset(new(std::nothrow) triton::engines::symbolic::SymbolicEngine(*this->symbolic));
+    snap.taint.reset(new(std::nothrow) triton::engines::taint::TaintEngine(*this->taint));
 
-  template TRITON_EXPORT void Context::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::MemoryAccess&)> cb);
-  template TRITON_EXPORT void Context::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::Register&)> cb);
-  template TRITON_EXPORT void Context::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb);
-  template TRITON_EXPORT void Context::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::Register&, const triton::uint512& value)> cb);
-  template TRITON_EXPORT void Context::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<triton::ast::SharedAbstractNode(triton::Context&, const triton::ast::SharedAbstractNode&)> cb);
+    if (snap.cpu == nullptr || snap.symbolic == nullptr || snap.taint == nullptr)
+      throw triton::exceptions::Context("Context::snapshot(): Not enough memory.");
 
-  template TRITON_EXPORT void Context::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::MemoryAccess&)> cb);
-  template TRITON_EXPORT void Context::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::Register&)> cb);
-  template TRITON_EXPORT void Context::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb);
-  template TRITON_EXPORT void Context::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::Register&, const triton::uint512& value)> cb);
-  template TRITON_EXPORT void Context::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<triton::ast::SharedAbstractNode(triton::Context&, const triton::ast::SharedAbstractNode&)> cb);
+    triton::usize id = this->uniqueSnapshotId++;
+    this->snapshots.emplace(id, std::move(snap));
+    this->trackSnapshot(id);
 
+    return id;
+  }
 
-  void Context::clearCallbacks(void) {
-    this->callbacks.clearCallbacks();
+
+  void Context::restore(triton::usize id) {
+    this->checkSymbolic();
+    this->checkTaint();
+
+    auto it = this->snapshots.find(id);
+    if (it == this->snapshots.end())
+      throw triton::exceptions::Context("Context::restore(): Snapshot not found.");
+
+    copyCpuState(this->getArchitecture(), this->getCpuInstance(), it->second.cpu.get());
+    this->symbolic->copyState(*it->second.symbolic);
+    this->taint->copyState(*it->second.taint);
+    this->merge = nullptr;
+    this->trackSnapshot(id);
   }
 
 
-  triton::ast::SharedAbstractNode Context::processCallbacks(triton::callbacks::callback_e kind, triton::ast::SharedAbstractNode node) {
-    if (this->callbacks.isDefined()) {
-      return this->callbacks.processCallbacks(kind, node);
+  void Context::resetToSnapshot(triton::usize id) {
+    this->checkSymbolic();
+    this->checkTaint();
+
+    auto it = this->snapshots.find(id);
+    if (it == this->snapshots.end())
+      throw triton::exceptions::Context("Context::resetToSnapshot(): Snapshot not found.");
+
+    triton::arch::CpuInterface* cpu         = this->getCpuInstance();
+    const triton::arch::ConcreteMemory& base = it->second.cpu->getConcreteMemory();
+    triton::arch::ConcreteMemory memory;
+
+    /* Put the memory aside while the registers are copied */
+    cpu->swapConcreteMemory(memory);
+    bool restored = (this->trackedSnapshot == id && memory.restoreChanges(base));
+    copyCpuState(this->getArchitecture(), cpu, it->second.cpu.get());
+
+    if (!restored) {
+      memory = base;
+      memory.trackChanges();
+      this->trackedSnapshot = id;
     }
-    return node;
+
+    cpu->swapConcreteMemory(memory);
+    this->symbolic->copyState(*it->second.symbolic);
+    this->taint->copyState(*it->second.taint);
+    this->merge = nullptr;
   }
 
 
-  void Context::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::MemoryAccess& mem) {
-    if (this->callbacks.isDefined()) {
-      this->callbacks.processCallbacks(kind, mem);
+  void Context::trackSnapshot(triton::usize id) {
+    triton::arch::ConcreteMemory memory;
+    triton::arch::CpuInterface* cpu = this->getCpuInstance();
+
+    cpu->swapConcreteMemory(memory);
+    memory.trackChanges();
+    cpu->swapConcreteMemory(memory);
+    this->trackedSnapshot = id;
+  }
+
+
+  bool Context::isSnapshotExists(triton::usize id) const {
+    return this->snapshots.find(id) != this->snapshots.end();
+  }
+
+
+  void Context::removeSnapshot(triton::usize id) {
+    if (this->snapshots.erase(id) == 0)
+      throw triton::exceptions::Context("Context::removeSnapshot(): Snapshot not found.");
+    if (this->trackedSnapshot == id)
+      this->trackedSnapshot = static_cast<triton::usize>(-1);
+  }
+
+
+  void Context::clearSnapshots(void) {
+    this->snapshots.clear();
+    this->trackedSnapshot = static_cast<triton::usize>(-1);
+  }
+
+
+  std::unique_ptr<triton::Context> Context::fork(void) {
+    this->checkSymbolic();
+    this->checkTaint();
+
+    std::unique_ptr<triton::Context> ctx(new(std::nothrow) triton::Context());
+    if (ctx == nullptr)
+      throw triton::exceptions::Context("Context::fork(): Not enough memory.");
+
+    /* Nodes of both contexts belong to the same AST context */
+    if (this->forks == nullptr)
+      this->forks = std::make_shared<char>(0);
+
+    ctx->forks    = this->forks;
+    ctx->modes    = this->modes;
+    ctx->astCtxt  = this->astCtxt;
+    ctx->resource = this->resource;
+
+    ctx->arch.setArchitecture(this->getArchitecture());
+    ctx->initEngines();
+    ctx->setSolver(this->getSolver());
+
+    copyCpuState(this->getArchitecture(), ctx->getCpuInstance(), this->getCpuInstance());
+    ctx->symbolic->copyState(*this->symbolic);
+    ctx->taint->copyState(*this->taint);
+
+    return ctx;
+  }
+
+
+  void Context::save(const std::string& path) {
+    this->checkSymbolic();
+    this->checkTaint();
+
+    const auto& memory = this->arch.getConcreteMemory();
+    const auto& regions = memory.getRegions();
+    std::vector<std::tuple<triton::uint64, triton::uint64, triton::uint64, triton::uint64>> entries;
+    std::vector<std::pair<const triton::uint8*, triton::usize>> chunks;
+    triton::uint64 offset = 0;
+
+    /* Returns true if a region overlaps the page */
+    auto isShadowing = [&regions](triton::uint64 number) {
+      triton::uint64 addr = number * triton::arch::ConcreteMemory::pageSize;
+      auto it = regions.upper_bound(addr + (triton::arch::ConcreteMemory::pageSize - 1));
+      return it != regions.begin() && (--it)->first + (it->second.size - 1) >= addr;
+    };
+
+    /* The regions first, the pages shadow them */
+    for (const auto& region : regions) {
+      if (region.second.data == nullptr) {
+        entries.emplace_back(region.first, region.second.size, 0, CHECKPOINT_ZEROS);
+        continue;
+      }
+      entries.emplace_back(region.first, region.second.size, offset, CHECKPOINT_DATA);
+      chunks.emplace_back(region.second.data, region.second.size);
+      offset += region.second.size;
+    }
+
+    /* The runs of full pages are mapped at once, the other pages are written */
+    std::vector<triton::uint64> numbers;
+    for (const auto& page : memory.getPages())
+      numbers.push_back(page.first);
+    std::sort(numbers.begin(), numbers.end());
+
+    for (triton::uint64 number : numbers) {
+      const auto* page = memory.getPages().at(number).get();
+      triton::uint64 addr = number * triton::arch::ConcreteMemory::pageSize;
+
+      chunks.emplace_back(page->data, sizeof(page->data));
+      if (page->count == triton::arch::ConcreteMemory::pageSize && !isShadowing(number)) {
+        if (!entries.empty() && std::get<3>(entries.back()) == CHECKPOINT_DATA &&
+            std::get<0>(entries.back()) + std::get<1>(entries.back()) == addr &&
+            std::get<2>(entries.back()) + std::get<1>(entries.back()) == offset) {
+          std::get<1>(entries.back()) += sizeof(page->data);
+        }
+        else {
+          entries.emplace_back(addr, sizeof(page->data), offset, CHECKPOINT_DATA);
+        }
+        offset += sizeof(page->data);
+        continue;
+      }
+
+      entries.emplace_back(addr, sizeof(page->data), offset, CHECKPOINT_PARTIAL);
+      chunks.emplace_back(reinterpret_cast<const triton::uint8*>(page->defined), sizeof(page->defined));
+      offset += sizeof(page->data) + sizeof(page->defined);
+    }
+
+    /* The metadata: the modes, the registers, the index of the memory, then the symbolic and taint states */
+    std::ostringstream meta;
+    std::vector<const char*> enabled;
+    for (const auto& mode : checkpointModes) {
+      if (this->isModeEnabled(mode.first))
+        enabled.push_back(mode.second);
+    }
+
+    writeWord(meta, enabled.size());
+    for (const char* name : enabled)
+      writeString(meta, name);
+
+    triton::usize count = 0;
+    triton::uint64 layout = registerLayoutDigest(*this, &count);
+    writeWord(meta, count);
+    writeWord(meta, layout);
+    writeWord(meta, this->getConcreteRegisterFileSize());
+    meta.write(reinterpret_cast<const char*>(this->getConcreteRegisterFile()), static_cast<std::streamsize>(this->getConcreteRegisterFileSize()));
+
+    writeWord(meta, entries.size());
+    for (const auto& entry : entries) {
+      writeWord(meta, std::get<0>(entry));
+      writeWord(meta, std::get<1>(entry));
+      writeWord(meta, std::get<2>(entry));
+      writeWord(meta, std::get<3>(entry));
     }
+
+    this->symbolic->saveState(meta);
+    this->taint->saveState(meta);
+
+    /* The data are aligned on a page of the file */
+    std::string metadata = meta.str();
+    triton::uint64 dataOffset = CHECKPOINT_HEADER + metadata.size();
+    dataOffset = (dataOffset + triton::arch::ConcreteMemory::pageSize - 1) & ~static_cast<triton::uint64>(triton::arch::ConcreteMemory::pageSize - 1);
+
+    std::ofstream stream(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!stream)
+      throw triton::exceptions::Context("Context::save(): Cannot open the checkpoint.");
+
+    writeWord(stream, CHECKPOINT_MAGIC | (static_cast<triton::uint64>(CHECKPOINT_VERSION) << 32));
+    writeWord(stream, this->getArchitecture());
+    writeWord(stream, dataOffset);
+    stream.write(metadata.data(), static_cast<std::streamsize>(metadata.size()));
+    stream.write(std::string(dataOffset - CHECKPOINT_HEADER - metadata.size(), '\0').data(), static_cast<std::streamsize>(dataOffset - CHECKPOINT_HEADER - metadata.size()));
+
+    for (const auto& chunk : chunks)
+      stream.write(reinterpret_cast<const char*>(chunk.first), static_cast<std::streamsize>(chunk.second));
+
+    if (!stream)
+      throw triton::exceptions::Context("Context::save(): Cannot write the checkpoint.");
   }
 
 
-  void Context::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) {
-    if (this->callbacks.isDefined()) {
-      this->callbacks.processCallbacks(kind, reg);
+  void Context::load(const std::string& path) {
+    this->checkSymbolic();
+    this->checkTaint();
+
+    auto file = std::make_shared<triton::loaders::MappedFile>(path);
+    const triton::uint8* data = file->getData();
+    triton::usize size = file->getSize();
+
+    CheckpointBuffer buffer(data, size);
+    std::istream meta(&buffer);
+
+    triton::uint64 magic = readWord(meta);
+    if ((magic & 0xffffffff) != CHECKPOINT_MAGIC)
+      throw triton::exceptions::Context("Context::load(): Not a checkpoint.");
+
+    if ((magic >> 32) != CHECKPOINT_VERSION)
+      throw triton::exceptions::Context("Context::load(): Unsupported version of checkpoint.");
+
+    if (readWord(meta) != static_cast<triton::uint64>(this->getArchitecture()))
+      throw triton::exceptions::Context("Context::load(): The checkpoint is not of the architecture of the context.");
+
+    triton::uint64 dataOffset = readWord(meta);
+    if (dataOffset > size)
+      throw triton::exceptions::Context("Context::load(): Invalid checkpoint.");
+
+    /* The enabled modes, the ones unknown by this version are ignored */
+    std::vector<triton::modes::mode_e> modes;
+    triton::uint64 enabled = readWord(meta);
+    for (triton::uint64 index = 0; index < enabled; index++) {
+      std::string name = readString(meta);
+      for (const auto& mode : checkpointModes) {
+        if (name == mode.second)
+          modes.push_back(mode.first);
+      }
+    }
+
+    /* The register file is copied raw, so it must have the layout of this version */
+    triton::usize count = 0;
+    triton::uint64 layout = registerLayoutDigest(*this, &count);
+    if (readWord(meta) != count || readWord(meta) != layout)
+      throw triton::exceptions::Context("Context::load(): The register file of the checkpoint has another layout.");
+
+    std::vector<triton::uint8> registers(readWord(meta));
+    if (registers.size() != this->getConcreteRegisterFileSize())
+      throw triton::exceptions::Context("Context::load(): Invalid register file.");
+    if (!meta.read(reinterpret_cast<char*>(registers.data()), static_cast<std::streamsize>(registers.size())))
+      throw triton::exceptions::Context("Context::load(): Truncated checkpoint.");
+
+    std::vector<std::tuple<triton::uint64, triton::uint64, triton::uint64, triton::uint64>> entries(readWord(meta));
+    for (auto& entry : entries) {
+      std::get<0>(entry) = readWord(meta);
+      std::get<1>(entry) = readWord(meta);
+      std::get<2>(entry) = readWord(meta);
+      std::get<3>(entry) = readWord(meta);
+
+      triton::uint64 length = (std::get<3>(entry) == CHECKPOINT_ZEROS) ? 0 : std::get<1>(entry);
+      if (std::get<3>(entry) == CHECKPOINT_PARTIAL) {
+        if (std::get<1>(entry) != triton::arch::ConcreteMemory::pageSize)
+          throw triton::exceptions::Context("Context::load(): Invalid checkpoint.");
+        length += triton::arch::ConcreteMemory::bitmapSize * sizeof(triton::uint64);
+      }
+      if (std::get<3>(entry) > CHECKPOINT_PARTIAL || std::get<2>(entry) > size - dataOffset || length > size - dataOffset - std::get<2>(entry))
+        throw triton::exceptions::Context("Context::load(): Invalid checkpoint.");
+    }
+
+    /* The modes, then the concrete state */
+    this->clearModes();
+    for (auto mode : modes)
+      this->setMode(mode, true);
+
+    this->arch.setConcreteRegisterFile(registers.data(), registers.size());
+
+    std::vector<std::pair<triton::uint64, triton::usize>> defined;
+    const auto& memory = this->arch.getConcreteMemory();
+    for (const auto& region : memory.getRegions())
+      defined.emplace_back(region.first, region.second.size);
+    for (const auto& page : memory.getPages())
+      defined.emplace_back(page.first * triton::arch::ConcreteMemory::pageSize, triton::arch::ConcreteMemory::pageSize);
+    for (const auto& range : defined)
+      this->arch.clearConcreteMemoryValue(range.first, range.second);
+
+    /* The bytes of the file are read in place, the file being kept alive by the memory */
+    const triton::uint8* bytes = data + dataOffset;
+    for (const auto& entry : entries) {
+      triton::uint64 addr = std::get<0>(entry);
+
+      switch (std::get<3>(entry)) {
+        case CHECKPOINT_DATA:
+          this->arch.mapConcreteMemoryArea(addr, bytes + std::get<2>(entry), std::get<1>(entry), file);
+          break;
+
+        case CHECKPOINT_ZEROS:
+          this->arch.mapConcreteMemoryArea(addr, nullptr, std::get<1>(entry), file);
+          break;
+
+        default: {
+          const triton::uint8* page = bytes + std::get<2>(entry);
+          triton::uint64 bitmap[triton::arch::ConcreteMemory::bitmapSize];
+          std::memcpy(bitmap, page + triton::arch::ConcreteMemory::pageSize, sizeof(bitmap));
+
+          for (triton::usize i = 0; i < triton::arch::ConcreteMemory::pageSize;) {
+            if (((bitmap[i / 64] >> (i % 64)) & 1) == 0) {
+              i++;
+              continue;
+            }
+            triton::usize start = i;
+            while (i < triton::arch::ConcreteMemory::pageSize && ((bitmap[i / 64] >> (i % 64)) & 1))
+              i++;
+            this->arch.writeConcreteMemory(addr + start, page + start, i - start, false);
+          }
+          break;
+        }
+      }
     }
+
+    /* The symbolic and taint states */
+    this->symbolic->loadState(meta);
+    this->taint->loadState(meta);
   }
 
 
+  void Context::enableUndoJournal(bool flag, triton::usize capacity) {
+    this->checkSymbolic();
+    this->symbolic->enableUndoJournal(flag, capacity);
+  }
 
-  /* Modes Context======================================================================================= */
 
-  void Context::setMode(triton::modes::mode_e mode, bool flag) {
-    this->modes->setMode(mode, flag);
+  bool Context::isUndoJournalEnabled(void) const {
+    this->checkSymbolic();
+    return this->symbolic->isUndoJournalEnabled();
   }
 
 
-  bool Context::isModeEnabled(triton::modes::mode_e mode) const {
-    return this->modes->isModeEnabled(mode);
+  triton::usize Context::getUndoJournalSize(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getUndoJournalSize();
   }
 
 
-  void Context::clearModes(void) {
-    this->modes->clearModes();
+  void Context::stepBack(triton::usize count) {
+    this->checkSymbolic();
+    this->merge = nullptr;
+    this->symbolic->stepBack(count);
   }
 
 
+  triton::arch::exception_e Context::processing(triton::arch::Instruction& inst) {
+    TRITON_TRACE("processing", "Context::processing");
+
+    this->checkArchitecture();
+    this->arch.disassembly(inst);
+
+    if (!this->modes->isModeEnabled(triton::modes::STATE_MERGING)) {
+      this->merge = nullptr;
+      triton::arch::exception_e ret = this->irBuilder->buildSemantics(inst);
+      this->concretization.apply(*this, inst);
+      if (this->accessStream)
+        this->accessStream->record(*this, inst);
+      return ret;
+    }
+
+    triton::usize size = this->symbolic->getSizeOfPathConstraints();
+    triton::arch::exception_e ret = this->irBuilder->buildSemantics(inst);
+
+    this->concretization.apply(*this, inst);
+    if (this->accessStream)
+      this->accessStream->record(*this, inst);
+
+    if (ret != triton::arch::NO_FAULT)
+      this->merge = nullptr;
+    else if (this->merge)
+      this->continueMerge(inst);
+    else if (this->symbolic->getSizeOfPathConstraints() > size)
+      this->startMerge(inst);
+
+    return ret;
+  }
+
+
+  triton::arch::exception_e Context::processing(triton::arch::BasicBlock& block, triton::uint64 addr) {
+    TRITON_TRACE("processing", "Context::processing");
+
+    this->checkArchitecture();
+    this->arch.disassembly(block, addr);
+
+    /* Only the instructions processed one by one are merged */
+    this->merge = nullptr;
+    triton::arch::exception_e ret = this->irBuilder->buildSemantics(block);
+
+    for (auto& inst : block.getInstructions()) {
+      this->concretization.apply(*this, inst);
+      if (this->accessStream)
+        this->accessStream->record(*this, inst);
+    }
+
+    return ret;
+  }
+
+
+  void Context::setAccessStream(triton::callbacks::AccessStream* stream) {
+    this->accessStream = stream;
+  }
+
+
+  triton::callbacks::AccessStream* Context::getAccessStream(void) const {
+    return this->accessStream;
+  }
+
+
+  /* Records the parent registers and the memory cells written by an instruction */
+  static void recordWrites(std::set<triton::arch::register_e>& registers, std::set<triton::uint64>& memory, triton::arch::Instruction& inst) {
+    for (const auto& reg : inst.getWrittenRegisters())
+      registers.insert(reg.first.getParent());
+
+    for (const auto& store : inst.getStoreAccess()) {
+      for (triton::uint32 i = 0; i < store.first.getSize(); i++)
+        memory.insert(store.first.getAddress() + i);
+    }
+  }
+
+
+  std::vector<triton::uint64> Context::resolvePointer(const triton::ast::SharedAbstractNode& address, triton::usize limit) const {
+    triton::engines::solver::status_e status = triton::engines::solver::UNSAT;
+    triton::ast::SharedAbstractNode constraint = this->symbolic->getPathPredicate();
+    std::vector<triton::uint64> values;
+
+    /* Each query excludes the values already found */
+    while (values.size() <= limit) {
+      auto model = this->getModel(constraint, &status);
+      if (status != triton::engines::solver::SAT)
+        break;
+
+      triton::uint64 value = static_cast<triton::uint64>(this->evaluateAstViaModel(address, model));
+      values.push_back(value);
+      constraint = this->astCtxt->land(constraint, this->astCtxt->distinct(address, this->astCtxt->bv(value, address->getBitvectorSize())));
+    }
+
+    /* Too many values or an unknown one, the pointer is concretized */
+    if (values.size() > limit || status != triton::engines::solver::UNSAT)
+      values.clear();
+
+    return values;
+  }
+
+
+  triton::uint64 Context::getJoinPoint(triton::uint64 fall, triton::uint64 target) const {
+    triton::uint64 join = target;
+    triton::uint8 opcodes[16];
+
+    /* Decodes the straight-line code from `addr` to `end`, the last instruction being returned */
+    auto decode = [&](triton::uint64 addr, triton::uint64 end, triton::arch::Instruction& last) {
+      while (addr < end) {
+        if (!this->isConcreteMemoryValueDefined(addr))
+          return false;
+        this->readConcreteMemory(addr, opcodes, sizeof(opcodes), false);
+        last = triton::arch::Instruction(addr, opcodes, sizeof(opcodes));
+        this->disassembly(last);
+        addr += last.getSize();
+        if (last.isControlFlow() && addr != end)
+          return false;
+      }
+      return addr == end;
+    };
+
+    try {
+      triton::arch::Instruction last;
+      if (!decode(fall, target, last))
+        return 0;
+
+      /* The then side of a diamond jumps over the else side */
+      if (last.isControlFlow()) {
+        if (!this->isArchitectureValid() || (this->getArchitecture() != triton::arch::ARCH_X86 && this->getArchitecture() != triton::arch::ARCH_X86_64))
+          return 0;
+        if (last.getType() != triton::arch::x86::ID_INS_JMP || last.operands.size() != 1 || last.operands[0].getType() != triton::arch::OP_IMM)
+          return 0;
+
+        join = static_cast<triton::uint64>(last.operands[0].getImmediate().getValue());
+        if (join <= target || join - target > this->mergeDistance)
+          return 0;
+
+        triton::arch::Instruction other;
+        if (!decode(target, join, other) || other.isControlFlow())
+          return 0;
+      }
+    }
+    catch (const triton::exceptions::Exception&) {
+      return 0;
+    }
+
+    return join;
+  }
+
+
+  void Context::startMerge(const triton::arch::Instruction& inst) {
+    const auto& pco = this->symbolic->getPathConstraints().back();
+    const auto& branches = pco.getBranchConstraints();
+    triton::ast::SharedAbstractNode predicate = nullptr;
+    triton::uint64 taken = 0;
+    triton::uint64 other = 0;
+
+    if (branches.size() != 2)
+      return;
+
+    for (const auto& branch : branches) {
+      if (std::get<1>(branch) != inst.getAddress())
+        return;
+      if (std::get<0>(branch)) {
+        taken = std::get<2>(branch);
+        predicate = std::get<3>(branch);
+      }
+      else
+        other = std::get<2>(branch);
+    }
+
+    if (predicate == nullptr || !predicate->isSymbolized())
+      return;
+
+    /* A short forward branch, falling through or jumping over its then side */
+    triton::uint64 fall = inst.getNextAddress();
+    triton::uint64 target = (taken == fall) ? other : taken;
+    if ((taken != fall && other != fall) || target <= fall || target - fall > this->mergeDistance)
+      return;
+
+    triton::uint64 join = this->getJoinPoint(fall, target);
+    if (join == 0)
+      return;
+
+    auto merge = std::make_unique<Merge>();
+    merge->predicate = predicate;
+    merge->index     = this->symbolic->getSizeOfPathConstraints() - 1;
+    merge->join      = join;
+    merge->start     = taken;
+    merge->end       = (taken == fall) ? target : join;
+
+    /* The side not taken runs apart from the state of the branch */
+    merge->other = this->fork();
+    triton::Context& ctx = *merge->other;
+    const triton::arch::Register& pc = ctx.getCpuInstance()->getProgramCounter();
+    triton::uint64 start = other;
+    triton::uint64 end = (other == fall) ? target : join;
+    triton::uint8 opcodes[16];
+
+    ctx.setConcreteRegisterValue(pc, other);
+    for (triton::uint64 addr = other; addr != join;) {
+      if (addr < start || addr >= end || !ctx.isConcreteMemoryValueDefined(addr))
+        return;
+
+      ctx.readConcreteMemory(addr, opcodes, sizeof(opcodes), false);
+      triton::arch::Instruction side(addr, opcodes, sizeof(opcodes));
+      ctx.arch.disassembly(side);
+      if (ctx.irBuilder->buildSemantics(side) != triton::arch::NO_FAULT)
+        return;
+
+      recordWrites(merge->registers, merge->memory, side);
+      addr = static_cast<triton::uint64>(ctx.getConcreteRegisterValue(pc));
+    }
+
+    this->merge = std::move(merge);
+
+    /* The side taken is empty when the branch jumps to the join point */
+    if (taken == join)
+      this->mergeSides();
+  }
+
+
+  void Context::continueMerge(triton::arch::Instruction& inst) {
+    Merge& merge = *this->merge;
+
+    if (inst.getAddress() < merge.start || inst.getAddress() >= merge.end) {
+      this->merge = nullptr;
+      return;
+    }
+
+    recordWrites(merge.registers, merge.memory, inst);
+
+    triton::uint64 next = static_cast<triton::uint64>(this->getConcreteRegisterValue(this->arch.getProgramCounter()));
+    if (next == merge.join)
+      this->mergeSides();
+    else if (inst.isControlFlow() || next < merge.start || next >= merge.end)
+      this->merge = nullptr;
+  }
+
+
+  void Context::mergeSides(void) {
+    std::unique_ptr<Merge> merge = std::move(this->merge);
+    triton::Context& other = *merge->other;
+    const triton::arch::Register& pc = this->arch.getProgramCounter();
+
+    /* Only the unconditional jump of a diamond may follow the branch */
+    const auto& pcs = this->symbolic->getPathConstraints();
+    if (pcs.size() <= merge->index)
+      return;
+    for (triton::usize index = merge->index + 1; index < pcs.size(); index++) {
+      if (pcs[index].isMultipleBranches())
+        return;
+    }
+
+    while (this->symbolic->getSizeOfPathConstraints() > merge->index + 1)
+      this->symbolic->popPathConstraint();
+
+    for (triton::arch::register_e id : merge->registers) {
+      const triton::arch::Register& reg = this->getRegister(id);
+      if (reg.getId() == pc.getId())
+        continue;
+
+      auto taken = this->getRegisterAst(reg);
+      auto notTaken = other.getRegisterAst(reg);
+      if (!taken->equalTo(notTaken)) {
+        auto se = this->newSymbolicExpression(this->astCtxt->ite(merge->predicate, taken, notTaken), "State merging");
+        this->assignSymbolicExpressionToRegister(se, reg);
+      }
+
+      if (other.isRegisterTainted(reg))
+        this->taintRegister(reg);
+    }
+
+    for (triton::uint64 addr : merge->memory) {
+      triton::arch::MemoryAccess mem(addr, triton::size::byte);
+
+      auto taken = this->getMemoryAst(mem);
+      auto notTaken = other.getMemoryAst(mem);
+      if (!taken->equalTo(notTaken)) {
+        auto se = this->newSymbolicExpression(this->astCtxt->ite(merge->predicate, taken, notTaken), "State merging");
+        this->assignSymbolicExpressionToMemory(se, mem);
+      }
+
+      if (other.isMemoryTainted(addr))
+        this->taintMemory(addr);
+    }
+
+    /* One state continues, the branch is no longer in the path predicate */
+    this->symbolic->mergePathConstraint();
+  }
+
+
+  const std::vector<triton::engines::symbolic::PathConstraint>& Context::getMergedPathConstraints(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getMergedPathConstraints();
+  }
+
+
+  void Context::setMergeDistance(triton::usize distance) {
+    this->mergeDistance = distance;
+  }
+
+
+  triton::usize Context::getMergeDistance(void) const {
+    return this->mergeDistance;
+  }
+
+
+  triton::arch::exception_e Context::run(triton::uint64 addr, triton::usize maxInstructions, const std::unordered_set<triton::uint64>& stopAddresses, const std::unordered_map<triton::uint64, std::function<bool(triton::Context&, triton::uint64)>>& hooks, triton::usize* count) {
+    TRITON_TRACE("processing", "Context::run");
+
+    triton::arch::exception_e ret = triton::arch::NO_FAULT;
+    triton::usize executed = 0;
+    triton::uint8 opcodes[16];
+
+    this->checkArchitecture();
+    const triton::arch::Register& pc = this->arch.getProgramCounter();
+
+    while (maxInstructions == 0 || executed < maxInstructions) {
+      if (stopAddresses.find(addr) != stopAddresses.end())
+        break;
+
+      /* A hook may stop the loop or redirect it */
+      auto hook = hooks.find(addr);
+      if (hook != hooks.end()) {
+        this->setConcreteRegisterValue(pc, addr);
+        if (hook->second(*this, addr) == false)
+          break;
+        triton::uint64 next = static_cast<triton::uint64>(this->getConcreteRegisterValue(pc));
+        if (next != addr) {
+          addr = next;
+          continue;
+        }
+      }
+
+      if (!this->isConcreteMemoryValueDefined(addr))
+        break;
+
+      /* The longest instruction fits in 16 bytes, the undefined bytes read as zero */
+      this->readConcreteMemory(addr, opcodes, sizeof(opcodes));
+      triton::arch::Instruction inst(addr, opcodes, sizeof(opcodes));
+
+      ret = this->processing(inst);
+      if (ret != triton::arch::NO_FAULT)
+        break;
+
+      executed++;
+      addr = static_cast<triton::uint64>(this->getConcreteRegisterValue(pc));
+    }
+
+    if (count != nullptr)
+      *count = executed;
+
+    return ret;
+  }
+
+
+
+  /* IR builder Context ================================================================================= */
+
+  triton::arch::exception_e Context::buildSemantics(triton::arch::Instruction& inst) {
+    this->checkIrBuilder();
+    return this->irBuilder->buildSemantics(inst);
+  }
+
+
+  triton::arch::exception_e Context::buildSemantics(triton::arch::BasicBlock& block) {
+    this->checkIrBuilder();
+    return this->irBuilder->buildSemantics(block);
+  }
+
+
+  triton::ast::SharedAstContext Context::getAstContext(void) {
+    return this->astCtxt;
+  }
+
+
+  std::pmr::memory_resource* Context::getMemoryResource(void) const {
+    return this->resource;
+  }
+
+
+  void Context::enableSemanticsCache(bool flag) {
+    this->checkIrBuilder();
+    this->irBuilder->enableSemanticsCache(flag);
+  }
+
+
+  bool Context::isSemanticsCacheEnabled(void) const {
+    this->checkIrBuilder();
+    return this->irBuilder->isSemanticsCacheEnabled();
+  }
+
+
+  triton::usize Context::getSemanticsCacheSize(void) const {
+    this->checkIrBuilder();
+    return this->irBuilder->getSemanticsCacheSize();
+  }
+
+
+  void Context::clearSemanticsCache(void) {
+    this->checkIrBuilder();
+    this->irBuilder->clearSemanticsCache();
+  }
+
+
+  void Context::enableConcreteMemo(bool flag, triton::usize capacity) {
+    this->checkIrBuilder();
+    this->irBuilder->enableConcreteMemo(flag, capacity);
+  }
+
+
+  bool Context::isConcreteMemoEnabled(void) const {
+    this->checkIrBuilder();
+    return this->irBuilder->isConcreteMemoEnabled();
+  }
+
+
+  triton::arch::ConcreteMemoStats Context::getConcreteMemoStats(void) const {
+    this->checkIrBuilder();
+    return this->irBuilder->getConcreteMemoStats();
+  }
+
+
+  void Context::clearConcreteMemo(void) {
+    this->checkIrBuilder();
+    this->irBuilder->clearConcreteMemo();
+  }
+
+
+  void Context::enableProfiling(bool flag) {
+    this->checkIrBuilder();
+    this->irBuilder->enableProfiling(flag);
+  }
+
+
+  bool Context::isProfilingEnabled(void) const {
+    this->checkIrBuilder();
+    return this->irBuilder->isProfilingEnabled();
+  }
+
+
+  const std::map<triton::uint32, triton::arch::InstructionProfile>& Context::getProfile(void) const {
+    this->checkIrBuilder();
+    return this->irBuilder->getProfile();
+  }
+
+
+  void Context::clearProfile(void) {
+    this->checkIrBuilder();
+    this->irBuilder->clearProfile();
+  }
+
+
+  void Context::enableHeatMap(bool flag, triton::uint32 period) {
+    this->checkIrBuilder();
+    this->irBuilder->enableHeatMap(flag, period);
+  }
+
+
+  bool Context::isHeatMapEnabled(void) const {
+    this->checkIrBuilder();
+    return this->irBuilder->isHeatMapEnabled();
+  }
+
+
+  std::vector<std::pair<triton::uint64, triton::arch::HotSpot>> Context::getHotSpots(bool blocks, triton::usize count) const {
+    this->checkIrBuilder();
+    return this->irBuilder->getHotSpots(blocks, count);
+  }
+
+
+  void Context::exportHeatMap(const std::string& path, bool flameGraph) const {
+    this->checkIrBuilder();
+    this->irBuilder->exportHeatMap(path, flameGraph);
+  }
+
+
+  void Context::clearHeatMap(void) {
+    this->checkIrBuilder();
+    this->irBuilder->clearHeatMap();
+  }
+
+
+  void Context::setFunctionSummary(triton::uint64 addr, const std::string& name, bool msAbi) {
+    this->checkIrBuilder();
+    this->irBuilder->getSummaries().setFunctionSummary(addr, name, msAbi);
+  }
+
+
+  triton::usize Context::setFunctionSummaries(triton::uint64 base, const std::map<std::string, triton::uint64>& symbols, bool msAbi) {
+    this->checkIrBuilder();
+    return this->irBuilder->getSummaries().setFunctionSummaries(base, symbols, msAbi);
+  }
+
+
+  void Context::removeFunctionSummary(triton::uint64 addr) {
+    this->checkIrBuilder();
+    this->irBuilder->getSummaries().removeFunctionSummary(addr);
+  }
+
+
+  std::map<triton::uint64, std::string> Context::getFunctionSummaries(void) const {
+    this->checkIrBuilder();
+    return this->irBuilder->getSummaries().getFunctionSummaries();
+  }
+
+
+  void Context::enableSyscallEmulation(bool flag) {
+    this->checkIrBuilder();
+    this->irBuilder->getSyscalls().enable(flag);
+  }
+
+
+  bool Context::isSyscallEmulationEnabled(void) const {
+    this->checkIrBuilder();
+    return this->irBuilder->getSyscalls().isEnabled();
+  }
+
+
+  void Context::addVirtualFile(const std::string& path, const std::vector<triton::uint8>& data, bool symbolic) {
+    this->checkIrBuilder();
+    this->irBuilder->getSyscalls().addFile(path, data, symbolic);
+  }
+
+
+  const std::vector<triton::uint8>& Context::getVirtualFile(const std::string& path) const {
+    this->checkIrBuilder();
+    return this->irBuilder->getSyscalls().getFile(path);
+  }
+
+
+  void Context::setSyscallHandler(triton::uint64 number, const std::function<triton::uint64(triton::Context&, triton::uint64)>& handler) {
+    this->checkIrBuilder();
+    this->irBuilder->getSyscalls().setHandler(number, [this, handler](triton::uint64 n) { return handler(*this, n); });
+  }
+
+
+  void Context::removeSyscallHandler(triton::uint64 number) {
+    this->checkIrBuilder();
+    this->irBuilder->getSyscalls().removeHandler(number);
+  }
+
+
+  void Context::setProgramBreak(triton::uint64 addr) {
+    this->checkIrBuilder();
+    this->irBuilder->getSyscalls().setProgramBreak(addr);
+  }
+
+
+  bool Context::hasProgramExited(void) const {
+    this->checkIrBuilder();
+    return this->irBuilder->getSyscalls().hasExited();
+  }
+
+
+  triton::uint64 Context::getProgramExitStatus(void) const {
+    this->checkIrBuilder();
+    return this->irBuilder->getSyscalls().getExitStatus();
+  }
+
+
+
+  /* AST representation Context ========================================================================= */
+
+  triton::ast::representations::mode_e Context::getAstRepresentationMode(void) const {
+    return this->astCtxt->getRepresentationMode();
+  }
+
+
+  void Context::setAstRepresentationMode(triton::ast::representations::mode_e mode) {
+    this->astCtxt->setRepresentationMode(mode);
+  }
+
+
+
+  /* Callbacks Context ================================================================================= */
+
+  template TRITON_EXPORT void Context::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::MemoryAccess&)> cb);
+  template TRITON_EXPORT void Context::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<std::vector<triton::uint8>(triton::Context&, triton::uint64 addr)> cb);
+  template TRITON_EXPORT void Context::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::Register&)> cb);
+  template TRITON_EXPORT void Context::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb);
+  template TRITON_EXPORT void Context::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::Register&, const triton::uint512& value)> cb);
+  template TRITON_EXPORT void Context::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<triton::ast::SharedAbstractNode(triton::Context&, const triton::ast::SharedAbstractNode&)> cb);
+
+  template TRITON_EXPORT void Context::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::MemoryAccess&)> cb);
+  template TRITON_EXPORT void Context::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<std::vector<triton::uint8>(triton::Context&, triton::uint64 addr)> cb);
+  template TRITON_EXPORT void Context::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::Register&)> cb);
+  template TRITON_EXPORT void Context::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb);
+  template TRITON_EXPORT void Context::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::Register&, const triton::uint512& value)> cb);
+  template TRITON_EXPORT void Context::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<triton::ast::SharedAbstractNode(triton::Context&, const triton::ast::SharedAbstractNode&)> cb);
+
+
+  void Context::clearCallbacks(void) {
+    this->callbacks.clearCallbacks();
+  }
+
+
+  triton::ast::SharedAbstractNode Context::processCallbacks(triton::callbacks::callback_e kind, triton::ast::SharedAbstractNode node) {
+    if (this->callbacks.isDefined()) {
+      return this->callbacks.processCallbacks(kind, node);
+    }
+    return node;
+  }
+
+
+  void Context::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::MemoryAccess& mem) {
+    if (this->callbacks.isDefined()) {
+      this->callbacks.processCallbacks(kind, mem);
+    }
+  }
+
+
+  void Context::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) {
+    if (this->callbacks.isDefined()) {
+      this->callbacks.processCallbacks(kind, reg);
+    }
+  }
+
+
+
+  /* Modes Context======================================================================================= */
+
+  void Context::setMode(triton::modes::mode_e mode, bool flag) {
+    this->modes->setMode(mode, flag);
+  }
+
+
+  bool Context::isModeEnabled(triton::modes::mode_e mode) const {
+    return this->modes->isModeEnabled(mode);
+  }
+
+
+  void Context::clearModes(void) {
+    this->modes->clearModes();
+  }
+
+
+
+  /* Symbolic engine Context ============================================================================ */
+
+  triton::engines::symbolic::SymbolicEngine* Context::getSymbolicEngine(void) {
+    this->checkSymbolic();
+    return this->symbolic;
+  }
+
+
+  triton::engines::symbolic::SharedSymbolicVariable Context::symbolizeExpression(triton::usize exprId, triton::uint32 symVarSize, const std::string& symVarAlias) {
+    this->checkSymbolic();
+    return this->symbolic->symbolizeExpression(exprId, symVarSize, symVarAlias);
+  }
+
+
+  triton::engines::symbolic::SharedSymbolicVariable Context::symbolizeMemory(const triton::arch::MemoryAccess& mem, const std::string& symVarAlias) {
+    this->checkSymbolic();
+    return this->symbolic->symbolizeMemory(mem, symVarAlias);
+  }
+
+
+  void Context::symbolizeMemory(triton::uint64 addr, triton::usize size) {
+    this->checkSymbolic();
+    this->symbolic->symbolizeMemory(addr, size);
+  }
+
+
+  std::vector<triton::engines::symbolic::SharedSymbolicVariable> Context::symbolizeBuffer(triton::uint64 addr, triton::usize size, const std::string& symVarAlias) {
+    this->checkSymbolic();
+    return this->symbolic->symbolizeBuffer(addr, size, symVarAlias);
+  }
+
+
+  triton::engines::symbolic::SharedSymbolicVariable Context::symbolizeRegister(const triton::arch::Register& reg, const std::string& symVarAlias) {
+    this->checkSymbolic();
+    return this->symbolic->symbolizeRegister(reg, symVarAlias);
+  }
+
+
+  triton::ast::SharedAbstractNode Context::getOperandAst(const triton::arch::OperandWrapper& op) {
+    this->checkSymbolic();
+    return this->symbolic->getOperandAst(op);
+  }
+
+
+  triton::ast::SharedAbstractNode Context::getOperandAst(triton::arch::Instruction& inst, const triton::arch::OperandWrapper& op) {
+    this->checkSymbolic();
+    return this->symbolic->getOperandAst(inst, op);
+  }
+
+
+  triton::ast::SharedAbstractNode Context::getImmediateAst(const triton::arch::Immediate& imm) {
+    this->checkSymbolic();
+    return this->symbolic->getImmediateAst(imm);
+  }
+
+
+  triton::ast::SharedAbstractNode Context::getImmediateAst(triton::arch::Instruction& inst, const triton::arch::Immediate& imm) {
+    this->checkSymbolic();
+    return this->symbolic->getImmediateAst(inst, imm);
+  }
+
+
+  triton::ast::SharedAbstractNode Context::getMemoryAst(const triton::arch::MemoryAccess& mem) {
+    this->checkSymbolic();
+    return this->symbolic->getMemoryAst(mem);
+  }
+
+
+  triton::ast::SharedAbstractNode Context::getMemoryAst(triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem) {
+    this->checkSymbolic();
+    return this->symbolic->getMemoryAst(inst, mem);
+  }
+
+
+  triton::ast::SharedAbstractNode Context::getRegisterAst(const triton::arch::Register& reg) {
+    this->checkSymbolic();
+    return this->symbolic->getRegisterAst(reg);
+  }
+
+
+  triton::ast::SharedAbstractNode Context::getRegisterAst(triton::arch::Instruction& inst, const triton::arch::Register& reg) {
+    this->checkSymbolic();
+    return this->symbolic->getRegisterAst(inst, reg);
+  }
+
+
+  triton::engines::symbolic::SharedSymbolicExpression Context::newSymbolicExpression(const triton::ast::SharedAbstractNode& node, const std::string& comment) {
+    this->checkSymbolic();
+    return this->symbolic->newSymbolicExpression(node, triton::engines::symbolic::VOLATILE_EXPRESSION, comment);
+  }
+
+
+  triton::engines::symbolic::SharedSymbolicVariable Context::newSymbolicVariable(triton::uint32 varSize, const std::string& alias) {
+    this->checkSymbolic();
+    return this->symbolic->newSymbolicVariable(triton::engines::symbolic::UNDEFINED_VARIABLE, 0, varSize, alias);
+  }
+
+
+  void Context::removeSymbolicExpression(const triton::engines::symbolic::SharedSymbolicExpression& expr) {
+    this->checkSymbolic();
+    return this->symbolic->removeSymbolicExpression(expr);
+  }
+
+
+  const triton::engines::symbolic::SharedSymbolicExpression& Context::createSymbolicExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::OperandWrapper& dst, const std::string& comment) {
+    this->checkSymbolic();
+    return this->symbolic->createSymbolicExpression(inst, node, dst, comment);
+  }
+
+
+  const triton::engines::symbolic::SharedSymbolicExpression& Context::createSymbolicMemoryExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::MemoryAccess& mem, const std::string& comment) {
+    this->checkSymbolic();
+    return this->symbolic->createSymbolicMemoryExpression(inst, node, mem, comment);
+  }
+
+
+  const triton::engines::symbolic::SharedSymbolicExpression& Context::createSymbolicRegisterExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::Register& reg, const std::string& comment) {
+    this->checkSymbolic();
+    return this->symbolic->createSymbolicRegisterExpression(inst, node, reg, comment);
+  }
+
+
+  const triton::engines::symbolic::SharedSymbolicExpression& Context::createSymbolicVolatileExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const std::string& comment) {
+    this->checkSymbolic();
+    return this->symbolic->createSymbolicVolatileExpression(inst, node, comment);
+  }
+
+
+  void Context::assignSymbolicExpressionToMemory(const triton::engines::symbolic::SharedSymbolicExpression& se, const triton::arch::MemoryAccess& mem) {
+    this->checkSymbolic();
+    this->symbolic->assignSymbolicExpressionToMemory(se, mem);
+  }
+
+
+  void Context::assignSymbolicExpressionToRegister(const triton::engines::symbolic::SharedSymbolicExpression& se, const triton::arch::Register& reg) {
+    this->checkSymbolic();
+    this->symbolic->assignSymbolicExpressionToRegister(se, reg);
+  }
+
+
+  triton::engines::symbolic::SharedSymbolicExpression Context::getSymbolicMemory(triton::uint64 addr) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicMemory(addr);
+  }
+
+
+  std::unordered_map<triton::arch::register_e, triton::engines::symbolic::SharedSymbolicExpression> Context::getSymbolicRegisters(void) const {
+    this->checkSymbolic();
+    this->symbolic->materializeLazyRegisters();
+    return this->symbolic->getSymbolicRegisters();
+  }
+
+
+  const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& Context::getSymbolicRegisterArray(void) const {
+    this->checkSymbolic();
+    this->symbolic->materializeLazyRegisters();
+    return this->symbolic->getSymbolicRegisterArray();
+  }
+
+
+  std::unordered_map<triton::uint64, triton::engines::symbolic::SharedSymbolicExpression> Context::getSymbolicMemory(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicMemory();
+  }
+
+
+  bool Context::forEachSymbolicRegister(const std::function<bool(triton::arch::register_e, const triton::engines::symbolic::SharedSymbolicExpression&)>& fn) const {
+    this->checkSymbolic();
+    this->symbolic->materializeLazyRegisters();
+    return this->symbolic->forEachSymbolicRegister(fn);
+  }
+
+
+  bool Context::forEachSymbolicMemory(const std::function<bool(triton::uint64, const triton::engines::symbolic::SharedSymbolicExpression&)>& fn) const {
+    this->checkSymbolic();
+    return this->symbolic->forEachSymbolicMemory(fn);
+  }
+
+
+  const triton::engines::symbolic::SharedSymbolicExpression& Context::getSymbolicRegister(const triton::arch::Register& reg) const {
+    this->checkSymbolic();
+    this->symbolic->materializeLazyRegister(reg);
+    return this->symbolic->getSymbolicRegister(reg);
+  }
+
+
+  triton::uint8 Context::getSymbolicMemoryValue(triton::uint64 address) {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicMemoryValue(address);
+  }
+
+
+  triton::uint512 Context::getSymbolicMemoryValue(const triton::arch::MemoryAccess& mem) {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicMemoryValue(mem);
+  }
+
+
+  std::vector<triton::uint8> Context::getSymbolicMemoryAreaValue(triton::uint64 baseAddr, triton::usize size) {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicMemoryAreaValue(baseAddr, size);
+  }
+
+
+  triton::uint512 Context::getSymbolicRegisterValue(const triton::arch::Register& reg) {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicRegisterValue(reg);
+  }
+
+
+  void Context::addRewriteRule(const std::string& pattern, const std::string& replacement) {
+    this->checkSymbolic();
+    this->symbolic->getAstRewriter().addRule(pattern, replacement);
+  }
+
+
+  void Context::addBuiltinRewriteRules(void) {
+    this->checkSymbolic();
+    this->symbolic->getAstRewriter().addBuiltinRules();
+  }
+
+
+  void Context::clearRewriteRules(void) {
+    this->checkSymbolic();
+    this->symbolic->getAstRewriter().clearRules();
+  }
+
+
+  triton::ast::AstRewriter& Context::getAstRewriter(void) {
+    this->checkSymbolic();
+    return this->symbolic->getAstRewriter();
+  }
+
+
+  triton::ast::SharedAbstractNode Context::simplify(const triton::ast::SharedAbstractNode& node, bool usingSolver, bool usingLLVM) const {
+    if (usingSolver || usingLLVM) {
+      auto& memo = usingSolver ? this->solverSimplifications : this->llvmSimplifications;
+
+      if (node == nullptr)
+        throw triton::exceptions::Context("Context::simplify(): node cannot be null.");
+
+      memo.validate(this->modes->getVersion());
+      if (auto result = memo.find(node))
+        return result;
+
+      auto snode = usingSolver ? this->simplifyAstViaSolver(node) : this->simplifyAstViaLLVM(node);
+      memo.insert(node, snode);
+      return snode;
+    }
+    else {
+      this->checkSymbolic();
+      return this->symbolic->simplify(node);
+    }
+  }
+
+
+  std::vector<triton::ast::SharedAbstractNode> Context::simplify(const std::vector<triton::ast::SharedAbstractNode>& nodes, bool usingSolver, bool usingLLVM) const {
+    std::vector<triton::ast::SharedAbstractNode> simplified;
+
+    if (usingSolver == false && usingLLVM == true) {
+      std::vector<triton::ast::SharedAbstractNode> misses;
+
+      /* Only the nodes not memoized yet are lifted */
+      this->llvmSimplifications.validate(this->modes->getVersion());
+      for (const auto& node : nodes) {
+        if (node == nullptr)
+          throw triton::exceptions::Context("Context::simplify(): node cannot be null.");
+        auto result = this->llvmSimplifications.find(node);
+        simplified.push_back(result);
+        if (result == nullptr)
+          misses.push_back(node);
+      }
+
+      if (misses.size()) {
+        auto results = this->simplifyAstViaLLVM(misses);
+        for (triton::usize i = 0, j = 0; i < simplified.size(); i++) {
+          if (simplified[i] == nullptr) {
+            simplified[i] = results[j++];
+            this->llvmSimplifications.insert(nodes[i], simplified[i]);
+          }
+        }
+      }
+
+      return simplified;
+    }
+
+    for (const auto& node : nodes) {
+      simplified.push_back(this->simplify(node, usingSolver, usingLLVM));
+    }
+
+    return simplified;
+  }
+
+
+  triton::usize Context::getSimplificationMemoSize(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getSimplificationMemo().size() + this->solverSimplifications.size() + this->llvmSimplifications.size();
+  }
+
+
+  triton::usize Context::getSimplificationMemoHits(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getSimplificationMemo().getHits() + this->solverSimplifications.getHits() + this->llvmSimplifications.getHits();
+  }
+
+
+  void Context::clearSimplificationMemo(void) {
+    this->checkSymbolic();
+    this->symbolic->getSimplificationMemo().clear();
+    this->solverSimplifications.clear();
+    this->llvmSimplifications.clear();
+  }
+
+
+  triton::arch::BasicBlock Context::simplify(const triton::arch::BasicBlock& block, bool padding) const {
+    this->checkSymbolic();
+    return this->symbolic->simplify(block, padding);
+  }
+
+
+  std::vector<triton::arch::BasicBlock> Context::simplify(const std::vector<triton::arch::BasicBlock>& region, bool padding) const {
+    this->checkSymbolic();
+    return this->symbolic->simplify(region, padding);
+  }
+
+
+  triton::engines::symbolic::SharedSymbolicExpression Context::getSymbolicExpression(triton::usize symExprId) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicExpression(symExprId);
+  }
+
+
+  triton::uint512 Context::getConcreteVariableValue(const triton::engines::symbolic::SharedSymbolicVariable& symVar) const {
+    this->checkSymbolic();
+    return this->symbolic->getConcreteVariableValue(symVar);
+  }
+
+
+  void Context::setConcreteVariableValue(const triton::engines::symbolic::SharedSymbolicVariable& symVar, const triton::uint512& value) {
+    this->checkSymbolic();
+    this->symbolic->setConcreteVariableValue(symVar, value);
+  }
+
+
+  triton::uint512 Context::evaluateAstViaModel(const triton::ast::SharedAbstractNode& node, const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model) const {
+    std::unordered_map<triton::usize, triton::uint512> values;
+
+    for (const auto& item : model)
+      values[item.first] = item.second.getValue();
+
+    return this->evaluateAstViaModel(node, values);
+  }
+
+
+  triton::uint512 Context::evaluateAstViaModel(const triton::ast::SharedAbstractNode& node, const std::unordered_map<triton::usize, triton::uint512>& values) const {
+    return this->astCtxt->evaluate(node, values);
+  }
+
+
+  triton::engines::symbolic::SharedSymbolicVariable Context::getSymbolicVariable(triton::usize symVarId) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicVariable(symVarId);
+  }
+
+
+  triton::engines::symbolic::SharedSymbolicVariable Context::getSymbolicVariable(const std::string& symVarName) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicVariable(symVarName);
+  }
+
+
+  const std::vector<triton::engines::symbolic::PathConstraint>& Context::getPathConstraints(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getPathConstraints();
+  }
+
+
+  std::vector<triton::engines::symbolic::PathConstraint> Context::getPathConstraints(triton::usize start, triton::usize end) const {
+    this->checkSymbolic();
+    return this->symbolic->getPathConstraints(start, end);
+  }
+
+
+  std::vector<triton::engines::symbolic::PathConstraint> Context::getPathConstraintsOfThread(triton::uint32 threadId) const {
+    this->checkSymbolic();
+    return this->symbolic->getPathConstraintsOfThread(threadId);
+  }
+
+
+  std::vector<triton::usize> Context::getPathConstraintIndexesOfThread(triton::uint32 threadId) const {
+    this->checkSymbolic();
+    return this->symbolic->getPathConstraintIndexesOfThread(threadId);
+  }
+
+
+  std::vector<triton::uint32> Context::getPathConstraintThreads(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getPathConstraintThreads();
+  }
+
+
+  triton::ast::SharedAbstractNode Context::getPathPredicateOfThread(triton::uint32 threadId) const {
+    this->checkSymbolic();
+    return this->symbolic->getPathPredicateOfThread(threadId);
+  }
+
+
+  std::vector<std::vector<triton::ast::SharedAbstractNode>> Context::getPredicatesToReachAddresses(const std::vector<triton::uint64>& addrs) {
+    this->checkSymbolic();
+    return this->symbolic->getPredicatesToReachAddresses(addrs);
+  }
+
+
+  triton::usize Context::getSizeOfPathConstraints(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getSizeOfPathConstraints();
+  }
+
+
+  triton::ast::SharedAbstractNode Context::getPathPredicate(void) {
+    this->checkSymbolic();
+    return this->symbolic->getPathPredicate();
+  }
+
+
+  std::vector<triton::ast::SharedAbstractNode> Context::getPredicatesToReachAddress(triton::uint64 addr) {
+    this->checkSymbolic();
+    return this->symbolic->getPredicatesToReachAddress(addr);
+  }
+
+
+  void Context::pushPathConstraint(const triton::ast::SharedAbstractNode& node, const std::string& comment) {
+    this->checkSymbolic();
+    this->symbolic->pushPathConstraint(node, comment);
+  }
+
+
+  void Context::pushPathConstraint(const triton::engines::symbolic::PathConstraint& pco) {
+    this->checkSymbolic();
+    this->symbolic->pushPathConstraint(pco);
+  }
+
+
+  void Context::popPathConstraint(void) {
+    this->checkSymbolic();
+    this->symbolic->popPathConstraint();
+  }
+
+
+  void Context::clearPathConstraints(void) {
+    this->checkSymbolic();
+    this->symbolic->clearPathConstraints();
+  }
+
+
+  void Context::summarizePathConstraints(triton::usize count) {
+    this->checkSymbolic();
+    this->symbolic->summarizePathConstraints(count);
+  }
+
+
+  void Context::setPathConstraintsWindow(triton::usize size) {
+    this->checkSymbolic();
+    this->symbolic->setPathConstraintsWindow(size);
+  }
+
+
+  triton::usize Context::getPathConstraintsWindow(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getPathConstraintsWindow();
+  }
+
+
+  bool Context::isSymbolicExpressionExists(triton::usize symExprId) const {
+    this->checkSymbolic();
+    return this->symbolic->isSymbolicExpressionExists(symExprId);
+  }
+
+
+  bool Context::isMemorySymbolized(const triton::arch::MemoryAccess& mem) const {
+    this->checkSymbolic();
+    return this->symbolic->isMemorySymbolized(mem);
+  }
+
+
+  bool Context::isMemorySymbolized(triton::uint64 addr, triton::uint32 size) const {
+    this->checkSymbolic();
+    return this->symbolic->isMemorySymbolized(addr, size);
+  }
+
+
+  bool Context::isRegisterSymbolized(const triton::arch::Register& reg) const {
+    this->checkSymbolic();
+    this->symbolic->materializeLazyRegister(reg);
+    return this->symbolic->isRegisterSymbolized(reg);
+  }
+
+
+  void Context::concretizeAllMemory(void) {
+    this->checkSymbolic();
+    this->symbolic->concretizeAllMemory();
+  }
+
+
+  void Context::concretizeAllRegister(void) {
+    this->checkSymbolic();
+    this->symbolic->concretizeAllRegister();
+  }
+
+
+  void Context::concretizeMemory(const triton::arch::MemoryAccess& mem) {
+    this->checkSymbolic();
+    this->symbolic->concretizeMemory(mem);
+  }
+
+
+  void Context::concretizeMemory(triton::uint64 addr) {
+    this->checkSymbolic();
+    this->symbolic->concretizeMemory(addr);
+  }
+
+
+  void Context::concretizeRegister(const triton::arch::Register& reg) {
+    this->checkSymbolic();
+    this->symbolic->concretizeRegister(reg);
+  }
+
+
+  void Context::setAstBudget(triton::usize maxNodes, triton::uint32 maxLevel) {
+    this->checkSymbolic();
+    this->symbolic->setAstBudget(maxNodes, maxLevel);
+  }
+
+
+  void Context::setAstBudgetPolicy(triton::engines::symbolic::budget_e policy) {
+    this->checkSymbolic();
+    this->symbolic->setAstBudgetPolicy(policy);
+  }
+
+
+  const std::vector<triton::engines::symbolic::BudgetEvent>& Context::getAstBudgetEvents(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getAstBudgetEvents();
+  }
+
+
+  void Context::clearAstBudgetEvents(void) {
+    this->checkSymbolic();
+    this->symbolic->clearAstBudgetEvents();
+  }
+
+
+  void Context::setLoopUnrollBound(triton::usize bound) {
+    this->checkSymbolic();
+    this->symbolic->setLoopUnrollBound(bound);
+  }
+
+
+  triton::usize Context::getLoopUnrollBound(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getLoopUnrollBound();
+  }
+
+
+  const std::vector<triton::engines::symbolic::LoopSummary>& Context::getLoopSummaries(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getLoopSummaries();
+  }
+
+
+  void Context::clearLoopSummaries(void) {
+    this->checkSymbolic();
+    this->symbolic->clearLoopSummaries();
+  }
+
+
+  void Context::setPointerResolutionBound(triton::usize bound) {
+    this->checkSymbolic();
+    this->symbolic->setPointerResolutionBound(bound);
+  }
+
+
+  triton::usize Context::getPointerResolutionBound(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getPointerResolutionBound();
+  }
+
+
+  void Context::addConcretizationRule(triton::engines::symbolic::concretization_e rule, triton::usize threshold) {
+    this->concretization.addRule(rule, threshold);
+  }
+
+
+  void Context::removeConcretizationRule(triton::engines::symbolic::concretization_e rule) {
+    this->concretization.removeRule(rule);
+  }
+
+
+  void Context::addSymbolicRegion(triton::uint64 baseAddr, triton::usize size) {
+    this->concretization.addSymbolicRegion(baseAddr, size);
+  }
+
+
+  void Context::setConcretizationHook(const triton::engines::symbolic::ConcretizationHook& hook) {
+    this->concretization.setHook(hook);
+  }
+
+
+  const std::vector<triton::engines::symbolic::ConcretizationEvent>& Context::getConcretizationEvents(void) const {
+    return this->concretization.getEvents();
+  }
+
+
+  void Context::clearConcretizationEvents(void) {
+    this->concretization.clearEvents();
+  }
+
+
+  void Context::clearConcretizationPolicy(void) {
+    this->concretization.clear();
+  }
+
+
+  std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> Context::sliceExpressions(const triton::engines::symbolic::SharedSymbolicExpression& expr) {
+    this->checkSymbolic();
+    return this->symbolic->sliceExpressions(expr);
+  }
+
+
+  std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> Context::sliceExpressions(const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs) {
+    this->checkSymbolic();
+    return this->symbolic->sliceExpressions(exprs);
+  }
+
+
+  std::vector<triton::engines::symbolic::SharedSymbolicExpression> Context::getTaintedSymbolicExpressions(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getTaintedSymbolicExpressions();
+  }
+
+
+  std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> Context::getSymbolicExpressions(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicExpressions();
+  }
+
+
+  std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> Context::getSymbolicExpressions(triton::engines::symbolic::expression_e type) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicExpressions(type);
+  }
+
+
+  std::vector<triton::engines::symbolic::SharedSymbolicExpression> Context::getSymbolicExpressionsAt(triton::uint64 address) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicExpressionsAt(address);
+  }
+
+
+  triton::ast::SsaTrace Context::getSsaTrace(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getSsaTrace();
+  }
+
+
+  std::map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> Context::getSymbolicVariables(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicVariables();
+  }
+
+
+  std::map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> Context::getSymbolicVariables(triton::engines::symbolic::variable_e type) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicVariables(type);
+  }
+
+
+  std::map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> Context::getSymbolicVariables(triton::engines::symbolic::variable_e type, triton::uint64 origin) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicVariables(type, origin);
+  }
+
+
+  bool Context::forEachSymbolicExpression(const std::function<bool(const triton::engines::symbolic::SharedSymbolicExpression&)>& fn) const {
+    this->checkSymbolic();
+    return this->symbolic->forEachSymbolicExpression(fn);
+  }
+
+
+  bool Context::forEachSymbolicVariable(const std::function<bool(const triton::engines::symbolic::SharedSymbolicVariable&)>& fn) const {
+    this->checkSymbolic();
+    return this->symbolic->forEachSymbolicVariable(fn);
+  }
+
+
+
+  /* Solver engine Context ============================================================================= */
+
+  void Context::enableQueryCache(bool flag, triton::usize capacity) {
+    this->checkSolver();
+    this->solver->enableQueryCache(flag, capacity);
+  }
+
+
+  bool Context::isQueryCacheEnabled(void) const {
+    this->checkSolver();
+    return this->solver->isQueryCacheEnabled();
+  }
+
+
+  triton::usize Context::getQueryCacheSize(void) const {
+    this->checkSolver();
+    return this->solver->getQueryCacheSize();
+  }
+
+
+  triton::usize Context::getQueryCacheHits(void) const {
+    this->checkSolver();
+    return this->solver->getQueryCacheHits();
+  }
+
+
+  triton::usize Context::getQueryCacheMisses(void) const {
+    this->checkSolver();
+    return this->solver->getQueryCacheMisses();
+  }
+
+
+  void Context::clearQueryCache(void) {
+    this->checkSolver();
+    this->solver->clearQueryCache();
+  }
+
+
+  void Context::openSharedQueryCache(const std::string& path, triton::usize slots) {
+    this->checkSolver();
+    this->solver->openSharedQueryCache(path, slots);
+  }
+
+
+  void Context::closeSharedQueryCache(void) {
+    this->checkSolver();
+    this->solver->closeSharedQueryCache();
+  }
+
+
+  bool Context::isSharedQueryCacheOpen(void) const {
+    this->checkSolver();
+    return this->solver->isSharedQueryCacheOpen();
+  }
+
+
+  void Context::enableBitBlasting(bool flag, triton::usize maxNodes) {
+    this->checkSolver();
+    this->solver->enableBitBlasting(flag, maxNodes);
+  }
+
+
+  bool Context::isBitBlastingEnabled(void) const {
+    this->checkSolver();
+    return this->solver->isBitBlastingEnabled();
+  }
+
+
+  void Context::enableAdaptiveTimeout(bool flag) {
+    this->checkSolver();
+    this->solver->enableAdaptiveTimeout(flag);
+  }
 
-  /* Symbolic engine Context ============================================================================ */
 
-  triton::engines::symbolic::SymbolicEngine* Context::getSymbolicEngine(void) {
-    this->checkSymbolic();
-    return this->symbolic;
+  bool Context::isAdaptiveTimeoutEnabled(void) const {
+    this->checkSolver();
+    return this->solver->isAdaptiveTimeoutEnabled();
   }
 
 
-  triton::engines::symbolic::SharedSymbolicVariable Context::symbolizeExpression(triton::usize exprId, triton::uint32 symVarSize, const std::string& symVarAlias) {
-    this->checkSymbolic();
-    return this->symbolic->symbolizeExpression(exprId, symVarSize, symVarAlias);
+  void Context::setAdaptiveTimeoutBounds(triton::uint32 minTimeout, triton::uint32 maxTimeout) {
+    this->checkSolver();
+    this->solver->setAdaptiveTimeoutBounds(minTimeout, maxTimeout);
   }
 
 
-  triton::engines::symbolic::SharedSymbolicVariable Context::symbolizeMemory(const triton::arch::MemoryAccess& mem, const std::string& symVarAlias) {
-    this->checkSymbolic();
-    return this->symbolic->symbolizeMemory(mem, symVarAlias);
+  void Context::startTimeoutRound(triton::uint64 budget) {
+    this->checkSolver();
+    this->solver->startTimeoutRound(budget);
   }
 
 
-  void Context::symbolizeMemory(triton::uint64 addr, triton::usize size) {
-    this->checkSymbolic();
-    this->symbolic->symbolizeMemory(addr, size);
+  triton::uint64 Context::getTimeoutRoundRemaining(void) const {
+    this->checkSolver();
+    return this->solver->getTimeoutRoundRemaining();
   }
 
 
-  triton::engines::symbolic::SharedSymbolicVariable Context::symbolizeRegister(const triton::arch::Register& reg, const std::string& symVarAlias) {
-    this->checkSymbolic();
-    return this->symbolic->symbolizeRegister(reg, symVarAlias);
+  void Context::setTimeoutRetryCallback(const triton::engines::solver::TimeoutBudget::RetryCallback& callback, triton::uint32 retries) {
+    this->checkSolver();
+    this->solver->setTimeoutRetryCallback(callback, retries);
   }
 
 
-  triton::ast::SharedAbstractNode Context::getOperandAst(const triton::arch::OperandWrapper& op) {
-    this->checkSymbolic();
-    return this->symbolic->getOperandAst(op);
+  triton::uint32 Context::predictSolvingTime(const triton::ast::SharedAbstractNode& node) const {
+    this->checkSolver();
+    return this->solver->predictSolvingTime(node);
   }
 
 
-  triton::ast::SharedAbstractNode Context::getOperandAst(triton::arch::Instruction& inst, const triton::arch::OperandWrapper& op) {
-    this->checkSymbolic();
-    return this->symbolic->getOperandAst(inst, op);
+  void Context::enableCounterexampleCache(bool flag, triton::usize capacity) {
+    this->checkSolver();
+    this->solver->enableCounterexampleCache(flag, capacity);
   }
 
 
-  triton::ast::SharedAbstractNode Context::getImmediateAst(const triton::arch::Immediate& imm) {
-    this->checkSymbolic();
-    return this->symbolic->getImmediateAst(imm);
+  bool Context::isCounterexampleCacheEnabled(void) const {
+    this->checkSolver();
+    return this->solver->isCounterexampleCacheEnabled();
   }
 
 
-  triton::ast::SharedAbstractNode Context::getImmediateAst(triton::arch::Instruction& inst, const triton::arch::Immediate& imm) {
-    this->checkSymbolic();
-    return this->symbolic->getImmediateAst(inst, imm);
+  triton::usize Context::getCounterexampleCacheSize(void) const {
+    this->checkSolver();
+    return this->solver->getCounterexampleCacheSize();
   }
 
 
-  triton::ast::SharedAbstractNode Context::getMemoryAst(const triton::arch::MemoryAccess& mem) {
-    this->checkSymbolic();
-    return this->symbolic->getMemoryAst(mem);
+  triton::usize Context::getCounterexampleCacheHits(void) const {
+    this->checkSolver();
+    return this->solver->getCounterexampleCacheHits();
   }
 
 
-  triton::ast::SharedAbstractNode Context::getMemoryAst(triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem) {
-    this->checkSymbolic();
-    return this->symbolic->getMemoryAst(inst, mem);
+  void Context::clearCounterexampleCache(void) {
+    this->checkSolver();
+    this->solver->clearCounterexampleCache();
   }
 
 
-  triton::ast::SharedAbstractNode Context::getRegisterAst(const triton::arch::Register& reg) {
-    this->checkSymbolic();
-    return this->symbolic->getRegisterAst(reg);
+  void Context::enableUnsatCoreCache(bool flag, triton::usize capacity) {
+    this->checkSolver();
+    this->solver->enableUnsatCoreCache(flag, capacity);
   }
 
 
-  triton::ast::SharedAbstractNode Context::getRegisterAst(triton::arch::Instruction& inst, const triton::arch::Register& reg) {
-    this->checkSymbolic();
-    return this->symbolic->getRegisterAst(inst, reg);
+  bool Context::isUnsatCoreCacheEnabled(void) const {
+    this->checkSolver();
+    return this->solver->isUnsatCoreCacheEnabled();
   }
 
 
-  triton::engines::symbolic::SharedSymbolicExpression Context::newSymbolicExpression(const triton::ast::SharedAbstractNode& node, const std::string& comment) {
-    this->checkSymbolic();
-    return this->symbolic->newSymbolicExpression(node, triton::engines::symbolic::VOLATILE_EXPRESSION, comment);
+  triton::usize Context::getUnsatCoreCacheSize(void) const {
+    this->checkSolver();
+    return this->solver->getUnsatCoreCacheSize();
   }
 
 
-  triton::engines::symbolic::SharedSymbolicVariable Context::newSymbolicVariable(triton::uint32 varSize, const std::string& alias) {
-    this->checkSymbolic();
-    return this->symbolic->newSymbolicVariable(triton::engines::symbolic::UNDEFINED_VARIABLE, 0, varSize, alias);
+  triton::usize Context::getUnsatCoreCacheHits(void) const {
+    this->checkSolver();
+    return this->solver->getUnsatCoreCacheHits();
   }
 
 
-  void Context::removeSymbolicExpression(const triton::engines::symbolic::SharedSymbolicExpression& expr) {
-    this->checkSymbolic();
-    return this->symbolic->removeSymbolicExpression(expr);
+  void Context::clearUnsatCoreCache(void) {
+    this->checkSolver();
+    this->solver->clearUnsatCoreCache();
   }
 
 
-  const triton::engines::symbolic::SharedSymbolicExpression& Context::createSymbolicExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::OperandWrapper& dst, const std::string& comment) {
-    this->checkSymbolic();
-    return this->symbolic->createSymbolicExpression(inst, node, dst, comment);
+  void Context::enableConstraintIndependence(bool flag) {
+    this->checkSolver();
+    this->solver->enableConstraintIndependence(flag);
   }
 
 
-  const triton::engines::symbolic::SharedSymbolicExpression& Context::createSymbolicMemoryExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::MemoryAccess& mem, const std::string& comment) {
-    this->checkSymbolic();
-    return this->symbolic->createSymbolicMemoryExpression(inst, node, mem, comment);
+  bool Context::isConstraintIndependenceEnabled(void) const {
+    this->checkSolver();
+    return this->solver->isConstraintIndependenceEnabled();
   }
 
 
-  const triton::engines::symbolic::SharedSymbolicExpression& Context::createSymbolicRegisterExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::Register& reg, const std::string& comment) {
-    this->checkSymbolic();
-    return this->symbolic->createSymbolicRegisterExpression(inst, node, reg, comment);
+  void Context::enablePresolver(bool flag) {
+    this->checkSolver();
+    this->solver->enablePresolver(flag);
   }
 
 
-  const triton::engines::symbolic::SharedSymbolicExpression& Context::createSymbolicVolatileExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const std::string& comment) {
-    this->checkSymbolic();
-    return this->symbolic->createSymbolicVolatileExpression(inst, node, comment);
+  bool Context::isPresolverEnabled(void) const {
+    this->checkSolver();
+    return this->solver->isPresolverEnabled();
   }
 
 
-  void Context::assignSymbolicExpressionToMemory(const triton::engines::symbolic::SharedSymbolicExpression& se, const triton::arch::MemoryAccess& mem) {
-    this->checkSymbolic();
-    this->symbolic->assignSymbolicExpressionToMemory(se, mem);
+  triton::usize Context::getPresolverHits(void) const {
+    this->checkSolver();
+    return this->solver->getPresolverHits();
   }
 
 
-  void Context::assignSymbolicExpressionToRegister(const triton::engines::symbolic::SharedSymbolicExpression& se, const triton::arch::Register& reg) {
-    this->checkSymbolic();
-    this->symbolic->assignSymbolicExpressionToRegister(se, reg);
+  void Context::enableQueryClassification(bool flag) {
+    this->checkSolver();
+    this->solver->enableQueryClassification(flag);
   }
 
 
-  triton::engines::symbolic::SharedSymbolicExpression Context::getSymbolicMemory(triton::uint64 addr) const {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicMemory(addr);
+  bool Context::isQueryClassificationEnabled(void) const {
+    this->checkSolver();
+    return this->solver->isQueryClassificationEnabled();
   }
 
 
-  std::unordered_map<triton::arch::register_e, triton::engines::symbolic::SharedSymbolicExpression> Context::getSymbolicRegisters(void) const {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicRegisters();
+  void Context::setQueryConfiguration(triton::engines::solver::query_e query, const triton::engines::solver::SolverConfiguration& config) {
+    this->checkSolver();
+    this->solver->setQueryConfiguration(query, config);
   }
 
 
-  std::unordered_map<triton::uint64, triton::engines::symbolic::SharedSymbolicExpression> Context::getSymbolicMemory(void) const {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicMemory();
+  const triton::engines::solver::SolverConfiguration& Context::getQueryConfiguration(triton::engines::solver::query_e query) const {
+    this->checkSolver();
+    return this->solver->getQueryConfiguration(query);
   }
 
 
-  const triton::engines::symbolic::SharedSymbolicExpression& Context::getSymbolicRegister(const triton::arch::Register& reg) const {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicRegister(reg);
+  void Context::enableSolverStatistics(bool flag) {
+    this->checkSolver();
+    this->solver->enableStatistics(flag);
   }
 
 
-  triton::uint8 Context::getSymbolicMemoryValue(triton::uint64 address) {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicMemoryValue(address);
+  bool Context::isSolverStatisticsEnabled(void) const {
+    this->checkSolver();
+    return this->solver->isStatisticsEnabled();
   }
 
 
-  triton::uint512 Context::getSymbolicMemoryValue(const triton::arch::MemoryAccess& mem) {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicMemoryValue(mem);
+  triton::engines::solver::SolverStatistics Context::getSolverStatistics(void) const {
+    this->checkSolver();
+    return this->solver->getStatistics();
   }
 
 
-  std::vector<triton::uint8> Context::getSymbolicMemoryAreaValue(triton::uint64 baseAddr, triton::usize size) {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicMemoryAreaValue(baseAddr, size);
+  void Context::clearSolverStatistics(void) {
+    this->checkSolver();
+    this->solver->clearStatistics();
   }
 
 
-  triton::uint512 Context::getSymbolicRegisterValue(const triton::arch::Register& reg) {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicRegisterValue(reg);
+  void Context::setSolverTraceCallback(const std::function<void(const triton::engines::solver::SolverQuery& query)>& callback) {
+    this->checkSolver();
+    this->queryCorpus = nullptr;
+    this->solver->setTraceCallback(callback);
   }
 
 
-  triton::ast::SharedAbstractNode Context::simplify(const triton::ast::SharedAbstractNode& node, bool usingSolver, bool usingLLVM) const {
-    if (usingSolver) {
-      return this->simplifyAstViaSolver(node);
-    }
-    else if (usingLLVM) {
-      return this->simplifyAstViaLLVM(node);
-    }
-    else {
-      this->checkSymbolic();
-      return this->symbolic->simplify(node);
+  void Context::dumpSlowSolverQueries(const std::string& directory, triton::uint32 threshold) {
+    this->checkSolver();
+    this->checkLifting();
+    this->queryCorpus = nullptr;
+
+    if (directory.empty()) {
+      this->solver->setTraceCallback(nullptr);
+      return;
     }
-  }
 
+    auto count = std::make_shared<triton::usize>(0);
+    this->solver->setTraceCallback([this, directory, threshold, count](const triton::engines::solver::SolverQuery& query) {
+      if (query.node == nullptr || query.queryTime < static_cast<triton::uint64>(threshold) * 1000)
+        return;
 
-  triton::arch::BasicBlock Context::simplify(const triton::arch::BasicBlock& block, bool padding) const {
-    this->checkSymbolic();
-    return this->symbolic->simplify(block, padding);
+      std::string path = directory + "/query-" + std::to_string((*count)++) + ".smt2";
+      std::ofstream stream(path);
+      if (!stream)
+        throw triton::exceptions::Context("Context::dumpSlowSolverQueries(): Cannot open " + path + ".");
+
+      /* The query is not registered, its own define is replaced by its asserts */
+      auto expr = std::make_shared<triton::engines::symbolic::SymbolicExpression>(query.node, static_cast<triton::usize>(-1), triton::engines::symbolic::VOLATILE_EXPRESSION);
+      stream << "; " << query.queryTime << "us, " << query.nodes << " nodes, " << query.variables << " variables" << std::endl;
+      this->lifting->liftToSMT(stream, expr, true);
+    });
   }
 
 
-  triton::engines::symbolic::SharedSymbolicExpression Context::getSymbolicExpression(triton::usize symExprId) const {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicExpression(symExprId);
-  }
+  void Context::dumpSolverQueries(const std::string& path) {
+    this->queryCorpus = nullptr;
 
+    if (!path.empty()) {
+      this->queryCorpus = std::make_shared<std::ofstream>(path, std::ios::out | std::ios::binary | std::ios::trunc);
+      if (!*this->queryCorpus) {
+        this->queryCorpus = nullptr;
+        throw triton::exceptions::Context("Context::dumpSolverQueries(): Cannot open " + path + ".");
+      }
+    }
 
-  triton::uint512 Context::getConcreteVariableValue(const triton::engines::symbolic::SharedSymbolicVariable& symVar) const {
-    this->checkSymbolic();
-    return this->symbolic->getConcreteVariableValue(symVar);
+    if (this->solver != nullptr)
+      this->traceQueryCorpus();
   }
 
 
-  void Context::setConcreteVariableValue(const triton::engines::symbolic::SharedSymbolicVariable& symVar, const triton::uint512& value) {
-    this->checkSymbolic();
-    this->symbolic->setConcreteVariableValue(symVar, value);
+  void Context::traceQueryCorpus(void) {
+    if (this->queryCorpus == nullptr) {
+      this->solver->setTraceCallback(nullptr);
+      return;
+    }
+
+    auto stream = this->queryCorpus;
+    this->solver->setTraceCallback([stream](const triton::engines::solver::SolverQuery& query) {
+      triton::engines::solver::writeQuery(*stream, query);
+      stream->flush();
+    });
   }
 
 
-  triton::engines::symbolic::SharedSymbolicVariable Context::getSymbolicVariable(triton::usize symVarId) const {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicVariable(symVarId);
+  triton::engines::solver::solver_e Context::getSolver(void) const {
+    this->checkSolver();
+    return this->solver->getSolver();
   }
 
 
-  triton::engines::symbolic::SharedSymbolicVariable Context::getSymbolicVariable(const std::string& symVarName) const {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicVariable(symVarName);
+  const triton::engines::solver::SolverInterface* Context::getSolverInstance(void) const {
+    this->checkSolver();
+    return this->solver->getSolverInstance();
   }
 
 
-  const std::vector<triton::engines::symbolic::PathConstraint>& Context::getPathConstraints(void) const {
-    this->checkSymbolic();
-    return this->symbolic->getPathConstraints();
+  void Context::setSolver(triton::engines::solver::solver_e kind) {
+    this->checkSolver();
+    this->solver->setSolver(kind);
+
+    /* The session belongs to the previous solver */
+    if (this->isIncrementalSolvingEnabled())
+      this->enableIncrementalSolving(true);
   }
 
 
-  std::vector<triton::engines::symbolic::PathConstraint> Context::getPathConstraints(triton::usize start, triton::usize end) const {
-    this->checkSymbolic();
-    return this->symbolic->getPathConstraints(start, end);
+  void Context::setCustomSolver(triton::engines::solver::SolverInterface* customSolver) {
+    this->checkSolver();
+    this->solver->setCustomSolver(customSolver);
+
+    /* The session belongs to the previous solver */
+    if (this->isIncrementalSolvingEnabled())
+      this->enableIncrementalSolving(true);
   }
 
 
-  std::vector<triton::engines::symbolic::PathConstraint> Context::getPathConstraintsOfThread(triton::uint32 threadId) const {
-    this->checkSymbolic();
-    return this->symbolic->getPathConstraintsOfThread(threadId);
+  void Context::setRemoteSolver(const std::vector<std::string>& endpoints) {
+    this->checkSolver();
+    #ifdef TRITON_REMOTE_INTERFACE
+    this->solver->setRemoteSolver(endpoints);
+
+    /* The session belongs to the previous solver */
+    if (this->isIncrementalSolvingEnabled())
+      this->enableIncrementalSolving(true);
+    return;
+    #endif
+    throw triton::exceptions::Context("Context::setRemoteSolver(): Triton not built with the remote solver");
   }
 
 
-  triton::usize Context::getSizeOfPathConstraints(void) const {
-    this->checkSymbolic();
-    return this->symbolic->getSizeOfPathConstraints();
+  bool Context::isSolverValid(void) const {
+    this->checkSolver();
+    return this->solver->isValid();
   }
 
 
-  triton::ast::SharedAbstractNode Context::getPathPredicate(void) {
-    this->checkSymbolic();
-    return this->symbolic->getPathPredicate();
+  std::unordered_map<triton::usize, triton::engines::solver::SolverModel> Context::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+    this->checkSolver();
+    return this->solver->getModel(node, status, timeout, solvingTime);
   }
 
 
-  std::vector<triton::ast::SharedAbstractNode> Context::getPredicatesToReachAddress(triton::uint64 addr) {
-    this->checkSymbolic();
-    return this->symbolic->getPredicatesToReachAddress(addr);
+  triton::engines::solver::DenseModel Context::getDenseModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+    this->checkSolver();
+    return triton::engines::solver::DenseModel(this->solver->getModel(node, status, timeout, solvingTime));
   }
 
 
-  void Context::pushPathConstraint(const triton::ast::SharedAbstractNode& node, const std::string& comment) {
-    this->checkSymbolic();
-    this->symbolic->pushPathConstraint(node, comment);
+  std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> Context::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+    this->checkSolver();
+    return this->solver->getModels(node, limit, status, timeout, solvingTime);
   }
 
 
-  void Context::pushPathConstraint(const triton::engines::symbolic::PathConstraint& pco) {
-    this->checkSymbolic();
-    this->symbolic->pushPathConstraint(pco);
+  triton::usize Context::enumerateModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, const triton::engines::solver::ModelCallback& callback, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+    this->checkSolver();
+    return this->solver->enumerateModels(node, projection, callback, limit, status, timeout, solvingTime);
   }
 
 
-  void Context::popPathConstraint(void) {
-    this->checkSymbolic();
-    this->symbolic->popPathConstraint();
+  bool Context::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+    this->checkSolver();
+    return this->solver->isSat(node, status, timeout, solvingTime);
   }
 
 
-  void Context::clearPathConstraints(void) {
-    this->checkSymbolic();
-    this->symbolic->clearPathConstraints();
+  bool Context::isOpaquePredicate(const triton::ast::SharedAbstractNode& node, triton::uint512* value, triton::usize samples, triton::uint32 timeout) const {
+    this->checkSolver();
+    return this->solver->isOpaquePredicate(node, value, samples, timeout);
   }
 
 
-  bool Context::isSymbolicExpressionExists(triton::usize symExprId) const {
-    this->checkSymbolic();
-    return this->symbolic->isSymbolicExpressionExists(symExprId);
+  std::shared_ptr<triton::engines::solver::SolverFuture> Context::getModelAsync(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout) const {
+    this->checkSolver();
+    return this->solver->getModelAsync(node, timeout);
   }
 
 
-  bool Context::isMemorySymbolized(const triton::arch::MemoryAccess& mem) const {
-    this->checkSymbolic();
-    return this->symbolic->isMemorySymbolized(mem);
+  std::shared_ptr<triton::engines::solver::SolverFuture> Context::isSatAsync(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout) const {
+    this->checkSolver();
+    return this->solver->isSatAsync(node, timeout);
   }
 
 
-  bool Context::isMemorySymbolized(triton::uint64 addr, triton::uint32 size) const {
-    this->checkSymbolic();
-    return this->symbolic->isMemorySymbolized(addr, size);
+  void Context::cancelAsync(void) {
+    this->checkSolver();
+    this->solver->cancelAsync();
   }
 
 
-  bool Context::isRegisterSymbolized(const triton::arch::Register& reg) const {
-    this->checkSymbolic();
-    return this->symbolic->isRegisterSymbolized(reg);
+  triton::usize Context::getAsyncSize(void) const {
+    this->checkSolver();
+    return this->solver->getAsyncSize();
   }
 
 
-  void Context::concretizeAllMemory(void) {
+  void Context::enableIncrementalSolving(bool flag) {
+    this->checkSolver();
     this->checkSymbolic();
-    this->symbolic->concretizeAllMemory();
+    this->symbolic->setSolverSession(flag ? this->solver->newSession() : nullptr);
   }
 
 
-  void Context::concretizeAllRegister(void) {
+  bool Context::isIncrementalSolvingEnabled(void) const {
     this->checkSymbolic();
-    this->symbolic->concretizeAllRegister();
+    return this->symbolic->isSolverSessionDefined();
   }
 
 
-  void Context::concretizeMemory(const triton::arch::MemoryAccess& mem) {
-    this->checkSymbolic();
-    this->symbolic->concretizeMemory(mem);
-  }
+  triton::ast::SharedAbstractNode Context::getPrefixPredicate(triton::usize index, const triton::ast::SharedAbstractNode& node) const {
+    if (index > this->symbolic->getSizeOfPathConstraints())
+      throw triton::exceptions::Context("Context::getPrefixPredicate(): Index out of range.");
 
+    /* The prefixes share the balanced conjunctions of the path */
+    auto exprs = this->symbolic->getPrefixConjunctions(index);
+    exprs.push_back(node);
 
-  void Context::concretizeMemory(triton::uint64 addr) {
-    this->checkSymbolic();
-    this->symbolic->concretizeMemory(addr);
+    return exprs.size() == 1 ? node : this->astCtxt->land(exprs);
   }
 
 
-  void Context::concretizeRegister(const triton::arch::Register& reg) {
+  std::unordered_map<triton::usize, triton::engines::solver::SolverModel> Context::getModelOfPath(triton::usize index, const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+    this->checkSolver();
     this->checkSymbolic();
-    this->symbolic->concretizeRegister(reg);
-  }
 
+    if (this->symbolic->isSolverSessionDefined())
+      return this->symbolic->getModelOfPath(index, node, status, timeout, solvingTime);
 
-  std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> Context::sliceExpressions(const triton::engines::symbolic::SharedSymbolicExpression& expr) {
-    this->checkSymbolic();
-    return this->symbolic->sliceExpressions(expr);
+    return this->solver->getModel(this->getPrefixPredicate(index, node), status, timeout, solvingTime);
   }
 
 
-  std::vector<triton::engines::symbolic::SharedSymbolicExpression> Context::getTaintedSymbolicExpressions(void) const {
+  bool Context::isSatOfPath(triton::usize index, const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+    this->checkSolver();
     this->checkSymbolic();
-    return this->symbolic->getTaintedSymbolicExpressions();
+
+    if (this->symbolic->isSolverSessionDefined())
+      return this->symbolic->isSatOfPath(index, node, status, timeout, solvingTime);
+
+    return this->solver->isSat(this->getPrefixPredicate(index, node), status, timeout, solvingTime);
   }
 
 
-  std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> Context::getSymbolicExpressions(void) const {
+  std::vector<triton::engines::symbolic::BranchFlip> Context::solveAllBranchFlips(triton::usize threads, triton::uint32 timeout, const std::function<void(const triton::engines::symbolic::BranchFlip&)>& callback, const std::function<bool(triton::uint64 srcAddr, triton::uint64 dstAddr)>& filter) {
+    std::vector<triton::engines::symbolic::BranchFlip> flips;
+    std::vector<triton::ast::SharedAbstractNode> nodes;
+
+    this->checkSolver();
     this->checkSymbolic();
-    return this->symbolic->getSymbolicExpressions();
-  }
 
+    /* The queries are built on the calling thread, only their solving is concurrent */
+    const auto& pcs = this->symbolic->getPathConstraints();
+    for (triton::usize index = 0; index < pcs.size(); index++) {
+      for (const auto& branch : pcs[index].getBranchConstraints()) {
+        if (std::get<0>(branch) || (filter && !filter(std::get<1>(branch), std::get<2>(branch))))
+          continue;
+
+        triton::engines::symbolic::BranchFlip flip;
+        flip.index       = index;
+        flip.srcAddr     = std::get<1>(branch);
+        flip.dstAddr     = std::get<2>(branch);
+        flip.status      = triton::engines::solver::UNKNOWN;
+        flip.solvingTime = 0;
+
+        /* With incremental solving, the session keeps the prefix and the branch is an assumption */
+        flips.push_back(flip);
+        nodes.push_back(this->symbolic->isSolverSessionDefined() ? std::get<3>(branch) : this->getPrefixPredicate(index, std::get<3>(branch)));
+      }
+    }
 
-  std::map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> Context::getSymbolicVariables(void) const {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicVariables();
+    if (this->symbolic->isSolverSessionDefined())
+      return this->solveBranchFlipsOfPath(flips, nodes, timeout, callback);
+
+    return this->solveBranchFlips(flips, nodes, threads, timeout, callback);
   }
 
 
+  std::vector<triton::engines::symbolic::BranchFlip> Context::solveBranchFlipsOfPath(std::vector<triton::engines::symbolic::BranchFlip>& flips, const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 timeout, const std::function<void(const triton::engines::symbolic::BranchFlip&)>& callback) {
+    std::vector<triton::engines::symbolic::BranchFlip> ret;
 
-  /* Solver engine Context ============================================================================= */
+    /* The flips are in the order of the path, so that each query only asserts the constraints since the previous one */
+    ret.reserve(flips.size());
+    for (triton::usize index = 0; index < flips.size(); index++) {
+      auto& flip  = flips[index];
+      flip.model  = this->symbolic->getModelOfPath(flip.index, nodes[index], &flip.status, timeout, &flip.solvingTime);
+      ret.push_back(flip);
+      if (callback)
+        callback(ret.back());
+    }
 
-  triton::engines::solver::solver_e Context::getSolver(void) const {
-    this->checkSolver();
-    return this->solver->getSolver();
+    return ret;
   }
 
 
-  const triton::engines::solver::SolverInterface* Context::getSolverInstance(void) const {
+  std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> Context::getModelsToReachAddresses(const std::vector<triton::uint64>& addrs, triton::usize threads, triton::uint32 timeout) {
+    std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> ret(addrs.size());
+    std::vector<triton::ast::SharedAbstractNode> nodes;
+    std::vector<std::pair<triton::usize, triton::usize>> owners;
+    std::vector<triton::usize> firsts(addrs.size(), static_cast<triton::usize>(-1));
+
     this->checkSolver();
-    return this->solver->getSolverInstance();
-  }
+    this->checkSymbolic();
+
+    /* The predicates of all the addresses are solved together, <address, predicate> by query */
+    auto predicates = this->symbolic->getPredicatesToReachAddresses(addrs);
+    for (triton::usize a = 0; a < predicates.size(); a++) {
+      for (triton::usize p = 0; p < predicates[a].size(); p++) {
+        nodes.push_back(predicates[a][p]);
+        owners.push_back({a, p});
+      }
+    }
 
+    this->solver->solveAll(nodes, threads, timeout, [&](triton::usize index, triton::engines::solver::status_e status, const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model, triton::uint32) {
+      auto owner = owners[index];
+      if (status == triton::engines::solver::SAT && owner.second < firsts[owner.first]) {
+        firsts[owner.first] = owner.second;
+        ret[owner.first] = model;
+      }
+    });
 
-  void Context::setSolver(triton::engines::solver::solver_e kind) {
-    this->checkSolver();
-    this->solver->setSolver(kind);
+    return ret;
   }
 
 
-  void Context::setCustomSolver(triton::engines::solver::SolverInterface* customSolver) {
-    this->checkSolver();
-    this->solver->setCustomSolver(customSolver);
-  }
+  std::vector<triton::engines::symbolic::BranchFlip> Context::solveAllBranchFlipsOfThread(triton::uint32 threadId, triton::usize threads, triton::uint32 timeout, const std::function<void(const triton::engines::symbolic::BranchFlip&)>& callback, const std::function<bool(triton::uint64 srcAddr, triton::uint64 dstAddr)>& filter) {
+    std::vector<triton::engines::symbolic::BranchFlip> flips;
+    std::vector<triton::ast::SharedAbstractNode> nodes;
 
+    /* The taken predicates of the thread, merged by 16 as the conjunctions of the path so that the prefixes share them */
+    std::vector<std::pair<triton::ast::SharedAbstractNode, triton::usize>> prefix;
 
-  bool Context::isSolverValid(void) const {
     this->checkSolver();
-    return this->solver->isValid();
-  }
+    this->checkSymbolic();
 
+    const auto& pcs = this->symbolic->getPathConstraints();
+    for (triton::usize index : this->symbolic->getPathConstraintIndexesOfThread(threadId)) {
+      for (const auto& branch : pcs[index].getBranchConstraints()) {
+        if (std::get<0>(branch) || (filter && !filter(std::get<1>(branch), std::get<2>(branch))))
+          continue;
+
+        triton::engines::symbolic::BranchFlip flip;
+        flip.index       = index;
+        flip.srcAddr     = std::get<1>(branch);
+        flip.dstAddr     = std::get<2>(branch);
+        flip.status      = triton::engines::solver::UNKNOWN;
+        flip.solvingTime = 0;
+
+        std::vector<triton::ast::SharedAbstractNode> exprs;
+        for (const auto& conj : prefix)
+          exprs.push_back(conj.first);
+        exprs.push_back(std::get<3>(branch));
+
+        flips.push_back(flip);
+        nodes.push_back(exprs.size() == 1 ? exprs.front() : this->astCtxt->land(exprs));
+      }
+
+      prefix.push_back({pcs[index].getTakenPredicate(), 1});
+      while (prefix.size() >= 16 && prefix[prefix.size() - 16].second == prefix.back().second) {
+        std::vector<triton::ast::SharedAbstractNode> children;
+        triton::usize size = prefix.back().second;
+
+        for (triton::usize i = prefix.size() - 16; i < prefix.size(); i++)
+          children.push_back(prefix[i].first);
+
+        prefix.resize(prefix.size() - 16);
+        prefix.push_back({this->astCtxt->land(children), size * 16});
+      }
+    }
 
-  std::unordered_map<triton::usize, triton::engines::solver::SolverModel> Context::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
-    this->checkSolver();
-    return this->solver->getModel(node, status, timeout, solvingTime);
+    return this->solveBranchFlips(flips, nodes, threads, timeout, callback);
   }
 
 
-  std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> Context::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
-    this->checkSolver();
-    return this->solver->getModels(node, limit, status, timeout, solvingTime);
-  }
+  std::vector<triton::engines::symbolic::BranchFlip> Context::solveBranchFlips(std::vector<triton::engines::symbolic::BranchFlip>& flips, const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::usize threads, triton::uint32 timeout, const std::function<void(const triton::engines::symbolic::BranchFlip&)>& callback) {
+    std::vector<triton::engines::symbolic::BranchFlip> ret;
 
+    ret.reserve(flips.size());
+    this->solver->solveAll(nodes, threads, timeout, [&](triton::usize index, triton::engines::solver::status_e status, const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model, triton::uint32 solvingTime) {
+      auto& flip       = flips[index];
+      flip.status      = status;
+      flip.model       = model;
+      flip.solvingTime = solvingTime;
+      ret.push_back(flip);
+      if (callback)
+        callback(ret.back());
+    });
 
-  bool Context::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
-    this->checkSolver();
-    return this->solver->isSat(node, status, timeout, solvingTime);
+    return ret;
   }
 
 
@@ -1169,30 +3720,66 @@ namespace triton {
   }
 
 
-  const std::unordered_set<triton::uint64>& Context::getTaintedMemory(void) const {
+  const triton::engines::taint::TaintBitmap& Context::getTaintedMemory(void) const {
     this->checkTaint();
     return this->taint->getTaintedMemory();
   }
 
 
+  std::vector<std::pair<triton::uint64, triton::usize>> Context::getTaintedRanges(void) const {
+    this->checkTaint();
+    return this->taint->getTaintedRanges();
+  }
+
+
+  std::vector<triton::uint32> Context::getMemoryTaintLabels(triton::uint64 addr, triton::usize size) const {
+    this->checkTaint();
+    return this->taint->getMemoryTaintLabels(addr, size);
+  }
+
+
+  std::vector<triton::uint32> Context::getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const {
+    this->checkTaint();
+    return this->taint->getMemoryTaintLabels(mem);
+  }
+
+
+  std::vector<triton::uint32> Context::getRegisterTaintLabels(const triton::arch::Register& reg) const {
+    this->checkTaint();
+    return this->taint->getRegisterTaintLabels(reg);
+  }
+
+
   std::unordered_set<const triton::arch::Register*> Context::getTaintedRegisters(void) const {
     this->checkTaint();
     return this->taint->getTaintedRegisters();
   }
 
 
+  const triton::engines::taint::RegisterSet& Context::getTaintedRegisterSet(void) const {
+    this->checkTaint();
+    return this->taint->getTaintedRegisterSet();
+  }
+
+
   bool Context::isTainted(const triton::arch::OperandWrapper& op) const {
     this->checkTaint();
     return this->taint->isTainted(op);
   }
 
 
-  bool Context::isMemoryTainted(triton::uint64 addr, uint32 size) const {
+  bool Context::isMemoryTainted(triton::uint64 addr, triton::usize size) const {
     this->checkTaint();
     return this->taint->isMemoryTainted(addr, size);
   }
 
 
+  bool Context::isAnyTainted(triton::uint64 addr, triton::usize size) const {
+    this->checkTaint();
+    return this->taint->isAnyTainted(addr, size);
+  }
+
+
   bool Context::isMemoryTainted(const triton::arch::MemoryAccess& mem) const {
     this->checkTaint();
     return this->taint->isMemoryTainted(mem);
@@ -1225,9 +3812,15 @@ namespace triton {
   }
 
 
-  bool Context::taintMemory(triton::uint64 addr) {
+  bool Context::taintMemory(triton::uint64 addr, triton::usize size) {
+    this->checkTaint();
+    return this->taint->taintMemory(addr, size);
+  }
+
+
+  bool Context::taintMemoryRange(triton::uint64 addr, triton::usize size) {
     this->checkTaint();
-    return this->taint->taintMemory(addr);
+    return this->taint->taintMemoryRange(addr, size);
   }
 
 
@@ -1243,9 +3836,33 @@ namespace triton {
   }
 
 
-  bool Context::untaintMemory(triton::uint64 addr) {
+  bool Context::taintMemoryWithLabel(triton::uint64 addr, triton::usize size, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->taintMemoryWithLabel(addr, size, label);
+  }
+
+
+  bool Context::taintMemoryWithLabel(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->taintMemoryWithLabel(mem, label);
+  }
+
+
+  bool Context::taintRegisterWithLabel(const triton::arch::Register& reg, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->taintRegisterWithLabel(reg, label);
+  }
+
+
+  bool Context::untaintMemory(triton::uint64 addr, triton::usize size) {
+    this->checkTaint();
+    return this->taint->untaintMemory(addr, size);
+  }
+
+
+  bool Context::untaintMemoryRange(triton::uint64 addr, triton::usize size) {
     this->checkTaint();
-    return this->taint->untaintMemory(addr);
+    return this->taint->untaintMemoryRange(addr, size);
   }
 
 
@@ -1348,10 +3965,76 @@ namespace triton {
 
   /* Synthesizer engine Context ============================================================================= */
 
-  triton::engines::synthesis::SynthesisResult Context::synthesize(const triton::ast::SharedAbstractNode& node, bool constant, bool subexpr, bool opaque) {
+  triton::engines::synthesis::SynthesisResult Context::synthesize(const triton::ast::SharedAbstractNode& node, bool constant, bool subexpr, bool opaque, triton::usize threads) {
+    TRITON_TRACE("synthesis", "Context::synthesize");
+
     this->checkSymbolic();
-    triton::engines::synthesis::Synthesizer synth(this->symbolic);
-    return synth.synthesize(node, constant, subexpr, opaque);
+    triton::engines::synthesis::Synthesizer synth(this->symbolic, this->synthesisCache.isEnabled() ? &this->synthesisCache : nullptr, &this->synthesisDatabases);
+    return synth.synthesize(node, constant, subexpr, opaque, threads);
+  }
+
+
+  triton::engines::synthesis::SynthesisResult Context::synthesizeByEnumeration(const triton::ast::SharedAbstractNode& node, triton::usize maxSize, triton::usize timeout, triton::usize threads) {
+    TRITON_TRACE("synthesis", "Context::synthesizeByEnumeration");
+
+    triton::engines::synthesis::EnumerativeSynthesizer synth;
+    return synth.synthesize(node, maxSize, timeout, threads);
+  }
+
+
+  void Context::enableSynthesisCache(bool flag) {
+    this->synthesisCache.enable(flag);
+  }
+
+
+  bool Context::isSynthesisCacheEnabled(void) const {
+    return this->synthesisCache.isEnabled();
+  }
+
+
+  triton::usize Context::getSynthesisCacheSize(void) const {
+    return this->synthesisCache.size();
+  }
+
+
+  triton::usize Context::getSynthesisCacheHits(void) const {
+    return this->synthesisCache.getHits();
+  }
+
+
+  void Context::clearSynthesisCache(void) {
+    this->synthesisCache.clear();
+  }
+
+
+  void Context::saveSynthesisCache(const std::string& path) const {
+    this->synthesisCache.save(path);
+  }
+
+
+  void Context::loadSynthesisCache(const std::string& path) {
+    this->synthesisCache.load(path);
+  }
+
+
+  void Context::loadSynthesisDatabase(const std::string& path) {
+    this->synthesisDatabases.push_back(std::make_shared<triton::engines::synthesis::SynthesisDatabase>(path));
+    this->synthesisCache.removeFailures();
+  }
+
+
+  triton::usize Context::getSynthesisDatabasesSize(void) const {
+    return this->synthesisDatabases.size();
+  }
+
+
+  void Context::clearSynthesisDatabases(void) {
+    this->synthesisDatabases.clear();
+  }
+
+
+  triton::usize Context::writeSynthesisDatabase(const std::string& path, const std::vector<triton::ast::SharedAbstractNode>& vars, const std::vector<std::vector<triton::uint512>>& inputs, const std::vector<triton::ast::SharedAbstractNode>& exprs) const {
+    return triton::engines::synthesis::SynthesisDatabase::write(path, std::deque<triton::ast::SharedAbstractNode>(vars.begin(), vars.end()), inputs, exprs);
   }
 
 
@@ -1372,6 +4055,104 @@ namespace triton {
   }
 
 
+  std::ostream& Context::liftToLLVM(std::ostream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes, const char* fname, bool optimize) {
+    this->checkLifting();
+    #ifdef TRITON_LLVM_INTERFACE
+    return this->lifting->liftToLLVM(stream, nodes, fname, optimize);
+    #endif
+    throw triton::exceptions::Context("Context::liftToLLVM(): Triton not built with LLVM");
+  }
+
+
+  std::ostream& Context::liftToLLVM(std::ostream& stream, const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs, const char* fname, bool optimize) {
+    std::vector<triton::ast::SharedAbstractNode> nodes;
+
+    for (const auto& expr : exprs) {
+      nodes.push_back(expr->getAst());
+    }
+
+    return this->liftToLLVM(stream, nodes, fname, optimize);
+  }
+
+
+  std::vector<triton::engines::symbolic::SharedSymbolicExpression> Context::getBlockOutputs(triton::arch::BasicBlock& block, triton::uint32 maxSize) const {
+    std::map<triton::arch::register_e, triton::engines::symbolic::SharedSymbolicExpression> registers;
+    std::map<triton::uint64, triton::engines::symbolic::SharedSymbolicExpression> memory;
+    std::vector<triton::engines::symbolic::SharedSymbolicExpression> exprs;
+
+    /* The last expression of each location, the previous ones are reached through the references */
+    for (const auto& inst : block.getInstructions()) {
+      for (const auto& expr : inst.symbolicExpressions) {
+        if (expr->isRegister())
+          registers[this->getParentRegister(expr->getOriginRegister().getId()).getId()] = expr;
+        else if (expr->isMemory())
+          memory[expr->getOriginMemory().getAddress()] = expr;
+      }
+    }
+
+    for (const auto& item : registers) {
+      if (item.second->getAst()->getBitvectorSize() <= maxSize)
+        exprs.push_back(item.second);
+    }
+
+    for (const auto& item : memory) {
+      if (item.second->getAst()->getBitvectorSize() <= maxSize)
+        exprs.push_back(item.second);
+    }
+
+    return exprs;
+  }
+
+
+  std::ostream& Context::liftToLLVM(std::ostream& stream, triton::arch::BasicBlock& block, const char* fname, bool optimize) {
+    return this->liftToLLVM(stream, this->getBlockOutputs(block, triton::bitsize::qword), fname, optimize);
+  }
+
+
+  std::ostream& Context::liftToBTOR2(std::ostream& stream, const triton::ast::SharedAbstractNode& node) {
+    this->checkLifting();
+    return this->lifting->liftToBTOR2(stream, node);
+  }
+
+
+  std::ostream& Context::liftToBTOR2(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr) {
+    return this->liftToBTOR2(stream, expr->getAst());
+  }
+
+
+  std::ostream& Context::liftToC(std::ostream& stream, const triton::ast::SharedAbstractNode& node, const std::string& fname, bool icomment) {
+    this->checkLifting();
+    return this->lifting->liftToC(stream, node, fname, icomment);
+  }
+
+
+  std::ostream& Context::liftToC(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, const std::string& fname, bool icomment) {
+    return this->liftToC(stream, expr->getAst(), fname, icomment);
+  }
+
+
+  std::ostream& Context::liftToC(std::ostream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes, const std::string& fname, bool icomment) {
+    this->checkLifting();
+    return this->lifting->liftToC(stream, nodes, fname, icomment);
+  }
+
+
+  std::ostream& Context::liftToC(std::ostream& stream, const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs, const std::string& fname, bool icomment) {
+    std::vector<triton::ast::SharedAbstractNode> nodes;
+
+    for (const auto& expr : exprs) {
+      nodes.push_back(expr->getAst());
+    }
+
+    return this->liftToC(stream, nodes, fname, icomment);
+  }
+
+
+  std::ostream& Context::liftToC(std::ostream& stream, triton::arch::BasicBlock& block, const std::string& fname, bool icomment) {
+    return this->liftToC(stream, this->getBlockOutputs(block, triton::bitsize::dqword), fname, icomment);
+  }
+
+
   std::ostream& Context::liftToPython(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool icomment) {
     this->checkLifting();
     return this->lifting->liftToPython(stream, expr, icomment);
@@ -1384,6 +4165,54 @@ namespace triton {
   }
 
 
+  void Context::startSmtStream(std::ostream& stream) {
+    this->checkSymbolic();
+    this->checkLifting();
+    this->stopSmtStream();
+    this->lifting->triton::engines::lifters::LiftingToSMT::requiredFunctions(stream);
+    this->symbolic->startSmtStream(stream);
+  }
+
+
+  void Context::startSmtStream(const std::string& path) {
+    auto file = std::make_unique<std::ofstream>(path, std::ios::out | std::ios::trunc);
+    if (!file->is_open())
+      throw triton::exceptions::Context("Context::startSmtStream(): Cannot open the file.");
+
+    this->startSmtStream(*file);
+    this->smtFile = std::move(file);
+  }
+
+
+  void Context::stopSmtStream(void) {
+    this->checkSymbolic();
+    this->symbolic->stopSmtStream();
+    this->smtFile = nullptr;
+  }
+
+
+  bool Context::isSmtStreamEnabled(void) const {
+    this->checkSymbolic();
+    return this->symbolic->isSmtStreamEnabled();
+  }
+
+
+  std::vector<triton::ast::SharedAbstractNode> Context::parseSmt(std::istream& stream) {
+    this->checkSymbolic();
+
+    triton::ast::AstSmtParser parser(this->astCtxt, [this](const std::string& name, triton::uint32 size) {
+      try {
+        return this->symbolic->getSymbolicVariable(name);
+      }
+      catch (const triton::exceptions::SymbolicEngine&) {
+        return this->symbolic->newSymbolicVariable(triton::engines::symbolic::UNDEFINED_VARIABLE, 0, size, name);
+      }
+    });
+
+    return parser.parse(stream);
+  }
+
+
   std::ostream& Context::liftToDot(std::ostream& stream, const triton::ast::SharedAbstractNode& node) {
     this->checkLifting();
     return this->lifting->liftToDot(stream, node);
@@ -1396,6 +4225,12 @@ namespace triton {
   }
 
 
+  std::ostream& Context::liftToDot(std::ostream& stream, const triton::ast::SharedAbstractNode& node, triton::usize maxNodes, triton::uint32 maxDepth) {
+    this->checkLifting();
+    return this->lifting->liftToDot(stream, node, maxNodes, maxDepth);
+  }
+
+
   triton::ast::SharedAbstractNode Context::simplifyAstViaLLVM(const triton::ast::SharedAbstractNode& node) const {
     this->checkLifting();
     #ifdef TRITON_LLVM_INTERFACE
@@ -1404,4 +4239,142 @@ namespace triton {
     throw triton::exceptions::Context("Context::simplifyAstViaLLVM(): Triton not built with LLVM");
   }
 
+
+  std::vector<triton::ast::SharedAbstractNode> Context::simplifyAstViaLLVM(const std::vector<triton::ast::SharedAbstractNode>& nodes) const {
+    this->checkLifting();
+    #ifdef TRITON_LLVM_INTERFACE
+    return this->lifting->simplifyAstViaLLVM(nodes);
+    #endif
+    throw triton::exceptions::Context("Context::simplifyAstViaLLVM(): Triton not built with LLVM");
+  }
+
+
+  void Context::compileBasicBlock(triton::arch::BasicBlock& block, triton::uint64 addr) {
+    #ifdef TRITON_LLVM_INTERFACE
+    std::unordered_map<triton::usize, triton::arch::Register> variables;
+    std::unordered_set<const triton::ast::AbstractNode*> seen;
+    std::set<triton::arch::register_e> written;
+    std::vector<triton::arch::Register> inputs;
+    std::vector<triton::arch::Register> outputs;
+    std::vector<triton::ast::SharedAbstractNode> vars;
+    std::vector<triton::ast::SharedAbstractNode> nodes;
+    bool branch = false;
+
+    triton::Context scratch(this->getArchitecture());
+    const triton::arch::Register& pc = scratch.arch.getProgramCounter();
+
+    /* Every register is an input, a concrete value would be baked into the ASTs */
+    for (const auto* reg : scratch.getParentRegisters()) {
+      if (reg->getId() == pc.getId() || reg->getBitSize() > triton::bitsize::qword)
+        continue;
+      variables[scratch.symbolizeRegister(*reg)->getId()] = *reg;
+    }
+
+    for (const auto& inst : block.getInstructions()) {
+      triton::arch::Instruction copy(inst.getAddress(), inst.getOpcode(), inst.getSize());
+
+      if (scratch.processing(copy) != triton::arch::NO_FAULT || scratch.irBuilder->isCompilable(copy) == false) {
+        this->lifting->rejectBlock(block, addr);
+        return;
+      }
+
+      /* Registers left concrete in the scratch context can not be read */
+      for (const auto& item : copy.getReadRegisters()) {
+        const triton::arch::Register& parent = scratch.getParentRegister(std::get<0>(item));
+        if (parent.getId() == pc.getId() || parent.getBitSize() > triton::bitsize::qword) {
+          this->lifting->rejectBlock(block, addr);
+          return;
+        }
+      }
+
+      for (const auto& item : copy.getWrittenRegisters())
+        written.insert(scratch.getParentRegister(std::get<0>(item)).getId());
+
+      branch |= copy.isControlFlow();
+    }
+
+    for (const auto id : written) {
+      const triton::arch::Register& reg = scratch.getRegister(id);
+      if (reg.getBitSize() > triton::bitsize::qword) {
+        this->lifting->rejectBlock(block, addr);
+        return;
+      }
+      outputs.push_back(reg);
+      nodes.push_back(scratch.getRegisterAst(reg));
+    }
+
+    for (const auto& node : nodes) {
+      for (const auto& var : triton::ast::search(node, triton::ast::VARIABLE_NODE)) {
+        if (seen.insert(var.get()).second) {
+          inputs.push_back(variables.at(reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable()->getId()));
+          vars.push_back(var);
+        }
+      }
+    }
+
+    this->lifting->compileBlock(block, addr, inputs, vars, outputs, nodes, branch);
+    #endif
+  }
+
+
+  triton::arch::exception_e Context::processingJit(triton::arch::BasicBlock& block, triton::uint64 addr) {
+    this->checkLifting();
+    #ifdef TRITON_LLVM_INTERFACE
+    const triton::engines::lifters::CompiledBlock* compiled = this->lifting->getCompiledBlock(block, addr);
+    bool native = (compiled != nullptr && compiled->function != nullptr);
+
+    /* The journal records the expressions, and concrete branches are path constraints without PC_TRACKING_SYMBOLIC */
+    if (native && (this->symbolic->isUndoJournalEnabled() || (compiled->branch && this->isModeEnabled(triton::modes::PC_TRACKING_SYMBOLIC) == false)))
+      native = false;
+
+    for (triton::usize index = 0; native && index < compiled->inputs.size() + compiled->outputs.size(); index++) {
+      const triton::arch::Register& reg = (index < compiled->inputs.size()) ? compiled->inputs[index] : compiled->outputs[index - compiled->inputs.size()];
+      this->symbolic->materializeLazyRegister(reg);
+      if (this->symbolic->isRegisterSymbolized(reg) || this->taint->isRegisterTainted(reg))
+        native = false;
+    }
+
+    if (native) {
+      std::vector<triton::uint64> inputs(compiled->inputs.size());
+      std::vector<triton::uint64> outputs(compiled->outputs.size());
+
+      for (triton::usize index = 0; index < inputs.size(); index++)
+        inputs[index] = static_cast<triton::uint64>(this->arch.getConcreteRegisterValue(compiled->inputs[index]));
+
+      compiled->function(inputs.data(), outputs.data());
+
+      for (triton::usize index = 0; index < outputs.size(); index++) {
+        this->arch.setConcreteRegisterValue(compiled->outputs[index], outputs[index]);
+        this->symbolic->concretizeRegister(compiled->outputs[index]);
+      }
+
+      return triton::arch::NO_FAULT;
+    }
+
+    triton::arch::exception_e ret = this->processing(block, addr);
+    if (ret == triton::arch::NO_FAULT && compiled == nullptr)
+      this->compileBasicBlock(block, addr);
+
+    return ret;
+    #endif
+    throw triton::exceptions::Context("Context::processingJit(): Triton not built with LLVM");
+  }
+
+
+  triton::usize Context::getJitCacheSize(void) const {
+    this->checkLifting();
+    #ifdef TRITON_LLVM_INTERFACE
+    return this->lifting->getCompiledBlocksSize();
+    #endif
+    throw triton::exceptions::Context("Context::getJitCacheSize(): Triton not built with LLVM");
+  }
+
+
+  void Context::clearJitCache(void) {
+    this->checkLifting();
+    #ifdef TRITON_LLVM_INTERFACE
+    this->lifting->clearCompiledBlocks();
+    #endif
+  }
+
 }; /* triton namespace */
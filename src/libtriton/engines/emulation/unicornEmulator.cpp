@@ -0,0 +1,499 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include <unicorn/unicorn.h>
+
+#include <triton/exceptions.hpp>
+#include <triton/externalLibs.hpp>
+#include <triton/instruction.hpp>
+#include <triton/unicornEmulator.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace emulation {
+
+      /* The flags of eflags <bit : register> */
+      static const std::pair<triton::uint32, triton::arch::register_e> eflagsBits[] = {
+        {0,  triton::arch::ID_REG_X86_CF},
+        {2,  triton::arch::ID_REG_X86_PF},
+        {4,  triton::arch::ID_REG_X86_AF},
+        {6,  triton::arch::ID_REG_X86_ZF},
+        {7,  triton::arch::ID_REG_X86_SF},
+        {8,  triton::arch::ID_REG_X86_TF},
+        {9,  triton::arch::ID_REG_X86_IF},
+        {10, triton::arch::ID_REG_X86_DF},
+        {11, triton::arch::ID_REG_X86_OF},
+        {14, triton::arch::ID_REG_X86_NT},
+        {16, triton::arch::ID_REG_X86_RF},
+        {17, triton::arch::ID_REG_X86_VM},
+        {18, triton::arch::ID_REG_X86_AC},
+        {19, triton::arch::ID_REG_X86_VIF},
+        {20, triton::arch::ID_REG_X86_VIP},
+        {21, triton::arch::ID_REG_X86_ID},
+      };
+
+
+      UnicornEmulator::UnicornEmulator(triton::Context& ctx)
+        : ctx(ctx),
+          specs(triton::arch::ARCH_X86_64),
+          uc(nullptr),
+          handle(0),
+          current(0),
+          executing(false),
+          touched(false),
+          currentRegisters(nullptr),
+          executed(0),
+          processed(0),
+          fetchCallback([this](triton::Context& ctx, const triton::arch::MemoryAccess& mem) { this->fetchMemory(ctx, mem); }, this) {
+
+        if (ctx.getArchitecture() != triton::arch::ARCH_X86_64)
+          throw triton::exceptions::Engines("UnicornEmulator::UnicornEmulator(): Only the x86-64 architecture is supported.");
+
+        if (uc_open(UC_ARCH_X86, UC_MODE_64, &this->uc) != UC_ERR_OK)
+          throw triton::exceptions::Engines("UnicornEmulator::UnicornEmulator(): Cannot open Unicorn.");
+
+        triton::extlibs::capstone::csh cs = 0;
+        if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_X86, triton::extlibs::capstone::CS_MODE_64, &cs) != triton::extlibs::capstone::CS_ERR_OK) {
+          uc_close(this->uc);
+          throw triton::exceptions::Engines("UnicornEmulator::UnicornEmulator(): Cannot open capstone.");
+        }
+        triton::extlibs::capstone::cs_option(cs, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
+        this->handle = cs;
+
+        this->initRegisters();
+
+        /* The hooks on every address */
+        uc_hook code = 0, memory = 0;
+        uc_hook_add(this->uc, &code, UC_HOOK_CODE, reinterpret_cast<void*>(UnicornEmulator::hookCode), this, 1, 0);
+        uc_hook_add(this->uc, &memory, UC_HOOK_MEM_READ | UC_HOOK_MEM_WRITE, reinterpret_cast<void*>(UnicornEmulator::hookMemory), this, 1, 0);
+        this->hooks = {code, memory};
+
+        this->ctx.addCallback(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, this->fetchCallback);
+      }
+
+
+      UnicornEmulator::~UnicornEmulator() {
+        triton::extlibs::capstone::csh cs = this->handle;
+
+        this->ctx.removeCallback(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, this->fetchCallback);
+        for (triton::usize hook : this->hooks)
+          uc_hook_del(this->uc, hook);
+        uc_close(this->uc);
+        triton::extlibs::capstone::cs_close(&cs);
+      }
+
+
+      void UnicornEmulator::initRegisters(void) {
+        static const std::pair<triton::arch::register_e, int> gprs[] = {
+          {triton::arch::ID_REG_X86_RAX,    UC_X86_REG_RAX},
+          {triton::arch::ID_REG_X86_RBX,    UC_X86_REG_RBX},
+          {triton::arch::ID_REG_X86_RCX,    UC_X86_REG_RCX},
+          {triton::arch::ID_REG_X86_RDX,    UC_X86_REG_RDX},
+          {triton::arch::ID_REG_X86_RDI,    UC_X86_REG_RDI},
+          {triton::arch::ID_REG_X86_RSI,    UC_X86_REG_RSI},
+          {triton::arch::ID_REG_X86_RBP,    UC_X86_REG_RBP},
+          {triton::arch::ID_REG_X86_RSP,    UC_X86_REG_RSP},
+          {triton::arch::ID_REG_X86_RIP,    UC_X86_REG_RIP},
+          {triton::arch::ID_REG_X86_R8,     UC_X86_REG_R8},
+          {triton::arch::ID_REG_X86_R9,     UC_X86_REG_R9},
+          {triton::arch::ID_REG_X86_R10,    UC_X86_REG_R10},
+          {triton::arch::ID_REG_X86_R11,    UC_X86_REG_R11},
+          {triton::arch::ID_REG_X86_R12,    UC_X86_REG_R12},
+          {triton::arch::ID_REG_X86_R13,    UC_X86_REG_R13},
+          {triton::arch::ID_REG_X86_R14,    UC_X86_REG_R14},
+          {triton::arch::ID_REG_X86_R15,    UC_X86_REG_R15},
+          {triton::arch::ID_REG_X86_EFLAGS, UC_X86_REG_EFLAGS},
+          {triton::arch::ID_REG_X86_FS,     UC_X86_REG_FS_BASE},
+          {triton::arch::ID_REG_X86_GS,     UC_X86_REG_GS_BASE},
+        };
+
+        for (const auto& gpr : gprs)
+          this->syncRegisters.push_back({&this->ctx.getRegister(gpr.first), gpr.second});
+
+        /* Only the lower 128 bits of the SSE registers */
+        for (triton::uint32 i = 0; i < 16; i++) {
+          auto id = static_cast<triton::arch::register_e>(triton::arch::ID_REG_X86_XMM0 + i);
+          this->syncRegisters.push_back({&this->ctx.getRegister(id), UC_X86_REG_XMM0 + static_cast<int>(i)});
+        }
+
+        /* Indexed by the parent register, a xmm register being the one of its zmm */
+        this->syncIndex.assign(triton::arch::ID_REG_LAST_ITEM, -1);
+        for (triton::uint32 index = 0; index < this->syncRegisters.size(); index++)
+          this->syncIndex[this->syncRegisters[index].reg->getParent()] = static_cast<triton::sint32>(index);
+      }
+
+
+      const UnicornEmulator::InstructionRegisters& UnicornEmulator::getInstructionRegisters(triton::uint64 addr, triton::uint32 size) {
+        std::vector<triton::uint8> opcode(size);
+
+        if (uc_mem_read(this->uc, addr, opcode.data(), size) != UC_ERR_OK)
+          throw triton::exceptions::Engines("UnicornEmulator::getInstructionRegisters(): Cannot read the instruction.");
+
+        /* The entry is kept as long as the code is not modified */
+        auto it = this->instructions.find(addr);
+        if (it != this->instructions.end() && it->second.opcode == opcode)
+          return it->second;
+
+        InstructionRegisters& entry = this->instructions[addr];
+        entry.opcode      = std::move(opcode);
+        entry.unsupported = false;
+        entry.reads.clear();
+        entry.writes.clear();
+
+        triton::extlibs::capstone::cs_insn* insn = nullptr;
+        triton::extlibs::capstone::csh cs = this->handle;
+        triton::usize count = triton::extlibs::capstone::cs_disasm(cs, entry.opcode.data(), size, addr, 1, &insn);
+
+        /* Neither capstone nor the semantics know it */
+        if (count == 0) {
+          entry.unsupported = true;
+          return entry;
+        }
+
+        triton::extlibs::capstone::cs_regs regsRead, regsWrite;
+        triton::uint8 readCount = 0, writeCount = 0;
+        if (triton::extlibs::capstone::cs_regs_access(cs, insn, regsRead, &readCount, regsWrite, &writeCount) != triton::extlibs::capstone::CS_ERR_OK)
+          entry.unsupported = true;
+
+        for (triton::uint32 i = 0; i < readCount; i++) {
+          triton::arch::register_e id = this->specs.capstoneRegisterToTritonRegister(regsRead[i]);
+          if (id == triton::arch::ID_REG_INVALID) {
+            entry.unsupported = true;
+            continue;
+          }
+
+          const triton::arch::Register& reg = this->ctx.getRegister(id);
+          triton::sint32 index = this->syncIndex[reg.getParent()];
+          if (index < 0 || reg.getHigh() > this->syncRegisters[index].reg->getHigh()) {
+            entry.unsupported = true;
+            continue;
+          }
+
+          if (std::find(entry.reads.begin(), entry.reads.end(), static_cast<triton::uint32>(index)) == entry.reads.end())
+            entry.reads.push_back(static_cast<triton::uint32>(index));
+        }
+
+        for (triton::uint32 i = 0; i < writeCount; i++) {
+          triton::arch::register_e id = this->specs.capstoneRegisterToTritonRegister(regsWrite[i]);
+          if (id == triton::arch::ID_REG_INVALID)
+            continue;
+
+          entry.writes.push_back(id);
+          if (id == triton::arch::ID_REG_X86_EFLAGS) {
+            for (const auto& flag : eflagsBits)
+              entry.writes.push_back(flag.second);
+          }
+        }
+
+        triton::extlibs::capstone::cs_free(insn, count);
+
+        return entry;
+      }
+
+
+      bool UnicornEmulator::isTouched(triton::arch::register_e id) const {
+        const triton::arch::Register& reg = this->ctx.getRegister(id);
+
+        if (this->ctx.isRegisterSymbolized(reg) || this->ctx.isRegisterTainted(reg))
+          return true;
+
+        if (id == triton::arch::ID_REG_X86_EFLAGS) {
+          for (const auto& flag : eflagsBits) {
+            if (this->isTouched(flag.second))
+              return true;
+          }
+        }
+
+        return false;
+      }
+
+
+      triton::uint512 UnicornEmulator::readRegister(const SyncRegister& reg) const {
+        triton::uint8 bytes[triton::size::dqword] = {0};
+        triton::uint512 value = 0;
+
+        uc_reg_read(this->uc, reg.ucReg, bytes);
+        for (triton::uint32 i = reg.reg->getSize(); i > 0; i--)
+          value = (value << 8) | bytes[i - 1];
+
+        return value;
+      }
+
+
+      void UnicornEmulator::writeRegister(const SyncRegister& reg, const triton::uint512& value) {
+        triton::uint8 bytes[triton::size::dqword] = {0};
+
+        for (triton::uint32 i = 0; i < reg.reg->getSize(); i++)
+          bytes[i] = static_cast<triton::uint8>((value >> (i * 8)) & 0xff);
+
+        uc_reg_write(this->uc, reg.ucReg, bytes);
+      }
+
+
+      void UnicornEmulator::fetchMemory(triton::Context& ctx, const triton::arch::MemoryAccess& mem) {
+        triton::uint64 addr = mem.getAddress();
+        triton::uint32 size = mem.getSize();
+
+        if (ctx.isConcreteMemoryValueDefined(addr, size))
+          return;
+
+        /* The bytes of Unicorn, from before the writes of the instruction being executed */
+        std::vector<triton::uint8> bytes(size);
+        if (uc_mem_read(this->uc, addr, bytes.data(), size) != UC_ERR_OK)
+          return;
+
+        for (const auto& write : this->writes) {
+          for (triton::uint32 i = 0; i < write.previous.size(); i++) {
+            triton::uint64 byte = write.addr + i;
+            if (byte >= addr && byte < addr + size)
+              bytes[byte - addr] = write.previous[i];
+          }
+        }
+
+        for (triton::uint32 i = 0; i < size; i++) {
+          if (!ctx.isConcreteMemoryValueDefined(addr + i))
+            ctx.getCpuInstance()->setConcreteMemoryValue(addr + i, bytes[i], false);
+        }
+      }
+
+
+      void UnicornEmulator::finish(void) {
+        if (!this->executing)
+          return;
+
+        this->executing = false;
+        this->executed++;
+
+        if (this->touched) {
+          if (this->currentRegisters->unsupported)
+            throw triton::exceptions::Engines("UnicornEmulator::finish(): The instruction reads a register which is not synchronized.");
+
+          /* The semantics run on the state from before the instruction */
+          triton::arch::CpuInterface* cpu = this->ctx.getCpuInstance();
+          for (triton::uint32 i = 0; i < this->currentRegisters->reads.size(); i++) {
+            const SyncRegister& reg = this->syncRegisters[this->currentRegisters->reads[i]];
+            cpu->setConcreteRegisterValue(*reg.reg, this->readValues[i], false);
+            if (reg.reg->getId() == triton::arch::ID_REG_X86_EFLAGS) {
+              for (const auto& flag : eflagsBits)
+                cpu->setConcreteRegisterValue(this->ctx.getRegister(flag.second), (this->readValues[i] >> flag.first) & 1, false);
+            }
+          }
+
+          triton::arch::Instruction inst(this->current, this->currentRegisters->opcode.data(), static_cast<triton::uint32>(this->currentRegisters->opcode.size()));
+          this->ctx.processing(inst);
+          this->processed++;
+        }
+
+        else {
+          /* Keeps up to date the bytes the Context defines, and drops what is overwritten */
+          for (const auto& write : this->writes) {
+            triton::uint32 size = static_cast<triton::uint32>(write.previous.size());
+            std::vector<triton::uint8> bytes(size);
+            bool symbolized = this->ctx.isMemorySymbolized(write.addr, size);
+            bool tainted    = this->ctx.isMemoryTainted(write.addr, size);
+
+            uc_mem_read(this->uc, write.addr, bytes.data(), size);
+            for (triton::uint32 i = 0; i < size; i++) {
+              if (this->ctx.isConcreteMemoryValueDefined(write.addr + i))
+                this->ctx.getCpuInstance()->setConcreteMemoryValue(write.addr + i, bytes[i], false);
+              if (symbolized)
+                this->ctx.concretizeMemory(write.addr + i);
+              if (tainted)
+                this->ctx.untaintMemory(write.addr + i);
+            }
+          }
+
+          for (triton::arch::register_e id : this->currentRegisters->writes) {
+            const triton::arch::Register& reg = this->ctx.getRegister(id);
+            if (this->ctx.isRegisterSymbolized(reg))
+              this->ctx.concretizeRegister(reg);
+            if (this->ctx.isRegisterTainted(reg))
+              this->ctx.untaintRegister(reg);
+          }
+        }
+
+        this->writes.clear();
+        this->currentRegisters = nullptr;
+      }
+
+
+      void UnicornEmulator::hookCode(uc_struct* uc, triton::uint64 addr, triton::uint32 size, void* user) {
+        UnicornEmulator* self = static_cast<UnicornEmulator*>(user);
+
+        /* The exceptions must not go through Unicorn */
+        try {
+          self->finish();
+
+          self->current          = addr;
+          self->executing        = true;
+          self->touched          = false;
+          self->currentRegisters = &self->getInstructionRegisters(addr, size);
+
+          const InstructionRegisters& regs = *self->currentRegisters;
+          for (triton::uint32 index : regs.reads)
+            self->touched |= self->isTouched(self->syncRegisters[index].reg->getId());
+
+          /* A partial write of a symbolized or tainted register keeps the rest of it */
+          for (triton::arch::register_e id : regs.writes) {
+            const triton::arch::Register& reg = self->ctx.getRegister(id);
+            const triton::arch::Register& parent = self->ctx.getRegister(reg.getParent());
+            bool partial = reg.getSize() < parent.getSize() && !(reg.getSize() == triton::size::dword && parent.getSize() == triton::size::qword);
+            if (partial && self->isTouched(id))
+              self->touched = true;
+          }
+
+          self->readValues.clear();
+          for (triton::uint32 index : regs.reads)
+            self->readValues.push_back(self->readRegister(self->syncRegisters[index]));
+        }
+        catch (...) {
+          self->error     = std::current_exception();
+          self->executing = false;
+          uc_emu_stop(uc);
+        }
+      }
+
+
+      void UnicornEmulator::hookMemory(uc_struct* uc, int type, triton::uint64 addr, int size, triton::sint64 value, void* user) {
+        UnicornEmulator* self = static_cast<UnicornEmulator*>(user);
+
+        if (!self->executing)
+          return;
+
+        try {
+          if (type == UC_MEM_READ) {
+            if (self->ctx.isMemorySymbolized(addr, size) || self->ctx.isMemoryTainted(addr, size))
+              self->touched = true;
+          }
+
+          /* The hook runs before the write */
+          else if (type == UC_MEM_WRITE) {
+            PendingWrite write = {addr, std::vector<triton::uint8>(size)};
+            uc_mem_read(uc, addr, write.previous.data(), size);
+            self->writes.push_back(std::move(write));
+          }
+        }
+        catch (...) {
+          self->error     = std::current_exception();
+          self->executing = false;
+          uc_emu_stop(uc);
+        }
+      }
+
+
+      triton::usize UnicornEmulator::run(triton::uint64 start, triton::uint64 stop, triton::usize count) {
+        this->executed  = 0;
+        this->processed = 0;
+        this->executing = false;
+        this->error     = nullptr;
+
+        uc_err err = uc_emu_start(this->uc, start, stop, 0, count);
+
+        if (this->error) {
+          this->writes.clear();
+          std::rethrow_exception(this->error);
+        }
+
+        /* The last instruction executed */
+        this->finish();
+
+        if (err != UC_ERR_OK)
+          throw triton::exceptions::Engines(std::string("UnicornEmulator::run(): ") + uc_strerror(err));
+
+        return this->executed;
+      }
+
+
+      void UnicornEmulator::mapMemory(triton::uint64 addr, triton::usize size) {
+        triton::uint64 base = addr & ~0xfffULL;
+        triton::uint64 end  = (addr + size + 0xfff) & ~0xfffULL;
+
+        if (uc_mem_map(this->uc, base, end - base, UC_PROT_ALL) != UC_ERR_OK)
+          throw triton::exceptions::Engines("UnicornEmulator::mapMemory(): Cannot map the memory.");
+      }
+
+
+      void UnicornEmulator::setMemoryAreaValue(triton::uint64 addr, const std::vector<triton::uint8>& values) {
+        if (uc_mem_write(this->uc, addr, values.data(), values.size()) != UC_ERR_OK)
+          throw triton::exceptions::Engines("UnicornEmulator::setMemoryAreaValue(): Cannot write the memory.");
+
+        for (triton::usize i = 0; i < values.size(); i++) {
+          if (this->ctx.isConcreteMemoryValueDefined(addr + i))
+            this->ctx.setConcreteMemoryValue(addr + i, values[i]);
+        }
+      }
+
+
+      void UnicornEmulator::synchronizeToUnicorn(triton::uint64 addr, triton::usize size) {
+        /* The runs of defined bytes */
+        for (triton::usize i = 0; i < size;) {
+          if (!this->ctx.isConcreteMemoryValueDefined(addr + i)) {
+            i++;
+            continue;
+          }
+
+          triton::usize end = i;
+          while (end < size && this->ctx.isConcreteMemoryValueDefined(addr + end))
+            end++;
+
+          std::vector<triton::uint8> values = this->ctx.getConcreteMemoryAreaValue(addr + i, end - i, false);
+          if (uc_mem_write(this->uc, addr + i, values.data(), values.size()) != UC_ERR_OK)
+            throw triton::exceptions::Engines("UnicornEmulator::synchronizeToUnicorn(): Cannot write the memory.");
+          i = end;
+        }
+
+        for (const auto& reg : this->syncRegisters) {
+          triton::uint512 value = this->ctx.getConcreteRegisterValue(*reg.reg, false);
+
+          /* The flags are kept apart from eflags by the semantics */
+          if (reg.reg->getId() == triton::arch::ID_REG_X86_EFLAGS) {
+            for (const auto& flag : eflagsBits) {
+              triton::uint512 bit = triton::uint512(1) << flag.first;
+              if (this->ctx.getConcreteRegisterValue(this->ctx.getRegister(flag.second), false) != 0)
+                value |= bit;
+              else
+                value &= ~bit;
+            }
+          }
+
+          this->writeRegister(reg, value);
+        }
+      }
+
+
+      void UnicornEmulator::synchronizeToContext(void) {
+        triton::arch::CpuInterface* cpu = this->ctx.getCpuInstance();
+
+        for (const auto& reg : this->syncRegisters) {
+          triton::uint512 value = this->readRegister(reg);
+          cpu->setConcreteRegisterValue(*reg.reg, value, false);
+          if (reg.reg->getId() == triton::arch::ID_REG_X86_EFLAGS) {
+            for (const auto& flag : eflagsBits)
+              cpu->setConcreteRegisterValue(this->ctx.getRegister(flag.second), (value >> flag.first) & 1, false);
+          }
+        }
+      }
+
+
+      triton::usize UnicornEmulator::getExecutedCount(void) const {
+        return this->executed;
+      }
+
+
+      triton::usize UnicornEmulator::getProcessedCount(void) const {
+        return this->processed;
+      }
+
+    }; /* emulation namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
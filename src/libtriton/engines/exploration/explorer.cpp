@@ -0,0 +1,474 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <thread>
+
+#include <triton/exceptions.hpp>
+#include <triton/explorer.hpp>
+#include <triton/solverEnums.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace exploration {
+
+      /* The task of no deferred flip */
+      static constexpr triton::usize NO_FLIP = static_cast<triton::usize>(-1);
+
+
+      /* Returns the AFL bucket of a hit count */
+      static triton::uint8 getBucket(triton::uint8 count) {
+        if (count <= 3)   return static_cast<triton::uint8>(1 << (count - 1));
+        if (count <= 7)   return 8;
+        if (count <= 15)  return 16;
+        if (count <= 31)  return 32;
+        if (count <= 127) return 64;
+        return 128;
+      }
+
+
+      /* Returns the hash of an address in the edge bitmap */
+      static triton::usize getLocation(triton::uint64 addr) {
+        addr ^= addr >> 33;
+        addr *= 0xff51afd7ed558ccdULL;
+        addr ^= addr >> 33;
+        return static_cast<triton::usize>(addr) & (Explorer::edgeMapSize - 1);
+      }
+
+
+      std::vector<triton::uint8> applyModel(const std::vector<triton::uint8>& input,
+                                            const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables,
+                                            const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model) {
+        std::vector<triton::uint8> ret = input;
+        triton::usize offset = 0;
+
+        for (const auto& var : variables) {
+          triton::usize size = std::max<triton::usize>(var->getSize() / 8, 1);
+          auto it = model.find(var->getId());
+          if (it != model.end()) {
+            triton::uint512 value = it->second.getValue();
+            for (triton::usize i = 0; i < size && offset + i < ret.size(); i++)
+              ret[offset + i] = static_cast<triton::uint8>((value >> (i * 8)) & 0xff);
+          }
+          offset += size;
+        }
+
+        return ret;
+      }
+
+
+      Explorer::Explorer(const SetupHook& setup, const InjectHook& inject)
+        : setup(setup),
+          inject(inject),
+          scheduler(SCHEDULER_DFS),
+          workers(0),
+          maxRuns(0),
+          maxInstructions(1000000),
+          timeout(0),
+          maxDepth(0),
+          sequence(0),
+          pending(0),
+          queued(0),
+          stopping(false),
+          runs(0) {
+        if (!this->setup || !this->inject)
+          throw triton::exceptions::Engines("Explorer::Explorer(): The setup and inject hooks must be defined.");
+      }
+
+
+      void Explorer::setTerminationHook(const TerminationHook& hook) {
+        this->termination = hook;
+      }
+
+
+      void Explorer::setInputHook(const InputHook& hook) {
+        this->inputHook = hook;
+      }
+
+
+      void Explorer::setWorkers(triton::usize count) {
+        this->workers = count;
+      }
+
+
+      void Explorer::setMaxRuns(triton::usize count) {
+        this->maxRuns = count;
+      }
+
+
+      void Explorer::setMaxInstructions(triton::usize count) {
+        this->maxInstructions = count;
+      }
+
+
+      void Explorer::setTimeout(triton::uint32 ms) {
+        this->timeout = ms;
+      }
+
+
+      void Explorer::setScheduler(triton::engines::exploration::scheduler_e scheduler) {
+        switch (scheduler) {
+          case SCHEDULER_DFS:
+          case SCHEDULER_COVERAGE:
+          case SCHEDULER_BFS:
+          case SCHEDULER_COST:
+          case SCHEDULER_CUSTOM:
+            this->scheduler = scheduler;
+            break;
+          default:
+            throw triton::exceptions::Engines("Explorer::setScheduler(): Invalid scheduler.");
+        }
+      }
+
+
+      void Explorer::setPriorityHook(const PriorityHook& hook) {
+        this->priorityHook = hook;
+      }
+
+
+      void Explorer::setMaxDepth(triton::usize depth) {
+        this->maxDepth = depth;
+      }
+
+
+      double Explorer::getPriority(const TaskInfo& info) const {
+        switch (this->scheduler) {
+          case SCHEDULER_COVERAGE:
+            return static_cast<double>(info.edges);
+          case SCHEDULER_BFS:
+            return -static_cast<double>(info.depth);
+          case SCHEDULER_COST:
+            return -static_cast<double>(info.cost);
+          case SCHEDULER_CUSTOM:
+            return this->priorityHook ? this->priorityHook(info) : 0.0;
+          default:
+            return 0.0;
+        }
+      }
+
+
+      void Explorer::push(triton::usize worker, Task&& task) {
+        if (this->scheduler != SCHEDULER_DFS) {
+          {
+            std::lock_guard<std::mutex> guard(this->lock);
+            task.priority = this->getPriority(task.info);
+            task.sequence = this->sequence++;
+            this->heap.push_back(std::move(task));
+            std::push_heap(this->heap.begin(), this->heap.end(), TaskOrder());
+            this->pending++;
+            this->queued++;
+          }
+          this->changed.notify_one();
+          return;
+        }
+
+        {
+          std::lock_guard<std::mutex> guard(this->queues[worker]->lock);
+          this->queues[worker]->tasks.push_back(std::move(task));
+        }
+        {
+          std::lock_guard<std::mutex> guard(this->lock);
+          this->pending++;
+          this->queued++;
+        }
+        this->changed.notify_one();
+      }
+
+
+      bool Explorer::take(triton::usize worker, Task& task) {
+        while (true) {
+          bool found = false;
+
+          /* The task of the highest priority of the shared queue */
+          if (this->scheduler != SCHEDULER_DFS) {
+            std::lock_guard<std::mutex> guard(this->lock);
+            if (!this->heap.empty()) {
+              std::pop_heap(this->heap.begin(), this->heap.end(), TaskOrder());
+              task = std::move(this->heap.back());
+              this->heap.pop_back();
+              found = true;
+            }
+          }
+
+          /* The last task of its own queue, the most recent inputs being explored first */
+          else {
+            Queue& queue = *this->queues[worker];
+            std::lock_guard<std::mutex> guard(queue.lock);
+            if (!queue.tasks.empty()) {
+              task = std::move(queue.tasks.back());
+              queue.tasks.pop_back();
+              found = true;
+            }
+          }
+
+          /* Otherwise the first task of another queue, the oldest one */
+          for (triton::usize i = 1; !found && this->scheduler == SCHEDULER_DFS && i < this->queues.size(); i++) {
+            Queue& queue = *this->queues[(worker + i) % this->queues.size()];
+            std::lock_guard<std::mutex> guard(queue.lock);
+            if (!queue.tasks.empty()) {
+              task = std::move(queue.tasks.front());
+              queue.tasks.pop_front();
+              found = true;
+            }
+          }
+
+          std::unique_lock<std::mutex> guard(this->lock);
+          if (found) {
+            this->queued--;
+            if (!task.info.deferred && this->maxRuns != 0 && this->runs >= this->maxRuns)
+              this->stopping = true;
+            if (this->stopping) {
+              this->pending--;
+              this->changed.notify_all();
+              return false;
+            }
+            /* A deferred flip runs an input again, it is not a new run */
+            if (!task.info.deferred)
+              this->runs++;
+            return true;
+          }
+
+          if (this->stopping || this->pending == 0)
+            return false;
+
+          /* A task pushed but not yet visible is taken again */
+          if (this->queued > 0)
+            continue;
+
+          this->changed.wait(guard, [this] { return this->stopping || this->pending == 0 || this->queued > 0; });
+        }
+      }
+
+
+      void Explorer::finish(void) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        if (--this->pending == 0)
+          this->changed.notify_all();
+      }
+
+
+      void Explorer::run(triton::usize worker, triton::Context& ctx, const Task& task, std::vector<triton::uint8>& trace) {
+        const triton::arch::Register& pc = ctx.getCpuInstance()->getProgramCounter();
+        std::vector<triton::uint64> addresses;
+        std::vector<triton::usize> touched;
+        triton::usize previous = 0;
+
+        auto variables = this->inject(ctx, task.input);
+
+        /* The concolic execution of the input */
+        for (triton::usize count = 0; count < this->maxInstructions; count++) {
+          triton::uint64 addr = static_cast<triton::uint64>(ctx.getConcreteRegisterValue(pc));
+          std::vector<triton::uint8> opcode = ctx.getConcreteMemoryAreaValue(addr, 16);
+          triton::arch::Instruction inst(addr, opcode.data(), static_cast<triton::uint32>(opcode.size()));
+
+          if (ctx.processing(inst) != triton::arch::NO_FAULT)
+            break;
+
+          addresses.push_back(addr);
+
+          /* The edge to the next instruction, its hit count saturating */
+          if (inst.isControlFlow()) {
+            triton::usize location = getLocation(static_cast<triton::uint64>(ctx.getConcreteRegisterValue(pc)));
+            triton::usize index = location ^ previous;
+            if (trace[index] == 0)
+              touched.push_back(index);
+            if (trace[index] != 0xff)
+              trace[index]++;
+            previous = location >> 1;
+          }
+
+          if (this->termination && this->termination(ctx, inst))
+            break;
+        }
+
+        /* The flips to solve now, and the ones deferred */
+        std::vector<std::pair<triton::usize, triton::ast::SharedAbstractNode>> flips;
+        std::vector<std::pair<triton::uint64, triton::usize>> costs;
+        std::vector<Task> deferred;
+        triton::usize edges = 0;
+        {
+          std::lock_guard<std::mutex> guard(this->lock);
+          bool covered = false;
+
+          /* The coverage of the instructions and of the edges */
+          for (triton::uint64 addr : addresses)
+            covered |= this->coverage.insert(addr).second;
+
+          for (triton::usize index : touched) {
+            triton::uint8 bucket = getBucket(trace[index]);
+            if ((this->edges[index] & bucket) == 0) {
+              this->edges[index] |= bucket;
+              edges++;
+            }
+            trace[index] = 0;
+          }
+          covered |= (edges != 0);
+
+          if (!task.info.deferred) {
+            this->inputs.push_back(task.input);
+            if (this->inputHook && !this->inputHook(task.input, covered)) {
+              this->stopping = true;
+              this->changed.notify_all();
+            }
+          }
+
+          if (this->stopping)
+            return;
+
+          const auto& pcs = ctx.getPathConstraints();
+          triton::usize limit = this->maxDepth ? std::min(this->maxDepth, pcs.size()) : pcs.size();
+          triton::usize cost = 0;
+
+          for (triton::usize index = 0; index < limit; index++) {
+            const auto& branches = pcs[index].getBranchConstraints();
+            if (branches.empty())
+              continue;
+
+            /* The timeouts of the queries of the sources up to this branch */
+            auto it = this->timeouts.find(std::get<1>(branches.front()));
+            if (it != this->timeouts.end())
+              cost += it->second;
+
+            if (task.info.deferred) {
+              if (index != task.flip)
+                continue;
+              for (const auto& branch : branches) {
+                if (std::get<0>(branch) == false && task.edge == std::make_pair(std::get<1>(branch), std::get<2>(branch))) {
+                  flips.emplace_back(index, std::get<3>(branch));
+                  costs.emplace_back(std::get<1>(branch), task.info.cost);
+                }
+              }
+              break;
+            }
+
+            if (index < task.info.bound)
+              continue;
+
+            for (const auto& branch : branches) {
+              if (std::get<0>(branch) == true || !this->flipped.emplace(std::get<1>(branch), std::get<2>(branch)).second)
+                continue;
+
+              /* A flip behind a timed out query waits for the others */
+              if (this->scheduler == SCHEDULER_COST && cost != 0) {
+                Task later{task.input, {task.info.depth, task.info.bound, edges, cost, true}, index, {std::get<1>(branch), std::get<2>(branch)}, 0.0, 0};
+                deferred.push_back(std::move(later));
+                continue;
+              }
+
+              flips.emplace_back(index, std::get<3>(branch));
+              costs.emplace_back(std::get<1>(branch), cost);
+            }
+          }
+        }
+
+        for (auto& later : deferred)
+          this->push(worker, std::move(later));
+
+        /* Each model is a new input, its branches up to the flipped one being explored */
+        for (triton::usize f = 0; f < flips.size(); f++) {
+          const auto& flip = flips[f];
+          triton::engines::solver::status_e status;
+          auto model = ctx.getModelOfPath(flip.first, flip.second, &status, this->timeout);
+
+          if (status == triton::engines::solver::TIMEOUT) {
+            std::lock_guard<std::mutex> guard(this->lock);
+            this->timeouts[costs[f].first]++;
+          }
+
+          if (status != triton::engines::solver::SAT)
+            continue;
+
+          Task child{applyModel(task.input, variables, model), {task.info.depth + 1, flip.first + 1, edges, costs[f].second, false}, NO_FLIP, {0, 0}, 0.0, 0};
+          this->push(worker, std::move(child));
+        }
+      }
+
+
+      void Explorer::work(triton::usize worker, triton::uint64 entry) {
+        try {
+          triton::Context ctx;
+          this->setup(ctx);
+
+          /* Each run starts from the state of the setup */
+          const triton::arch::Register& pc = ctx.getCpuInstance()->getProgramCounter();
+          ctx.setConcreteRegisterValue(pc, entry);
+          triton::usize snapshot = ctx.snapshot();
+
+          std::vector<triton::uint8> trace(edgeMapSize, 0);
+          Task task;
+          while (this->take(worker, task)) {
+            ctx.restore(snapshot);
+            ctx.clearPathConstraints();
+            this->run(worker, ctx, task, trace);
+            this->finish();
+          }
+        }
+        catch (...) {
+          std::lock_guard<std::mutex> guard(this->lock);
+          if (!this->error)
+            this->error = std::current_exception();
+          this->stopping = true;
+          this->changed.notify_all();
+        }
+      }
+
+
+      triton::usize Explorer::explore(triton::uint64 entry, const std::vector<triton::uint8>& input) {
+        triton::usize count = this->workers ? this->workers : std::max<triton::usize>(std::thread::hardware_concurrency(), 1);
+
+        this->queues.clear();
+        for (triton::usize i = 0; i < count; i++)
+          this->queues.emplace_back(new Queue);
+
+        this->pending  = 0;
+        this->queued   = 0;
+        this->sequence = 0;
+        this->stopping = false;
+        this->runs     = 0;
+        this->error    = nullptr;
+        this->heap.clear();
+        this->coverage.clear();
+        this->flipped.clear();
+        this->timeouts.clear();
+        this->inputs.clear();
+        this->edges.assign(edgeMapSize, 0);
+
+        this->push(0, Task{input, {0, 0, 0, 0, false}, NO_FLIP, {0, 0}, 0.0, 0});
+
+        std::vector<std::thread> pool;
+        for (triton::usize i = 0; i < count; i++)
+          pool.emplace_back(&Explorer::work, this, i, entry);
+
+        for (auto& thread : pool)
+          thread.join();
+
+        if (this->error)
+          std::rethrow_exception(this->error);
+
+        return this->runs;
+      }
+
+
+      const std::unordered_set<triton::uint64>& Explorer::getCoverage(void) const {
+        return this->coverage;
+      }
+
+
+      const std::vector<std::vector<triton::uint8>>& Explorer::getInputs(void) const {
+        return this->inputs;
+      }
+
+
+      triton::usize Explorer::getEdgeCount(void) const {
+        return static_cast<triton::usize>(std::count_if(this->edges.begin(), this->edges.end(), [](triton::uint8 bucket) { return bucket != 0; }));
+      }
+
+    }; /* exploration namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,202 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include <triton/exceptions.hpp>
+#include <triton/fuzzerSync.hpp>
+#include <triton/solverEnums.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace exploration {
+
+      /* Returns the id of a queue entry `id:NNNNNN,...`, or -1 if it is not one */
+      static triton::sint64 getEntryId(const std::string& name) {
+        if (name.compare(0, 3, "id:") != 0)
+          return -1;
+
+        triton::sint64 id = 0;
+        triton::usize index = 3;
+        for (; index < name.size() && name[index] >= '0' && name[index] <= '9'; index++)
+          id = id * 10 + (name[index] - '0');
+
+        return (index == 3) ? -1 : id;
+      }
+
+
+      FuzzerSync::FuzzerSync(const std::string& syncDir, const std::string& name, triton::uint64 entry, const SetupHook& setup, const InjectHook& inject)
+        : setup(setup),
+          inject(inject),
+          syncDir(syncDir),
+          name(name),
+          entry(entry),
+          snapshot(0),
+          threads(0),
+          timeout(0),
+          maxInstructions(1000000),
+          nextId(0) {
+        std::filesystem::path queue = std::filesystem::path(syncDir) / name / "queue";
+        std::error_code ec;
+
+        if (!this->setup || !this->inject)
+          throw triton::exceptions::Engines("FuzzerSync::FuzzerSync(): The setup and inject hooks must be defined.");
+
+        std::filesystem::create_directories(queue, ec);
+        if (ec)
+          throw triton::exceptions::Engines("FuzzerSync::FuzzerSync(): Cannot create " + queue.string() + ": " + ec.message());
+
+        /* A restarted instance goes on after its entries */
+        for (const auto& file : std::filesystem::directory_iterator(queue, ec)) {
+          triton::sint64 id = getEntryId(file.path().filename().string());
+          if (id >= 0)
+            this->nextId = std::max(this->nextId, static_cast<triton::usize>(id) + 1);
+        }
+      }
+
+
+      void FuzzerSync::setThreads(triton::usize count) {
+        this->threads = count;
+      }
+
+
+      void FuzzerSync::setTimeout(triton::uint32 ms) {
+        this->timeout = ms;
+      }
+
+
+      void FuzzerSync::setMaxInstructions(triton::usize count) {
+        this->maxInstructions = count;
+      }
+
+
+      void FuzzerSync::setStopAddresses(const std::unordered_set<triton::uint64>& addresses) {
+        this->stopAddresses = addresses;
+      }
+
+
+      void FuzzerSync::prepare(void) {
+        if (this->ctx)
+          return;
+
+        auto ctx = std::make_unique<triton::Context>();
+        this->setup(*ctx);
+        this->snapshot = ctx->snapshot();
+        this->ctx = std::move(ctx);
+      }
+
+
+      std::vector<std::vector<triton::uint8>> FuzzerSync::solve(const std::vector<triton::uint8>& input) {
+        std::vector<std::vector<triton::uint8>> ret;
+
+        this->prepare();
+        this->ctx->restore(this->snapshot);
+        this->ctx->clearPathConstraints();
+
+        auto variables = this->inject(*this->ctx, input);
+        this->ctx->run(this->entry, this->maxInstructions, this->stopAddresses);
+
+        for (const auto& pc : this->ctx->getPathConstraints()) {
+          for (const auto& branch : pc.getBranchConstraints()) {
+            if (std::get<0>(branch))
+              this->covered.emplace(std::get<1>(branch), std::get<2>(branch));
+          }
+        }
+
+        /* Only the edges no run took are solved, once */
+        this->ctx->solveAllBranchFlips(this->threads, this->timeout,
+          [&](const triton::engines::symbolic::BranchFlip& flip) {
+            if (flip.status == triton::engines::solver::SAT)
+              ret.push_back(applyModel(input, variables, flip.model));
+          },
+          [this](triton::uint64 srcAddr, triton::uint64 dstAddr) {
+            auto edge = std::make_pair(srcAddr, dstAddr);
+            return this->covered.find(edge) == this->covered.end() && this->flipped.insert(edge).second;
+          });
+
+        return ret;
+      }
+
+
+      void FuzzerSync::write(const std::vector<triton::uint8>& input, const std::string& source) {
+        std::filesystem::path dir = std::filesystem::path(this->syncDir) / this->name;
+        char id[32];
+
+        std::snprintf(id, sizeof(id), "id:%06zu", static_cast<size_t>(this->nextId));
+        std::string file = std::string(id) + ",src:" + source + ",op:triton";
+
+        /* The entry is complete once renamed into the queue */
+        std::filesystem::path tmp = dir / ("." + file);
+        {
+          std::ofstream out(tmp, std::ios::binary);
+          out.write(reinterpret_cast<const char*>(input.data()), static_cast<std::streamsize>(input.size()));
+          if (!out)
+            throw triton::exceptions::Engines("FuzzerSync::write(): Cannot write " + tmp.string() + ".");
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tmp, dir / "queue" / file, ec);
+        if (ec)
+          throw triton::exceptions::Engines("FuzzerSync::write(): Cannot rename " + tmp.string() + ": " + ec.message());
+
+        this->nextId++;
+      }
+
+
+      triton::usize FuzzerSync::sync(void) {
+        std::vector<std::pair<std::filesystem::path, std::string>> entries;
+        triton::usize count = 0;
+        std::error_code ec;
+
+        for (const auto& fuzzer : std::filesystem::directory_iterator(this->syncDir, ec)) {
+          std::string fuzzerName = fuzzer.path().filename().string();
+          if (fuzzerName == this->name || !fuzzer.is_directory())
+            continue;
+
+          std::error_code qec;
+          for (const auto& file : std::filesystem::directory_iterator(fuzzer.path() / "queue", qec)) {
+            std::string fileName = file.path().filename().string();
+            triton::sint64 id = getEntryId(fileName);
+            if (id < 0 || !file.is_regular_file() || !this->seen.insert(file.path().string()).second)
+              continue;
+            entries.emplace_back(file.path(), fuzzerName + ":" + fileName.substr(3, fileName.find(',') - 3));
+          }
+        }
+
+        if (ec)
+          throw triton::exceptions::Engines("FuzzerSync::sync(): Cannot read " + this->syncDir + ": " + ec.message());
+
+        /* The entries of a fuzzer are ingested in the order of its queue */
+        std::sort(entries.begin(), entries.end());
+
+        for (const auto& entry : entries) {
+          std::ifstream in(entry.first, std::ios::binary);
+          std::vector<triton::uint8> input((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+          for (const auto& solved : this->solve(input)) {
+            this->write(solved, entry.second);
+            count++;
+          }
+        }
+
+        return count;
+      }
+
+
+      triton::usize FuzzerSync::getCoveredCount(void) const {
+        return this->covered.size();
+      }
+
+    }; /* exploration namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,266 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <sstream>
+
+#include <triton/exceptions.hpp>
+#include <triton/liftingToBTOR2.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace lifters {
+
+      /* Returns the BTOR2 operator of the nodes whose children are the operands, nullptr if none */
+      static const char* getOperator(triton::ast::ast_e type) {
+        switch (type) {
+          case triton::ast::BVADD_NODE:     return "add";
+          case triton::ast::BVAND_NODE:     return "and";
+          case triton::ast::BVASHR_NODE:    return "sra";
+          case triton::ast::BVLSHR_NODE:    return "srl";
+          case triton::ast::BVMUL_NODE:     return "mul";
+          case triton::ast::BVNAND_NODE:    return "nand";
+          case triton::ast::BVNEG_NODE:     return "neg";
+          case triton::ast::BVNOR_NODE:     return "nor";
+          case triton::ast::BVNOT_NODE:     return "not";
+          case triton::ast::BVOR_NODE:      return "or";
+          case triton::ast::BVSDIV_NODE:    return "sdiv";
+          case triton::ast::BVSGE_NODE:     return "sgte";
+          case triton::ast::BVSGT_NODE:     return "sgt";
+          case triton::ast::BVSHL_NODE:     return "sll";
+          case triton::ast::BVSLE_NODE:     return "slte";
+          case triton::ast::BVSLT_NODE:     return "slt";
+          case triton::ast::BVSMOD_NODE:    return "smod";
+          case triton::ast::BVSREM_NODE:    return "srem";
+          case triton::ast::BVSUB_NODE:     return "sub";
+          case triton::ast::BVUDIV_NODE:    return "udiv";
+          case triton::ast::BVUGE_NODE:     return "ugte";
+          case triton::ast::BVUGT_NODE:     return "ugt";
+          case triton::ast::BVULE_NODE:     return "ulte";
+          case triton::ast::BVULT_NODE:     return "ult";
+          case triton::ast::BVUREM_NODE:    return "urem";
+          case triton::ast::BVXNOR_NODE:    return "xnor";
+          case triton::ast::BVXOR_NODE:     return "xor";
+          case triton::ast::DISTINCT_NODE:  return "neq";
+          case triton::ast::EQUAL_NODE:     return "eq";
+          case triton::ast::IFF_NODE:       return "iff";
+          case triton::ast::ITE_NODE:       return "ite";
+          case triton::ast::LNOT_NODE:      return "not";
+          case triton::ast::SELECT_NODE:    return "read";
+          case triton::ast::STORE_NODE:     return "write";
+          default:                          return nullptr;
+        }
+      }
+
+
+      LiftingToBTOR2::LiftingToBTOR2() {
+        this->uniqueId = 1;
+      }
+
+
+      triton::usize LiftingToBTOR2::getBvSort(std::ostream& stream, triton::uint32 size) {
+        auto it = this->bvSorts.find(size);
+        if (it != this->bvSorts.end())
+          return it->second;
+
+        return this->bvSorts[size] = this->print(stream, "sort bitvec " + std::to_string(size), 0, {});
+      }
+
+
+      triton::usize LiftingToBTOR2::getArraySort(std::ostream& stream, triton::uint32 size) {
+        auto it = this->arraySorts.find(size);
+        if (it != this->arraySorts.end())
+          return it->second;
+
+        triton::usize index = this->getBvSort(stream, size);
+        triton::usize value = this->getBvSort(stream, triton::bitsize::byte);
+        return this->arraySorts[size] = this->print(stream, "sort array", 0, {std::to_string(index), std::to_string(value)});
+      }
+
+
+      triton::usize LiftingToBTOR2::getSort(std::ostream& stream, const triton::ast::SharedAbstractNode& node) {
+        if (node->isArray())
+          return this->getArraySort(stream, triton::ast::getIndexSize(node));
+
+        if (node->isLogical())
+          return this->getBvSort(stream, 1);
+
+        return this->getBvSort(stream, node->getBitvectorSize());
+      }
+
+
+      triton::usize LiftingToBTOR2::print(std::ostream& stream, const std::string& op, triton::usize sid, const std::vector<std::string>& args) {
+        triton::usize nid = this->uniqueId++;
+
+        stream << nid << " " << op;
+        if (sid)
+          stream << " " << sid;
+        for (const auto& arg : args)
+          stream << " " << arg;
+        stream << std::endl;
+
+        return nid;
+      }
+
+
+      triton::usize LiftingToBTOR2::lift(std::ostream& stream, const triton::ast::SharedAbstractNode& node) {
+        const auto& children = node->getChildren();
+        std::vector<std::string> operands;
+
+        for (const auto& child : children) {
+          auto it = this->nids.find(child.get());
+          operands.push_back(it != this->nids.end() ? std::to_string(it->second) : "");
+        }
+
+        const char* op = getOperator(node->getType());
+        if (op != nullptr)
+          return this->print(stream, op, this->getSort(stream, node), operands);
+
+        switch (node->getType()) {
+          case triton::ast::ARRAY_NODE: {
+            /* The concrete cells are not kept, as by the solvers */
+            triton::usize sid   = this->getSort(stream, node);
+            triton::usize zero  = this->print(stream, "zero", this->getBvSort(stream, triton::bitsize::byte), {});
+            triton::usize state = this->print(stream, "state", sid, {"memory"});
+            this->print(stream, "init", sid, {std::to_string(state), std::to_string(zero)});
+            return state;
+          }
+
+          case triton::ast::BSWAP_NODE: {
+            triton::uint32 size = node->getBitvectorSize();
+            triton::usize sid   = this->getBvSort(stream, triton::bitsize::byte);
+            triton::usize value = 0;
+
+            /* The low byte becomes the high one */
+            for (triton::uint32 index = 0; index != size; index += triton::bitsize::byte) {
+              triton::usize byte = this->print(stream, "slice", sid, {operands[0], std::to_string(index + 7), std::to_string(index)});
+              if (index == 0)
+                value = byte;
+              else
+                value = this->print(stream, "concat", this->getBvSort(stream, index + triton::bitsize::byte), {std::to_string(value), std::to_string(byte)});
+            }
+            return value;
+          }
+
+          case triton::ast::BVROL_NODE:
+          case triton::ast::BVROR_NODE: {
+            triton::uint32 rot = triton::ast::getInteger<triton::uint32>(children[1]) % node->getBitvectorSize();
+            triton::usize sid  = this->getSort(stream, node);
+
+            if (rot == 0)
+              return this->nids.at(children[0].get());
+
+            triton::usize amount = this->print(stream, "constd", sid, {std::to_string(rot)});
+            return this->print(stream, (node->getType() == triton::ast::BVROL_NODE ? "rol" : "ror"), sid, {operands[0], std::to_string(amount)});
+          }
+
+          case triton::ast::BV_NODE: {
+            triton::uint512 value = node->evaluate();
+            triton::usize sid     = this->getSort(stream, node);
+            std::ostringstream hex;
+
+            if (value == 0)
+              return this->print(stream, "zero", sid, {});
+
+            hex << std::hex << value;
+            return this->print(stream, "consth", sid, {hex.str()});
+          }
+
+          case triton::ast::CONCAT_NODE: {
+            triton::uint32 size = children[0]->getBitvectorSize();
+            triton::usize value = this->nids.at(children[0].get());
+
+            for (triton::usize index = 1; index < children.size(); index++) {
+              size += children[index]->getBitvectorSize();
+              value = this->print(stream, "concat", this->getBvSort(stream, size), {std::to_string(value), operands[index]});
+            }
+            return value;
+          }
+
+          case triton::ast::EXTRACT_NODE: {
+            triton::uint32 high = triton::ast::getInteger<triton::uint32>(children[0]);
+            triton::uint32 low  = triton::ast::getInteger<triton::uint32>(children[1]);
+
+            if (low == 0 && high + 1 == children[2]->getBitvectorSize())
+              return this->nids.at(children[2].get());
+
+            return this->print(stream, "slice", this->getSort(stream, node), {operands[2], std::to_string(high), std::to_string(low)});
+          }
+
+          case triton::ast::INTEGER_NODE:
+            return 0;
+
+          case triton::ast::LAND_NODE:
+          case triton::ast::LOR_NODE:
+          case triton::ast::LXOR_NODE: {
+            const char* chain   = (node->getType() == triton::ast::LAND_NODE ? "and" : node->getType() == triton::ast::LOR_NODE ? "or" : "xor");
+            triton::usize sid   = this->getSort(stream, node);
+            triton::usize value = this->nids.at(children[0].get());
+
+            for (triton::usize index = 1; index < children.size(); index++)
+              value = this->print(stream, chain, sid, {std::to_string(value), operands[index]});
+            return value;
+          }
+
+          case triton::ast::REFERENCE_NODE: {
+            const auto& ref = reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst();
+            return this->nids.at(ref.get());
+          }
+
+          case triton::ast::SX_NODE:
+          case triton::ast::ZX_NODE: {
+            triton::uint32 extend = triton::ast::getInteger<triton::uint32>(children[0]);
+
+            if (extend == 0)
+              return this->nids.at(children[1].get());
+
+            return this->print(stream, (node->getType() == triton::ast::SX_NODE ? "sext" : "uext"), this->getSort(stream, node), {operands[1], std::to_string(extend)});
+          }
+
+          case triton::ast::VARIABLE_NODE: {
+            const auto& var = reinterpret_cast<triton::ast::VariableNode*>(node.get())->getSymbolicVariable();
+            return this->print(stream, "input", this->getSort(stream, node), {var->getAlias().empty() ? var->getName() : var->getAlias()});
+          }
+
+          default:
+            throw triton::exceptions::LiftingEngine("LiftingToBTOR2::lift(): Unsupported node, the quantifiers, let bindings and declarations can not be lifted.");
+        }
+      }
+
+
+      std::ostream& LiftingToBTOR2::liftToBTOR2(std::ostream& stream, const triton::ast::SharedAbstractNode& node) {
+        std::ostringstream lines;
+
+        this->uniqueId = 1;
+        this->bvSorts.clear();
+        this->arraySorts.clear();
+        this->nids.clear();
+
+        /* Each node shared is lifted once, children first */
+        for (const auto& n : triton::ast::childrenExtraction(node, true /* unroll */, true /* revert */)) {
+          this->nids[n.get()] = this->lift(lines, n);
+        }
+
+        /* A logical root is reachable iff it is satisfiable */
+        this->print(lines, (node->isLogical() ? "bad" : "output"), 0, {std::to_string(this->nids.at(node.get()))});
+
+        this->nids.clear();
+        stream << lines.str();
+
+        return stream;
+      }
+
+
+      std::ostream& LiftingToBTOR2::liftToBTOR2(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr) {
+        return this->liftToBTOR2(stream, expr->getAst());
+      }
+
+    }; /* lifters namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
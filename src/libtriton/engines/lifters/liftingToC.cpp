@@ -0,0 +1,269 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <triton/astCRepresentation.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/liftingToC.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace lifters {
+
+      LiftingToC::LiftingToC(const triton::ast::SharedAstContext& astCtxt, triton::engines::symbolic::SymbolicEngine* symbolic)
+        : astCtxt(astCtxt), symbolic(symbolic) {
+      }
+
+
+      void LiftingToC::requiredFunctions(std::ostream& stream, triton::uint32 width) {
+        std::string n = std::to_string(width);
+        std::string t = (width == triton::bitsize::qword ? "uint64_t" : "triton_uint128");
+        std::string s = (width == triton::bitsize::qword ? "int64_t" : "triton_sint128");
+
+        stream << "static inline " << t << " triton_mask" << n << "(uint32_t bits) {" << std::endl;
+        stream << "  return bits >= " << n << " ? ~(" << t << ")0 : (((" << t << ")1 << bits) - 1);" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << s << " triton_sx" << n << "(" << t << " value, uint32_t bits) {" << std::endl;
+        stream << "  return bits >= " << n << " ? (" << s << ")value : (" << s << ")(value << (" << n << " - bits)) >> (" << n << " - bits);" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << t << " triton_shl" << n << "(" << t << " value, " << t << " shift, uint32_t bits) {" << std::endl;
+        stream << "  return shift >= bits ? 0 : (value << shift) & triton_mask" << n << "(bits);" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << t << " triton_lshr" << n << "(" << t << " value, " << t << " shift, uint32_t bits) {" << std::endl;
+        stream << "  return shift >= bits ? 0 : value >> shift;" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << t << " triton_ashr" << n << "(" << t << " value, " << t << " shift, uint32_t bits) {" << std::endl;
+        stream << "  return (" << t << ")(triton_sx" << n << "(value, bits) >> (shift >= bits ? bits - 1 : (uint32_t)shift)) & triton_mask" << n << "(bits);" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << t << " triton_rol" << n << "(" << t << " value, uint32_t rot, uint32_t bits) {" << std::endl;
+        stream << "  return ((value << rot) | (value >> (bits - rot))) & triton_mask" << n << "(bits);" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << t << " triton_ror" << n << "(" << t << " value, uint32_t rot, uint32_t bits) {" << std::endl;
+        stream << "  return ((value >> rot) | (value << (bits - rot))) & triton_mask" << n << "(bits);" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << t << " triton_udiv" << n << "(" << t << " a, " << t << " b, uint32_t bits) {" << std::endl;
+        stream << "  return b ? a / b : triton_mask" << n << "(bits);" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << t << " triton_urem" << n << "(" << t << " a, " << t << " b, uint32_t bits) {" << std::endl;
+        stream << "  (void)bits;" << std::endl;
+        stream << "  return b ? a % b : a;" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << t << " triton_sdiv" << n << "(" << t << " a, " << t << " b, uint32_t bits) {" << std::endl;
+        stream << "  bool na = triton_sx" << n << "(a, bits) < 0, nb = triton_sx" << n << "(b, bits) < 0;" << std::endl;
+        stream << "  " << t << " mask = triton_mask" << n << "(bits), q;" << std::endl;
+        stream << "  if (b == 0)" << std::endl;
+        stream << "    return na ? 1 : mask;" << std::endl;
+        stream << "  q = (na ? (0 - a) & mask : a) / (nb ? (0 - b) & mask : b);" << std::endl;
+        stream << "  return (na != nb ? 0 - q : q) & mask;" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << t << " triton_srem" << n << "(" << t << " a, " << t << " b, uint32_t bits) {" << std::endl;
+        stream << "  bool na = triton_sx" << n << "(a, bits) < 0, nb = triton_sx" << n << "(b, bits) < 0;" << std::endl;
+        stream << "  " << t << " mask = triton_mask" << n << "(bits), r;" << std::endl;
+        stream << "  if (b == 0)" << std::endl;
+        stream << "    return a;" << std::endl;
+        stream << "  r = (na ? (0 - a) & mask : a) % (nb ? (0 - b) & mask : b);" << std::endl;
+        stream << "  return (na ? 0 - r : r) & mask;" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << t << " triton_smod" << n << "(" << t << " a, " << t << " b, uint32_t bits) {" << std::endl;
+        stream << "  " << t << " r = triton_srem" << n << "(a, b, bits);" << std::endl;
+        stream << "  if (b == 0 || r == 0 || (triton_sx" << n << "(r, bits) < 0) == (triton_sx" << n << "(b, bits) < 0))" << std::endl;
+        stream << "    return r;" << std::endl;
+        stream << "  return (r + b) & triton_mask" << n << "(bits);" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << t << " triton_bswap" << n << "(" << t << " value, uint32_t bits) {" << std::endl;
+        stream << "  " << t << " result = 0;" << std::endl;
+        stream << "  for (uint32_t index = 0; index < bits; index += 8)" << std::endl;
+        stream << "    result = (result << 8) | ((value >> index) & 0xff);" << std::endl;
+        stream << "  return result;" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+      }
+
+
+      std::ostream& LiftingToC::liftToC(std::ostream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes, const std::string& fname, bool icomment, bool single) {
+        std::map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> symExprs;
+        std::map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> symVars;
+        std::ostringstream body;
+        bool wide = false;
+
+        if (nodes.empty())
+          throw triton::exceptions::LiftingEngine("LiftingToC::liftToC(): No node to lift.");
+
+        /* Collect the references and the symbolic variables, and check the sorts before printing anything */
+        for (const auto& node : nodes) {
+          for (const auto& n : triton::ast::search(node)) {
+            if (n->isArray())
+              throw triton::exceptions::LiftingEngine("LiftingToC::liftToC(): Arrays are not supported.");
+
+            if (!n->isLogical() && n->getBitvectorSize() > triton::bitsize::dqword)
+              throw triton::exceptions::LiftingEngine("LiftingToC::liftToC(): Bitvectors wider than 128 bits are not supported.");
+
+            if (!n->isLogical() && n->getBitvectorSize() > triton::bitsize::qword)
+              wide = true;
+
+            if (n->getType() == triton::ast::REFERENCE_NODE) {
+              const auto& expr = reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression();
+              symExprs[expr->getId()] = expr;
+            }
+
+            else if (n->getType() == triton::ast::VARIABLE_NODE) {
+              const auto& var = reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable();
+              symVars[var->getId()] = var;
+            }
+          }
+        }
+
+        /* Save the AST representation mode */
+        triton::ast::representations::mode_e mode = this->astCtxt->getRepresentationMode();
+        this->astCtxt->setRepresentationMode(triton::ast::representations::C_REPRESENTATION);
+
+        try {
+          /* Print required functions */
+          stream << "#include <stdbool.h>" << std::endl;
+          stream << "#include <stdint.h>" << std::endl;
+          stream << std::endl;
+          if (wide) {
+            stream << "typedef unsigned __int128 triton_uint128;" << std::endl;
+            stream << "typedef __int128 triton_sint128;" << std::endl;
+            stream << std::endl;
+          }
+          this->requiredFunctions(stream, triton::bitsize::qword);
+          if (wide)
+            this->requiredFunctions(stream, triton::bitsize::dqword);
+
+          /* Print the symbolic variables as arguments, then the outputs */
+          std::vector<std::string> args;
+          for (const auto& var : symVars) {
+            std::ostringstream arg;
+            arg << this->astCtxt->declare(this->astCtxt->variable(var.second));
+            args.push_back(arg.str());
+          }
+
+          if (!single) {
+            for (triton::usize index = 0; index < nodes.size(); index++)
+              args.push_back(triton::ast::representations::AstCRepresentation::getType(nodes[index].get()) + "* out_" + std::to_string(index));
+          }
+
+          stream << (single ? triton::ast::representations::AstCRepresentation::getType(nodes[0].get()) : "void") << " " << fname << "(";
+          for (triton::usize index = 0; index < args.size(); index++)
+            stream << (index ? ", " : "") << args[index];
+          stream << (args.empty() ? "void" : "") << ") {" << std::endl;
+
+          /* The arguments narrower than their type are truncated to their size */
+          for (const auto& var : symVars) {
+            auto n = this->astCtxt->variable(var.second);
+            triton::uint32 size = var.second->getSize();
+
+            if (size == triton::bitsize::byte || size == triton::bitsize::word || size == triton::bitsize::dword || size == triton::bitsize::qword || size == triton::bitsize::dqword)
+              continue;
+
+            if (size < triton::bitsize::qword)
+              body << n << " &= 0x" << std::hex << n->getBitvectorMask64() << std::dec << "ull;" << std::endl;
+            else
+              body << n << " &= triton_mask128(" << size << ");" << std::endl;
+          }
+
+          /* Print the shared subexpressions once, as temporaries */
+          std::vector<triton::ast::SharedAbstractNode> roots;
+          for (const auto& se : symExprs) {
+            roots.push_back(se.second->getAst());
+          }
+          roots.insert(roots.end(), nodes.begin(), nodes.end());
+          this->astCtxt->clearTemporaries();
+          this->astCtxt->shareTemporaries(roots);
+
+          /* Print symbolic expressions */
+          for (const auto& se : symExprs) {
+            const auto& e = se.second;
+            this->astCtxt->printTemporaries(body, e->getAst());
+            body << e->getFormattedExpression();
+            if (icomment && !e->getDisassembly().empty()) {
+              if (e->getComment().empty()) {
+                body << " // ";
+              }
+              else {
+                body << " - ";
+              }
+              body << e->getDisassembly();
+            }
+            body << std::endl;
+          }
+
+          /* Print the outputs */
+          for (triton::usize index = 0; index < nodes.size(); index++) {
+            this->astCtxt->printTemporaries(body, nodes[index]);
+            if (single)
+              body << "return " << nodes[index] << ";" << std::endl;
+            else
+              body << "*out_" << index << " = " << nodes[index] << ";" << std::endl;
+          }
+
+          std::istringstream lines(body.str());
+          for (std::string line; std::getline(lines, line);)
+            stream << "  " << line << std::endl;
+          stream << "}" << std::endl;
+        }
+        catch (...) {
+          this->astCtxt->clearTemporaries();
+          this->astCtxt->setRepresentationMode(mode);
+          throw;
+        }
+
+        /* Restore the AST representation mode */
+        this->astCtxt->clearTemporaries();
+        this->astCtxt->setRepresentationMode(mode);
+
+        return stream;
+      }
+
+
+      std::ostream& LiftingToC::liftToC(std::ostream& stream, const triton::ast::SharedAbstractNode& node, const std::string& fname, bool icomment) {
+        return this->liftToC(stream, std::vector<triton::ast::SharedAbstractNode>{node}, fname, icomment, true);
+      }
+
+
+      std::ostream& LiftingToC::liftToC(std::ostream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes, const std::string& fname, bool icomment) {
+        return this->liftToC(stream, nodes, fname, icomment, false);
+      }
+
+    }; /* lifters namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -6,10 +6,13 @@
 */
 
 #include <algorithm>
+#include <deque>
+#include <sstream>
 #include <vector>
 #include <string>
 
 #include <triton/astEnums.hpp>
+#include <triton/exceptions.hpp>
 #include <triton/liftingToDot.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -19,6 +22,138 @@ namespace triton {
   namespace engines {
     namespace lifters {
 
+      /* The number of nodes counted in the label of a summary node */
+      static const triton::usize summaryCount = 256;
+
+
+      /* Returns the label of an operation, as displayed by liftToDot() */
+      static const char* getDotMnemonic(triton::ast::ast_e type) {
+        switch (type) {
+          case triton::ast::ASSERT_NODE:     return "ASSERT";
+          case triton::ast::BSWAP_NODE:      return "BSWAP";
+          case triton::ast::BVADD_NODE:      return "BVADD";
+          case triton::ast::BVAND_NODE:      return "BVAND";
+          case triton::ast::BVASHR_NODE:     return "BVASHR";
+          case triton::ast::BVLSHR_NODE:     return "BVLSHR";
+          case triton::ast::BVMUL_NODE:      return "BVMUL";
+          case triton::ast::BVNAND_NODE:     return "BVNAND";
+          case triton::ast::BVNEG_NODE:      return "BVNEG";
+          case triton::ast::BVNOR_NODE:      return "BVNOR";
+          case triton::ast::BVNOT_NODE:      return "BVNOT";
+          case triton::ast::BVOR_NODE:       return "BVOR";
+          case triton::ast::BVROL_NODE:      return "BVROL";
+          case triton::ast::BVROR_NODE:      return "BVROR";
+          case triton::ast::BVSDIV_NODE:     return "BVSDIV";
+          case triton::ast::BVSGE_NODE:      return "BVSGE";
+          case triton::ast::BVSGT_NODE:      return "BVSGT";
+          case triton::ast::BVSHL_NODE:      return "BVSHL";
+          case triton::ast::BVSLE_NODE:      return "BVSLE";
+          case triton::ast::BVSLT_NODE:      return "BVSLT";
+          case triton::ast::BVSMOD_NODE:     return "BVSMOD";
+          case triton::ast::BVSREM_NODE:     return "BVSREM";
+          case triton::ast::BVSUB_NODE:      return "BVSUB";
+          case triton::ast::BVUDIV_NODE:     return "BVUDIV";
+          case triton::ast::BVUGE_NODE:      return "BVUGE";
+          case triton::ast::BVUGT_NODE:      return "BVUGT";
+          case triton::ast::BVULE_NODE:      return "BVULE";
+          case triton::ast::BVULT_NODE:      return "BVULT";
+          case triton::ast::BVUREM_NODE:     return "BVUREM";
+          case triton::ast::BVXNOR_NODE:     return "BVXNOR";
+          case triton::ast::BVXOR_NODE:      return "BVXOR";
+          case triton::ast::COMPOUND_NODE:   return "COMPOUND";
+          case triton::ast::CONCAT_NODE:     return "CONCAT";
+          case triton::ast::DECLARE_NODE:    return "DECLARE";
+          case triton::ast::DISTINCT_NODE:   return "!=";
+          case triton::ast::EQUAL_NODE:      return "==";
+          case triton::ast::EXTRACT_NODE:    return "EXTRACT";
+          case triton::ast::FORALL_NODE:     return "FORALL";
+          case triton::ast::IFF_NODE:        return "IFF";
+          case triton::ast::ITE_NODE:        return "ITE";
+          case triton::ast::LAND_NODE:       return "LAND";
+          case triton::ast::LET_NODE:        return "LET";
+          case triton::ast::LNOT_NODE:       return "LNOT";
+          case triton::ast::LOR_NODE:        return "LOR";
+          case triton::ast::LXOR_NODE:       return "LXOR";
+          case triton::ast::REFERENCE_NODE:  return "REF";
+          case triton::ast::SELECT_NODE:     return "SELECT";
+          case triton::ast::STORE_NODE:      return "STORE";
+          case triton::ast::SX_NODE:         return "SX";
+          case triton::ast::ZX_NODE:         return "ZX";
+          default:                           return "UNKNOWN";
+        }
+      }
+
+
+      /* Returns the attributes of a node of the budgeted export, its integer parameters in the label */
+      static std::string getDotAttributes(const triton::ast::SharedAbstractNode& node) {
+        const auto& children = node->getChildren();
+        std::stringstream s;
+
+        switch (node->getType()) {
+          case triton::ast::ARRAY_NODE:
+            s << "[label=\"MEMORY\"];";
+            break;
+
+          case triton::ast::BV_NODE:
+            s << "[label=\"0x" << std::hex << triton::ast::getInteger<triton::uint512>(children[0]) << std::dec << " : " << triton::ast::getInteger<triton::uint512>(children[1]) << "-bit\" style=filled, color=black, fillcolor=lightblue];";
+            break;
+
+          case triton::ast::EXTRACT_NODE:
+            s << "[label=\"EXTRACT " << triton::ast::getInteger<std::string>(children[0]) << ":" << triton::ast::getInteger<std::string>(children[1]) << "\"];";
+            break;
+
+          case triton::ast::SX_NODE:
+          case triton::ast::ZX_NODE:
+            s << "[label=\"" << getDotMnemonic(node->getType()) << " " << triton::ast::getInteger<std::string>(children[0]) << "-bit\"];";
+            break;
+
+          case triton::ast::REFERENCE_NODE:
+            s << "[label=\"Ref #" << reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getId() << "\"];";
+            break;
+
+          case triton::ast::VARIABLE_NODE:
+            s << "[label=\"" << node << "\" style=filled, color=black, fillcolor=lightgreen];";
+            break;
+
+          case triton::ast::INTEGER_NODE:
+          case triton::ast::STRING_NODE:
+            s << "[label=\"" << node << "\"];";
+            break;
+
+          default:
+            s << "[label=\"" << getDotMnemonic(node->getType()) << "\"];";
+            break;
+        }
+
+        return s.str();
+      }
+
+
+      /* Returns the children linked by the budgeted export, the integer parameters being in the labels */
+      static std::vector<triton::ast::SharedAbstractNode> getDotChildren(const triton::ast::SharedAbstractNode& node) {
+        const auto& children = node->getChildren();
+
+        switch (node->getType()) {
+          case triton::ast::ARRAY_NODE:
+          case triton::ast::BV_NODE:
+            return {};
+
+          case triton::ast::EXTRACT_NODE:
+            return {children[2]};
+
+          case triton::ast::SX_NODE:
+          case triton::ast::ZX_NODE:
+            return {children[1]};
+
+          case triton::ast::REFERENCE_NODE:
+            return {reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst()};
+
+          default:
+            return children;
+        }
+      }
+
+
       LiftingToDot::LiftingToDot(const triton::ast::SharedAstContext& astCtxt, triton::engines::symbolic::SymbolicEngine* symbolic)
         : astCtxt(astCtxt), symbolic(symbolic) {
         this->uniqueid = 0;
@@ -464,6 +599,69 @@ namespace triton {
         return stream;
       }
 
+
+      std::ostream& LiftingToDot::liftToDot(std::ostream& stream, const triton::ast::SharedAbstractNode& root, triton::usize maxNodes, triton::uint32 maxDepth) const {
+        /* The dot id of each node emitted, the summary nodes included */
+        std::unordered_map<const triton::ast::AbstractNode*, triton::usize> ids;
+        std::deque<std::pair<triton::ast::SharedAbstractNode, triton::uint32>> worklist;
+        triton::usize expanded = 1;
+
+        if (root == nullptr)
+          throw triton::exceptions::LiftingEngine("LiftingToDot::liftToDot(): The node cannot be null.");
+
+        /* Prologue of Dot format */
+        stream << "digraph triton {" << std::endl;
+        stream << "ordering=\"out\";" << std::endl;
+        stream << "fontname=mono;" << std::endl;
+
+        ids[root.get()] = 0;
+        stream << "n0 " << getDotAttributes(root) << std::endl;
+        worklist.push_back({root, 0});
+
+        /* Breadth-first, so that the budget is spent on the top of the tree. Each node is emitted once, before its edges */
+        while (!worklist.empty()) {
+          auto current  = worklist.front();
+          auto from     = ids.at(current.first.get());
+          worklist.pop_front();
+
+          for (const auto& child : getDotChildren(current.first)) {
+            auto it = ids.find(child.get());
+            if (it != ids.end()) {
+              stream << "n" << from << " -> n" << it->second << std::endl;
+              continue;
+            }
+
+            triton::usize id = ids.size();
+            ids[child.get()] = id;
+
+            bool leaf = getDotChildren(child).empty();
+            if (leaf || ((maxNodes == 0 || expanded < maxNodes) && (maxDepth == 0 || current.second + 1 < maxDepth))) {
+              stream << "n" << id << " " << getDotAttributes(child) << std::endl;
+              if (!leaf)
+                worklist.push_back({child, current.second + 1});
+              expanded++;
+            }
+            else {
+              /* The subtree is collapsed, only the first nodes are counted */
+              auto count = triton::ast::countNodes(child, summaryCount);
+              stream << "n" << id << " [label=\"" << getDotMnemonic(child->getType()) << " ... ";
+              if (count > summaryCount)
+                stream << ">" << summaryCount;
+              else
+                stream << count;
+              stream << " nodes\" shape=box, style=dashed];" << std::endl;
+            }
+
+            stream << "n" << from << " -> n" << id << std::endl;
+          }
+        }
+
+        /* Epilogue of Dot format */
+        stream << "}" << std::endl;
+
+        return stream;
+      }
+
     }; /* lifters namespace */
   }; /* engines namespace */
 }; /* triton namespace */
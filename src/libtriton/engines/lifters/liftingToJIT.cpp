@@ -0,0 +1,142 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <triton/exceptions.hpp>
+#include <triton/liftingToJIT.hpp>
+#include <triton/tritonToLLVM.hpp>
+
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/TargetSelect.h>
+#include <llvm/Transforms/Utils/Cloning.h>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace lifters {
+
+      bool CompiledBlock::matches(triton::arch::BasicBlock& block) const {
+        triton::usize offset = 0;
+
+        if (block.getSize() != this->count)
+          return false;
+
+        for (const auto& inst : block.getInstructions()) {
+          if (offset + inst.getSize() > this->opcodes.size() || std::memcmp(this->opcodes.data() + offset, inst.getOpcode(), inst.getSize()) != 0)
+            return false;
+          offset += inst.getSize();
+        }
+
+        return offset == this->opcodes.size();
+      }
+
+
+      LiftingToJIT::LiftingToJIT() {
+        this->uniqueFunctionId = 0;
+      }
+
+
+      void LiftingToJIT::initCompiledBlock(CompiledBlock& compiled, triton::arch::BasicBlock& block) const {
+        compiled.opcodes.clear();
+        for (const auto& inst : block.getInstructions())
+          compiled.opcodes.insert(compiled.opcodes.end(), inst.getOpcode(), inst.getOpcode() + inst.getSize());
+
+        compiled.count    = block.getSize();
+        compiled.function = nullptr;
+        compiled.branch   = false;
+      }
+
+
+      const CompiledBlock& LiftingToJIT::compileBlock(triton::arch::BasicBlock& block, triton::uint64 addr,
+                                                      const std::vector<triton::arch::Register>& inputs, const std::vector<triton::ast::SharedAbstractNode>& vars,
+                                                      const std::vector<triton::arch::Register>& outputs, const std::vector<triton::ast::SharedAbstractNode>& nodes,
+                                                      bool branch) {
+        CompiledBlock compiled;
+
+        if (inputs.size() != vars.size() || outputs.size() != nodes.size())
+          throw triton::exceptions::LiftingEngine("LiftingToJIT::compileBlock(): Registers and ASTs mismatch.");
+
+        if (this->jit == nullptr) {
+          llvm::InitializeNativeTarget();
+          llvm::InitializeNativeTargetAsmPrinter();
+
+          auto jit = llvm::orc::LLJITBuilder().create();
+          if (!jit) {
+            llvm::consumeError(jit.takeError());
+            throw triton::exceptions::LiftingEngine("LiftingToJIT::compileBlock(): Failed to create the LLVM JIT.");
+          }
+          this->jit = std::move(*jit);
+        }
+
+        std::string fname = "__triton_block_" + std::to_string(this->uniqueFunctionId++);
+
+        /* The module and its context are given to the JIT, the lifter must release them first */
+        auto context = std::make_unique<llvm::LLVMContext>();
+        std::unique_ptr<llvm::Module> module = nullptr;
+        {
+          triton::ast::TritonToLLVM lifter(*context);
+          module = llvm::CloneModule(*lifter.convert(nodes, vars, fname.c_str(), true));
+        }
+
+        if (auto err = this->jit->addIRModule(llvm::orc::ThreadSafeModule(std::move(module), std::move(context)))) {
+          llvm::consumeError(std::move(err));
+          throw triton::exceptions::LiftingEngine("LiftingToJIT::compileBlock(): Failed to add the module to the LLVM JIT.");
+        }
+
+        auto symbol = this->jit->lookup(fname);
+        if (!symbol) {
+          llvm::consumeError(symbol.takeError());
+          throw triton::exceptions::LiftingEngine("LiftingToJIT::compileBlock(): Failed to compile the block.");
+        }
+
+        this->initCompiledBlock(compiled, block);
+        compiled.function = reinterpret_cast<JitFunction>(symbol->getAddress());
+        compiled.inputs   = inputs;
+        compiled.outputs  = outputs;
+        compiled.branch   = branch;
+
+        return this->compiledBlocks[addr] = std::move(compiled);
+      }
+
+
+      void LiftingToJIT::rejectBlock(triton::arch::BasicBlock& block, triton::uint64 addr) {
+        CompiledBlock compiled;
+
+        this->initCompiledBlock(compiled, block);
+        this->compiledBlocks[addr] = std::move(compiled);
+      }
+
+
+      const CompiledBlock* LiftingToJIT::getCompiledBlock(triton::arch::BasicBlock& block, triton::uint64 addr) const {
+        auto it = this->compiledBlocks.find(addr);
+
+        if (it == this->compiledBlocks.end() || it->second.matches(block) == false)
+          return nullptr;
+
+        return &it->second;
+      }
+
+
+      triton::usize LiftingToJIT::getCompiledBlocksSize(void) const {
+        return this->compiledBlocks.size();
+      }
+
+
+      void LiftingToJIT::clearCompiledBlocks(void) {
+        this->compiledBlocks.clear();
+      }
+
+    }; /* lifters namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
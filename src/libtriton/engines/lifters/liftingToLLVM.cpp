@@ -5,9 +5,13 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
 #include <memory>
 #include <ostream>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <triton/astContext.hpp>
 #include <triton/liftingToLLVM.hpp>
@@ -53,6 +57,35 @@ namespace triton {
       }
 
 
+      std::ostream& LiftingToLLVM::liftToLLVM(std::ostream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes, const char* fname, bool optimize) {
+        std::unordered_set<const triton::ast::AbstractNode*> seen;
+        std::vector<triton::ast::SharedAbstractNode> vars;
+
+        /* The symbolic variables are the inputs, in order of appearance */
+        for (const auto& node : nodes) {
+          for (const auto& var : triton::ast::search(node, triton::ast::VARIABLE_NODE)) {
+            if (seen.insert(var.get()).second) {
+              vars.push_back(var);
+            }
+          }
+        }
+
+        llvm::LLVMContext context;
+        triton::ast::TritonToLLVM lifter(context);
+
+        /* Lift the ASTs to one LLVM function */
+        auto llvmModule = lifter.convert(nodes, vars, fname, optimize, true /* memory */);
+
+        /* Print the LLVM module into the stream */
+        std::string dump;
+        llvm::raw_string_ostream llvmStream(dump);
+        llvmModule->print(llvmStream, nullptr);
+        stream << dump;
+
+        return stream;
+      }
+
+
       triton::ast::SharedAbstractNode LiftingToLLVM::simplifyAstViaLLVM(const triton::ast::SharedAbstractNode& node) const {
         llvm::LLVMContext context;
 
@@ -63,6 +96,50 @@ namespace triton {
         return llvmtt.convert(llvmModule.get(), "__tmp");       /* from llvm to triton */
       }
 
+
+      std::vector<triton::ast::SharedAbstractNode> LiftingToLLVM::simplifyAstViaLLVM(const std::vector<triton::ast::SharedAbstractNode>& nodes) const {
+        std::unordered_map<triton::uint64, std::vector<triton::usize>> lifted;
+        std::vector<triton::ast::SharedAbstractNode> simplified;
+        std::vector<triton::ast::SharedAbstractNode> outputs;
+        std::vector<triton::usize> functions;
+        std::vector<std::string> fnames;
+
+        if (nodes.empty())
+          return simplified;
+
+        llvm::LLVMContext context;
+
+        triton::ast::TritonToLLVM ttllvm(context);
+        triton::ast::LLVMToTriton llvmtt(nodes.front()->getContext());
+
+        /* Each distinct AST is a function of the same module, the duplicates share it */
+        for (const auto& node : nodes) {
+          auto& candidates = lifted[node->getHash64()];
+          auto  it = std::find_if(candidates.begin(), candidates.end(), [&](triton::usize index) { return nodes[index]->equalTo(node); });
+
+          if (it != candidates.end()) {
+            functions.push_back(functions[*it]);
+            continue;
+          }
+
+          candidates.push_back(functions.size());
+          functions.push_back(fnames.size());
+          fnames.push_back("__tmp" + std::to_string(fnames.size()));
+          ttllvm.convert(node, fnames.back().c_str(), false);
+        }
+
+        /* The optimizations run once for the batch */
+        ttllvm.optimizeModule();
+
+        for (const auto& fname : fnames)
+          outputs.push_back(llvmtt.convert(ttllvm.getModule().get(), fname.c_str()));
+
+        for (triton::usize function : functions)
+          simplified.push_back(outputs[function]);
+
+        return simplified;
+      }
+
     }; /* lifters namespace */
   }; /* engines namespace */
 }; /* triton namespace */
@@ -99,9 +99,18 @@ namespace triton {
         /* Sort SSA */
         std::sort(symExprs.begin(), symExprs.end());
 
+        /* Print the shared subexpressions once, as temporaries */
+        std::vector<triton::ast::SharedAbstractNode> roots;
+        for (const auto& id : symExprs) {
+          roots.push_back(ssa[id]->getAst());
+        }
+        this->astCtxt->clearTemporaries();
+        this->astCtxt->shareTemporaries(roots);
+
         /* Print symbolic expressions */
         for (const auto& id : symExprs) {
           auto& e = ssa[id];
+          this->astCtxt->printTemporaries(stream, e->getAst());
           stream << e->getFormattedExpression();
           if (icomment && !e->getDisassembly().empty()) {
             if (e->getComment().empty()) {
@@ -116,6 +125,7 @@ namespace triton {
         }
 
         /* Restore the AST representation mode */
+        this->astCtxt->clearTemporaries();
         this->astCtxt->setRepresentationMode(mode);
 
         return stream;
@@ -144,6 +144,14 @@ namespace triton {
 
         /* Sort SSA */
         std::sort(symExprs.begin(), symExprs.end());
+        /* Print the shared subexpressions once, as temporaries */
+        std::vector<triton::ast::SharedAbstractNode> roots;
+        for (const auto& id : symExprs) {
+          roots.push_back(ssa[id]->getAst());
+        }
+        this->astCtxt->clearTemporaries();
+        this->astCtxt->shareTemporaries(roots);
+
         if (assert_) {
           /* The last node will be handled later to separate conjuncts */
           symExprs.pop_back();
@@ -152,6 +160,7 @@ namespace triton {
         /* Print symbolic expressions */
         for (const auto& id : symExprs) {
           auto& e = ssa[id];
+          this->astCtxt->printTemporaries(stream, e->getAst());
           stream << e->getFormattedExpression();
           if (icomment && !e->getDisassembly().empty()) {
             if (e->getComment().empty()) {
@@ -184,6 +193,7 @@ namespace triton {
             }
           }
 
+          this->astCtxt->printTemporaries(stream, expr->getAst());
           for (auto it = exprs.crbegin(); it != exprs.crend(); ++it) {
             stream << this->astCtxt->assert_(*it) << std::endl;
           }
@@ -193,6 +203,7 @@ namespace triton {
         }
 
         /* Restore the AST representation mode */
+        this->astCtxt->clearTemporaries();
         this->astCtxt->setRepresentationMode(mode);
 
         return stream;
@@ -0,0 +1,746 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <stack>
+
+#include <triton/bitBlastSolver.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      BitBlaster::BitBlaster(triton::engines::solver::SatSolver& sat)
+        : sat(sat) {
+        this->one = this->sat.newVariable();
+        this->sat.addClause({this->one});
+      }
+
+
+      triton::sint32 BitBlaster::land(triton::sint32 a, triton::sint32 b) {
+        if (a == -this->one || b == -this->one || a == -b)
+          return -this->one;
+
+        if (a == this->one || a == b)
+          return b;
+
+        if (b == this->one)
+          return a;
+
+        if (a > b)
+          std::swap(a, b);
+
+        triton::uint64 key = (static_cast<triton::uint64>(static_cast<triton::uint32>(a)) << 32) | static_cast<triton::uint32>(b);
+        auto it = this->ands.find(key);
+        if (it != this->ands.end())
+          return it->second;
+
+        triton::sint32 g = this->sat.newVariable();
+        this->sat.addClause({-g, a});
+        this->sat.addClause({-g, b});
+        this->sat.addClause({g, -a, -b});
+        this->ands[key] = g;
+
+        return g;
+      }
+
+
+      triton::sint32 BitBlaster::lor(triton::sint32 a, triton::sint32 b) {
+        return -this->land(-a, -b);
+      }
+
+
+      triton::sint32 BitBlaster::lxor(triton::sint32 a, triton::sint32 b) {
+        bool negated = false;
+
+        if (a == this->one)  return -b;
+        if (a == -this->one) return b;
+        if (b == this->one)  return -a;
+        if (b == -this->one) return a;
+        if (a == b)          return -this->one;
+        if (a == -b)         return this->one;
+
+        /* The gate is hashed on the positive inputs */
+        if (a < 0) {
+          a = -a;
+          negated = !negated;
+        }
+
+        if (b < 0) {
+          b = -b;
+          negated = !negated;
+        }
+
+        if (a > b)
+          std::swap(a, b);
+
+        triton::uint64 key = (static_cast<triton::uint64>(a) << 32) | static_cast<triton::uint32>(b);
+        triton::sint32 g   = 0;
+        auto it = this->xors.find(key);
+
+        if (it != this->xors.end()) {
+          g = it->second;
+        }
+        else {
+          g = this->sat.newVariable();
+          this->sat.addClause({-g, a, b});
+          this->sat.addClause({-g, -a, -b});
+          this->sat.addClause({g, -a, b});
+          this->sat.addClause({g, a, -b});
+          this->xors[key] = g;
+        }
+
+        return negated ? -g : g;
+      }
+
+
+      triton::sint32 BitBlaster::ite(triton::sint32 c, triton::sint32 t, triton::sint32 e) {
+        if (c == this->one || t == e)
+          return t;
+
+        if (c == -this->one)
+          return e;
+
+        return this->lor(this->land(c, t), this->land(-c, e));
+      }
+
+
+      Bits BitBlaster::constant(const triton::uint512& value, triton::uint32 size) const {
+        Bits r(size);
+
+        for (triton::uint32 i = 0; i < size; i++)
+          r[i] = (((value >> i) & 1) != 0) ? this->one : -this->one;
+
+        return r;
+      }
+
+
+      Bits BitBlaster::bitwise(const Bits& a, const Bits& b, triton::sint32 (BitBlaster::*gate)(triton::sint32, triton::sint32)) {
+        Bits r(a.size());
+
+        for (triton::usize i = 0; i < a.size(); i++)
+          r[i] = (this->*gate)(a[i], b[i]);
+
+        return r;
+      }
+
+
+      Bits BitBlaster::ite(triton::sint32 c, const Bits& t, const Bits& e) {
+        Bits r(t.size());
+
+        for (triton::usize i = 0; i < t.size(); i++)
+          r[i] = this->ite(c, t[i], e[i]);
+
+        return r;
+      }
+
+
+      Bits BitBlaster::add(const Bits& a, const Bits& b, triton::sint32 carry) {
+        Bits r(a.size());
+
+        /* Ripple-carry adder */
+        for (triton::usize i = 0; i < a.size(); i++) {
+          triton::sint32 x = this->lxor(a[i], b[i]);
+          r[i]  = this->lxor(x, carry);
+          carry = this->lor(this->land(a[i], b[i]), this->land(carry, x));
+        }
+
+        return r;
+      }
+
+
+      Bits BitBlaster::neg(const Bits& a) {
+        Bits n(a.size());
+
+        for (triton::usize i = 0; i < a.size(); i++)
+          n[i] = -a[i];
+
+        return this->add(n, this->constant(0, static_cast<triton::uint32>(a.size())), this->one);
+      }
+
+
+      Bits BitBlaster::mul(const Bits& a, const Bits& b) {
+        triton::usize n = a.size();
+        Bits r = this->constant(0, static_cast<triton::uint32>(n));
+
+        /* Shift and add, the partial products being truncated */
+        for (triton::usize i = 0; i < n; i++) {
+          if (b[i] == -this->one)
+            continue;
+          Bits p(n, -this->one);
+          for (triton::usize j = i; j < n; j++)
+            p[j] = this->land(a[j - i], b[i]);
+          r = this->add(r, p, -this->one);
+        }
+
+        return r;
+      }
+
+
+      std::pair<Bits, Bits> BitBlaster::udivrem(const Bits& a, const Bits& b) {
+        triton::usize n = a.size();
+        Bits q(n);
+        Bits r = this->constant(0, static_cast<triton::uint32>(n));
+        Bits d(b);
+        Bits nd(n + 1);
+
+        /* The divisor and its complement on n+1 bits */
+        d.push_back(-this->one);
+        for (triton::usize i = 0; i <= n; i++)
+          nd[i] = -d[i];
+
+        /*
+         * Restoring division. A null divisor gives the quotient of all ones and
+         * the dividend as remainder, as in SMT-LIB.
+         */
+        for (triton::usize i = n; i-- > 0;) {
+          Bits s(1, a[i]);
+          s.insert(s.end(), r.begin(), r.end());
+          q[i] = -this->ult(s, d);
+          r = this->ite(q[i], this->add(s, nd, this->one), s);
+          r.resize(n);
+        }
+
+        return {q, r};
+      }
+
+
+      Bits BitBlaster::abs(const Bits& a) {
+        return this->ite(a.back(), this->neg(a), a);
+      }
+
+
+      Bits BitBlaster::shift(const Bits& a, const Bits& b, bool left, triton::sint32 fill) {
+        triton::usize n = a.size();
+        triton::sint32 overflow = -this->one;
+        Bits r(a);
+
+        /* Barrel shifter, a shift of the size or more fills the result */
+        for (triton::usize k = 0; k < n; k++) {
+          if (k >= 63 || (static_cast<triton::uint64>(1) << k) >= n) {
+            overflow = this->lor(overflow, b[k]);
+            continue;
+          }
+
+          triton::usize amount = static_cast<triton::usize>(1) << k;
+          Bits s(n, fill);
+          for (triton::usize i = 0; i < n; i++) {
+            if (left && i >= amount)
+              s[i] = r[i - amount];
+            else if (!left && i + amount < n)
+              s[i] = r[i + amount];
+          }
+          r = this->ite(b[k], s, r);
+        }
+
+        return this->ite(overflow, Bits(n, fill), r);
+      }
+
+
+      triton::sint32 BitBlaster::eq(const Bits& a, const Bits& b) {
+        triton::sint32 r = this->one;
+
+        for (triton::usize i = 0; i < a.size(); i++)
+          r = this->land(r, -this->lxor(a[i], b[i]));
+
+        return r;
+      }
+
+
+      triton::sint32 BitBlaster::ult(const Bits& a, const Bits& b) {
+        triton::sint32 r = -this->one;
+
+        /* The most significant different bit decides */
+        for (triton::usize i = 0; i < a.size(); i++)
+          r = this->ite(this->lxor(a[i], b[i]), b[i], r);
+
+        return r;
+      }
+
+
+      triton::sint32 BitBlaster::slt(const Bits& a, const Bits& b) {
+        triton::sint32 r = -this->one;
+        triton::usize  n = a.size();
+
+        /* As ult(), the sign bits being reversed */
+        for (triton::usize i = 0; i < n; i++)
+          r = this->ite(this->lxor(a[i], b[i]), (i + 1 == n) ? a[i] : b[i], r);
+
+        return r;
+      }
+
+
+      const Bits& BitBlaster::get(const triton::ast::SharedAbstractNode& node) const {
+        return this->cache.at(node.get());
+      }
+
+
+      Bits BitBlaster::translate(triton::ast::AbstractNode* node) {
+        const std::vector<triton::ast::SharedAbstractNode>& children = node->getChildren();
+        triton::uint32 size = node->getBitvectorSize();
+
+        switch (node->getType()) {
+          case triton::ast::INTEGER_NODE:
+          case triton::ast::STRING_NODE:
+            return {};
+
+          default:
+            break;
+        }
+
+        /* A concrete node is a constant, whatever its kind */
+        if (node->isSymbolized() == false)
+          return this->constant(node->evaluate(), size);
+
+        switch (node->getType()) {
+          case triton::ast::BSWAP_NODE: {
+            const Bits& a = this->get(children[0]);
+            Bits r(size);
+            for (triton::uint32 i = 0; i < size; i++)
+              r[i] = a[(size / 8 - 1 - i / 8) * 8 + i % 8];
+            return r;
+          }
+
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVMUL_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVXOR_NODE: {
+            Bits r = this->get(children[0]);
+            for (triton::usize i = 1; i < children.size(); i++) {
+              const Bits& b = this->get(children[i]);
+              switch (node->getType()) {
+                case triton::ast::BVADD_NODE: r = this->add(r, b, -this->one); break;
+                case triton::ast::BVAND_NODE: r = this->bitwise(r, b, &BitBlaster::land); break;
+                case triton::ast::BVMUL_NODE: r = this->mul(r, b); break;
+                case triton::ast::BVOR_NODE:  r = this->bitwise(r, b, &BitBlaster::lor); break;
+                default:                      r = this->bitwise(r, b, &BitBlaster::lxor); break;
+              }
+            }
+            return r;
+          }
+
+          case triton::ast::BVNAND_NODE:
+          case triton::ast::BVNOR_NODE:
+          case triton::ast::BVXNOR_NODE: {
+            Bits r;
+            if (node->getType() == triton::ast::BVNAND_NODE)
+              r = this->bitwise(this->get(children[0]), this->get(children[1]), &BitBlaster::land);
+            else if (node->getType() == triton::ast::BVNOR_NODE)
+              r = this->bitwise(this->get(children[0]), this->get(children[1]), &BitBlaster::lor);
+            else
+              r = this->bitwise(this->get(children[0]), this->get(children[1]), &BitBlaster::lxor);
+            for (auto& bit : r)
+              bit = -bit;
+            return r;
+          }
+
+          case triton::ast::BVNOT_NODE: {
+            Bits r = this->get(children[0]);
+            for (auto& bit : r)
+              bit = -bit;
+            return r;
+          }
+
+          case triton::ast::BVNEG_NODE:
+            return this->neg(this->get(children[0]));
+
+          case triton::ast::BVSUB_NODE: {
+            Bits nb = this->get(children[1]);
+            for (auto& bit : nb)
+              bit = -bit;
+            return this->add(this->get(children[0]), nb, this->one);
+          }
+
+          case triton::ast::BVUDIV_NODE:
+            return this->udivrem(this->get(children[0]), this->get(children[1])).first;
+
+          case triton::ast::BVUREM_NODE:
+            return this->udivrem(this->get(children[0]), this->get(children[1])).second;
+
+          case triton::ast::BVSDIV_NODE:
+          case triton::ast::BVSREM_NODE:
+          case triton::ast::BVSMOD_NODE: {
+            const Bits& a = this->get(children[0]);
+            const Bits& b = this->get(children[1]);
+            auto qr = this->udivrem(this->abs(a), this->abs(b));
+
+            /* The quotient is negative if the signs differ */
+            if (node->getType() == triton::ast::BVSDIV_NODE)
+              return this->ite(this->lxor(a.back(), b.back()), this->neg(qr.first), qr.first);
+
+            /* The remainder has the sign of the dividend */
+            Bits rem = this->ite(a.back(), this->neg(qr.second), qr.second);
+            if (node->getType() == triton::ast::BVSREM_NODE)
+              return rem;
+
+            /* The modulus has the sign of the divisor */
+            Bits sum = this->add(rem, b, -this->one);
+            return this->ite(this->eq(qr.second, this->constant(0, size)), qr.second, this->ite(this->lxor(a.back(), b.back()), sum, rem));
+          }
+
+          case triton::ast::BVSHL_NODE:
+            return this->shift(this->get(children[0]), this->get(children[1]), true, -this->one);
+
+          case triton::ast::BVLSHR_NODE:
+            return this->shift(this->get(children[0]), this->get(children[1]), false, -this->one);
+
+          case triton::ast::BVASHR_NODE: {
+            const Bits& a = this->get(children[0]);
+            return this->shift(a, this->get(children[1]), false, a.back());
+          }
+
+          case triton::ast::BVROL_NODE:
+          case triton::ast::BVROR_NODE: {
+            const Bits& a = this->get(children[0]);
+            triton::uint32 rot = triton::ast::getInteger<triton::uint32>(children[1]) % size;
+            Bits r(size);
+            for (triton::uint32 i = 0; i < size; i++) {
+              if (node->getType() == triton::ast::BVROL_NODE)
+                r[(i + rot) % size] = a[i];
+              else
+                r[i] = a[(i + rot) % size];
+            }
+            return r;
+          }
+
+          case triton::ast::BVSGE_NODE: return {-this->slt(this->get(children[0]), this->get(children[1]))};
+          case triton::ast::BVSGT_NODE: return {this->slt(this->get(children[1]), this->get(children[0]))};
+          case triton::ast::BVSLE_NODE: return {-this->slt(this->get(children[1]), this->get(children[0]))};
+          case triton::ast::BVSLT_NODE: return {this->slt(this->get(children[0]), this->get(children[1]))};
+          case triton::ast::BVUGE_NODE: return {-this->ult(this->get(children[0]), this->get(children[1]))};
+          case triton::ast::BVUGT_NODE: return {this->ult(this->get(children[1]), this->get(children[0]))};
+          case triton::ast::BVULE_NODE: return {-this->ult(this->get(children[1]), this->get(children[0]))};
+          case triton::ast::BVULT_NODE: return {this->ult(this->get(children[0]), this->get(children[1]))};
+
+          case triton::ast::CONCAT_NODE: {
+            Bits r;
+            /* The first child is the most significant */
+            for (auto it = children.rbegin(); it != children.rend(); it++) {
+              const Bits& b = this->get(*it);
+              r.insert(r.end(), b.begin(), b.end());
+            }
+            return r;
+          }
+
+          case triton::ast::EXTRACT_NODE: {
+            const Bits& a = this->get(children[2]);
+            triton::uint32 high = triton::ast::getInteger<triton::uint32>(children[0]);
+            triton::uint32 low  = triton::ast::getInteger<triton::uint32>(children[1]);
+            return Bits(a.begin() + low, a.begin() + high + 1);
+          }
+
+          case triton::ast::ZX_NODE:
+          case triton::ast::SX_NODE: {
+            Bits r = this->get(children[1]);
+            r.resize(size, (node->getType() == triton::ast::ZX_NODE) ? -this->one : r.back());
+            return r;
+          }
+
+          case triton::ast::EQUAL_NODE:
+            return {this->eq(this->get(children[0]), this->get(children[1]))};
+
+          case triton::ast::DISTINCT_NODE:
+            return {-this->eq(this->get(children[0]), this->get(children[1]))};
+
+          case triton::ast::IFF_NODE:
+            return {-this->lxor(this->get(children[0])[0], this->get(children[1])[0])};
+
+          case triton::ast::LAND_NODE:
+          case triton::ast::LOR_NODE:
+          case triton::ast::LXOR_NODE: {
+            triton::sint32 r = this->get(children[0])[0];
+            for (triton::usize i = 1; i < children.size(); i++) {
+              triton::sint32 b = this->get(children[i])[0];
+              switch (node->getType()) {
+                case triton::ast::LAND_NODE: r = this->land(r, b); break;
+                case triton::ast::LOR_NODE:  r = this->lor(r, b); break;
+                default:                     r = this->lxor(r, b); break;
+              }
+            }
+            return {r};
+          }
+
+          case triton::ast::LNOT_NODE:
+            return {-this->get(children[0])[0]};
+
+          case triton::ast::ITE_NODE:
+            return this->ite(this->get(children[0])[0], this->get(children[1]), this->get(children[2]));
+
+          case triton::ast::REFERENCE_NODE:
+            return this->cache.at(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getSymbolicExpression()->getAst().get());
+
+          case triton::ast::VARIABLE_NODE: {
+            const triton::engines::symbolic::SharedSymbolicVariable& var = reinterpret_cast<triton::ast::VariableNode*>(node)->getSymbolicVariable();
+            auto it = this->variables.find(var->getId());
+            if (it != this->variables.end())
+              return it->second.second;
+            Bits r(size);
+            for (auto& bit : r)
+              bit = this->sat.newVariable();
+            this->variables[var->getId()] = {var, r};
+            return r;
+          }
+
+          default:
+            throw triton::exceptions::SolverEngine("BitBlaster::translate(): Unsupported node.");
+        }
+      }
+
+
+      triton::sint32 BitBlaster::blast(const triton::ast::SharedAbstractNode& node) {
+        std::vector<std::pair<triton::ast::AbstractNode*, bool>> worklist;
+        triton::ast::SharedAbstractNode root = node;
+
+        if (root == nullptr)
+          throw triton::exceptions::SolverEngine("BitBlaster::blast(): node cannot be null.");
+
+        if (root->getType() == triton::ast::ASSERT_NODE)
+          root = root->getChildren()[0];
+
+        if (root->isLogical() == false)
+          throw triton::exceptions::SolverEngine("BitBlaster::blast(): Must be a logical node.");
+
+        /* Children first, the concrete subtrees being constants */
+        worklist.push_back({root.get(), false});
+        while (!worklist.empty()) {
+          std::pair<triton::ast::AbstractNode*, bool> item = worklist.back();
+          worklist.pop_back();
+
+          if (item.second) {
+            this->cache[item.first] = this->translate(item.first);
+            continue;
+          }
+
+          if (this->cache.find(item.first) != this->cache.end())
+            continue;
+
+          worklist.push_back({item.first, true});
+          if (item.first->isSymbolized() == false)
+            continue;
+
+          if (item.first->getType() == triton::ast::REFERENCE_NODE) {
+            worklist.push_back({reinterpret_cast<triton::ast::ReferenceNode*>(item.first)->getSymbolicExpression()->getAst().get(), false});
+            continue;
+          }
+
+          for (const auto& child : item.first->getChildren()) {
+            if (this->cache.find(child.get()) == this->cache.end())
+              worklist.push_back({child.get(), false});
+          }
+        }
+
+        return this->get(root)[0];
+      }
+
+
+      const std::map<triton::usize, std::pair<triton::engines::symbolic::SharedSymbolicVariable, Bits>>& BitBlaster::getVariables(void) const {
+        return this->variables;
+      }
+
+
+      bool BitBlaster::isSupported(const triton::ast::SharedAbstractNode& node, triton::usize maxNodes) {
+        std::stack<triton::ast::AbstractNode*> nodes;
+        triton::usize count = 0;
+
+        if (node == nullptr)
+          return false;
+
+        triton::ast::AbstractNode* root = node.get();
+        if (root->getType() == triton::ast::ASSERT_NODE)
+          root = root->getChildren()[0].get();
+
+        if (root->isLogical() == false)
+          return false;
+
+        triton::ast::VisitedNodes visited(root->getContext());
+
+        nodes.push(root);
+        while (!nodes.empty()) {
+          triton::ast::AbstractNode* current = nodes.top();
+          nodes.pop();
+
+          if (!visited.insert(current))
+            continue;
+
+          if (++count > maxNodes)
+            return false;
+
+          switch (current->getType()) {
+            case triton::ast::ARRAY_NODE:
+            case triton::ast::ASSERT_NODE:
+            case triton::ast::COMPOUND_NODE:
+            case triton::ast::DECLARE_NODE:
+            case triton::ast::FORALL_NODE:
+            case triton::ast::LET_NODE:
+            case triton::ast::SELECT_NODE:
+            case triton::ast::STORE_NODE:
+            case triton::ast::STRING_NODE:
+              return false;
+
+            /* The size of the circuits is quadratic */
+            case triton::ast::BVMUL_NODE:
+            case triton::ast::BVSDIV_NODE:
+            case triton::ast::BVSMOD_NODE:
+            case triton::ast::BVSREM_NODE:
+            case triton::ast::BVUDIV_NODE:
+            case triton::ast::BVUREM_NODE:
+              if (current->getBitvectorSize() > triton::bitsize::qword)
+                return false;
+              break;
+
+            default:
+              break;
+          }
+
+          if (current->getType() == triton::ast::REFERENCE_NODE) {
+            nodes.push(reinterpret_cast<triton::ast::ReferenceNode*>(current)->getSymbolicExpression()->getAst().get());
+          }
+          else {
+            for (const auto& child : current->getChildren())
+              nodes.push(child.get());
+          }
+        }
+
+        return true;
+      }
+
+
+      BitBlastSolver::BitBlastSolver() {
+        this->timeout = 0;
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> BitBlastSolver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        return this->getModels(node, limit, status, timeout, solvingTime, nullptr);
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> BitBlastSolver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime, triton::engines::solver::SolverInterrupt* interrupt) const {
+        std::vector<std::unordered_map<triton::usize, SolverModel>> ret;
+        triton::engines::solver::SatSolver sat;
+        triton::engines::solver::BitBlaster blaster(sat);
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("BitBlastSolver::getModels(): node cannot be null.");
+
+        if (timeout == 0)
+          timeout = this->timeout;
+
+        /* Get time of solving start */
+        auto start = std::chrono::system_clock::now();
+
+        sat.addClause({blaster.blast(node)});
+
+        /* Get first model */
+        triton::engines::solver::status_e res = (interrupt != nullptr && interrupt->isInterrupted()) ? triton::engines::solver::UNKNOWN : sat.solve(timeout, interrupt);
+
+        /* Write back the status code of the first constraint */
+        if (status)
+          *status = res;
+
+        while (res == triton::engines::solver::SAT && limit >= 1) {
+          std::unordered_map<triton::usize, SolverModel> smodel;
+          std::vector<triton::sint32> blocking;
+
+          for (const auto& it : blaster.getVariables()) {
+            const Bits& bits = it.second.second;
+            triton::uint512 value = 0;
+            for (triton::usize i = 0; i < bits.size(); i++) {
+              if (sat.getValue(bits[i]))
+                value |= (triton::uint512(1) << i);
+              blocking.push_back(sat.getValue(bits[i]) ? -bits[i] : bits[i]);
+            }
+            smodel[it.first] = SolverModel(it.second.first, value);
+          }
+
+          /* Check that model is available */
+          if (smodel.empty())
+            break;
+
+          /* Push model */
+          ret.push_back(smodel);
+
+          if (--limit) {
+            /* Escape last models */
+            sat.addClause(blocking);
+
+            /* Get next model */
+            res = (interrupt != nullptr && interrupt->isInterrupted()) ? triton::engines::solver::UNKNOWN : sat.solve(timeout, interrupt);
+          }
+        }
+
+        /* Get time of solving end */
+        auto end = std::chrono::system_clock::now();
+
+        if (solvingTime)
+          *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+        return ret;
+      }
+
+
+      bool BitBlastSolver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::engines::solver::SatSolver sat;
+        triton::engines::solver::BitBlaster blaster(sat);
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("BitBlastSolver::isSat(): node cannot be null.");
+
+        /* Get time of solving start */
+        auto start = std::chrono::system_clock::now();
+
+        sat.addClause({blaster.blast(node)});
+        triton::engines::solver::status_e res = sat.solve(timeout ? timeout : this->timeout);
+
+        /* Get time of solving end */
+        auto end = std::chrono::system_clock::now();
+
+        if (solvingTime)
+          *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+        if (status)
+          *status = res;
+
+        return res == triton::engines::solver::SAT;
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> BitBlastSolver::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::unordered_map<triton::usize, SolverModel> ret;
+        std::vector<std::unordered_map<triton::usize, SolverModel>> allModels;
+
+        allModels = this->getModels(node, 1, status, timeout, solvingTime);
+        if (allModels.size() > 0)
+          ret = allModels.front();
+
+        return ret;
+      }
+
+
+      std::string BitBlastSolver::getName(void) const {
+        return "bitblast";
+      }
+
+
+      void BitBlastSolver::setTimeout(triton::uint32 ms) {
+        this->timeout = ms;
+      }
+
+
+      void BitBlastSolver::setMemoryLimit(triton::uint32 mem) {
+        (void)mem;
+      }
+
+    }; /* solver namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,438 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include <triton/exceptions.hpp>
+#include <triton/satSolver.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* The activities decay by this factor at each conflict */
+      static constexpr double DECAY = 0.95;
+
+      /* The number of conflicts of the first restart */
+      static constexpr triton::uint64 RESTART_BASE = 100;
+
+
+      /* The x-th element of the Luby sequence, as a power of y */
+      static double luby(double y, triton::uint32 x) {
+        triton::uint32 size = 1;
+        triton::uint32 seq  = 0;
+
+        while (size < x + 1) {
+          seq++;
+          size = 2 * size + 1;
+        }
+
+        while (size - 1 != x) {
+          size = (size - 1) >> 1;
+          seq--;
+          x = x % size;
+        }
+
+        return std::pow(y, seq);
+      }
+
+
+      SatSolver::SatSolver() {
+        this->consistent = true;
+        this->head       = 0;
+        this->increment  = 1.0;
+      }
+
+
+      triton::sint32 SatSolver::newVariable(void) {
+        triton::uint32 var = static_cast<triton::uint32>(this->assigns.size());
+
+        this->assigns.push_back(UNDEF);
+        this->levels.push_back(0);
+        this->reasons.push_back(NONE);
+        this->phases.push_back(false);
+        this->activities.push_back(0.0);
+        this->positions.push_back(NONE);
+        this->seen.push_back(false);
+        this->watches.emplace_back();
+        this->watches.emplace_back();
+        this->heapInsert(var);
+
+        return static_cast<triton::sint32>(var + 1);
+      }
+
+
+      triton::usize SatSolver::getNumberOfVariables(void) const {
+        return this->assigns.size();
+      }
+
+
+      triton::usize SatSolver::getNumberOfClauses(void) const {
+        return this->clauses.size();
+      }
+
+
+      triton::uint32 SatSolver::toInternal(triton::sint32 lit) const {
+        triton::uint32 var = static_cast<triton::uint32>(std::abs(lit));
+
+        if (lit == 0 || var > this->assigns.size())
+          throw triton::exceptions::SolverEngine("SatSolver::toInternal(): Invalid literal.");
+
+        return (var - 1) * 2 + (lit < 0 ? 1 : 0);
+      }
+
+
+      triton::sint8 SatSolver::value(triton::uint32 lit) const {
+        triton::sint8 value = this->assigns[lit >> 1];
+        if (value == UNDEF)
+          return UNDEF;
+        return value ^ static_cast<triton::sint8>(lit & 1);
+      }
+
+
+      triton::uint32 SatSolver::getLevel(void) const {
+        return static_cast<triton::uint32>(this->trailLimits.size());
+      }
+
+
+      void SatSolver::enqueue(triton::uint32 lit, triton::uint32 reason) {
+        triton::uint32 var = lit >> 1;
+        this->assigns[var] = (lit & 1) ? 0 : 1;
+        this->levels[var]  = this->getLevel();
+        this->reasons[var] = reason;
+        this->trail.push_back(lit);
+      }
+
+
+      triton::uint32 SatSolver::attach(const std::vector<triton::uint32>& lits) {
+        triton::uint32 index = static_cast<triton::uint32>(this->clauses.size());
+        this->clauses.push_back(lits);
+        this->watches[lits[0]].push_back(index);
+        this->watches[lits[1]].push_back(index);
+        return index;
+      }
+
+
+      void SatSolver::addClause(const std::vector<triton::sint32>& lits) {
+        std::vector<triton::uint32> clause;
+
+        if (this->consistent == false)
+          return;
+
+        /* Only the assignments of level 0 are kept between the searches */
+        this->backtrack(0);
+
+        for (triton::sint32 lit : lits) {
+          triton::uint32 l = this->toInternal(lit);
+          triton::sint8 v = this->value(l);
+
+          /* Satisfied, or a tautology */
+          if (v == 1 || std::find(clause.begin(), clause.end(), l ^ 1) != clause.end())
+            return;
+
+          if (v == 0 || std::find(clause.begin(), clause.end(), l) != clause.end())
+            continue;
+
+          clause.push_back(l);
+        }
+
+        if (clause.empty()) {
+          this->consistent = false;
+        }
+        else if (clause.size() == 1) {
+          this->enqueue(clause[0], NONE);
+          if (this->propagate() != NONE)
+            this->consistent = false;
+        }
+        else {
+          this->attach(clause);
+        }
+      }
+
+
+      triton::uint32 SatSolver::propagate(void) {
+        triton::uint32 conflict = NONE;
+
+        while (this->head < this->trail.size() && conflict == NONE) {
+          triton::uint32 falseLit = this->trail[this->head++] ^ 1;
+          std::vector<triton::uint32>& ws = this->watches[falseLit];
+          triton::usize i = 0;
+          triton::usize j = 0;
+
+          for (; i < ws.size(); i++) {
+            triton::uint32 index = ws[i];
+            std::vector<triton::uint32>& c = this->clauses[index];
+
+            /* The false literal is the second one */
+            if (c[0] == falseLit)
+              std::swap(c[0], c[1]);
+
+            if (this->value(c[0]) == 1) {
+              ws[j++] = index;
+              continue;
+            }
+
+            /* Looks for another literal to watch */
+            bool found = false;
+            for (triton::usize k = 2; k < c.size(); k++) {
+              if (this->value(c[k]) != 0) {
+                std::swap(c[1], c[k]);
+                this->watches[c[1]].push_back(index);
+                found = true;
+                break;
+              }
+            }
+
+            if (found)
+              continue;
+
+            /* Unit or conflicting */
+            ws[j++] = index;
+            if (this->value(c[0]) == 0) {
+              conflict = index;
+              for (i++; i < ws.size(); i++)
+                ws[j++] = ws[i];
+              break;
+            }
+            this->enqueue(c[0], index);
+          }
+
+          ws.resize(j);
+        }
+
+        return conflict;
+      }
+
+
+      triton::uint32 SatSolver::analyze(triton::uint32 conflict, std::vector<triton::uint32>& learnt) {
+        triton::uint32 pending = 0;
+        triton::uint32 lit     = NONE;
+        triton::uint32 index   = conflict;
+        triton::usize  cursor  = this->trail.size();
+
+        learnt.clear();
+        learnt.push_back(0);
+
+        /* Resolves the literals of the current level up to the first unique implication point */
+        do {
+          const std::vector<triton::uint32>& c = this->clauses[index];
+
+          for (triton::usize i = (lit == NONE ? 0 : 1); i < c.size(); i++) {
+            triton::uint32 var = c[i] >> 1;
+            if (this->seen[var] || this->levels[var] == 0)
+              continue;
+            this->seen[var] = true;
+            this->bump(var);
+            if (this->levels[var] >= this->getLevel())
+              pending++;
+            else
+              learnt.push_back(c[i]);
+          }
+
+          while (!this->seen[this->trail[--cursor] >> 1]);
+          lit   = this->trail[cursor];
+          index = this->reasons[lit >> 1];
+          this->seen[lit >> 1] = false;
+          pending--;
+        } while (pending > 0);
+
+        learnt[0] = lit ^ 1;
+
+        /* The second literal is the one of the highest level below */
+        triton::uint32 level = 0;
+        for (triton::usize i = 1; i < learnt.size(); i++) {
+          if (this->levels[learnt[i] >> 1] > level) {
+            level = this->levels[learnt[i] >> 1];
+            std::swap(learnt[1], learnt[i]);
+          }
+        }
+
+        for (triton::uint32 l : learnt)
+          this->seen[l >> 1] = false;
+
+        return level;
+      }
+
+
+      void SatSolver::backtrack(triton::uint32 level) {
+        if (this->getLevel() <= level)
+          return;
+
+        for (triton::usize i = this->trail.size(); i > this->trailLimits[level]; i--) {
+          triton::uint32 var = this->trail[i - 1] >> 1;
+          this->phases[var]  = (this->assigns[var] == 1);
+          this->assigns[var] = UNDEF;
+          this->reasons[var] = NONE;
+          if (this->positions[var] == NONE)
+            this->heapInsert(var);
+        }
+
+        this->trail.resize(this->trailLimits[level]);
+        this->trailLimits.resize(level);
+        this->head = this->trail.size();
+      }
+
+
+      void SatSolver::bump(triton::uint32 var) {
+        this->activities[var] += this->increment;
+
+        /* Rescales before the activities overflow */
+        if (this->activities[var] > 1e100) {
+          for (auto& activity : this->activities)
+            activity *= 1e-100;
+          this->increment *= 1e-100;
+        }
+
+        if (this->positions[var] != NONE)
+          this->heapUp(this->positions[var]);
+      }
+
+
+      void SatSolver::heapUp(triton::uint32 index) {
+        triton::uint32 var = this->heap[index];
+
+        while (index > 0) {
+          triton::uint32 parent = (index - 1) / 2;
+          if (this->activities[this->heap[parent]] >= this->activities[var])
+            break;
+          this->heap[index] = this->heap[parent];
+          this->positions[this->heap[index]] = index;
+          index = parent;
+        }
+
+        this->heap[index] = var;
+        this->positions[var] = index;
+      }
+
+
+      void SatSolver::heapDown(triton::uint32 index) {
+        triton::uint32 var  = this->heap[index];
+        triton::uint32 size = static_cast<triton::uint32>(this->heap.size());
+
+        while (true) {
+          triton::uint32 child = 2 * index + 1;
+          if (child >= size)
+            break;
+          if (child + 1 < size && this->activities[this->heap[child + 1]] > this->activities[this->heap[child]])
+            child++;
+          if (this->activities[this->heap[child]] <= this->activities[var])
+            break;
+          this->heap[index] = this->heap[child];
+          this->positions[this->heap[index]] = index;
+          index = child;
+        }
+
+        this->heap[index] = var;
+        this->positions[var] = index;
+      }
+
+
+      void SatSolver::heapInsert(triton::uint32 var) {
+        this->positions[var] = static_cast<triton::uint32>(this->heap.size());
+        this->heap.push_back(var);
+        this->heapUp(this->positions[var]);
+      }
+
+
+      triton::uint32 SatSolver::heapPop(void) {
+        triton::uint32 var  = this->heap.front();
+        triton::uint32 last = this->heap.back();
+
+        this->heap.pop_back();
+        this->positions[var] = NONE;
+
+        if (!this->heap.empty()) {
+          this->heap[0] = last;
+          this->positions[last] = 0;
+          this->heapDown(0);
+        }
+
+        return var;
+      }
+
+
+      triton::engines::solver::status_e SatSolver::solve(triton::uint32 timeout, const triton::engines::solver::SolverInterrupt* interrupt) {
+        std::vector<triton::uint32> learnt;
+        auto start = std::chrono::steady_clock::now();
+        triton::uint32 restarts = 0;
+        triton::uint64 steps = 0;
+
+        if (this->consistent == false)
+          return triton::engines::solver::UNSAT;
+
+        this->backtrack(0);
+
+        while (true) {
+          triton::uint64 budget = static_cast<triton::uint64>(luby(2, restarts++) * RESTART_BASE);
+          triton::uint64 conflicts = 0;
+
+          while (true) {
+            /* The clock is read every few steps */
+            if ((++steps & 0x3ff) == 0) {
+              if (interrupt != nullptr && interrupt->isInterrupted())
+                return triton::engines::solver::UNKNOWN;
+              if (timeout && std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(timeout))
+                return triton::engines::solver::TIMEOUT;
+            }
+
+            triton::uint32 conflict = this->propagate();
+
+            if (conflict != NONE) {
+              if (this->getLevel() == 0) {
+                this->consistent = false;
+                return triton::engines::solver::UNSAT;
+              }
+
+              triton::uint32 level = this->analyze(conflict, learnt);
+              this->backtrack(level);
+              if (learnt.size() == 1)
+                this->enqueue(learnt[0], NONE);
+              else
+                this->enqueue(learnt[0], this->attach(learnt));
+
+              this->increment /= DECAY;
+              conflicts++;
+              continue;
+            }
+
+            if (conflicts >= budget) {
+              this->backtrack(0);
+              break;
+            }
+
+            /* Decides on the most active unassigned variable */
+            triton::uint32 next = NONE;
+            while (!this->heap.empty()) {
+              triton::uint32 var = this->heapPop();
+              if (this->assigns[var] == UNDEF) {
+                next = var;
+                break;
+              }
+            }
+
+            /* Every variable is assigned */
+            if (next == NONE)
+              return triton::engines::solver::SAT;
+
+            this->trailLimits.push_back(static_cast<triton::uint32>(this->trail.size()));
+            this->enqueue(2 * next + (this->phases[next] ? 0 : 1), NONE);
+          }
+        }
+      }
+
+
+      bool SatSolver::getValue(triton::sint32 lit) const {
+        return this->value(this->toInternal(lit)) == 1;
+      }
+
+    }; /* solver namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
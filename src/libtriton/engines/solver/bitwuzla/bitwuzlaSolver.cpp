@@ -5,6 +5,7 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
 #include <fstream>
 #include <regex>
 #include <string>
@@ -23,12 +24,43 @@ namespace triton {
   namespace engines {
     namespace solver {
 
+      /* The number of queries after which the terms of the shared manager are released */
+      static const triton::usize termMgrRelease = 64;
+
+
       BitwuzlaSolver::BitwuzlaSolver() {
         this->timeout = 0;
         this->memoryLimit = 0;
+        this->termMgrQueries = 0;
 
         // Set bitwuzla abort function.
         bitwuzla_set_abort_callback(this->abortCallback);
+
+        this->termMgr = bitwuzla_term_manager_new();
+      }
+
+
+      BitwuzlaSolver::~BitwuzlaSolver() {
+        bitwuzla_term_manager_delete(this->termMgr);
+      }
+
+
+      BitwuzlaTermManager* BitwuzlaSolver::acquireTermManager(const std::unique_lock<std::mutex>& guard) const {
+        return guard.owns_lock() ? this->termMgr : bitwuzla_term_manager_new();
+      }
+
+
+      void BitwuzlaSolver::releaseTermManager(BitwuzlaTermManager* tm, const std::unique_lock<std::mutex>& guard) const {
+        if (guard.owns_lock() == false) {
+          bitwuzla_term_manager_delete(tm);
+          return;
+        }
+
+        // The terms of the previous queries are kept so that their common subterms are shared, up to a bound.
+        if (++this->termMgrQueries >= termMgrRelease) {
+          bitwuzla_term_manager_release(tm);
+          this->termMgrQueries = 0;
+        }
       }
 
 
@@ -38,6 +70,11 @@ namespace triton {
         // Count elapsed time.
         auto delta = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - p->start).count();
 
+        // Check interruption from another thread.
+        if (p->interrupt && p->interrupt->isInterrupted()) {
+          return 1;
+        }
+
         // Check timeout expired.
         if (p->timeout && delta > p->timeout) {
           p->status = triton::engines::solver::TIMEOUT;
@@ -92,6 +129,16 @@ namespace triton {
                                                                                             triton::engines::solver::status_e* status,
                                                                                             triton::uint32 timeout,
                                                                                             triton::uint32* solvingTime) const {
+        return this->getModels(node, limit, status, timeout, solvingTime, nullptr);
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> BitwuzlaSolver::getModels(const triton::ast::SharedAbstractNode& node,
+                                                                                            triton::uint32 limit,
+                                                                                            triton::engines::solver::status_e* status,
+                                                                                            triton::uint32 timeout,
+                                                                                            triton::uint32* solvingTime,
+                                                                                            triton::engines::solver::SolverInterrupt* interrupt) const {
         if (node == nullptr)
           throw triton::exceptions::SolverEngine("BitwuzlaSolver::getModels(): Node cannot be null.");
 
@@ -101,7 +148,19 @@ namespace triton {
         // Create solver.
         auto bzlaOptions = bitwuzla_options_new();
         bitwuzla_set_option(bzlaOptions, BITWUZLA_OPT_PRODUCE_MODELS, 1);
-        auto bzlaTermMgr = bitwuzla_term_manager_new();
+
+        // Configure the solver for the class of the query.
+        const auto& config = this->queries.selectConfiguration(node);
+        if (config.rewriteLevel >= 0) {
+          bitwuzla_set_option(bzlaOptions, BITWUZLA_OPT_REWRITE_LEVEL, config.rewriteLevel);
+        }
+        if (!config.satSolver.empty()) {
+          bitwuzla_set_option_mode(bzlaOptions, BITWUZLA_OPT_SAT_SOLVER, config.satSolver.c_str());
+        }
+
+        // The shared term manager is used by one query at a time.
+        std::unique_lock<std::mutex> guard(this->termMgrLock, std::try_to_lock);
+        auto bzlaTermMgr = this->acquireTermManager(guard);
         auto bzla = bitwuzla_new(bzlaTermMgr, bzlaOptions);
 
         // Convert Triton' AST to solver terms.
@@ -112,7 +171,8 @@ namespace triton {
 
         // Set solving params.
         SolverParams p(tmout, this->memoryLimit);
-        if (tmout || this->memoryLimit) {
+        p.interrupt = interrupt;
+        if (tmout || this->memoryLimit || interrupt) {
           bitwuzla_set_termination_callback(bzla, this->terminateCallback, reinterpret_cast<void*>(&p));
         }
 
@@ -186,13 +246,145 @@ namespace triton {
           *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
 
         bitwuzla_delete(bzla);
-        bitwuzla_term_manager_delete(bzlaTermMgr);
+        this->releaseTermManager(bzlaTermMgr, guard);
         bitwuzla_options_delete(bzlaOptions);
 
         return ret;
       }
 
 
+      triton::usize BitwuzlaSolver::enumerateModels(const triton::ast::SharedAbstractNode& node,
+                                                    const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection,
+                                                    const ModelCallback& callback,
+                                                    triton::uint32 limit,
+                                                    triton::engines::solver::status_e* status,
+                                                    triton::uint32 timeout,
+                                                    triton::uint32* solvingTime) const {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("BitwuzlaSolver::enumerateModels(): Node cannot be null.");
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("BitwuzlaSolver::enumerateModels(): Must be a logical node.");
+
+        if (callback == nullptr)
+          throw triton::exceptions::SolverEngine("BitwuzlaSolver::enumerateModels(): The callback must be defined.");
+
+        auto vars = SolverInterface::getProjection(node, projection);
+
+        // Create solver.
+        auto bzlaOptions = bitwuzla_options_new();
+        bitwuzla_set_option(bzlaOptions, BITWUZLA_OPT_PRODUCE_MODELS, 1);
+
+        // Configure the solver for the class of the query.
+        const auto& config = this->queries.selectConfiguration(node);
+        if (config.rewriteLevel >= 0) {
+          bitwuzla_set_option(bzlaOptions, BITWUZLA_OPT_REWRITE_LEVEL, config.rewriteLevel);
+        }
+        if (!config.satSolver.empty()) {
+          bitwuzla_set_option_mode(bzlaOptions, BITWUZLA_OPT_SAT_SOLVER, config.satSolver.c_str());
+        }
+
+        // The shared term manager is used by one query at a time.
+        std::unique_lock<std::mutex> guard(this->termMgrLock, std::try_to_lock);
+        auto bzlaTermMgr = this->acquireTermManager(guard);
+        auto bzla = bitwuzla_new(bzlaTermMgr, bzlaOptions);
+        triton::usize count = 0;
+
+        try {
+          // Convert Triton' AST to solver terms, the variables of the projection share the terms of the query.
+          auto bzlaAst = triton::ast::TritonToBitwuzla();
+          bitwuzla_assert(bzla, bzlaAst.convert(node, bzla));
+
+          std::vector<BitwuzlaTerm> terms;
+          terms.reserve(vars.size());
+          for (const auto& var : vars) {
+            terms.push_back(bzlaAst.convert(node->getContext()->variable(var), bzla));
+          }
+
+          auto tmout = timeout != 0 ? timeout : this->timeout;
+
+          // Set solving params.
+          SolverParams p(tmout, this->memoryLimit);
+          if (tmout || this->memoryLimit) {
+            bitwuzla_set_termination_callback(bzla, this->terminateCallback, reinterpret_cast<void*>(&p));
+          }
+
+          // Get time of solving start.
+          auto start = std::chrono::system_clock::now();
+
+          while (true) {
+            // The timeout applies to each check.
+            p.start = std::chrono::system_clock::now();
+            auto res = bitwuzla_check_sat(bzla);
+
+            // Write back status.
+            if (status) {
+              switch (res) {
+                case BITWUZLA_SAT:
+                  *status = triton::engines::solver::SAT;
+                  break;
+                case BITWUZLA_UNSAT:
+                  *status = triton::engines::solver::UNSAT;
+                  break;
+                case BITWUZLA_UNKNOWN:
+                  *status = p.status;
+                  break;
+              }
+            }
+
+            if (res != BITWUZLA_SAT) {
+              break;
+            }
+
+            // Parse the model of the projection.
+            std::vector<BitwuzlaTerm> solution;
+            solution.reserve(terms.size());
+            std::unordered_map<triton::usize, SolverModel> model;
+            for (triton::usize i = 0; i < terms.size(); i++) {
+              auto cur_val = bitwuzla_get_value(bzla, terms[i]);
+              auto m = SolverModel(vars[i], this->fromBvalueToUint512(bitwuzla_term_value_get_str_fmt(cur_val, 2)));
+              model[m.getId()] = m;
+
+              // Negate the projection of the model only.
+              auto n = bitwuzla_mk_term2(bzlaTermMgr, BITWUZLA_KIND_EQUAL, terms[i], cur_val);
+              solution.push_back(bitwuzla_mk_term1(bzlaTermMgr, BITWUZLA_KIND_NOT, n));
+            }
+
+            count++;
+            if (callback(model) == false || solution.empty() || count == limit) {
+              break;
+            }
+
+            // Escape last model.
+            if (solution.size() > 1) {
+              bitwuzla_assert(bzla, bitwuzla_mk_term(bzlaTermMgr, BITWUZLA_KIND_OR, solution.size(), solution.data()));
+            }
+            else {
+              bitwuzla_assert(bzla, solution.front());
+            }
+          }
+
+          // Get time of solving end.
+          auto end = std::chrono::system_clock::now();
+
+          if (solvingTime)
+            *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+        }
+        catch (...) {
+          bitwuzla_delete(bzla);
+          this->releaseTermManager(bzlaTermMgr, guard);
+          bitwuzla_options_delete(bzlaOptions);
+          throw;
+        }
+
+        bitwuzla_delete(bzla);
+        this->releaseTermManager(bzlaTermMgr, guard);
+        bitwuzla_options_delete(bzlaOptions);
+
+        return count;
+      }
+
+
       bool BitwuzlaSolver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
         triton::engines::solver::status_e st;
 
@@ -205,6 +397,64 @@ namespace triton {
       }
 
 
+      std::vector<triton::usize> BitwuzlaSolver::getUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 timeout) const {
+        std::vector<triton::usize> ret;
+
+        for (const auto& node : nodes) {
+          if (node == nullptr)
+            throw triton::exceptions::SolverEngine("BitwuzlaSolver::getUnsatCore(): Node cannot be null.");
+          if (node->isLogical() == false)
+            throw triton::exceptions::SolverEngine("BitwuzlaSolver::getUnsatCore(): Must be a logical node.");
+        }
+
+        if (nodes.empty())
+          return ret;
+
+        // Create solver.
+        auto bzlaOptions = bitwuzla_options_new();
+        bitwuzla_set_option(bzlaOptions, BITWUZLA_OPT_PRODUCE_UNSAT_CORES, 1);
+
+        // The shared term manager is used by one query at a time.
+        std::unique_lock<std::mutex> guard(this->termMgrLock, std::try_to_lock);
+        auto bzlaTermMgr = this->acquireTermManager(guard);
+        auto bzla = bitwuzla_new(bzlaTermMgr, bzlaOptions);
+
+        // Assert each constraint on its own, so that the core is made of them.
+        auto bzlaAst = triton::ast::TritonToBitwuzla();
+        std::unordered_map<BitwuzlaTerm, triton::usize> positions;
+        for (triton::usize index = 0; index < nodes.size(); index++) {
+          auto term = bzlaAst.convert(nodes[index], bzla);
+          bitwuzla_assert(bzla, term);
+          positions.emplace(term, index);
+        }
+
+        auto tmout = timeout != 0 ? timeout : this->timeout;
+
+        // Set solving params.
+        SolverParams p(tmout, this->memoryLimit);
+        if (tmout || this->memoryLimit) {
+          bitwuzla_set_termination_callback(bzla, this->terminateCallback, reinterpret_cast<void*>(&p));
+        }
+
+        if (bitwuzla_check_sat(bzla) == BITWUZLA_UNSAT) {
+          size_t size = 0;
+          const BitwuzlaTerm* core = bitwuzla_get_unsat_core(bzla, &size);
+          for (size_t i = 0; i < size; i++) {
+            auto it = positions.find(core[i]);
+            if (it != positions.end())
+              ret.push_back(it->second);
+          }
+          std::sort(ret.begin(), ret.end());
+        }
+
+        bitwuzla_delete(bzla);
+        this->releaseTermManager(bzlaTermMgr, guard);
+        bitwuzla_options_delete(bzlaOptions);
+
+        return ret;
+      }
+
+
       std::unordered_map<triton::usize, SolverModel> BitwuzlaSolver::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
         auto models = this->getModels(node, 1, status, timeout, solvingTime);
         return models.empty() ? std::unordered_map<triton::usize, SolverModel>() : models.front();
@@ -261,6 +511,103 @@ namespace triton {
         this->memoryLimit = limit;
       }
 
+
+      void BitwuzlaSolver::setQueryConfigurations(const triton::engines::solver::QueryConfigurations& configurations) {
+        this->queries = configurations;
+      }
+
+
+      SolverSession* BitwuzlaSolver::newSession(void) const {
+        return new BitwuzlaSession(this);
+      }
+
+
+      BitwuzlaSession::BitwuzlaSession(const BitwuzlaSolver* parent)
+        : SolverSession(parent), parent(parent) {
+        this->bzlaOptions = bitwuzla_options_new();
+        bitwuzla_set_option(this->bzlaOptions, BITWUZLA_OPT_PRODUCE_MODELS, 1);
+        this->bzlaTermMgr = bitwuzla_term_manager_new();
+        this->bzla = bitwuzla_new(this->bzlaTermMgr, this->bzlaOptions);
+      }
+
+
+      BitwuzlaSession::~BitwuzlaSession() {
+        bitwuzla_delete(this->bzla);
+        bitwuzla_term_manager_delete(this->bzlaTermMgr);
+        bitwuzla_options_delete(this->bzlaOptions);
+      }
+
+
+      void BitwuzlaSession::push(const triton::ast::SharedAbstractNode& node) {
+        auto term = this->bzlaAst.convert(node, this->bzla);
+        bitwuzla_push(this->bzla, 1);
+        bitwuzla_assert(this->bzla, term);
+      }
+
+
+      void BitwuzlaSession::pop(void) {
+        bitwuzla_pop(this->bzla, 1);
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> BitwuzlaSession::check(const triton::ast::SharedAbstractNode& node, bool model, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+        std::unordered_map<triton::usize, SolverModel> ret;
+
+        // The query is an assumption, the asserted constraints are kept.
+        BitwuzlaTerm assumption = this->bzlaAst.convert(node, this->bzla);
+
+        auto tmout = timeout != 0 ? timeout : this->parent->timeout;
+
+        // Set solving params.
+        BitwuzlaSolver::SolverParams p(tmout, this->parent->memoryLimit);
+        if (tmout || this->parent->memoryLimit) {
+          bitwuzla_set_termination_callback(this->bzla, BitwuzlaSolver::terminateCallback, reinterpret_cast<void*>(&p));
+        }
+
+        // Get time of solving start.
+        auto start = std::chrono::system_clock::now();
+
+        // Check result.
+        auto res = bitwuzla_check_sat_assuming(this->bzla, 1, &assumption);
+
+        // Get time of solving end.
+        auto end = std::chrono::system_clock::now();
+
+        // The params do not outlive the query.
+        if (tmout || this->parent->memoryLimit) {
+          bitwuzla_set_termination_callback(this->bzla, nullptr, nullptr);
+        }
+
+        if (solvingTime)
+          *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+        // Write back status.
+        if (status) {
+          switch (res) {
+            case BITWUZLA_SAT:
+              *status = triton::engines::solver::SAT;
+              break;
+            case BITWUZLA_UNSAT:
+              *status = triton::engines::solver::UNSAT;
+              break;
+            case BITWUZLA_UNKNOWN:
+              *status = p.status;
+              break;
+          }
+        }
+
+        // Parse model.
+        if (model && res == BITWUZLA_SAT) {
+          for (const auto& it : this->bzlaAst.getVariables()) {
+            const char* svalue = bitwuzla_term_value_get_str_fmt(bitwuzla_get_value(this->bzla, it.first), 2);
+            auto m = SolverModel(it.second, this->parent->fromBvalueToUint512(svalue));
+            ret[m.getId()] = m;
+          }
+        }
+
+        return ret;
+      }
+
       triton::uint512 BitwuzlaSolver::fromBvalueToUint512(const char* value) const {
         triton::usize   len = strlen(value);
         triton::usize   pos = 0;
@@ -0,0 +1,199 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+
+#include <triton/denseModel.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicEnums.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      DenseModel::DenseModel() {
+      }
+
+
+      DenseModel::DenseModel(const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model) {
+        this->entries.reserve(model.size());
+
+        for (const auto& it : model) {
+          const auto& var = it.second.getVariable();
+          const triton::uint512& value = it.second.getValue();
+          Entry entry;
+
+          entry.id      = it.first;
+          entry.size    = var->getSize();
+          entry.memory  = (var->getType() == triton::engines::symbolic::MEMORY_VARIABLE);
+          entry.address = entry.memory ? var->getOrigin() : 0;
+
+          if (entry.size <= 64) {
+            entry.value = static_cast<triton::uint64>(value);
+          }
+          else {
+            entry.value = this->wides.size();
+            this->wides.push_back(value);
+          }
+
+          this->entries.push_back(entry);
+        }
+
+        std::sort(this->entries.begin(), this->entries.end(), [](const Entry& a, const Entry& b) { return a.id < b.id; });
+      }
+
+
+      const DenseModel::Entry* DenseModel::find(triton::usize id) const {
+        auto it = std::lower_bound(this->entries.begin(), this->entries.end(), id, [](const Entry& entry, triton::usize id) { return entry.id < id; });
+        if (it == this->entries.end() || it->id != id)
+          return nullptr;
+        return &(*it);
+      }
+
+
+      void DenseModel::set(const triton::engines::symbolic::SharedSymbolicVariable& variable, const triton::uint512& value) {
+        if (variable == nullptr)
+          throw triton::exceptions::SolverModel("DenseModel::set(): The variable cannot be null.");
+
+        triton::usize id = variable->getId();
+        auto it = std::lower_bound(this->entries.begin(), this->entries.end(), id, [](const Entry& entry, triton::usize id) { return entry.id < id; });
+
+        if (it == this->entries.end() || it->id != id) {
+          Entry entry;
+          entry.id   = id;
+          entry.size = 0;
+          it = this->entries.insert(it, entry);
+        }
+
+        /* A wide value already kept is overwritten in place */
+        bool wide = (it->size > 64);
+
+        it->size    = variable->getSize();
+        it->memory  = (variable->getType() == triton::engines::symbolic::MEMORY_VARIABLE);
+        it->address = it->memory ? variable->getOrigin() : 0;
+
+        if (it->size <= 64) {
+          it->value = static_cast<triton::uint64>(value);
+        }
+        else if (wide) {
+          this->wides[static_cast<triton::usize>(it->value)] = value;
+        }
+        else {
+          it->value = this->wides.size();
+          this->wides.push_back(value);
+        }
+      }
+
+
+      triton::usize DenseModel::size(void) const {
+        return this->entries.size();
+      }
+
+
+      bool DenseModel::empty(void) const {
+        return this->entries.empty();
+      }
+
+
+      bool DenseModel::contains(triton::usize id) const {
+        return this->find(id) != nullptr;
+      }
+
+
+      triton::usize DenseModel::indexOf(triton::usize id) const {
+        const Entry* entry = this->find(id);
+        if (entry == nullptr)
+          return DenseModel::npos;
+        return static_cast<triton::usize>(entry - this->entries.data());
+      }
+
+
+      triton::usize DenseModel::getId(triton::usize index) const {
+        if (index >= this->entries.size())
+          throw triton::exceptions::SolverModel("DenseModel::getId(): Invalid index.");
+        return this->entries[index].id;
+      }
+
+
+      triton::uint32 DenseModel::getSize(triton::usize index) const {
+        if (index >= this->entries.size())
+          throw triton::exceptions::SolverModel("DenseModel::getSize(): Invalid index.");
+        return this->entries[index].size;
+      }
+
+
+      triton::uint512 DenseModel::getValue(triton::usize index) const {
+        if (index >= this->entries.size())
+          throw triton::exceptions::SolverModel("DenseModel::getValue(): Invalid index.");
+
+        const Entry& entry = this->entries[index];
+        if (entry.size <= 64)
+          return entry.value;
+        return this->wides[static_cast<triton::usize>(entry.value)];
+      }
+
+
+      triton::uint512 DenseModel::getValueOf(triton::usize id) const {
+        triton::usize index = this->indexOf(id);
+        if (index == DenseModel::npos)
+          return 0;
+        return this->getValue(index);
+      }
+
+
+      bool DenseModel::isMemory(triton::usize index) const {
+        if (index >= this->entries.size())
+          throw triton::exceptions::SolverModel("DenseModel::isMemory(): Invalid index.");
+        return this->entries[index].memory;
+      }
+
+
+      triton::uint64 DenseModel::getAddress(triton::usize index) const {
+        if (index >= this->entries.size())
+          throw triton::exceptions::SolverModel("DenseModel::getAddress(): Invalid index.");
+        return this->entries[index].address;
+      }
+
+
+      void DenseModel::clear(void) {
+        this->entries.clear();
+        this->wides.clear();
+      }
+
+
+      triton::usize applyModelToBuffer(const DenseModel& model, triton::uint64 baseAddr, triton::usize size, triton::uint8* out) {
+        triton::usize written = 0;
+
+        if (out == nullptr && size != 0)
+          throw triton::exceptions::SolverModel("applyModelToBuffer(): The buffer cannot be null.");
+
+        for (triton::usize index = 0; index < model.size(); index++) {
+          if (model.isMemory(index) == false)
+            continue;
+
+          triton::uint64 addr  = model.getAddress(index);
+          triton::uint32 bytes = (model.getSize(index) + 7) / 8;
+          triton::uint512 value = model.getValue(index);
+
+          for (triton::uint32 i = 0; i < bytes; i++) {
+            triton::uint64 offset = addr + i - baseAddr;
+            if (addr + i >= baseAddr && offset < size) {
+              out[offset] = static_cast<triton::uint8>(value & 0xff);
+              written++;
+            }
+            value >>= 8;
+          }
+        }
+
+        return written;
+      }
+
+    };
+  };
+};
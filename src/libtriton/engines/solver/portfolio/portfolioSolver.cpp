@@ -0,0 +1,155 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include <triton/exceptions.hpp>
+#include <triton/portfolioSolver.hpp>
+#include <triton/solverInterrupt.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      PortfolioSolver::PortfolioSolver() {
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> PortfolioSolver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        return this->getModels(node, limit, status, timeout, solvingTime, nullptr);
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> PortfolioSolver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime, triton::engines::solver::SolverInterrupt* interrupt) const {
+        /* The answer of a solver */
+        struct Racer {
+          SolverInterrupt interrupt;
+          triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+          std::vector<std::unordered_map<triton::usize, SolverModel>> models;
+          triton::uint32 time = 0;
+          std::exception_ptr error;
+        };
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("PortfolioSolver::getModels(): node cannot be null.");
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("PortfolioSolver::getModels(): Must be a logical node.");
+
+        Racer racers[2];
+        std::mutex lock;
+        triton::usize winner = 2;
+
+        /* The first definitive answer interrupts the other solver */
+        auto race = [&](triton::usize index) {
+          Racer& racer = racers[index];
+          try {
+            if (index == 0)
+              racer.models = this->z3.getModels(node, limit, &racer.status, timeout, &racer.time, &racer.interrupt);
+            else
+              racer.models = this->bitwuzla.getModels(node, limit, &racer.status, timeout, &racer.time, &racer.interrupt);
+          }
+          catch (...) {
+            racer.error = std::current_exception();
+            return;
+          }
+
+          if (racer.status == triton::engines::solver::SAT || racer.status == triton::engines::solver::UNSAT) {
+            std::lock_guard<std::mutex> guard(lock);
+            if (winner == 2) {
+              winner = index;
+              racers[index ^ 1].interrupt.interrupt();
+            }
+          }
+        };
+
+        /* An interrupted query interrupts both solvers */
+        if (interrupt != nullptr)
+          interrupt->setHandler([&racers]() { racers[0].interrupt.interrupt(); racers[1].interrupt.interrupt(); });
+
+        try {
+          std::thread thread(race, 1);
+          race(0);
+          thread.join();
+        }
+        catch (...) {
+          if (interrupt != nullptr)
+            interrupt->clearHandler();
+          throw;
+        }
+
+        if (interrupt != nullptr)
+          interrupt->clearHandler();
+
+        /* Without a definitive answer, z3 answers unless it failed */
+        if (winner == 2)
+          winner = (racers[0].error && !racers[1].error) ? 1 : 0;
+
+        if (racers[winner].error)
+          std::rethrow_exception(racers[winner].error);
+
+        if (status)
+          *status = racers[winner].status;
+
+        if (solvingTime)
+          *solvingTime = racers[winner].time;
+
+        return racers[winner].models;
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> PortfolioSolver::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        auto models = this->getModels(node, 1, status, timeout, solvingTime);
+        return models.empty() ? std::unordered_map<triton::usize, SolverModel>() : models.front();
+      }
+
+
+      triton::usize PortfolioSolver::enumerateModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, const ModelCallback& callback, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        return this->z3.enumerateModels(node, projection, callback, limit, status, timeout, solvingTime);
+      }
+
+
+      bool PortfolioSolver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+        this->getModels(node, 0, &st, timeout, solvingTime);
+        if (status)
+          *status = st;
+
+        return st == triton::engines::solver::SAT;
+      }
+
+
+      std::string PortfolioSolver::getName(void) const {
+        return "portfolio";
+      }
+
+
+      void PortfolioSolver::setTimeout(triton::uint32 ms) {
+        this->z3.setTimeout(ms);
+        this->bitwuzla.setTimeout(ms);
+      }
+
+
+      void PortfolioSolver::setMemoryLimit(triton::uint32 limit) {
+        this->z3.setMemoryLimit(limit);
+        this->bitwuzla.setMemoryLimit(limit);
+      }
+
+
+      void PortfolioSolver::setQueryConfigurations(const triton::engines::solver::QueryConfigurations& configurations) {
+        this->z3.setQueryConfigurations(configurations);
+        this->bitwuzla.setQueryConfigurations(configurations);
+      }
+
+    };
+  };
+};
@@ -0,0 +1,335 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+#include <triton/queryCanonicalizer.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* A round of xxHash64 */
+      static inline triton::uint64 hashRound(triton::uint64 acc, triton::uint64 value) {
+        acc += value * 0xc2b2ae3d27d4eb4fULL;
+        acc  = (acc << 31) | (acc >> 33);
+        return acc * 0x9e3779b185ebca87ULL;
+      }
+
+
+      /* The final mix of xxHash64 */
+      static inline triton::uint64 hashAvalanche(triton::uint64 h) {
+        h ^= h >> 33;
+        h *= 0xc2b2ae3d27d4eb4fULL;
+        h ^= h >> 29;
+        h *= 0x165667b19e3779f9ULL;
+        h ^= h >> 32;
+        return h;
+      }
+
+
+      /* Returns the node behind the references */
+      static triton::ast::AbstractNode* resolve(triton::ast::AbstractNode* node) {
+        while (node->getType() == triton::ast::REFERENCE_NODE)
+          node = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getSymbolicExpression()->getAst().get();
+        return node;
+      }
+
+
+      /* Operators whose nested applications are flattened */
+      static bool isAssociative(triton::ast::ast_e type) {
+        switch (type) {
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVMUL_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVXOR_NODE:
+          case triton::ast::LAND_NODE:
+          case triton::ast::LOR_NODE:
+          case triton::ast::LXOR_NODE:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
+      /* Operators whose operands are sorted */
+      static bool isCommutative(triton::ast::ast_e type) {
+        switch (type) {
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVMUL_NODE:
+          case triton::ast::BVNAND_NODE:
+          case triton::ast::BVNOR_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVXNOR_NODE:
+          case triton::ast::BVXOR_NODE:
+          case triton::ast::DISTINCT_NODE:
+          case triton::ast::EQUAL_NODE:
+          case triton::ast::IFF_NODE:
+          case triton::ast::LAND_NODE:
+          case triton::ast::LOR_NODE:
+          case triton::ast::LXOR_NODE:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
+      /* Returns the comparison with its operands swapped, or the same type if it is not a comparison */
+      static triton::ast::ast_e mirror(triton::ast::ast_e type) {
+        switch (type) {
+          case triton::ast::BVSGE_NODE: return triton::ast::BVSLE_NODE;
+          case triton::ast::BVSGT_NODE: return triton::ast::BVSLT_NODE;
+          case triton::ast::BVSLE_NODE: return triton::ast::BVSGE_NODE;
+          case triton::ast::BVSLT_NODE: return triton::ast::BVSGT_NODE;
+          case triton::ast::BVUGE_NODE: return triton::ast::BVULE_NODE;
+          case triton::ast::BVUGT_NODE: return triton::ast::BVULT_NODE;
+          case triton::ast::BVULE_NODE: return triton::ast::BVUGE_NODE;
+          case triton::ast::BVULT_NODE: return triton::ast::BVUGT_NODE;
+          default:
+            return type;
+        }
+      }
+
+
+      /* Returns the hash of a leaf, the variables being hashed by `variable` */
+      static triton::uint64 hashLeaf(triton::ast::AbstractNode* node, triton::uint64 seed, triton::uint64 variable) {
+        triton::uint64 h = hashRound(hashRound(seed, node->getType()), node->getBitvectorSize());
+
+        switch (node->getType()) {
+          case triton::ast::INTEGER_NODE: {
+            triton::uint512 value = reinterpret_cast<triton::ast::IntegerNode*>(node)->getInteger();
+            do {
+              h = hashRound(h, static_cast<triton::uint64>(value));
+              value >>= 64;
+            } while (value != 0);
+            break;
+          }
+
+          case triton::ast::STRING_NODE:
+            h = hashRound(h, std::hash<std::string>{}(reinterpret_cast<triton::ast::StringNode*>(node)->getString()));
+            break;
+
+          case triton::ast::VARIABLE_NODE:
+            h = hashRound(h, variable);
+            break;
+
+          default:
+            break;
+        }
+
+        return h;
+      }
+
+
+      QueryCanonicalizer::QueryCanonicalizer(const triton::ast::SharedAbstractNode& node) {
+        /* The canonical form of a node: its type and its operands, in order */
+        struct Canonical {
+          triton::ast::ast_e type;
+          std::vector<triton::ast::AbstractNode*> operands;
+          triton::uint64 shape;
+          triton::uint64 lanes[2];
+        };
+
+        std::unordered_map<triton::ast::AbstractNode*, Canonical> forms;
+        triton::ast::AbstractNode* root = resolve(node.get());
+
+        /*
+         * First pass: the shapes, where the variables only count by their size. They order
+         * the operands of the commutative operators before the variables get their positions.
+         */
+        std::vector<std::pair<triton::ast::AbstractNode*, bool>> worklist = {{root, false}};
+        while (!worklist.empty()) {
+          auto item = worklist.back();
+          worklist.pop_back();
+
+          if (forms.find(item.first) != forms.end())
+            continue;
+
+          auto& children = item.first->getChildren();
+          if (!item.second) {
+            worklist.push_back({item.first, true});
+            for (auto it = children.rbegin(); it != children.rend(); it++) {
+              auto* child = resolve(it->get());
+              if (forms.find(child) == forms.end())
+                worklist.push_back({child, false});
+            }
+            continue;
+          }
+
+          Canonical form;
+          form.type = item.first->getType();
+
+          for (const auto& child : children) {
+            auto* operand = resolve(child.get());
+            const auto& sub = forms.at(operand);
+            /* The nested applications of an associative operator are flattened */
+            if (isAssociative(form.type) && sub.type == form.type && operand->getBitvectorSize() == item.first->getBitvectorSize() && sub.operands.size() <= 16)
+              form.operands.insert(form.operands.end(), sub.operands.begin(), sub.operands.end());
+            else
+              form.operands.push_back(operand);
+          }
+
+          /* The constant of a comparison goes to the right */
+          if (form.operands.size() == 2 && mirror(form.type) != form.type) {
+            if (!form.operands[0]->isSymbolized() && form.operands[1]->isSymbolized()) {
+              std::swap(form.operands[0], form.operands[1]);
+              form.type = mirror(form.type);
+            }
+          }
+
+          if (isCommutative(form.type)) {
+            std::stable_sort(form.operands.begin(), form.operands.end(), [&](triton::ast::AbstractNode* a, triton::ast::AbstractNode* b) {
+              return forms.at(a).shape < forms.at(b).shape;
+            });
+          }
+
+          if (form.operands.empty()) {
+            form.shape = hashLeaf(item.first, 0, item.first->getBitvectorSize());
+          }
+          else {
+            triton::uint64 h = hashRound(hashRound(hashRound(0, form.type), item.first->getBitvectorSize()), form.operands.size());
+            for (auto* operand : form.operands)
+              h = hashRound(h, forms.at(operand).shape);
+            form.shape = hashAvalanche(h);
+          }
+
+          forms.emplace(item.first, std::move(form));
+        }
+
+        /* Second pass: the variables are numbered in the order they are met in the canonical form */
+        std::unordered_set<triton::ast::AbstractNode*> visited;
+        std::vector<triton::ast::AbstractNode*> stack = {root};
+        while (!stack.empty()) {
+          auto* current = stack.back();
+          stack.pop_back();
+
+          if (!visited.insert(current).second)
+            continue;
+
+          if (current->getType() == triton::ast::VARIABLE_NODE) {
+            const auto& variable = reinterpret_cast<triton::ast::VariableNode*>(current)->getSymbolicVariable();
+            if (this->positions.find(variable->getId()) == this->positions.end()) {
+              this->positions[variable->getId()] = this->variables.size();
+              this->variables.push_back(variable);
+            }
+            continue;
+          }
+
+          const auto& operands = forms.at(current).operands;
+          for (auto it = operands.rbegin(); it != operands.rend(); it++)
+            stack.push_back(*it);
+        }
+
+        /*
+         * Third pass: the hash of the canonical form, on two lanes of different seeds. The
+         * commutative operators combine the hashes of their operands sorted, so that the
+         * operands of the same shape do not depend on their original order.
+         */
+        static const triton::uint64 seeds[2] = {0x27d4eb2f165667c5ULL, 0x85ebca77c2b2ae63ULL};
+        std::vector<triton::ast::AbstractNode*> order;
+        visited.clear();
+        std::vector<std::pair<triton::ast::AbstractNode*, bool>> postorder = {{root, false}};
+        while (!postorder.empty()) {
+          auto item = postorder.back();
+          postorder.pop_back();
+
+          if (item.second) {
+            order.push_back(item.first);
+            continue;
+          }
+
+          if (!visited.insert(item.first).second)
+            continue;
+
+          postorder.push_back({item.first, true});
+          for (auto* operand : forms.at(item.first).operands) {
+            if (visited.find(operand) == visited.end())
+              postorder.push_back({operand, false});
+          }
+        }
+
+        for (auto* current : order) {
+          auto& form = forms.at(current);
+          for (triton::uint32 lane = 0; lane < 2; lane++) {
+            if (form.operands.empty()) {
+              triton::uint64 variable = 0;
+              if (current->getType() == triton::ast::VARIABLE_NODE)
+                variable = this->positions.at(reinterpret_cast<triton::ast::VariableNode*>(current)->getSymbolicVariable()->getId());
+              form.lanes[lane] = hashLeaf(current, seeds[lane], variable);
+              continue;
+            }
+
+            std::vector<triton::uint64> hashes;
+            hashes.reserve(form.operands.size());
+            for (auto* operand : form.operands)
+              hashes.push_back(forms.at(operand).lanes[lane]);
+
+            if (isCommutative(form.type))
+              std::sort(hashes.begin(), hashes.end());
+
+            triton::uint64 h = hashRound(hashRound(hashRound(seeds[lane], form.type), current->getBitvectorSize()), hashes.size());
+            for (auto value : hashes)
+              h = hashRound(h, value);
+            form.lanes[lane] = hashAvalanche(h);
+          }
+        }
+
+        const auto& top = forms.at(root);
+        this->hash = (static_cast<triton::uint512>(top.lanes[1]) << 64) | top.lanes[0];
+      }
+
+
+      const triton::uint512& QueryCanonicalizer::getHash(void) const {
+        return this->hash;
+      }
+
+
+      const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& QueryCanonicalizer::getVariables(void) const {
+        return this->variables;
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> QueryCanonicalizer::toPositions(const std::unordered_map<triton::usize, SolverModel>& model) const {
+        std::unordered_map<triton::usize, SolverModel> ret;
+
+        for (const auto& item : model) {
+          auto it = this->positions.find(item.first);
+          if (it != this->positions.end())
+            ret[it->second] = item.second;
+        }
+
+        return ret;
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> QueryCanonicalizer::fromPositions(const std::unordered_map<triton::usize, SolverModel>& model) const {
+        std::unordered_map<triton::usize, SolverModel> ret;
+
+        for (const auto& item : model) {
+          if (item.first >= this->variables.size())
+            continue;
+          const auto& variable = this->variables[item.first];
+          ret[variable->getId()] = SolverModel(variable, item.second.getValue());
+        }
+
+        return ret;
+      }
+
+    };
+  };
+};
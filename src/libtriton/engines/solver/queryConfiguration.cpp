@@ -0,0 +1,140 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <unordered_set>
+#include <vector>
+
+#include <triton/exceptions.hpp>
+#include <triton/queryConfiguration.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverConfiguration::SolverConfiguration(const std::string& logic, const std::string& tactics, const std::string& satSolver, triton::sint32 rewriteLevel)
+        : logic(logic), tactics(tactics), satSolver(satSolver), rewriteLevel(rewriteLevel) {
+      }
+
+
+      QueryConfigurations::QueryConfigurations() {
+        this->classification = true;
+
+        /* The solvers of the logics skip its detection, and the equalities are bit-blasted directly */
+        this->configurations[triton::engines::solver::QUERY_QF_BV]      = SolverConfiguration("QF_BV");
+        this->configurations[triton::engines::solver::QUERY_QF_ABV]     = SolverConfiguration("QF_ABV");
+        this->configurations[triton::engines::solver::QUERY_EQUALITIES] = SolverConfiguration("", "simplify;solve-eqs;bit-blast;sat");
+      }
+
+
+      void QueryConfigurations::enableClassification(bool flag) {
+        this->classification = flag;
+      }
+
+
+      bool QueryConfigurations::isClassificationEnabled(void) const {
+        return this->classification;
+      }
+
+
+      void QueryConfigurations::setConfiguration(triton::engines::solver::query_e query, const SolverConfiguration& config) {
+        if (query >= triton::engines::solver::QUERY_CLASSES)
+          throw triton::exceptions::SolverEngine("QueryConfigurations::setConfiguration(): Invalid class of query.");
+
+        if (config.rewriteLevel < -1 || config.rewriteLevel > 2)
+          throw triton::exceptions::SolverEngine("QueryConfigurations::setConfiguration(): The rewrite level must be from 0 to 2, or -1.");
+
+        this->configurations[query] = config;
+      }
+
+
+      const SolverConfiguration& QueryConfigurations::getConfiguration(triton::engines::solver::query_e query) const {
+        if (query >= triton::engines::solver::QUERY_CLASSES)
+          throw triton::exceptions::SolverEngine("QueryConfigurations::getConfiguration(): Invalid class of query.");
+
+        return this->configurations[query];
+      }
+
+
+      const SolverConfiguration& QueryConfigurations::selectConfiguration(const triton::ast::SharedAbstractNode& node) const {
+        if (this->classification == false)
+          return this->configurations[triton::engines::solver::QUERY_ANY];
+        return this->configurations[triton::engines::solver::classifyQuery(node)];
+      }
+
+
+      triton::engines::solver::query_e classifyQuery(const triton::ast::SharedAbstractNode& node) {
+        std::unordered_set<const triton::ast::AbstractNode*> visited;
+        std::vector<triton::ast::AbstractNode*> worklist = {node.get()};
+        bool equalities = true;
+        bool arrays     = false;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("triton::engines::solver::classifyQuery(): node cannot be null.");
+
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+          worklist.pop_back();
+
+          if (visited.insert(current).second == false)
+            continue;
+
+          switch (current->getType()) {
+            /* A quantified query is left to the solver detecting its logic */
+            case triton::ast::FORALL_NODE:
+              return triton::engines::solver::QUERY_ANY;
+
+            case triton::ast::ARRAY_NODE:
+            case triton::ast::SELECT_NODE:
+            case triton::ast::STORE_NODE:
+              arrays = true;
+              equalities = false;
+              break;
+
+            case triton::ast::REFERENCE_NODE:
+              worklist.push_back(reinterpret_cast<triton::ast::ReferenceNode*>(current)->getSymbolicExpression()->getAst().get());
+              continue;
+
+            /* The nodes of an equality of bits */
+            case triton::ast::ASSERT_NODE:
+            case triton::ast::BV_NODE:
+            case triton::ast::CONCAT_NODE:
+            case triton::ast::DISTINCT_NODE:
+            case triton::ast::EQUAL_NODE:
+            case triton::ast::EXTRACT_NODE:
+            case triton::ast::IFF_NODE:
+            case triton::ast::INTEGER_NODE:
+            case triton::ast::LAND_NODE:
+            case triton::ast::LNOT_NODE:
+            case triton::ast::LOR_NODE:
+            case triton::ast::VARIABLE_NODE:
+            case triton::ast::ZX_NODE:
+              break;
+
+            default:
+              equalities = false;
+              break;
+          }
+
+          for (const auto& child : current->getChildren())
+            worklist.push_back(child.get());
+        }
+
+        if (arrays)
+          return triton::engines::solver::QUERY_QF_ABV;
+
+        if (equalities)
+          return triton::engines::solver::QUERY_EQUALITIES;
+
+        return triton::engines::solver::QUERY_QF_BV;
+      }
+
+    };
+  };
+};
@@ -0,0 +1,236 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <triton/exceptions.hpp>
+#include <triton/remoteProtocol.hpp>
+
+#ifndef MSG_NOSIGNAL
+  #define MSG_NOSIGNAL 0
+#endif
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+      namespace remote {
+
+        /* The largest frame accepted, which bounds the memory taken by a broken peer */
+        static const triton::uint32 maxFrameSize = 0x40000000;
+
+
+        /* The queries are small and pipelined, they are not delayed */
+        static void setupSocket(int socket) {
+          int flag = 1;
+          ::setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+          #ifdef SO_NOSIGPIPE
+          ::setsockopt(socket, SOL_SOCKET, SO_NOSIGPIPE, &flag, sizeof(flag));
+          #endif
+        }
+
+
+        int connectTo(const std::string& endpoint) {
+          auto colon = endpoint.rfind(':');
+          if (colon == std::string::npos || colon == 0 || colon + 1 == endpoint.size())
+            return -1;
+
+          std::string host = endpoint.substr(0, colon);
+          std::string port = endpoint.substr(colon + 1);
+          struct addrinfo hints;
+          struct addrinfo* addresses = nullptr;
+          int ret = -1;
+
+          std::memset(&hints, 0, sizeof(hints));
+          hints.ai_family   = AF_UNSPEC;
+          hints.ai_socktype = SOCK_STREAM;
+
+          if (::getaddrinfo(host.c_str(), port.c_str(), &hints, &addresses) != 0)
+            return -1;
+
+          for (struct addrinfo* it = addresses; it != nullptr && ret == -1; it = it->ai_next) {
+            ret = ::socket(it->ai_family, it->ai_socktype, it->ai_protocol);
+            if (ret == -1)
+              continue;
+
+            if (::connect(ret, it->ai_addr, it->ai_addrlen) != 0) {
+              ::close(ret);
+              ret = -1;
+            }
+          }
+
+          ::freeaddrinfo(addresses);
+
+          if (ret != -1)
+            setupSocket(ret);
+
+          return ret;
+        }
+
+
+        int listenOn(triton::uint16 port, triton::uint16* bound) {
+          struct sockaddr_in address;
+          socklen_t length = sizeof(address);
+          int flag = 1;
+
+          int ret = ::socket(AF_INET, SOCK_STREAM, 0);
+          if (ret == -1)
+            return -1;
+
+          ::setsockopt(ret, SOL_SOCKET, SO_REUSEADDR, &flag, sizeof(flag));
+
+          std::memset(&address, 0, sizeof(address));
+          address.sin_family      = AF_INET;
+          address.sin_addr.s_addr = htonl(INADDR_ANY);
+          address.sin_port        = htons(port);
+
+          if (::bind(ret, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) != 0 || ::listen(ret, SOMAXCONN) != 0) {
+            ::close(ret);
+            return -1;
+          }
+
+          if (bound) {
+            if (::getsockname(ret, reinterpret_cast<struct sockaddr*>(&address), &length) != 0) {
+              ::close(ret);
+              return -1;
+            }
+            *bound = ntohs(address.sin_port);
+          }
+
+          return ret;
+        }
+
+
+        int acceptOn(int listener) {
+          int ret = ::accept(listener, nullptr, nullptr);
+          if (ret != -1)
+            setupSocket(ret);
+          return ret;
+        }
+
+
+        void shutdownSocket(int socket) {
+          ::shutdown(socket, SHUT_RDWR);
+        }
+
+
+        void closeSocket(int socket) {
+          ::close(socket);
+        }
+
+
+        void appendMessage(std::string& buffer, const triton::engines::solver::RemoteMessage& message) {
+          if (message.payload.size() + 9 > maxFrameSize)
+            throw triton::exceptions::SolverEngine("remote::appendMessage(): The query is too large.");
+
+          putNumber(buffer, message.payload.size() + 9, 4);
+          putNumber(buffer, message.kind, 1);
+          putNumber(buffer, message.id, 8);
+          buffer.append(message.payload);
+        }
+
+
+        bool sendBuffer(int socket, const std::string& buffer) {
+          triton::usize offset = 0;
+
+          while (offset < buffer.size()) {
+            auto sent = ::send(socket, buffer.data() + offset, buffer.size() - offset, MSG_NOSIGNAL);
+            if (sent <= 0)
+              return false;
+            offset += sent;
+          }
+
+          return true;
+        }
+
+
+        /* Receives exactly `size` bytes */
+        static bool receiveBytes(int socket, char* data, triton::usize size) {
+          triton::usize offset = 0;
+
+          while (offset < size) {
+            auto received = ::recv(socket, data + offset, size - offset, 0);
+            if (received <= 0)
+              return false;
+            offset += received;
+          }
+
+          return true;
+        }
+
+
+        bool receiveMessage(int socket, triton::engines::solver::RemoteMessage& message) {
+          std::string header(4, '\0');
+          triton::usize offset = 0;
+
+          if (!receiveBytes(socket, &header[0], header.size()))
+            return false;
+
+          auto size = getNumber(header, offset, 4);
+          if (size < 9 || size > maxFrameSize)
+            return false;
+
+          std::string frame(size, '\0');
+          if (!receiveBytes(socket, &frame[0], frame.size()))
+            return false;
+
+          offset          = 0;
+          message.kind    = static_cast<triton::engines::solver::remote_e>(getNumber(frame, offset, 1));
+          message.id      = getNumber(frame, offset, 8);
+          message.payload = frame.substr(offset);
+
+          return true;
+        }
+
+
+        void putNumber(std::string& payload, triton::uint64 value, triton::usize size) {
+          for (triton::usize i = 0; i < size; i++)
+            payload.push_back(static_cast<char>((value >> (i * 8)) & 0xff));
+        }
+
+
+        triton::uint64 getNumber(const std::string& payload, triton::usize& offset, triton::usize size) {
+          triton::uint64 ret = 0;
+
+          if (size > 8 || offset + size > payload.size())
+            throw triton::exceptions::SolverEngine("remote::getNumber(): Truncated message.");
+
+          for (triton::usize i = 0; i < size; i++)
+            ret |= static_cast<triton::uint64>(static_cast<triton::uint8>(payload[offset + i])) << (i * 8);
+
+          offset += size;
+          return ret;
+        }
+
+
+        void putValue(std::string& payload, const triton::uint512& value) {
+          for (triton::usize i = 0; i < 8; i++)
+            putNumber(payload, static_cast<triton::uint64>((value >> (i * 64)) & 0xffffffffffffffff), 8);
+        }
+
+
+        triton::uint512 getValue(const std::string& payload, triton::usize& offset) {
+          triton::uint512 ret = 0;
+
+          for (triton::usize i = 0; i < 8; i++)
+            ret |= triton::uint512(getNumber(payload, offset, 8)) << (i * 64);
+
+          return ret;
+        }
+
+      };
+    };
+  };
+};
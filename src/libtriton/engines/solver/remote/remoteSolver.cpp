@@ -0,0 +1,404 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <sstream>
+
+#include <triton/astSerialization.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/remoteProtocol.hpp>
+#include <triton/remoteSolver.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      RemoteSolver::RemoteSolver(const std::vector<std::string>& endpoints) {
+        this->nextId   = 0;
+        this->stopping = false;
+        this->timeout  = 0;
+
+        for (const auto& endpoint : endpoints) {
+          int socket = triton::engines::solver::remote::connectTo(endpoint);
+          if (socket == -1)
+            continue;
+
+          std::unique_ptr<Worker> worker(new Worker());
+          worker->alive       = true;
+          worker->endpoint    = endpoint;
+          worker->outstanding = 0;
+          worker->socket      = socket;
+
+          std::lock_guard<std::mutex> guard(this->lock);
+          Worker* current = worker.get();
+          this->workers.push_back(std::move(worker));
+          current->sender   = std::thread(&RemoteSolver::send, this, current);
+          current->receiver = std::thread(&RemoteSolver::receive, this, current);
+        }
+
+        if (this->workers.empty())
+          throw triton::exceptions::SolverEngine("RemoteSolver::RemoteSolver(): No worker reachable.");
+      }
+
+
+      RemoteSolver::~RemoteSolver() {
+        {
+          std::lock_guard<std::mutex> guard(this->lock);
+          this->stopping = true;
+
+          for (auto& worker : this->workers) {
+            triton::engines::solver::remote::shutdownSocket(worker->socket);
+            worker->pending.notify_all();
+          }
+
+          std::vector<std::shared_ptr<Query>> outstanding;
+          for (const auto& it : this->queries)
+            outstanding.push_back(it.second);
+
+          for (const auto& query : outstanding) {
+            query->error = "The solver is destroyed.";
+            this->finish(query);
+          }
+        }
+
+        for (auto& worker : this->workers) {
+          worker->sender.join();
+          worker->receiver.join();
+          triton::engines::solver::remote::closeSocket(worker->socket);
+        }
+      }
+
+
+      void RemoteSolver::send(Worker* worker) {
+        std::unique_lock<std::mutex> guard(this->lock);
+
+        while (true) {
+          worker->pending.wait(guard, [&]() { return this->stopping || !worker->alive || !worker->outgoing.empty(); });
+          if (this->stopping || !worker->alive)
+            return;
+
+          /* The frames queued meanwhile go in the same batch */
+          std::string batch;
+          batch.swap(worker->outgoing);
+
+          guard.unlock();
+          bool sent = triton::engines::solver::remote::sendBuffer(worker->socket, batch);
+          guard.lock();
+
+          /* The receiver sends the queries again */
+          if (!sent) {
+            triton::engines::solver::remote::shutdownSocket(worker->socket);
+            return;
+          }
+        }
+      }
+
+
+      void RemoteSolver::receive(Worker* worker) {
+        triton::engines::solver::RemoteMessage message;
+
+        while (triton::engines::solver::remote::receiveMessage(worker->socket, message)) {
+          std::lock_guard<std::mutex> guard(this->lock);
+
+          /* Cancelled queries and queries sent again are dropped */
+          auto it = this->queries.find(message.id);
+          if (it == this->queries.end() || it->second->worker != worker)
+            continue;
+
+          auto query = it->second;
+          worker->outstanding--;
+
+          if (message.kind == triton::engines::solver::REMOTE_RESULT) {
+            try {
+              triton::usize offset = 0;
+              query->status      = static_cast<triton::engines::solver::status_e>(triton::engines::solver::remote::getNumber(message.payload, offset, 1));
+              query->solvingTime = static_cast<triton::uint32>(triton::engines::solver::remote::getNumber(message.payload, offset, 4));
+
+              auto models = triton::engines::solver::remote::getNumber(message.payload, offset, 4);
+              for (triton::uint64 i = 0; i < models; i++) {
+                std::unordered_map<triton::usize, triton::uint512> values;
+                auto count = triton::engines::solver::remote::getNumber(message.payload, offset, 4);
+                for (triton::uint64 j = 0; j < count; j++) {
+                  auto id = triton::engines::solver::remote::getNumber(message.payload, offset, 8);
+                  values[id] = triton::engines::solver::remote::getValue(message.payload, offset);
+                }
+                query->values.push_back(std::move(values));
+              }
+            }
+            catch (const triton::exceptions::Exception& e) {
+              query->error = e.what();
+            }
+          }
+          else if (message.kind == triton::engines::solver::REMOTE_ERROR) {
+            query->error = message.payload;
+          }
+          else {
+            query->error = "Unexpected message.";
+          }
+
+          this->finish(query);
+        }
+
+        /* The connection is lost, its queries go to the other workers */
+        std::lock_guard<std::mutex> guard(this->lock);
+        worker->alive       = false;
+        worker->outstanding = 0;
+        worker->outgoing.clear();
+        worker->pending.notify_all();
+
+        if (this->stopping)
+          return;
+
+        std::vector<std::shared_ptr<Query>> lost;
+        for (const auto& it : this->queries) {
+          if (it.second->worker == worker)
+            lost.push_back(it.second);
+        }
+
+        for (const auto& query : lost)
+          this->dispatch(query);
+      }
+
+
+      void RemoteSolver::dispatch(const std::shared_ptr<Query>& query) const {
+        Worker* worker = nullptr;
+
+        for (const auto& current : this->workers) {
+          if (current->alive && (worker == nullptr || current->outstanding < worker->outstanding))
+            worker = current.get();
+        }
+
+        if (worker == nullptr) {
+          query->worker = nullptr;
+          query->error  = "No worker reachable.";
+          this->finish(query);
+          return;
+        }
+
+        query->worker = worker;
+        worker->outstanding++;
+        worker->outgoing.append(query->frame);
+        worker->pending.notify_one();
+      }
+
+
+      void RemoteSolver::finish(const std::shared_ptr<Query>& query) const {
+        query->ready = true;
+        this->queries.erase(query->id);
+
+        if (query->finished)
+          query->finished->push_back(query);
+
+        this->done.notify_all();
+      }
+
+
+      std::shared_ptr<RemoteSolver::Query> RemoteSolver::submit(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::uint32 timeout, triton::usize index, std::deque<std::shared_ptr<Query>>* finished) const {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("RemoteSolver::submit(): node cannot be null.");
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("RemoteSolver::submit(): Must be a logical node.");
+
+        auto query = std::make_shared<Query>();
+        query->finished    = finished;
+        query->index       = index;
+        query->ready       = false;
+        query->solvingTime = 0;
+        query->status      = triton::engines::solver::UNKNOWN;
+        query->worker      = nullptr;
+
+        {
+          std::lock_guard<std::mutex> guard(this->lock);
+          query->id = this->nextId++;
+        }
+
+        /* The constraint is written out of the lock */
+        std::ostringstream stream;
+        triton::ast::serialize(stream, std::vector<triton::ast::SharedAbstractNode>{node});
+
+        triton::engines::solver::RemoteMessage message;
+        message.kind = triton::engines::solver::REMOTE_QUERY;
+        message.id   = query->id;
+        triton::engines::solver::remote::putNumber(message.payload, limit, 4);
+        triton::engines::solver::remote::putNumber(message.payload, timeout ? timeout : this->timeout, 4);
+        message.payload.append(stream.str());
+        triton::engines::solver::remote::appendMessage(query->frame, message);
+
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->queries[query->id] = query;
+        this->dispatch(query);
+
+        return query;
+      }
+
+
+      void RemoteSolver::cancel(const std::shared_ptr<Query>& query) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        if (query->ready)
+          return;
+
+        /* The worker stops its search, its answer is dropped */
+        if (query->worker && query->worker->alive) {
+          triton::engines::solver::RemoteMessage message = {triton::engines::solver::REMOTE_CANCEL, query->id, ""};
+          triton::engines::solver::remote::appendMessage(query->worker->outgoing, message);
+          query->worker->outstanding--;
+          query->worker->pending.notify_one();
+        }
+
+        query->status = triton::engines::solver::UNKNOWN;
+        query->values.clear();
+        this->finish(query);
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> RemoteSolver::collect(const triton::ast::SharedAbstractNode& node, const std::shared_ptr<Query>& query, triton::engines::solver::status_e* status, triton::uint32* solvingTime) const {
+        std::vector<std::unordered_map<triton::usize, SolverModel>> ret;
+
+        if (!query->error.empty())
+          throw triton::exceptions::SolverEngine("RemoteSolver::collect(): " + query->error);
+
+        /* The models name the variables by id */
+        std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> variables;
+        for (const auto& n : triton::ast::search(node, triton::ast::VARIABLE_NODE)) {
+          const auto& var = reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable();
+          variables[var->getId()] = var;
+        }
+
+        for (const auto& values : query->values) {
+          std::unordered_map<triton::usize, SolverModel> model;
+          for (const auto& value : values) {
+            auto it = variables.find(value.first);
+            if (it != variables.end())
+              model[value.first] = SolverModel(it->second, value.second);
+          }
+          ret.push_back(std::move(model));
+        }
+
+        if (status)
+          *status = query->status;
+
+        if (solvingTime)
+          *solvingTime = query->solvingTime;
+
+        return ret;
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> RemoteSolver::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        auto models = this->getModels(node, 1, status, timeout, solvingTime, nullptr);
+        return models.empty() ? std::unordered_map<triton::usize, SolverModel>{} : models.front();
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> RemoteSolver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        return this->getModels(node, limit, status, timeout, solvingTime, nullptr);
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> RemoteSolver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime, triton::engines::solver::SolverInterrupt* interrupt) const {
+        if (interrupt != nullptr && interrupt->isInterrupted()) {
+          if (status)
+            *status = triton::engines::solver::UNKNOWN;
+          return {};
+        }
+
+        auto query = this->submit(node, limit, timeout);
+
+        if (interrupt)
+          interrupt->setHandler([this, query]() { this->cancel(query); });
+
+        {
+          std::unique_lock<std::mutex> guard(this->lock);
+          this->done.wait(guard, [&]() { return query->ready; });
+        }
+
+        if (interrupt)
+          interrupt->clearHandler();
+
+        return this->collect(node, query, status, solvingTime);
+      }
+
+
+      bool RemoteSolver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+        this->getModels(node, 0, &st, timeout, solvingTime, nullptr);
+        if (status)
+          *status = st;
+
+        return st == triton::engines::solver::SAT;
+      }
+
+
+      void RemoteSolver::solveAll(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 timeout, const std::function<void(triton::usize index, triton::engines::solver::status_e status, const std::unordered_map<triton::usize, SolverModel>& model, triton::uint32 solvingTime)>& callback) const {
+        std::deque<std::shared_ptr<Query>> finished;
+        std::vector<std::shared_ptr<Query>> sent;
+
+        try {
+          /* All the queries are outstanding at once */
+          for (triton::usize index = 0; index < nodes.size(); index++)
+            sent.push_back(this->submit(nodes[index], 1, timeout, index, &finished));
+
+          for (triton::usize count = 0; count < nodes.size(); count++) {
+            std::shared_ptr<Query> query;
+            {
+              std::unique_lock<std::mutex> guard(this->lock);
+              this->done.wait(guard, [&]() { return !finished.empty(); });
+              query = std::move(finished.front());
+              finished.pop_front();
+            }
+
+            triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+            triton::uint32 time = 0;
+
+            auto models = this->collect(nodes[query->index], query, &st, &time);
+            if (callback)
+              callback(query->index, st, models.empty() ? std::unordered_map<triton::usize, SolverModel>{} : models.front(), time);
+          }
+        }
+        catch (...) {
+          for (const auto& query : sent)
+            this->cancel(query);
+
+          /* The list of the ended queries goes out of scope */
+          std::lock_guard<std::mutex> guard(this->lock);
+          for (const auto& query : sent)
+            query->finished = nullptr;
+
+          throw;
+        }
+      }
+
+
+      triton::usize RemoteSolver::getWorkerCount(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return std::count_if(this->workers.begin(), this->workers.end(), [](const std::unique_ptr<Worker>& worker) { return worker->alive; });
+      }
+
+
+      std::string RemoteSolver::getName(void) const {
+        return "remote";
+      }
+
+
+      void RemoteSolver::setTimeout(triton::uint32 ms) {
+        this->timeout = ms;
+      }
+
+
+      void RemoteSolver::setMemoryLimit(triton::uint32 mem) {
+        (void)mem;
+      }
+
+    };
+  };
+};
@@ -0,0 +1,237 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <sstream>
+#include <unordered_map>
+
+#include <triton/astContext.hpp>
+#include <triton/astSerialization.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/modes.hpp>
+#include <triton/remoteProtocol.hpp>
+#include <triton/remoteWorker.hpp>
+#include <triton/solverInterrupt.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      RemoteWorker::RemoteWorker(triton::uint16 port, triton::usize threads, triton::engines::solver::solver_e kind) {
+        this->port     = 0;
+        this->stopping = false;
+        this->threads  = threads ? threads : std::max<triton::usize>(std::thread::hardware_concurrency(), 1);
+
+        if (kind != triton::engines::solver::SOLVER_INVALID)
+          this->engine.setSolver(kind);
+
+        if (!this->engine.isValid())
+          throw triton::exceptions::SolverEngine("RemoteWorker::RemoteWorker(): Solver undefined.");
+
+        this->listener = triton::engines::solver::remote::listenOn(port, &this->port);
+        if (this->listener == -1)
+          throw triton::exceptions::SolverEngine("RemoteWorker::RemoteWorker(): Cannot listen on port " + std::to_string(port) + ".");
+      }
+
+
+      RemoteWorker::~RemoteWorker() {
+        this->stop();
+        triton::engines::solver::remote::closeSocket(this->listener);
+      }
+
+
+      triton::uint16 RemoteWorker::getPort(void) const {
+        return this->port;
+      }
+
+
+      void RemoteWorker::serve(void) {
+        std::vector<std::thread> handlers;
+
+        while (!this->stopping) {
+          int socket = triton::engines::solver::remote::acceptOn(this->listener);
+          if (socket == -1)
+            continue;
+
+          std::lock_guard<std::mutex> guard(this->lock);
+          if (this->stopping) {
+            triton::engines::solver::remote::closeSocket(socket);
+            break;
+          }
+
+          this->connections.insert(socket);
+          handlers.emplace_back(&RemoteWorker::handle, this, socket);
+        }
+
+        for (auto& handler : handlers)
+          handler.join();
+      }
+
+
+      void RemoteWorker::stop(void) {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        this->stopping = true;
+        triton::engines::solver::remote::shutdownSocket(this->listener);
+        for (int socket : this->connections)
+          triton::engines::solver::remote::shutdownSocket(socket);
+      }
+
+
+      void RemoteWorker::handle(int socket) {
+        /* A query, in its own AST context so that the queries do not share any node */
+        struct Job {
+          triton::ast::SharedAstContext ctxt;
+          triton::ast::SharedAbstractNode node;
+          triton::uint64 id;
+          triton::uint32 limit;
+          triton::uint32 timeout;
+          triton::engines::solver::SolverInterrupt interrupt;
+          bool running;
+        };
+
+        const triton::engines::solver::SolverInterface* solver = this->engine.getSolverInstance();
+        std::mutex jobLock;
+        std::mutex writeLock;
+        std::condition_variable pending;
+        std::deque<std::shared_ptr<Job>> jobs;
+        std::unordered_map<triton::uint64, std::shared_ptr<Job>> active;
+        std::vector<std::thread> pool;
+        bool closed = false;
+
+        auto reply = [&](const triton::engines::solver::RemoteMessage& message) {
+          std::string buffer;
+          triton::engines::solver::remote::appendMessage(buffer, message);
+          std::lock_guard<std::mutex> guard(writeLock);
+          triton::engines::solver::remote::sendBuffer(socket, buffer);
+        };
+
+        auto work = [&]() {
+          std::unique_lock<std::mutex> guard(jobLock);
+
+          while (true) {
+            pending.wait(guard, [&]() { return closed || !jobs.empty(); });
+            if (closed)
+              return;
+
+            auto job = std::move(jobs.front());
+            jobs.pop_front();
+            job->running = true;
+            guard.unlock();
+
+            triton::engines::solver::RemoteMessage answer = {triton::engines::solver::REMOTE_RESULT, job->id, ""};
+            triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+            triton::uint32 time = 0;
+
+            try {
+              /* A satisfiability check is a model query whose model is not sent */
+              auto models = solver->getModels(job->node, std::max<triton::uint32>(job->limit, 1), &status, job->timeout, &time, &job->interrupt);
+              if (status == triton::engines::solver::UNKNOWN && !models.empty())
+                status = triton::engines::solver::SAT;
+              if (job->limit == 0)
+                models.clear();
+
+              triton::engines::solver::remote::putNumber(answer.payload, status, 1);
+              triton::engines::solver::remote::putNumber(answer.payload, time, 4);
+              triton::engines::solver::remote::putNumber(answer.payload, models.size(), 4);
+              for (const auto& model : models) {
+                triton::engines::solver::remote::putNumber(answer.payload, model.size(), 4);
+                for (const auto& it : model) {
+                  triton::engines::solver::remote::putNumber(answer.payload, it.first, 8);
+                  triton::engines::solver::remote::putValue(answer.payload, it.second.getValue());
+                }
+              }
+            }
+            catch (const std::exception& e) {
+              answer.kind    = triton::engines::solver::REMOTE_ERROR;
+              answer.payload = e.what();
+            }
+
+            reply(answer);
+
+            guard.lock();
+            active.erase(job->id);
+          }
+        };
+
+        triton::engines::solver::RemoteMessage message;
+        while (!this->stopping && triton::engines::solver::remote::receiveMessage(socket, message)) {
+          if (message.kind == triton::engines::solver::REMOTE_QUERY) {
+            auto job = std::make_shared<Job>();
+            job->id      = message.id;
+            job->running = false;
+
+            try {
+              triton::usize offset = 0;
+              job->limit   = static_cast<triton::uint32>(triton::engines::solver::remote::getNumber(message.payload, offset, 4));
+              job->timeout = static_cast<triton::uint32>(triton::engines::solver::remote::getNumber(message.payload, offset, 4));
+              job->ctxt    = std::make_shared<triton::ast::AstContext>(std::make_shared<triton::modes::Modes>());
+
+              std::istringstream stream(message.payload.substr(offset));
+              auto nodes = triton::ast::deserializeNodes(stream, job->ctxt);
+              if (nodes.size() != 1 || nodes.front()->isLogical() == false)
+                throw triton::exceptions::SolverEngine("RemoteWorker::handle(): Invalid query.");
+              job->node = nodes.front();
+            }
+            catch (const std::exception& e) {
+              reply({triton::engines::solver::REMOTE_ERROR, message.id, e.what()});
+              continue;
+            }
+
+            std::lock_guard<std::mutex> guard(jobLock);
+            jobs.push_back(job);
+            active[job->id] = job;
+
+            /* A thread is started per outstanding query, up to the limit */
+            if (pool.size() < this->threads && pool.size() < active.size())
+              pool.emplace_back(work);
+
+            pending.notify_one();
+          }
+          else if (message.kind == triton::engines::solver::REMOTE_CANCEL) {
+            std::lock_guard<std::mutex> guard(jobLock);
+
+            auto it = active.find(message.id);
+            if (it == active.end())
+              continue;
+
+            /* A pending query is dropped, a running one is interrupted */
+            if (it->second->running) {
+              it->second->interrupt.interrupt();
+            }
+            else {
+              jobs.erase(std::find(jobs.begin(), jobs.end(), it->second));
+              active.erase(it);
+            }
+          }
+        }
+
+        /* The connection is closed, the running queries are interrupted */
+        {
+          std::lock_guard<std::mutex> guard(jobLock);
+          closed = true;
+          for (const auto& it : active)
+            it.second->interrupt.interrupt();
+        }
+        pending.notify_all();
+
+        for (auto& thread : pool)
+          thread.join();
+
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->connections.erase(socket);
+        triton::engines::solver::remote::closeSocket(socket);
+      }
+
+    };
+  };
+};
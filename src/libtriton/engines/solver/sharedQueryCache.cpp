@@ -0,0 +1,306 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <triton/exceptions.hpp>
+#include <triton/sharedQueryCache.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* The layout of the file */
+      static constexpr char           FILE_MAGIC[8] = {'T', 'R', 'I', 'T', 'O', 'N', 'Q', 'C'};
+      static constexpr triton::uint32 FILE_VERSION  = 2;
+      static constexpr triton::usize  SLOT_SIZE     = 1024;
+      static constexpr triton::usize  MAX_PROBES    = 16;
+
+      /* The states of a slot */
+      static constexpr triton::uint32 SLOT_EMPTY   = 0;
+      static constexpr triton::uint32 SLOT_WRITING = 1;
+      static constexpr triton::uint32 SLOT_READY   = 2;
+
+      struct FileHeader {
+        char           magic[8];
+        triton::uint32 version;
+        triton::uint32 slotSize;
+        triton::uint64 slots;
+      };
+
+      struct SlotHeader {
+        std::atomic<triton::uint32> state;
+        triton::uint32 status;
+        triton::uint32 timeout;
+        triton::uint32 limit;
+        triton::uint32 payloadSize;
+        triton::uint32 reserved;
+        triton::uint8  hash[64];
+      };
+
+      static constexpr triton::usize HEADER_SIZE  = 64;
+      static constexpr triton::usize PAYLOAD_SIZE = SLOT_SIZE - sizeof(SlotHeader);
+
+      static_assert(sizeof(FileHeader) <= HEADER_SIZE, "The file header does not fit");
+      static_assert(std::atomic<triton::uint32>::is_always_lock_free, "The slots are shared by processes");
+
+
+      /* The structural hash of a query as little-endian bytes */
+      static void hashBytes(const triton::uint512& hash, triton::uint8* bytes) {
+        for (triton::usize i = 0; i < 64; i++)
+          bytes[i] = static_cast<triton::uint8>((hash >> (i * 8)) & 0xff);
+      }
+
+
+      /* The slot probed first for a query */
+      static triton::uint64 hashKey(const triton::uint8* hash, triton::uint32 timeout, triton::uint32 limit) {
+        triton::uint64 h = 0;
+        std::memcpy(&h, hash, sizeof(h));
+        h ^= (static_cast<triton::uint64>(timeout) << 32) ^ limit;
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+      }
+
+
+      SharedQueryCache::SharedQueryCache(const std::string& path, triton::usize slots) {
+        this->data  = nullptr;
+        this->size  = 0;
+        this->slots = slots;
+
+        if (slots == 0)
+          throw triton::exceptions::SolverEngine("SharedQueryCache::SharedQueryCache(): The cache needs at least one slot.");
+
+        int fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd < 0)
+          throw triton::exceptions::SolverEngine("SharedQueryCache::SharedQueryCache(): Cannot open " + path);
+
+        /* The first process creates the file, the others wait for its header */
+        if (flock(fd, LOCK_EX) != 0) {
+          close(fd);
+          throw triton::exceptions::SolverEngine("SharedQueryCache::SharedQueryCache(): Cannot lock " + path);
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+          close(fd);
+          throw triton::exceptions::SolverEngine("SharedQueryCache::SharedQueryCache(): Cannot get the size of " + path);
+        }
+
+        FileHeader header = {};
+        if (st.st_size == 0) {
+          std::memcpy(header.magic, FILE_MAGIC, sizeof(header.magic));
+          header.version  = FILE_VERSION;
+          header.slotSize = SLOT_SIZE;
+          header.slots    = slots;
+          /* The slots are zeros, i.e. empty, until they are written */
+          if (ftruncate(fd, HEADER_SIZE + slots * SLOT_SIZE) != 0 || pwrite(fd, &header, sizeof(header), 0) != sizeof(header)) {
+            close(fd);
+            throw triton::exceptions::SolverEngine("SharedQueryCache::SharedQueryCache(): Cannot initialize " + path);
+          }
+        }
+        else if (pread(fd, &header, sizeof(header), 0) != sizeof(header) ||
+                 std::memcmp(header.magic, FILE_MAGIC, sizeof(header.magic)) != 0 ||
+                 header.version != FILE_VERSION ||
+                 header.slotSize != SLOT_SIZE ||
+                 header.slots == 0 ||
+                 static_cast<triton::uint64>(st.st_size) != HEADER_SIZE + header.slots * SLOT_SIZE) {
+          close(fd);
+          throw triton::exceptions::SolverEngine("SharedQueryCache::SharedQueryCache(): " + path + " is not a query cache of this build.");
+        }
+
+        /* An existing file keeps its own number of slots */
+        this->slots = static_cast<triton::usize>(header.slots);
+        this->size  = HEADER_SIZE + this->slots * SLOT_SIZE;
+
+        void* area = mmap(nullptr, this->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+
+        if (area == MAP_FAILED)
+          throw triton::exceptions::SolverEngine("SharedQueryCache::SharedQueryCache(): Cannot map " + path);
+        this->data = static_cast<triton::uint8*>(area);
+      }
+
+
+      SharedQueryCache::~SharedQueryCache() {
+        if (this->data)
+          munmap(this->data, this->size);
+      }
+
+
+      triton::uint8* SharedQueryCache::getSlot(triton::usize index) const {
+        return this->data + HEADER_SIZE + (index % this->slots) * SLOT_SIZE;
+      }
+
+
+      triton::usize SharedQueryCache::getCapacity(void) const {
+        return this->slots;
+      }
+
+
+      bool SharedQueryCache::load(const triton::engines::solver::QueryCanonicalizer& query,
+                                  triton::uint32 timeout,
+                                  triton::uint32 limit,
+                                  triton::engines::solver::status_e& status,
+                                  std::vector<std::unordered_map<triton::usize, SolverModel>>& models) const {
+        triton::uint8 hash[64];
+        hashBytes(query.getHash(), hash);
+        triton::uint64 first = hashKey(hash, timeout, limit);
+
+        for (triton::usize probe = 0; probe < MAX_PROBES && probe < this->slots; probe++) {
+          triton::uint8* slot = this->getSlot(first + probe);
+          SlotHeader* entry   = reinterpret_cast<SlotHeader*>(slot);
+
+          triton::uint32 state = entry->state.load(std::memory_order_acquire);
+          if (state == SLOT_EMPTY)
+            return false;
+
+          if (state != SLOT_READY || entry->timeout != timeout || entry->limit != limit || std::memcmp(entry->hash, hash, sizeof(hash)) != 0)
+            continue;
+
+          /* The models name the variables by their position in the canonical form */
+          const auto& variables = query.getVariables();
+
+          const triton::uint8* payload = slot + sizeof(SlotHeader);
+          triton::usize end            = std::min<triton::usize>(entry->payloadSize, PAYLOAD_SIZE);
+          triton::usize offset         = 0;
+
+          /* A corrupted record is ignored */
+          auto read = [&](void* dst, triton::usize n) {
+            if (n > end - offset)
+              return false;
+            std::memcpy(dst, payload + offset, n);
+            offset += n;
+            return true;
+          };
+
+          std::vector<std::unordered_map<triton::usize, SolverModel>> ret;
+          triton::uint32 count = 0;
+          if (!read(&count, sizeof(count)))
+            return false;
+
+          for (triton::uint32 i = 0; i < count; i++) {
+            std::unordered_map<triton::usize, SolverModel> model;
+            triton::uint32 values = 0;
+            if (!read(&values, sizeof(values)))
+              return false;
+
+            for (triton::uint32 j = 0; j < values; j++) {
+              triton::uint64 position = 0;
+              triton::uint8 bytes = 0;
+              triton::uint8 buffer[64];
+              if (!read(&position, sizeof(position)) || !read(&bytes, sizeof(bytes)) || bytes > sizeof(buffer) || !read(buffer, bytes))
+                return false;
+
+              triton::uint512 value = 0;
+              for (triton::uint8 k = 0; k < bytes; k++)
+                value |= triton::uint512(buffer[k]) << (k * 8);
+
+              if (position < variables.size())
+                model[variables[position]->getId()] = SolverModel(variables[position], value);
+            }
+            ret.push_back(std::move(model));
+          }
+
+          status = static_cast<triton::engines::solver::status_e>(entry->status);
+          models = std::move(ret);
+          return true;
+        }
+
+        return false;
+      }
+
+
+      void SharedQueryCache::store(const triton::engines::solver::QueryCanonicalizer& query,
+                                   triton::uint32 timeout,
+                                   triton::uint32 limit,
+                                   triton::engines::solver::status_e status,
+                                   const std::vector<std::unordered_map<triton::usize, SolverModel>>& models) {
+        triton::uint8 payload[PAYLOAD_SIZE];
+        triton::usize offset = 0;
+
+        auto write = [&](const void* src, triton::usize n) {
+          if (n > PAYLOAD_SIZE - offset)
+            return false;
+          std::memcpy(payload + offset, src, n);
+          offset += n;
+          return true;
+        };
+
+        triton::uint32 count = static_cast<triton::uint32>(models.size());
+        if (!write(&count, sizeof(count)))
+          return;
+
+        for (const auto& model : models) {
+          const auto positional = query.toPositions(model);
+          triton::uint32 values = static_cast<triton::uint32>(positional.size());
+          if (!write(&values, sizeof(values)))
+            return;
+
+          for (const auto& it : positional) {
+            triton::uint64 position = it.first;
+            triton::uint8 bytes = static_cast<triton::uint8>((it.second.getSize() + 7) / 8);
+            triton::uint8 buffer[64];
+            triton::uint512 value = it.second.getValue();
+
+            /* Only the bytes of the variable are kept */
+            for (triton::uint8 k = 0; k < bytes; k++)
+              buffer[k] = static_cast<triton::uint8>((value >> (k * 8)) & 0xff);
+
+            /* Too large to be kept */
+            if (!write(&position, sizeof(position)) || !write(&bytes, sizeof(bytes)) || !write(buffer, bytes))
+              return;
+          }
+        }
+
+        triton::uint8 hash[64];
+        hashBytes(query.getHash(), hash);
+        triton::uint64 first = hashKey(hash, timeout, limit);
+
+        for (triton::usize probe = 0; probe < MAX_PROBES && probe < this->slots; probe++) {
+          triton::uint8* slot = this->getSlot(first + probe);
+          SlotHeader* entry   = reinterpret_cast<SlotHeader*>(slot);
+
+          triton::uint32 state = entry->state.load(std::memory_order_acquire);
+
+          /* Already recorded, by this process or another one */
+          if (state == SLOT_READY && entry->timeout == timeout && entry->limit == limit && std::memcmp(entry->hash, hash, sizeof(hash)) == 0)
+            return;
+
+          if (state != SLOT_EMPTY || !entry->state.compare_exchange_strong(state, SLOT_WRITING, std::memory_order_acquire))
+            continue;
+
+          entry->status      = static_cast<triton::uint32>(status);
+          entry->timeout     = timeout;
+          entry->limit       = limit;
+          entry->payloadSize = static_cast<triton::uint32>(offset);
+          std::memcpy(entry->hash, hash, sizeof(hash));
+          std::memcpy(slot + sizeof(SlotHeader), payload, offset);
+
+          /* Published once complete */
+          entry->state.store(SLOT_READY, std::memory_order_release);
+          return;
+        }
+      }
+
+    }; /* solver namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
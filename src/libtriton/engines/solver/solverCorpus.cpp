@@ -0,0 +1,75 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <vector>
+
+#include <triton/astSerialization.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/solverCorpus.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      static void writeWord(std::ostream& stream, triton::uint64 value) {
+        char bytes[8];
+        for (triton::uint32 i = 0; i < 8; i++)
+          bytes[i] = static_cast<char>((value >> (i * 8)) & 0xff);
+        stream.write(bytes, sizeof(bytes));
+      }
+
+
+      static triton::uint64 readWord(std::istream& stream) {
+        char bytes[8];
+        triton::uint64 value = 0;
+
+        if (!stream.read(bytes, sizeof(bytes)))
+          throw triton::exceptions::SolverEngine("triton::engines::solver::readQuery(): Truncated corpus.");
+
+        for (triton::uint32 i = 0; i < 8; i++)
+          value |= static_cast<triton::uint64>(static_cast<triton::uint8>(bytes[i])) << (i * 8);
+
+        return value;
+      }
+
+
+      void writeQuery(std::ostream& stream, const triton::engines::solver::SolverQuery& query) {
+        if (query.node == nullptr)
+          return;
+
+        writeWord(stream, query.limit);
+        writeWord(stream, query.status);
+        writeWord(stream, query.solvingTime);
+        writeWord(stream, query.queryTime);
+        triton::ast::serialize(stream, std::vector<triton::ast::SharedAbstractNode>{query.node});
+      }
+
+
+      bool readQuery(std::istream& stream, const triton::ast::SharedAstContext& ctxt, triton::engines::solver::SolverQuery& query) {
+        if (stream.peek() == std::istream::traits_type::eof())
+          return false;
+
+        query.limit       = static_cast<triton::uint32>(readWord(stream));
+        query.status      = static_cast<triton::engines::solver::status_e>(readWord(stream));
+        query.solvingTime = static_cast<triton::uint32>(readWord(stream));
+        query.queryTime   = readWord(stream);
+        query.nodes       = 0;
+        query.variables   = 0;
+
+        auto nodes = triton::ast::deserializeNodes(stream, ctxt);
+        if (nodes.size() != 1 || query.status > triton::engines::solver::UNKNOWN)
+          throw triton::exceptions::SolverEngine("triton::engines::solver::readQuery(): Invalid query.");
+
+        query.node = nodes[0];
+        return true;
+      }
+
+    }; /* solver namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
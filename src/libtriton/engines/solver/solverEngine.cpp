@@ -5,9 +5,26 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <stack>
+#include <system_error>
+#include <thread>
+
+#include <triton/astContext.hpp>
+#include <triton/astProgram.hpp>
 #include <triton/config.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/solverEngine.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tracing.hpp>
 
 
 
@@ -16,16 +33,41 @@ namespace triton {
     namespace solver {
 
       SolverEngine::SolverEngine() {
-        this->kind = triton::engines::solver::SOLVER_INVALID;
+        this->asyncIdle              = 0;
+        this->asyncStop              = false;
+        this->bitBlastingEnabled     = false;
+        this->bitBlastingMaxNodes    = 0;
+        this->kind                   = triton::engines::solver::SOLVER_INVALID;
+        this->counterexampleCapacity = 0;
+        this->counterexampleEnabled  = false;
+        this->counterexampleHits     = 0;
+        this->independenceEnabled    = false;
+        this->presolverEnabled       = false;
+        this->presolverHits          = 0;
+        this->queryCacheEnabled      = false;
+        this->queryCacheCapacity     = 0;
+        this->queryCacheHits         = 0;
+        this->queryCacheMisses       = 0;
+        this->statisticsEnabled      = false;
+        this->unsatCoreCapacity      = 0;
+        this->unsatCoreEnabled       = false;
+        this->unsatCoreHits          = 0;
         #if defined(TRITON_Z3_INTERFACE)
         /* By default we initialized the z3 solver */
         this->setSolver(triton::engines::solver::SOLVER_Z3);
         #elif defined(TRITON_BITWUZLA_INTERFACE)
         this->setSolver(triton::engines::solver::SOLVER_BITWUZLA);
+        #else
+        this->setSolver(triton::engines::solver::SOLVER_BITBLAST);
         #endif
       }
 
 
+      SolverEngine::~SolverEngine() {
+        this->stopAsync();
+      }
+
+
       triton::engines::solver::solver_e SolverEngine::getSolver(void) const {
         return this->kind;
       }
@@ -39,6 +81,9 @@ namespace triton {
 
 
       void SolverEngine::setSolver(triton::engines::solver::solver_e kind) {
+        /* The running queries refer to the previous solver */
+        this->stopAsync();
+
         /* Allocate and init the good solver */
         switch (kind) {
           #ifdef TRITON_Z3_INTERFACE
@@ -57,6 +102,26 @@ namespace triton {
               throw triton::exceptions::SolverEngine("SolverEngine::setSolver(): Not enough memory.");
             break;
           #endif
+          #if defined(TRITON_Z3_INTERFACE) && defined(TRITON_BITWUZLA_INTERFACE)
+          case triton::engines::solver::SOLVER_PORTFOLIO:
+            /* init the new instance */
+            this->solver.reset(new(std::nothrow) triton::engines::solver::PortfolioSolver());
+            if (this->solver == nullptr)
+              throw triton::exceptions::SolverEngine("SolverEngine::setSolver(): Not enough memory.");
+            break;
+          #endif
+
+          case triton::engines::solver::SOLVER_BITBLAST:
+            /* init the new instance */
+            this->solver.reset(new(std::nothrow) triton::engines::solver::BitBlastSolver());
+            if (this->solver == nullptr)
+              throw triton::exceptions::SolverEngine("SolverEngine::setSolver(): Not enough memory.");
+            break;
+
+          #ifdef TRITON_REMOTE_INTERFACE
+          case triton::engines::solver::SOLVER_REMOTE:
+            throw triton::exceptions::SolverEngine("SolverEngine::setSolver(): The workers are defined by setRemoteSolver().");
+          #endif
 
           default:
             throw triton::exceptions::SolverEngine("SolverEngine::setSolver(): Solver not supported.");
@@ -65,6 +130,11 @@ namespace triton {
 
         /* Setup global variables */
         this->kind = kind;
+        this->solver->setQueryConfigurations(this->queries);
+
+        /* The results of the previous solver are not kept */
+        this->clearQueryCache();
+        this->timeoutBudget.clear();
       }
 
 
@@ -72,12 +142,41 @@ namespace triton {
         if (customSolver == nullptr)
           throw triton::exceptions::SolverEngine("SolverEngine::setCustomSolver(): custom solver cannot be null.");
 
+        /* The running queries refer to the previous solver */
+        this->stopAsync();
+
         /* Define the custom solver as current solver */
         this->solver.reset(customSolver);
 
         /* Setup global variables */
         this->kind = triton::engines::solver::SOLVER_CUSTOM;
+        this->solver->setQueryConfigurations(this->queries);
+
+        /* The results of the previous solver are not kept */
+        this->clearQueryCache();
+        this->timeoutBudget.clear();
+      }
+
+
+      #ifdef TRITON_REMOTE_INTERFACE
+      void SolverEngine::setRemoteSolver(const std::vector<std::string>& endpoints) {
+        /* The workers are reached before the previous solver is stopped */
+        std::unique_ptr<triton::engines::solver::SolverInterface> remote(new triton::engines::solver::RemoteSolver(endpoints));
+
+        /* The running queries refer to the previous solver */
+        this->stopAsync();
+
+        /* Define the remote solver as current solver */
+        this->solver = std::move(remote);
+
+        /* Setup global variables */
+        this->kind = triton::engines::solver::SOLVER_REMOTE;
+
+        /* The results of the previous solver are not kept */
+        this->clearQueryCache();
+        this->timeoutBudget.clear();
       }
+      #endif
 
 
       bool SolverEngine::isValid(void) const {
@@ -87,24 +186,1141 @@ namespace triton {
       }
 
 
-      std::unordered_map<triton::usize, SolverModel> SolverEngine::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+      const SolverEngine::QueryResult* SolverEngine::findQuery(const triton::engines::solver::QueryCanonicalizer& query, triton::uint32 timeout, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32* solvingTime, std::vector<std::unordered_map<triton::usize, SolverModel>>* models) const {
+        QueryKey key = {query.getHash(), timeout, limit};
+        auto it = this->queryCache.find(key);
+
+        #ifdef TRITON_PERSISTENT_CACHE
+        /* Another process may have solved it */
+        if (it == this->queryCache.end() && this->sharedQueryCache) {
+          triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+          std::vector<std::unordered_map<triton::usize, SolverModel>> loaded;
+          if (this->sharedQueryCache->load(query, timeout, limit, st, loaded)) {
+            this->storeQuery(query, timeout, limit, st, loaded);
+            it = this->queryCache.find(key);
+          }
+        }
+        #endif
+
+        if (it == this->queryCache.end())
+          return nullptr;
+
+        /* The result becomes the most recently used */
+        this->queryResults.splice(this->queryResults.begin(), this->queryResults, it->second);
+        this->queryCacheHits++;
+
+        if (status)
+          *status = it->second->status;
+
+        if (solvingTime)
+          *solvingTime = 0;
+
+        /* The models go back to the variables of this query */
+        if (models) {
+          models->clear();
+          for (const auto& model : it->second->models)
+            models->push_back(query.fromPositions(model));
+        }
+
+        return &(*it->second);
+      }
+
+
+      void SolverEngine::storeQuery(const triton::engines::solver::QueryCanonicalizer& query, triton::uint32 timeout, triton::uint32 limit, triton::engines::solver::status_e status, const std::vector<std::unordered_map<triton::usize, SolverModel>>& models) const {
+        /* Timeouts and unknown results may change with another attempt */
+        if (status != triton::engines::solver::SAT && status != triton::engines::solver::UNSAT)
+          return;
+
+        QueryKey key = {query.getHash(), timeout, limit};
+
+        #ifdef TRITON_PERSISTENT_CACHE
+        if (this->sharedQueryCache)
+          this->sharedQueryCache->store(query, timeout, limit, status, models);
+        #endif
+
+        auto it = this->queryCache.find(key);
+        if (it != this->queryCache.end()) {
+          this->queryResults.erase(it->second);
+          this->queryCache.erase(it);
+        }
+
+        /* The models are kept by the positions of the variables */
+        std::vector<std::unordered_map<triton::usize, SolverModel>> positional;
+        for (const auto& model : models)
+          positional.push_back(query.toPositions(model));
+
+        this->queryResults.push_front(QueryResult{key, status, std::move(positional)});
+        this->queryCache[key] = this->queryResults.begin();
+
+        /* Evict the least recently used results */
+        while (this->queryResults.size() > this->queryCacheCapacity) {
+          this->queryCache.erase(this->queryResults.back().key);
+          this->queryResults.pop_back();
+        }
+      }
+
+
+      bool SolverEngine::findCounterexample(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::usize, SolverModel>& model) const {
+        if (!this->counterexampleEnabled || this->counterexamples.empty() || node->isLogical() == false)
+          return false;
+
+        /* Arrays cannot be evaluated */
+        if (node->containsArray())
+          return false;
+
+        /* The variables of the query */
+        std::unordered_map<triton::usize, triton::ast::VariableNode*> variables;
+        std::stack<triton::ast::AbstractNode*> nodes;
+        triton::ast::VisitedNodes visited(node->getContext());
+
+        nodes.push(node.get());
+        while (!nodes.empty()) {
+          triton::ast::AbstractNode* current = nodes.top();
+          nodes.pop();
+
+          if (!visited.insert(current))
+            continue;
+
+          switch (current->getType()) {
+            /* Arrays cannot be evaluated */
+            case triton::ast::ARRAY_NODE:
+              return false;
+
+            case triton::ast::VARIABLE_NODE: {
+              auto var = reinterpret_cast<triton::ast::VariableNode*>(current);
+              variables[var->getSymbolicVariable()->getId()] = var;
+              break;
+            }
+
+            case triton::ast::REFERENCE_NODE:
+              nodes.push(reinterpret_cast<triton::ast::ReferenceNode*>(current)->getSymbolicExpression()->getAst().get());
+              break;
+
+            default:
+              for (const auto& child : current->getChildren())
+                nodes.push(child.get());
+              break;
+          }
+        }
+
+        /* Evaluates the query under each kept model, without touching the variables */
+        triton::ast::AstProgram program(node);
+        for (auto it = this->counterexamples.begin(); it != this->counterexamples.end(); it++) {
+          std::unordered_map<triton::usize, triton::uint512> values;
+          for (const auto& var : variables) {
+            auto value = it->find(var.first);
+            if (value != it->end())
+              values[var.first] = value->second.getValue();
+          }
+
+          if (program.eval(values) == 0)
+            continue;
+
+          model.clear();
+          for (const auto& var : variables) {
+            auto value = values.find(var.first);
+            model[var.first] = SolverModel(var.second->getSymbolicVariable(), value != values.end() ? value->second : var.second->evaluate());
+          }
+
+          /* The model becomes the most recently used */
+          this->counterexamples.splice(this->counterexamples.begin(), this->counterexamples, it);
+          this->counterexampleHits++;
+          return true;
+        }
+
+        return false;
+      }
+
+
+      void SolverEngine::storeCounterexample(const std::unordered_map<triton::usize, SolverModel>& model) const {
+        if (!this->counterexampleEnabled || model.empty())
+          return;
+
+        this->counterexamples.push_front(model);
+        while (this->counterexamples.size() > this->counterexampleCapacity)
+          this->counterexamples.pop_back();
+      }
+
+
+      triton::ast::SharedAbstractNode SolverEngine::balanceQuery(const triton::ast::SharedAbstractNode& node) {
+        if (node == nullptr || !node->getContext()->getModes()->isModeEnabled(triton::modes::AST_BALANCING))
+          return node;
+        return node->getContext()->balance(node);
+      }
+
+
+      std::vector<triton::ast::SharedAbstractNode> SolverEngine::getConjuncts(const triton::ast::SharedAbstractNode& node) {
+        std::vector<triton::ast::SharedAbstractNode> conjuncts;
+        std::vector<triton::ast::SharedAbstractNode> worklist = {node};
+
+        /* Flatten the conjunctions, in order */
+        while (!worklist.empty()) {
+          auto current = triton::ast::dereference(worklist.back());
+          worklist.pop_back();
+
+          if (current->getType() == triton::ast::LAND_NODE || current->getType() == triton::ast::ASSERT_NODE) {
+            const auto& children = current->getChildren();
+            for (auto it = children.rbegin(); it != children.rend(); it++)
+              worklist.push_back(*it);
+          }
+          else {
+            conjuncts.push_back(current);
+          }
+        }
+
+        return conjuncts;
+      }
+
+
+      bool SolverEngine::findUnsatCore(const triton::ast::SharedAbstractNode& node) const {
+        if (!this->unsatCoreEnabled || this->unsatCores.empty() || node == nullptr || node->isLogical() == false)
+          return false;
+
+        std::vector<triton::uint512> hashes;
+        for (const auto& conjunct : SolverEngine::getConjuncts(node))
+          hashes.push_back(conjunct->getHash());
+        std::sort(hashes.begin(), hashes.end());
+
+        for (auto it = this->unsatCores.begin(); it != this->unsatCores.end(); it++) {
+          if (!std::includes(hashes.begin(), hashes.end(), it->begin(), it->end()))
+            continue;
+
+          /* The core becomes the most recently used */
+          this->unsatCores.splice(this->unsatCores.begin(), this->unsatCores, it);
+          this->unsatCoreHits++;
+          return true;
+        }
+
+        return false;
+      }
+
+
+      void SolverEngine::storeUnsatCore(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout) const {
+        if (!this->unsatCoreEnabled || node == nullptr || node->isLogical() == false)
+          return;
+
+        auto conjuncts = SolverEngine::getConjuncts(node);
+        auto positions = this->solver->getUnsatCore(conjuncts, timeout);
+
+        /* The conjunction as a whole is a core if the solver cannot extract a smaller one */
+        std::vector<triton::uint512> core;
+        if (positions.empty()) {
+          for (const auto& conjunct : conjuncts)
+            core.push_back(conjunct->getHash());
+        }
+        else {
+          for (triton::usize index : positions) {
+            if (index < conjuncts.size())
+              core.push_back(conjuncts[index]->getHash());
+          }
+        }
+
+        std::sort(core.begin(), core.end());
+        core.erase(std::unique(core.begin(), core.end()), core.end());
+
+        this->unsatCores.push_front(std::move(core));
+        while (this->unsatCores.size() > this->unsatCoreCapacity)
+          this->unsatCores.pop_back();
+      }
+
+
+      void SolverEngine::solveBudgeted(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime, const std::function<void(triton::engines::solver::status_e*, triton::uint32, triton::uint32*)>& solve) const {
+        /* An explicit timeout is kept */
+        if (timeout != 0 || node == nullptr || !this->timeoutBudget.isEnabled()) {
+          solve(status, timeout, solvingTime);
+          return;
+        }
+
+        triton::engines::solver::QueryFeatures features = triton::engines::solver::TimeoutBudget::getFeatures(node);
+        triton::engines::solver::status_e st = triton::engines::solver::TIMEOUT;
+        triton::uint32 time = 0;
+        triton::uint32 budget = this->timeoutBudget.allocate(node, features);
+
+        /* A spent round does not reach the solver */
+        for (triton::uint32 attempt = 0; budget != 0; attempt++) {
+          st   = triton::engines::solver::UNKNOWN;
+          time = 0;
+          solve(&st, budget, &time);
+          this->timeoutBudget.record(node, features, budget, st, time);
+          if (st != triton::engines::solver::TIMEOUT)
+            break;
+          budget = this->timeoutBudget.retry(node, budget, attempt);
+        }
+
+        if (status)
+          *status = st;
+
+        if (solvingTime)
+          *solvingTime = time;
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> SolverEngine::solveModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        if ((!this->queryCacheEnabled && !this->counterexampleEnabled && !this->unsatCoreEnabled) || node == nullptr) {
+          std::unordered_map<triton::usize, SolverModel> model;
+          this->solveBudgeted(node, status, timeout, solvingTime, [&](triton::engines::solver::status_e* s, triton::uint32 t, triton::uint32* time) {
+            model = this->route(node)->getModel(node, s, t, time);
+          });
+          return model;
+        }
+
+        /* A model is one model of getModels() */
+        std::unique_ptr<triton::engines::solver::QueryCanonicalizer> query;
+        if (this->queryCacheEnabled) {
+          std::vector<std::unordered_map<triton::usize, SolverModel>> models;
+          query.reset(new triton::engines::solver::QueryCanonicalizer(node));
+          if (this->findQuery(*query, timeout, 1, status, solvingTime, &models))
+            return models.empty() ? std::unordered_map<triton::usize, SolverModel>{} : models.front();
+        }
+
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        std::unordered_map<triton::usize, SolverModel> model;
+
+        if (this->findUnsatCore(node)) {
+          st = triton::engines::solver::UNSAT;
+          if (solvingTime)
+            *solvingTime = 0;
+        }
+        else if (this->findCounterexample(node, model)) {
+          st = triton::engines::solver::SAT;
+          if (solvingTime)
+            *solvingTime = 0;
+        }
+        else {
+          this->solveBudgeted(node, &st, timeout, solvingTime, [&](triton::engines::solver::status_e* s, triton::uint32 t, triton::uint32* time) {
+            model = this->route(node)->getModel(node, s, t, time);
+          });
+          if (this->queryCacheEnabled)
+            this->queryCacheMisses++;
+
+          /* Custom solvers may not write back the status */
+          if (st == triton::engines::solver::UNKNOWN && !model.empty())
+            st = triton::engines::solver::SAT;
+
+          if (st == triton::engines::solver::SAT)
+            this->storeCounterexample(model);
+          else if (st == triton::engines::solver::UNSAT)
+            this->storeUnsatCore(node, timeout);
+        }
+
+        if (this->queryCacheEnabled)
+          this->storeQuery(*query, timeout, 1, st, model.empty() ? std::vector<std::unordered_map<triton::usize, SolverModel>>{} : std::vector<std::unordered_map<triton::usize, SolverModel>>{model});
+
+        if (status)
+          *status = st;
+
+        return model;
+      }
+
+
+      std::vector<triton::ast::SharedAbstractNode> SolverEngine::splitIndependentConstraints(const triton::ast::SharedAbstractNode& node) const {
+        std::vector<triton::ast::SharedAbstractNode> conjuncts = SolverEngine::getConjuncts(node);
+
+        if (conjuncts.size() < 2)
+          return {node};
+
+        /* Union-find of the constraints sharing a variable. The memory array is a variable shared by all its selects */
+        std::vector<triton::usize> parents(conjuncts.size());
+        std::iota(parents.begin(), parents.end(), 0);
+
+        auto find = [&parents](triton::usize index) {
+          while (parents[index] != index)
+            index = parents[index] = parents[parents[index]];
+          return index;
+        };
+
+        const triton::usize memoryKey = static_cast<triton::usize>(-1);
+        std::unordered_map<triton::usize, triton::usize> owners;
+        std::vector<bool> ground(conjuncts.size(), true);
+
+        for (triton::usize index = 0; index < conjuncts.size(); index++) {
+          /* The variables and arrays are summarized by the nodes */
+          std::vector<triton::usize> keys = conjuncts[index]->getVariableIds();
+          if (conjuncts[index]->containsArray())
+            keys.push_back(memoryKey);
+
+          for (triton::usize key : keys) {
+            ground[index] = false;
+            auto it = owners.find(key);
+            if (it == owners.end())
+              owners[key] = index;
+            else
+              parents[find(index)] = find(it->second);
+          }
+        }
+
+        /* The constraints without variable go with the last constraint */
+        triton::usize last = conjuncts.size() - 1;
+        for (triton::usize index = 0; index < conjuncts.size(); index++) {
+          if (ground[index] && index != last)
+            parents[index] = find(last);
+        }
+        if (ground[last]) {
+          for (triton::usize index = 0; index < last; index++) {
+            if (!ground[index]) {
+              parents[find(last)] = find(index);
+              break;
+            }
+          }
+        }
+
+        /* Group the constraints by cluster, the cluster of the last constraint first */
+        std::unordered_map<triton::usize, triton::usize> clusterIds;
+        std::vector<std::vector<triton::ast::SharedAbstractNode>> clusters;
+
+        clusterIds[find(last)] = 0;
+        clusters.emplace_back();
+        for (triton::usize index = 0; index < conjuncts.size(); index++) {
+          triton::usize root = find(index);
+          auto it = clusterIds.find(root);
+          if (it == clusterIds.end()) {
+            it = clusterIds.emplace(root, clusters.size()).first;
+            clusters.emplace_back();
+          }
+          clusters[it->second].push_back(conjuncts[index]);
+        }
+
+        if (clusters.size() == 1)
+          return {node};
+
+        std::vector<triton::ast::SharedAbstractNode> ret;
+        for (const auto& cluster : clusters)
+          ret.push_back(cluster.size() == 1 ? cluster.front() : node->getContext()->land(cluster));
+
+        return ret;
+      }
+
+
+      triton::engines::solver::status_e SolverEngine::presolve(const triton::ast::SharedAbstractNode& node, bool model) const {
+        if (!this->presolverEnabled || node == nullptr)
+          return triton::engines::solver::UNKNOWN;
+
+        triton::ast::AbstractValue value = node->getContext()->getAbstractValue(node);
+        if (!value.isConstant())
+          return triton::engines::solver::UNKNOWN;
+
+        /* The model of a true constraint is the empty one only without variable */
+        if (model && value.isTrue() && node->isSymbolized())
+          return triton::engines::solver::UNKNOWN;
+
+        this->presolverHits++;
+        return value.isTrue() ? triton::engines::solver::SAT : triton::engines::solver::UNSAT;
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> SolverEngine::computeModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
         if (!this->solver)
           return std::unordered_map<triton::usize, SolverModel>{};
-        return this->solver->getModel(node, status, timeout, solvingTime);
+
+        triton::engines::solver::status_e decided = this->presolve(node, true);
+        if (decided != triton::engines::solver::UNKNOWN) {
+          if (status)
+            *status = decided;
+          if (solvingTime)
+            *solvingTime = 0;
+          return std::unordered_map<triton::usize, SolverModel>{};
+        }
+
+        if (!this->independenceEnabled || node == nullptr)
+          return this->solveModel(node, status, timeout, solvingTime);
+
+        auto clusters = this->splitIndependentConstraints(node);
+        if (clusters.size() == 1)
+          return this->solveModel(node, status, timeout, solvingTime);
+
+        /* The models of the clusters are merged, the first one which is not satisfiable stops */
+        std::unordered_map<triton::usize, SolverModel> ret;
+        triton::engines::solver::status_e st = triton::engines::solver::SAT;
+        triton::uint32 total = 0;
+
+        for (const auto& cluster : clusters) {
+          triton::engines::solver::status_e cst = triton::engines::solver::UNKNOWN;
+          triton::uint32 time = 0;
+
+          auto model = this->solveModel(cluster, &cst, timeout, &time);
+          total += time;
+
+          if (cst == triton::engines::solver::UNKNOWN && !model.empty())
+            cst = triton::engines::solver::SAT;
+
+          if (cst != triton::engines::solver::SAT) {
+            st = cst;
+            ret.clear();
+            break;
+          }
+
+          ret.insert(model.begin(), model.end());
+        }
+
+        if (status)
+          *status = st;
+
+        if (solvingTime)
+          *solvingTime = total;
+
+        return ret;
       }
 
 
-      std::vector<std::unordered_map<triton::usize, SolverModel>> SolverEngine::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+      std::vector<std::unordered_map<triton::usize, SolverModel>> SolverEngine::computeModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
         if (!this->solver)
           return std::vector<std::unordered_map<triton::usize, SolverModel>>{};
-        return this->solver->getModels(node, limit, status, timeout, solvingTime);
+
+        triton::engines::solver::status_e decided = this->presolve(node, true);
+        if (decided != triton::engines::solver::UNKNOWN) {
+          if (status)
+            *status = decided;
+          if (solvingTime)
+            *solvingTime = 0;
+          if (decided == triton::engines::solver::UNSAT || limit == 0)
+            return std::vector<std::unordered_map<triton::usize, SolverModel>>{};
+          return std::vector<std::unordered_map<triton::usize, SolverModel>>(1);
+        }
+
+        if (!this->queryCacheEnabled || node == nullptr) {
+          if (this->findUnsatCore(node)) {
+            if (status)
+              *status = triton::engines::solver::UNSAT;
+            if (solvingTime)
+              *solvingTime = 0;
+            return std::vector<std::unordered_map<triton::usize, SolverModel>>{};
+          }
+
+          triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+          std::vector<std::unordered_map<triton::usize, SolverModel>> models;
+          this->solveBudgeted(node, &st, timeout, solvingTime, [&](triton::engines::solver::status_e* s, triton::uint32 t, triton::uint32* time) {
+            models = this->route(node)->getModels(node, limit, s, t, time);
+          });
+          for (const auto& model : models)
+            this->storeCounterexample(model);
+
+          if (st == triton::engines::solver::UNSAT)
+            this->storeUnsatCore(node, timeout);
+
+          if (status)
+            *status = st;
+
+          return models;
+        }
+
+        triton::engines::solver::QueryCanonicalizer query(node);
+        std::vector<std::unordered_map<triton::usize, SolverModel>> models;
+        if (this->findQuery(query, timeout, limit, status, solvingTime, &models))
+          return models;
+
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+        if (this->findUnsatCore(node)) {
+          st = triton::engines::solver::UNSAT;
+          if (solvingTime)
+            *solvingTime = 0;
+        }
+        else {
+          this->solveBudgeted(node, &st, timeout, solvingTime, [&](triton::engines::solver::status_e* s, triton::uint32 t, triton::uint32* time) {
+            models = this->route(node)->getModels(node, limit, s, t, time);
+          });
+          this->queryCacheMisses++;
+
+          /* Custom solvers may not write back the status */
+          if (st == triton::engines::solver::UNKNOWN && !models.empty())
+            st = triton::engines::solver::SAT;
+
+          if (st == triton::engines::solver::UNSAT)
+            this->storeUnsatCore(node, timeout);
+        }
+
+        for (const auto& model : models)
+          this->storeCounterexample(model);
+
+        this->storeQuery(query, timeout, limit, st, models);
+
+        if (status)
+          *status = st;
+
+        return models;
+      }
+
+
+      bool SolverEngine::solveSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        if ((!this->queryCacheEnabled && !this->counterexampleEnabled && !this->unsatCoreEnabled) || node == nullptr) {
+          bool sat = false;
+          this->solveBudgeted(node, status, timeout, solvingTime, [&](triton::engines::solver::status_e* s, triton::uint32 t, triton::uint32* time) {
+            sat = this->route(node)->isSat(node, s, t, time);
+          });
+          return sat;
+        }
+
+        /* The status of a model query answers as well */
+        std::unique_ptr<triton::engines::solver::QueryCanonicalizer> query;
+        if (this->queryCacheEnabled) {
+          query.reset(new triton::engines::solver::QueryCanonicalizer(node));
+          const QueryResult* result = this->findQuery(*query, timeout, 0, status, solvingTime);
+          if (result == nullptr)
+            result = this->findQuery(*query, timeout, 1, status, solvingTime);
+          if (result)
+            return result->status == triton::engines::solver::SAT;
+        }
+
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        std::unordered_map<triton::usize, SolverModel> model;
+        bool sat = true;
+
+        if (this->findUnsatCore(node)) {
+          st  = triton::engines::solver::UNSAT;
+          sat = false;
+          if (solvingTime)
+            *solvingTime = 0;
+        }
+        else if (this->findCounterexample(node, model)) {
+          st = triton::engines::solver::SAT;
+          if (solvingTime)
+            *solvingTime = 0;
+        }
+        else {
+          /* Not solved if the round is spent */
+          sat = false;
+          this->solveBudgeted(node, &st, timeout, solvingTime, [&](triton::engines::solver::status_e* s, triton::uint32 t, triton::uint32* time) {
+            sat = this->route(node)->isSat(node, s, t, time);
+          });
+          if (this->queryCacheEnabled)
+            this->queryCacheMisses++;
+
+          /* Custom solvers may not write back the status */
+          if (st == triton::engines::solver::UNKNOWN && sat)
+            st = triton::engines::solver::SAT;
+
+          if (st == triton::engines::solver::UNSAT)
+            this->storeUnsatCore(node, timeout);
+        }
+
+        if (this->queryCacheEnabled)
+          this->storeQuery(*query, timeout, 0, st, {});
+
+        if (status)
+          *status = st;
+
+        return sat;
+      }
+
+
+      bool SolverEngine::computeSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        if (!this->solver)
+          return false;
+
+        triton::engines::solver::status_e decided = this->presolve(node, false);
+        if (decided != triton::engines::solver::UNKNOWN) {
+          if (status)
+            *status = decided;
+          if (solvingTime)
+            *solvingTime = 0;
+          return decided == triton::engines::solver::SAT;
+        }
+
+        if (!this->independenceEnabled || node == nullptr)
+          return this->solveSat(node, status, timeout, solvingTime);
+
+        auto clusters = this->splitIndependentConstraints(node);
+        if (clusters.size() == 1)
+          return this->solveSat(node, status, timeout, solvingTime);
+
+        /* The first cluster which is not satisfiable stops */
+        triton::engines::solver::status_e st = triton::engines::solver::SAT;
+        triton::uint32 total = 0;
+        bool sat = true;
+
+        for (const auto& cluster : clusters) {
+          triton::engines::solver::status_e cst = triton::engines::solver::UNKNOWN;
+          triton::uint32 time = 0;
+
+          sat = this->solveSat(cluster, &cst, timeout, &time);
+          total += time;
+
+          if (sat == false) {
+            st = (cst == triton::engines::solver::SAT) ? triton::engines::solver::UNKNOWN : cst;
+            break;
+          }
+        }
+
+        if (status)
+          *status = st;
+
+        if (solvingTime)
+          *solvingTime = total;
+
+        return sat;
+      }
+
+
+      bool SolverEngine::isRecording(void) const {
+        return this->statisticsEnabled || this->traceCallback;
+      }
+
+
+      void SolverEngine::recordQuery(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e status, triton::uint32 solvingTime, triton::uint64 queryTime) const {
+        triton::engines::solver::SolverQuery query = {node, limit, status, solvingTime, queryTime, 0, 0};
+
+        /* The distinct nodes and variables of the constraint, the referenced expressions included */
+        if (node != nullptr) {
+          std::stack<triton::ast::AbstractNode*> nodes;
+          triton::ast::VisitedNodes visited(node->getContext());
+
+          nodes.push(node.get());
+          while (!nodes.empty()) {
+            triton::ast::AbstractNode* current = nodes.top();
+            nodes.pop();
+
+            if (!visited.insert(current))
+              continue;
+
+            query.nodes++;
+            if (current->getType() == triton::ast::VARIABLE_NODE)
+              query.variables++;
+
+            if (current->getType() == triton::ast::REFERENCE_NODE) {
+              nodes.push(reinterpret_cast<triton::ast::ReferenceNode*>(current)->getSymbolicExpression()->getAst().get());
+            }
+            else {
+              for (const auto& child : current->getChildren())
+                nodes.push(child.get());
+            }
+          }
+        }
+
+        if (this->statisticsEnabled) {
+          triton::uint64 checkTime = std::min<triton::uint64>(static_cast<triton::uint64>(solvingTime) * 1000, queryTime);
+          triton::usize bucket = 0;
+
+          for (triton::uint64 bound = 1000; bucket + 1 < triton::engines::solver::timeBuckets && queryTime >= bound; bound *= 10)
+            bucket++;
+
+          this->statistics.queries++;
+          this->statistics.statuses[std::min<triton::usize>(status, triton::engines::solver::UNKNOWN)]++;
+          this->statistics.histogram[bucket]++;
+          this->statistics.nodes           += query.nodes;
+          this->statistics.maxNodes         = std::max(this->statistics.maxNodes, query.nodes);
+          this->statistics.variables       += query.variables;
+          this->statistics.queryTime       += queryTime;
+          this->statistics.checkTime       += checkTime;
+          this->statistics.translationTime += queryTime - checkTime;
+          this->statistics.maxQueryTime     = std::max(this->statistics.maxQueryTime, queryTime);
+        }
+
+        if (this->traceCallback)
+          this->traceCallback(query);
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> SolverEngine::getModel(const triton::ast::SharedAbstractNode& root, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        TRITON_TRACE("solver", "SolverEngine::getModel");
+        const triton::ast::SharedAbstractNode node = SolverEngine::balanceQuery(root);
+
+        if (!this->isRecording())
+          return this->computeModel(node, status, timeout, solvingTime);
+
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        triton::uint32 time = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        auto model = this->computeModel(node, &st, timeout, &time);
+        auto end = std::chrono::steady_clock::now();
+
+        /* Custom solvers may not write back the status */
+        this->recordQuery(node, 1, (st == triton::engines::solver::UNKNOWN && !model.empty()) ? triton::engines::solver::SAT : st, time, std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+        if (status)
+          *status = st;
+
+        if (solvingTime)
+          *solvingTime = time;
+
+        return model;
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> SolverEngine::getModels(const triton::ast::SharedAbstractNode& root, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        TRITON_TRACE("solver", "SolverEngine::getModels");
+        const triton::ast::SharedAbstractNode node = SolverEngine::balanceQuery(root);
+
+        if (!this->isRecording())
+          return this->computeModels(node, limit, status, timeout, solvingTime);
+
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        triton::uint32 time = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        auto models = this->computeModels(node, limit, &st, timeout, &time);
+        auto end = std::chrono::steady_clock::now();
+
+        this->recordQuery(node, limit, (st == triton::engines::solver::UNKNOWN && !models.empty()) ? triton::engines::solver::SAT : st, time, std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+        if (status)
+          *status = st;
+
+        if (solvingTime)
+          *solvingTime = time;
+
+        return models;
       }
 
 
-      bool SolverEngine::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+      triton::usize SolverEngine::enumerateModels(const triton::ast::SharedAbstractNode& root, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, const triton::engines::solver::ModelCallback& callback, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        TRITON_TRACE("solver", "SolverEngine::enumerateModels");
+        const triton::ast::SharedAbstractNode node = SolverEngine::balanceQuery(root);
+
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        triton::uint32 time = 0;
+
         if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::enumerateModels(): Solver undefined.");
+
+        if (callback == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::enumerateModels(): The callback must be defined.");
+
+        auto start = std::chrono::steady_clock::now();
+
+        /* The models are streamed, a counterexample is still kept from each of them */
+        triton::usize count = this->solver->enumerateModels(node, projection, [&](const std::unordered_map<triton::usize, SolverModel>& model) {
+          this->storeCounterexample(model);
+          return callback(model);
+        }, limit, &st, timeout, &time);
+
+        auto end = std::chrono::steady_clock::now();
+
+        if (this->isRecording())
+          this->recordQuery(node, limit, st, time, std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+        if (status)
+          *status = st;
+
+        if (solvingTime)
+          *solvingTime = time;
+
+        return count;
+      }
+
+
+      bool SolverEngine::isSat(const triton::ast::SharedAbstractNode& root, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        TRITON_TRACE("solver", "SolverEngine::isSat");
+        const triton::ast::SharedAbstractNode node = SolverEngine::balanceQuery(root);
+
+        if (!this->isRecording())
+          return this->computeSat(node, status, timeout, solvingTime);
+
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        triton::uint32 time = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        bool sat = this->computeSat(node, &st, timeout, &time);
+        auto end = std::chrono::steady_clock::now();
+
+        this->recordQuery(node, 0, (st == triton::engines::solver::UNKNOWN && sat) ? triton::engines::solver::SAT : st, time, std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+        if (status)
+          *status = st;
+
+        if (solvingTime)
+          *solvingTime = time;
+
+        return sat;
+      }
+
+
+      bool SolverEngine::isOpaquePredicate(const triton::ast::SharedAbstractNode& node, triton::uint512* value, triton::usize samples, triton::uint32 timeout) const {
+        TRITON_TRACE("solver", "SolverEngine::isOpaquePredicate");
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::isOpaquePredicate(): node cannot be null.");
+
+        auto actx = node->getContext();
+        triton::uint512 constant = 0;
+
+        /* A node which varies across the samples is rejected without query */
+        if (!actx->sampleConstant(node, samples, &constant))
+          return false;
+
+        if (!node->isSymbolized()) {
+          if (value)
+            *value = constant;
+          return true;
+        }
+
+        /* The solver proves that no input gives another value */
+        triton::ast::SharedAbstractNode other = nullptr;
+        if (node->isLogical())
+          other = (constant != 0) ? actx->lnot(node) : node;
+        else
+          other = actx->distinct(node, actx->bv(constant, node->getBitvectorSize()));
+
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        this->isSat(other, &status, timeout);
+        if (status != triton::engines::solver::UNSAT)
           return false;
-        return this->solver->isSat(node, status, timeout, solvingTime);
+
+        if (value)
+          *value = constant;
+
+        return true;
+      }
+
+
+      void SolverEngine::solveAll(const std::vector<triton::ast::SharedAbstractNode>& roots, triton::usize threads, triton::uint32 timeout, const std::function<void(triton::usize index, triton::engines::solver::status_e status, const std::unordered_map<triton::usize, SolverModel>& model, triton::uint32 solvingTime)>& callback) const {
+        /* A result of a worker */
+        struct Result {
+          triton::usize index;
+          triton::engines::solver::status_e status;
+          std::unordered_map<triton::usize, SolverModel> model;
+          triton::uint32 time;
+          triton::uint64 queryTime;
+        };
+
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::solveAll(): Solver undefined.");
+
+        /* The queries are balanced on the calling thread */
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+        nodes.reserve(roots.size());
+        for (const auto& root : roots)
+          nodes.push_back(SolverEngine::balanceQuery(root));
+
+        auto solve = [&](triton::usize index) {
+          Result result = {index, triton::engines::solver::UNKNOWN, {}, 0, 0};
+          auto start = std::chrono::steady_clock::now();
+          result.model = this->solver->getModel(nodes[index], &result.status, timeout, &result.time);
+          result.queryTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+          /* Custom solvers may not write back the status */
+          if (result.status == triton::engines::solver::UNKNOWN && !result.model.empty())
+            result.status = triton::engines::solver::SAT;
+
+          return result;
+        };
+
+        std::mutex lock;
+        std::condition_variable ready;
+        std::deque<Result> results;
+        std::exception_ptr error;
+        std::atomic<triton::usize> next(0);
+        std::vector<std::thread> pool;
+        triton::usize finished = 0;
+
+        /* Each query converts the constraints into its own solver context */
+        auto work = [&]() {
+          for (triton::usize index = next++; index < nodes.size(); index = next++) {
+            try {
+              Result result = solve(index);
+              std::lock_guard<std::mutex> guard(lock);
+              results.push_back(std::move(result));
+            }
+            catch (...) {
+              std::lock_guard<std::mutex> guard(lock);
+              if (!error)
+                error = std::current_exception();
+              next = nodes.size();
+            }
+            ready.notify_one();
+          }
+
+          std::lock_guard<std::mutex> guard(lock);
+          finished++;
+          ready.notify_one();
+        };
+
+        #ifdef TRITON_REMOTE_INTERFACE
+        /* The remote queries are all outstanding at once, the workers solve them in parallel */
+        if (this->kind == triton::engines::solver::SOLVER_REMOTE) {
+          auto remote = static_cast<const triton::engines::solver::RemoteSolver*>(this->solver.get());
+          remote->solveAll(nodes, timeout, [&](triton::usize index, triton::engines::solver::status_e status, const std::unordered_map<triton::usize, SolverModel>& model, triton::uint32 solvingTime) {
+            /* The queries overlap, their search time stands for their time */
+            if (this->isRecording())
+              this->recordQuery(nodes[index], 1, status, solvingTime, static_cast<triton::uint64>(solvingTime) * 1000);
+            if (callback)
+              callback(index, status, model, solvingTime);
+          });
+          return;
+        }
+        #endif
+
+        /* Custom solvers may call back into Python, they stay on the calling thread */
+        triton::usize count = threads ? threads : std::thread::hardware_concurrency();
+        count = std::min<triton::usize>(std::max<triton::usize>(count, 1), nodes.size());
+
+        if (count > 1 && this->kind != triton::engines::solver::SOLVER_CUSTOM) {
+          for (triton::usize i = 0; i < count; i++) {
+            try {
+              pool.emplace_back(work);
+            }
+            catch (const std::system_error&) {
+              break;
+            }
+          }
+        }
+
+        if (pool.empty()) {
+          for (triton::usize index = 0; index < nodes.size(); index++) {
+            Result result = solve(index);
+            if (this->isRecording())
+              this->recordQuery(nodes[result.index], 1, result.status, result.time, result.queryTime);
+            if (callback)
+              callback(result.index, result.status, result.model, result.time);
+          }
+          return;
+        }
+
+        /* The results are handed to the callback as they finish */
+        std::unique_lock<std::mutex> guard(lock);
+        while (true) {
+          ready.wait(guard, [&]() { return !results.empty() || finished == pool.size(); });
+          if (results.empty())
+            break;
+
+          Result result = std::move(results.front());
+          results.pop_front();
+
+          if ((callback || this->isRecording()) && !error) {
+            guard.unlock();
+            try {
+              if (this->isRecording())
+                this->recordQuery(nodes[result.index], 1, result.status, result.time, result.queryTime);
+              if (callback)
+                callback(result.index, result.status, result.model, result.time);
+            }
+            catch (...) {
+              guard.lock();
+              if (!error)
+                error = std::current_exception();
+              next = nodes.size();
+              continue;
+            }
+            guard.lock();
+          }
+        }
+        guard.unlock();
+
+        for (auto& thread : pool)
+          thread.join();
+
+        if (error)
+          std::rethrow_exception(error);
+      }
+
+
+      void SolverEngine::asyncWork(void) const {
+        std::unique_lock<std::mutex> guard(this->asyncLock);
+
+        while (true) {
+          this->asyncIdle++;
+          this->asyncPending.wait(guard, [this]() { return this->asyncStop || !this->asyncQueries.empty(); });
+          this->asyncIdle--;
+
+          if (this->asyncStop)
+            return;
+
+          auto query = std::move(this->asyncQueries.front());
+          this->asyncQueries.pop_front();
+          this->asyncRunning.insert(query);
+          guard.unlock();
+
+          /* Each query converts the constraint into its own solver context */
+          auto node = query->solve(this->solver.get());
+
+          guard.lock();
+          this->asyncRunning.erase(query);
+          if (node != nullptr)
+            this->asyncReleased.push_back(std::move(node));
+        }
+      }
+
+
+      std::shared_ptr<triton::engines::solver::SolverFuture> SolverEngine::submit(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::uint32 timeout) const {
+        std::vector<triton::ast::SharedAbstractNode> released;
+        bool queued = false;
+
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::submit(): Solver undefined.");
+
+        auto query = std::make_shared<triton::engines::solver::SolverFuture>(SolverEngine::balanceQuery(node), limit, timeout);
+
+        /* Custom solvers may call back into Python, they stay on the calling thread */
+        if (this->kind != triton::engines::solver::SOLVER_CUSTOM) {
+          std::lock_guard<std::mutex> guard(this->asyncLock);
+          released.swap(this->asyncReleased);
+
+          /* A worker is started when none is waiting, up to one per core */
+          triton::usize count = std::max<triton::usize>(std::thread::hardware_concurrency(), 1);
+          if (this->asyncIdle <= this->asyncQueries.size() && this->asyncWorkers.size() < count) {
+            try {
+              this->asyncWorkers.emplace_back(&SolverEngine::asyncWork, this);
+            }
+            catch (const std::system_error&) {
+            }
+          }
+
+          if (!this->asyncWorkers.empty()) {
+            this->asyncQueries.push_back(query);
+            queued = true;
+          }
+        }
+
+        if (queued)
+          this->asyncPending.notify_one();
+        else
+          query->solve(this->solver.get());
+
+        return query;
+      }
+
+
+      void SolverEngine::cancelAsync(void) {
+        std::deque<std::shared_ptr<triton::engines::solver::SolverFuture>> pending;
+        std::vector<std::shared_ptr<triton::engines::solver::SolverFuture>> running;
+        std::vector<triton::ast::SharedAbstractNode> released;
+
+        {
+          std::lock_guard<std::mutex> guard(this->asyncLock);
+          pending.swap(this->asyncQueries);
+          running.assign(this->asyncRunning.begin(), this->asyncRunning.end());
+          released.swap(this->asyncReleased);
+        }
+
+        for (auto& query : pending)
+          query->cancel();
+
+        for (auto& query : running)
+          query->cancel();
+      }
+
+
+      void SolverEngine::stopAsync(void) {
+        this->cancelAsync();
+
+        {
+          std::lock_guard<std::mutex> guard(this->asyncLock);
+          this->asyncStop = true;
+        }
+        this->asyncPending.notify_all();
+
+        for (auto& worker : this->asyncWorkers)
+          worker.join();
+
+        this->asyncReleased.clear();
+        this->asyncWorkers.clear();
+        this->asyncStop = false;
+      }
+
+
+      std::shared_ptr<triton::engines::solver::SolverFuture> SolverEngine::getModelAsync(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout) const {
+        return this->submit(node, 1, timeout);
+      }
+
+
+      std::shared_ptr<triton::engines::solver::SolverFuture> SolverEngine::isSatAsync(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout) const {
+        return this->submit(node, 0, timeout);
+      }
+
+
+      triton::usize SolverEngine::getAsyncSize(void) const {
+        std::lock_guard<std::mutex> guard(this->asyncLock);
+        return this->asyncQueries.size() + this->asyncRunning.size();
       }
 
 
@@ -119,6 +1335,7 @@ namespace triton {
         if (this->solver) {
           this->solver->setTimeout(ms);
         }
+        this->bitBlastSolver.setTimeout(ms);
       }
 
 
@@ -128,6 +1345,280 @@ namespace triton {
         }
       }
 
+
+      void SolverEngine::enableQueryCache(bool flag, triton::usize capacity) {
+        this->queryCacheEnabled  = flag;
+        this->queryCacheCapacity = flag ? capacity : 0;
+        if (flag == false || this->queryResults.size() > capacity)
+          this->clearQueryCache();
+      }
+
+
+      bool SolverEngine::isQueryCacheEnabled(void) const {
+        return this->queryCacheEnabled;
+      }
+
+
+      triton::usize SolverEngine::getQueryCacheSize(void) const {
+        return this->queryResults.size();
+      }
+
+
+      triton::usize SolverEngine::getQueryCacheHits(void) const {
+        return this->queryCacheHits;
+      }
+
+
+      triton::usize SolverEngine::getQueryCacheMisses(void) const {
+        return this->queryCacheMisses;
+      }
+
+
+      void SolverEngine::clearQueryCache(void) {
+        this->queryCache.clear();
+        this->queryResults.clear();
+        this->queryCacheHits   = 0;
+        this->queryCacheMisses = 0;
+      }
+
+
+      void SolverEngine::openSharedQueryCache(const std::string& path, triton::usize slots) {
+        #ifdef TRITON_PERSISTENT_CACHE
+        this->sharedQueryCache.reset();
+        this->sharedQueryCache.reset(new triton::engines::solver::SharedQueryCache(path, slots));
+        return;
+        #endif
+        throw triton::exceptions::SolverEngine("SolverEngine::openSharedQueryCache(): Triton not built with the persistent caches");
+      }
+
+
+      void SolverEngine::closeSharedQueryCache(void) {
+        #ifdef TRITON_PERSISTENT_CACHE
+        this->sharedQueryCache.reset();
+        #endif
+      }
+
+
+      bool SolverEngine::isSharedQueryCacheOpen(void) const {
+        #ifdef TRITON_PERSISTENT_CACHE
+        return this->sharedQueryCache != nullptr;
+        #endif
+        return false;
+      }
+
+
+      void SolverEngine::enableAdaptiveTimeout(bool flag) {
+        this->timeoutBudget.enable(flag);
+      }
+
+
+      bool SolverEngine::isAdaptiveTimeoutEnabled(void) const {
+        return this->timeoutBudget.isEnabled();
+      }
+
+
+      void SolverEngine::setAdaptiveTimeoutBounds(triton::uint32 minTimeout, triton::uint32 maxTimeout) {
+        this->timeoutBudget.setBounds(minTimeout, maxTimeout);
+      }
+
+
+      void SolverEngine::startTimeoutRound(triton::uint64 budget) {
+        this->timeoutBudget.startRound(budget);
+      }
+
+
+      triton::uint64 SolverEngine::getTimeoutRoundRemaining(void) const {
+        return this->timeoutBudget.getRemaining();
+      }
+
+
+      void SolverEngine::setTimeoutRetryCallback(const triton::engines::solver::TimeoutBudget::RetryCallback& callback, triton::uint32 retries) {
+        this->timeoutBudget.setRetryCallback(callback, retries);
+      }
+
+
+      triton::uint32 SolverEngine::predictSolvingTime(const triton::ast::SharedAbstractNode& node) const {
+        return this->timeoutBudget.predict(node);
+      }
+
+
+      const triton::engines::solver::SolverInterface* SolverEngine::route(const triton::ast::SharedAbstractNode& node) const {
+        /* The arrays and the large arithmetic are left to the current solver */
+        if (this->bitBlastingEnabled && triton::engines::solver::BitBlaster::isSupported(node, this->bitBlastingMaxNodes))
+          return &this->bitBlastSolver;
+        return this->solver.get();
+      }
+
+
+      void SolverEngine::enableBitBlasting(bool flag, triton::usize maxNodes) {
+        this->bitBlastingEnabled  = flag;
+        this->bitBlastingMaxNodes = maxNodes;
+      }
+
+
+      bool SolverEngine::isBitBlastingEnabled(void) const {
+        return this->bitBlastingEnabled;
+      }
+
+
+      void SolverEngine::enableCounterexampleCache(bool flag, triton::usize capacity) {
+        this->counterexampleEnabled  = flag;
+        this->counterexampleCapacity = flag ? capacity : 0;
+        if (flag == false)
+          this->clearCounterexampleCache();
+
+        while (this->counterexamples.size() > this->counterexampleCapacity)
+          this->counterexamples.pop_back();
+      }
+
+
+      bool SolverEngine::isCounterexampleCacheEnabled(void) const {
+        return this->counterexampleEnabled;
+      }
+
+
+      triton::usize SolverEngine::getCounterexampleCacheSize(void) const {
+        return this->counterexamples.size();
+      }
+
+
+      triton::usize SolverEngine::getCounterexampleCacheHits(void) const {
+        return this->counterexampleHits;
+      }
+
+
+      void SolverEngine::clearCounterexampleCache(void) {
+        this->counterexamples.clear();
+        this->counterexampleHits = 0;
+      }
+
+
+      void SolverEngine::enableUnsatCoreCache(bool flag, triton::usize capacity) {
+        this->unsatCoreEnabled  = flag;
+        this->unsatCoreCapacity = flag ? capacity : 0;
+        if (flag == false)
+          this->clearUnsatCoreCache();
+
+        while (this->unsatCores.size() > this->unsatCoreCapacity)
+          this->unsatCores.pop_back();
+      }
+
+
+      bool SolverEngine::isUnsatCoreCacheEnabled(void) const {
+        return this->unsatCoreEnabled;
+      }
+
+
+      triton::usize SolverEngine::getUnsatCoreCacheSize(void) const {
+        return this->unsatCores.size();
+      }
+
+
+      triton::usize SolverEngine::getUnsatCoreCacheHits(void) const {
+        return this->unsatCoreHits;
+      }
+
+
+      void SolverEngine::clearUnsatCoreCache(void) {
+        this->unsatCores.clear();
+        this->unsatCoreHits = 0;
+      }
+
+
+      void SolverEngine::enableConstraintIndependence(bool flag) {
+        this->independenceEnabled = flag;
+      }
+
+
+      bool SolverEngine::isConstraintIndependenceEnabled(void) const {
+        return this->independenceEnabled;
+      }
+
+
+      void SolverEngine::enablePresolver(bool flag) {
+        this->presolverEnabled = flag;
+        if (flag == false)
+          this->presolverHits = 0;
+      }
+
+
+      bool SolverEngine::isPresolverEnabled(void) const {
+        return this->presolverEnabled;
+      }
+
+
+      triton::usize SolverEngine::getPresolverHits(void) const {
+        return this->presolverHits;
+      }
+
+
+      void SolverEngine::enableQueryClassification(bool flag) {
+        this->queries.enableClassification(flag);
+        if (this->solver)
+          this->solver->setQueryConfigurations(this->queries);
+      }
+
+
+      bool SolverEngine::isQueryClassificationEnabled(void) const {
+        return this->queries.isClassificationEnabled();
+      }
+
+
+      void SolverEngine::setQueryConfiguration(triton::engines::solver::query_e query, const triton::engines::solver::SolverConfiguration& config) {
+        this->queries.setConfiguration(query, config);
+        if (this->solver)
+          this->solver->setQueryConfigurations(this->queries);
+      }
+
+
+      const triton::engines::solver::SolverConfiguration& SolverEngine::getQueryConfiguration(triton::engines::solver::query_e query) const {
+        return this->queries.getConfiguration(query);
+      }
+
+
+      void SolverEngine::enableStatistics(bool flag) {
+        this->statisticsEnabled = flag;
+      }
+
+
+      bool SolverEngine::isStatisticsEnabled(void) const {
+        return this->statisticsEnabled;
+      }
+
+
+      triton::engines::solver::SolverStatistics SolverEngine::getStatistics(void) const {
+        triton::engines::solver::SolverStatistics ret = this->statistics;
+
+        ret.counterexampleHits = this->counterexampleHits;
+        ret.presolverHits      = this->presolverHits;
+        ret.queryCacheHits     = this->queryCacheHits;
+        ret.queryCacheMisses   = this->queryCacheMisses;
+
+        return ret;
+      }
+
+
+      void SolverEngine::clearStatistics(void) {
+        this->statistics = triton::engines::solver::SolverStatistics();
+      }
+
+
+      void SolverEngine::setTraceCallback(const std::function<void(const triton::engines::solver::SolverQuery& query)>& callback) {
+        this->traceCallback = callback;
+      }
+
+
+      std::shared_ptr<triton::engines::solver::SolverSession> SolverEngine::newSession(void) const {
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::newSession(): Solver undefined.");
+
+        std::shared_ptr<triton::engines::solver::SolverSession> session(this->solver->newSession());
+        if (session == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::newSession(): Not enough memory.");
+
+        return session;
+      }
+
     };
   };
 };
@@ -0,0 +1,167 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <chrono>
+
+#include <triton/exceptions.hpp>
+#include <triton/solverFuture.hpp>
+#include <triton/solverInterface.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverFuture::SolverFuture(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::uint32 timeout) {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverFuture::SolverFuture(): node cannot be null.");
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("SolverFuture::SolverFuture(): Must be a logical node.");
+
+        this->cancelled   = false;
+        this->limit       = limit;
+        this->node        = node;
+        this->ready       = false;
+        this->solvingTime = 0;
+        this->started     = false;
+        this->status      = triton::engines::solver::UNKNOWN;
+        this->timeout     = timeout;
+      }
+
+
+      triton::ast::SharedAbstractNode SolverFuture::solve(const triton::engines::solver::SolverInterface* solver) {
+        triton::ast::SharedAbstractNode query;
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        std::vector<std::unordered_map<triton::usize, SolverModel>> ms;
+        triton::uint32 time = 0;
+        std::exception_ptr err;
+
+        {
+          std::lock_guard<std::mutex> guard(this->lock);
+          if (this->ready)
+            return nullptr;
+          this->started = true;
+          query = std::move(this->node);
+        }
+
+        try {
+          ms = solver->getModels(query, this->limit, &st, this->timeout, &time, &this->interrupt);
+        }
+        catch (...) {
+          err = std::current_exception();
+        }
+
+        /* Custom solvers may not write back the status */
+        if (st == triton::engines::solver::UNKNOWN && !ms.empty())
+          st = triton::engines::solver::SAT;
+
+        {
+          std::lock_guard<std::mutex> guard(this->lock);
+
+          /* A query cancelled while ending has no result either */
+          if (this->cancelled) {
+            ms.clear();
+            st = triton::engines::solver::UNKNOWN;
+          }
+
+          this->error       = err;
+          this->models      = std::move(ms);
+          this->ready       = true;
+          this->solvingTime = time;
+          this->status      = st;
+        }
+        this->done.notify_all();
+
+        return query;
+      }
+
+
+      void SolverFuture::cancel(void) {
+        triton::ast::SharedAbstractNode query;
+
+        {
+          std::lock_guard<std::mutex> guard(this->lock);
+          if (this->ready)
+            return;
+
+          this->cancelled = true;
+          this->interrupt.interrupt();
+
+          /* A pending query ends at once */
+          if (!this->started) {
+            query = std::move(this->node);
+            this->ready = true;
+          }
+        }
+        this->done.notify_all();
+      }
+
+
+      bool SolverFuture::isCancelled(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->cancelled;
+      }
+
+
+      bool SolverFuture::isReady(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->ready;
+      }
+
+
+      void SolverFuture::wait(void) const {
+        std::unique_lock<std::mutex> guard(this->lock);
+        this->done.wait(guard, [this]() { return this->ready; });
+      }
+
+
+      bool SolverFuture::waitFor(triton::uint32 ms) const {
+        std::unique_lock<std::mutex> guard(this->lock);
+        return this->done.wait_for(guard, std::chrono::milliseconds(ms), [this]() { return this->ready; });
+      }
+
+
+      void SolverFuture::get(void) const {
+        this->wait();
+        if (this->error)
+          std::rethrow_exception(this->error);
+      }
+
+
+      triton::engines::solver::status_e SolverFuture::getStatus(void) const {
+        this->get();
+        return this->status;
+      }
+
+
+      bool SolverFuture::isSat(void) const {
+        return this->getStatus() == triton::engines::solver::SAT;
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> SolverFuture::getModel(void) const {
+        this->get();
+        return this->models.empty() ? std::unordered_map<triton::usize, SolverModel>() : this->models.front();
+      }
+
+
+      const std::vector<std::unordered_map<triton::usize, SolverModel>>& SolverFuture::getModels(void) const {
+        this->get();
+        return this->models;
+      }
+
+
+      triton::uint32 SolverFuture::getSolvingTime(void) const {
+        this->get();
+        return this->solvingTime;
+      }
+
+    };
+  };
+};
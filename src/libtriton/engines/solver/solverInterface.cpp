@@ -0,0 +1,111 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <unordered_set>
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/solverInterface.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      std::vector<triton::engines::symbolic::SharedSymbolicVariable> SolverInterface::getProjection(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection) {
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> ret;
+        std::unordered_set<triton::usize> ids;
+
+        if (projection.empty()) {
+          for (const auto& var : triton::ast::search(node, triton::ast::VARIABLE_NODE)) {
+            const auto& symVar = reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable();
+            if (ids.insert(symVar->getId()).second)
+              ret.push_back(symVar);
+          }
+          return ret;
+        }
+
+        for (const auto& symVar : projection) {
+          if (symVar == nullptr)
+            throw triton::exceptions::SolverEngine("SolverInterface::getProjection(): The projection cannot contain a null variable.");
+          if (ids.insert(symVar->getId()).second)
+            ret.push_back(symVar);
+        }
+
+        return ret;
+      }
+
+
+      triton::usize SolverInterface::enumerateModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, const ModelCallback& callback, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        triton::uint32 totalTime = 0;
+        triton::usize count = 0;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverInterface::enumerateModels(): node cannot be null.");
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("SolverInterface::enumerateModels(): Must be a logical node.");
+
+        if (callback == nullptr)
+          throw triton::exceptions::SolverEngine("SolverInterface::enumerateModels(): The callback must be defined.");
+
+        auto ctxt = node->getContext();
+        auto vars = SolverInterface::getProjection(node, projection);
+
+        /* The query and the blocking constraints of the previous models */
+        std::vector<triton::ast::SharedAbstractNode> exprs = {node->getType() == triton::ast::ASSERT_NODE ? node->getChildren()[0] : node};
+
+        while (limit == 0 || count < limit) {
+          triton::uint32 time = 0;
+          auto model = this->getModel(exprs.size() == 1 ? exprs[0] : ctxt->land(exprs), &st, timeout, &time);
+          totalTime += time;
+
+          if (st != triton::engines::solver::SAT)
+            break;
+
+          /* The model of the projection, a variable left free by the solver is 0 */
+          std::unordered_map<triton::usize, SolverModel> projected;
+          std::vector<triton::ast::SharedAbstractNode> diffs;
+          for (const auto& var : vars) {
+            auto it = model.find(var->getId());
+            triton::uint512 value = (it != model.end()) ? it->second.getValue() : 0;
+            projected[var->getId()] = SolverModel(var, value);
+            diffs.push_back(ctxt->distinct(ctxt->variable(var), ctxt->bv(value, var->getSize())));
+          }
+
+          count++;
+          if (callback(projected) == false || diffs.empty())
+            break;
+
+          exprs.push_back(diffs.size() == 1 ? diffs[0] : ctxt->lor(diffs));
+        }
+
+        if (status)
+          *status = st;
+
+        if (solvingTime)
+          *solvingTime = totalTime;
+
+        return count;
+      }
+
+
+      std::vector<triton::usize> SolverInterface::getUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 timeout) const {
+        std::vector<triton::usize> ret(nodes.size());
+        (void)timeout;
+
+        for (triton::usize index = 0; index < nodes.size(); index++)
+          ret[index] = index;
+
+        return ret;
+      }
+
+    };
+  };
+};
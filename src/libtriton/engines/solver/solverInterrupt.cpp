@@ -0,0 +1,51 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/solverInterrupt.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverInterrupt::SolverInterrupt() {
+        this->interrupted = false;
+      }
+
+
+      void SolverInterrupt::interrupt(void) {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        this->interrupted = true;
+        if (this->handler)
+          this->handler();
+      }
+
+
+      bool SolverInterrupt::isInterrupted(void) const {
+        return this->interrupted;
+      }
+
+
+      void SolverInterrupt::setHandler(const std::function<void(void)>& handler) {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        this->handler = handler;
+        if (this->interrupted && this->handler)
+          this->handler();
+      }
+
+
+      void SolverInterrupt::clearHandler(void) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->handler = nullptr;
+      }
+
+    };
+  };
+};
@@ -0,0 +1,106 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/solverInterface.hpp>
+#include <triton/solverSession.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverSession::SolverSession(const triton::engines::solver::SolverInterface* solver) {
+        if (solver == nullptr)
+          throw triton::exceptions::SolverEngine("SolverSession::SolverSession(): The solver must be defined.");
+        this->solver = solver;
+      }
+
+
+      SolverSession::~SolverSession() {
+      }
+
+
+      void SolverSession::push(const triton::ast::SharedAbstractNode& node) {
+      }
+
+
+      void SolverSession::pop(void) {
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> SolverSession::check(const triton::ast::SharedAbstractNode& node, bool model, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+        std::vector<triton::ast::SharedAbstractNode> exprs = this->constraints;
+        exprs.push_back(node);
+
+        auto predicate = exprs.size() == 1 ? node : node->getContext()->land(exprs);
+        if (model)
+          return this->solver->getModel(predicate, status, timeout, solvingTime);
+
+        this->solver->isSat(predicate, status, timeout, solvingTime);
+        return {};
+      }
+
+
+      void SolverSession::synchronize(const std::vector<triton::ast::SharedAbstractNode>& nodes) {
+        triton::usize common = 0;
+
+        /* Keep the common prefix */
+        while (common < nodes.size() && common < this->constraints.size() && nodes[common] == this->constraints[common])
+          common++;
+
+        while (this->constraints.size() > common) {
+          this->pop();
+          this->constraints.pop_back();
+        }
+
+        for (triton::usize index = common; index < nodes.size(); index++) {
+          if (nodes[index] == nullptr)
+            throw triton::exceptions::SolverEngine("SolverSession::synchronize(): node cannot be null.");
+          this->push(nodes[index]);
+          this->constraints.push_back(nodes[index]);
+        }
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> SolverSession::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverSession::getModel(): node cannot be null.");
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("SolverSession::getModel(): Must be a logical node.");
+
+        return this->check(node, true, status, timeout, solvingTime);
+      }
+
+
+      bool SolverSession::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverSession::isSat(): node cannot be null.");
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("SolverSession::isSat(): Must be a logical node.");
+
+        this->check(node, false, &st, timeout, solvingTime);
+        if (status)
+          *status = st;
+
+        return st == triton::engines::solver::SAT;
+      }
+
+
+      triton::usize SolverSession::getSize(void) const {
+        return this->constraints.size();
+      }
+
+    };
+  };
+};
@@ -0,0 +1,281 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <limits>
+#include <stack>
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/timeoutBudget.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* A query receives this many times its predicted solving time */
+      static constexpr triton::uint64 HEADROOM = 4;
+
+      /* The history is dropped beyond this number of queries */
+      static constexpr triton::usize MAX_QUERIES = 65536;
+
+
+      /* The power of two of a count, at most 63 */
+      static triton::uint64 log2(triton::usize value) {
+        triton::uint64 ret = 0;
+        while (value > 1 && ret < 63) {
+          value >>= 1;
+          ret++;
+        }
+        return ret;
+      }
+
+
+      /* The moving average of the solving times */
+      static triton::uint64 average(triton::uint64 previous, triton::uint64 sample) {
+        return (previous * 3 + sample) / 4;
+      }
+
+
+      TimeoutBudget::TimeoutBudget() {
+        this->bounded    = false;
+        this->enabled    = false;
+        this->maxTimeout = 10000;
+        this->minTimeout = 10;
+        this->remaining  = 0;
+        this->retries    = 0;
+      }
+
+
+      void TimeoutBudget::enable(bool flag) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->enabled = flag;
+      }
+
+
+      bool TimeoutBudget::isEnabled(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->enabled;
+      }
+
+
+      void TimeoutBudget::setBounds(triton::uint32 minTimeout, triton::uint32 maxTimeout) {
+        if (minTimeout == 0 || minTimeout > maxTimeout)
+          throw triton::exceptions::SolverEngine("TimeoutBudget::setBounds(): The bounds must be 0 < min <= max.");
+
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->minTimeout = minTimeout;
+        this->maxTimeout = maxTimeout;
+      }
+
+
+      void TimeoutBudget::startRound(triton::uint64 budget) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->bounded   = (budget != 0);
+        this->remaining = budget;
+      }
+
+
+      triton::uint64 TimeoutBudget::getRemaining(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->bounded ? this->remaining : 0;
+      }
+
+
+      void TimeoutBudget::setRetryCallback(const RetryCallback& callback, triton::uint32 retries) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->retryCallback = callback;
+        this->retries       = callback ? retries : 0;
+      }
+
+
+      QueryFeatures TimeoutBudget::getFeatures(const triton::ast::SharedAbstractNode& node) {
+        QueryFeatures features;
+
+        if (node == nullptr)
+          return features;
+
+        std::stack<triton::ast::AbstractNode*> nodes;
+        triton::ast::VisitedNodes visited(node->getContext());
+
+        nodes.push(node.get());
+        while (!nodes.empty()) {
+          triton::ast::AbstractNode* current = nodes.top();
+          nodes.pop();
+
+          if (!visited.insert(current))
+            continue;
+
+          features.nodes++;
+          switch (current->getType()) {
+            case triton::ast::VARIABLE_NODE:
+              features.variables++;
+              break;
+
+            case triton::ast::BVMUL_NODE:
+            case triton::ast::BVSDIV_NODE:
+            case triton::ast::BVSMOD_NODE:
+            case triton::ast::BVSREM_NODE:
+            case triton::ast::BVUDIV_NODE:
+            case triton::ast::BVUREM_NODE:
+              features.multiplications++;
+              break;
+
+            case triton::ast::ARRAY_NODE:
+            case triton::ast::SELECT_NODE:
+            case triton::ast::STORE_NODE:
+              features.arrays = true;
+              break;
+
+            default:
+              break;
+          }
+
+          if (current->getType() == triton::ast::REFERENCE_NODE) {
+            nodes.push(reinterpret_cast<triton::ast::ReferenceNode*>(current)->getSymbolicExpression()->getAst().get());
+          }
+          else {
+            for (const auto& child : current->getChildren())
+              nodes.push(child.get());
+          }
+        }
+
+        return features;
+      }
+
+
+      triton::uint64 TimeoutBudget::getClass(const QueryFeatures& features) {
+        return log2(features.nodes) | (log2(features.variables) << 6) | (log2(features.multiplications) << 12) | (static_cast<triton::uint64>(features.arrays) << 18);
+      }
+
+
+      triton::uint32 TimeoutBudget::predictLocked(const triton::ast::SharedAbstractNode& node, const QueryFeatures& features) const {
+        triton::uint64 time = 0;
+
+        auto query = this->queries.find(node->getHash());
+        auto cls   = this->classes.find(TimeoutBudget::getClass(features));
+
+        if (query != this->queries.end())
+          time = query->second.time;
+        else if (cls != this->classes.end())
+          time = cls->second.time;
+        else
+          /* Bit-blasting grows with the nodes, a lot with the multipliers and the array theory */
+          time = 1 + features.nodes / 256 + features.variables / 16 + features.multiplications * 2 + (features.arrays ? 20 : 0);
+
+        return static_cast<triton::uint32>(std::min<triton::uint64>(std::max<triton::uint64>(time, 1), std::numeric_limits<triton::uint32>::max()));
+      }
+
+
+      triton::uint32 TimeoutBudget::predict(const triton::ast::SharedAbstractNode& node) const {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("TimeoutBudget::predict(): node cannot be null.");
+
+        QueryFeatures features = TimeoutBudget::getFeatures(node);
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->predictLocked(node, features);
+      }
+
+
+      triton::uint32 TimeoutBudget::allocate(const triton::ast::SharedAbstractNode& node, const QueryFeatures& features) {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        if (this->bounded && this->remaining == 0)
+          return 0;
+
+        triton::uint64 timeout = 0;
+        auto query = this->queries.find(node->getHash());
+
+        /* Already timed out with the largest timeout */
+        if (query != this->queries.end() && query->second.timeout >= this->maxTimeout)
+          timeout = this->minTimeout;
+        else
+          timeout = std::min<triton::uint64>(std::max<triton::uint64>(HEADROOM * this->predictLocked(node, features), this->minTimeout), this->maxTimeout);
+
+        if (this->bounded) {
+          timeout = std::min<triton::uint64>(timeout, this->remaining);
+          this->remaining -= timeout;
+        }
+
+        return static_cast<triton::uint32>(timeout);
+      }
+
+
+      void TimeoutBudget::record(const triton::ast::SharedAbstractNode& node, const QueryFeatures& features, triton::uint32 timeout, triton::engines::solver::status_e status, triton::uint32 solvingTime) {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        bool expired = (status == triton::engines::solver::TIMEOUT);
+        triton::uint32 spent = expired ? timeout : std::min(solvingTime, timeout);
+
+        /* The unused part goes back to the round */
+        if (this->bounded)
+          this->remaining += timeout - spent;
+
+        if (status != triton::engines::solver::SAT && status != triton::engines::solver::UNSAT && !expired)
+          return;
+
+        /* An expired query lasts at least twice its timeout */
+        triton::uint64 sample = expired ? static_cast<triton::uint64>(timeout) * 2 : solvingTime;
+
+        if (this->queries.size() >= MAX_QUERIES)
+          this->queries.clear();
+
+        auto query = this->queries.find(node->getHash());
+        if (query == this->queries.end()) {
+          this->queries[node->getHash()] = History{sample, expired ? timeout : 0};
+        }
+        else {
+          query->second.time    = expired ? std::max(query->second.time, sample) : average(query->second.time, sample);
+          query->second.timeout = expired ? std::max(query->second.timeout, timeout) : 0;
+        }
+
+        auto cls = this->classes.find(TimeoutBudget::getClass(features));
+        if (cls == this->classes.end())
+          this->classes[TimeoutBudget::getClass(features)] = History{sample, 0};
+        else
+          cls->second.time = average(cls->second.time, sample);
+      }
+
+
+      triton::uint32 TimeoutBudget::retry(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout, triton::uint32 attempt) {
+        RetryCallback callback;
+
+        {
+          std::lock_guard<std::mutex> guard(this->lock);
+          if (!this->retryCallback || attempt >= this->retries || (this->bounded && this->remaining == 0))
+            return 0;
+          callback = this->retryCallback;
+        }
+
+        /* The callback may query the context, the lock is not held */
+        if (callback(node, timeout) == false)
+          return 0;
+
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        triton::uint64 next = std::min<triton::uint64>(static_cast<triton::uint64>(timeout) * 2, std::numeric_limits<triton::uint32>::max());
+        if (this->bounded) {
+          next = std::min<triton::uint64>(next, this->remaining);
+          this->remaining -= next;
+        }
+
+        return static_cast<triton::uint32>(next);
+      }
+
+
+      void TimeoutBudget::clear(void) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->queries.clear();
+        this->classes.clear();
+      }
+
+    }; /* solver namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
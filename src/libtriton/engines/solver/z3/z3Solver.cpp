@@ -5,7 +5,9 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
 #include <chrono>
+#include <memory>
 #include <string>
 
 #include <triton/astContext.hpp>
@@ -33,16 +35,46 @@ namespace triton {
       }
 
 
-      Z3Solver::Z3Solver() {
+      triton::uint512 Z3Solver::getNumeralValue(const z3::expr& expr) {
+        /* Not a bit-vector numeral, e.g. the memory array */
+        if (!expr.is_bv() || !expr.is_numeral())
+          return triton::uint512{Z3_get_numeral_string(expr.ctx(), expr)};
+
+        triton::uint32 size = expr.get_sort().bv_size();
+        if (size <= 64)
+          return expr.get_numeral_uint64();
+
+        /* Wider values are read 64 bits at a time */
+        triton::uint512 value = 0;
+        for (triton::uint32 low = 0; low < size; low += 64) {
+          z3::expr word = expr.extract(std::min<triton::uint32>(low + 64, size) - 1, low).simplify();
+          value |= triton::uint512(word.get_numeral_uint64()) << low;
+        }
+
+        return value;
+      }
+
+
+      Z3Solver::Z3Solver()
+        : translator(false) {
         this->timeout = 0;
         this->memoryLimit = 0;
       }
 
 
       std::vector<std::unordered_map<triton::usize, SolverModel>> Z3Solver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        return this->getModels(node, limit, status, timeout, solvingTime, nullptr);
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> Z3Solver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime, triton::engines::solver::SolverInterrupt* interrupt) const {
         std::vector<std::unordered_map<triton::usize, SolverModel>> ret;
         triton::ast::SharedAbstractNode onode = node;
-        triton::ast::TritonToZ3 z3Ast{false};
+
+        /* The kept converter is used by one query at a time */
+        std::unique_lock<std::mutex> guard(this->translatorLock, std::try_to_lock);
+        std::unique_ptr<triton::ast::TritonToZ3> local(guard.owns_lock() ? nullptr : new triton::ast::TritonToZ3(false));
+        triton::ast::TritonToZ3& z3Ast = guard.owns_lock() ? this->translator : *local;
 
         try {
           if (onode == nullptr)
@@ -55,9 +87,9 @@ namespace triton {
           if (onode->isLogical() == false)
             throw triton::exceptions::SolverEngine("Z3Solver::getModels(): Must be a logical node.");
 
-          z3::expr      expr = z3Ast.convert(onode);
-          z3::context&  ctx  = expr.ctx();
-          z3::solver    solver(ctx);
+          z3::expr      expr   = z3Ast.convert(onode);
+          z3::context&  ctx    = expr.ctx();
+          z3::solver    solver = this->newSolver(ctx, onode);
 
           /* Create a solver and add the expression */
           solver.add(expr);
@@ -79,11 +111,15 @@ namespace triton {
 
           solver.set(p);
 
+          /* The context may be interrupted from another thread while searching */
+          if (interrupt != nullptr)
+            interrupt->setHandler([&ctx]() { ctx.interrupt(); });
+
           /* Get time of solving start */
           auto start = std::chrono::system_clock::now();
 
           /* Get first model */
-          z3::check_result res = solver.check();
+          z3::check_result res = (interrupt != nullptr && interrupt->isInterrupted()) ? z3::unknown : solver.check();
 
           /* Write back the status code of the first constraint */
           this->writeBackStatus(solver, res, status);
@@ -107,14 +143,8 @@ namespace triton {
               /* Get z3 expr */
               z3::expr exp = m.get_const_interp(z3Variable);
 
-              /* Get the size of a z3 expr */
-              triton::uint32 bvSize = exp.get_sort().bv_size();
-
               /* Get the value of a z3 expr */
-              std::string svalue = Z3_get_numeral_string(ctx, exp);
-
-              /* Convert a string value to a integer value */
-              triton::uint512 value = triton::uint512(svalue.c_str());
+              triton::uint512 value = Z3Solver::getNumeralValue(exp);
 
               /* Create a triton model */
               SolverModel trionModel = SolverModel(z3Ast.variables[varName], value);
@@ -122,9 +152,9 @@ namespace triton {
               /* Map the result */
               smodel[trionModel.getId()] = trionModel;
 
-              /* Uniq result */
+              /* Uniq result, the value is already a numeral of the variable */
               if (exp.get_sort().is_bv())
-                args.push_back(ctx.bv_const(varName.c_str(), bvSize) != ctx.bv_val(svalue.c_str(), bvSize));
+                args.push_back(z3Variable() != exp);
             }
 
             /* Check that model is available */
@@ -141,10 +171,13 @@ namespace triton {
               }
 
               /* Get next model */
-              res = solver.check();
+              res = (interrupt != nullptr && interrupt->isInterrupted()) ? z3::unknown : solver.check();
             }
           }
 
+          if (interrupt != nullptr)
+            interrupt->clearHandler();
+
           /* Get time of solving end */
           auto end = std::chrono::system_clock::now();
 
@@ -152,6 +185,9 @@ namespace triton {
             *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
         }
         catch (const z3::exception& e) {
+          if (interrupt != nullptr)
+            interrupt->clearHandler();
+
           if (!strcmp(e.msg(), "max. memory exceeded")) {
             if (status) {
               *status = triton::engines::solver::OUTOFMEM;
@@ -165,19 +201,127 @@ namespace triton {
       }
 
 
-      bool Z3Solver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
-        triton::ast::TritonToZ3 z3Ast{false};
+      triton::usize Z3Solver::enumerateModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, const ModelCallback& callback, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::ast::SharedAbstractNode onode = node;
+        triton::usize count = 0;
+
+        if (callback == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Solver::enumerateModels(): The callback must be defined.");
+
+        /* The kept converter is used by one query at a time */
+        std::unique_lock<std::mutex> guard(this->translatorLock, std::try_to_lock);
+        std::unique_ptr<triton::ast::TritonToZ3> local(guard.owns_lock() ? nullptr : new triton::ast::TritonToZ3(false));
+        triton::ast::TritonToZ3& z3Ast = guard.owns_lock() ? this->translator : *local;
+
+        try {
+          if (onode == nullptr)
+            throw triton::exceptions::SolverEngine("Z3Solver::enumerateModels(): node cannot be null.");
+
+          /* Z3 does not need an assert() as root node */
+          if (node->getType() == triton::ast::ASSERT_NODE)
+            onode = node->getChildren()[0];
+
+          if (onode->isLogical() == false)
+            throw triton::exceptions::SolverEngine("Z3Solver::enumerateModels(): Must be a logical node.");
+
+          auto vars = SolverInterface::getProjection(onode, projection);
+
+          z3::expr      expr   = z3Ast.convert(onode);
+          z3::context&  ctx    = expr.ctx();
+          z3::solver    solver = z3::solver(ctx);
+
+          /*
+           * The generic solver is kept incremental while the models are blocked, so that
+           * each check reuses what the previous ones learnt, whatever the class of the query.
+           */
+          solver.add(expr);
+
+          /* The terms of the projection */
+          z3::expr_vector terms(ctx);
+          for (const auto& var : vars)
+            terms.push_back(z3Ast.convert(onode->getContext()->variable(var)));
+
+          z3::params p(ctx);
+
+          /* Define the timeout of each check */
+          if (timeout) {
+            p.set(":timeout", timeout);
+          }
+          else if (this->timeout) {
+            p.set(":timeout", this->timeout);
+          }
+
+          /* Define memory limit */
+          if (this->memoryLimit) {
+            p.set(":max_memory", this->memoryLimit);
+          }
+
+          solver.set(p);
 
+          /* Get time of solving start */
+          auto start = std::chrono::system_clock::now();
+
+          z3::check_result res = solver.check();
+          this->writeBackStatus(solver, res, status);
+
+          while (res == z3::sat) {
+            z3::model m = solver.get_model();
+
+            /* The model of the projection, completed for the variables left free by the solver */
+            std::unordered_map<triton::usize, SolverModel> smodel;
+            z3::expr_vector args(ctx);
+            for (triton::uint32 i = 0; i < terms.size(); i++) {
+              z3::expr exp = m.eval(terms[i], true);
+              smodel[vars[i]->getId()] = SolverModel(vars[i], Z3Solver::getNumeralValue(exp));
+              args.push_back(terms[i] != exp);
+            }
+
+            count++;
+            if (callback(smodel) == false || args.empty() || count == limit)
+              break;
+
+            /* Block the projection of this model only */
+            solver.add(this->mk_or(args));
+            res = solver.check();
+            this->writeBackStatus(solver, res, status);
+          }
+
+          /* Get time of solving end */
+          auto end = std::chrono::system_clock::now();
+
+          if (solvingTime)
+            *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+        }
+        catch (const z3::exception& e) {
+          if (!strcmp(e.msg(), "max. memory exceeded")) {
+            if (status) {
+              *status = triton::engines::solver::OUTOFMEM;
+            }
+            return count;
+          }
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::enumerateModels(): ") + e.msg());
+        }
+
+        return count;
+      }
+
+
+      bool Z3Solver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
         if (node == nullptr)
           throw triton::exceptions::SolverEngine("Z3Solver::isSat(): node cannot be null.");
 
         if (node->isLogical() == false)
           throw triton::exceptions::SolverEngine("Z3Solver::isSat(): Must be a logical node.");
 
+        /* The kept converter is used by one query at a time */
+        std::unique_lock<std::mutex> guard(this->translatorLock, std::try_to_lock);
+        std::unique_ptr<triton::ast::TritonToZ3> local(guard.owns_lock() ? nullptr : new triton::ast::TritonToZ3(false));
+        triton::ast::TritonToZ3& z3Ast = guard.owns_lock() ? this->translator : *local;
+
         try {
-          z3::expr      expr = z3Ast.convert(node);
-          z3::context&  ctx  = expr.ctx();
-          z3::solver    solver(ctx);
+          z3::expr      expr   = z3Ast.convert(node);
+          z3::context&  ctx    = expr.ctx();
+          z3::solver    solver = this->newSolver(ctx, node);
 
           /* Create a solver and add the expression */
           solver.add(expr);
@@ -225,6 +369,76 @@ namespace triton {
       }
 
 
+      std::vector<triton::usize> Z3Solver::getUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 timeout) const {
+        std::vector<triton::usize> ret;
+
+        for (const auto& node : nodes) {
+          if (node == nullptr)
+            throw triton::exceptions::SolverEngine("Z3Solver::getUnsatCore(): node cannot be null.");
+          if (node->isLogical() == false)
+            throw triton::exceptions::SolverEngine("Z3Solver::getUnsatCore(): Must be a logical node.");
+        }
+
+        if (nodes.empty())
+          return ret;
+
+        /* The kept converter is used by one query at a time */
+        std::unique_lock<std::mutex> guard(this->translatorLock, std::try_to_lock);
+        std::unique_ptr<triton::ast::TritonToZ3> local(guard.owns_lock() ? nullptr : new triton::ast::TritonToZ3(false));
+        triton::ast::TritonToZ3& z3Ast = guard.owns_lock() ? this->translator : *local;
+
+        try {
+          z3::context& ctx = z3Ast.getContext();
+          z3::solver solver(ctx);
+          z3::expr_vector assumptions(ctx);
+          std::unordered_map<unsigned, triton::usize> positions;
+
+          /* Each constraint is tracked by an assumption implying it */
+          for (triton::usize index = 0; index < nodes.size(); index++) {
+            z3::expr literal = ctx.bool_const(("__core_" + std::to_string(index)).c_str());
+            solver.add(z3::implies(literal, z3Ast.convert(nodes[index])));
+            assumptions.push_back(literal);
+            positions.emplace(literal.id(), index);
+          }
+
+          z3::params p(ctx);
+
+          /* Define the timeout */
+          if (timeout) {
+            p.set(":timeout", timeout);
+          }
+          else if (this->timeout) {
+            p.set(":timeout", this->timeout);
+          }
+
+          /* Define memory limit */
+          if (this->memoryLimit) {
+            p.set(":max_memory", this->memoryLimit);
+          }
+
+          solver.set(p);
+
+          if (solver.check(assumptions) != z3::unsat)
+            return ret;
+
+          z3::expr_vector core = solver.unsat_core();
+          for (unsigned i = 0; i < core.size(); i++) {
+            auto it = positions.find(core[i].id());
+            if (it != positions.end())
+              ret.push_back(it->second);
+          }
+
+          std::sort(ret.begin(), ret.end());
+          return ret;
+        }
+        catch (const z3::exception& e) {
+          if (!strcmp(e.msg(), "max. memory exceeded"))
+            return {};
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::getUnsatCore(): ") + e.msg());
+        }
+      }
+
+
       std::unordered_map<triton::usize, SolverModel> Z3Solver::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32 *solvingTime) const {
         std::unordered_map<triton::usize, SolverModel> ret;
         std::vector<std::unordered_map<triton::usize, SolverModel>> allModels;
@@ -243,7 +457,7 @@ namespace triton {
 
         try {
           triton::ast::TritonToZ3 z3Ast{false};
-          triton::ast::Z3ToTriton tritonAst{node->getContext()};
+          triton::ast::Z3ToTriton tritonAst{node->getContext(), &z3Ast};
 
           /* From Triton to Z3 */
           z3::expr expr = z3Ast.convert(node);
@@ -276,7 +490,7 @@ namespace triton {
           if (expr.get_sort().is_bool())
             res = Z3_get_bool_value(expr.ctx(), expr) == Z3_L_TRUE ? true : false;
           else
-            res = triton::uint512{Z3_get_numeral_string(expr.ctx(), expr)};
+            res = Z3Solver::getNumeralValue(expr);
 
           return res;
         }
@@ -286,6 +500,38 @@ namespace triton {
       }
 
 
+      z3::solver Z3Solver::newSolver(z3::context& ctx, const triton::ast::SharedAbstractNode& node) const {
+        const SolverConfiguration& config = this->queries.selectConfiguration(node);
+
+        /* The tactics are applied in sequence, the last one decides the query */
+        if (!config.tactics.empty()) {
+          std::unique_ptr<z3::tactic> tactic;
+          std::string::size_type start = 0;
+
+          while (start <= config.tactics.size()) {
+            std::string::size_type end = config.tactics.find(';', start);
+            if (end == std::string::npos)
+              end = config.tactics.size();
+
+            std::string name = config.tactics.substr(start, end - start);
+            if (name.empty())
+              throw triton::exceptions::SolverEngine("Z3Solver::newSolver(): Empty tactic in \"" + config.tactics + "\".");
+
+            z3::tactic next(ctx, name.c_str());
+            tactic.reset(tactic ? new z3::tactic(*tactic & next) : new z3::tactic(next));
+            start = end + 1;
+          }
+
+          return tactic->mk_solver();
+        }
+
+        if (!config.logic.empty())
+          return z3::solver(ctx, config.logic.c_str());
+
+        return z3::solver(ctx);
+      }
+
+
       void Z3Solver::writeBackStatus(z3::solver& solver, z3::check_result res, triton::engines::solver::status_e* status) const {
         if (status != nullptr) {
           switch (res) {
@@ -327,6 +573,116 @@ namespace triton {
         this->memoryLimit = limit;
       }
 
+
+      void Z3Solver::setQueryConfigurations(const triton::engines::solver::QueryConfigurations& configurations) {
+        this->queries = configurations;
+      }
+
+
+      SolverSession* Z3Solver::newSession(void) const {
+        return new Z3Session(this);
+      }
+
+
+      Z3Session::Z3Session(const Z3Solver* parent)
+        : SolverSession(parent), parent(parent), z3Ast(false), solver(z3Ast.getContext()) {
+      }
+
+
+      void Z3Session::push(const triton::ast::SharedAbstractNode& node) {
+        try {
+          z3::expr expr = this->z3Ast.convert(node);
+          this->solver.push();
+          this->solver.add(expr);
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine(std::string("Z3Session::push(): ") + e.msg());
+        }
+      }
+
+
+      void Z3Session::pop(void) {
+        this->solver.pop();
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> Z3Session::check(const triton::ast::SharedAbstractNode& node, bool model, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+        std::unordered_map<triton::usize, SolverModel> ret;
+        z3::context& ctx = this->z3Ast.getContext();
+        bool pushed = false;
+
+        try {
+          z3::expr expr = this->z3Ast.convert(node);
+          z3::params p(ctx);
+
+          /* Define the timeout, unlimited by default as the solver is kept between the queries */
+          if (timeout) {
+            p.set(":timeout", timeout);
+          }
+          else if (this->parent->timeout) {
+            p.set(":timeout", this->parent->timeout);
+          }
+          else {
+            p.set(":timeout", static_cast<triton::uint32>(-1));
+          }
+
+          /* Define memory limit */
+          if (this->parent->memoryLimit) {
+            p.set(":max_memory", this->parent->memoryLimit);
+          }
+
+          this->solver.set(p);
+
+          /* The query is only checked in its own scope */
+          this->solver.push();
+          pushed = true;
+          this->solver.add(expr);
+
+          /* Get time of solving start */
+          auto start = std::chrono::system_clock::now();
+
+          z3::check_result res = this->solver.check();
+
+          /* Get time of solving end */
+          auto end = std::chrono::system_clock::now();
+
+          if (solvingTime)
+            *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+          this->parent->writeBackStatus(this->solver, res, status);
+
+          if (model && res == z3::sat) {
+            z3::model m = this->solver.get_model();
+
+            /* Traversing the model */
+            for (triton::uint32 i = 0; i < m.size(); i++) {
+              z3::func_decl z3Variable = m[i];
+              std::string varName = z3Variable.name().str();
+              z3::expr exp = m.get_const_interp(z3Variable);
+              triton::uint512 value = Z3Solver::getNumeralValue(exp);
+              SolverModel trionModel = SolverModel(this->z3Ast.variables[varName], value);
+              ret[trionModel.getId()] = trionModel;
+            }
+          }
+
+          this->solver.pop();
+        }
+        catch (const z3::exception& e) {
+          if (pushed)
+            this->solver.pop();
+
+          if (!strcmp(e.msg(), "max. memory exceeded")) {
+            if (status) {
+              *status = triton::engines::solver::OUTOFMEM;
+            }
+            return {};
+          }
+          throw triton::exceptions::SolverEngine(std::string("Z3Session::check(): ") + e.msg());
+        }
+
+        return ret;
+      }
+
     };
   };
 };
@@ -0,0 +1,206 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+
+#include <triton/concretizationPolicy.hpp>
+#include <triton/context.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      ConcretizationPolicy::ConcretizationPolicy() {
+      }
+
+
+      void ConcretizationPolicy::addRule(triton::engines::symbolic::concretization_e rule, triton::usize threshold) {
+        switch (rule) {
+          case CONCRETIZATION_HOT_ADDRESSES:
+          case CONCRETIZATION_LARGE_EXPRESSIONS:
+          case CONCRETIZATION_OUTSIDE_REGIONS:
+            break;
+          default:
+            throw triton::exceptions::SymbolicEngine("ConcretizationPolicy::addRule(): Invalid rule, the hook is set with setHook().");
+        }
+
+        if (rule == CONCRETIZATION_LARGE_EXPRESSIONS && threshold == 0)
+          throw triton::exceptions::SymbolicEngine("ConcretizationPolicy::addRule(): The number of nodes must not be null.");
+
+        this->rules[rule] = threshold;
+      }
+
+
+      void ConcretizationPolicy::removeRule(triton::engines::symbolic::concretization_e rule) {
+        this->rules.erase(rule);
+        if (rule == CONCRETIZATION_HOOK)
+          this->hook = nullptr;
+        if (rule == CONCRETIZATION_HOT_ADDRESSES)
+          this->hits.clear();
+      }
+
+
+      bool ConcretizationPolicy::isRuleEnabled(triton::engines::symbolic::concretization_e rule) const {
+        return this->rules.find(rule) != this->rules.end();
+      }
+
+
+      bool ConcretizationPolicy::isEnabled(void) const {
+        return !this->rules.empty();
+      }
+
+
+      void ConcretizationPolicy::addSymbolicRegion(triton::uint64 baseAddr, triton::usize size) {
+        if (size == 0)
+          return;
+
+        /* The regions are merged, so that a cell belongs to the last region starting before it */
+        triton::uint64 lo = baseAddr;
+        triton::uint64 hi = baseAddr + size;
+
+        auto it = this->regions.upper_bound(lo);
+        if (it != this->regions.begin() && std::prev(it)->first + std::prev(it)->second >= lo)
+          it = std::prev(it);
+
+        while (it != this->regions.end() && it->first <= hi) {
+          lo = std::min(lo, it->first);
+          hi = std::max(hi, it->first + it->second);
+          it = this->regions.erase(it);
+        }
+
+        this->regions[lo] = hi - lo;
+      }
+
+
+      void ConcretizationPolicy::setHook(const ConcretizationHook& hook) {
+        this->hook = hook;
+        if (hook)
+          this->rules[CONCRETIZATION_HOOK] = 0;
+        else
+          this->rules.erase(CONCRETIZATION_HOOK);
+      }
+
+
+      void ConcretizationPolicy::clear(void) {
+        this->rules.clear();
+        this->regions.clear();
+        this->hits.clear();
+        this->events.clear();
+        this->hook = nullptr;
+      }
+
+
+      bool ConcretizationPolicy::isInRegion(triton::uint64 addr) const {
+        auto it = this->regions.upper_bound(addr);
+        if (it == this->regions.begin())
+          return false;
+        it = std::prev(it);
+        return addr - it->first < it->second;
+      }
+
+
+      void ConcretizationPolicy::concretize(triton::Context& ctx, const triton::arch::Instruction& inst, triton::engines::symbolic::concretization_e rule, const triton::arch::Register& reg) {
+        if (ctx.getSymbolicRegister(reg) == nullptr)
+          return;
+
+        ctx.concretizeRegister(reg);
+        this->events.push_back({inst.getAddress(), rule, reg.getId(), 0, 0});
+      }
+
+
+      void ConcretizationPolicy::concretize(triton::Context& ctx, const triton::arch::Instruction& inst, triton::engines::symbolic::concretization_e rule, triton::uint64 addr, triton::uint32 size, bool regions) {
+        triton::uint32 run = 0;
+
+        for (triton::uint32 i = 0; i <= size; i++) {
+          bool concretized = false;
+
+          if (i < size && ctx.getSymbolicMemory(addr + i) != nullptr && (regions == false || this->isInRegion(addr + i) == false)) {
+            ctx.concretizeMemory(addr + i);
+            concretized = true;
+            run++;
+          }
+
+          /* One event per contiguous run of cells */
+          if (!concretized && run) {
+            this->events.push_back({inst.getAddress(), rule, triton::arch::ID_REG_INVALID, addr + i - run, run});
+            run = 0;
+          }
+        }
+      }
+
+
+      void ConcretizationPolicy::concretizeWrites(triton::Context& ctx, triton::arch::Instruction& inst, triton::engines::symbolic::concretization_e rule) {
+        const triton::arch::Register& pc = ctx.getCpuInstance()->getProgramCounter();
+        std::set<triton::arch::register_e> done;
+
+        for (const auto& reg : inst.getWrittenRegisters()) {
+          const triton::arch::Register& parent = ctx.getParentRegister(reg.first);
+          if (parent.getId() != pc.getId() && done.insert(parent.getId()).second)
+            this->concretize(ctx, inst, rule, parent);
+        }
+
+        for (const auto& store : inst.getStoreAccess())
+          this->concretize(ctx, inst, rule, store.first.getAddress(), store.first.getSize(), false);
+      }
+
+
+      void ConcretizationPolicy::apply(triton::Context& ctx, triton::arch::Instruction& inst) {
+        if (this->rules.empty())
+          return;
+
+        if (this->hook && this->hook(ctx, inst)) {
+          this->concretizeWrites(ctx, inst, CONCRETIZATION_HOOK);
+          return;
+        }
+
+        auto hot = this->rules.find(CONCRETIZATION_HOT_ADDRESSES);
+        if (hot != this->rules.end() && ++this->hits[inst.getAddress()] > hot->second) {
+          this->concretizeWrites(ctx, inst, CONCRETIZATION_HOT_ADDRESSES);
+          return;
+        }
+
+        auto large = this->rules.find(CONCRETIZATION_LARGE_EXPRESSIONS);
+        if (large != this->rules.end()) {
+          const triton::arch::Register& pc = ctx.getCpuInstance()->getProgramCounter();
+          std::set<triton::arch::register_e> done;
+
+          for (const auto& reg : inst.getWrittenRegisters()) {
+            const triton::arch::Register& parent = ctx.getParentRegister(reg.first);
+            if (parent.getId() == pc.getId() || !done.insert(parent.getId()).second)
+              continue;
+
+            /* Nodes are only counted up to the threshold */
+            const auto& expr = ctx.getSymbolicRegister(parent);
+            if (expr && triton::ast::countNodes(expr->getAst(), large->second) > large->second)
+              this->concretize(ctx, inst, CONCRETIZATION_LARGE_EXPRESSIONS, parent);
+          }
+        }
+
+        if (this->isRuleEnabled(CONCRETIZATION_OUTSIDE_REGIONS)) {
+          for (const auto& store : inst.getStoreAccess())
+            this->concretize(ctx, inst, CONCRETIZATION_OUTSIDE_REGIONS, store.first.getAddress(), store.first.getSize(), true);
+        }
+      }
+
+
+      const std::vector<ConcretizationEvent>& ConcretizationPolicy::getEvents(void) const {
+        return this->events;
+      }
+
+
+      void ConcretizationPolicy::clearEvents(void) {
+        this->events.clear();
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,410 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <unordered_map>
+
+#include <triton/astContext.hpp>
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/passManager.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      /* The number of inputs on which a condition is evaluated before a query of PASS_OPAQUE_PREDICATES */
+      static const triton::usize opaqueSamples = 4096;
+
+
+      /* Returns the node written to the program counter by an instruction, null if none */
+      static triton::ast::SharedAbstractNode getProgramCounterAst(triton::arch::Instruction& inst, const triton::arch::Register& pc) {
+        for (const auto& reg : inst.getWrittenRegisters()) {
+          if (reg.first.getId() == pc.getId())
+            return reg.second;
+        }
+        return nullptr;
+      }
+
+
+      /* Replaces the node written to the program counter by an instruction */
+      static void setProgramCounterAst(triton::arch::Instruction& inst, const triton::arch::Register& pc, const triton::ast::SharedAbstractNode& node) {
+        auto& written = inst.getWrittenRegisters();
+        for (auto it = written.begin(); it != written.end(); it++) {
+          if (it->first.getId() == pc.getId()) {
+            triton::arch::Register reg = it->first;
+            written.erase(it);
+            written.insert({reg, node});
+            return;
+          }
+        }
+      }
+
+
+      /* Returns true if the node written to the program counter is a branch between two constant targets */
+      static bool isConditionalBranch(const triton::ast::SharedAbstractNode& node) {
+        return node && node->getType() == triton::ast::ITE_NODE &&
+               node->getChildren()[1]->getType() == triton::ast::BV_NODE &&
+               node->getChildren()[2]->getType() == triton::ast::BV_NODE;
+      }
+
+
+      /* Returns the node behind its references */
+      static triton::ast::SharedAbstractNode getReferencedAst(triton::ast::SharedAbstractNode node) {
+        while (node->getType() == triton::ast::REFERENCE_NODE)
+          node = reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst();
+        return node;
+      }
+
+
+      /*
+       * Returns the blocks reachable from the first one. `ends` are the addresses following the
+       * last instruction of each block as lifted, the block falling through to it unless it still
+       * ends with this instruction and the instruction is a branch.
+       */
+      static std::vector<bool> getReachableBlocks(std::vector<triton::arch::BasicBlock>& region, const std::vector<triton::uint64>& ends, const triton::arch::Register& pc) {
+        std::unordered_map<triton::uint64, triton::usize> starts;
+        std::vector<bool> reachable(region.size(), false);
+        std::vector<triton::usize> worklist;
+
+        for (triton::usize b = 0; b < region.size(); b++) {
+          if (region[b].getSize())
+            starts.emplace(region[b].getFirstAddress(), b);
+        }
+
+        if (region.empty())
+          return reachable;
+
+        reachable[0] = true;
+        worklist.push_back(0);
+        while (!worklist.empty()) {
+          triton::usize b = worklist.back();
+          worklist.pop_back();
+
+          std::vector<triton::uint64> targets;
+          auto& instructions = region[b].getInstructions();
+          if (!instructions.empty() && instructions.back().getNextAddress() == ends[b] && instructions.back().isControlFlow()) {
+            triton::ast::SharedAbstractNode node = getProgramCounterAst(instructions.back(), pc);
+            if (node && node->getType() == triton::ast::BV_NODE) {
+              targets.push_back(static_cast<triton::uint64>(node->evaluate()));
+            }
+            else if (isConditionalBranch(node)) {
+              targets.push_back(static_cast<triton::uint64>(node->getChildren()[1]->evaluate()));
+              targets.push_back(static_cast<triton::uint64>(node->getChildren()[2]->evaluate()));
+            }
+          }
+          else {
+            targets.push_back(ends[b]);
+          }
+
+          for (triton::uint64 target : targets) {
+            auto it = starts.find(target);
+            if (it != starts.end() && !reachable[it->second]) {
+              reachable[it->second] = true;
+              worklist.push_back(it->second);
+            }
+          }
+        }
+
+        return reachable;
+      }
+
+
+      PassManager::PassManager(triton::Context& ctx)
+        : ctx(ctx),
+          stats(),
+          timeout(0),
+          symbolizing(false),
+          loadCallback([this](triton::Context& lifter, const triton::arch::MemoryAccess& mem) { this->symbolizeLoad(lifter, mem); }, this) {
+      }
+
+
+      void PassManager::addPass(triton::engines::symbolic::pass_e pass) {
+        switch (pass) {
+          case PASS_DEAD_STORES:
+          case PASS_OPAQUE_PREDICATES:
+          case PASS_REDUNDANT_WRITES:
+            this->passes.push_back(pass);
+            break;
+          default:
+            throw triton::exceptions::SymbolicEngine("PassManager::addPass(): Invalid pass.");
+        }
+      }
+
+
+      void PassManager::clearPasses(void) {
+        this->passes.clear();
+      }
+
+
+      const std::vector<triton::engines::symbolic::pass_e>& PassManager::getPasses(void) const {
+        return this->passes;
+      }
+
+
+      void PassManager::setTimeout(triton::uint32 ms) {
+        this->timeout = ms;
+      }
+
+
+      const PassStatistics& PassManager::getStatistics(void) const {
+        return this->stats;
+      }
+
+
+      void PassManager::symbolizeLoad(triton::Context& lifter, const triton::arch::MemoryAccess& mem) {
+        /* Symbolizing a cell reads its concrete value again */
+        if (this->symbolizing)
+          return;
+
+        this->symbolizing = true;
+        try {
+          for (triton::uint32 i = 0; i < mem.getSize(); i++) {
+            triton::uint64 addr = mem.getAddress() + i;
+            if (lifter.getSymbolicMemory(addr) == nullptr)
+              lifter.symbolizeMemory(triton::arch::MemoryAccess(addr, triton::size::byte));
+          }
+        }
+        catch (...) {
+          this->symbolizing = false;
+          throw;
+        }
+        this->symbolizing = false;
+      }
+
+
+      void PassManager::lift(std::vector<triton::arch::BasicBlock>& region) {
+        this->lifter = std::make_unique<triton::Context>(this->ctx.getArchitecture());
+        this->lifter->setConcreteState(this->ctx);
+
+        /* The passes must hold for any input of the region */
+        const triton::arch::Register& pc = this->lifter->getCpuInstance()->getProgramCounter();
+        for (const auto* reg : this->lifter->getParentRegisters()) {
+          if (reg->isMutable() && reg->getId() != pc.getId())
+            this->lifter->symbolizeRegister(*reg);
+        }
+
+        this->lifter->addCallback(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, this->loadCallback);
+        for (auto& block : region) {
+          if (block.getSize())
+            this->lifter->processing(block, block.getFirstAddress());
+        }
+        this->lifter->removeCallback(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, this->loadCallback);
+      }
+
+
+      void PassManager::removeOpaquePredicates(std::vector<triton::arch::BasicBlock>& region, std::set<triton::uint64>& removed) {
+        const triton::arch::Register& pc = this->lifter->getCpuInstance()->getProgramCounter();
+        triton::ast::SharedAstContext astCtxt = this->lifter->getAstContext();
+
+        for (auto& block : region) {
+          if (block.getSize() == 0)
+            continue;
+
+          auto& inst = block.getInstructions().back();
+          if (!inst.isControlFlow() || removed.count(inst.getAddress()))
+            continue;
+
+          triton::ast::SharedAbstractNode node = getProgramCounterAst(inst, pc);
+          if (!isConditionalBranch(node))
+            continue;
+
+          /* The condition is sampled first, the solver only proves the conditions which do not vary */
+          triton::ast::SharedAbstractNode cond = this->lifter->simplify(node->getChildren()[0]);
+          triton::uint512 value = 0;
+          if (!astCtxt->sampleConstant(cond, opaqueSamples, &value)) {
+            this->stats.sampledPredicates++;
+            continue;
+          }
+          if (!this->lifter->isOpaquePredicate(cond, &value, 0, this->timeout))
+            continue;
+
+          if (value != 0) {
+            /* The branch must still read its condition */
+            setProgramCounterAst(inst, pc, node->getChildren()[1]);
+            this->stats.opaquePredicates++;
+          }
+          else {
+            /* The branch is removed, its condition is no longer read */
+            setProgramCounterAst(inst, pc, node->getChildren()[2]);
+            inst.getReadRegisters().clear();
+            removed.insert(inst.getAddress());
+            this->stats.opaquePredicates++;
+          }
+        }
+      }
+
+
+      void PassManager::removeRedundantWrites(std::vector<triton::arch::BasicBlock>& region) {
+        const triton::arch::Register& pc = this->lifter->getCpuInstance()->getProgramCounter();
+
+        for (auto& block : region) {
+          /* The values of the parent registers written in the block, the paths being merged at its start */
+          std::unordered_map<triton::arch::register_e, triton::ast::SharedAbstractNode> values;
+          triton::arch::BasicBlock out;
+
+          for (auto& inst : block.getInstructions()) {
+            bool redundant = !inst.isControlFlow() && inst.getStoreAccess().empty();
+            bool written = false;
+
+            for (const auto& reg : inst.getWrittenRegisters()) {
+              if (!redundant)
+                break;
+              if (reg.first.getId() == pc.getId())
+                continue;
+
+              /* A write of a sub-register also writes the rest of its parent */
+              if (reg.first.getId() != reg.first.getParent()) {
+                redundant = false;
+                break;
+              }
+
+              /* The value held, from the block or read by the instruction itself */
+              triton::ast::SharedAbstractNode held = nullptr;
+              auto it = values.find(reg.first.getId());
+              if (it != values.end()) {
+                held = it->second;
+              }
+              else {
+                for (const auto& read : inst.getReadRegisters()) {
+                  if (read.first.getId() == reg.first.getId())
+                    held = read.second;
+                }
+              }
+              if (held == nullptr) {
+                redundant = false;
+                break;
+              }
+
+              triton::ast::SharedAbstractNode value = getReferencedAst(reg.second);
+              held = getReferencedAst(held);
+              if (value != held && !getReferencedAst(this->lifter->simplify(value))->equalTo(getReferencedAst(this->lifter->simplify(held))))
+                redundant = false;
+              written = true;
+            }
+
+            if (redundant && written) {
+              this->stats.redundantWrites++;
+              continue;
+            }
+
+            for (const auto& se : inst.symbolicExpressions) {
+              if (se->isRegister())
+                values[se->getOriginRegister().getId()] = se->getAst();
+            }
+            out.add(inst);
+          }
+
+          block = std::move(out);
+        }
+      }
+
+
+      void PassManager::removeDeadStores(std::vector<triton::arch::BasicBlock>& region) {
+        triton::usize before = 0;
+        triton::usize after = 0;
+
+        for (const auto& block : region)
+          before += block.getSize();
+
+        /* The region is lifted, the analysis does not process it again */
+        region = this->lifter->simplify(region);
+
+        for (const auto& block : region)
+          after += block.getSize();
+
+        this->stats.deadStores += before - after;
+      }
+
+
+      std::vector<triton::arch::BasicBlock> PassManager::run(const std::vector<triton::arch::BasicBlock>& region, bool padding) {
+        std::vector<triton::arch::BasicBlock> blocks = region;
+        std::vector<triton::arch::BasicBlock> out(region.size());
+        std::vector<triton::uint64> ends(region.size(), 0);
+        std::set<triton::uint64> removed;
+
+        this->stats = PassStatistics();
+        for (const auto& block : region) {
+          this->stats.instructions += block.getSize();
+        }
+
+        /* Lift the region once for all the passes */
+        this->lift(blocks);
+
+        const triton::arch::Register& pc = this->lifter->getCpuInstance()->getProgramCounter();
+        for (triton::usize b = 0; b < blocks.size(); b++) {
+          if (blocks[b].getSize())
+            ends[b] = blocks[b].getInstructions().back().getNextAddress();
+        }
+
+        std::vector<bool> reachable = getReachableBlocks(blocks, ends, pc);
+        std::vector<bool> resolved = reachable;
+
+        for (triton::engines::symbolic::pass_e pass : this->passes) {
+          switch (pass) {
+            case PASS_DEAD_STORES:
+              this->removeDeadStores(blocks);
+              break;
+
+            case PASS_OPAQUE_PREDICATES:
+              this->removeOpaquePredicates(blocks, removed);
+              resolved = getReachableBlocks(blocks, ends, pc);
+              break;
+
+            case PASS_REDUNDANT_WRITES:
+              this->removeRedundantWrites(blocks);
+              break;
+          }
+        }
+
+        /* Create the new blocks without the branches never taken and the blocks no longer reachable */
+        auto nop = this->lifter->getNopInstruction();
+        for (triton::usize b = 0; b < blocks.size(); b++) {
+          if (region[b].getSize() == 0)
+            continue;
+
+          if (reachable[b] && !resolved[b]) {
+            this->stats.unreachableBlocks++;
+            continue;
+          }
+
+          auto lastaddr = region[b].getFirstAddress();
+          for (auto& inst : blocks[b].getInstructions()) {
+            if (removed.count(inst.getAddress()))
+              continue;
+            if (padding) {
+              while (inst.getAddress() > lastaddr) {
+                out[b].add(nop);
+                lastaddr += nop.getSize();
+              }
+            }
+            out[b].add(inst);
+            lastaddr = inst.getNextAddress();
+            this->stats.kept++;
+          }
+
+          if (padding) {
+            while (ends[b] > lastaddr) {
+              out[b].add(nop);
+              lastaddr += nop.getSize();
+            }
+          }
+        }
+
+        return out;
+      }
+
+
+      triton::arch::BasicBlock PassManager::run(const triton::arch::BasicBlock& block, bool padding) {
+        return this->run(std::vector<triton::arch::BasicBlock>{block}, padding).front();
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
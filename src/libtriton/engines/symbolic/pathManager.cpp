@@ -5,6 +5,10 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <set>
+#include <string>
+
 #include <triton/astContext.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/pathManager.hpp>
@@ -18,48 +22,135 @@ namespace triton {
 
       PathManager::PathManager(const triton::modes::SharedModes& modes, const triton::ast::SharedAstContext& astCtxt)
         : modes(modes), astCtxt(astCtxt) {
+        this->branchIndexesSize = 0;
+        this->conjunctionsSize  = 0;
+        this->smtStream         = nullptr;
+        this->takenIndexesSize  = 0;
+        this->threadIndexesSize = 0;
+        this->windowSize        = 0;
       }
 
 
       PathManager::PathManager(const PathManager& other)
         : modes(other.modes), astCtxt(other.astCtxt) {
-        this->pathConstraints = other.pathConstraints;
+        this->branchIndexesSize  = other.branchIndexesSize;
+        this->conjunctions       = other.conjunctions;
+        this->conjunctionsSize   = other.conjunctionsSize;
+        this->destinationIndexes = other.destinationIndexes;
+        this->indirectBranches   = other.indirectBranches;
+        this->mergedConstraints  = other.mergedConstraints;
+        this->pathConstraints    = other.pathConstraints;
+        this->pathPredicate      = other.pathPredicate;
+        this->smtStream          = nullptr;
+        this->sourceIndexes      = other.sourceIndexes;
+        this->takenIndexes       = other.takenIndexes;
+        this->takenIndexesSize   = other.takenIndexesSize;
+        this->threadIndexes      = other.threadIndexes;
+        this->threadIndexesSize  = other.threadIndexesSize;
+        this->windowSize         = other.windowSize;
       }
 
 
+      /* The solving session and the SMT stream are kept, they follow the restored path */
       PathManager& PathManager::operator=(const PathManager& other) {
-        this->astCtxt         = other.astCtxt;
-        this->modes           = other.modes;
-        this->pathConstraints = other.pathConstraints;
+        this->astCtxt            = other.astCtxt;
+        this->branchIndexesSize  = other.branchIndexesSize;
+        this->conjunctions       = other.conjunctions;
+        this->conjunctionsSize   = other.conjunctionsSize;
+        this->destinationIndexes = other.destinationIndexes;
+        this->indirectBranches   = other.indirectBranches;
+        this->mergedConstraints  = other.mergedConstraints;
+        this->modes              = other.modes;
+        this->pathConstraints    = other.pathConstraints;
+        this->pathPredicate      = other.pathPredicate;
+        this->sourceIndexes      = other.sourceIndexes;
+        this->takenIndexes       = other.takenIndexes;
+        this->takenIndexesSize   = other.takenIndexesSize;
+        this->threadIndexes      = other.threadIndexes;
+        this->threadIndexesSize  = other.threadIndexesSize;
+        this->windowSize         = other.windowSize;
         return *this;
       }
 
 
       triton::usize PathManager::getSizeOfPathConstraints(void) const {
-        return this->pathConstraints.size();
+        return this->pathConstraints->size();
       }
 
 
       /* Returns the logical conjunction vector of path constraint */
       const std::vector<triton::engines::symbolic::PathConstraint>& PathManager::getPathConstraints(void) const {
-        return this->pathConstraints;
+        return this->pathConstraints.get();
+      }
+
+
+      void PathManager::extendThreadIndexes(void) const {
+        const auto& pcs = this->pathConstraints.get();
+
+        if (this->threadIndexesSize == pcs.size())
+          return;
+
+        auto& indexes = this->threadIndexes.mutate();
+        for (; this->threadIndexesSize < pcs.size(); this->threadIndexesSize++)
+          indexes[pcs[this->threadIndexesSize].getThreadId()].push_back(this->threadIndexesSize);
       }
 
 
       /* Returns the logical conjunction vector of path constraint of a given thread */
       std::vector<triton::engines::symbolic::PathConstraint> PathManager::getPathConstraintsOfThread(triton::uint32 threadId) const {
         std::vector<triton::engines::symbolic::PathConstraint> ret;
+        const auto& pcs = this->pathConstraints.get();
 
-        for (auto& pc : this->pathConstraints) {
-          if (pc.getThreadId() == threadId) {
-            ret.push_back(pc);
-          }
+        for (triton::usize index : this->getPathConstraintIndexesOfThread(threadId)) {
+          ret.push_back(pcs[index]);
+        }
+
+        return ret;
+      }
+
+
+      std::vector<triton::usize> PathManager::getPathConstraintIndexesOfThread(triton::uint32 threadId) const {
+        this->extendThreadIndexes();
+
+        auto it = this->threadIndexes->find(threadId);
+        if (it == this->threadIndexes->end())
+          return {};
+
+        return it->second;
+      }
+
+
+      std::vector<triton::uint32> PathManager::getPathConstraintThreads(void) const {
+        std::vector<triton::uint32> ret;
+
+        this->extendThreadIndexes();
+        for (const auto& it : this->threadIndexes.get()) {
+          if (!it.second.empty())
+            ret.push_back(it.first);
         }
+        std::sort(ret.begin(), ret.end());
 
         return ret;
       }
 
 
+      triton::ast::SharedAbstractNode PathManager::getPathPredicateOfThread(triton::uint32 threadId) const {
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+        const auto& pcs = this->pathConstraints.get();
+
+        /* by default PC is T (top) */
+        nodes.push_back(this->astCtxt->equal(
+                          this->astCtxt->bvtrue(),
+                          this->astCtxt->bvtrue()
+                        ));
+
+        for (triton::usize index : this->getPathConstraintIndexesOfThread(threadId))
+          nodes.push_back(pcs[index].getTakenPredicate());
+
+        return nodes.size() == 1 ? nodes.front() : this->astCtxt->land(nodes);
+      }
+
+
       /* Returns the logical conjunction vector of path constraint from a given range */
       std::vector<triton::engines::symbolic::PathConstraint> PathManager::getPathConstraints(triton::usize start, triton::usize end) const {
         triton::usize pcsize = this->getSizeOfPathConstraints();
@@ -69,14 +160,14 @@ namespace triton {
         }
 
         if (start < pcsize && end > pcsize) {
-          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator first = this->pathConstraints.begin() + start;
-          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator last  = this->pathConstraints.end();
+          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator first = this->pathConstraints->begin() + start;
+          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator last  = this->pathConstraints->end();
           return {first, last};
         }
 
         if (start < pcsize && end < pcsize && end > start) {
-          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator first = this->pathConstraints.begin() + start;
-          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator last  = this->pathConstraints.begin() + end;
+          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator first = this->pathConstraints->begin() + start;
+          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator last  = this->pathConstraints->begin() + end;
           return {first, last};
         }
 
@@ -84,73 +175,366 @@ namespace triton {
       }
 
 
-      /* Returns the current path predicate as an AST of logical conjunction of each taken branch. */
-      triton::ast::SharedAbstractNode PathManager::getPathPredicate(void) const {
-        std::vector<triton::engines::symbolic::PathConstraint>::const_iterator it;
+      void PathManager::extendConjunctions(void) const {
+        const auto& pcs = this->pathConstraints.get();
+
+        if (this->conjunctionsSize == pcs.size())
+          return;
+
+        auto& conjs = this->conjunctions.mutate();
+        this->pathPredicate = nullptr;
+
+        for (triton::usize index = this->conjunctionsSize; index < pcs.size(); index++) {
+          conjs.push_back({pcs[index].getTakenPredicate(), 1});
+
+          /* The last conjunctions of the same size are merged, as the digits of a counter */
+          while (conjs.size() >= conjunctionArity && conjs[conjs.size() - conjunctionArity].size == conjs.back().size) {
+            std::vector<triton::ast::SharedAbstractNode> children;
+            triton::usize size = conjs.back().size;
+
+            children.reserve(conjunctionArity);
+            for (triton::usize i = conjs.size() - conjunctionArity; i < conjs.size(); i++)
+              children.push_back(conjs[i].node);
+
+            conjs.resize(conjs.size() - conjunctionArity);
+            conjs.push_back({this->astCtxt->land(children), size * conjunctionArity});
+          }
+
+          this->conjunctionsSize++;
+        }
+      }
+
+
+      void PathManager::truncateConjunctions(void) {
+        triton::usize size = this->pathConstraints->size();
+
+        this->pathPredicate = nullptr;
+        if (this->conjunctionsSize <= size)
+          return;
+
+        /* The last conjunction is split into its children until the popped constraints are removed */
+        auto& conjs = this->conjunctions.mutate();
+        while (this->conjunctionsSize > size) {
+          Conjunction last = std::move(conjs.back());
+          conjs.pop_back();
+
+          if (last.size == 1) {
+            this->conjunctionsSize--;
+            continue;
+          }
+
+          for (const auto& child : last.node->getChildren())
+            conjs.push_back({child, last.size / conjunctionArity});
+        }
+      }
+
+
+      std::vector<triton::ast::SharedAbstractNode> PathManager::getPrefixConjunctions(triton::usize index) const {
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+        triton::usize covered = 0;
+
+        if (index > this->pathConstraints->size())
+          throw triton::exceptions::PathManager("PathManager::getPrefixConjunctions(): Index out of range.");
+
+        this->extendConjunctions();
+
+        for (const auto& conj : this->conjunctions.get()) {
+          if (covered == index)
+            break;
+
+          if (covered + conj.size <= index) {
+            nodes.push_back(conj.node);
+            covered += conj.size;
+            continue;
+          }
+
+          /* The conjunction exceeds the prefix, its children are taken instead */
+          const Conjunction* current = &conj;
+          Conjunction child;
+          while (covered < index) {
+            triton::usize size = current->size / conjunctionArity;
+            for (const auto& node : current->node->getChildren()) {
+              if (covered + size > index) {
+                child = {node, size};
+                break;
+              }
+              nodes.push_back(node);
+              covered += size;
+            }
+            current = &child;
+          }
+        }
+
+        return nodes;
+      }
+
+
+      triton::ast::SharedAbstractNode PathManager::buildPredicate(triton::usize index, const triton::ast::SharedAbstractNode& node) const {
+        std::vector<triton::ast::SharedAbstractNode> nodes;
 
         /* by default PC is T (top) */
-        auto node = this->astCtxt->equal(
-                      this->astCtxt->bvtrue(),
-                      this->astCtxt->bvtrue()
-                    );
+        nodes.push_back(this->astCtxt->equal(
+                          this->astCtxt->bvtrue(),
+                          this->astCtxt->bvtrue()
+                        ));
 
         /* Then, we create a conjunction of path constraint */
-        for (it = this->pathConstraints.begin(); it != this->pathConstraints.end(); it++) {
-          node = this->astCtxt->land(node, it->getTakenPredicate());
-        }
+        auto prefix = this->getPrefixConjunctions(index);
+        nodes.insert(nodes.end(), prefix.begin(), prefix.end());
+
+        if (node != nullptr)
+          nodes.push_back(node);
+
+        return nodes.size() == 1 ? nodes.front() : this->astCtxt->land(nodes);
+      }
+
+
+      /* Returns the current path predicate as an AST of logical conjunction of each taken branch. */
+      triton::ast::SharedAbstractNode PathManager::getPathPredicate(void) const {
+        if (this->pathPredicate == nullptr || this->conjunctionsSize != this->pathConstraints->size())
+          this->pathPredicate = this->buildPredicate(this->pathConstraints->size(), nullptr);
+        return this->pathPredicate;
+      }
+
 
-        return node;
+      /* Returns true if a branch is a direct branch (call reg, jmp reg) which may reach any address, and not a standalone constraint */
+      static bool isIndirectBranch(const triton::engines::symbolic::PathConstraint& pco, const std::tuple<bool, triton::uint64, triton::uint64, triton::ast::SharedAbstractNode>& branch) {
+        return pco.getBranchConstraints().size() < 2 &&
+               std::get<1>(branch) != 0 && std::get<2>(branch) != 0 &&
+               std::get<3>(branch)->getType() == triton::ast::EQUAL_NODE;
       }
 
 
+      void PathManager::extendBranchIndexes(void) const {
+        const auto& pcs = this->pathConstraints.get();
+
+        if (this->branchIndexesSize == pcs.size())
+          return;
+
+        auto& sources      = this->sourceIndexes.mutate();
+        auto& destinations = this->destinationIndexes.mutate();
+        auto& indirects    = this->indirectBranches.mutate();
+
+        for (; this->branchIndexesSize < pcs.size(); this->branchIndexesSize++) {
+          const auto& branches = pcs[this->branchIndexesSize].getBranchConstraints();
+          for (triton::usize b = 0; b < branches.size(); b++) {
+            BranchPosition position = {this->branchIndexesSize, b};
+            sources[std::get<1>(branches[b])].push_back(position);
+            destinations[std::get<2>(branches[b])].push_back(position);
+            if (isIndirectBranch(pcs[this->branchIndexesSize], branches[b]))
+              indirects.push_back(position);
+          }
+        }
+      }
+
+
+      void PathManager::truncateBranchIndexes(void) {
+        triton::usize index = this->pathConstraints->size() - 1;
+
+        if (this->branchIndexesSize <= index)
+          return;
+
+        /* The branches of the last path constraint are the last ones of their addresses */
+        auto pop = [index](std::unordered_map<triton::uint64, std::vector<BranchPosition>>& indexes, triton::uint64 addr) {
+          auto it = indexes.find(addr);
+          while (it != indexes.end() && !it->second.empty() && it->second.back().index == index)
+            it->second.pop_back();
+          if (it != indexes.end() && it->second.empty())
+            indexes.erase(it);
+        };
+
+        auto& sources      = this->sourceIndexes.mutate();
+        auto& destinations = this->destinationIndexes.mutate();
+        auto& indirects    = this->indirectBranches.mutate();
+
+        for (const auto& branch : this->pathConstraints->back().getBranchConstraints()) {
+          pop(sources, std::get<1>(branch));
+          pop(destinations, std::get<2>(branch));
+        }
+        while (!indirects.empty() && indirects.back().index == index)
+          indirects.pop_back();
+
+        this->branchIndexesSize = index;
+      }
+
 
       std::vector<triton::ast::SharedAbstractNode> PathManager::getPredicatesToReachAddress(triton::uint64 addr) const {
+        /* A branch which may reach the address: from its source (0), to its destination (1) or indirectly (2) */
+        std::vector<std::tuple<triton::usize, triton::usize, triton::uint32>> matches;
         std::vector<triton::ast::SharedAbstractNode> predicates;
+        const auto& pcs = this->pathConstraints.get();
 
-        /* by default PC is T (top) */
-        auto node = this->astCtxt->equal(
-                      this->astCtxt->bvtrue(),
-                      this->astCtxt->bvtrue()
-                    );
-
-        /* Go through all path constraints */
-        for (auto pc = this->pathConstraints.begin(); pc != this->pathConstraints.end(); pc++) {
-          auto branches = pc->getBranchConstraints();
-          bool isMultib = (branches.size() >= 2);
-
-          /* Check if one of the branch constraint may reach the targeted address */
-          for (auto branch = branches.begin(); branch != branches.end(); branch++) {
+        this->extendBranchIndexes();
+
+        auto source = this->sourceIndexes->find(addr);
+        if (source != this->sourceIndexes->end()) {
+          for (const auto& position : source->second)
+            matches.push_back({position.index, position.branch, 0});
+        }
+
+        auto destination = this->destinationIndexes->find(addr);
+        if (destination != this->destinationIndexes->end()) {
+          for (const auto& position : destination->second)
+            matches.push_back({position.index, position.branch, 1});
+        }
+
+        for (const auto& position : this->indirectBranches.get())
+          matches.push_back({position.index, position.branch, 2});
+
+        /* The predicates are returned in the order of the path, the ones of a prefix sharing its conjunctions */
+        std::sort(matches.begin(), matches.end());
+
+        for (const auto& match : matches) {
+          const auto& branch = pcs[std::get<0>(match)].getBranchConstraints()[std::get<1>(match)];
+          switch (std::get<2>(match)) {
             /* if source branch == target, add the current path predicate */
-            if (std::get<1>(*branch) == addr) {
-              predicates.push_back(node);
-            }
-            /*
-             * if dst branch == target, do the conjunction of the current
-             * path predicate and the branch constraint.
-             */
-            if (std::get<2>(*branch) == addr) {
-              predicates.push_back(this->astCtxt->land(node, std::get<3>(*branch)));
-            }
-            /*
-             * if it's a direct branch (call reg, jmp reg) and not a standalone
-             * constraint. Try to reach the targeted address.
-             */
-            if (isMultib == false && std::get<1>(*branch) != 0 && std::get<2>(*branch) != 0) {
-              if (std::get<3>(*branch)->getType() == triton::ast::EQUAL_NODE) {
-                auto ip = std::get<3>(*branch)->getChildren()[0];
-                predicates.push_back(this->astCtxt->land(node, this->astCtxt->equal(ip, this->astCtxt->bv(addr, ip->getBitvectorSize()))));
-              }
+            case 0:
+              predicates.push_back(this->buildPredicate(std::get<0>(match), nullptr));
+              break;
+
+            /* if dst branch == target, do the conjunction of the current path predicate and the branch constraint */
+            case 1:
+              predicates.push_back(this->buildPredicate(std::get<0>(match), std::get<3>(branch)));
+              break;
+
+            /* if it's a direct branch (call reg, jmp reg), try to reach the targeted address */
+            default: {
+              auto ip = std::get<3>(branch)->getChildren()[0];
+              predicates.push_back(this->buildPredicate(std::get<0>(match), this->astCtxt->equal(ip, this->astCtxt->bv(addr, ip->getBitvectorSize()))));
+              break;
             }
-          } /* branch constraints */
-
-          /* Continue to create the conjunction of the current path predicate */
-          node = this->astCtxt->land(node, pc->getTakenPredicate());
-        } /* path constraint */
+          }
+        }
 
         return predicates;
       }
 
 
+      std::vector<std::vector<triton::ast::SharedAbstractNode>> PathManager::getPredicatesToReachAddresses(const std::vector<triton::uint64>& addrs) const {
+        std::vector<std::vector<triton::ast::SharedAbstractNode>> ret;
+
+        ret.reserve(addrs.size());
+        for (triton::uint64 addr : addrs)
+          ret.push_back(this->getPredicatesToReachAddress(addr));
+
+        return ret;
+      }
+
+
+      /* Returns the key of the taken branch of a path constraint, the hash of a reference is the one of its AST */
+      static triton::uint64 getTakenKey(const triton::engines::symbolic::PathConstraint& pco) {
+        return pco.getTakenPredicate()->getHash64()
+               ^ (pco.getSourceAddress() * 0x9e3779b97f4a7c15)
+               ^ (pco.getTakenAddress()  * 0xc2b2ae3d27d4eb4f);
+      }
+
+
+      /* Returns true if two nodes are structurally equal, through the references and whether they are shared or not */
+      static bool isStructurallyEqual(const triton::ast::SharedAbstractNode& node1, const triton::ast::SharedAbstractNode& node2) {
+        std::set<std::pair<triton::ast::AbstractNode*, triton::ast::AbstractNode*>> visited;
+        std::vector<std::pair<triton::ast::AbstractNode*, triton::ast::AbstractNode*>> worklist = {{node1.get(), node2.get()}};
+
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* n1 = worklist.back().first;
+          triton::ast::AbstractNode* n2 = worklist.back().second;
+          worklist.pop_back();
+
+          while (n1->getType() == triton::ast::REFERENCE_NODE)
+            n1 = reinterpret_cast<triton::ast::ReferenceNode*>(n1)->getSymbolicExpression()->getAst().get();
+          while (n2->getType() == triton::ast::REFERENCE_NODE)
+            n2 = reinterpret_cast<triton::ast::ReferenceNode*>(n2)->getSymbolicExpression()->getAst().get();
+
+          if (n1 == n2 || visited.insert({n1, n2}).second == false)
+            continue;
+
+          if (n1->getType() != n2->getType() || n1->getBitvectorSize() != n2->getBitvectorSize() || n1->getHash64() != n2->getHash64())
+            return false;
+
+          switch (n1->getType()) {
+            /* Distinct arrays hold distinct memories */
+            case triton::ast::ARRAY_NODE:
+              return false;
+
+            case triton::ast::INTEGER_NODE:
+              if (reinterpret_cast<triton::ast::IntegerNode*>(n1)->getInteger() != reinterpret_cast<triton::ast::IntegerNode*>(n2)->getInteger())
+                return false;
+              continue;
+
+            case triton::ast::STRING_NODE:
+              if (reinterpret_cast<triton::ast::StringNode*>(n1)->getString() != reinterpret_cast<triton::ast::StringNode*>(n2)->getString())
+                return false;
+              continue;
+
+            case triton::ast::VARIABLE_NODE:
+              if (reinterpret_cast<triton::ast::VariableNode*>(n1)->getSymbolicVariable() != reinterpret_cast<triton::ast::VariableNode*>(n2)->getSymbolicVariable())
+                return false;
+              continue;
+
+            default:
+              break;
+          }
+
+          const auto& children1 = n1->getChildren();
+          const auto& children2 = n2->getChildren();
+          if (children1.size() != children2.size())
+            return false;
+
+          for (triton::usize index = 0; index < children1.size(); index++)
+            worklist.push_back({children1[index].get(), children2[index].get()});
+        }
+
+        return true;
+      }
+
+
+      bool PathManager::isDuplicatedPathConstraint(const triton::engines::symbolic::PathConstraint& pco) {
+        const auto& pcs = this->pathConstraints.get();
+
+        /* The constraints pushed since the last call are indexed first */
+        if (this->takenIndexesSize < pcs.size()) {
+          auto& indexes = this->takenIndexes.mutate();
+          for (; this->takenIndexesSize < pcs.size(); this->takenIndexesSize++)
+            indexes.insert({getTakenKey(pcs[this->takenIndexesSize]), this->takenIndexesSize});
+        }
+
+        auto range = this->takenIndexes->equal_range(getTakenKey(pco));
+        for (auto it = range.first; it != range.second; it++) {
+          const auto& other = pcs[it->second];
+          if (other.getSourceAddress() == pco.getSourceAddress() &&
+              other.getTakenAddress() == pco.getTakenAddress() &&
+              isStructurallyEqual(other.getTakenPredicate(), pco.getTakenPredicate()))
+            return true;
+        }
+
+        return false;
+      }
+
+
+      void PathManager::appendPathConstraint(const triton::engines::symbolic::PathConstraint& pco) {
+        /* The conjunction is idempotent, a constraint already in the path does not change it */
+        if (this->modes->isModeEnabled(triton::modes::PC_DEDUPLICATION) && this->isDuplicatedPathConstraint(pco))
+          return;
+
+        this->pathConstraints.mutate().push_back(pco);
+
+        if (this->smtStream)
+          this->streamPathConstraint(pco);
+
+        /* The window is summarized past twice its size, so that each constraint is summarized once on average */
+        if (this->windowSize && this->pathConstraints->size() > this->windowSize * 2)
+          this->summarizePathConstraints(this->pathConstraints->size() - this->windowSize);
+      }
+
+
+      void PathManager::streamPathConstraint(const triton::engines::symbolic::PathConstraint& pco) {
+        triton::ast::representations::mode_e mode = this->astCtxt->getRepresentationMode();
+
+        this->astCtxt->setRepresentationMode(triton::ast::representations::SMT_REPRESENTATION);
+        *this->smtStream << this->astCtxt->assert_(pco.getTakenPredicate()) << "\n";
+        this->astCtxt->setRepresentationMode(mode);
+      }
+
+
       /* Pushs constraints of a branch instruction to the path predicate. */
       void PathManager::pushPathConstraint(const triton::arch::Instruction& inst, const triton::engines::symbolic::SharedSymbolicExpression& expr) {
         triton::engines::symbolic::PathConstraint pco;
@@ -213,7 +597,7 @@ namespace triton {
             bb2pc           /* expr which must be true to take the branch */
           );
 
-          this->pathConstraints.push_back(pco);
+          this->appendPathConstraint(pco);
         }
 
         /* Direct branch */
@@ -225,7 +609,7 @@ namespace triton {
             /* expr which must be true to take the branch */
             this->astCtxt->equal(pc, this->astCtxt->bv(dstAddr, size))
           );
-          this->pathConstraints.push_back(pco);
+          this->appendPathConstraint(pco);
         }
       }
 
@@ -250,26 +634,170 @@ namespace triton {
 
         pco.setComment(comment);
 
-        this->pathConstraints.push_back(pco);
+        this->appendPathConstraint(pco);
       }
 
 
       /* Pushes constraint to the current path predicate. */
       void PathManager::pushPathConstraint(const triton::engines::symbolic::PathConstraint& pco) {
-        this->pathConstraints.push_back(pco);
+        this->appendPathConstraint(pco);
       }
 
 
       /* Pops the last constraints added to the path predicate. */
       void PathManager::popPathConstraint(void) {
-        if (this->pathConstraints.size())
-          this->pathConstraints.pop_back();
+        if (this->pathConstraints->size()) {
+          triton::usize index = this->pathConstraints->size() - 1;
+
+          /* The popped constraint is removed from the indexes if it was indexed */
+          if (this->takenIndexesSize > index) {
+            auto& indexes = this->takenIndexes.mutate();
+            auto range = indexes.equal_range(getTakenKey(this->pathConstraints->back()));
+            for (auto it = range.first; it != range.second; it++) {
+              if (it->second == index) {
+                indexes.erase(it);
+                break;
+              }
+            }
+            this->takenIndexesSize = index;
+          }
+
+          /* The popped constraint is the last one of its thread */
+          if (this->threadIndexesSize > index) {
+            auto& indexes = this->threadIndexes.mutate();
+            auto it = indexes.find(this->pathConstraints->back().getThreadId());
+            it->second.pop_back();
+            if (it->second.empty())
+              indexes.erase(it);
+            this->threadIndexesSize = index;
+          }
+
+          this->truncateBranchIndexes();
+          this->pathConstraints.mutate().pop_back();
+          this->truncateConjunctions();
+        }
       }
 
 
       /* Clears the current path predicate. */
       void PathManager::clearPathConstraints(void) {
+        this->conjunctions.clear();
+        this->conjunctionsSize = 0;
+        this->mergedConstraints.clear();
         this->pathConstraints.clear();
+        this->pathPredicate = nullptr;
+        this->takenIndexes.clear();
+        this->takenIndexesSize = 0;
+        this->threadIndexes.clear();
+        this->threadIndexesSize = 0;
+        this->sourceIndexes.clear();
+        this->destinationIndexes.clear();
+        this->indirectBranches.clear();
+        this->branchIndexesSize = 0;
+      }
+
+
+      void PathManager::mergePathConstraint(void) {
+        if (this->pathConstraints->empty())
+          throw triton::exceptions::PathManager("PathManager::mergePathConstraint(): No path constraint to merge.");
+
+        this->mergedConstraints.mutate().push_back(this->pathConstraints->back());
+        this->popPathConstraint();
+      }
+
+
+      const std::vector<triton::engines::symbolic::PathConstraint>& PathManager::getMergedPathConstraints(void) const {
+        return *this->mergedConstraints;
+      }
+
+
+      void PathManager::summarizePathConstraints(triton::usize count) {
+        if (count > this->pathConstraints->size())
+          throw triton::exceptions::PathManager("PathManager::summarizePathConstraints(): Index out of range.");
+
+        if (count < 2)
+          return;
+
+        triton::engines::symbolic::PathConstraint pco;
+        auto nodes = this->getPrefixConjunctions(count);
+
+        pco.addBranchConstraint(
+          true, /* always taken   */
+          0,    /* from: not used */
+          0,    /* to: not used   */
+          nodes.size() == 1 ? nodes.front() : this->astCtxt->land(nodes)
+        );
+
+        pco.setComment("Summary of " + std::to_string(count) + " path constraints");
+
+        auto& pcs = this->pathConstraints.mutate();
+        pcs.erase(pcs.begin(), pcs.begin() + count);
+        pcs.insert(pcs.begin(), pco);
+
+        /* The indexes moved, the conjunctions and the indexes are built again */
+        this->conjunctions.clear();
+        this->conjunctionsSize = 0;
+        this->pathPredicate = nullptr;
+        this->takenIndexes.clear();
+        this->takenIndexesSize = 0;
+        this->threadIndexes.clear();
+        this->threadIndexesSize = 0;
+        this->sourceIndexes.clear();
+        this->destinationIndexes.clear();
+        this->indirectBranches.clear();
+        this->branchIndexesSize = 0;
+      }
+
+
+      void PathManager::setPathConstraintsWindow(triton::usize size) {
+        this->windowSize = size;
+        if (size && this->pathConstraints->size() > size)
+          this->summarizePathConstraints(this->pathConstraints->size() - size);
+      }
+
+
+      triton::usize PathManager::getPathConstraintsWindow(void) const {
+        return this->windowSize;
+      }
+
+
+      void PathManager::setSolverSession(const std::shared_ptr<triton::engines::solver::SolverSession>& session) {
+        this->solverSession = session;
+      }
+
+
+      bool PathManager::isSolverSessionDefined(void) const {
+        return this->solverSession != nullptr;
+      }
+
+
+      void PathManager::synchronizeSession(triton::usize index) {
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+
+        if (this->solverSession == nullptr)
+          throw triton::exceptions::PathManager("PathManager::synchronizeSession(): Incremental solving is disabled.");
+
+        if (index > this->pathConstraints->size())
+          throw triton::exceptions::PathManager("PathManager::synchronizeSession(): Index out of range.");
+
+        /* Only the constraints which changed since the last query are asserted again */
+        nodes.reserve(index);
+        for (triton::usize i = 0; i < index; i++)
+          nodes.push_back(this->pathConstraints.get()[i].getTakenPredicate());
+
+        this->solverSession->synchronize(nodes);
+      }
+
+
+      std::unordered_map<triton::usize, triton::engines::solver::SolverModel> PathManager::getModelOfPath(triton::usize index, const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+        this->synchronizeSession(index);
+        return this->solverSession->getModel(node, status, timeout, solvingTime);
+      }
+
+
+      bool PathManager::isSatOfPath(triton::usize index, const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+        this->synchronizeSession(index);
+        return this->solverSession->isSat(node, status, timeout, solvingTime);
       }
 
     }; /* symbolic namespace */
@@ -0,0 +1,264 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+#include <stack>
+#include <unordered_set>
+
+#include <triton/astContext.hpp>
+#include <triton/semanticTemplate.hpp>
+#include <triton/symbolicEngine.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      /*
+       * Returns a new placeholder. It is copied out of the AST context so that it stays
+       * distinct from the constants of the semantics, even when the nodes are hash-consed.
+       */
+      static triton::ast::SharedAbstractNode newPlaceholder(const triton::ast::SharedAbstractNode& node, triton::uint32 size) {
+        return triton::ast::newInstance(node->getContext()->bv(0, size).get());
+      }
+
+
+      /*
+       * Binds the references to the expressions of the instruction to their placeholder.
+       * Returns false if the AST depends on something else than the registers read.
+       */
+      static bool bindReferences(const triton::ast::SharedAbstractNode& root,
+                                 const std::unordered_map<SymbolicExpression*, triton::ast::SharedAbstractNode>& exprs,
+                                 std::unordered_map<triton::ast::AbstractNode*, triton::ast::SharedAbstractNode>& bindings,
+                                 std::unordered_set<triton::ast::AbstractNode*>& used) {
+        std::unordered_set<triton::ast::AbstractNode*> visited;
+        std::stack<triton::ast::AbstractNode*> worklist;
+
+        worklist.push(root.get());
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* node = worklist.top();
+          worklist.pop();
+
+          if (visited.insert(node).second == false)
+            continue;
+
+          if (bindings.find(node) != bindings.end()) {
+            used.insert(node);
+            continue;
+          }
+
+          switch (node->getType()) {
+            case triton::ast::REFERENCE_NODE: {
+              auto it = exprs.find(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getSymbolicExpression().get());
+              if (it == exprs.end())
+                return false;
+              bindings[node] = it->second;
+              break;
+            }
+
+            case triton::ast::ARRAY_NODE:
+            case triton::ast::VARIABLE_NODE:
+              return false;
+
+            default:
+              for (const auto& child : node->getChildren())
+                worklist.push(child.get());
+              break;
+          }
+        }
+
+        return true;
+      }
+
+
+      SemanticTemplate::SemanticTemplate() {
+        this->arch  = triton::arch::ARCH_INVALID;
+        this->size  = 0;
+        this->valid = true;
+      }
+
+
+      void SemanticTemplate::clear(void) {
+        this->operations.clear();
+        this->immediates.clear();
+        this->undefined.clear();
+        this->registers.clear();
+        this->arch  = triton::arch::ARCH_INVALID;
+        this->size  = 0;
+        this->valid = true;
+      }
+
+
+      void SemanticTemplate::addRead(const triton::arch::Register& reg, const triton::ast::SharedAbstractNode& node) {
+        Operation op;
+
+        op.write      = false;
+        op.declared   = false;
+        op.isVolatile = false;
+        op.reg        = reg;
+        op.node       = node;
+
+        this->operations.push_back(std::move(op));
+      }
+
+
+      void SemanticTemplate::addWrite(const SharedSymbolicExpression& expr, const triton::ast::SharedAbstractNode& node, const triton::arch::Register& reg, const std::string& comment) {
+        Operation op;
+
+        op.write      = true;
+        op.declared   = false;
+        op.isVolatile = false;
+        op.reg        = reg;
+        op.comment    = comment;
+        op.node       = node;
+        op.expr       = expr;
+
+        this->operations.push_back(std::move(op));
+      }
+
+
+      void SemanticTemplate::addWrite(const SharedSymbolicExpression& expr, const triton::ast::SharedAbstractNode& node, const std::string& comment) {
+        Operation op;
+
+        op.write      = true;
+        op.declared   = false;
+        op.isVolatile = true;
+        op.comment    = comment;
+        op.node       = node;
+        op.expr       = expr;
+
+        this->operations.push_back(std::move(op));
+      }
+
+
+      void SemanticTemplate::invalidate(void) {
+        this->valid = false;
+      }
+
+
+      bool SemanticTemplate::build(triton::arch::Instruction& inst, triton::arch::architecture_e arch) {
+        std::unordered_map<SymbolicExpression*, triton::ast::SharedAbstractNode> exprs;
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::SharedAbstractNode> bindings;
+        std::unordered_set<triton::ast::AbstractNode*> used;
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+        std::vector<Operation> operations;
+        triton::usize written = 0;
+
+        if (this->valid == false || inst.getSize() > sizeof(this->opcode))
+          return false;
+
+        if (inst.getLoadAccess().empty() == false || inst.getStoreAccess().empty() == false)
+          return false;
+
+        /* Replace the registers read and the expressions created by placeholders */
+        for (auto& op : this->operations) {
+          if (op.write == false) {
+            op.declared    = (inst.getReadRegisters().find(std::make_pair(op.reg, op.node)) != inst.getReadRegisters().end());
+            op.placeholder = newPlaceholder(op.node, op.node->getBitvectorSize());
+            bindings[op.node.get()] = op.placeholder;
+            nodes.push_back(nullptr);
+            continue;
+          }
+
+          /* The semantics must not have removed an output of the instruction */
+          if (op.isVolatile == false) {
+            if (inst.getWrittenRegisters().find(std::make_pair(op.reg, op.node)) == inst.getWrittenRegisters().end())
+              return false;
+            written++;
+          }
+
+          if (bindReferences(op.node, exprs, bindings, used) == false)
+            return false;
+
+          nodes.push_back(triton::ast::newInstance(op.node.get(), bindings));
+          op.placeholder = newPlaceholder(op.node, op.expr->getAst()->getBitvectorSize());
+          exprs[op.expr.get()] = op.placeholder;
+        }
+
+        if (written != inst.getWrittenRegisters().size())
+          return false;
+
+        /* Keep the placeholders only, recorded nodes refer to the previous state */
+        for (triton::usize index = 0; index < this->operations.size(); index++) {
+          Operation& op = this->operations[index];
+
+          if (op.write == false) {
+            /* Reads done by the symbolic engine for its own purpose */
+            if (op.declared == false && used.find(op.node.get()) == used.end())
+              continue;
+            op.node = nullptr;
+          }
+          else {
+            op.node = nodes[index];
+            op.expr = nullptr;
+          }
+
+          if (op.isVolatile == false)
+            this->registers.push_back(op.reg);
+
+          operations.push_back(std::move(op));
+        }
+
+        this->operations = std::move(operations);
+        this->immediates = inst.getReadImmediates();
+        this->undefined  = inst.getUndefinedRegisters();
+
+        for (const auto& reg : this->undefined)
+          this->registers.push_back(reg);
+
+        std::memcpy(this->opcode, inst.getOpcode(), inst.getSize());
+        this->size = inst.getSize();
+        this->arch = arch;
+
+        return true;
+      }
+
+
+      bool SemanticTemplate::matches(const triton::arch::Instruction& inst, triton::arch::architecture_e arch) const {
+        return this->arch == arch && this->size == inst.getSize() && std::memcmp(this->opcode, inst.getOpcode(), this->size) == 0;
+      }
+
+
+      const std::vector<triton::arch::Register>& SemanticTemplate::getRegisters(void) const {
+        return this->registers;
+      }
+
+
+      void SemanticTemplate::bind(triton::arch::Instruction& inst, SymbolicEngine* symbolicEngine) const {
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::SharedAbstractNode> bindings;
+
+        for (const auto& op : this->operations) {
+          if (op.write == false) {
+            if (op.declared)
+              bindings[op.placeholder.get()] = symbolicEngine->getRegisterAst(inst, op.reg);
+            else
+              bindings[op.placeholder.get()] = symbolicEngine->getRegisterAst(op.reg);
+            continue;
+          }
+
+          auto node = triton::ast::newInstance(op.node.get(), bindings);
+          if (op.isVolatile) {
+            const SharedSymbolicExpression& expr = symbolicEngine->createSymbolicVolatileExpression(inst, node, op.comment);
+            bindings[op.placeholder.get()] = node->getContext()->reference(expr);
+          }
+          else {
+            const SharedSymbolicExpression& expr = symbolicEngine->createSymbolicRegisterExpression(inst, node, op.reg, op.comment);
+            bindings[op.placeholder.get()] = node->getContext()->reference(expr);
+          }
+        }
+
+        for (const auto& imm : this->immediates)
+          inst.setReadImmediate(imm.first, imm.second);
+
+        for (const auto& reg : this->undefined)
+          inst.setUndefinedRegister(reg);
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,90 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+
+#include <triton/simplificationMemo.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      SimplificationMemo::SimplificationMemo() {
+        this->signature = 0;
+        this->threshold = 1024;
+        this->hits      = 0;
+      }
+
+
+      void SimplificationMemo::validate(triton::usize signature) {
+        if (this->signature != signature) {
+          this->entries.clear();
+          this->signature = signature;
+          this->threshold = 1024;
+        }
+      }
+
+
+      triton::ast::SharedAbstractNode SimplificationMemo::find(const triton::ast::SharedAbstractNode& node) {
+        auto it = this->entries.find(node->getId());
+        if (it == this->entries.end())
+          return nullptr;
+
+        const Entry& entry = it->second;
+        if (entry.node.lock() != node || entry.nodeHash != node->getHash())
+          return nullptr;
+
+        auto result = entry.result.lock();
+        if (result == nullptr || entry.resultHash != result->getHash())
+          return nullptr;
+
+        this->hits++;
+        return result;
+      }
+
+
+      void SimplificationMemo::insert(const triton::ast::SharedAbstractNode& node, const triton::ast::SharedAbstractNode& result) {
+        /* Prunes the entries whose node or result is dead, the id of a dead node being given again */
+        if (this->entries.size() >= this->threshold) {
+          for (auto it = this->entries.begin(); it != this->entries.end();) {
+            if (it->second.node.expired() || it->second.result.expired())
+              it = this->entries.erase(it);
+            else
+              ++it;
+          }
+          this->threshold = std::max<triton::usize>(1024, this->entries.size() * 2);
+        }
+
+        Entry& entry     = this->entries[node->getId()];
+        entry.node       = node;
+        entry.result     = result;
+        entry.nodeHash   = node->getHash();
+        entry.resultHash = result->getHash();
+      }
+
+
+      triton::usize SimplificationMemo::size(void) const {
+        return this->entries.size();
+      }
+
+
+      triton::usize SimplificationMemo::getHits(void) const {
+        return this->hits;
+      }
+
+
+      void SimplificationMemo::clear(void) {
+        this->entries.clear();
+        this->threshold = 1024;
+        this->hits      = 0;
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
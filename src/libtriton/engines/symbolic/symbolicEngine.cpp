@@ -5,13 +5,19 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <new>
 #include <set>
+#include <unordered_set>
 
+#include <triton/astSerialization.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/coreUtils.hpp>
+#include <triton/memoryResource.hpp>
 #include <triton/symbolicEngine.hpp>
+#include <triton/tracing.hpp>
 #include <triton/astContext.hpp>
 
 
@@ -20,6 +26,55 @@ namespace triton {
   namespace engines {
     namespace symbolic {
 
+      static void writeWord(std::ostream& stream, triton::uint64 value) {
+        char bytes[8];
+        for (triton::uint32 i = 0; i < 8; i++)
+          bytes[i] = static_cast<char>((value >> (i * 8)) & 0xff);
+        stream.write(bytes, sizeof(bytes));
+      }
+
+
+      static triton::uint64 readWord(std::istream& stream) {
+        char bytes[8];
+        triton::uint64 value = 0;
+
+        if (!stream.read(bytes, sizeof(bytes)))
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::loadState(): Truncated state.");
+
+        for (triton::uint32 i = 0; i < 8; i++)
+          value |= static_cast<triton::uint64>(static_cast<triton::uint8>(bytes[i])) << (i * 8);
+
+        return value;
+      }
+
+
+      /*
+       * Removes the dead entries of a map of weak pointers once it has doubled since the last
+       * removal, so that the map stays bounded by the live objects on long traces.
+       */
+      template <typename Map>
+      static void removeExpiredEntries(Map& map, triton::usize& threshold) {
+        if (map.size() < threshold)
+          return;
+
+        for (auto it = map.begin(); it != map.end();) {
+          if (it->second.expired())
+            it = map.erase(it);
+          else
+            ++it;
+        }
+
+        threshold = std::max<triton::usize>(1024, map.size() * 2);
+      }
+
+
+      template <typename T>
+      static void removeExpiredEntries(triton::utils::CopyOnWrite<std::unordered_map<triton::usize, std::weak_ptr<T>>>& entries, triton::usize& threshold) {
+        if (entries->size() >= threshold)
+          removeExpiredEntries(entries.mutate(), threshold);
+      }
+
+
       SymbolicEngine::SymbolicEngine(triton::arch::Architecture* architecture,
                                      const triton::modes::SharedModes& modes,
                                      const triton::ast::SharedAstContext& astCtxt,
@@ -33,14 +88,30 @@ namespace triton {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::SymbolicEngine(): The architecture pointer must be valid.");
         }
 
-        this->architecture      = architecture;
-        this->callbacks         = callbacks;
-        this->numberOfRegisters = this->architecture->numberOfRegisters();
-        this->uniqueSymExprId   = 0;
-        this->uniqueSymVarId    = 0;
-        this->memoryArray       = nullptr;
+        this->architecture           = architecture;
+        this->callbacks              = callbacks;
+        this->numberOfRegisters      = this->architecture->numberOfRegisters();
+        this->uniqueSymExprId        = 0;
+        this->uniqueSymVarId         = std::make_shared<std::atomic<triton::usize>>(0);
+        this->memoryArray            = nullptr;
+        this->recorder               = nullptr;
+        this->deferringFlags         = false;
+        this->budgetNodes            = 0;
+        this->budgetLevel            = 0;
+        this->budgetPolicy           = BUDGET_CONCRETIZE;
+        this->loopUnrollBound        = 16;
+        this->pointerResolutionBound = 16;
+
+        this->commentsThreshold    = 1024;
+        this->expressionsThreshold = 1024;
+        this->memoryArrayThreshold = 1024;
+        this->variablesThreshold   = 1024;
 
         this->symbolicReg.resize(this->numberOfRegisters);
+        this->concreteRegisterNodes.resize(this->numberOfRegisters);
+
+        /* The expressions, the variables and the memory pages come from the memory resource of the AST context */
+        this->memoryBitvector.mutate().setMemoryResource(this->astCtxt->getMemoryResource());
       }
 
 
@@ -50,24 +121,47 @@ namespace triton {
           astCtxt(other.astCtxt),
           modes(other.modes) {
 
-        this->alignedBitvectorMemory = other.alignedBitvectorMemory;
         this->architecture           = other.architecture;
+        this->budgetEvents           = other.budgetEvents;
+        this->budgetLevel            = other.budgetLevel;
+        this->budgetNodes            = other.budgetNodes;
+        this->budgetPolicy           = other.budgetPolicy;
         this->callbacks              = other.callbacks;
+        this->comments               = other.comments;
+        this->commentsThreshold      = other.commentsThreshold;
+        this->expressionIndexes      = other.expressionIndexes;
+        this->expressionsThreshold   = other.expressionsThreshold;
+        this->lazyRegisters          = other.lazyRegisters;
+        this->loopSummaries          = other.loopSummaries;
+        this->loopUnrollBound        = other.loopUnrollBound;
+        this->loops                  = other.loops;
         this->memoryArray            = other.memoryArray;
+        this->memoryArrayThreshold   = other.memoryArrayThreshold;
         this->memoryBitvector        = other.memoryBitvector;
         this->numberOfRegisters      = other.numberOfRegisters;
+        this->pointerResolutionBound = other.pointerResolutionBound;
+        this->pointerResolver        = other.pointerResolver;
+        this->subRegisterSlices      = other.subRegisterSlices;
         this->symbolicExpressions    = other.symbolicExpressions;
         this->symbolicReg            = other.symbolicReg;
         this->symbolicVariables      = other.symbolicVariables;
-        this->uniqueSymExprId        = other.uniqueSymExprId;
+        this->variableIndexes        = other.variableIndexes;
+        this->uniqueSymExprId        = other.uniqueSymExprId.load();
         this->uniqueSymVarId         = other.uniqueSymVarId;
+        this->variablesThreshold     = other.variablesThreshold;
+        this->recorder               = nullptr;
+        this->deferringFlags         = false;
+
+        this->concreteRegisterNodes.resize(this->numberOfRegisters);
       }
 
 
       SymbolicEngine::~SymbolicEngine() {
         /* See #828: Release ownership before calling container destructor */
+        this->journal = nullptr;
         this->memoryBitvector.clear();
         this->symbolicReg.clear();
+        this->concreteRegisterNodes.clear();
         this->memoryArray = nullptr;
       }
 
@@ -76,23 +170,294 @@ namespace triton {
         triton::engines::symbolic::SymbolicSimplification::operator=(other);
         triton::engines::symbolic::PathManager::operator=(other);
 
-        this->alignedBitvectorMemory = other.alignedBitvectorMemory;
         this->architecture           = other.architecture;
         this->astCtxt                = other.astCtxt;
+        this->budgetEvents           = other.budgetEvents;
+        this->budgetLevel            = other.budgetLevel;
+        this->budgetNodes            = other.budgetNodes;
+        this->budgetPolicy           = other.budgetPolicy;
         this->callbacks              = other.callbacks;
+        this->comments               = other.comments;
+        this->commentsThreshold      = other.commentsThreshold;
+        this->expressionIndexes      = other.expressionIndexes;
+        this->expressionsThreshold   = other.expressionsThreshold;
+        this->lazyRegisters          = other.lazyRegisters;
+        this->loopSummaries          = other.loopSummaries;
+        this->loopUnrollBound        = other.loopUnrollBound;
+        this->loops                  = other.loops;
         this->memoryBitvector        = other.memoryBitvector;
         this->modes                  = other.modes;
         this->numberOfRegisters      = other.numberOfRegisters;
+        this->pointerResolutionBound = other.pointerResolutionBound;
+        this->pointerResolver        = other.pointerResolver;
+        this->subRegisterSlices      = other.subRegisterSlices;
         this->symbolicExpressions    = other.symbolicExpressions;
         this->symbolicReg            = other.symbolicReg;
         this->symbolicVariables      = other.symbolicVariables;
-        this->uniqueSymExprId        = other.uniqueSymExprId;
+        this->variableIndexes        = other.variableIndexes;
+        this->uniqueSymExprId        = other.uniqueSymExprId.load();
         this->uniqueSymVarId         = other.uniqueSymVarId;
+        this->variablesThreshold     = other.variablesThreshold;
+
+        /* The effective addresses were built from the previous state, and the constant nodes may come from another AST context */
+        this->effectiveAddresses.clear();
+        this->concreteRegisterNodes.assign(this->numberOfRegisters, nullptr);
+
+        /* The journaled deltas do not apply to the new state */
+        if (this->journal)
+          this->journal->clear();
 
         return *this;
       }
 
 
+      void SymbolicEngine::copyState(const SymbolicEngine& other) {
+        triton::engines::symbolic::PathManager::operator=(other);
+
+        this->expressionIndexes      = other.expressionIndexes;
+        this->expressionsThreshold   = other.expressionsThreshold;
+        this->lazyRegisters          = other.lazyRegisters;
+        this->memoryArray            = other.memoryArray;
+        this->memoryArrayThreshold   = other.memoryArrayThreshold;
+        this->memoryBitvector        = other.memoryBitvector;
+        this->subRegisterSlices      = other.subRegisterSlices;
+        this->symbolicExpressions    = other.symbolicExpressions;
+        this->symbolicReg            = other.symbolicReg;
+        this->symbolicVariables      = other.symbolicVariables;
+        this->variableIndexes        = other.variableIndexes;
+        this->uniqueSymVarId         = other.uniqueSymVarId;
+        this->variablesThreshold     = other.variablesThreshold;
+
+        /* Never reuse an expression id, nodes of the previous state may still be alive */
+        this->uniqueSymExprId = std::max(this->uniqueSymExprId.load(), other.uniqueSymExprId.load());
+
+        /* The loops being executed belong to the previous trace */
+        this->loops.clear();
+
+        /* The journaled deltas do not apply to the new state */
+        if (this->journal)
+          this->journal->clear();
+      }
+
+
+      void SymbolicEngine::reset(void) {
+        /* The journal and the recorder refer to the dropped state */
+        this->journal  = nullptr;
+        this->recorder = nullptr;
+
+        /* The nodes of the dropped expressions go back to the arenas of the AST context */
+        this->concretizeAllRegister();
+        this->concretizeAllMemory();
+        this->clearPathConstraints();
+        this->stopSmtStream();
+
+        this->symbolicExpressions.clear();
+        this->symbolicVariables.clear();
+        this->comments.clear();
+        this->effectiveAddresses.clear();
+        this->budgetEvents.clear();
+        this->loopSummaries.clear();
+        this->loops.clear();
+        this->concreteRegisterNodes.assign(this->numberOfRegisters, nullptr);
+
+        /* The indexes keep their buckets */
+        auto& expressionIndexes = this->expressionIndexes.mutate();
+        expressionIndexes.tainted.clear();
+        expressionIndexes.addresses.clear();
+        for (auto& type : expressionIndexes.types)
+          type.clear();
+        expressionIndexes.taintedThreshold = 1024;
+        expressionIndexes.typesThresholds  = {{1024, 1024, 1024}};
+
+        auto& variableIndexes = this->variableIndexes.mutate();
+        variableIndexes.aliases.clear();
+        variableIndexes.origins.clear();
+        variableIndexes.aliasesThreshold = 1024;
+        variableIndexes.originsThreshold = 1024;
+
+        /* The ids start again, the counter of the variables may be shared with a fork */
+        this->uniqueSymExprId = 0;
+        if (this->uniqueSymVarId.use_count() > 1)
+          this->uniqueSymVarId = std::make_shared<std::atomic<triton::usize>>(0);
+        else
+          *this->uniqueSymVarId = 0;
+
+        /* The settings of a new engine */
+        this->deferringFlags         = false;
+        this->budgetNodes            = 0;
+        this->budgetLevel            = 0;
+        this->budgetPolicy           = BUDGET_CONCRETIZE;
+        this->loopUnrollBound        = 16;
+        this->pointerResolutionBound = 16;
+        this->commentsThreshold      = 1024;
+        this->expressionsThreshold   = 1024;
+        this->memoryArrayThreshold   = 1024;
+        this->variablesThreshold     = 1024;
+        this->setPathConstraintsWindow(0);
+      }
+
+
+      void SymbolicEngine::saveState(std::ostream& stream) {
+        std::vector<SharedSymbolicExpression> exprs;
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+        std::vector<triton::uint64> registers;
+        std::vector<triton::uint64> cells;
+
+        /* The deferred registers cannot be written */
+        this->materializeLazyRegisters(true);
+
+        for (triton::uint32 id = 0; id < this->numberOfRegisters; id++) {
+          if (this->symbolicReg[id] != nullptr) {
+            registers.push_back(id);
+            exprs.push_back(this->symbolicReg[id]);
+          }
+        }
+
+        this->memoryBitvector->forEachCell([&](triton::uint64 addr, const SharedSymbolicExpression& expr) {
+          cells.push_back(addr);
+          exprs.push_back(expr);
+          return true;
+        });
+
+        if (this->memoryArray != nullptr)
+          exprs.push_back(this->memoryArray);
+
+        writeWord(stream, this->uniqueSymExprId.load());
+        writeWord(stream, this->uniqueSymVarId->load());
+
+        writeWord(stream, registers.size());
+        for (triton::uint64 id : registers)
+          writeWord(stream, id);
+
+        writeWord(stream, cells.size());
+        for (triton::uint64 addr : cells)
+          writeWord(stream, addr);
+
+        writeWord(stream, this->memoryArray != nullptr);
+
+        /* The path constraints, their predicates being written with the expressions */
+        writeWord(stream, this->pathConstraints->size());
+        for (const auto& pco : *this->pathConstraints) {
+          writeWord(stream, pco.getThreadId());
+          writeWord(stream, pco.getComment().size());
+          stream.write(pco.getComment().data(), static_cast<std::streamsize>(pco.getComment().size()));
+          writeWord(stream, pco.getBranchConstraints().size());
+          for (const auto& branch : pco.getBranchConstraints()) {
+            writeWord(stream, std::get<0>(branch));
+            writeWord(stream, std::get<1>(branch));
+            writeWord(stream, std::get<2>(branch));
+            nodes.push_back(std::get<3>(branch));
+          }
+        }
+
+        triton::ast::serialize(stream, nodes, exprs);
+      }
+
+
+      void SymbolicEngine::loadState(std::istream& stream) {
+        std::vector<SharedSymbolicExpression> exprs;
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+        std::vector<triton::engines::symbolic::PathConstraint> pcs;
+
+        triton::usize exprId = readWord(stream);
+        triton::usize varId  = readWord(stream);
+
+        std::vector<triton::uint64> registers(readWord(stream));
+        for (auto& id : registers) {
+          id = readWord(stream);
+          if (id >= this->numberOfRegisters)
+            throw triton::exceptions::SymbolicEngine("SymbolicEngine::loadState(): Invalid register.");
+        }
+
+        std::vector<triton::uint64> cells(readWord(stream));
+        for (auto& addr : cells)
+          addr = readWord(stream);
+
+        bool array = (readWord(stream) != 0);
+
+        std::vector<std::tuple<bool, triton::uint64, triton::uint64>> branches;
+        std::vector<triton::usize> ends;
+        pcs.resize(readWord(stream));
+        for (auto& pco : pcs) {
+          pco.setThreadId(static_cast<triton::uint32>(readWord(stream)));
+          std::string comment(readWord(stream), '\0');
+          if (!stream.read(&comment[0], static_cast<std::streamsize>(comment.size())))
+            throw triton::exceptions::SymbolicEngine("SymbolicEngine::loadState(): Truncated state.");
+          pco.setComment(comment);
+          for (auto count = readWord(stream); count > 0; count--) {
+            bool taken          = (readWord(stream) != 0);
+            triton::uint64 src  = readWord(stream);
+            triton::uint64 dst  = readWord(stream);
+            branches.emplace_back(taken, src, dst);
+          }
+          ends.push_back(branches.size());
+        }
+
+        triton::ast::deserialize(stream, this->astCtxt, nodes, exprs);
+        if (exprs.size() != registers.size() + cells.size() + array || nodes.size() != branches.size())
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::loadState(): Invalid state.");
+
+        /* The previous state is dropped */
+        this->concretizeAllRegister();
+        this->concretizeAllMemory();
+        this->clearPathConstraints();
+        this->loops.clear();
+        this->effectiveAddresses.clear();
+        if (this->journal)
+          this->journal->clear();
+
+        /* The expressions and the variables of the DAG are known by their ids */
+        std::vector<triton::ast::SharedAbstractNode> roots = nodes;
+        for (const auto& expr : exprs) {
+          this->symbolicExpressions.mutate()[expr->getId()] = expr;
+          this->indexSymbolicExpression(expr);
+          roots.push_back(expr->getAst());
+        }
+
+        for (const auto& node : triton::ast::childrenExtraction(roots, true, false)) {
+          if (node->getType() == triton::ast::REFERENCE_NODE) {
+            const auto& expr = reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression();
+            this->symbolicExpressions.mutate()[expr->getId()] = expr;
+            this->indexSymbolicExpression(expr);
+          }
+          else if (node->getType() == triton::ast::VARIABLE_NODE) {
+            const auto& var = reinterpret_cast<triton::ast::VariableNode*>(node.get())->getSymbolicVariable();
+            this->symbolicVariables.mutate()[var->getId()] = var;
+            this->indexSymbolicVariable(var);
+          }
+        }
+
+        triton::usize index = 0;
+        for (triton::uint64 id : registers) {
+          const auto& expr = exprs[index++];
+          expr->setOriginRegister(this->architecture->getRegister(static_cast<triton::arch::register_e>(id)));
+          this->symbolicReg[id] = expr;
+        }
+
+        for (triton::uint64 addr : cells) {
+          const auto& expr = exprs[index++];
+          if (expr->getOriginMemory().getAddress() == 0 && expr->getOriginMemory().getSize() == 0)
+            expr->setOriginMemory(triton::arch::MemoryAccess(addr, triton::size::byte));
+          this->memoryBitvector.mutate().setCell(addr, expr);
+        }
+
+        if (array)
+          this->memoryArray = exprs[index++];
+
+        /* The path is restored as saved, neither deduplicated nor summarized again */
+        index = 0;
+        for (triton::usize i = 0; i < pcs.size(); i++) {
+          for (; index < ends[i]; index++)
+            pcs[i].addBranchConstraint(std::get<0>(branches[index]), std::get<1>(branches[index]), std::get<2>(branches[index]), nodes[index]);
+          this->pathConstraints.mutate().push_back(pcs[i]);
+        }
+
+        /* Never reuse an expression or a variable id */
+        this->uniqueSymExprId = std::max(this->uniqueSymExprId.load(), exprId);
+        *this->uniqueSymVarId = std::max(this->uniqueSymVarId->load(), varId);
+      }
+
+
       /*
        * Concretize a register. If the register is setup as nullptr, the next assignment
        * will be over the concretization. This method must be called before symbolic
@@ -102,15 +467,21 @@ namespace triton {
         triton::arch::register_e parentId = reg.getParent();
 
         if (this->architecture->isRegisterValid(parentId)) {
-          this->symbolicReg[parentId] = nullptr;
+          this->journalRegister(this->architecture->getRegister(parentId));
+          this->lazyRegisters.erase(parentId);
+          this->subRegisterSlices.erase(parentId);
+          /* Moved out, so the entry is null */
+          this->astCtxt->reclaim(std::move(this->symbolicReg[parentId]));
         }
       }
 
 
       /* Same as concretizeRegister but with all registers */
       void SymbolicEngine::concretizeAllRegister(void) {
+        this->lazyRegisters.clear();
+        this->subRegisterSlices.clear();
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
-          this->symbolicReg[i] = nullptr;
+          this->astCtxt->reclaim(std::move(this->symbolicReg[i]));
         }
       }
 
@@ -145,31 +516,56 @@ namespace triton {
         }
 
         /* Symbolic bitvector */
-        this->memoryBitvector.erase(addr);
+        if (this->memoryBitvector->getCell(addr) != nullptr)
+          this->memoryBitvector.mutate().removeCell(addr);
         this->removeAlignedMemory(addr, triton::size::byte);
       }
 
 
       /* Same as concretizeMemory but with all address memory */
       void SymbolicEngine::concretizeAllMemory(void) {
-        this->memoryArray = nullptr;          /* abv logic */
-        this->memoryBitvector.clear();        /* bv logic  */
-        this->alignedBitvectorMemory.clear(); /* bv optim  */
-      }
-
+        this->memoryArray = nullptr;   /* abv logic */
+        this->memoryBitvector.clear(); /* bv logic and optim */
 
-      /* Gets an aligned entry. */
-      const SharedSymbolicExpression& SymbolicEngine::getAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        return this->alignedBitvectorMemory[std::make_pair(address, size)];
+        /* A shared memory is released, not cleared */
+        this->memoryBitvector.mutate().setMemoryResource(this->astCtxt->getMemoryResource());
       }
 
 
-      /* Checks if the aligned memory is recored. */
-      bool SymbolicEngine::isAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        if (this->alignedBitvectorMemory.find(std::make_pair(address, size)) != this->alignedBitvectorMemory.end()) {
-          return true;
+      /*
+       * Reads a load from the aligned entries. The part of the load in an entry is
+       * one extraction of its AST, so a load of the size of a store gets the AST
+       * of the store, a narrower load one extraction and a wider load one
+       * concatenation of the entries. The bytes out of the entries are read one by
+       * one, the most significant first.
+       */
+      triton::ast::SharedAbstractNode SymbolicEngine::getAlignedMemoryAst(triton::uint64 address, triton::uint32 size, const triton::uint8* raw) {
+        std::vector<triton::ast::SharedAbstractNode> parts;
+        triton::uint32 top = size;
+
+        while (top) {
+          triton::uint64 start  = 0;
+          triton::uint32 length = 0;
+
+          const SharedSymbolicExpression& aligned = this->memoryBitvector->findInterval(address + top - 1, start, length);
+          if (aligned) {
+            /* The bytes [offset, offset + count) of the entry are loaded */
+            triton::uint64 first  = std::max(start, address);
+            triton::uint32 count  = static_cast<triton::uint32>(address + top - first);
+            triton::uint32 offset = static_cast<triton::uint32>(first - start);
+
+            parts.push_back(this->astCtxt->extract(((offset + count) * bitsize::byte) - 1, offset * bitsize::byte, aligned->getAst()));
+            top -= count;
+          }
+          else {
+            const SharedSymbolicExpression& symMem = this->getSymbolicMemory(address + top - 1);
+            if (symMem) parts.push_back(this->astCtxt->reference(symMem));
+            else        parts.push_back(this->astCtxt->bv(raw[top - 1], bitsize::byte));
+            top--;
+          }
         }
-        return false;
+
+        return this->astCtxt->concat(parts);
       }
 
 
@@ -177,7 +573,7 @@ namespace triton {
       void SymbolicEngine::addAlignedMemory(triton::uint64 address, triton::uint32 size, const SharedSymbolicExpression& expr) {
         this->removeAlignedMemory(address, size);
         if (!(this->modes->isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED) && expr->getAst()->isSymbolized() == false)) {
-          this->alignedBitvectorMemory[std::make_pair(address, size)] = expr;
+          this->memoryBitvector.mutate().setInterval(address, size, expr);
         }
       }
 
@@ -185,57 +581,32 @@ namespace triton {
       /* Removes an aligned memory */
       void SymbolicEngine::removeAlignedMemory(triton::uint64 address, triton::uint32 size) {
         /*
-         * Avoid accessing the alignedBitvectorMemory array when empty. This usually happens when
+         * Avoid copying a shared memory when there is no aligned entry. This usually happens when
          * you initialize the symbolic engine and concretize whole sections of an executable using
-         * setConcreteMemoryValue. No symbolic memory has been created yet but this function will
-         * still try to rougly erase (size * 7) elements.
+         * setConcreteMemoryValue.
          */
-        if (this->alignedBitvectorMemory.empty())
+        if (!this->memoryBitvector->hasIntervals())
           return;
 
         /* Do nothing if we are in array mode */
         if (this->isArrayMode())
           return;
 
-        /* Remove overloaded positive ranges */
-        for (triton::uint32 index = 0; index < size; index++) {
-          this->alignedBitvectorMemory.erase(std::make_pair(address+index, triton::size::byte));
-          this->alignedBitvectorMemory.erase(std::make_pair(address+index, triton::size::word));
-          this->alignedBitvectorMemory.erase(std::make_pair(address+index, triton::size::dword));
-          this->alignedBitvectorMemory.erase(std::make_pair(address+index, triton::size::qword));
-          this->alignedBitvectorMemory.erase(std::make_pair(address+index, triton::size::fword));
-          this->alignedBitvectorMemory.erase(std::make_pair(address+index, triton::size::dqword));
-          this->alignedBitvectorMemory.erase(std::make_pair(address+index, triton::size::qqword));
-          this->alignedBitvectorMemory.erase(std::make_pair(address+index, triton::size::dqqword));
-        }
-
-        /* Remove overloaded negative ranges */
-        for (triton::uint32 index = 1; index < triton::size::dqqword; index++) {
-          if (index < triton::size::word)    this->alignedBitvectorMemory.erase(std::make_pair(address-index, triton::size::word));
-          if (index < triton::size::dword)   this->alignedBitvectorMemory.erase(std::make_pair(address-index, triton::size::dword));
-          if (index < triton::size::qword)   this->alignedBitvectorMemory.erase(std::make_pair(address-index, triton::size::qword));
-          if (index < triton::size::fword)   this->alignedBitvectorMemory.erase(std::make_pair(address-index, triton::size::fword));
-          if (index < triton::size::dqword)  this->alignedBitvectorMemory.erase(std::make_pair(address-index, triton::size::dqword));
-          if (index < triton::size::qqword)  this->alignedBitvectorMemory.erase(std::make_pair(address-index, triton::size::qqword));
-          if (index < triton::size::dqqword) this->alignedBitvectorMemory.erase(std::make_pair(address-index, triton::size::dqqword));
-        }
+        /* Remove the entries overlapping the area */
+        this->memoryBitvector.mutate().removeIntervals(address, size);
       }
 
 
       /* Returns the reference memory if it's referenced otherwise returns nullptr */
       SharedSymbolicExpression SymbolicEngine::getSymbolicMemory(triton::uint64 addr) const {
-        auto it = this->memoryBitvector.find(addr);
-        if (it != this->memoryBitvector.end()) {
-          return it->second;
-        }
-        return nullptr;
+        return this->memoryBitvector->getCell(addr);
       }
 
 
       /* Returns the symbolic variable otherwise raises an exception */
       SharedSymbolicVariable SymbolicEngine::getSymbolicVariable(triton::usize symVarId) const {
-        auto it = this->symbolicVariables.find(symVarId);
-        if (it == this->symbolicVariables.end()) {
+        auto it = this->symbolicVariables->find(symVarId);
+        if (it == this->symbolicVariables->end()) {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicVariable(): Unregistred symbolic variable.");
         }
 
@@ -247,23 +618,63 @@ namespace triton {
       }
 
 
-      /* Returns the symbolic variable otherwise returns nullptr */
+      void SymbolicEngine::indexSymbolicVariable(const SharedSymbolicVariable& var) {
+        VariableIndexes& indexes = this->variableIndexes.mutate();
+
+        if (!var->getAlias().empty()) {
+          indexes.aliases.emplace(var->getAlias(), var);
+          removeExpiredEntries(indexes.aliases, indexes.aliasesThreshold);
+        }
+
+        if (var->getType() != UNDEFINED_VARIABLE) {
+          indexes.origins.emplace(var->getOrigin(), var);
+          removeExpiredEntries(indexes.origins, indexes.originsThreshold);
+        }
+      }
+
+
+      /* Returns the symbolic variable otherwise raises an exception */
       SharedSymbolicVariable SymbolicEngine::getSymbolicVariable(const std::string& name) const {
-        /*
-         * FIXME: 1) When there is a ton of symvar, this loop takes a while to go through.
-         *           What about adding two maps {id:symvar} and {string:symvar}? See #648.
-         *
-         *        2) If we are looking for alias, we return the first occurrence. It's not
-         *           ideal if we have multiple same aliases.
-         */
-        for (auto& sv: this->symbolicVariables) {
-          if (auto symVar = sv.second.lock()) {
-            if (symVar->getName() == name || symVar->getAlias() == name) {
+        SharedSymbolicVariable found = nullptr;
+
+        /* The names are made of the ids */
+        const std::string prefix = TRITON_SYMVAR_NAME;
+        if (name.size() > prefix.size() && name.size() - prefix.size() < 20 && name.compare(0, prefix.size(), prefix) == 0 &&
+            name.find_first_not_of("0123456789", prefix.size()) == std::string::npos) {
+          auto it = this->symbolicVariables->find(std::stoull(name.substr(prefix.size())));
+          if (it != this->symbolicVariables->end()) {
+            auto symVar = it->second.lock();
+            if (symVar && symVar->getName() == name)
               return symVar;
-            }
           }
         }
-        throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicVariable(): Unregistred or dead symbolic variable.");
+
+        /* The alias of a variable may have changed since its creation */
+        auto range = this->variableIndexes->aliases.equal_range(name);
+        for (auto it = range.first; it != range.second; it++) {
+          auto symVar = it->second.lock();
+          if (symVar && symVar->getAlias() == name && (found == nullptr || symVar->getId() < found->getId()))
+            found = symVar;
+        }
+
+        if (found)
+          return found;
+
+        /* An alias given after the creation of its variable is only found by a scan, then indexed */
+        for (auto& sv: this->symbolicVariables.get()) {
+          if (auto symVar = sv.second.lock()) {
+            if ((symVar->getName() == name || symVar->getAlias() == name) && (found == nullptr || symVar->getId() < found->getId()))
+              found = symVar;
+          }
+        }
+
+        if (found == nullptr)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicVariable(): Unregistred or dead symbolic variable.");
+
+        if (found->getAlias() == name)
+          this->variableIndexes.mutate().aliases.emplace(name, found);
+
+        return found;
       }
 
 
@@ -273,7 +684,7 @@ namespace triton {
         std::map<triton::usize, SharedSymbolicVariable> ret;
         std::vector<triton::usize> toRemove;
 
-        for (auto& kv : this->symbolicVariables) {
+        for (auto& kv : this->symbolicVariables.get()) {
           if (auto sp = kv.second.lock()) {
             ret[kv.first] = sp;
           } else {
@@ -282,7 +693,34 @@ namespace triton {
         }
 
         for (triton::usize id : toRemove) {
-          this->symbolicVariables.erase(id);
+          this->symbolicVariables.mutate().erase(id);
+        }
+
+        return ret;
+      }
+
+
+      std::map<triton::usize, SharedSymbolicVariable> SymbolicEngine::getSymbolicVariables(triton::engines::symbolic::variable_e type) const {
+        std::map<triton::usize, SharedSymbolicVariable> ret;
+
+        for (const auto& kv : this->symbolicVariables.get()) {
+          auto sp = kv.second.lock();
+          if (sp && sp->getType() == type)
+            ret[kv.first] = sp;
+        }
+
+        return ret;
+      }
+
+
+      std::map<triton::usize, SharedSymbolicVariable> SymbolicEngine::getSymbolicVariables(triton::engines::symbolic::variable_e type, triton::uint64 origin) const {
+        std::map<triton::usize, SharedSymbolicVariable> ret;
+
+        auto range = this->variableIndexes->origins.equal_range(origin);
+        for (auto it = range.first; it != range.second; it++) {
+          auto sp = it->second.lock();
+          if (sp && sp->getType() == type)
+            ret[sp->getId()] = sp;
         }
 
         return ret;
@@ -367,7 +805,12 @@ namespace triton {
       /* Get an unique id.
        * Mainly used when a new symbolic expression is created */
       triton::usize SymbolicEngine::getUniqueSymExprId(void) {
-        return this->uniqueSymExprId++;
+        return this->uniqueSymExprId.fetch_add(1, std::memory_order_relaxed);
+      }
+
+
+      triton::usize SymbolicEngine::getNextSymbolicExpressionId(void) const {
+        return this->uniqueSymExprId;
       }
 
 
@@ -375,7 +818,7 @@ namespace triton {
       /* Get an unique id.
        * Mainly used when a new symbolic variable is created */
       triton::usize SymbolicEngine::getUniqueSymVarId(void) {
-        return this->uniqueSymVarId++;
+        return this->uniqueSymVarId->fetch_add(1, std::memory_order_relaxed);
       }
 
 
@@ -385,12 +828,53 @@ namespace triton {
           triton::uint32 gpr_size = this->architecture->gprBitSize();
           this->memoryArray = this->newSymbolicExpression(this->astCtxt->array(gpr_size), VOLATILE_EXPRESSION);
         }
+
+        /* Each store adds a level, keep the chain bounded by the number of stored addresses */
+        if (this->memoryArray && this->memoryArray->getAst()->getLevel() >= this->memoryArrayThreshold) {
+          if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS))
+            this->compactMemoryArray();
+        }
+
         return this->memoryArray;
       }
 
 
+      /*
+       * The stores to concrete indexes commute, so the stores down to the first symbolic
+       * index can be replayed with only the last one of each index.
+       */
+      void SymbolicEngine::compactMemoryArray(void) {
+        std::vector<triton::ast::SharedAbstractNode> stores;
+        std::unordered_set<triton::uint64> indexes;
+        triton::usize length = 0;
+
+        triton::ast::SharedAbstractNode base = triton::ast::dereference(this->memoryArray->getAst());
+        while (base->getType() == triton::ast::STORE_NODE && !base->getChildren()[1]->isSymbolized()) {
+          if (indexes.insert(static_cast<triton::uint64>(base->getChildren()[1]->evaluate())).second)
+            stores.push_back(base);
+          base = triton::ast::dereference(base->getChildren()[0]);
+          length++;
+        }
+
+        if (stores.size() < length) {
+          triton::ast::SharedAbstractNode array = base;
+          for (auto it = stores.rbegin(); it != stores.rend(); it++) {
+            const auto& children = (*it)->getChildren();
+            triton::uint64 index = static_cast<triton::uint64>(children[1]->evaluate());
+            this->memoryArray = this->newSymbolicExpression(this->astCtxt->store(array, children[1], children[2]), MEMORY_EXPRESSION, "Compacted memory");
+            this->memoryArray->setOriginMemory(triton::arch::MemoryAccess(index, triton::size::byte));
+            array = this->astCtxt->reference(this->memoryArray);
+          }
+        }
+
+        this->memoryArrayThreshold = std::max<triton::uint32>(1024, this->memoryArray->getAst()->getLevel() * 2);
+      }
+
+
       /* Creates a new symbolic expression with comment */
       SharedSymbolicExpression SymbolicEngine::newSymbolicExpression(const triton::ast::SharedAbstractNode& node, triton::engines::symbolic::expression_e type, const std::string& comment) {
+        TRITON_TRACE("symbolic", "SymbolicEngine::newSymbolicExpression");
+
         if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
           /*
            * Create volatile expression for extended part to avoid long
@@ -414,20 +898,44 @@ namespace triton {
         const triton::ast::SharedAbstractNode& snode = this->simplify(node);
 
         /* Allocates the new shared symbolic expression */
-        SharedSymbolicExpression expr = std::make_shared<SymbolicExpression>(snode, id, type, comment);
+        SharedSymbolicExpression expr = triton::utils::allocateShared<SymbolicExpression>(this->astCtxt->getMemoryResource(), snode, id, type);
         if (expr == nullptr) {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicExpression(): not enough memory");
         }
+        expr->setComment(this->internComment(comment));
 
         /* Save and returns the new shared symbolic expression */
-        this->symbolicExpressions[id] = expr;
+        this->symbolicExpressions.mutate()[id] = expr;
+        removeExpiredEntries(this->symbolicExpressions, this->expressionsThreshold);
+        this->indexSymbolicExpression(expr);
+
+        if (this->smtStream)
+          this->streamExpression(expr);
+
         return expr;
       }
 
 
+      /* Returns the shared copy of a comment, the semantics use the same few comments for every instruction */
+      std::shared_ptr<const std::string> SymbolicEngine::internComment(const std::string& comment) {
+        if (comment.empty())
+          return nullptr;
+
+        auto& entry = this->comments[comment];
+        std::shared_ptr<const std::string> shared = entry.lock();
+        if (shared == nullptr) {
+          shared = std::make_shared<const std::string>(comment);
+          entry  = shared;
+          removeExpiredEntries(this->comments, this->commentsThreshold);
+        }
+
+        return shared;
+      }
+
+
       /* Removes the symbolic expression corresponding to the id */
       void SymbolicEngine::removeSymbolicExpression(const SharedSymbolicExpression& expr) {
-        if (this->symbolicExpressions.find(expr->getId()) != this->symbolicExpressions.end()) {
+        if (this->symbolicExpressions->find(expr->getId()) != this->symbolicExpressions->end()) {
           /* Concretize memory */
           if (expr->getType() == MEMORY_EXPRESSION) {
             const auto& mem = expr->getOriginMemory();
@@ -441,15 +949,20 @@ namespace triton {
           }
 
           /* Delete and remove the pointer */
-          this->symbolicExpressions.erase(expr->getId());
+          this->symbolicExpressions.mutate().erase(expr->getId());
+
+          /* The index by address checks the expressions when queried */
+          ExpressionIndexes& indexes = this->expressionIndexes.mutate();
+          indexes.tainted.erase(expr->getId());
+          indexes.types[expr->getType()].erase(expr->getId());
         }
       }
 
 
       /* Gets the shared symbolic expression from a symbolic id */
       SharedSymbolicExpression SymbolicEngine::getSymbolicExpression(triton::usize symExprId) const {
-        auto it = this->symbolicExpressions.find(symExprId);
-        if (it == this->symbolicExpressions.end()) {
+        auto it = this->symbolicExpressions->find(symExprId);
+        if (it == this->symbolicExpressions->end()) {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicExpression(): symbolic expression id not found");
         }
 
@@ -457,7 +970,7 @@ namespace triton {
           return sp;
         }
 
-        this->symbolicExpressions.erase(symExprId);
+        this->symbolicExpressions.mutate().erase(symExprId);
         throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicExpression(): symbolic expression is not available anymore");
       }
 
@@ -468,7 +981,7 @@ namespace triton {
         std::unordered_map<triton::usize, SharedSymbolicExpression> ret;
         std::vector<triton::usize> toRemove;
 
-        for (auto& kv : this->symbolicExpressions) {
+        for (auto& kv : this->symbolicExpressions.get()) {
           if (auto sp = kv.second.lock()) {
             ret[kv.first] = sp;
           } else {
@@ -477,58 +990,204 @@ namespace triton {
         }
 
         for (auto id : toRemove)
-          this->symbolicExpressions.erase(id);
+          this->symbolicExpressions.mutate().erase(id);
 
         return ret;
       }
 
 
+      triton::ast::SsaTrace SymbolicEngine::getSsaTrace(void) const {
+        std::vector<SharedSymbolicExpression> exprs;
+
+        this->forEachSymbolicExpression([&](const SharedSymbolicExpression& expr) {
+          exprs.push_back(expr);
+          return true;
+        });
+
+        std::sort(exprs.begin(), exprs.end(), [](const SharedSymbolicExpression& a, const SharedSymbolicExpression& b) {
+          return a->getId() < b->getId();
+        });
+
+        return triton::ast::SsaTrace(exprs);
+      }
+
+
+      bool SymbolicEngine::forEachSymbolicExpression(const std::function<bool(const SharedSymbolicExpression&)>& fn) const {
+        for (const auto& kv : this->symbolicExpressions.get()) {
+          if (auto sp = kv.second.lock()) {
+            if (fn(sp) == false)
+              return false;
+          }
+        }
+        return true;
+      }
+
+
+      bool SymbolicEngine::forEachSymbolicVariable(const std::function<bool(const SharedSymbolicVariable&)>& fn) const {
+        for (const auto& kv : this->symbolicVariables.get()) {
+          if (auto sp = kv.second.lock()) {
+            if (fn(sp) == false)
+              return false;
+          }
+        }
+        return true;
+      }
+
+
       /* Slices all expressions from a given one */
       std::unordered_map<triton::usize, SharedSymbolicExpression> SymbolicEngine::sliceExpressions(const SharedSymbolicExpression& expr) {
-        std::unordered_map<triton::usize, SharedSymbolicExpression> exprs;
-
         if (expr == nullptr) {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::sliceExpressions(): expr cannot be null.");
         }
 
-        exprs[expr->getId()] = expr;
+        return this->sliceExpressions(std::vector<SharedSymbolicExpression>{expr});
+      }
+
+
+      /* Slices all expressions from given ones, each expression is visited once */
+      std::unordered_map<triton::usize, SharedSymbolicExpression> SymbolicEngine::sliceExpressions(const std::vector<SharedSymbolicExpression>& exprs) {
+        std::unordered_map<triton::usize, SharedSymbolicExpression> slice;
+        std::vector<SharedSymbolicExpression> worklist;
+        std::vector<triton::ast::AbstractNode*> nodes;
+        triton::ast::VisitedNodes visited(this->astCtxt);
+
+        for (const auto& expr : exprs) {
+          if (expr == nullptr)
+            throw triton::exceptions::SymbolicEngine("SymbolicEngine::sliceExpressions(): expr cannot be null.");
+          if (slice.emplace(expr->getId(), expr).second)
+            worklist.push_back(expr);
+        }
+
+        /* The AST of an expression is walked up to the references, which are walked once */
+        while (!worklist.empty()) {
+          SharedSymbolicExpression current = std::move(worklist.back());
+          worklist.pop_back();
+
+          nodes.push_back(current->getAst().get());
+          while (!nodes.empty()) {
+            triton::ast::AbstractNode* node = nodes.back();
+            nodes.pop_back();
+
+            if (!visited.insert(node))
+              continue;
+
+            if (node->getType() == triton::ast::REFERENCE_NODE) {
+              const auto& ref = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getSymbolicExpression();
+              if (slice.emplace(ref->getId(), ref).second)
+                worklist.push_back(ref);
+              continue;
+            }
 
-        auto worklist = triton::ast::childrenExtraction(expr->getAst(), true /* unroll */, false /* revert */);
-        for (auto&& n : worklist) {
-          if (n->getType() == triton::ast::REFERENCE_NODE) {
-            auto expr  = reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression();
-            auto eid   = expr->getId();
-            exprs[eid] = expr;
+            for (const auto& child : node->getChildren())
+              nodes.push_back(child.get());
           }
         }
 
-        return exprs;
+        return slice;
       }
 
 
       /* Returns a list which contains all tainted expressions */
+      void SymbolicEngine::indexSymbolicExpression(const SharedSymbolicExpression& expr) {
+        ExpressionIndexes& indexes = this->expressionIndexes.mutate();
+        triton::uint32 type = expr->getType();
+
+        indexes.types[type][expr->getId()] = expr;
+        removeExpiredEntries(indexes.types[type], indexes.typesThresholds[type]);
+
+        if (expr->isTainted) {
+          indexes.tainted[expr->getId()] = expr;
+          removeExpiredEntries(indexes.tainted, indexes.taintedThreshold);
+        }
+      }
+
+
+      void SymbolicEngine::indexSymbolicExpressions(const triton::arch::Instruction& inst) {
+        if (inst.symbolicExpressions.empty())
+          return;
+
+        ExpressionIndexes& indexes = this->expressionIndexes.mutate();
+        std::vector<WeakSymbolicExpression>& exprs = indexes.addresses[inst.getAddress()];
+
+        /* The previous executions of a loop leave dead expressions */
+        exprs.erase(std::remove_if(exprs.begin(), exprs.end(), [](const WeakSymbolicExpression& e) { return e.expired(); }), exprs.end());
+
+        for (const auto& expr : inst.symbolicExpressions) {
+          exprs.push_back(expr);
+          if (expr->isTainted) {
+            indexes.tainted[expr->getId()] = expr;
+          }
+        }
+
+        removeExpiredEntries(indexes.tainted, indexes.taintedThreshold);
+      }
+
+
       std::vector<SharedSymbolicExpression> SymbolicEngine::getTaintedSymbolicExpressions(void) const {
         std::vector<SharedSymbolicExpression> taintedExprs;
         std::vector<triton::usize> invalidSymExpr;
 
-        for (auto it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end(); it++) {
-          if (auto sp = it->second.lock()) {
-            if (sp->isTainted) {
-              taintedExprs.push_back(sp);
-            }
-          } else {
-            invalidSymExpr.push_back(it->first);
-          }
+        /* The taint of an expression may have been cleared since it was indexed */
+        for (const auto& kv : this->expressionIndexes->tainted) {
+          auto sp = kv.second.lock();
+          if (sp && sp->isTainted)
+            taintedExprs.push_back(sp);
+          else
+            invalidSymExpr.push_back(kv.first);
         }
 
-        for (auto id : invalidSymExpr) {
-          this->symbolicExpressions.erase(id);
+        if (!invalidSymExpr.empty()) {
+          ExpressionIndexes& indexes = this->expressionIndexes.mutate();
+          for (auto id : invalidSymExpr)
+            indexes.tainted.erase(id);
         }
 
         return taintedExprs;
       }
 
 
+      std::unordered_map<triton::usize, SharedSymbolicExpression> SymbolicEngine::getSymbolicExpressions(triton::engines::symbolic::expression_e type) const {
+        std::unordered_map<triton::usize, SharedSymbolicExpression> ret;
+        std::vector<triton::usize> toRemove;
+
+        if (type != MEMORY_EXPRESSION && type != REGISTER_EXPRESSION && type != VOLATILE_EXPRESSION)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicExpressions(): Invalid type of expression.");
+
+        for (const auto& kv : this->expressionIndexes->types[type]) {
+          if (auto sp = kv.second.lock())
+            ret[kv.first] = sp;
+          else
+            toRemove.push_back(kv.first);
+        }
+
+        if (!toRemove.empty()) {
+          ExpressionIndexes& indexes = this->expressionIndexes.mutate();
+          for (auto id : toRemove)
+            indexes.types[type].erase(id);
+        }
+
+        return ret;
+      }
+
+
+      std::vector<SharedSymbolicExpression> SymbolicEngine::getSymbolicExpressionsAt(triton::uint64 address) const {
+        std::vector<SharedSymbolicExpression> ret;
+
+        auto it = this->expressionIndexes->addresses.find(address);
+        if (it == this->expressionIndexes->addresses.end())
+          return ret;
+
+        /* A removed expression may still be alive */
+        for (const auto& e : it->second) {
+          auto sp = e.lock();
+          if (sp && this->symbolicExpressions->find(sp->getId()) != this->symbolicExpressions->end())
+            ret.push_back(sp);
+        }
+
+        return ret;
+      }
+
+
       /* Returns the map of symbolic registers defined */
       std::unordered_map<triton::arch::register_e, SharedSymbolicExpression> SymbolicEngine::getSymbolicRegisters(void) const {
         std::unordered_map<triton::arch::register_e, SharedSymbolicExpression> ret;
@@ -543,9 +1202,35 @@ namespace triton {
       }
 
 
+      /* Returns the view of the symbolic registers */
+      const std::vector<SharedSymbolicExpression>& SymbolicEngine::getSymbolicRegisterArray(void) const {
+        return this->symbolicReg;
+      }
+
+
+      bool SymbolicEngine::forEachSymbolicRegister(const std::function<bool(triton::arch::register_e, const SharedSymbolicExpression&)>& fn) const {
+        for (triton::uint32 it = 0; it < this->numberOfRegisters; it++) {
+          if (this->symbolicReg[it] != nullptr && fn(triton::arch::register_e(it), this->symbolicReg[it]) == false)
+            return false;
+        }
+        return true;
+      }
+
+
+      bool SymbolicEngine::forEachSymbolicMemory(const std::function<bool(triton::uint64, const SharedSymbolicExpression&)>& fn) const {
+        return this->memoryBitvector->forEachCell(fn);
+      }
+
+
       /* Returns the map of symbolic memory defined */
-      const std::unordered_map<triton::uint64, SharedSymbolicExpression>& SymbolicEngine::getSymbolicMemory(void) const {
-        return this->memoryBitvector;
+      std::unordered_map<triton::uint64, SharedSymbolicExpression> SymbolicEngine::getSymbolicMemory(void) const {
+        return this->memoryBitvector->getCells();
+      }
+
+
+      /* Returns the addresses of the symbolic memory defined in an area */
+      std::vector<triton::uint64> SymbolicEngine::getSymbolicMemoryAddresses(triton::uint64 baseAddr, triton::uint64 size) const {
+        return this->memoryBitvector->getAddresses(baseAddr, size);
       }
 
 
@@ -579,6 +1264,25 @@ namespace triton {
       }
 
 
+      std::vector<SharedSymbolicVariable> SymbolicEngine::symbolizeBuffer(triton::uint64 addr, triton::usize size, const std::string& symVarAlias) {
+        std::vector<SharedSymbolicVariable> buffer;
+        triton::usize offset = 0;
+
+        /* A variable per chunk, of the widest access fitting the rest of the buffer */
+        while (offset != size) {
+          triton::uint32 chunk = triton::size::max_supported;
+          while (chunk > size - offset)
+            chunk >>= 1;
+
+          std::string alias = symVarAlias.empty() ? "" : symVarAlias + "_" + std::to_string(buffer.size());
+          buffer.push_back(this->symbolizeMemory(triton::arch::MemoryAccess(addr + offset, chunk), alias));
+          offset += chunk;
+        }
+
+        return buffer;
+      }
+
+
       /* The memory size is used to define the symbolic variable's size. */
       SharedSymbolicVariable SymbolicEngine::symbolizeMemory(const triton::arch::MemoryAccess& mem, const std::string& symVarAlias) {
         triton::uint64 memAddr    = mem.getAddress();
@@ -630,6 +1334,9 @@ namespace triton {
 
 
       SharedSymbolicVariable SymbolicEngine::symbolizeRegister(const triton::arch::Register& reg, const std::string& symVarAlias) {
+        /* The concrete value of a deferred flag is not synchronized yet */
+        this->materializeLazyRegister(reg);
+
         const triton::arch::Register& parent  = this->architecture->getRegister(reg.getParent());
         triton::uint32 symVarSize             = reg.getBitSize();
         triton::uint512 cv                    = this->architecture->getConcreteRegisterValue(reg);
@@ -663,12 +1370,18 @@ namespace triton {
       SharedSymbolicVariable SymbolicEngine::newSymbolicVariable(triton::engines::symbolic::variable_e type, triton::uint64 origin, triton::uint32 size, const std::string& alias) {
         triton::usize uniqueId = this->getUniqueSymVarId();
 
-        SharedSymbolicVariable symVar = std::make_shared<SymbolicVariable>(type, origin, uniqueId, size, alias);
+        SharedSymbolicVariable symVar = triton::utils::allocateShared<SymbolicVariable>(this->astCtxt->getMemoryResource(), type, origin, uniqueId, size, alias);
         if (symVar == nullptr) {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicVariable(): Cannot allocate a new symbolic variable");
         }
 
-        this->symbolicVariables[uniqueId] = symVar;
+        this->symbolicVariables.mutate()[uniqueId] = symVar;
+        removeExpiredEntries(this->symbolicVariables, this->variablesThreshold);
+        this->indexSymbolicVariable(symVar);
+
+        if (this->smtStream)
+          this->streamVariable(symVar);
+
         return symVar;
       }
 
@@ -855,30 +1568,246 @@ namespace triton {
       }
 
 
-      /* Returns the AST corresponding to the memory */
-      triton::ast::SharedAbstractNode SymbolicEngine::getMemoryAst(const triton::arch::MemoryAccess& mem) {
-        std::vector<triton::ast::SharedAbstractNode> cells;
-
-        triton::ast::SharedAbstractNode tmp = nullptr;
-        triton::uint64 address              = mem.getAddress();
-        triton::uint32 size                 = mem.getSize();
-        triton::uint8 raw[64]               = {0};
-        triton::uint512 value               = this->architecture->getConcreteMemoryValue(mem);
+      /* The values lo + k * stride up to hi, a stride of 0 being a single value */
+      struct StridedInterval {
+        triton::uint512 lo;
+        triton::uint512 hi;
+        triton::uint512 stride;
+      };
 
-        /* Convert the integer value to a raw buffer */
-        triton::utils::fromUintToBuffer(value, raw);
 
-        /*
-         * Symbolic optimization
-         * If the memory access is aligned, don't split the memory.
-         */
-        if (this->isArrayMode() == false && this->isAlignedMode() && this->isAlignedMemory(address, size)) {
-          return this->getAlignedMemory(address, size)->getAst();
+      /* Returns the greatest common divisor, gcd(x, 0) being x */
+      static triton::uint512 getGcd(triton::uint512 a, triton::uint512 b) {
+        while (b != 0) {
+          triton::uint512 r = a % b;
+          a = b;
+          b = r;
         }
+        return a;
+      }
 
-        cells.reserve(size);
-        while (size) {
-          /* Symbolic Array */
+
+      /*
+       * Returns a strided interval holding the values of a bitvector AST, from the ranges of its variables
+       * and the known bits of its masks. The nodes which may wrap around or which are not supported, and the
+       * ones past `budget` visited nodes, take any value of their size.
+       */
+      static StridedInterval getStridedInterval(const triton::ast::SharedAbstractNode& node, triton::usize& budget) {
+        const StridedInterval any = {0, node->getBitvectorMask(), 1};
+
+        if (budget == 0)
+          return any;
+        budget--;
+
+        if (node->isSymbolized() == false)
+          return {node->evaluate(), node->evaluate(), 0};
+
+        const std::vector<triton::ast::SharedAbstractNode>& children = node->getChildren();
+        StridedInterval a, b, out;
+
+        switch (node->getType()) {
+          case triton::ast::REFERENCE_NODE: {
+            const auto& expr = reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression();
+            return getStridedInterval(expr->getAst(), budget);
+          }
+
+          case triton::ast::ZX_NODE:
+            return getStridedInterval(children[1], budget);
+
+          /* Only the non negative values are kept as they are */
+          case triton::ast::SX_NODE:
+            a = getStridedInterval(children[1], budget);
+            return (a.hi <= (children[1]->getBitvectorMask() >> 1)) ? a : any;
+
+          case triton::ast::EXTRACT_NODE:
+            if (triton::ast::getInteger<triton::uint32>(children[1]) != 0)
+              return any;
+            a = getStridedInterval(children[2], budget);
+            return (a.hi <= any.hi) ? a : any;
+
+          /* Only the zero extensions */
+          case triton::ast::CONCAT_NODE:
+            for (triton::usize index = 0; index + 1 < children.size(); index++) {
+              if (children[index]->isSymbolized() || children[index]->evaluate() != 0)
+                return any;
+            }
+            return getStridedInterval(children.back(), budget);
+
+          case triton::ast::BVADD_NODE:
+            a   = getStridedInterval(children[0], budget);
+            b   = getStridedInterval(children[1], budget);
+            out = {a.lo + b.lo, a.hi + b.hi, getGcd(a.stride, b.stride)};
+            return (out.hi <= any.hi) ? out : any;
+
+          case triton::ast::BVMUL_NODE:
+          case triton::ast::BVSHL_NODE: {
+            triton::uint512 factor = 0;
+            triton::usize index    = 0;
+
+            if (children[1]->isSymbolized() == false) {
+              factor = children[1]->evaluate();
+            }
+            else if (children[0]->isSymbolized() == false && node->getType() == triton::ast::BVMUL_NODE) {
+              factor = children[0]->evaluate();
+              index  = 1;
+            }
+            else {
+              return any;
+            }
+
+            if (node->getType() == triton::ast::BVSHL_NODE) {
+              if (factor >= node->getBitvectorSize())
+                return {0, 0, 0};
+              factor = triton::uint512(1) << static_cast<triton::uint32>(factor);
+            }
+
+            a   = getStridedInterval(children[index], budget);
+            out = {a.lo * factor, a.hi * factor, a.stride * factor};
+            return (out.hi <= any.hi) ? out : any;
+          }
+
+          case triton::ast::BVLSHR_NODE: {
+            if (children[1]->isSymbolized() || children[1]->evaluate() >= node->getBitvectorSize())
+              return any;
+            triton::uint32 shift = static_cast<triton::uint32>(children[1]->evaluate());
+            a = getStridedInterval(children[0], budget);
+            bool aligned = (a.stride % (triton::uint512(1) << shift)) == 0;
+            return {a.lo >> shift, a.hi >> shift, aligned ? triton::uint512(a.stride >> shift) : triton::uint512(1)};
+          }
+
+          /* The bits cleared by the mask are known */
+          case triton::ast::BVAND_NODE: {
+            triton::usize index = children[1]->isSymbolized() ? 0 : 1;
+            if (children[index]->isSymbolized())
+              return any;
+
+            triton::uint512 mask = children[index]->evaluate();
+            if (mask == 0)
+              return {0, 0, 0};
+
+            triton::uint512 low = 1;
+            while ((mask & low) == 0)
+              low <<= 1;
+
+            a = getStridedInterval(children[1 - index], budget);
+            return {0, std::min(a.hi, mask), low};
+          }
+
+          case triton::ast::ITE_NODE:
+            a = getStridedInterval(children[1], budget);
+            b = getStridedInterval(children[2], budget);
+            out.lo     = std::min(a.lo, b.lo);
+            out.hi     = std::max(a.hi, b.hi);
+            out.stride = getGcd(getGcd(a.stride, b.stride), a.lo > b.lo ? a.lo - b.lo : b.lo - a.lo);
+            return out;
+
+          default:
+            return any;
+        }
+      }
+
+
+      /* Returns the addresses of a memory access through a symbolic pointer */
+      std::vector<triton::uint64> SymbolicEngine::resolvePointer(const triton::arch::MemoryAccess& mem) {
+        std::vector<triton::uint64> addresses;
+        const triton::ast::SharedAbstractNode& ea = mem.getLeaAst();
+        triton::usize budget = 4096;
+
+        if (this->modes->isModeEnabled(triton::modes::POINTER_RESOLUTION) == false || this->pointerResolutionBound == 0)
+          return addresses;
+
+        if (ea == nullptr || ea->isSymbolized() == false)
+          return addresses;
+
+        /* The strided interval of the pointer gives its addresses without any query */
+        StridedInterval range = getStridedInterval(ea, budget);
+        triton::uint512 count = (range.stride == 0) ? 1 : ((range.hi - range.lo) / range.stride) + 1;
+        if (count <= this->pointerResolutionBound) {
+          for (triton::uint512 index = 0; index < count; index++)
+            addresses.push_back(static_cast<triton::uint64>(range.lo + index * range.stride));
+        }
+
+        /* Otherwise they are enumerated under the path predicate */
+        if (addresses.empty() && this->pointerResolver)
+          addresses = this->pointerResolver(ea, this->pointerResolutionBound);
+
+        /* The concrete address is always one of them */
+        if (!addresses.empty() && std::find(addresses.begin(), addresses.end(), mem.getAddress()) == addresses.end())
+          addresses.push_back(mem.getAddress());
+
+        return addresses;
+      }
+
+
+      /* Stores a value through a symbolic pointer at one of its addresses */
+      void SymbolicEngine::assignResolvedMemory(triton::uint64 address, const triton::ast::SharedAbstractNode& ea, const triton::ast::SharedAbstractNode& node, const std::string& comment) {
+        triton::ast::SharedAbstractNode cond = this->astCtxt->equal(ea, this->astCtxt->bv(address, ea->getBitvectorSize()));
+        triton::uint32 size                  = node->getBitvectorSize() / bitsize::byte;
+
+        for (triton::uint32 index = 0; index < size; index++) {
+          triton::uint64 cell = address + index;
+          auto byte  = this->astCtxt->extract((index * bitsize::byte) + (bitsize::byte - 1), index * bitsize::byte, node);
+          auto value = this->astCtxt->ite(cond, byte, this->getMemoryAst(triton::arch::MemoryAccess(cell, triton::size::byte)));
+
+          /* Symbolic array */
+          if (this->isArrayMode()) {
+            auto store = this->astCtxt->store(this->astCtxt->reference(this->getMemoryArray()), this->astCtxt->bv(cell, this->architecture->gprBitSize()), value);
+            this->memoryArray = this->newSymbolicExpression(store, MEMORY_EXPRESSION, "Byte reference - " + comment);
+            this->memoryArray->setOriginMemory(triton::arch::MemoryAccess(cell, triton::size::byte));
+            this->addBitvectorMemory(cell, this->memoryArray);
+          }
+          /* Symbolic bitvector */
+          else {
+            const SharedSymbolicExpression& se = this->newSymbolicExpression(value, MEMORY_EXPRESSION, "Byte reference - " + comment);
+            se->setOriginMemory(triton::arch::MemoryAccess(cell, triton::size::byte));
+            this->addBitvectorMemory(cell, se);
+          }
+        }
+      }
+
+
+      /* Returns the AST corresponding to the memory */
+      triton::ast::SharedAbstractNode SymbolicEngine::getMemoryAst(const triton::arch::MemoryAccess& mem) {
+        std::vector<triton::ast::SharedAbstractNode> cells;
+
+        triton::ast::SharedAbstractNode tmp = nullptr;
+        triton::uint64 address              = mem.getAddress();
+        triton::uint32 size                 = mem.getSize();
+        triton::uint8 raw[64]               = {0};
+        triton::uint512 value               = this->architecture->getConcreteMemoryValue(mem);
+
+        /* Memory accesses depend on concrete addresses, they can not be replayed */
+        if (this->recorder)
+          this->recorder->invalidate();
+
+        /* A symbolic pointer resolved to a few addresses reads each one of them */
+        std::vector<triton::uint64> addresses = this->resolvePointer(mem);
+        if (addresses.size() > 1) {
+          const triton::ast::SharedAbstractNode& ea = mem.getLeaAst();
+          tmp = this->getMemoryAst(triton::arch::MemoryAccess(address, size));
+          for (triton::uint64 addr : addresses) {
+            if (addr != address) {
+              auto cond = this->astCtxt->equal(ea, this->astCtxt->bv(addr, ea->getBitvectorSize()));
+              tmp = this->astCtxt->ite(cond, this->getMemoryAst(triton::arch::MemoryAccess(addr, size)), tmp);
+            }
+          }
+          return tmp;
+        }
+
+        /* Convert the integer value to a raw buffer */
+        triton::utils::fromUintToBuffer(value, raw);
+
+        /*
+         * Symbolic optimization
+         * If the memory access overlaps aligned entries, don't split them.
+         */
+        if (this->isArrayMode() == false && this->isAlignedMode() && this->memoryBitvector->hasIntervals()) {
+          return this->getAlignedMemoryAst(address, size, raw);
+        }
+
+        cells.reserve(size);
+        while (size) {
+          /* Symbolic Array */
           if (this->isArrayMode()) {
             auto gpr_size = this->architecture->gprBitSize();
             auto memor_ea = mem.getLeaAst() != nullptr ? mem.getLeaAst() : this->astCtxt->bv(address, gpr_size);
@@ -927,35 +1856,86 @@ namespace triton {
       /* Returns the AST corresponding to the register */
       triton::ast::SharedAbstractNode SymbolicEngine::getRegisterAst(const triton::arch::Register& reg) {
         triton::ast::SharedAbstractNode node = nullptr;
-        triton::uint32 bvSize                = reg.getBitSize();
         triton::uint32 high                  = reg.getHigh();
         triton::uint32 low                   = reg.getLow();
-        triton::uint512 value                = this->architecture->getConcreteRegisterValue(reg);
+        const SubRegisterSlice* slice        = nullptr;
+        bool merge                           = true;
 
-        /* Check if the register is already symbolic */
-        const SharedSymbolicExpression& symReg = this->getSymbolicRegister(reg);
-        if (symReg) node = this->astCtxt->extract(high, low, this->astCtxt->reference(symReg));
-        else        node = this->astCtxt->bv(value, bvSize);
+        /*
+         * A read inside a written slice takes the slice, and a read beside the
+         * slices takes the previous expression of the parent. Only a read across
+         * a slice merges them.
+         */
+        if (!this->subRegisterSlices.empty()) {
+          auto it = this->subRegisterSlices.find(reg.getParent());
+          if (it != this->subRegisterSlices.end()) {
+            merge = false;
+            for (const auto& s : it->second) {
+              if (low >= s.low && high <= s.high) {
+                slice = &s;
+                break;
+              }
+              if (low <= s.high && high >= s.low) {
+                merge = true;
+                break;
+              }
+            }
+          }
+        }
+
+        if (slice) {
+          node = this->astCtxt->extract(high - slice->low, low - slice->low, this->astCtxt->reference(slice->expr));
+        }
+        else {
+          /* A deferred flag is built once read, and the slices crossed are merged */
+          if (merge)
+            this->materializeLazyRegister(reg);
+
+          /* Check if the register is already symbolic */
+          const SharedSymbolicExpression& symReg = this->getSymbolicRegister(reg);
+          if (symReg) node = this->astCtxt->extract(high, low, this->astCtxt->reference(symReg));
+          else        node = this->getConcreteRegisterAst(reg);
+        }
 
         /* extend AST if it's a extend operand (mainly used for AArch64) */
         if (reg.getExtendType() != triton::arch::arm::ID_EXTEND_INVALID) {
-          return this->getExtendAst(static_cast<const triton::arch::arm::ArmOperandProperties>(reg), node);
+          node = this->getExtendAst(static_cast<const triton::arch::arm::ArmOperandProperties>(reg), node);
         }
 
         /* Shift AST if it's a shift operand (mainly used for Arm) */
-        if (reg.getShiftType() != triton::arch::arm::ID_SHIFT_INVALID) {
-          return this->getShiftAst(static_cast<const triton::arch::arm::ArmOperandProperties>(reg), node);
+        else if (reg.getShiftType() != triton::arch::arm::ID_SHIFT_INVALID) {
+          node = this->getShiftAst(static_cast<const triton::arch::arm::ArmOperandProperties>(reg), node);
         }
 
         /* Extract AST if it's have vector index (mainly used for Arm Neon) */
-        if (reg.getVectorIndex() != -1 && reg.getVASSize() != 0) {
-          return this->getIndexAst(static_cast<const triton::arch::arm::ArmOperandProperties>(reg), node);
+        else if (reg.getVectorIndex() != -1 && reg.getVASSize() != 0) {
+          node = this->getIndexAst(static_cast<const triton::arch::arm::ArmOperandProperties>(reg), node);
         }
 
+        /* Record the read when lifting a semantic template */
+        if (this->recorder)
+          this->recorder->addRead(reg, node);
+
         return node;
       }
 
 
+      /* Reuses the constant node of the previous read while the register holds the same value */
+      triton::ast::SharedAbstractNode SymbolicEngine::getConcreteRegisterAst(const triton::arch::Register& reg) {
+        triton::uint512 value = this->getConcreteRegister(reg);
+        triton::uint32 id = reg.getId();
+
+        if (id >= this->concreteRegisterNodes.size())
+          return this->astCtxt->bv(value, reg.getBitSize());
+
+        triton::ast::SharedAbstractNode& cached = this->concreteRegisterNodes[id];
+        if (cached == nullptr || cached->evaluate() != value)
+          cached = this->astCtxt->bv(value, reg.getBitSize());
+
+        return cached;
+      }
+
+
       /* Returns the AST corresponding to the register and defines the register as input of the instruction */
       triton::ast::SharedAbstractNode SymbolicEngine::getRegisterAst(triton::arch::Instruction& inst, const triton::arch::Register& reg) {
         triton::ast::SharedAbstractNode node = this->getRegisterAst(reg);
@@ -975,16 +1955,68 @@ namespace triton {
       }
 
 
+      /* Concretizes or records an AST exceeding the budget */
+      triton::ast::SharedAbstractNode SymbolicEngine::applyAstBudget(const triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node) {
+        if (this->budgetNodes == 0 && this->budgetLevel == 0)
+          return node;
+
+        /* The level is known, nodes are only counted up to the budget when their estimate exceeds it */
+        bool exceeded = (this->budgetLevel && node->getLevel() > this->budgetLevel);
+        triton::usize nodes = 0;
+        if (!exceeded && this->budgetNodes && node->getDagSizeEstimate() > this->budgetNodes) {
+          nodes = triton::ast::countNodes(node, this->budgetNodes);
+          exceeded = (nodes > this->budgetNodes);
+        }
+
+        if (!exceeded)
+          return node;
+
+        BudgetEvent event;
+        event.address     = inst.getAddress();
+        event.id          = this->uniqueSymExprId;
+        event.level       = node->getLevel();
+        event.nodes       = nodes;
+        event.concretized = (this->budgetPolicy == BUDGET_CONCRETIZE);
+        this->budgetEvents.push_back(event);
+
+        if (!event.concretized)
+          return node;
+
+        /* A concrete value can not be replayed by a semantic template */
+        if (this->recorder)
+          this->recorder->invalidate();
+
+        return this->astCtxt->bv(node->evaluate(), node->getBitvectorSize());
+      }
+
+
       /* Returns the new symbolic memory expression */
-      const SharedSymbolicExpression& SymbolicEngine::createSymbolicMemoryExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::MemoryAccess& mem, const std::string& comment) {
+      const SharedSymbolicExpression& SymbolicEngine::createSymbolicMemoryExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& input, const triton::arch::MemoryAccess& mem, const std::string& comment) {
         triton::ast::SharedAbstractNode tmp = nullptr;
         SharedSymbolicExpression se         = nullptr;
         triton::uint64 address              = mem.getAddress();
         triton::uint32 writeSize            = mem.getSize();
         triton::usize id                    = this->uniqueSymExprId;
 
+        /* An AST exceeding the budget may fall back to its concrete value */
+        const triton::ast::SharedAbstractNode node = this->applyAstBudget(inst, input);
+
+        /* Memory accesses depend on concrete addresses, they can not be replayed */
+        if (this->recorder)
+          this->recorder->invalidate();
+
+        /* A symbolic pointer resolved to a few addresses may store to each one of them */
+        std::vector<triton::uint64> addresses = this->resolvePointer(mem);
+
+        /* Keep the previous state of the memory when journaling */
+        this->journalMemory(mem);
+        for (triton::uint64 addr : addresses) {
+          if (addr != address)
+            this->journalMemory(triton::arch::MemoryAccess(addr, writeSize));
+        }
+
         /* Record the aligned memory for a symbolic optimization */
-        if (this->isAlignedMode() && this->isArrayMode() == false) {
+        if (this->isAlignedMode() && this->isArrayMode() == false && addresses.size() <= 1) {
           const SharedSymbolicExpression& aligned = this->newSymbolicExpression(node, MEMORY_EXPRESSION, "Aligned optimization - " + comment);
           aligned->setOriginMemory(mem);
           this->addAlignedMemory(address, writeSize, aligned);
@@ -992,6 +2024,13 @@ namespace triton {
           id = this->uniqueSymExprId;
         }
 
+        /* Each address keeps its previous bytes if the pointer is not equal to it */
+        if (addresses.size() > 1) {
+          for (triton::uint64 addr : addresses)
+            this->assignResolvedMemory(addr, mem.getLeaAst(), node, comment);
+          writeSize = 0;
+        }
+
         /*
          * As the x86's memory can be accessed without alignment, each byte of the
          * memory must be assigned to an unique reference.
@@ -1113,12 +2152,25 @@ namespace triton {
 
 
       /* Returns the new symbolic register expression */
-      const SharedSymbolicExpression& SymbolicEngine::createSymbolicRegisterExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::Register& reg, const std::string& comment) {
+      const SharedSymbolicExpression& SymbolicEngine::createSymbolicRegisterExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& input, const triton::arch::Register& reg, const std::string& comment) {
         triton::usize id = this->uniqueSymExprId;
         SharedSymbolicExpression se = nullptr;
 
-        se = this->newSymbolicExpression(this->insertSubRegisterInParent(reg, node), REGISTER_EXPRESSION, comment);
-        this->assignSymbolicExpressionToRegister(se, this->architecture->getParentRegister(reg));
+        /* An AST exceeding the budget may fall back to its concrete value */
+        const triton::ast::SharedAbstractNode node = this->applyAstBudget(inst, input);
+
+        if (this->isSubRegisterSliced(reg)) {
+          se = this->newSymbolicExpression(node, REGISTER_EXPRESSION, comment);
+          this->assignSymbolicExpressionToSubRegister(se, reg);
+        }
+        else {
+          se = this->newSymbolicExpression(this->insertSubRegisterInParent(reg, node), REGISTER_EXPRESSION, comment);
+          this->assignSymbolicExpressionToRegister(se, this->architecture->getParentRegister(reg));
+        }
+
+        /* Record the assignment when lifting a semantic template */
+        if (this->recorder)
+          this->recorder->addWrite(se, node, reg, comment);
 
         inst.setWrittenRegister(reg, node);
         return this->addSymbolicExpressions(inst, id);
@@ -1126,16 +2178,198 @@ namespace triton {
 
 
       /* Returns the new symbolic volatile expression */
-      const SharedSymbolicExpression& SymbolicEngine::createSymbolicVolatileExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const std::string& comment) {
+      const SharedSymbolicExpression& SymbolicEngine::createSymbolicVolatileExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& input, const std::string& comment) {
         triton::usize id = this->uniqueSymExprId;
+
+        /* An AST exceeding the budget may fall back to its concrete value */
+        const triton::ast::SharedAbstractNode node = this->applyAstBudget(inst, input);
+
         const SharedSymbolicExpression& se = this->newSymbolicExpression(node, VOLATILE_EXPRESSION, comment);
+
+        /* Record the expression when lifting a semantic template */
+        if (this->recorder)
+          this->recorder->addWrite(se, node, comment);
+
         return this->addSymbolicExpressions(inst, id);
       }
 
 
+      void SymbolicEngine::deferFlags(bool flag) {
+        this->deferringFlags = flag;
+      }
+
+
+      bool SymbolicEngine::isDeferringFlags(void) const {
+        return this->deferringFlags || this->modes->isModeEnabled(triton::modes::LAZY_FLAGS);
+      }
+
+
+      /* Creates or defers a register expression */
+      void SymbolicEngine::createLazyRegisterExpression(triton::arch::Instruction& inst, const std::function<triton::ast::SharedAbstractNode(void)>& builder, const triton::arch::Register& reg, const std::string& comment, bool tainted) {
+        if (this->isDeferringFlags() == false) {
+          const SharedSymbolicExpression& se = this->createSymbolicRegisterExpression(inst, builder(), reg, comment);
+          se->isTainted = tainted;
+          return;
+        }
+
+        /* Only the last deferred expression of a register may be read */
+        LazyRegister& lazy = this->lazyRegisters[reg.getParent()];
+        lazy.builder = builder;
+        lazy.reg     = reg;
+        lazy.comment = comment;
+        lazy.tainted = tainted;
+        lazy.inst    = this->deferringFlags ? &inst : nullptr;
+      }
+
+
+      /* Builds the deferred expression of a register and assigns it */
+      void SymbolicEngine::materializeLazyRegister(const triton::arch::Register& reg) {
+        this->materializeSubRegisters(reg);
+
+        if (this->lazyRegisters.empty())
+          return;
+
+        auto it = this->lazyRegisters.find(reg.getParent());
+        if (it == this->lazyRegisters.end())
+          return;
+
+        /* Remove it first, the builder may read the previous state of the register */
+        LazyRegister lazy = std::move(it->second);
+        this->lazyRegisters.erase(it);
+
+        triton::ast::SharedAbstractNode node = lazy.builder();
+        SharedSymbolicExpression se = this->newSymbolicExpression(this->insertSubRegisterInParent(lazy.reg, node), REGISTER_EXPRESSION, lazy.comment);
+        se->isTainted = lazy.tainted;
+        this->indexSymbolicExpression(se);
+        this->assignSymbolicExpressionToRegister(se, this->architecture->getParentRegister(lazy.reg));
+
+        /* The instructions of a basic block still list the flags they wrote, only the dead ones are missing */
+        if (lazy.inst) {
+          lazy.inst->setWrittenRegister(lazy.reg, node);
+          lazy.inst->addSymbolicExpression(se);
+        }
+      }
+
+
+      void SymbolicEngine::materializeLazyRegisters(bool withSubRegisters) {
+        while (!this->lazyRegisters.empty()) {
+          this->materializeLazyRegister(this->lazyRegisters.begin()->second.reg);
+        }
+
+        if (withSubRegisters)
+          this->materializeSubRegisters();
+      }
+
+
+      /* Returns true if the write of a byte or word sub-register is kept as a slice */
+      bool SymbolicEngine::isSubRegisterSliced(const triton::arch::Register& reg) const {
+        if (this->modes->isModeEnabled(triton::modes::LAZY_SUBREGISTERS) == false)
+          return false;
+
+        /* The journal and the templates record the expressions of the parents */
+        if (this->journal || this->recorder)
+          return false;
+
+        /* The wider writes are zero extended, they do not read their parent */
+        if (reg.getSize() != triton::size::byte && reg.getSize() != triton::size::word)
+          return false;
+
+        return reg.getId() != reg.getParent() && reg.isMutable() && !this->architecture->isFlag(reg);
+      }
+
+
+      /* Assigns a symbolic expression to a part of a register, the parent keeps its previous expression */
+      void SymbolicEngine::assignSymbolicExpressionToSubRegister(const SharedSymbolicExpression& se, const triton::arch::Register& reg) {
+        triton::uint32 high = reg.getHigh();
+        triton::uint32 low  = reg.getLow();
+
+        se->setType(REGISTER_EXPRESSION);
+        se->setOriginRegister(reg);
+
+        /* The slices crossing this one are merged first, the ones it covers are overwritten */
+        auto it = this->subRegisterSlices.find(reg.getParent());
+        if (it != this->subRegisterSlices.end()) {
+          for (const auto& s : it->second) {
+            if ((low > s.low || high < s.high) && low <= s.high && high >= s.low) {
+              this->materializeSubRegisters(reg);
+              break;
+            }
+          }
+        }
+
+        auto& slices = this->subRegisterSlices[reg.getParent()];
+        slices.erase(std::remove_if(slices.begin(), slices.end(), [low, high](const SubRegisterSlice& s) {
+          return low <= s.low && high >= s.high;
+        }), slices.end());
+        slices.push_back({high, low, se});
+
+        /* Synchronize the concrete state */
+        this->setConcreteRegister(reg, se->getAst()->evaluate());
+      }
+
+
+      /* Merges the written slices of a register into a new expression of its parent */
+      void SymbolicEngine::materializeSubRegisters(const triton::arch::Register& reg) {
+        if (this->subRegisterSlices.empty())
+          return;
+
+        auto it = this->subRegisterSlices.find(reg.getParent());
+        if (it == this->subRegisterSlices.end())
+          return;
+
+        /* Remove them first, the parent is assigned below */
+        std::vector<SubRegisterSlice> slices = std::move(it->second);
+        this->subRegisterSlices.erase(it);
+
+        const triton::arch::Register& parent = this->architecture->getParentRegister(reg);
+        const SharedSymbolicExpression prev  = this->symbolicReg[parent.getId()];
+        triton::uint512 value                = this->architecture->getConcreteRegisterValue(parent);
+        bool tainted                         = slices.back().expr->isTainted;
+
+        /* The bits between the slices keep the previous expression, or the concrete value */
+        auto keep = [&](triton::uint32 hi, triton::uint32 lo) {
+          if (prev)
+            return this->astCtxt->extract(hi, lo, this->astCtxt->reference(prev));
+          triton::uint512 mask = (triton::uint512(1) << (hi - lo + 1)) - 1;
+          return this->astCtxt->bv((value >> lo) & mask, hi - lo + 1);
+        };
+
+        /* The concatenation takes the most significant part first */
+        std::sort(slices.begin(), slices.end(), [](const SubRegisterSlice& a, const SubRegisterSlice& b) {
+          return a.low > b.low;
+        });
+
+        std::vector<triton::ast::SharedAbstractNode> parts;
+        parts.reserve(2 * slices.size() + 1);
+
+        triton::uint32 top = parent.getBitSize();
+        for (const auto& s : slices) {
+          if (s.high + 1 != top)
+            parts.push_back(keep(top - 1, s.high + 1));
+          parts.push_back(this->astCtxt->reference(s.expr));
+          top = s.low;
+        }
+        if (top != 0)
+          parts.push_back(keep(top - 1, 0));
+
+        SharedSymbolicExpression se = this->newSymbolicExpression(this->astCtxt->concat(parts), REGISTER_EXPRESSION, "Sub-registers merge");
+        se->isTainted = tainted;
+        this->indexSymbolicExpression(se);
+        this->assignSymbolicExpressionToRegister(se, parent);
+      }
+
+
+      void SymbolicEngine::materializeSubRegisters(void) {
+        while (!this->subRegisterSlices.empty()) {
+          auto id = static_cast<triton::arch::register_e>(this->subRegisterSlices.begin()->first);
+          this->materializeSubRegisters(this->architecture->getRegister(id));
+        }
+      }
+
+
       /* Adds a symbolic expression to the bitvector memory model */
       inline void SymbolicEngine::addBitvectorMemory(triton::uint64 mem, const SharedSymbolicExpression& expr) {
-        this->memoryBitvector[mem] = expr;
+        this->memoryBitvector.mutate().setCell(mem, expr);
       }
 
 
@@ -1158,10 +2392,19 @@ namespace triton {
         se->setOriginRegister(reg);
 
         if (reg.isMutable()) {
-          /* Assign if this register is mutable */
+          /* Keep the previous state of the register when journaling */
+          this->journalRegister(reg);
+          /* A deferred expression of this register is overwritten before being read */
+          if (!this->lazyRegisters.empty())
+            this->lazyRegisters.erase(id);
+          /* So are the written slices of the register */
+          if (!this->subRegisterSlices.empty())
+            this->subRegisterSlices.erase(id);
+          /* Assign if this register is mutable, the previous expression being released by the reclamation thread if any */
+          this->astCtxt->reclaim(std::move(this->symbolicReg[id]));
           this->symbolicReg[id] = se;
           /* Synchronize the concrete state */
-          this->architecture->setConcreteRegisterValue(reg, node->evaluate());
+          this->setConcreteRegister(reg, node->evaluate());
         }
       }
 
@@ -1177,6 +2420,9 @@ namespace triton {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::assignSymbolicExpressionToMemory(): The size of the symbolic expression is not equal to the memory access.");
         }
 
+        /* Keep the previous state of the memory when journaling */
+        this->journalMemory(mem);
+
         /* Record the aligned memory for a symbolic optimization */
         if (this->isAlignedMode() && this->isArrayMode() == false) {
           this->addAlignedMemory(address, writeSize, se);
@@ -1217,9 +2463,9 @@ namespace triton {
 
       /* Returns true if the symbolic expression ID exists */
       bool SymbolicEngine::isSymbolicExpressionExists(triton::usize symExprId) const {
-        auto it = this->symbolicExpressions.find(symExprId);
+        auto it = this->symbolicExpressions->find(symExprId);
 
-        if (it != this->symbolicExpressions.end()) {
+        if (it != this->symbolicExpressions->end()) {
           return (it->second.use_count() > 0);
         }
 
@@ -1251,9 +2497,21 @@ namespace triton {
       /* Returns true if the register expression contains a symbolic variable. */
       bool SymbolicEngine::isRegisterSymbolized(const triton::arch::Register& reg) const {
         const SharedSymbolicExpression& expr = this->getSymbolicRegister(reg);
-        if (expr) {
-          return expr->isSymbolized();
+        if (expr && expr->isSymbolized()) {
+          return true;
         }
+
+        /* The written slices are not merged into the parent yet */
+        if (!this->subRegisterSlices.empty()) {
+          auto it = this->subRegisterSlices.find(reg.getParent());
+          if (it != this->subRegisterSlices.end()) {
+            for (const auto& s : it->second) {
+              if (s.expr->isSymbolized())
+                return true;
+            }
+          }
+        }
+
         return false;
       }
 
@@ -1308,8 +2566,64 @@ namespace triton {
       }
 
 
+      void SymbolicEngine::initLeaAst(const triton::arch::Instruction& inst, triton::uint32 operand, triton::arch::MemoryAccess& mem) {
+        std::array<SharedSymbolicExpression, 3> exprs;
+        std::array<triton::uint512, 3> values;
+        bool symbolic = false;
+
+        if (this->modes->isModeEnabled(triton::modes::EFFECTIVE_ADDRESS_CACHE) == false || this->recorder || mem.getBitSize() < bitsize::byte) {
+          this->initLeaAst(mem);
+          return;
+        }
+
+        /* The registers the effective address is built from */
+        const triton::arch::Register* regs[] = {
+          &mem.getConstBaseRegister(),
+          &mem.getConstIndexRegister(),
+          &mem.getConstSegmentRegister()
+        };
+
+        for (triton::uint32 i = 0; i < 3; i++) {
+          if (this->architecture->isRegisterValid(*regs[i]) == false)
+            continue;
+
+          /* The deferred flags and the sub-register slices are only built once read */
+          triton::uint32 parentId = regs[i]->getParent();
+          if (this->lazyRegisters.count(parentId) || this->subRegisterSlices.count(parentId)) {
+            this->initLeaAst(mem);
+            return;
+          }
+
+          exprs[i] = this->symbolicReg[parentId];
+          if (exprs[i]) symbolic  = true;
+          else          values[i] = this->getConcreteRegister(*regs[i]);
+        }
+
+        /* An instruction rewritten at the same address gets new entries */
+        std::string opcode(reinterpret_cast<const char*>(inst.getOpcode()), inst.getSize());
+        auto& entries = this->effectiveAddresses[inst.getAddress()];
+        if (entries.size() <= operand)
+          entries.resize(operand + 1);
+
+        EffectiveAddress& entry = entries[operand];
+        if (entry.leaAst == nullptr || entry.opcode != opcode || entry.exprs != exprs || entry.values != values) {
+          this->initLeaAst(mem);
+
+          /* Without symbolic registers, the effective address is a constant */
+          const triton::ast::SharedAbstractNode& leaAst = mem.getLeaAst();
+          entry.leaAst = symbolic ? leaAst : this->astCtxt->bv(leaAst->evaluate(), leaAst->getBitvectorSize());
+          entry.opcode = std::move(opcode);
+          entry.exprs  = std::move(exprs);
+          entry.values = values;
+        }
+
+        mem.setLeaAst(entry.leaAst);
+        mem.setAddress(static_cast<triton::uint64>(entry.leaAst->evaluate()));
+      }
+
+
       triton::uint512 SymbolicEngine::getConcreteVariableValue(const SharedSymbolicVariable& symVar) const {
-        return this->astCtxt->getVariableValue(symVar->getName());
+        return this->astCtxt->getVariableValue(symVar->getId());
       }
 
 
@@ -1323,7 +2637,7 @@ namespace triton {
         }
 
         /* Update the symbolic variable value */
-        this->astCtxt->updateVariable(symVar->getName(), value);
+        this->astCtxt->updateVariable(symVar->getId(), value);
 
         /* Synchronize concrete state */
         if (symVar->getType() == REGISTER_VARIABLE) {
@@ -1350,6 +2664,466 @@ namespace triton {
         return this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY);
       }
 
+
+      triton::uint512 SymbolicEngine::getConcreteRegister(const triton::arch::Register& reg) const {
+        if (reg.getBitSize() <= triton::bitsize::qword)
+          return this->architecture->loadConcreteRegister<triton::uint64>(reg);
+        return this->architecture->getConcreteRegisterValue(reg);
+      }
+
+
+      void SymbolicEngine::setConcreteRegister(const triton::arch::Register& reg, const triton::uint512& value) {
+        triton::uint64 word = static_cast<triton::uint64>(value);
+
+        /* A value too big is left to the generic path, which rejects it */
+        if (reg.getBitSize() <= triton::bitsize::qword && value == word)
+          this->architecture->storeConcreteRegister<triton::uint64>(reg, word);
+        else
+          this->architecture->setConcreteRegisterValue(reg, value);
+      }
+
+
+      /* Journals the current state of a parent register before it is assigned */
+      void SymbolicEngine::journalRegister(const triton::arch::Register& reg) {
+        UndoJournal::Record* record = this->journal ? this->journal->getCurrentRecord() : nullptr;
+        if (record == nullptr)
+          return;
+
+        const triton::arch::RegisterSlot& slot = this->architecture->getConcreteRegisterSlot(reg.getId());
+        const triton::uint8* file = this->architecture->getConcreteRegisterFile();
+        triton::uint32 data = static_cast<triton::uint32>(record->bytes.size());
+
+        record->bytes.insert(record->bytes.end(), file + slot.offset, file + slot.offset + slot.size);
+        record->registers.push_back({reg.getId(), data, this->symbolicReg[reg.getId()]});
+      }
+
+
+      /* Journals the current state of a memory area before it is assigned */
+      void SymbolicEngine::journalMemory(const triton::arch::MemoryAccess& mem) {
+        UndoJournal::Record* record = this->journal ? this->journal->getCurrentRecord() : nullptr;
+        if (record == nullptr)
+          return;
+
+        triton::uint64 address = mem.getAddress();
+        triton::uint32 size    = mem.getSize();
+        triton::uint8 values[triton::size::dqqword] = {0};
+
+        /* Most stores target defined memory, read it at once */
+        bool defined = size <= sizeof(values) && this->architecture->isConcreteMemoryValueDefined(address, size);
+        if (defined) {
+          this->architecture->readConcreteMemory(address, values, size, false);
+        }
+
+        for (triton::uint32 index = 0; index < size; index++) {
+          UndoJournal::MemoryDelta delta;
+          delta.address = address + index;
+          delta.expr    = this->memoryBitvector->getCell(address + index);
+          delta.defined = defined || this->architecture->isConcreteMemoryValueDefined(address + index);
+          delta.value   = defined ? values[index] : (delta.defined ? this->architecture->getConcreteMemoryValue(address + index, false) : 0);
+
+          record->memory.push_back(delta);
+        }
+
+        if (this->isArrayMode() && record->memoryArrayChanged == false) {
+          record->memoryArray        = this->memoryArray;
+          record->memoryArrayChanged = true;
+        }
+      }
+
+
+      void SymbolicEngine::enableUndoJournal(bool flag, triton::usize capacity) {
+        /* Deferred expressions of the previous instructions can not be undone */
+        this->materializeLazyRegisters();
+        this->journal = nullptr;
+
+        if (flag) {
+          this->journal.reset(new(std::nothrow) triton::engines::symbolic::UndoJournal(capacity));
+          if (this->journal == nullptr)
+            throw triton::exceptions::SymbolicEngine("SymbolicEngine::enableUndoJournal(): Not enough memory.");
+        }
+      }
+
+
+      bool SymbolicEngine::isUndoJournalEnabled(void) const {
+        return this->journal != nullptr;
+      }
+
+
+      triton::usize SymbolicEngine::getUndoJournalSize(void) const {
+        return this->journal ? this->journal->getSize() : 0;
+      }
+
+
+      void SymbolicEngine::getMemoryUsage(triton::MemoryUsage& usage) const {
+        usage.symbolicExpressions      = this->symbolicExpressions->size();
+        usage.symbolicExpressionsBytes = usage.symbolicExpressions * sizeof(SymbolicExpression);
+        usage.symbolicVariables        = this->symbolicVariables->size();
+        usage.symbolicMemory           = this->memoryBitvector->getSize();
+        usage.symbolicMemoryBytes      = this->memoryBitvector->getMemoryBytes();
+        usage.pathConstraints          = this->getSizeOfPathConstraints();
+        usage.symbolicRegisters        = 0;
+
+        /* The interned comments are few, the distinct comments of the semantics */
+        for (const auto& kv : this->comments)
+          usage.symbolicExpressionsBytes += 2 * (sizeof(std::string) + kv.first.size());
+
+        for (const auto& expr : this->symbolicReg) {
+          if (expr != nullptr)
+            usage.symbolicRegisters++;
+        }
+      }
+
+
+      void SymbolicEngine::openUndoRecord(void) {
+        if (this->journal) {
+          UndoJournal::Record& record = this->journal->openRecord();
+          record.pathConstraints = this->getSizeOfPathConstraints();
+        }
+      }
+
+
+      void SymbolicEngine::closeUndoRecord(void) {
+        if (this->journal) {
+          this->journal->closeRecord();
+        }
+      }
+
+
+      void SymbolicEngine::stepBack(triton::usize count) {
+        if (this->journal == nullptr)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::stepBack(): The undo journal is disabled.");
+
+        if (count > this->journal->getSize())
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::stepBack(): Not enough journaled instructions.");
+
+        while (count--) {
+          UndoJournal::Record& record = this->journal->popRecord();
+
+          /* Undo the memory assignments, the last written first */
+          for (auto it = record.memory.rbegin(); it != record.memory.rend(); it++) {
+            if (it->expr != nullptr)
+              this->memoryBitvector.mutate().setCell(it->address, it->expr);
+            else if (this->memoryBitvector->getCell(it->address) != nullptr)
+              this->memoryBitvector.mutate().removeCell(it->address);
+
+            /* Aligned expressions are an optimization, drop the ones covering the cell */
+            this->removeAlignedMemory(it->address, triton::size::byte);
+
+            if (it->defined)
+              this->architecture->setConcreteMemoryValue(it->address, it->value, false);
+            else
+              this->architecture->clearConcreteMemoryValue(it->address);
+          }
+
+          if (record.memoryArrayChanged)
+            this->memoryArray = record.memoryArray;
+
+          /* Undo the register assignments, the last written first */
+          for (auto it = record.registers.rbegin(); it != record.registers.rend(); it++) {
+            const triton::arch::Register& reg = this->architecture->getRegister(it->id);
+            const triton::arch::RegisterSlot& slot = this->architecture->getConcreteRegisterSlot(it->id);
+            const triton::arch::RegisterSlot saved = {0, slot.size, 0, slot.bitSize};
+
+            this->symbolicReg[it->id] = it->expr;
+            this->architecture->setConcreteRegisterValue(reg, saved.read(record.bytes.data() + it->data), false);
+          }
+
+          while (this->getSizeOfPathConstraints() > record.pathConstraints)
+            this->popPathConstraint();
+
+          /* Release the expressions kept by the record */
+          record.clear();
+        }
+      }
+
+
+      void SymbolicEngine::setSemanticRecorder(SemanticTemplate* recorder) {
+        this->recorder = recorder;
+      }
+
+
+      void SymbolicEngine::streamVariable(const SharedSymbolicVariable& var) {
+        triton::ast::representations::mode_e mode = this->astCtxt->getRepresentationMode();
+
+        this->astCtxt->setRepresentationMode(triton::ast::representations::SMT_REPRESENTATION);
+        *this->smtStream << this->astCtxt->declare(this->astCtxt->variable(var)) << "\n";
+        this->astCtxt->setRepresentationMode(mode);
+      }
+
+
+      void SymbolicEngine::streamExpression(const SharedSymbolicExpression& expr) {
+        triton::ast::representations::mode_e mode = this->astCtxt->getRepresentationMode();
+
+        /* The references are printed as names, the referenced expressions are already written */
+        this->astCtxt->setRepresentationMode(triton::ast::representations::SMT_REPRESENTATION);
+        *this->smtStream << expr->getFormattedExpression() << "\n";
+        this->astCtxt->setRepresentationMode(mode);
+      }
+
+
+      void SymbolicEngine::startSmtStream(std::ostream& stream) {
+        std::map<triton::usize, SharedSymbolicExpression> exprs;
+
+        this->smtStream = &stream;
+
+        /* What exists is written first, in order of creation */
+        for (const auto& item : this->getSymbolicVariables())
+          this->streamVariable(item.second);
+
+        for (const auto& item : this->getSymbolicExpressions())
+          exprs.insert(item);
+
+        for (const auto& item : exprs)
+          this->streamExpression(item.second);
+
+        for (const auto& pco : this->pathConstraints.get())
+          this->streamPathConstraint(pco);
+      }
+
+
+      void SymbolicEngine::stopSmtStream(void) {
+        if (this->smtStream)
+          this->smtStream->flush();
+        this->smtStream = nullptr;
+      }
+
+
+      bool SymbolicEngine::isSmtStreamEnabled(void) const {
+        return this->smtStream != nullptr;
+      }
+
+
+      void SymbolicEngine::setAstBudget(triton::usize maxNodes, triton::uint32 maxLevel) {
+        this->budgetNodes = maxNodes;
+        this->budgetLevel = maxLevel;
+      }
+
+
+      void SymbolicEngine::setAstBudgetPolicy(triton::engines::symbolic::budget_e policy) {
+        this->budgetPolicy = policy;
+      }
+
+
+      const std::vector<BudgetEvent>& SymbolicEngine::getAstBudgetEvents(void) const {
+        return this->budgetEvents;
+      }
+
+
+      void SymbolicEngine::clearAstBudgetEvents(void) {
+        this->budgetEvents.clear();
+      }
+
+
+      bool SymbolicEngine::isPinned(const LoopState& loop, const triton::ast::SharedAbstractNode& node) const {
+        if (loop.pinned.empty())
+          return false;
+
+        for (triton::usize id : node->getVariableIds()) {
+          if (loop.pinned.find(id) == loop.pinned.end())
+            return false;
+        }
+
+        return true;
+      }
+
+
+      void SymbolicEngine::pinVariables(LoopState& loop, const triton::ast::SharedAbstractNode& node) {
+        for (const auto& var : triton::ast::search(node, triton::ast::VARIABLE_NODE)) {
+          if (loop.pinned.insert(reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable()->getId()).second)
+            this->pushPathConstraint(this->astCtxt->equal(var, this->astCtxt->bv(var->evaluate(), var->getBitvectorSize())), "Loop concretization");
+        }
+      }
+
+
+      /* Returns the increment of `expr` over `previous` if its AST is `previous + step`, nullptr otherwise */
+      static triton::ast::SharedAbstractNode getInductionStep(const SharedSymbolicExpression& expr, const SharedSymbolicExpression& previous) {
+        const triton::ast::SharedAbstractNode& node = expr->getAst();
+
+        if (node->getType() != triton::ast::BVADD_NODE)
+          return nullptr;
+
+        for (triton::uint32 index = 0; index < 2; index++) {
+          const triton::ast::SharedAbstractNode& child = node->getChildren()[index];
+          if (child->getType() == triton::ast::REFERENCE_NODE && reinterpret_cast<triton::ast::ReferenceNode*>(child.get())->getSymbolicExpression() == previous)
+            return node->getChildren()[1 - index];
+        }
+
+        return nullptr;
+      }
+
+
+      /* Returns true if two increments are the same on every iteration */
+      static bool isSameStep(const triton::ast::SharedAbstractNode& step1, const triton::ast::SharedAbstractNode& step2) {
+        if (step1 == step2)
+          return true;
+
+        if (step1->getType() != step2->getType() || step1->getBitvectorSize() != step2->getBitvectorSize())
+          return false;
+
+        switch (step1->getType()) {
+          case triton::ast::BV_NODE:
+            return step1->evaluate() == step2->evaluate();
+
+          case triton::ast::REFERENCE_NODE:
+            return reinterpret_cast<triton::ast::ReferenceNode*>(step1.get())->getSymbolicExpression() == reinterpret_cast<triton::ast::ReferenceNode*>(step2.get())->getSymbolicExpression();
+
+          default:
+            return false;
+        }
+      }
+
+
+      void SymbolicEngine::summarizeInductions(LoopState& loop, LoopSummary& summary) {
+        for (const auto& previous : loop.previous) {
+          const SharedSymbolicExpression& expr = this->symbolicReg[previous.first];
+
+          /* Not written by the iteration */
+          if (expr == previous.second)
+            continue;
+
+          triton::ast::SharedAbstractNode step = (expr != nullptr) ? getInductionStep(expr, previous.second) : nullptr;
+          if (step == nullptr) {
+            loop.inductions.erase(previous.first);
+            continue;
+          }
+
+          auto it = loop.inductions.find(previous.first);
+          if (it == loop.inductions.end() || isSameStep(it->second.step, step) == false) {
+            loop.inductions[previous.first] = {previous.second, step, 1};
+            continue;
+          }
+
+          /* The register is `base + count * step`, instead of a chain of one addition per iteration */
+          Induction& induction = it->second;
+          induction.count++;
+
+          const triton::arch::Register& reg = this->architecture->getRegister(previous.first);
+          triton::ast::SharedAbstractNode node = this->astCtxt->bvadd(
+                                                   this->astCtxt->reference(induction.base),
+                                                   this->astCtxt->bvmul(this->astCtxt->bv(induction.count, reg.getBitSize()), induction.step)
+                                                 );
+
+          const SharedSymbolicExpression& se = this->newSymbolicExpression(node, REGISTER_EXPRESSION, "Loop induction");
+          se->isTainted = expr->isTainted;
+          this->indexSymbolicExpression(se);
+          this->assignSymbolicExpressionToRegister(se, reg);
+
+          if (std::find(summary.inductions.begin(), summary.inductions.end(), previous.first) == summary.inductions.end())
+            summary.inductions.push_back(previous.first);
+        }
+      }
+
+
+      void SymbolicEngine::summarizeLoop(const triton::arch::Instruction& inst) {
+        if (inst.isBranch() == false)
+          return;
+
+        /* The inductions are read from the expressions of the parents */
+        this->materializeSubRegisters();
+
+        triton::uint64 addr   = inst.getAddress();
+        triton::uint64 target = static_cast<triton::uint64>(this->architecture->getConcreteRegisterValue(this->architecture->getProgramCounter()));
+        auto it               = this->loops.find(addr);
+
+        /* Going forward from the back-edge leaves the loop */
+        if (target > addr) {
+          if (it != this->loops.end())
+            this->loops.erase(it);
+          return;
+        }
+
+        if (it == this->loops.end()) {
+          LoopState loop;
+          loop.summary = this->loopSummaries.size();
+          loop.entryId = this->uniqueSymExprId;
+          it = this->loops.emplace(addr, std::move(loop)).first;
+          this->loopSummaries.push_back({addr, target, 0, 0, {}, false});
+        }
+
+        LoopState& loop = it->second;
+        LoopSummary& summary = this->loopSummaries[loop.summary];
+        summary.iterations++;
+
+        /* The constraint of the branch, if it is a conditional one which has been recorded */
+        triton::ast::SharedAbstractNode predicate = nullptr;
+        if (!this->pathConstraints->empty()) {
+          const PathConstraint& pco = this->pathConstraints->back();
+          if (pco.isMultipleBranches() && pco.getSourceAddress() == addr)
+            predicate = pco.getTakenPredicate();
+        }
+
+        /* The constraint of an iteration is implied if it is concrete, or only over the variables pinned by the loop */
+        if (summary.iterations > 1 && predicate != nullptr) {
+          if (predicate->isSymbolized() == false || this->isPinned(loop, predicate)) {
+            this->popPathConstraint();
+            summary.constraints++;
+          }
+
+          /* Unrolled up to the bound, the variables of the condition keep their concrete value from now on */
+          else if (summary.iterations > this->loopUnrollBound) {
+            this->popPathConstraint();
+            this->pinVariables(loop, predicate);
+            summary.constraints++;
+            summary.concretized = true;
+          }
+        }
+
+        if (summary.iterations > 1) {
+          this->summarizeInductions(loop, summary);
+
+          /* The registers of the iterations only over pinned variables are concrete */
+          if (summary.concretized) {
+            for (triton::uint32 id = 0; id < this->numberOfRegisters; id++) {
+              const SharedSymbolicExpression& expr = this->symbolicReg[id];
+              if (expr != nullptr && expr->getId() >= loop.entryId && expr->getAst()->isSymbolized() && this->isPinned(loop, expr->getAst()))
+                this->concretizeRegister(this->architecture->getRegister(triton::arch::register_e(id)));
+            }
+          }
+        }
+
+        loop.previous.clear();
+        for (triton::uint32 id = 0; id < this->numberOfRegisters; id++) {
+          if (this->symbolicReg[id] != nullptr)
+            loop.previous[triton::arch::register_e(id)] = this->symbolicReg[id];
+        }
+      }
+
+
+      void SymbolicEngine::setLoopUnrollBound(triton::usize bound) {
+        this->loopUnrollBound = bound;
+      }
+
+
+      triton::usize SymbolicEngine::getLoopUnrollBound(void) const {
+        return this->loopUnrollBound;
+      }
+
+
+      const std::vector<LoopSummary>& SymbolicEngine::getLoopSummaries(void) const {
+        return this->loopSummaries;
+      }
+
+
+      void SymbolicEngine::clearLoopSummaries(void) {
+        this->loopSummaries.clear();
+        this->loops.clear();
+      }
+
+
+      void SymbolicEngine::setPointerResolutionBound(triton::usize bound) {
+        this->pointerResolutionBound = bound;
+      }
+
+
+      triton::usize SymbolicEngine::getPointerResolutionBound(void) const {
+        return this->pointerResolutionBound;
+      }
+
+
+      void SymbolicEngine::setPointerResolver(const PointerResolver& resolver) {
+        this->pointerResolver = resolver;
+      }
+
     }; /* symbolic namespace */
   }; /* engines namespace */
 }; /*triton namespace */
@@ -10,6 +10,7 @@
 #include <sstream>
 
 #include <triton/ast.hpp>
+#include <triton/astCRepresentation.hpp>
 #include <triton/astContext.hpp>
 #include <triton/astRepresentation.hpp>
 #include <triton/exceptions.hpp>
@@ -27,17 +28,21 @@ namespace triton {
         : originMemory(),
           originRegister() {
         this->ast           = node;
-        this->comment       = comment;
+        this->comment       = nullptr;
         this->address       = -1;
         this->id            = id;
         this->isTainted     = false;
         this->type          = type;
+
+        if (!comment.empty())
+          this->comment = std::make_shared<const std::string>(comment);
       }
 
 
       SymbolicExpression::SymbolicExpression(const SymbolicExpression& other) {
         this->ast            = other.ast;
         this->comment        = other.comment;
+        this->disassembly    = other.disassembly;
         this->id             = other.id;
         this->isTainted      = other.isTainted;
         this->originMemory   = other.originMemory;
@@ -50,6 +55,7 @@ namespace triton {
       SymbolicExpression& SymbolicExpression::operator=(const SymbolicExpression& other) {
         this->ast            = other.ast;
         this->comment        = other.comment;
+        this->disassembly    = other.disassembly;
         this->id             = other.id;
         this->isTainted      = other.isTainted;
         this->originMemory   = other.originMemory;
@@ -74,8 +80,14 @@ namespace triton {
       }
 
 
+      /* The value of the unset comment and disassembly */
+      static const std::string emptyString;
+
+
       const std::string& SymbolicExpression::getComment(void) const {
-        return this->comment;
+        if (this->comment == nullptr)
+          return emptyString;
+        return *this->comment;
       }
 
 
@@ -94,6 +106,9 @@ namespace triton {
         else if (ast->getContext()->getRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION)
           return "ref_" + std::to_string(this->id);
 
+        else if (ast->getContext()->getRepresentationMode() == triton::ast::representations::C_REPRESENTATION)
+          return "ref_" + std::to_string(this->id);
+
         else if (ast->getContext()->getRepresentationMode() == triton::ast::representations::PCODE_REPRESENTATION) {
           if (this->isMemory()) {
             auto mem = this->getOriginMemory();
@@ -130,6 +145,9 @@ namespace triton {
           case triton::ast::representations::PYTHON_REPRESENTATION:
             return "# " + this->getComment();
 
+          case triton::ast::representations::C_REPRESENTATION:
+            return "// " + this->getComment();
+
           default:
             throw triton::exceptions::SymbolicExpression("SymbolicExpression::getFormattedComment(): Invalid AST representation mode.");
         };
@@ -171,6 +189,9 @@ namespace triton {
           case triton::ast::representations::PYTHON_REPRESENTATION:
             stream << this->getFormattedId() << " = " << this->getAst();
             break;
+          case triton::ast::representations::C_REPRESENTATION:
+            stream << "const " << triton::ast::representations::AstCRepresentation::getType(this->getAst().get()) << " " << this->getFormattedId() << " = " << this->getAst() << ";";
+            break;
 
           default:
             throw triton::exceptions::SymbolicExpression("SymbolicExpression::getFormattedExpression(): Invalid AST representation mode.");
@@ -220,10 +241,22 @@ namespace triton {
         if (!old || !old->canReplaceNodeWithoutUpdate(ast)) {
           this->ast->initParents();
         }
+        else {
+          /* The references may not have the known bits of the new node */
+          this->ast->getContext()->forgetAbstractValues();
+        }
       }
 
 
       void SymbolicExpression::setComment(const std::string& comment) {
+        if (comment.empty())
+          this->comment = nullptr;
+        else
+          this->comment = std::make_shared<const std::string>(comment);
+      }
+
+
+      void SymbolicExpression::setComment(const std::shared_ptr<const std::string>& comment) {
         this->comment = comment;
       }
 
@@ -271,12 +304,22 @@ namespace triton {
 
 
       void SymbolicExpression::writeBackDisassembly(const std::string& disassembly) {
+        if (disassembly.empty())
+          this->disassembly = nullptr;
+        else
+          this->disassembly = std::make_shared<const std::string>(disassembly);
+      }
+
+
+      void SymbolicExpression::writeBackDisassembly(const std::shared_ptr<const std::string>& disassembly) {
         this->disassembly = disassembly;
       }
 
 
       const std::string& SymbolicExpression::getDisassembly(void) {
-        return this->disassembly;
+        if (this->disassembly == nullptr)
+          return emptyString;
+        return *this->disassembly;
       }
 
 
@@ -0,0 +1,218 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <iterator>
+
+#include <triton/memoryResource.hpp>
+#include <triton/symbolicMemory.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      /* The expression returned for the concrete cells */
+      static const SharedSymbolicExpression noExpression = nullptr;
+
+
+      SymbolicMemory::SymbolicMemory() {
+        this->resource = nullptr;
+        this->size     = 0;
+      }
+
+
+      SymbolicMemory::Page& SymbolicMemory::mutatePage(std::shared_ptr<Page>& page) {
+        if (page.use_count() > 1)
+          page = triton::utils::allocateShared<Page>(this->resource, *page);
+        return *page;
+      }
+
+
+      const SharedSymbolicExpression& SymbolicMemory::getCell(triton::uint64 addr) const {
+        auto it = this->pages.find(addr / pageSize);
+        if (it == this->pages.end())
+          return noExpression;
+        return it->second->cells[addr % pageSize];
+      }
+
+
+      void SymbolicMemory::setCell(triton::uint64 addr, const SharedSymbolicExpression& expr) {
+        if (expr == nullptr)
+          return this->removeCell(addr);
+
+        auto& page = this->pages[addr / pageSize];
+        if (page == nullptr)
+          page = triton::utils::allocateShared<Page>(this->resource);
+
+        Page& cells = this->mutatePage(page);
+        auto& cell  = cells.cells[addr % pageSize];
+        if (cell == nullptr) {
+          cells.used++;
+          this->size++;
+        }
+        cell = expr;
+      }
+
+
+      void SymbolicMemory::removeCell(triton::uint64 addr) {
+        auto it = this->pages.find(addr / pageSize);
+        if (it == this->pages.end() || it->second->cells[addr % pageSize] == nullptr)
+          return;
+
+        /* An empty page is released instead of being copied */
+        if (it->second->used == 1) {
+          this->pages.erase(it);
+        }
+        else {
+          Page& cells = this->mutatePage(it->second);
+          cells.cells[addr % pageSize] = nullptr;
+          cells.used--;
+        }
+        this->size--;
+      }
+
+
+      triton::usize SymbolicMemory::getSize(void) const {
+        return this->size;
+      }
+
+
+      std::vector<triton::uint64> SymbolicMemory::getAddresses(triton::uint64 addr, triton::uint64 size) const {
+        std::vector<triton::uint64> addrs;
+
+        if (size == 0)
+          return addrs;
+
+        triton::uint64 first = addr / pageSize;
+        triton::uint64 last  = (addr + (size - 1)) / pageSize;
+
+        /* Visit the pages of the area if they are fewer than the allocated ones */
+        if (first <= last && last - first < this->pages.size()) {
+          for (triton::uint64 index = first; index <= last; index++) {
+            auto it = this->pages.find(index);
+            if (it == this->pages.end())
+              continue;
+            for (triton::uint32 offset = 0; offset < pageSize; offset++) {
+              triton::uint64 cell = index * pageSize + offset;
+              if (it->second->cells[offset] != nullptr && cell - addr < size)
+                addrs.push_back(cell);
+            }
+          }
+          return addrs;
+        }
+
+        for (const auto& page : this->pages) {
+          for (triton::uint32 offset = 0; offset < pageSize; offset++) {
+            triton::uint64 cell = page.first * pageSize + offset;
+            if (page.second->cells[offset] != nullptr && cell - addr < size)
+              addrs.push_back(cell);
+          }
+        }
+
+        return addrs;
+      }
+
+
+      std::unordered_map<triton::uint64, SharedSymbolicExpression> SymbolicMemory::getCells(void) const {
+        std::unordered_map<triton::uint64, SharedSymbolicExpression> cells;
+
+        cells.reserve(this->size);
+        for (const auto& page : this->pages) {
+          for (triton::uint32 offset = 0; offset < pageSize; offset++) {
+            if (page.second->cells[offset] != nullptr)
+              cells.emplace(page.first * pageSize + offset, page.second->cells[offset]);
+          }
+        }
+
+        return cells;
+      }
+
+
+      bool SymbolicMemory::forEachCell(const std::function<bool(triton::uint64, const SharedSymbolicExpression&)>& fn) const {
+        for (const auto& page : this->pages) {
+          for (triton::uint32 offset = 0; offset < pageSize; offset++) {
+            if (page.second->cells[offset] != nullptr && fn(page.first * pageSize + offset, page.second->cells[offset]) == false)
+              return false;
+          }
+        }
+        return true;
+      }
+
+
+      const SharedSymbolicExpression& SymbolicMemory::getInterval(triton::uint64 addr, triton::uint32 size) const {
+        auto it = this->intervals.find(addr);
+        if (it == this->intervals.end() || it->second.size != size)
+          return noExpression;
+        return it->second.expr;
+      }
+
+
+      const SharedSymbolicExpression& SymbolicMemory::findInterval(triton::uint64 addr, triton::uint64& start, triton::uint32& size) const {
+        /* Intervals are disjoint, only the last one starting at or before addr may contain it */
+        auto it = this->intervals.upper_bound(addr);
+        if (it == this->intervals.begin())
+          return noExpression;
+
+        it = std::prev(it);
+        if (addr - it->first >= it->second.size)
+          return noExpression;
+
+        start = it->first;
+        size  = it->second.size;
+        return it->second.expr;
+      }
+
+
+      void SymbolicMemory::setInterval(triton::uint64 addr, triton::uint32 size, const SharedSymbolicExpression& expr) {
+        this->removeIntervals(addr, size);
+        this->intervals[addr] = Interval{size, expr};
+      }
+
+
+      void SymbolicMemory::removeIntervals(triton::uint64 addr, triton::uint32 size) {
+        if (this->intervals.empty())
+          return;
+
+        /* Intervals are disjoint, only the previous one may start before the area */
+        auto it = this->intervals.lower_bound(addr);
+        if (it != this->intervals.begin()) {
+          auto prev = std::prev(it);
+          if (addr - prev->first < prev->second.size)
+            this->intervals.erase(prev);
+        }
+
+        while (it != this->intervals.end() && it->first - addr < size) {
+          it = this->intervals.erase(it);
+        }
+      }
+
+
+      bool SymbolicMemory::hasIntervals(void) const {
+        return !this->intervals.empty();
+      }
+
+
+      triton::usize SymbolicMemory::getMemoryBytes(void) const {
+        return this->pages.size() * (sizeof(Page) + sizeof(std::pair<const triton::uint64, std::shared_ptr<Page>>)) + this->intervals.size() * sizeof(std::pair<const triton::uint64, Interval>);
+      }
+
+
+      void SymbolicMemory::clear(void) {
+        this->pages.clear();
+        this->intervals.clear();
+        this->size = 0;
+      }
+
+
+      void SymbolicMemory::setMemoryResource(std::pmr::memory_resource* resource) {
+        this->resource = resource;
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
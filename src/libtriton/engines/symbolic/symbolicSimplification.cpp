@@ -7,13 +7,20 @@
 
 #include <list>
 #include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <triton/archEnums.hpp>
 #include <triton/context.hpp>
+#include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/mbaNormalizer.hpp>
 #include <triton/modesEnums.hpp>
 #include <triton/symbolicExpression.hpp>
 #include <triton/symbolicSimplification.hpp>
+#include <triton/tracing.hpp>
 
 
 
@@ -110,6 +117,36 @@ if __name__ == "__main__":
     print 'Simp: ', c
 ~~~~~~~~~~~~~
 
+\subsection SMT_simplification_native Simplification via native rewrite rules
+<hr>
+
+Rules can also be declared as patterns and run natively by a triton::ast::AstRewriter, which avoids a callback per node.
+The native rules are applied before the simplification callbacks. A name matches any node, a name starting with `#`
+matches a concrete node and commutative operators match both orders of their operands.
+
+~~~~~~~~~~~~~{.py}
+>>> ctx.addBuiltinRewriteRules()
+>>> ctx.addRewriteRule('(bvadd (bvand x y) (bvor x y))', '(bvadd x y)')
+>>> x = ctx.getAstContext().variable(ctx.newSymbolicVariable(8))
+>>> print(ctx.simplify((x + 1) + 2))
+(bvadd SymVar_0 (_ bv3 8))
+~~~~~~~~~~~~~
+
+\subsection SMT_simplification_mba Simplification of the linear MBA
+<hr>
+
+With the triton::modes::MBA_SIMPLIFICATION mode, the linear mixed boolean-arithmetic subtrees (sums of bitwise expressions
+multiplied by constants) are normalized by a triton::ast::MbaNormalizer after the native rules. Their coefficients over the
+conjunctions of their atoms are computed without a solver and the subtree is rebuilt from them when it is smaller.
+
+~~~~~~~~~~~~~{.py}
+>>> ctx.setMode(MODE.MBA_SIMPLIFICATION, True)
+>>> x = ctx.getAstContext().variable(ctx.newSymbolicVariable(8))
+>>> y = ctx.getAstContext().variable(ctx.newSymbolicVariable(8))
+>>> print(ctx.simplify((x ^ y) + 2 * (x & y)))
+(bvadd SymVar_0 SymVar_1)
+~~~~~~~~~~~~~
+
 \subsection SMT_simplification_z3 Simplification via Z3
 <hr>
 
@@ -163,6 +200,160 @@ namespace triton {
     namespace symbolic {
 
 
+      /* The locations of a region: the bits of the parent registers and the bytes of memory */
+      struct DeadStoreLocations {
+        std::map<triton::arch::register_e, triton::uint512> registers;
+        std::set<triton::uint64> memory;
+      };
+
+
+      /* The locations written and read by an instruction */
+      struct DeadStoreEffects {
+        DeadStoreLocations defs;
+        DeadStoreLocations uses;
+      };
+
+
+      /* Returns the mask of the bits [high:low] */
+      static triton::uint512 getBitMask(triton::uint32 high, triton::uint32 low) {
+        triton::uint512 mask = 0;
+        mask = ~mask >> (511 - high);
+        return (mask >> low) << low;
+      }
+
+
+      /* Adds the bits [high:low] of a parent register to `locations` */
+      static void addRegister(DeadStoreLocations& locations, triton::arch::register_e parent, triton::uint32 high, triton::uint32 low) {
+        locations.registers[parent] |= getBitMask(high, low);
+      }
+
+
+      /* Adds the bytes of a memory access to `locations` */
+      static void addMemory(DeadStoreLocations& locations, const triton::arch::MemoryAccess& mem) {
+        for (triton::uint32 i = 0; i < mem.getSize(); i++)
+          locations.memory.insert(mem.getAddress() + i);
+      }
+
+
+      /* Adds `src` to `dst` */
+      static void mergeLocations(DeadStoreLocations& dst, const DeadStoreLocations& src) {
+        for (const auto& reg : src.registers)
+          dst.registers[reg.first] |= reg.second;
+        dst.memory.insert(src.memory.begin(), src.memory.end());
+      }
+
+
+      /* Removes `src` from `dst` */
+      static void removeLocations(DeadStoreLocations& dst, const DeadStoreLocations& src) {
+        for (const auto& reg : src.registers) {
+          auto it = dst.registers.find(reg.first);
+          if (it != dst.registers.end()) {
+            it->second ^= (it->second & reg.second);
+            if (it->second == 0)
+              dst.registers.erase(it);
+          }
+        }
+        for (triton::uint64 addr : src.memory)
+          dst.memory.erase(addr);
+      }
+
+
+      /* Returns true if `a` and `b` share a location */
+      static bool intersectLocations(const DeadStoreLocations& a, const DeadStoreLocations& b) {
+        for (const auto& reg : b.registers) {
+          auto it = a.registers.find(reg.first);
+          if (it != a.registers.end() && (it->second & reg.second) != 0)
+            return true;
+        }
+        for (triton::uint64 addr : b.memory) {
+          if (a.memory.count(addr))
+            return true;
+        }
+        return false;
+      }
+
+
+      /*
+       * Adds to `uses` the origins of the expressions referenced by `node`. The references are
+       * not unrolled, except those to the expressions of the instruction itself (`own`).
+       */
+      static void addReferences(const triton::ast::SharedAbstractNode& node,
+                                const std::unordered_set<triton::usize>& own,
+                                std::unordered_set<const triton::ast::AbstractNode*>& visited,
+                                DeadStoreLocations& uses) {
+        std::vector<triton::ast::AbstractNode*> worklist = {node.get()};
+
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+          worklist.pop_back();
+
+          if (current == nullptr || visited.insert(current).second == false)
+            continue;
+
+          if (current->getType() == triton::ast::REFERENCE_NODE) {
+            const auto& expr = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getSymbolicExpression();
+            if (own.count(expr->getId()))
+              worklist.push_back(expr->getAst().get());
+            else if (expr->isRegister())
+              addRegister(uses, expr->getOriginRegister().getParent(), expr->getOriginRegister().getHigh(), expr->getOriginRegister().getLow());
+            else if (expr->isMemory())
+              addMemory(uses, expr->getOriginMemory());
+            continue;
+          }
+
+          for (const auto& child : current->getChildren())
+            worklist.push_back(child.get());
+        }
+      }
+
+
+      /* Returns the locations written and read by an instruction */
+      static DeadStoreEffects getEffects(const triton::arch::Architecture* architecture, triton::arch::Instruction& inst) {
+        std::unordered_set<const triton::ast::AbstractNode*> visited;
+        std::unordered_set<triton::usize> own;
+        DeadStoreEffects effects;
+
+        for (const auto& se : inst.symbolicExpressions)
+          own.insert(se->getId());
+
+        for (const auto& reg : inst.getWrittenRegisters()) {
+          const triton::arch::Register& parent = architecture->getParentRegister(reg.first);
+          /* A write of a dword zero-extends its qword parent */
+          if (reg.first.getSize() == triton::size::dword && parent.getSize() == triton::size::qword)
+            addRegister(effects.defs, parent.getId(), parent.getHigh(), parent.getLow());
+          else
+            addRegister(effects.defs, parent.getId(), reg.first.getHigh(), reg.first.getLow());
+          addReferences(reg.second, own, visited, effects.uses);
+        }
+
+        for (const auto& mem : inst.getStoreAccess()) {
+          addMemory(effects.defs, mem.first);
+          addReferences(mem.second, own, visited, effects.uses);
+          /* Keep instructions that build effective addresses (see #1174) */
+          if (mem.first.getLeaAst())
+            addReferences(mem.first.getLeaAst(), own, visited, effects.uses);
+        }
+
+        for (const auto& reg : inst.getReadRegisters())
+          addRegister(effects.uses, reg.first.getParent(), reg.first.getHigh(), reg.first.getLow());
+
+        for (const auto& mem : inst.getLoadAccess()) {
+          addMemory(effects.uses, mem.first);
+          addReferences(mem.second, own, visited, effects.uses);
+          if (mem.first.getLeaAst())
+            addReferences(mem.first.getLeaAst(), own, visited, effects.uses);
+        }
+
+        return effects;
+      }
+
+
+      /* Returns true if the instruction was processed */
+      static bool isLifted(triton::arch::Instruction& inst) {
+        return !inst.getWrittenRegisters().empty() || !inst.getStoreAccess().empty();
+      }
+
+
       SymbolicSimplification::SymbolicSimplification(triton::arch::Architecture* architecture, triton::callbacks::Callbacks* callbacks) {
         this->architecture = architecture;
         this->callbacks = callbacks;
@@ -177,137 +368,246 @@ namespace triton {
       void SymbolicSimplification::copy(const SymbolicSimplification& other) {
         this->architecture = other.architecture;
         this->callbacks = other.callbacks;
+        this->rewriter = other.rewriter;
+        this->memo.clear();
+      }
+
+
+      triton::ast::AstRewriter& SymbolicSimplification::getAstRewriter(void) {
+        return this->rewriter;
+      }
+
+
+      triton::engines::symbolic::SimplificationMemo& SymbolicSimplification::getSimplificationMemo(void) const {
+        return this->memo;
+      }
+
+
+      triton::usize SymbolicSimplification::getSignature(const triton::ast::SharedAbstractNode& node) const {
+        /* Each version only increases, so does their sum */
+        triton::usize signature = this->rewriter.getVersion() + node->getContext()->getModes()->getVersion();
+
+        if (this->callbacks)
+          signature += this->callbacks->getSymbolicSimplificationVersion();
+
+        return signature;
       }
 
 
       triton::ast::SharedAbstractNode SymbolicSimplification::simplify(const triton::ast::SharedAbstractNode& node) const {
+        TRITON_TRACE("simplification", "SymbolicSimplification::simplify");
+
         std::list<triton::ast::SharedAbstractNode> worklist;
         triton::ast::SharedAbstractNode snode = node;
 
         if (node == nullptr)
           throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::simplify(): node cannot be null.");
 
-        if (this->callbacks && this->callbacks->isDefined(triton::callbacks::SYMBOLIC_SIMPLIFICATION)) {
-          snode = this->callbacks->processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, node);
+        bool callbacks = (this->callbacks && this->callbacks->isDefined(triton::callbacks::SYMBOLIC_SIMPLIFICATION));
+        bool mba = node->getContext()->getModes()->isModeEnabled(triton::modes::MBA_SIMPLIFICATION);
+        if (this->rewriter.getRulesSize() == 0 && callbacks == false && mba == false)
+          return snode;
+
+        /* The shared subtrees already simplified are given back as they were */
+        this->memo.validate(this->getSignature(node));
+        if (auto result = this->memo.find(node))
+          return result;
+
+        /* The native rules are applied first, without modifying the node */
+        if (this->rewriter.getRulesSize())
+          snode = this->rewriter.rewrite(node);
+
+        /* Then the linear MBA subtrees are normalized */
+        if (mba)
+          snode = triton::ast::MbaNormalizer().normalize(snode);
+
+        if (callbacks) {
+          /* The children already simplified during this call, kept alive so that their addresses are not reused */
+          std::unordered_map<const triton::ast::AbstractNode*, std::pair<triton::ast::SharedAbstractNode, triton::ast::SharedAbstractNode>> done;
+
+          snode = this->callbacks->processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, snode);
           /*
            *  We use a worklist strategy to avoid recursive calls
            *  and so stack overflow when going through a big AST.
+           *  The replaced nodes are only marked dirty, so that each
+           *  ancestor is initialized once when the worklist is empty.
            */
           worklist.push_back(snode);
           while (worklist.size()) {
             auto ast = worklist.front();
             worklist.pop_front();
-            bool needs_update = false;
             for (triton::uint32 index = 0; index < ast->getChildren().size(); index++) {
               auto child = ast->getChildren()[index];
               /* Don't apply simplification on nodes like String, Integer, etc. */
               if (child->getBitvectorSize()) {
-                auto schild = this->callbacks->processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, child);
-                ast->setChild(index, schild);
-                needs_update |= !schild->canReplaceNodeWithoutUpdate(child);
-                worklist.push_back(schild);
+                auto it = done.find(child.get());
+                if (it != done.end()) {
+                  ast->setChild(index, it->second.second, false);
+                  continue;
+                }
+                /* A memoized result is already simplified, it is not visited again */
+                auto schild = this->memo.find(child);
+                if (schild == nullptr) {
+                  schild = this->callbacks->processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, child);
+                  worklist.push_back(schild);
+                }
+                done.emplace(child.get(), std::make_pair(child, schild));
+                ast->setChild(index, schild, false);
               }
             }
-            if (needs_update) {
-              ast->init(true);
-            }
           }
+          snode->getContext()->initDirtyNodes();
+
+          /* The hashes are final once the dirty nodes are initialized */
+          for (const auto& item : done)
+            this->memo.insert(item.second.first, item.second.second);
         }
 
+        this->memo.insert(node, snode);
         return snode;
       }
 
 
       triton::arch::BasicBlock SymbolicSimplification::simplify(const triton::arch::BasicBlock& block, bool padding) const {
-        return this->deadStoreElimination(block, padding);
-      }
+        TRITON_TRACE("simplification", "SymbolicSimplification::deadStoreElimination");
 
+        return this->deadStoreElimination({block}, padding).front();
+      }
 
-      triton::arch::BasicBlock SymbolicSimplification::deadStoreElimination(const triton::arch::BasicBlock& block, bool padding) const {
-        std::unordered_map<triton::usize, SharedSymbolicExpression> lifetime;
-        std::map<triton::uint64, triton::arch::Instruction> instructions;
-        triton::arch::BasicBlock out;
-        triton::arch::BasicBlock in = block;
 
-        if (block.getSize() == 0)
-          return {};
+      std::vector<triton::arch::BasicBlock> SymbolicSimplification::simplify(const std::vector<triton::arch::BasicBlock>& region, bool padding) const {
+        TRITON_TRACE("simplification", "SymbolicSimplification::deadStoreElimination");
 
-        /* Define a temporary Context */
-        triton::Context tmpctx(this->architecture->getArchitecture());
+        return this->deadStoreElimination(region, padding);
+      }
 
-        /* Synch the concrete state */
-        tmpctx.setConcreteState(*this->architecture);
 
-        /* Execute the block */
-        tmpctx.processing(in);
+      std::vector<triton::arch::BasicBlock> SymbolicSimplification::deadStoreElimination(const std::vector<triton::arch::BasicBlock>& region, bool padding) const {
+        std::vector<triton::arch::BasicBlock> blocks = region;
+        std::vector<triton::arch::BasicBlock> out(region.size());
+        const triton::arch::Register& pc = this->architecture->getProgramCounter();
+        triton::usize count = blocks.size();
 
-        /* Get all symbolic registers that were written */
-        for (auto& reg : tmpctx.getSymbolicRegisters()) {
-          for (auto& item : tmpctx.sliceExpressions(reg.second)) {
-            lifetime[item.first] = item.second;
+        /* Lift the region once on a temporary context if it was not processed yet */
+        bool lifted = true;
+        for (auto& block : blocks) {
+          for (auto& inst : block.getInstructions())
+            lifted = lifted && isLifted(inst);
+        }
+        if (!lifted) {
+          triton::Context tmpctx(this->architecture->getArchitecture());
+          tmpctx.setConcreteState(*this->architecture);
+          for (auto& block : blocks) {
+            if (block.getSize())
+              tmpctx.processing(block, block.getFirstAddress());
           }
         }
 
-        /* Get all symbolic memory cells that were written */
-        for (auto& mem : tmpctx.getSymbolicMemory()) {
-          for (auto& item : tmpctx.sliceExpressions(mem.second)) {
-            lifetime[item.first] = item.second;
+        /* The effects of the instructions, the universe being all the locations written by the region */
+        std::vector<std::vector<DeadStoreEffects>> effects(count);
+        std::unordered_map<triton::uint64, triton::usize> starts;
+        DeadStoreLocations universe;
+        DeadStoreLocations pcLocation;
+
+        addRegister(pcLocation, pc.getId(), pc.getHigh(), pc.getLow());
+        for (triton::usize b = 0; b < count; b++) {
+          if (blocks[b].getSize() == 0)
+            continue;
+          starts.emplace(blocks[b].getFirstAddress(), b);
+          for (auto& inst : blocks[b].getInstructions()) {
+            effects[b].push_back(getEffects(this->architecture, inst));
+            mergeLocations(universe, effects[b].back().defs);
           }
         }
 
-        /* Keep instructions that build effective addresses (see #1174) */
-        for (auto& inst : in.getInstructions()) {
-          std::set<std::pair<triton::arch::MemoryAccess, triton::ast::SharedAbstractNode>> access;
-          if (inst.isMemoryWrite()) {
-            access = inst.getStoreAccess();
-          }
-          if (inst.isMemoryRead()) {
-            access.insert(inst.getLoadAccess().begin(), inst.getLoadAccess().end());
-          }
-          for (const auto& x : access) {
-            auto refs = triton::ast::search(x.second, triton::ast::REFERENCE_NODE);
-            for (const auto& ref : refs) {
-              auto expr = reinterpret_cast<triton::ast::ReferenceNode*>(ref.get())->getSymbolicExpression();
-              auto eid = expr->getId();
-              lifetime[eid] = expr;
+        /* The successors of the blocks, a symbolic target or a target out of the region being an exit */
+        std::vector<std::vector<triton::usize>> successors(count);
+        std::vector<bool> exits(count, false);
+        for (triton::usize b = 0; b < count; b++) {
+          if (blocks[b].getSize() == 0)
+            continue;
+
+          auto& last = blocks[b].getInstructions().back();
+          std::vector<triton::uint64> targets;
+          if (last.isControlFlow()) {
+            triton::ast::SharedAbstractNode node = nullptr;
+            for (const auto& reg : last.getWrittenRegisters()) {
+              if (reg.first.getId() == pc.getId())
+                node = reg.second;
             }
-            if (x.first.getLeaAst()) {
-              auto refs = triton::ast::search(x.first.getLeaAst(), triton::ast::REFERENCE_NODE);
-              for (const auto& ref : refs) {
-                auto expr = reinterpret_cast<triton::ast::ReferenceNode*>(ref.get())->getSymbolicExpression();
-                auto eid = expr->getId();
-                lifetime[eid] = expr;
-              }
+            if (node && node->getType() == triton::ast::BV_NODE) {
+              targets.push_back(static_cast<triton::uint64>(node->evaluate()));
+            }
+            else if (node && node->getType() == triton::ast::ITE_NODE &&
+                     node->getChildren()[1]->getType() == triton::ast::BV_NODE &&
+                     node->getChildren()[2]->getType() == triton::ast::BV_NODE) {
+              targets.push_back(static_cast<triton::uint64>(node->getChildren()[1]->evaluate()));
+              targets.push_back(static_cast<triton::uint64>(node->getChildren()[2]->evaluate()));
+            }
+            else {
+              exits[b] = true;
             }
           }
-        }
+          else {
+            targets.push_back(last.getNextAddress());
+          }
 
-        /* Get back the origin assembly of expressions that still alive */
-        for (auto& se : lifetime) {
-          if (se.second->getDisassembly().empty()) {
-            continue;
+          for (triton::uint64 target : targets) {
+            auto it = starts.find(target);
+            if (it == starts.end())
+              exits[b] = true;
+            else
+              successors[b].push_back(it->second);
           }
-          auto addr = se.second->getAddress();
-          for (auto& inst : in.getInstructions()) {
-            if (inst.getAddress() == addr) {
-              instructions[addr] = inst;
-              break;
+        }
+
+        /* Backward liveness until a fixpoint, the program counter being live at the end of each block */
+        std::vector<DeadStoreLocations> liveIn(count);
+        std::vector<std::vector<bool>> kept(count);
+        bool changed = true;
+        while (changed) {
+          changed = false;
+          for (triton::usize b = count; b-- > 0;) {
+            DeadStoreLocations live = exits[b] ? universe : DeadStoreLocations();
+            for (triton::usize s : successors[b])
+              mergeLocations(live, liveIn[s]);
+            mergeLocations(live, pcLocation);
+
+            kept[b].assign(effects[b].size(), false);
+            for (triton::usize i = effects[b].size(); i-- > 0;) {
+              if (intersectLocations(live, effects[b][i].defs)) {
+                kept[b][i] = true;
+                removeLocations(live, effects[b][i].defs);
+                mergeLocations(live, effects[b][i].uses);
+              }
+            }
+
+            if (live.registers != liveIn[b].registers || live.memory != liveIn[b].memory) {
+              liveIn[b] = std::move(live);
+              changed = true;
             }
           }
         }
 
-        /* Create a new block with sorted instructions */
-        auto lastaddr = in.getFirstAddress();
-        auto nop = tmpctx.getNopInstruction();
-        for (auto& item : instructions) {
-          if (padding) {
-            while (item.second.getAddress() > lastaddr) {
-              out.add(nop);
-              lastaddr += nop.getSize();
+        /* Create the new blocks with the instructions kept */
+        auto nop = this->architecture->getNopInstruction();
+        for (triton::usize b = 0; b < count; b++) {
+          if (blocks[b].getSize() == 0)
+            continue;
+          auto lastaddr = blocks[b].getFirstAddress();
+          auto& instructions = blocks[b].getInstructions();
+          for (triton::usize i = 0; i < instructions.size(); i++) {
+            if (kept[b][i] == false)
+              continue;
+            if (padding) {
+              while (instructions[i].getAddress() > lastaddr) {
+                out[b].add(nop);
+                lastaddr += nop.getSize();
+              }
             }
+            out[b].add(instructions[i]);
+            lastaddr = instructions[i].getNextAddress();
           }
-          out.add(item.second);
-          lastaddr = item.second.getNextAddress();
         }
 
         return out;
@@ -0,0 +1,258 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <unordered_map>
+
+#include <triton/astContext.hpp>
+#include <triton/context.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicSummary.hpp>
+#include <triton/taintBitmap.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      SymbolicSummary::SymbolicSummary() {
+        this->first = 0;
+        this->count = 0;
+      }
+
+
+      SymbolicSummary SymbolicSummary::compute(triton::arch::architecture_e arch,
+                                               const triton::modes::SharedModes& modes,
+                                               const std::vector<triton::loaders::TraceRecord>& records,
+                                               triton::usize begin,
+                                               triton::usize end,
+                                               const std::vector<std::pair<triton::arch::register_e, triton::uint512>>& registers,
+                                               const std::function<triton::uint8(triton::uint64)>& memory) {
+        SymbolicSummary summary;
+        triton::Context ctx(arch);
+
+        /* The entry expression of each parent register */
+        std::unordered_map<triton::arch::register_e, SharedSymbolicExpression> entries;
+
+        /* The bytes symbolized or written by the segment, and the written ones */
+        triton::engines::taint::TaintBitmap seen;
+        triton::engines::taint::TaintBitmap written;
+
+        if (modes->isModeEnabled(triton::modes::MEMORY_ARRAY))
+          throw triton::exceptions::SymbolicEngine("SymbolicSummary::compute(): The MEMORY_ARRAY mode is not supported.");
+
+        summary.first = begin;
+        summary.count = end - begin;
+
+        /* The modes whose state spans several instructions would not cross the segments */
+        for (triton::uint32 i = triton::modes::ALIGNED_MEMORY; i <= triton::modes::TAINT_THROUGH_POINTERS; i++) {
+          triton::modes::mode_e mode = static_cast<triton::modes::mode_e>(i);
+          switch (mode) {
+            case triton::modes::LAZY_FLAGS:
+            case triton::modes::LAZY_SUBREGISTERS:
+            case triton::modes::LOOP_SUMMARIZATION:
+            case triton::modes::ONLY_ON_TAINTED:
+            case triton::modes::STATE_MERGING:
+            case triton::modes::TAINT_ONLY:
+              ctx.setMode(mode, false);
+              break;
+            default:
+              ctx.setMode(mode, modes->isModeEnabled(mode));
+              break;
+          }
+        }
+
+        for (const auto& reg : registers)
+          ctx.setConcreteRegisterValue(ctx.getRegister(reg.first), reg.second, false);
+
+        for (triton::usize i = 0; i <= begin && i < records.size(); i++) {
+          for (const auto& delta : records[i].registers)
+            ctx.setConcreteRegisterValue(ctx.getRegister(delta.first), delta.second, false);
+
+          for (const auto& delta : records[i].memory)
+            ctx.setConcreteMemoryAreaValue(delta.address, records[i].bytes.data() + delta.offset, delta.size, false);
+        }
+
+        for (const auto* reg : ctx.getParentRegisters()) {
+          if (reg->isMutable() == false)
+            continue;
+          const SharedSymbolicVariable& var = ctx.symbolizeRegister(*reg);
+          summary.inputs.push_back({var->getId(), {reg->getId(), 0}});
+          entries[reg->getId()] = ctx.getSymbolicRegister(*reg);
+        }
+
+        /* The loads read the concrete memory before building their AST */
+        ctx.addCallback(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, triton::callbacks::getConcreteMemoryValueCallback([&](triton::Context&, const triton::arch::MemoryAccess& mem) {
+          for (triton::usize i = 0; i < mem.getSize(); i++) {
+            triton::uint64 addr = mem.getAddress() + i;
+            if (seen.isTainted(addr))
+              continue;
+            if (!ctx.isConcreteMemoryValueDefined(addr))
+              ctx.setConcreteMemoryValue(addr, memory(addr), false);
+            /* Marked first, the symbolization reads the byte again */
+            seen.taint(addr);
+            const SharedSymbolicVariable& var = ctx.symbolizeMemory(triton::arch::MemoryAccess(addr, triton::size::byte));
+            summary.inputs.push_back({var->getId(), {triton::arch::ID_REG_INVALID, addr}});
+          }
+        }, &seen));
+
+        /* A delta changing a location still at its entry value comes from outside the trace */
+        auto setDeltas = [&](const triton::loaders::TraceRecord& record) {
+          triton::arch::CpuInterface* cpu = ctx.getCpuInstance();
+
+          for (const auto& delta : record.registers) {
+            const triton::arch::Register& reg = ctx.getRegister(delta.first);
+            const triton::arch::Register& parent = ctx.getParentRegister(reg);
+            if (ctx.getSymbolicRegister(parent) == entries[parent.getId()] && cpu->getConcreteRegisterValue(reg, false) != delta.second)
+              ctx.setConcreteRegisterValue(reg, delta.second, false);
+            else
+              cpu->setConcreteRegisterValue(reg, delta.second, false);
+          }
+
+          for (const auto& delta : record.memory) {
+            for (triton::usize i = 0; i < delta.size; i++) {
+              triton::uint64 addr = delta.address + i;
+              triton::uint8 value = record.bytes[delta.offset + i];
+              triton::uint8 current = ctx.isConcreteMemoryValueDefined(addr) ? cpu->getConcreteMemoryValue(addr, false) : memory(addr);
+              if (!written.isTainted(addr) && current != value) {
+                ctx.setConcreteMemoryValue(addr, value, false);
+                seen.taint(addr);
+                written.taint(addr);
+              }
+              else {
+                cpu->setConcreteMemoryValue(addr, value, false);
+              }
+            }
+          }
+        };
+
+        for (triton::usize i = begin; i < end; i++) {
+          const triton::loaders::TraceRecord& record = records[i];
+          if (i != begin)
+            setDeltas(record);
+
+          triton::arch::Instruction inst(record.address, record.opcode.data(), static_cast<triton::uint32>(record.opcode.size()));
+          ctx.processing(inst);
+
+          for (const auto& store : inst.getStoreAccess()) {
+            seen.taint(store.first.getAddress(), store.first.getSize());
+            written.taint(store.first.getAddress(), store.first.getSize());
+          }
+        }
+
+        /* A register still holding its entry expression is unchanged */
+        for (const auto* reg : ctx.getParentRegisters()) {
+          if (reg->isMutable() == false || ctx.getSymbolicRegister(*reg) == entries[reg->getId()])
+            continue;
+          summary.outputs.push_back({{reg->getId(), 0}, ctx.getRegisterAst(*reg), ctx.getConcreteRegisterValue(*reg, false)});
+        }
+
+        for (triton::uint64 addr : written) {
+          triton::arch::MemoryAccess mem(addr, triton::size::byte);
+          summary.outputs.push_back({{triton::arch::ID_REG_INVALID, addr}, ctx.getMemoryAst(mem), ctx.getConcreteMemoryValue(addr, false)});
+        }
+
+        summary.constraints = ctx.getPathConstraints();
+
+        return summary;
+      }
+
+
+      triton::usize SymbolicSummary::getFirstRecord(void) const {
+        return this->first;
+      }
+
+
+      triton::usize SymbolicSummary::getNumberOfRecords(void) const {
+        return this->count;
+      }
+
+
+      const std::vector<std::pair<triton::usize, SymbolicLocation>>& SymbolicSummary::getInputs(void) const {
+        return this->inputs;
+      }
+
+
+      const std::vector<SymbolicOutput>& SymbolicSummary::getOutputs(void) const {
+        return this->outputs;
+      }
+
+
+      const std::vector<triton::engines::symbolic::PathConstraint>& SymbolicSummary::getPathConstraints(void) const {
+        return this->constraints;
+      }
+
+
+      void SymbolicSummary::apply(triton::engines::symbolic::SymbolicEngine& engine, triton::arch::Architecture& arch, const triton::ast::SharedAstContext& astCtxt) const {
+        std::unordered_map<triton::usize, triton::ast::SharedAbstractNode> substitutions;
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+
+        /* The entry variables stand for the state left by the previous segments */
+        for (const auto& input : this->inputs) {
+          if (input.second.reg != triton::arch::ID_REG_INVALID)
+            substitutions[input.first] = engine.getRegisterAst(arch.getRegister(input.second.reg));
+          else
+            substitutions[input.first] = engine.getMemoryAst(triton::arch::MemoryAccess(input.second.address, triton::size::byte));
+        }
+
+        /* All the outputs are composed with the entry state before any is assigned */
+        for (const auto& output : this->outputs)
+          nodes.push_back(output.node);
+
+        for (const auto& pco : this->constraints) {
+          for (const auto& branch : pco.getBranchConstraints())
+            nodes.push_back(std::get<3>(branch));
+        }
+
+        std::vector<triton::ast::SharedAbstractNode> copies = astCtxt->import(nodes, substitutions);
+        triton::usize index = 0;
+
+        for (const auto& output : this->outputs) {
+          const triton::ast::SharedAbstractNode& node = copies[index++];
+
+          if (output.location.reg != triton::arch::ID_REG_INVALID) {
+            const triton::arch::Register& reg = arch.getRegister(output.location.reg);
+            if (node->isSymbolized())
+              engine.assignSymbolicExpressionToRegister(engine.newSymbolicExpression(node, REGISTER_EXPRESSION, "Trace summary"), reg);
+            else
+              engine.concretizeRegister(reg);
+            arch.setConcreteRegisterValue(reg, output.value, false);
+          }
+          else {
+            triton::arch::MemoryAccess mem(output.location.address, triton::size::byte);
+            if (node->isSymbolized())
+              engine.assignSymbolicExpressionToMemory(engine.newSymbolicExpression(node, MEMORY_EXPRESSION, "Trace summary"), mem);
+            else
+              engine.concretizeMemory(output.location.address);
+            arch.setConcreteMemoryValue(output.location.address, static_cast<triton::uint8>(output.value), false);
+          }
+        }
+
+        bool symbolizedOnly = astCtxt->getModes()->isModeEnabled(triton::modes::PC_TRACKING_SYMBOLIC);
+
+        for (const auto& pco : this->constraints) {
+          PathConstraint copy;
+          bool symbolized = false;
+
+          for (const auto& branch : pco.getBranchConstraints()) {
+            const triton::ast::SharedAbstractNode& node = copies[index++];
+            copy.addBranchConstraint(std::get<0>(branch), std::get<1>(branch), std::get<2>(branch), node);
+            symbolized |= node->isSymbolized();
+          }
+
+          if (symbolizedOnly && !symbolized)
+            continue;
+
+          copy.setThreadId(pco.getThreadId());
+          copy.setComment(pco.getComment());
+          engine.pushPathConstraint(copy);
+        }
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
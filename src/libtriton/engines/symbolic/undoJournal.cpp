@@ -0,0 +1,96 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/exceptions.hpp>
+#include <triton/undoJournal.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      void UndoJournal::Record::clear(void) {
+        this->registers.clear();
+        this->memory.clear();
+        this->bytes.clear();
+        this->memoryArray        = nullptr;
+        this->memoryArrayChanged = false;
+        this->pathConstraints    = 0;
+      }
+
+
+      UndoJournal::UndoJournal(triton::usize capacity) {
+        if (capacity == 0)
+          throw triton::exceptions::SymbolicEngine("UndoJournal::UndoJournal(): The capacity must be greater than zero.");
+
+        this->records.resize(capacity);
+        this->head    = 0;
+        this->size    = 0;
+        this->current = nullptr;
+      }
+
+
+      triton::usize UndoJournal::getCapacity(void) const {
+        return this->records.size();
+      }
+
+
+      triton::usize UndoJournal::getSize(void) const {
+        return this->size;
+      }
+
+
+      UndoJournal::Record& UndoJournal::openRecord(void) {
+        Record& record = this->records[this->head];
+
+        /* Overwrite the oldest record once full */
+        record.clear();
+
+        this->head = (this->head + 1) % this->records.size();
+        if (this->size < this->records.size())
+          this->size++;
+
+        this->current = &record;
+        return record;
+      }
+
+
+      void UndoJournal::closeRecord(void) {
+        this->current = nullptr;
+      }
+
+
+      UndoJournal::Record* UndoJournal::getCurrentRecord(void) const {
+        return this->current;
+      }
+
+
+      UndoJournal::Record& UndoJournal::popRecord(void) {
+        if (this->size == 0)
+          throw triton::exceptions::SymbolicEngine("UndoJournal::popRecord(): The journal is empty.");
+
+        this->current = nullptr;
+        this->head    = (this->head + this->records.size() - 1) % this->records.size();
+        this->size--;
+
+        return this->records[this->head];
+      }
+
+
+      void UndoJournal::clear(void) {
+        for (auto& record : this->records)
+          record.clear();
+
+        this->head    = 0;
+        this->size    = 0;
+        this->current = nullptr;
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,406 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <thread>
+
+#include <triton/astContext.hpp>
+#include <triton/enumerativeSynthesizer.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/synthesizer.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace synthesis {
+
+      /* The operators of the grammar */
+      static const triton::ast::ast_e unaryOperators[]  = {triton::ast::BVNEG_NODE, triton::ast::BVNOT_NODE};
+      static const triton::ast::ast_e binaryOperators[] = {triton::ast::BVADD_NODE, triton::ast::BVAND_NODE, triton::ast::BVMUL_NODE, triton::ast::BVOR_NODE, triton::ast::BVSUB_NODE, triton::ast::BVXOR_NODE};
+
+
+      /* Returns the milliseconds of a monotonic clock */
+      static triton::uint64 now(void) {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+      }
+
+
+      /* The pseudo random generator of the inputs, from a fixed seed so that the enumeration is reproducible */
+      static triton::uint64 nextInput(triton::uint64& state) {
+        triton::uint64 z = (state += 0x9e3779b97f4a7c15);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+      }
+
+
+      /* Returns the number of nodes of the tree of `node`, up to `limit` */
+      static triton::usize treeSize(const triton::ast::SharedAbstractNode& node, triton::usize limit) {
+        std::vector<triton::ast::AbstractNode*> worklist = {node.get()};
+        triton::usize count = 0;
+
+        while (!worklist.empty() && count < limit) {
+          auto ast = worklist.back();
+          worklist.pop_back();
+          count++;
+          for (const auto& child : ast->getChildren()) {
+            /* Don't count the nodes like String, Integer, etc. */
+            if (child->getBitvectorSize())
+              worklist.push_back(child.get());
+          }
+        }
+
+        return count;
+      }
+
+
+      EnumerativeSynthesizer::EnumerativeSynthesizer(triton::usize capacity)
+        : mask(0), capacity(capacity), refinements(0) {
+        #ifdef TRITON_Z3_INTERFACE
+        this->solver.setSolver(triton::engines::solver::SOLVER_Z3);
+        #endif
+      }
+
+
+      triton::usize EnumerativeSynthesizer::lanes(void) const {
+        return this->inputs.size();
+      }
+
+
+      triton::uint64 EnumerativeSynthesizer::hashOutputs(const triton::uint64* lanes, triton::usize count) {
+        triton::uint64 hash = 0x9e3779b97f4a7c15;
+
+        for (triton::usize i = 0; i < count; i++) {
+          hash ^= lanes[i];
+          hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9;
+          hash = (hash ^ (hash >> 27)) * 0x94d049bb133111eb;
+          hash ^= (hash >> 31);
+        }
+
+        return hash;
+      }
+
+
+      bool EnumerativeSynthesizer::isKnown(const triton::uint64* lanes, triton::uint64 hash) const {
+        auto it = this->classes.find(hash);
+        if (it == this->classes.end())
+          return false;
+
+        triton::usize count = this->lanes();
+        for (triton::uint32 index : it->second) {
+          if (std::equal(lanes, lanes + count, this->outputs.begin() + index * count))
+            return true;
+        }
+
+        return false;
+      }
+
+
+      void EnumerativeSynthesizer::evaluate(triton::ast::ast_e op, triton::uint32 left, triton::uint32 right, triton::uint64* out) const {
+        triton::usize count   = this->lanes();
+        const triton::uint64* a = this->outputs.data() + left * count;
+        const triton::uint64* b = this->outputs.data() + right * count;
+
+        switch (op) {
+          case triton::ast::BVNEG_NODE: for (triton::usize i = 0; i < count; i++) out[i] = (0 - a[i]) & this->mask; break;
+          case triton::ast::BVNOT_NODE: for (triton::usize i = 0; i < count; i++) out[i] = ~a[i] & this->mask; break;
+          case triton::ast::BVADD_NODE: for (triton::usize i = 0; i < count; i++) out[i] = (a[i] + b[i]) & this->mask; break;
+          case triton::ast::BVAND_NODE: for (triton::usize i = 0; i < count; i++) out[i] = a[i] & b[i]; break;
+          case triton::ast::BVMUL_NODE: for (triton::usize i = 0; i < count; i++) out[i] = (a[i] * b[i]) & this->mask; break;
+          case triton::ast::BVOR_NODE:  for (triton::usize i = 0; i < count; i++) out[i] = a[i] | b[i]; break;
+          case triton::ast::BVSUB_NODE: for (triton::usize i = 0; i < count; i++) out[i] = (a[i] - b[i]) & this->mask; break;
+          case triton::ast::BVXOR_NODE: for (triton::usize i = 0; i < count; i++) out[i] = a[i] ^ b[i]; break;
+          default:
+            throw triton::exceptions::SynthesizerEngine("EnumerativeSynthesizer::evaluate(): Invalid operator.");
+        }
+      }
+
+
+      bool EnumerativeSynthesizer::insert(const Term& term, const triton::uint64* lanes, triton::uint64 hash) {
+        if (this->terms.size() >= this->capacity || this->isKnown(lanes, hash))
+          return false;
+
+        this->classes[hash].push_back(static_cast<triton::uint32>(this->terms.size()));
+        this->terms.push_back(term);
+        this->outputs.insert(this->outputs.end(), lanes, lanes + this->lanes());
+        return true;
+      }
+
+
+      void EnumerativeSynthesizer::initInputs(triton::usize samples) {
+        triton::uint64 state = 0;
+
+        this->inputs.assign(samples, std::vector<triton::uint512>(this->vars.size()));
+        for (triton::usize i = 0; i < samples; i++) {
+          for (triton::usize v = 0; v < this->vars.size(); v++) {
+            if (i == 0)
+              this->inputs[i][v] = 0;
+            else if (i == 1)
+              this->inputs[i][v] = this->mask;
+            else if (i == 2)
+              this->inputs[i][v] = 1;
+            else
+              this->inputs[i][v] = nextInput(state) & this->mask;
+          }
+        }
+      }
+
+
+      triton::sint64 EnumerativeSynthesizer::enumerate(triton::usize maxSize, triton::usize threads, triton::uint64 deadline) {
+        triton::usize count = this->lanes();
+        std::vector<triton::usize> first = {0, 0};
+        std::vector<triton::uint64> lanes(count);
+
+        this->terms.clear();
+        this->outputs.clear();
+        this->classes.clear();
+
+        /* The leaves are the variables and the constant 1 */
+        for (triton::usize v = 0; v <= this->vars.size(); v++) {
+          Term term = {triton::ast::VARIABLE_NODE, static_cast<triton::uint32>(v), 0, 1};
+          for (triton::usize i = 0; i < count; i++)
+            lanes[i] = (v < this->vars.size()) ? static_cast<triton::uint64>(this->inputs[i][v]) : (1 & this->mask);
+
+          if (v == this->vars.size())
+            term.op = triton::ast::BV_NODE;
+
+          if (this->insert(term, lanes.data(), EnumerativeSynthesizer::hashOutputs(lanes.data(), count)) && lanes == this->target)
+            return static_cast<triton::sint64>(this->terms.size() - 1);
+        }
+        first.push_back(this->terms.size());
+
+        for (triton::usize size = 2; size <= maxSize; size++) {
+          /* The candidates of one operand, computed concurrently against the expressions of the smaller sizes */
+          struct Batch {
+            std::vector<Term> terms;
+            std::vector<triton::uint64> lanes;
+            std::vector<triton::uint64> hashes;
+          };
+
+          triton::usize jobs = first[size];
+          triton::usize remaining = this->capacity - std::min(this->capacity, this->terms.size());
+          std::vector<Batch> batches(jobs);
+          std::atomic<triton::usize> found(jobs);
+          std::atomic<triton::usize> produced(0);
+          std::atomic<bool> full(false);
+          std::atomic<bool> expired(false);
+
+          parallelFor(jobs, threads, [&](triton::usize job) {
+            std::vector<triton::uint64> tmp(count);
+            Batch& batch = batches[job];
+            triton::uint32 left = static_cast<triton::uint32>(job);
+            triton::uint32 leftSize = this->terms[left].size;
+            triton::usize tried = 0;
+
+            /* Returns false if the job must stop */
+            auto emit = [&](triton::ast::ast_e op, triton::uint32 right) {
+              if ((++tried & 0xff) == 0 && deadline && now() >= deadline)
+                expired = true;
+              if (expired || full || job > found)
+                return false;
+
+              this->evaluate(op, left, right, tmp.data());
+              triton::uint64 hash = EnumerativeSynthesizer::hashOutputs(tmp.data(), count);
+              if (this->isKnown(tmp.data(), hash))
+                return true;
+
+              batch.terms.push_back({op, left, right, static_cast<triton::uint32>(size)});
+              batch.lanes.insert(batch.lanes.end(), tmp.begin(), tmp.end());
+              batch.hashes.push_back(hash);
+              if (++produced > remaining)
+                full = true;
+
+              /* The following jobs are not needed anymore */
+              if (tmp == this->target) {
+                triton::usize current = found;
+                while (job < current && !found.compare_exchange_weak(current, job));
+                return false;
+              }
+              return true;
+            };
+
+            if (leftSize == size - 1) {
+              for (auto op : unaryOperators) {
+                if (!emit(op, left))
+                  return;
+              }
+              return;
+            }
+
+            /* The commutative operators only take the operands in one order */
+            triton::usize rightSize = size - 1 - leftSize;
+            for (triton::usize right = first[rightSize]; right < first[rightSize + 1]; right++) {
+              bool ordered = (leftSize < rightSize || (leftSize == rightSize && left <= right));
+              for (auto op : binaryOperators) {
+                if (op != triton::ast::BVSUB_NODE && !ordered)
+                  continue;
+                if (!emit(op, static_cast<triton::uint32>(right)))
+                  return;
+              }
+            }
+          });
+
+          if (expired)
+            return -1;
+
+          /* Merged in the order of the jobs, so that the result does not depend on the threads */
+          for (triton::usize job = 0; job < jobs && job <= found; job++) {
+            const Batch& batch = batches[job];
+            for (triton::usize i = 0; i < batch.terms.size(); i++) {
+              const triton::uint64* out = batch.lanes.data() + i * count;
+              if (this->insert(batch.terms[i], out, batch.hashes[i]) && std::equal(out, out + count, this->target.begin()))
+                return static_cast<triton::sint64>(this->terms.size() - 1);
+            }
+          }
+
+          first.push_back(this->terms.size());
+          if (full || this->terms.size() >= this->capacity)
+            return -1;
+        }
+
+        return -1;
+      }
+
+
+      triton::ast::SharedAbstractNode EnumerativeSynthesizer::build(triton::uint32 index, const triton::ast::SharedAstContext& actx) const {
+        const Term& term = this->terms[index];
+
+        switch (term.op) {
+          case triton::ast::VARIABLE_NODE: return this->vars[term.left];
+          case triton::ast::BV_NODE:       return actx->bv(1, this->vars[0]->getBitvectorSize());
+          case triton::ast::BVNEG_NODE:    return actx->bvneg(this->build(term.left, actx));
+          case triton::ast::BVNOT_NODE:    return actx->bvnot(this->build(term.left, actx));
+          case triton::ast::BVADD_NODE:    return actx->bvadd(this->build(term.left, actx), this->build(term.right, actx));
+          case triton::ast::BVAND_NODE:    return actx->bvand(this->build(term.left, actx), this->build(term.right, actx));
+          case triton::ast::BVMUL_NODE:    return actx->bvmul(this->build(term.left, actx), this->build(term.right, actx));
+          case triton::ast::BVOR_NODE:     return actx->bvor(this->build(term.left, actx), this->build(term.right, actx));
+          case triton::ast::BVSUB_NODE:    return actx->bvsub(this->build(term.left, actx), this->build(term.right, actx));
+          case triton::ast::BVXOR_NODE:    return actx->bvxor(this->build(term.left, actx), this->build(term.right, actx));
+          default:
+            throw triton::exceptions::SynthesizerEngine("EnumerativeSynthesizer::build(): Invalid operator.");
+        }
+      }
+
+
+      triton::sint32 EnumerativeSynthesizer::verify(const triton::ast::SharedAbstractNode& candidate, const triton::ast::SharedAbstractNode& node, triton::uint32 timeout) {
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        auto actx = node->getContext();
+
+        if (this->solver.isValid() == false)
+          return -1;
+
+        auto model = this->solver.getModel(actx->lnot(actx->equal(candidate, node)), &status, timeout);
+        if (status == triton::engines::solver::UNSAT)
+          return 1;
+
+        if (status != triton::engines::solver::SAT || this->refinements >= EnumerativeSynthesizer::maxRefinements)
+          return -1;
+
+        /* The counterexample becomes a new lane */
+        std::vector<triton::uint512> lane(this->vars.size(), 0);
+        for (triton::usize v = 0; v < this->vars.size(); v++) {
+          auto id = reinterpret_cast<triton::ast::VariableNode*>(this->vars[v].get())->getSymbolicVariable()->getId();
+          auto it = model.find(id);
+          if (it != model.end())
+            lane[v] = it->second.getValue();
+        }
+
+        this->inputs.push_back(lane);
+        this->refinements++;
+        return 0;
+      }
+
+
+      SynthesisResult EnumerativeSynthesizer::synthesize(const triton::ast::SharedAbstractNode& input, triton::usize maxSize, triton::usize timeout, triton::usize threads) {
+        SynthesisResult result;
+
+        if (input == nullptr)
+          throw triton::exceptions::SynthesizerEngine("EnumerativeSynthesizer::synthesize(): node cannot be null.");
+
+        result.setInput(input);
+
+        auto start    = std::chrono::system_clock::now();
+        auto deadline = timeout ? now() + timeout : 0;
+        auto node     = triton::ast::unroll(input);
+        auto actx     = node->getContext();
+        auto found    = triton::ast::search(node, triton::ast::VARIABLE_NODE);
+        auto bits     = node->getBitvectorSize();
+
+        this->vars.assign(found.begin(), found.end());
+        this->terms.clear();
+        this->outputs.clear();
+        this->classes.clear();
+        this->refinements = 0;
+
+        /* The expressions are on the variables of the node, of its size */
+        bool valid = (bits && bits <= 64 && this->vars.size());
+        for (const auto& var : this->vars)
+          valid = valid && var->getBitvectorSize() == bits;
+
+        /* Only the expressions smaller than the node are enumerated */
+        if (valid)
+          maxSize = std::min(maxSize, treeSize(node, maxSize + 1) - 1);
+
+        if (valid && maxSize) {
+          this->mask = (bits == 64) ? std::numeric_limits<triton::uint64>::max() : ((1ULL << bits) - 1);
+          this->initInputs(32);
+          threads = threads ? threads : std::max<triton::usize>(std::thread::hardware_concurrency(), 1);
+
+          while (true) {
+            auto values = actx->evaluateBatch(node, this->vars, this->inputs);
+            this->target.assign(values.size(), 0);
+            for (triton::usize i = 0; i < values.size(); i++)
+              this->target[i] = static_cast<triton::uint64>(values[i] & this->mask);
+
+            triton::sint64 index = this->enumerate(maxSize, threads, deadline);
+            if (index < 0)
+              break;
+
+            /* The solver is given the time left */
+            triton::uint32 left = 0;
+            if (deadline) {
+              triton::uint64 current = now();
+              if (current >= deadline)
+                break;
+              left = static_cast<triton::uint32>(deadline - current);
+            }
+
+            auto candidate = this->build(static_cast<triton::uint32>(index), actx);
+            auto verified  = this->verify(candidate, node, left);
+            if (verified == 1) {
+              result.setOutput(candidate);
+              result.setSuccess(true);
+            }
+            if (verified != 0)
+              break;
+          }
+        }
+
+        auto end = std::chrono::system_clock::now();
+        result.setTime(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+
+        return result;
+      }
+
+
+      triton::usize EnumerativeSynthesizer::getNumberOfTerms(void) const {
+        return this->terms.size();
+      }
+
+
+      triton::usize EnumerativeSynthesizer::getNumberOfRefinements(void) const {
+        return this->refinements;
+      }
+
+    };
+  };
+};
@@ -0,0 +1,397 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <fstream>
+#include <sstream>
+
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/synthesisCache.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace synthesis {
+
+      /* The first line of a cache file */
+      static const char* cacheHeader = "triton-synthesis-cache 1";
+
+
+      /* Mixes a word into both lanes of a key */
+      static void mixKey(SynthesisCache::Key& key, triton::uint64 value) {
+        auto finalize = [](triton::uint64 x) {
+          x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+          x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+          return x ^ (x >> 31);
+        };
+        key.first  = finalize(key.first ^ value);
+        key.second = finalize((key.second ^ ((value << 32) | (value >> 32))) + 0x9e3779b97f4a7c15ULL);
+      }
+
+
+      /* Returns the position of the symbolic variable of `node` in `vars`, or vars.size() if it is not there */
+      static triton::usize variablePosition(const triton::ast::SharedAbstractNode& node, const std::deque<triton::ast::SharedAbstractNode>& vars) {
+        triton::usize id = reinterpret_cast<triton::ast::VariableNode*>(node.get())->getSymbolicVariable()->getId();
+
+        for (triton::usize index = 0; index < vars.size(); index++) {
+          if (reinterpret_cast<triton::ast::VariableNode*>(vars[index].get())->getSymbolicVariable()->getId() == id)
+            return index;
+        }
+
+        return vars.size();
+      }
+
+
+      /* Returns the number of operands of an operator which can be part of a template, or 0 */
+      static triton::uint32 operatorArity(triton::ast::ast_e type) {
+        switch (type) {
+          case triton::ast::BSWAP_NODE:
+          case triton::ast::BVNEG_NODE:
+          case triton::ast::BVNOT_NODE:
+            return 1;
+
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVMUL_NODE:
+          case triton::ast::BVNAND_NODE:
+          case triton::ast::BVNOR_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVROL_NODE:
+          case triton::ast::BVROR_NODE:
+          case triton::ast::BVSDIV_NODE:
+          case triton::ast::BVSMOD_NODE:
+          case triton::ast::BVSREM_NODE:
+          case triton::ast::BVSUB_NODE:
+          case triton::ast::BVUDIV_NODE:
+          case triton::ast::BVUREM_NODE:
+          case triton::ast::BVXNOR_NODE:
+          case triton::ast::BVXOR_NODE:
+            return 2;
+
+          default:
+            return 0;
+        }
+      }
+
+
+      SynthesisCache::SynthesisCache() {
+        this->enabled = false;
+        this->hits    = 0;
+      }
+
+
+      SynthesisCache::Key SynthesisCache::getKey(const triton::ast::SharedAbstractNode& node, const std::deque<triton::ast::SharedAbstractNode>& vars, bool constant, bool opaque) {
+        std::unordered_map<const triton::ast::AbstractNode*, Key> hashes;
+
+        /* Children go before parents, the references being unrolled */
+        for (const auto& n : triton::ast::childrenExtraction(node, true /* unroll */, true /* revert */)) {
+          Key key = {0, 0};
+
+          switch (n->getType()) {
+            /* A variable is its position, so the key does not depend on the variables themselves */
+            case triton::ast::VARIABLE_NODE:
+              mixKey(key, triton::ast::VARIABLE_NODE);
+              mixKey(key, variablePosition(n, vars));
+              mixKey(key, n->getBitvectorSize());
+              break;
+
+            /* A reference is the node it refers to */
+            case triton::ast::REFERENCE_NODE:
+              key = hashes.at(reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression()->getAst().get());
+              break;
+
+            case triton::ast::INTEGER_NODE: {
+              triton::uint512 value = reinterpret_cast<triton::ast::IntegerNode*>(n.get())->getInteger();
+              mixKey(key, triton::ast::INTEGER_NODE);
+              for (triton::uint32 limb = 0; limb < 8; limb++)
+                mixKey(key, static_cast<triton::uint64>(value >> (limb * 64)));
+              break;
+            }
+
+            default:
+              mixKey(key, n->getType());
+              mixKey(key, n->getBitvectorSize());
+              if (n->getChildren().empty())
+                mixKey(key, n->getHash64());
+              for (const auto& child : n->getChildren()) {
+                const Key& sub = hashes.at(child.get());
+                mixKey(key, sub.first);
+                mixKey(key, sub.second);
+              }
+              break;
+          }
+
+          hashes[n.get()] = key;
+        }
+
+        Key key = hashes.at(node.get());
+
+        /* The variables and the flags select which synthesis is tried */
+        mixKey(key, vars.size());
+        for (const auto& var : vars)
+          mixKey(key, var->getBitvectorSize());
+
+        #ifdef TRITON_Z3_INTERFACE
+        mixKey(key, (constant ? 1 : 0) | (opaque ? 2 : 0) | 4);
+        #else
+        mixKey(key, 0);
+        #endif
+
+        return key;
+      }
+
+
+      bool SynthesisCache::encode(const triton::ast::SharedAbstractNode& node, const std::deque<triton::ast::SharedAbstractNode>& vars, Template& code) {
+        const auto& children = node->getChildren();
+        triton::ast::ast_e type = node->getType();
+
+        switch (type) {
+          case triton::ast::VARIABLE_NODE: {
+            triton::usize position = variablePosition(node, vars);
+            if (position == vars.size())
+              return false;
+            code.push_back(type);
+            code.push_back(position);
+            return true;
+          }
+
+          case triton::ast::BV_NODE: {
+            triton::uint512 value = node->evaluate();
+            triton::uint32 size   = node->getBitvectorSize();
+            code.push_back(type);
+            code.push_back(size);
+            for (triton::uint32 limb = 0; limb * 64 < size; limb++)
+              code.push_back(static_cast<triton::uint64>(value >> (limb * 64)));
+            return true;
+          }
+
+          case triton::ast::ZX_NODE:
+            code.push_back(type);
+            code.push_back(triton::ast::getInteger<triton::uint64>(children[0]));
+            return SynthesisCache::encode(children[1], vars, code);
+
+          default: {
+            triton::uint32 arity = operatorArity(type);
+            if (arity == 0 || arity != children.size())
+              return false;
+            code.push_back(type);
+            for (const auto& child : children) {
+              if (SynthesisCache::encode(child, vars, code) == false)
+                return false;
+            }
+            return true;
+          }
+        }
+      }
+
+
+      triton::ast::SharedAbstractNode SynthesisCache::decode(const triton::ast::SharedAstContext& actx, const Template& code, triton::usize& index, const std::deque<triton::ast::SharedAbstractNode>& vars) {
+        if (index >= code.size())
+          return nullptr;
+
+        auto type = static_cast<triton::ast::ast_e>(code[index++]);
+
+        switch (type) {
+          case triton::ast::VARIABLE_NODE: {
+            if (index >= code.size() || code[index] >= vars.size())
+              return nullptr;
+            auto var = reinterpret_cast<triton::ast::VariableNode*>(vars[code[index++]].get())->getSymbolicVariable();
+            return actx->variable(var);
+          }
+
+          case triton::ast::BV_NODE: {
+            if (index >= code.size() || code[index] == 0 || code[index] > triton::bitsize::max_supported)
+              return nullptr;
+            triton::uint32 size   = static_cast<triton::uint32>(code[index++]);
+            triton::uint512 value = 0;
+            for (triton::uint32 limb = 0; limb * 64 < size; limb++) {
+              if (index >= code.size())
+                return nullptr;
+              value |= triton::uint512(code[index++]) << (limb * 64);
+            }
+            return actx->bv(value, size);
+          }
+
+          case triton::ast::ZX_NODE: {
+            if (index >= code.size())
+              return nullptr;
+            triton::uint32 sizeExt = static_cast<triton::uint32>(code[index++]);
+            auto expr = SynthesisCache::decode(actx, code, index, vars);
+            if (expr == nullptr)
+              return nullptr;
+            return actx->zx(sizeExt, expr);
+          }
+
+          default:
+            break;
+        }
+
+        triton::uint32 arity = operatorArity(type);
+        if (arity == 0)
+          return nullptr;
+
+        auto x = SynthesisCache::decode(actx, code, index, vars);
+        if (x == nullptr)
+          return nullptr;
+
+        if (arity == 1) {
+          switch (type) {
+            case triton::ast::BSWAP_NODE: return actx->bswap(x);
+            case triton::ast::BVNEG_NODE: return actx->bvneg(x);
+            default:                      return actx->bvnot(x);
+          }
+        }
+
+        auto y = SynthesisCache::decode(actx, code, index, vars);
+        if (y == nullptr || x->getBitvectorSize() != y->getBitvectorSize())
+          return nullptr;
+
+        switch (type) {
+          case triton::ast::BVADD_NODE:   return actx->bvadd(x, y);
+          case triton::ast::BVAND_NODE:   return actx->bvand(x, y);
+          case triton::ast::BVMUL_NODE:   return actx->bvmul(x, y);
+          case triton::ast::BVNAND_NODE:  return actx->bvnand(x, y);
+          case triton::ast::BVNOR_NODE:   return actx->bvnor(x, y);
+          case triton::ast::BVOR_NODE:    return actx->bvor(x, y);
+          case triton::ast::BVROL_NODE:   return actx->bvrol(x, y);
+          case triton::ast::BVROR_NODE:   return actx->bvror(x, y);
+          case triton::ast::BVSDIV_NODE:  return actx->bvsdiv(x, y);
+          case triton::ast::BVSMOD_NODE:  return actx->bvsmod(x, y);
+          case triton::ast::BVSREM_NODE:  return actx->bvsrem(x, y);
+          case triton::ast::BVSUB_NODE:   return actx->bvsub(x, y);
+          case triton::ast::BVUDIV_NODE:  return actx->bvudiv(x, y);
+          case triton::ast::BVUREM_NODE:  return actx->bvurem(x, y);
+          case triton::ast::BVXNOR_NODE:  return actx->bvxnor(x, y);
+          default:                        return actx->bvxor(x, y);
+        }
+      }
+
+
+      void SynthesisCache::enable(bool flag) {
+        this->enabled = flag;
+      }
+
+
+      bool SynthesisCache::isEnabled(void) const {
+        return this->enabled;
+      }
+
+
+      bool SynthesisCache::find(const Key& key, const std::deque<triton::ast::SharedAbstractNode>& vars, triton::ast::SharedAstContext actx, triton::ast::SharedAbstractNode& output) {
+        auto it = this->entries.find(key);
+        if (it == this->entries.end())
+          return false;
+
+        output = nullptr;
+        if (it->second.size()) {
+          triton::usize index = 0;
+          output = SynthesisCache::decode(actx, it->second, index, vars);
+          /* A template which does not fit is a miss */
+          if (output == nullptr || index != it->second.size())
+            return false;
+        }
+
+        this->hits++;
+        return true;
+      }
+
+
+      void SynthesisCache::insert(const Key& key, const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& output) {
+        Template code;
+
+        if (output != nullptr && SynthesisCache::encode(output, vars, code) == false)
+          return;
+
+        this->entries[key] = std::move(code);
+      }
+
+
+      triton::usize SynthesisCache::size(void) const {
+        return this->entries.size();
+      }
+
+
+      triton::usize SynthesisCache::getHits(void) const {
+        return this->hits;
+      }
+
+
+      void SynthesisCache::clear(void) {
+        this->entries.clear();
+        this->hits = 0;
+      }
+
+
+      void SynthesisCache::removeFailures(void) {
+        for (auto it = this->entries.begin(); it != this->entries.end();) {
+          if (it->second.empty())
+            it = this->entries.erase(it);
+          else
+            it++;
+        }
+      }
+
+
+      void SynthesisCache::save(const std::string& path) const {
+        std::ofstream file(path, std::ios::out | std::ios::trunc);
+
+        if (!file.is_open())
+          throw triton::exceptions::SynthesizerEngine("SynthesisCache::save(): Cannot open the file.");
+
+        /* One entry per line: the key, the size of the template and its words, in hexadecimal */
+        file << cacheHeader << std::endl << std::hex;
+        for (const auto& entry : this->entries) {
+          file << entry.first.first << " " << entry.first.second << " " << entry.second.size();
+          for (triton::uint64 word : entry.second)
+            file << " " << word;
+          file << "\n";
+        }
+
+        if (!file.good())
+          throw triton::exceptions::SynthesizerEngine("SynthesisCache::save(): Cannot write the file.");
+      }
+
+
+      void SynthesisCache::load(const std::string& path) {
+        std::ifstream file(path);
+        std::string line;
+
+        if (!file.is_open())
+          throw triton::exceptions::SynthesizerEngine("SynthesisCache::load(): Cannot open the file.");
+
+        if (!std::getline(file, line) || line != cacheHeader)
+          throw triton::exceptions::SynthesizerEngine("SynthesisCache::load(): Invalid file.");
+
+        while (std::getline(file, line)) {
+          std::istringstream stream(line);
+          triton::usize size = 0;
+          Key key = {0, 0};
+          Template code;
+
+          if (line.empty())
+            continue;
+
+          stream >> std::hex >> key.first >> key.second >> size;
+          for (triton::usize index = 0; stream && index < size; index++) {
+            triton::uint64 word = 0;
+            stream >> word;
+            code.push_back(word);
+          }
+
+          if (!stream || code.size() != size)
+            throw triton::exceptions::SynthesizerEngine("SynthesisCache::load(): Invalid entry.");
+
+          this->entries[key] = std::move(code);
+        }
+      }
+
+    }; /* synthesis namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,231 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <set>
+#include <utility>
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/synthesisDatabase.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace synthesis {
+
+      /* "TRSYNDB1" read as a little-endian word */
+      static constexpr triton::uint64 databaseMagic = 0x3142444e59535254ULL;
+
+      /* The number of words of the header */
+      static constexpr triton::uint64 headerWords = 8;
+
+
+      SynthesisDatabase::SynthesisDatabase(const std::string& path) {
+        this->file = std::make_unique<triton::loaders::MappedFile>(path);
+
+        if (this->file->getSize() < headerWords * 8 || this->read(0) != databaseMagic)
+          throw triton::exceptions::SynthesizerEngine("SynthesisDatabase::SynthesisDatabase(): Invalid database.");
+
+        this->bits        = static_cast<triton::uint32>(this->read(8));
+        this->arity       = static_cast<triton::uint32>(this->read(8) >> 32);
+        this->entries     = this->read(24);
+        this->indexOffset = this->read(40);
+        this->codeOffset  = this->read(48);
+
+        triton::uint64 count        = this->read(16);
+        triton::uint64 inputsOffset = this->read(32);
+        triton::uint64 size         = this->file->getSize();
+
+        if ((this->bits != 8 && this->bits != 16 && this->bits != 32 && this->bits != 64) || this->arity == 0 || this->arity > 8)
+          throw triton::exceptions::SynthesizerEngine("SynthesisDatabase::SynthesisDatabase(): Unsupported variables.");
+
+        if (count == 0 || count > size / 8 || this->entries > size / 16 || this->indexOffset + this->entries * 16 > size || this->codeOffset > size)
+          throw triton::exceptions::SynthesizerEngine("SynthesisDatabase::SynthesisDatabase(): Truncated database.");
+
+        /* The inputs are few, they are read once */
+        for (triton::uint64 index = 0; index < count; index++) {
+          std::vector<triton::uint512> input;
+          for (triton::uint32 var = 0; var < this->arity; var++)
+            input.push_back(this->read(inputsOffset + (index * this->arity + var) * 8));
+          this->inputs.push_back(std::move(input));
+        }
+      }
+
+
+      triton::uint64 SynthesisDatabase::read(triton::uint64 offset) const {
+        if (offset > this->file->getSize() || this->file->getSize() - offset < 8)
+          throw triton::exceptions::SynthesizerEngine("SynthesisDatabase::read(): Truncated database.");
+
+        const triton::uint8* data = this->file->getData() + offset;
+        triton::uint64 value = 0;
+        for (triton::uint32 i = 0; i < 8; i++)
+          value |= static_cast<triton::uint64>(data[i]) << (i * 8);
+
+        return value;
+      }
+
+
+      triton::uint32 SynthesisDatabase::getBits(void) const {
+        return this->bits;
+      }
+
+
+      triton::uint32 SynthesisDatabase::getArity(void) const {
+        return this->arity;
+      }
+
+
+      triton::usize SynthesisDatabase::getSize(void) const {
+        return static_cast<triton::usize>(this->entries);
+      }
+
+
+      const std::vector<std::vector<triton::uint512>>& SynthesisDatabase::getInputs(void) const {
+        return this->inputs;
+      }
+
+
+      std::vector<SynthesisCache::Template> SynthesisDatabase::find(triton::uint64 hash) const {
+        std::vector<SynthesisCache::Template> templates;
+        triton::uint64 first = 0;
+        triton::uint64 last  = this->entries;
+
+        /* The first entry of the index whose hash is not lower than `hash` */
+        while (first < last) {
+          triton::uint64 middle = first + (last - first) / 2;
+          if (this->read(this->indexOffset + middle * 16) < hash)
+            first = middle + 1;
+          else
+            last = middle;
+        }
+
+        for (; first < this->entries && this->read(this->indexOffset + first * 16) == hash; first++) {
+          triton::uint64 offset = this->codeOffset + this->read(this->indexOffset + first * 16 + 8) * 8;
+          triton::uint64 size   = this->read(offset);
+          SynthesisCache::Template code;
+
+          if (size > (this->file->getSize() - offset) / 8)
+            throw triton::exceptions::SynthesizerEngine("SynthesisDatabase::find(): Truncated database.");
+
+          for (triton::uint64 index = 1; index <= size; index++)
+            code.push_back(this->read(offset + index * 8));
+
+          templates.push_back(std::move(code));
+        }
+
+        return templates;
+      }
+
+
+      triton::uint64 SynthesisDatabase::hashSignature(const std::vector<triton::uint512>& outputs, triton::uint32 bits) {
+        triton::uint512 mask = (triton::uint512(1) << bits) - 1;
+        triton::uint64 hash  = 0xcbf29ce484222325ULL;
+
+        for (const auto& output : outputs) {
+          hash ^= static_cast<triton::uint64>(output & mask);
+          hash  = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+          hash  = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+          hash ^= hash >> 31;
+        }
+
+        return hash;
+      }
+
+
+      triton::usize SynthesisDatabase::write(const std::string& path, const std::deque<triton::ast::SharedAbstractNode>& vars, const std::vector<std::vector<triton::uint512>>& inputs, const std::vector<triton::ast::SharedAbstractNode>& exprs) {
+        std::vector<std::pair<triton::uint64, triton::uint64>> index;
+        std::set<std::vector<triton::uint512>> signatures;
+        std::vector<triton::uint64> code;
+
+        if (vars.empty() || vars.size() > 8 || inputs.empty())
+          throw triton::exceptions::SynthesizerEngine("SynthesisDatabase::write(): Expects from one to eight variables and at least one input.");
+
+        triton::uint32 bits = vars[0]->getBitvectorSize();
+        for (const auto& var : vars) {
+          if (var->getType() != triton::ast::VARIABLE_NODE || var->getBitvectorSize() != bits)
+            throw triton::exceptions::SynthesizerEngine("SynthesisDatabase::write(): The variables must be variable nodes of a same size.");
+        }
+
+        if (bits != 8 && bits != 16 && bits != 32 && bits != 64)
+          throw triton::exceptions::SynthesizerEngine("SynthesisDatabase::write(): The variables must be 8, 16, 32 or 64-bit long.");
+
+        for (const auto& input : inputs) {
+          if (input.size() != vars.size())
+            throw triton::exceptions::SynthesizerEngine("SynthesisDatabase::write(): Each input must give a value to each variable.");
+        }
+
+        std::vector<triton::ast::SharedAbstractNode> variables(vars.begin(), vars.end());
+        for (const auto& expr : exprs) {
+          SynthesisCache::Template tmpl;
+
+          if (expr == nullptr || expr->getBitvectorSize() != bits || SynthesisCache::encode(expr, vars, tmpl) == false)
+            continue;
+
+          /* The first expression of a signature is kept */
+          auto outputs = expr->getContext()->evaluateBatch(expr, variables, inputs);
+          if (signatures.insert(outputs).second == false)
+            continue;
+
+          index.push_back({SynthesisDatabase::hashSignature(outputs, bits), code.size()});
+          code.push_back(tmpl.size());
+          code.insert(code.end(), tmpl.begin(), tmpl.end());
+        }
+
+        std::stable_sort(index.begin(), index.end(), [](const std::pair<triton::uint64, triton::uint64>& a, const std::pair<triton::uint64, triton::uint64>& b) {
+          return a.first < b.first;
+        });
+
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+          throw triton::exceptions::SynthesizerEngine("SynthesisDatabase::write(): Cannot open the file.");
+
+        auto put = [&file](triton::uint64 value) {
+          char bytes[8];
+          for (triton::uint32 i = 0; i < 8; i++)
+            bytes[i] = static_cast<char>((value >> (i * 8)) & 0xff);
+          file.write(bytes, 8);
+        };
+
+        triton::uint64 inputsOffset = headerWords * 8;
+        triton::uint64 indexOffset  = inputsOffset + inputs.size() * vars.size() * 8;
+        triton::uint64 codeOffset   = indexOffset + index.size() * 16;
+
+        put(databaseMagic);
+        put(bits | (static_cast<triton::uint64>(vars.size()) << 32));
+        put(inputs.size());
+        put(index.size());
+        put(inputsOffset);
+        put(indexOffset);
+        put(codeOffset);
+        put(code.size());
+
+        for (const auto& input : inputs) {
+          for (const auto& value : input)
+            put(static_cast<triton::uint64>(value));
+        }
+
+        for (const auto& entry : index) {
+          put(entry.first);
+          put(entry.second);
+        }
+
+        for (triton::uint64 word : code)
+          put(word);
+
+        if (!file.good())
+          throw triton::exceptions::SynthesizerEngine("SynthesisDatabase::write(): Cannot write the file.");
+
+        return index.size();
+      }
+
+    }; /* synthesis namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -5,8 +5,15 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <exception>
+#include <functional>
+#include <mutex>
 #include <stack>
+#include <system_error>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -22,15 +29,57 @@ namespace triton {
   namespace engines {
     namespace synthesis {
 
-      Synthesizer::Synthesizer(triton::engines::symbolic::SymbolicEngine* symbolic)
-        : symbolic(symbolic) {
+      void parallelFor(triton::usize count, triton::usize threads, const std::function<void(triton::usize)>& function) {
+        std::atomic<triton::usize> next(0);
+        std::exception_ptr error;
+        std::mutex lock;
+        std::vector<std::thread> pool;
+
+        auto work = [&]() {
+          for (triton::usize index = next++; index < count; index = next++) {
+            try {
+              function(index);
+            }
+            catch (...) {
+              std::lock_guard<std::mutex> guard(lock);
+              if (!error)
+                error = std::current_exception();
+              next = count;
+            }
+          }
+        };
+
+        threads = std::min(threads, count);
+        for (triton::usize i = 0; threads > 1 && i < threads; i++) {
+          try {
+            pool.emplace_back(work);
+          }
+          catch (const std::system_error&) {
+            break;
+          }
+        }
+
+        /* Without threads, the work is done on the calling thread */
+        if (pool.empty())
+          work();
+
+        for (auto& thread : pool)
+          thread.join();
+
+        if (error)
+          std::rethrow_exception(error);
+      }
+
+
+      Synthesizer::Synthesizer(triton::engines::symbolic::SymbolicEngine* symbolic, SynthesisCache* cache, const std::vector<std::shared_ptr<SynthesisDatabase>>* databases)
+        : symbolic(symbolic), cache(cache), databases(databases) {
         #ifdef TRITON_Z3_INTERFACE
         this->solver.setSolver(triton::engines::solver::SOLVER_Z3);
         #endif
       }
 
 
-      SynthesisResult Synthesizer::synthesize(const triton::ast::SharedAbstractNode& input, bool constant, bool subexpr, bool opaque) {
+      SynthesisResult Synthesizer::synthesize(const triton::ast::SharedAbstractNode& input, bool constant, bool subexpr, bool opaque, triton::usize threads) {
         SynthesisResult result;
 
         // Save the input node
@@ -44,9 +93,13 @@ namespace triton {
 
         // Do the synthesize and if nothing has been synthesized, try on children expression
         if (this->do_synthesize(node, constant, opaque, result) == false) {
-          if (subexpr == true) {
+          if (subexpr == true && threads == 1) {
             while (this->childrenSynthesis(node, constant, opaque, result));
           }
+          else if (subexpr == true) {
+            threads = threads ? threads : std::max<triton::usize>(std::thread::hardware_concurrency(), 1);
+            while (this->parallelChildrenSynthesis(node, constant, opaque, threads, result));
+          }
         }
 
         //! Substitute all sub expressions
@@ -70,10 +123,33 @@ namespace triton {
         // How many variables in the expression?
         auto vars = triton::ast::search(node, triton::ast::VARIABLE_NODE);
 
+        // Is a synthesis tried on this node?
+        bool tried = this->isTried(vars, node, opaque);
+
+        // Look up a previous result of the same subtree, on other variables or from another call
+        SynthesisCache::Key key;
+        if (this->cache && tried) {
+          triton::ast::SharedAbstractNode output = nullptr;
+          key = SynthesisCache::getKey(node, vars, constant, opaque);
+          if (this->cache->find(key, vars, node->getContext(), output)) {
+            if (output == nullptr) {
+              return false;
+            }
+            result.setOutput(output);
+            result.setSuccess(true);
+            return true;
+          }
+        }
+
         // If there is one symbolic variable, do unary operators synthesis
         if (vars.size() == 1 && node->getLevel() > 2) {
           ret = this->unaryOperatorSynthesis(vars, node, result);
 
+          // Then look up the precomputed expressions
+          if (ret == false) {
+            ret = this->databaseSynthesis(vars, node, result);
+          }
+
           // Do also constant synthesis
           if (ret == false && constant == true) {
             ret = this->constantSynthesis(vars, node, result);
@@ -83,6 +159,16 @@ namespace triton {
         // If there is two symbolic variables, do binary operators synthesis
         else if (vars.size() == 2 && node->getLevel() > 2) {
           ret = this->binaryOperatorSynthesis(vars, node, result);
+
+          // Then look up the precomputed expressions
+          if (ret == false) {
+            ret = this->databaseSynthesis(vars, node, result);
+          }
+        }
+
+        // With more variables, only the precomputed expressions are looked up
+        else if (vars.size() > 2 && node->getLevel() > 2) {
+          ret = this->databaseSynthesis(vars, node, result);
         }
 
         // If nothing worked, do constant opaque synthesis
@@ -90,34 +176,131 @@ namespace triton {
           ret = this->opaqueConstantSynthesis(vars, node, result);
         }
 
+        // Record the result, or that the subtree cannot be synthesized
+        if (this->cache && tried) {
+          this->cache->insert(key, vars, ret ? result.getOutput() : nullptr);
+        }
+
         return ret;
       }
 
 
-      bool Synthesizer::opaqueConstantSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result) {
-        /* We need Z3 solver in order to use quantifier logic */
-        #ifdef TRITON_Z3_INTERFACE
+      bool Synthesizer::isTried(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, bool opaque) const {
+        return node->getLevel() > 2 && (vars.size() == 1 || vars.size() == 2 || (vars.size() && opaque == true) || this->hasDatabase(vars.size()));
+      }
 
-        auto actx  = node->getContext();
-        auto var_c = this->symbolic->newSymbolicVariable(triton::engines::symbolic::UNDEFINED_VARIABLE, 0, node->getBitvectorSize(), "");
-        auto model = this->solver.getModel(actx->forall(vars, actx->equal(node, actx->variable(var_c))));
 
-        if (model.size()) {
-          auto constant = model.at(var_c->getId()).getValue();
-          auto size     = model.at(var_c->getId()).getSize();
+      bool Synthesizer::hasDatabase(triton::usize arity) const {
+        if (this->databases == nullptr)
+          return false;
+
+        for (const auto& database : *this->databases) {
+          if (database->getArity() == arity)
+            return true;
+        }
+
+        return false;
+      }
+
+
+      std::vector<Synthesizer::DatabaseMatch> Synthesizer::lookupDatabases(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node) const {
+        std::vector<DatabaseMatch> matches;
+
+        if (this->databases == nullptr || vars.empty())
+          return matches;
+
+        for (const auto& database : *this->databases) {
+          triton::uint32 bits = database->getBits();
+
+          /* The database must be on the number and on the size of the variables */
+          if (database->getArity() != vars.size() || node->getBitvectorSize() != bits)
+            continue;
+
+          if (std::any_of(vars.begin(), vars.end(), [bits](const triton::ast::SharedAbstractNode& var) { return var->getBitvectorSize() != bits; }))
+            continue;
+
+          DatabaseMatch match;
+          match.database  = database.get();
+          match.outputs   = node->getContext()->evaluateBatch(node, std::vector<triton::ast::SharedAbstractNode>(vars.begin(), vars.end()), database->getInputs());
+          match.templates = database->find(SynthesisDatabase::hashSignature(match.outputs, bits));
+
+          if (match.templates.size()) {
+            matches.push_back(std::move(match));
+          }
+        }
+
+        return matches;
+      }
+
+
+      triton::ast::SharedAbstractNode Synthesizer::buildFromDatabases(const std::vector<DatabaseMatch>& matches, const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node) const {
+        std::vector<triton::ast::SharedAbstractNode> variables(vars.begin(), vars.end());
+        auto actx = node->getContext();
+
+        for (const auto& match : matches) {
+          for (const auto& code : match.templates) {
+            triton::usize index = 0;
+            auto output = SynthesisCache::decode(actx, code, index, vars);
+
+            if (output == nullptr || index != code.size() || output->getBitvectorSize() != node->getBitvectorSize())
+              continue;
+
+            /* The hash may collide, the expression must give the same outputs */
+            if (actx->evaluateBatch(output, variables, match.database->getInputs()) == match.outputs)
+              return output;
+          }
+        }
+
+        return nullptr;
+      }
+
+
+      bool Synthesizer::databaseSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result) {
+        auto output = this->buildFromDatabases(this->lookupDatabases(vars, node), vars, node);
 
-          /* Replace the constant variable to a bitvector */
-          result.setOutput(actx->bv(constant, size));
+        if (output != nullptr) {
+          result.setOutput(output);
           result.setSuccess(true);
-          return true;
         }
 
-        #endif
+        return result.successful();
+      }
+
+
+      bool Synthesizer::opaqueConstantSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result) {
+        triton::uint512 constant = 0;
+
+        /* The node is sampled first, so that only the nodes constant on every sample are sent to the solver */
+        if (this->solver.isValid() && this->solver.isOpaquePredicate(node, &constant)) {
+          result.setOutput(node->getContext()->bv(constant, node->getBitvectorSize()));
+          result.setSuccess(true);
+          return true;
+        }
 
         return false;
       }
 
 
+      std::array<ConstantEntry, 6> Synthesizer::getConstantEntries(const triton::engines::symbolic::SharedSymbolicVariable& var_x, const triton::engines::symbolic::SharedSymbolicVariable& var_c, const triton::ast::SharedAstContext& actx) {
+        return {
+          ConstantEntry(1, actx->bvadd(actx->variable(var_x), actx->variable(var_c))), // x + c
+          ConstantEntry(1, actx->bvand(actx->variable(var_x), actx->variable(var_c))), // x & c
+          ConstantEntry(1, actx->bvmul(actx->variable(var_x), actx->variable(var_c))), // x * c
+          ConstantEntry(0, actx->bvsub(actx->variable(var_c), actx->variable(var_x))), // c - x
+          ConstantEntry(1, actx->bvsub(actx->variable(var_x), actx->variable(var_c))), // x - c
+          ConstantEntry(1, actx->bvxor(actx->variable(var_x), actx->variable(var_c)))  // x ^ c
+        };
+      }
+
+
+      bool Synthesizer::isConstantCandidate(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node) {
+        triton::uint32 bits = reinterpret_cast<triton::ast::VariableNode*>(vars[0].get())->getSymbolicVariable()->getSize();
+
+        /* We suppose variables are 8, 16, 32 or 64-bit long */
+        return (bits == 8 || bits == 16 || bits == 32 || bits == 64) && node->getBitvectorSize() == bits;
+      }
+
+
       bool Synthesizer::constantSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result) {
         /* We need Z3 solver in order to use quantifier logic */
         #ifdef TRITON_Z3_INTERFACE
@@ -126,26 +309,16 @@ namespace triton {
         auto var_x = reinterpret_cast<triton::ast::VariableNode*>(vars[0].get())->getSymbolicVariable();
         auto actx  = node->getContext();
 
-        triton::uint32 bits    = var_x->getSize();
-        triton::uint32 insize  = node->getBitvectorSize();
-        triton::uint32 outsize = bits;
+        triton::uint32 bits = var_x->getSize();
 
-        /* We suppose variables are 8, 16, 32 or 64-bit long */
-        if ((bits != 8 && bits != 16 && bits != 32 && bits != 64) || insize != outsize)
+        if (Synthesizer::isConstantCandidate(vars, node) == false)
           return false;
 
         /* We create the constant variable */
         auto var_c = this->symbolic->newSymbolicVariable(triton::engines::symbolic::UNDEFINED_VARIABLE, 0, bits, "");
 
         /* Create the constant operator table */
-        std::array<ConstantEntry, 6> operatorTable = {
-          ConstantEntry(1, actx->bvadd(actx->variable(var_x), actx->variable(var_c))), // x + c
-          ConstantEntry(1, actx->bvand(actx->variable(var_x), actx->variable(var_c))), // x & c
-          ConstantEntry(1, actx->bvmul(actx->variable(var_x), actx->variable(var_c))), // x * c
-          ConstantEntry(0, actx->bvsub(actx->variable(var_c), actx->variable(var_x))), // c - x
-          ConstantEntry(1, actx->bvsub(actx->variable(var_x), actx->variable(var_c))), // x - c
-          ConstantEntry(1, actx->bvxor(actx->variable(var_x), actx->variable(var_c)))  // x ^ c
-        };
+        auto operatorTable = Synthesizer::getConstantEntries(var_x, var_c, actx);
 
         std::vector<triton::ast::SharedAbstractNode> x = {actx->variable(var_x)};
         for (auto const& entry : operatorTable) {
@@ -170,17 +343,38 @@ namespace triton {
       }
 
 
-      bool Synthesizer::unaryOperatorSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result) {
-        /* We start by saving orignal value of symbolic variable */
+      triton::ast::ast_e Synthesizer::findUnaryOperator(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node) {
         auto var_x = reinterpret_cast<triton::ast::VariableNode*>(vars[0].get())->getSymbolicVariable();
         auto actx  = node->getContext();
 
-        triton::uint512 save_x = actx->getVariableValue(var_x->getName());
-        triton::uint32  bits   = var_x->getSize();
+        std::vector<std::vector<triton::uint512>> inputs;
+        std::vector<triton::uint512> expected;
+        std::vector<triton::usize> bounds;
+        triton::uint32 bits = var_x->getSize();
 
         /* We suppose variables are 8, 16, 32 or 64-bit long */
         if (bits != 8 && bits != 16 && bits != 32 && bits != 64)
-          return false;
+          return triton::ast::INVALID_NODE;
+
+        /*
+         * The oracles of every operator are evaluated together in one batch,
+         * each operator owning the lanes from bounds[i] to bounds[i + 1]. The
+         * batch evaluation does not modify the values of the variables.
+         */
+        bounds.push_back(0);
+        for (auto const& it : triton::engines::synthesis::oracles::unopTable) {
+          for (auto const& oracle : it.second) {
+            // Ignore oracle that is not on same size, and bswap oracle for 8 bit value.
+            if (oracle.bits != bits || (bits == 8 && it.first == triton::ast::BSWAP_NODE)) {
+              continue;
+            }
+            inputs.push_back({oracle.x});
+            expected.push_back(oracle.r);
+          }
+          bounds.push_back(inputs.size());
+        }
+
+        auto outputs = actx->evaluateBatch(node, {vars[0]}, inputs);
 
         /*
          * NOTE: More the oracle table will grow more it will take time to looking
@@ -188,143 +382,160 @@ namespace triton {
          *       n is the number of entry in the table. At some point we have to
          *       change this.
          */
+        triton::usize index = 0;
         for (auto const& it : triton::engines::synthesis::oracles::unopTable) {
           triton::ast::ast_e op = it.first;
-          std::array<UnaryEntry, 40> oracles = it.second;
+          triton::usize first   = bounds[index];
+          triton::usize last    = bounds[++index];
 
           // Ignore bswap oracle for 8 bit value.
           if (bits == 8 && op == triton::ast::BSWAP_NODE) {
             continue;
           }
 
-          bool found = true;
-          for (auto const& oracle : oracles) {
-            // Ignore oracle that is not on same size
-            if (oracle.bits != bits) {
-              continue;
-            }
-
-            // Inject value
-            actx->updateVariable(var_x->getName(), oracle.x);
-            if (node->evaluate() != oracle.r) {
-              found = false;
-              break;
-            }
-          }
-
-          // If an oracle is found, we craft a synthesized node.
-          if (found) {
-            switch (op) {
-              case triton::ast::BSWAP_NODE: result.setOutput(actx->bswap(actx->variable(var_x))); break;
-              case triton::ast::BVNEG_NODE: result.setOutput(actx->bvneg(actx->variable(var_x))); break;
-              case triton::ast::BVNOT_NODE: result.setOutput(actx->bvnot(actx->variable(var_x))); break;
-              default:
-                throw triton::exceptions::SynthesizerEngine("Synthesizer::unaryOperatorSynthesis(): Invalid type of operator.");
-            }
-
-            // Adjust the size of the destination
-            auto out     = result.getOutput();
-            auto in      = node;
-            auto outsize = out->getBitvectorSize();
-            auto insize  = in->getBitvectorSize();
-            if (insize > outsize) {
-              result.setOutput(actx->zx(insize - outsize, out));
-            }
-
-            // Stop iterating over oracles
-            result.setSuccess(true);
-            break;
+          // Compare the lanes of the operator at once
+          if (std::equal(outputs.begin() + first, outputs.begin() + last, expected.begin() + first)) {
+            return op;
           }
           // If not found, continuing to iterate over oracles
         }
 
-        // Whatever the result, we must restore orignal value of the symbolic variable
-        actx->updateVariable(var_x->getName(), save_x);
-
-        return result.successful();
+        return triton::ast::INVALID_NODE;
       }
 
 
-      bool Synthesizer::binaryOperatorSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result) {
-        /* We start by saving orignal value of symbolic variables */
+      triton::ast::ast_e Synthesizer::findBinaryOperator(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node) {
         auto var_x = reinterpret_cast<triton::ast::VariableNode*>(vars[0].get())->getSymbolicVariable();
         auto var_y = reinterpret_cast<triton::ast::VariableNode*>(vars[1].get())->getSymbolicVariable();
         auto actx  = node->getContext();
 
-        triton::uint512 save_x = actx->getVariableValue(var_x->getName());
-        triton::uint512 save_y = actx->getVariableValue(var_y->getName());
-        triton::uint32  bits   = var_x->getSize();
+        std::vector<std::vector<triton::uint512>> inputs;
+        std::vector<triton::uint512> expected;
+        std::vector<triton::usize> bounds;
+        triton::uint32 bits = var_x->getSize();
 
         /* We suppose variables are on a same size */
         if (var_x->getSize() != var_y->getSize())
-          return false;
+          return triton::ast::INVALID_NODE;
 
         /* We suppose variables are 8, 16, 32 or 64-bit long */
         if (bits != 8 && bits != 16 && bits != 32 && bits != 64)
-          return false;
+          return triton::ast::INVALID_NODE;
 
+        /* Same as the unary operators, the oracles of every operator are evaluated together in one batch */
+        bounds.push_back(0);
         for (auto const& it : triton::engines::synthesis::oracles::binopTable) {
-          triton::ast::ast_e op = it.first;
-          std::array<BinaryEntry, 40> oracles = it.second;
-
-          bool found = true;
-          for (auto const& oracle : oracles) {
+          for (auto const& oracle : it.second) {
             // Ignore oracle that is not on same size
             if (oracle.bits != bits) {
               continue;
             }
-
-            // Inject values
-            actx->updateVariable(var_x->getName(), oracle.x);
-            actx->updateVariable(var_y->getName(), oracle.y);
-            if (node->evaluate() != oracle.r) {
-              found = false;
-              break;
-            }
+            inputs.push_back({oracle.x, oracle.y});
+            expected.push_back(oracle.r);
           }
+          bounds.push_back(inputs.size());
+        }
 
-          // If an oracle is found, we craft a synthesized node.
-          if (found) {
-            switch (op) {
-              case triton::ast::BVADD_NODE:   result.setOutput(actx->bvadd(actx->variable(var_x),  actx->variable(var_y))); break;
-              case triton::ast::BVAND_NODE:   result.setOutput(actx->bvand(actx->variable(var_x),  actx->variable(var_y))); break;
-              case triton::ast::BVMUL_NODE:   result.setOutput(actx->bvmul(actx->variable(var_x),  actx->variable(var_y))); break;
-              case triton::ast::BVNAND_NODE:  result.setOutput(actx->bvnand(actx->variable(var_x), actx->variable(var_y))); break;
-              case triton::ast::BVNOR_NODE:   result.setOutput(actx->bvnor(actx->variable(var_x),  actx->variable(var_y))); break;
-              case triton::ast::BVOR_NODE:    result.setOutput(actx->bvor(actx->variable(var_x),   actx->variable(var_y))); break;
-              case triton::ast::BVROL_NODE:   result.setOutput(actx->bvrol(actx->variable(var_x),  actx->variable(var_y))); break;
-              case triton::ast::BVROR_NODE:   result.setOutput(actx->bvror(actx->variable(var_x),  actx->variable(var_y))); break;
-              case triton::ast::BVSDIV_NODE:  result.setOutput(actx->bvsdiv(actx->variable(var_x), actx->variable(var_y))); break;
-              case triton::ast::BVSMOD_NODE:  result.setOutput(actx->bvsmod(actx->variable(var_x), actx->variable(var_y))); break;
-              case triton::ast::BVSREM_NODE:  result.setOutput(actx->bvsrem(actx->variable(var_x), actx->variable(var_y))); break;
-              case triton::ast::BVSUB_NODE:   result.setOutput(actx->bvsub(actx->variable(var_x),  actx->variable(var_y))); break;
-              case triton::ast::BVUDIV_NODE:  result.setOutput(actx->bvudiv(actx->variable(var_x), actx->variable(var_y))); break;
-              case triton::ast::BVUREM_NODE:  result.setOutput(actx->bvurem(actx->variable(var_x), actx->variable(var_y))); break;
-              case triton::ast::BVXNOR_NODE:  result.setOutput(actx->bvxnor(actx->variable(var_x), actx->variable(var_y))); break;
-              case triton::ast::BVXOR_NODE:   result.setOutput(actx->bvxor(actx->variable(var_x),  actx->variable(var_y))); break;
-              default:
-                throw triton::exceptions::SynthesizerEngine("Synthesizer::binaryOperatorSynthesis(): Invalid type of operator.");
-            }
+        auto outputs = actx->evaluateBatch(node, {vars[0], vars[1]}, inputs);
 
-            // Adjust the size of the destination
-            auto out     = result.getOutput();
-            auto in      = node;
-            auto outsize = out->getBitvectorSize();
-            auto insize  = in->getBitvectorSize();
-            if (insize > outsize) {
-              result.setOutput(actx->zx(insize - outsize, out));
-            }
+        triton::usize index = 0;
+        for (auto const& it : triton::engines::synthesis::oracles::binopTable) {
+          triton::ast::ast_e op = it.first;
+          triton::usize first   = bounds[index];
+          triton::usize last    = bounds[++index];
 
-            // Stop iterating over oracles
-            result.setSuccess(true);
-            break;
+          // Compare the lanes of the operator at once
+          if (std::equal(outputs.begin() + first, outputs.begin() + last, expected.begin() + first)) {
+            return op;
           }
           // If not found, continuing to iterate over oracles
         }
 
-        // Whatever the result, we must restore orignal value of symbolic variables
-        actx->updateVariable(var_x->getName(), save_x);
-        actx->updateVariable(var_y->getName(), save_y);
+        return triton::ast::INVALID_NODE;
+      }
+
+
+      triton::ast::ast_e Synthesizer::findOperator(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node) {
+        if (vars.size() == 1)
+          return Synthesizer::findUnaryOperator(vars, node);
+
+        if (vars.size() == 2)
+          return Synthesizer::findBinaryOperator(vars, node);
+
+        return triton::ast::INVALID_NODE;
+      }
+
+
+      triton::ast::SharedAbstractNode Synthesizer::buildOperator(triton::ast::ast_e op, const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node) {
+        auto var_x = reinterpret_cast<triton::ast::VariableNode*>(vars[0].get())->getSymbolicVariable();
+        auto actx  = node->getContext();
+        triton::ast::SharedAbstractNode out = nullptr;
+
+        if (vars.size() == 1) {
+          switch (op) {
+            case triton::ast::BSWAP_NODE: out = actx->bswap(actx->variable(var_x)); break;
+            case triton::ast::BVNEG_NODE: out = actx->bvneg(actx->variable(var_x)); break;
+            case triton::ast::BVNOT_NODE: out = actx->bvnot(actx->variable(var_x)); break;
+            default:
+              throw triton::exceptions::SynthesizerEngine("Synthesizer::buildOperator(): Invalid type of operator.");
+          }
+        }
+        else {
+          auto var_y = reinterpret_cast<triton::ast::VariableNode*>(vars[1].get())->getSymbolicVariable();
+          switch (op) {
+            case triton::ast::BVADD_NODE:   out = actx->bvadd(actx->variable(var_x),  actx->variable(var_y)); break;
+            case triton::ast::BVAND_NODE:   out = actx->bvand(actx->variable(var_x),  actx->variable(var_y)); break;
+            case triton::ast::BVMUL_NODE:   out = actx->bvmul(actx->variable(var_x),  actx->variable(var_y)); break;
+            case triton::ast::BVNAND_NODE:  out = actx->bvnand(actx->variable(var_x), actx->variable(var_y)); break;
+            case triton::ast::BVNOR_NODE:   out = actx->bvnor(actx->variable(var_x),  actx->variable(var_y)); break;
+            case triton::ast::BVOR_NODE:    out = actx->bvor(actx->variable(var_x),   actx->variable(var_y)); break;
+            case triton::ast::BVROL_NODE:   out = actx->bvrol(actx->variable(var_x),  actx->variable(var_y)); break;
+            case triton::ast::BVROR_NODE:   out = actx->bvror(actx->variable(var_x),  actx->variable(var_y)); break;
+            case triton::ast::BVSDIV_NODE:  out = actx->bvsdiv(actx->variable(var_x), actx->variable(var_y)); break;
+            case triton::ast::BVSMOD_NODE:  out = actx->bvsmod(actx->variable(var_x), actx->variable(var_y)); break;
+            case triton::ast::BVSREM_NODE:  out = actx->bvsrem(actx->variable(var_x), actx->variable(var_y)); break;
+            case triton::ast::BVSUB_NODE:   out = actx->bvsub(actx->variable(var_x),  actx->variable(var_y)); break;
+            case triton::ast::BVUDIV_NODE:  out = actx->bvudiv(actx->variable(var_x), actx->variable(var_y)); break;
+            case triton::ast::BVUREM_NODE:  out = actx->bvurem(actx->variable(var_x), actx->variable(var_y)); break;
+            case triton::ast::BVXNOR_NODE:  out = actx->bvxnor(actx->variable(var_x), actx->variable(var_y)); break;
+            case triton::ast::BVXOR_NODE:   out = actx->bvxor(actx->variable(var_x),  actx->variable(var_y)); break;
+            default:
+              throw triton::exceptions::SynthesizerEngine("Synthesizer::buildOperator(): Invalid type of operator.");
+          }
+        }
+
+        // Adjust the size of the destination
+        auto outsize = out->getBitvectorSize();
+        auto insize  = node->getBitvectorSize();
+        if (insize > outsize) {
+          out = actx->zx(insize - outsize, out);
+        }
+
+        return out;
+      }
+
+
+      bool Synthesizer::unaryOperatorSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result) {
+        triton::ast::ast_e op = Synthesizer::findUnaryOperator(vars, node);
+
+        // If an oracle is found, we craft a synthesized node.
+        if (op != triton::ast::INVALID_NODE) {
+          result.setOutput(Synthesizer::buildOperator(op, vars, node));
+          result.setSuccess(true);
+        }
+
+        return result.successful();
+      }
+
+
+      bool Synthesizer::binaryOperatorSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result) {
+        triton::ast::ast_e op = Synthesizer::findBinaryOperator(vars, node);
+
+        // If an oracle is found, we craft a synthesized node.
+        if (op != triton::ast::INVALID_NODE) {
+          result.setOutput(Synthesizer::buildOperator(op, vars, node));
+          result.setSuccess(true);
+        }
 
         return result.successful();
       }
@@ -383,6 +594,223 @@ namespace triton {
       }
 
 
+      bool Synthesizer::parallelChildrenSynthesis(const triton::ast::SharedAbstractNode& node, bool constant, bool opaque, triton::usize threads, SynthesisResult& result) {
+        std::unordered_set<const triton::ast::AbstractNode*> visited;
+        std::vector<triton::ast::AbstractNode*> layer = {node.get()};
+        auto actx = node->getContext();
+        bool ret  = false;
+
+        /*
+         * The children are synthesized layer by layer: the children of a layer
+         * are tried together, and those which are not synthesized are the
+         * parents of the next layer. The oracles and the solver queries of a
+         * layer run concurrently, while the nodes are only built on the calling
+         * thread, the AST context not being safe to build from several threads.
+         */
+        while (!layer.empty()) {
+          std::vector<Candidate> candidates;
+          std::vector<triton::ast::AbstractNode*> next;
+
+          for (triton::usize i = 0; i < layer.size(); i++) {
+            auto current = layer[i];
+
+            // This means that node is already visited and we will not need to visited it second time
+            if (visited.insert(current).second == false) {
+              continue;
+            }
+
+            // Unroll reference
+            if (current->getType() == triton::ast::REFERENCE_NODE) {
+              layer.push_back(reinterpret_cast<triton::ast::ReferenceNode*>(current)->getSymbolicExpression()->getAst().get());
+              continue;
+            }
+
+            triton::usize index = 0;
+            for (const auto& child : current->getChildren()) {
+              Candidate candidate;
+              candidate.parent = current;
+              candidate.index  = index++;
+              candidate.node   = child;
+              candidates.push_back(std::move(candidate));
+            }
+          }
+
+          // Look up the memo first, a hit builds its nodes
+          for (auto& c : candidates) {
+            c.vars  = triton::ast::search(c.node, triton::ast::VARIABLE_NODE);
+            c.tried = this->isTried(c.vars, c.node, opaque);
+            if (this->cache && c.tried) {
+              c.key    = SynthesisCache::getKey(c.node, c.vars, constant, opaque);
+              c.cached = this->cache->find(c.key, c.vars, actx, c.output);
+            }
+          }
+
+          // The oracles only read the nodes when they are evaluated natively
+          parallelFor(candidates.size(), threads, [&](triton::usize index) {
+            auto& c = candidates[index];
+            if (c.tried == false || c.cached == true) {
+              return;
+            }
+            if (actx->isBatchEvaluationNative(c.node) == false) {
+              c.deferred = true;
+              return;
+            }
+            c.op = Synthesizer::findOperator(c.vars, c.node);
+            if (c.op == triton::ast::INVALID_NODE) {
+              c.matches = this->lookupDatabases(c.vars, c.node);
+            }
+          });
+
+          for (auto& c : candidates) {
+            if (c.tried == false || c.cached == true) {
+              continue;
+            }
+            if (c.deferred == true) {
+              c.op = Synthesizer::findOperator(c.vars, c.node);
+              if (c.op == triton::ast::INVALID_NODE) {
+                c.matches = this->lookupDatabases(c.vars, c.node);
+              }
+            }
+            if (c.op != triton::ast::INVALID_NODE) {
+              c.output = Synthesizer::buildOperator(c.op, c.vars, c.node);
+            }
+            else if (c.matches.size()) {
+              c.output = this->buildFromDatabases(c.matches, c.vars, c.node);
+            }
+          }
+
+          // Then the constant synthesis, and the opaque constant synthesis of what is left
+          #ifdef TRITON_Z3_INTERFACE
+          if (constant == true) {
+            this->solveConstants(candidates, false, threads);
+          }
+          #endif
+          if (opaque == true && this->solver.isValid()) {
+            this->solveConstants(candidates, true, threads);
+          }
+
+          // Record the results, replace the synthesized children and descend into the others
+          for (auto& c : candidates) {
+            if (this->cache && c.tried && c.cached == false) {
+              this->cache->insert(c.key, c.vars, c.output);
+            }
+
+            if (c.output == nullptr) {
+              next.push_back(c.node.get());
+              continue;
+            }
+
+            SynthesisResult tmp;
+            tmp.setOutput(c.output);
+            tmp.setSuccess(true);
+
+            /* Symbolize the sub expression and replace the child on the fly */
+            c.parent->setChild(c.index, this->symbolizeSubExpression(c.node, tmp));
+            result.setSuccess(true);
+            ret = true;
+          }
+
+          layer = std::move(next);
+        }
+
+        /*
+         * If we synthesized at least one child, we set the output as 'node'
+         * because it has been modified on the fly
+         */
+        if (result.successful()) {
+          result.setOutput(node);
+        }
+
+        return ret;
+      }
+
+
+      void Synthesizer::solveConstants(std::vector<Candidate>& candidates, bool opaque, triton::usize threads) {
+        std::vector<triton::ast::SharedAbstractNode> queries;
+        std::vector<std::pair<triton::usize, triton::usize>> owners;
+
+        /* The queries are built on the calling thread */
+        for (triton::usize index = 0; index < candidates.size(); index++) {
+          auto& c = candidates[index];
+          if (c.tried == false || c.cached == true || c.output != nullptr) {
+            continue;
+          }
+
+          auto actx = c.node->getContext();
+
+          if (opaque == true) {
+            /* The node is sampled first, the solver only proves the constant of the nodes which do not vary */
+            triton::uint512 value = 0;
+            if (actx->sampleConstant(c.node, 4096, &value)) {
+              c.constant = actx->bv(value, c.node->getBitvectorSize());
+              queries.push_back(actx->distinct(c.node, c.constant));
+              owners.push_back({index, 0});
+            }
+            continue;
+          }
+
+          if (c.vars.size() != 1 || Synthesizer::isConstantCandidate(c.vars, c.node) == false) {
+            continue;
+          }
+
+          auto var_x = reinterpret_cast<triton::ast::VariableNode*>(c.vars[0].get())->getSymbolicVariable();
+          c.var_c = this->symbolic->newSymbolicVariable(triton::engines::symbolic::UNDEFINED_VARIABLE, 0, var_x->getSize(), "");
+
+          std::vector<triton::ast::SharedAbstractNode> x = {actx->variable(var_x)};
+          for (const auto& entry : Synthesizer::getConstantEntries(var_x, c.var_c, actx)) {
+            /* For all X, there exists a constant C, such that operator is equal to node */
+            queries.push_back(actx->forall(x, actx->equal(entry.op, c.node)));
+            owners.push_back({index, c.entries.size()});
+            c.entries.push_back(entry);
+          }
+          c.models.resize(c.entries.size());
+        }
+
+        if (queries.empty()) {
+          return;
+        }
+
+        /* Each query is converted into its own solver context */
+        this->solver.solveAll(queries, threads, 0, [&](triton::usize index, triton::engines::solver::status_e status, const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model, triton::uint32) {
+          auto& c = candidates[owners[index].first];
+          if (opaque == true) {
+            if (status == triton::engines::solver::UNSAT) {
+              c.output = c.constant;
+            }
+            return;
+          }
+          if (model.empty()) {
+            return;
+          }
+          c.models[owners[index].second] = model;
+        });
+
+        if (opaque == true) {
+          return;
+        }
+
+        /* The first operator of the table with a constant wins, as in the constant synthesis */
+        for (auto& c : candidates) {
+          for (triton::usize entry = 0; entry < c.models.size(); entry++) {
+            if (c.models[entry].empty()) {
+              continue;
+            }
+
+            auto constant = c.models[entry].at(c.var_c->getId()).getValue();
+            auto size     = c.models[entry].at(c.var_c->getId()).getSize();
+            auto output   = triton::ast::newInstance(c.entries[entry].op.get());
+
+            /* Replace the constant variable to a bitvector */
+            output->setChild(c.entries[entry].position, c.node->getContext()->bv(constant, size));
+            c.output = output;
+            break;
+          }
+          c.entries.clear();
+          c.models.clear();
+        }
+      }
+
+
       triton::ast::SharedAbstractNode Synthesizer::symbolizeSubExpression(const triton::ast::SharedAbstractNode& node, SynthesisResult& tmpResult) {
         triton::ast::SharedAstContext actx      = node->getContext();
         triton::ast::SharedAbstractNode subvar  = nullptr;
@@ -0,0 +1,359 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <triton/memoryResource.hpp>
+#include <triton/taintBitmap.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      /* Returns the mask of `count` bits starting at `bit` in a 64-bit word */
+      static inline triton::uint64 bitmapMask(triton::usize bit, triton::usize count) {
+        if (count >= 64)
+          return ~static_cast<triton::uint64>(0);
+        return ((static_cast<triton::uint64>(1) << count) - 1) << bit;
+      }
+
+
+      /* Returns the number of bits set in a 64-bit word */
+      static inline triton::usize bitmapCount(triton::uint64 word) {
+        return std::bitset<64>(word).count();
+      }
+
+
+      /* Returns the last address of `size` bytes from `addr`, the last address of the memory if they wrap around */
+      static inline triton::uint64 lastAddress(triton::uint64 addr, triton::usize size) {
+        triton::uint64 last = addr + (size - 1);
+        return last < addr ? std::numeric_limits<triton::uint64>::max() : last;
+      }
+
+
+      /* Calls `fn(word, mask)` for each word of the bitmap holding bits from `start` to `start + size`, until it returns true */
+      template <typename F>
+      static bool forEachWord(triton::usize start, triton::usize size, F fn) {
+        for (triton::usize bit = start; bit < start + size;) {
+          triton::usize n = std::min(64 - (bit % 64), start + size - bit);
+          if (fn(bit / 64, bitmapMask(bit % 64, n)))
+            return true;
+          bit += n;
+        }
+        return false;
+      }
+
+
+      /* Calls `fn(page, addr, size)` for each part of an allocated page between `addr` and `last` (included), until it returns true */
+      template <typename F>
+      static void forEachPage(const TaintBitmap::PageMap& pages, triton::uint64 addr, triton::uint64 last, F fn) {
+        triton::uint64 first = TaintBitmap::pageNumber(addr);
+        triton::uint64 lastPn = TaintBitmap::pageNumber(last);
+
+        auto visit = [&](triton::uint64 pn, const TaintBitmap::Page* page) {
+          triton::uint64 start = std::max(addr, pn * TaintBitmap::pageSize);
+          triton::uint64 end   = std::min(last, pn * TaintBitmap::pageSize + (TaintBitmap::pageSize - 1));
+          return fn(page, start, static_cast<triton::usize>(end - start + 1));
+        };
+
+        /* Look up page numbers if there are less of them than allocated pages */
+        if (lastPn - first < pages.size()) {
+          for (triton::uint64 pn = first;; pn++) {
+            auto it = pages.find(pn);
+            if (it != pages.end() && visit(pn, it->second.get()))
+              return;
+            if (pn == lastPn)
+              break;
+          }
+        }
+        else {
+          for (const auto& it : pages) {
+            if (it.first >= first && it.first <= lastPn && visit(it.first, it.second.get()))
+              return;
+          }
+        }
+      }
+
+
+      TaintBitmap::Page::Page() {
+        std::memset(this->tainted, 0x00, sizeof(this->tainted));
+        this->count = 0;
+      }
+
+
+      TaintBitmap::const_iterator::const_iterator(const TaintBitmap* bitmap, bool end) {
+        this->bitmap = bitmap;
+        this->page   = end ? bitmap->pages->end() : bitmap->pages->begin();
+        this->offset = 0;
+        this->seek();
+      }
+
+
+      void TaintBitmap::const_iterator::seek(void) {
+        while (this->page != this->bitmap->pages->end()) {
+          const Page* p = this->page->second.get();
+          while (this->offset < pageSize) {
+            triton::uint64 word = p->tainted[this->offset / 64] >> (this->offset % 64);
+            if (word & 1)
+              return;
+            /* Skip the whole word if there is no more bit set */
+            if (word == 0)
+              this->offset = (this->offset / 64 + 1) * 64;
+            else
+              this->offset++;
+          }
+          this->offset = 0;
+          this->page++;
+        }
+      }
+
+
+      TaintBitmap::const_iterator::value_type TaintBitmap::const_iterator::operator*(void) const {
+        return this->page->first * pageSize + this->offset;
+      }
+
+
+      TaintBitmap::const_iterator& TaintBitmap::const_iterator::operator++(void) {
+        this->offset++;
+        this->seek();
+        return *this;
+      }
+
+
+      TaintBitmap::const_iterator TaintBitmap::const_iterator::operator++(int) {
+        const_iterator old = *this;
+        ++(*this);
+        return old;
+      }
+
+
+      bool TaintBitmap::const_iterator::operator==(const const_iterator& other) const {
+        return this->page == other.page && this->offset == other.offset;
+      }
+
+
+      bool TaintBitmap::const_iterator::operator!=(const const_iterator& other) const {
+        return !(*this == other);
+      }
+
+
+      TaintBitmap::TaintBitmap() {
+        this->resource     = nullptr;
+        this->taintedBytes = 0;
+      }
+
+
+      TaintBitmap::TaintBitmap(const TaintBitmap& other)
+        : TaintBitmap() {
+        *this = other;
+      }
+
+
+      TaintBitmap& TaintBitmap::operator=(const TaintBitmap& other) {
+        if (this == &other)
+          return *this;
+
+        this->pages        = other.pages;
+        this->resource     = other.resource;
+        this->taintedBytes = other.taintedBytes;
+
+        return *this;
+      }
+
+
+      TaintBitmap::Page* TaintBitmap::getWritablePage(std::shared_ptr<Page>& page) {
+        if (page.use_count() > 1)
+          page = triton::utils::allocateShared<Page>(this->resource, *page);
+        return page.get();
+      }
+
+
+      void TaintBitmap::update(triton::uint64 addr, triton::usize size, bool flag) {
+        triton::uint64 pn = TaintBitmap::pageNumber(addr);
+
+        /* Untainting a page not allocated changes nothing */
+        if (flag == false && this->pages->find(pn) == this->pages->end())
+          return;
+
+        std::shared_ptr<Page>& page = this->pages.mutate()[pn];
+        if (page == nullptr)
+          page = triton::utils::allocateShared<Page>(this->resource);
+
+        Page* p = this->getWritablePage(page);
+        forEachWord(TaintBitmap::pageOffset(addr), size, [&](triton::usize index, triton::uint64 mask) {
+          triton::uint64 old = p->tainted[index];
+          p->tainted[index]  = flag ? (old | mask) : (old & ~mask);
+
+          triton::usize changed = bitmapCount(old ^ p->tainted[index]);
+          p->count           = flag ? p->count + changed : p->count - changed;
+          this->taintedBytes = flag ? this->taintedBytes + changed : this->taintedBytes - changed;
+          return false;
+        });
+
+        /* Release the page once it has no tainted byte */
+        if (p->count == 0)
+          this->pages.mutate().erase(pn);
+      }
+
+
+      bool TaintBitmap::isTainted(triton::uint64 addr, triton::usize size) const {
+        bool tainted = false;
+
+        if (size == 0 || this->taintedBytes == 0)
+          return false;
+
+        forEachPage(*this->pages, addr, lastAddress(addr, size), [&](const Page* p, triton::uint64 start, triton::usize n) {
+          tainted = forEachWord(TaintBitmap::pageOffset(start), n, [&](triton::usize index, triton::uint64 mask) {
+            return (p->tainted[index] & mask) != 0;
+          });
+          return tainted;
+        });
+
+        return tainted;
+      }
+
+
+      triton::usize TaintBitmap::count(triton::uint64 addr, triton::usize size) const {
+        triton::usize count = 0;
+
+        if (size == 0 || this->taintedBytes == 0)
+          return 0;
+
+        forEachPage(*this->pages, addr, lastAddress(addr, size), [&](const Page* p, triton::uint64 start, triton::usize n) {
+          /* A whole page is counted at once */
+          if (n == pageSize) {
+            count += p->count;
+            return false;
+          }
+          forEachWord(TaintBitmap::pageOffset(start), n, [&](triton::usize index, triton::uint64 mask) {
+            count += bitmapCount(p->tainted[index] & mask);
+            return false;
+          });
+          return false;
+        });
+
+        return count;
+      }
+
+
+      void TaintBitmap::taint(triton::uint64 addr, triton::usize size) {
+        if (size == 0)
+          return;
+
+        triton::uint64 last = lastAddress(addr, size);
+        while (true) {
+          triton::uint64 end = std::min(last, TaintBitmap::pageNumber(addr) * pageSize + (pageSize - 1));
+          this->update(addr, static_cast<triton::usize>(end - addr + 1), true);
+          if (end == last)
+            break;
+          addr = end + 1;
+        }
+      }
+
+
+      void TaintBitmap::untaint(triton::uint64 addr, triton::usize size) {
+        std::vector<std::pair<triton::uint64, triton::usize>> parts;
+
+        if (size == 0 || this->taintedBytes == 0)
+          return;
+
+        /* The pages are released while they are updated */
+        forEachPage(*this->pages, addr, lastAddress(addr, size), [&](const Page*, triton::uint64 start, triton::usize n) {
+          parts.push_back({start, n});
+          return false;
+        });
+
+        for (const auto& part : parts)
+          this->update(part.first, part.second, false);
+      }
+
+
+      void TaintBitmap::clear(void) {
+        this->pages.clear();
+        this->taintedBytes = 0;
+      }
+
+
+      void TaintBitmap::setMemoryResource(std::pmr::memory_resource* resource) {
+        this->resource = resource;
+      }
+
+
+      triton::usize TaintBitmap::size(void) const {
+        return this->taintedBytes;
+      }
+
+
+      bool TaintBitmap::empty(void) const {
+        return this->taintedBytes == 0;
+      }
+
+
+      std::vector<std::pair<triton::uint64, triton::usize>> TaintBitmap::getRanges(void) const {
+        std::vector<std::pair<triton::uint64, triton::usize>> ranges;
+        std::vector<triton::uint64> numbers;
+
+        numbers.reserve(this->pages->size());
+        for (const auto& it : *this->pages)
+          numbers.push_back(it.first);
+        std::sort(numbers.begin(), numbers.end());
+
+        /* Extends the last interval if the byte follows it */
+        auto add = [&](triton::uint64 addr, triton::usize size) {
+          if (!ranges.empty() && ranges.back().first + ranges.back().second == addr)
+            ranges.back().second += size;
+          else
+            ranges.push_back({addr, size});
+        };
+
+        for (triton::uint64 pn : numbers) {
+          const Page* p = this->pages->at(pn).get();
+          for (triton::usize index = 0; index < bitmapSize; index++) {
+            triton::uint64 word = p->tainted[index];
+            triton::uint64 base = pn * pageSize + index * 64;
+
+            /* Whole words are added at once */
+            if (word == 0)
+              continue;
+            if (word == ~static_cast<triton::uint64>(0)) {
+              add(base, 64);
+              continue;
+            }
+            for (triton::usize bit = 0; bit < 64; bit++) {
+              if ((word >> bit) & 1)
+                add(base + bit, 1);
+            }
+          }
+        }
+
+        return ranges;
+      }
+
+
+      triton::usize TaintBitmap::getNumberOfPages(void) const {
+        return this->pages->size();
+      }
+
+
+      TaintBitmap::const_iterator TaintBitmap::begin(void) const {
+        return const_iterator(this, false);
+      }
+
+
+      TaintBitmap::const_iterator TaintBitmap::end(void) const {
+        return const_iterator(this, true);
+      }
+
+    };
+  };
+};
@@ -14,12 +14,15 @@ namespace triton {
   namespace engines {
     namespace taint {
 
-      TaintEngine::TaintEngine(const triton::modes::SharedModes& modes, triton::engines::symbolic::SymbolicEngine* symbolicEngine, triton::arch::CpuInterface& cpu)
+      TaintEngine::TaintEngine(const triton::modes::SharedModes& modes, triton::engines::symbolic::SymbolicEngine* symbolicEngine, triton::arch::CpuInterface& cpu, std::pmr::memory_resource* resource)
         : modes(modes),
           symbolicEngine(symbolicEngine),
           cpu(cpu) {
         if (this->symbolicEngine == nullptr)
           throw triton::exceptions::TaintEngine("TaintEngine::TaintEngine(): The symbolicEngine cannot be null.");
+
+        this->taintedMemory.setMemoryResource(resource);
+        this->labels.setMemoryResource(resource);
       }
 
 
@@ -29,6 +32,7 @@ namespace triton {
         this->symbolicEngine   = other.symbolicEngine;
         this->taintedMemory    = other.taintedMemory;
         this->taintedRegisters = other.taintedRegisters;
+        this->labels           = other.labels;
       }
 
 
@@ -38,37 +42,209 @@ namespace triton {
         this->symbolicEngine   = other.symbolicEngine;
         this->taintedMemory    = other.taintedMemory;
         this->taintedRegisters = other.taintedRegisters;
+        this->labels           = other.labels;
         return *this;
       }
 
 
+      void TaintEngine::copyState(const TaintEngine& other) {
+        this->taintedMemory    = other.taintedMemory;
+        this->taintedRegisters = other.taintedRegisters;
+        this->labels           = other.labels;
+      }
+
+
+      void TaintEngine::reset(void) {
+        this->taintedMemory.clear();
+        this->taintedRegisters.reset();
+        this->labels.clear();
+      }
+
+
+      static void writeWord(std::ostream& stream, triton::uint64 value) {
+        char bytes[8];
+        for (triton::uint32 i = 0; i < 8; i++)
+          bytes[i] = static_cast<char>((value >> (i * 8)) & 0xff);
+        stream.write(bytes, sizeof(bytes));
+      }
+
+
+      static triton::uint64 readWord(std::istream& stream) {
+        char bytes[8];
+        triton::uint64 value = 0;
+
+        if (!stream.read(bytes, sizeof(bytes)))
+          throw triton::exceptions::TaintEngine("TaintEngine::loadState(): Truncated state.");
+
+        for (triton::uint32 i = 0; i < 8; i++)
+          value |= static_cast<triton::uint64>(static_cast<triton::uint8>(bytes[i])) << (i * 8);
+
+        return value;
+      }
+
+
+      static void writeLabels(std::ostream& stream, const std::vector<triton::uint32>& labels) {
+        writeWord(stream, labels.size());
+        for (triton::uint32 label : labels)
+          writeWord(stream, label);
+      }
+
+
+      static std::vector<triton::uint32> readLabels(std::istream& stream) {
+        std::vector<triton::uint32> labels(readWord(stream));
+        for (auto& label : labels)
+          label = static_cast<triton::uint32>(readWord(stream));
+        return labels;
+      }
+
+
+      void TaintEngine::saveState(std::ostream& stream) const {
+        const auto ranges = this->taintedMemory.getRanges();
+
+        writeWord(stream, ranges.size());
+        for (const auto& range : ranges) {
+          writeWord(stream, range.first);
+          writeWord(stream, range.second);
+        }
+
+        writeWord(stream, this->taintedRegisters.count());
+        for (triton::usize id = 0; id < this->taintedRegisters.size(); id++) {
+          if (this->taintedRegisters.test(id)) {
+            writeWord(stream, id);
+            writeLabels(stream, this->labels.getLabels(this->labels.getRegister(static_cast<triton::arch::register_e>(id))));
+          }
+        }
+
+        /* The labels of the memory, by runs of bytes having the same set */
+        std::vector<std::pair<triton::uint64, triton::usize>> runs;
+        std::vector<TaintLabels::LabelSet> sets;
+        if (this->labels.isUsed()) {
+          for (const auto& range : ranges) {
+            for (triton::usize i = 0; i < range.second; i++) {
+              triton::uint64 addr = range.first + i;
+              TaintLabels::LabelSet set = this->labels.getMemory(addr);
+              if (set == 0)
+                continue;
+              if (!runs.empty() && sets.back() == set && runs.back().first + runs.back().second == addr)
+                runs.back().second++;
+              else {
+                runs.emplace_back(addr, 1);
+                sets.push_back(set);
+              }
+            }
+          }
+        }
+
+        writeWord(stream, runs.size());
+        for (triton::usize i = 0; i < runs.size(); i++) {
+          writeWord(stream, runs[i].first);
+          writeWord(stream, runs[i].second);
+          writeLabels(stream, this->labels.getLabels(sets[i]));
+        }
+      }
+
+
+      void TaintEngine::loadState(std::istream& stream) {
+        this->taintedMemory.clear();
+        this->taintedRegisters.reset();
+        this->labels.clear();
+
+        for (auto count = readWord(stream); count > 0; count--) {
+          triton::uint64 addr = readWord(stream);
+          triton::usize size  = readWord(stream);
+          this->taintedMemory.taint(addr, size);
+        }
+
+        for (auto count = readWord(stream); count > 0; count--) {
+          triton::uint64 id = readWord(stream);
+          if (id >= this->taintedRegisters.size())
+            throw triton::exceptions::TaintEngine("TaintEngine::loadState(): Invalid register.");
+          this->taintedRegisters.set(id);
+          for (triton::uint32 label : readLabels(stream))
+            this->labels.addRegister(static_cast<triton::arch::register_e>(id), this->labels.makeSet(label));
+        }
+
+        for (auto count = readWord(stream); count > 0; count--) {
+          triton::uint64 addr = readWord(stream);
+          triton::usize size  = readWord(stream);
+          for (triton::uint32 label : readLabels(stream))
+            this->labels.addMemory(addr, size, this->labels.makeSet(label));
+        }
+      }
+
+
       /* Returns the tainted addresses */
-      const std::unordered_set<triton::uint64>& TaintEngine::getTaintedMemory(void) const {
+      const triton::engines::taint::TaintBitmap& TaintEngine::getTaintedMemory(void) const {
         return this->taintedMemory;
       }
 
 
+      /* Returns the intervals of tainted addresses */
+      std::vector<std::pair<triton::uint64, triton::usize>> TaintEngine::getTaintedRanges(void) const {
+        return this->taintedMemory.getRanges();
+      }
+
+
       /* Returns the tainted registers */
       std::unordered_set<const triton::arch::Register*> TaintEngine::getTaintedRegisters(void) const {
         std::unordered_set<const triton::arch::Register*> res;
 
-        for (auto id : this->taintedRegisters)
-          res.insert(&this->cpu.getRegister(id));
+        if (this->taintedRegisters.none())
+          return res;
+
+        for (triton::usize id = 0; id < this->taintedRegisters.size(); id++) {
+          if (this->taintedRegisters.test(id))
+            res.insert(&this->cpu.getRegister(static_cast<triton::arch::register_e>(id)));
+        }
 
         return res;
       }
 
 
-      /* Returns true of false if the memory address is currently tainted */
-      bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem, bool mode) const {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
+      /* Returns the view of the tainted registers */
+      const triton::engines::taint::RegisterSet& TaintEngine::getTaintedRegisterSet(void) const {
+        return this->taintedRegisters;
+      }
 
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
+
+      /* Returns the labels reaching the addresses */
+      std::vector<triton::uint32> TaintEngine::getMemoryTaintLabels(triton::uint64 addr, triton::usize size) const {
+        return this->labels.getLabels(this->labels.getMemory(addr, size));
+      }
+
+
+      /* Returns the labels reaching the memory */
+      std::vector<triton::uint32> TaintEngine::getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const {
+        return this->labels.getLabels(this->getMemoryLabels(mem));
+      }
+
+
+      /* Returns the labels reaching the register */
+      std::vector<triton::uint32> TaintEngine::getRegisterTaintLabels(const triton::arch::Register& reg) const {
+        return this->labels.getLabels(this->labels.getRegister(reg.getParent()));
+      }
+
+
+      /* Returns the labels of the memory, with the labels of its pointers if the taint spreads through them */
+      triton::engines::taint::TaintLabels::LabelSet TaintEngine::getMemoryLabels(const triton::arch::MemoryAccess& mem, bool mode) const {
+        triton::engines::taint::TaintLabels::LabelSet set = this->labels.getMemory(mem.getAddress(), mem.getSize());
+
+        if (mode && this->modes->isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
+          for (const auto* reg : {&mem.getConstBaseRegister(), &mem.getConstIndexRegister(), &mem.getConstSegmentRegister()}) {
+            if (this->isRegisterTainted(*reg))
+              set = this->labels.unite(set, this->labels.getRegister(reg->getParent()));
+          }
         }
 
+        return set;
+      }
+
+
+      /* Returns true of false if the memory address is currently tainted */
+      bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem, bool mode) const {
+        if (this->taintedMemory.isTainted(mem.getAddress(), mem.getSize()))
+          return TAINTED;
+
         /* Spread the taint through pointers if the mode is enabled */
         if (mode && this->modes->isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
           if (this->isRegisterTainted(mem.getConstBaseRegister()))
@@ -84,19 +260,23 @@ namespace triton {
 
 
       /* Returns true of false if the address is currently tainted */
-      bool TaintEngine::isMemoryTainted(triton::uint64 addr, triton::uint32 size) const {
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
+      bool TaintEngine::isMemoryTainted(triton::uint64 addr, triton::usize size) const {
+        if (this->taintedMemory.isTainted(addr, size))
+          return TAINTED;
 
         return !TAINTED;
       }
 
 
+      /* Returns true of false if one of the addresses is currently tainted */
+      bool TaintEngine::isAnyTainted(triton::uint64 addr, triton::usize size) const {
+        return this->isMemoryTainted(addr, size);
+      }
+
+
       /* Returns true of false if the register is currently tainted */
       bool TaintEngine::isRegisterTainted(const triton::arch::Register& reg) const {
-        if (this->taintedRegisters.find(reg.getParent()) != this->taintedRegisters.end())
+        if (this->taintedRegisters.test(reg.getParent()))
           return TAINTED;
 
         return !TAINTED;
@@ -117,14 +297,15 @@ namespace triton {
 
       /* Taint the register */
       bool TaintEngine::taintRegister(const triton::arch::Register& reg) {
-        this->taintedRegisters.insert(reg.getParent());
+        this->taintedRegisters.set(reg.getParent());
         return TAINTED;
       }
 
 
       /* Untaint the register */
       bool TaintEngine::untaintRegister(const triton::arch::Register& reg) {
-        this->taintedRegisters.erase(reg.getParent());
+        this->taintedRegisters.reset(reg.getParent());
+        this->labels.setRegister(reg.getParent(), 0);
         return !TAINTED;
       }
 
@@ -167,39 +348,65 @@ namespace triton {
 
       /* Taint the memory */
       bool TaintEngine::taintMemory(const triton::arch::MemoryAccess& mem) {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
+        this->taintedMemory.taint(mem.getAddress(), mem.getSize());
+        return TAINTED;
+      }
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.insert(addr+index);
 
+      /* Taint the addresses */
+      bool TaintEngine::taintMemory(triton::uint64 addr, triton::usize size) {
+        this->taintedMemory.taint(addr, size);
         return TAINTED;
       }
 
 
-      /* Taint the address */
-      bool TaintEngine::taintMemory(triton::uint64 addr) {
-        this->taintedMemory.insert(addr);
+      /* Taint an interval of addresses */
+      bool TaintEngine::taintMemoryRange(triton::uint64 addr, triton::usize size) {
+        return this->taintMemory(addr, size);
+      }
+
+
+      /* Taint the addresses with a label */
+      bool TaintEngine::taintMemoryWithLabel(triton::uint64 addr, triton::usize size, triton::uint32 label) {
+        this->taintedMemory.taint(addr, size);
+        this->labels.addMemory(addr, size, this->labels.makeSet(label));
+        return TAINTED;
+      }
+
+
+      /* Taint the memory with a label */
+      bool TaintEngine::taintMemoryWithLabel(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
+        return this->taintMemoryWithLabel(mem.getAddress(), mem.getSize(), label);
+      }
+
+
+      /* Taint the register with a label */
+      bool TaintEngine::taintRegisterWithLabel(const triton::arch::Register& reg, triton::uint32 label) {
+        this->taintedRegisters.set(reg.getParent());
+        this->labels.addRegister(reg.getParent(), this->labels.makeSet(label));
         return TAINTED;
       }
 
 
       /* Untaint the memory */
       bool TaintEngine::untaintMemory(const triton::arch::MemoryAccess& mem) {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
+        this->taintedMemory.untaint(mem.getAddress(), mem.getSize());
+        this->labels.setMemory(mem.getAddress(), mem.getSize(), 0);
+        return !TAINTED;
+      }
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.erase(addr+index);
 
+      /* Untaint the addresses */
+      bool TaintEngine::untaintMemory(triton::uint64 addr, triton::usize size) {
+        this->taintedMemory.untaint(addr, size);
+        this->labels.setMemory(addr, size, 0);
         return !TAINTED;
       }
 
 
-      /* Untaint the address */
-      bool TaintEngine::untaintMemory(triton::uint64 addr) {
-        this->taintedMemory.erase(addr);
-        return !TAINTED;
+      /* Untaint an interval of addresses */
+      bool TaintEngine::untaintMemoryRange(triton::uint64 addr, triton::usize size) {
+        return this->untaintMemory(addr, size);
       }
 
 
@@ -407,6 +614,8 @@ namespace triton {
       bool TaintEngine::assignmentRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc) {
         if (this->isRegisterTainted(regSrc)) {
           this->taintRegister(regDst);
+          if (this->labels.isUsed())
+            this->labels.setRegister(regDst.getParent(), this->labels.getRegister(regSrc.getParent()));
           return TAINTED;
         }
 
@@ -426,6 +635,8 @@ namespace triton {
       bool TaintEngine::assignmentRegisterMemory(const triton::arch::Register& regDst, const triton::arch::MemoryAccess& memSrc) {
         if (this->isMemoryTainted(memSrc)) {
           this->taintRegister(regDst);
+          if (this->labels.isUsed())
+            this->labels.setRegister(regDst.getParent(), this->getMemoryLabels(memSrc));
           return TAINTED;
         }
 
@@ -441,6 +652,13 @@ namespace triton {
         triton::uint64 addrSrc  = memSrc.getAddress();
         triton::uint64 addrDst  = memDst.getAddress();
 
+        /* The labels of the source, before the destination overlapping it is written */
+        std::vector<triton::engines::taint::TaintLabels::LabelSet> sets;
+        if (this->labels.isUsed()) {
+          for (triton::uint32 offset = 0; offset < readSize; offset++)
+            sets.push_back(this->labels.getMemory(addrSrc+offset));
+        }
+
         for (triton::uint32 offset = 0; offset < readSize; offset++) {
           if (this->isMemoryTainted(addrSrc+offset)) {
             this->taintMemory(addrDst+offset);
@@ -450,10 +668,15 @@ namespace triton {
             this->untaintMemory(addrDst+offset);
         }
 
+        for (triton::uint32 offset = 0; offset < sets.size(); offset++)
+          this->labels.setMemory(addrDst+offset, 1, sets[offset]);
+
         /* Spread the taint through pointers if the mode is enabled */
         if (this->modes->isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
           if (this->isMemoryTainted(memSrc)) {
             this->taintMemory(memDst);
+            if (this->labels.isUsed())
+              this->labels.addMemory(addrDst, memDst.getSize(), this->getMemoryLabels(memSrc));
             isTainted = TAINTED;
           }
         }
@@ -474,6 +697,8 @@ namespace triton {
         /* Check source */
         if (this->isRegisterTainted(regSrc)) {
           this->taintMemory(memDst);
+          if (this->labels.isUsed())
+            this->labels.setMemory(memDst.getAddress(), memDst.getSize(), this->labels.getRegister(regSrc.getParent()));
           return TAINTED;
         }
 
@@ -493,6 +718,8 @@ namespace triton {
       bool TaintEngine::unionRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc) {
         if (this->isRegisterTainted(regSrc)) {
           this->taintRegister(regDst);
+          if (this->labels.isUsed())
+            this->labels.addRegister(regDst.getParent(), this->labels.getRegister(regSrc.getParent()));
           return TAINTED;
         }
         return this->isRegisterTainted(regDst);
@@ -506,6 +733,13 @@ namespace triton {
         triton::uint64 addrDst   = memDst.getAddress();
         triton::uint64 addrSrc   = memSrc.getAddress();
 
+        /* The labels of the source, before the destination overlapping it is written */
+        std::vector<triton::engines::taint::TaintLabels::LabelSet> sets;
+        if (this->labels.isUsed()) {
+          for (triton::uint32 offset = 0; offset < writeSize; offset++)
+            sets.push_back(this->labels.getMemory(addrSrc+offset));
+        }
+
         /* Check source */
         for (triton::uint32 offset = 0; offset < writeSize; offset++) {
           if (this->isMemoryTainted(addrSrc+offset)) {
@@ -514,10 +748,15 @@ namespace triton {
           }
         }
 
+        for (triton::uint32 offset = 0; offset < sets.size(); offset++)
+          this->labels.addMemory(addrDst+offset, 1, sets[offset]);
+
         /* Spread the taint through pointers if the mode is enabled */
         if (this->modes->isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
           if (this->isMemoryTainted(memSrc)) {
             this->taintMemory(memDst);
+            if (this->labels.isUsed())
+              this->labels.addMemory(addrDst, writeSize, this->getMemoryLabels(memSrc));
             isTainted = TAINTED;
           }
         }
@@ -535,6 +774,8 @@ namespace triton {
       bool TaintEngine::unionRegisterMemory(const triton::arch::Register& regDst, const triton::arch::MemoryAccess& memSrc) {
         if (this->isMemoryTainted(memSrc)) {
           this->taintRegister(regDst);
+          if (this->labels.isUsed())
+            this->labels.addRegister(regDst.getParent(), this->getMemoryLabels(memSrc));
           return TAINTED;
         }
         return this->isRegisterTainted(regDst);
@@ -554,6 +795,8 @@ namespace triton {
       bool TaintEngine::unionMemoryRegister(const triton::arch::MemoryAccess& memDst, const triton::arch::Register& regSrc) {
         if (this->isRegisterTainted(regSrc)) {
           this->taintMemory(memDst);
+          if (this->labels.isUsed())
+            this->labels.addMemory(memDst.getAddress(), memDst.getSize(), this->labels.getRegister(regSrc.getParent()));
           return TAINTED;
         }
 
@@ -0,0 +1,245 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <iterator>
+
+#include <triton/exceptions.hpp>
+#include <triton/memoryResource.hpp>
+#include <triton/taintLabels.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      TaintLabels::Page::Page() {
+        std::fill(std::begin(this->labels), std::end(this->labels), static_cast<LabelSet>(0));
+        this->count = 0;
+      }
+
+
+      TaintLabels::TaintLabels() {
+        this->resource = nullptr;
+        this->used     = false;
+      }
+
+
+      TaintLabels::TaintLabels(const TaintLabels& other)
+        : TaintLabels() {
+        *this = other;
+      }
+
+
+      TaintLabels& TaintLabels::operator=(const TaintLabels& other) {
+        if (this == &other)
+          return *this;
+
+        this->table     = other.table;
+        this->pages     = other.pages;
+        this->registers = other.registers;
+        this->resource  = other.resource;
+        this->used      = other.used;
+
+        return *this;
+      }
+
+
+      TaintLabels::LabelSet TaintLabels::intern(const std::vector<triton::uint32>& labels) const {
+        if (labels.empty())
+          return 0;
+
+        /* The labels are sorted, the highest one is the last */
+        if (labels.back() < TaintLabels::inlineLabels) {
+          LabelSet set = 0;
+          for (triton::uint32 label : labels)
+            set |= static_cast<LabelSet>(1) << label;
+          return set;
+        }
+
+        auto it = this->table->indexes.find(labels);
+        if (it != this->table->indexes.end())
+          return TaintLabels::interned | it->second;
+
+        Table& table = this->table.mutate();
+        triton::uint64 index = table.sets.size();
+        table.sets.push_back(labels);
+        table.indexes[labels] = index;
+
+        return TaintLabels::interned | index;
+      }
+
+
+      TaintLabels::Page* TaintLabels::getWritablePage(std::shared_ptr<Page>& page) {
+        if (page.use_count() > 1)
+          page = triton::utils::allocateShared<Page>(this->resource, *page);
+        return page.get();
+      }
+
+
+      bool TaintLabels::isUsed(void) const {
+        return this->used;
+      }
+
+
+      TaintLabels::LabelSet TaintLabels::makeSet(triton::uint32 label) {
+        this->used = true;
+        return this->intern({label});
+      }
+
+
+      TaintLabels::LabelSet TaintLabels::unite(LabelSet set1, LabelSet set2) const {
+        if (set1 == set2 || set2 == 0)
+          return set1;
+
+        if (set1 == 0)
+          return set2;
+
+        if (((set1 | set2) & TaintLabels::interned) == 0)
+          return set1 | set2;
+
+        std::vector<triton::uint32> labels1 = this->getLabels(set1);
+        std::vector<triton::uint32> labels2 = this->getLabels(set2);
+        std::vector<triton::uint32> labels;
+
+        labels.reserve(labels1.size() + labels2.size());
+        std::set_union(labels1.begin(), labels1.end(), labels2.begin(), labels2.end(), std::back_inserter(labels));
+
+        return this->intern(labels);
+      }
+
+
+      std::vector<triton::uint32> TaintLabels::getLabels(LabelSet set) const {
+        std::vector<triton::uint32> labels;
+
+        if (set & TaintLabels::interned) {
+          triton::uint64 index = set & ~TaintLabels::interned;
+          if (index >= this->table->sets.size())
+            throw triton::exceptions::TaintEngine("TaintLabels::getLabels(): Invalid set of labels.");
+          return this->table->sets[index];
+        }
+
+        for (triton::uint32 label = 0; set != 0; label++, set >>= 1) {
+          if (set & 1)
+            labels.push_back(label);
+        }
+
+        return labels;
+      }
+
+
+      TaintLabels::LabelSet TaintLabels::getMemory(triton::uint64 addr, triton::usize size) const {
+        LabelSet set = 0;
+
+        if (this->pages->empty())
+          return 0;
+
+        for (triton::usize index = 0; index < size; index++) {
+          triton::uint64 cur = addr + index;
+          auto it = this->pages->find(TaintBitmap::pageNumber(cur));
+
+          /* Skip the rest of a page not allocated */
+          if (it == this->pages->end()) {
+            index += (pageSize - TaintBitmap::pageOffset(cur)) - 1;
+            continue;
+          }
+
+          set = this->unite(set, it->second->labels[TaintBitmap::pageOffset(cur)]);
+        }
+
+        return set;
+      }
+
+
+      void TaintLabels::updateMemory(triton::uint64 addr, triton::usize size, LabelSet set, bool add) {
+        for (triton::usize index = 0; index < size;) {
+          triton::uint64 cur = addr + index;
+          triton::uint64 pn  = TaintBitmap::pageNumber(cur);
+          triton::usize  off = TaintBitmap::pageOffset(cur);
+          triton::usize  n   = std::min(pageSize - off, size - index);
+          index += n;
+
+          /* Nothing to clear in a page not allocated */
+          if (set == 0 && this->pages->find(pn) == this->pages->end())
+            continue;
+
+          std::shared_ptr<Page>& page = this->pages.mutate()[pn];
+          if (page == nullptr)
+            page = triton::utils::allocateShared<Page>(this->resource);
+
+          Page* p = this->getWritablePage(page);
+          for (triton::usize i = off; i < off + n; i++) {
+            LabelSet value = add ? this->unite(p->labels[i], set) : set;
+            if (p->labels[i] == 0 && value != 0)
+              p->count++;
+            else if (p->labels[i] != 0 && value == 0)
+              p->count--;
+            p->labels[i] = value;
+          }
+
+          /* Release the page once it has no label */
+          if (p->count == 0)
+            this->pages.mutate().erase(pn);
+        }
+      }
+
+
+      void TaintLabels::setMemory(triton::uint64 addr, triton::usize size, LabelSet set) {
+        if (set == 0 && this->pages->empty())
+          return;
+        this->updateMemory(addr, size, set, false);
+      }
+
+
+      void TaintLabels::addMemory(triton::uint64 addr, triton::usize size, LabelSet set) {
+        if (set == 0)
+          return;
+        this->updateMemory(addr, size, set, true);
+      }
+
+
+      TaintLabels::LabelSet TaintLabels::getRegister(triton::arch::register_e parent) const {
+        auto it = this->registers->find(parent);
+        if (it == this->registers->end())
+          return 0;
+        return it->second;
+      }
+
+
+      void TaintLabels::setRegister(triton::arch::register_e parent, LabelSet set) {
+        if (set == 0) {
+          if (this->registers->find(parent) != this->registers->end())
+            this->registers.mutate().erase(parent);
+          return;
+        }
+        this->registers.mutate()[parent] = set;
+      }
+
+
+      void TaintLabels::addRegister(triton::arch::register_e parent, LabelSet set) {
+        if (set == 0)
+          return;
+        this->setRegister(parent, this->unite(this->getRegister(parent), set));
+      }
+
+
+      void TaintLabels::clear(void) {
+        this->table = triton::utils::CopyOnWrite<Table>();
+        this->pages.clear();
+        this->registers.clear();
+        this->used = false;
+      }
+
+
+      void TaintLabels::setMemoryResource(std::pmr::memory_resource* resource) {
+        this->resource = resource;
+      }
+
+    };
+  };
+};
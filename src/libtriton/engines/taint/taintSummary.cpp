@@ -0,0 +1,183 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <unordered_map>
+
+#include <triton/context.hpp>
+#include <triton/taintBitmap.hpp>
+#include <triton/taintSummary.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      TaintSummary::TaintSummary() {
+        this->first = 0;
+        this->count = 0;
+      }
+
+
+      TaintSummary TaintSummary::compute(triton::arch::architecture_e arch,
+                                         const std::vector<triton::loaders::TraceRecord>& records,
+                                         triton::usize begin,
+                                         triton::usize end,
+                                         const std::vector<std::pair<triton::arch::register_e, triton::uint512>>& registers,
+                                         const std::function<triton::uint8(triton::uint64)>& memory) {
+        TaintSummary summary;
+        triton::Context ctx(arch);
+
+        /* The location named by each label */
+        std::vector<TaintLocation> locations;
+        std::unordered_map<triton::arch::register_e, triton::uint32> registerLabels;
+        std::unordered_map<triton::uint64, triton::uint32> memoryLabels;
+
+        /* The bytes labeled or written by the chunk, and the written ones */
+        TaintBitmap seen;
+        TaintBitmap written;
+
+        summary.first = begin;
+        summary.count = end - begin;
+
+        auto setDeltas = [&](const triton::loaders::TraceRecord& record) {
+          for (const auto& delta : record.registers)
+            ctx.setConcreteRegisterValue(ctx.getRegister(delta.first), delta.second, false);
+
+          for (const auto& delta : record.memory)
+            ctx.setConcreteMemoryAreaValue(delta.address, record.bytes.data() + delta.offset, delta.size, false);
+        };
+
+        for (const auto& reg : registers)
+          ctx.setConcreteRegisterValue(ctx.getRegister(reg.first), reg.second, false);
+
+        for (triton::usize i = 0; i < begin; i++)
+          setDeltas(records[i]);
+
+        for (const auto* reg : ctx.getParentRegisters()) {
+          triton::uint32 label = static_cast<triton::uint32>(locations.size());
+          locations.push_back({reg->getId(), 0});
+          registerLabels[reg->getId()] = label;
+          ctx.taintRegisterWithLabel(*reg, label);
+        }
+
+        auto labelMemory = [&](triton::uint64 addr, triton::usize size) {
+          for (triton::usize i = 0; i < size; i++) {
+            if (seen.isTainted(addr + i))
+              continue;
+            triton::uint32 label = static_cast<triton::uint32>(locations.size());
+            locations.push_back({triton::arch::ID_REG_INVALID, addr + i});
+            memoryLabels[addr + i] = label;
+            seen.taint(addr + i);
+            ctx.taintMemoryWithLabel(addr + i, 1, label);
+          }
+        };
+
+        /* The loads read the concrete memory before the taint is propagated */
+        ctx.addCallback(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, triton::callbacks::getConcreteMemoryValueCallback([&](triton::Context&, const triton::arch::MemoryAccess& mem) {
+          for (triton::usize i = 0; i < mem.getSize(); i++) {
+            if (!ctx.isConcreteMemoryValueDefined(mem.getAddress() + i))
+              ctx.setConcreteMemoryValue(mem.getAddress() + i, memory(mem.getAddress() + i), false);
+          }
+          labelMemory(mem.getAddress(), mem.getSize());
+        }, &seen));
+
+        for (triton::usize i = begin; i < end; i++) {
+          const triton::loaders::TraceRecord& record = records[i];
+          setDeltas(record);
+
+          triton::arch::Instruction inst(record.address, record.opcode.data(), static_cast<triton::uint32>(record.opcode.size()));
+          ctx.processing(inst);
+
+          for (const auto& store : inst.getStoreAccess()) {
+            seen.taint(store.first.getAddress(), store.first.getSize());
+            written.taint(store.first.getAddress(), store.first.getSize());
+          }
+
+          /* The loads of symbolic memory did not read the concrete one */
+          for (const auto& load : inst.getLoadAccess())
+            labelMemory(load.first.getAddress(), load.first.getSize());
+        }
+
+        auto dependencies = [&](const std::vector<triton::uint32>& labels) {
+          std::vector<TaintLocation> sources;
+          sources.reserve(labels.size());
+          for (triton::uint32 label : labels)
+            sources.push_back(locations[label]);
+          return sources;
+        };
+
+        /* A location only reached by its own label kept its taint */
+        for (const auto* reg : ctx.getParentRegisters()) {
+          auto labels = ctx.getRegisterTaintLabels(*reg);
+          if (labels.size() == 1 && labels[0] == registerLabels[reg->getId()])
+            continue;
+          summary.outputs.push_back({{reg->getId(), 0}, dependencies(labels)});
+        }
+
+        for (triton::uint64 addr : written) {
+          auto labels = ctx.getMemoryTaintLabels(addr);
+          auto it = memoryLabels.find(addr);
+          if (labels.size() == 1 && it != memoryLabels.end() && labels[0] == it->second)
+            continue;
+          summary.outputs.push_back({{triton::arch::ID_REG_INVALID, addr}, dependencies(labels)});
+        }
+
+        return summary;
+      }
+
+
+      triton::usize TaintSummary::getFirstRecord(void) const {
+        return this->first;
+      }
+
+
+      triton::usize TaintSummary::getNumberOfRecords(void) const {
+        return this->count;
+      }
+
+
+      const std::vector<std::pair<TaintLocation, std::vector<TaintLocation>>>& TaintSummary::getOutputs(void) const {
+        return this->outputs;
+      }
+
+
+      void TaintSummary::apply(triton::engines::taint::TaintEngine& engine, const triton::arch::CpuInterface& cpu) const {
+        auto isTainted = [&](const TaintLocation& location) {
+          if (location.reg != triton::arch::ID_REG_INVALID)
+            return engine.isRegisterTainted(cpu.getRegister(location.reg));
+          return engine.isMemoryTainted(location.address);
+        };
+
+        /* All the outputs depend on the taint at the entry of the chunk */
+        std::vector<bool> flags;
+        flags.reserve(this->outputs.size());
+        for (const auto& output : this->outputs) {
+          bool flag = !TAINTED;
+          for (const auto& source : output.second) {
+            if (isTainted(source)) {
+              flag = TAINTED;
+              break;
+            }
+          }
+          flags.push_back(flag);
+        }
+
+        for (triton::usize i = 0; i < this->outputs.size(); i++) {
+          const TaintLocation& location = this->outputs[i].first;
+          if (location.reg != triton::arch::ID_REG_INVALID)
+            engine.setTaintRegister(cpu.getRegister(location.reg), flags[i]);
+          else if (flags[i] == TAINTED)
+            engine.taintMemory(location.address);
+          else
+            engine.untaintMemory(location.address);
+        }
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -82,7 +82,10 @@ namespace triton {
             //! Control flow semantics. Used to represent PC.
             void controlFlow_s(triton::arch::Instruction& inst);
 
-            //! Creates a conditional node.
+            //! Returns the condition of a conditional instruction, or nullptr if the instruction is unconditional.
+            triton::ast::SharedAbstractNode getCodeConditionNode(triton::arch::Instruction& inst);
+
+            //! Creates a conditional node, directly selecting `thenNode` or `elseNode` if the condition is concrete.
             triton::ast::SharedAbstractNode getCodeConditionAst(triton::arch::Instruction& inst,
                                                                 triton::ast::SharedAbstractNode& thenNode,
                                                                 triton::ast::SharedAbstractNode& elseNode);
@@ -10,11 +10,13 @@
 
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 #include <triton/archEnums.hpp>
 #include <triton/architecture.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/register.hpp>
+#include <triton/registerFile.hpp>
 
 
 
@@ -52,10 +54,27 @@ namespace triton {
         //! \class AArch64Specifications
         /*! \brief The AArch64Specifications class defines specifications about the AArch64 CPU */
         class AArch64Specifications {
+          private:
+            //! The registers specification of an architecture.
+            struct RegisterTables {
+              //! The registers <id : register>.
+              std::unordered_map<triton::arch::register_e, const triton::arch::Register> id2reg;
+
+              //! The register ids <name : id>.
+              std::unordered_map<std::string, triton::arch::register_e> name2id;
+
+              //! The registers indexed by id, nullptr if not available.
+              std::vector<const triton::arch::Register*> id2ptr;
+            };
+
+            //! Returns the registers specification of an architecture, built once on the first call and shared by every instance.
+            static const RegisterTables& getRegisterTables(triton::arch::architecture_e arch);
+
           protected:
-            //! List of registers specification available for this architecture.
-            std::unordered_map<triton::arch::register_e, const triton::arch::Register> id2reg;
-            std::unordered_map<std::string, triton::arch::register_e> name2id;
+            //! List of registers specification available for this architecture (immutable, shared by every instance).
+            const std::unordered_map<triton::arch::register_e, const triton::arch::Register>& id2reg;
+            const std::unordered_map<std::string, triton::arch::register_e>& name2id;
+            const std::vector<const triton::arch::Register*>& id2ptr;
 
           public:
             //! Constructor.
@@ -83,6 +102,36 @@ namespace triton {
             TRITON_EXPORT triton::uint32 getMemoryOperandSpecialSize(triton::uint32 id) const;
         };
 
+        //! Returns the layout of the concrete register file of the AArch64 CPU.
+        constexpr triton::arch::RegisterFileLayout registerFileLayout(void) {
+          triton::arch::RegisterFileLayout layout;
+
+          /* Parent registers have their own storage, except flags and immutable registers */
+          #define REG_SPEC(UPPER_NAME, _1, AARCH64_UPPER, _3, AARCH64_PARENT, MUTABLE)                                                       \
+          if ((MUTABLE) && triton::arch::ID_REG_AARCH64_##AARCH64_PARENT == triton::arch::ID_REG_AARCH64_##UPPER_NAME && (AARCH64_UPPER) >= 7) \
+            layout.addRegister(triton::arch::ID_REG_AARCH64_##UPPER_NAME, (AARCH64_UPPER) + 1);
+          #define REG_SPEC_NO_CAPSTONE REG_SPEC
+          #define SYS_REG_SPEC REG_SPEC
+          #include "triton/aarch64.spec"
+
+          /* Sub-registers are stored in their parent */
+          #define REG_SPEC(UPPER_NAME, _1, AARCH64_UPPER, AARCH64_LOWER, AARCH64_PARENT, _5)                                     \
+          if (triton::arch::ID_REG_AARCH64_##AARCH64_PARENT != triton::arch::ID_REG_AARCH64_##UPPER_NAME)                           \
+            layout.addSubRegister(triton::arch::ID_REG_AARCH64_##UPPER_NAME, triton::arch::ID_REG_AARCH64_##AARCH64_PARENT, (AARCH64_LOWER), (AARCH64_UPPER) - (AARCH64_LOWER) + 1);
+          #define REG_SPEC_NO_CAPSTONE REG_SPEC
+          #define SYS_REG_SPEC REG_SPEC
+          #include "triton/aarch64.spec"
+
+          /* Flags are stored in the status register */
+          layout.addSubRegister(triton::arch::ID_REG_AARCH64_N, triton::arch::ID_REG_AARCH64_SPSR, 31, 1);
+          layout.addSubRegister(triton::arch::ID_REG_AARCH64_Z, triton::arch::ID_REG_AARCH64_SPSR, 30, 1);
+          layout.addSubRegister(triton::arch::ID_REG_AARCH64_C, triton::arch::ID_REG_AARCH64_SPSR, 29, 1);
+          layout.addSubRegister(triton::arch::ID_REG_AARCH64_V, triton::arch::ID_REG_AARCH64_SPSR, 28, 1);
+
+          return layout;
+        }
+
+
         //! AArch64 NOP instruction
         const triton::arch::Instruction nop = triton::arch::Instruction("\x1f\x20\x03\xd5", 4);
 
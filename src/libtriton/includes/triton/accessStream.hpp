@@ -0,0 +1,157 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_ACCESSSTREAM_HPP
+#define TRITON_ACCESSSTREAM_HPP
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  class Context;
+
+  //! The Callbacks namespace
+  namespace callbacks {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup callbacks
+   *  @{
+   */
+
+    //! A memory access of an AccessRecord.
+    struct AccessValue {
+      //! The address of the access.
+      triton::uint64 address;
+
+      //! The size of the access in bytes.
+      triton::uint32 size;
+
+      //! The value loaded or stored.
+      triton::uint512 value;
+    };
+
+    //! The accesses of a processed instruction.
+    struct AccessRecord {
+      //! The address of the instruction.
+      triton::uint64 address;
+
+      //! The loads, in the order of the addresses.
+      std::vector<AccessValue> loads;
+
+      //! The stores, in the order of the addresses.
+      std::vector<AccessValue> stores;
+
+      //! The registers written and their values <register : value>.
+      std::vector<std::pair<triton::arch::register_e, triton::uint512>> registers;
+    };
+
+    //! Receives the records of an AccessStream, on its consumer thread.
+    using AccessObserver = std::function<void(const AccessRecord& record)>;
+
+
+    /*! \class AccessStream
+     *  \brief Streams the accesses of the processed instructions to an observer.
+     *
+     *  \details Once attached with `Context::setAccessStream()`, each instruction processed by the context,
+     *  alone or in a basic block, gives one AccessRecord written into a ring buffer of `capacity` slots.
+     *  The values come from the expressions of the instruction, and from the concrete state after the
+     *  instruction when it has none (see CONCRETE_FAST_PATH). A consumer thread drains the buffer and calls
+     *  the observer in order, so the emulation does not wait for it. The buffer is lock-free with a single
+     *  producer, the thread of the context: when it is full, the producer yields until a slot is free and
+     *  counts a stall. The slots are reused, their vectors keeping their capacity. An exception raised by
+     *  the observer drops the records which follow and is raised again by `flush()` or `stop()`.
+     */
+    class AccessStream {
+      private:
+        //! The slots of the ring buffer.
+        std::vector<AccessRecord> slots;
+
+        //! The capacity of the ring buffer minus one, the capacity being a power of two.
+        triton::usize mask;
+
+        //! The number of records written, only advanced by the producer.
+        alignas(64) std::atomic<triton::usize> head;
+
+        //! The number of records drained, only advanced by the consumer.
+        alignas(64) std::atomic<triton::usize> tail;
+
+        //! True once the consumer must end after draining the buffer.
+        std::atomic<bool> stopping;
+
+        //! The number of records which waited for a free slot.
+        triton::usize stalls;
+
+        //! The observer.
+        AccessObserver observer;
+
+        //! The first exception raised by the observer.
+        std::exception_ptr error;
+
+        //! True once `error` is set.
+        std::atomic<bool> failed;
+
+        //! The consumer thread.
+        std::thread consumer;
+
+        //! The loop of the consumer thread.
+        void drain(void);
+
+        //! Raises again the exception of the observer, if any.
+        void rethrow(void);
+
+      public:
+        //! Constructor. Starts the consumer thread, the capacity being rounded up to a power of two.
+        TRITON_EXPORT AccessStream(const AccessObserver& observer, triton::usize capacity=4096);
+
+        AccessStream(const AccessStream& other) = delete;
+        AccessStream& operator=(const AccessStream& other) = delete;
+
+        //! Destructor. Drains the buffer and ends the consumer thread.
+        TRITON_EXPORT ~AccessStream();
+
+        //! Writes the record of an instruction processed by `ctx`. Called by the context, on its thread.
+        TRITON_EXPORT void record(const triton::Context& ctx, triton::arch::Instruction& inst);
+
+        //! Waits until the observer has received all the records written.
+        TRITON_EXPORT void flush(void);
+
+        //! Drains the buffer and ends the consumer thread. No record may be written afterwards.
+        TRITON_EXPORT void stop(void);
+
+        //! Returns the capacity of the ring buffer.
+        TRITON_EXPORT triton::usize getCapacity(void) const;
+
+        //! Returns the number of records written.
+        TRITON_EXPORT triton::usize getRecordCount(void) const;
+
+        //! Returns the number of records which waited for a free slot.
+        TRITON_EXPORT triton::usize getStalls(void) const;
+    };
+
+  /*! @} End of callbacks namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ACCESSSTREAM_HPP */
@@ -60,6 +60,15 @@ namespace triton {
       FAULT_GP,         /*!< Fault raised: General Protection Fault.  */
     };
 
+    /*! Classes of control flow, see `DecodeInfo` */
+    enum flow_e {
+      FLOW_NONE = 0,    /*!< Goes on with the next instruction.       */
+      FLOW_JUMP,        /*!< Unconditional jump.                      */
+      FLOW_COND_JUMP,   /*!< Conditional jump.                        */
+      FLOW_CALL,        /*!< Call.                                    */
+      FLOW_RETURN,      /*!< Return.                                  */
+    };
+
     //! Types of register.
     enum register_e {
       ID_REG_INVALID = 0, //!< invalid = 0
@@ -18,6 +18,7 @@
 #include <triton/callbacks.hpp>
 #include <triton/cpuInterface.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/exceptions.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/register.hpp>
@@ -119,7 +120,7 @@ namespace triton {
         TRITON_EXPORT const std::unordered_map<triton::arch::register_e, const triton::arch::Register>& getAllRegisters(void) const;
 
         //! Return all memory.
-        TRITON_EXPORT const std::unordered_map<triton::uint64, triton::uint8, IdentityHash<triton::uint64>>& getConcreteMemory(void) const;
+        TRITON_EXPORT const triton::arch::ConcreteMemory& getConcreteMemory(void) const;
 
         //! Returns all parent registers.
         TRITON_EXPORT std::set<const triton::arch::Register*> getParentRegisters(void) const;
@@ -160,6 +161,30 @@ namespace triton {
         //! Disassembles a concrete memory area from `addr` to control flow instruction and returns a `BasicBlock`.
         TRITON_EXPORT triton::arch::BasicBlock disassembly(triton::uint64 addr) const;
 
+        //! Disassembles the concrete memory area [addr, addr + size) with `threads` workers (0 for one per hardware thread) and returns its basic blocks in address order.
+        TRITON_EXPORT std::vector<triton::arch::BasicBlock> disassemblyBlocks(triton::uint64 addr, triton::usize size, triton::uint32 threads=0) const;
+
+        //! Decodes the instruction at `addr` without building its operands nor its disassembly.
+        TRITON_EXPORT triton::arch::DecodeInfo decode(const triton::uint8* opcode, triton::uint32 size, triton::uint64 addr) const;
+
+        //! Linearly decodes the concrete memory area [addr, addr + size) without building operands, undecodable bytes being skipped.
+        TRITON_EXPORT std::vector<triton::arch::DecodeInfo> decode(triton::uint64 addr, triton::usize size) const;
+
+        //! Enables or disables the cache of disassembled instructions. Disabling clears it.
+        TRITON_EXPORT void enableDecodeCache(bool flag);
+
+        //! Returns true if the cache of disassembled instructions is enabled.
+        TRITON_EXPORT bool isDecodeCacheEnabled(void) const;
+
+        //! Clears the cache of disassembled instructions.
+        TRITON_EXPORT void clearDecodeCache(void);
+
+        //! Opens the file at `path` as a cache of disassembled instructions shared by the processes, creating it with `slots` slots if it does not exist.
+        TRITON_EXPORT void openPersistentDecodeCache(const std::string& path, triton::usize slots=65536);
+
+        //! Closes the file of disassembled instructions.
+        TRITON_EXPORT void closePersistentDecodeCache(void);
+
         //! Returns the concrete value of a memory cell.
         TRITON_EXPORT triton::uint8 getConcreteMemoryValue(triton::uint64 addr, bool execCallbacks=true) const;
 
@@ -169,9 +194,34 @@ namespace triton {
         //! Returns the concrete value of a memory area.
         TRITON_EXPORT std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
 
+        /*!
+         * \brief [**architecture api**] - Copies `size` bytes of concrete memory from `baseAddr` into `area`.
+         *
+         * \details Contiguous bytes are copied at once and GET_CONCRETE_MEMORY_VALUE callbacks are called
+         * once per memory access of at most 64 bytes instead of once per byte.
+         */
+        TRITON_EXPORT void readConcreteMemory(triton::uint64 baseAddr, void* area, triton::usize size, bool execCallbacks=true) const;
+
         //! Returns the concrete value of a register.
         TRITON_EXPORT triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const;
 
+        //! [**architecture api**] - Returns the concrete value of a register, truncated to `T`, see CpuInterface::loadConcreteRegister().
+        template <typename T>
+        T loadConcreteRegister(const triton::arch::Register& reg, bool execCallbacks=true) const {
+          if (!this->cpu)
+            throw triton::exceptions::Architecture("Architecture::loadConcreteRegister(): You must define an architecture.");
+          return this->cpu->template loadConcreteRegister<T>(reg, execCallbacks);
+        }
+
+        //! Returns the location of a register in the concrete register file.
+        TRITON_EXPORT const triton::arch::RegisterSlot& getConcreteRegisterSlot(triton::arch::register_e id) const;
+
+        //! [**architecture api**] - Returns the concrete register file.
+        TRITON_EXPORT const triton::uint8* getConcreteRegisterFile(void) const;
+
+        //! Returns the size in bytes of the concrete register file.
+        TRITON_EXPORT triton::usize getConcreteRegisterFileSize(void) const;
+
         /*!
          * \brief [**architecture api**] - Sets the concrete value of a memory cell.
          *
@@ -204,6 +254,38 @@ namespace triton {
          */
         TRITON_EXPORT void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const void* area, triton::usize size, bool execCallbacks=true);
 
+        /*!
+         * \brief [**architecture api**] - Copies `size` bytes from `area` to the concrete memory at `baseAddr`.
+         *
+         * \details Contiguous bytes are copied at once and SET_CONCRETE_MEMORY_VALUE callbacks are called
+         * once per memory access of at most 64 bytes instead of once per byte.
+         */
+        TRITON_EXPORT void writeConcreteMemory(triton::uint64 baseAddr, const void* area, triton::usize size, bool execCallbacks=true);
+
+        //! [**architecture api**] - Returns the concrete value of `sizeof(T)` bytes of memory at `addr`, see CpuInterface::loadConcreteMemory().
+        template <typename T>
+        T loadConcreteMemory(triton::uint64 addr, bool execCallbacks=true) const {
+          if (!this->cpu)
+            throw triton::exceptions::Architecture("Architecture::loadConcreteMemory(): You must define an architecture.");
+          return this->cpu->template loadConcreteMemory<T>(addr, execCallbacks);
+        }
+
+        //! [**architecture api**] - Sets the concrete value of `sizeof(T)` bytes of memory at `addr`, see CpuInterface::storeConcreteMemory().
+        template <typename T>
+        void storeConcreteMemory(triton::uint64 addr, T value, bool execCallbacks=true) {
+          if (!this->cpu)
+            throw triton::exceptions::Architecture("Architecture::storeConcreteMemory(): You must define an architecture.");
+          this->cpu->template storeConcreteMemory<T>(addr, value, execCallbacks);
+        }
+
+        /*!
+         * \brief [**architecture api**] - Maps a read-only memory area without copying it.
+         *
+         * \details The bytes are read from `area` (zeros if `area` is nullptr) until they are written,
+         * the first write into a page copies it. `owner` must keep `area` alive. No callback is called.
+         */
+        TRITON_EXPORT void mapConcreteMemoryArea(triton::uint64 baseAddr, const void* area, triton::usize size, const std::shared_ptr<const void>& owner);
+
         /*!
          * \brief [**architecture api**] - Sets the concrete value of a register.
          *
@@ -212,6 +294,22 @@ namespace triton {
          */
         TRITON_EXPORT void setConcreteRegisterValue(const triton::arch::Register& reg, const triton::uint512& value, bool execCallbacks=true);
 
+        //! [**architecture api**] - Sets the concrete value of a register, see CpuInterface::storeConcreteRegister().
+        template <typename T>
+        void storeConcreteRegister(const triton::arch::Register& reg, T value, bool execCallbacks=true) {
+          if (!this->cpu)
+            throw triton::exceptions::Architecture("Architecture::storeConcreteRegister(): You must define an architecture.");
+          this->cpu->template storeConcreteRegister<T>(reg, value, execCallbacks);
+        }
+
+        /*!
+         * \brief [**architecture api**] - Replaces the concrete register file by `size` bytes from `file`.
+         *
+         * \details Note that by setting the concrete values will probably imply a desynchronization
+         * with the symbolic state (if it exists). You should probably use the concretize functions after this.
+         */
+        TRITON_EXPORT void setConcreteRegisterFile(const triton::uint8* file, triton::usize size);
+
         //! Returns true if memory cells have a defined concrete value
         TRITON_EXPORT bool isConcreteMemoryValueDefined(const triton::arch::MemoryAccess& mem) const;
 
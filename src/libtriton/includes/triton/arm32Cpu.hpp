@@ -16,11 +16,14 @@
 #include <triton/archEnums.hpp>
 #include <triton/arm32Specifications.hpp>
 #include <triton/callbacks.hpp>
+#include <triton/concreteMemory.hpp>
 #include <triton/cpuInterface.hpp>
+#include <triton/decodeCache.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/register.hpp>
+#include <triton/registerFile.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -104,49 +107,23 @@ namespace triton {
             triton::arch::arm::condition_e invertCodeCondition(triton::arch::arm::condition_e cc) const;
 
           protected:
-            /*! \brief map of address -> concrete value
-             *
-             * \details
-             *
-             * **item1**: memory address<br>
-             * **item2**: concrete value
-             */
-            std::unordered_map<triton::uint64, triton::uint8, IdentityHash<triton::uint64>> memory;
-
-            //! Concrete value of r0
-            triton::uint8 r0[triton::size::dword];
-            //! Concrete value of r1
-            triton::uint8 r1[triton::size::dword];
-            //! Concrete value of r2
-            triton::uint8 r2[triton::size::dword];
-            //! Concrete value of r3
-            triton::uint8 r3[triton::size::dword];
-            //! Concrete value of r4
-            triton::uint8 r4[triton::size::dword];
-            //! Concrete value of r5
-            triton::uint8 r5[triton::size::dword];
-            //! Concrete value of r6
-            triton::uint8 r6[triton::size::dword];
-            //! Concrete value of r7
-            triton::uint8 r7[triton::size::dword];
-            //! Concrete value of r8
-            triton::uint8 r8[triton::size::dword];
-            //! Concrete value of r9
-            triton::uint8 r9[triton::size::dword];
-            //! Concrete value of r10
-            triton::uint8 r10[triton::size::dword];
-            //! Concrete value of r11
-            triton::uint8 r11[triton::size::dword];
-            //! Concrete value of r12
-            triton::uint8 r12[triton::size::dword];
-            //! Concrete value of sp
-            triton::uint8 sp[triton::size::dword];
-            //! Concrete value of r14
-            triton::uint8 r14[triton::size::dword];
-            //! Concrete value of pc
-            triton::uint8 pc[triton::size::dword];
-            // //! Concrete value of apsr
-            triton::uint8 apsr[triton::size::dword];
+            //! The concrete memory state (paged).
+            triton::arch::ConcreteMemory memory;
+
+            //! The layout of the concrete register file.
+            static constexpr triton::arch::RegisterFileLayout layout = triton::arch::arm::arm32::registerFileLayout();
+
+            //! The concrete register file. Registers are located in it by `layout`.
+            triton::uint8 registerFile[layout.getSize()];
+
+            //! The cache of disassembled instructions.
+            triton::arch::DecodeCache decodeCache;
+
+            //! Returns true if `reg` has a storage, is not the program counter, and has no callback of `kind` to call.
+            TRITON_EXPORT bool isDirectConcreteRegister(const triton::arch::Register& reg, triton::callbacks::callback_e kind, bool execCallbacks) const;
+
+            //! Returns the concrete register file, to write the direct registers into.
+            TRITON_EXPORT triton::uint8* getWritableConcreteRegisterFile(void);
 
             //! Thumb mode flag
             bool thumb;
@@ -174,7 +151,11 @@ namespace triton {
             TRITON_EXPORT bool isThumb(void) const;
             TRITON_EXPORT bool isMemoryExclusive(const triton::arch::MemoryAccess& mem) const;
             TRITON_EXPORT const std::unordered_map<triton::arch::register_e, const triton::arch::Register>& getAllRegisters(void) const;
-            TRITON_EXPORT const std::unordered_map<triton::uint64, triton::uint8, IdentityHash<triton::uint64>>& getConcreteMemory(void) const;
+            TRITON_EXPORT const triton::arch::ConcreteMemory& getConcreteMemory(void) const;
+            TRITON_EXPORT const triton::arch::RegisterSlot& getConcreteRegisterSlot(triton::arch::register_e id) const;
+            TRITON_EXPORT const triton::uint8* getConcreteRegisterFile(void) const;
+            TRITON_EXPORT triton::usize getConcreteRegisterFileSize(void) const;
+            TRITON_EXPORT triton::arch::DecodeCache& getDecodeCache(void);
             TRITON_EXPORT const triton::arch::Register& getParentRegister(const triton::arch::Register& reg) const;
             TRITON_EXPORT const triton::arch::Register& getParentRegister(triton::arch::register_e id) const;
             TRITON_EXPORT const triton::arch::Register& getProgramCounter(void) const;
@@ -183,6 +164,7 @@ namespace triton {
             TRITON_EXPORT const triton::arch::Register& getStackPointer(void) const;
             TRITON_EXPORT std::set<const triton::arch::Register*> getParentRegisters(void) const;
             TRITON_EXPORT std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
+            TRITON_EXPORT void readConcreteMemory(triton::uint64 baseAddr, void* area, triton::usize size, bool execCallbacks=true) const;
             TRITON_EXPORT triton::arch::endianness_e getEndianness(void) const;
             TRITON_EXPORT triton::uint32 gprBitSize(void) const;
             TRITON_EXPORT triton::uint32 gprSize(void) const;
@@ -192,11 +174,16 @@ namespace triton {
             TRITON_EXPORT triton::uint8 getConcreteMemoryValue(triton::uint64 addr, bool execCallbacks=true) const;
             TRITON_EXPORT void clear(void);
             TRITON_EXPORT void disassembly(triton::arch::Instruction& inst);
+            TRITON_EXPORT triton::arch::DecodeInfo decode(const triton::uint8* opcode, triton::uint32 size, triton::uint64 addr);
             TRITON_EXPORT void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values, bool execCallbacks=true);
             TRITON_EXPORT void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const void* area, triton::usize size, bool execCallbacks=true);
+            TRITON_EXPORT void mapConcreteMemoryArea(triton::uint64 baseAddr, const void* area, triton::usize size, const std::shared_ptr<const void>& owner);
+            TRITON_EXPORT void writeConcreteMemory(triton::uint64 baseAddr, const void* area, triton::usize size, bool execCallbacks=true);
             TRITON_EXPORT void setConcreteMemoryValue(const triton::arch::MemoryAccess& mem, const triton::uint512& value, bool execCallbacks=true);
             TRITON_EXPORT void setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value, bool execCallbacks=true);
             TRITON_EXPORT void setConcreteRegisterValue(const triton::arch::Register& reg, const triton::uint512& value, bool execCallbacks=true);
+            TRITON_EXPORT void setConcreteRegisterFile(const triton::uint8* file, triton::usize size);
+            TRITON_EXPORT void swapConcreteMemory(triton::arch::ConcreteMemory& memory);
             TRITON_EXPORT void setThumb(bool state);
             TRITON_EXPORT void setMemoryExclusiveTag(const triton::arch::MemoryAccess& mem, bool tag);
             TRITON_EXPORT bool isConcreteMemoryValueDefined(const triton::arch::MemoryAccess& mem) const;
@@ -8,10 +8,14 @@
 #ifndef TRITON_ARM32SEMANTICS_H
 #define TRITON_ARM32SEMANTICS_H
 
+#include <functional>
+#include <string>
+
 #include <triton/archEnums.hpp>
 #include <triton/architecture.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/instruction.hpp>
+#include <triton/modes.hpp>
 #include <triton/semanticsInterface.hpp>
 #include <triton/symbolicEngine.hpp>
 #include <triton/taintEngine.hpp>
@@ -62,6 +66,9 @@ namespace triton {
             //! Taint Engine API
             triton::engines::taint::TaintEngine* taintEngine;
 
+            //! The Modes API
+            triton::modes::SharedModes modes;
+
             //! The AST Context API
             triton::ast::SharedAstContext astCtxt;
 
@@ -73,6 +80,7 @@ namespace triton {
             TRITON_EXPORT Arm32Semantics(triton::arch::Architecture* architecture,
                                          triton::engines::symbolic::SymbolicEngine* symbolicEngine,
                                          triton::engines::taint::TaintEngine* taintEngine,
+                                         const triton::modes::SharedModes& modes,
                                          const triton::ast::SharedAstContext& astCtxt);
 
             //! Builds the semantics of the instruction. Returns `triton::arch::NO_FAULT` if succeed.
@@ -91,6 +99,9 @@ namespace triton {
             //! Builds the semantics of a conditional instruction.
             triton::ast::SharedAbstractNode buildConditionalSemantics(triton::arch::Instruction& inst, triton::arch::OperandWrapper& dst, const triton::ast::SharedAbstractNode& opNode);
 
+            //! Returns true if the condition of the instruction is concrete, untainted and does not hold.
+            bool isConcretelyNotExecuted(triton::arch::Instruction& inst);
+
             //! Returns the AST corresponding to the adjustment of the LSB of the provided node.
             triton::ast::SharedAbstractNode adjustISSB(const triton::ast::SharedAbstractNode& node);
 
@@ -136,6 +147,14 @@ namespace triton {
                              const triton::arch::OperandWrapper& operand,
                              bool taint);
 
+            //! Creates the expression of a flag updated under the condition. Deferred with the flags if the instruction is unconditional.
+            void flag_s(triton::arch::Instruction& inst,
+                        const triton::ast::SharedAbstractNode& cond,
+                        const triton::engines::symbolic::SharedSymbolicExpression& parent,
+                        triton::arch::OperandWrapper& flag,
+                        const std::function<triton::ast::SharedAbstractNode(void)>& builder,
+                        const std::string& comment);
+
             /* Generic flags computation ------------------------------------- */
 
             //! The NF semantics.
@@ -10,11 +10,13 @@
 
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 #include <triton/archEnums.hpp>
 #include <triton/architecture.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/register.hpp>
+#include <triton/registerFile.hpp>
 
 
 
@@ -52,10 +54,27 @@ namespace triton {
         //! \class Arm32Specifications
         /*! \brief The Arm32Specifications class defines specifications about the Arm32 CPU */
         class Arm32Specifications {
+          private:
+            //! The registers specification of an architecture.
+            struct RegisterTables {
+              //! The registers <id : register>.
+              std::unordered_map<triton::arch::register_e, const triton::arch::Register> id2reg;
+
+              //! The register ids <name : id>.
+              std::unordered_map<std::string, triton::arch::register_e> name2id;
+
+              //! The registers indexed by id, nullptr if not available.
+              std::vector<const triton::arch::Register*> id2ptr;
+            };
+
+            //! Returns the registers specification of an architecture, built once on the first call and shared by every instance.
+            static const RegisterTables& getRegisterTables(triton::arch::architecture_e arch);
+
           protected:
-            //! List of registers specification available for this architecture.
-            std::unordered_map<triton::arch::register_e, const triton::arch::Register> id2reg;
-            std::unordered_map<std::string, triton::arch::register_e> name2id;
+            //! List of registers specification available for this architecture (immutable, shared by every instance).
+            const std::unordered_map<triton::arch::register_e, const triton::arch::Register>& id2reg;
+            const std::unordered_map<std::string, triton::arch::register_e>& name2id;
+            const std::vector<const triton::arch::Register*>& id2ptr;
 
           public:
             //! Constructor.
@@ -77,6 +96,34 @@ namespace triton {
             TRITON_EXPORT triton::uint32 getMemoryOperandSpecialSize(triton::uint32 id) const;
         };
 
+        //! Returns the layout of the concrete register file of the Arm32 CPU.
+        constexpr triton::arch::RegisterFileLayout registerFileLayout(void) {
+          triton::arch::RegisterFileLayout layout;
+
+          /* Parent registers have their own storage, except flags */
+          #define REG_SPEC(UPPER_NAME, _1, ARM32_UPPER, _3, ARM32_PARENT, _5)                                              \
+          if (triton::arch::ID_REG_ARM32_##ARM32_PARENT == triton::arch::ID_REG_ARM32_##UPPER_NAME && (ARM32_UPPER) >= 7) \
+            layout.addRegister(triton::arch::ID_REG_ARM32_##UPPER_NAME, (ARM32_UPPER) + 1);
+          #define REG_SPEC_NO_CAPSTONE REG_SPEC
+          #include "triton/arm32.spec"
+
+          /* Sub-registers are stored in their parent */
+          #define REG_SPEC(UPPER_NAME, _1, ARM32_UPPER, ARM32_LOWER, ARM32_PARENT, _5)                                   \
+          if (triton::arch::ID_REG_ARM32_##ARM32_PARENT != triton::arch::ID_REG_ARM32_##UPPER_NAME)                         \
+            layout.addSubRegister(triton::arch::ID_REG_ARM32_##UPPER_NAME, triton::arch::ID_REG_ARM32_##ARM32_PARENT, (ARM32_LOWER), (ARM32_UPPER) - (ARM32_LOWER) + 1);
+          #define REG_SPEC_NO_CAPSTONE REG_SPEC
+          #include "triton/arm32.spec"
+
+          /* Flags are stored in the status register */
+          layout.addSubRegister(triton::arch::ID_REG_ARM32_N, triton::arch::ID_REG_ARM32_APSR, 31, 1);
+          layout.addSubRegister(triton::arch::ID_REG_ARM32_Z, triton::arch::ID_REG_ARM32_APSR, 30, 1);
+          layout.addSubRegister(triton::arch::ID_REG_ARM32_C, triton::arch::ID_REG_ARM32_APSR, 29, 1);
+          layout.addSubRegister(triton::arch::ID_REG_ARM32_V, triton::arch::ID_REG_ARM32_APSR, 28, 1);
+
+          return layout;
+        }
+
+
         //! ARM32 NOP instruction
         const triton::arch::Instruction nop = triton::arch::Instruction("\x00\xf0\x20\xe3", 4);
 
@@ -73,7 +73,7 @@ namespace triton {
           TRITON_EXPORT ArmOperandProperties();
 
           //! Constructor by copy.
-          TRITON_EXPORT ArmOperandProperties(const ArmOperandProperties& other);
+          ArmOperandProperties(const ArmOperandProperties& other) = default;
 
           //! Returns the type of the shift.
           TRITON_EXPORT triton::arch::arm::shift_e getShiftType(void) const;
@@ -130,7 +130,7 @@ namespace triton {
           TRITON_EXPORT void setSubtracted(bool value);
 
           //! Copy an ArmOperandProperties.
-          TRITON_EXPORT ArmOperandProperties& operator=(const ArmOperandProperties& other);
+          ArmOperandProperties& operator=(const ArmOperandProperties& other) = default;
       };
 
     /*! @} End of arm namespace */
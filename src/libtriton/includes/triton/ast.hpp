@@ -9,6 +9,8 @@
 #define TRITON_AST_H
 
 #include <deque>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <stdexcept>
@@ -18,6 +20,7 @@
 #include <vector>
 
 #include <triton/astEnums.hpp>
+#include <triton/astMemory.hpp>
 #include <triton/coreUtils.hpp>
 #include <triton/cpuSize.hpp>
 #include <triton/dllexport.hpp>
@@ -64,13 +67,236 @@ namespace triton {
     //! Shared AST context
     using SharedAstContext = std::shared_ptr<triton::ast::AstContext>;
 
+    /*! \class NodeParents
+     *  \brief The parents of a node, with the number of times each one uses it.
+     *
+     *  \details Most nodes have one or two parents, so they are kept in a vector searched linearly.
+     *  Only the nodes with more than `maxInlineParents` parents move them into a hash map.
+     */
+    class NodeParents {
+      private:
+        //! A parent <number of uses, parent>
+        using Entry = std::pair<triton::uint32, WeakAbstractNode>;
+
+        //! The number of parents kept in the vector.
+        static const triton::usize maxInlineParents = 8;
+
+        //! The parents while there are few of them.
+        std::vector<std::pair<AbstractNode*, Entry>> inlineParents;
+
+        //! The parents of high fan-in nodes, nullptr otherwise.
+        std::unique_ptr<std::unordered_map<AbstractNode*, Entry>> mappedParents;
+
+        //! Returns the entry of a parent, nullptr if there is none.
+        Entry* find(AbstractNode* p);
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT NodeParents();
+
+        //! Constructor by copy.
+        TRITON_EXPORT NodeParents(const NodeParents& other);
+
+        //! Copies another set of parents.
+        TRITON_EXPORT NodeParents& operator=(const NodeParents& other);
+
+        //! Adds a use of the node by `p`.
+        TRITON_EXPORT void add(AbstractNode* p);
+
+        //! Removes a use of the node by `p`. The parent is removed once it does not use the node anymore.
+        TRITON_EXPORT void remove(AbstractNode* p);
+
+        //! Returns the parents still alive and forgets the dead ones.
+        TRITON_EXPORT std::vector<SharedAbstractNode> get(void);
+    };
+
+    /*! \class NodeChildren
+     *  \brief The children of a node.
+     *
+     *  \details Most operators have a fixed arity of at most three children (`bvadd`, `extract`, `ite`, ...), so they are
+     *  kept inline in the node, without an allocation of their own. Only the nodes with more than `maxInlineChildren`
+     *  children (`concat`, `land`, `lor`, ...) move them into a vector. The children are contiguous in both cases.
+     */
+    class NodeChildren {
+      public:
+        //! The type of a child.
+        using value_type = SharedAbstractNode;
+
+        //! An iterator over the children.
+        using iterator = SharedAbstractNode*;
+
+        //! A constant iterator over the children.
+        using const_iterator = const SharedAbstractNode*;
+
+        //! A reverse iterator over the children.
+        using reverse_iterator = std::reverse_iterator<iterator>;
+
+        //! A constant reverse iterator over the children.
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+      private:
+        //! The number of children kept inline.
+        static const triton::usize maxInlineChildren = 3;
+
+        //! The children while there are few of them.
+        SharedAbstractNode inlineChildren[maxInlineChildren];
+
+        //! All the children of the n-ary nodes, empty otherwise.
+        std::vector<SharedAbstractNode> spilledChildren;
+
+        //! The number of children.
+        triton::uint32 count;
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT NodeChildren();
+
+        //! Constructor by copy.
+        TRITON_EXPORT NodeChildren(const NodeChildren& other);
+
+        //! Copies another set of children.
+        TRITON_EXPORT NodeChildren& operator=(const NodeChildren& other);
+
+        //! Returns the children as a vector.
+        TRITON_EXPORT operator std::vector<SharedAbstractNode>(void) const;
+
+        //! Adds a child.
+        TRITON_EXPORT void push_back(const SharedAbstractNode& child);
+
+        //! Reserves the room of `n` children.
+        TRITON_EXPORT void reserve(triton::usize n);
+
+        //! Removes all the children.
+        TRITON_EXPORT void clear(void);
+
+        //! Returns the number of children.
+        triton::usize size(void) const;
+
+        //! Returns true if there is no child.
+        bool empty(void) const;
+
+        //! Returns the contiguous children.
+        SharedAbstractNode* data(void);
+
+        //! Returns the contiguous children.
+        const SharedAbstractNode* data(void) const;
+
+        //! Returns the child at `index`.
+        SharedAbstractNode& operator[](triton::usize index);
+
+        //! Returns the child at `index`.
+        const SharedAbstractNode& operator[](triton::usize index) const;
+
+        //! Returns the first child.
+        SharedAbstractNode& front(void);
+
+        //! Returns the last child.
+        SharedAbstractNode& back(void);
+
+        //! Returns an iterator on the first child.
+        iterator begin(void);
+
+        //! Returns an iterator past the last child.
+        iterator end(void);
+
+        //! Returns an iterator on the first child.
+        const_iterator begin(void) const;
+
+        //! Returns an iterator past the last child.
+        const_iterator end(void) const;
+
+        //! Returns a reverse iterator on the last child.
+        reverse_iterator rbegin(void);
+
+        //! Returns a reverse iterator past the first child.
+        reverse_iterator rend(void);
+
+        //! Returns a reverse iterator on the last child.
+        const_reverse_iterator rbegin(void) const;
+
+        //! Returns a reverse iterator past the first child.
+        const_reverse_iterator rend(void) const;
+    };
+
+    /* The accessors are inlined, they are on the path of every traversal */
+    inline triton::usize NodeChildren::size(void) const {
+      return this->count;
+    }
+
+    inline bool NodeChildren::empty(void) const {
+      return this->count == 0;
+    }
+
+    inline SharedAbstractNode* NodeChildren::data(void) {
+      return this->spilledChildren.empty() ? this->inlineChildren : this->spilledChildren.data();
+    }
+
+    inline const SharedAbstractNode* NodeChildren::data(void) const {
+      return this->spilledChildren.empty() ? this->inlineChildren : this->spilledChildren.data();
+    }
+
+    inline SharedAbstractNode& NodeChildren::operator[](triton::usize index) {
+      return this->data()[index];
+    }
+
+    inline const SharedAbstractNode& NodeChildren::operator[](triton::usize index) const {
+      return this->data()[index];
+    }
+
+    inline SharedAbstractNode& NodeChildren::front(void) {
+      return this->data()[0];
+    }
+
+    inline SharedAbstractNode& NodeChildren::back(void) {
+      return this->data()[this->count - 1];
+    }
+
+    inline NodeChildren::iterator NodeChildren::begin(void) {
+      return this->data();
+    }
+
+    inline NodeChildren::iterator NodeChildren::end(void) {
+      return this->data() + this->count;
+    }
+
+    inline NodeChildren::const_iterator NodeChildren::begin(void) const {
+      return this->data();
+    }
+
+    inline NodeChildren::const_iterator NodeChildren::end(void) const {
+      return this->data() + this->count;
+    }
+
+    inline NodeChildren::reverse_iterator NodeChildren::rbegin(void) {
+      return reverse_iterator(this->end());
+    }
+
+    inline NodeChildren::reverse_iterator NodeChildren::rend(void) {
+      return reverse_iterator(this->begin());
+    }
+
+    inline NodeChildren::const_reverse_iterator NodeChildren::rbegin(void) const {
+      return const_reverse_iterator(this->end());
+    }
+
+    inline NodeChildren::const_reverse_iterator NodeChildren::rend(void) const {
+      return const_reverse_iterator(this->begin());
+    }
+
     //! Abstract node
     class AbstractNode : public std::enable_shared_from_this<AbstractNode> {
       private:
         //! Hashes the tree.
         virtual void initHash(void) = 0;
 
+      public:
+        //! The number of symbolic variables past which a node does not keep the set of its variables.
+        static const triton::usize maxSummarizedVariables = 256;
+
       protected:
+        //! The dense id of the node in its context.
+        triton::uint32 id;
+
         //! Deep level for computing hash
         triton::uint32 level;
 
@@ -78,21 +304,27 @@ namespace triton {
         triton::ast::ast_e type;
 
         //! The children of the node.
-        std::vector<SharedAbstractNode> children;
+        NodeChildren children;
 
         // This structure counter the number of use of a given parent as a node may have
         // multiple time the same parent: eg. xor rax rax
-        std::unordered_map<AbstractNode*, std::pair<triton::uint32, WeakAbstractNode>> parents;
+        NodeParents parents;
 
         //! The size of the node.
         triton::uint32 size;
 
-        //! The value of the tree from this root node.
+        //! The value of the tree from this root node, if the node is wider than 64 bits.
         triton::uint512 eval;
 
-        //! The hash of the tree
+        //! The value of the tree from this root node, if the node is 64 bits wide or less.
+        triton::uint64 eval64;
+
+        //! The hash of the tree, the 64-bit hash unless the AST_WIDE_HASH mode is enabled.
         triton::uint512 hash;
 
+        //! The 64-bit structural hash of the tree.
+        triton::uint64 hash64;
+
         //! True if the tree contains a symbolic variable.
         bool symbolized;
 
@@ -102,18 +334,51 @@ namespace triton {
         //! True if it's an array node.
         bool array;
 
+        //! True if the tree contains an array node.
+        bool withArray;
+
+        //! The sorted ids of the symbolic variables of the tree, shared with a child holding them all. Null without variable or past `maxSummarizedVariables`.
+        std::shared_ptr<const std::vector<triton::usize>> variables;
+
+        //! The bits `id % 64` of the ids of the symbolic variables of the tree.
+        triton::uint64 variablesMask;
+
+        //! True if the tree has more than `maxSummarizedVariables` symbolic variables.
+        bool variablesOverflow;
+
+        //! The number of nodes of the tree, a shared subtree being counted for each of its parents.
+        triton::uint64 dagSize;
+
         //! Contect use to create this node
         SharedAstContext ctxt;
 
+        //! Computes the 64-bit hash, and the 512-bit one if the AST_WIDE_HASH mode is enabled. The size and children must be initialized first.
+        void computeHash(void);
+
+        //! Sets the value of the tree, in the representation of its size. The size must be initialized first.
+        void setEvaluation(const triton::uint512& value);
+
+        //! Computes the variables, the arrays and the size of the tree from the children, or from the expression of a reference.
+        void computeSummaries(void);
+
       public:
         //! Constructor.
         TRITON_EXPORT AbstractNode(triton::ast::ast_e type, const SharedAstContext& ctxt);
 
+        //! Constructor by copy. The copy has its own id.
+        TRITON_EXPORT AbstractNode(const AbstractNode& other);
+
         //! Destructor.
         TRITON_EXPORT virtual ~AbstractNode();
 
+        //! Copies all the properties of another node but its id.
+        TRITON_EXPORT AbstractNode& operator=(const AbstractNode& other);
+
         //! Access to its context
-        TRITON_EXPORT SharedAstContext getContext(void) const;
+        TRITON_EXPORT const SharedAstContext& getContext(void) const;
+
+        //! Returns the dense id of the node in its context. The id of a destroyed node is given to a new one.
+        TRITON_EXPORT triton::uint32 getId(void) const;
 
         //! Returns the type of the node.
         TRITON_EXPORT triton::ast::ast_e getType(void) const;
@@ -124,6 +389,9 @@ namespace triton {
         //! Returns the vector mask according the size of the node.
         TRITON_EXPORT triton::uint512 getBitvectorMask(void) const;
 
+        //! Returns the vector mask according the size of the node, for nodes of 64 bits or less.
+        TRITON_EXPORT triton::uint64 getBitvectorMask64(void) const;
+
         //! Returns true if it's an array node.
         TRITON_EXPORT bool isArray(void) const;
 
@@ -136,10 +404,28 @@ namespace triton {
         //! Returns true if it's a logical node.
         TRITON_EXPORT bool isLogical(void) const;
 
+        //! Returns true if the tree contains an array node. The referenced expressions are included, as for the queries below.
+        TRITON_EXPORT bool containsArray(void) const;
+
+        //! Returns the sorted ids of the symbolic variables of the tree, in O(|vars|) unless the tree has more than `maxSummarizedVariables` variables.
+        TRITON_EXPORT std::vector<triton::usize> getVariableIds(void) const;
+
+        //! Returns the bits `id % 64` of the ids of the symbolic variables of the tree. Trees with disjoint masks do not share any variable.
+        TRITON_EXPORT triton::uint64 getVariablesMask(void) const;
+
+        //! Returns true if the tree contains the symbolic variable `id`.
+        TRITON_EXPORT bool hasVariable(triton::usize id) const;
+
+        //! Returns true if the trees share a symbolic variable.
+        TRITON_EXPORT bool sharesVariablesWith(const AbstractNode& other) const;
+
+        //! Returns an upper bound of the number of distinct nodes of the tree. It is exact for a tree without shared subtrees, and saturates at the uint64 maximum.
+        TRITON_EXPORT triton::uint64 getDagSizeEstimate(void) const;
+
         //! Returns true if the node's concrete value and value type match those of the second one.
         TRITON_EXPORT bool hasSameConcreteValueAndTypeAs(const SharedAbstractNode& other) const;
 
-        //! Returns true if the node's value, value type and properties match those of the second one.
+        //! Returns true if the node's value, value type and properties match those of the second one, and the variables, arrays and size kept by its parents hold for the second one.
         TRITON_EXPORT bool canReplaceNodeWithoutUpdate(const SharedAbstractNode& other) const;
 
         //! Returns true if the current tree is equal to the second one.
@@ -148,17 +434,23 @@ namespace triton {
         //! Returns the deep level of the tree.
         TRITON_EXPORT triton::uint32 getLevel(void) const;
 
-        //! Returns the hash of the tree.
+        //! Returns the hash of the tree. This is the 64-bit hash, unless the AST_WIDE_HASH mode is enabled.
         TRITON_EXPORT triton::uint512 getHash(void) const;
 
+        //! Returns the 64-bit structural hash of the tree.
+        TRITON_EXPORT triton::uint64 getHash64(void) const;
+
         //! Evaluates the tree.
         TRITON_EXPORT triton::uint512 evaluate(void) const;
 
+        //! Evaluates the tree without multiprecision arithmetic. The value is truncated to 64 bits for wider nodes.
+        TRITON_EXPORT triton::uint64 evaluate64(void) const;
+
         //! Initializes parents.
         void initParents(void);
 
         //! Returns the children of the node.
-        TRITON_EXPORT std::vector<SharedAbstractNode>& getChildren(void);
+        TRITON_EXPORT NodeChildren& getChildren(void);
 
         //! Returns the parents of node or an empty set if there is still no parent defined.
         TRITON_EXPORT std::vector<SharedAbstractNode> getParents(void);
@@ -178,8 +470,8 @@ namespace triton {
         //! Adds a child.
         TRITON_EXPORT void addChild(const SharedAbstractNode& child);
 
-        //! Sets a child at an index.
-        TRITON_EXPORT void setChild(triton::uint32 index, const SharedAbstractNode& child);
+        //! Sets a child at an index. If withParents is false, the node is only marked dirty and its parents are initialized by `AstContext::initDirtyNodes()`.
+        TRITON_EXPORT void setChild(triton::uint32 index, const SharedAbstractNode& child, bool withParents=true);
 
         //! Returns the string representation of the node.
         TRITON_EXPORT std::string str(void) const;
@@ -196,7 +488,9 @@ namespace triton {
         //
         // (1) Synchronize the concrete and the symbolic
         // (2) Evaluate nodes
-        std::unordered_map<triton::uint64, triton::uint8> memory;
+        //
+        // The cells are shared with the previous stores of the chain.
+        triton::ast::ArrayMemory memory;
 
         //! Size of array index
         triton::uint32 indexSize;
@@ -220,7 +514,7 @@ namespace triton {
         TRITON_EXPORT triton::uint8 select(const SharedAbstractNode& node) const;
 
         //! Gets the concrete memory array
-        TRITON_EXPORT std::unordered_map<triton::uint64, triton::uint8>& getMemory(void);
+        TRITON_EXPORT triton::ast::ArrayMemory& getMemory(void);
 
         //! Gets the index size
         TRITON_EXPORT triton::uint32 getIndexSize(void) const;
@@ -819,7 +1113,9 @@ namespace triton {
         //
         // (1) Synchronize the concrete and the symbolic
         // (2) Evaluate nodes
-        std::unordered_map<triton::uint64, triton::uint8> memory;
+        //
+        // The cells are shared with the previous stores of the chain.
+        triton::ast::ArrayMemory memory;
 
         //! Size of array index
         triton::uint32 indexSize;
@@ -841,7 +1137,7 @@ namespace triton {
         TRITON_EXPORT triton::uint8 select(const SharedAbstractNode& node) const;
 
         //! Gets the concrete memory array
-        TRITON_EXPORT std::unordered_map<triton::uint64, triton::uint8>& getMemory(void);
+        TRITON_EXPORT const triton::ast::ArrayMemory& getMemory(void) const;
 
         //! Gets the index size
         TRITON_EXPORT triton::uint32 getIndexSize(void) const;
@@ -912,21 +1208,149 @@ namespace triton {
     //! Displays the node in ast representation.
     TRITON_EXPORT std::ostream& operator<<(std::ostream& stream, AbstractNode* node);
 
+    /*! \class VisitedNodes
+     *  \brief The nodes visited by a traversal.
+     *
+     *  \details A node of the context of the traversal is marked by stamping its id with the epoch of the
+     *  traversal, so neither hashing nor clearing is needed. The stamps are taken from the context and given
+     *  back to it for the next traversal. The few nodes of other contexts are kept in a set.
+     */
+    class VisitedNodes {
+      private:
+        //! The context of the traversal.
+        SharedAstContext ctxt;
+
+        //! The stamps, indexed by node id.
+        std::vector<triton::uint32> stamps;
+
+        //! The epoch of the traversal.
+        triton::uint32 epoch;
+
+        //! The visited nodes of other contexts.
+        std::unordered_set<const AbstractNode*> others;
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT VisitedNodes(const SharedAstContext& ctxt);
+
+        //! Destructor.
+        TRITON_EXPORT ~VisitedNodes();
+
+        VisitedNodes(const VisitedNodes&) = delete;
+        VisitedNodes& operator=(const VisitedNodes&) = delete;
+
+        //! Marks a node as visited. Returns false if it was already visited.
+        TRITON_EXPORT bool insert(const AbstractNode* node);
+
+        //! Returns true if a node is visited.
+        TRITON_EXPORT bool contains(const AbstractNode* node) const;
+    };
+
+    /*! \class TopologicalSort
+     *  \brief The topological order of the nodes of a DAG.
+     *
+     *  \details The nodes are sorted by a worklist of raw pointers, each node once and its children first, in the
+     *  order of `childrenExtraction()` with `revert`. They are either streamed to a visitor, so that a converter
+     *  translates the DAG in a single pass without holding its nodes, or appended to a buffer reused by the next
+     *  sort. The references are unrolled when they are met. The nodes must be kept alive by the caller.
+     */
+    class TopologicalSort {
+      private:
+        //! The worklist <node : children visited>.
+        std::vector<std::pair<AbstractNode*, bool>> worklist;
+
+        //! The nodes sorted by the last call to `sort()`.
+        std::vector<AbstractNode*> order;
+
+        //! Returns the root of the AST of the expression of a reference node.
+        TRITON_EXPORT static AbstractNode* getReferencedNode(AbstractNode* node);
+
+      public:
+        //! Calls `visitor` on the nodes reachable from `roots`, children first. If `unroll` is true, references are unrolled. The visitor must not use this sort.
+        template <typename Visitor> void visit(const std::vector<AbstractNode*>& roots, bool unroll, Visitor&& visitor);
+
+        //! Returns the nodes reachable from `roots`, children first. If `unroll` is true, references are unrolled. The buffer is reused by the next sort.
+        TRITON_EXPORT const std::vector<AbstractNode*>& sort(const std::vector<AbstractNode*>& roots, bool unroll);
+
+        //! Returns the nodes reachable from `root`, children first. If `unroll` is true, references are unrolled. The buffer is reused by the next sort.
+        TRITON_EXPORT const std::vector<AbstractNode*>& sort(const SharedAbstractNode& root, bool unroll);
+    };
+
+
+    template <typename Visitor>
+    void TopologicalSort::visit(const std::vector<AbstractNode*>& roots, bool unroll, Visitor&& visitor) {
+      if (roots.empty())
+        return;
+
+      if (roots.front() == nullptr)
+        throw triton::exceptions::Ast("TopologicalSort::visit(): Node cannot be null.");
+
+      VisitedNodes visited(roots.front()->getContext());
+
+      this->worklist.clear();
+      for (auto it = roots.rbegin(); it != roots.rend(); it++) {
+        if (*it == nullptr)
+          throw triton::exceptions::Ast("TopologicalSort::visit(): Node cannot be null.");
+        this->worklist.push_back({*it, false});
+      }
+
+      while (!this->worklist.empty()) {
+        std::pair<AbstractNode*, bool> item = this->worklist.back();
+        this->worklist.pop_back();
+
+        /* All the children of the node are visited */
+        if (item.second) {
+          visitor(item.first);
+          continue;
+        }
+
+        if (!visited.insert(item.first))
+          continue;
+
+        this->worklist.push_back({item.first, true});
+        for (const auto& child : item.first->getChildren()) {
+          if (!visited.contains(child.get()))
+            this->worklist.push_back({child.get(), false});
+        }
+
+        if (unroll && item.first->getType() == REFERENCE_NODE) {
+          AbstractNode* ref = TopologicalSort::getReferencedNode(item.first);
+          if (!visited.contains(ref))
+            this->worklist.push_back({ref, false});
+        }
+      }
+    }
+
     //! AST C++ API - Duplicates the AST
     TRITON_EXPORT SharedAbstractNode newInstance(AbstractNode* node, bool unroll=false);
 
+    //! AST C++ API - Duplicates the AST, replacing the nodes found in `bindings` by their binding. Bound nodes are not visited.
+    TRITON_EXPORT SharedAbstractNode newInstance(AbstractNode* node, const std::unordered_map<AbstractNode*, SharedAbstractNode>& bindings);
+
     //! AST C++ API - Unrolls the SSA form of a given AST.
     TRITON_EXPORT SharedAbstractNode unroll(const SharedAbstractNode& node);
 
     //! Returns node and all its children of an AST sorted topologically. If `unroll` is true, references are unrolled. If `revert` is true, children are on top of list.
     TRITON_EXPORT std::vector<SharedAbstractNode> childrenExtraction(const SharedAbstractNode& node, bool unroll, bool revert);
 
+    //! Returns nodes and all their children sorted topologically, each node once. If `unroll` is true, references are unrolled. If `revert` is true, children are on top of list.
+    TRITON_EXPORT std::vector<SharedAbstractNode> childrenExtraction(const std::vector<SharedAbstractNode>& nodes, bool unroll, bool revert);
+
     //! Returns node and all its parents of an AST sorted topologically. If `revert` is true, oldest parents are on top of list.
     TRITON_EXPORT std::vector<SharedAbstractNode> parentsExtraction(const SharedAbstractNode& node, bool revert);
 
+    //! Returns nodes and all their parents sorted topologically, each node once. If `revert` is true, oldest parents are on top of list.
+    TRITON_EXPORT std::vector<SharedAbstractNode> parentsExtraction(const std::vector<SharedAbstractNode>& nodes, bool revert);
+
     //! Returns a deque of collected matched nodes via a depth-first pre order traversal.
     TRITON_EXPORT std::deque<SharedAbstractNode> search(const SharedAbstractNode& node, triton::ast::ast_e match=ANY_NODE);
 
+    //! Returns the number of distinct nodes of an AST, references unrolled. The traversal stops once the count exceeds `limit`.
+    TRITON_EXPORT triton::usize countNodes(const SharedAbstractNode& node, triton::usize limit=std::numeric_limits<triton::usize>::max() - 1);
+
+    //! Returns the size in bytes of a node of type `type`, its children and parents excluded.
+    TRITON_EXPORT triton::usize getNodeSize(triton::ast::ast_e type);
+
     //! Returns the first non referene node encountered.
     TRITON_EXPORT SharedAbstractNode dereference(const SharedAbstractNode& node);
 
@@ -0,0 +1,107 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_ASTABSTRACTVALUE_HPP
+#define TRITON_ASTABSTRACTVALUE_HPP
+
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    class AbstractNode;
+
+    /*! \class AbstractValue
+     *  \brief The values a node may take, as far as a cheap analysis proves it.
+     *
+     *  \details An abstract value holds the known bits of a node, with its unsigned and signed ranges. Every
+     *  concrete value of the node, whatever the values of its variables, is in the three of them. The nodes
+     *  of up to 64 bits are tracked, a logical node as a 1-bit value, the others are not.
+     */
+    class AbstractValue {
+      public:
+        //! The size of the value, 0 if the node is not tracked.
+        triton::uint32 size;
+
+        //! The bits known to be 0.
+        triton::uint64 zeros;
+
+        //! The bits known to be 1.
+        triton::uint64 ones;
+
+        //! The lowest unsigned value.
+        triton::uint64 umin;
+
+        //! The highest unsigned value.
+        triton::uint64 umax;
+
+        //! The lowest signed value.
+        triton::sint64 smin;
+
+        //! The highest signed value.
+        triton::sint64 smax;
+
+        //! Constructor of a value not tracked.
+        TRITON_EXPORT AbstractValue(void);
+
+        //! Returns a value of `size` bits on which nothing is known, not tracked above 64 bits.
+        TRITON_EXPORT static AbstractValue top(triton::uint32 size);
+
+        //! Returns the value `value` of `size` bits.
+        TRITON_EXPORT static AbstractValue constant(triton::uint64 value, triton::uint32 size);
+
+        //! Returns true if the value is tracked.
+        TRITON_EXPORT bool isTracked(void) const;
+
+        //! Returns true if every bit is known.
+        TRITON_EXPORT bool isConstant(void) const;
+
+        //! Returns the value once every bit is known.
+        TRITON_EXPORT triton::uint64 getConstant(void) const;
+
+        //! Returns true if the 1-bit value of a logical node is known to be true.
+        TRITON_EXPORT bool isTrue(void) const;
+
+        //! Returns true if the 1-bit value of a logical node is known to be false.
+        TRITON_EXPORT bool isFalse(void) const;
+
+        //! Returns the mask of the size.
+        TRITON_EXPORT triton::uint64 getMask(void) const;
+
+        //! Narrows the known bits and the ranges with each other.
+        TRITON_EXPORT void refine(void);
+
+        //! Returns the value holding both this one and `other`, of the same size.
+        TRITON_EXPORT AbstractValue join(const AbstractValue& other) const;
+    };
+
+    //! Computes the abstract value of `node` from the ones of its operands: its children, or the AST of a reference.
+    TRITON_EXPORT AbstractValue transferAbstractValue(AbstractNode* node, const std::vector<AbstractValue>& operands);
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTABSTRACTVALUE_HPP */
@@ -0,0 +1,179 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_AST_ALLOCATOR_H
+#define TRITON_AST_ALLOCATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \class AstArena
+     *  \brief The slabs in which the nodes of an AST context are allocated.
+     *
+     *  \details Each size of node has its own slabs and free list. A freed node goes back to the free list of
+     *  its size and the slabs are only released, all at once, when the arena is destroyed. The arena is shared by
+     *  the allocators of the nodes, so it lives until the last node allocated in it. The slabs and the blocks
+     *  too large for them come from a memory resource if one is given, from the heap otherwise.
+     *
+     *  An arena owned by a thread (see the AST_CONCURRENT mode) is only allocated from by this thread. The blocks
+     *  freed by the other threads are pushed on a lock-free list, taken back by the owner once a free list is empty.
+     */
+    class AstArena {
+      private:
+        //! The granularity and the alignment of the blocks.
+        static const triton::usize granularity = 16;
+
+        //! The size of the largest block, larger ones are allocated on the heap.
+        static const triton::usize maxBlockSize = 512;
+
+        //! The number of blocks of a slab.
+        static const triton::usize blocksPerSlab = 256;
+
+        //! A free block.
+        struct FreeBlock {
+          FreeBlock* next;
+          triton::usize sizeClass;
+        };
+
+        //! The free lists, indexed by size class.
+        std::vector<FreeBlock*> freeLists;
+
+        //! The slabs and their sizes.
+        std::vector<std::pair<triton::uint8*, triton::usize>> slabs;
+
+        //! The memory resource of the slabs, nullptr for the heap.
+        std::pmr::memory_resource* resource;
+
+        //! True if the free lists belong to `owner`.
+        bool owned;
+
+        //! The thread owning the free lists.
+        std::thread::id owner;
+
+        //! The blocks freed by the other threads than the owner, of any size class.
+        std::atomic<FreeBlock*> remoteBlocks;
+
+        //! Allocates a new slab for a size class.
+        void allocateSlab(triton::usize sizeClass);
+
+        //! Moves the blocks freed by the other threads into the free lists.
+        void takeRemoteBlocks(void);
+
+      public:
+        //! A block given back while the deallocations are deferred.
+        struct Block {
+          //! The arena of the block.
+          AstArena* arena;
+
+          //! The block.
+          void* ptr;
+
+          //! The size of the block.
+          triton::usize size;
+
+          //! The alignment of the block.
+          triton::usize align;
+        };
+
+        //! Constructor. If `owned`, the arena is only allocated from by the calling thread, but any thread may free its blocks. The memory comes from `resource` if it is not nullptr.
+        TRITON_EXPORT AstArena(bool owned=false, std::pmr::memory_resource* resource=nullptr);
+
+        //! Destructor. Releases the slabs.
+        TRITON_EXPORT ~AstArena();
+
+        AstArena(const AstArena& other) = delete;
+        AstArena& operator=(const AstArena& other) = delete;
+
+        //! Defers the blocks given back to any arena by the calling thread into `blocks`, until it is called with nullptr. The blocks are then given back by their owner one at a time.
+        TRITON_EXPORT static void deferDeallocations(std::vector<Block>* blocks);
+
+        //! Returns a block of `size` bytes aligned on `align`.
+        TRITON_EXPORT void* allocate(triton::usize size, triton::usize align);
+
+        //! Gives back a block allocated with the same `size` and `align`.
+        TRITON_EXPORT void deallocate(void* ptr, triton::usize size, triton::usize align);
+
+        //! Returns the number of slabs.
+        TRITON_EXPORT triton::usize getSlabsSize(void) const;
+    };
+
+    //! Shared Arena
+    using SharedAstArena = std::shared_ptr<triton::ast::AstArena>;
+
+    /*! \class AstAllocator
+     *  \brief The allocator used by `std::allocate_shared` to build the nodes in an arena.
+     */
+    template <typename T> class AstAllocator {
+      template <typename U> friend class AstAllocator;
+
+      private:
+        //! The arena.
+        SharedAstArena arena;
+
+      public:
+        //! The type allocated.
+        using value_type = T;
+
+        //! Constructor.
+        AstAllocator(const SharedAstArena& arena) : arena(arena) {}
+
+        //! Constructor by copy of an allocator of another type.
+        template <typename U> AstAllocator(const AstAllocator<U>& other) : arena(other.arena) {}
+
+        //! Allocates `n` objects.
+        T* allocate(std::size_t n) {
+          return static_cast<T*>(this->arena->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        //! Deallocates `n` objects.
+        void deallocate(T* ptr, std::size_t n) {
+          this->arena->deallocate(ptr, n * sizeof(T), alignof(T));
+        }
+
+        //! Returns true if both allocators use the same arena.
+        template <typename U> bool operator==(const AstAllocator<U>& other) const {
+          return this->arena == other.arena;
+        }
+
+        //! Returns true if the allocators use different arenas.
+        template <typename U> bool operator!=(const AstAllocator<U>& other) const {
+          return this->arena != other.arena;
+        }
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_AST_ALLOCATOR_H */
@@ -8,16 +8,26 @@
 #ifndef TRITON_AST_CONTEXT_H
 #define TRITON_AST_CONTEXT_H
 
+#include <array>
+#include <atomic>
 #include <deque>
+#include <functional>
 #include <list>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <triton/ast.hpp>
+#include <triton/astAbstractValue.hpp>
+#include <triton/astAllocator.hpp>
+#include <triton/astReclaimer.hpp>
 #include <triton/astRepresentation.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/memoryResource.hpp>
 #include <triton/modes.hpp>
 
 
@@ -48,8 +58,18 @@ namespace triton {
    *  @{
    */
 
-    //! \class AstContext
-    /*! \brief AST Context - Used as AST builder. */
+    /*! \class AstContext
+     *  \brief AST Context - Used as AST builder.
+     *
+     *  \details In AST_CONCURRENT mode, several threads may build nodes in the same context: the node builders,
+     *  `collect()`, the variables and the abstract values are thread-safe. Each thread takes the ids and the slabs
+     *  of its nodes from its own state, and the interned nodes of the hash-consing mode are sharded, each shard
+     *  with its own lock. The nodes must still not be modified in place (`setChild()`, `updateVariable()`,
+     *  `initDirtyNodes()`, ...) while other threads use them, and the modes must not change while nodes are built.
+     *
+     *  Given a memory resource, the nodes (or the slabs of the AST_SLAB_ALLOCATOR mode) are allocated from it
+     *  instead of the heap. The resource must outlive the nodes, and be thread-safe in AST_CONCURRENT mode.
+     */
     class AstContext : public std::enable_shared_from_this<AstContext> {
       private:
         //! Modes API
@@ -58,11 +78,201 @@ namespace triton {
         //! String formater for ast
         triton::ast::representations::AstRepresentation astRepresentation;
 
-        //! Maps a concrete value and ast node for a variable name.
-        std::unordered_map<std::string, std::pair<triton::ast::WeakAbstractNode, triton::uint512>> valueMapping;
+        //! The node and the concrete value of a symbolic variable.
+        struct VariableValue {
+          //! The variable node, expired once the variable is dead.
+          triton::ast::WeakAbstractNode node;
 
-        //! The list of nodes
-        std::deque<SharedAbstractNode> nodes;
+          //! The concrete value.
+          triton::uint512 value;
+
+          //! True if the variable is initialized in this context.
+          bool initialized = false;
+        };
+
+        //! Maps a concrete value and ast node for a variable id. A deque, so that the values returned stay in place while variables are added.
+        std::deque<VariableValue> valueMapping;
+
+        //! Maps a variable name to its id, for the API by name.
+        std::unordered_map<std::string, triton::usize> variableIds;
+
+        //! The nodes whose properties and parents must be initialized again.
+        std::vector<WeakAbstractNode> dirtyNodes;
+
+        //! The ids of the destroyed nodes, given to the next new nodes.
+        std::vector<triton::uint32> freeNodeIds;
+
+        //! The lowest id never given to a node.
+        triton::uint32 nextNodeId;
+
+        //! The number of nodes created since the construction of the context.
+        triton::uint64 allocatedNodes;
+
+        //! The number of nodes alive per type, indexed by their triton::ast::ast_e.
+        std::array<triton::usize, triton::ast::STORE_NODE + 1> liveNodes;
+
+        //! The number of children of the nodes alive.
+        triton::usize liveChildren;
+
+        //! The number of ids moved at once between the context and a thread in AST_CONCURRENT mode.
+        static const triton::usize nodeIdsBatch = 64;
+
+        /*! \brief The state of a thread building nodes in AST_CONCURRENT mode.
+         *
+         *  \details The ids and the counters are only written by their thread, and merged lazily: the ids
+         *  go back to the context by batches, and the counters are summed when they are read.
+         */
+        struct ThreadState {
+          //! The ids reserved by the thread, given to its next nodes.
+          std::vector<triton::uint32> freeNodeIds;
+
+          //! The number of nodes created by the thread.
+          std::atomic<triton::uint64> allocatedNodes{0};
+
+          //! The number of nodes created minus the number of nodes destroyed by the thread, per type, modulo 2^n.
+          std::array<std::atomic<triton::usize>, triton::ast::STORE_NODE + 1> liveNodes{};
+
+          //! The number of children added minus the number of children released by the thread, modulo 2^n.
+          std::atomic<triton::usize> liveChildren{0};
+
+          //! The slabs of the nodes allocated by the thread in slab allocator mode.
+          SharedAstArena arena;
+        };
+
+        //! The states of the threads which built nodes in AST_CONCURRENT mode.
+        std::vector<std::shared_ptr<ThreadState>> threadStates;
+
+        //! Protects the ids of the context and the list of the thread states.
+        mutable std::mutex threadStatesLock;
+
+        //! The id of the context, never reused, which keys the states of a thread.
+        triton::uint64 uid;
+
+        //! Returns the state of the calling thread, created on its first node.
+        ThreadState& getThreadState(void);
+
+        //! Moves a batch of ids from the context to a thread.
+        void reserveNodeIds(ThreadState& state);
+
+        //! An abstract value, valid while its generation is the one of the context.
+        struct CachedAbstractValue {
+          //! The generation of the value, 0 once forgotten.
+          triton::uint64 generation = 0;
+
+          //! The abstract value.
+          AbstractValue value;
+        };
+
+        //! The abstract values of the nodes <node id : value>, see `getAbstractValue()`.
+        std::vector<CachedAbstractValue> abstractValues;
+
+        //! The generation of the abstract values, moved once they are all forgotten.
+        triton::uint64 abstractGeneration;
+
+        //! Returns the cached abstract value of a node, nullptr if there is none.
+        const AbstractValue* findAbstractValue(const AbstractNode* node) const;
+
+        //! The visit stamps not used by a traversal <stamps : last epoch>.
+        std::vector<std::pair<std::vector<triton::uint32>, triton::uint32>> visitStamps;
+
+        //! Protects the visit stamps, so that several threads may traverse the same AST.
+        std::mutex visitStampsLock;
+
+        //! The slabs of the nodes allocated in slab allocator mode.
+        SharedAstArena arena;
+
+        //! The memory resource of the nodes, nullptr for the heap.
+        std::pmr::memory_resource* resource;
+
+        //! The reclamation thread, nullptr if it is disabled.
+        std::unique_ptr<AstReclaimer> reclaimer;
+
+        //! Keeps the context alive while the reclamation is enabled, so that it is not destroyed by the reclamation thread.
+        std::shared_ptr<AstContext> reclaimerOwner;
+
+        //! Gives back the ids and the blocks released by the reclamation thread.
+        void collectReclaimed(void);
+
+        //! The number of shards of the interned nodes, each one locked on its own in AST_CONCURRENT mode.
+        static const triton::usize internedShards = 64;
+
+        //! A shard of the interned nodes of the hash-consing mode.
+        struct InternedShard {
+          //! The interned nodes <64-bit hash : node>.
+          std::unordered_multimap<triton::uint64, WeakAbstractNode> nodes;
+
+          //! The number of interned nodes from which the expired ones are removed.
+          triton::usize threshold = 16;
+        };
+
+        //! The interned nodes, sharded by hash.
+        std::array<InternedShard, internedShards> internedNodes;
+
+        //! The locks of the shards of the interned nodes.
+        std::array<std::mutex, internedShards> internedLocks;
+
+        //! The number of locks of the parents of the nodes in AST_CONCURRENT mode.
+        static const triton::usize parentsShards = 64;
+
+        //! The locks of the parents of the nodes, by address.
+        std::array<std::mutex, parentsShards> parentsLocks;
+
+        //! Protects the shared integer and bitvector nodes.
+        std::mutex poolsLock;
+
+        //! Protects the variables, locked again by the initialization of a variable node.
+        mutable std::recursive_mutex variablesLock;
+
+        //! Protects the abstract values.
+        std::mutex abstractValuesLock;
+
+        //! Returns `lock` locked in AST_CONCURRENT mode, not locked otherwise.
+        template <typename M> std::unique_lock<M> lockIfConcurrent(M& lock) const {
+          if (this->modes->isModeEnabled(triton::modes::AST_CONCURRENT))
+            return std::unique_lock<M>(lock);
+          return std::unique_lock<M>();
+        }
+
+        //! The highest value of the shared integer nodes, enough for every size and index.
+        static constexpr triton::uint32 maxPooledInteger = triton::bitsize::dqqword;
+
+        //! The number of small values whose bitvector nodes are shared, per size up to 64 bits.
+        static constexpr triton::uint32 pooledBvValues = 16;
+
+        //! The shared integer nodes <value : node>.
+        std::vector<WeakAbstractNode> integerPool;
+
+        //! The shared bitvector nodes <(size - 1) * pooledBvValues + value : node>.
+        std::vector<WeakAbstractNode> bvPool;
+
+        //! Returns the interned node structurally equal to `node`, or interns `node` if there is none.
+        SharedAbstractNode intern(const SharedAbstractNode& node);
+
+        //! Returns true if two nodes have the same type, size and leaf value, and share their children.
+        bool isStructurallyEqual(const SharedAbstractNode& node1, const SharedAbstractNode& node2) const;
+
+        //! The relation between two array indexes, as far as it can be proven.
+        enum index_relation_e {
+          INDEX_UNKNOWN,  //!< The indexes may or may not be equal.
+          INDEX_EQUAL,    //!< The indexes are always equal.
+          INDEX_DISTINCT, //!< The indexes are never equal.
+        };
+
+        //! Compares two array indexes, either concrete or made of a same base plus concrete offsets.
+        index_relation_e compareIndexes(const SharedAbstractNode& index1, const SharedAbstractNode& index2) const;
+
+        //! Allocates a node, in the slabs of the context if the AST_SLAB_ALLOCATOR mode is enabled, those of the calling thread in AST_CONCURRENT mode, otherwise from the memory resource.
+        template <typename T, typename... Args> std::shared_ptr<T> allocate(Args&&... args) {
+          if (this->modes->isModeEnabled(triton::modes::AST_SLAB_ALLOCATOR)) {
+            if (this->modes->isModeEnabled(triton::modes::AST_CONCURRENT))
+              return std::allocate_shared<T>(AstAllocator<T>(this->getThreadState().arena), std::forward<Args>(args)...);
+            return std::allocate_shared<T>(AstAllocator<T>(this->arena), std::forward<Args>(args)...);
+          }
+          return triton::utils::allocateShared<T>(this->resource, std::forward<Args>(args)...);
+        }
+
+        //! Evaluates `node` once per input vector, by updating the variables.
+        std::vector<triton::uint512> evaluateBatchScalar(const SharedAbstractNode& node, const std::vector<SharedAbstractNode>& vars, const std::vector<std::vector<triton::uint512>>& inputs);
 
         //! Returns simplified concatenation.
         SharedAbstractNode simplify_concat(std::vector<SharedAbstractNode> exprs);
@@ -70,9 +280,20 @@ namespace triton {
         //! Returns simplified extraction.
         SharedAbstractNode simplify_extract(triton::uint32 high, triton::uint32 low, const SharedAbstractNode& expr);
 
+        //! Returns the constant of a bitvector node whose bits are all known, nullptr if they are not.
+        SharedAbstractNode simplify_known(const SharedAbstractNode& node);
+
+        //! Returns `expr1 op expr2` rotated to keep the chains of `op` balanced, nullptr if it is not rotated. See the AST_BALANCING mode.
+        SharedAbstractNode rotate(triton::ast::ast_e type, const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+
+        //! Copies the ASTs of `nodes`, built by another context, mapping the variables by `variables` and replacing them by `substitutions`. See import().
+        std::vector<SharedAbstractNode> transplant(const std::vector<SharedAbstractNode>& nodes,
+                                                   const std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable>& variables,
+                                                   const std::unordered_map<triton::usize, SharedAbstractNode>& substitutions);
+
       public:
-        //! Constructor
-        TRITON_EXPORT AstContext(const triton::modes::SharedModes& modes);
+        //! Constructor. The nodes are allocated from `resource` if it is not nullptr.
+        TRITON_EXPORT AstContext(const triton::modes::SharedModes& modes, std::pmr::memory_resource* resource=nullptr);
 
         //! Destructor
         TRITON_EXPORT ~AstContext();
@@ -80,12 +301,37 @@ namespace triton {
         //! Operator
         TRITON_EXPORT AstContext& operator=(const AstContext& other);
 
-        //! Collect new nodes
-        TRITON_EXPORT SharedAbstractNode collect(const SharedAbstractNode& node);
+        //! Forgets the variables, the interned nodes and the cached abstract values, and restores the default representation. The arenas, the node ids and the reclamation thread are kept.
+        TRITON_EXPORT void reset(void);
 
-        //! Garbage unused nodes.
+        //! Collect new nodes. Returns the node to use, which is an already existing one in hash-consing mode.
+        TRITON_EXPORT SharedAbstractNode collect(const SharedAbstractNode& n);
+
+        //! Garbage unused nodes. Does nothing, the nodes are released iteratively as soon as they die. Kept for compatibility.
         TRITON_EXPORT void garbage(void);
 
+        /*!
+         * \brief Enables or disables the reclamation thread.
+         *
+         * \details Once enabled, the objects given to `reclaim()` are released by a thread of the context,
+         * so that the destructors of the dead ASTs they own do not run on the thread of the emulation. At most
+         * `capacity` objects wait, `reclaim()` waiting for the thread beyond. The context is kept alive until
+         * the reclamation is disabled, which waits for the objects queued.
+         */
+        TRITON_EXPORT void setReclamation(bool enable, triton::usize capacity=65536);
+
+        //! Returns true if the reclamation thread is enabled.
+        TRITON_EXPORT bool isReclamationEnabled(void) const;
+
+        //! Releases an object, on the reclamation thread if it is enabled and `object` is its last owner.
+        TRITON_EXPORT void reclaim(std::shared_ptr<void>&& object);
+
+        //! Waits until the objects queued to the reclamation thread are released.
+        TRITON_EXPORT void flushReclamation(void);
+
+        //! Returns the number of calls to `reclaim()` which waited for the reclamation thread.
+        TRITON_EXPORT triton::usize getReclamationStalls(void) const;
+
         //! AST C++ API - array node builder
         TRITON_EXPORT SharedAbstractNode array(triton::uint32 addrSize);
 
@@ -95,7 +341,7 @@ namespace triton {
         //! AST C++ API - bswap node builder
         TRITON_EXPORT SharedAbstractNode bswap(const SharedAbstractNode& expr);
 
-        //! AST C++ API - bv node builder
+        //! AST C++ API - bv node builder. The nodes of the values lower than 16, up to 64 bits, are shared and must not be modified.
         TRITON_EXPORT SharedAbstractNode bv(const triton::uint512& value, triton::uint32 size);
 
         //! AST C++ API - bvadd node builder
@@ -199,7 +445,7 @@ namespace triton {
 
         //! AST C++ API - compound node builder
         template <typename T> SharedAbstractNode compound(const T& exprs) {
-          SharedAbstractNode node = std::make_shared<CompoundNode>(exprs, this->shared_from_this());
+          SharedAbstractNode node = this->allocate<CompoundNode>(exprs, this->shared_from_this());
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
           node->init();
@@ -217,7 +463,7 @@ namespace triton {
           }
 
           /* Allocate node */
-          SharedAbstractNode node = std::make_shared<ConcatNode>(exprs, this->shared_from_this());
+          SharedAbstractNode node = this->allocate<ConcatNode>(exprs, this->shared_from_this());
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
           node->init();
@@ -253,7 +499,7 @@ namespace triton {
 
         //! AST C++ API - forall node builder
         template <typename T> SharedAbstractNode forall(const T& vars, const SharedAbstractNode& body) {
-          SharedAbstractNode node = std::make_shared<ForallNode>(vars, body);
+          SharedAbstractNode node = this->allocate<ForallNode>(vars, body);
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
           node->init();
@@ -263,7 +509,7 @@ namespace triton {
         //! AST C++ API - iff node builder
         TRITON_EXPORT SharedAbstractNode iff(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
 
-        //! AST C++ API - integer node builder
+        //! AST C++ API - integer node builder. The nodes of the values up to 512 are shared and must not be modified.
         TRITON_EXPORT SharedAbstractNode integer(const triton::uint512& value);
 
         //! AST C++ API - ite node builder
@@ -274,7 +520,7 @@ namespace triton {
 
         //! AST C++ API - land node builder
         template <typename T> SharedAbstractNode land(const T& exprs) {
-          SharedAbstractNode node = std::make_shared<LandNode>(exprs, this->shared_from_this());
+          SharedAbstractNode node = this->allocate<LandNode>(exprs, this->shared_from_this());
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
           node->init();
@@ -292,7 +538,7 @@ namespace triton {
 
         //! AST C++ API - lor node builder
         template <typename T> SharedAbstractNode lor(const T& exprs) {
-          SharedAbstractNode node = std::make_shared<LorNode>(exprs, this->shared_from_this());
+          SharedAbstractNode node = this->allocate<LorNode>(exprs, this->shared_from_this());
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
           node->init();
@@ -304,7 +550,7 @@ namespace triton {
 
         //! AST C++ API - lxor node builder
         template <typename T> SharedAbstractNode lxor(const T& exprs) {
-          SharedAbstractNode node = std::make_shared<LxorNode>(exprs, this->shared_from_this());
+          SharedAbstractNode node = this->allocate<LxorNode>(exprs, this->shared_from_this());
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
           node->init();
@@ -338,29 +584,182 @@ namespace triton {
         //! AST C++ API - zx node builder
         TRITON_EXPORT SharedAbstractNode zx(triton::uint32 sizeExt, const SharedAbstractNode& expr);
 
+        /*!
+         * \brief AST C++ API - returns `node` with its chains of associative operators flattened.
+         *
+         * \details A chain is a tree of `bvadd`, `bvand`, `bvmul`, `bvor`, `bvxor`, `land` or `lor` nodes of the
+         * same type, through the references. The chains of `land` and `lor` become one n-ary node, the others a
+         * balanced tree of their operands in the same order. The references are unrolled and a shared node is
+         * rebuilt once. `node` is not modified.
+         */
+        TRITON_EXPORT SharedAbstractNode balance(const SharedAbstractNode& node);
+
+        //! AST C++ API - builds a node of `type` from its children, as returned by `getChildren()`. Leaves cannot be built.
+        TRITON_EXPORT SharedAbstractNode build(triton::ast::ast_e type, const std::vector<SharedAbstractNode>& children);
+
+        /*!
+         * \brief AST C++ API - copies the AST of `node`, built by another context, into this context.
+         *
+         * \details The DAG is copied iteratively, a shared node once, and the references are unrolled. A
+         * variable whose id is in `variables` is replaced by its mapping, the others are kept by id. A variable
+         * already known here keeps its node and its value, a new one gets the value of the source context.
+         * The source AST is only read. See also SsaTrace, an immutable form several contexts may rebuild from.
+         */
+        TRITON_EXPORT SharedAbstractNode import(const SharedAbstractNode& node, const std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable>& variables={});
+
+        /*!
+         * \brief AST C++ API - copies the ASTs of `nodes`, built by another context, into this context, each shared node once.
+         *
+         * \details A variable whose id is in `substitutions` is replaced by its mapping, a node of this context
+         * of the same size, the others are imported as by import(). This composes a summary computed over its
+         * own variables with the state of this context. Returns the copies in the order of `nodes`.
+         */
+        TRITON_EXPORT std::vector<SharedAbstractNode> import(const std::vector<SharedAbstractNode>& nodes, const std::unordered_map<triton::usize, SharedAbstractNode>& substitutions);
+
+        /*!
+         * \brief AST C++ API - rebuilds the AST of `node` with each node in `mapping` replaced by its mapping.
+         *
+         * \details The DAG is rebuilt iteratively, children before parents, each shared node once. The unchanged
+         * subtrees are shared with `node`, the new nodes are only built along the paths to a replaced node. The
+         * keys are matched by identity: a variable is replaced through its node, see `getVariableNode()`, and a
+         * mapping must have the size of its key. The references are followed, a reference whose expression changed
+         * is replaced by the new AST of its expression. If `inplace` is true, the nodes reached without following a
+         * reference get their new children in place instead of being rebuilt, which the caller may only do on nodes
+         * it owns exclusively; they are rebuilt anyway with `AST_HASH_CONSING`, whose nodes are shared.
+         */
+        TRITON_EXPORT SharedAbstractNode substitute(const SharedAbstractNode& node, const std::unordered_map<SharedAbstractNode, SharedAbstractNode>& mapping, bool inplace=false);
+
+        //! AST C++ API - rebuilds the ASTs of `nodes` sharing their common nodes, see substitute(node, mapping, inplace). Returns the results in the order of `nodes`.
+        TRITON_EXPORT std::vector<SharedAbstractNode> substitute(const std::vector<SharedAbstractNode>& nodes, const std::unordered_map<SharedAbstractNode, SharedAbstractNode>& mapping, bool inplace=false);
+
+        //! AST C++ API - splits `vec` into lanes of `size` bits, lane 0 being the least significant. The aligned parts of a concatenation are returned as is.
+        TRITON_EXPORT std::vector<SharedAbstractNode> lanes(const SharedAbstractNode& vec, triton::uint32 size);
+
+        //! AST C++ API - returns the lane `index` of `size` bits of `vec`.
+        TRITON_EXPORT SharedAbstractNode lane(const SharedAbstractNode& vec, triton::uint32 size, triton::uint32 index);
+
+        //! AST C++ API - returns `vec` with its lane `index` replaced by `value`, the lanes being of the size of `value`.
+        TRITON_EXPORT SharedAbstractNode insertLane(const SharedAbstractNode& vec, triton::uint32 index, const SharedAbstractNode& value);
+
+        //! AST C++ API - concatenates `lanes` into a vector, lane 0 being the least significant.
+        TRITON_EXPORT SharedAbstractNode concatLanes(const std::vector<SharedAbstractNode>& lanes);
+
+        //! AST C++ API - returns a vector of `count` lanes, each one being the same `lane` node.
+        TRITON_EXPORT SharedAbstractNode splat(const SharedAbstractNode& lane, triton::uint32 count);
+
+        //! AST C++ API - returns the vector of `fn` applied to each lane of `size` bits of `vec`.
+        TRITON_EXPORT SharedAbstractNode mapLanes(const SharedAbstractNode& vec, triton::uint32 size, const std::function<SharedAbstractNode(const SharedAbstractNode&)>& fn);
+
+        //! AST C++ API - returns the vector of `fn` applied to each pair of lanes of `size` bits of `vec1` and `vec2`.
+        TRITON_EXPORT SharedAbstractNode zipLanes(const SharedAbstractNode& vec1, const SharedAbstractNode& vec2, triton::uint32 size, const std::function<SharedAbstractNode(const SharedAbstractNode&, const SharedAbstractNode&)>& fn);
+
         //! Initializes a variable in the context
         TRITON_EXPORT void initVariable(const std::string& name, const triton::uint512& value, const SharedAbstractNode& node);
 
-        //! Updates a variable value in this context
-        TRITON_EXPORT void updateVariable(const std::string& name, const triton::uint512& value);
+        //! Updates a variable value in this context. If withParents is false, the variable node is only marked dirty, see `initDirtyNodes()`.
+        TRITON_EXPORT void updateVariable(const std::string& name, const triton::uint512& value, bool withParents=true);
+
+        //! Updates the value of the variable of id `id` in this context. If withParents is false, the variable node is only marked dirty, see `initDirtyNodes()`.
+        TRITON_EXPORT void updateVariable(triton::usize id, const triton::uint512& value, bool withParents=true);
+
+        //! Marks a node whose properties and parents must be initialized again by `initDirtyNodes()`.
+        TRITON_EXPORT void setDirtyNode(const SharedAbstractNode& node);
+
+        //! Initializes the dirty nodes and their parents, each node once and children before parents.
+        TRITON_EXPORT void initDirtyNodes(void);
+
+        //! Returns a dense id for a new node of type `type`.
+        TRITON_EXPORT triton::uint32 newNodeId(triton::ast::ast_e type);
+
+        //! Gives back the id of a destroyed node of type `type`, which had `children` children.
+        TRITON_EXPORT void releaseNodeId(triton::uint32 id, triton::ast::ast_e type, triton::usize children);
+
+        //! Accounts for `count` children added to a node.
+        TRITON_EXPORT void countChildren(triton::usize count);
+
+        //! Returns the lock of the parents of `node` locked in AST_CONCURRENT mode, as the threads building nodes over a same child add their parents to it. Not locked otherwise.
+        TRITON_EXPORT std::unique_lock<std::mutex> lockParents(const AbstractNode* node);
+
+        //! Returns the abstract value of a node: its known bits and ranges, whatever the values of the variables. The values are cached per node id, so that a node is analyzed once.
+        TRITON_EXPORT AbstractValue getAbstractValue(const SharedAbstractNode& node);
+
+        //! Forgets the cached abstract value of a node, once its children change.
+        TRITON_EXPORT void forgetAbstractValue(triton::uint32 id);
+
+        //! Forgets every cached abstract value, once a referenced expression changes.
+        TRITON_EXPORT void forgetAbstractValues(void);
+
+        //! Returns true if the nodes also compute their 512-bit hash (AST_WIDE_HASH mode).
+        TRITON_EXPORT bool isWideHashEnabled(void) const;
+
+        //! Returns an upper bound of the ids given to the nodes alive.
+        TRITON_EXPORT triton::uint32 getNodeIdsSize(void) const;
+
+        //! Returns the number of nodes created since the construction of the context, shared nodes counted once.
+        TRITON_EXPORT triton::uint64 getAllocatedNodes(void) const;
+
+        //! Returns the number of nodes of type `type` alive.
+        TRITON_EXPORT triton::usize getLiveNodes(triton::ast::ast_e type) const;
+
+        //! Returns the number of children of the nodes alive, an edge of the AST each.
+        TRITON_EXPORT triton::usize getLiveChildren(void) const;
+
+        //! Takes visit stamps and a new epoch from the context, see `VisitedNodes`.
+        TRITON_EXPORT std::pair<std::vector<triton::uint32>, triton::uint32> acquireVisitStamps(void);
+
+        //! Gives back visit stamps to the context.
+        TRITON_EXPORT void releaseVisitStamps(std::vector<triton::uint32>&& stamps, triton::uint32 epoch);
+
+        //! Evaluates `node` for each vector of `inputs`, which gives the values of `vars` in order. The variables keep their values.
+        TRITON_EXPORT std::vector<triton::uint512> evaluateBatch(const SharedAbstractNode& node, const std::vector<SharedAbstractNode>& vars, const std::vector<std::vector<triton::uint512>>& inputs);
+
+        //! Returns true if `evaluateBatch()` evaluates `node` with native integers. The nodes and the variables are then only read, so several threads may evaluate the same AST.
+        TRITON_EXPORT bool isBatchEvaluationNative(const SharedAbstractNode& node);
+
+        //! Returns true if `node` has the same value on `samples` inputs of its variables, their extreme values then pseudo random ones, this value being returned in `value`. The variables keep their values.
+        TRITON_EXPORT bool sampleConstant(const SharedAbstractNode& node, triton::usize samples, triton::uint512* value=nullptr);
+
+        //! Evaluates `node` with the values of `model`, by symbolic variable id. The other variables keep their values. Neither the nodes nor the variables are modified, so several threads may evaluate the same AST. Arrays are not supported.
+        TRITON_EXPORT triton::uint512 evaluate(const SharedAbstractNode& node, const std::unordered_map<triton::usize, triton::uint512>& model) const;
 
         //! Gets a variable node from its name.
         SharedAbstractNode getVariableNode(const std::string& name);
 
+        //! Gets a variable node from its id.
+        SharedAbstractNode getVariableNode(triton::usize id);
+
         //! Returns the address space used for the ABV logic.
         TRITON_EXPORT triton::uint16 getArraySize(void) const;
 
         //! Gets a variable value from its name.
         TRITON_EXPORT const triton::uint512& getVariableValue(const std::string& name) const;
 
+        //! Gets a variable value from its id.
+        TRITON_EXPORT const triton::uint512& getVariableValue(triton::usize id) const;
+
         //! Sets the representation mode for this astContext
         TRITON_EXPORT void setRepresentationMode(triton::ast::representations::mode_e mode);
 
         //! Gets the representations mode of this astContext
         TRITON_EXPORT triton::ast::representations::mode_e getRepresentationMode(void) const;
 
+        //! Returns the modes of this astContext.
+        TRITON_EXPORT const triton::modes::SharedModes& getModes(void) const;
+
+        //! Returns the memory resource of the nodes, nullptr for the heap.
+        TRITON_EXPORT std::pmr::memory_resource* getMemoryResource(void) const;
+
         //! Prints the node according to the current representation mode.
         TRITON_EXPORT std::ostream& print(std::ostream& stream, AbstractNode* node);
+
+        //! Chooses the subexpressions of `roots` printed as temporaries. \sa triton::ast::representations::AstRepresentation::shareTemporaries().
+        TRITON_EXPORT void shareTemporaries(const std::vector<SharedAbstractNode>& roots);
+
+        //! Prints the definitions of the temporaries of `node` not printed yet according to the current representation mode.
+        TRITON_EXPORT std::ostream& printTemporaries(std::ostream& stream, const SharedAbstractNode& node);
+
+        //! Forgets the temporaries, the nodes are printed in full again.
+        TRITON_EXPORT void clearTemporaries(void);
     };
 
     //! Shared AST context
@@ -99,7 +99,8 @@ namespace triton {
         SMT_REPRESENTATION = 0,     /*!< SMT representation */
         PYTHON_REPRESENTATION = 1,  /*!< Python representation */
         PCODE_REPRESENTATION = 2,   /*!< Pseudo Code representation */
-        LAST_REPRESENTATION = 3,    /*!< Must be the last item */
+        C_REPRESENTATION = 3,       /*!< C representation */
+        LAST_REPRESENTATION = 4,    /*!< Must be the last item */
       };
 
     /*! @} End of representations namespace */
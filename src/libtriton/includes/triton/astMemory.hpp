@@ -0,0 +1,94 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_AST_MEMORY_H
+#define TRITON_AST_MEMORY_H
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \class ArrayMemory
+     *  \brief The concrete cells of an array, see `ArrayNode` and `StoreNode`.
+     *
+     *  \details The cells are kept in a persistent radix tree of 64 children per level, whose nodes are
+     *  immutable and compressed by a bitmap. A copy shares the whole tree, and `store()` only copies the
+     *  nodes of the path to the modified cell, so that a chain of stores shares everything else. The tree
+     *  only grows as deep as the highest address requires.
+     */
+    class ArrayMemory {
+      private:
+        //! A node of the tree, defined by the implementation.
+        struct Node;
+
+        //! The root of the tree, nullptr if no cell is defined.
+        std::shared_ptr<const Node> root;
+
+        //! The number of levels above the leaves.
+        triton::uint32 levels;
+
+        //! The number of cells defined.
+        triton::usize cells;
+
+        //! Returns true if the address is covered by the current levels.
+        bool fits(triton::uint64 addr) const;
+
+        //! Returns the cell at `addr`, nullptr if it is not defined.
+        const triton::uint8* find(triton::uint64 addr) const;
+
+        //! Returns a copy of `node` at `level` where the cell at `addr` is `value`.
+        static std::shared_ptr<const Node> store(const Node* node, triton::uint32 level, triton::uint64 addr, triton::uint8 value);
+
+        //! Appends the cells of `node` at `level` to `out`, in address order.
+        static void collect(const Node* node, triton::uint32 level, triton::uint64 prefix, std::vector<std::pair<triton::uint64, triton::uint8>>& out);
+
+      public:
+        //! Constructor. No cell is defined.
+        TRITON_EXPORT ArrayMemory();
+
+        //! Stores a concrete value at `addr`.
+        TRITON_EXPORT void store(triton::uint64 addr, triton::uint8 value);
+
+        //! Returns the concrete value at `addr`, 0 if the cell is not defined.
+        TRITON_EXPORT triton::uint8 select(triton::uint64 addr) const;
+
+        //! Returns true if the cell at `addr` is defined.
+        TRITON_EXPORT bool isDefined(triton::uint64 addr) const;
+
+        //! Returns the number of cells defined.
+        TRITON_EXPORT triton::usize size(void) const;
+
+        //! Returns the cells defined, in address order.
+        TRITON_EXPORT std::vector<std::pair<triton::uint64, triton::uint8>> getCells(void) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_AST_MEMORY_H */
@@ -0,0 +1,110 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_AST_PROGRAM_H
+#define TRITON_AST_PROGRAM_H
+
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \class AstProgram
+     *  \brief An AST compiled into a flat register-based program.
+     *
+     *  \details Each node of the DAG, references unrolled, is given one register and one instruction, in
+     *  topological order, so a shared subexpression is computed once per evaluation. Constants have no
+     *  instruction, their registers are written at compilation. `eval()` runs the instructions on the registers
+     *  only: it neither allocates nor touches the original AST, which may be modified or destroyed afterwards.
+     */
+    class AstProgram {
+      private:
+        //! An instruction of the program.
+        struct Instruction {
+          //! The type of the node.
+          triton::ast::ast_e type;
+
+          //! The register of the result.
+          triton::uint32 dst;
+
+          //! The size of the node.
+          triton::uint32 size;
+
+          //! The position of the operands in `operands`.
+          triton::uint32 first;
+
+          //! The number of operands.
+          triton::uint32 count;
+
+          //! The immediate of the node: the low bit of an extraction, the rotation or the index of a variable.
+          triton::uint32 imm;
+
+          //! The mask of the node.
+          triton::uint512 mask;
+        };
+
+        //! The instructions.
+        std::vector<Instruction> instructions;
+
+        //! The registers read by the instructions.
+        std::vector<triton::uint32> operands;
+
+        //! The registers, one per node.
+        std::vector<triton::uint512> registers;
+
+        //! The sizes of the registers.
+        std::vector<triton::uint32> sizes;
+
+        //! The ids of the symbolic variables, indexed by the immediate of their instructions.
+        std::vector<triton::usize> variables;
+
+        //! The values of the symbolic variables when the program has been compiled.
+        std::vector<triton::uint512> defaults;
+
+        //! The register of the root.
+        triton::uint32 root;
+
+        //! Returns the value of a register sign extended from its size.
+        triton::sint512 signExtend(triton::uint32 reg) const;
+
+      public:
+        //! Constructor. Compiles `node`.
+        TRITON_EXPORT AstProgram(const SharedAbstractNode& node);
+
+        //! Evaluates the program. `values` gives the values of symbolic variables by id, the others keep their values at compilation.
+        TRITON_EXPORT triton::uint512 eval(const std::unordered_map<triton::usize, triton::uint512>& values);
+
+        //! Returns the number of instructions.
+        TRITON_EXPORT triton::usize getInstructionsSize(void) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_AST_PROGRAM_H */
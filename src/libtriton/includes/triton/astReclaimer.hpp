@@ -0,0 +1,137 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_AST_RECLAIMER_H
+#define TRITON_AST_RECLAIMER_H
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <triton/astAllocator.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    class AstContext;
+
+    /*! \class AstReclaimer
+     *  \brief The thread releasing the dead ASTs of a context, see `AstContext::setReclamation()`.
+     *
+     *  \details The objects queued by `submit()` are released on the reclamation thread, so that the
+     *  destructors of the nodes they own run there. The ids of the nodes and the blocks of the arena are
+     *  owned by the thread of the context: they are given back to it by `collect()`. When `capacity`
+     *  objects wait, `submit()` waits for the thread and counts a stall.
+     */
+    class AstReclaimer {
+      public:
+        //! The id of a dead node, given back by `collect()`.
+        struct Release {
+          //! The id of the node.
+          triton::uint32 id;
+
+          //! The type of the node.
+          triton::ast::ast_e type;
+
+          //! The number of children of the node.
+          triton::usize children;
+        };
+
+      private:
+        //! The maximum number of objects waiting.
+        triton::usize capacity;
+
+        //! The number of calls to `submit()` which waited for the thread.
+        triton::usize stalls;
+
+        //! The objects waiting to be released.
+        std::vector<std::shared_ptr<void>> queue;
+
+        //! The ids released by the thread, not collected yet.
+        std::vector<Release> released;
+
+        //! The ids released by the batch being released, only used by the thread.
+        std::vector<Release> batchIds;
+
+        //! The blocks given back by the thread, not collected yet.
+        std::vector<AstArena::Block> blocks;
+
+        //! True while the thread releases a batch.
+        bool busy;
+
+        //! True once the thread must end after releasing the queue.
+        bool stopping;
+
+        //! The lock of the members shared with the thread.
+        std::mutex lock;
+
+        //! Notified when objects are queued or the thread must end.
+        std::condition_variable ready;
+
+        //! Notified when the thread has taken or released a batch.
+        std::condition_variable done;
+
+        //! The reclamation thread.
+        std::thread thread;
+
+        //! The loop of the reclamation thread.
+        void run(void);
+
+      public:
+        //! Constructor. Starts the reclamation thread.
+        TRITON_EXPORT AstReclaimer(triton::usize capacity);
+
+        AstReclaimer(const AstReclaimer& other) = delete;
+        AstReclaimer& operator=(const AstReclaimer& other) = delete;
+
+        //! Destructor. Releases the queue and ends the thread. The ids and blocks not collected are dropped.
+        TRITON_EXPORT ~AstReclaimer();
+
+        //! Queues an object to release, waiting while `capacity` objects wait.
+        TRITON_EXPORT void submit(std::shared_ptr<void>&& object);
+
+        //! Returns true and keeps the id of a dead node when called by the reclamation thread.
+        TRITON_EXPORT bool defer(triton::uint32 id, triton::ast::ast_e type, triton::usize children);
+
+        //! Moves the ids and blocks released so far into `ids` and `freed`.
+        TRITON_EXPORT void collect(std::vector<Release>& ids, std::vector<AstArena::Block>& freed);
+
+        //! Waits until the queue is released.
+        TRITON_EXPORT void flush(void);
+
+        //! Returns the number of objects waiting.
+        TRITON_EXPORT triton::usize getPending(void);
+
+        //! Returns the number of calls to `submit()` which waited for the thread.
+        TRITON_EXPORT triton::usize getStalls(void) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_AST_RECLAIMER_H */
@@ -10,6 +10,9 @@
 
 #include <iostream>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/astEnums.hpp>
@@ -50,7 +53,22 @@ namespace triton {
           //! AstRepresentation interface.
           std::unique_ptr<triton::ast::representations::AstRepresentationInterface> representations[triton::ast::representations::LAST_REPRESENTATION];
 
+          //! The temporaries, by node. The name is empty until the definition is printed.
+          std::unordered_map<const AbstractNode*, std::pair<SharedAbstractNode, std::string>> temporaries;
+
+          //! The number of temporaries printed.
+          triton::usize printed;
+
+          //! The number of let and forall nodes being printed. Their bodies are printed without temporaries.
+          triton::usize scopes;
+
+          //! Returns true if `node` can be printed as a temporary.
+          bool isTemporary(const SharedAbstractNode& node) const;
+
         public:
+          //! The maximum depth printed without temporary.
+          static const triton::uint32 maxDepth = 32;
+
           //! Constructor.
           TRITON_EXPORT AstRepresentation();
 
@@ -68,6 +86,20 @@ namespace triton {
 
           //! Prints the node according to the current representation mode.
           TRITON_EXPORT std::ostream& print(std::ostream& stream, AbstractNode* node);
+
+          /*!
+           * \brief Chooses the subexpressions of `roots` printed as temporaries: the nodes used several times and the nodes
+           * deeper than `maxDepth` below the last temporary. References are not followed.
+           *
+           * \details Once its definition is printed by `printTemporaries()`, a temporary is printed by name until `clearTemporaries()`.
+           */
+          TRITON_EXPORT void shareTemporaries(const std::vector<SharedAbstractNode>& roots);
+
+          //! Prints the definitions of the temporaries of `node` not printed yet, children first, one per line.
+          TRITON_EXPORT std::ostream& printTemporaries(std::ostream& stream, const SharedAbstractNode& node);
+
+          //! Forgets the temporaries.
+          TRITON_EXPORT void clearTemporaries(void);
       };
 
     /*! @} End of representations namespace */
@@ -0,0 +1,152 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_AST_REWRITER_H
+#define TRITON_AST_REWRITER_H
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \class AstRewriter
+     *  \brief A native term-rewriting engine.
+     *
+     *  \details The rules are indexed by the type of the root they apply to. `rewrite()` goes through the DAG
+     *  bottom-up, without following references, and memoizes the result of each node by id: a shared node is
+     *  rewritten once. The nodes are never modified, a node whose children changed is built again. When a rule
+     *  applies, its result is rewritten in turn, up to `maxRewrites` times in a row.
+     *
+     *  Declarative rules are written as two patterns in the SMT syntax:
+     *
+     *  ~~~~~~~~~~~~~{.cpp}
+     *  rewriter.addRule("(bvadd (bvand x y) (bvor x y))", "(bvadd x y)");
+     *  rewriter.addRule("(bvadd (bvadd x #a) #b)", "(bvadd x (bvadd #a #b))");
+     *  ~~~~~~~~~~~~~
+     *
+     *  A name matches any node, the same name must match equal nodes. A name starting with `#` only matches
+     *  concrete nodes, and a number only matches a concrete node of this value. Commutative operators match both
+     *  orders of their operands. The patterns only use operators whose operands have the size of their result, so
+     *  that the numbers of the replacement take the size of the rewritten node. The concrete nodes built by a
+     *  replacement are folded into constants.
+     */
+    class AstRewriter {
+      public:
+        //! A native rule. Returns the rewritten node, or null if the rule does not apply.
+        using Rule = std::function<SharedAbstractNode(const SharedAbstractNode& node)>;
+
+        //! The maximum number of rules applied in a row on a node.
+        static const triton::usize maxRewrites = 64;
+
+      private:
+        //! A pattern of a declarative rule.
+        struct Pattern {
+          //! The type of the operator, or INVALID_NODE for a name or a number.
+          triton::ast::ast_e type;
+
+          //! The name of a placeholder, empty for a number.
+          std::string name;
+
+          //! The value of a number, which may be negative.
+          triton::sint512 value;
+
+          //! The operands.
+          std::vector<Pattern> children;
+        };
+
+        //! The bindings of the names of a pattern.
+        using Bindings = std::vector<std::pair<std::string, SharedAbstractNode>>;
+
+        //! The memoized results, by node id.
+        class Memo {
+          private:
+            //! The nodes and their results, indexed by id. The nodes are kept alive so that their ids are not given again.
+            std::vector<std::pair<SharedAbstractNode, SharedAbstractNode>> results;
+
+            //! The results of the nodes whose id is taken by a node of another context.
+            std::unordered_map<const AbstractNode*, std::pair<SharedAbstractNode, SharedAbstractNode>> others;
+
+          public:
+            //! Returns the result of a node, null if not rewritten yet.
+            SharedAbstractNode get(const SharedAbstractNode& node) const;
+
+            //! Sets the result of a node.
+            void set(const SharedAbstractNode& node, const SharedAbstractNode& result);
+        };
+
+        //! The rules, by type of root.
+        std::unordered_map<triton::ast::ast_e, std::vector<Rule>> rules;
+
+        //! Increased each time the rules change.
+        triton::usize version = 0;
+
+        //! Parses a pattern.
+        static Pattern parse(const std::string& text, triton::usize& position);
+
+        //! Matches the patterns of `goals` against their nodes, trying both orders of the commutative operators.
+        static bool match(std::vector<std::pair<const Pattern*, SharedAbstractNode>> goals, Bindings& bindings);
+
+        //! Builds the replacement of a pattern.
+        static SharedAbstractNode instantiate(const Pattern& pattern, const SharedAbstractNode& root, const Bindings& bindings);
+
+        //! Rewrites `root` and its children not memoized yet.
+        SharedAbstractNode process(const SharedAbstractNode& root, Memo& memo, triton::usize depth) const;
+
+        //! Rewrites a node whose children are memoized.
+        SharedAbstractNode apply(const SharedAbstractNode& node, Memo& memo, triton::usize depth) const;
+
+      public:
+        //! Adds a native rule for the nodes of `type`.
+        TRITON_EXPORT void addRule(triton::ast::ast_e type, const Rule& rule);
+
+        //! Adds a declarative rule which replaces the nodes matching `pattern` by `replacement`.
+        TRITON_EXPORT void addRule(const std::string& pattern, const std::string& replacement);
+
+        //! Adds the built-in rules: MBA identities, constant reassociation and extract/concat fusion.
+        TRITON_EXPORT void addBuiltinRules(void);
+
+        //! Removes all rules.
+        TRITON_EXPORT void clearRules(void);
+
+        //! Returns the number of rules.
+        TRITON_EXPORT triton::usize getRulesSize(void) const;
+
+        //! Returns a number which increases each time the rules change.
+        TRITON_EXPORT triton::usize getVersion(void) const;
+
+        //! Returns the rewritten node. `node` is not modified.
+        TRITON_EXPORT SharedAbstractNode rewrite(const SharedAbstractNode& node) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_AST_REWRITER_H */
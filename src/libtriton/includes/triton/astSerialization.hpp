@@ -0,0 +1,75 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_AST_SERIALIZATION_H
+#define TRITON_AST_SERIALIZATION_H
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  /* Forward declarations */
+  namespace engines {
+    namespace symbolic {
+      class SymbolicExpression;
+      using SharedSymbolicExpression = std::shared_ptr<triton::engines::symbolic::SymbolicExpression>;
+    };
+  };
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*
+     *  The binary format is a table of records in topological order, children first and references
+     *  unrolled, so a shared node is written once. Numbers are LEB128 varints and a child is written as
+     *  the distance to its parent in the table. The symbolic variables are written with their variable
+     *  nodes and the symbolic expressions before their first reference. Origins of expressions are not
+     *  written, as registers need an architecture to be read back.
+     */
+
+    //! Writes the DAG of `nodes` in binary form.
+    TRITON_EXPORT void serialize(std::ostream& stream, const std::vector<SharedAbstractNode>& nodes);
+
+    //! Writes symbolic expressions and their DAG in binary form.
+    TRITON_EXPORT void serialize(std::ostream& stream, const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs);
+
+    //! Writes nodes and symbolic expressions sharing a same DAG in binary form.
+    TRITON_EXPORT void serialize(std::ostream& stream, const std::vector<SharedAbstractNode>& nodes, const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs);
+
+    //! Reads back into `ctxt` the nodes written by `serialize()`. The symbolic variables already known by `ctxt` keep their values.
+    TRITON_EXPORT std::vector<SharedAbstractNode> deserializeNodes(std::istream& stream, const SharedAstContext& ctxt);
+
+    //! Reads back into `ctxt` the symbolic expressions written by `serialize()`. The symbolic variables already known by `ctxt` keep their values.
+    TRITON_EXPORT std::vector<triton::engines::symbolic::SharedSymbolicExpression> deserializeExpressions(std::istream& stream, const SharedAstContext& ctxt);
+
+    //! Reads back into `ctxt` the nodes and the symbolic expressions written by `serialize(stream, nodes, exprs)`. The symbolic variables already known by `ctxt` keep their values.
+    TRITON_EXPORT void deserialize(std::istream& stream, const SharedAstContext& ctxt, std::vector<SharedAbstractNode>& nodes, std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs);
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_AST_SERIALIZATION_H */
@@ -0,0 +1,150 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_AST_SMT_PARSER_H
+#define TRITON_AST_SMT_PARSER_H
+
+#include <functional>
+#include <istream>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! A token of SMT-LIB2.
+    struct SmtToken {
+      //! The kind of token.
+      enum kind_e {
+        LPAREN,
+        RPAREN,
+        ATOM,
+        END,
+      } kind;
+
+      //! The symbol, keyword, numeral or literal of an `ATOM`.
+      std::string text;
+    };
+
+    /* Forward declarations */
+    class SmtLexer;
+
+    /*! \class AstSmtParser
+     *  \brief Reads SMT-LIB2 scripts into the nodes of an AST context, without any solver.
+     *
+     *  \details The parser handles the QF_ABV subset printed by the SMT representation and `liftToSMT()`:
+     *  `declare-fun`, `declare-const`, `define-fun` (with or without parameters) and `assert`, the
+     *  bitvector, boolean and array operators, `let` and the `bswapN` functions. Each name bound by a
+     *  `let` or a `define-fun` without parameters is built once and shared by all its references.
+     *  The other commands (`set-logic`, `check-sat`, `get-model`, ...) are skipped.
+     */
+    class AstSmtParser {
+      public:
+        //! Returns the symbolic variable for a declared constant of `size` bits.
+        using VariableCallback = std::function<triton::engines::symbolic::SharedSymbolicVariable(const std::string& name, triton::uint32 size)>;
+
+      private:
+        //! A sort: a bitvector, a boolean or an array of bytes indexed by bitvectors.
+        struct Sort {
+          enum kind_e { BITVEC, BOOL, ARRAY } kind;
+          triton::uint32 size;
+        };
+
+        //! A function with parameters, built again from its body at each application.
+        struct Function {
+          std::vector<std::string> params;
+          std::vector<Sort> sorts;
+          Sort sort;
+          std::vector<SmtToken> body;
+        };
+
+        //! A term being built.
+        struct Frame;
+
+        //! The AST context.
+        SharedAstContext ctxt;
+
+        //! The callback of declared constants.
+        VariableCallback newVariable;
+
+        //! The declared and defined constants.
+        std::unordered_map<std::string, SharedAbstractNode> globals;
+
+        //! The functions with parameters.
+        std::unordered_map<std::string, Function> functions;
+
+        //! The scopes of `let` and function parameters, the innermost last.
+        std::vector<std::unordered_map<std::string, SharedAbstractNode>> scopes;
+
+        //! The symbolic variables of the declared constants.
+        std::map<std::string, triton::engines::symbolic::SharedSymbolicVariable> variables;
+
+        //! The next id tried for a new variable.
+        triton::usize nextId;
+
+        //! Returns a variable of `size` bits named or aliased `name`, when no callback is given.
+        triton::engines::symbolic::SharedSymbolicVariable defaultVariable(const std::string& name, triton::uint32 size);
+
+        //! Binds `name` to a new constant of `sort`.
+        void declare(const std::string& name, const Sort& sort);
+
+        //! Reads a sort.
+        Sort sort(SmtLexer& lexer);
+
+        //! Reads a term.
+        SharedAbstractNode term(SmtLexer& lexer);
+
+        //! Returns the node of a symbol or a literal.
+        SharedAbstractNode atom(const std::string& text);
+
+        //! Returns the node of an application.
+        SharedAbstractNode apply(Frame& frame);
+
+        //! Returns the node of the application of a function with parameters.
+        SharedAbstractNode expand(const std::string& name, const Function& function, std::vector<SharedAbstractNode>& args);
+
+      public:
+        //! Constructor. Without callback, a declared constant gets the variable of the same name in `ctxt`, or a new one aliased by its name.
+        TRITON_EXPORT AstSmtParser(const SharedAstContext& ctxt, const VariableCallback& newVariable=nullptr);
+
+        //! Reads a script and returns its assertions.
+        TRITON_EXPORT std::vector<SharedAbstractNode> parse(std::istream& stream);
+
+        //! Reads a single term, with the names declared by the scripts already read.
+        TRITON_EXPORT SharedAbstractNode parseTerm(const std::string& term);
+
+        //! Returns the symbolic variables of the declared constants, by name.
+        TRITON_EXPORT const std::map<std::string, triton::engines::symbolic::SharedSymbolicVariable>& getVariables(void) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_AST_SMT_PARSER_H */
@@ -0,0 +1,167 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_AST_SSA_H
+#define TRITON_AST_SSA_H
+
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/symbolicEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+      class SymbolicExpression;
+      class SymbolicVariable;
+      using SharedSymbolicExpression = std::shared_ptr<triton::engines::symbolic::SymbolicExpression>;
+      using SharedSymbolicVariable = std::shared_ptr<triton::engines::symbolic::SymbolicVariable>;
+    };
+  };
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \class SsaTrace
+     *  \brief The symbolic expressions of a trace as a flat SSA program.
+     *
+     *  \details Each node of the DAG, references unrolled, is given one value number and one operation, in
+     *  topological order, so a shared subexpression is defined once and the operands of an operation are
+     *  always lower value numbers. A reference shares the value of the expression it refers to. Each
+     *  expression of the trace is a definition binding its id and its origin to the value of its AST.
+     *  The trace holds no node: the constants, strings and variables are kept aside and indexed by the
+     *  immediate of their operation, so it may outlive the AST. Arrays cannot be converted.
+     */
+    class SsaTrace {
+      public:
+        //! An operation, defining the value of its index.
+        struct Operation {
+          //! The type of the node.
+          triton::ast::ast_e type;
+
+          //! The size of the node in bits.
+          triton::uint32 size;
+
+          //! The position of the operands in `getOperands()`.
+          triton::uint32 first;
+
+          //! The number of operands.
+          triton::uint32 count;
+
+          //! The index of the constant of BV_NODE and INTEGER_NODE, of the string of STRING_NODE or of the variable of VARIABLE_NODE.
+          triton::uint32 imm;
+        };
+
+        //! A symbolic expression of the trace.
+        struct Definition {
+          //! The id of the expression.
+          triton::usize id;
+
+          //! The value of its AST.
+          triton::uint32 value;
+
+          //! The kind of its origin.
+          triton::engines::symbolic::expression_e type;
+
+          //! The register id of a REGISTER_EXPRESSION or the address of a MEMORY_EXPRESSION, 0 otherwise.
+          triton::uint64 origin;
+
+          //! The address of the instruction of the expression.
+          triton::uint64 address;
+        };
+
+      private:
+        //! The operations, indexed by value number.
+        std::vector<Operation> operations;
+
+        //! The operands of the operations.
+        std::vector<triton::uint32> operands;
+
+        //! The constants.
+        std::vector<triton::uint512> constants;
+
+        //! The strings.
+        std::vector<std::string> strings;
+
+        //! The symbolic variables.
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+
+        //! The definitions, in the order of the trace.
+        std::vector<Definition> definitions;
+
+        //! The positions of the definitions <expression id : position>.
+        std::unordered_map<triton::usize, triton::usize> index;
+
+        //! Appends the operations of the nodes of `roots` not converted yet. `values` maps the nodes converted to their values.
+        void convert(const std::vector<AbstractNode*>& roots, std::unordered_map<const AbstractNode*, triton::uint32>& values);
+
+      public:
+        //! Constructor. Converts the expressions of a trace, in order.
+        TRITON_EXPORT SsaTrace(const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs);
+
+        //! Constructor. Converts nodes, without definitions.
+        TRITON_EXPORT SsaTrace(const std::vector<SharedAbstractNode>& nodes);
+
+        //! Returns the operations, indexed by value number.
+        TRITON_EXPORT const std::vector<Operation>& getOperations(void) const;
+
+        //! Returns the operands of all the operations. Those of `op` are from `op.first` to `op.first + op.count`.
+        TRITON_EXPORT const std::vector<triton::uint32>& getOperands(void) const;
+
+        //! Returns the definitions, in the order of the trace.
+        TRITON_EXPORT const std::vector<Definition>& getDefinitions(void) const;
+
+        //! Returns the constant of a BV_NODE or INTEGER_NODE value.
+        TRITON_EXPORT const triton::uint512& getConstant(triton::uint32 value) const;
+
+        //! Returns the symbolic variable of a VARIABLE_NODE value.
+        TRITON_EXPORT const triton::engines::symbolic::SharedSymbolicVariable& getVariable(triton::uint32 value) const;
+
+        //! Returns the value of the expression `id` of the trace.
+        TRITON_EXPORT triton::uint32 getValue(triton::usize id) const;
+
+        //! Returns the values `value` depends on, itself included, in increasing order.
+        TRITON_EXPORT std::vector<triton::uint32> getSlice(triton::uint32 value) const;
+
+        //! Builds back the AST of `value` into `ctxt`.
+        TRITON_EXPORT SharedAbstractNode getAst(const SharedAstContext& ctxt, triton::uint32 value) const;
+
+        //! Returns the number of bytes held by the trace.
+        TRITON_EXPORT triton::usize getMemoryUsage(void) const;
+    };
+
+    //! Displays the operations of a trace, one per line, and its definitions.
+    TRITON_EXPORT std::ostream& operator<<(std::ostream& stream, const SsaTrace& trace);
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_AST_SSA_H */
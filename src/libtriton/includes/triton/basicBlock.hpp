@@ -46,18 +46,30 @@ namespace triton {
         //! Constructor.
         TRITON_EXPORT BasicBlock(const std::vector<triton::arch::Instruction>& instructions);
 
+        //! Constructor taking the instructions without copying them.
+        TRITON_EXPORT BasicBlock(std::vector<triton::arch::Instruction>&& instructions);
+
         //! Constructor by copy.
         TRITON_EXPORT BasicBlock(const BasicBlock& other);
 
+        //! Constructor by move.
+        TRITON_EXPORT BasicBlock(BasicBlock&& other) noexcept;
+
         //! Copies an BasicBlock.
         TRITON_EXPORT BasicBlock& operator=(const BasicBlock& other);
 
+        //! Moves an BasicBlock.
+        TRITON_EXPORT BasicBlock& operator=(BasicBlock&& other) noexcept;
+
         //! Destructor.
         TRITON_EXPORT ~BasicBlock();
 
         //! Add an instruction to the block
         TRITON_EXPORT void add(const Instruction& instruction);
 
+        //! Add an instruction to the block without copying it
+        TRITON_EXPORT void add(Instruction&& instruction);
+
         //! Remove an instruction from the block at the given position. Returns true if success.
         TRITON_EXPORT bool remove(triton::uint32 position);
 
@@ -0,0 +1,150 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_BINARYLOADER_HPP
+#define TRITON_BINARYLOADER_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Loaders namespace
+  namespace loaders {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup loaders
+   *  @{
+   */
+
+    /*! \class MappedFile
+     *  \brief A file mapped read-only in memory.
+     *
+     *  \details The mapping is private, the file content is only read from the disk when it is
+     *  accessed and is never copied by the loader. The mapping is released by the destructor.
+     */
+    class MappedFile {
+      private:
+        //! The mapped bytes.
+        const triton::uint8* data;
+
+        //! The size of the file.
+        triton::usize size;
+
+        #if defined(_WIN32)
+        //! The file mapping handle.
+        void* mapping;
+        #endif
+
+      public:
+        //! Constructor. Maps the file at `path`.
+        TRITON_EXPORT MappedFile(const std::string& path);
+
+        //! Destructor.
+        TRITON_EXPORT ~MappedFile();
+
+        MappedFile(const MappedFile& other) = delete;
+        MappedFile& operator=(const MappedFile& other) = delete;
+
+        //! Returns the mapped bytes.
+        TRITON_EXPORT const triton::uint8* getData(void) const;
+
+        //! Returns the size of the file.
+        TRITON_EXPORT triton::usize getSize(void) const;
+    };
+
+
+    //! The file formats supported by the loader.
+    enum format_e {
+      FORMAT_INVALID = 0, //!< invalid format
+      FORMAT_ELF,         //!< ELF executables, libraries and core dumps
+      FORMAT_PE,          //!< PE executables and libraries
+      FORMAT_MACHO,       //!< Mach-O executables and libraries
+      FORMAT_MINIDUMP,    //!< Windows minidumps
+    };
+
+
+    //! A segment of a file which is loaded in memory.
+    struct Segment {
+      //! The virtual address of the segment.
+      triton::uint64 address;
+
+      //! The size of the segment in memory.
+      triton::uint64 size;
+
+      //! The offset of the segment content in the file.
+      triton::uint64 offset;
+
+      //! The size of the segment content in the file. The remaining bytes of the segment are zeros.
+      triton::uint64 fileSize;
+    };
+
+
+    /*! \class BinaryLoader
+     *  \brief Parses the segments of an executable, a library or a memory dump.
+     *
+     *  \details ELF (32/64-bit, little and big endian, including core dumps), PE, Mach-O (32/64-bit,
+     *  little endian, fat binaries excepted) and Windows minidumps are supported. Only the layout of
+     *  the segments is parsed; relocations, imports and symbols are ignored.
+     */
+    class BinaryLoader {
+      private:
+        //! The mapped file.
+        std::shared_ptr<MappedFile> file;
+
+        //! The format of the file.
+        triton::loaders::format_e format;
+
+        //! The segments of the file.
+        std::vector<triton::loaders::Segment> segments;
+
+        //! Parses an ELF file.
+        void parseElf(void);
+
+        //! Parses a PE file.
+        void parsePe(void);
+
+        //! Parses a Mach-O file.
+        void parseMacho(void);
+
+        //! Parses a minidump file.
+        void parseMinidump(void);
+
+        //! Adds a segment. Checks that its content is inside the file.
+        void addSegment(triton::uint64 address, triton::uint64 size, triton::uint64 offset, triton::uint64 fileSize);
+
+      public:
+        //! Constructor. Maps and parses the file at `path`.
+        TRITON_EXPORT BinaryLoader(const std::string& path);
+
+        //! Returns the format of the file.
+        TRITON_EXPORT triton::loaders::format_e getFormat(void) const;
+
+        //! Returns the segments of the file.
+        TRITON_EXPORT const std::vector<triton::loaders::Segment>& getSegments(void) const;
+
+        //! Returns the mapped file.
+        TRITON_EXPORT const std::shared_ptr<MappedFile>& getFile(void) const;
+    };
+
+  /*! @} End of loaders namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_BINARYLOADER_HPP */
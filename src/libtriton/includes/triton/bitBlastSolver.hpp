@@ -0,0 +1,175 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_BITBLASTSOLVER_HPP
+#define TRITON_BITBLASTSOLVER_HPP
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/satSolver.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverInterface.hpp>
+#include <triton/solverInterrupt.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! The bits of a bitvector, least significant first, as literals of a `SatSolver`.
+      using Bits = std::vector<triton::sint32>;
+
+      /*! \class BitBlaster
+       *  \brief Translates the quantifier-free bitvector ASTs into the clauses of a `SatSolver`.
+       *
+       *  \details Each node is translated once, the shared subterms and the references included, and the gates
+       *  are hashed so that a same gate of the same inputs is a same literal. The nodes which are not symbolized
+       *  are constants. The arrays, the quantifiers and the `let` are not supported.
+       */
+      class BitBlaster {
+        private:
+          //! The solver receiving the clauses.
+          triton::engines::solver::SatSolver& sat;
+
+          //! The literal always true.
+          triton::sint32 one;
+
+          //! The bits of the translated nodes.
+          std::unordered_map<const triton::ast::AbstractNode*, Bits> cache;
+
+          //! The hashed gates by kind and inputs.
+          std::unordered_map<triton::uint64, triton::sint32> ands;
+          std::unordered_map<triton::uint64, triton::sint32> xors;
+
+          //! The variables met, by id, and their bits.
+          std::map<triton::usize, std::pair<triton::engines::symbolic::SharedSymbolicVariable, Bits>> variables;
+
+          //! Gates.
+          triton::sint32 land(triton::sint32 a, triton::sint32 b);
+          triton::sint32 lor(triton::sint32 a, triton::sint32 b);
+          triton::sint32 lxor(triton::sint32 a, triton::sint32 b);
+          triton::sint32 ite(triton::sint32 c, triton::sint32 t, triton::sint32 e);
+
+          //! Bitvector operations.
+          Bits constant(const triton::uint512& value, triton::uint32 size) const;
+          Bits bitwise(const Bits& a, const Bits& b, triton::sint32 (BitBlaster::*gate)(triton::sint32, triton::sint32));
+          Bits ite(triton::sint32 c, const Bits& t, const Bits& e);
+          Bits add(const Bits& a, const Bits& b, triton::sint32 carry);
+          Bits neg(const Bits& a);
+          Bits mul(const Bits& a, const Bits& b);
+          std::pair<Bits, Bits> udivrem(const Bits& a, const Bits& b);
+          Bits abs(const Bits& a);
+          Bits shift(const Bits& a, const Bits& b, bool left, triton::sint32 fill);
+          triton::sint32 eq(const Bits& a, const Bits& b);
+          triton::sint32 ult(const Bits& a, const Bits& b);
+          triton::sint32 slt(const Bits& a, const Bits& b);
+
+          //! Translates a node whose children are translated.
+          Bits translate(triton::ast::AbstractNode* node);
+
+          //! Returns the bits of a translated node.
+          const Bits& get(const triton::ast::SharedAbstractNode& node) const;
+
+        public:
+          //! Constructor. The clauses are added to `sat`.
+          TRITON_EXPORT BitBlaster(triton::engines::solver::SatSolver& sat);
+
+          //! Translates a logical node. Returns its literal.
+          TRITON_EXPORT triton::sint32 blast(const triton::ast::SharedAbstractNode& node);
+
+          //! Returns the variables met, by id, and their bits.
+          TRITON_EXPORT const std::map<triton::usize, std::pair<triton::engines::symbolic::SharedSymbolicVariable, Bits>>& getVariables(void) const;
+
+          //! Returns true if `node` is a logical node of at most `maxNodes` nodes, the references unrolled, which can be translated. The multiplications and divisions must be of 64 bits at most.
+          TRITON_EXPORT static bool isSupported(const triton::ast::SharedAbstractNode& node, triton::usize maxNodes);
+      };
+
+      /*! \class BitBlastSolver
+       *  \brief Solver engine bit-blasting the queries to an embedded SAT solver.
+       *
+       *  \details Each query is translated by a `BitBlaster` into the clauses of a `SatSolver`, without
+       *  the cost of an external solver. It is meant for the small queries, see `BitBlaster::isSupported()`,
+       *  the large arithmetic being better handled by the word-level solvers. The memory limit is ignored.
+       */
+      class BitBlastSolver : public SolverInterface {
+        private:
+          //! The default timeout (in milliseconds).
+          triton::uint32 timeout;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT BitBlastSolver();
+
+          //! Computes and returns a model from a symbolic constraint. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes and returns several models from a symbolic constraint. The search stops with an unknown status once `interrupt` is interrupted, from another thread.
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime, triton::engines::solver::SolverInterrupt* interrupt) const;
+
+          //! Returns true if an expression is satisfiable.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns the name of this solver.
+          TRITON_EXPORT std::string getName(void) const;
+
+          //! Defines a solver timeout (in milliseconds).
+          TRITON_EXPORT void setTimeout(triton::uint32 ms);
+
+          //! Defines a solver memory consumption limit (in megabytes). Ignored.
+          TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_BITBLASTSOLVER_HPP */
@@ -49,10 +49,10 @@ namespace triton {
         TRITON_EXPORT BitsVector(triton::uint32 high, triton::uint32 low);
 
         //! Constructor by copy.
-        TRITON_EXPORT BitsVector(const triton::arch::BitsVector& other);
+        BitsVector(const triton::arch::BitsVector& other) = default;
 
         //! Copy a BitsVector.
-        TRITON_EXPORT BitsVector& operator=(const BitsVector& other);
+        BitsVector& operator=(const BitsVector& other) = default;
 
         //! Returns the highest bit
         TRITON_EXPORT triton::uint32 getHigh(void) const;
@@ -9,6 +9,7 @@
 #define TRITON_BITWUZLASOLVER_H
 
 #include <chrono>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -21,8 +22,11 @@ extern "C" {
 #include <triton/dllexport.hpp>
 #include <triton/solverEnums.hpp>
 #include <triton/solverInterface.hpp>
+#include <triton/solverInterrupt.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/solverSession.hpp>
 #include <triton/symbolicExpression.hpp>
+#include <triton/tritonToBitwuzla.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -51,6 +55,8 @@ namespace triton {
       //! \class BitwuzlaSolver
       /*! \brief Solver engine using Bitwuzla. */
       class BitwuzlaSolver : public SolverInterface {
+        friend class BitwuzlaSession;
+
         private:
           //! Converts binary bitvector value from string to uint512.
           triton::uint512 fromBvalueToUint512(const char* value) const;
@@ -65,6 +71,7 @@ namespace triton {
             int64_t timeout;                                                                                /*!< Timeout (ms) for solver instance running. */
             size_t  memory_limit;                                                                           /*!< Memory limit for the whole symbolic process. */
             int64_t last_mem_check = -1;                                                                    /*!< Time when the last memory usage check was performed. */
+            const SolverInterrupt* interrupt = nullptr;                                                     /*!< Interrupts the solving from another thread. */
           };
 
           //! The SMT solver timeout. By default, unlimited. This global timeout may be changed for a specific query (isSat/getModel/getModels) via argument `timeout`.
@@ -73,10 +80,34 @@ namespace triton {
           //! The SMT solver memory limit. By default, unlimited.
           triton::uint32 memoryLimit;
 
+          //! The configurations of the classes of queries.
+          triton::engines::solver::QueryConfigurations queries;
+
+          //! The term manager shared by the queries, so that a query does not create its own.
+          mutable BitwuzlaTermManager* termMgr;
+
+          //! The number of queries since the terms of the shared manager were released.
+          mutable triton::usize termMgrQueries;
+
+          //! Protects the shared term manager. A concurrent query uses its own manager.
+          mutable std::mutex termMgrLock;
+
+          //! Returns the shared term manager if `guard` owns its lock, a new one otherwise.
+          BitwuzlaTermManager* acquireTermManager(const std::unique_lock<std::mutex>& guard) const;
+
+          //! Gives back a term manager of `acquireTermManager()`. The terms of the shared one are released every `termMgrRelease` queries.
+          void releaseTermManager(BitwuzlaTermManager* tm, const std::unique_lock<std::mutex>& guard) const;
+
         public:
           //! Constructor.
           TRITON_EXPORT BitwuzlaSolver();
 
+          //! Destructor.
+          TRITON_EXPORT ~BitwuzlaSolver();
+
+          BitwuzlaSolver(const BitwuzlaSolver& other) = delete;
+          BitwuzlaSolver& operator=(const BitwuzlaSolver& other) = delete;
+
           //! Computes and returns a model from a symbolic constraint.
           /*! \brief map of symbolic variable id -> model
            *
@@ -95,9 +126,18 @@ namespace triton {
            */
           TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+          //! Computes and returns several models from a symbolic constraint. The search stops with an unknown status once `interrupt` is interrupted, from another thread.
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime, triton::engines::solver::SolverInterrupt* interrupt) const;
+
+          //! Enumerates the models of a symbolic constraint, distinct on the `projection` variables, and streams them to `callback`. The models are blocked in one Bitwuzla instance.
+          TRITON_EXPORT triton::usize enumerateModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, const ModelCallback& callback, triton::uint32 limit = 0, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+          //! Returns the sorted positions in `nodes` of constraints whose conjunction is unsatisfiable, extracted by `bitwuzla_get_unsat_core()`.
+          TRITON_EXPORT std::vector<triton::usize> getUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 timeout = 0) const;
+
           //! Evaluates a Triton's AST via Bitwuzla and returns a concrete value.
           TRITON_EXPORT triton::uint512 evaluate(const triton::ast::SharedAbstractNode& node) const;
 
@@ -110,6 +150,12 @@ namespace triton {
           //! Defines a solver memory consumption limit (in megabytes).
           TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
 
+          //! Sets the configurations of the classes of queries: the SAT solver and the rewrite level.
+          TRITON_EXPORT void setQueryConfigurations(const triton::engines::solver::QueryConfigurations& configurations);
+
+          //! Returns a new incremental solving session keeping a live Bitwuzla instance, owned by the caller.
+          TRITON_EXPORT SolverSession* newSession(void) const;
+
           //! Callback function that implements termination of Bitwuzla solver on timeout and memory limit.
           static int32_t terminateCallback(void* state);
 
@@ -117,6 +163,43 @@ namespace triton {
           static void abortCallback(const char* msg);
       };
 
+      //! \class BitwuzlaSession
+      /*! \brief Incremental solving session using a live Bitwuzla instance, with one push/pop scope per constraint and the query as an assumption. */
+      class BitwuzlaSession : public SolverSession {
+        private:
+          //! The solver of the session, which gives the timeout and the memory limit.
+          const BitwuzlaSolver* parent;
+
+          //! The options of the instance.
+          BitwuzlaOptions* bzlaOptions;
+
+          //! The term manager of the instance.
+          BitwuzlaTermManager* bzlaTermMgr;
+
+          //! The live Bitwuzla instance.
+          Bitwuzla* bzla;
+
+          //! The converter of the constraints, which keeps their terms and the variables of the models.
+          triton::ast::TritonToBitwuzla bzlaAst;
+
+        protected:
+          //! Asserts a constraint in a new scope.
+          void push(const triton::ast::SharedAbstractNode& node);
+
+          //! Removes the scope of the last constraint.
+          void pop(void);
+
+          //! Checks `node` on top of the asserted constraints, and returns a model if `model` is true and it is satisfiable.
+          std::unordered_map<triton::usize, SolverModel> check(const triton::ast::SharedAbstractNode& node, bool model, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT BitwuzlaSession(const BitwuzlaSolver* parent);
+
+          //! Destructor.
+          TRITON_EXPORT ~BitwuzlaSession();
+      };
+
     /*! @} End of solver namespace */
     };
   /*! @} End of engines namespace */
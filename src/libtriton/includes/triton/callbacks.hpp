@@ -10,10 +10,14 @@
 
 #include <atomic>
 #include <list>
+#include <map>
+#include <unordered_set>
+#include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/callbacksEnums.hpp>
 #include <triton/comparableFunctor.hpp>
+#include <triton/concreteMemory.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/register.hpp>
@@ -45,6 +49,15 @@ namespace triton {
      */
     using getConcreteMemoryValueCallback = ComparableFunctor<void(triton::Context&, const triton::arch::MemoryAccess&)>;
 
+    /*! \brief The prototype of a GET_CONCRETE_MEMORY_PAGE callback.
+     *
+     * \details The callback takes a Context as first argument and the base address of a page as second argument.
+     * Callbacks will be called once, the first time that the Triton library will touch a page of memory which has no defined
+     * concrete value. The callback returns the content of the page (at most `triton::arch::ConcreteMemory::pageSize` bytes
+     * from the base address) or an empty vector if it does not provide the page.
+     */
+    using getConcreteMemoryPageCallback = ComparableFunctor<std::vector<triton::uint8>(triton::Context&, triton::uint64 addr)>;
+
     /*! \brief The prototype of a GET_CONCRETE_REGISTER_VALUE callback.
      *
      * \details The callback takes an Context context as first argument and a register as second argument.
@@ -74,6 +87,114 @@ namespace triton {
      */
     using symbolicSimplificationCallback = ComparableFunctor<triton::ast::SharedAbstractNode(triton::Context&, const triton::ast::SharedAbstractNode&)>;
 
+    /*! \brief The C prototype of a native GET_CONCRETE_MEMORY_VALUE callback.
+     *
+     * \details The callback takes its user data, the address and the size of the access, and a buffer of this size.
+     * It returns non-zero if it wrote the little-endian value of the access into the buffer, which is then defined
+     * as the concrete value of the memory.
+     */
+    typedef int (*nativeGetConcreteMemoryValueCallback)(void* user, triton::uint64 addr, triton::uint8* value, triton::uint32 size);
+
+    /*! \brief The C prototype of a native GET_CONCRETE_MEMORY_PAGE callback.
+     *
+     * \details The callback takes its user data, the base address of a page and a buffer of `size` bytes. It returns
+     * the number of bytes of the page it wrote into the buffer, 0 if it does not provide the page.
+     */
+    typedef triton::uint32 (*nativeGetConcreteMemoryPageCallback)(void* user, triton::uint64 addr, triton::uint8* page, triton::uint32 size);
+
+    /*! \brief The C prototype of a native GET_CONCRETE_REGISTER_VALUE callback.
+     *
+     * \details The callback takes its user data, the id of the register, and a buffer of the size of the register.
+     * It returns non-zero if it wrote the little-endian value of the register into the buffer, which is then defined
+     * as the concrete value of the register.
+     */
+    typedef int (*nativeGetConcreteRegisterValueCallback)(void* user, triton::uint32 id, triton::uint8* value, triton::uint32 size);
+
+    /*! \brief The C prototype of a native SET_CONCRETE_MEMORY_VALUE callback.
+     *
+     * \details The callback takes its user data, the address and the size of the access, and its little-endian value.
+     */
+    typedef void (*nativeSetConcreteMemoryValueCallback)(void* user, triton::uint64 addr, const triton::uint8* value, triton::uint32 size);
+
+    /*! \brief The C prototype of a native SET_CONCRETE_REGISTER_VALUE callback.
+     *
+     * \details The callback takes its user data, the id of the register, and its little-endian value of the size of the register.
+     */
+    typedef void (*nativeSetConcreteRegisterValueCallback)(void* user, triton::uint32 id, const triton::uint8* value, triton::uint32 size);
+
+    /*! \brief Returns the callback of a C function pointer of the prototype of `kind`, and of its user data.
+     *
+     * \details The native callbacks are called without the context, so they can come from a shared library or a
+     * foreign function interface such as ctypes and run without the Python interpreter. Two callbacks are the same
+     * if they have the same function, which is how they are removed. SYMBOLIC_SIMPLIFICATION has no native prototype.
+     */
+    TRITON_EXPORT getConcreteMemoryValueCallback nativeCallback(nativeGetConcreteMemoryValueCallback function, void* user=nullptr);
+
+    //! Returns the callback of a native GET_CONCRETE_MEMORY_PAGE function pointer.
+    TRITON_EXPORT getConcreteMemoryPageCallback nativeCallback(nativeGetConcreteMemoryPageCallback function, void* user=nullptr);
+
+    //! Returns the callback of a native GET_CONCRETE_REGISTER_VALUE function pointer.
+    TRITON_EXPORT getConcreteRegisterValueCallback nativeCallback(nativeGetConcreteRegisterValueCallback function, void* user=nullptr);
+
+    //! Returns the callback of a native SET_CONCRETE_MEMORY_VALUE function pointer.
+    TRITON_EXPORT setConcreteMemoryValueCallback nativeCallback(nativeSetConcreteMemoryValueCallback function, void* user=nullptr);
+
+    //! Returns the callback of a native SET_CONCRETE_REGISTER_VALUE function pointer.
+    TRITON_EXPORT setConcreteRegisterValueCallback nativeCallback(nativeSetConcreteRegisterValueCallback function, void* user=nullptr);
+
+    /*! \class CallbackFilter
+     *  \brief The memory ranges and registers watched by a callback, see `filteredCallback()`.
+     *
+     *  \details The ranges are merged as they are added, so that an access is looked up in a logarithmic
+     *  time whatever the number of ranges. A register is watched along with its sub-registers.
+     */
+    class CallbackFilter {
+      private:
+        //! The watched ranges <first address : last address>, disjoint and not adjacent.
+        std::map<triton::uint64, triton::uint64> ranges;
+
+        //! The ids of the watched registers.
+        std::unordered_set<triton::uint32> registers;
+
+      public:
+        //! Watches the memory from `addr` to `addr + size`.
+        TRITON_EXPORT void addRange(triton::uint64 addr, triton::usize size);
+
+        //! Watches a register and its sub-registers.
+        TRITON_EXPORT void addRegister(const triton::arch::Register& reg);
+
+        //! Returns true if a byte from `addr` to `addr + size` is watched.
+        TRITON_EXPORT bool isWatched(triton::uint64 addr, triton::usize size) const;
+
+        //! Returns true if the register, whose parent is `parent`, is watched.
+        TRITON_EXPORT bool isWatched(const triton::arch::Register& reg, const triton::arch::Register& parent) const;
+
+        //! Returns the number of disjoint ranges watched.
+        TRITON_EXPORT triton::usize getNumberOfRanges(void) const;
+
+        //! Returns the number of registers watched.
+        TRITON_EXPORT triton::usize getNumberOfRegisters(void) const;
+    };
+
+    /*! \brief Returns a callback only calling `cb` for the accesses watched by `filter`.
+     *
+     * \details The filter is checked before `cb` is called, so that a callback of the bindings does not take
+     * the interpreter for the other accesses. The callback is the same as `cb` for its removal.
+     */
+    TRITON_EXPORT getConcreteMemoryValueCallback filteredCallback(const getConcreteMemoryValueCallback& cb, const CallbackFilter& filter);
+
+    //! Returns a GET_CONCRETE_MEMORY_PAGE callback only calling `cb` for the pages of the ranges watched by `filter`.
+    TRITON_EXPORT getConcreteMemoryPageCallback filteredCallback(const getConcreteMemoryPageCallback& cb, const CallbackFilter& filter);
+
+    //! Returns a GET_CONCRETE_REGISTER_VALUE callback only calling `cb` for the registers watched by `filter`.
+    TRITON_EXPORT getConcreteRegisterValueCallback filteredCallback(const getConcreteRegisterValueCallback& cb, const CallbackFilter& filter);
+
+    //! Returns a SET_CONCRETE_MEMORY_VALUE callback only calling `cb` for the accesses watched by `filter`.
+    TRITON_EXPORT setConcreteMemoryValueCallback filteredCallback(const setConcreteMemoryValueCallback& cb, const CallbackFilter& filter);
+
+    //! Returns a SET_CONCRETE_REGISTER_VALUE callback only calling `cb` for the registers watched by `filter`.
+    TRITON_EXPORT setConcreteRegisterValueCallback filteredCallback(const setConcreteRegisterValueCallback& cb, const CallbackFilter& filter);
+
     //! \class Callbacks
     /*! \brief The callbacks class */
     class Callbacks {
@@ -87,6 +208,9 @@ namespace triton {
         //! Mutex for the getConcreteMemoryValue callback
         std::atomic<bool> mload;
 
+        //! Mutex for the getConcreteMemoryPage callback
+        std::atomic<bool> mpage;
+
         //! Mutex for the setConcreteRegisterValue callback
         std::atomic<bool> mput;
 
@@ -96,10 +220,16 @@ namespace triton {
         //! True if there is at least one callback defined.
         std::atomic<bool> defined;
 
+        //! Changes each time a SYMBOLIC_SIMPLIFICATION callback is added or removed.
+        triton::usize simplificationVersion;
+
       protected:
         //! [c++] Callbacks for all concrete memory needs (LOAD).
         std::list<triton::callbacks::getConcreteMemoryValueCallback> getConcreteMemoryValueCallbacks;
 
+        //! [c++] Callbacks for all concrete memory pages needs (page faults).
+        std::list<triton::callbacks::getConcreteMemoryPageCallback> getConcreteMemoryPageCallbacks;
+
         //! [c++] Callbacks for all concrete register needs (GET).
         std::list<triton::callbacks::getConcreteRegisterValueCallback> getConcreteRegisterValueCallbacks;
 
@@ -125,6 +255,9 @@ namespace triton {
         //! Adds a GET_CONCRETE_MEMORY_VALUE callback.
         TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::MemoryAccess&)> cb);
 
+        //! Adds a GET_CONCRETE_MEMORY_PAGE callback.
+        TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<std::vector<triton::uint8>(triton::Context&, triton::uint64 addr)> cb);
+
         //! Adds a GET_CONCRETE_REGISTER_VALUE callback.
         TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::Register&)> cb);
 
@@ -143,6 +276,9 @@ namespace triton {
         //! Deletes a GET_CONCRETE_MEMORY_VALUE callback.
         TRITON_EXPORT void removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::MemoryAccess&)> cb);
 
+        //! Deletes a GET_CONCRETE_MEMORY_PAGE callback.
+        TRITON_EXPORT void removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<std::vector<triton::uint8>(triton::Context&, triton::uint64 addr)> cb);
+
         //! Deletes a GET_CONCRETE_REGISTER_VALUE callback.
         TRITON_EXPORT void removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::Context&, const triton::arch::Register&)> cb);
 
@@ -164,6 +300,15 @@ namespace triton {
         //! Processes callbacks according to the kind and the C++ polymorphism.
         TRITON_EXPORT void processCallbacks(triton::callbacks::callback_e kind, const triton::arch::MemoryAccess& mem, const triton::uint512& value);
 
+        //! Processes GET_CONCRETE_MEMORY_PAGE callbacks for the pages of `memory` from `baseAddr` to `baseAddr + size` which have never been touched.
+        TRITON_EXPORT void processCallbacks(triton::callbacks::callback_e kind, const triton::arch::ConcreteMemory& memory, triton::uint64 baseAddr, triton::usize size);
+
+        //! Processes GET_CONCRETE_MEMORY_VALUE callbacks for a memory area, once per memory access of at most 64 bytes.
+        TRITON_EXPORT void processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size);
+
+        //! Processes SET_CONCRETE_MEMORY_VALUE callbacks for a memory area, once per memory access of at most 64 bytes.
+        TRITON_EXPORT void processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, const triton::uint8* area, triton::usize size);
+
         //! Processes callbacks according to the kind and the C++ polymorphism.
         TRITON_EXPORT void processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg);
 
@@ -175,6 +320,9 @@ namespace triton {
 
         //! Returns true if at least one callback is defined.
         TRITON_EXPORT bool isDefined(void) const;
+
+        //! Returns a number which changes each time a SYMBOLIC_SIMPLIFICATION callback is added or removed.
+        TRITON_EXPORT triton::usize getSymbolicSimplificationVersion(void) const;
     };
 
   /*! @} End of callbacks namespace */
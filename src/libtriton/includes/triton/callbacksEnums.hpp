@@ -28,6 +28,7 @@ namespace triton {
     /*! Enumerates all kinds callbacks. */
     enum callback_e {
       GET_CONCRETE_MEMORY_VALUE,    /*!< LOAD concrete memory value callback */
+      GET_CONCRETE_MEMORY_PAGE,     /*!< LOAD concrete memory page callback (page fault) */
       GET_CONCRETE_REGISTER_VALUE,  /*!< GET concrete register value callback */
       SET_CONCRETE_MEMORY_VALUE,    /*!< STORE concrete memory value callback */
       SET_CONCRETE_REGISTER_VALUE,  /*!< PUT concrete register value callback */
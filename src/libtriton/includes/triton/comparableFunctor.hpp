@@ -64,6 +64,11 @@ namespace triton {
         return F_(api, param1, param2);
       }
 
+      //! Returns the id use for functor comparison
+      void* getId(void) const {
+        return this->ID_;
+      }
+
       //! Comparison of functor based on id
       template <class T>
       bool operator==(const ComparableFunctor<T>& O) const {
@@ -0,0 +1,197 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_CONCRETEMEMO_H
+#define TRITON_CONCRETEMEMO_H
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/architecture.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/memoryAccess.hpp>
+#include <triton/modes.hpp>
+#include <triton/register.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/taintEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The statistics of the concrete memo, see `ConcreteMemo`.
+    struct ConcreteMemoStats {
+      //! The number of instructions replayed from the memo.
+      triton::uint64 hits = 0;
+
+      //! The number of instructions looked up and not found.
+      triton::uint64 misses = 0;
+
+      //! The number of executions recorded.
+      triton::uint64 records = 0;
+
+      //! The number of times the memo has been flushed because it was full.
+      triton::uint64 flushes = 0;
+
+      //! The number of executions in the memo.
+      triton::usize size = 0;
+
+      //! The maximum number of executions in the memo.
+      triton::usize capacity = 0;
+    };
+
+
+    /*! \class ConcreteMemo
+     *  \brief The memo of the concrete executions of the instructions.
+     *
+     *  \details When the semantics of a deterministic instruction are built over concrete inputs only, the values
+     *  of the registers and memory cells it reads, along with the values it writes, are recorded under its address
+     *  and opcode. The next time the instruction is met with the same input values, still concrete, the outputs are
+     *  written back without building any AST: the registers and memory cells written are concretized and untainted.
+     *  The registers of the effective addresses and the parents of the sub-registers written are inputs as well.
+     *  When `capacity` executions are recorded, the memo is flushed.
+     */
+    class ConcreteMemo {
+      private:
+        //! A recorded execution of an instruction.
+        struct Execution {
+          //! The registers read and their values.
+          std::vector<std::pair<triton::arch::Register, triton::uint512>> reads;
+
+          //! The registers of the operands and effective addresses, and their values.
+          std::vector<std::pair<triton::arch::Register, triton::uint512>> operands;
+
+          //! The memory cells read and their values.
+          std::vector<std::pair<triton::arch::MemoryAccess, triton::uint512>> loads;
+
+          //! The registers written and their values.
+          std::vector<std::pair<triton::arch::Register, triton::uint512>> outputs;
+
+          //! The memory cells written and their values.
+          std::vector<std::pair<triton::arch::MemoryAccess, triton::uint512>> stores;
+
+          //! The registers defined as undefined.
+          std::vector<triton::arch::Register> undefined;
+        };
+
+        //! The executions of an instruction.
+        struct Entry {
+          //! The opcode of the instruction.
+          triton::uint8 opcode[16];
+
+          //! The size of the instruction.
+          triton::uint32 size;
+
+          //! The code condition of the instruction.
+          triton::arch::arm::condition_e codeCondition;
+
+          //! True if the instruction is a Thumb instruction.
+          bool thumb;
+
+          //! The executions, the oldest one being replaced first.
+          std::vector<Execution> executions;
+
+          //! The next execution to replace.
+          triton::usize next;
+        };
+
+        //! Architecture API
+        triton::arch::Architecture* architecture;
+
+        //! Modes API
+        triton::modes::SharedModes modes;
+
+        //! Symbolic engine API
+        triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+        //! Taint engine API
+        triton::engines::taint::TaintEngine* taintEngine;
+
+        //! True if the memo is enabled.
+        bool enabled;
+
+        //! The entries <address : Entry>
+        std::unordered_map<triton::uint64, Entry> entries;
+
+        //! The statistics.
+        ConcreteMemoStats stats;
+
+        //! The registers of the effective addresses and of the operands, and their values before the semantics.
+        std::vector<std::pair<triton::arch::Register, triton::uint512>> prepared;
+
+        //! The execution replayed by `replay()`, found by `lookup()`.
+        const Execution* found;
+
+        //! Returns the entry of the instruction if it has been recorded from the same opcode, nullptr otherwise.
+        Entry* getEntry(const triton::arch::Instruction& inst);
+
+        //! Returns true if the inputs of the execution have the same values and are neither symbolized nor tainted.
+        bool matches(const Execution& execution) const;
+
+        //! Returns the value of a register before the semantics if it has been prepared.
+        const triton::uint512* getPrepared(const triton::arch::Register& reg) const;
+
+      public:
+        //! The maximum number of executions kept per instruction.
+        static const triton::usize maxExecutions = 16;
+
+        //! Constructor. The memo is disabled.
+        TRITON_EXPORT ConcreteMemo(triton::arch::Architecture* architecture,
+                                   const triton::modes::SharedModes& modes,
+                                   triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                   triton::engines::taint::TaintEngine* taintEngine);
+
+        //! Enables or disables the memo, keeping at most `capacity` executions. Disabling clears it.
+        TRITON_EXPORT void enable(bool flag, triton::usize capacity);
+
+        //! Returns true if the memo is enabled.
+        TRITON_EXPORT bool isEnabled(void) const;
+
+        //! Returns true if the instruction is deterministic, and so its executions can be recorded.
+        TRITON_EXPORT bool isMemoizable(const triton::arch::Instruction& inst) const;
+
+        //! Keeps the values of the registers of the operands of the instruction, before its semantics are built.
+        TRITON_EXPORT void prepare(const triton::arch::Instruction& inst);
+
+        //! Returns true if an execution of the instruction has the current values as inputs, see `replay()`.
+        TRITON_EXPORT bool lookup(const triton::arch::Instruction& inst);
+
+        //! Writes the outputs of the execution found by `lookup()` and sets up the accesses of the instruction.
+        TRITON_EXPORT void replay(triton::arch::Instruction& inst);
+
+        //! Records the execution of the instruction whose semantics have just been built over concrete inputs.
+        TRITON_EXPORT void record(triton::arch::Instruction& inst);
+
+        //! Returns the statistics.
+        TRITON_EXPORT ConcreteMemoStats getStats(void) const;
+
+        //! Removes all executions and resets the statistics.
+        TRITON_EXPORT void clear(void);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_CONCRETEMEMO_H */
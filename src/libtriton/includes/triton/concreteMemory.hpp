@@ -0,0 +1,324 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_CONCRETEMEMORY_HPP
+#define TRITON_CONCRETEMEMORY_HPP
+
+#include <iterator>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <triton/copyOnWrite.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class ConcreteMemory
+     *  \brief This class is used to store the concrete memory state of a CPU.
+     *
+     *  \details The memory is split into pages of `ConcreteMemory::pageSize` bytes. Pages are
+     *  allocated on the first write and are indexed by their page number. Each page holds its
+     *  bytes and a bitmap which marks the bytes that have a defined concrete value. Reading an
+     *  undefined byte returns 0.
+     *
+     *  Read-only regions (e.g. segments of a memory-mapped file) are mapped with `map()`. Their
+     *  bytes are defined and read in place, without being copied. The first write into a page
+     *  covered by a region allocates the page and copies the bytes of the region into it. The
+     *  page then shadows the region.
+     *
+     *  Copying a ConcreteMemory shares its page directory, its pages and its regions. They are
+     *  copied the first time one of their owners modifies them (copy-on-write), so a copy costs O(1).
+     *  The pages come from the memory resource of the memory if one is set.
+     *
+     *  Once `trackChanges()` is called, the numbers of the pages written or cleared are recorded, so
+     *  `restoreChanges()` brings the memory back to a copy taken at that time in O(changed pages).
+     */
+    class ConcreteMemory {
+      public:
+        //! The size of a page in bytes.
+        static constexpr triton::usize pageSize = 0x1000;
+
+        //! The number of 64-bit words used by the bitmap of a page.
+        static constexpr triton::usize bitmapSize = pageSize / 64;
+
+        //! A page of memory.
+        struct Page {
+          //! The concrete values of the page. Undefined bytes are always 0.
+          triton::uint8 data[pageSize];
+
+          //! The bitmap of defined bytes.
+          triton::uint64 defined[bitmapSize];
+
+          //! The number of defined bytes in the page.
+          triton::usize count;
+
+          //! Constructor.
+          Page();
+        };
+
+        //! A read-only region of memory whose bytes are not owned by the memory.
+        struct Region {
+          //! The bytes of the region, nullptr if the region is filled with zeros.
+          const triton::uint8* data;
+
+          //! The size of the region in bytes.
+          triton::usize size;
+
+          //! Keeps the bytes of the region alive.
+          std::shared_ptr<const void> owner;
+        };
+
+        //! The page directory type (page number -> page).
+        using PageMap = std::unordered_map<triton::uint64, std::shared_ptr<Page>, IdentityHash<triton::uint64>>;
+
+        //! The region directory type (base address -> region).
+        using RegionMap = std::map<triton::uint64, Region>;
+
+        /*! \class const_iterator
+         *  \brief Iterates over all defined bytes as `std::pair<address, value>`. The order is unspecified.
+         */
+        class const_iterator {
+          private:
+            //! The iterated memory.
+            const ConcreteMemory* memory;
+
+            //! The current page.
+            PageMap::const_iterator page;
+
+            //! The offset of the current byte in the current page.
+            triton::usize offset;
+
+            //! The current region, once all pages have been visited.
+            RegionMap::const_iterator region;
+
+            //! The offset of the current byte in the current region.
+            triton::usize delta;
+
+            //! Moves to the next defined byte starting at the current position (included).
+            void seek(void);
+
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = std::pair<triton::uint64, triton::uint8>;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = void;
+            using reference         = value_type;
+
+            //! Constructor. Points to the first defined byte of `memory`, or past its last one if `end` is true.
+            TRITON_EXPORT const_iterator(const ConcreteMemory* memory, bool end);
+
+            //! Returns the current pair <address, value>.
+            TRITON_EXPORT value_type operator*(void) const;
+
+            //! Moves to the next defined byte.
+            TRITON_EXPORT const_iterator& operator++(void);
+
+            //! Moves to the next defined byte.
+            TRITON_EXPORT const_iterator operator++(int);
+
+            //! Returns true if both iterators point to the same byte.
+            TRITON_EXPORT bool operator==(const const_iterator& other) const;
+
+            //! Returns true if iterators point to different bytes.
+            TRITON_EXPORT bool operator!=(const const_iterator& other) const;
+        };
+
+      private:
+        //! The page directory (shared copy-on-write).
+        triton::utils::CopyOnWrite<PageMap> pages;
+
+        //! The region directory (shared copy-on-write). Regions never overlap.
+        triton::utils::CopyOnWrite<RegionMap> regions;
+
+        //! The page numbers already returned by touchUndefinedPages (shared copy-on-write).
+        mutable triton::utils::CopyOnWrite<std::unordered_set<triton::uint64, IdentityHash<triton::uint64>>> touchedPages;
+
+        //! The number of defined bytes held by pages.
+        triton::usize definedBytes;
+
+        //! The number of region bytes which are not shadowed by a page.
+        triton::usize regionBytes;
+
+        //! True if the changed pages are recorded.
+        bool tracking;
+
+        //! True if the memory changed in a way which is not recorded by `changedPages` (regions, assignment, whole clear).
+        bool untracked;
+
+        //! The memory resource of the pages, nullptr for the heap.
+        std::pmr::memory_resource* resource;
+
+        //! The numbers of the pages changed since `trackChanges()`.
+        std::unordered_set<triton::uint64, IdentityHash<triton::uint64>> changedPages;
+
+        //! Records a change of the page.
+        inline void markChanged(triton::uint64 pn) {
+          if (this->tracking)
+            this->changedPages.insert(pn);
+        }
+
+        //! Returns the page which contains the address, nullptr if the page is not allocated.
+        const Page* getPage(triton::uint64 addr) const;
+
+        //! Returns the page which contains the address. Allocates the page if it does not exist.
+        Page* getOrCreatePage(triton::uint64 addr);
+
+        //! Returns a writable page. The page is copied first if it is shared with another memory.
+        Page* getWritablePage(std::shared_ptr<Page>& page);
+
+        //! Copies the bytes of regions into a new page and marks them as defined.
+        void fillPage(triton::uint64 pn, Page* page);
+
+        //! Returns the number of bytes from `addr` to `last` (included) which are covered by regions.
+        triton::usize getRegionBytes(triton::uint64 addr, triton::uint64 last) const;
+
+        //! Returns the number of bytes from `addr` to `last` (included) which are covered by regions and shadowed by pages.
+        triton::usize getShadowedBytes(triton::uint64 addr, triton::uint64 last) const;
+
+        //! Copies `size` bytes of regions from `addr` into `dst`. Bytes outside of regions are read as 0.
+        void readRegions(triton::uint64 addr, triton::uint8* dst, triton::usize size) const;
+
+        //! Removes the parts of regions from `addr` to `last` (included).
+        void unmapRegions(triton::uint64 addr, triton::uint64 last);
+
+      public:
+        //! Returns the page number of an address.
+        static inline triton::uint64 pageNumber(triton::uint64 addr) {
+          return addr / pageSize;
+        }
+
+        //! Returns the offset of an address in its page.
+        static inline triton::usize pageOffset(triton::uint64 addr) {
+          return static_cast<triton::usize>(addr % pageSize);
+        }
+
+        //! Constructor.
+        TRITON_EXPORT ConcreteMemory();
+
+        //! Constructor by copy. Pages and regions are shared copy-on-write.
+        TRITON_EXPORT ConcreteMemory(const ConcreteMemory& other);
+
+        //! Copies a ConcreteMemory. Pages and regions are shared copy-on-write. The tracking of changes is not copied.
+        TRITON_EXPORT ConcreteMemory& operator=(const ConcreteMemory& other);
+
+        //! Swaps the contents of two ConcreteMemory, including the tracking of changes.
+        TRITON_EXPORT void swap(ConcreteMemory& other);
+
+        //! Returns the concrete value of a memory cell. Returns 0 if the cell is undefined.
+        TRITON_EXPORT triton::uint8 read(triton::uint64 addr) const;
+
+        //! Copies `size` bytes from `addr` into `dst`. Undefined cells are read as 0.
+        TRITON_EXPORT void read(triton::uint64 addr, triton::uint8* dst, triton::usize size) const;
+
+        //! Returns the little-endian value of `size` bytes (at most `triton::size::dqqword`) from `addr`.
+        TRITON_EXPORT triton::uint512 readValue(triton::uint64 addr, triton::uint32 size) const;
+
+        //! Sets the concrete value of a memory cell.
+        TRITON_EXPORT void write(triton::uint64 addr, triton::uint8 value);
+
+        //! Copies `size` bytes from `src` to `addr`.
+        TRITON_EXPORT void write(triton::uint64 addr, const triton::uint8* src, triton::usize size);
+
+        //! Stores `value` as `size` little-endian bytes (at most `triton::size::dqqword`) at `addr`.
+        TRITON_EXPORT void writeValue(triton::uint64 addr, const triton::uint512& value, triton::uint32 size);
+
+        /*!
+         * \brief Maps a read-only region of `size` bytes at `addr`.
+         *
+         * \details The bytes are read in place from `data`, or as zeros if `data` is nullptr, until
+         * they are written. `owner` keeps `data` alive. The region replaces the concrete values
+         * previously defined from `addr` to `addr + size`.
+         */
+        TRITON_EXPORT void map(triton::uint64 addr, const triton::uint8* data, triton::usize size, const std::shared_ptr<const void>& owner=nullptr);
+
+        //! Returns true if all memory cells from `addr` to `addr + size` have a defined concrete value.
+        TRITON_EXPORT bool isDefined(triton::uint64 addr, triton::usize size=1) const;
+
+        /*!
+         * \brief Returns the base addresses of the pages from `addr` to `addr + size` which have no defined cell and have never been touched.
+         *
+         * \details The returned pages are marked as touched and are never returned again until the whole memory is cleared.
+         */
+        TRITON_EXPORT std::vector<triton::uint64> touchUndefinedPages(triton::uint64 addr, triton::usize size) const;
+
+        //! Clears the concrete values of memory cells from `addr` to `addr + size`. Empty pages are released.
+        TRITON_EXPORT void clear(triton::uint64 addr, triton::usize size);
+
+        //! Clears the whole memory.
+        TRITON_EXPORT void clear(void);
+
+        //! Sets the memory resource of the pages allocated from now on, nullptr for the heap.
+        TRITON_EXPORT void setMemoryResource(std::pmr::memory_resource* resource);
+
+        //! Returns the number of defined memory cells.
+        TRITON_EXPORT triton::usize size(void) const;
+
+        //! Returns true if no memory cell is defined.
+        TRITON_EXPORT bool empty(void) const;
+
+        //! Returns the number of allocated pages. Regions do not allocate pages until they are written.
+        TRITON_EXPORT triton::usize getNumberOfPages(void) const;
+
+        //! Starts (or restarts) recording the pages changed from now on if `flag` is true, stops recording them otherwise.
+        TRITON_EXPORT void trackChanges(bool flag=true);
+
+        //! Returns true if the changed pages are recorded.
+        TRITON_EXPORT bool isTrackingChanges(void) const;
+
+        //! Returns the number of pages changed since `trackChanges()`.
+        TRITON_EXPORT triton::usize getNumberOfChangedPages(void) const;
+
+        /*!
+         * \brief Brings the changed pages back to their state in `base` and restarts the recording.
+         *
+         * \details `base` must be a copy of the memory taken when the recording started, left unchanged
+         * since. Returns false, without changing anything, if the changes are not recorded or if the
+         * memory changed in a way which is not (e.g. a region has been mapped): the caller copies `base`
+         * instead.
+         */
+        TRITON_EXPORT bool restoreChanges(const ConcreteMemory& base);
+
+        //! Returns the page directory.
+        TRITON_EXPORT const PageMap& getPages(void) const;
+
+        //! Returns the region directory.
+        TRITON_EXPORT const RegionMap& getRegions(void) const;
+
+        //! Returns an iterator to the first defined byte.
+        TRITON_EXPORT const_iterator begin(void) const;
+
+        //! Returns an iterator past the last defined byte.
+        TRITON_EXPORT const_iterator end(void) const;
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_CONCRETEMEMORY_HPP */
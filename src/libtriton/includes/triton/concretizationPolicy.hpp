@@ -0,0 +1,149 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_CONCRETIZATIONPOLICY_HPP
+#define TRITON_CONCRETIZATIONPOLICY_HPP
+
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/symbolicEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  class Context;
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! Returns true if the registers and memory cells written by `inst` must be concretized (CONCRETIZATION_HOOK).
+      using ConcretizationHook = std::function<bool(triton::Context& ctx, const triton::arch::Instruction& inst)>;
+
+      //! A register or memory area concretized by a rule of a ConcretizationPolicy.
+      struct ConcretizationEvent {
+        //! The address of the instruction.
+        triton::uint64 address;
+
+        //! The rule which triggered.
+        triton::engines::symbolic::concretization_e rule;
+
+        //! The parent register concretized, ID_REG_INVALID for a memory area.
+        triton::arch::register_e reg;
+
+        //! The address of the memory area concretized.
+        triton::uint64 memory;
+
+        //! The size of the memory area in bytes, 0 for a register.
+        triton::uint32 size;
+      };
+
+
+      /*! \class ConcretizationPolicy
+       *  \brief Concretizes the symbolic state written by the instructions according to rules.
+       *
+       *  \details The rules are evaluated after the processing of each instruction by the context, on the
+       *  parent registers and the memory cells it wrote, those of a basic block once the block is processed.
+       *  Only the symbolic locations are concretized, and each concretization is recorded as an event.
+       */
+      class ConcretizationPolicy {
+        private:
+          //! The thresholds of the rules enabled <rule : threshold>.
+          std::map<triton::engines::symbolic::concretization_e, triton::usize> rules;
+
+          //! The symbolic regions of the memory <base address : size>.
+          std::map<triton::uint64, triton::usize> regions;
+
+          //! The hook of CONCRETIZATION_HOOK.
+          ConcretizationHook hook;
+
+          //! The number of times each instruction was processed, with CONCRETIZATION_HOT_ADDRESSES.
+          std::unordered_map<triton::uint64, triton::usize> hits;
+
+          //! The concretizations, in order.
+          std::vector<ConcretizationEvent> events;
+
+          //! Returns true if the memory cell belongs to a symbolic region.
+          bool isInRegion(triton::uint64 addr) const;
+
+          //! Concretizes the parent register if it is symbolic.
+          void concretize(triton::Context& ctx, const triton::arch::Instruction& inst, triton::engines::symbolic::concretization_e rule, const triton::arch::Register& reg);
+
+          //! Concretizes the symbolic cells of a memory area, one event per contiguous run.
+          void concretize(triton::Context& ctx, const triton::arch::Instruction& inst, triton::engines::symbolic::concretization_e rule, triton::uint64 addr, triton::uint32 size, bool regions);
+
+          //! Concretizes all the registers and memory cells written by `inst`.
+          void concretizeWrites(triton::Context& ctx, triton::arch::Instruction& inst, triton::engines::symbolic::concretization_e rule);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT ConcretizationPolicy();
+
+          //! Enables a rule. `threshold` is the number of nodes of CONCRETIZATION_LARGE_EXPRESSIONS and the number of iterations of CONCRETIZATION_HOT_ADDRESSES.
+          TRITON_EXPORT void addRule(triton::engines::symbolic::concretization_e rule, triton::usize threshold=0);
+
+          //! Disables a rule.
+          TRITON_EXPORT void removeRule(triton::engines::symbolic::concretization_e rule);
+
+          //! Returns true if a rule is enabled.
+          TRITON_EXPORT bool isRuleEnabled(triton::engines::symbolic::concretization_e rule) const;
+
+          //! Returns true if any rule is enabled.
+          TRITON_EXPORT bool isEnabled(void) const;
+
+          //! Declares a symbolic region of the memory, kept by CONCRETIZATION_OUTSIDE_REGIONS.
+          TRITON_EXPORT void addSymbolicRegion(triton::uint64 baseAddr, triton::usize size);
+
+          //! Sets the hook of CONCRETIZATION_HOOK and enables the rule, nullptr to disable it.
+          TRITON_EXPORT void setHook(const ConcretizationHook& hook);
+
+          //! Disables the rules, and clears the regions, the counters and the events.
+          TRITON_EXPORT void clear(void);
+
+          //! Applies the rules to an instruction processed by `ctx`.
+          TRITON_EXPORT void apply(triton::Context& ctx, triton::arch::Instruction& inst);
+
+          //! Returns the concretizations, in order.
+          TRITON_EXPORT const std::vector<ConcretizationEvent>& getEvents(void) const;
+
+          //! Clears the recorded concretizations.
+          TRITON_EXPORT void clearEvents(void);
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_CONCRETIZATIONPOLICY_HPP */
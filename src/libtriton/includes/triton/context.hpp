@@ -8,27 +8,48 @@
 #ifndef TRITON_CONTEXT_H
 #define TRITON_CONTEXT_H
 
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <triton/accessStream.hpp>
 #include <triton/architecture.hpp>
 #include <triton/ast.hpp>
 #include <triton/astContext.hpp>
 #include <triton/astRepresentation.hpp>
 #include <triton/basicBlock.hpp>
+#include <triton/binaryLoader.hpp>
 #include <triton/callbacks.hpp>
+#include <triton/concreteMemo.hpp>
+#include <triton/concretizationPolicy.hpp>
+#include <triton/denseModel.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/enumerativeSynthesizer.hpp>
+#include <triton/gdbRemote.hpp>
 #include <triton/immediate.hpp>
 #include <triton/instruction.hpp>
 #include <triton/irBuilder.hpp>
 #include <triton/liftingEngine.hpp>
 #include <triton/memoryAccess.hpp>
+#include <triton/memoryUsage.hpp>
 #include <triton/modes.hpp>
 #include <triton/operandWrapper.hpp>
 #include <triton/register.hpp>
 #include <triton/shortcutRegister.hpp>
+#include <triton/simplificationMemo.hpp>
 #include <triton/solverEngine.hpp>
 #include <triton/solverEnums.hpp>
 #include <triton/symbolicEngine.hpp>
+#include <triton/synthesisCache.hpp>
+#include <triton/synthesisDatabase.hpp>
 #include <triton/synthesizer.hpp>
 #include <triton/taintEngine.hpp>
+#include <triton/traceReader.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -41,7 +62,13 @@ namespace triton {
  */
 
     /*! \class Context
-     *  \brief This is the main Triton Context class. */
+     *  \brief This is the main Triton Context class.
+     *
+     *  \details A Context is not thread-safe, but independent Contexts may be used concurrently from
+     *  different threads, e.g. one `processing()` loop per thread. They only share immutable data such as
+     *  the registers specification of the architectures. A forked Context shares its AST context with its
+     *  parent, so both must stay on the same thread.
+     */
     class Context {
       private:
         //! Raises an exception if the architecture is not initialized.
@@ -62,11 +89,116 @@ namespace triton {
         //! Raises an exception if the lifting engine is not initialized.
         inline void checkLifting(void) const;
 
+        //! Concretizes the symbolic memory cells from `baseAddr` to `baseAddr + size`. The memory array is updated if `array` is true.
+        void concretizeMemoryArea(triton::uint64 baseAddr, triton::uint64 size, bool array=true);
+
+        //! Returns the conjunction of the first `index` path constraints and `node`.
+        triton::ast::SharedAbstractNode getPrefixPredicate(triton::usize index, const triton::ast::SharedAbstractNode& node) const;
+
+        //! Solves the branch of each flip under its prefix of the path with the incremental solving session, in order.
+        std::vector<triton::engines::symbolic::BranchFlip> solveBranchFlipsOfPath(std::vector<triton::engines::symbolic::BranchFlip>& flips, const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 timeout, const std::function<void(const triton::engines::symbolic::BranchFlip&)>& callback);
+
+        //! Solves the query of each flip, see `solveAllBranchFlips()`.
+        std::vector<triton::engines::symbolic::BranchFlip> solveBranchFlips(std::vector<triton::engines::symbolic::BranchFlip>& flips, const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::usize threads, triton::uint32 timeout, const std::function<void(const triton::engines::symbolic::BranchFlip&)>& callback);
+
+        //! Returns the last expression of each register, then of each memory cell, written by a processed block, up to `maxSize` bits.
+        std::vector<triton::engines::symbolic::SharedSymbolicExpression> getBlockOutputs(triton::arch::BasicBlock& block, triton::uint32 maxSize) const;
+
+        //! Lifts a processed block in a context whose registers are symbolic, and compiles it at `addr`. A block which can not be compiled is cached as such.
+        void compileBasicBlock(triton::arch::BasicBlock& block, triton::uint64 addr);
+
+        //! Sets the trace callback of the solver engine writing the queries into `queryCorpus`.
+        void traceQueryCorpus(void);
+
+        //! A snapshot of the concrete, symbolic and taint states.
+        struct Snapshot {
+          //! The concrete state.
+          std::unique_ptr<triton::arch::CpuInterface> cpu;
+
+          //! The symbolic state.
+          std::unique_ptr<triton::engines::symbolic::SymbolicEngine> symbolic;
+
+          //! The taint state.
+          std::unique_ptr<triton::engines::taint::TaintEngine> taint;
+        };
+
+        //! The snapshots <id : Snapshot>
+        std::unordered_map<triton::usize, Snapshot> snapshots;
+
+        //! The id of the next snapshot.
+        triton::usize uniqueSnapshotId = 0;
+
+        //! The snapshot whose memory the changed pages are recorded against (see `resetToSnapshot()`).
+        triton::usize trackedSnapshot = static_cast<triton::usize>(-1);
+
+        //! Restarts the recording of the changed pages of the concrete memory against the snapshot `id`.
+        void trackSnapshot(triton::usize id);
+
+        //! The results of `simplify()` via the solver, kept until the modes change.
+        mutable triton::engines::symbolic::SimplificationMemo solverSimplifications;
+
+        //! The results of `simplify()` via LLVM, kept until the modes change.
+        mutable triton::engines::symbolic::SimplificationMemo llvmSimplifications;
+
+        //! A branch whose sides run apart up to their join point (see STATE_MERGING).
+        struct Merge {
+          //! The state of the side not taken, at the join point.
+          std::unique_ptr<triton::Context> other;
+
+          //! The predicate of the side taken.
+          triton::ast::SharedAbstractNode predicate;
+
+          //! The index of the path constraint of the branch.
+          triton::usize index;
+
+          //! The address of the join point.
+          triton::uint64 join;
+
+          //! The addresses of the side taken [start, end).
+          triton::uint64 start, end;
+
+          //! The parent registers written by both sides.
+          std::set<triton::arch::register_e> registers;
+
+          //! The memory cells written by both sides.
+          std::set<triton::uint64> memory;
+        };
+
+        //! The branch being merged, nullptr if none.
+        std::unique_ptr<Merge> merge;
+
+        //! The maximum number of bytes of each side of a merged branch.
+        triton::usize mergeDistance = 64;
+
+        //! Returns the join point of the sides of the branch falling through at `fall` or going to `target`, 0 if they are not short straight-line code.
+        triton::uint64 getJoinPoint(triton::uint64 fall, triton::uint64 target) const;
+
+        //! Runs the side not taken of the branch just processed apart, if it is a short forward one.
+        void startMerge(const triton::arch::Instruction& inst);
+
+        //! Follows the side taken, and merges both sides once it reaches the join point.
+        void continueMerge(triton::arch::Instruction& inst);
+
+        //! Merges the state of the side not taken into the current one with `ite` on the predicate of the side taken.
+        void mergeSides(void);
+
+        //! Returns the values of `address` feasible under the path predicate, at most `limit`, or none if there are more or if the solver fails (see POINTER_RESOLUTION).
+        std::vector<triton::uint64> resolvePointer(const triton::ast::SharedAbstractNode& address, triton::usize limit) const;
+
 
       protected:
         //! The Callbacks interface.
         triton::callbacks::Callbacks callbacks;
 
+        //! The stream of the accesses of the processed instructions, nullptr if none.
+        triton::callbacks::AccessStream* accessStream = nullptr;
+
+        //! The rules concretizing the symbolic state after each instruction.
+        triton::engines::symbolic::ConcretizationPolicy concretization;
+
+        //! The target attached through the GDB remote protocol, nullptr if none.
+        std::shared_ptr<triton::loaders::GdbRemote> gdbRemote;
+
         //! The architecture entry.
         triton::arch::Architecture arch;
 
@@ -88,9 +220,27 @@ namespace triton {
         //! The AST Context interface.
         triton::ast::SharedAstContext astCtxt;
 
+        //! Held by all the contexts of a fork, which share the modes and the AST context. nullptr if never forked.
+        std::shared_ptr<char> forks;
+
+        //! The memory resource of the engines, nullptr for the heap.
+        std::pmr::memory_resource* resource = nullptr;
+
         //! The IR builder.
         triton::arch::IrBuilder* irBuilder = nullptr;
 
+        //! The memo of the synthesis results.
+        triton::engines::synthesis::SynthesisCache synthesisCache;
+
+        //! The databases of precomputed expressions.
+        std::vector<std::shared_ptr<triton::engines::synthesis::SynthesisDatabase>> synthesisDatabases;
+
+        //! The file of the SMT export opened by `startSmtStream(path)`.
+        std::unique_ptr<std::ofstream> smtFile;
+
+        //! The corpus file opened by `dumpSolverQueries(path)`. It is kept across the resets.
+        std::shared_ptr<std::ofstream> queryCorpus;
+
 
       public:
         //! A shortcut to access to a Register class from a register name.
@@ -102,6 +252,9 @@ namespace triton {
         //! Constructor of the Context.
         TRITON_EXPORT Context(triton::arch::architecture_e arch);
 
+        //! Constructor of the Context. The AST nodes, the symbolic expressions and variables, and the pages of the concrete, symbolic and taint memories are allocated from `resource`, which must outlive the Context and its nodes.
+        TRITON_EXPORT Context(triton::arch::architecture_e arch, std::pmr::memory_resource* resource);
+
         //! Destructor of the Context.
         TRITON_EXPORT ~Context();
 
@@ -179,7 +332,7 @@ namespace triton {
         TRITON_EXPORT const std::unordered_map<triton::arch::register_e, const triton::arch::Register>& getAllRegisters(void) const;
 
         //! [**architecture api**] - Returns all memory.
-        TRITON_EXPORT const std::unordered_map<triton::uint64, triton::uint8, IdentityHash<triton::uint64>>& getConcreteMemory(void) const;
+        TRITON_EXPORT const triton::arch::ConcreteMemory& getConcreteMemory(void) const;
 
         //! [**architecture api**] - Returns all parent registers. \sa triton::arch::x86::register_e.
         TRITON_EXPORT std::set<const triton::arch::Register*> getParentRegisters(void) const;
@@ -193,9 +346,26 @@ namespace triton {
         //! [**architecture api**] - Returns the concrete value of a memory area.
         TRITON_EXPORT std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
 
+        //! [**architecture api**] - Copies `size` bytes of concrete memory from `baseAddr` into `area`. Callbacks are called once per access of at most 64 bytes.
+        TRITON_EXPORT void readConcreteMemory(triton::uint64 baseAddr, void* area, triton::usize size, bool execCallbacks=true) const;
+
         //! [**architecture api**] - Returns the concrete value of a register.
         TRITON_EXPORT triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const;
 
+        //! [**architecture api**] - Returns the location of a register in the concrete register file.
+        TRITON_EXPORT const triton::arch::RegisterSlot& getConcreteRegisterSlot(triton::arch::register_e id) const;
+
+        /*!
+         * \brief [**architecture api**] - Returns the concrete register file.
+         *
+         * \details All registers are stored contiguously in this buffer of `getConcreteRegisterFileSize()` bytes,
+         * so the concrete state of the registers can be saved with a single copy.
+         */
+        TRITON_EXPORT const triton::uint8* getConcreteRegisterFile(void) const;
+
+        //! [**architecture api**] - Returns the size in bytes of the concrete register file.
+        TRITON_EXPORT triton::usize getConcreteRegisterFileSize(void) const;
+
         /*!
          * \brief [**architecture api**] - Sets the concrete value of a memory cell.
          *
@@ -228,6 +398,85 @@ namespace triton {
          */
         TRITON_EXPORT void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const void* area, triton::usize size, bool execCallbacks=true);
 
+        /*!
+         * \brief [**architecture api**] - Copies `size` bytes from `area` to the concrete memory at `baseAddr`.
+         *
+         * \details Contiguous bytes are copied at once and callbacks are called once per access of at most
+         * 64 bytes. The symbolic memory cells of the area are concretized.
+         */
+        TRITON_EXPORT void writeConcreteMemory(triton::uint64 baseAddr, const void* area, triton::usize size, bool execCallbacks=true);
+
+        /*!
+         * \brief [**architecture api**] - Maps the segments of an ELF, PE, Mach-O or minidump file in the concrete memory.
+         *
+         * \details The file is memory-mapped read-only and its segments are read in place, a page is only
+         * copied the first time it is written. Uninitialized parts of segments (e.g. `.bss`) are zeros.
+         * Symbolic bitvector expressions of the mapped cells are concretized. Note that the symbolic memory
+         * array (if the `MEMORY_ARRAY` mode is enabled) is not updated. No callback is called.
+         * Returns the mapped segments.
+         */
+        TRITON_EXPORT std::vector<triton::loaders::Segment> loadBinary(const std::string& path);
+
+        /*!
+         * \brief [**architecture api**] - Processes the records of the execution trace at `path`, see triton::loaders::TraceReader.
+         *
+         * \details The register and memory deltas of a record are set in the concrete state, without
+         * concretizing nor calling the callbacks, then its instruction is processed. Stops after
+         * `count` records if not 0. Returns the number of records processed.
+         */
+        TRITON_EXPORT triton::usize replayTrace(const std::string& path, triton::usize count=0);
+
+        //! [**architecture api**] - Processes the next records of `reader`, see replayTrace(path, count).
+        TRITON_EXPORT triton::usize replayTrace(triton::loaders::TraceReader& reader, triton::usize count=0);
+
+        /*!
+         * \brief [**taint api**] - Propagates the taint through the records of the execution trace at `path`, using `threads` threads.
+         *
+         * \details The records are split into chunks of `chunkSize` records whose taint summaries are computed
+         * in parallel, see triton::engines::taint::TaintSummary, then applied in order to the taint engine. Up
+         * to one chunk per thread is summarized at once, 0 meaning the number of cores. The result is the taint
+         * of replayTrace() but only the taint bits are propagated, not the labels, and the symbolic state is
+         * not updated. The entry state of a chunk is rebuilt from the deltas of the previous records, which must
+         * hold every value changed by the previous instruction. The concrete state is updated with the deltas.
+         * Returns the number of records processed.
+         */
+        TRITON_EXPORT triton::usize taintTrace(const std::string& path, triton::usize chunkSize=0x10000, triton::uint32 threads=0);
+
+        //! [**taint api**] - Propagates the taint through the next records of `reader`, see taintTrace(path, chunkSize, threads).
+        TRITON_EXPORT triton::usize taintTrace(triton::loaders::TraceReader& reader, triton::usize chunkSize=0x10000, triton::uint32 threads=0);
+
+        /*!
+         * \brief [**symbolic api**] - Symbolically executes the records of the execution trace at `path` in segments, using `threads` threads.
+         *
+         * \details The records are split into segments of `segmentSize` records whose symbolic summaries are
+         * computed in parallel over fresh variables at their entry, see triton::engines::symbolic::SymbolicSummary,
+         * then composed in order with the symbolic state by substituting the entry variables of a segment with the
+         * ASTs left by the previous ones. Up to one segment per thread is summarized at once, 0 meaning the number
+         * of cores. The result is the symbolic state and the path constraints of replayTrace(), with one expression
+         * per changed location and segment instead of one per instruction, and no callback of the instructions. The
+         * entry state of a segment is rebuilt from the deltas of the previous records, which must hold every value
+         * changed by the previous instruction. The `MEMORY_ARRAY` mode is not supported. Returns the number of
+         * records processed.
+         */
+        TRITON_EXPORT triton::usize processTrace(const std::string& path, triton::usize segmentSize=0x10000, triton::uint32 threads=0);
+
+        //! [**symbolic api**] - Symbolically executes the next records of `reader` in segments, see processTrace(path, segmentSize, threads).
+        TRITON_EXPORT triton::usize processTrace(triton::loaders::TraceReader& reader, triton::usize segmentSize=0x10000, triton::uint32 threads=0);
+
+        /*!
+         * \brief [**architecture api**] - Attaches to a stopped target through the GDB remote protocol of the stub at `host:port`, see triton::loaders::GdbRemote.
+         *
+         * \details The registers are set from the target, then a GET_CONCRETE_MEMORY_PAGE callback fetches each page
+         * of memory the first time it is touched, with the `prefetch` pages following it. An attached target is detached first.
+         */
+        TRITON_EXPORT void attachGdbRemote(const std::string& endpoint, triton::usize prefetch=4);
+
+        //! [**architecture api**] - Detaches from the target, the pages already fetched are kept.
+        TRITON_EXPORT void detachGdbRemote(void);
+
+        //! [**architecture api**] - Returns the client of the attached target, nullptr if none.
+        TRITON_EXPORT triton::loaders::GdbRemote* getGdbRemote(void) const;
+
         /*!
          * \brief [**architecture api**] - Sets the concrete value of a register.
          *
@@ -236,9 +485,20 @@ namespace triton {
          */
         TRITON_EXPORT void setConcreteRegisterValue(const triton::arch::Register& reg, const triton::uint512& value, bool execCallbacks=true);
 
+        /*!
+         * \brief [**architecture api**] - Replaces the concrete register file by `size` bytes from `file`.
+         *
+         * \details The buffer must have the layout of `getConcreteRegisterFile()`. Callbacks are not called
+         * and the symbolic expressions of all registers are concretized.
+         */
+        TRITON_EXPORT void setConcreteRegisterFile(const triton::uint8* file, triton::usize size);
+
         //! [**architecture api**] - Defines a concrete state.
         TRITON_EXPORT void setConcreteState(triton::arch::Architecture& other);
 
+        //! [**architecture api**] - Defines a concrete state from the concrete state of another context.
+        TRITON_EXPORT void setConcreteState(triton::Context& other);
+
         //! Returns true if memory cells have a defined concrete value
         TRITON_EXPORT bool isConcreteMemoryValueDefined(const triton::arch::MemoryAccess& mem) const;
 
@@ -266,6 +526,30 @@ namespace triton {
         //! [**architecture api**] - Disassembles a concrete memory area from `addr` to control flow instruction and returns a `BasicBlock`.
         TRITON_EXPORT triton::arch::BasicBlock disassembly(triton::uint64 addr) const;
 
+        //! [**architecture api**] - Disassembles the concrete memory area [addr, addr + size) with `threads` workers (0 for one per hardware thread) and returns its basic blocks in address order.
+        TRITON_EXPORT std::vector<triton::arch::BasicBlock> disassemblyBlocks(triton::uint64 addr, triton::usize size, triton::uint32 threads=0) const;
+
+        //! [**architecture api**] - Decodes the instruction at `addr` without building its operands nor its disassembly: only its size, type and control flow are returned.
+        TRITON_EXPORT triton::arch::DecodeInfo decode(const triton::uint8* opcode, triton::uint32 size, triton::uint64 addr=0) const;
+
+        //! [**architecture api**] - Linearly decodes the concrete memory area [addr, addr + size) without building operands, undecodable bytes being skipped.
+        TRITON_EXPORT std::vector<triton::arch::DecodeInfo> decode(triton::uint64 addr, triton::usize size) const;
+
+        //! [**architecture api**] - Enables or disables the cache of disassembled instructions, keyed by address and opcode. Disabling clears it.
+        TRITON_EXPORT void enableDecodeCache(bool flag);
+
+        //! [**architecture api**] - Returns true if the cache of disassembled instructions is enabled.
+        TRITON_EXPORT bool isDecodeCacheEnabled(void) const;
+
+        //! [**architecture api**] - Clears the cache of disassembled instructions.
+        TRITON_EXPORT void clearDecodeCache(void);
+
+        //! [**architecture api**] - Opens the file at `path` as a cache of disassembled instructions shared by the processes analyzing the same code, creating it with `slots` slots if it does not exist.
+        TRITON_EXPORT void openPersistentDecodeCache(const std::string& path, triton::usize slots=65536);
+
+        //! [**architecture api**] - Closes the file of disassembled instructions. The cache in memory is kept.
+        TRITON_EXPORT void closePersistentDecodeCache(void);
+
 
 
         /* Processing API ================================================================================ */
@@ -273,9 +557,25 @@ namespace triton {
         //! [**proccesing api**] - Processes an instruction and updates engines according to the instruction semantics. Returns `triton::arch::NO_FAULT` if succeed.
         TRITON_EXPORT triton::arch::exception_e processing(triton::arch::Instruction& inst);
 
-        //! [**proccesing api**] - Processes a block of instructions and updates engines according to instructions semantics. Returns `triton::arch::NO_FAULT` if succeed.
+        //! [**proccesing api**] - Processes a block of instructions and updates engines according to instructions semantics. The flags overwritten in the block before being read are not built. Returns `triton::arch::NO_FAULT` if succeed.
         TRITON_EXPORT triton::arch::exception_e processing(triton::arch::BasicBlock& block, triton::uint64 addr=0);
 
+        //! [**proccesing api**] - Attaches a stream receiving one record per instruction processed, nullptr to detach it. The stream is not owned by the context.
+        TRITON_EXPORT void setAccessStream(triton::callbacks::AccessStream* stream);
+
+        //! [**proccesing api**] - Returns the stream of the accesses, nullptr if none.
+        TRITON_EXPORT triton::callbacks::AccessStream* getAccessStream(void) const;
+
+        /*!
+         * \brief [**proccesing api**] - Processes the instructions from `addr`, fetched from the concrete memory, and follows the program counter.
+         *
+         * \details The loop stops after `maxInstructions` instructions (0 for no limit), on an address of
+         * `stopAddresses`, on an address whose memory is not defined, or on a fault, which is returned. Before
+         * the instruction of a `hooks` address is processed, its hook is called; it returns false to stop the loop
+         * and may move the program counter. The number of processed instructions is written to `count` if not null.
+         */
+        TRITON_EXPORT triton::arch::exception_e run(triton::uint64 addr, triton::usize maxInstructions=0, const std::unordered_set<triton::uint64>& stopAddresses={}, const std::unordered_map<triton::uint64, std::function<bool(triton::Context&, triton::uint64)>>& hooks={}, triton::usize* count=nullptr);
+
         //! [**proccesing api**] - Initializes everything.
         TRITON_EXPORT void initEngines(void);
 
@@ -285,6 +585,97 @@ namespace triton {
         //! [**proccesing api**] - Resets everything.
         TRITON_EXPORT void reset(void);
 
+        /*!
+         * \brief [**proccesing api**] - Resets everything like `reset()`, but keeps the engines instead of building new ones.
+         *
+         * \details The state of the engines is dropped while their allocations are kept: the arenas of the AST context,
+         * the capacity of the hash tables, the handle of the disassembler, the cache of lifted semantics, the function
+         * summaries and the handlers and files of the system calls. The solver engine keeps its settings, its query cache
+         * and its unsat cores. Meant for pools of contexts running many short tasks. The nodes built before the reset
+         * must not be used after it, the ids of the variables and the expressions start again from zero. A context
+         * which shares its modes and its AST context through `fork()` gets its own ones and new engines instead, so that
+         * the other contexts of the fork are left untouched.
+         */
+        TRITON_EXPORT void warmReset(void);
+
+        //! [**proccesing api**] - Returns an estimate of the memory held by the engines, cheap enough to be polled after each instruction. \sa triton::MemoryUsage.
+        TRITON_EXPORT triton::MemoryUsage getMemoryUsage(void) const;
+
+        //! [**proccesing api**] - Enables or disables the recording of the timeline of the engines, for every context and thread of the process. Needs the TRACING build option. \sa triton::utils::enableTracing().
+        TRITON_EXPORT void enableTracing(bool flag);
+
+        //! [**proccesing api**] - Returns true if the timeline of the engines is recorded.
+        TRITON_EXPORT bool isTracingEnabled(void) const;
+
+        //! [**proccesing api**] - Writes the recorded timeline to `path`, as a Chrome trace (JSON) or, if `perfetto` is true, as a Perfetto trace (protobuf). Returns the number of events.
+        TRITON_EXPORT triton::usize dumpTrace(const std::string& path, bool perfetto=false) const;
+
+        //! [**proccesing api**] - Drops the recorded timeline. No engine must be running on another thread meanwhile.
+        TRITON_EXPORT void clearTrace(void);
+
+
+
+        /* Snapshot API ================================================================================== */
+
+        //! [**snapshot api**] - Takes a snapshot of the concrete, symbolic and taint states and returns its id. Memory pages and symbolic maps are shared copy-on-write with the current state.
+        TRITON_EXPORT triton::usize snapshot(void);
+
+        //! [**snapshot api**] - Restores the states recorded by a snapshot. The snapshot is kept and can be restored again.
+        TRITON_EXPORT void restore(triton::usize id);
+
+        /*!
+         * \brief [**snapshot api**] - Restores the states recorded by a snapshot, copying back only the memory pages changed since the last snapshot, restore or reset.
+         *
+         * \details Meant for loops which run from the same snapshot many times. Registers are copied,
+         * the symbolic and taint states (including the path constraints) are shared copy-on-write with the
+         * snapshot. The memory is fully restored the first time, or if it changed in a way which is not
+         * recorded (e.g. an area has been mapped).
+         */
+        TRITON_EXPORT void resetToSnapshot(triton::usize id);
+
+        //! [**snapshot api**] - Returns true if the snapshot exists.
+        TRITON_EXPORT bool isSnapshotExists(triton::usize id) const;
+
+        //! [**snapshot api**] - Removes a snapshot.
+        TRITON_EXPORT void removeSnapshot(triton::usize id);
+
+        //! [**snapshot api**] - Removes all snapshots.
+        TRITON_EXPORT void clearSnapshots(void);
+
+        //! [**snapshot api**] - Returns a new context which starts from the current concrete, symbolic and taint states. Both contexts share the modes and the AST context, states are shared copy-on-write. Callbacks are not inherited.
+        TRITON_EXPORT std::unique_ptr<triton::Context> fork(void);
+
+
+        /*!
+         * \brief [**snapshot api**] - Saves the modes and the concrete, symbolic and taint states into the checkpoint file at `path`.
+         *
+         * \details The deferred registers are built first. The loops, the undo journal and the snapshots are not saved.
+         * The enabled modes are stored by name, and the register file with a digest of its layout.
+         */
+        TRITON_EXPORT void save(const std::string& path);
+
+        /*!
+         * \brief [**snapshot api**] - Replaces the modes and the concrete, symbolic and taint states by the ones of the checkpoint file at `path`.
+         *
+         * \details The file is mapped in memory and the saved pages are read in place until they are written.
+         * The context must be of the architecture of the checkpoint, with the same layout of the register file.
+         * The modes unknown to this version are ignored. The callbacks are kept.
+         */
+        TRITON_EXPORT void load(const std::string& path);
+
+
+        //! [**snapshot api**] - Enables or disables the undo journal of `processing`. The last `capacity` instructions processed can then be undone with `stepBack`. The taint state is not journaled.
+        TRITON_EXPORT void enableUndoJournal(bool flag, triton::usize capacity=1024);
+
+        //! [**snapshot api**] - Returns true if the undo journal is enabled.
+        TRITON_EXPORT bool isUndoJournalEnabled(void) const;
+
+        //! [**snapshot api**] - Returns the number of instructions which can be undone.
+        TRITON_EXPORT triton::usize getUndoJournalSize(void) const;
+
+        //! [**snapshot api**] - Undoes the concrete and symbolic register and memory assignments, and the path constraints, of the last `count` processed instructions.
+        TRITON_EXPORT void stepBack(triton::usize count=1);
+
 
 
         /* IR API ======================================================================================== */
@@ -298,6 +689,99 @@ namespace triton {
         //! [**IR builder api**] - Returns the AST context. Used as AST builder.
         TRITON_EXPORT triton::ast::SharedAstContext getAstContext(void);
 
+        //! [**architecture api**] - Returns the memory resource of the engines, nullptr for the heap.
+        TRITON_EXPORT std::pmr::memory_resource* getMemoryResource(void) const;
+
+        //! [**IR builder api**] - Enables or disables the cache of lifted semantics, keyed by address and opcode. Disabling clears it.
+        TRITON_EXPORT void enableSemanticsCache(bool flag);
+
+        //! [**IR builder api**] - Returns true if the cache of lifted semantics is enabled.
+        TRITON_EXPORT bool isSemanticsCacheEnabled(void) const;
+
+        //! [**IR builder api**] - Returns the number of instructions in the cache of lifted semantics.
+        TRITON_EXPORT triton::usize getSemanticsCacheSize(void) const;
+
+        //! [**IR builder api**] - Clears the cache of lifted semantics.
+        TRITON_EXPORT void clearSemanticsCache(void);
+
+        //! [**IR builder api**] - Enables or disables the memo replaying the outputs of the deterministic instructions met with the same concrete inputs, keeping at most `capacity` executions. Disabling clears it.
+        TRITON_EXPORT void enableConcreteMemo(bool flag, triton::usize capacity=0x10000);
+
+        //! [**IR builder api**] - Returns true if the concrete memo is enabled.
+        TRITON_EXPORT bool isConcreteMemoEnabled(void) const;
+
+        //! [**IR builder api**] - Returns the statistics of the concrete memo.
+        TRITON_EXPORT triton::arch::ConcreteMemoStats getConcreteMemoStats(void) const;
+
+        //! [**IR builder api**] - Removes all executions of the concrete memo and resets its statistics.
+        TRITON_EXPORT void clearConcreteMemo(void);
+
+        //! [**IR builder api**] - Enables or disables the profiling of the semantics per instruction type. Disabling clears the profile.
+        TRITON_EXPORT void enableProfiling(bool flag);
+
+        //! [**IR builder api**] - Returns true if the semantics are profiled.
+        TRITON_EXPORT bool isProfilingEnabled(void) const;
+
+        //! [**IR builder api**] - Returns the profile of the semantics <instruction type : profile>.
+        TRITON_EXPORT const std::map<triton::uint32, triton::arch::InstructionProfile>& getProfile(void) const;
+
+        //! [**IR builder api**] - Clears the profile of the semantics.
+        TRITON_EXPORT void clearProfile(void);
+
+        //! [**IR builder api**] - Enables or disables the heat map of the processed code per address and per basic block, measuring one instruction out of `period`. Disabling clears it.
+        TRITON_EXPORT void enableHeatMap(bool flag, triton::uint32 period=1);
+
+        //! [**IR builder api**] - Returns true if the heat map is enabled.
+        TRITON_EXPORT bool isHeatMapEnabled(void) const;
+
+        //! [**IR builder api**] - Returns the heat of the addresses, or of the basic blocks, the hottest first. Only the `count` hottest are returned, all if 0.
+        TRITON_EXPORT std::vector<std::pair<triton::uint64, triton::arch::HotSpot>> getHotSpots(bool blocks=false, triton::usize count=0) const;
+
+        //! [**IR builder api**] - Writes the heat map to the file `path`, as a report or as the folded stacks of a flame graph.
+        TRITON_EXPORT void exportHeatMap(const std::string& path, bool flameGraph=false) const;
+
+        //! [**IR builder api**] - Clears the heat map.
+        TRITON_EXPORT void clearHeatMap(void);
+
+        //! [**IR builder api**] - Summarizes the libc function `name` at `addr`, applied natively instead of emulating its stub. Raises an exception if the function has no summary.
+        TRITON_EXPORT void setFunctionSummary(triton::uint64 addr, const std::string& name, bool msAbi=false);
+
+        //! [**IR builder api**] - Summarizes the functions of a stubs symbols mapping loaded at `base`, the ones without summary are ignored. Returns the number of summarized functions.
+        TRITON_EXPORT triton::usize setFunctionSummaries(triton::uint64 base, const std::map<std::string, triton::uint64>& symbols, bool msAbi=false);
+
+        //! [**IR builder api**] - Removes the summary at `addr`.
+        TRITON_EXPORT void removeFunctionSummary(triton::uint64 addr);
+
+        //! [**IR builder api**] - Returns the summarized addresses <address : function name>.
+        TRITON_EXPORT std::map<triton::uint64, std::string> getFunctionSummaries(void) const;
+
+        //! [**IR builder api**] - Enables or disables the native emulation of the Linux system calls, applied once their instruction is processed (see SyscallEmulator).
+        TRITON_EXPORT void enableSyscallEmulation(bool flag);
+
+        //! [**IR builder api**] - Returns true if the system calls are emulated.
+        TRITON_EXPORT bool isSyscallEmulationEnabled(void) const;
+
+        //! [**IR builder api**] - Adds or replaces a file of the virtual filesystem of the system calls. The bytes read from a symbolic file are symbolic variables.
+        TRITON_EXPORT void addVirtualFile(const std::string& path, const std::vector<triton::uint8>& data, bool symbolic=false);
+
+        //! [**IR builder api**] - Returns the content of a file of the virtual filesystem, e.g. `/dev/stdout`. Raises an exception if the file does not exist.
+        TRITON_EXPORT const std::vector<triton::uint8>& getVirtualFile(const std::string& path) const;
+
+        //! [**IR builder api**] - Overrides the system call `number` of the current architecture. The handler returns the result of the call.
+        TRITON_EXPORT void setSyscallHandler(triton::uint64 number, const std::function<triton::uint64(triton::Context&, triton::uint64)>& handler);
+
+        //! [**IR builder api**] - Removes the override of the system call `number`.
+        TRITON_EXPORT void removeSyscallHandler(triton::uint64 number);
+
+        //! [**IR builder api**] - Sets the start of the heap grown by the `brk` system call.
+        TRITON_EXPORT void setProgramBreak(triton::uint64 addr);
+
+        //! [**IR builder api**] - Returns true once the program called the `exit` or `exit_group` system call.
+        TRITON_EXPORT bool hasProgramExited(void) const;
+
+        //! [**IR builder api**] - Returns the status given to the `exit` or `exit_group` system call.
+        TRITON_EXPORT triton::uint64 getProgramExitStatus(void) const;
+
 
 
         /* AST Representation API ======================================================================== */
@@ -317,6 +801,11 @@ namespace triton {
           this->callbacks.addCallback(kind, cb);
         }
 
+        //! [**callbacks api**] - Adds a callback only called for the memory ranges or the registers watched by `filter`. See `triton::callbacks::filteredCallback()`.
+        template <typename T> void addCallback(triton::callbacks::callback_e kind, T cb, const triton::callbacks::CallbackFilter& filter) {
+          this->callbacks.addCallback(kind, triton::callbacks::filteredCallback(cb, filter));
+        }
+
         //! [**callbacks api**] - Removes a callback.
         template <typename T> void removeCallback(triton::callbacks::callback_e kind, T cb) {
           this->callbacks.removeCallback(kind, cb);
@@ -357,9 +846,18 @@ namespace triton {
         //! [**symbolic api**] - Returns the map of symbolic registers defined.
         TRITON_EXPORT std::unordered_map<triton::arch::register_e, triton::engines::symbolic::SharedSymbolicExpression> getSymbolicRegisters(void) const;
 
+        //! [**symbolic api**] - Returns the symbolic expressions of the parent registers, as a view indexed by their id (null if not defined).
+        TRITON_EXPORT const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& getSymbolicRegisterArray(void) const;
+
         //! [**symbolic api**] - Returns the map (<Addr : SymExpr>) of symbolic memory defined.
         TRITON_EXPORT std::unordered_map<triton::uint64, triton::engines::symbolic::SharedSymbolicExpression> getSymbolicMemory(void) const;
 
+        //! [**symbolic api**] - Calls `fn` on every symbolic parent register, by increasing id and without copying them, until it returns false. Returns false if it was stopped.
+        TRITON_EXPORT bool forEachSymbolicRegister(const std::function<bool(triton::arch::register_e, const triton::engines::symbolic::SharedSymbolicExpression&)>& fn) const;
+
+        //! [**symbolic api**] - Calls `fn` on every symbolic memory byte, in no particular order and without copying them, until it returns false. Returns false if it was stopped. The symbolic memory must not be modified by `fn`.
+        TRITON_EXPORT bool forEachSymbolicMemory(const std::function<bool(triton::uint64, const triton::engines::symbolic::SharedSymbolicExpression&)>& fn) const;
+
         //! [**symbolic api**] - Returns the symbolic expression assigned to the memory address.
         TRITON_EXPORT triton::engines::symbolic::SharedSymbolicExpression getSymbolicMemory(triton::uint64 addr) const;
 
@@ -429,12 +927,39 @@ namespace triton {
         //! [**symbolic api**] - Assigns a symbolic expression to a register.
         TRITON_EXPORT void assignSymbolicExpressionToRegister(const triton::engines::symbolic::SharedSymbolicExpression& se, const triton::arch::Register& reg);
 
+        //! [**symbolic api**] - Adds a native rewrite rule which replaces the nodes matching `pattern` by `replacement`, see triton::ast::AstRewriter.
+        TRITON_EXPORT void addRewriteRule(const std::string& pattern, const std::string& replacement);
+
+        //! [**symbolic api**] - Adds the built-in native rewrite rules: MBA identities, constant reassociation and extract/concat fusion.
+        TRITON_EXPORT void addBuiltinRewriteRules(void);
+
+        //! [**symbolic api**] - Removes all native rewrite rules.
+        TRITON_EXPORT void clearRewriteRules(void);
+
+        //! [**symbolic api**] - Returns the native rewrite rules applied by `simplify()`.
+        TRITON_EXPORT triton::ast::AstRewriter& getAstRewriter(void);
+
         //! [**symbolic api**] - Processes all recorded AST simplifications, uses solver's simplifications if `usingSolver` is true or LLVM is `usingLLVM` is true. Returns the simplified AST.
         TRITON_EXPORT triton::ast::SharedAbstractNode simplify(const triton::ast::SharedAbstractNode& node, bool usingSolver=false, bool usingLLVM=false) const;
 
+        //! [**symbolic api**] - Processes all recorded AST simplifications on each of `nodes`, as `simplify()` on one AST. With `usingLLVM`, the ASTs are lifted into one LLVM module, which is optimized once. Returns the simplified ASTs.
+        TRITON_EXPORT std::vector<triton::ast::SharedAbstractNode> simplify(const std::vector<triton::ast::SharedAbstractNode>& nodes, bool usingSolver=false, bool usingLLVM=false) const;
+
+        //! [**symbolic api**] - Returns the number of results memoized by `simplify()`, the ones of the nodes which died since included.
+        TRITON_EXPORT triton::usize getSimplificationMemoSize(void) const;
+
+        //! [**symbolic api**] - Returns the number of results given back by the memo of `simplify()` instead of simplifying the nodes again.
+        TRITON_EXPORT triton::usize getSimplificationMemoHits(void) const;
+
+        //! [**symbolic api**] - Removes the results memoized by `simplify()`.
+        TRITON_EXPORT void clearSimplificationMemo(void);
+
         //! [**symbolic api**] - Processes a dead store elimination simplification on a given basic block. If `padding` is true, keep addresses aligned and padds with NOP instructions.
         TRITON_EXPORT triton::arch::BasicBlock simplify(const triton::arch::BasicBlock& block, bool padding=false) const;
 
+        //! [**symbolic api**] - Processes a dead store elimination simplification on a region of basic blocks, the live locations flowing through the branches between the blocks. Returns the simplified blocks in order.
+        TRITON_EXPORT std::vector<triton::arch::BasicBlock> simplify(const std::vector<triton::arch::BasicBlock>& region, bool padding=false) const;
+
         //! [**symbolic api**] - Returns the symbolic expression corresponding to an id.
         TRITON_EXPORT triton::engines::symbolic::SharedSymbolicExpression getSymbolicExpression(triton::usize symExprId) const;
 
@@ -453,12 +978,24 @@ namespace triton {
         //! [**symbolic api**] - Returns the logical conjunction vector of path constraint of a given thread.
         TRITON_EXPORT std::vector<triton::engines::symbolic::PathConstraint> getPathConstraintsOfThread(triton::uint32 threadId) const;
 
+        //! [**symbolic api**] - Returns the indexes in the path of the path constraints of a given thread, in order.
+        TRITON_EXPORT std::vector<triton::usize> getPathConstraintIndexesOfThread(triton::uint32 threadId) const;
+
+        //! [**symbolic api**] - Returns the ids of the threads of the path constraints, sorted.
+        TRITON_EXPORT std::vector<triton::uint32> getPathConstraintThreads(void) const;
+
+        //! [**symbolic api**] - Returns the logical conjunction of the taken branches of a given thread. The constraints of the other threads are ignored.
+        TRITON_EXPORT triton::ast::SharedAbstractNode getPathPredicateOfThread(triton::uint32 threadId) const;
+
         //! [**symbolic api**] - Returns the current path predicate as an AST of logical conjunction of each taken branch.
         TRITON_EXPORT triton::ast::SharedAbstractNode getPathPredicate(void);
 
         //! [**symbolic api**] - Returns path predicates which may reach the targeted address.
         TRITON_EXPORT std::vector<triton::ast::SharedAbstractNode> getPredicatesToReachAddress(triton::uint64 addr);
 
+        //! [**symbolic api**] - Returns the path predicates which may reach each targeted address, in the order of `addrs`.
+        TRITON_EXPORT std::vector<std::vector<triton::ast::SharedAbstractNode>> getPredicatesToReachAddresses(const std::vector<triton::uint64>& addrs);
+
         //! [**symbolic api**] - Returns the size of the path constraints
         TRITON_EXPORT triton::usize getSizeOfPathConstraints(void) const;
 
@@ -474,6 +1011,24 @@ namespace triton {
         //! [**symbolic api**] - Clears the current path predicate.
         TRITON_EXPORT void clearPathConstraints(void);
 
+        //! [**symbolic api**] - Replaces the first `count` path constraints by a single one, the conjunction of their taken predicates.
+        TRITON_EXPORT void summarizePathConstraints(triton::usize count);
+
+        //! [**symbolic api**] - Returns the path constraints of the branches whose sides were merged, in order (see STATE_MERGING).
+        TRITON_EXPORT const std::vector<triton::engines::symbolic::PathConstraint>& getMergedPathConstraints(void) const;
+
+        //! [**symbolic api**] - Sets the maximum number of bytes of each side of a branch merged (see STATE_MERGING).
+        TRITON_EXPORT void setMergeDistance(triton::usize distance);
+
+        //! [**symbolic api**] - Returns the maximum number of bytes of each side of a branch merged.
+        TRITON_EXPORT triton::usize getMergeDistance(void) const;
+
+        //! [**symbolic api**] - Sets the number of recent path constraints kept, 0 to disable. Past twice as many, the older ones are summarized into the first path constraint.
+        TRITON_EXPORT void setPathConstraintsWindow(triton::usize size);
+
+        //! [**symbolic api**] - Returns the number of recent path constraints kept, 0 if the path is not windowed.
+        TRITON_EXPORT triton::usize getPathConstraintsWindow(void) const;
+
         //! [**symbolic api**] - Returns true if the symbolic expression ID exists.
         TRITON_EXPORT bool isSymbolicExpressionExists(triton::usize symExprId) const;
 
@@ -495,6 +1050,9 @@ namespace triton {
         //! [**symbolic api**] - Converts a symbolic memory area to 8-bits symbolic variables.
         TRITON_EXPORT void symbolizeMemory(triton::uint64 addr, triton::usize size);
 
+        //! [**symbolic api**] - Converts a memory buffer to symbolic variables of up to 512 bits, one per chunk of the buffer, by increasing address. A model is written back to the buffer by `triton::engines::solver::applyModelToBuffer()`.
+        TRITON_EXPORT std::vector<triton::engines::symbolic::SharedSymbolicVariable> symbolizeBuffer(triton::uint64 addr, triton::usize size, const std::string& symVarAlias="");
+
         //! [**symbolic api**] - Converts a symbolic register expression to a symbolic variable.
         TRITON_EXPORT triton::engines::symbolic::SharedSymbolicVariable symbolizeRegister(const triton::arch::Register& reg, const std::string& symVarAlias="");
 
@@ -513,24 +1071,105 @@ namespace triton {
         //! [**symbolic api**] - Concretizes a symbolic register.
         TRITON_EXPORT void concretizeRegister(const triton::arch::Register& reg);
 
+        //! [**symbolic api**] - Bounds the ASTs assigned by the semantics to `maxNodes` nodes and `maxLevel` levels, references unrolled. 0 means unbounded.
+        TRITON_EXPORT void setAstBudget(triton::usize maxNodes, triton::uint32 maxLevel);
+
+        //! [**symbolic api**] - Sets the policy applied to the ASTs exceeding the budget.
+        TRITON_EXPORT void setAstBudgetPolicy(triton::engines::symbolic::budget_e policy);
+
+        //! [**symbolic api**] - Returns the ASTs which exceeded the budget, in order.
+        TRITON_EXPORT const std::vector<triton::engines::symbolic::BudgetEvent>& getAstBudgetEvents(void) const;
+
+        //! [**symbolic api**] - Clears the recorded budget events.
+        TRITON_EXPORT void clearAstBudgetEvents(void);
+
+        //! [**symbolic api**] - Sets the number of iterations of a loop with a symbolic condition recorded before it is concretized (see LOOP_SUMMARIZATION).
+        TRITON_EXPORT void setLoopUnrollBound(triton::usize bound);
+
+        //! [**symbolic api**] - Returns the number of iterations of a loop with a symbolic condition recorded before it is concretized.
+        TRITON_EXPORT triton::usize getLoopUnrollBound(void) const;
+
+        //! [**symbolic api**] - Returns the loops detected on the trace, in order.
+        TRITON_EXPORT const std::vector<triton::engines::symbolic::LoopSummary>& getLoopSummaries(void) const;
+
+        //! [**symbolic api**] - Clears the loops detected.
+        TRITON_EXPORT void clearLoopSummaries(void);
+
+        //! [**symbolic api**] - Sets the maximum number of addresses a symbolic pointer is resolved to, the pointers with more addresses being concretized (see POINTER_RESOLUTION).
+        TRITON_EXPORT void setPointerResolutionBound(triton::usize bound);
+
+        //! [**symbolic api**] - Returns the maximum number of addresses a symbolic pointer is resolved to.
+        TRITON_EXPORT triton::usize getPointerResolutionBound(void) const;
+
+        //! [**symbolic api**] - Enables a rule concretizing the state written by the instructions. `threshold` is the number of nodes of CONCRETIZATION_LARGE_EXPRESSIONS or of iterations of CONCRETIZATION_HOT_ADDRESSES. \sa triton::engines::symbolic::ConcretizationPolicy.
+        TRITON_EXPORT void addConcretizationRule(triton::engines::symbolic::concretization_e rule, triton::usize threshold=0);
+
+        //! [**symbolic api**] - Disables a concretization rule.
+        TRITON_EXPORT void removeConcretizationRule(triton::engines::symbolic::concretization_e rule);
+
+        //! [**symbolic api**] - Declares a symbolic region of the memory, kept by CONCRETIZATION_OUTSIDE_REGIONS.
+        TRITON_EXPORT void addSymbolicRegion(triton::uint64 baseAddr, triton::usize size);
+
+        //! [**symbolic api**] - Sets the hook of CONCRETIZATION_HOOK, returning true to concretize the writes of an instruction. nullptr disables the rule.
+        TRITON_EXPORT void setConcretizationHook(const triton::engines::symbolic::ConcretizationHook& hook);
+
+        //! [**symbolic api**] - Returns the concretizations of the rules, in order.
+        TRITON_EXPORT const std::vector<triton::engines::symbolic::ConcretizationEvent>& getConcretizationEvents(void) const;
+
+        //! [**symbolic api**] - Clears the recorded concretizations.
+        TRITON_EXPORT void clearConcretizationEvents(void);
+
+        //! [**symbolic api**] - Disables the concretization rules, and clears the symbolic regions and the events.
+        TRITON_EXPORT void clearConcretizationPolicy(void);
+
         //! [**symbolic api**] - Slices all expressions from a given one.
         TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> sliceExpressions(const triton::engines::symbolic::SharedSymbolicExpression& expr);
 
+        //! [**symbolic api**] - Slices all expressions from several ones in one pass and returns the union of their slices.
+        TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> sliceExpressions(const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs);
+
         //! [**symbolic api**] - Returns the list of the tainted symbolic expressions.
         TRITON_EXPORT std::vector<triton::engines::symbolic::SharedSymbolicExpression> getTaintedSymbolicExpressions(void) const;
 
         //! [**symbolic api**] - Returns all symbolic expressions as a map of <SymExprId : SymExpr>
         TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> getSymbolicExpressions(void) const;
 
+        //! [**symbolic api**] - Returns the symbolic expressions of a type as a map of <SymExprId : SymExpr>
+        TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> getSymbolicExpressions(triton::engines::symbolic::expression_e type) const;
+
+        //! [**symbolic api**] - Returns the symbolic expressions of the instructions processed at an address, in creation order.
+        TRITON_EXPORT std::vector<triton::engines::symbolic::SharedSymbolicExpression> getSymbolicExpressionsAt(triton::uint64 address) const;
+
+        //! [**symbolic api**] - Returns all symbolic expressions, in the order of their ids, as a flat SSA trace. \sa triton::ast::SsaTrace.
+        TRITON_EXPORT triton::ast::SsaTrace getSsaTrace(void) const;
+
         //! [**symbolic api**] - Returns all symbolic variables as a map of <SymVarId : SymVar>
         TRITON_EXPORT std::map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> getSymbolicVariables(void) const;
 
+        //! [**symbolic api**] - Returns the symbolic variables of a type as a map of <SymVarId : SymVar>
+        TRITON_EXPORT std::map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> getSymbolicVariables(triton::engines::symbolic::variable_e type) const;
+
+        //! [**symbolic api**] - Returns the symbolic variables of a type assigned to an origin (memory address or register id) as a map of <SymVarId : SymVar>
+        TRITON_EXPORT std::map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> getSymbolicVariables(triton::engines::symbolic::variable_e type, triton::uint64 origin) const;
+
+        //! [**symbolic api**] - Calls `fn` on every symbolic expression, in no particular order and without copying them, until it returns false. Returns false if it was stopped. No expression may be created by `fn`.
+        TRITON_EXPORT bool forEachSymbolicExpression(const std::function<bool(const triton::engines::symbolic::SharedSymbolicExpression&)>& fn) const;
+
+        //! [**symbolic api**] - Calls `fn` on every symbolic variable, in no particular order and without copying them, until it returns false. Returns false if it was stopped. No variable may be created by `fn`.
+        TRITON_EXPORT bool forEachSymbolicVariable(const std::function<bool(const triton::engines::symbolic::SharedSymbolicVariable&)>& fn) const;
+
         //! [**symbolic api**] - Gets the concrete value of a symbolic variable.
         TRITON_EXPORT triton::uint512 getConcreteVariableValue(const triton::engines::symbolic::SharedSymbolicVariable& symVar) const;
 
         //! [**symbolic api**] - Sets the concrete value of a symbolic variable.
         TRITON_EXPORT void setConcreteVariableValue(const triton::engines::symbolic::SharedSymbolicVariable& symVar, const triton::uint512& value);
 
+        //! [**symbolic api**] - Evaluates an AST with the values of a model, as returned by `getModel()`. The other variables keep their values. Neither the AST nor the variables are modified, and several threads may evaluate the same AST.
+        TRITON_EXPORT triton::uint512 evaluateAstViaModel(const triton::ast::SharedAbstractNode& node, const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model) const;
+
+        //! [**symbolic api**] - Evaluates an AST with the values of symbolic variables given by id. \sa evaluateAstViaModel().
+        TRITON_EXPORT triton::uint512 evaluateAstViaModel(const triton::ast::SharedAbstractNode& node, const std::unordered_map<triton::usize, triton::uint512>& values) const;
+
 
 
         /* Solver engine API ============================================================================= */
@@ -544,6 +1183,9 @@ namespace triton {
          */
         TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::solver::SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+        //! [**solver api**] - Computes and returns a model from a symbolic constraint as a dense vector sorted by variable id. See `getModel()` and `triton::engines::solver::applyModelToBuffer()`.
+        TRITON_EXPORT triton::engines::solver::DenseModel getDenseModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
         /*!
          * \brief [**solver api**] - Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
          *
@@ -553,9 +1195,180 @@ namespace triton {
          */
         TRITON_EXPORT std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+        //! [**solver api**] - Enumerates the models of a symbolic constraint, distinct on the `projection` variables (all the variables if it is empty), and streams them to `callback` until it returns false or `limit` models are found (0 for unlimited). The `timeout` applies to each check, and the status is UNSAT once every model is enumerated. Returns the number of models.
+        TRITON_EXPORT triton::usize enumerateModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, const triton::engines::solver::ModelCallback& callback, triton::uint32 limit = 0, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
         //! Returns true if an expression is satisfiable.
         TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+        //! [**solver api**] - Returns true if `node` has the same value for any input, returned in `value`, e.g. an opaque predicate. The node is evaluated on `samples` inputs first and only the nodes which do not vary are proved by the solver. A `timeout` can also be defined.
+        TRITON_EXPORT bool isOpaquePredicate(const triton::ast::SharedAbstractNode& node, triton::uint512* value = nullptr, triton::usize samples = 4096, triton::uint32 timeout = 0) const;
+
+        //! [**solver api**] - Queues the computation of a model of `node` and returns its handle. The query is solved by a background worker while the calling thread keeps running, the constraint must not be modified until it ends. A `timeout` can also be defined.
+        TRITON_EXPORT std::shared_ptr<triton::engines::solver::SolverFuture> getModelAsync(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout = 0) const;
+
+        //! [**solver api**] - Queues the satisfiability check of `node` and returns its handle. See `getModelAsync()`.
+        TRITON_EXPORT std::shared_ptr<triton::engines::solver::SolverFuture> isSatAsync(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout = 0) const;
+
+        //! [**solver api**] - Cancels the pending and running asynchronous queries.
+        TRITON_EXPORT void cancelAsync(void);
+
+        //! [**solver api**] - Returns the number of pending and running asynchronous queries.
+        TRITON_EXPORT triton::usize getAsyncSize(void) const;
+
+        //! [**solver api**] - Enables or disables the incremental solving of the path. A live solver keeps the path constraints asserted between the queries of `getModelOfPath()` and `isSatOfPath()`.
+        TRITON_EXPORT void enableIncrementalSolving(bool flag);
+
+        //! [**solver api**] - Returns true if the path is solved incrementally.
+        TRITON_EXPORT bool isIncrementalSolvingEnabled(void) const;
+
+        //! [**solver api**] - Computes and returns a model of `node` under the first `index` path constraints, e.g. the negation of the branch `index`. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+        TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::solver::SolverModel> getModelOfPath(triton::usize index, const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr);
+
+        //! [**solver api**] - Returns true if `node` is satisfiable under the first `index` path constraints.
+        TRITON_EXPORT bool isSatOfPath(triton::usize index, const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr);
+
+        //! [**solver api**] - Solves, on `threads` threads (0 for one per core), the path prefix and the negated branch of each branch not taken by the path. The flips are returned in the order they finish, and `callback` receives each of them at once on the calling thread. The callback must not build new nodes while the other queries are running. If defined, `filter` receives the source and destination addresses of each branch not taken, only the ones it accepts being solved. With incremental solving, the flips are solved in the order of the path by the session instead, each branch as an assumption, and `threads` is ignored.
+        TRITON_EXPORT std::vector<triton::engines::symbolic::BranchFlip> solveAllBranchFlips(triton::usize threads = 0, triton::uint32 timeout = 0, const std::function<void(const triton::engines::symbolic::BranchFlip&)>& callback = nullptr, const std::function<bool(triton::uint64 srcAddr, triton::uint64 dstAddr)>& filter = nullptr);
+
+        //! [**solver api**] - Solves, on `threads` threads (0 for one per core), the predicates of `getPredicatesToReachAddresses()` in a batch, and returns for each address the model of its first satisfiable predicate, empty if there is none. A `timeout` applies to each query.
+        TRITON_EXPORT std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> getModelsToReachAddresses(const std::vector<triton::uint64>& addrs, triton::usize threads = 0, triton::uint32 timeout = 0);
+
+        //! [**solver api**] - Same as `solveAllBranchFlips()` on the branches of a given thread, each one under the prefix of the constraints of this thread only, so that the threads are explored independently.
+        TRITON_EXPORT std::vector<triton::engines::symbolic::BranchFlip> solveAllBranchFlipsOfThread(triton::uint32 threadId, triton::usize threads = 0, triton::uint32 timeout = 0, const std::function<void(const triton::engines::symbolic::BranchFlip&)>& callback = nullptr, const std::function<bool(triton::uint64 srcAddr, triton::uint64 dstAddr)>& filter = nullptr);
+
+        //! [**solver api**] - Enables or disables the cache of the query results, keyed by the canonical hash of the query, its timeout and its number of models. The canonical form follows the references, sorts the operands of the commutative operators, puts the constants of the comparisons on the right and numbers the variables by position, so that a query hits the results of the same query on other variables. The `capacity` least recently used results are kept. Disabling clears it.
+        TRITON_EXPORT void enableQueryCache(bool flag, triton::usize capacity=1024);
+
+        //! [**solver api**] - Returns true if the cache of the query results is enabled.
+        TRITON_EXPORT bool isQueryCacheEnabled(void) const;
+
+        //! [**solver api**] - Returns the number of cached query results.
+        TRITON_EXPORT triton::usize getQueryCacheSize(void) const;
+
+        //! [**solver api**] - Returns the number of queries answered by the cache.
+        TRITON_EXPORT triton::usize getQueryCacheHits(void) const;
+
+        //! [**solver api**] - Returns the number of queries sent to the solver while the cache is enabled.
+        TRITON_EXPORT triton::usize getQueryCacheMisses(void) const;
+
+        //! [**solver api**] - Clears the cache of the query results and its statistics.
+        TRITON_EXPORT void clearQueryCache(void);
+
+        //! [**solver api**] - Opens the query cache file at `path` shared by the processes, creating it with `slots` slots if it does not exist. While the query cache is enabled, the queries missing from memory are looked up in the file and the solved ones are recorded in it. Needs `PERSISTENT_CACHE`.
+        TRITON_EXPORT void openSharedQueryCache(const std::string& path, triton::usize slots=65536);
+
+        //! [**solver api**] - Closes the shared query cache file. The cache in memory is kept.
+        TRITON_EXPORT void closeSharedQueryCache(void);
+
+        //! [**solver api**] - Returns true if a shared query cache file is opened.
+        TRITON_EXPORT bool isSharedQueryCacheOpen(void) const;
+
+        //! [**solver api**] - Enables or disables the bit-blasting of the small queries. A query of at most `maxNodes` nodes without arrays nor quantifiers is solved by the embedded SAT solver, the others by the current solver.
+        TRITON_EXPORT void enableBitBlasting(bool flag, triton::usize maxNodes=512);
+
+        //! [**solver api**] - Returns true if the small queries are bit-blasted.
+        TRITON_EXPORT bool isBitBlastingEnabled(void) const;
+
+        //! [**solver api**] - Enables or disables the adaptive timeouts. The queries without explicit timeout receive a few times their predicted solving time, within the bounds of a query and out of the budget of the current round.
+        TRITON_EXPORT void enableAdaptiveTimeout(bool flag);
+
+        //! [**solver api**] - Returns true if the timeouts are adaptive.
+        TRITON_EXPORT bool isAdaptiveTimeoutEnabled(void) const;
+
+        //! [**solver api**] - Sets the smallest and the largest adaptive timeout of a query, in milliseconds.
+        TRITON_EXPORT void setAdaptiveTimeoutBounds(triton::uint32 minTimeout, triton::uint32 maxTimeout);
+
+        //! [**solver api**] - Starts an exploration round with `budget` milliseconds to hand out to the queries, 0 for an unlimited round. Once the round is spent, the queries time out without solver.
+        TRITON_EXPORT void startTimeoutRound(triton::uint64 budget);
+
+        //! [**solver api**] - Returns the time left in the current round, in milliseconds. Returns 0 for an unlimited round.
+        TRITON_EXPORT triton::uint64 getTimeoutRoundRemaining(void) const;
+
+        //! [**solver api**] - Sets the callback deciding if a timed out query is retried with twice its timeout, at most `retries` times. An empty callback disables the retries.
+        TRITON_EXPORT void setTimeoutRetryCallback(const triton::engines::solver::TimeoutBudget::RetryCallback& callback, triton::uint32 retries=2);
+
+        //! [**solver api**] - Returns the predicted solving time of a query, in milliseconds.
+        TRITON_EXPORT triton::uint32 predictSolvingTime(const triton::ast::SharedAbstractNode& node) const;
+
+        //! [**solver api**] - Enables or disables the counterexample cache. The `capacity` most recently used models are kept, and a query satisfied by one of them under evaluation is not sent to the solver. Disabling clears it.
+        TRITON_EXPORT void enableCounterexampleCache(bool flag, triton::usize capacity=64);
+
+        //! [**solver api**] - Returns true if the counterexample cache is enabled.
+        TRITON_EXPORT bool isCounterexampleCacheEnabled(void) const;
+
+        //! [**solver api**] - Returns the number of models kept by the counterexample cache.
+        TRITON_EXPORT triton::usize getCounterexampleCacheSize(void) const;
+
+        //! [**solver api**] - Returns the number of queries satisfied by a model of the counterexample cache.
+        TRITON_EXPORT triton::usize getCounterexampleCacheHits(void) const;
+
+        //! [**solver api**] - Clears the models of the counterexample cache and its statistics.
+        TRITON_EXPORT void clearCounterexampleCache(void);
+
+        //! [**solver api**] - Enables or disables the unsat core cache. The core of each unsatisfiable query is extracted and the `capacity` most recently used cores are kept: a query which contains all the constraints of one of them is unsatisfiable without solver. Disabling clears it.
+        TRITON_EXPORT void enableUnsatCoreCache(bool flag, triton::usize capacity=256);
+
+        //! [**solver api**] - Returns true if the unsat core cache is enabled.
+        TRITON_EXPORT bool isUnsatCoreCacheEnabled(void) const;
+
+        //! [**solver api**] - Returns the number of cores kept by the unsat core cache.
+        TRITON_EXPORT triton::usize getUnsatCoreCacheSize(void) const;
+
+        //! [**solver api**] - Returns the number of queries contradicted by a core of the unsat core cache.
+        TRITON_EXPORT triton::usize getUnsatCoreCacheHits(void) const;
+
+        //! [**solver api**] - Clears the cores of the unsat core cache and its statistics.
+        TRITON_EXPORT void clearUnsatCoreCache(void);
+
+        //! [**solver api**] - Enables or disables the split of the queries into clusters of constraints which do not share any variable, solved separately by `getModel()` and `isSat()`.
+        TRITON_EXPORT void enableConstraintIndependence(bool flag);
+
+        //! [**solver api**] - Returns true if the queries are split into independent clusters of constraints before solving.
+        TRITON_EXPORT bool isConstraintIndependenceEnabled(void) const;
+
+        //! [**solver api**] - Enables or disables the presolver, which answers without solver the queries decided by the known bits and ranges of their nodes.
+        TRITON_EXPORT void enablePresolver(bool flag);
+
+        //! [**solver api**] - Returns true if the presolver is enabled.
+        TRITON_EXPORT bool isPresolverEnabled(void) const;
+
+        //! [**solver api**] - Returns the number of queries decided by the presolver.
+        TRITON_EXPORT triton::usize getPresolverHits(void) const;
+
+        //! [**solver api**] - Enables or disables the classification of the queries, each class being solved with its own configuration.
+        TRITON_EXPORT void enableQueryClassification(bool flag);
+
+        //! [**solver api**] - Returns true if the queries are classified.
+        TRITON_EXPORT bool isQueryClassificationEnabled(void) const;
+
+        //! [**solver api**] - Sets the configuration of the solvers for a class of queries.
+        TRITON_EXPORT void setQueryConfiguration(triton::engines::solver::query_e query, const triton::engines::solver::SolverConfiguration& config);
+
+        //! [**solver api**] - Returns the configuration of the solvers for a class of queries.
+        TRITON_EXPORT const triton::engines::solver::SolverConfiguration& getQueryConfiguration(triton::engines::solver::query_e query) const;
+
+        //! [**solver api**] - Enables or disables the statistics of the queries: their statuses, their time histogram, the size of their constraints and their translation and search times. The asynchronous queries are not recorded.
+        TRITON_EXPORT void enableSolverStatistics(bool flag);
+
+        //! [**solver api**] - Returns true if the statistics of the queries are recorded.
+        TRITON_EXPORT bool isSolverStatisticsEnabled(void) const;
+
+        //! [**solver api**] - Returns the statistics of the queries, with the hits of the caches.
+        TRITON_EXPORT triton::engines::solver::SolverStatistics getSolverStatistics(void) const;
+
+        //! [**solver api**] - Clears the statistics of the queries.
+        TRITON_EXPORT void clearSolverStatistics(void);
+
+        //! [**solver api**] - Defines the callback receiving the trace of each query, on the calling thread. An empty callback removes it.
+        TRITON_EXPORT void setSolverTraceCallback(const std::function<void(const triton::engines::solver::SolverQuery& query)>& callback);
+
+        //! [**solver api**] - Dumps the queries lasting at least `threshold` milliseconds into `directory`, as SMT-LIB files named `query-<n>.smt2`. Replaces the trace callback, an empty directory removes it.
+        TRITON_EXPORT void dumpSlowSolverQueries(const std::string& directory, triton::uint32 threshold);
+
+        //! [**solver api**] - Writes every query into the corpus file `path`, to be replayed by `triton-solver-replay` (see triton::engines::solver::writeQuery()). Replaces the trace callback, also across the resets and the changes of architecture. An empty path removes it.
+        TRITON_EXPORT void dumpSolverQueries(const std::string& path);
+
         //! Returns the kind of solver as triton::engines::solver::solver_e.
         TRITON_EXPORT triton::engines::solver::solver_e getSolver(void) const;
 
@@ -568,6 +1381,9 @@ namespace triton {
         //! Initializes a custom solver.
         TRITON_EXPORT void setCustomSolver(triton::engines::solver::SolverInterface* customSolver);
 
+        //! [**solver api**] - Initializes the remote solver with the workers `host:port`. The queries are pipelined to the workers, and `solveAllBranchFlips()` sends all its queries at once.
+        TRITON_EXPORT void setRemoteSolver(const std::vector<std::string>& endpoints);
+
         //! Returns true if the solver is valid.
         TRITON_EXPORT bool isSolverValid(void) const;
 
@@ -590,17 +1406,35 @@ namespace triton {
         //! [**taint api**] - Returns the instance of the taint engine.
         TRITON_EXPORT triton::engines::taint::TaintEngine* getTaintEngine(void);
 
-        //! [**taint api**] - Returns the tainted addresses.
-        TRITON_EXPORT const std::unordered_set<triton::uint64>& getTaintedMemory(void) const;
+        //! [**taint api**] - Returns the tainted addresses, as a view iterating over them.
+        TRITON_EXPORT const triton::engines::taint::TaintBitmap& getTaintedMemory(void) const;
+
+        //! [**taint api**] - Returns the tainted addresses as sorted and coalesced intervals of <address : size>.
+        TRITON_EXPORT std::vector<std::pair<triton::uint64, triton::usize>> getTaintedRanges(void) const;
+
+        //! [**taint api**] - Returns the sorted labels reaching one of the `size` bytes from an address.
+        TRITON_EXPORT std::vector<triton::uint32> getMemoryTaintLabels(triton::uint64 addr, triton::usize size=1) const;
+
+        //! [**taint api**] - Returns the sorted labels reaching the memory.
+        TRITON_EXPORT std::vector<triton::uint32> getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const;
+
+        //! [**taint api**] - Returns the sorted labels reaching the register.
+        TRITON_EXPORT std::vector<triton::uint32> getRegisterTaintLabels(const triton::arch::Register& reg) const;
 
         //! [**taint api**] - Returns the tainted registers.
         TRITON_EXPORT std::unordered_set<const triton::arch::Register*> getTaintedRegisters(void) const;
 
+        //! [**taint api**] - Returns the tainted parent registers, as a view indexed by their id.
+        TRITON_EXPORT const triton::engines::taint::RegisterSet& getTaintedRegisterSet(void) const;
+
         //! [**taint api**] - Abstract taint verification. Returns true if the operand is tainted.
         TRITON_EXPORT bool isTainted(const triton::arch::OperandWrapper& op) const;
 
         //! [**taint api**] - Returns true if the address:size is tainted.
-        TRITON_EXPORT bool isMemoryTainted(triton::uint64 addr, triton::uint32 size=1) const;
+        TRITON_EXPORT bool isMemoryTainted(triton::uint64 addr, triton::usize size=1) const;
+
+        //! [**taint api**] - Returns true if one of the `size` bytes from addr is tainted.
+        TRITON_EXPORT bool isAnyTainted(triton::uint64 addr, triton::usize size) const;
 
         //! [**taint api**] - Returns true if the memory is tainted.
         TRITON_EXPORT bool isMemoryTainted(const triton::arch::MemoryAccess& mem) const;
@@ -617,8 +1451,11 @@ namespace triton {
         //! [**taint api**] - Sets the flag (taint or untaint) to a register.
         TRITON_EXPORT bool setTaintRegister(const triton::arch::Register& reg, bool flag);
 
-        //! [**taint api**] - Taints an address. Returns TAINTED if the address has been tainted correctly. Otherwise it returns the last defined state.
-        TRITON_EXPORT bool taintMemory(triton::uint64 addr);
+        //! [**taint api**] - Taints `size` bytes from an address. Returns TAINTED if the addresses have been tainted correctly. Otherwise it returns the last defined state.
+        TRITON_EXPORT bool taintMemory(triton::uint64 addr, triton::usize size=1);
+
+        //! [**taint api**] - Taints the interval of `size` bytes from an address at once.
+        TRITON_EXPORT bool taintMemoryRange(triton::uint64 addr, triton::usize size);
 
         //! [**taint api**] - Taints a memory. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool taintMemory(const triton::arch::MemoryAccess& mem);
@@ -626,8 +1463,20 @@ namespace triton {
         //! [**taint api**] - Taints a register. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool taintRegister(const triton::arch::Register& reg);
 
-        //! [**taint api**] - Untaints an address. Returns !TAINTED if the address has been untainted correctly. Otherwise it returns the last defined state.
-        TRITON_EXPORT bool untaintMemory(triton::uint64 addr);
+        //! [**taint api**] - Taints `size` bytes from an address with a label, e.g. one per input source. The labels are then propagated with the taint. Returns TAINTED.
+        TRITON_EXPORT bool taintMemoryWithLabel(triton::uint64 addr, triton::usize size, triton::uint32 label);
+
+        //! [**taint api**] - Taints a memory with a label. Returns TAINTED.
+        TRITON_EXPORT bool taintMemoryWithLabel(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
+        //! [**taint api**] - Taints a register with a label. Returns TAINTED.
+        TRITON_EXPORT bool taintRegisterWithLabel(const triton::arch::Register& reg, triton::uint32 label);
+
+        //! [**taint api**] - Untaints `size` bytes from an address. Returns !TAINTED if the addresses have been untainted correctly. Otherwise it returns the last defined state.
+        TRITON_EXPORT bool untaintMemory(triton::uint64 addr, triton::usize size=1);
+
+        //! [**taint api**] - Untaints the interval of `size` bytes from an address at once.
+        TRITON_EXPORT bool untaintMemoryRange(triton::uint64 addr, triton::usize size);
 
         //! [**taint api**] - Untaints a memory. Returns !TAINTED if the memory has been untainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool untaintMemory(const triton::arch::MemoryAccess& mem);
@@ -681,8 +1530,44 @@ namespace triton {
 
         /* Synthesizer engine API ============================================================================== */
 
-        //! [**synthesizer api**] - Synthesizes a given node. If `constant` is true, performa a constant synthesis. If `opaque` is true, perform opaque constant synthesis. If `subexpr` is true, analyze children AST.
-        TRITON_EXPORT triton::engines::synthesis::SynthesisResult synthesize(const triton::ast::SharedAbstractNode& node, bool constant=true, bool subexpr=true, bool opaque=false);
+        //! [**synthesizer api**] - Synthesizes a given node. If `constant` is true, performa a constant synthesis. If `opaque` is true, perform opaque constant synthesis. If `subexpr` is true, analyze children AST. With `threads` other than 1 (0 for one per core), the children of a same depth are synthesized concurrently.
+        TRITON_EXPORT triton::engines::synthesis::SynthesisResult synthesize(const triton::ast::SharedAbstractNode& node, bool constant=true, bool subexpr=true, bool opaque=false, triton::usize threads=1);
+
+        //! [**synthesizer api**] - Synthesizes the smallest expression of at most `maxSize` nodes equivalent to `node`, by a bottom-up enumeration over the arithmetic and bitwise operators pruned by observational equivalence, and proven by the solver. The enumeration stops after `timeout` milliseconds (0 for no limit) and runs on `threads` threads (0 for one per core).
+        TRITON_EXPORT triton::engines::synthesis::SynthesisResult synthesizeByEnumeration(const triton::ast::SharedAbstractNode& node, triton::usize maxSize=7, triton::usize timeout=1000, triton::usize threads=1);
+
+        //! [**synthesizer api**] - Enables or disables the memo of the synthesis results, keyed by the structure of the subtrees regardless of their variables, and kept across the calls and the resets. Disabling keeps the results.
+        TRITON_EXPORT void enableSynthesisCache(bool flag);
+
+        //! [**synthesizer api**] - Returns true if the memo of the synthesis results is enabled.
+        TRITON_EXPORT bool isSynthesisCacheEnabled(void) const;
+
+        //! [**synthesizer api**] - Returns the number of subtrees held by the memo of the synthesis results.
+        TRITON_EXPORT triton::usize getSynthesisCacheSize(void) const;
+
+        //! [**synthesizer api**] - Returns the number of subtrees answered by the memo of the synthesis results.
+        TRITON_EXPORT triton::usize getSynthesisCacheHits(void) const;
+
+        //! [**synthesizer api**] - Clears the memo of the synthesis results and its statistics.
+        TRITON_EXPORT void clearSynthesisCache(void);
+
+        //! [**synthesizer api**] - Saves the memo of the synthesis results to the file `path`.
+        TRITON_EXPORT void saveSynthesisCache(const std::string& path) const;
+
+        //! [**synthesizer api**] - Loads the results of the file `path` into the memo of the synthesis results.
+        TRITON_EXPORT void loadSynthesisCache(const std::string& path);
+
+        //! [**synthesizer api**] - Maps the database of precomputed expressions at `path`, looked up by the synthesis after the oracles of the operators. The memo forgets the subtrees which could not be synthesized.
+        TRITON_EXPORT void loadSynthesisDatabase(const std::string& path);
+
+        //! [**synthesizer api**] - Returns the number of databases of precomputed expressions.
+        TRITON_EXPORT triton::usize getSynthesisDatabasesSize(void) const;
+
+        //! [**synthesizer api**] - Unmaps the databases of precomputed expressions.
+        TRITON_EXPORT void clearSynthesisDatabases(void);
+
+        //! [**synthesizer api**] - Writes to `path` the database of `exprs`, on the variables `vars` and the vectors of `inputs`. The first expression of each signature is kept. Returns the number of expressions written.
+        TRITON_EXPORT triton::usize writeSynthesisDatabase(const std::string& path, const std::vector<triton::ast::SharedAbstractNode>& vars, const std::vector<std::vector<triton::uint512>>& inputs, const std::vector<triton::ast::SharedAbstractNode>& exprs) const;
 
 
 
@@ -694,20 +1579,80 @@ namespace triton {
         //! [**lifting api**] - Lifts a symbolic expression and all its references to LLVM format. `fname` represents the name of the LLVM function.
         TRITON_EXPORT std::ostream& liftToLLVM(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, const char* fname="__triton", bool optimize=false);
 
-        //! [**lifting api**] - Lifts a symbolic expression and all its references to Python format. If `icomment` is true, then print instructions assembly in expression comments.
+        //! [**lifting api**] - Lifts several ASTs as one LLVM function `void fname(i64* inputs, i64* outputs, i8* memory)`. The symbolic variables are read from `inputs` in order of appearance, `outputs[i]` receives the value of `nodes[i]`, and the memory accesses are offsets from `memory`.
+        TRITON_EXPORT std::ostream& liftToLLVM(std::ostream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes, const char* fname="__triton", bool optimize=false);
+
+        //! [**lifting api**] - Lifts a trace of symbolic expressions as one LLVM function, `outputs[i]` receiving the value of `exprs[i]` (see the lifting of several ASTs).
+        TRITON_EXPORT std::ostream& liftToLLVM(std::ostream& stream, const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs, const char* fname="__triton", bool optimize=false);
+
+        //! [**lifting api**] - Lifts a processed basic block as one LLVM function whose outputs are the last values of the registers, then of the memory cells, written by the block (up to 64 bits).
+        TRITON_EXPORT std::ostream& liftToLLVM(std::ostream& stream, triton::arch::BasicBlock& block, const char* fname="__triton", bool optimize=false);
+
+        //! [**lifting api**] - Lifts an AST and all its references to BTOR2 format. A logical AST is a `bad` property, reachable iff it is satisfiable, otherwise it is an `output`.
+        TRITON_EXPORT std::ostream& liftToBTOR2(std::ostream& stream, const triton::ast::SharedAbstractNode& node);
+
+        //! [**lifting api**] - Lifts a symbolic expression and all its references to BTOR2 format (see the lifting of an AST).
+        TRITON_EXPORT std::ostream& liftToBTOR2(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr);
+
+        //! [**lifting api**] - Lifts an AST and all its references to a C function `fname` returning its value. If `icomment` is true, then print instructions assembly in expression comments. The subexpressions used several times are printed once, as temporaries.
+        TRITON_EXPORT std::ostream& liftToC(std::ostream& stream, const triton::ast::SharedAbstractNode& node, const std::string& fname="triton_expr", bool icomment=false);
+
+        //! [**lifting api**] - Lifts a symbolic expression and all its references to a C function `fname` returning its value (see the lifting of an AST).
+        TRITON_EXPORT std::ostream& liftToC(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, const std::string& fname="triton_expr", bool icomment=false);
+
+        //! [**lifting api**] - Lifts several ASTs as one C function `void fname(<variables>, <type>* out_0, ...)`. The symbolic variables are the first arguments, in order of their ids, and `out_i` receives the value of `nodes[i]`.
+        TRITON_EXPORT std::ostream& liftToC(std::ostream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes, const std::string& fname="triton_expr", bool icomment=false);
+
+        //! [**lifting api**] - Lifts a trace of symbolic expressions as one C function, `out_i` receiving the value of `exprs[i]` (see the lifting of several ASTs).
+        TRITON_EXPORT std::ostream& liftToC(std::ostream& stream, const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs, const std::string& fname="triton_expr", bool icomment=false);
+
+        //! [**lifting api**] - Lifts a processed basic block as one C function whose outputs are the last values of the registers, then of the memory cells, written by the block (up to 128 bits).
+        TRITON_EXPORT std::ostream& liftToC(std::ostream& stream, triton::arch::BasicBlock& block, const std::string& fname="triton_expr", bool icomment=false);
+
+        //! [**lifting api**] - Lifts a symbolic expression and all its references to Python format. If `icomment` is true, then print instructions assembly in expression comments. The subexpressions used several times are printed once, as temporaries.
         TRITON_EXPORT std::ostream& liftToPython(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool icomment=false);
 
-        //! [**lifting api**] - Lifts a symbolic expression and all its references to SMT format. If `assert_` is true, then (assert <expr>). If `icomment` is true, then print instructions assembly in expression comments.
+        //! [**lifting api**] - Lifts a symbolic expression and all its references to SMT format. If `assert_` is true, then (assert <expr>). If `icomment` is true, then print instructions assembly in expression comments. The subexpressions used several times are printed once, as temporaries.
         TRITON_EXPORT std::ostream& liftToSMT(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool assert_=false, bool icomment=false);
 
+        //! [**lifting api**] - Starts writing the SMT export of the trace to `stream`: the required functions, the current variables, expressions and path constraints, then each new variable as a `declare-fun`, expression as a `define-fun` and path constraint as an `assert`, exactly once as they are created.
+        TRITON_EXPORT void startSmtStream(std::ostream& stream);
+
+        //! [**lifting api**] - Starts writing the SMT export of the trace to the file `path`. \sa startSmtStream(std::ostream&).
+        TRITON_EXPORT void startSmtStream(const std::string& path);
+
+        //! [**lifting api**] - Stops writing the SMT export, and closes its file if opened by `startSmtStream(path)`.
+        TRITON_EXPORT void stopSmtStream(void);
+
+        //! [**lifting api**] - Returns true if the SMT export of the trace is being written.
+        TRITON_EXPORT bool isSmtStreamEnabled(void) const;
+
+        //! [**lifting api**] - Reads an SMT-LIB2 script, such as the one of `liftToSMT()`, without any solver and returns its assertions. The declared constants are the symbolic variables of the same name or alias, new ones being created for the others.
+        TRITON_EXPORT std::vector<triton::ast::SharedAbstractNode> parseSmt(std::istream& stream);
+
         //! [**lifting api**] - Lifts an AST and all its references to Dot format.
         TRITON_EXPORT std::ostream& liftToDot(std::ostream& stream, const triton::ast::SharedAbstractNode& node);
 
         //! [**lifting api**] - Lifts a symbolic expression and all its references to Dot format.
         TRITON_EXPORT std::ostream& liftToDot(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr);
 
+        //! [**lifting api**] - Lifts an AST and its references to Dot format, streamed breadth-first with at most `maxNodes` nodes expanded (0 for unlimited) down to `maxDepth` (0 for unlimited). The subtrees beyond are collapsed into summary nodes, and the shared nodes are emitted once.
+        TRITON_EXPORT std::ostream& liftToDot(std::ostream& stream, const triton::ast::SharedAbstractNode& node, triton::usize maxNodes, triton::uint32 maxDepth=0);
+
         //! [**lifting api**] - Lifts and simplify an AST using LLVM
         TRITON_EXPORT triton::ast::SharedAbstractNode simplifyAstViaLLVM(const triton::ast::SharedAbstractNode& node) const;
+
+        //! [**lifting api**] - Lifts and simplify several ASTs using LLVM. The ASTs are lifted into one module, which is optimized once.
+        TRITON_EXPORT std::vector<triton::ast::SharedAbstractNode> simplifyAstViaLLVM(const std::vector<triton::ast::SharedAbstractNode>& nodes) const;
+
+        //! [**lifting api**] - Processes a block of instructions through native code. The first time, the block goes through `processing` and is compiled by the LLVM JIT at `addr`. Then, while its registers are neither symbolized nor tainted, it runs on the concrete registers without being disassembled. Returns `triton::arch::NO_FAULT` if succeed.
+        TRITON_EXPORT triton::arch::exception_e processingJit(triton::arch::BasicBlock& block, triton::uint64 addr=0);
+
+        //! [**lifting api**] - Returns the number of blocks cached by `processingJit`, the ones which can not be compiled included.
+        TRITON_EXPORT triton::usize getJitCacheSize(void) const;
+
+        //! [**lifting api**] - Clears the blocks cached by `processingJit`.
+        TRITON_EXPORT void clearJitCache(void);
     };
 
 /*! @} End of triton namespace */
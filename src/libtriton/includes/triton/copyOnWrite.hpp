@@ -0,0 +1,88 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_COPYONWRITE_HPP
+#define TRITON_COPYONWRITE_HPP
+
+#include <memory>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    /*! \class CopyOnWrite
+     *  \brief A container holder shared between copies until one of them is modified.
+     *
+     *  \details Copying a `CopyOnWrite` only copies a reference to the held object. The object
+     *  is deep copied the first time `mutate()` is called while it is shared with another holder.
+     *  Read accesses go through `get()`, `operator*` or `operator->` and never copy.
+     */
+    template <typename T>
+    class CopyOnWrite {
+      private:
+        //! The shared object.
+        std::shared_ptr<T> object;
+
+      public:
+        //! Constructor.
+        CopyOnWrite() : object(std::make_shared<T>()) {}
+
+        //! Returns a read-only reference to the object.
+        const T& get(void) const {
+          return *this->object;
+        }
+
+        //! Returns a read-only reference to the object.
+        const T& operator*(void) const {
+          return *this->object;
+        }
+
+        //! Returns a read-only pointer to the object.
+        const T* operator->(void) const {
+          return this->object.get();
+        }
+
+        //! Returns a writable reference to the object. The object is copied first if it is shared.
+        T& mutate(void) {
+          if (this->object.use_count() > 1)
+            this->object = std::make_shared<T>(*this->object);
+          return *this->object;
+        }
+
+        //! Clears the object. A shared object is released instead of being copied.
+        void clear(void) {
+          if (this->object.use_count() > 1)
+            this->object = std::make_shared<T>();
+          else
+            this->object->clear();
+        }
+
+        //! Returns true if the object is shared with another holder.
+        bool isShared(void) const {
+          return this->object.use_count() > 1;
+        }
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_COPYONWRITE_HPP */
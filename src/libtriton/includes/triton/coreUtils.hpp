@@ -41,6 +41,22 @@ namespace triton {
       return ss.str();
     }
 
+    //! Converts a native unsigned integer from or to the little-endian byte order. Resolved at compile time.
+    template <typename T>
+    inline T littleEndian(T value) {
+      static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value, "littleEndian() needs a native unsigned integer");
+      #if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+      T swapped = 0;
+      for (triton::usize i = 0; i < sizeof(T); i++) {
+        swapped = static_cast<T>((swapped << 8) | (value & 0xff));
+        value = static_cast<T>(value >> 8);
+      }
+      return swapped;
+      #else
+      return value;
+      #endif
+    }
+
     //! Inject the value into the buffer. Make sure that the `buffer` contains at least 10 allocated bytes.
     TRITON_EXPORT void fromUintToBuffer(triton::uint80 value, triton::uint8* buffer);
 
@@ -8,16 +8,23 @@
 #ifndef TRITON_CPUINTERFACE_HPP
 #define TRITON_CPUINTERFACE_HPP
 
+#include <memory>
 #include <set>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include <triton/archEnums.hpp>
+#include <triton/callbacksEnums.hpp>
+#include <triton/concreteMemory.hpp>
+#include <triton/coreUtils.hpp>
+#include <triton/cpuSize.hpp>
+#include <triton/decodeCache.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/register.hpp>
+#include <triton/registerFile.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -40,6 +47,13 @@ namespace triton {
     /*! \interface CpuInterface
         \brief This interface is used as abstract CPU interface. All CPU must use this interface. */
     class CpuInterface {
+      protected:
+        //! Returns true if `reg` is read or written through its slot alone, without side effect nor callback of `kind` to call.
+        TRITON_EXPORT virtual bool isDirectConcreteRegister(const triton::arch::Register& reg, triton::callbacks::callback_e kind, bool execCallbacks) const = 0;
+
+        //! Returns the concrete register file, to write the direct registers into.
+        TRITON_EXPORT virtual triton::uint8* getWritableConcreteRegisterFile(void) = 0;
+
       public:
         //! Destructor.
         TRITON_EXPORT virtual ~CpuInterface(){};
@@ -87,7 +101,10 @@ namespace triton {
         TRITON_EXPORT virtual const std::unordered_map<triton::arch::register_e, const triton::arch::Register>& getAllRegisters(void) const = 0;
 
         //! Return all memory.
-        TRITON_EXPORT virtual const std::unordered_map<triton::uint64, triton::uint8, IdentityHash<triton::uint64>>& getConcreteMemory(void) const = 0;
+        TRITON_EXPORT virtual const triton::arch::ConcreteMemory& getConcreteMemory(void) const = 0;
+
+        //! Swaps the memory of the CPU with `memory`, leaving the registers untouched.
+        TRITON_EXPORT virtual void swapConcreteMemory(triton::arch::ConcreteMemory& memory) = 0;
 
         //! Returns parent register from a given one.
         TRITON_EXPORT virtual const triton::arch::Register& getParentRegister(const triton::arch::Register& reg) const = 0;
@@ -110,6 +127,12 @@ namespace triton {
         //! Disassembles the instruction according to the architecture.
         TRITON_EXPORT virtual void disassembly(triton::arch::Instruction& inst) = 0;
 
+        //! Decodes the instruction at `addr` without building its operands nor its disassembly. Throws a `Disassembly` exception if the opcode is undecodable.
+        TRITON_EXPORT virtual triton::arch::DecodeInfo decode(const triton::uint8* opcode, triton::uint32 size, triton::uint64 addr) = 0;
+
+        //! Returns the cache of disassembled instructions.
+        TRITON_EXPORT virtual triton::arch::DecodeCache& getDecodeCache(void) = 0;
+
         //! Returns the concrete value of a memory cell.
         TRITON_EXPORT virtual triton::uint8 getConcreteMemoryValue(triton::uint64 addr,  bool execCallbacks=true) const = 0;
 
@@ -119,9 +142,32 @@ namespace triton {
         //! Returns the concrete value of a memory area.
         TRITON_EXPORT virtual std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const = 0;
 
+        /*!
+         * \brief [**architecture api**] - Copies `size` bytes of concrete memory from `baseAddr` into `area`.
+         *
+         * \details Contiguous bytes are copied at once and GET_CONCRETE_MEMORY_VALUE callbacks are called
+         * once per memory access of at most 64 bytes instead of once per byte.
+         */
+        TRITON_EXPORT virtual void readConcreteMemory(triton::uint64 baseAddr, void* area, triton::usize size, bool execCallbacks=true) const = 0;
+
         //! Returns the concrete value of a register.
         TRITON_EXPORT virtual triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const = 0;
 
+        //! Returns the location of a register in the concrete register file.
+        TRITON_EXPORT virtual const triton::arch::RegisterSlot& getConcreteRegisterSlot(triton::arch::register_e id) const = 0;
+
+        /*!
+         * \brief [**architecture api**] - Returns the concrete register file.
+         *
+         * \details All registers are stored contiguously in this buffer of `getConcreteRegisterFileSize()`
+         * bytes and are located by `getConcreteRegisterSlot()`. The whole concrete state of the registers
+         * can thus be saved with a single copy.
+         */
+        TRITON_EXPORT virtual const triton::uint8* getConcreteRegisterFile(void) const = 0;
+
+        //! Returns the size in bytes of the concrete register file.
+        TRITON_EXPORT virtual triton::usize getConcreteRegisterFileSize(void) const = 0;
+
         /*!
          * \brief [**architecture api**] - Sets the concrete value of a memory cell.
          *
@@ -154,6 +200,93 @@ namespace triton {
          */
         TRITON_EXPORT virtual void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const void* area, triton::usize size, bool execCallbacks=true) = 0;
 
+        /*!
+         * \brief [**architecture api**] - Copies `size` bytes from `area` to the concrete memory at `baseAddr`.
+         *
+         * \details Contiguous bytes are copied at once and SET_CONCRETE_MEMORY_VALUE callbacks are called
+         * once per memory access of at most 64 bytes instead of once per byte.
+         */
+        TRITON_EXPORT virtual void writeConcreteMemory(triton::uint64 baseAddr, const void* area, triton::usize size, bool execCallbacks=true) = 0;
+
+        /*!
+         * \brief [**architecture api**] - Returns the concrete value of `sizeof(T)` bytes of memory at `addr`.
+         *
+         * \details `T` is a native unsigned integer or triton::uint128. The bytes are copied at once by
+         * `readConcreteMemory()` and the byte order is resolved at compile time, without triton::uint512.
+         */
+        template <typename T>
+        T loadConcreteMemory(triton::uint64 addr, bool execCallbacks=true) const {
+          if constexpr (std::is_same<T, triton::uint128>::value) {
+            triton::uint8 buffer[sizeof(triton::uint64) * 2];
+            this->readConcreteMemory(addr, buffer, sizeof(buffer), execCallbacks);
+            return triton::utils::cast<triton::uint128>(buffer);
+          }
+          else {
+            T value = 0;
+            this->readConcreteMemory(addr, &value, sizeof(T), execCallbacks);
+            return triton::utils::littleEndian<T>(value);
+          }
+        }
+
+        /*!
+         * \brief [**architecture api**] - Sets the concrete value of `sizeof(T)` bytes of memory at `addr`.
+         *
+         * \details `T` is a native unsigned integer or triton::uint128. The bytes are copied at once by
+         * `writeConcreteMemory()` and the byte order is resolved at compile time, without triton::uint512.
+         */
+        template <typename T>
+        void storeConcreteMemory(triton::uint64 addr, T value, bool execCallbacks=true) {
+          if constexpr (std::is_same<T, triton::uint128>::value) {
+            triton::uint8 buffer[sizeof(triton::uint64) * 2];
+            triton::utils::fromUintToBuffer(value, buffer);
+            this->writeConcreteMemory(addr, buffer, sizeof(buffer), execCallbacks);
+          }
+          else {
+            value = triton::utils::littleEndian<T>(value);
+            this->writeConcreteMemory(addr, &value, sizeof(T), execCallbacks);
+          }
+        }
+
+        /*!
+         * \brief [**architecture api**] - Returns the concrete value of a register, truncated to `T`.
+         *
+         * \details `T` is a native unsigned integer or triton::uint128. The register is read at its offset
+         * in the register file, without triton::uint512, unless it has side effects or callbacks to call.
+         */
+        template <typename T>
+        T loadConcreteRegister(const triton::arch::Register& reg, bool execCallbacks=true) const {
+          if (this->isDirectConcreteRegister(reg, triton::callbacks::GET_CONCRETE_REGISTER_VALUE, execCallbacks) == false)
+            return static_cast<T>(this->getConcreteRegisterValue(reg, execCallbacks));
+          return this->getConcreteRegisterSlot(reg.getId()).template read<T>(this->getConcreteRegisterFile());
+        }
+
+        /*!
+         * \brief [**architecture api**] - Sets the concrete value of a register.
+         *
+         * \details `T` is a native unsigned integer or triton::uint128. The register is written at its offset
+         * in the register file, without triton::uint512, unless it has side effects or callbacks to call.
+         */
+        template <typename T>
+        void storeConcreteRegister(const triton::arch::Register& reg, T value, bool execCallbacks=true) {
+          constexpr triton::uint32 bits = std::is_same<T, triton::uint128>::value ? triton::bitsize::dqword : sizeof(T) * triton::bitsize::byte;
+
+          /* A register wider than T, or a value too big for the register, is left to the generic path */
+          if (this->isDirectConcreteRegister(reg, triton::callbacks::SET_CONCRETE_REGISTER_VALUE, execCallbacks) == false || reg.getBitSize() > bits || (reg.getBitSize() < bits && (value >> reg.getBitSize()) != 0)) {
+            this->setConcreteRegisterValue(reg, triton::uint512(value), execCallbacks);
+            return;
+          }
+
+          this->getConcreteRegisterSlot(reg.getId()).template write<T>(this->getWritableConcreteRegisterFile(), value);
+        }
+
+        /*!
+         * \brief [**architecture api**] - Maps a read-only memory area without copying it.
+         *
+         * \details The bytes are read from `area` (zeros if `area` is nullptr) until they are written,
+         * the first write into a page copies it. `owner` must keep `area` alive. No callback is called.
+         */
+        TRITON_EXPORT virtual void mapConcreteMemoryArea(triton::uint64 baseAddr, const void* area, triton::usize size, const std::shared_ptr<const void>& owner) = 0;
+
         /*!
          * \brief [**architecture api**] - Sets the concrete value of a register.
          *
@@ -162,6 +295,13 @@ namespace triton {
          */
         TRITON_EXPORT virtual void setConcreteRegisterValue(const triton::arch::Register& reg, const triton::uint512& value, bool execCallbacks=true) = 0;
 
+        /*!
+         * \brief [**architecture api**] - Replaces the concrete register file by `size` bytes from `file`.
+         *
+         * \details The buffer must have the layout of `getConcreteRegisterFile()`. Callbacks are not called.
+         */
+        TRITON_EXPORT virtual void setConcreteRegisterFile(const triton::uint8* file, triton::usize size) = 0;
+
         //! Returns true if memory cells have a defined concrete value
         TRITON_EXPORT virtual bool isConcreteMemoryValueDefined(const triton::arch::MemoryAccess& mem) const = 0;
 
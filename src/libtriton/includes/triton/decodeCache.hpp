@@ -0,0 +1,184 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_DECODECACHE_HPP
+#define TRITON_DECODECACHE_HPP
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/config.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/operandWrapper.hpp>
+#include <triton/tritonTypes.hpp>
+
+#ifdef TRITON_PERSISTENT_CACHE
+  #include <triton/persistentDecodeCache.hpp>
+#endif
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \brief What a fast decoding tells about an instruction, see `CpuInterface::decode()`.
+     *
+     *  \details No operand is built: only the size, the type and the control flow of the
+     *  instruction are known, which is what a sweep of a whole binary needs.
+     */
+    struct DecodeInfo {
+      //! The address of the instruction.
+      triton::uint64 address = 0;
+
+      //! The size of the instruction.
+      triton::uint32 size = 0;
+
+      //! The type of the instruction.
+      triton::uint32 type = 0;
+
+      //! The class of control flow of the instruction.
+      triton::arch::flow_e flow = triton::arch::FLOW_NONE;
+
+      //! True if the instruction is a branch, as `Instruction::isBranch()`.
+      bool branch = false;
+
+      //! True if the instruction changes the control flow, as `Instruction::isControlFlow()`.
+      bool controlFlow = false;
+
+      //! True if the target of the jump or call is an immediate.
+      bool direct = false;
+
+      //! The target of the jump or call if it is direct, 0 otherwise.
+      triton::uint64 target = 0;
+    };
+
+
+    /*! \class DecodeCache
+     *  \brief A cache of disassembled instructions, keyed by address and opcode.
+     *
+     *  \details Each entry keeps what the disassembly sets on an instruction. An entry is only
+     *  used if the opcode of the instruction to disassemble starts with the bytes it was decoded
+     *  from, so code modified in memory is decoded again without explicit invalidation. With
+     *  `PERSISTENT_CACHE`, the instructions missing from memory are also looked up in a file shared
+     *  by the processes, see `PersistentDecodeCache`.
+     */
+    class DecodeCache {
+      private:
+        //! A disassembled instruction.
+        struct Entry {
+          //! The opcode decoded.
+          triton::uint8 opcode[16];
+
+          //! The size of the instruction.
+          triton::uint32 size;
+
+          //! The architecture of the instruction.
+          triton::arch::architecture_e arch;
+
+          //! The type of the instruction.
+          triton::uint32 type;
+
+          //! The prefix of the instruction.
+          triton::arch::x86::prefix_e prefix;
+
+          //! The code condition of the instruction.
+          triton::arch::arm::condition_e codeCondition;
+
+          //! True if the instruction is a branch.
+          bool branch;
+
+          //! True if the instruction changes the control flow.
+          bool controlFlow;
+
+          //! True if the instruction performs a write back.
+          bool writeBack;
+
+          //! True if the instruction updates flags.
+          bool updateFlag;
+
+          //! True if the instruction has been decoded in Thumb mode.
+          bool thumb;
+
+          //! The disassembly of the instruction.
+          std::string disassembly;
+
+          //! The operands of the instruction.
+          std::vector<triton::arch::OperandWrapper> operands;
+        };
+
+        //! The entries <address : Entry>
+        std::unordered_map<triton::uint64, Entry> entries;
+
+        //! True if the cache is enabled.
+        bool enabled;
+
+        #ifdef TRITON_PERSISTENT_CACHE
+        //! The cache file, if one is opened.
+        std::unique_ptr<triton::arch::PersistentDecodeCache> persistent;
+        #endif
+
+        //! Sets up the instruction from the cache in memory.
+        bool loadEntry(triton::arch::Instruction& inst, bool thumb) const;
+
+        //! Records a disassembled instruction in memory.
+        void storeEntry(const triton::arch::Instruction& inst, bool thumb);
+
+      public:
+        //! Constructor. The cache is disabled.
+        TRITON_EXPORT DecodeCache();
+
+        //! Enables or disables the cache. Disabling clears it.
+        TRITON_EXPORT void enable(bool flag);
+
+        //! Returns true if the cache is enabled.
+        TRITON_EXPORT bool isEnabled(void) const;
+
+        //! Returns the number of cached instructions.
+        TRITON_EXPORT triton::usize getSize(void) const;
+
+        //! Sets up the instruction from the cache and returns true if it has been decoded before in the same mode.
+        TRITON_EXPORT bool load(triton::arch::Instruction& inst, bool thumb=false);
+
+        //! Records a disassembled instruction, in memory if the cache is enabled and in the cache file if one is opened.
+        TRITON_EXPORT void store(const triton::arch::Instruction& inst, bool thumb=false);
+
+        //! Removes all entries. The cache file is kept.
+        TRITON_EXPORT void clear(void);
+
+        #ifdef TRITON_PERSISTENT_CACHE
+        //! Opens the cache file at `path`, creating it with `slots` slots if it does not exist. It is used even if the cache in memory is disabled.
+        TRITON_EXPORT void openPersistent(const std::string& path, triton::arch::architecture_e arch, const triton::arch::CpuInterface& cpu, triton::usize slots=65536);
+
+        //! Closes the cache file.
+        TRITON_EXPORT void closePersistent(void);
+
+        //! Returns true if a cache file is opened.
+        TRITON_EXPORT bool isPersistentOpen(void) const;
+        #endif
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_DECODECACHE_HPP */
@@ -0,0 +1,139 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_DENSEMODEL_H
+#define TRITON_DENSEMODEL_H
+
+#include <unordered_map>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class DenseModel
+      /*! \brief A model kept as a dense vector of values sorted by variable id.
+       *
+       *  \details The values of the variables of 64 bits or less are held in place, the wider ones in a
+       *  separate vector. Unlike `SolverModel`, an entry owns neither the variable nor any allocation: only
+       *  the id, the size and, for the memory variables, the address are kept.
+       */
+      class DenseModel {
+        private:
+          //! The value of a variable.
+          struct Entry {
+            //! The id of the variable.
+            triton::usize id;
+
+            //! The value if the variable is 64 bits or less, its index in `wides` otherwise.
+            triton::uint64 value;
+
+            //! The address of a memory variable, 0 otherwise.
+            triton::uint64 address;
+
+            //! The size (in bits) of the variable.
+            triton::uint32 size;
+
+            //! True if the variable is a memory variable.
+            bool memory;
+          };
+
+          //! The entries, sorted by id.
+          std::vector<Entry> entries;
+
+          //! The values of the variables wider than 64 bits.
+          std::vector<triton::uint512> wides;
+
+          //! Returns the entry of the variable, nullptr if it is not in the model.
+          const Entry* find(triton::usize id) const;
+
+        public:
+          //! Marks a variable which is not in the model, see `indexOf()`.
+          static const triton::usize npos = static_cast<triton::usize>(-1);
+
+          //! Constructor. The model is empty.
+          TRITON_EXPORT DenseModel();
+
+          //! Constructor from a model, as returned by `getModel()`.
+          TRITON_EXPORT DenseModel(const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model);
+
+          //! Adds or replaces the value of a variable.
+          TRITON_EXPORT void set(const triton::engines::symbolic::SharedSymbolicVariable& variable, const triton::uint512& value);
+
+          //! Returns the number of variables.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns true if the model has no variable.
+          TRITON_EXPORT bool empty(void) const;
+
+          //! Returns true if the variable is in the model.
+          TRITON_EXPORT bool contains(triton::usize id) const;
+
+          //! Returns the position of the variable in the model, `npos` if it is not in the model.
+          TRITON_EXPORT triton::usize indexOf(triton::usize id) const;
+
+          //! Returns the id of the variable at `index`.
+          TRITON_EXPORT triton::usize getId(triton::usize index) const;
+
+          //! Returns the size (in bits) of the variable at `index`.
+          TRITON_EXPORT triton::uint32 getSize(triton::usize index) const;
+
+          //! Returns the value of the variable at `index`.
+          TRITON_EXPORT triton::uint512 getValue(triton::usize index) const;
+
+          //! Returns the value of the variable, 0 if it is not in the model.
+          TRITON_EXPORT triton::uint512 getValueOf(triton::usize id) const;
+
+          //! Returns true if the variable at `index` is a memory variable.
+          TRITON_EXPORT bool isMemory(triton::usize index) const;
+
+          //! Returns the address of the memory variable at `index`.
+          TRITON_EXPORT triton::uint64 getAddress(triton::usize index) const;
+
+          //! Removes all variables.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*!
+     * \brief Writes the values of the memory variables of `model` lying in `[baseAddr, baseAddr + size)` into `out`, in little endian.
+     *
+     * \details The bytes of the variables crossing a bound of the range are clipped, the other bytes of `out`
+     * are left untouched. Returns the number of bytes written.
+     */
+    TRITON_EXPORT triton::usize applyModelToBuffer(const DenseModel& model, triton::uint64 baseAddr, triton::usize size, triton::uint8* out);
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_DENSEMODEL_H */
@@ -0,0 +1,159 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_ENUMERATIVESYNTHESIZER_HPP
+#define TRITON_ENUMERATIVESYNTHESIZER_HPP
+
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEngine.hpp>
+#include <triton/synthesisResult.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Synthesis namespace
+    namespace synthesis {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup synthesis
+     *  @{
+     */
+
+      /*! \class EnumerativeSynthesizer
+       *  \brief A synthesis engine enumerating expressions bottom-up, by increasing size.
+       *
+       *  \details The expressions are built over the variables of the node, the constant 1, the unary
+       *  operators `bvneg` and `bvnot` and the binary operators `bvadd`, `bvand`, `bvmul`, `bvor`, `bvsub`
+       *  and `bvxor`, as the offline generator of the synthesis databases. Each expression is kept as its
+       *  operator, its operands and its outputs on the inputs of the node (the lanes), computed with native
+       *  integers so that the candidates of a size are generated on several threads. Two expressions giving
+       *  the same outputs are observationally equivalent and only the first one, the smallest, is kept.
+       *
+       *  The first expression giving the outputs of the node, computed by the batch evaluator, is proven
+       *  equivalent by the solver. If the solver finds a counterexample, it is added to the inputs and the
+       *  enumeration starts again.
+       */
+      class EnumerativeSynthesizer {
+        private:
+          //! An enumerated expression.
+          struct Term {
+            //! The operator, VARIABLE_NODE for a variable or BV_NODE for the constant.
+            triton::ast::ast_e op;
+
+            //! The first operand, or the index of the variable.
+            triton::uint32 left;
+
+            //! The second operand.
+            triton::uint32 right;
+
+            //! The number of nodes of the expression.
+            triton::uint32 size;
+          };
+
+          //! The variables of the node.
+          std::vector<triton::ast::SharedAbstractNode> vars;
+
+          //! The values of the variables of each lane.
+          std::vector<std::vector<triton::uint512>> inputs;
+
+          //! The outputs of the node on the lanes.
+          std::vector<triton::uint64> target;
+
+          //! The enumerated expressions, by increasing size.
+          std::vector<Term> terms;
+
+          //! The outputs of the expressions, `lanes()` words per expression.
+          std::vector<triton::uint64> outputs;
+
+          //! The expressions, by hash of their outputs.
+          std::unordered_map<triton::uint64, std::vector<triton::uint32>> classes;
+
+          //! The mask of the size of the node.
+          triton::uint64 mask;
+
+          //! The maximum number of expressions kept.
+          triton::usize capacity;
+
+          //! The number of times the inputs have been refined by a counterexample.
+          triton::usize refinements;
+
+          //! An instance of a solver engine to verify the expressions found.
+          triton::engines::solver::SolverEngine solver;
+
+          //! Returns the number of lanes.
+          triton::usize lanes(void) const;
+
+          //! Returns the hash of the outputs of an expression.
+          static triton::uint64 hashOutputs(const triton::uint64* lanes, triton::usize count);
+
+          //! Returns true if an expression giving `lanes` is already kept.
+          bool isKnown(const triton::uint64* lanes, triton::uint64 hash) const;
+
+          //! Computes into `out` the outputs of the operator `op` on the expressions `left` and `right`.
+          void evaluate(triton::ast::ast_e op, triton::uint32 left, triton::uint32 right, triton::uint64* out) const;
+
+          //! Keeps an expression if no kept one gives its outputs. Returns true if it is kept.
+          bool insert(const Term& term, const triton::uint64* lanes, triton::uint64 hash);
+
+          //! Enumerates the expressions up to `maxSize` nodes. Returns the index of the first one giving the outputs of the node, or -1.
+          triton::sint64 enumerate(triton::usize maxSize, triton::usize threads, triton::uint64 deadline);
+
+          //! Builds the node of an expression.
+          triton::ast::SharedAbstractNode build(triton::uint32 index, const triton::ast::SharedAstContext& actx) const;
+
+          //! Returns 1 if `candidate` is proven equivalent to `node` within `timeout` milliseconds (0 for no limit), 0 if a counterexample has been added to the inputs, -1 otherwise.
+          triton::sint32 verify(const triton::ast::SharedAbstractNode& candidate, const triton::ast::SharedAbstractNode& node, triton::uint32 timeout);
+
+          //! Sets the inputs of the enumeration: the extreme values of the variables, then pseudo random ones.
+          void initInputs(triton::usize samples);
+
+        public:
+          //! The maximum number of times the inputs are refined by a counterexample.
+          static const triton::usize maxRefinements = 8;
+
+          //! Constructor. At most `capacity` expressions are kept by an enumeration.
+          TRITON_EXPORT EnumerativeSynthesizer(triton::usize capacity=(1 << 18));
+
+          //! Synthesizes the smallest expression of at most `maxSize` nodes equivalent to `node`, within `timeout` milliseconds (0 for no limit), on `threads` threads (0 for one per core).
+          TRITON_EXPORT SynthesisResult synthesize(const triton::ast::SharedAbstractNode& node, triton::usize maxSize=7, triton::usize timeout=1000, triton::usize threads=1);
+
+          //! Returns the number of expressions kept by the last enumeration.
+          TRITON_EXPORT triton::usize getNumberOfTerms(void) const;
+
+          //! Returns the number of times the inputs have been refined by a counterexample during the last synthesis.
+          TRITON_EXPORT triton::usize getNumberOfRefinements(void) const;
+      };
+
+    /*! @} End of synthesis namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ENUMERATIVESYNTHESIZER_HPP */
@@ -216,6 +216,18 @@ namespace triton {
     };
 
 
+    /*! \class Loader
+     *  \brief The exception class used by the binary loader. */
+    class Loader : public triton::exceptions::Exception {
+      public:
+        //! Constructor.
+        TRITON_EXPORT Loader(const char* message) : triton::exceptions::Exception(message) {};
+
+        //! Constructor.
+        TRITON_EXPORT Loader(const std::string& message) : triton::exceptions::Exception(message) {};
+    };
+
+
     /*! \class Architecture
      *  \brief The exception class used by architectures. */
     class Architecture : public triton::exceptions::Exception {
@@ -0,0 +1,302 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_EXPLORER_HPP
+#define TRITON_EXPLORER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <triton/context.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/explorerEnums.hpp>
+#include <triton/instruction.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      //! Initializes a worker context: its architecture, modes and concrete state. Called once per worker.
+      using SetupHook = std::function<void(triton::Context& ctx)>;
+
+      //! Writes an input into a worker context and symbolizes it. Returns the variables of the input in order, each one covering its size in bytes of the input.
+      using InjectHook = std::function<std::vector<triton::engines::symbolic::SharedSymbolicVariable>(triton::Context& ctx, const std::vector<triton::uint8>& input)>;
+
+      //! Called after the processing of each instruction of a run. Returns true to end the run.
+      using TerminationHook = std::function<bool(triton::Context& ctx, const triton::arch::Instruction& inst)>;
+
+      //! Called once per run with its input and true if it covered new instructions or edges. Returns false to end the exploration.
+      using InputHook = std::function<bool(const std::vector<triton::uint8>& input, bool coverage)>;
+
+      //! The properties of a task, from which its priority is computed.
+      struct TaskInfo {
+        //! The generation of the input, 0 for the first one.
+        triton::usize depth;
+
+        //! The index of the first path constraint to flip.
+        triton::usize bound;
+
+        //! The number of new edges covered by the run which produced the task.
+        triton::usize edges;
+
+        //! The number of timeouts of the queries on the path prefix of the flip which produced the task.
+        triton::usize cost;
+
+        //! True if the task is a deferred flip, its input being run again to solve it.
+        bool deferred;
+      };
+
+      //! Returns a copy of `input` where the bytes of each variable, in order and little endian, are replaced by their value in `model`.
+      TRITON_EXPORT std::vector<triton::uint8> applyModel(const std::vector<triton::uint8>& input,
+                                                          const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables,
+                                                          const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model);
+
+      //! Returns the priority of a task with SCHEDULER_CUSTOM, the highest being run first. Called under the lock of the scheduler.
+      using PriorityHook = std::function<double(const TaskInfo& info)>;
+
+
+      /*! \class Explorer
+       *  \brief Explores the paths of a program concolically on a pool of worker contexts.
+       *
+       *  \details Each worker owns a Context initialized by the setup hook, then restored to this state
+       *  before each run. A run injects an input, processes the instructions from the entry point until
+       *  the termination hook returns true, a fault, or the limit of instructions, and then solves the
+       *  branches not taken by the path, from the bound of its input on (generational search). Each
+       *  model gives a new input, bounded to the branch after the flipped one, which is pushed to the
+       *  queue of the worker. A worker takes the last input of its own queue and steals the first one of
+       *  the other queues once its queue is empty.
+       *
+       *  The coverage of the instructions and the branches already flipped are shared: a branch is only
+       *  flipped by the first worker which reaches it. The hooks are called by the workers and must be
+       *  thread safe, except the input and priority hooks which are called under a lock.
+       *
+       *  The edges of a run are counted in an AFL-style bitmap of `edgeMapSize` entries indexed by the
+       *  hashes of the transitions of the control flow instructions, their hit counts being bucketed. The
+       *  buckets are merged into the shared bitmap, a new bucket being a new edge. With another scheduler
+       *  than SCHEDULER_DFS, the tasks are ordered by priority in one queue shared by the workers. With
+       *  SCHEDULER_COST, a flip whose path prefix holds the source of a query which timed out is not solved
+       *  at once but deferred, its input being run again once its task comes.
+       */
+      class Explorer {
+        public:
+          //! The number of entries of the edge bitmap.
+          static constexpr triton::usize edgeMapSize = 1 << 16;
+
+        private:
+          //! An input to run, its branches before `info.bound` being already flipped.
+          struct Task {
+            //! The input.
+            std::vector<triton::uint8> input;
+
+            //! The properties of the task.
+            TaskInfo info;
+
+            //! The index of the path constraint of a deferred flip.
+            triton::usize flip;
+
+            //! The branch of a deferred flip <source address : destination address>.
+            std::pair<triton::uint64, triton::uint64> edge;
+
+            //! The priority of the task in the shared queue.
+            double priority;
+
+            //! The order of the push of the task, the oldest being run first at a same priority.
+            triton::uint64 sequence;
+          };
+
+          //! Orders the shared queue, the task of the highest priority on top.
+          struct TaskOrder {
+            bool operator()(const Task& a, const Task& b) const {
+              return a.priority < b.priority || (a.priority == b.priority && a.sequence > b.sequence);
+            }
+          };
+
+          //! The queue of a worker.
+          struct Queue {
+            //! Guards the tasks.
+            std::mutex lock;
+
+            //! The tasks, taken from the back by the worker and stolen from the front.
+            std::deque<Task> tasks;
+          };
+
+          //! The hooks.
+          SetupHook setup;
+          InjectHook inject;
+          TerminationHook termination;
+          InputHook inputHook;
+          PriorityHook priorityHook;
+
+          //! The order of the tasks.
+          triton::engines::exploration::scheduler_e scheduler;
+
+          //! The number of workers, 0 for one per hardware thread.
+          triton::usize workers;
+
+          //! The maximum number of runs, 0 for unlimited.
+          triton::usize maxRuns;
+
+          //! The maximum number of instructions of a run.
+          triton::usize maxInstructions;
+
+          //! The timeout of a query in milliseconds, 0 for none.
+          triton::uint32 timeout;
+
+          //! The number of path constraints which may be flipped, 0 for all.
+          triton::usize maxDepth;
+
+          //! The queues of the workers, with SCHEDULER_DFS.
+          std::vector<std::unique_ptr<Queue>> queues;
+
+          //! The queue shared by the workers with the other schedulers, as a heap.
+          std::vector<Task> heap;
+
+          //! The number of tasks pushed.
+          triton::uint64 sequence;
+
+          //! Guards the shared state below.
+          std::mutex lock;
+
+          //! Signals a new task or the end of the exploration.
+          std::condition_variable changed;
+
+          //! The number of tasks queued or running.
+          triton::usize pending;
+
+          //! The number of tasks queued, a task being counted once visible in a queue.
+          triton::sint64 queued;
+
+          //! True once the exploration must end.
+          bool stopping;
+
+          //! The number of runs.
+          triton::usize runs;
+
+          //! The addresses of the instructions covered.
+          std::unordered_set<triton::uint64> coverage;
+
+          //! The branches flipped <source address : destination address>.
+          std::set<std::pair<triton::uint64, triton::uint64>> flipped;
+
+          //! The bucketed hit counts of the edges covered.
+          std::vector<triton::uint8> edges;
+
+          //! The number of timeouts of the queries of the branches <source address : timeouts>.
+          std::unordered_map<triton::uint64, triton::usize> timeouts;
+
+          //! The inputs run, in order.
+          std::vector<std::vector<triton::uint8>> inputs;
+
+          //! The first exception raised by a worker.
+          std::exception_ptr error;
+
+          //! Pushes a task to the queue of a worker.
+          void push(triton::usize worker, Task&& task);
+
+          //! Takes a task, stealing it if the queue of the worker is empty. Returns false once the exploration is ended.
+          bool take(triton::usize worker, Task& task);
+
+          //! Ends a task.
+          void finish(void);
+
+          //! Returns the priority of a task for the scheduler.
+          double getPriority(const TaskInfo& info) const;
+
+          //! Runs a task in a worker context, `trace` being the edge bitmap of the worker.
+          void run(triton::usize worker, triton::Context& ctx, const Task& task, std::vector<triton::uint8>& trace);
+
+          //! The loop of a worker.
+          void work(triton::usize worker, triton::uint64 entry);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT Explorer(const SetupHook& setup, const InjectHook& inject);
+
+          Explorer(const Explorer& other) = delete;
+          Explorer& operator=(const Explorer& other) = delete;
+
+          //! Sets the hook ending the runs.
+          TRITON_EXPORT void setTerminationHook(const TerminationHook& hook);
+
+          //! Sets the hook receiving the inputs run.
+          TRITON_EXPORT void setInputHook(const InputHook& hook);
+
+          //! Sets the number of workers, 0 for one per hardware thread.
+          TRITON_EXPORT void setWorkers(triton::usize count);
+
+          //! Sets the maximum number of runs, 0 for unlimited.
+          TRITON_EXPORT void setMaxRuns(triton::usize count);
+
+          //! Sets the maximum number of instructions of a run.
+          TRITON_EXPORT void setMaxInstructions(triton::usize count);
+
+          //! Sets the timeout of a query in milliseconds, 0 for none.
+          TRITON_EXPORT void setTimeout(triton::uint32 ms);
+
+          //! Sets the order of the tasks.
+          TRITON_EXPORT void setScheduler(triton::engines::exploration::scheduler_e scheduler);
+
+          //! Sets the hook computing the priorities of the tasks with SCHEDULER_CUSTOM.
+          TRITON_EXPORT void setPriorityHook(const PriorityHook& hook);
+
+          //! Sets the number of path constraints which may be flipped from the start of a path, 0 for all.
+          TRITON_EXPORT void setMaxDepth(triton::usize depth);
+
+          //! Explores the program from `entry`, starting with `input`. Returns the number of runs.
+          TRITON_EXPORT triton::usize explore(triton::uint64 entry, const std::vector<triton::uint8>& input);
+
+          //! Returns the addresses of the instructions covered by the last exploration.
+          TRITON_EXPORT const std::unordered_set<triton::uint64>& getCoverage(void) const;
+
+          //! Returns the inputs run by the last exploration, in the order of the runs.
+          TRITON_EXPORT const std::vector<std::vector<triton::uint8>>& getInputs(void) const;
+
+          //! Returns the number of entries of the edge bitmap covered by the last exploration.
+          TRITON_EXPORT triton::usize getEdgeCount(void) const;
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EXPLORER_HPP */
@@ -0,0 +1,52 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_EXPLORERENUMS_HPP
+#define TRITON_EXPLORERENUMS_HPP
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      /*! The orders of the tasks of an exploration */
+      enum scheduler_e {
+        SCHEDULER_DFS = 0,  /*!< The most recent inputs first, on the work-stealing queues of the workers. */
+        SCHEDULER_COVERAGE, /*!< The inputs of the runs which covered the most new edges first. */
+        SCHEDULER_BFS,      /*!< The inputs of the lowest generation first. */
+        SCHEDULER_COST,     /*!< The flips whose path prefix timed out the least first, the others being deferred. */
+        SCHEDULER_CUSTOM,   /*!< The order of the priority hook. */
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EXPLORERENUMS_HPP */
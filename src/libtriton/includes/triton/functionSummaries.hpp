@@ -0,0 +1,167 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_FUNCTIONSUMMARIES_H
+#define TRITON_FUNCTIONSUMMARIES_H
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/architecture.hpp>
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/modes.hpp>
+#include <triton/register.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/taintEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class FunctionSummaries
+     *  \brief The native summaries of the libc functions of the stubs.
+     *
+     *  \details When the instruction at a summarized address is processed, the whole function is applied at once
+     *  on the concrete, symbolic and taint states, then it returns to its caller. Concrete bytes are copied as
+     *  a block, symbolic bytes keep their expressions, and the results computed over symbolic bytes (e.g. `strlen`)
+     *  are `ite` chains over those bytes up to the concrete end of the data. Pointers and sizes are taken concrete.
+     */
+    class FunctionSummaries {
+      public:
+        //! The summarized functions.
+        enum summary_e {
+          SUMMARY_MEMCMP,   //!< `int memcmp(const void* s1, const void* s2, size_t n)`
+          SUMMARY_MEMCPY,   //!< `void* memcpy(void* dst, const void* src, size_t n)`
+          SUMMARY_MEMMOVE,  //!< `void* memmove(void* dst, const void* src, size_t n)`
+          SUMMARY_MEMSET,   //!< `void* memset(void* s, int c, size_t n)`
+          SUMMARY_STRCMP,   //!< `int strcmp(const char* s1, const char* s2)`
+          SUMMARY_STRCPY,   //!< `char* strcpy(char* dst, const char* src)`
+          SUMMARY_STRLEN,   //!< `size_t strlen(const char* s)`
+          SUMMARY_STRNCMP,  //!< `int strncmp(const char* s1, const char* s2, size_t n)`
+        };
+
+      private:
+        //! A summarized address.
+        struct Hook {
+          //! The function.
+          summary_e summary;
+
+          //! True if the function follows the Microsoft x64 calling convention.
+          bool msAbi;
+        };
+
+        //! Architecture API
+        triton::arch::Architecture* architecture;
+
+        //! Modes API
+        triton::modes::SharedModes modes;
+
+        //! AstContext API
+        triton::ast::SharedAstContext astCtxt;
+
+        //! Symbolic engine API
+        triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+        //! Taint engine API
+        triton::engines::taint::TaintEngine* taintEngine;
+
+        //! The summarized addresses <address : hook>.
+        std::unordered_map<triton::uint64, Hook> hooks;
+
+        //! The hook being applied.
+        const Hook* current;
+
+        //! Returns the summary of a function name, false if the function is not summarized.
+        static bool getSummary(const std::string& name, summary_e& summary);
+
+        //! Returns the register of the `index`-th argument, nullptr if the argument is on the stack.
+        const triton::arch::Register* getArgumentRegister(triton::uint32 index) const;
+
+        //! Returns the concrete value of the `index`-th argument.
+        triton::uint64 getArgument(triton::uint32 index);
+
+        //! Returns the AST of the `index`-th argument.
+        triton::ast::SharedAbstractNode getArgumentAst(triton::uint32 index);
+
+        //! Returns the AST of a memory byte, nullptr if the byte is concrete.
+        triton::ast::SharedAbstractNode getSymbolicByte(triton::uint64 addr);
+
+        //! Sets the return value, symbolic if `node` is symbolized, and its taint.
+        void setReturnValue(const triton::ast::SharedAbstractNode& node, bool tainted);
+
+        //! Returns to the caller.
+        void returnToCaller(void);
+
+        //! Copies `size` bytes from `src` to `dst`, overlapping areas included.
+        void copyMemory(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
+        //! Returns the number of bytes until the concrete null byte from `addr`.
+        triton::usize getStringLength(triton::uint64 addr);
+
+        //! Compares `size` bytes of `s1` and `s2`, up to a null byte if `string` is true. Returns the result as an AST.
+        triton::ast::SharedAbstractNode compareMemory(triton::uint64 s1, triton::uint64 s2, triton::usize size, bool string, bool& tainted);
+
+        //! The summaries.
+        void memcmp(void);
+        void memcpy(void);
+        void memset(void);
+        void strcmp(void);
+        void strcpy(void);
+        void strlen(void);
+        void strncmp(void);
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT FunctionSummaries(triton::arch::Architecture* architecture,
+                                        const triton::modes::SharedModes& modes,
+                                        const triton::ast::SharedAstContext& astCtxt,
+                                        triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                        triton::engines::taint::TaintEngine* taintEngine);
+
+        //! Summarizes the function `name` at `addr`. Raises an exception if the function has no summary.
+        TRITON_EXPORT void setFunctionSummary(triton::uint64 addr, const std::string& name, bool msAbi=false);
+
+        //! Summarizes the functions of a stubs symbols mapping loaded at `base`, the ones without summary are ignored. Returns the number of summarized functions.
+        TRITON_EXPORT triton::usize setFunctionSummaries(triton::uint64 base, const std::map<std::string, triton::uint64>& symbols, bool msAbi=false);
+
+        //! Removes the summary at `addr`.
+        TRITON_EXPORT void removeFunctionSummary(triton::uint64 addr);
+
+        //! Returns the summarized addresses <address : function name>.
+        TRITON_EXPORT std::map<triton::uint64, std::string> getFunctionSummaries(void) const;
+
+        //! Returns true if the address is summarized.
+        TRITON_EXPORT bool isSummarized(triton::uint64 addr) const;
+
+        //! Applies the summary of the function at the address of the instruction. Returns false if there is none, or if it can not be applied in the current modes.
+        TRITON_EXPORT bool apply(triton::arch::Instruction& inst);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_FUNCTIONSUMMARIES_H */
@@ -0,0 +1,147 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_FUZZERSYNC_HPP
+#define TRITON_FUZZERSYNC_HPP
+
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <triton/context.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/explorer.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      /*! \class FuzzerSync
+       *  \brief Assists a fuzzer concolically through its sync directory.
+       *
+       *  \details The instance is a fuzzer `name` of an AFL++ sync directory. `sync()` ingests the new entries
+       *  of the queues of the other fuzzers, `<syncDir>/<fuzzer>/queue/id:*`, and runs each one on a context
+       *  initialized once by the setup hook, with `Context::run` from the entry point.
+       *  The branches not taken whose edge was not taken by a run yet are solved at once with
+       *  `Context::solveAllBranchFlips`, and each model is written as a new entry of `<syncDir>/<name>/queue`,
+       *  renamed once complete so that the fuzzers never read a partial entry. The queue of the instance may also
+       *  be given to libFuzzer as a corpus reloaded with `-reload=1`. `solve()` does the same for one input
+       *  without the sync directory, e.g. in a custom mutator.
+       */
+      class FuzzerSync {
+        private:
+          //! The hooks.
+          SetupHook setup;
+          InjectHook inject;
+
+          //! The sync directory.
+          std::string syncDir;
+
+          //! The name of the instance in the sync directory.
+          std::string name;
+
+          //! The entry point of the runs.
+          triton::uint64 entry;
+
+          //! The context of the runs, initialized on first use.
+          std::unique_ptr<triton::Context> ctx;
+
+          //! The snapshot of the state of the setup.
+          triton::usize snapshot;
+
+          //! The number of solving threads, 0 for one per core.
+          triton::usize threads;
+
+          //! The timeout of a query in milliseconds, 0 for none.
+          triton::uint32 timeout;
+
+          //! The maximum number of instructions of a run.
+          triton::usize maxInstructions;
+
+          //! The addresses ending a run.
+          std::unordered_set<triton::uint64> stopAddresses;
+
+          //! The branches taken by the runs <source address : destination address>.
+          std::set<std::pair<triton::uint64, triton::uint64>> covered;
+
+          //! The branches solved <source address : destination address>.
+          std::set<std::pair<triton::uint64, triton::uint64>> flipped;
+
+          //! The queue entries ingested.
+          std::unordered_set<std::string> seen;
+
+          //! The id of the next entry written.
+          triton::usize nextId;
+
+          //! Initializes the context.
+          void prepare(void);
+
+          //! Writes an entry of the queue of the instance, `source` naming the entry it comes from.
+          void write(const std::vector<triton::uint8>& input, const std::string& source);
+
+        public:
+          //! Constructor. Creates the queue of the instance `name` in `syncDir`, its next id following its existing entries.
+          TRITON_EXPORT FuzzerSync(const std::string& syncDir, const std::string& name, triton::uint64 entry, const SetupHook& setup, const InjectHook& inject);
+
+          FuzzerSync(const FuzzerSync& other) = delete;
+          FuzzerSync& operator=(const FuzzerSync& other) = delete;
+
+          //! Sets the number of solving threads, 0 for one per core.
+          TRITON_EXPORT void setThreads(triton::usize count);
+
+          //! Sets the timeout of a query in milliseconds, 0 for none.
+          TRITON_EXPORT void setTimeout(triton::uint32 ms);
+
+          //! Sets the maximum number of instructions of a run.
+          TRITON_EXPORT void setMaxInstructions(triton::usize count);
+
+          //! Sets the addresses ending a run.
+          TRITON_EXPORT void setStopAddresses(const std::unordered_set<triton::uint64>& addresses);
+
+          //! Runs `input` and returns the inputs solved for its branches not covered yet.
+          TRITON_EXPORT std::vector<std::vector<triton::uint8>> solve(const std::vector<triton::uint8>& input);
+
+          //! Ingests the new entries of the queues of the other fuzzers. Returns the number of entries written.
+          TRITON_EXPORT triton::usize sync(void);
+
+          //! Returns the number of branches taken by the runs.
+          TRITON_EXPORT triton::usize getCoveredCount(void) const;
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_FUZZERSYNC_HPP */
@@ -0,0 +1,119 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_GDBREMOTE_HPP
+#define TRITON_GDBREMOTE_HPP
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  class Context;
+
+  //! The Loaders namespace
+  namespace loaders {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup loaders
+   *  @{
+   */
+
+    /*! \class GdbRemote
+     *  \brief A client of the GDB remote serial protocol, fetching the state of a stopped target on demand.
+     *
+     *  \details The target is a gdbserver or a QEMU gdb stub, whose registers are read by `g` packets and
+     *  memory by `m` packets. The no-ack mode is used if the stub supports it. A page is fetched the first
+     *  time it is asked for, along with the `prefetch` pages following it in as few packets as the packet
+     *  size of the stub allows: those are kept until they are asked for. The pages the target does not map
+     *  are remembered as such. The target must stay stopped while it is read, `flush()` forgets the pages
+     *  fetched once it ran.
+     */
+    class GdbRemote {
+      private:
+        //! The socket connected to the stub.
+        int socket;
+
+        //! True if the stub acknowledges the packets.
+        bool acks;
+
+        //! The largest packet accepted by the stub.
+        triton::usize packetSize;
+
+        //! The number of pages fetched after each page fault.
+        triton::usize prefetch;
+
+        //! The bytes received and not yet parsed.
+        std::string input;
+
+        //! The pages prefetched and not yet asked for <base address : content>.
+        std::unordered_map<triton::uint64, std::vector<triton::uint8>> pages;
+
+        //! The base addresses of the pages the target does not map.
+        std::unordered_map<triton::uint64, bool> unmapped;
+
+        //! The number of packets sent.
+        triton::usize packets;
+
+        //! The number of pages fetched from the target.
+        triton::usize fetched;
+
+        //! Returns the next byte received. Raises an exception if the connection is lost.
+        char receiveByte(void);
+
+        //! Sends a packet and returns the decoded reply.
+        std::string request(const std::string& command);
+
+        //! Reads `size` bytes of the memory from `addr` into `out`, in packets. Returns false if the target refuses.
+        bool readMemory(triton::uint64 addr, triton::usize size, triton::uint8* out);
+
+      public:
+        //! Constructor. Connects to the stub at `host:port`.
+        TRITON_EXPORT GdbRemote(const std::string& endpoint, triton::usize prefetch=4);
+
+        //! Destructor. Closes the connection, the target keeps running as it was.
+        TRITON_EXPORT ~GdbRemote();
+
+        GdbRemote(const GdbRemote& other) = delete;
+        GdbRemote& operator=(const GdbRemote& other) = delete;
+
+        //! Returns the raw register file of the target, as the reply of a `g` packet.
+        TRITON_EXPORT std::vector<triton::uint8> readRegisters(void);
+
+        //! Sets the concrete values of the general purpose registers, the program counter and the flags of `ctx` from the target. Returns the number of registers set.
+        TRITON_EXPORT triton::usize syncRegisters(triton::Context& ctx);
+
+        //! Returns the content of the page at `addr`, prefetching the following ones. Empty if the target does not map it.
+        TRITON_EXPORT std::vector<triton::uint8> fetchPage(triton::uint64 addr);
+
+        //! Forgets the pages fetched but not yet asked for, and the unmapped ones.
+        TRITON_EXPORT void flush(void);
+
+        //! Returns the number of packets sent.
+        TRITON_EXPORT triton::usize getNumberOfPackets(void) const;
+
+        //! Returns the number of pages fetched from the target.
+        TRITON_EXPORT triton::usize getNumberOfFetchedPages(void) const;
+    };
+
+  /*! @} End of loaders namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_GDBREMOTE_HPP */
@@ -0,0 +1,143 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_HEATMAP_H
+#define TRITON_HEATMAP_H
+
+#include <ostream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The heat of an address or of a basic block, see `HeatMap`.
+    struct HotSpot {
+      //! The number of executions.
+      triton::uint64 count = 0;
+
+      //! The cumulative time spent to build their semantics, in nanoseconds.
+      triton::uint64 time = 0;
+
+      //! The number of AST nodes created.
+      triton::uint64 nodes = 0;
+
+      //! The number of symbolic expressions created.
+      triton::uint64 expressions = 0;
+    };
+
+
+    /*! \class HeatMap
+     *  \brief The heat map of the processed code, per address and per basic block.
+     *
+     *  \details Each processed instruction adds its execution, the time spent to build its semantics and the AST nodes
+     *  and symbolic expressions it created to the counters of its address and of its basic block. A basic block starts
+     *  after a control flow instruction, or where the execution does not follow the previous instruction, and is named
+     *  by the address of its first instruction. With a sampling period of `n`, only one instruction out of `n` is
+     *  measured and its costs count `n` times, so the heat map can stay enabled at a fraction of the cost; the blocks
+     *  are still followed at each instruction.
+     */
+    class HeatMap {
+      private:
+        //! The heat of an address.
+        struct Entry {
+          //! The heat of the address.
+          HotSpot spot;
+
+          //! The first address of its basic block, the last time it was measured.
+          triton::uint64 block = 0;
+        };
+
+        //! True if the heat map is enabled.
+        bool enabled;
+
+        //! One instruction out of `period` is measured.
+        triton::uint32 period;
+
+        //! The number of instructions before the next measured one.
+        triton::uint32 countdown;
+
+        //! The first address of the current basic block.
+        triton::uint64 block;
+
+        //! The address following the previous instruction.
+        triton::uint64 next;
+
+        //! True if the next instruction starts a basic block.
+        bool leader;
+
+        //! The heat of the addresses <address : Entry>
+        std::unordered_map<triton::uint64, Entry> addresses;
+
+        //! The heat of the basic blocks <first address : HotSpot>
+        std::unordered_map<triton::uint64, HotSpot> blocks;
+
+      public:
+        //! Constructor. The heat map is disabled.
+        TRITON_EXPORT HeatMap();
+
+        //! Enables or disables the heat map, measuring one instruction out of `period`. Disabling clears it.
+        TRITON_EXPORT void enable(bool flag, triton::uint32 period=1);
+
+        //! Returns true if the heat map is enabled.
+        TRITON_EXPORT bool isEnabled(void) const;
+
+        //! Returns the sampling period.
+        TRITON_EXPORT triton::uint32 getPeriod(void) const;
+
+        //! Returns true if the next instruction is measured, see `record()`.
+        inline bool sample(void) {
+          if (this->enabled == false || --this->countdown != 0)
+            return false;
+          this->countdown = this->period;
+          return true;
+        }
+
+        //! Follows the basic blocks through an instruction which is not measured.
+        TRITON_EXPORT void follow(const triton::arch::Instruction& inst);
+
+        //! Records the costs of a measured instruction and follows the basic blocks through it.
+        TRITON_EXPORT void record(const triton::arch::Instruction& inst, triton::uint64 time, triton::uint64 nodes, triton::uint64 expressions);
+
+        //! Returns the heat of the addresses, or of the basic blocks, the hottest first. Only the `count` hottest are returned, all if 0.
+        TRITON_EXPORT std::vector<std::pair<triton::uint64, HotSpot>> getHotSpots(bool blocks=false, triton::usize count=0) const;
+
+        //! Writes the report of the basic blocks then of the addresses, the hottest first.
+        TRITON_EXPORT void exportReport(std::ostream& stream) const;
+
+        //! Writes the folded stacks of the addresses under their basic blocks, weighted by their time, as read by `flamegraph.pl`.
+        TRITON_EXPORT void exportFlameGraph(std::ostream& stream) const;
+
+        //! Clears the heat map.
+        TRITON_EXPORT void clear(void);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_HEATMAP_H */
@@ -10,9 +10,11 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <ostream>
 #include <set>
 #include <sstream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -57,7 +59,10 @@ namespace triton {
         triton::uint64 address;
 
         //! The disassembly of the instruction. This field is set at the disassembly level.
-        std::stringstream disassembly;
+        std::string disassembly;
+
+        //! The formatted disassembly shared by the symbolic expressions of the instruction, nullptr until the first one is added.
+        std::shared_ptr<const std::string> formattedDisassembly;
 
         //! The opcode of the instruction.
         triton::uint8 opcode[16];
@@ -117,6 +122,9 @@ namespace triton {
         //! Copies an Instruction
         void copy(const Instruction& other);
 
+        //! Moves an Instruction, its containers are taken without being copied.
+        void move(Instruction& other);
+
       public:
         //! A list of operands
         std::vector<triton::arch::OperandWrapper> operands;
@@ -136,9 +144,15 @@ namespace triton {
         //! Constructor by copy.
         TRITON_EXPORT Instruction(const Instruction& other);
 
+        //! Constructor by move.
+        TRITON_EXPORT Instruction(Instruction&& other) noexcept;
+
         //! Copies an Instruction.
         TRITON_EXPORT Instruction& operator=(const Instruction& other);
 
+        //! Moves an Instruction.
+        TRITON_EXPORT Instruction& operator=(Instruction&& other) noexcept;
+
         //! Destructor.
         TRITON_EXPORT ~Instruction();
 
@@ -304,7 +318,7 @@ namespace triton {
         //! Returns true if the instruction performs a write back. Mainly used for AArch64 instructions like LDR.
         TRITON_EXPORT bool isWriteBack(void) const;
 
-        //! Returns true if the instruction updates flags. Mainly used for AArch64 instructions like ADDS.
+        //! Returns true if the instruction updates flags (e.g AArch64: ADDS, x86: ADD, CMP, ...).
         TRITON_EXPORT bool isUpdateFlag(void) const;
 
         //! Returns true if it is a Thumb instruction.
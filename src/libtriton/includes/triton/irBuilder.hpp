@@ -8,15 +8,26 @@
 #ifndef TRITON_IRBUILDER_H
 #define TRITON_IRBUILDER_H
 
+#include <map>
+#include <string>
+#include <unordered_map>
+
 #include <triton/archEnums.hpp>
 #include <triton/architecture.hpp>
 #include <triton/basicBlock.hpp>
+#include <triton/concreteMemo.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/functionSummaries.hpp>
+#include <triton/heatMap.hpp>
 #include <triton/instruction.hpp>
 #include <triton/modes.hpp>
+#include <triton/semanticTemplate.hpp>
 #include <triton/semanticsInterface.hpp>
 #include <triton/symbolicEngine.hpp>
+#include <triton/syscallEmulator.hpp>
 #include <triton/taintEngine.hpp>
+#include <triton/x86ConcreteSemantics.hpp>
+#include <triton/x86TaintSemantics.hpp>
 
 
 
@@ -35,6 +46,21 @@ namespace triton {
    *  @{
    */
 
+    //! The profile of an instruction type, see `IrBuilder::enableProfiling()`.
+    struct InstructionProfile {
+      //! The number of instructions processed.
+      triton::uint64 count = 0;
+
+      //! The cumulative time spent to build their semantics, in nanoseconds.
+      triton::uint64 time = 0;
+
+      //! The number of AST nodes created.
+      triton::uint64 nodes = 0;
+
+      //! The number of symbolic expressions created.
+      triton::uint64 expressions = 0;
+    };
+
     /*! \class IrBuilder
      *  \brief The IR builder. */
     class IrBuilder {
@@ -54,9 +80,72 @@ namespace triton {
         //! Taint engine API
         triton::engines::taint::TaintEngine* taintEngine;
 
+        //! True if the semantics cache is enabled.
+        bool semanticsCacheEnabled;
+
+        //! The semantics cache <address : SemanticTemplate>
+        std::unordered_map<triton::uint64, triton::engines::symbolic::SemanticTemplate> semanticsCache;
+
+        //! The template being recorded.
+        triton::engines::symbolic::SemanticTemplate recording;
+
+        //! True if the semantics are profiled.
+        bool profilingEnabled;
+
+        //! The profile of the semantics <instruction type : profile>
+        std::map<triton::uint32, InstructionProfile> profile;
+
+        //! The heat map of the processed code.
+        triton::arch::HeatMap heatMap;
+
+        //! Builds the semantics of the instruction, see `buildSemantics()`.
+        triton::arch::exception_e processSemantics(triton::arch::Instruction& inst);
+
+        //! Builds the semantics of the instruction from the semantics cache. Returns false if they are not cached.
+        bool replaySemantics(triton::arch::Instruction& inst);
+
+        //! Starts recording the semantics of the instruction if they can be cached. Returns true if recording.
+        bool recordSemantics(const triton::arch::Instruction& inst);
+
+        //! Stops recording and caches the semantics of the instruction.
+        void storeSemantics(triton::arch::Instruction& inst, triton::arch::exception_e ret);
+
+        //! Returns true if a register of the operands or of their effective addresses is symbolized, or tainted. Only the taint matters with ONLY_ON_TAINTED.
+        bool isInputDependent(const triton::arch::Instruction& inst) const;
+
+        //! Emulates natively the instruction if it only touches concrete values. Returns false if it must go through the semantics.
+        bool emulateSemantics(triton::arch::Instruction& inst);
+
+        //! Returns true if the flags are deferred while a basic block is processed, see `SymbolicEngine::deferFlags()`.
+        bool isDeferringBlockFlags(void) const;
+
+        //! Builds the flags deferred by the basic block and stops deferring them.
+        void endBlockFlags(void);
+
+        //! Returns true if the executions of the instruction go through the concrete memo.
+        bool isMemoizing(const triton::arch::Instruction& inst) const;
+
+        //! Records the execution of the instruction in the concrete memo if its inputs are concrete.
+        void memoizeSemantics(triton::arch::Instruction& inst, triton::arch::exception_e ret);
+
+        //! Spreads the taint of the instruction without its semantics (TAINT_ONLY). Returns false if it must go through the semantics.
+        bool propagateTaint(triton::arch::Instruction& inst);
+
         //! Removes all symbolic expressions of an instruction.
         void removeSymbolicExpressions(triton::arch::Instruction& inst);
 
+        //! Collects all the nodes and removes all the symbolic expressions of an instruction.
+        void collectAllNodes(triton::arch::Instruction& inst);
+
+        //! Collects the unsymbolized nodes and removes the unsymbolized symbolic expressions of an instruction.
+        void collectUnsymbolizedNodes(triton::arch::Instruction& inst);
+
+        //! Returns true if a node of a set is symbolized.
+        template <typename T> bool hasSymbolizedNodes(const T& items) const;
+
+        //! Returns true if a node read by an instruction (register, memory or effective address) is symbolized.
+        bool hasSymbolizedInputs(triton::arch::Instruction& inst) const;
+
         //! Collects nodes from a set.
         template <typename T> void collectNodes(T& items) const;
 
@@ -79,6 +168,21 @@ namespace triton {
         //! x86 ISA builder.
         triton::arch::SemanticsInterface* x86Isa;
 
+        //! x86 native emulation of the concrete instructions.
+        triton::arch::x86::x86ConcreteSemantics* x86ConcreteIsa;
+
+        //! x86 taint propagation of the instructions, without their semantics.
+        triton::arch::x86::x86TaintSemantics* x86TaintIsa;
+
+        //! Native summaries of the libc functions.
+        triton::arch::FunctionSummaries* summaries;
+
+        //! Native emulation of the system calls.
+        triton::arch::SyscallEmulator* syscalls;
+
+        //! The memo of the concrete executions of the instructions.
+        triton::arch::ConcreteMemo* concreteMemo;
+
       public:
         //! Constructor.
         TRITON_EXPORT IrBuilder(triton::arch::Architecture* architecture,
@@ -101,6 +205,72 @@ namespace triton {
 
         //! Everything which must be done after building the semantics.
         TRITON_EXPORT void postIrInit(triton::arch::Instruction& inst);
+
+        //! Enables or disables the cache of lifted semantics, keyed by address and opcode. Disabling clears it.
+        TRITON_EXPORT void enableSemanticsCache(bool flag);
+
+        //! Returns true if the cache of lifted semantics is enabled.
+        TRITON_EXPORT bool isSemanticsCacheEnabled(void) const;
+
+        //! Returns the number of instructions in the cache of lifted semantics.
+        TRITON_EXPORT triton::usize getSemanticsCacheSize(void) const;
+
+        //! Drops the state of the last trace: the profile, the heat map, the concrete memo and the state of the emulated system calls. The cache of lifted semantics, the function summaries and the handlers and files of the system calls are kept.
+        TRITON_EXPORT void reset(void);
+
+        //! Clears the cache of lifted semantics.
+        TRITON_EXPORT void clearSemanticsCache(void);
+
+        //! Enables or disables the concrete memo, keeping at most `capacity` executions.
+        TRITON_EXPORT void enableConcreteMemo(bool flag, triton::usize capacity);
+
+        //! Returns true if the concrete memo is enabled.
+        TRITON_EXPORT bool isConcreteMemoEnabled(void) const;
+
+        //! Returns the statistics of the concrete memo.
+        TRITON_EXPORT triton::arch::ConcreteMemoStats getConcreteMemoStats(void) const;
+
+        //! Removes all executions of the concrete memo and resets its statistics.
+        TRITON_EXPORT void clearConcreteMemo(void);
+
+        //! Enables or disables the profiling of the semantics per instruction type. Disabling clears the profile.
+        TRITON_EXPORT void enableProfiling(bool flag);
+
+        //! Returns true if the semantics are profiled.
+        TRITON_EXPORT bool isProfilingEnabled(void) const;
+
+        //! Returns the profile of the semantics <instruction type : profile>.
+        TRITON_EXPORT const std::map<triton::uint32, InstructionProfile>& getProfile(void) const;
+
+        //! Clears the profile of the semantics.
+        TRITON_EXPORT void clearProfile(void);
+
+        //! Enables or disables the heat map per address and per basic block, measuring one instruction out of `period`. Disabling clears it.
+        TRITON_EXPORT void enableHeatMap(bool flag, triton::uint32 period=1);
+
+        //! Returns true if the heat map is enabled.
+        TRITON_EXPORT bool isHeatMapEnabled(void) const;
+
+        //! Returns the heat of the addresses, or of the basic blocks, the hottest first. Only the `count` hottest are returned, all if 0.
+        TRITON_EXPORT std::vector<std::pair<triton::uint64, triton::arch::HotSpot>> getHotSpots(bool blocks=false, triton::usize count=0) const;
+
+        //! Writes the heat map to the file `path`, as a report or as the folded stacks of a flame graph.
+        TRITON_EXPORT void exportHeatMap(const std::string& path, bool flameGraph=false) const;
+
+        //! Clears the heat map.
+        TRITON_EXPORT void clearHeatMap(void);
+
+        //! Returns the native summaries of the libc functions.
+        TRITON_EXPORT triton::arch::FunctionSummaries& getSummaries(void);
+
+        //! Returns the native emulation of the system calls.
+        TRITON_EXPORT triton::arch::SyscallEmulator& getSyscalls(void);
+
+        //! Returns true if the semantics of the instruction do not depend on concrete values, and so can be replayed.
+        TRITON_EXPORT bool isTemplatable(const triton::arch::Instruction& inst) const;
+
+        //! Returns true if the semantics of the instruction do not depend on concrete values, direct branches included, and so can be compiled.
+        TRITON_EXPORT bool isCompilable(const triton::arch::Instruction& inst) const;
     };
 
   /*! @} End of arch namespace */
@@ -11,6 +11,8 @@
 #include <triton/astContext.hpp>
 #include <triton/config.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/liftingToBTOR2.hpp>
+#include <triton/liftingToC.hpp>
 #include <triton/liftingToDot.hpp>
 #include <triton/liftingToPython.hpp>
 #include <triton/liftingToSMT.hpp>
@@ -18,6 +20,7 @@
 #include <triton/symbolicExpression.hpp>
 
 #ifdef TRITON_LLVM_INTERFACE
+  #include <triton/liftingToJIT.hpp>
   #include <triton/liftingToLLVM.hpp>
 #endif
 
@@ -50,8 +53,11 @@ namespace triton {
       /*! \brief The lifting engine class. */
       class LiftingEngine
         : public LiftingToSMT,
+          public LiftingToBTOR2,
+          public LiftingToC,
           public LiftingToDot,
           #ifdef TRITON_LLVM_INTERFACE
+          public LiftingToJIT,
           public LiftingToLLVM,
           #endif
           public LiftingToPython {
@@ -60,8 +66,11 @@ namespace triton {
           //! Constructor.
           TRITON_EXPORT LiftingEngine(const triton::ast::SharedAstContext& astCtxt, triton::engines::symbolic::SymbolicEngine* symbolic)
             : LiftingToSMT(astCtxt, symbolic),
+              LiftingToBTOR2(),
+              LiftingToC(astCtxt, symbolic),
               LiftingToDot(astCtxt, symbolic),
               #ifdef TRITON_LLVM_INTERFACE
+              LiftingToJIT(),
               LiftingToLLVM(),
               #endif
               LiftingToPython(astCtxt, symbolic) {
@@ -0,0 +1,106 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_LIFTINGTOBTOR2_HPP
+#define TRITON_LIFTINGTOBTOR2_HPP
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Lifters namespace
+    namespace lifters {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup lifters
+     *  @{
+     */
+
+      //! \class LiftingToBTOR2
+      /*! \brief The lifting to BTOR2 class.
+       *
+       * \details The nodes are visited children first with the references unrolled, and each node shared is given one line.
+       * The logical nodes are of sort `bitvec 1`, the arrays are states initialized to zero, and the symbolic variables are
+       * inputs. A logical root is a `bad` property, so that it is reachable iff the root is satisfiable, otherwise the root
+       * is an `output`. The quantifiers are not supported.
+       */
+      class LiftingToBTOR2 {
+        private:
+          //! The id of the next line.
+          triton::usize uniqueId;
+
+          //! The lines of the bitvector sorts, by size.
+          std::map<triton::uint32, triton::usize> bvSorts;
+
+          //! The lines of the array sorts, by index size.
+          std::map<triton::uint32, triton::usize> arraySorts;
+
+          //! The lines of the nodes lifted.
+          std::unordered_map<const triton::ast::AbstractNode*, triton::usize> nids;
+
+          //! The nodes bound by let, by name.
+          std::unordered_map<std::string, triton::ast::SharedAbstractNode> symbols;
+
+          //! Returns the line of the sort of `size` bits, which is printed if it is new.
+          triton::usize getBvSort(std::ostream& stream, triton::uint32 size);
+
+          //! Returns the line of the sort of the arrays indexed on `size` bits, which is printed if it is new.
+          triton::usize getArraySort(std::ostream& stream, triton::uint32 size);
+
+          //! Returns the line of the sort of `node`.
+          triton::usize getSort(std::ostream& stream, const triton::ast::SharedAbstractNode& node);
+
+          //! Prints a line `<nid> <op> <sid> <args>` and returns its nid.
+          triton::usize print(std::ostream& stream, const std::string& op, triton::usize sid, const std::vector<std::string>& args);
+
+          //! Prints the lines of `node` whose children are lifted, and returns the nid of its value.
+          triton::usize lift(std::ostream& stream, const triton::ast::SharedAbstractNode& node);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT LiftingToBTOR2();
+
+          //! Lifts an AST and all its references to BTOR2 format.
+          TRITON_EXPORT std::ostream& liftToBTOR2(std::ostream& stream, const triton::ast::SharedAbstractNode& node);
+
+          //! Lifts a symbolic expression and all its references to BTOR2 format.
+          TRITON_EXPORT std::ostream& liftToBTOR2(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr);
+      };
+
+    /*! @} End of lifters namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_LIFTINGTOBTOR2_HPP */
@@ -0,0 +1,85 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_LIFTINGTOC_HPP
+#define TRITON_LIFTINGTOC_HPP
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <triton/astContext.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Lifters namespace
+    namespace lifters {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup lifters
+     *  @{
+     */
+
+      //! \class LiftingToC
+      /*! \brief The lifting to C class.
+       *
+       * \details The lifted function takes the symbolic variables as arguments, in the order of their ids, in the smallest
+       * unsigned type holding them. The expressions referenced are printed as constants, and the subexpressions used several
+       * times are printed once, as temporaries. The 128-bit helpers are only defined when a bitvector is wider than 64 bits.
+       * The arrays and the bitvectors wider than 128 bits are not supported.
+       */
+      class LiftingToC {
+        private:
+          //! Reference to the context managing ast nodes.
+          triton::ast::SharedAstContext astCtxt;
+
+          //! Instance to the symbolic engine.
+          triton::engines::symbolic::SymbolicEngine* symbolic;
+
+          //! Defines the helpers of the signed, shift, division, rotation and swap operations on `width` bits.
+          void requiredFunctions(std::ostream& stream, triton::uint32 width);
+
+          //! Lifts `nodes` as one function, returning the value of the first node if `single` is true.
+          std::ostream& liftToC(std::ostream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes, const std::string& fname, bool icomment, bool single);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT LiftingToC(const triton::ast::SharedAstContext& astCtxt, triton::engines::symbolic::SymbolicEngine* symbolic);
+
+          //! Lifts an AST and all its references to a C function `fname` returning its value. If `icomment` is true, then print instructions assembly in expression comments.
+          TRITON_EXPORT std::ostream& liftToC(std::ostream& stream, const triton::ast::SharedAbstractNode& node, const std::string& fname="triton_expr", bool icomment=false);
+
+          //! Lifts several ASTs and all their references to a C function `fname` whose last arguments are the pointers `out_i` receiving the value of `nodes[i]`.
+          TRITON_EXPORT std::ostream& liftToC(std::ostream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes, const std::string& fname="triton_expr", bool icomment=false);
+      };
+
+    /*! @} End of lifters namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_LIFTINGTOC_HPP */
@@ -90,6 +90,9 @@ namespace triton {
 
           //! Lifts a symbolic expressions and all its references to Dot format.
           TRITON_EXPORT std::ostream& liftToDot(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr);
+
+          //! Lifts an AST and its references to Dot format, streamed breadth-first. At most `maxNodes` nodes are expanded (0 for unlimited), down to `maxDepth` (0 for unlimited); the children beyond are collapsed into summary nodes. The shared nodes are emitted once.
+          TRITON_EXPORT std::ostream& liftToDot(std::ostream& stream, const triton::ast::SharedAbstractNode& node, triton::usize maxNodes, triton::uint32 maxDepth=0) const;
       };
 
     /*! @} End of lifters namespace */
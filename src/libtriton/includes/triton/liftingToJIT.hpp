@@ -0,0 +1,125 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_LIFTINGTOJIT_HPP
+#define TRITON_LIFTINGTOJIT_HPP
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/basicBlock.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/register.hpp>
+#include <triton/tritonTypes.hpp>
+
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Lifters namespace
+    namespace lifters {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup lifters
+     *  @{
+     */
+
+      //! The native code of a basic block. It reads the values of its input registers and writes the values of its output registers.
+      using JitFunction = void (*)(const triton::uint64* inputs, triton::uint64* outputs);
+
+      //! A basic block compiled into native code.
+      struct CompiledBlock {
+        //! The opcodes of the instructions, one after the other.
+        std::vector<triton::uint8> opcodes;
+
+        //! The number of instructions.
+        triton::usize count;
+
+        //! The native code, nullptr if the block can not be compiled.
+        JitFunction function;
+
+        //! The registers read by the native code, in the order of its inputs.
+        std::vector<triton::arch::Register> inputs;
+
+        //! The registers written by the native code, in the order of its outputs.
+        std::vector<triton::arch::Register> outputs;
+
+        //! True if the block ends with a conditional branch.
+        bool branch;
+
+        //! Returns true if the block has been compiled from the same instructions.
+        TRITON_EXPORT bool matches(triton::arch::BasicBlock& block) const;
+      };
+
+      /*! \class LiftingToJIT
+       *  \brief The compilation of basic blocks into native code through the LLVM ORC JIT.
+       *
+       *  \details The ASTs of the registers written by a block are lifted to one LLVM function by `TritonToLLVM`,
+       *  compiled, and cached at the address of the block. A block whose instructions changed is compiled again.
+       */
+      class LiftingToJIT {
+        private:
+          //! The LLVM JIT, created at the first compilation.
+          std::unique_ptr<llvm::orc::LLJIT> jit;
+
+          //! The compiled blocks <address : CompiledBlock>
+          std::unordered_map<triton::uint64, CompiledBlock> compiledBlocks;
+
+          //! An unique id for the name of the native functions.
+          triton::usize uniqueFunctionId;
+
+          //! Fills the opcodes of the block.
+          void initCompiledBlock(CompiledBlock& compiled, triton::arch::BasicBlock& block) const;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT LiftingToJIT();
+
+          //! Compiles the ASTs `nodes` of the `outputs` registers of a block, whose symbolic variables `vars` stand for the `inputs` registers. The block is cached at `addr`.
+          TRITON_EXPORT const CompiledBlock& compileBlock(triton::arch::BasicBlock& block, triton::uint64 addr,
+                                                          const std::vector<triton::arch::Register>& inputs, const std::vector<triton::ast::SharedAbstractNode>& vars,
+                                                          const std::vector<triton::arch::Register>& outputs, const std::vector<triton::ast::SharedAbstractNode>& nodes,
+                                                          bool branch);
+
+          //! Caches a block which can not be compiled at `addr`, so that it is not lifted again.
+          TRITON_EXPORT void rejectBlock(triton::arch::BasicBlock& block, triton::uint64 addr);
+
+          //! Returns the block cached at `addr` if it has been compiled from the same instructions, nullptr otherwise.
+          TRITON_EXPORT const CompiledBlock* getCompiledBlock(triton::arch::BasicBlock& block, triton::uint64 addr) const;
+
+          //! Returns the number of cached blocks.
+          TRITON_EXPORT triton::usize getCompiledBlocksSize(void) const;
+
+          //! Removes all cached blocks. The native code already emitted is kept by the JIT.
+          TRITON_EXPORT void clearCompiledBlocks(void);
+      };
+
+    /*! @} End of lifters namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_LIFTINGTOJIT_HPP */
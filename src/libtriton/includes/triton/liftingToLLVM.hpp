@@ -11,6 +11,7 @@
 #include <map>
 #include <memory>
 #include <ostream>
+#include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
@@ -54,8 +55,14 @@ namespace triton {
           //! Lifts a abstract node and all its references to LLVM format. `fname` represents the name of the LLVM function.
           TRITON_EXPORT std::ostream& liftToLLVM(std::ostream& stream, const triton::ast::SharedAbstractNode& node, const char* fname="__triton", bool optimize=false);
 
+          //! Lifts several ASTs as one LLVM function `void fname(i64* inputs, i64* outputs, i8* memory)`. The symbolic variables are read from `inputs` in order of appearance, `outputs[i]` receives the value of `nodes[i]`, and the memory accesses are offsets from `memory`.
+          TRITON_EXPORT std::ostream& liftToLLVM(std::ostream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes, const char* fname="__triton", bool optimize=false);
+
           //! Lifts and simplify an AST using LLVM
           TRITON_EXPORT triton::ast::SharedAbstractNode simplifyAstViaLLVM(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Lifts and simplify several ASTs using LLVM. The ASTs are lifted into one module, which is optimized once.
+          TRITON_EXPORT std::vector<triton::ast::SharedAbstractNode> simplifyAstViaLLVM(const std::vector<triton::ast::SharedAbstractNode>& nodes) const;
       };
 
     /*! @} End of lifters namespace */
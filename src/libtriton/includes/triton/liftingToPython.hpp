@@ -57,7 +57,7 @@ namespace triton {
           //! Constructor.
           TRITON_EXPORT LiftingToPython(const triton::ast::SharedAstContext& astCtxt, triton::engines::symbolic::SymbolicEngine* symbolic);
 
-          //! Lifts a symbolic expression and all its references to Python format. If `icomment` is true, then print instructions assembly in expression comments.
+          //! Lifts a symbolic expression and all its references to Python format. If `icomment` is true, then print instructions assembly in expression comments. The subexpressions used several times are printed once, as temporaries.
           TRITON_EXPORT std::ostream& liftToPython(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool icomment=false);
       };
 
@@ -12,6 +12,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include <triton/context.hpp>
 
@@ -49,9 +50,15 @@ namespace triton {
         //! Map of triton symbolic variables.
         std::map<std::string, SharedAbstractNode> symvars;
 
+        //! Map of the LLVM values already converted, so a value used several times is converted once.
+        std::unordered_map<llvm::Value*, SharedAbstractNode> values;
+
         //! Converts nodes.
         triton::ast::SharedAbstractNode do_convert(llvm::Value* llvmnode);
 
+        //! Converts a node which is not converted yet.
+        triton::ast::SharedAbstractNode convertValue(llvm::Value* llvmnode);
+
         //! Gets or creates new symbolic variable.
         triton::ast::SharedAbstractNode var(const std::string& name, triton::uint32 varSize);
 
@@ -0,0 +1,105 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_MBA_NORMALIZER_H
+#define TRITON_MBA_NORMALIZER_H
+
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \class MbaNormalizer
+     *  \brief Normalizes the linear mixed boolean-arithmetic subtrees, in the spirit of SiMBA.
+     *
+     *  \details A linear MBA is a sum of bitwise expressions (`bvand`, `bvor`, `bvxor`, `bvnot`, ...) multiplied
+     *  by constants, through `bvadd`, `bvsub`, `bvneg` and `bvmul` by a constant. The operands of the bitwise
+     *  expressions, and the nodes which are not of these operators, are its atoms: they are treated as
+     *  variables, so that `((a * b) ^ c) + 2 * ((a * b) & c)` is linear over `a * b` and `c`.
+     *
+     *  Such an expression is the sum of the conjunctions of its atoms, each multiplied by a coefficient, plus
+     *  a constant. The coefficients are computed without a solver, by evaluating the expression on the
+     *  `2^n` inputs where each of its `n` atoms is 0 or 1. The expression is then rebuilt as this sum, or as a
+     *  constant plus one bitwise expression of up to three atoms multiplied by a constant, this bitwise
+     *  expression being the smallest of its truth table. The smallest rewriting replaces the subtree if it has
+     *  fewer nodes. The DAG is processed bottom-up without following references, the nodes are never modified.
+     */
+    class MbaNormalizer {
+      private:
+        //! An operation of the program evaluating a subtree.
+        struct Operation {
+          //! The operator, VARIABLE_NODE for an atom and BV_NODE for a constant.
+          triton::ast::ast_e type;
+
+          //! The operands, by index in the program.
+          std::vector<triton::usize> operands;
+
+          //! The index of the atom, or the constant, or the constant multiplier of BVMUL_NODE.
+          triton::uint64 value;
+        };
+
+        //! A linear MBA subtree compiled into a program.
+        struct Program {
+          //! The operations, the operands first.
+          std::vector<Operation> operations;
+
+          //! The atoms.
+          std::vector<SharedAbstractNode> atoms;
+
+          //! The operations of the nodes already compiled, in an arithmetic or a bitwise position.
+          std::unordered_map<const AbstractNode*, triton::usize> compiled[2];
+
+          //! The mask of the size of the subtree.
+          triton::uint64 mask;
+        };
+
+        //! Compiles `node`, in a bitwise position if `bitwise` is true. Returns false if the subtree is too large.
+        static bool compile(const SharedAbstractNode& node, bool bitwise, Program& program, triton::usize& index);
+
+        //! Returns the value of the program on the atoms whose bit is set in `inputs`.
+        static triton::uint64 run(const Program& program, triton::usize inputs, std::vector<triton::uint64>& values);
+
+        //! Returns the smallest rewriting of a linear MBA subtree, or null if it is not smaller.
+        static SharedAbstractNode normalizeLinear(const SharedAbstractNode& node);
+
+      public:
+        //! The maximum number of atoms of a linear MBA subtree.
+        static const triton::usize maxAtoms = 6;
+
+        //! The maximum number of operations of a linear MBA subtree.
+        static const triton::usize maxOperations = 256;
+
+        //! Returns `node` with its linear MBA subtrees normalized. `node` is not modified.
+        TRITON_EXPORT SharedAbstractNode normalize(const SharedAbstractNode& node) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_MBA_NORMALIZER_H */
@@ -0,0 +1,50 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_MEMORYRESOURCE_HPP
+#define TRITON_MEMORYRESOURCE_HPP
+
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    /*!
+     *  \brief Returns a new shared object allocated from `resource`, or on the heap if `resource` is nullptr.
+     *
+     *  \details The object and its reference counts are allocated in one block, given back to `resource`
+     *  when the last reference goes away. The resource must outlive the object.
+     */
+    template <typename T, typename... Args>
+    inline std::shared_ptr<T> allocateShared(std::pmr::memory_resource* resource, Args&&... args) {
+      if (resource == nullptr)
+        return std::make_shared<T>(std::forward<Args>(args)...);
+      return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(resource), std::forward<Args>(args)...);
+    }
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_MEMORYRESOURCE_HPP */
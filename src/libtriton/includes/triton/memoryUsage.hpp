@@ -0,0 +1,101 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_MEMORYUSAGE_HPP
+#define TRITON_MEMORYUSAGE_HPP
+
+#include <map>
+
+#include <triton/astEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  /*! \struct MemoryUsage
+   *  \brief The memory held by the engines of a context, as returned by triton::Context::getMemoryUsage().
+   *
+   *  \details The figures are kept up to date by the engines or read from the sizes of their containers,
+   *  so that they are cheap enough to be polled after each instruction. The bytes are estimates: they
+   *  count the objects and their main buffers, not the overhead of the allocator nor the buckets of the
+   *  hash maps. The pages shared with the snapshots are counted by each of them.
+   */
+  struct MemoryUsage {
+    //! The number of nodes alive per type <type : count>, the AST context being shared by the forks.
+    std::map<triton::ast::ast_e, triton::usize> astNodes;
+
+    //! The bytes of the nodes alive per type <type : bytes>.
+    std::map<triton::ast::ast_e, triton::usize> astNodesBytes;
+
+    //! The bytes of the children lists of the nodes.
+    triton::usize astChildrenBytes = 0;
+
+    //! The bytes of the parent maps of the nodes, an entry per child edge.
+    triton::usize astParentsBytes = 0;
+
+    //! The number of entries of the symbolic expressions map, some of them may be dead.
+    triton::usize symbolicExpressions = 0;
+
+    //! The bytes of the symbolic expressions and of their interned comments.
+    triton::usize symbolicExpressionsBytes = 0;
+
+    //! The number of entries of the symbolic variables map.
+    triton::usize symbolicVariables = 0;
+
+    //! The number of symbolic registers.
+    triton::usize symbolicRegisters = 0;
+
+    //! The number of symbolic bytes of memory.
+    triton::usize symbolicMemory = 0;
+
+    //! The bytes of the pages of the symbolic memory.
+    triton::usize symbolicMemoryBytes = 0;
+
+    //! The number of path constraints.
+    triton::usize pathConstraints = 0;
+
+    //! The number of pages of the concrete memory.
+    triton::usize concreteMemoryPages = 0;
+
+    //! The bytes of the pages of the concrete memory.
+    triton::usize concreteMemoryBytes = 0;
+
+    //! The number of tainted bytes of memory.
+    triton::usize taintedMemory = 0;
+
+    //! The bytes of the pages of the taint bitmap.
+    triton::usize taintedMemoryBytes = 0;
+
+    //! The number of tainted registers.
+    triton::usize taintedRegisters = 0;
+
+    //! The number of queries held by the query cache of the solver.
+    triton::usize queryCache = 0;
+
+    //! The number of models held by the counterexample cache of the solver.
+    triton::usize counterexampleCache = 0;
+
+    //! The number of instructions held by the semantics cache.
+    triton::usize semanticsCache = 0;
+
+    //! The number of executions held by the concrete memo.
+    triton::usize concreteMemo = 0;
+
+    //! The sum of the bytes above.
+    triton::usize totalBytes = 0;
+  };
+
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_MEMORYUSAGE_HPP */
@@ -13,6 +13,7 @@
 
 #include <triton/dllexport.hpp>
 #include <triton/modesEnums.hpp>
+#include <triton/tritonTypes.hpp>
 
 
 
@@ -42,6 +43,9 @@ namespace triton {
         //! The set of enabled modes
         std::unordered_set<triton::modes::mode_e> enabledModes;
 
+        //! Increased each time the set of enabled modes changes.
+        triton::usize version;
+
       public:
         //! Constructor.
         TRITON_EXPORT Modes();
@@ -60,6 +64,9 @@ namespace triton {
 
         //! Clears recorded modes.
         TRITON_EXPORT void clearModes(void);
+
+        //! Returns a number which increases each time the set of enabled modes changes.
+        TRITON_EXPORT triton::usize getVersion(void) const;
     };
 
     //! Shared Modes.
@@ -28,16 +28,32 @@ namespace triton {
     //! Enumerates all kinds of mode.
     enum mode_e {
       ALIGNED_MEMORY,                 //!< [symbolic] Keep a map of aligned memory.
+      AST_BALANCING,                  //!< [AST] Keep the chains of associative operators balanced when they are built, and flatten them before the queries are converted for the solver.
+      AST_CONCURRENT,                 //!< [AST] Let several threads build nodes in the same AST context, with thread-local ids and slabs and a sharded hash-consing.
+      AST_HASH_CONSING,               //!< [AST] Share the structurally identical nodes built by the AST context.
       AST_OPTIMIZATIONS,              //!< [AST] Classical arithmetic optimisations to reduce the depth of the trees.
+      AST_SLAB_ALLOCATOR,             //!< [AST] Allocate the nodes in slabs owned by the AST context instead of the heap.
+      AST_WIDE_HASH,                  //!< [AST] Compute the 512-bit hash of the nodes in addition to the 64-bit one, for the comparisons where collisions matter.
+      BULK_STRING_INSTRUCTIONS,       //!< [symbolic] Execute the x86 string instructions with a REP prefix and a concrete counter in one processing, building expressions only for the symbolic elements.
+      CONCRETE_FAST_PATH,             //!< [symbolic] Emulate natively the common x86 instructions whose operands are neither symbolized nor tainted, without building their expressions.
       CONCRETIZE_UNDEFINED_REGISTERS, //!< [symbolic] Concretize every registers tagged as undefined (see #750).
       CONSTANT_FOLDING,               //!< [symbolic] Perform a constant folding optimization of sub ASTs which do not contain symbolic variables.
+      EFFECTIVE_ADDRESS_CACHE,        //!< [symbolic] Reuse the effective address AST of a memory operand while its base, index and segment registers are unchanged.
+      LAZY_FLAGS,                     //!< [symbolic] Build the flag expressions of arithmetic instructions only once a flag is read or the basic block ends.
+      LAZY_SUBREGISTERS,              //!< [symbolic] Keep the writes of the byte and word sub-registers apart from their parent until the parent is read across them.
+      LOOP_SUMMARIZATION,             //!< [symbolic] Detect the loops closed by a branch going back, summarize their path constraints and induction registers, and concretize them past an unroll bound.
+      MBA_SIMPLIFICATION,             //!< [symbolic] Normalize the linear mixed boolean-arithmetic subtrees in simplify() by their coefficients over the conjunctions of their atoms.
       MEMORY_ARRAY,                   //!< [symbolic] Enable memory symbolic array
-      ONLY_ON_SYMBOLIZED,             //!< [symbolic] Perform symbolic execution only on symbolized expressions.
-      ONLY_ON_TAINTED,                //!< [symbolic] Perform symbolic execution only on tainted instructions.
+      ONLY_ON_SYMBOLIZED,             //!< [symbolic] Perform symbolic execution only on symbolized expressions. Implies CONCRETE_FAST_PATH.
+      ONLY_ON_TAINTED,                //!< [symbolic] Perform symbolic execution only on tainted instructions. Implies CONCRETE_FAST_PATH for the untainted ones.
+      PC_DEDUPLICATION,               //!< [symbolic] Do not push a path constraint taking the same branch as one of the path under a structurally equal predicate.
       PC_TRACKING_SYMBOLIC,           //!< [symbolic] Track path constraints only if they are symbolized.
+      POINTER_RESOLUTION,             //!< [symbolic] Resolve the symbolic pointers to their addresses, up to a bound, and read or write them through an `ite` on the pointer instead of concretizing it.
+      STATE_MERGING,                  //!< [symbolic] Merge the sides of the short forward branches with a symbolic condition at their join point, with `ite` on the branch predicate, so that one state continues.
       SYMBOLIZE_INDEX_ROTATION,       //!< [symbolic] Symbolize index rotation for bvrol and bvror (see #751). This mode increases the complexity of solving.
       SYMBOLIZE_LOAD,                 //!< [symbolic] Symbolize memory load if memory array is enabled
       SYMBOLIZE_STORE,                //!< [symbolic] Symbolize memory store if memory array is enabled
+      TAINT_ONLY,                     //!< [taint] Spread the taint of the common x86 instructions from their operands without building their semantics. The concrete state is left to the caller.
       TAINT_THROUGH_POINTERS,         //!< [taint] Spread the taint if an index pointer is already tainted (see #725).
     };
 
@@ -0,0 +1,156 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_PASSMANAGER_HPP
+#define TRITON_PASSMANAGER_HPP
+
+#include <memory>
+#include <set>
+#include <vector>
+
+#include <triton/basicBlock.hpp>
+#include <triton/callbacks.hpp>
+#include <triton/context.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/symbolicEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! The statistics of the last run of a PassManager.
+      struct PassStatistics {
+        //! The number of instructions of the region.
+        triton::usize instructions;
+
+        //! The number of instructions kept, the padding excluded.
+        triton::usize kept;
+
+        //! The number of instructions removed by PASS_DEAD_STORES.
+        triton::usize deadStores;
+
+        //! The number of conditional branches resolved by PASS_OPAQUE_PREDICATES.
+        triton::usize opaquePredicates;
+
+        //! The number of conditional branches whose condition varies on the samples of PASS_OPAQUE_PREDICATES, rejected without solver query.
+        triton::usize sampledPredicates;
+
+        //! The number of blocks no longer reachable from the first block once the opaque predicates are resolved.
+        triton::usize unreachableBlocks;
+
+        //! The number of instructions removed by PASS_REDUNDANT_WRITES.
+        triton::usize redundantWrites;
+      };
+
+
+      /*! \class PassManager
+       *  \brief Runs a pipeline of optimization passes over a region of basic blocks.
+       *
+       *  \details The region is lifted once on a context of the manager whose registers and loaded memory
+       *  are symbolized, from the concrete state of the context given to the constructor, so that the passes
+       *  hold for any input of the region. The passes then run in the order of `addPass()` on the lifted
+       *  instructions, without processing them again. The first block is the entry of the region. As the
+       *  instructions are not rewritten, a branch always taken is kept while a branch never taken is removed,
+       *  and a block reachable only through the side never taken is emptied.
+       */
+      class PassManager {
+        private:
+          //! The context whose concrete state the regions start from.
+          triton::Context& ctx;
+
+          //! The context lifting the region of the current run.
+          std::unique_ptr<triton::Context> lifter;
+
+          //! The passes, in order.
+          std::vector<triton::engines::symbolic::pass_e> passes;
+
+          //! The statistics of the last run.
+          PassStatistics stats;
+
+          //! The timeout of a query of PASS_OPAQUE_PREDICATES in milliseconds, 0 for none.
+          triton::uint32 timeout;
+
+          //! True while the load callback symbolizes a memory cell.
+          bool symbolizing;
+
+          //! Symbolizes the memory cells loaded by the region.
+          triton::callbacks::getConcreteMemoryValueCallback loadCallback;
+
+          //! Lifts `region` on a new lifter.
+          void lift(std::vector<triton::arch::BasicBlock>& region);
+
+          //! Resolves the conditional branches of `region` whose condition is constant. The branches never taken are added to `removed`.
+          void removeOpaquePredicates(std::vector<triton::arch::BasicBlock>& region, std::set<triton::uint64>& removed);
+
+          //! Removes the instructions of `region` writing the values already held.
+          void removeRedundantWrites(std::vector<triton::arch::BasicBlock>& region);
+
+          //! Removes the instructions of `region` whose writes are dead.
+          void removeDeadStores(std::vector<triton::arch::BasicBlock>& region);
+
+          //! Symbolizes the bytes of a load which are not symbolic yet.
+          void symbolizeLoad(triton::Context& lifter, const triton::arch::MemoryAccess& mem);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT PassManager(triton::Context& ctx);
+
+          PassManager(const PassManager& other) = delete;
+          PassManager& operator=(const PassManager& other) = delete;
+
+          //! Adds a pass at the end of the pipeline. A pass may be added several times.
+          TRITON_EXPORT void addPass(triton::engines::symbolic::pass_e pass);
+
+          //! Removes all the passes.
+          TRITON_EXPORT void clearPasses(void);
+
+          //! Returns the passes, in order.
+          TRITON_EXPORT const std::vector<triton::engines::symbolic::pass_e>& getPasses(void) const;
+
+          //! Sets the timeout of a query of PASS_OPAQUE_PREDICATES in milliseconds, 0 for none.
+          TRITON_EXPORT void setTimeout(triton::uint32 ms);
+
+          //! Runs the passes on a region of blocks. If `padding` is true, keep addresses aligned and padds with NOP instructions. Returns the optimized blocks in order.
+          TRITON_EXPORT std::vector<triton::arch::BasicBlock> run(const std::vector<triton::arch::BasicBlock>& region, bool padding=false);
+
+          //! Runs the passes on a block. If `padding` is true, keep addresses aligned and padds with NOP instructions.
+          TRITON_EXPORT triton::arch::BasicBlock run(const triton::arch::BasicBlock& block, bool padding=false);
+
+          //! Returns the statistics of the last run.
+          TRITON_EXPORT const PassStatistics& getStatistics(void) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PASSMANAGER_HPP */
@@ -8,12 +8,19 @@
 #ifndef TRITON_PATHMANAGER_H
 #define TRITON_PATHMANAGER_H
 
+#include <memory>
+#include <ostream>
+#include <unordered_map>
 #include <vector>
 
+#include <triton/copyOnWrite.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/instruction.hpp>
 #include <triton/modes.hpp>
 #include <triton/pathConstraint.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/solverSession.hpp>
 #include <triton/symbolicExpression.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -42,6 +49,27 @@ namespace triton {
      *  @{
      */
 
+      //! A branch of the path which was not taken, and the model reaching it.
+      struct BranchFlip {
+        //! The index of the path constraint of the branch.
+        triton::usize index;
+
+        //! The source address of the branch.
+        triton::uint64 srcAddr;
+
+        //! The destination address of the branch.
+        triton::uint64 dstAddr;
+
+        //! The status of the query.
+        triton::engines::solver::status_e status;
+
+        //! The model reaching the branch, empty if there is none.
+        std::unordered_map<triton::usize, triton::engines::solver::SolverModel> model;
+
+        //! The solving time of the query.
+        triton::uint32 solvingTime;
+      };
+
       /*! \class PathManager
           \brief The path manager class. */
       class PathManager {
@@ -52,9 +80,105 @@ namespace triton {
           //! AstContext API
           triton::ast::SharedAstContext astCtxt;
 
+          //! The incremental solving session of the path, nullptr if disabled. It is not copied, and keeps its own constraints until a query.
+          std::shared_ptr<triton::engines::solver::SolverSession> solverSession;
+
+          //! Asserts the first `index` path constraints in the solving session.
+          void synchronizeSession(triton::usize index);
+
+          //! The number of conjunctions of the same size merged into a larger one.
+          static const triton::usize conjunctionArity = 16;
+
+          //! A balanced conjunction of `size` consecutive taken predicates. `size` is a power of the arity, and the children of a conjunction are its conjunctions of the lower size.
+          struct Conjunction {
+            //! The conjunction, or the taken predicate itself if `size` is 1.
+            triton::ast::SharedAbstractNode node;
+
+            //! The number of path constraints in the conjunction.
+            triton::usize size;
+          };
+
+          //! The balanced conjunctions of the path constraints, in order and by decreasing size, built lazily (shared copy-on-write between copies).
+          mutable triton::utils::CopyOnWrite<std::vector<Conjunction>> conjunctions;
+
+          //! The number of path constraints in the conjunctions.
+          mutable triton::usize conjunctionsSize;
+
+          //! The current path predicate, nullptr until it is built again.
+          mutable triton::ast::SharedAbstractNode pathPredicate;
+
+          //! Adds the path constraints pushed since the last call to the conjunctions.
+          void extendConjunctions(void) const;
+
+          //! Removes the path constraints popped since the last call from the conjunctions.
+          void truncateConjunctions(void);
+
+          //! Returns the conjunction of `(= true true)`, the first `index` path constraints and `node` if defined.
+          triton::ast::SharedAbstractNode buildPredicate(triton::usize index, const triton::ast::SharedAbstractNode& node) const;
+
+          //! The indexes of the path constraints by the key of their taken branch, built lazily while PC_DEDUPLICATION is enabled (shared copy-on-write between copies).
+          triton::utils::CopyOnWrite<std::unordered_multimap<triton::uint64, triton::usize>> takenIndexes;
+
+          //! The number of path constraints in the indexes.
+          triton::usize takenIndexesSize;
+
+          //! The indexes of the path constraints of each thread, in order, built lazily (shared copy-on-write between copies).
+          mutable triton::utils::CopyOnWrite<std::unordered_map<triton::uint32, std::vector<triton::usize>>> threadIndexes;
+
+          //! The number of path constraints in the indexes of the threads.
+          mutable triton::usize threadIndexesSize;
+
+          //! Adds the path constraints pushed since the last call to the indexes of the threads.
+          void extendThreadIndexes(void) const;
+
+          //! A branch of the path, by the index of its path constraint and its position in the constraint.
+          struct BranchPosition {
+            //! The index of the path constraint.
+            triton::usize index;
+
+            //! The position of the branch in the path constraint.
+            triton::usize branch;
+          };
+
+          //! The branches of the path by source address, in order, built lazily (shared copy-on-write between copies).
+          mutable triton::utils::CopyOnWrite<std::unordered_map<triton::uint64, std::vector<BranchPosition>>> sourceIndexes;
+
+          //! The branches of the path by destination address, in order, built lazily (shared copy-on-write between copies).
+          mutable triton::utils::CopyOnWrite<std::unordered_map<triton::uint64, std::vector<BranchPosition>>> destinationIndexes;
+
+          //! The indirect branches of the path, which may reach any address, in order (shared copy-on-write between copies).
+          mutable triton::utils::CopyOnWrite<std::vector<BranchPosition>> indirectBranches;
+
+          //! The number of path constraints in the indexes of the branches.
+          mutable triton::usize branchIndexesSize;
+
+          //! Adds the path constraints pushed since the last call to the indexes of the branches.
+          void extendBranchIndexes(void) const;
+
+          //! Removes the branches of the last path constraint from the indexes of the branches.
+          void truncateBranchIndexes(void);
+
+          //! The number of recent path constraints kept when the older ones are summarized, 0 if the path is not windowed.
+          triton::usize windowSize;
+
+          //! Returns true if a path constraint of the path takes the same branch as `pco` under a structurally equal predicate.
+          bool isDuplicatedPathConstraint(const triton::engines::symbolic::PathConstraint& pco);
+
+          //! Appends a path constraint, unless it is duplicated while PC_DEDUPLICATION is enabled, and summarizes the path beyond its window.
+          void appendPathConstraint(const triton::engines::symbolic::PathConstraint& pco);
+
         protected:
-          //! \brief The logical conjunction vector of path constraints.
-          std::vector<triton::engines::symbolic::PathConstraint> pathConstraints;
+          //! \brief The logical conjunction vector of path constraints (shared copy-on-write between copies).
+          triton::utils::CopyOnWrite<std::vector<triton::engines::symbolic::PathConstraint>> pathConstraints;
+
+          //! The path constraints of the branches whose sides were merged, in order (shared copy-on-write between copies).
+          triton::utils::CopyOnWrite<std::vector<triton::engines::symbolic::PathConstraint>> mergedConstraints;
+
+          //! The stream of the SMT export, nullptr if disabled. The path constraints are asserted as they are pushed. It is not copied.
+          std::ostream* smtStream;
+
+          //! Writes the assertion of the taken predicate of `pco` to the SMT stream.
+          void streamPathConstraint(const triton::engines::symbolic::PathConstraint& pco);
 
         public:
           //! Constructor.
@@ -78,12 +202,27 @@ namespace triton {
           //! Returns the logical conjunction vector of path constraint of a given thread.
           TRITON_EXPORT std::vector<triton::engines::symbolic::PathConstraint> getPathConstraintsOfThread(triton::uint32 threadId) const;
 
-          //! Returns the current path predicate as an AST of logical conjunction of each taken branch.
+          //! Returns the indexes in the path of the path constraints of a given thread, in order.
+          TRITON_EXPORT std::vector<triton::usize> getPathConstraintIndexesOfThread(triton::uint32 threadId) const;
+
+          //! Returns the ids of the threads of the path constraints, sorted.
+          TRITON_EXPORT std::vector<triton::uint32> getPathConstraintThreads(void) const;
+
+          //! Returns the logical conjunction of the taken branches of a given thread. The constraints of the other threads are ignored.
+          TRITON_EXPORT triton::ast::SharedAbstractNode getPathPredicateOfThread(triton::uint32 threadId) const;
+
+          //! Returns the current path predicate as an AST of logical conjunction of each taken branch. The conjunction is balanced, and kept until the path changes.
           TRITON_EXPORT triton::ast::SharedAbstractNode getPathPredicate(void) const;
 
-          //! Returns path predicates which may reach the targeted address.
+          //! Returns the nodes whose conjunction is the predicate of the first `index` path constraints. They are kept between the calls, so the predicates of two prefixes share their common nodes.
+          TRITON_EXPORT std::vector<triton::ast::SharedAbstractNode> getPrefixConjunctions(triton::usize index) const;
+
+          //! Returns path predicates which may reach the targeted address. The branches are found through an index of their addresses, and the predicates share the conjunctions of the path.
           TRITON_EXPORT std::vector<triton::ast::SharedAbstractNode> getPredicatesToReachAddress(triton::uint64 addr) const;
 
+          //! Returns the path predicates which may reach each targeted address, in the order of `addrs`.
+          TRITON_EXPORT std::vector<std::vector<triton::ast::SharedAbstractNode>> getPredicatesToReachAddresses(const std::vector<triton::uint64>& addrs) const;
+
           //! Pushs constraints of a branch instruction to the path predicate.
           TRITON_EXPORT void pushPathConstraint(const triton::arch::Instruction& inst, const triton::engines::symbolic::SharedSymbolicExpression& expr);
 
@@ -98,6 +237,33 @@ namespace triton {
 
           //! Clears the current path predicate.
           TRITON_EXPORT void clearPathConstraints(void);
+
+          //! Moves the last path constraint to the merged ones, its sides being merged into one state (see STATE_MERGING). It is no longer in the path predicate.
+          TRITON_EXPORT void mergePathConstraint(void);
+
+          //! Returns the path constraints of the branches whose sides were merged, in order.
+          TRITON_EXPORT const std::vector<triton::engines::symbolic::PathConstraint>& getMergedPathConstraints(void) const;
+
+          //! Replaces the first `count` path constraints by a single one, the conjunction of their taken predicates. The path predicate is the same, but the branches of these constraints can no longer be flipped.
+          TRITON_EXPORT void summarizePathConstraints(triton::usize count);
+
+          //! Sets the number of recent path constraints kept, 0 to disable. Past twice as many, the older ones are summarized into the first path constraint.
+          TRITON_EXPORT void setPathConstraintsWindow(triton::usize size);
+
+          //! Returns the number of recent path constraints kept, 0 if the path is not windowed.
+          TRITON_EXPORT triton::usize getPathConstraintsWindow(void) const;
+
+          //! Sets the incremental solving session of the path, nullptr to disable it.
+          TRITON_EXPORT void setSolverSession(const std::shared_ptr<triton::engines::solver::SolverSession>& session);
+
+          //! Returns true if an incremental solving session is set.
+          TRITON_EXPORT bool isSolverSessionDefined(void) const;
+
+          //! Computes and returns a model of `node` under the first `index` path constraints, with the incremental solving session. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::solver::SolverModel> getModelOfPath(triton::usize index, const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr);
+
+          //! Returns true if `node` is satisfiable under the first `index` path constraints, with the incremental solving session.
+          TRITON_EXPORT bool isSatOfPath(triton::usize index, const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr);
       };
 
     /*! @} End of symbolic namespace */
@@ -0,0 +1,93 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_PERSISTENTDECODECACHE_HPP
+#define TRITON_PERSISTENTDECODECACHE_HPP
+
+#include <string>
+
+#include <triton/archEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! Used to rebuild the registers of the operands.
+    class CpuInterface;
+
+    /*! \class PersistentDecodeCache
+     *  \brief A cache of disassembled instructions kept in a file, shared by the processes analyzing the same code.
+     *
+     *  \details The file is a fixed-size hash table mapped in memory. Each slot holds a compact record of a
+     *  disassembled instruction: its opcode, its attributes and its operands, the registers being kept by id.
+     *  A slot is keyed by the address, the architecture and the mode of the instruction, and only used if the
+     *  opcode to disassemble starts with the bytes it was decoded from. A slot is claimed atomically and only
+     *  published once written, so that concurrent processes can fill the same file. When the probed slots are
+     *  all taken, the instruction is not recorded.
+     */
+    class PersistentDecodeCache {
+      private:
+        //! The mapped file.
+        triton::uint8* data;
+
+        //! The size of the mapped file.
+        triton::usize size;
+
+        //! The number of slots of the file.
+        triton::usize slots;
+
+        //! The architecture of the recorded instructions.
+        triton::arch::architecture_e arch;
+
+        //! The CPU whose registers are used by the operands.
+        const triton::arch::CpuInterface& cpu;
+
+        //! Returns the slot at `index`.
+        triton::uint8* getSlot(triton::usize index) const;
+
+      public:
+        //! Constructor. Maps the file at `path`, creating it with `slots` slots if it does not exist.
+        TRITON_EXPORT PersistentDecodeCache(const std::string& path, triton::arch::architecture_e arch, const triton::arch::CpuInterface& cpu, triton::usize slots=65536);
+
+        //! Destructor.
+        TRITON_EXPORT ~PersistentDecodeCache();
+
+        PersistentDecodeCache(const PersistentDecodeCache& other) = delete;
+        PersistentDecodeCache& operator=(const PersistentDecodeCache& other) = delete;
+
+        //! Returns the number of slots of the file.
+        TRITON_EXPORT triton::usize getCapacity(void) const;
+
+        //! Sets up the instruction from the file and returns true if it has been decoded before in the same mode.
+        TRITON_EXPORT bool load(triton::arch::Instruction& inst, bool thumb=false) const;
+
+        //! Records a disassembled instruction, unless it does not fit in a slot.
+        TRITON_EXPORT void store(const triton::arch::Instruction& inst, bool thumb=false);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PERSISTENTDECODECACHE_HPP */
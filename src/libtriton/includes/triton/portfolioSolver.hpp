@@ -0,0 +1,113 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_PORTFOLIOSOLVER_HPP
+#define TRITON_PORTFOLIOSOLVER_HPP
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/bitwuzlaSolver.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverInterface.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+#include <triton/z3Solver.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class PortfolioSolver
+       *  \brief Solver engine racing z3 and Bitwuzla.
+       *
+       *  \details Each query runs on z3 in the calling thread and on Bitwuzla in another thread. The first
+       *  definitive answer (SAT or UNSAT) is returned and interrupts the other solver. If none is definitive,
+       *  the answer of z3 is returned.
+       */
+      class PortfolioSolver : public SolverInterface {
+        private:
+          //! The z3 solver.
+          triton::engines::solver::Z3Solver z3;
+
+          //! The Bitwuzla solver.
+          triton::engines::solver::BitwuzlaSolver bitwuzla;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT PortfolioSolver();
+
+          //! Computes and returns a model from a symbolic constraint. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes and returns several models from a symbolic constraint. Both searches stop with an unknown status once `interrupt` is interrupted, from another thread.
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime, triton::engines::solver::SolverInterrupt* interrupt) const;
+
+          //! Enumerates the models of a symbolic constraint on z3 only, as the callback cannot receive the models of two racing searches.
+          TRITON_EXPORT triton::usize enumerateModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, const ModelCallback& callback, triton::uint32 limit = 0, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns true if an expression is satisfiable.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns the name of this solver.
+          TRITON_EXPORT std::string getName(void) const;
+
+          //! Defines the timeout of both solvers (in milliseconds).
+          TRITON_EXPORT void setTimeout(triton::uint32 ms);
+
+          //! Defines the memory consumption limit of both solvers (in megabytes).
+          TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
+
+          //! Sets the configurations of the classes of queries of both solvers.
+          TRITON_EXPORT void setQueryConfigurations(const triton::engines::solver::QueryConfigurations& configurations);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PORTFOLIOSOLVER_HPP */
@@ -63,6 +63,9 @@ namespace triton {
       //! Initializes the CALLBACK python namespace.
       void initCallbackNamespace(PyObject* callbackDict);
 
+      //! Initializes the CONCRETIZATION python namespace.
+      void initConcretizationNamespace(PyObject* concretizationDict);
+
       //! Initializes the CONDITION python namespace.
       void initConditionsNamespace(PyObject* conditionsDict);
 
@@ -78,6 +81,9 @@ namespace triton {
       //! Initializes the OPERAND python namespace.
       void initOperandNamespace(PyObject* operandDict);
 
+      //! Initializes the PASS python namespace.
+      void initPassNamespace(PyObject* passDict);
+
       //! Initializes the SHIFT python namespace.
       void initShiftsNamespace(PyObject* shiftDict);
 
@@ -87,6 +93,9 @@ namespace triton {
       //! Initializes the EXTEND python namespace.
       void initExtendNamespace(PyObject* extendDict);
 
+      //! Initializes the FLOW python namespace.
+      void initFlowNamespace(PyObject* flowDict);
+
       //! Initializes the VAS python namespace.
       void initVASNamespace(PyObject* vasDict);
 
@@ -96,6 +105,12 @@ namespace triton {
       //! Initializes the MODE python namespace.
       void initModeNamespace(PyObject* modeDict);
 
+      //! Initializes the QUERY python namespace.
+      void initQueryNamespace(PyObject* queryDict);
+
+      //! Initializes the SCHEDULER python namespace.
+      void initSchedulerNamespace(PyObject* schedulerDict);
+
       //! Initializes the SOLVER python namespace.
       void initSolverNamespace(PyObject* solverDict);
 
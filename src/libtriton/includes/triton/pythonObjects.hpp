@@ -15,11 +15,13 @@
 #include <triton/ast.hpp>
 #include <triton/basicBlock.hpp>
 #include <triton/bitsVector.hpp>
+#include <triton/explorer.hpp>
 #include <triton/immediate.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/pathConstraint.hpp>
 #include <triton/register.hpp>
+#include <triton/solverFuture.hpp>
 #include <triton/solverModel.hpp>
 #include <triton/symbolicExpression.hpp>
 #include <triton/symbolicVariable.hpp>
@@ -69,6 +71,9 @@ namespace triton {
       //! Creates the BasicBlock python class.
       PyObject* PyBasicBlock(std::vector<triton::arch::Instruction>& insts);
 
+      //! Creates the Explorer python class, exploring with the `setup` and `inject` functions.
+      PyObject* PyExplorer(PyObject* setup, PyObject* inject);
+
       //! Creates the Instruction python class.
       PyObject* PyInstruction(void);
 
@@ -93,6 +98,9 @@ namespace triton {
       //! Creates the new TritonContext python class.
       PyObject* PyTritonContext(triton::arch::architecture_e arch);
 
+      //! Creates a TritonContext python class which takes the ownership of a Context.
+      PyObject* PyTritonContext(triton::Context* ctx);
+
       //! Creates a TritonContext python class which is a reference to another Context.
       PyObject* PyTritonContextRef(triton::Context& ctx);
 
@@ -102,9 +110,23 @@ namespace triton {
       //! Creates the Register python class.
       PyObject* PyRegister(const triton::arch::Register& reg);
 
+      //! Creates the SolverFuture python class.
+      PyObject* PySolverFuture(const std::shared_ptr<triton::engines::solver::SolverFuture>& future);
+
       //! Creates the SolverModel python class.
       PyObject* PySolverModel(const triton::engines::solver::SolverModel& model);
 
+      //! The kinds of entries walked by a SymbolicIterator.
+      enum symbolic_iterator_e {
+        SYMBOLIC_ITERATOR_EXPRESSIONS = 0, //!< The symbolic expressions, keyed by id.
+        SYMBOLIC_ITERATOR_VARIABLES,       //!< The symbolic variables, keyed by id.
+        SYMBOLIC_ITERATOR_REGISTERS,       //!< The symbolic parent registers, keyed by register id.
+        SYMBOLIC_ITERATOR_MEMORY,          //!< The symbolic memory bytes, keyed by address.
+      };
+
+      //! Creates the SymbolicIterator python class over the entries of `keys` of the TritonContext `ctx`.
+      PyObject* PySymbolicIterator(PyObject* ctx, symbolic_iterator_e kind, std::vector<triton::uint64>&& keys);
+
       //! Creates the SymbolicExpression python class.
       PyObject* PySymbolicExpression(const triton::engines::symbolic::SharedSymbolicExpression& expr);
 
@@ -144,6 +166,22 @@ namespace triton {
       //! pyBasicBlock type.
       extern PyTypeObject BasicBlock_Type;
 
+      /* Explorer ======================================================= */
+
+      //! pyExplorer object.
+      typedef struct {
+        PyObject_HEAD
+        triton::engines::exploration::Explorer* explorer; //! Pointer to the cpp explorer
+        PyObject* setup;                                  //! The setup function
+        PyObject* inject;                                 //! The inject function
+        PyObject* termination;                            //! The termination function, if any
+        PyObject* input;                                  //! The input function, if any
+        PyObject* priority;                               //! The priority function, if any
+      } Explorer_Object;
+
+      //! pyExplorer type.
+      extern PyTypeObject Explorer_Type;
+
       /* Immediate ====================================================== */
 
       //! pyImmediate object.
@@ -223,6 +261,17 @@ namespace triton {
       //! pyRegister type.
       extern PyTypeObject AstContextObject_Type;
 
+      /* SolverFuture =================================================== */
+
+      //! pySolverFuture object.
+      typedef struct {
+        PyObject_HEAD
+        std::shared_ptr<triton::engines::solver::SolverFuture>* future; //! Pointer to the cpp solver future
+      } SolverFuture_Object;
+
+      //! pySolverFuture type.
+      extern PyTypeObject SolverFuture_Type;
+
       /* SolverModel ==================================================== */
 
       //! pySolverModel object.
@@ -234,6 +283,20 @@ namespace triton {
       //! pySolverModel type.
       extern PyTypeObject SolverModel_Type;
 
+      /* SymbolicIterator =============================================== */
+
+      //! pySymbolicIterator object.
+      typedef struct {
+        PyObject_HEAD
+        PyObject* ctx;                        //! The TritonContext, kept alive by the iterator
+        symbolic_iterator_e kind;             //! The kind of the entries
+        std::vector<triton::uint64>* keys;    //! The keys of the entries
+        triton::usize index;                  //! The index of the next key
+      } SymbolicIterator_Object;
+
+      //! pySymbolicIterator type.
+      extern PyTypeObject SymbolicIterator_Type;
+
       /* SymbolicExpression ============================================= */
 
       //! pySymbolicExpression object.
@@ -279,6 +342,12 @@ namespace triton {
 /*! Returns the triton::arch::BasicBlock. */
 #define PyBasicBlock_AsBasicBlock(v) (((triton::bindings::python::BasicBlock_Object*)(v))->block)
 
+/*! Checks if the pyObject is a triton::engines::exploration::Explorer. */
+#define PyExplorer_Check(v) ((v)->ob_type == &triton::bindings::python::Explorer_Type)
+
+/*! Returns the triton::engines::exploration::Explorer. */
+#define PyExplorer_AsExplorer(v) (((triton::bindings::python::Explorer_Object*)(v))->explorer)
+
 /*! Checks if the pyObject is a triton::arch::Immediate. */
 #define PyImmediate_Check(v) ((v)->ob_type == &triton::bindings::python::Immediate_Type)
 
@@ -321,6 +390,15 @@ namespace triton {
 /*! Returns the triton::arch::Register. */
 #define PyRegister_AsRegister(v) (((triton::bindings::python::Register_Object*)(v))->reg)
 
+/*! Checks if the pyObject is a triton::engines::solver::SolverFuture. */
+#define PySolverFuture_Check(v) ((v)->ob_type == &triton::bindings::python::SolverFuture_Type)
+
+/*! Returns the triton::engines::solver::SolverFuture. */
+#define PySolverFuture_AsSolverFuture(v) (((triton::bindings::python::SolverFuture_Object*)(v))->future)
+
+/*! Checks if the pyObject is a SymbolicIterator. */
+#define PySymbolicIterator_Check(v) ((v)->ob_type == &triton::bindings::python::SymbolicIterator_Type)
+
 /*! Checks if the pyObject is a triton::engines::solver::SolverModel. */
 #define PySolverModel_Check(v) ((v)->ob_type == &triton::bindings::python::SolverModel_Type)
 
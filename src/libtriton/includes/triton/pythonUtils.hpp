@@ -81,6 +81,40 @@ namespace triton {
       //! Returns a pyObject from a triton::uint512.
       PyObject* PyLong_FromUint512(triton::uint512 value);
 
+      //! Releases the GIL for the lifetime of the object, around a long native call which does not touch Python objects.
+      class PyAllowThreads {
+        private:
+          //! The state of the thread, restored by the destructor.
+          PyThreadState* state;
+
+        public:
+          //! Constructor. Releases the GIL.
+          PyAllowThreads() : state(PyEval_SaveThread()) {}
+
+          //! Destructor. Takes the GIL back.
+          ~PyAllowThreads() { PyEval_RestoreThread(this->state); }
+
+          PyAllowThreads(const PyAllowThreads& other) = delete;
+          PyAllowThreads& operator=(const PyAllowThreads& other) = delete;
+      };
+
+      //! Holds the GIL for the lifetime of the object, around a call to Python from a native callback. The GIL may be held already.
+      class PyAcquireGil {
+        private:
+          //! The state of the GIL, restored by the destructor.
+          PyGILState_STATE state;
+
+        public:
+          //! Constructor. Takes the GIL.
+          PyAcquireGil() : state(PyGILState_Ensure()) {}
+
+          //! Destructor. Releases the GIL if it was not held.
+          ~PyAcquireGil() { PyGILState_Release(this->state); }
+
+          PyAcquireGil(const PyAcquireGil& other) = delete;
+          PyAcquireGil& operator=(const PyAcquireGil& other) = delete;
+      };
+
     /*! @} End of python namespace */
     };
   /*! @} End of bindings namespace */
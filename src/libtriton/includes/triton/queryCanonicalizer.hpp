@@ -0,0 +1,89 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_QUERYCANONICALIZER_HPP
+#define TRITON_QUERYCANONICALIZER_HPP
+
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class QueryCanonicalizer
+       *  \brief The canonical form of a query, which keys the query caches.
+       *
+       *  \details The references are followed, the nested operands of the associative operators are flattened,
+       *  the operands of the commutative operators are sorted by the hash of their shape, and the constant of a
+       *  comparison goes to the right. The variables are then numbered in the order they are met in this form,
+       *  so that two queries which only differ by the ids of their variables get the same hash. The models are
+       *  kept by the positions of their variables, and translated back to the variables of another query.
+       */
+      class QueryCanonicalizer {
+        private:
+          //! The canonical hash of the query.
+          triton::uint512 hash;
+
+          //! The variables of the query, by position.
+          std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+
+          //! The positions of the variables <id : position>.
+          std::unordered_map<triton::usize, triton::usize> positions;
+
+        public:
+          //! Constructor. Computes the canonical form of `node`.
+          TRITON_EXPORT QueryCanonicalizer(const triton::ast::SharedAbstractNode& node);
+
+          //! Returns the canonical hash of the query.
+          TRITON_EXPORT const triton::uint512& getHash(void) const;
+
+          //! Returns the variables of the query, by position.
+          TRITON_EXPORT const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& getVariables(void) const;
+
+          //! Returns a model of the query keyed by the positions of its variables instead of their ids.
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> toPositions(const std::unordered_map<triton::usize, SolverModel>& model) const;
+
+          //! Returns a model keyed by positions on the variables of the query, keyed by their ids.
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> fromPositions(const std::unordered_map<triton::usize, SolverModel>& model) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_QUERYCANONICALIZER_HPP */
@@ -0,0 +1,105 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_QUERYCONFIGURATION_HPP
+#define TRITON_QUERYCONFIGURATION_HPP
+
+#include <string>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! The configuration of the solvers for a class of queries. An empty field keeps the default of the solver.
+      struct SolverConfiguration {
+        //! The SMT logic of the z3 solver (e.g. `QF_BV`), empty for the solver detecting it.
+        std::string logic;
+
+        //! The z3 tactics applied in sequence, separated by `;` (e.g. `simplify;bit-blast;sat`). They replace the solver of the logic, and the last one must decide the query.
+        std::string tactics;
+
+        //! The SAT solver of Bitwuzla (e.g. `cadical`, `kissat`), empty for its default one.
+        std::string satSolver;
+
+        //! The rewrite level of Bitwuzla, from 0 to 2, -1 for its default one.
+        triton::sint32 rewriteLevel;
+
+        //! Constructor of the default configuration.
+        TRITON_EXPORT SolverConfiguration(const std::string& logic="", const std::string& tactics="", const std::string& satSolver="", triton::sint32 rewriteLevel=-1);
+      };
+
+      /*! \class QueryConfigurations
+       *  \brief The configurations of the solvers for each class of queries.
+       *
+       *  \details A query is classified by the nodes it reaches through the references: the memory array makes
+       *  it QF_ABV, the quantifiers leave it to the default configuration, and the equalities of variables,
+       *  constants, extractions and concatenations are bit-blasted directly. Without classification, every
+       *  query gets the configuration of `QUERY_ANY`.
+       */
+      class QueryConfigurations {
+        private:
+          //! True if the queries are classified.
+          bool classification;
+
+          //! The configurations, by class of query.
+          SolverConfiguration configurations[triton::engines::solver::QUERY_CLASSES];
+
+        public:
+          //! Constructor. The queries are classified, with the configurations tuned for each class.
+          TRITON_EXPORT QueryConfigurations();
+
+          //! Enables or disables the classification of the queries.
+          TRITON_EXPORT void enableClassification(bool flag);
+
+          //! Returns true if the queries are classified.
+          TRITON_EXPORT bool isClassificationEnabled(void) const;
+
+          //! Sets the configuration of a class of queries.
+          TRITON_EXPORT void setConfiguration(triton::engines::solver::query_e query, const SolverConfiguration& config);
+
+          //! Returns the configuration of a class of queries.
+          TRITON_EXPORT const SolverConfiguration& getConfiguration(triton::engines::solver::query_e query) const;
+
+          //! Returns the configuration of `node`, the one of its class if the queries are classified.
+          TRITON_EXPORT const SolverConfiguration& selectConfiguration(const triton::ast::SharedAbstractNode& node) const;
+      };
+
+      //! Returns the class of a query.
+      TRITON_EXPORT triton::engines::solver::query_e classifyQuery(const triton::ast::SharedAbstractNode& node);
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_QUERYCONFIGURATION_HPP */
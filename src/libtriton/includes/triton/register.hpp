@@ -40,11 +40,14 @@ namespace triton {
 
     /*! \class Register
      *  \brief This class is used when an instruction has a register operand.
+     *
+     *  \details The names are interned once for all, so that a register is trivially copyable: the operands,
+     *  the memory accesses and the access sets of the instructions copy it without any allocation.
      */
     class Register : public BitsVector, public arm::ArmOperandProperties {
       protected:
-        //! The name of the register.
-        std::string name;
+        //! The interned name of the register.
+        const std::string* name;
 
         //! The id of the register.
         triton::arch::register_e id;
@@ -55,22 +58,18 @@ namespace triton {
         //! True if the register is mutable. For example XZR in AArch64 is immutable.
         bool vmutable;
 
-      private:
-        //! Copy a Register.
-        void copy(const Register& other);
-
       public:
         //! Constructor.
         TRITON_EXPORT Register();
 
         //! Constructor.
-        TRITON_EXPORT Register(triton::arch::register_e regId, std::string name, triton::arch::register_e parent, triton::uint32 high, triton::uint32 low, bool vmutable);
+        TRITON_EXPORT Register(triton::arch::register_e regId, const std::string& name, triton::arch::register_e parent, triton::uint32 high, triton::uint32 low, bool vmutable);
 
         //! Constructor.
         TRITON_EXPORT Register(const triton::arch::CpuInterface&, triton::arch::register_e regId);
 
-        //! Constructor.
-        TRITON_EXPORT Register(const Register& other);
+        //! Constructor by copy.
+        Register(const Register& other) = default;
 
         //! Returns the parent id of the register.
         TRITON_EXPORT triton::arch::register_e getParent(void) const;
@@ -103,7 +102,7 @@ namespace triton {
         TRITON_EXPORT bool operator!=(const Register& other) const;
 
         //! Copies a Register.
-        TRITON_EXPORT Register& operator=(const Register& other);
+        Register& operator=(const Register& other) = default;
     };
 
     //! Displays a Register.
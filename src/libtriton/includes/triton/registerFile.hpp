@@ -0,0 +1,166 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_REGISTERFILE_HPP
+#define TRITON_REGISTERFILE_HPP
+
+#include <cstring>
+#include <type_traits>
+
+#include <triton/archEnums.hpp>
+#include <triton/cpuSize.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class RegisterSlot
+     *  \brief The location of a register in the concrete register file of a CPU.
+     *
+     *  \details A register is stored in the bytes of its parent register, starting at the bit
+     *  `low`. Registers and their parent are stored in little endian.
+     */
+    class RegisterSlot {
+      public:
+        //! The offset in bytes of the parent register in the register file.
+        triton::uint16 offset;
+
+        //! The size in bytes of the parent register. 0 if the register has no storage.
+        triton::uint16 size;
+
+        //! The position of the register's lowest bit in its parent register.
+        triton::uint16 low;
+
+        //! The size in bits of the register.
+        triton::uint16 bitSize;
+
+        //! Returns the value of the register stored in `file`.
+        TRITON_EXPORT triton::uint512 read(const triton::uint8* file) const;
+
+        //! Writes the value of the register into `file`. The other bits of its parent register are kept.
+        TRITON_EXPORT void write(triton::uint8* file, const triton::uint512& value) const;
+
+        /*!
+         * \brief Returns the value of the register stored in `file`, truncated to `T`.
+         *
+         * \details `T` is a native unsigned integer or triton::uint128. A register of a parent of at
+         * most 64 bits is read with a single native load, a wider one by 64-bit limbs.
+         */
+        template <typename T>
+        T read(const triton::uint8* file) const {
+          static_assert((std::is_integral<T>::value && std::is_unsigned<T>::value) || std::is_same<T, triton::uint128>::value, "RegisterSlot needs a native unsigned integer or triton::uint128");
+          if (this->size <= triton::size::qword) {
+            triton::uint64 area = 0;
+            std::memcpy(&area, file + this->offset, this->size);
+            area >>= this->low;
+            if (this->bitSize < triton::bitsize::qword)
+              area &= (static_cast<triton::uint64>(1) << this->bitSize) - 1;
+            return static_cast<T>(area);
+          }
+
+          /* Wider registers are byte aligned in their parent */
+          triton::uint64 limbs[2] = {0};
+          triton::usize bytes = this->bitSize / triton::bitsize::byte;
+          std::memcpy(limbs, file + this->offset + this->low / triton::bitsize::byte, bytes < sizeof(limbs) ? bytes : sizeof(limbs));
+
+          if constexpr (std::is_same<T, triton::uint128>::value)
+            return (triton::uint128(limbs[1]) << triton::bitsize::qword) | limbs[0];
+          else
+            return static_cast<T>(limbs[0]);
+        }
+
+        /*!
+         * \brief Writes the value of the register into `file`. The other bits of its parent register are kept.
+         *
+         * \details `value` must fit in the register and the register in `T`.
+         */
+        template <typename T>
+        void write(triton::uint8* file, T value) const {
+          static_assert((std::is_integral<T>::value && std::is_unsigned<T>::value) || std::is_same<T, triton::uint128>::value, "RegisterSlot needs a native unsigned integer or triton::uint128");
+          if (this->size <= triton::size::qword) {
+            triton::uint64 mask = (this->bitSize < triton::bitsize::qword ? (static_cast<triton::uint64>(1) << this->bitSize) - 1 : ~static_cast<triton::uint64>(0)) << this->low;
+            triton::uint64 area = 0;
+            std::memcpy(&area, file + this->offset, this->size);
+            area = (area & ~mask) | ((static_cast<triton::uint64>(value) << this->low) & mask);
+            std::memcpy(file + this->offset, &area, this->size);
+            return;
+          }
+
+          triton::uint64 limbs[2] = {static_cast<triton::uint64>(value), 0};
+          if constexpr (std::is_same<T, triton::uint128>::value)
+            limbs[1] = static_cast<triton::uint64>(value >> triton::bitsize::qword);
+
+          std::memcpy(file + this->offset + this->low / triton::bitsize::byte, limbs, this->bitSize / triton::bitsize::byte);
+        }
+    };
+
+
+    /*! \class RegisterFileLayout
+     *  \brief The layout of the concrete register file of a CPU.
+     *
+     *  \details The layout is built at compile time from the `.spec` file of an architecture.
+     *  Parent registers are stored contiguously, in their order of addition, and a register
+     *  is looked up by its id in O(1).
+     */
+    class RegisterFileLayout {
+      private:
+        //! The slot of each register, indexed by register id.
+        triton::arch::RegisterSlot slots[triton::arch::ID_REG_LAST_ITEM];
+
+        //! The size in bytes of the register file.
+        triton::uint16 size;
+
+      public:
+        //! Constructor. Registers have no storage.
+        constexpr RegisterFileLayout() : slots{}, size(0) {
+        }
+
+        //! Allocates the storage of a parent register of `bitSize` bits.
+        constexpr void addRegister(triton::arch::register_e id, triton::uint32 bitSize) {
+          triton::uint16 bytes = static_cast<triton::uint16>((bitSize + 7) / 8);
+          this->slots[id] = {this->size, bytes, 0, static_cast<triton::uint16>(bitSize)};
+          this->size += bytes;
+        }
+
+        //! Stores a register of `bitSize` bits in the storage of `parent`, starting at the bit `low`.
+        constexpr void addSubRegister(triton::arch::register_e id, triton::arch::register_e parent, triton::uint32 low, triton::uint32 bitSize) {
+          const triton::arch::RegisterSlot& storage = this->slots[parent];
+          this->slots[id] = {storage.offset, storage.size, static_cast<triton::uint16>(storage.low + low), static_cast<triton::uint16>(bitSize)};
+        }
+
+        //! Returns the slot of a register.
+        constexpr const triton::arch::RegisterSlot& getSlot(triton::arch::register_e id) const {
+          return this->slots[id];
+        }
+
+        //! Returns the size in bytes of the register file.
+        constexpr triton::usize getSize(void) const {
+          return this->size;
+        }
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_REGISTERFILE_HPP */
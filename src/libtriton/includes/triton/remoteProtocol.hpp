@@ -0,0 +1,118 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_REMOTEPROTOCOL_HPP
+#define TRITON_REMOTEPROTOCOL_HPP
+
+#include <string>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*
+       *  A message of the remote solver protocol is framed by its length, on 4 bytes, followed by its kind on
+       *  1 byte, the id of its query on 8 bytes and its payload. Numbers are little endian.
+       *
+       *  QUERY   : limit (4), timeout (4), the constraint in the binary AST format.
+       *  CANCEL  : no payload. A cancelled query may still be answered, the answer is dropped.
+       *  RESULT  : status (1), solving time (4), models (4), each model as its values (4), each value as
+       *            its variable id (8) and its 64 bytes.
+       *  ERROR   : the message of the error.
+       */
+
+      //! The kinds of message of the remote solver protocol.
+      enum remote_e {
+        REMOTE_QUERY = 1, /*!< client to worker, a query. */
+        REMOTE_CANCEL,    /*!< client to worker, cancels a query. */
+        REMOTE_RESULT,    /*!< worker to client, the result of a query. */
+        REMOTE_ERROR,     /*!< worker to client, the failure of a query. */
+      };
+
+      //! A message of the remote solver protocol.
+      struct RemoteMessage {
+        //! The kind of the message.
+        triton::engines::solver::remote_e kind;
+
+        //! The id of the query.
+        triton::uint64 id;
+
+        //! The payload of the message.
+        std::string payload;
+      };
+
+      //! The remote solver protocol.
+      namespace remote {
+
+        //! Connects to an endpoint `host:port`. Returns the socket, -1 on failure.
+        TRITON_EXPORT int connectTo(const std::string& endpoint);
+
+        //! Listens on every interface on `port`, 0 for any port. Returns the socket, -1 on failure, and the port bound in `bound`.
+        TRITON_EXPORT int listenOn(triton::uint16 port, triton::uint16* bound);
+
+        //! Accepts a connection. Returns the socket, -1 on failure.
+        TRITON_EXPORT int acceptOn(int listener);
+
+        //! Stops the transfers of a socket, which unblocks its readers.
+        TRITON_EXPORT void shutdownSocket(int socket);
+
+        //! Closes a socket.
+        TRITON_EXPORT void closeSocket(int socket);
+
+        //! Appends the frame of a message to `buffer`, so that several messages are sent at once.
+        TRITON_EXPORT void appendMessage(std::string& buffer, const triton::engines::solver::RemoteMessage& message);
+
+        //! Sends `buffer`. Returns false if the connection is lost.
+        TRITON_EXPORT bool sendBuffer(int socket, const std::string& buffer);
+
+        //! Receives a message. Returns false if the connection is lost or the frame is invalid.
+        TRITON_EXPORT bool receiveMessage(int socket, triton::engines::solver::RemoteMessage& message);
+
+        //! Appends a number of `size` bytes to a payload.
+        TRITON_EXPORT void putNumber(std::string& payload, triton::uint64 value, triton::usize size);
+
+        //! Reads a number of `size` bytes of a payload at `offset`, which moves past it.
+        TRITON_EXPORT triton::uint64 getNumber(const std::string& payload, triton::usize& offset, triton::usize size);
+
+        //! Appends a 512-bit value to a payload.
+        TRITON_EXPORT void putValue(std::string& payload, const triton::uint512& value);
+
+        //! Reads a 512-bit value of a payload at `offset`, which moves past it.
+        TRITON_EXPORT triton::uint512 getValue(const std::string& payload, triton::usize& offset);
+
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_REMOTEPROTOCOL_HPP */
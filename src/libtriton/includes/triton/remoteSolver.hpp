@@ -0,0 +1,223 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_REMOTESOLVER_HPP
+#define TRITON_REMOTESOLVER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverInterface.hpp>
+#include <triton/solverInterrupt.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class RemoteSolver
+       *  \brief Solver engine sending the queries to remote workers.
+       *
+       *  \details The queries are written in the binary AST format and sent to `RemoteWorker`s over TCP, see
+       *  `remoteProtocol.hpp`. Each worker has one connection, on which the queries of all the threads are
+       *  pipelined: a query goes to the worker with the fewest outstanding queries, and the queries queued
+       *  while a batch is written are sent together. The answers come back with the ids of the symbolic
+       *  variables, which are mapped back to the variables of the query. The queries of a lost worker are
+       *  sent again to the others.
+       */
+      class RemoteSolver : public SolverInterface {
+        private:
+          //! A connection to a worker.
+          struct Worker {
+            //! The endpoint of the worker.
+            std::string endpoint;
+
+            //! The socket of the connection.
+            int socket;
+
+            //! False once the connection is lost.
+            bool alive;
+
+            //! The number of queries sent and not answered.
+            triton::usize outstanding;
+
+            //! The frames waiting to be sent.
+            std::string outgoing;
+
+            //! Signals frames to send.
+            std::condition_variable pending;
+
+            //! Sends the queued frames.
+            std::thread sender;
+
+            //! Receives the answers.
+            std::thread receiver;
+          };
+
+          //! An outstanding query.
+          struct Query {
+            //! The id of the query.
+            triton::uint64 id;
+
+            //! The frame of the query, kept to send it again.
+            std::string frame;
+
+            //! The worker of the query.
+            Worker* worker;
+
+            //! True once the query is answered.
+            bool ready;
+
+            //! The status of the query.
+            triton::engines::solver::status_e status;
+
+            //! The solving time of the query.
+            triton::uint32 solvingTime;
+
+            //! The values of the models <variable id : value>.
+            std::vector<std::unordered_map<triton::usize, triton::uint512>> values;
+
+            //! The error of the worker, if any.
+            std::string error;
+
+            //! The index of the query in its batch.
+            triton::usize index;
+
+            //! The ended queries of the batch of the query, if any.
+            std::deque<std::shared_ptr<Query>>* finished;
+          };
+
+          //! Protects the workers and the queries.
+          mutable std::mutex lock;
+
+          //! Signals the end of a query.
+          mutable std::condition_variable done;
+
+          //! The workers.
+          std::vector<std::unique_ptr<Worker>> workers;
+
+          //! The outstanding queries <id : query>.
+          mutable std::unordered_map<triton::uint64, std::shared_ptr<Query>> queries;
+
+          //! The id of the next query.
+          mutable triton::uint64 nextId;
+
+          //! True while the connections are closed.
+          bool stopping;
+
+          //! The default timeout of the queries.
+          triton::uint32 timeout;
+
+          //! Sends the frames queued for a worker, several at once.
+          void send(Worker* worker);
+
+          //! Receives the answers of a worker.
+          void receive(Worker* worker);
+
+          //! Sends a query to the worker with the fewest outstanding queries. The lock must be held.
+          void dispatch(const std::shared_ptr<Query>& query) const;
+
+          //! Ends a query. The lock must be held.
+          void finish(const std::shared_ptr<Query>& query) const;
+
+          //! Sends a query of `limit` models (0 for `isSat`).
+          std::shared_ptr<Query> submit(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::uint32 timeout, triton::usize index = 0, std::deque<std::shared_ptr<Query>>* finished = nullptr) const;
+
+          //! Cancels a query, which ends with an unknown status.
+          void cancel(const std::shared_ptr<Query>& query) const;
+
+          //! Returns the models of an ended query, with the variables of `node`.
+          std::vector<std::unordered_map<triton::usize, SolverModel>> collect(const triton::ast::SharedAbstractNode& node, const std::shared_ptr<Query>& query, triton::engines::solver::status_e* status, triton::uint32* solvingTime) const;
+
+        public:
+          //! Constructor. Connects to the workers `host:port`, at least one must be reachable.
+          TRITON_EXPORT RemoteSolver(const std::vector<std::string>& endpoints);
+
+          //! Destructor. The outstanding queries are failed.
+          TRITON_EXPORT ~RemoteSolver();
+
+          RemoteSolver(const RemoteSolver&) = delete;
+          RemoteSolver& operator=(const RemoteSolver&) = delete;
+
+          //! Computes and returns a model from a symbolic constraint. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes and returns several models from a symbolic constraint. The query is cancelled on its worker once `interrupt` is interrupted, from another thread.
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime, triton::engines::solver::SolverInterrupt* interrupt) const;
+
+          //! Returns true if an expression is satisfiable.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Sends a model query for each node at once and hands the results to `callback` on the calling thread, in the order they end.
+          TRITON_EXPORT void solveAll(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 timeout, const std::function<void(triton::usize index, triton::engines::solver::status_e status, const std::unordered_map<triton::usize, SolverModel>& model, triton::uint32 solvingTime)>& callback) const;
+
+          //! Returns the number of reachable workers.
+          TRITON_EXPORT triton::usize getWorkerCount(void) const;
+
+          //! Returns the name of this solver.
+          TRITON_EXPORT std::string getName(void) const;
+
+          //! Defines the timeout of the queries without timeout (in milliseconds).
+          TRITON_EXPORT void setTimeout(triton::uint32 ms);
+
+          //! Defines a solver memory consumption limit (in megabytes). Ignored, the protocol does not carry it and the workers solve without limit.
+          TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_REMOTESOLVER_HPP */
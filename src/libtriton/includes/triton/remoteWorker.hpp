@@ -0,0 +1,106 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_REMOTEWORKER_HPP
+#define TRITON_REMOTEWORKER_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/solverEngine.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class RemoteWorker
+       *  \brief Serves the queries of `RemoteSolver`s with a local solver.
+       *
+       *  \details Each connection reads its queries into its own AST context and solves up to `threads` of
+       *  them at once, so that the queries pipelined by a client are solved in parallel. The answers are
+       *  sent as they end, in any order.
+       */
+      class RemoteWorker {
+        private:
+          //! The listening socket.
+          int listener;
+
+          //! The port listened.
+          triton::uint16 port;
+
+          //! The number of queries solved at once by a connection.
+          triton::usize threads;
+
+          //! The local solver.
+          triton::engines::solver::SolverEngine engine;
+
+          //! True once stopped.
+          std::atomic<bool> stopping;
+
+          //! Protects the connections.
+          std::mutex lock;
+
+          //! The sockets of the connections.
+          std::unordered_set<int> connections;
+
+          //! Serves the queries of a connection until it is closed.
+          void handle(int socket);
+
+        public:
+          //! Constructor. Listens on `port`, 0 for any port, and solves `threads` queries at once per connection (0 for one per core) with `kind`.
+          TRITON_EXPORT RemoteWorker(triton::uint16 port, triton::usize threads = 0, triton::engines::solver::solver_e kind = triton::engines::solver::SOLVER_INVALID);
+
+          //! Destructor.
+          TRITON_EXPORT ~RemoteWorker();
+
+          RemoteWorker(const RemoteWorker&) = delete;
+          RemoteWorker& operator=(const RemoteWorker&) = delete;
+
+          //! Returns the port listened.
+          TRITON_EXPORT triton::uint16 getPort(void) const;
+
+          //! Serves the connections until `stop()` is called.
+          TRITON_EXPORT void serve(void);
+
+          //! Stops serving, from another thread. The connections are closed.
+          TRITON_EXPORT void stop(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_REMOTEWORKER_HPP */
@@ -0,0 +1,165 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SATSOLVER_HPP
+#define TRITON_SATSOLVER_HPP
+
+#include <chrono>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverInterrupt.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class SatSolver
+       *  \brief An incremental CDCL SAT solver for the small queries, see `BitBlastSolver`.
+       *
+       *  \details The literals are those of DIMACS: the variable `v`, from 1, or its negation `-v`. The search
+       *  propagates the clauses through two watched literals, learns the first UIP clause of each conflict,
+       *  decides on the most active variable (VSIDS) with the saved phase and restarts on the Luby sequence.
+       *  The clauses, the learnt ones included, are kept between the searches, so that a clause blocking a
+       *  model can be added to enumerate the next one.
+       */
+      class SatSolver {
+        private:
+          //! The unknown value of a variable.
+          static constexpr triton::sint8 UNDEF = -1;
+
+          //! No clause, the reason of a decision.
+          static constexpr triton::uint32 NONE = 0xffffffff;
+
+          //! The clauses, of internal literals `2 * var + negated`.
+          std::vector<std::vector<triton::uint32>> clauses;
+
+          //! The clauses watching each literal.
+          std::vector<std::vector<triton::uint32>> watches;
+
+          //! The values of the variables, 0, 1 or `UNDEF`.
+          std::vector<triton::sint8> assigns;
+
+          //! The decision level of each assigned variable.
+          std::vector<triton::uint32> levels;
+
+          //! The clause which implied each assigned variable, `NONE` for a decision.
+          std::vector<triton::uint32> reasons;
+
+          //! The last value of each variable.
+          std::vector<bool> phases;
+
+          //! The activity of each variable.
+          std::vector<double> activities;
+
+          //! The activity added to the variables of a conflict.
+          double increment;
+
+          //! The unassigned variables, by activity, and the position of each variable in the heap (`NONE` if absent).
+          std::vector<triton::uint32> heap;
+          std::vector<triton::uint32> positions;
+
+          //! The assigned literals, in order, and the start of each decision level.
+          std::vector<triton::uint32> trail;
+          std::vector<triton::uint32> trailLimits;
+
+          //! The next literal of the trail to propagate.
+          triton::usize head;
+
+          //! Marks of the analysis.
+          std::vector<bool> seen;
+
+          //! False once the clauses are unsatisfiable at level 0.
+          bool consistent;
+
+          //! Returns the value of an internal literal.
+          triton::sint8 value(triton::uint32 lit) const;
+
+          //! Assigns an internal literal implied by `reason`.
+          void enqueue(triton::uint32 lit, triton::uint32 reason);
+
+          //! Propagates the trail. Returns the conflicting clause, `NONE` if none.
+          triton::uint32 propagate(void);
+
+          //! Learns the clause of a conflict. Returns the level to backtrack to.
+          triton::uint32 analyze(triton::uint32 conflict, std::vector<triton::uint32>& learnt);
+
+          //! Unassigns the variables above `level`.
+          void backtrack(triton::uint32 level);
+
+          //! Attaches a clause of at least two literals. Returns its index.
+          triton::uint32 attach(const std::vector<triton::uint32>& lits);
+
+          //! Bumps the activity of a variable.
+          void bump(triton::uint32 var);
+
+          //! Heap of the variables by activity.
+          void heapUp(triton::uint32 index);
+          void heapDown(triton::uint32 index);
+          void heapInsert(triton::uint32 var);
+          triton::uint32 heapPop(void);
+
+          //! Returns the current decision level.
+          triton::uint32 getLevel(void) const;
+
+          //! Converts a DIMACS literal.
+          triton::uint32 toInternal(triton::sint32 lit) const;
+
+        public:
+          //! Constructor. No variable.
+          TRITON_EXPORT SatSolver();
+
+          //! Returns a new variable, from 1.
+          TRITON_EXPORT triton::sint32 newVariable(void);
+
+          //! Returns the number of variables.
+          TRITON_EXPORT triton::usize getNumberOfVariables(void) const;
+
+          //! Returns the number of clauses, the learnt ones included.
+          TRITON_EXPORT triton::usize getNumberOfClauses(void) const;
+
+          //! Adds a clause. The empty clause makes the clauses unsatisfiable.
+          TRITON_EXPORT void addClause(const std::vector<triton::sint32>& lits);
+
+          //! Searches an assignment, within `timeout` milliseconds if not 0. Returns SAT, UNSAT, TIMEOUT, or UNKNOWN once `interrupt` is interrupted.
+          TRITON_EXPORT triton::engines::solver::status_e solve(triton::uint32 timeout=0, const triton::engines::solver::SolverInterrupt* interrupt=nullptr);
+
+          //! Returns the value of a literal in the assignment found by solve().
+          TRITON_EXPORT bool getValue(triton::sint32 lit) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SATSOLVER_HPP */
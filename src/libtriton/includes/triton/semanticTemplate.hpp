@@ -0,0 +1,154 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SEMANTICTEMPLATE_H
+#define TRITON_SEMANTICTEMPLATE_H
+
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/immediate.hpp>
+#include <triton/instruction.hpp>
+#include <triton/register.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      class SymbolicEngine;
+
+      /*! \class SemanticTemplate
+       *  \brief The lifted semantics of an instruction with their register inputs left as placeholders.
+       *
+       *  \details A template is recorded while the semantics of an instruction are built: the symbolic
+       *  engine reports each register read and each expression created. Once built, the template only
+       *  holds placeholders and constant nodes, and binding it to an instruction re-reads the registers
+       *  and creates the same expressions over the current state, without running the ISA semantics.
+       *  Memory accesses are not supported, they invalidate the recording.
+       */
+      class SemanticTemplate {
+        private:
+          //! A register read or an expression created, in order of execution.
+          struct Operation {
+            //! True if the operation creates an expression, false if it reads a register.
+            bool write;
+
+            //! True if the read register is an input of the instruction.
+            bool declared;
+
+            //! True if the expression created is volatile.
+            bool isVolatile;
+
+            //! The register read or assigned.
+            triton::arch::Register reg;
+
+            //! The comment of the expression created.
+            std::string comment;
+
+            //! The AST read or assigned. Once built, the AST of the expression over placeholders.
+            triton::ast::SharedAbstractNode node;
+
+            //! The node standing for the register read or for a reference to the expression created.
+            triton::ast::SharedAbstractNode placeholder;
+
+            //! The expression created while recording, released once built.
+            SharedSymbolicExpression expr;
+          };
+
+          //! The operations.
+          std::vector<Operation> operations;
+
+          //! The immediates read by the instruction.
+          std::set<std::pair<triton::arch::Immediate, triton::ast::SharedAbstractNode>> immediates;
+
+          //! The registers defined as undefined by the instruction.
+          std::set<triton::arch::Register> undefined;
+
+          //! The registers read, written or undefined by the instruction.
+          std::vector<triton::arch::Register> registers;
+
+          //! The opcode of the instruction.
+          triton::uint8 opcode[16];
+
+          //! The size of the instruction.
+          triton::uint32 size;
+
+          //! The architecture of the instruction.
+          triton::arch::architecture_e arch;
+
+          //! False if the recording met something which cannot be replayed.
+          bool valid;
+
+        public:
+          //! Constructor. The template is empty.
+          TRITON_EXPORT SemanticTemplate();
+
+          //! Clears the template to start a new recording.
+          TRITON_EXPORT void clear(void);
+
+          //! Records a register read.
+          TRITON_EXPORT void addRead(const triton::arch::Register& reg, const triton::ast::SharedAbstractNode& node);
+
+          //! Records a register expression created.
+          TRITON_EXPORT void addWrite(const SharedSymbolicExpression& expr, const triton::ast::SharedAbstractNode& node, const triton::arch::Register& reg, const std::string& comment);
+
+          //! Records a volatile expression created.
+          TRITON_EXPORT void addWrite(const SharedSymbolicExpression& expr, const triton::ast::SharedAbstractNode& node, const std::string& comment);
+
+          //! Marks the recording as not replayable.
+          TRITON_EXPORT void invalidate(void);
+
+          //! Turns the recording of `inst` into a template. Returns false if `inst` can not be replayed from it.
+          TRITON_EXPORT bool build(triton::arch::Instruction& inst, triton::arch::architecture_e arch);
+
+          //! Returns true if the template has been built from the same instruction bytes and architecture.
+          TRITON_EXPORT bool matches(const triton::arch::Instruction& inst, triton::arch::architecture_e arch) const;
+
+          //! Returns the registers read, written or undefined by the instruction.
+          TRITON_EXPORT const std::vector<triton::arch::Register>& getRegisters(void) const;
+
+          //! Creates the expressions of `inst` from the current state of the symbolic engine.
+          TRITON_EXPORT void bind(triton::arch::Instruction& inst, SymbolicEngine* symbolicEngine) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SEMANTICTEMPLATE_H */
@@ -0,0 +1,108 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SHAREDQUERYCACHE_HPP
+#define TRITON_SHAREDQUERYCACHE_HPP
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/queryCanonicalizer.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class SharedQueryCache
+       *  \brief A cache of solver results kept in a file, shared by the processes solving the same queries.
+       *
+       *  \details The file is a fixed-size open-addressing table mapped in memory. Each slot is keyed by the
+       *  canonical hash of a query, its timeout and its number of models, and holds the status of the query
+       *  and its models, the variables being kept by their position in the canonical form. The canonical hash
+       *  does not depend on the ids of the variables, so the processes share the results of the same queries
+       *  on variables created in another order, and the models are rebuilt on the variables of the process.
+       *  A slot is claimed atomically and only published once written, so that concurrent processes can fill
+       *  the same file without lock. When the probed slots are all taken, or the models do not fit in a slot,
+       *  the result is not recorded.
+       */
+      class SharedQueryCache {
+        private:
+          //! The mapped file.
+          triton::uint8* data;
+
+          //! The size of the mapped file.
+          triton::usize size;
+
+          //! The number of slots of the file.
+          triton::usize slots;
+
+          //! Returns the slot at `index`.
+          triton::uint8* getSlot(triton::usize index) const;
+
+        public:
+          //! Constructor. Maps the file at `path`, creating it with `slots` slots if it does not exist.
+          TRITON_EXPORT SharedQueryCache(const std::string& path, triton::usize slots=65536);
+
+          //! Destructor.
+          TRITON_EXPORT ~SharedQueryCache();
+
+          SharedQueryCache(const SharedQueryCache& other) = delete;
+          SharedQueryCache& operator=(const SharedQueryCache& other) = delete;
+
+          //! Returns the number of slots of the file.
+          TRITON_EXPORT triton::usize getCapacity(void) const;
+
+          //! Returns true and sets the status and the models of the query if it has been recorded. The models are rebuilt on the variables of `query`.
+          TRITON_EXPORT bool load(const triton::engines::solver::QueryCanonicalizer& query,
+                                  triton::uint32 timeout,
+                                  triton::uint32 limit,
+                                  triton::engines::solver::status_e& status,
+                                  std::vector<std::unordered_map<triton::usize, SolverModel>>& models) const;
+
+          //! Records the result of the query, unless it does not fit in a slot.
+          TRITON_EXPORT void store(const triton::engines::solver::QueryCanonicalizer& query,
+                                   triton::uint32 timeout,
+                                   triton::uint32 limit,
+                                   triton::engines::solver::status_e status,
+                                   const std::vector<std::unordered_map<triton::usize, SolverModel>>& models);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SHAREDQUERYCACHE_HPP */
@@ -0,0 +1,110 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SIMPLIFICATIONMEMO_H
+#define TRITON_SIMPLIFICATIONMEMO_H
+
+#include <memory>
+#include <unordered_map>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! \class SimplificationMemo
+      /*! \brief The results of the simplifications, by node id.
+       *
+       *  \details The nodes and their results are held weakly: an entry is only given back while both are
+       *  alive and their hashes did not change, so a node modified in place, or a new node taking the id
+       *  of a dead one, is simplified again. The memo is cleared when the signature given to `validate()`
+       *  changes, that is when the simplifications applied change.
+       */
+      class SimplificationMemo {
+        private:
+          //! A memoized simplification.
+          struct Entry {
+            //! The simplified node.
+            std::weak_ptr<triton::ast::AbstractNode> node;
+
+            //! The result of the simplification.
+            std::weak_ptr<triton::ast::AbstractNode> result;
+
+            //! The hash of the node when memoized.
+            triton::uint512 nodeHash;
+
+            //! The hash of the result when memoized.
+            triton::uint512 resultHash;
+          };
+
+          //! The entries, by node id.
+          std::unordered_map<triton::uint32, Entry> entries;
+
+          //! The signature of the simplifications the entries were computed with.
+          triton::usize signature;
+
+          //! The number of entries from which the dead ones are pruned.
+          triton::usize threshold;
+
+          //! The number of results given back.
+          triton::usize hits;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SimplificationMemo();
+
+          //! Clears the memo if `signature` is not the one of its entries.
+          TRITON_EXPORT void validate(triton::usize signature);
+
+          //! Returns the memoized result of `node`, null if there is none.
+          TRITON_EXPORT triton::ast::SharedAbstractNode find(const triton::ast::SharedAbstractNode& node);
+
+          //! Memoizes `result` as the simplification of `node`.
+          TRITON_EXPORT void insert(const triton::ast::SharedAbstractNode& node, const triton::ast::SharedAbstractNode& result);
+
+          //! Returns the number of entries, dead ones included.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns the number of results given back.
+          TRITON_EXPORT triton::usize getHits(void) const;
+
+          //! Removes all entries and resets the number of hits.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SIMPLIFICATIONMEMO_H */
@@ -0,0 +1,61 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SOLVERCORPUS_HPP
+#define TRITON_SOLVERCORPUS_HPP
+
+#include <istream>
+#include <ostream>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverStatistics.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*
+       *  A corpus is a sequence of queries, replayed against a solver to compare its options. A query is
+       *  written as its limit, status, search time and query time, four little-endian 64-bit words,
+       *  followed by its constraint as written by triton::ast::serialize(). The counts of nodes and of
+       *  variables are not written, they are computed again by the replay.
+       */
+
+      //! Appends `query` to a corpus. A query without constraint is not written.
+      TRITON_EXPORT void writeQuery(std::ostream& stream, const triton::engines::solver::SolverQuery& query);
+
+      //! Reads the next query of a corpus, its constraint into `ctxt`. Returns false at the end of the corpus.
+      TRITON_EXPORT bool readQuery(std::istream& stream, const triton::ast::SharedAstContext& ctxt, triton::engines::solver::SolverQuery& query);
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERCORPUS_HPP */
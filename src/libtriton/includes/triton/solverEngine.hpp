@@ -8,17 +8,31 @@
 #ifndef TRITON_SOLVERENGINE_HPP
 #define TRITON_SOLVERENGINE_HPP
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <iostream>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <triton/ast.hpp>
+#include <triton/bitBlastSolver.hpp>
 #include <triton/config.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/queryCanonicalizer.hpp>
+#include <triton/queryConfiguration.hpp>
 #include <triton/solverEnums.hpp>
+#include <triton/solverFuture.hpp>
 #include <triton/solverInterface.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/solverSession.hpp>
+#include <triton/solverStatistics.hpp>
+#include <triton/timeoutBudget.hpp>
 #include <triton/tritonTypes.hpp>
 #ifdef TRITON_Z3_INTERFACE
   #include <triton/z3Solver.hpp>
@@ -26,6 +40,15 @@
 #ifdef TRITON_BITWUZLA_INTERFACE
   #include <triton/bitwuzlaSolver.hpp>
 #endif
+#if defined(TRITON_Z3_INTERFACE) && defined(TRITON_BITWUZLA_INTERFACE)
+  #include <triton/portfolioSolver.hpp>
+#endif
+#ifdef TRITON_REMOTE_INTERFACE
+  #include <triton/remoteSolver.hpp>
+#endif
+#ifdef TRITON_PERSISTENT_CACHE
+  #include <triton/sharedQueryCache.hpp>
+#endif
 
 
 
@@ -60,10 +83,220 @@ namespace triton {
           //! Instance to the real solver class.
           std::unique_ptr<triton::engines::solver::SolverInterface> solver;
 
+        private:
+          //! The key of a query: the canonical hash of the node, the timeout and the number of models (0 for `isSat`).
+          struct QueryKey {
+            //! The canonical hash of the query node.
+            triton::uint512 hash;
+
+            //! The timeout of the query.
+            triton::uint32 timeout;
+
+            //! The number of models of the query.
+            triton::uint32 limit;
+
+            //! Returns true if both keys are equal.
+            bool operator==(const QueryKey& other) const {
+              return this->hash == other.hash && this->timeout == other.timeout && this->limit == other.limit;
+            }
+          };
+
+          //! Hashes a query key.
+          struct QueryKeyHash {
+            triton::usize operator()(const QueryKey& key) const {
+              return static_cast<triton::usize>(static_cast<triton::uint64>(key.hash) ^ (static_cast<triton::uint64>(key.timeout) << 32) ^ key.limit);
+            }
+          };
+
+          //! A cached query result.
+          struct QueryResult {
+            //! The key of the query.
+            QueryKey key;
+
+            //! The status of the query.
+            triton::engines::solver::status_e status;
+
+            //! The models of the query, keyed by the positions of the variables in the canonical form.
+            std::vector<std::unordered_map<triton::usize, SolverModel>> models;
+          };
+
+          //! True if the query cache is enabled.
+          bool queryCacheEnabled;
+
+          //! The maximum number of cached queries.
+          triton::usize queryCacheCapacity;
+
+          //! The cached queries, the most recently used first.
+          mutable std::list<QueryResult> queryResults;
+
+          //! The cached queries <key : result>
+          mutable std::unordered_map<QueryKey, std::list<QueryResult>::iterator, QueryKeyHash> queryCache;
+
+          //! The number of queries answered by the cache.
+          mutable triton::usize queryCacheHits;
+
+          //! The number of queries sent to the solver while the cache is enabled.
+          mutable triton::usize queryCacheMisses;
+
+          #ifdef TRITON_PERSISTENT_CACHE
+          //! The cache file shared by the processes, under the query cache, if one is opened.
+          std::unique_ptr<triton::engines::solver::SharedQueryCache> sharedQueryCache;
+          #endif
+
+          //! Returns the cached result of the query, nullptr if there is none. Its models are translated to the variables of `query`. The results of the shared cache are brought into the cache in memory.
+          const QueryResult* findQuery(const triton::engines::solver::QueryCanonicalizer& query, triton::uint32 timeout, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32* solvingTime, std::vector<std::unordered_map<triton::usize, SolverModel>>* models=nullptr) const;
+
+          //! Caches the result of the query, if it is definitive.
+          void storeQuery(const triton::engines::solver::QueryCanonicalizer& query, triton::uint32 timeout, triton::uint32 limit, triton::engines::solver::status_e status, const std::vector<std::unordered_map<triton::usize, SolverModel>>& models) const;
+
+          //! True if the conjunctions are split into independent clusters before solving.
+          bool independenceEnabled;
+
+          //! Splits a conjunction into clusters of constraints which do not share any variable, the cluster of the last constraint first. Returns the node itself if there is one cluster.
+          std::vector<triton::ast::SharedAbstractNode> splitIndependentConstraints(const triton::ast::SharedAbstractNode& node) const;
+
+          //! True if the constraints decided by their abstract values are not sent to the solver.
+          bool presolverEnabled;
+
+          //! The number of queries decided by the abstract values.
+          mutable triton::usize presolverHits;
+
+          //! Decides a constraint by its abstract value: UNSAT if it is false, SAT if it is true and, for a `model` query, without variable. UNKNOWN otherwise.
+          triton::engines::solver::status_e presolve(const triton::ast::SharedAbstractNode& node, bool model) const;
+
+          //! The configurations of the classes of queries, given to each solver set.
+          triton::engines::solver::QueryConfigurations queries;
+
+          //! True if the counterexample cache is enabled.
+          bool counterexampleEnabled;
+
+          //! The maximum number of kept models.
+          triton::usize counterexampleCapacity;
+
+          //! The models of the previous queries, the most recently used first.
+          mutable std::list<std::unordered_map<triton::usize, SolverModel>> counterexamples;
+
+          //! The number of queries satisfied by a kept model.
+          mutable triton::usize counterexampleHits;
+
+          //! Looks for a kept model satisfying `node`, completed with the current values of the variables it does not define. Returns false if there is none.
+          bool findCounterexample(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::usize, SolverModel>& model) const;
+
+          //! Keeps the model of a satisfiable query.
+          void storeCounterexample(const std::unordered_map<triton::usize, SolverModel>& model) const;
+
+          //! True if the unsat core cache is enabled.
+          bool unsatCoreEnabled;
+
+          //! The maximum number of kept unsat cores.
+          triton::usize unsatCoreCapacity;
+
+          //! The unsat cores of the previous queries, as the sorted structural hashes of their constraints, the most recently used first.
+          mutable std::list<std::vector<triton::uint512>> unsatCores;
+
+          //! The number of queries contradicted by a kept unsat core.
+          mutable triton::usize unsatCoreHits;
+
+          //! Returns `node` with its chains of associative operators flattened if the AST_BALANCING mode of its context is enabled.
+          static triton::ast::SharedAbstractNode balanceQuery(const triton::ast::SharedAbstractNode& node);
+
+          //! Flattens the conjunctions of `node` into their constraints, in order.
+          static std::vector<triton::ast::SharedAbstractNode> getConjuncts(const triton::ast::SharedAbstractNode& node);
+
+          //! Returns true if the constraints of `node` contain a kept unsat core.
+          bool findUnsatCore(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Extracts and keeps the unsat core of an unsatisfiable query.
+          void storeUnsatCore(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout) const;
+
+          //! The adaptive timeouts of the queries.
+          mutable triton::engines::solver::TimeoutBudget timeoutBudget;
+
+          //! The embedded solver of the small queries.
+          triton::engines::solver::BitBlastSolver bitBlastSolver;
+
+          //! True if the small queries are bit-blasted.
+          bool bitBlastingEnabled;
+
+          //! The largest number of nodes of a bit-blasted query.
+          triton::usize bitBlastingMaxNodes;
+
+          //! Returns the solver of `node`: the embedded one if it is bit-blasted, the current solver otherwise.
+          const triton::engines::solver::SolverInterface* route(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Runs `solve` with the adaptive timeout of `node` if `timeout` is 0 and the adaptive timeouts are enabled, retrying it while the retry callback asks for it. Runs it with `timeout` otherwise.
+          void solveBudgeted(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime, const std::function<void(triton::engines::solver::status_e*, triton::uint32, triton::uint32*)>& solve) const;
+
+          //! Computes a model of a cluster, through the query cache.
+          std::unordered_map<triton::usize, SolverModel> solveModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const;
+
+          //! Returns true if a cluster is satisfiable, through the query cache.
+          bool solveSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const;
+
+          //! Computes a model, see `getModel()`.
+          std::unordered_map<triton::usize, SolverModel> computeModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const;
+
+          //! Computes several models, see `getModels()`.
+          std::vector<std::unordered_map<triton::usize, SolverModel>> computeModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const;
+
+          //! Checks the satisfiability, see `isSat()`.
+          bool computeSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const;
+
+          //! True if the statistics of the queries are recorded.
+          bool statisticsEnabled;
+
+          //! The statistics of the queries.
+          mutable triton::engines::solver::SolverStatistics statistics;
+
+          //! Receives the trace of each query.
+          std::function<void(const triton::engines::solver::SolverQuery& query)> traceCallback;
+
+          //! Returns true if the queries are recorded.
+          bool isRecording(void) const;
+
+          //! Records a query of `limit` models (0 for `isSat`) which lasted `queryTime` microseconds.
+          void recordQuery(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e status, triton::uint32 solvingTime, triton::uint64 queryTime) const;
+
+          //! Protects the asynchronous queries.
+          mutable std::mutex asyncLock;
+
+          //! Signals a new asynchronous query to the workers.
+          mutable std::condition_variable asyncPending;
+
+          //! The pending asynchronous queries, in order.
+          mutable std::deque<std::shared_ptr<triton::engines::solver::SolverFuture>> asyncQueries;
+
+          //! The running asynchronous queries.
+          mutable std::unordered_set<std::shared_ptr<triton::engines::solver::SolverFuture>> asyncRunning;
+
+          //! The constraints of the ended queries. They are released by the calling thread, as releasing nodes from a worker would race with the creation of nodes.
+          mutable std::vector<triton::ast::SharedAbstractNode> asyncReleased;
+
+          //! The workers solving the asynchronous queries, started on demand.
+          mutable std::vector<std::thread> asyncWorkers;
+
+          //! The number of workers waiting for a query.
+          mutable triton::usize asyncIdle;
+
+          //! True while the workers are stopped.
+          mutable bool asyncStop;
+
+          //! Solves the asynchronous queries until the workers are stopped.
+          void asyncWork(void) const;
+
+          //! Queues a query of `limit` models (0 for `isSat`) and returns its handle.
+          std::shared_ptr<triton::engines::solver::SolverFuture> submit(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::uint32 timeout) const;
+
+          //! Cancels the asynchronous queries and stops the workers.
+          void stopAsync(void);
+
         public:
           //! Constructor.
           TRITON_EXPORT SolverEngine();
 
+          //! Destructor.
+          TRITON_EXPORT ~SolverEngine();
+
           //! Returns the kind of solver as triton::engines::solver::solver_e.
           TRITON_EXPORT triton::engines::solver::solver_e getSolver(void) const;
 
@@ -76,6 +309,11 @@ namespace triton {
           //! Initializes a custom solver.
           TRITON_EXPORT void setCustomSolver(triton::engines::solver::SolverInterface* customSolver);
 
+          #ifdef TRITON_REMOTE_INTERFACE
+          //! Initializes the remote solver with the workers `host:port`, at least one must be reachable.
+          TRITON_EXPORT void setRemoteSolver(const std::vector<std::string>& endpoints);
+          #endif
+
           //! Returns true if the solver is valid.
           TRITON_EXPORT bool isValid(void) const;
 
@@ -97,9 +335,30 @@ namespace triton {
            */
           TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+          //! Enumerates the models of a symbolic constraint, distinct on the `projection` variables (all the variables if it is empty), and streams them to `callback` until it returns false or `limit` models are found (0 for unlimited). The caches are not used. Returns the number of models.
+          TRITON_EXPORT triton::usize enumerateModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, const triton::engines::solver::ModelCallback& callback, triton::uint32 limit = 0, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+          //! Returns true if `node` has the same value for any value of its variables, this value being returned in `value`. The node is first evaluated on `samples` inputs (see `AstContext::sampleConstant()`), a node which varies being rejected without solver query, and the solver then proves that no input gives another value. Without samples, the value proved is the current one.
+          TRITON_EXPORT bool isOpaquePredicate(const triton::ast::SharedAbstractNode& node, triton::uint512* value = nullptr, triton::usize samples = 4096, triton::uint32 timeout = 0) const;
+
+          //! Computes a model of each node on `threads` threads (0 for one per core), each query with its own solver context. `callback` receives the results on the calling thread, as they finish, with the index of their node. The caches are not used. Custom solvers solve on the calling thread.
+          TRITON_EXPORT void solveAll(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::usize threads, triton::uint32 timeout, const std::function<void(triton::usize index, triton::engines::solver::status_e status, const std::unordered_map<triton::usize, SolverModel>& model, triton::uint32 solvingTime)>& callback) const;
+
+          //! Queues the computation of a model of `node`, solved in the background, and returns its handle. The caches are not used. Custom solvers solve on the calling thread. The constraint must not be modified until the query ends.
+          TRITON_EXPORT std::shared_ptr<triton::engines::solver::SolverFuture> getModelAsync(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout = 0) const;
+
+          //! Queues the satisfiability check of `node`, solved in the background, and returns its handle. See `getModelAsync()`.
+          TRITON_EXPORT std::shared_ptr<triton::engines::solver::SolverFuture> isSatAsync(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout = 0) const;
+
+          //! Cancels the pending and running asynchronous queries.
+          TRITON_EXPORT void cancelAsync(void);
+
+          //! Returns the number of pending and running asynchronous queries.
+          TRITON_EXPORT triton::usize getAsyncSize(void) const;
+
           //! Returns the name of the solver.
           TRITON_EXPORT std::string getName(void) const;
 
@@ -108,6 +367,135 @@ namespace triton {
 
           //! Defines a solver memory consumption limit (in megabytes).
           TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
+
+          //! Enables or disables the cache of the query results, keyed by the canonical hash of the query, its timeout and its number of models. The canonical form follows the references, sorts the operands of the commutative operators, puts the constants of the comparisons on the right and numbers the variables by position, so that a query hits the results of the same query on other variables. The `capacity` least recently used results are kept. Disabling clears it.
+          TRITON_EXPORT void enableQueryCache(bool flag, triton::usize capacity=1024);
+
+          //! Returns true if the cache of the query results is enabled.
+          TRITON_EXPORT bool isQueryCacheEnabled(void) const;
+
+          //! Returns the number of cached query results.
+          TRITON_EXPORT triton::usize getQueryCacheSize(void) const;
+
+          //! Returns the number of queries answered by the cache.
+          TRITON_EXPORT triton::usize getQueryCacheHits(void) const;
+
+          //! Returns the number of queries sent to the solver while the cache is enabled.
+          TRITON_EXPORT triton::usize getQueryCacheMisses(void) const;
+
+          //! Clears the cache of the query results and its statistics.
+          TRITON_EXPORT void clearQueryCache(void);
+
+          //! Opens the query cache file at `path` shared by the processes, creating it with `slots` slots if it does not exist. While the query cache is enabled, the queries missing from memory are looked up in the file and the solved ones are recorded in it. Needs `PERSISTENT_CACHE`.
+          TRITON_EXPORT void openSharedQueryCache(const std::string& path, triton::usize slots=65536);
+
+          //! Closes the shared query cache file. The cache in memory is kept.
+          TRITON_EXPORT void closeSharedQueryCache(void);
+
+          //! Returns true if a shared query cache file is opened.
+          TRITON_EXPORT bool isSharedQueryCacheOpen(void) const;
+
+          //! Enables or disables the adaptive timeouts. The queries without explicit timeout receive a few times their predicted solving time, within the bounds of a query and out of the budget of the current round.
+          TRITON_EXPORT void enableAdaptiveTimeout(bool flag);
+
+          //! Returns true if the timeouts are adaptive.
+          TRITON_EXPORT bool isAdaptiveTimeoutEnabled(void) const;
+
+          //! Sets the smallest and the largest adaptive timeout of a query, in milliseconds.
+          TRITON_EXPORT void setAdaptiveTimeoutBounds(triton::uint32 minTimeout, triton::uint32 maxTimeout);
+
+          //! Starts an exploration round with `budget` milliseconds to hand out to the queries, 0 for an unlimited round. Once the round is spent, the queries time out without solver.
+          TRITON_EXPORT void startTimeoutRound(triton::uint64 budget);
+
+          //! Returns the time left in the current round, in milliseconds. Returns 0 for an unlimited round.
+          TRITON_EXPORT triton::uint64 getTimeoutRoundRemaining(void) const;
+
+          //! Sets the callback deciding if a timed out query is retried with twice its timeout, at most `retries` times. An empty callback disables the retries.
+          TRITON_EXPORT void setTimeoutRetryCallback(const triton::engines::solver::TimeoutBudget::RetryCallback& callback, triton::uint32 retries=2);
+
+          //! Returns the predicted solving time of a query, in milliseconds.
+          TRITON_EXPORT triton::uint32 predictSolvingTime(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Enables or disables the bit-blasting of the small queries. A query of at most `maxNodes` nodes without arrays nor quantifiers is solved by the embedded SAT solver, see `BitBlastSolver`, the others by the current solver.
+          TRITON_EXPORT void enableBitBlasting(bool flag, triton::usize maxNodes=512);
+
+          //! Returns true if the small queries are bit-blasted.
+          TRITON_EXPORT bool isBitBlastingEnabled(void) const;
+
+          //! Enables or disables the counterexample cache. The `capacity` most recently used models are kept, and a query satisfied by one of them under evaluation is not sent to the solver. Disabling clears it.
+          TRITON_EXPORT void enableCounterexampleCache(bool flag, triton::usize capacity=64);
+
+          //! Returns true if the counterexample cache is enabled.
+          TRITON_EXPORT bool isCounterexampleCacheEnabled(void) const;
+
+          //! Returns the number of kept models.
+          TRITON_EXPORT triton::usize getCounterexampleCacheSize(void) const;
+
+          //! Returns the number of queries satisfied by a kept model.
+          TRITON_EXPORT triton::usize getCounterexampleCacheHits(void) const;
+
+          //! Clears the kept models and the statistics of the counterexample cache.
+          TRITON_EXPORT void clearCounterexampleCache(void);
+
+          //! Enables or disables the unsat core cache. Once a conjunction is proved unsatisfiable, the solver extracts an unsatisfiable subset of its constraints (a core), kept as their structural hashes. A query containing one of the `capacity` most recently used cores is unsatisfiable without solver. Disabling clears it.
+          TRITON_EXPORT void enableUnsatCoreCache(bool flag, triton::usize capacity=256);
+
+          //! Returns true if the unsat core cache is enabled.
+          TRITON_EXPORT bool isUnsatCoreCacheEnabled(void) const;
+
+          //! Returns the number of kept unsat cores.
+          TRITON_EXPORT triton::usize getUnsatCoreCacheSize(void) const;
+
+          //! Returns the number of queries contradicted by a kept unsat core.
+          TRITON_EXPORT triton::usize getUnsatCoreCacheHits(void) const;
+
+          //! Clears the kept unsat cores and the statistics of the unsat core cache.
+          TRITON_EXPORT void clearUnsatCoreCache(void);
+
+          //! Enables or disables the split of the conjunctions into independent clusters, solved separately by `getModel()` and `isSat()`. With the query cache, the clusters already solved are answered by the cache.
+          TRITON_EXPORT void enableConstraintIndependence(bool flag);
+
+          //! Returns true if the conjunctions are split into independent clusters before solving.
+          TRITON_EXPORT bool isConstraintIndependenceEnabled(void) const;
+
+          //! Enables or disables the presolver. The constraints that the known bits and ranges of their nodes prove false are unsatisfiable without solver, and the ones proved true are satisfiable for `isSat()`, see `AstContext::getAbstractValue()`. Disabling clears its statistics.
+          TRITON_EXPORT void enablePresolver(bool flag);
+
+          //! Returns true if the presolver is enabled.
+          TRITON_EXPORT bool isPresolverEnabled(void) const;
+
+          //! Returns the number of queries decided by the presolver.
+          TRITON_EXPORT triton::usize getPresolverHits(void) const;
+
+          //! Enables or disables the classification of the queries. A classified query is solved with the configuration of its class, otherwise with the one of `QUERY_ANY`. Enabled by default.
+          TRITON_EXPORT void enableQueryClassification(bool flag);
+
+          //! Returns true if the queries are classified.
+          TRITON_EXPORT bool isQueryClassificationEnabled(void) const;
+
+          //! Sets the configuration of the solvers for a class of queries. It must not change while asynchronous queries are running.
+          TRITON_EXPORT void setQueryConfiguration(triton::engines::solver::query_e query, const triton::engines::solver::SolverConfiguration& config);
+
+          //! Returns the configuration of the solvers for a class of queries.
+          TRITON_EXPORT const triton::engines::solver::SolverConfiguration& getQueryConfiguration(triton::engines::solver::query_e query) const;
+
+          //! Enables or disables the statistics of the queries of `getModel()`, `getModels()`, `enumerateModels()`, `isSat()` and `solveAll()`. The asynchronous queries and the sessions are not recorded.
+          TRITON_EXPORT void enableStatistics(bool flag);
+
+          //! Returns true if the statistics of the queries are recorded.
+          TRITON_EXPORT bool isStatisticsEnabled(void) const;
+
+          //! Returns the statistics of the queries.
+          TRITON_EXPORT triton::engines::solver::SolverStatistics getStatistics(void) const;
+
+          //! Clears the statistics of the queries. The hits of the caches are cleared with the caches.
+          TRITON_EXPORT void clearStatistics(void);
+
+          //! Defines the callback receiving the trace of each query recorded by the statistics, even if they are disabled. The callback is called on the calling thread, once the query ends. An empty callback removes it.
+          TRITON_EXPORT void setTraceCallback(const std::function<void(const triton::engines::solver::SolverQuery& query)>& callback);
+
+          //! Returns a new incremental solving session of the current solver. The session must not outlive the solver.
+          TRITON_EXPORT std::shared_ptr<triton::engines::solver::SolverSession> newSession(void) const;
       };
 
     /*! @} End of solver namespace */
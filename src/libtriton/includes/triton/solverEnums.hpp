@@ -45,6 +45,13 @@ namespace triton {
         #ifdef TRITON_BITWUZLA_INTERFACE
         SOLVER_BITWUZLA,    /*!< bitwuzla solver. */
         #endif
+        #if defined(TRITON_Z3_INTERFACE) && defined(TRITON_BITWUZLA_INTERFACE)
+        SOLVER_PORTFOLIO,   /*!< z3 and bitwuzla racing. */
+        #endif
+        #ifdef TRITON_REMOTE_INTERFACE
+        SOLVER_REMOTE,      /*!< remote workers. */
+        #endif
+        SOLVER_BITBLAST,    /*!< embedded bit-blasting SAT solver. */
       };
 
       /*! The different kind of status */
@@ -56,6 +63,15 @@ namespace triton {
         UNKNOWN    /*!< UNKNOWN */
       };
 
+      /*! The classes of queries, configured separately (see QueryConfigurations) */
+      enum query_e {
+        QUERY_ANY = 0,    /*!< any query, e.g. with quantifiers, or every query if they are not classified. */
+        QUERY_QF_BV,      /*!< quantifier-free bit-vectors. */
+        QUERY_QF_ABV,     /*!< quantifier-free bit-vectors over the memory array. */
+        QUERY_EQUALITIES, /*!< equalities of variables, constants, extractions and concatenations. */
+        QUERY_CLASSES     /*!< the number of classes. */
+      };
+
     /*! @} End of solver namespace */
     };
   /*! @} End of engines namespace */
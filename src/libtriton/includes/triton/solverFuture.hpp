@@ -0,0 +1,144 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SOLVERFUTURE_HPP
+#define TRITON_SOLVERFUTURE_HPP
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverInterrupt.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      class SolverInterface;
+
+      /*! \class SolverFuture
+       *  \brief The handle of a query solved in the background.
+       *
+       *  \details The result getters wait for the end of the query. A cancelled query ends with an unknown
+       *  status and no model, and an exception thrown by the solver is thrown again by the getters.
+       */
+      class SolverFuture {
+        private:
+          //! Protects the state of the query.
+          mutable std::mutex lock;
+
+          //! Signals the end of the query.
+          mutable std::condition_variable done;
+
+          //! Stops the running search.
+          triton::engines::solver::SolverInterrupt interrupt;
+
+          //! The constraint, until the query starts.
+          triton::ast::SharedAbstractNode node;
+
+          //! The number of models (0 for `isSat`).
+          triton::uint32 limit;
+
+          //! The timeout of the query.
+          triton::uint32 timeout;
+
+          //! True once the query is started.
+          bool started;
+
+          //! True once the query is ended.
+          bool ready;
+
+          //! True if the query is cancelled.
+          bool cancelled;
+
+          //! The status of the query.
+          triton::engines::solver::status_e status;
+
+          //! The models of the query.
+          std::vector<std::unordered_map<triton::usize, SolverModel>> models;
+
+          //! The solving time of the query.
+          triton::uint32 solvingTime;
+
+          //! The exception thrown by the solver, if any.
+          std::exception_ptr error;
+
+          //! Waits for the end of the query and throws the exception of the solver, if any.
+          void get(void) const;
+
+        public:
+          //! Constructor. `limit` is the number of models, 0 for `isSat`.
+          TRITON_EXPORT SolverFuture(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::uint32 timeout);
+
+          //! Solves the query with `solver`, unless it is cancelled. Returns the constraint, which the caller releases.
+          TRITON_EXPORT triton::ast::SharedAbstractNode solve(const triton::engines::solver::SolverInterface* solver);
+
+          //! Cancels the query. A pending query ends at once, a running one once its solver is interrupted.
+          TRITON_EXPORT void cancel(void);
+
+          //! Returns true if the query is cancelled.
+          TRITON_EXPORT bool isCancelled(void) const;
+
+          //! Returns true if the query is ended.
+          TRITON_EXPORT bool isReady(void) const;
+
+          //! Waits for the end of the query.
+          TRITON_EXPORT void wait(void) const;
+
+          //! Waits for the end of the query at most `ms` milliseconds. Returns true if it is ended.
+          TRITON_EXPORT bool waitFor(triton::uint32 ms) const;
+
+          //! Returns the status of the query.
+          TRITON_EXPORT triton::engines::solver::status_e getStatus(void) const;
+
+          //! Returns true if the constraint is satisfiable.
+          TRITON_EXPORT bool isSat(void) const;
+
+          //! Returns the first model of the query, empty if there is none.
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> getModel(void) const;
+
+          //! Returns the models of the query.
+          TRITON_EXPORT const std::vector<std::unordered_map<triton::usize, SolverModel>>& getModels(void) const;
+
+          //! Returns the solving time of the query.
+          TRITON_EXPORT triton::uint32 getSolvingTime(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERFUTURE_HPP */
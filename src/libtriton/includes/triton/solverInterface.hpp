@@ -8,13 +8,18 @@
 #ifndef TRITON_SOLVERINTERFACE_HPP
 #define TRITON_SOLVERINTERFACE_HPP
 
+#include <functional>
 #include <unordered_map>
 #include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/queryConfiguration.hpp>
 #include <triton/solverEnums.hpp>
+#include <triton/solverInterrupt.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/solverSession.hpp>
+#include <triton/symbolicVariable.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -40,9 +45,16 @@ namespace triton {
      *  @{
      */
 
+      //! The callback receiving the models of an enumeration, which goes on while it returns true.
+      using ModelCallback = std::function<bool(const std::unordered_map<triton::usize, SolverModel>& model)>;
+
       /*! \interface SolverInterface
           \brief This interface is used to interface with solvers */
       class SolverInterface {
+        protected:
+          //! Returns the variables of an enumeration: `projection`, or the variables of `node` if it is empty.
+          TRITON_EXPORT static std::vector<triton::engines::symbolic::SharedSymbolicVariable> getProjection(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection);
+
         public:
           //! Destructor.
           TRITON_EXPORT virtual ~SolverInterface(){};
@@ -65,9 +77,32 @@ namespace triton {
            */
           TRITON_EXPORT virtual std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const = 0;
 
+          //! Computes and returns several models from a symbolic constraint, as `getModels()`, while `interrupt` may stop the search from another thread. By default, the search is not interruptible and only a query interrupted before it starts is skipped.
+          TRITON_EXPORT virtual std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime, triton::engines::solver::SolverInterrupt* interrupt) const {
+            if (interrupt != nullptr && interrupt->isInterrupted()) {
+              if (status)
+                *status = triton::engines::solver::UNKNOWN;
+              return {};
+            }
+            return this->getModels(node, limit, status, timeout, solvingTime);
+          }
+
+          //! Enumerates the models of a symbolic constraint, distinct on the `projection` variables, and streams them to `callback` instead of keeping them.
+          /*!
+           * \details The models are blocked on the projection only, all the variables of `node` if it is empty, and
+           * only the projection is in a model. The enumeration stops once `limit` models are found (0 for unlimited)
+           * or once `callback` returns false. The `timeout` applies to each check, and the status of the last check
+           * is returned in the `status` pointer: UNSAT once every model is enumerated. By default, each model is a
+           * new query blocking the previous ones. Returns the number of models.
+           */
+          TRITON_EXPORT virtual triton::usize enumerateModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, const ModelCallback& callback, triton::uint32 limit = 0, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT virtual bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const = 0;
 
+          //! Returns the sorted positions in `nodes` of constraints whose conjunction is unsatisfiable, the conjunction of `nodes` being so. Empty if the core cannot be extracted in `timeout`. By default, all the positions are returned.
+          TRITON_EXPORT virtual std::vector<triton::usize> getUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 timeout = 0) const;
+
           //! Returns the name of the solver.
           TRITON_EXPORT virtual std::string getName(void) const = 0;
 
@@ -76,6 +111,16 @@ namespace triton {
 
           //! Defines a solver memory consumption limit (in megabytes).
           TRITON_EXPORT virtual void setMemoryLimit(triton::uint32 mem) = 0;
+
+          //! Sets the configurations of the classes of queries. By default, they are ignored.
+          TRITON_EXPORT virtual void setQueryConfigurations(const QueryConfigurations& configurations) {
+            (void)configurations;
+          }
+
+          //! Returns a new incremental solving session, owned by the caller. By default, the queries of the session are conjunctions of its constraints.
+          TRITON_EXPORT virtual SolverSession* newSession(void) const {
+            return new SolverSession(this);
+          }
       };
 
     /*! @} End of solver namespace */
@@ -0,0 +1,81 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SOLVERINTERRUPT_HPP
+#define TRITON_SOLVERINTERRUPT_HPP
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+#include <triton/dllexport.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class SolverInterrupt
+       *  \brief Stops a running query from another thread.
+       *
+       *  \details A solver polling its termination state checks `isInterrupted()`, a solver which must be
+       *  interrupted explicitly sets a handler for the time of its search. Once interrupted, it stays interrupted.
+       */
+      class SolverInterrupt {
+        private:
+          //! Protects the handler.
+          std::mutex lock;
+
+          //! True once interrupted.
+          std::atomic<bool> interrupted;
+
+          //! Stops the running search, if any.
+          std::function<void(void)> handler;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SolverInterrupt();
+
+          //! Interrupts the query.
+          TRITON_EXPORT void interrupt(void);
+
+          //! Returns true if the query is interrupted.
+          TRITON_EXPORT bool isInterrupted(void) const;
+
+          //! Sets the handler stopping the running search. It is called at once if the query is already interrupted.
+          TRITON_EXPORT void setHandler(const std::function<void(void)>& handler);
+
+          //! Removes the handler, before the search it stops is destroyed.
+          TRITON_EXPORT void clearHandler(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERINTERRUPT_HPP */
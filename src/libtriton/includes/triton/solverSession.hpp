@@ -0,0 +1,98 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SOLVERSESSION_HPP
+#define TRITON_SOLVERSESSION_HPP
+
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      class SolverInterface;
+
+      /*! \class SolverSession
+       *  \brief An incremental solving session, which keeps a stack of asserted constraints between the queries.
+       *
+       *  \details The constraints are asserted once, in their own scope, and a query only checks its own constraint
+       *  on top of them. For instance, flipping the branches of a path one after the other only asserts one new
+       *  path constraint per query. By default, each query is sent to the solver as the conjunction of the
+       *  constraints; the solvers supporting push/pop keep a live solver instead.
+       */
+      class SolverSession {
+        private:
+          //! The solver of the non-incremental queries.
+          const triton::engines::solver::SolverInterface* solver;
+
+        protected:
+          //! The asserted constraints, one scope each.
+          std::vector<triton::ast::SharedAbstractNode> constraints;
+
+          //! Asserts a constraint in a new scope.
+          TRITON_EXPORT virtual void push(const triton::ast::SharedAbstractNode& node);
+
+          //! Removes the scope of the last constraint.
+          TRITON_EXPORT virtual void pop(void);
+
+          //! Checks `node` on top of the asserted constraints, and returns a model if `model` is true and it is satisfiable.
+          TRITON_EXPORT virtual std::unordered_map<triton::usize, SolverModel> check(const triton::ast::SharedAbstractNode& node, bool model, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SolverSession(const triton::engines::solver::SolverInterface* solver);
+
+          //! Destructor.
+          TRITON_EXPORT virtual ~SolverSession();
+
+          //! Asserts `nodes` in order. The constraints in common with the asserted ones are kept, the others are removed.
+          TRITON_EXPORT void synchronize(const std::vector<triton::ast::SharedAbstractNode>& nodes);
+
+          //! Computes and returns a model of `node` and the asserted constraints. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr);
+
+          //! Returns true if `node` and the asserted constraints are satisfiable.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr);
+
+          //! Returns the number of asserted constraints.
+          TRITON_EXPORT triton::usize getSize(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERSESSION_HPP */
@@ -0,0 +1,130 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SOLVERSTATISTICS_HPP
+#define TRITON_SOLVERSTATISTICS_HPP
+
+#include <array>
+
+#include <triton/ast.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! The number of buckets of the time histogram: < 1ms, < 10ms, < 100ms, < 1s, < 10s and more.
+      const triton::usize timeBuckets = 6;
+
+      //! The number of query statuses.
+      const triton::usize statusCount = triton::engines::solver::UNKNOWN + 1;
+
+      /*! \struct SolverQuery
+       *  \brief The trace of a query.
+       */
+      struct SolverQuery {
+        //! The constraint.
+        triton::ast::SharedAbstractNode node;
+
+        //! The number of models asked (0 for `isSat`).
+        triton::uint32 limit;
+
+        //! The status of the query.
+        triton::engines::solver::status_e status;
+
+        //! The search time of the solver, in milliseconds.
+        triton::uint32 solvingTime;
+
+        //! The whole time of the query, in microseconds.
+        triton::uint64 queryTime;
+
+        //! The number of distinct AST nodes of the constraint, the referenced expressions included.
+        triton::usize nodes;
+
+        //! The number of distinct symbolic variables of the constraint.
+        triton::usize variables;
+      };
+
+      /*! \struct SolverStatistics
+       *  \brief The statistics of the queries of a solver engine.
+       *
+       *  \details The times are in microseconds. The search time comes from the solvers, at a millisecond
+       *  resolution, and the translation time is the rest of the query: the translation of the constraint,
+       *  the caches and the extraction of the models.
+       */
+      struct SolverStatistics {
+        //! The number of queries.
+        triton::usize queries = 0;
+
+        //! The number of queries, indexed by status.
+        std::array<triton::usize, statusCount> statuses = {};
+
+        //! The number of queries, indexed by the power of ten of their time in milliseconds.
+        std::array<triton::usize, timeBuckets> histogram = {};
+
+        //! The total number of AST nodes of the constraints.
+        triton::usize nodes = 0;
+
+        //! The largest number of AST nodes of a constraint.
+        triton::usize maxNodes = 0;
+
+        //! The total number of symbolic variables of the constraints.
+        triton::usize variables = 0;
+
+        //! The total time of the queries.
+        triton::uint64 queryTime = 0;
+
+        //! The total search time of the solver.
+        triton::uint64 checkTime = 0;
+
+        //! The total time outside of the search.
+        triton::uint64 translationTime = 0;
+
+        //! The longest query time.
+        triton::uint64 maxQueryTime = 0;
+
+        //! The number of queries answered by the query cache.
+        triton::usize queryCacheHits = 0;
+
+        //! The number of queries sent to the solver while the query cache is enabled.
+        triton::usize queryCacheMisses = 0;
+
+        //! The number of queries satisfied by the counterexample cache.
+        triton::usize counterexampleHits = 0;
+
+        //! The number of queries decided by the presolver.
+        triton::usize presolverHits = 0;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERSTATISTICS_HPP */
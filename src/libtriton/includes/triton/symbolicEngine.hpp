@@ -8,27 +8,39 @@
 #ifndef TRITON_SYMBOLICENGINE_H
 #define TRITON_SYMBOLICENGINE_H
 
+#include <array>
+#include <atomic>
+#include <functional>
+#include <istream>
 #include <map>
 #include <memory>
+#include <ostream>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <triton/architecture.hpp>
 #include <triton/armOperandProperties.hpp>
 #include <triton/ast.hpp>
 #include <triton/astContext.hpp>
+#include <triton/astSsa.hpp>
 #include <triton/callbacks.hpp>
+#include <triton/copyOnWrite.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/memoryAccess.hpp>
+#include <triton/memoryUsage.hpp>
 #include <triton/modes.hpp>
 #include <triton/pathManager.hpp>
 #include <triton/register.hpp>
+#include <triton/semanticTemplate.hpp>
 #include <triton/symbolicEnums.hpp>
 #include <triton/symbolicExpression.hpp>
+#include <triton/symbolicMemory.hpp>
 #include <triton/symbolicSimplification.hpp>
 #include <triton/symbolicVariable.hpp>
 #include <triton/tritonTypes.hpp>
+#include <triton/undoJournal.hpp>
 
 
 
@@ -55,6 +67,48 @@ namespace triton {
      *  @{
      */
 
+      //! An expression whose AST exceeded the budget of the symbolic engine.
+      struct BudgetEvent {
+        //! The address of the instruction.
+        triton::uint64 address;
+
+        //! The id of the first symbolic expression created from the AST.
+        triton::usize id;
+
+        //! The level of the AST.
+        triton::uint32 level;
+
+        //! The number of nodes of the AST, counted up to the budget only.
+        triton::usize nodes;
+
+        //! True if the expression fell back to its concrete value.
+        bool concretized;
+      };
+
+      //! A loop detected on the executed trace (see LOOP_SUMMARIZATION).
+      struct LoopSummary {
+        //! The address of the branch going back to the head of the loop.
+        triton::uint64 address;
+
+        //! The address of the head of the loop.
+        triton::uint64 target;
+
+        //! The number of times the branch went back to the head.
+        triton::usize iterations;
+
+        //! The number of path constraints of the iterations dropped, being implied by the previous ones.
+        triton::usize constraints;
+
+        //! The registers summarized as induction variables.
+        std::vector<triton::arch::register_e> inductions;
+
+        //! True if the loop has been unrolled up to the bound, then concretized.
+        bool concretized;
+      };
+
+      //! Returns the values of an address AST feasible under the path predicate, at most `limit`, or none if there are more or if they are unknown.
+      using PointerResolver = std::function<std::vector<triton::uint64>(const triton::ast::SharedAbstractNode& address, triton::usize limit)>;
+
       //! \class SymbolicEngine
       /*! \brief The symbolic engine class. */
       class SymbolicEngine
@@ -65,30 +119,204 @@ namespace triton {
           //! Number of registers
           triton::uint32 numberOfRegisters;
 
-          //! Symbolic expressions id.
-          triton::usize uniqueSymExprId;
+          //! Symbolic expressions id. Atomic, so that several threads may create expressions.
+          std::atomic<triton::usize> uniqueSymExprId;
+
+          //! Symbolic variables id. Shared between copies of the engine as they also share the AST context which names variables.
+          std::shared_ptr<std::atomic<triton::usize>> uniqueSymVarId;
+
+          //! The map of symbolic variables <id : SymbolicVariable> (shared copy-on-write between copies of the engine)
+          mutable triton::utils::CopyOnWrite<std::unordered_map<triton::usize, WeakSymbolicVariable>> symbolicVariables;
+
+          //! The indexes of the symbolic variables, so that the lookups do not scan all of them.
+          struct VariableIndexes {
+            //! The variables by the alias given at their creation <alias : SymbolicVariable>.
+            std::unordered_multimap<std::string, WeakSymbolicVariable> aliases;
 
-          //! Symbolic variables id.
-          triton::usize uniqueSymVarId;
+            //! The memory and register variables by origin <address or register id : SymbolicVariable>.
+            std::unordered_multimap<triton::uint64, WeakSymbolicVariable> origins;
 
-          //! The map of symbolic variables <id : SymbolicVariable>
-          mutable std::unordered_map<triton::usize, WeakSymbolicVariable> symbolicVariables;
+            //! The size of the alias index from which the dead entries are removed.
+            triton::usize aliasesThreshold = 1024;
 
-          //! The map of symbolic expressions <id : SymbolicExpression>
-          mutable std::unordered_map<triton::usize, WeakSymbolicExpression> symbolicExpressions;
+            //! The size of the origin index from which the dead entries are removed.
+            triton::usize originsThreshold = 1024;
+          };
 
-          //! The map of aligned symbolic expressions (used for symbolic optimizations) <<addr : size> : SharedSymbolicExpression>
-          std::map<std::pair<triton::uint64, triton::uint32>, SharedSymbolicExpression> alignedBitvectorMemory;
+          //! The indexes of the symbolic variables (shared copy-on-write between copies of the engine)
+          mutable triton::utils::CopyOnWrite<VariableIndexes> variableIndexes;
+
+          //! The map of symbolic expressions <id : SymbolicExpression> (shared copy-on-write between copies of the engine)
+          mutable triton::utils::CopyOnWrite<std::unordered_map<triton::usize, WeakSymbolicExpression>> symbolicExpressions;
+
+          //! The indexes of the symbolic expressions, so that the queries do not scan all of them.
+          struct ExpressionIndexes {
+            //! The tainted expressions, recorded once their instruction is processed <id : SymbolicExpression>.
+            std::unordered_map<triton::usize, WeakSymbolicExpression> tainted;
+
+            //! The expressions by type <id : SymbolicExpression>.
+            std::array<std::unordered_map<triton::usize, WeakSymbolicExpression>, 3> types;
+
+            //! The expressions by address of their instruction, in creation order <address : expressions>.
+            std::unordered_map<triton::uint64, std::vector<WeakSymbolicExpression>> addresses;
+
+            //! The size of the tainted index from which the dead entries are removed.
+            triton::usize taintedThreshold = 1024;
+
+            //! The sizes of the type indexes from which the dead entries are removed.
+            std::array<triton::usize, 3> typesThresholds = {{1024, 1024, 1024}};
+          };
+
+          //! The indexes of the symbolic expressions (shared copy-on-write between copies of the engine)
+          mutable triton::utils::CopyOnWrite<ExpressionIndexes> expressionIndexes;
+
+          //! The interned comments of the symbolic expressions <comment : shared comment>.
+          std::unordered_map<std::string, std::weak_ptr<const std::string>> comments;
+
+          //! The size of the comments map from which the dead entries are removed.
+          triton::usize commentsThreshold;
+
+          //! The size of the symbolic expressions map from which the dead entries are removed.
+          triton::usize expressionsThreshold;
+
+          //! The size of the symbolic variables map from which the dead entries are removed.
+          triton::usize variablesThreshold;
 
           //! The list of all symbolic registers.
           std::vector<SharedSymbolicExpression> symbolicReg;
 
-          //! A bitvector memory model represented by a map of <address:SymbolicExpression>
-          std::unordered_map<triton::uint64, SharedSymbolicExpression> memoryBitvector;
+          //! The constant node of the last read of each concrete register, reused while the register holds its value.
+          std::vector<triton::ast::SharedAbstractNode> concreteRegisterNodes;
+
+          //! The bitvector memory model, with the aligned symbolic expressions used for symbolic optimizations (shared copy-on-write)
+          triton::utils::CopyOnWrite<triton::engines::symbolic::SymbolicMemory> memoryBitvector;
 
           //! An array memory model.
           SharedSymbolicExpression memoryArray;
 
+          //! The AST level of the memory array from which its store chain is compacted.
+          triton::uint32 memoryArrayThreshold;
+
+          //! The undo journal of the processed instructions, nullptr if disabled. Never shared between copies of the engine.
+          std::unique_ptr<triton::engines::symbolic::UndoJournal> journal;
+
+          //! The template recording the semantics being built, nullptr if none. Never shared between copies of the engine.
+          triton::engines::symbolic::SemanticTemplate* recorder;
+
+          //! True if the flags are deferred as in LAZY_FLAGS mode, while a basic block is processed. Never shared between copies of the engine.
+          bool deferringFlags;
+
+          //! A register expression deferred until the register is read (see LAZY_FLAGS).
+          struct LazyRegister {
+            //! Builds the AST of the expression.
+            std::function<triton::ast::SharedAbstractNode(void)> builder;
+
+            //! The register assigned.
+            triton::arch::Register reg;
+
+            //! The comment of the expression.
+            std::string comment;
+
+            //! The taint of the expression.
+            bool tainted;
+
+            //! The instruction listing the expression once built, only while a basic block is processed.
+            triton::arch::Instruction* inst;
+          };
+
+          //! The deferred register expressions <parent id : LazyRegister>.
+          std::unordered_map<triton::uint32, LazyRegister> lazyRegisters;
+
+          //! A write to a part of a register kept apart from the expression of its parent (see LAZY_SUBREGISTERS).
+          struct SubRegisterSlice {
+            //! The highest bit of the part in its parent.
+            triton::uint32 high;
+
+            //! The lowest bit of the part in its parent.
+            triton::uint32 low;
+
+            //! The expression of the part.
+            SharedSymbolicExpression expr;
+          };
+
+          //! The parts written since the last expression of their parent, in the order of the writes <parent id : slices>.
+          std::unordered_map<triton::uint32, std::vector<SubRegisterSlice>> subRegisterSlices;
+
+          //! The effective address of a memory operand, with the registers it was built from (see EFFECTIVE_ADDRESS_CACHE).
+          struct EffectiveAddress {
+            //! The opcode of the instruction.
+            std::string opcode;
+
+            //! The expressions of the base, index and segment registers, nullptr if concrete.
+            std::array<SharedSymbolicExpression, 3> exprs;
+
+            //! The values of the concrete base, index and segment registers.
+            std::array<triton::uint512, 3> values;
+
+            //! The AST of the effective address.
+            triton::ast::SharedAbstractNode leaAst;
+          };
+
+          //! The effective addresses of the memory operands <instruction address : an entry per operand>.
+          std::unordered_map<triton::uint64, std::vector<EffectiveAddress>> effectiveAddresses;
+
+          //! The maximum number of nodes of an AST assigned by the semantics, 0 if unbounded.
+          triton::usize budgetNodes;
+
+          //! The maximum level of an AST assigned by the semantics, 0 if unbounded.
+          triton::uint32 budgetLevel;
+
+          //! The policy applied to the ASTs exceeding the budget.
+          triton::engines::symbolic::budget_e budgetPolicy;
+
+          //! The ASTs which exceeded the budget.
+          std::vector<BudgetEvent> budgetEvents;
+
+          //! A register incremented by the same AST on each iteration of a loop.
+          struct Induction {
+            //! The expression of the register before the first increment.
+            SharedSymbolicExpression base;
+
+            //! The increment.
+            triton::ast::SharedAbstractNode step;
+
+            //! The number of increments since the base.
+            triton::uint64 count;
+          };
+
+          //! A loop being executed.
+          struct LoopState {
+            //! The index of the loop in the summaries.
+            triton::usize summary;
+
+            //! The first symbolic expression id of the iterations after the first one.
+            triton::usize entryId;
+
+            //! The register expressions at the previous back-edge.
+            std::unordered_map<triton::arch::register_e, SharedSymbolicExpression> previous;
+
+            //! The induction registers <register : Induction>.
+            std::unordered_map<triton::arch::register_e, Induction> inductions;
+
+            //! The symbolic variables pinned to their concrete value once the unroll bound is reached.
+            std::unordered_set<triton::usize> pinned;
+          };
+
+          //! The loops being executed <branch address : LoopState>.
+          std::unordered_map<triton::uint64, LoopState> loops;
+
+          //! The loops detected on the trace.
+          std::vector<LoopSummary> loopSummaries;
+
+          //! The number of iterations of a loop with a symbolic condition recorded before it is concretized.
+          triton::usize loopUnrollBound;
+
+          //! The maximum number of addresses of a symbolic pointer read or written (see POINTER_RESOLUTION).
+          triton::usize pointerResolutionBound;
+
+          //! Enumerates the addresses of the symbolic pointers past their strided interval, nullptr if none.
+          PointerResolver pointerResolver;
+
         private:
           //! AST API
           triton::ast::SharedAstContext astCtxt;
@@ -102,24 +330,39 @@ namespace triton {
           //! Modes API
           triton::modes::SharedModes modes;
 
-          //! Returns an unique symbolic expression id.
+          //! Returns an unique symbolic expression id. Thread-safe.
           triton::usize getUniqueSymExprId(void);
 
-          //! Returns an unique symbolic variable id.
+          //! Returns an unique symbolic variable id. Thread-safe.
           triton::usize getUniqueSymVarId(void);
 
+          //! Adds an expression to the indexes of its type and of the tainted expressions.
+          void indexSymbolicExpression(const SharedSymbolicExpression& expr);
+
+          //! Adds a variable to the indexes of the aliases and of the origins.
+          void indexSymbolicVariable(const SharedSymbolicVariable& var);
+
+          //! Returns the interned copy of a comment, nullptr if the comment is empty.
+          std::shared_ptr<const std::string> internComment(const std::string& comment);
+
+          //! Writes the declaration of `var` to the SMT stream.
+          void streamVariable(const SharedSymbolicVariable& var);
+
+          //! Writes the definition of `expr` to the SMT stream.
+          void streamExpression(const SharedSymbolicExpression& expr);
+
           //! Returns the memory array expression or initializes it if not defined.
           SharedSymbolicExpression getMemoryArray(void);
 
-          //! Gets an aligned entry.
-          const SharedSymbolicExpression& getAlignedMemory(triton::uint64 address, triton::uint32 size);
+          //! Rebuilds the store chain of the memory array with the last store of each concrete index only.
+          void compactMemoryArray(void);
+
+          //! Returns the AST of a load of `size` bytes at `address` from the aligned entries overlapping it, the other bytes are read one by one from the byte cells or from `raw`.
+          triton::ast::SharedAbstractNode getAlignedMemoryAst(triton::uint64 address, triton::uint32 size, const triton::uint8* raw);
 
           //! Adds an aligned entry.
           void addAlignedMemory(triton::uint64 address, triton::uint32 size, const SharedSymbolicExpression& expr);
 
-          //! Checks if the aligned memory is recored.
-          bool isAlignedMemory(triton::uint64 address, triton::uint32 size);
-
           //! Removes an aligned entry.
           void removeAlignedMemory(triton::uint64 address, triton::uint32 size);
 
@@ -132,6 +375,12 @@ namespace triton {
           //! Returns the parent AST after inserting the subregister (node) in its AST.
           triton::ast::SharedAbstractNode insertSubRegisterInParent(const triton::arch::Register& reg, const triton::ast::SharedAbstractNode& node, bool zxForAssign=true);
 
+          //! Returns true if the write of `reg` is kept as a slice of its parent (see LAZY_SUBREGISTERS).
+          bool isSubRegisterSliced(const triton::arch::Register& reg) const;
+
+          //! Assigns a symbolic expression to a part of a register, as a slice of its parent.
+          void assignSymbolicExpressionToSubRegister(const SharedSymbolicExpression& se, const triton::arch::Register& reg);
+
           //! Sets implicit read registers (base and index) from an effective address.
           void setImplicitReadRegisterFromEffectiveAddress(triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem);
 
@@ -144,6 +393,39 @@ namespace triton {
           //! Returns true if MEMORY_ARRAY is enabled.
           inline bool isArrayMode(void) const;
 
+          //! Applies the AST budget to an AST assigned by an instruction. Returns the AST to assign.
+          triton::ast::SharedAbstractNode applyAstBudget(const triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node);
+
+          //! Returns true if all the symbolic variables of the AST are pinned by the loop.
+          bool isPinned(const LoopState& loop, const triton::ast::SharedAbstractNode& node) const;
+
+          //! Pins the symbolic variables of the AST to their concrete value with path constraints.
+          void pinVariables(LoopState& loop, const triton::ast::SharedAbstractNode& node);
+
+          //! Rewrites the registers incremented by the same AST on each iteration as a function of the iteration count.
+          void summarizeInductions(LoopState& loop, LoopSummary& summary);
+
+          //! Returns the concrete value of a register, through the register file for the registers of at most 64 bits.
+          triton::uint512 getConcreteRegister(const triton::arch::Register& reg) const;
+
+          //! Returns the constant node of a concrete register, the same node while the register holds the same value.
+          triton::ast::SharedAbstractNode getConcreteRegisterAst(const triton::arch::Register& reg);
+
+          //! Sets the concrete value of a register, through the register file for the registers of at most 64 bits.
+          void setConcreteRegister(const triton::arch::Register& reg, const triton::uint512& value);
+
+          //! Journals the current state of a parent register before it is assigned.
+          void journalRegister(const triton::arch::Register& reg);
+
+          //! Journals the current state of a memory area before it is assigned.
+          void journalMemory(const triton::arch::MemoryAccess& mem);
+
+          //! Returns the addresses a memory access through a symbolic pointer is resolved to, none if the pointer is concretized (see POINTER_RESOLUTION).
+          std::vector<triton::uint64> resolvePointer(const triton::arch::MemoryAccess& mem);
+
+          //! Stores `node` at `address` if the effective address `ea` is equal to it, each byte keeping its previous AST otherwise.
+          void assignResolvedMemory(triton::uint64 address, const triton::ast::SharedAbstractNode& ea, const triton::ast::SharedAbstractNode& node, const std::string& comment);
+
         public:
           //! Constructor.
           TRITON_EXPORT SymbolicEngine(triton::arch::Architecture* architecture,
@@ -160,6 +442,18 @@ namespace triton {
           //! Copies a SymbolicEngine.
           TRITON_EXPORT SymbolicEngine& operator=(const SymbolicEngine& other);
 
+          //! Copies the symbolic state (expressions, variables, registers, memory and path constraints) of another engine while keeping the architecture and callbacks of this one. Maps are shared copy-on-write.
+          TRITON_EXPORT void copyState(const SymbolicEngine& other);
+
+          //! Drops the symbolic state and restores the settings of a new engine. The containers keep their capacity, and the ids start again from zero.
+          TRITON_EXPORT void reset(void);
+
+          //! Writes the symbolic state (registers, memory, memory array and path constraints, with their expressions and variables) into `stream`. The deferred registers are built first.
+          TRITON_EXPORT void saveState(std::ostream& stream);
+
+          //! Replaces the symbolic state by the one written by saveState(). The expressions and the variables keep their ids.
+          TRITON_EXPORT void loadState(std::istream& stream);
+
           //! Creates a new symbolic expression.
           TRITON_EXPORT SharedSymbolicExpression newSymbolicExpression(const triton::ast::SharedAbstractNode& node, triton::engines::symbolic::expression_e type, const std::string& comment="");
 
@@ -172,7 +466,7 @@ namespace triton {
           //! Returns the symbolic variable corresponding to the symbolic variable id.
           TRITON_EXPORT SharedSymbolicVariable getSymbolicVariable(triton::usize symVarId) const;
 
-          //! Returns the symbolic variable corresponding to the symbolic variable name.
+          //! Returns the symbolic variable corresponding to the symbolic variable name or alias, the oldest one when several share an alias.
           TRITON_EXPORT SharedSymbolicVariable getSymbolicVariable(const std::string& name) const;
 
           //! Returns the symbolic expression corresponding to an id.
@@ -182,7 +476,10 @@ namespace triton {
           TRITON_EXPORT SharedSymbolicExpression getSymbolicMemory(triton::uint64 addr) const;
 
           //! Returns the map (addr:expr) of all symbolic memory assigned.
-          TRITON_EXPORT const std::unordered_map<triton::uint64, SharedSymbolicExpression>& getSymbolicMemory(void) const;
+          TRITON_EXPORT std::unordered_map<triton::uint64, SharedSymbolicExpression> getSymbolicMemory(void) const;
+
+          //! Returns the addresses of the symbolic memory cells in [baseAddr, baseAddr + size).
+          TRITON_EXPORT std::vector<triton::uint64> getSymbolicMemoryAddresses(triton::uint64 baseAddr, triton::uint64 size) const;
 
           //! Returns the symbolic expression assigned to the register.
           TRITON_EXPORT const SharedSymbolicExpression& getSymbolicRegister(const triton::arch::Register& reg) const;
@@ -190,6 +487,9 @@ namespace triton {
           //! Returns the map of symbolic registers defined.
           TRITON_EXPORT std::unordered_map<triton::arch::register_e, SharedSymbolicExpression> getSymbolicRegisters(void) const;
 
+          //! Returns the symbolic expressions of the parent registers, as a view indexed by their id (null if not defined).
+          TRITON_EXPORT const std::vector<SharedSymbolicExpression>& getSymbolicRegisterArray(void) const;
+
           //! Returns the symbolic memory value.
           TRITON_EXPORT triton::uint8 getSymbolicMemoryValue(triton::uint64 address);
 
@@ -244,6 +544,27 @@ namespace triton {
           //! Returns the new symbolic volatile expression expression and links this expression to the instruction.
           TRITON_EXPORT const SharedSymbolicExpression& createSymbolicVolatileExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const std::string& comment="");
 
+          //! Defers the flags until they are read as in LAZY_FLAGS mode, regardless of the mode. Used by the processing of a basic block.
+          TRITON_EXPORT void deferFlags(bool flag);
+
+          //! Returns true if the flags are deferred, by LAZY_FLAGS or by `deferFlags()`.
+          TRITON_EXPORT bool isDeferringFlags(void) const;
+
+          //! Creates the register expression built by `builder`, or defers it until the register is read if the flags are deferred, see `isDeferringFlags()`.
+          TRITON_EXPORT void createLazyRegisterExpression(triton::arch::Instruction& inst, const std::function<triton::ast::SharedAbstractNode(void)>& builder, const triton::arch::Register& reg, const std::string& comment, bool tainted);
+
+          //! Creates the deferred expression of the register, if any, and merges the written slices of its parent.
+          TRITON_EXPORT void materializeLazyRegister(const triton::arch::Register& reg);
+
+          //! Creates all deferred register expressions. The written slices are merged as well unless `withSubRegisters` is false, they do not depend on the state at the end of a basic block.
+          TRITON_EXPORT void materializeLazyRegisters(bool withSubRegisters=true);
+
+          //! Merges the written slices of the parent of `reg` into a new expression of the parent, if any (see LAZY_SUBREGISTERS).
+          TRITON_EXPORT void materializeSubRegisters(const triton::arch::Register& reg);
+
+          //! Merges the written slices of every register.
+          TRITON_EXPORT void materializeSubRegisters(void);
+
           //! Assigns a symbolic expression to a register.
           TRITON_EXPORT void assignSymbolicExpressionToRegister(const SharedSymbolicExpression& se, const triton::arch::Register& reg);
 
@@ -253,15 +574,51 @@ namespace triton {
           //! Slices all expressions from a given one.
           TRITON_EXPORT std::unordered_map<triton::usize, SharedSymbolicExpression> sliceExpressions(const SharedSymbolicExpression& expr);
 
-          //! Returns the vector of the tainted symbolic expressions.
+          //! Slices all expressions from several ones in one pass and returns the union of their slices.
+          TRITON_EXPORT std::unordered_map<triton::usize, SharedSymbolicExpression> sliceExpressions(const std::vector<SharedSymbolicExpression>& exprs);
+
+          //! Returns the vector of the tainted symbolic expressions, from the index filled once the instructions are processed.
           TRITON_EXPORT std::vector<SharedSymbolicExpression> getTaintedSymbolicExpressions(void) const;
 
           //! Returns all symbolic expressions.
           TRITON_EXPORT std::unordered_map<triton::usize, SharedSymbolicExpression> getSymbolicExpressions(void) const;
 
+          //! Returns the symbolic expressions of a type, from its index.
+          TRITON_EXPORT std::unordered_map<triton::usize, SharedSymbolicExpression> getSymbolicExpressions(triton::engines::symbolic::expression_e type) const;
+
+          //! Returns the symbolic expressions of the instructions processed at an address, in creation order, from its index.
+          TRITON_EXPORT std::vector<SharedSymbolicExpression> getSymbolicExpressionsAt(triton::uint64 address) const;
+
+          //! Indexes the symbolic expressions of a processed instruction by address, and the tainted ones.
+          TRITON_EXPORT void indexSymbolicExpressions(const triton::arch::Instruction& inst);
+
+          //! Returns all symbolic expressions, in the order of their ids, as an SSA trace.
+          TRITON_EXPORT triton::ast::SsaTrace getSsaTrace(void) const;
+
           //! Returns all symbolic variables.
           TRITON_EXPORT std::map<triton::usize, SharedSymbolicVariable> getSymbolicVariables(void) const;
 
+          //! Returns the symbolic variables of a type.
+          TRITON_EXPORT std::map<triton::usize, SharedSymbolicVariable> getSymbolicVariables(triton::engines::symbolic::variable_e type) const;
+
+          //! Returns the symbolic variables of a type assigned to an origin (memory address or register id), from its index.
+          TRITON_EXPORT std::map<triton::usize, SharedSymbolicVariable> getSymbolicVariables(triton::engines::symbolic::variable_e type, triton::uint64 origin) const;
+
+          //! Calls `fn` on every live symbolic expression, in no particular order and without copying them, until it returns false. Returns false if it was stopped. No expression may be created by `fn`.
+          TRITON_EXPORT bool forEachSymbolicExpression(const std::function<bool(const SharedSymbolicExpression&)>& fn) const;
+
+          //! Calls `fn` on every live symbolic variable, in no particular order and without copying them, until it returns false. Returns false if it was stopped. No variable may be created by `fn`.
+          TRITON_EXPORT bool forEachSymbolicVariable(const std::function<bool(const SharedSymbolicVariable&)>& fn) const;
+
+          //! Calls `fn` on every symbolic parent register, by increasing id, until it returns false. Returns false if it was stopped.
+          TRITON_EXPORT bool forEachSymbolicRegister(const std::function<bool(triton::arch::register_e, const SharedSymbolicExpression&)>& fn) const;
+
+          //! Calls `fn` on every symbolic memory byte, in no particular order, until it returns false. Returns false if it was stopped. The memory must not be modified by `fn`.
+          TRITON_EXPORT bool forEachSymbolicMemory(const std::function<bool(triton::uint64, const SharedSymbolicExpression&)>& fn) const;
+
+          //! Returns the id of the next symbolic expression, which is the number of expressions created.
+          TRITON_EXPORT triton::usize getNextSymbolicExpressionId(void) const;
+
           //! Converts a symbolic expression to a symbolic variable. `symVarSize` must be in bits.
           TRITON_EXPORT SharedSymbolicVariable symbolizeExpression(triton::usize exprId, triton::uint32 symVarSize, const std::string& symVarAlias="");
 
@@ -271,6 +628,9 @@ namespace triton {
           //! Converts a symbolic memory area to 8-bits symbolic variables.
           TRITON_EXPORT void symbolizeMemory(triton::uint64 addr, triton::usize size);
 
+          //! Converts a memory buffer to symbolic variables of up to 512 bits, one per chunk of the buffer, by increasing address. The aliases are suffixed with the index of the chunk.
+          TRITON_EXPORT std::vector<SharedSymbolicVariable> symbolizeBuffer(triton::uint64 addr, triton::usize size, const std::string& symVarAlias="");
+
           //! Converts a symbolic register expression to a symbolic variable.
           TRITON_EXPORT SharedSymbolicVariable symbolizeRegister(const triton::arch::Register& reg, const std::string& symVarAlias="");
 
@@ -304,11 +664,83 @@ namespace triton {
           //! Initializes the effective address of a memory access.
           TRITON_EXPORT void initLeaAst(triton::arch::MemoryAccess& mem, bool force=true);
 
+          //! Initializes the effective address of the memory operand `operand` of an instruction, reusing its previous AST if its registers are unchanged (see EFFECTIVE_ADDRESS_CACHE).
+          TRITON_EXPORT void initLeaAst(const triton::arch::Instruction& inst, triton::uint32 operand, triton::arch::MemoryAccess& mem);
+
           //! Gets the concrete value of a symbolic variable.
           TRITON_EXPORT triton::uint512 getConcreteVariableValue(const SharedSymbolicVariable& symVar) const;
 
           //! Sets the concrete value of a symbolic variable.
           TRITON_EXPORT void setConcreteVariableValue(const SharedSymbolicVariable& symVar, const triton::uint512& value);
+
+          //! Enables or disables the undo journal. `capacity` is the maximum number of instructions which can be undone. Enabling or disabling drops the current journal.
+          TRITON_EXPORT void enableUndoJournal(bool flag, triton::usize capacity=1024);
+
+          //! Returns true if the undo journal is enabled.
+          TRITON_EXPORT bool isUndoJournalEnabled(void) const;
+
+          //! Returns the number of instructions which can be undone.
+          TRITON_EXPORT triton::usize getUndoJournalSize(void) const;
+
+          //! Fills the symbolic figures of `usage`: the expressions, the variables, the registers, the memory and the path constraints.
+          TRITON_EXPORT void getMemoryUsage(triton::MemoryUsage& usage) const;
+
+          //! Opens the journal record of a new instruction. Does nothing if the journal is disabled.
+          TRITON_EXPORT void openUndoRecord(void);
+
+          //! Closes the journal record of the current instruction. Does nothing if the journal is disabled.
+          TRITON_EXPORT void closeUndoRecord(void);
+
+          //! Undoes the concrete and symbolic register and memory assignments, and the path constraints, of the last `count` journaled instructions.
+          TRITON_EXPORT void stepBack(triton::usize count=1);
+
+          //! Sets the template recording the register reads and the expressions created, nullptr to stop recording.
+          TRITON_EXPORT void setSemanticRecorder(triton::engines::symbolic::SemanticTemplate* recorder);
+
+          //! Starts writing the SMT export to `stream`: the current variables, expressions and path constraints, then each new one as it is created, exactly once.
+          TRITON_EXPORT void startSmtStream(std::ostream& stream);
+
+          //! Stops writing the SMT export and flushes its stream.
+          TRITON_EXPORT void stopSmtStream(void);
+
+          //! Returns true if the SMT export is written to a stream.
+          TRITON_EXPORT bool isSmtStreamEnabled(void) const;
+
+          //! Bounds the ASTs assigned by the semantics to `maxNodes` nodes and `maxLevel` levels, references unrolled. 0 means unbounded.
+          TRITON_EXPORT void setAstBudget(triton::usize maxNodes, triton::uint32 maxLevel);
+
+          //! Sets the policy applied to the ASTs exceeding the budget.
+          TRITON_EXPORT void setAstBudgetPolicy(triton::engines::symbolic::budget_e policy);
+
+          //! Returns the ASTs which exceeded the budget, in order.
+          TRITON_EXPORT const std::vector<BudgetEvent>& getAstBudgetEvents(void) const;
+
+          //! Clears the recorded budget events.
+          TRITON_EXPORT void clearAstBudgetEvents(void);
+
+          //! Summarizes the loop closed by the branch instruction, if it went back to a previous address (see LOOP_SUMMARIZATION).
+          TRITON_EXPORT void summarizeLoop(const triton::arch::Instruction& inst);
+
+          //! Sets the number of iterations of a loop with a symbolic condition recorded before it is concretized.
+          TRITON_EXPORT void setLoopUnrollBound(triton::usize bound);
+
+          //! Returns the number of iterations of a loop with a symbolic condition recorded before it is concretized.
+          TRITON_EXPORT triton::usize getLoopUnrollBound(void) const;
+
+          //! Returns the loops detected on the trace, in order.
+          TRITON_EXPORT const std::vector<LoopSummary>& getLoopSummaries(void) const;
+
+          //! Clears the loops detected, the ones being executed are detected again from their next iteration.
+          TRITON_EXPORT void clearLoopSummaries(void);
+
+          //! Sets the maximum number of addresses of a symbolic pointer read or written, the pointers with more addresses being concretized.
+          TRITON_EXPORT void setPointerResolutionBound(triton::usize bound);
+
+          //! Returns the maximum number of addresses of a symbolic pointer read or written.
+          TRITON_EXPORT triton::usize getPointerResolutionBound(void) const;
+
+          //! Sets the enumeration of the addresses of the symbolic pointers whose strided interval is too wide.
+          TRITON_EXPORT void setPointerResolver(const PointerResolver& resolver);
       };
 
     /*! @} End of symbolic namespace */
@@ -43,6 +43,27 @@ namespace triton {
         VOLATILE_EXPRESSION,   //!< Assigned to a volatile expression.
       };
 
+      //! Policy applied to the expressions exceeding the AST budget.
+      enum budget_e {
+        BUDGET_CONCRETIZE,     //!< The expression falls back to its concrete value.
+        BUDGET_RECORD,         //!< The expression is kept, only the event is recorded.
+      };
+
+      //! Rules of the concretization policy.
+      enum concretization_e {
+        CONCRETIZATION_HOOK,              //!< Concretizes the writes of the instructions for which the hook returns true.
+        CONCRETIZATION_HOT_ADDRESSES,     //!< Concretizes the writes of an instruction processed more times than the threshold.
+        CONCRETIZATION_LARGE_EXPRESSIONS, //!< Concretizes the registers written whose AST has more nodes than the threshold.
+        CONCRETIZATION_OUTSIDE_REGIONS,   //!< Concretizes the memory cells written outside the symbolic regions.
+      };
+
+      //! Passes of the basic block optimizations.
+      enum pass_e {
+        PASS_DEAD_STORES,        //!< Removes the instructions whose writes are dead, the flags included.
+        PASS_OPAQUE_PREDICATES,  //!< Resolves the conditional branches whose condition is constant.
+        PASS_REDUNDANT_WRITES,   //!< Removes the instructions writing the values already held, constants and copies included.
+      };
+
       //! Type of symbolic variable.
       enum variable_e {
         MEMORY_VARIABLE,       //!< Variable assigned to a memory.
@@ -53,14 +53,14 @@ namespace triton {
           //! The root node (AST) of the symbolic expression.
           triton::ast::SharedAbstractNode ast;
 
-          //! The comment of the symbolic expression.
-          std::string comment;
+          //! The comment of the symbolic expression, nullptr if there is none. Usually interned by the symbolic engine.
+          std::shared_ptr<const std::string> comment;
 
           //! The address of the instruction behind the symbolic expression. -1 if not defined.
           triton::uint64 address;
 
-          //! The instruction disassembly where the symbolic expression comes from.
-          std::string disassembly;
+          //! The instruction disassembly where the symbolic expression comes from, shared by the expressions of an instruction.
+          std::shared_ptr<const std::string> disassembly;
 
           //! The symbolic expression id. This id is unique.
           triton::usize id;
@@ -139,6 +139,9 @@ namespace triton {
           //! Sets a comment to the symbolic expression.
           TRITON_EXPORT void setComment(const std::string& comment);
 
+          //! Sets a shared comment to the symbolic expression.
+          TRITON_EXPORT void setComment(const std::shared_ptr<const std::string>& comment);
+
           //! Sets the kind of the symbolic expression.
           TRITON_EXPORT void setType(triton::engines::symbolic::expression_e type);
 
@@ -157,6 +160,9 @@ namespace triton {
           //! Writes back the instruction disassembly where the symbolic expression comes from.
           TRITON_EXPORT void writeBackDisassembly(const std::string& disassembly);
 
+          //! Writes back a disassembly shared with the other symbolic expressions of the instruction.
+          TRITON_EXPORT void writeBackDisassembly(const std::shared_ptr<const std::string>& disassembly);
+
           //! Gets the instruction disassembly where the symbolic expression comes from.
           TRITON_EXPORT const std::string& getDisassembly(void);
       };
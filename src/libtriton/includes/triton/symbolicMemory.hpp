@@ -0,0 +1,154 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SYMBOLICMEMORY_H
+#define TRITON_SYMBOLICMEMORY_H
+
+#include <array>
+#include <functional>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      /*! \class SymbolicMemory
+       *  \brief The bitvector memory model of the symbolic engine.
+       *
+       *  \details The byte cells are stored in pages of `pageSize` bytes, so that a buffer costs one
+       *  pointer per byte and one map entry per page. Pages are shared between copies of the memory
+       *  and copied on their first write. The multi-byte cells of the aligned optimization are kept as
+       *  disjoint intervals, an interval is dropped once one of its bytes is overwritten. A load reads
+       *  the part of each interval it overlaps at once, whatever the size of the store. The pages come
+       *  from the memory resource of the memory if one is set.
+       */
+      class SymbolicMemory {
+        public:
+          //! The number of bytes of a page.
+          static constexpr triton::uint32 pageSize = 256;
+
+        private:
+          //! The byte cells of a page.
+          struct Page {
+            //! The expressions of the bytes, nullptr if a byte is concrete.
+            std::array<SharedSymbolicExpression, pageSize> cells;
+
+            //! The number of symbolic bytes.
+            triton::uint32 used = 0;
+          };
+
+          //! A multi-byte cell.
+          struct Interval {
+            //! The size in bytes.
+            triton::uint32 size;
+
+            //! The expression of the whole cell.
+            SharedSymbolicExpression expr;
+          };
+
+          //! The pages of the byte cells <address / pageSize : page>.
+          std::unordered_map<triton::uint64, std::shared_ptr<Page>> pages;
+
+          //! The multi-byte cells <address : interval>.
+          std::map<triton::uint64, Interval> intervals;
+
+          //! The number of symbolic bytes.
+          triton::usize size;
+
+          //! The memory resource of the pages, nullptr for the heap.
+          std::pmr::memory_resource* resource;
+
+          //! Returns a writable page, copied first if it is shared with another memory.
+          Page& mutatePage(std::shared_ptr<Page>& page);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SymbolicMemory();
+
+          //! Returns the expression of a byte, nullptr if the byte is concrete.
+          TRITON_EXPORT const SharedSymbolicExpression& getCell(triton::uint64 addr) const;
+
+          //! Assigns an expression to a byte.
+          TRITON_EXPORT void setCell(triton::uint64 addr, const SharedSymbolicExpression& expr);
+
+          //! Makes a byte concrete.
+          TRITON_EXPORT void removeCell(triton::uint64 addr);
+
+          //! Returns the number of symbolic bytes.
+          TRITON_EXPORT triton::usize getSize(void) const;
+
+          //! Returns the addresses of the symbolic bytes in [addr, addr + size), in no particular order.
+          TRITON_EXPORT std::vector<triton::uint64> getAddresses(triton::uint64 addr, triton::uint64 size) const;
+
+          //! Returns every symbolic byte <address : expression>.
+          TRITON_EXPORT std::unordered_map<triton::uint64, SharedSymbolicExpression> getCells(void) const;
+
+          //! Calls `fn` on every symbolic byte, in no particular order, until it returns false. Returns false if it was stopped. The memory must not be modified by `fn`.
+          TRITON_EXPORT bool forEachCell(const std::function<bool(triton::uint64, const SharedSymbolicExpression&)>& fn) const;
+
+          //! Returns the expression of the multi-byte cell of `size` bytes at `addr`, nullptr if there is none.
+          TRITON_EXPORT const SharedSymbolicExpression& getInterval(triton::uint64 addr, triton::uint32 size) const;
+
+          //! Returns the expression of the multi-byte cell containing `addr`, nullptr if there is none. `start` and `size` are set to the bounds of the cell.
+          TRITON_EXPORT const SharedSymbolicExpression& findInterval(triton::uint64 addr, triton::uint64& start, triton::uint32& size) const;
+
+          //! Records a multi-byte cell, the cells overlapping it are dropped.
+          TRITON_EXPORT void setInterval(triton::uint64 addr, triton::uint32 size, const SharedSymbolicExpression& expr);
+
+          //! Drops the multi-byte cells overlapping [addr, addr + size).
+          TRITON_EXPORT void removeIntervals(triton::uint64 addr, triton::uint32 size);
+
+          //! Returns true if there is a multi-byte cell.
+          TRITON_EXPORT bool hasIntervals(void) const;
+
+          //! Returns the bytes of the pages and of the multi-byte cells.
+          TRITON_EXPORT triton::usize getMemoryBytes(void) const;
+
+          //! Makes the whole memory concrete.
+          TRITON_EXPORT void clear(void);
+
+          //! Sets the memory resource of the pages allocated from now on, nullptr for the heap.
+          TRITON_EXPORT void setMemoryResource(std::pmr::memory_resource* resource);
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICMEMORY_H */
@@ -8,11 +8,15 @@
 #ifndef TRITON_SYMBOLICSIMPLIFICATION_H
 #define TRITON_SYMBOLICSIMPLIFICATION_H
 
+#include <vector>
+
 #include <triton/architecture.hpp>
 #include <triton/ast.hpp>
+#include <triton/astRewriter.hpp>
 #include <triton/basicBlock.hpp>
 #include <triton/callbacks.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/simplificationMemo.hpp>
 
 
 
@@ -49,11 +53,20 @@ namespace triton {
           //! Callbacks API
           triton::callbacks::Callbacks* callbacks;
 
+          //! The native rewrite rules, applied before the callbacks.
+          triton::ast::AstRewriter rewriter;
+
+          //! The results of `simplify()` on the nodes, kept until the rules, the callbacks or the modes change.
+          mutable triton::engines::symbolic::SimplificationMemo memo;
+
+          //! Returns the signature of the simplifications applied on `node`.
+          triton::usize getSignature(const triton::ast::SharedAbstractNode& node) const;
+
           //! Copies a SymbolicSimplification.
           void copy(const SymbolicSimplification& other);
 
-          //! Performs a dead store elimination analysis.
-          triton::arch::BasicBlock deadStoreElimination(const triton::arch::BasicBlock& block, bool padding=false) const;
+          //! Performs a dead store elimination analysis on a region of blocks, by a backward liveness of its locations.
+          std::vector<triton::arch::BasicBlock> deadStoreElimination(const std::vector<triton::arch::BasicBlock>& region, bool padding=false) const;
 
         public:
           //! Constructor.
@@ -62,12 +75,21 @@ namespace triton {
           //! Constructor.
           TRITON_EXPORT SymbolicSimplification(const SymbolicSimplification& other);
 
+          //! Returns the native rewrite rules applied by `simplify()`.
+          TRITON_EXPORT triton::ast::AstRewriter& getAstRewriter(void);
+
+          //! Returns the results memoized by `simplify()`.
+          TRITON_EXPORT triton::engines::symbolic::SimplificationMemo& getSimplificationMemo(void) const;
+
           //! Processes all recorded simplifications. Returns the simplified node.
           TRITON_EXPORT triton::ast::SharedAbstractNode simplify(const triton::ast::SharedAbstractNode& node) const;
 
           //! Performs a dead store elimination simplification. If `padding` is true, keep addresses aligned and padds with NOP instructions.
           TRITON_EXPORT triton::arch::BasicBlock simplify(const triton::arch::BasicBlock& block, bool padding=false) const;
 
+          //! Performs a dead store elimination simplification on a region of blocks, the live locations flowing through the branches between them. Returns the simplified blocks in order.
+          TRITON_EXPORT std::vector<triton::arch::BasicBlock> simplify(const std::vector<triton::arch::BasicBlock>& region, bool padding=false) const;
+
           //! Copies a SymbolicSimplification.
           TRITON_EXPORT SymbolicSimplification& operator=(const SymbolicSimplification& other);
       };
@@ -0,0 +1,155 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SYMBOLICSUMMARY_HPP
+#define TRITON_SYMBOLICSUMMARY_HPP
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <triton/architecture.hpp>
+#include <triton/archEnums.hpp>
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/modes.hpp>
+#include <triton/pathConstraint.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/traceReader.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! A location of the symbolic state: a parent register, or a byte of memory if `reg` is `ID_REG_INVALID`.
+      struct SymbolicLocation {
+        //! The parent register.
+        triton::arch::register_e reg;
+
+        //! The address of the byte, if not a register.
+        triton::uint64 address;
+      };
+
+      //! A location changed by a segment of a trace, see `SymbolicSummary`.
+      struct SymbolicOutput {
+        //! The changed location.
+        SymbolicLocation location;
+
+        //! Its AST over the variables of the entry locations, a constant if it is concrete.
+        triton::ast::SharedAbstractNode node;
+
+        //! Its concrete value at the end of the segment.
+        triton::uint512 value;
+      };
+
+      /*! \class SymbolicSummary
+       *  \brief The symbolic transfer function of a segment of an execution trace.
+       *
+       *  \details Each location written by the segment is mapped to its AST over one variable per location
+       *  at the entry of the segment, and the path constraints of the segment are kept over the same variables.
+       *  The summaries of consecutive segments are computed independently, then applied in order to a symbolic
+       *  engine: the entry variables of a summary are substituted by the ASTs of their locations, those left by
+       *  the previous summaries, which gives the symbolic state of the sequential processing.
+       *
+       *  A summary is computed by processing the segment in its own context where all the parent registers are
+       *  symbolized at the entry, and each byte of memory the first time it is read without having been written
+       *  by the segment.
+       */
+      class SymbolicSummary {
+        private:
+          //! The index of the first record of the segment.
+          triton::usize first;
+
+          //! The number of records of the segment.
+          triton::usize count;
+
+          //! The entry locations by variable id.
+          std::vector<std::pair<triton::usize, SymbolicLocation>> inputs;
+
+          //! The changed locations.
+          std::vector<SymbolicOutput> outputs;
+
+          //! The path constraints of the segment.
+          std::vector<triton::engines::symbolic::PathConstraint> constraints;
+
+        public:
+          //! Constructor. The summary of an empty segment.
+          TRITON_EXPORT SymbolicSummary();
+
+          /*!
+           * \brief Computes the summary of the records `[begin, end)` of `records` in a context of `arch` with the `modes` of the main context.
+           *
+           * \details `registers` and `memory` give the concrete state before the first record of `records`,
+           * those of the records being deltas. The deltas of the records up to `begin` are applied before the
+           * entry locations are symbolized. A later delta changing a location still at its entry value makes it
+           * concrete, as a value coming from outside the trace. `memory` is only called for the bytes not set by
+           * a delta and may be called concurrently by several summaries. The modes whose state spans several
+           * instructions (`LAZY_FLAGS`, `LAZY_SUBREGISTERS`, `LOOP_SUMMARIZATION`, `STATE_MERGING`) and the
+           * taint ones are not used, and the `MEMORY_ARRAY` mode is not supported.
+           */
+          TRITON_EXPORT static SymbolicSummary compute(triton::arch::architecture_e arch,
+                                                       const triton::modes::SharedModes& modes,
+                                                       const std::vector<triton::loaders::TraceRecord>& records,
+                                                       triton::usize begin,
+                                                       triton::usize end,
+                                                       const std::vector<std::pair<triton::arch::register_e, triton::uint512>>& registers,
+                                                       const std::function<triton::uint8(triton::uint64)>& memory);
+
+          //! Returns the index of the first record of the segment.
+          TRITON_EXPORT triton::usize getFirstRecord(void) const;
+
+          //! Returns the number of records of the segment.
+          TRITON_EXPORT triton::usize getNumberOfRecords(void) const;
+
+          //! Returns the entry locations by variable id.
+          TRITON_EXPORT const std::vector<std::pair<triton::usize, SymbolicLocation>>& getInputs(void) const;
+
+          //! Returns the changed locations.
+          TRITON_EXPORT const std::vector<SymbolicOutput>& getOutputs(void) const;
+
+          //! Returns the path constraints of the segment.
+          TRITON_EXPORT const std::vector<triton::engines::symbolic::PathConstraint>& getPathConstraints(void) const;
+
+          /*!
+           * \brief Updates the state of `engine` and `arch` as the processing of the segment would.
+           *
+           * \details `arch` must hold the concrete state before the first record of the segment, its deltas
+           * included. The ASTs are imported into `astCtxt`, an output which is not symbolized is concretized.
+           */
+          TRITON_EXPORT void apply(triton::engines::symbolic::SymbolicEngine& engine, triton::arch::Architecture& arch, const triton::ast::SharedAstContext& astCtxt) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICSUMMARY_HPP */
@@ -0,0 +1,132 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SYNTHESISCACHE_HPP
+#define TRITON_SYNTHESISCACHE_HPP
+
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astContext.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Synthesis namespace
+    namespace synthesis {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup synthesis
+     *  @{
+     */
+
+      //! \class SynthesisCache
+      /*! \brief The memo of the synthesis results, kept across the calls and savable to a file.
+       *
+       *  \details An entry is keyed by a 128-bit structural hash of the synthesized subtree, in which
+       *  the variables are replaced by their position, so the same gadget applied to other variables
+       *  hits the same entry. The synthesized node is held as a template: a sequence of words in prefix
+       *  order, whose variables are positions too. A subtree which cannot be synthesized is held with
+       *  an empty template, so it is not tried again.
+       */
+      class SynthesisCache {
+        public:
+          //! The key of an entry.
+          using Key = std::pair<triton::uint64, triton::uint64>;
+
+          //! The template of a synthesized node.
+          using Template = std::vector<triton::uint64>;
+
+        private:
+          //! The hash of a key.
+          struct KeyHash {
+            triton::usize operator()(const Key& key) const {
+              return static_cast<triton::usize>(key.first ^ key.second);
+            }
+          };
+
+          //! The entries.
+          std::unordered_map<Key, Template, KeyHash> entries;
+
+          //! True if the cache is enabled.
+          bool enabled;
+
+          //! The number of subtrees answered by the cache.
+          triton::usize hits;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SynthesisCache();
+
+          //! Appends the template of `node` to `code`. Returns false if a node of `node` cannot be part of a template.
+          TRITON_EXPORT static bool encode(const triton::ast::SharedAbstractNode& node, const std::deque<triton::ast::SharedAbstractNode>& vars, Template& code);
+
+          //! Builds the node of the template from `index`, which is moved past it. Returns null if the template is invalid.
+          TRITON_EXPORT static triton::ast::SharedAbstractNode decode(const triton::ast::SharedAstContext& actx, const Template& code, triton::usize& index, const std::deque<triton::ast::SharedAbstractNode>& vars);
+
+          //! Returns the key of `node`, whose variables are `vars`, synthesized with the `constant` and `opaque` flags.
+          TRITON_EXPORT static Key getKey(const triton::ast::SharedAbstractNode& node, const std::deque<triton::ast::SharedAbstractNode>& vars, bool constant, bool opaque);
+
+          //! Enables or disables the cache. Disabling keeps the entries.
+          TRITON_EXPORT void enable(bool flag);
+
+          //! Returns true if the cache is enabled.
+          TRITON_EXPORT bool isEnabled(void) const;
+
+          //! Looks up `key`. Returns false on a miss. On a hit, `output` is the synthesized node on `vars`, or null if it cannot be synthesized.
+          TRITON_EXPORT bool find(const Key& key, const std::deque<triton::ast::SharedAbstractNode>& vars, triton::ast::SharedAstContext actx, triton::ast::SharedAbstractNode& output);
+
+          //! Records the synthesized node of `key`, or that it cannot be synthesized if `output` is null. A node which cannot be held as a template is not recorded.
+          TRITON_EXPORT void insert(const Key& key, const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& output);
+
+          //! Returns the number of entries.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns the number of subtrees answered by the cache.
+          TRITON_EXPORT triton::usize getHits(void) const;
+
+          //! Clears the entries and the statistics.
+          TRITON_EXPORT void clear(void);
+
+          //! Removes the entries of the subtrees which cannot be synthesized, e.g. once the synthesis can do more.
+          TRITON_EXPORT void removeFailures(void);
+
+          //! Saves the entries to the file `path`, one entry per line.
+          TRITON_EXPORT void save(const std::string& path) const;
+
+          //! Loads the entries of the file `path`, in addition to the current ones.
+          TRITON_EXPORT void load(const std::string& path);
+      };
+
+    /*! @} End of synthesis namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYNTHESISCACHE_HPP */
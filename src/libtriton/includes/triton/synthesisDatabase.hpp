@@ -0,0 +1,123 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SYNTHESISDATABASE_HPP
+#define TRITON_SYNTHESISDATABASE_HPP
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/binaryLoader.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/synthesisCache.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Synthesis namespace
+    namespace synthesis {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup synthesis
+     *  @{
+     */
+
+      /*! \class SynthesisDatabase
+       *  \brief A precomputed table of expressions, looked up by their outputs on fixed inputs.
+       *
+       *  \details A database holds expressions of `arity` variables of `bits` bits, generated offline (see
+       *  `src/scripts/gen_synthesis_database.py`), with the input vectors they were evaluated on. Each
+       *  expression is indexed by the hash of its outputs, its signature, and the index is sorted by hash,
+       *  so the expressions of a signature are found by a binary search. The file is mapped read-only and
+       *  only the pages touched by the searches are read.
+       *
+       *  The file is made of 64-bit little-endian words: a header of 8 words (the magic, the bits and the
+       *  arity, the number of inputs, the number of entries, and the offsets of the inputs, of the index and
+       *  of the templates), the input vectors, the index ({hash, offset of the template} pairs), and the
+       *  templates of the expressions (their size followed by their words, see SynthesisCache::encode()).
+       */
+      class SynthesisDatabase {
+        private:
+          //! The mapped file.
+          std::unique_ptr<triton::loaders::MappedFile> file;
+
+          //! The size of the variables.
+          triton::uint32 bits;
+
+          //! The number of variables.
+          triton::uint32 arity;
+
+          //! The number of entries.
+          triton::uint64 entries;
+
+          //! The offset of the index.
+          triton::uint64 indexOffset;
+
+          //! The offset of the templates.
+          triton::uint64 codeOffset;
+
+          //! The input vectors.
+          std::vector<std::vector<triton::uint512>> inputs;
+
+          //! Returns the word at `offset`.
+          triton::uint64 read(triton::uint64 offset) const;
+
+        public:
+          //! Constructor. Maps the database at `path`.
+          TRITON_EXPORT SynthesisDatabase(const std::string& path);
+
+          SynthesisDatabase(const SynthesisDatabase& other) = delete;
+          SynthesisDatabase& operator=(const SynthesisDatabase& other) = delete;
+
+          //! Returns the size of the variables.
+          TRITON_EXPORT triton::uint32 getBits(void) const;
+
+          //! Returns the number of variables.
+          TRITON_EXPORT triton::uint32 getArity(void) const;
+
+          //! Returns the number of expressions.
+          TRITON_EXPORT triton::usize getSize(void) const;
+
+          //! Returns the input vectors, which give a value to each variable.
+          TRITON_EXPORT const std::vector<std::vector<triton::uint512>>& getInputs(void) const;
+
+          //! Returns the templates of the expressions whose signature hash is `hash`.
+          TRITON_EXPORT std::vector<SynthesisCache::Template> find(triton::uint64 hash) const;
+
+          //! Returns the signature hash of the outputs of an expression of `bits` bits.
+          TRITON_EXPORT static triton::uint64 hashSignature(const std::vector<triton::uint512>& outputs, triton::uint32 bits);
+
+          //! Writes to `path` the database of `exprs`, on the variables `vars` and the vectors of `inputs`. The first expression of a signature is kept, the others and those which cannot be held as a template are dropped. Returns the number of expressions written.
+          TRITON_EXPORT static triton::usize write(const std::string& path, const std::deque<triton::ast::SharedAbstractNode>& vars, const std::vector<std::vector<triton::uint512>>& inputs, const std::vector<triton::ast::SharedAbstractNode>& exprs);
+      };
+
+    /*! @} End of synthesis namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYNTHESISDATABASE_HPP */
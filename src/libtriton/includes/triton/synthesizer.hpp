@@ -10,13 +10,19 @@
 
 #include <array>
 #include <deque>
+#include <functional>
 #include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include <triton/astContext.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/oracleEntry.hpp>
 #include <triton/solverEngine.hpp>
 #include <triton/symbolicEngine.hpp>
+#include <triton/synthesisCache.hpp>
+#include <triton/synthesisDatabase.hpp>
 #include <triton/synthesisResult.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -62,10 +68,73 @@ namespace triton {
       /*! @} End of oracle namespace */
       };
 
+      //! Calls `function` with each index below `count`, on up to `threads` threads. The first exception is rethrown.
+      void parallelFor(triton::usize count, triton::usize threads, const std::function<void(triton::usize)>& function);
+
       //! \class Synthesizer
       /*! \brief The Synthesizer engine class. */
       class Synthesizer {
         private:
+          //! The expressions of a database whose signature is the one of a node.
+          struct DatabaseMatch {
+            //! The database.
+            const SynthesisDatabase* database = nullptr;
+
+            //! The outputs of the node on the inputs of the database.
+            std::vector<triton::uint512> outputs;
+
+            //! The templates of the expressions.
+            std::vector<SynthesisCache::Template> templates;
+          };
+
+          //! A child tried by the parallel synthesis of the children.
+          struct Candidate {
+            //! The parent of the child.
+            triton::ast::AbstractNode* parent = nullptr;
+
+            //! The index of the child in its parent.
+            triton::usize index = 0;
+
+            //! The child.
+            triton::ast::SharedAbstractNode node;
+
+            //! The variables of the child.
+            std::deque<triton::ast::SharedAbstractNode> vars;
+
+            //! True if a synthesis is tried on the child.
+            bool tried = false;
+
+            //! The key of the child in the memo.
+            SynthesisCache::Key key = {0, 0};
+
+            //! True if the child is answered by the memo.
+            bool cached = false;
+
+            //! True if the oracles of the child are evaluated on the calling thread.
+            bool deferred = false;
+
+            //! The operator found by the oracles.
+            triton::ast::ast_e op = triton::ast::INVALID_NODE;
+
+            //! The expressions of the databases found for the child.
+            std::vector<DatabaseMatch> matches;
+
+            //! The constant variable of the solver queries.
+            triton::engines::symbolic::SharedSymbolicVariable var_c;
+
+            //! The constant of the opaque constant synthesis, found by sampling.
+            triton::ast::SharedAbstractNode constant;
+
+            //! The operators of the constant synthesis.
+            std::vector<ConstantEntry> entries;
+
+            //! The models of the constant synthesis, by operator.
+            std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> models;
+
+            //! The synthesized node, or null.
+            triton::ast::SharedAbstractNode output;
+          };
+
           //! Map of subexpr hash to their new symbolic variable
           std::map<triton::uint512, triton::ast::SharedAbstractNode> hash2var;
 
@@ -78,6 +147,12 @@ namespace triton {
           //! An instance of a symbolic engine to create symbolic variable
           triton::engines::symbolic::SymbolicEngine* symbolic;
 
+          //! The memo of the results kept across the calls, or null
+          SynthesisCache* cache;
+
+          //! The databases of precomputed expressions, or null
+          const std::vector<std::shared_ptr<SynthesisDatabase>>* databases;
+
           //! Synthesize a given node that contains one variable (constant synthesizing)
           bool constantSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result);
 
@@ -93,6 +168,45 @@ namespace triton {
           //! Synthesize children expression
           bool childrenSynthesis(const triton::ast::SharedAbstractNode& node, bool constant, bool opaque, SynthesisResult& result);
 
+          //! Synthesize children expression layer by layer, the oracles and the solver queries of a layer on `threads` threads
+          bool parallelChildrenSynthesis(const triton::ast::SharedAbstractNode& node, bool constant, bool opaque, triton::usize threads, SynthesisResult& result);
+
+          //! Solves the constant synthesis, or the opaque constant synthesis if `opaque` is true, of the candidates not synthesized yet
+          void solveConstants(std::vector<Candidate>& candidates, bool opaque, triton::usize threads);
+
+          //! Returns the operator whose oracles a node containing one variable matches, or INVALID_NODE. The node is only read.
+          static triton::ast::ast_e findUnaryOperator(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node);
+
+          //! Returns the operator whose oracles a node containing two variables matches, or INVALID_NODE. The node is only read.
+          static triton::ast::ast_e findBinaryOperator(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node);
+
+          //! Returns the operator whose oracles a node matches, or INVALID_NODE. The node is only read.
+          static triton::ast::ast_e findOperator(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node);
+
+          //! Builds the synthesized node of an operator found by the oracles, extended to the size of `node`
+          static triton::ast::SharedAbstractNode buildOperator(triton::ast::ast_e op, const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node);
+
+          //! Returns the operators of the constant synthesis of `var_x` with the constant `var_c`
+          static std::array<ConstantEntry, 6> getConstantEntries(const triton::engines::symbolic::SharedSymbolicVariable& var_x, const triton::engines::symbolic::SharedSymbolicVariable& var_c, const triton::ast::SharedAstContext& actx);
+
+          //! Returns true if the constant synthesis is tried on a node containing one variable
+          static bool isConstantCandidate(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node);
+
+          //! Returns true if a synthesis is tried on a node
+          bool isTried(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, bool opaque) const;
+
+          //! Returns true if a database is on `arity` variables
+          bool hasDatabase(triton::usize arity) const;
+
+          //! Returns the expressions of the databases whose signature is the one of `node`. The node is only read.
+          std::vector<DatabaseMatch> lookupDatabases(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node) const;
+
+          //! Builds the first expression of `matches` which gives the outputs of `node`, or returns null
+          triton::ast::SharedAbstractNode buildFromDatabases(const std::vector<DatabaseMatch>& matches, const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node) const;
+
+          //! Synthesize a given node with the precomputed expressions of the databases
+          bool databaseSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result);
+
           //! Do the synthesis
           bool do_synthesize(const triton::ast::SharedAbstractNode& node, bool constant, bool opaque, SynthesisResult& result);
 
@@ -103,11 +217,11 @@ namespace triton {
           void substituteSubExpression(const triton::ast::SharedAbstractNode& node);
 
         public:
-          //! Constructor.
-          TRITON_EXPORT Synthesizer(triton::engines::symbolic::SymbolicEngine* symbolic);
+          //! Constructor. The results of the subtrees are looked up in and recorded to `cache` if it is not null, and the precomputed expressions of `databases` are looked up if it is not null.
+          TRITON_EXPORT Synthesizer(triton::engines::symbolic::SymbolicEngine* symbolic, SynthesisCache* cache=nullptr, const std::vector<std::shared_ptr<SynthesisDatabase>>* databases=nullptr);
 
-          //! Synthesizes a given node. If `constant` is true, perform a constant synthesis. If `opaque` is true, perform opaque constant synthesis. If `subexpr` is true, analyze children AST.
-          TRITON_EXPORT SynthesisResult synthesize(const triton::ast::SharedAbstractNode& node, bool constant=true, bool subexpr=true, bool opaque=false);
+          //! Synthesizes a given node. If `constant` is true, perform a constant synthesis. If `opaque` is true, perform opaque constant synthesis. If `subexpr` is true, analyze children AST, on `threads` threads (0 for one per core).
+          TRITON_EXPORT SynthesisResult synthesize(const triton::ast::SharedAbstractNode& node, bool constant=true, bool subexpr=true, bool opaque=false, triton::usize threads=1);
       };
 
     /*! @} End of synthesis namespace */
@@ -0,0 +1,248 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SYSCALLEMULATOR_HPP
+#define TRITON_SYSCALLEMULATOR_HPP
+
+#include <functional>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/architecture.hpp>
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/register.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/taintEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class SyscallEmulator
+     *  \brief The native emulation of the Linux system calls.
+     *
+     *  \details Once the `syscall` (x86-64), `int 0x80` (i386) or `svc` (AArch64) instruction has been processed,
+     *  the system call is applied on the concrete, symbolic and taint states and its result written into the
+     *  return register. The files are kept in a virtual filesystem, where `/dev/stdin`, `/dev/stdout` and
+     *  `/dev/stderr` are opened on the descriptors 0, 1 and 2. The bytes read from a symbolic file are symbolic
+     *  variables, one per byte of the file, and are tainted. `brk` and anonymous `mmap` map zero pages on the
+     *  concrete memory. The clock is virtual: it starts at the epoch and advances by one microsecond per query.
+     *  The calls without emulation return `-ENOSYS`. A handler set for a call number replaces its emulation.
+     */
+    class SyscallEmulator {
+      public:
+        /*! \brief The handler of an overridden system call.
+         *
+         * \details The handler takes the number of the call and returns its result, written into the return register.
+         * The arguments are read from the concrete registers.
+         */
+        using Handler = std::function<triton::uint64(triton::uint64 number)>;
+
+        //! The emulated system calls.
+        enum syscall_e {
+          SYSCALL_BRK,            //!< `void* brk(void* addr)`
+          SYSCALL_CLOCK_GETTIME,  //!< `int clock_gettime(clockid_t clk, struct timespec* tp)`
+          SYSCALL_CLOSE,          //!< `int close(int fd)`
+          SYSCALL_EXIT,           //!< `void exit(int status)`
+          SYSCALL_EXIT_GROUP,     //!< `void exit_group(int status)`
+          SYSCALL_GETEGID,        //!< `gid_t getegid(void)`
+          SYSCALL_GETEUID,        //!< `uid_t geteuid(void)`
+          SYSCALL_GETGID,         //!< `gid_t getgid(void)`
+          SYSCALL_GETPID,         //!< `pid_t getpid(void)`
+          SYSCALL_GETTIMEOFDAY,   //!< `int gettimeofday(struct timeval* tv, struct timezone* tz)`
+          SYSCALL_GETUID,         //!< `uid_t getuid(void)`
+          SYSCALL_LSEEK,          //!< `off_t lseek(int fd, off_t offset, int whence)`
+          SYSCALL_MMAP,           //!< `void* mmap(void* addr, size_t length, int prot, int flags, int fd, off_t offset)`
+          SYSCALL_MMAP2,          //!< `void* mmap2(void* addr, size_t length, int prot, int flags, int fd, off_t pgoffset)`
+          SYSCALL_MPROTECT,       //!< `int mprotect(void* addr, size_t len, int prot)`
+          SYSCALL_MUNMAP,         //!< `int munmap(void* addr, size_t length)`
+          SYSCALL_OPEN,           //!< `int open(const char* path, int flags, mode_t mode)`
+          SYSCALL_OPENAT,         //!< `int openat(int dirfd, const char* path, int flags, mode_t mode)`
+          SYSCALL_READ,           //!< `ssize_t read(int fd, void* buf, size_t count)`
+          SYSCALL_TIME,           //!< `time_t time(time_t* tloc)`
+          SYSCALL_WRITE,          //!< `ssize_t write(int fd, const void* buf, size_t count)`
+        };
+
+      private:
+        //! A file of the virtual filesystem.
+        struct File {
+          //! The content of the file.
+          std::vector<triton::uint8> data;
+
+          //! True if the bytes read from the file are symbolic.
+          bool symbolic;
+
+          //! The variables of the bytes already read <offset : variable>.
+          std::map<triton::uint64, triton::engines::symbolic::SharedSymbolicVariable> variables;
+        };
+
+        //! An opened file.
+        struct Descriptor {
+          //! The path of the file.
+          std::string path;
+
+          //! The offset of the next read or write.
+          triton::uint64 offset;
+
+          //! True if the writes go to the end of the file.
+          bool append;
+        };
+
+        //! Architecture API
+        triton::arch::Architecture* architecture;
+
+        //! AstContext API
+        triton::ast::SharedAstContext astCtxt;
+
+        //! Symbolic engine API
+        triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+        //! Taint engine API
+        triton::engines::taint::TaintEngine* taintEngine;
+
+        //! True if the system calls are emulated.
+        bool enabled;
+
+        //! The virtual filesystem <path : file>.
+        std::map<std::string, File> files;
+
+        //! The opened files <descriptor : file>.
+        std::map<triton::uint64, Descriptor> descriptors;
+
+        //! The handlers of the overridden calls <number : handler>.
+        std::unordered_map<triton::uint64, Handler> handlers;
+
+        //! The start of the heap, 0 until the first `brk`.
+        triton::uint64 heapBase;
+
+        //! The program break.
+        triton::uint64 programBreak;
+
+        //! The address of the next `mmap` without `MAP_FIXED`, 0 until the first one.
+        triton::uint64 mmapBase;
+
+        //! The virtual clock in microseconds.
+        triton::uint64 clock;
+
+        //! True once `exit` or `exit_group` has been called.
+        bool exited;
+
+        //! The status of the exit.
+        triton::uint64 exitStatus;
+
+        //! Returns the emulated call of a number of the current architecture, false if the call has no emulation.
+        bool getSyscall(triton::uint64 number, syscall_e& syscall) const;
+
+        //! Returns the register holding the number of the call.
+        const triton::arch::Register& getNumberRegister(void) const;
+
+        //! Returns the concrete value of the `index`-th argument.
+        triton::uint64 getArgument(triton::uint32 index) const;
+
+        //! Writes the result into the return register, concrete and untainted.
+        void setResult(triton::uint64 value);
+
+        //! Returns `-error` in the size of the registers.
+        triton::uint64 getError(triton::uint64 error) const;
+
+        //! Returns the concrete null terminated string at `addr`.
+        std::string getString(triton::uint64 addr) const;
+
+        //! Writes `size` bytes of a file from `offset` at `addr`, symbolic and tainted if the file is symbolic.
+        void loadFile(const std::string& path, triton::uint64 offset, triton::uint64 addr, triton::usize size);
+
+        //! Maps zero pages from `addr` to `addr + size`, dropping the previous symbolic and taint states.
+        void mapZero(triton::uint64 addr, triton::usize size);
+
+        //! Returns the lowest free descriptor.
+        triton::uint64 getFreeDescriptor(void) const;
+
+        //! The emulations, they return the result of the call.
+        triton::uint64 brk(void);
+        triton::uint64 clockGettime(void);
+        triton::uint64 close(void);
+        triton::uint64 gettimeofday(void);
+        triton::uint64 lseek(void);
+        triton::uint64 mmap(triton::uint64 pageOffset);
+        triton::uint64 munmap(void);
+        triton::uint64 open(const std::string& path, triton::uint64 flags);
+        triton::uint64 read(void);
+        triton::uint64 time(void);
+        triton::uint64 write(void);
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT SyscallEmulator(triton::arch::Architecture* architecture,
+                                      const triton::ast::SharedAstContext& astCtxt,
+                                      triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                      triton::engines::taint::TaintEngine* taintEngine);
+
+        //! Enables or disables the emulation.
+        TRITON_EXPORT void enable(bool flag);
+
+        //! Returns true if the system calls are emulated.
+        TRITON_EXPORT bool isEnabled(void) const;
+
+        //! Adds or replaces a file of the virtual filesystem. The bytes read from a symbolic file are symbolic variables.
+        TRITON_EXPORT void addFile(const std::string& path, const std::vector<triton::uint8>& data, bool symbolic=false);
+
+        //! Returns the content of a file of the virtual filesystem. Raises an exception if the file does not exist.
+        TRITON_EXPORT const std::vector<triton::uint8>& getFile(const std::string& path) const;
+
+        //! Returns the paths of the virtual filesystem.
+        TRITON_EXPORT std::vector<std::string> getFiles(void) const;
+
+        //! Overrides the call `number` of the current architecture by `handler`.
+        TRITON_EXPORT void setHandler(triton::uint64 number, const Handler& handler);
+
+        //! Removes the override of the call `number`.
+        TRITON_EXPORT void removeHandler(triton::uint64 number);
+
+        //! Sets the start of the heap grown by `brk`.
+        TRITON_EXPORT void setProgramBreak(triton::uint64 addr);
+
+        //! Returns the program break.
+        TRITON_EXPORT triton::uint64 getProgramBreak(void) const;
+
+        //! Returns true once the program called `exit` or `exit_group`.
+        TRITON_EXPORT bool hasExited(void) const;
+
+        //! Returns the status given to `exit` or `exit_group`.
+        TRITON_EXPORT triton::uint64 getExitStatus(void) const;
+
+        //! Closes the opened files but the standard ones, and resets the heap, the mappings, the clock and the exit status. The files are kept.
+        TRITON_EXPORT void reset(void);
+
+        //! Emulates the system call of the instruction, once it has been processed. Returns false if the instruction is not a system call or the emulation is disabled.
+        TRITON_EXPORT bool apply(const triton::arch::Instruction& inst);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYSCALLEMULATOR_HPP */
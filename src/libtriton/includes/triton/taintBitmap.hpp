@@ -0,0 +1,204 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TAINTBITMAP_HPP
+#define TRITON_TAINTBITMAP_HPP
+
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/copyOnWrite.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      /*! \class TaintBitmap
+       *  \brief The tainted bytes of the memory, as a sparse table of bitmap pages.
+       *
+       *  \details The memory is split into pages of `TaintBitmap::pageSize` bytes, each one holding one bit
+       *  per byte. Pages are allocated when one of their bytes is tainted and released once they have no
+       *  tainted byte anymore. A range is checked and updated a 64-bit word at a time.
+       *
+       *  Copying a TaintBitmap shares its page directory and its pages. They are copied the first time
+       *  one of their owners modifies them (copy-on-write), so a copy costs O(1). The pages come from the
+       *  memory resource of the bitmap if one is set.
+       */
+      class TaintBitmap {
+        public:
+          //! The size of a page in bytes.
+          static constexpr triton::usize pageSize = 0x1000;
+
+          //! The number of 64-bit words used by the bitmap of a page.
+          static constexpr triton::usize bitmapSize = pageSize / 64;
+
+          //! A page of the bitmap.
+          struct Page {
+            //! The bitmap of tainted bytes.
+            triton::uint64 tainted[bitmapSize];
+
+            //! The number of tainted bytes in the page.
+            triton::usize count;
+
+            //! Constructor.
+            Page();
+          };
+
+          //! The page directory type (page number -> page).
+          using PageMap = std::unordered_map<triton::uint64, std::shared_ptr<Page>, IdentityHash<triton::uint64>>;
+
+          /*! \class const_iterator
+           *  \brief Iterates over the tainted addresses. The order is unspecified.
+           */
+          class const_iterator {
+            private:
+              //! The iterated bitmap.
+              const TaintBitmap* bitmap;
+
+              //! The current page.
+              PageMap::const_iterator page;
+
+              //! The offset of the current byte in the current page.
+              triton::usize offset;
+
+              //! Moves to the next tainted byte starting at the current position (included).
+              void seek(void);
+
+            public:
+              using iterator_category = std::forward_iterator_tag;
+              using value_type        = triton::uint64;
+              using difference_type   = std::ptrdiff_t;
+              using pointer           = void;
+              using reference         = value_type;
+
+              //! Constructor. Points to the first tainted byte of `bitmap`, or past its last one if `end` is true.
+              TRITON_EXPORT const_iterator(const TaintBitmap* bitmap, bool end);
+
+              //! Returns the current address.
+              TRITON_EXPORT value_type operator*(void) const;
+
+              //! Moves to the next tainted byte.
+              TRITON_EXPORT const_iterator& operator++(void);
+
+              //! Moves to the next tainted byte.
+              TRITON_EXPORT const_iterator operator++(int);
+
+              //! Returns true if both iterators point to the same byte.
+              TRITON_EXPORT bool operator==(const const_iterator& other) const;
+
+              //! Returns true if iterators point to different bytes.
+              TRITON_EXPORT bool operator!=(const const_iterator& other) const;
+          };
+
+        private:
+          //! The page directory (shared copy-on-write).
+          triton::utils::CopyOnWrite<PageMap> pages;
+
+          //! The number of tainted bytes.
+          triton::usize taintedBytes;
+
+          //! The memory resource of the pages, nullptr for the heap.
+          std::pmr::memory_resource* resource;
+
+          //! Returns a writable page. The page is copied first if it is shared with another bitmap.
+          Page* getWritablePage(std::shared_ptr<Page>& page);
+
+          //! Sets or clears the bits of `size` bytes from `addr`, without crossing a page.
+          void update(triton::uint64 addr, triton::usize size, bool flag);
+
+        public:
+          //! Returns the page number of an address.
+          static inline triton::uint64 pageNumber(triton::uint64 addr) {
+            return addr / pageSize;
+          }
+
+          //! Returns the offset of an address in its page.
+          static inline triton::usize pageOffset(triton::uint64 addr) {
+            return static_cast<triton::usize>(addr % pageSize);
+          }
+
+          //! Constructor.
+          TRITON_EXPORT TaintBitmap();
+
+          //! Constructor by copy. Pages are shared copy-on-write.
+          TRITON_EXPORT TaintBitmap(const TaintBitmap& other);
+
+          //! Copies a TaintBitmap. Pages are shared copy-on-write.
+          TRITON_EXPORT TaintBitmap& operator=(const TaintBitmap& other);
+
+          //! Returns true if one of the bytes from `addr` to `addr + size` is tainted.
+          TRITON_EXPORT bool isTainted(triton::uint64 addr, triton::usize size=1) const;
+
+          //! Returns the number of tainted bytes from `addr` to `addr + size`.
+          TRITON_EXPORT triton::usize count(triton::uint64 addr, triton::usize size) const;
+
+          //! Taints the bytes from `addr` to `addr + size`.
+          TRITON_EXPORT void taint(triton::uint64 addr, triton::usize size=1);
+
+          //! Untaints the bytes from `addr` to `addr + size`. Empty pages are released.
+          TRITON_EXPORT void untaint(triton::uint64 addr, triton::usize size=1);
+
+          //! Untaints the whole memory.
+          TRITON_EXPORT void clear(void);
+
+          //! Sets the memory resource of the pages allocated from now on, nullptr for the heap.
+          TRITON_EXPORT void setMemoryResource(std::pmr::memory_resource* resource);
+
+          //! Returns the number of tainted bytes.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns true if no byte is tainted.
+          TRITON_EXPORT bool empty(void) const;
+
+          //! Returns the tainted addresses as sorted and coalesced intervals of <address : size>.
+          TRITON_EXPORT std::vector<std::pair<triton::uint64, triton::usize>> getRanges(void) const;
+
+          //! Returns the number of allocated pages.
+          TRITON_EXPORT triton::usize getNumberOfPages(void) const;
+
+          //! Returns an iterator to the first tainted address.
+          TRITON_EXPORT const_iterator begin(void) const;
+
+          //! Returns an iterator past the last tainted address.
+          TRITON_EXPORT const_iterator end(void) const;
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTBITMAP_HPP */
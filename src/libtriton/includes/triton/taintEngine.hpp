@@ -8,13 +8,22 @@
 #ifndef TRITON_TAINTENGINE_H
 #define TRITON_TAINTENGINE_H
 
+#include <bitset>
+#include <istream>
+#include <memory_resource>
+#include <ostream>
 #include <unordered_set>
+#include <vector>
 
+#include <triton/archEnums.hpp>
+#include <triton/copyOnWrite.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/modes.hpp>
 #include <triton/register.hpp>
 #include <triton/symbolicEngine.hpp>
+#include <triton/taintBitmap.hpp>
+#include <triton/taintLabels.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -48,6 +57,9 @@ namespace triton {
       //! Defines an untainted item.
       const bool UNTAINTED = !TAINTED;
 
+      //! The set of the tainted parent registers, as a bit per register indexed by its id.
+      using RegisterSet = std::bitset<triton::arch::ID_REG_LAST_ITEM>;
+
       /*! \class TaintEngine
           \brief The taint engine class. */
       class TaintEngine {
@@ -62,15 +74,18 @@ namespace triton {
           triton::arch::CpuInterface& cpu;
 
         protected:
-          //! The set of tainted addresses.
-          std::unordered_set<triton::uint64> taintedMemory;
+          //! The bitmap of tainted addresses (its pages are shared copy-on-write between copies of the engine).
+          triton::engines::taint::TaintBitmap taintedMemory;
+
+          //! The set of tainted parent registers. Currently it is an over approximation of the taint.
+          triton::engines::taint::RegisterSet taintedRegisters;
 
-          //! The set of tainted registers. Currently it is an over approximation of the taint.
-          std::unordered_set<triton::arch::register_e> taintedRegisters;
+          //! The labels of the tainted bytes and registers, propagated with the taint once a label is used.
+          triton::engines::taint::TaintLabels labels;
 
         public:
-          //! Constructor.
-          TRITON_EXPORT TaintEngine(const triton::modes::SharedModes& modes, triton::engines::symbolic::SymbolicEngine* symbolicEngine, triton::arch::CpuInterface& cpu);
+          //! Constructor. The pages of the taint and of the labels are allocated from `resource` if it is not nullptr.
+          TRITON_EXPORT TaintEngine(const triton::modes::SharedModes& modes, triton::engines::symbolic::SymbolicEngine* symbolicEngine, triton::arch::CpuInterface& cpu, std::pmr::memory_resource* resource=nullptr);
 
           //! Constructor by copy.
           TRITON_EXPORT TaintEngine(const TaintEngine& other);
@@ -78,14 +93,44 @@ namespace triton {
           //! Copies a TaintEngine.
           TRITON_EXPORT TaintEngine& operator=(const TaintEngine& other);
 
-          //! Returns the tainted addresses.
-          TRITON_EXPORT const std::unordered_set<triton::uint64>& getTaintedMemory(void) const;
+          //! Copies the tainted registers and addresses of another engine. The memory and the labels are shared copy-on-write.
+          TRITON_EXPORT void copyState(const TaintEngine& other);
+
+          //! Untaints everything and removes the labels.
+          TRITON_EXPORT void reset(void);
+
+          //! Writes the tainted memory and registers, with their labels, into `stream`.
+          TRITON_EXPORT void saveState(std::ostream& stream) const;
+
+          //! Replaces the taint state by the one written by saveState().
+          TRITON_EXPORT void loadState(std::istream& stream);
+
+          //! Returns the tainted addresses, as a view iterating over them.
+          TRITON_EXPORT const triton::engines::taint::TaintBitmap& getTaintedMemory(void) const;
+
+          //! Returns the tainted addresses as sorted and coalesced intervals of <address : size>.
+          TRITON_EXPORT std::vector<std::pair<triton::uint64, triton::usize>> getTaintedRanges(void) const;
 
           //! Returns the tainted registers.
           TRITON_EXPORT std::unordered_set<const triton::arch::Register*> getTaintedRegisters(void) const;
 
-          //! Returns true if the addr is tainted.
-          TRITON_EXPORT bool isMemoryTainted(triton::uint64 addr, triton::uint32 size=1) const;
+          //! Returns the tainted parent registers, as a view indexed by their id.
+          TRITON_EXPORT const triton::engines::taint::RegisterSet& getTaintedRegisterSet(void) const;
+
+          //! Returns the sorted labels reaching one of the `size` bytes from addr.
+          TRITON_EXPORT std::vector<triton::uint32> getMemoryTaintLabels(triton::uint64 addr, triton::usize size=1) const;
+
+          //! Returns the sorted labels reaching the memory.
+          TRITON_EXPORT std::vector<triton::uint32> getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const;
+
+          //! Returns the sorted labels reaching the register.
+          TRITON_EXPORT std::vector<triton::uint32> getRegisterTaintLabels(const triton::arch::Register& reg) const;
+
+          //! Returns true if one of the `size` bytes from addr is tainted.
+          TRITON_EXPORT bool isMemoryTainted(triton::uint64 addr, triton::usize size=1) const;
+
+          //! Returns true if one of the `size` bytes from addr is tainted. Same as isMemoryTainted(addr, size).
+          TRITON_EXPORT bool isAnyTainted(triton::uint64 addr, triton::usize size) const;
 
           //! Returns true if the memory is tainted.
           TRITON_EXPORT bool isMemoryTainted(const triton::arch::MemoryAccess& mem, bool mode=true) const;
@@ -105,8 +150,11 @@ namespace triton {
           //! Sets the flag (taint or untaint) to a register.
           TRITON_EXPORT bool setTaintRegister(const triton::arch::Register& reg, bool flag);
 
-          //! Taints an address. Returns TAINTED if the address has been tainted correctly. Otherwise it returns the last defined state.
-          TRITON_EXPORT bool taintMemory(triton::uint64 addr);
+          //! Taints `size` bytes from an address. Returns TAINTED if the addresses have been tainted correctly. Otherwise it returns the last defined state.
+          TRITON_EXPORT bool taintMemory(triton::uint64 addr, triton::usize size=1);
+
+          //! Taints the interval of `size` bytes from an address at once. Same as taintMemory(addr, size).
+          TRITON_EXPORT bool taintMemoryRange(triton::uint64 addr, triton::usize size);
 
           //! Taints a memory. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool taintMemory(const triton::arch::MemoryAccess& mem);
@@ -114,8 +162,20 @@ namespace triton {
           //! Taints a register. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool taintRegister(const triton::arch::Register& reg);
 
-          //! Untaints an address. Returns !TAINTED if the address has been untainted correctly. Otherwise it returns the last defined state.
-          TRITON_EXPORT bool untaintMemory(triton::uint64 addr);
+          //! Taints `size` bytes from an address with a label, added to their labels. Returns TAINTED.
+          TRITON_EXPORT bool taintMemoryWithLabel(triton::uint64 addr, triton::usize size, triton::uint32 label);
+
+          //! Taints a memory with a label, added to its labels. Returns TAINTED.
+          TRITON_EXPORT bool taintMemoryWithLabel(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
+          //! Taints a register with a label, added to its labels. Returns TAINTED.
+          TRITON_EXPORT bool taintRegisterWithLabel(const triton::arch::Register& reg, triton::uint32 label);
+
+          //! Untaints `size` bytes from an address. Returns !TAINTED if the addresses have been untainted correctly. Otherwise it returns the last defined state.
+          TRITON_EXPORT bool untaintMemory(triton::uint64 addr, triton::usize size=1);
+
+          //! Untaints the interval of `size` bytes from an address at once. Same as untaintMemory(addr, size).
+          TRITON_EXPORT bool untaintMemoryRange(triton::uint64 addr, triton::usize size);
 
           //! Untaints a memory. Returns !TAINTED if the memory has been untainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool untaintMemory(const triton::arch::MemoryAccess& mem);
@@ -166,6 +226,9 @@ namespace triton {
           TRITON_EXPORT bool taintAssignment(const triton::arch::Register& regDst, const triton::arch::Register& regSrc);
 
         private:
+          //! Returns the labels of the memory, and of its pointer registers if `mode` is true and the taint spreads through pointers.
+          triton::engines::taint::TaintLabels::LabelSet getMemoryLabels(const triton::arch::MemoryAccess& mem, bool mode=true) const;
+
           //! Spreads MemoryImmediate with union.
           bool unionMemoryImmediate(const triton::arch::MemoryAccess& memDst);
 
@@ -0,0 +1,176 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TAINTLABELS_HPP
+#define TRITON_TAINTLABELS_HPP
+
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/copyOnWrite.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/taintBitmap.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      /*! \class TaintLabels
+       *  \brief The labels of the tainted bytes and registers, i.e. the input sources which reach them.
+       *
+       *  \details A set of labels is a 64-bit word. The labels from 0 to 62 are held inline as a bitset, and
+       *  a set holding a higher label is interned into a table, the word being its index with the top bit set.
+       *  The labels of the memory are held by pages of `TaintBitmap::pageSize` bytes, allocated when one of
+       *  their bytes gets a label, and those of the registers by parent register. The empty set is 0.
+       *
+       *  Copying a TaintLabels shares its pages, its registers and its table copy-on-write. The pages come
+       *  from the memory resource of the labels if one is set.
+       */
+      class TaintLabels {
+        public:
+          //! A set of labels.
+          using LabelSet = triton::uint64;
+
+          //! The bit marking an interned set.
+          static constexpr LabelSet interned = static_cast<LabelSet>(1) << 63;
+
+          //! The number of labels held inline.
+          static constexpr triton::uint32 inlineLabels = 63;
+
+          //! The size of a page in bytes.
+          static constexpr triton::usize pageSize = TaintBitmap::pageSize;
+
+          //! A page of the labels of the memory.
+          struct Page {
+            //! The label set of each byte of the page.
+            LabelSet labels[pageSize];
+
+            //! The number of bytes having a label in the page.
+            triton::usize count;
+
+            //! Constructor.
+            Page();
+          };
+
+          //! The page directory type (page number -> page).
+          using PageMap = std::unordered_map<triton::uint64, std::shared_ptr<Page>, IdentityHash<triton::uint64>>;
+
+        private:
+          //! The interned sets.
+          struct Table {
+            //! The sorted labels of each interned set, by index.
+            std::vector<std::vector<triton::uint32>> sets;
+
+            //! The index of each interned set.
+            std::map<std::vector<triton::uint32>, triton::uint64> indexes;
+          };
+
+          //! The table of interned sets (shared copy-on-write). It only grows, even from a const method.
+          mutable triton::utils::CopyOnWrite<Table> table;
+
+          //! The page directory (shared copy-on-write).
+          triton::utils::CopyOnWrite<PageMap> pages;
+
+          //! The label sets of the parent registers (shared copy-on-write).
+          triton::utils::CopyOnWrite<std::unordered_map<triton::arch::register_e, LabelSet>> registers;
+
+          //! True once a label has been created.
+          bool used;
+
+          //! The memory resource of the pages, nullptr for the heap.
+          std::pmr::memory_resource* resource;
+
+          //! Returns the set of sorted and unique labels, interned if it cannot be held inline.
+          LabelSet intern(const std::vector<triton::uint32>& labels) const;
+
+          //! Returns a writable page. The page is copied first if it is shared.
+          Page* getWritablePage(std::shared_ptr<Page>& page);
+
+          //! Sets or adds `set` to the bytes from `addr` to `addr + size`.
+          void updateMemory(triton::uint64 addr, triton::usize size, LabelSet set, bool add);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT TaintLabels();
+
+          //! Constructor by copy.
+          TRITON_EXPORT TaintLabels(const TaintLabels& other);
+
+          //! Copies a TaintLabels.
+          TRITON_EXPORT TaintLabels& operator=(const TaintLabels& other);
+
+          //! Returns true once a label has been created, the labels being propagated from then on.
+          TRITON_EXPORT bool isUsed(void) const;
+
+          //! Returns the set holding `label` only.
+          TRITON_EXPORT LabelSet makeSet(triton::uint32 label);
+
+          //! Returns the union of two sets.
+          TRITON_EXPORT LabelSet unite(LabelSet set1, LabelSet set2) const;
+
+          //! Returns the sorted labels of a set.
+          TRITON_EXPORT std::vector<triton::uint32> getLabels(LabelSet set) const;
+
+          //! Returns the union of the sets of the bytes from `addr` to `addr + size`.
+          TRITON_EXPORT LabelSet getMemory(triton::uint64 addr, triton::usize size=1) const;
+
+          //! Sets the set of the bytes from `addr` to `addr + size`.
+          TRITON_EXPORT void setMemory(triton::uint64 addr, triton::usize size, LabelSet set);
+
+          //! Adds `set` to the sets of the bytes from `addr` to `addr + size`.
+          TRITON_EXPORT void addMemory(triton::uint64 addr, triton::usize size, LabelSet set);
+
+          //! Returns the set of a parent register.
+          TRITON_EXPORT LabelSet getRegister(triton::arch::register_e parent) const;
+
+          //! Sets the set of a parent register.
+          TRITON_EXPORT void setRegister(triton::arch::register_e parent, LabelSet set);
+
+          //! Adds `set` to the set of a parent register.
+          TRITON_EXPORT void addRegister(triton::arch::register_e parent, LabelSet set);
+
+          //! Clears the labels, the table and the sets.
+          TRITON_EXPORT void clear(void);
+
+          //! Sets the memory resource of the pages allocated from now on, nullptr for the heap.
+          TRITON_EXPORT void setMemoryResource(std::pmr::memory_resource* resource);
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTLABELS_HPP */
@@ -0,0 +1,119 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TAINTSUMMARY_HPP
+#define TRITON_TAINTSUMMARY_HPP
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/cpuInterface.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/taintEngine.hpp>
+#include <triton/traceReader.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      //! A location of the taint: a parent register, or a byte of memory if `reg` is `ID_REG_INVALID`.
+      struct TaintLocation {
+        //! The parent register.
+        triton::arch::register_e reg;
+
+        //! The address of the byte, if not a register.
+        triton::uint64 address;
+      };
+
+      /*! \class TaintSummary
+       *  \brief The taint transfer function of a chunk of an execution trace.
+       *
+       *  \details Each location written by the chunk is mapped to the locations at the entry of the
+       *  chunk it depends on, an empty list meaning that it is untainted whatever the entry taint. The
+       *  other locations keep their taint. The summaries of consecutive chunks are computed independently,
+       *  then applied in order to a taint engine, which gives the taint of the sequential processing.
+       *
+       *  A summary is computed by processing the chunk in its own context where each location holds a
+       *  label naming it: all the parent registers at the entry, and each byte of memory the first time
+       *  it is read without having been written by the chunk. The labels reaching a location at the end
+       *  of the chunk are its dependencies.
+       */
+      class TaintSummary {
+        private:
+          //! The index of the first record of the chunk.
+          triton::usize first;
+
+          //! The number of records of the chunk.
+          triton::usize count;
+
+          //! The written locations and the entry locations they depend on.
+          std::vector<std::pair<TaintLocation, std::vector<TaintLocation>>> outputs;
+
+        public:
+          //! Constructor. The summary of an empty chunk.
+          TRITON_EXPORT TaintSummary();
+
+          /*!
+           * \brief Computes the summary of the records `[begin, end)` of `records` in a context of `arch`.
+           *
+           * \details `registers` and `memory` give the concrete state before the first record of `records`,
+           * those of the records being deltas. The deltas of the records before `begin` are applied without
+           * processing their instruction. `memory` is only called for the bytes not set by a delta and may
+           * be called concurrently by several summaries.
+           */
+          TRITON_EXPORT static TaintSummary compute(triton::arch::architecture_e arch,
+                                                    const std::vector<triton::loaders::TraceRecord>& records,
+                                                    triton::usize begin,
+                                                    triton::usize end,
+                                                    const std::vector<std::pair<triton::arch::register_e, triton::uint512>>& registers,
+                                                    const std::function<triton::uint8(triton::uint64)>& memory);
+
+          //! Returns the index of the first record of the chunk.
+          TRITON_EXPORT triton::usize getFirstRecord(void) const;
+
+          //! Returns the number of records of the chunk.
+          TRITON_EXPORT triton::usize getNumberOfRecords(void) const;
+
+          //! Returns the written locations and the entry locations they depend on.
+          TRITON_EXPORT const std::vector<std::pair<TaintLocation, std::vector<TaintLocation>>>& getOutputs(void) const;
+
+          //! Updates the taint of `engine` as the processing of the chunk would.
+          TRITON_EXPORT void apply(triton::engines::taint::TaintEngine& engine, const triton::arch::CpuInterface& cpu) const;
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTSUMMARY_HPP */
@@ -0,0 +1,171 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TIMEOUTBUDGET_HPP
+#define TRITON_TIMEOUTBUDGET_HPP
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! The features of a query used to predict its solving time.
+      struct QueryFeatures {
+        //! The number of distinct AST nodes, the referenced expressions included.
+        triton::usize nodes = 0;
+
+        //! The number of distinct symbolic variables.
+        triton::usize variables = 0;
+
+        //! The number of multiplications, divisions and remainders.
+        triton::usize multiplications = 0;
+
+        //! True if the query reads the memory array.
+        bool arrays = false;
+      };
+
+      /*! \class TimeoutBudget
+       *  \brief The adaptive timeouts of the queries, handed out from the budget of an exploration round.
+       *
+       *  \details The solving time of a query is predicted from the previous solves of the same structural
+       *  hash, else from the average of the queries of similar features (the powers of two of their nodes,
+       *  variables and multiplications, and the use of the memory array), else from a cost model of its
+       *  features. A query receives a few times its prediction, within the bounds of a query, and never more
+       *  than what is left of the round. A query which already timed out with the largest timeout is deemed
+       *  hopeless and receives the smallest one. Once the round is spent, the queries time out without solver.
+       *  A timed out query is retried with twice its timeout while the retry callback deems it still valuable.
+       */
+      class TimeoutBudget {
+        public:
+          //! Decides if a timed out query is retried, given its timeout in milliseconds.
+          using RetryCallback = std::function<bool(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout)>;
+
+        private:
+          //! The solving times of a query or of a class of queries.
+          struct History {
+            //! The moving average of the solving times, in milliseconds.
+            triton::uint64 time;
+
+            //! The largest timeout which expired, 0 if none.
+            triton::uint32 timeout;
+          };
+
+          //! Protects the budget from the concurrent queries.
+          mutable std::mutex lock;
+
+          //! True if the timeouts are adaptive.
+          bool enabled;
+
+          //! The smallest timeout of a query, in milliseconds.
+          triton::uint32 minTimeout;
+
+          //! The largest timeout of a query, in milliseconds.
+          triton::uint32 maxTimeout;
+
+          //! True if the current round has a budget.
+          bool bounded;
+
+          //! The time left in the current round, in milliseconds.
+          triton::uint64 remaining;
+
+          //! The maximum number of retries of a query.
+          triton::uint32 retries;
+
+          //! Decides if a timed out query is retried.
+          RetryCallback retryCallback;
+
+          //! The solving times by structural hash.
+          std::map<triton::uint512, History> queries;
+
+          //! The solving times by class of features.
+          std::unordered_map<triton::uint64, History> classes;
+
+          //! Returns the class of a query.
+          static triton::uint64 getClass(const QueryFeatures& features);
+
+          //! Returns the predicted solving time of a query, the lock being taken.
+          triton::uint32 predictLocked(const triton::ast::SharedAbstractNode& node, const QueryFeatures& features) const;
+
+        public:
+          //! Constructor. Disabled, with the timeouts of a query between 10 ms and 10 s and no round.
+          TRITON_EXPORT TimeoutBudget();
+
+          //! Enables or disables the adaptive timeouts. Disabling keeps the history.
+          TRITON_EXPORT void enable(bool flag);
+
+          //! Returns true if the timeouts are adaptive.
+          TRITON_EXPORT bool isEnabled(void) const;
+
+          //! Sets the smallest and the largest timeout of a query, in milliseconds.
+          TRITON_EXPORT void setBounds(triton::uint32 minTimeout, triton::uint32 maxTimeout);
+
+          //! Starts an exploration round with `budget` milliseconds to hand out, 0 for an unlimited round.
+          TRITON_EXPORT void startRound(triton::uint64 budget);
+
+          //! Returns the time left in the current round, in milliseconds. Returns 0 for an unlimited round.
+          TRITON_EXPORT triton::uint64 getRemaining(void) const;
+
+          //! Sets the callback deciding if a timed out query is retried with twice its timeout, at most `retries` times. An empty callback disables the retries.
+          TRITON_EXPORT void setRetryCallback(const RetryCallback& callback, triton::uint32 retries=2);
+
+          //! Returns the features of a query.
+          TRITON_EXPORT static QueryFeatures getFeatures(const triton::ast::SharedAbstractNode& node);
+
+          //! Returns the predicted solving time of a query, in milliseconds.
+          TRITON_EXPORT triton::uint32 predict(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Returns the timeout of a query, in milliseconds, and charges it on the round. Returns 0 if the round is spent.
+          TRITON_EXPORT triton::uint32 allocate(const triton::ast::SharedAbstractNode& node, const QueryFeatures& features);
+
+          //! Records the solving time of a query given `timeout`, and gives back the unused part of its timeout to the round.
+          TRITON_EXPORT void record(const triton::ast::SharedAbstractNode& node, const QueryFeatures& features, triton::uint32 timeout, triton::engines::solver::status_e status, triton::uint32 solvingTime);
+
+          //! Returns the timeout of the retry of a timed out query, and charges it on the round. Returns 0 if the query is not retried.
+          TRITON_EXPORT triton::uint32 retry(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout, triton::uint32 attempt);
+
+          //! Clears the history of the solving times.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TIMEOUTBUDGET_HPP */
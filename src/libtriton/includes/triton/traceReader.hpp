@@ -0,0 +1,176 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TRACEREADER_HPP
+#define TRITON_TRACEREADER_HPP
+
+#include <condition_variable>
+#include <exception>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/binaryLoader.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Loaders namespace
+  namespace loaders {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup loaders
+   *  @{
+   */
+
+    //! A memory delta of a trace record, its bytes being at `offset` in the bytes of the record.
+    struct TraceMemory {
+      //! The address of the delta.
+      triton::uint64 address;
+
+      //! The offset of the bytes in `TraceRecord::bytes`.
+      triton::uint32 offset;
+
+      //! The number of bytes.
+      triton::uint32 size;
+    };
+
+
+    //! An instruction of an execution trace, with the concrete state it reads.
+    struct TraceRecord {
+      //! The address of the instruction.
+      triton::uint64 address;
+
+      //! The opcode of the instruction.
+      std::vector<triton::uint8> opcode;
+
+      //! The register deltas <register : value>.
+      std::vector<std::pair<triton::arch::register_e, triton::uint512>> registers;
+
+      //! The memory deltas.
+      std::vector<triton::loaders::TraceMemory> memory;
+
+      //! The bytes of the memory deltas.
+      std::vector<triton::uint8> bytes;
+    };
+
+
+    /*! \class TraceReader
+     *  \brief Reads the records of an execution trace, decoding the next ones in the background.
+     *
+     *  \details A trace is written by an external tracer (Pin, QEMU, DynamoRIO...) in little endian:
+     *  a header `"TTRC"`, a 16-bit version (1) and a 16-bit triton::arch::architecture_e, then the
+     *  records up to the end of the file. A record is the 64-bit address of the instruction, its 8-bit
+     *  opcode size (1 to 16) and its opcode, a 16-bit count of register deltas, each one a 16-bit
+     *  triton::arch::register_e, an 8-bit size (1 to 64) and the value, then a 16-bit count of memory
+     *  deltas, each one a 64-bit address, a 32-bit size and the bytes. The deltas are the concrete
+     *  values before the instruction, only the ones which changed since the previous record are needed.
+     *
+     *  A file is mapped in memory, a stream is read as it goes. A thread decodes a batch of records
+     *  while the previous one is consumed, so that the decoding overlaps the processing.
+     */
+    class TraceReader {
+      private:
+        //! The number of records of a batch.
+        static constexpr triton::usize batchSize = 256;
+
+        //! The mapped file, if any.
+        std::unique_ptr<triton::loaders::MappedFile> file;
+
+        //! The offset of the next byte in the mapped file.
+        triton::usize offset;
+
+        //! The stream read, if no file is mapped.
+        std::istream* stream;
+
+        //! The architecture of the trace.
+        triton::arch::architecture_e arch;
+
+        //! The batch consumed and the one decoded in the background.
+        std::vector<triton::loaders::TraceRecord> front, back;
+
+        //! The number of records of the batches.
+        triton::usize frontCount, backCount;
+
+        //! The index of the next record of `front`.
+        triton::usize position;
+
+        //! True if `back` is decoded and not yet consumed.
+        bool backReady;
+
+        //! True once the thread decoded the last record.
+        bool finished;
+
+        //! True if the thread must stop.
+        bool stopping;
+
+        //! The exception raised by the thread.
+        std::exception_ptr error;
+
+        //! Guards the fields shared with the thread.
+        std::mutex lock;
+
+        //! Signals the changes of the shared fields.
+        std::condition_variable changed;
+
+        //! The decoding thread.
+        std::thread prefetcher;
+
+        //! Reads `size` bytes. Returns false at the end of the trace.
+        bool read(void* dst, triton::usize size);
+
+        //! Reads `size` bytes of a record, the trace must not end.
+        void readRecord(void* dst, triton::usize size);
+
+        //! Decodes a record. Returns false at the end of the trace.
+        bool decode(triton::loaders::TraceRecord& record);
+
+        //! Reads the header and starts the thread.
+        void init(void);
+
+        //! The loop of the thread.
+        void prefetch(void);
+
+      public:
+        //! Constructor. Maps the trace at `path`.
+        TRITON_EXPORT TraceReader(const std::string& path);
+
+        //! Constructor. Reads the trace from `stream`, which must outlive the reader.
+        TRITON_EXPORT TraceReader(std::istream& stream);
+
+        //! Destructor. Stops the thread.
+        TRITON_EXPORT ~TraceReader();
+
+        TraceReader(const TraceReader& other) = delete;
+        TraceReader& operator=(const TraceReader& other) = delete;
+
+        //! Returns the architecture of the trace.
+        TRITON_EXPORT triton::arch::architecture_e getArchitecture(void) const;
+
+        //! Returns the next record, valid until the next call, or nullptr at the end of the trace.
+        TRITON_EXPORT const triton::loaders::TraceRecord* next(void);
+    };
+
+  /*! @} End of loaders namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEREADER_HPP */
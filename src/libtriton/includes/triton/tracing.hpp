@@ -0,0 +1,101 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TRACING_HPP
+#define TRITON_TRACING_HPP
+
+#include <ostream>
+
+#include <triton/config.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    /*
+     *  The tracing records the time spent in the main entry points of the engines (processing, semantics,
+     *  symbolic expressions, solver queries and simplifications) as timeline events, to be viewed in
+     *  chrome://tracing or in Perfetto. The hooks are compiled only with the TRACING option and record
+     *  nothing until the tracing is enabled. Each thread appends its events to its own buffer without a
+     *  lock; the buffers are only read by the writers below.
+     */
+
+    //! Enables or disables the recording of the events, for every thread.
+    TRITON_EXPORT void enableTracing(bool flag);
+
+    //! Returns true if the events are recorded.
+    TRITON_EXPORT bool isTracingEnabled(void);
+
+    //! Drops the recorded events. No thread must be traced meanwhile.
+    TRITON_EXPORT void clearTrace(void);
+
+    //! Returns the number of recorded events.
+    TRITON_EXPORT triton::usize getTraceSize(void);
+
+    //! Writes the recorded events as a Chrome trace (JSON).
+    TRITON_EXPORT void writeChromeTrace(std::ostream& stream);
+
+    //! Writes the recorded events as a Perfetto trace (protobuf), a track per thread.
+    TRITON_EXPORT void writePerfettoTrace(std::ostream& stream);
+
+    /*! \class TraceScope
+     *  \brief Records an event from its construction to its destruction, see TRITON_TRACE.
+     *
+     *  \details The category and the name must be string literals, they are kept as pointers.
+     */
+    class TraceScope {
+      private:
+        //! The category of the event.
+        const char* category;
+
+        //! The name of the event.
+        const char* name;
+
+        //! The start of the event in nanoseconds, 0 if the tracing was disabled.
+        triton::uint64 start;
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT TraceScope(const char* category, const char* name);
+
+        //! Destructor. Records the event.
+        TRITON_EXPORT ~TraceScope();
+
+        TraceScope(const TraceScope& other) = delete;
+        TraceScope& operator=(const TraceScope& other) = delete;
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+//! Traces the enclosing scope as the event `name` of `category`. Compiled out without the TRACING option.
+#ifdef TRITON_TRACING
+  #define TRITON_TRACE_CONCAT_(a, b) a##b
+  #define TRITON_TRACE_CONCAT(a, b) TRITON_TRACE_CONCAT_(a, b)
+  #define TRITON_TRACE(category, name) triton::utils::TraceScope TRITON_TRACE_CONCAT(traceScope, __LINE__)(category, name)
+#else
+  #define TRITON_TRACE(category, name)
+#endif
+
+#endif /* TRITON_TRACING_HPP */
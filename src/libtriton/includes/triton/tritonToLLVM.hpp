@@ -13,6 +13,7 @@
 #include <ostream>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
@@ -41,7 +42,11 @@ namespace triton {
    */
 
     //! \class TritonToLLVM
-    /*! \brief Converts a Triton's AST to LVM IR. */
+    /*! \brief Converts a Triton's AST to LVM IR.
+     *
+     *  \details Each call of `convert()` adds a function to the same module, so a batch of ASTs, a basic
+     *  block or a trace can be lifted once and optimized once with `optimizeModule()`.
+     */
     class TritonToLLVM {
       private:
         //! The LLVM context.
@@ -56,9 +61,18 @@ namespace triton {
         //! Map Triton variables to LLVM ones.
         std::map<triton::ast::SharedAbstractNode, llvm::Value*> llvmVars;
 
+        //! The memory argument of the current function, null if the memory is addressed by the values themselves.
+        llvm::Value* llvmMemory;
+
         //! Create a LLVM function. `fname` represents the name of the LLVM function.
         void createFunction(const triton::ast::SharedAbstractNode& node, const char* fname);
 
+        //! Create a LLVM function `void fname(i64* inputs, i64* outputs)`, or `void fname(i64* inputs, i64* outputs, i8* memory)` if `memory` is true. The symbolic variables `vars` are loaded from `inputs` in the same order.
+        void createFunction(const std::vector<triton::ast::SharedAbstractNode>& vars, const char* fname, bool memory);
+
+        //! Returns the pointer to the byte at `address`.
+        llvm::Value* getMemoryPointer(llvm::Value* address);
+
         //! Converts Triton AST to LLVM IR.
         llvm::Value* do_convert(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::ast::SharedAbstractNode, llvm::Value*>* results);
 
@@ -68,6 +82,15 @@ namespace triton {
 
         //! Lifts a symbolic expression and all its references to LLVM format. `fname` represents the name of the LLVM function.
         TRITON_EXPORT std::shared_ptr<llvm::Module> convert(const triton::ast::SharedAbstractNode& node, const char* fname="__triton", bool optimize=false);
+
+        //! Lifts several ASTs as one function `void fname(i64* inputs, i64* outputs)` storing the value of `nodes[i]` into `outputs[i]`. The symbolic variables used must be in `vars`, and are read from `inputs`. ASTs and variables are up to 64 bits. If `memory` is true, the function takes a third argument `i8* memory` and the memory accesses are offsets from it.
+        TRITON_EXPORT std::shared_ptr<llvm::Module> convert(const std::vector<triton::ast::SharedAbstractNode>& nodes, const std::vector<triton::ast::SharedAbstractNode>& vars, const char* fname="__triton", bool optimize=false, bool memory=false);
+
+        //! Applies the LLVM optimizations (-O3 -Oz) on the whole module, e.g. once after a batch of `convert()`.
+        TRITON_EXPORT void optimizeModule(void);
+
+        //! Returns the module holding the lifted functions.
+        TRITON_EXPORT std::shared_ptr<llvm::Module> getModule(void) const;
     };
 
   /*! @} End of ast namespace */
@@ -45,6 +45,33 @@ namespace triton {
         //! The convert internal process
         z3::expr do_convert(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::ast::SharedAbstractNode, z3::expr>* output);
 
+        //! A conversion kept between the calls of `convert()`.
+        struct Translation {
+          //! The converted node, which tells if it is still alive.
+          triton::ast::WeakAbstractNode node;
+
+          //! The hash of the node when converted.
+          triton::uint512 hash;
+
+          //! The z3's expression.
+          z3::expr expr;
+        };
+
+        //! The conversions of the nodes, kept between the calls of `convert()` when not evaluating <node : translation>.
+        std::unordered_map<const triton::ast::AbstractNode*, Translation> translations;
+
+        //! The nodes of the kept conversions <z3's ast id : node>.
+        std::unordered_map<unsigned, const triton::ast::AbstractNode*> origins;
+
+        //! Removes a kept conversion.
+        std::unordered_map<const triton::ast::AbstractNode*, Translation>::iterator forget(std::unordered_map<const triton::ast::AbstractNode*, Translation>::iterator it);
+
+        //! The number of kept conversions after the last removal of the dead nodes.
+        triton::usize sweepSize;
+
+        //! Removes the conversions of the dead nodes, once the number of kept conversions doubled.
+        void sweep(void);
+
       protected:
         //! The z3's context.
         z3::context context;
@@ -62,8 +89,17 @@ namespace triton {
         //! Destructor.
         TRITON_EXPORT ~TritonToZ3();
 
-        //! Converts to Z3's AST
+        //! Converts to Z3's AST. Without evaluation, the nodes converted by a previous call are not converted again, as long as they are alive.
         TRITON_EXPORT z3::expr convert(const triton::ast::SharedAbstractNode& node);
+
+        //! Returns the alive node whose kept conversion is `expr`, nullptr if there is none.
+        TRITON_EXPORT triton::ast::SharedAbstractNode getOrigin(const z3::expr& expr) const;
+
+        //! Returns the number of kept conversions.
+        TRITON_EXPORT triton::usize getTranslationsSize(void) const;
+
+        //! Returns the z3's context of the converted expressions.
+        TRITON_EXPORT z3::context& getContext(void);
     };
 
   /*! @} End of ast namespace */
@@ -0,0 +1,149 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_UNDOJOURNAL_H
+#define TRITON_UNDOJOURNAL_H
+
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      /*! \class UndoJournal
+       *  \brief A ring buffer of the state deltas of the last processed instructions.
+       *
+       *  \details Each record holds the previous concrete values and symbolic assignments of the
+       *  registers and memory cells written by one instruction. Once the journal is full, the oldest
+       *  record is overwritten. Records keep the capacity of their vectors when they are reused.
+       */
+      class UndoJournal {
+        public:
+          //! The previous state of a parent register.
+          struct RegisterDelta {
+            //! The register id.
+            triton::arch::register_e id;
+
+            //! The index of the previous concrete value in the bytes of the record.
+            triton::uint32 data;
+
+            //! The previous symbolic expression assigned to the register.
+            SharedSymbolicExpression expr;
+          };
+
+          //! The previous state of a memory cell.
+          struct MemoryDelta {
+            //! The address of the cell.
+            triton::uint64 address;
+
+            //! The previous symbolic expression assigned to the cell.
+            SharedSymbolicExpression expr;
+
+            //! The previous concrete value of the cell.
+            triton::uint8 value;
+
+            //! True if the cell had a concrete value.
+            bool defined;
+          };
+
+          //! The deltas of one instruction.
+          struct Record {
+            //! The registers written, in order of writing.
+            std::vector<RegisterDelta> registers;
+
+            //! The memory cells written, in order of writing.
+            std::vector<MemoryDelta> memory;
+
+            //! The previous concrete values of the registers written.
+            std::vector<triton::uint8> bytes;
+
+            //! The previous memory array expression, valid if `memoryArrayChanged` is true.
+            SharedSymbolicExpression memoryArray;
+
+            //! True if the instruction replaced the memory array expression.
+            bool memoryArrayChanged;
+
+            //! The number of path constraints before the instruction.
+            triton::usize pathConstraints;
+
+            //! Clears the record.
+            TRITON_EXPORT void clear(void);
+          };
+
+        private:
+          //! The records, used as a ring buffer.
+          std::vector<Record> records;
+
+          //! The index of the next record to open.
+          triton::usize head;
+
+          //! The number of records available.
+          triton::usize size;
+
+          //! The record being filled, nullptr if none is open.
+          Record* current;
+
+        public:
+          //! Constructor. `capacity` is the maximum number of instructions kept.
+          TRITON_EXPORT UndoJournal(triton::usize capacity);
+
+          //! Returns the maximum number of instructions kept.
+          TRITON_EXPORT triton::usize getCapacity(void) const;
+
+          //! Returns the number of instructions that can be undone.
+          TRITON_EXPORT triton::usize getSize(void) const;
+
+          //! Opens a new record, overwriting the oldest one if the journal is full.
+          TRITON_EXPORT Record& openRecord(void);
+
+          //! Closes the current record.
+          TRITON_EXPORT void closeRecord(void);
+
+          //! Returns the record being filled, nullptr if none is open.
+          TRITON_EXPORT Record* getCurrentRecord(void) const;
+
+          //! Returns the last record and removes it from the journal. The record stays valid until the next call to `openRecord`.
+          TRITON_EXPORT Record& popRecord(void);
+
+          //! Removes all records.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_UNDOJOURNAL_H */
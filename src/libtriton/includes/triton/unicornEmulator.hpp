@@ -0,0 +1,219 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_UNICORNEMULATOR_HPP
+#define TRITON_UNICORNEMULATOR_HPP
+
+#include <exception>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/context.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/memoryAccess.hpp>
+#include <triton/register.hpp>
+#include <triton/tritonTypes.hpp>
+#include <triton/x86Specifications.hpp>
+
+//! The Unicorn's engine, see <unicorn/unicorn.h>.
+struct uc_struct;
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Emulation namespace
+    namespace emulation {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup emulation
+     *  @{
+     */
+
+      /*! \class UnicornEmulator
+       *  \brief Runs the concrete execution of a Context in Unicorn, and only the instructions touching its symbolic or tainted state in Triton.
+       *
+       *  \details Unicorn executes every instruction at full speed. An instruction goes through the
+       *  semantics of the Context, once executed by Unicorn, only if it reads or writes a symbolized or
+       *  tainted register, or reads a symbolized or tainted byte of memory. The registers it reads are
+       *  then given back their values from before its execution, and the bytes of memory are fetched
+       *  from Unicorn when the Context reads them for the first time. The other instructions only update
+       *  the bytes of memory the Context already defines, and concretize and untaint what they overwrite,
+       *  so that the concrete state of the Context stays the one of Unicorn where it matters.
+       *
+       *  Only the x86-64 architecture is supported. The synchronized registers are the general purpose
+       *  ones, the flags, the `fs` and `gs` bases and the SSE registers; an instruction going through the
+       *  semantics while reading another register throws an exception.
+       */
+      class UnicornEmulator {
+        private:
+          //! A register synchronized between Unicorn and the Context.
+          struct SyncRegister {
+            //! The register of the Context.
+            const triton::arch::Register* reg;
+
+            //! The register of Unicorn.
+            int ucReg;
+          };
+
+          //! The registers read and written by the instruction at an address.
+          struct InstructionRegisters {
+            //! The opcode of the instruction.
+            std::vector<triton::uint8> opcode;
+
+            //! The registers read, as indexes into `syncRegisters`.
+            std::vector<triton::uint32> reads;
+
+            //! The registers written.
+            std::vector<triton::arch::register_e> writes;
+
+            //! True if it reads a register which is not synchronized.
+            bool unsupported;
+          };
+
+          //! A write of the instruction being executed, with the bytes it overwrites.
+          struct PendingWrite {
+            //! The address written.
+            triton::uint64 addr;
+
+            //! The bytes before the write.
+            std::vector<triton::uint8> previous;
+          };
+
+          //! The Context synchronized.
+          triton::Context& ctx;
+
+          //! The specifications used to convert the capstone's register ids.
+          triton::arch::x86::x86Specifications specs;
+
+          //! The Unicorn's engine.
+          uc_struct* uc;
+
+          //! The capstone's handle used to get the registers accessed by the instructions.
+          triton::usize handle;
+
+          //! The hooks of Unicorn.
+          std::vector<triton::usize> hooks;
+
+          //! The synchronized registers.
+          std::vector<SyncRegister> syncRegisters;
+
+          //! The index into `syncRegisters` of a parent register, -1 if not synchronized (indexed by register id).
+          std::vector<triton::sint32> syncIndex;
+
+          //! The registers accessed by the instructions <address : registers>.
+          std::unordered_map<triton::uint64, InstructionRegisters> instructions;
+
+          //! The address of the instruction being executed.
+          triton::uint64 current;
+
+          //! True if an instruction is being executed.
+          bool executing;
+
+          //! True if the instruction being executed goes through the semantics.
+          bool touched;
+
+          //! The registers accessed by the instruction being executed.
+          const InstructionRegisters* currentRegisters;
+
+          //! The values of the registers read by the instruction being executed, from before it.
+          std::vector<triton::uint512> readValues;
+
+          //! The writes of the instruction being executed.
+          std::vector<PendingWrite> writes;
+
+          //! The number of instructions executed.
+          triton::usize executed;
+
+          //! The number of instructions which went through the semantics.
+          triton::usize processed;
+
+          //! The exception raised in a hook, rethrown once Unicorn stopped.
+          std::exception_ptr error;
+
+          //! The callback fetching the bytes of memory undefined in the Context.
+          triton::callbacks::getConcreteMemoryValueCallback fetchCallback;
+
+          //! Initializes the synchronized registers.
+          void initRegisters(void);
+
+          //! Returns the registers accessed by the instruction at `addr`.
+          const InstructionRegisters& getInstructionRegisters(triton::uint64 addr, triton::uint32 size);
+
+          //! Returns true if the register is symbolized or tainted.
+          bool isTouched(triton::arch::register_e id) const;
+
+          //! Reads a register from Unicorn.
+          triton::uint512 readRegister(const SyncRegister& reg) const;
+
+          //! Writes a register into Unicorn.
+          void writeRegister(const SyncRegister& reg, const triton::uint512& value);
+
+          //! Fetches from Unicorn the bytes of `mem` undefined in the Context.
+          void fetchMemory(triton::Context& ctx, const triton::arch::MemoryAccess& mem);
+
+          //! Ends the instruction being executed.
+          void finish(void);
+
+          //! The hooks.
+          static void hookCode(uc_struct* uc, triton::uint64 addr, triton::uint32 size, void* user);
+          static void hookMemory(uc_struct* uc, int type, triton::uint64 addr, int size, triton::sint64 value, void* user);
+
+        public:
+          //! Constructor. The Context must be of the x86-64 architecture and outlive the emulator.
+          TRITON_EXPORT UnicornEmulator(triton::Context& ctx);
+
+          //! Destructor.
+          TRITON_EXPORT ~UnicornEmulator();
+
+          UnicornEmulator(const UnicornEmulator& other) = delete;
+          UnicornEmulator& operator=(const UnicornEmulator& other) = delete;
+
+          //! Maps `size` bytes of memory from `addr` in Unicorn, rounded to its pages.
+          TRITON_EXPORT void mapMemory(triton::uint64 addr, triton::usize size);
+
+          //! Writes bytes into the memory of Unicorn, and into the bytes of the Context it already defines.
+          TRITON_EXPORT void setMemoryAreaValue(triton::uint64 addr, const std::vector<triton::uint8>& values);
+
+          //! Copies the defined bytes of memory of the Context in `[addr, addr + size)` and the synchronized registers into Unicorn. The memory must be mapped.
+          TRITON_EXPORT void synchronizeToUnicorn(triton::uint64 addr, triton::usize size);
+
+          //! Copies the synchronized registers of Unicorn into the Context, without concretizing them.
+          TRITON_EXPORT void synchronizeToContext(void);
+
+          //! Executes from `start` until `stop` is reached, or `count` instructions if not 0. Returns the number of instructions executed.
+          TRITON_EXPORT triton::usize run(triton::uint64 start, triton::uint64 stop, triton::usize count=0);
+
+          //! Returns the number of instructions executed by the last run.
+          TRITON_EXPORT triton::usize getExecutedCount(void) const;
+
+          //! Returns the number of instructions of the last run which went through the semantics.
+          TRITON_EXPORT triton::usize getProcessedCount(void) const;
+      };
+
+    /*! @} End of emulation namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_UNICORNEMULATOR_HPP */
@@ -0,0 +1,302 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_WIDEARITHMETIC_HPP
+#define TRITON_WIDEARITHMETIC_HPP
+
+#include <cstring>
+
+#include <triton/config.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+  #include <intrin.h>
+#endif
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    /*! \class FixedUint
+     *  \brief An unsigned integer of `N` limbs of 64 bits, the least significant first.
+     *
+     *  \details The kernels below work on the limbs of the width of a bitvector, 2 limbs up to 128 bits,
+     *  4 up to 256 and 8 up to 512, with the carries of the compiler intrinsics, where the `uint512`
+     *  arithmetic always spans 512 bits.
+     */
+    template <triton::uint32 N>
+    struct FixedUint {
+      //! The limbs.
+      triton::uint64 limbs[N];
+    };
+
+
+    //! Returns `a + b + carry` and sets the carry out.
+    inline triton::uint64 addCarry(triton::uint64 a, triton::uint64 b, triton::uint8& carry) {
+      #if defined(__SIZEOF_INT128__)
+      __extension__ unsigned __int128 sum = static_cast<unsigned __int128>(a) + b + carry;
+      carry = static_cast<triton::uint8>(sum >> 64);
+      return static_cast<triton::uint64>(sum);
+      #elif defined(_MSC_VER) && defined(_M_X64)
+      unsigned long long sum = 0;
+      carry = _addcarry_u64(carry, a, b, &sum);
+      return sum;
+      #else
+      triton::uint64 sum = a + b;
+      triton::uint8 out = (sum < a);
+      triton::uint64 ret = sum + carry;
+      carry = out | (ret < sum);
+      return ret;
+      #endif
+    }
+
+
+    //! Returns `a - b - borrow` and sets the borrow out.
+    inline triton::uint64 subBorrow(triton::uint64 a, triton::uint64 b, triton::uint8& borrow) {
+      #if defined(_MSC_VER) && defined(_M_X64)
+      unsigned long long diff = 0;
+      borrow = _subborrow_u64(borrow, a, b, &diff);
+      return diff;
+      #else
+      triton::uint64 diff = a - b;
+      triton::uint8 out = (a < b);
+      triton::uint64 ret = diff - borrow;
+      borrow = out | (diff < borrow);
+      return ret;
+      #endif
+    }
+
+
+    //! Returns the low half of `a * b` and sets `high` to the high half.
+    inline triton::uint64 mulWide(triton::uint64 a, triton::uint64 b, triton::uint64& high) {
+      #if defined(__SIZEOF_INT128__)
+      __extension__ unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+      high = static_cast<triton::uint64>(product >> 64);
+      return static_cast<triton::uint64>(product);
+      #elif defined(_MSC_VER) && defined(_M_X64)
+      return _umul128(a, b, &high);
+      #else
+      triton::uint64 a0 = a & 0xffffffff, a1 = a >> 32;
+      triton::uint64 b0 = b & 0xffffffff, b1 = b >> 32;
+      triton::uint64 p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+      triton::uint64 middle = (p00 >> 32) + (p01 & 0xffffffff) + (p10 & 0xffffffff);
+      high = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+      return (middle << 32) | (p00 & 0xffffffff);
+      #endif
+    }
+
+
+    //! Loads the `N` low limbs of a `uint512`.
+    template <triton::uint32 N>
+    inline void fixedLoad(FixedUint<N>& r, const triton::uint512& value) {
+      #ifdef TRITON_BOOST_INTERFACE
+      triton::uint64 chunks[8] = {0};
+      boost::multiprecision::export_bits(value, chunks, 64, false);
+      for (triton::uint32 i = 0; i < N; i++)
+        r.limbs[i] = chunks[i];
+      #else
+      const auto& rep = value.crepresentation();
+      static_assert(sizeof(rep[0]) == 4, "fixedLoad() expects the limbs of 32 bits of uint512");
+      #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+      std::memcpy(r.limbs, rep.data(), sizeof(r.limbs));
+      #else
+      for (triton::uint32 i = 0; i < N; i++)
+        r.limbs[i] = static_cast<triton::uint64>(rep[2 * i]) | (static_cast<triton::uint64>(rep[2 * i + 1]) << 32);
+      #endif
+      #endif
+    }
+
+
+    //! Returns the limbs as a `uint512`.
+    template <triton::uint32 N>
+    inline triton::uint512 fixedStore(const FixedUint<N>& a) {
+      triton::uint512 value = 0;
+      #ifdef TRITON_BOOST_INTERFACE
+      boost::multiprecision::import_bits(value, a.limbs, a.limbs + N, 64, false);
+      #else
+      auto& rep = value.representation();
+      #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+      std::memcpy(rep.data(), a.limbs, sizeof(a.limbs));
+      #else
+      for (triton::uint32 i = 0; i < N; i++) {
+        rep[2 * i]     = static_cast<triton::uint32>(a.limbs[i]);
+        rep[2 * i + 1] = static_cast<triton::uint32>(a.limbs[i] >> 32);
+      }
+      #endif
+      #endif
+      return value;
+    }
+
+
+    //! Clears the bits from `size`.
+    template <triton::uint32 N>
+    inline void fixedMask(FixedUint<N>& r, triton::uint32 size) {
+      for (triton::uint32 i = 0; i < N; i++) {
+        if (size <= i * 64)
+          r.limbs[i] = 0;
+        else if (size < (i + 1) * 64)
+          r.limbs[i] &= ((static_cast<triton::uint64>(1) << (size - i * 64)) - 1);
+      }
+    }
+
+
+    //! Returns the bit `index`.
+    template <triton::uint32 N>
+    inline bool fixedBit(const FixedUint<N>& a, triton::uint32 index) {
+      return ((a.limbs[index / 64] >> (index % 64)) & 1) != 0;
+    }
+
+
+    //! r = a + b, modulo 2^(64N).
+    template <triton::uint32 N>
+    inline void fixedAdd(FixedUint<N>& r, const FixedUint<N>& a, const FixedUint<N>& b) {
+      triton::uint8 carry = 0;
+      for (triton::uint32 i = 0; i < N; i++)
+        r.limbs[i] = addCarry(a.limbs[i], b.limbs[i], carry);
+    }
+
+
+    //! r = a - b, modulo 2^(64N).
+    template <triton::uint32 N>
+    inline void fixedSub(FixedUint<N>& r, const FixedUint<N>& a, const FixedUint<N>& b) {
+      triton::uint8 borrow = 0;
+      for (triton::uint32 i = 0; i < N; i++)
+        r.limbs[i] = subBorrow(a.limbs[i], b.limbs[i], borrow);
+    }
+
+
+    //! r = a * b, modulo 2^(64N). Only the products of the low half are computed.
+    template <triton::uint32 N>
+    inline void fixedMul(FixedUint<N>& r, const FixedUint<N>& a, const FixedUint<N>& b) {
+      FixedUint<N> t = {};
+
+      for (triton::uint32 i = 0; i < N; i++) {
+        triton::uint64 carry = 0;
+        if (a.limbs[i] == 0)
+          continue;
+        for (triton::uint32 j = 0; i + j < N; j++) {
+          triton::uint64 high = 0;
+          triton::uint64 low  = mulWide(a.limbs[i], b.limbs[j], high);
+          triton::uint8  c    = 0;
+          low  = addCarry(low, t.limbs[i + j], c);
+          high += c;
+          c = 0;
+          t.limbs[i + j] = addCarry(low, carry, c);
+          carry = high + c;
+        }
+      }
+
+      r = t;
+    }
+
+
+    //! r = a << shift, modulo 2^(64N).
+    template <triton::uint32 N>
+    inline void fixedShl(FixedUint<N>& r, const FixedUint<N>& a, triton::uint32 shift) {
+      triton::uint32 limbs = shift / 64;
+      triton::uint32 bits  = shift % 64;
+      FixedUint<N> t = {};
+
+      for (triton::uint32 i = N; i-- > limbs;) {
+        t.limbs[i] = a.limbs[i - limbs] << bits;
+        if (bits && i > limbs)
+          t.limbs[i] |= a.limbs[i - limbs - 1] >> (64 - bits);
+      }
+
+      r = t;
+    }
+
+
+    //! r = a >> shift.
+    template <triton::uint32 N>
+    inline void fixedLshr(FixedUint<N>& r, const FixedUint<N>& a, triton::uint32 shift) {
+      triton::uint32 limbs = shift / 64;
+      triton::uint32 bits  = shift % 64;
+      FixedUint<N> t = {};
+
+      for (triton::uint32 i = 0; i + limbs < N; i++) {
+        t.limbs[i] = a.limbs[i + limbs] >> bits;
+        if (bits && i + limbs + 1 < N)
+          t.limbs[i] |= a.limbs[i + limbs + 1] << (64 - bits);
+      }
+
+      r = t;
+    }
+
+
+    //! r = a | b.
+    template <triton::uint32 N>
+    inline void fixedOr(FixedUint<N>& r, const FixedUint<N>& a, const FixedUint<N>& b) {
+      for (triton::uint32 i = 0; i < N; i++)
+        r.limbs[i] = a.limbs[i] | b.limbs[i];
+    }
+
+
+    //! Returns true if a < b.
+    template <triton::uint32 N>
+    inline bool fixedUlt(const FixedUint<N>& a, const FixedUint<N>& b) {
+      for (triton::uint32 i = N; i-- > 0;) {
+        if (a.limbs[i] != b.limbs[i])
+          return a.limbs[i] < b.limbs[i];
+      }
+      return false;
+    }
+
+
+    //! Returns (a + b) mod 2^size, for a size of up to 512 bits.
+    TRITON_EXPORT triton::uint512 wideAdd(const triton::uint512& a, const triton::uint512& b, triton::uint32 size);
+
+    //! Returns (a - b) mod 2^size.
+    TRITON_EXPORT triton::uint512 wideSub(const triton::uint512& a, const triton::uint512& b, triton::uint32 size);
+
+    //! Returns (a * b) mod 2^size.
+    TRITON_EXPORT triton::uint512 wideMul(const triton::uint512& a, const triton::uint512& b, triton::uint32 size);
+
+    //! Returns (a << shift) mod 2^size, 0 if `shift` is `size` or more.
+    TRITON_EXPORT triton::uint512 wideShl(const triton::uint512& a, const triton::uint512& shift, triton::uint32 size);
+
+    //! Returns a >> shift, 0 if `shift` is `size` or more.
+    TRITON_EXPORT triton::uint512 wideLshr(const triton::uint512& a, const triton::uint512& shift, triton::uint32 size);
+
+    //! Returns a >> shift filled with the sign bit of `size` bits.
+    TRITON_EXPORT triton::uint512 wideAshr(const triton::uint512& a, const triton::uint512& shift, triton::uint32 size);
+
+    //! Returns `a` of `size` bits rotated left by `rot`, lower than `size`.
+    TRITON_EXPORT triton::uint512 wideRol(const triton::uint512& a, triton::uint32 rot, triton::uint32 size);
+
+    //! Returns `a` of `size` bits rotated right by `rot`, lower than `size`.
+    TRITON_EXPORT triton::uint512 wideRor(const triton::uint512& a, triton::uint32 rot, triton::uint32 size);
+
+    //! Returns true if a < b, unsigned.
+    TRITON_EXPORT bool wideUlt(const triton::uint512& a, const triton::uint512& b, triton::uint32 size);
+
+    //! Returns true if a < b, both being signed values of `size` bits.
+    TRITON_EXPORT bool wideSlt(const triton::uint512& a, const triton::uint512& b, triton::uint32 size);
+
+    //! Returns the bits `high` to `low` of `a`.
+    TRITON_EXPORT triton::uint512 wideExtract(const triton::uint512& a, triton::uint32 high, triton::uint32 low);
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_WIDEARITHMETIC_HPP */
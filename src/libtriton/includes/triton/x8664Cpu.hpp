@@ -15,11 +15,14 @@
 
 #include <triton/archEnums.hpp>
 #include <triton/callbacks.hpp>
+#include <triton/concreteMemory.hpp>
 #include <triton/cpuInterface.hpp>
+#include <triton/decodeCache.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/register.hpp>
+#include <triton/registerFile.hpp>
 #include <triton/tritonTypes.hpp>
 #include <triton/x86Specifications.hpp>
 
@@ -69,211 +72,23 @@ namespace triton {
           void disassInit(void);
 
         protected:
-          /*! \brief map of address -> concrete value
-           *
-           * \details
-           *
-           * **item1**: memory address<br>
-           * **item2**: concrete value
-           */
-          std::unordered_map<triton::uint64, triton::uint8, IdentityHash<triton::uint64>> memory;
-
-          //! Concrete value of rax
-          triton::uint8 rax[triton::size::qword];
-          //! Concrete value of rbx
-          triton::uint8 rbx[triton::size::qword];
-          //! Concrete value of rcx
-          triton::uint8 rcx[triton::size::qword];
-          //! Concrete value of rdx
-          triton::uint8 rdx[triton::size::qword];
-          //! Concrete value of rdi
-          triton::uint8 rdi[triton::size::qword];
-          //! Concrete value of rsi
-          triton::uint8 rsi[triton::size::qword];
-          //! Concrete value of rbp
-          triton::uint8 rbp[triton::size::qword];
-          //! Concrete value of rsp
-          triton::uint8 rsp[triton::size::qword];
-          //! Concrete value of rip
-          triton::uint8 rip[triton::size::qword];
-          //! Concrete value of r8
-          triton::uint8 r8[triton::size::qword];
-          //! Concrete value of r9
-          triton::uint8 r9[triton::size::qword];
-          //! Concrete value of r10
-          triton::uint8 r10[triton::size::qword];
-          //! Concrete value of r11
-          triton::uint8 r11[triton::size::qword];
-          //! Concrete value of r12
-          triton::uint8 r12[triton::size::qword];
-          //! Concrete value of r13
-          triton::uint8 r13[triton::size::qword];
-          //! Concrete value of r14
-          triton::uint8 r14[triton::size::qword];
-          //! Concrete value of r15
-          triton::uint8 r15[triton::size::qword];
-          //! Concrete value of eflags
-          triton::uint8 eflags[triton::size::qword];
-          //! Concrete value of st0
-          triton::uint8 st0[triton::size::fword];
-          //! Concrete value of st1
-          triton::uint8 st1[triton::size::fword];
-          //! Concrete value of st2
-          triton::uint8 st2[triton::size::fword];
-          //! Concrete value of st3
-          triton::uint8 st3[triton::size::fword];
-          //! Concrete value of st4
-          triton::uint8 st4[triton::size::fword];
-          //! Concrete value of st5
-          triton::uint8 st5[triton::size::fword];
-          //! Concrete value of st6
-          triton::uint8 st6[triton::size::fword];
-          //! Concrete value of st7
-          triton::uint8 st7[triton::size::fword];
-          //! Concrete value of zmm0
-          triton::uint8 zmm0[triton::size::dqqword];
-          //! Concrete value of zmm1
-          triton::uint8 zmm1[triton::size::dqqword];
-          //! Concrete value of zmm2
-          triton::uint8 zmm2[triton::size::dqqword];
-          //! Concrete value of zmm3
-          triton::uint8 zmm3[triton::size::dqqword];
-          //! Concrete value of zmm4
-          triton::uint8 zmm4[triton::size::dqqword];
-          //! Concrete value of zmm5
-          triton::uint8 zmm5[triton::size::dqqword];
-          //! Concrete value of zmm6
-          triton::uint8 zmm6[triton::size::dqqword];
-          //! Concrete value of zmm7
-          triton::uint8 zmm7[triton::size::dqqword];
-          //! Concrete value of zmm8
-          triton::uint8 zmm8[triton::size::dqqword];
-          //! Concrete value of zmm9
-          triton::uint8 zmm9[triton::size::dqqword];
-          //! Concrete value of zmm10
-          triton::uint8 zmm10[triton::size::dqqword];
-          //! Concrete value of zmm11
-          triton::uint8 zmm11[triton::size::dqqword];
-          //! Concrete value of zmm12
-          triton::uint8 zmm12[triton::size::dqqword];
-          //! Concrete value of zmm13
-          triton::uint8 zmm13[triton::size::dqqword];
-          //! Concrete value of zmm14
-          triton::uint8 zmm14[triton::size::dqqword];
-          //! Concrete value of zmm15
-          triton::uint8 zmm15[triton::size::dqqword];
-          //! Concrete value of zmm16
-          triton::uint8 zmm16[triton::size::dqqword];
-          //! Concrete value of zmm17
-          triton::uint8 zmm17[triton::size::dqqword];
-          //! Concrete value of zmm18
-          triton::uint8 zmm18[triton::size::dqqword];
-          //! Concrete value of zmm19
-          triton::uint8 zmm19[triton::size::dqqword];
-          //! Concrete value of zmm20
-          triton::uint8 zmm20[triton::size::dqqword];
-          //! Concrete value of zmm21
-          triton::uint8 zmm21[triton::size::dqqword];
-          //! Concrete value of zmm22
-          triton::uint8 zmm22[triton::size::dqqword];
-          //! Concrete value of zmm23
-          triton::uint8 zmm23[triton::size::dqqword];
-          //! Concrete value of zmm24
-          triton::uint8 zmm24[triton::size::dqqword];
-          //! Concrete value of zmm25
-          triton::uint8 zmm25[triton::size::dqqword];
-          //! Concrete value of zmm26
-          triton::uint8 zmm26[triton::size::dqqword];
-          //! Concrete value of zmm27
-          triton::uint8 zmm27[triton::size::dqqword];
-          //! Concrete value of zmm28
-          triton::uint8 zmm28[triton::size::dqqword];
-          //! Concrete value of zmm29
-          triton::uint8 zmm29[triton::size::dqqword];
-          //! Concrete value of zmm30
-          triton::uint8 zmm30[triton::size::dqqword];
-          //! Concrete value of zmm31
-          triton::uint8 zmm31[triton::size::dqqword];
-          //! Concrete value of cr0
-          triton::uint8 cr0[triton::size::qword];
-          //! Concrete value of cr1
-          triton::uint8 cr1[triton::size::qword];
-          //! Concrete value of cr2
-          triton::uint8 cr2[triton::size::qword];
-          //! Concrete value of cr3
-          triton::uint8 cr3[triton::size::qword];
-          //! Concrete value of cr4
-          triton::uint8 cr4[triton::size::qword];
-          //! Concrete value of cr5
-          triton::uint8 cr5[triton::size::qword];
-          //! Concrete value of cr6
-          triton::uint8 cr6[triton::size::qword];
-          //! Concrete value of cr7
-          triton::uint8 cr7[triton::size::qword];
-          //! Concrete value of cr8
-          triton::uint8 cr8[triton::size::qword];
-          //! Concrete value of cr9
-          triton::uint8 cr9[triton::size::qword];
-          //! Concrete value of cr10
-          triton::uint8 cr10[triton::size::qword];
-          //! Concrete value of cr11
-          triton::uint8 cr11[triton::size::qword];
-          //! Concrete value of cr12
-          triton::uint8 cr12[triton::size::qword];
-          //! Concrete value of cr13
-          triton::uint8 cr13[triton::size::qword];
-          //! Concrete value of cr14
-          triton::uint8 cr14[triton::size::qword];
-          //! Concrete value of cr15
-          triton::uint8 cr15[triton::size::qword];
-          //! Concrete value of CS
-          triton::uint8 cs[triton::size::qword];
-          //! Concrete value of DS
-          triton::uint8 ds[triton::size::qword];
-          //! Concrete value of ES
-          triton::uint8 es[triton::size::qword];
-          //! Concrete value of FS
-          triton::uint8 fs[triton::size::qword];
-          //! Concrete value of GS
-          triton::uint8 gs[triton::size::qword];
-          //! Concrete value of SS
-          triton::uint8 ss[triton::size::qword];
-          //! Concrete value of dr0
-          triton::uint8 dr0[triton::size::qword];
-          //! Condete value of dr1
-          triton::uint8 dr1[triton::size::qword];
-          //! Condete value of dr2
-          triton::uint8 dr2[triton::size::qword];
-          //! Condete value of dr3
-          triton::uint8 dr3[triton::size::qword];
-          //! Condete value of dr6
-          triton::uint8 dr6[triton::size::qword];
-          //! Condete value of dr7
-          triton::uint8 dr7[triton::size::qword];
-          //! Concrete value of the x87 FPU Control Word
-          triton::uint8 fcw[triton::size::word];
-          //! Concrete value of the x87 FPU Status Word
-          triton::uint8 fsw[triton::size::word];
-          //! Concrete value of the x87 FPU Tag Word
-          triton::uint8 ftw[triton::size::word];
-          //! Concrete value of the x87 FPU Opcode
-          triton::uint8 fop[triton::size::word];
-          //! Concrete value of the x87 FPU Instruction Pointer Offset
-          triton::uint8 fip[triton::size::qword];
-          //! Concrete value of the x87 FPU Instruction Pointer Selector
-          triton::uint8 fcs[triton::size::word];
-          //! Concrete value of the x87 FPU Instruction Operand Pointer Offset
-          triton::uint8 fdp[triton::size::qword];
-          //! Concrete value of the x87 FPU Instruction Operand Pointer Selector
-          triton::uint8 fds[triton::size::word];
-          //! Concrete value of the EFER MSR Register
-          triton::uint8 efer[triton::size::qword];
-          //! Concrete value of the SSE Register State
-          triton::uint8 mxcsr[triton::size::dword];
-          //! Concrete value of the SSE Register State Mask
-          triton::uint8 mxcsr_mask[triton::size::dword];
-          //! Concrete value of the TSC Register
-          triton::uint8 tsc[triton::size::qword];
+          //! The concrete memory state (paged).
+          triton::arch::ConcreteMemory memory;
+
+          //! The layout of the concrete register file.
+          static constexpr triton::arch::RegisterFileLayout layout = triton::arch::x86::registerFileLayout(true);
+
+          //! The concrete register file. Registers are located in it by `layout`.
+          triton::uint8 registerFile[layout.getSize()];
+
+          //! The cache of disassembled instructions.
+          triton::arch::DecodeCache decodeCache;
+
+          //! Returns true if `reg` has a storage and no callback of `kind` to call.
+          TRITON_EXPORT bool isDirectConcreteRegister(const triton::arch::Register& reg, triton::callbacks::callback_e kind, bool execCallbacks) const;
+
+          //! Returns the concrete register file, to write the direct registers into.
+          TRITON_EXPORT triton::uint8* getWritableConcreteRegisterFile(void);
 
         public:
           //! Constructor.
@@ -331,7 +146,11 @@ namespace triton {
           TRITON_EXPORT bool isThumb(void) const;
           TRITON_EXPORT bool isMemoryExclusive(const triton::arch::MemoryAccess& mem) const;
           TRITON_EXPORT const std::unordered_map<triton::arch::register_e, const triton::arch::Register>& getAllRegisters(void) const;
-          TRITON_EXPORT const std::unordered_map<triton::uint64, triton::uint8, IdentityHash<triton::uint64>>& getConcreteMemory(void) const;
+          TRITON_EXPORT const triton::arch::ConcreteMemory& getConcreteMemory(void) const;
+          TRITON_EXPORT const triton::arch::RegisterSlot& getConcreteRegisterSlot(triton::arch::register_e id) const;
+          TRITON_EXPORT const triton::uint8* getConcreteRegisterFile(void) const;
+          TRITON_EXPORT triton::usize getConcreteRegisterFileSize(void) const;
+          TRITON_EXPORT triton::arch::DecodeCache& getDecodeCache(void);
           TRITON_EXPORT const triton::arch::Register& getParentRegister(const triton::arch::Register& reg) const;
           TRITON_EXPORT const triton::arch::Register& getParentRegister(triton::arch::register_e id) const;
           TRITON_EXPORT const triton::arch::Register& getProgramCounter(void) const;
@@ -340,6 +159,7 @@ namespace triton {
           TRITON_EXPORT const triton::arch::Register& getStackPointer(void) const;
           TRITON_EXPORT std::set<const triton::arch::Register*> getParentRegisters(void) const;
           TRITON_EXPORT std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
+          TRITON_EXPORT void readConcreteMemory(triton::uint64 baseAddr, void* area, triton::usize size, bool execCallbacks=true) const;
           TRITON_EXPORT triton::arch::endianness_e getEndianness(void) const;
           TRITON_EXPORT triton::uint32 gprBitSize(void) const;
           TRITON_EXPORT triton::uint32 gprSize(void) const;
@@ -349,11 +169,16 @@ namespace triton {
           TRITON_EXPORT triton::uint8 getConcreteMemoryValue(triton::uint64 addr, bool execCallbacks=true) const;
           TRITON_EXPORT void clear(void);
           TRITON_EXPORT void disassembly(triton::arch::Instruction& inst);
+          TRITON_EXPORT triton::arch::DecodeInfo decode(const triton::uint8* opcode, triton::uint32 size, triton::uint64 addr);
           TRITON_EXPORT void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values, bool execCallbacks=true);
           TRITON_EXPORT void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const void* area, triton::usize size, bool execCallbacks=true);
+          TRITON_EXPORT void mapConcreteMemoryArea(triton::uint64 baseAddr, const void* area, triton::usize size, const std::shared_ptr<const void>& owner);
+          TRITON_EXPORT void writeConcreteMemory(triton::uint64 baseAddr, const void* area, triton::usize size, bool execCallbacks=true);
           TRITON_EXPORT void setConcreteMemoryValue(const triton::arch::MemoryAccess& mem, const triton::uint512& value, bool execCallbacks=true);
           TRITON_EXPORT void setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value, bool execCallbacks=true);
           TRITON_EXPORT void setConcreteRegisterValue(const triton::arch::Register& reg, const triton::uint512& value, bool execCallbacks=true);
+          TRITON_EXPORT void setConcreteRegisterFile(const triton::uint8* file, triton::usize size);
+          TRITON_EXPORT void swapConcreteMemory(triton::arch::ConcreteMemory& memory);
           TRITON_EXPORT void setThumb(bool state);
           TRITON_EXPORT void setMemoryExclusiveTag(const triton::arch::MemoryAccess& mem, bool tag);
           TRITON_EXPORT bool isConcreteMemoryValueDefined(const triton::arch::MemoryAccess& mem) const;
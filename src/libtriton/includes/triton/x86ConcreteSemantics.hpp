@@ -0,0 +1,175 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_X86CONCRETESEMANTICS_H
+#define TRITON_X86CONCRETESEMANTICS_H
+
+#include <utility>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/architecture.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/memoryAccess.hpp>
+#include <triton/modes.hpp>
+#include <triton/operandWrapper.hpp>
+#include <triton/register.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/taintEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The x86 namespace
+    namespace x86 {
+    /*!
+     *  \ingroup arch
+     *  \addtogroup x86
+     *  @{
+     */
+
+      /*! \class x86ConcreteSemantics
+       *  \brief The native emulation of the common x86 instructions.
+       *
+       *  \details The ALU, load/store and branch instructions whose registers and memory cells are neither
+       *  symbolized nor tainted are executed on the concrete state only, without building their semantics.
+       *  The operands are checked before anything is written, so an instruction which does not qualify is left
+       *  untouched and goes through the x86 semantics. With ONLY_ON_TAINTED, whose untainted expressions are
+       *  dropped after the semantics anyway, the symbolized values are emulated as long as they are untainted.
+       *  The branches are only emulated when the path manager would drop their constraint: with PC_TRACKING_SYMBOLIC,
+       *  which keeps the symbolized constraints only, and with ONLY_ON_TAINTED, which keeps the tainted ones only.
+       */
+      class x86ConcreteSemantics {
+        private:
+          //! Architecture API
+          triton::arch::Architecture* architecture;
+
+          //! Symbolic Engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! Taint Engine API
+          triton::engines::taint::TaintEngine* taintEngine;
+
+          //! The Modes API
+          triton::modes::SharedModes modes;
+
+          //! The registers written by the instruction, as <register : value of its parent>.
+          std::vector<std::pair<triton::arch::Register, triton::uint64>> registers;
+
+          //! The memory cells written by the instruction, as <memory access : value>.
+          std::vector<std::pair<triton::arch::MemoryAccess, triton::uint64>> stores;
+
+          //! The flags defined as undefined by the instruction.
+          std::vector<triton::arch::Register> undefined;
+
+          //! Returns true if the register is a general purpose register, high bytes excepted.
+          bool isGpr(const triton::arch::Register& reg) const;
+
+          //! Returns true if the symbolized values can not be emulated, false if only the taint matters (ONLY_ON_TAINTED).
+          bool isSymbolic(void) const;
+
+          //! Returns true if the register is neither symbolized (see isSymbolic()) nor tainted.
+          bool isConcrete(const triton::arch::Register& reg);
+
+          //! Reads the value of an operand. Returns false if it is not concrete or not supported.
+          bool read(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op, triton::uint64& value);
+
+          //! Reads the value of a register. Returns false if it is not concrete.
+          bool readRegister(triton::arch::Instruction& inst, const triton::arch::Register& reg, triton::uint64& value);
+
+          //! Reads the value of a memory access whose address is defined. Returns false if it is not concrete.
+          bool readMemory(triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem, triton::uint64& value);
+
+          //! Reads the value of a flag. Returns false if it is not concrete.
+          bool readFlag(triton::arch::Instruction& inst, triton::arch::register_e id, bool& value);
+
+          //! Defines the address of a memory operand from concrete registers. Returns false if it depends on a symbolic one.
+          bool initAddress(triton::arch::Instruction& inst, triton::arch::MemoryAccess& mem);
+
+          //! Writes the value of an operand. Returns false if it is not supported.
+          bool write(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op, triton::uint64 value);
+
+          //! Writes the value of a register. Returns false if the bits it keeps from its parent are not concrete.
+          bool writeRegister(const triton::arch::Register& reg, triton::uint64 value);
+
+          //! Writes the value of a memory access whose address is defined.
+          void writeMemory(const triton::arch::MemoryAccess& mem, triton::uint64 value);
+
+          //! Writes the value of a flag.
+          void writeFlag(triton::arch::register_e id, bool value);
+
+          //! Writes the PF, SF and ZF flags of a result.
+          void writeResultFlags(triton::uint64 result, triton::uint32 bitSize);
+
+          //! Applies the writes of the instruction to the concrete state and drops the expressions they replace.
+          void commit(triton::arch::Instruction& inst);
+
+          //! The ADD, AND, CMP, OR, SUB, TEST and XOR instructions.
+          bool alu_s(triton::arch::Instruction& inst);
+
+          //! The CALL instruction.
+          bool call_s(triton::arch::Instruction& inst);
+
+          //! The conditional jump instructions.
+          bool jcc_s(triton::arch::Instruction& inst);
+
+          //! The JMP instruction.
+          bool jmp_s(triton::arch::Instruction& inst);
+
+          //! The LEA instruction.
+          bool lea_s(triton::arch::Instruction& inst);
+
+          //! The MOV, MOVSX, MOVSXD and MOVZX instructions.
+          bool mov_s(triton::arch::Instruction& inst);
+
+          //! The POP instruction.
+          bool pop_s(triton::arch::Instruction& inst);
+
+          //! The PUSH instruction.
+          bool push_s(triton::arch::Instruction& inst);
+
+          //! The RET instruction.
+          bool ret_s(triton::arch::Instruction& inst);
+
+          //! The DEC, INC, NEG and NOT instructions.
+          bool unary_s(triton::arch::Instruction& inst);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT x86ConcreteSemantics(triton::arch::Architecture* architecture,
+                                             triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                             triton::engines::taint::TaintEngine* taintEngine,
+                                             const triton::modes::SharedModes& modes);
+
+          //! Emulates the instruction on the concrete state. Returns false, before anything is written, if it must go through the semantics.
+          TRITON_EXPORT bool emulate(triton::arch::Instruction& inst);
+      };
+
+    /*! @} End of x86 namespace */
+    };
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_X86CONCRETESEMANTICS_H */
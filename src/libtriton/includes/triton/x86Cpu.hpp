@@ -15,11 +15,14 @@
 
 #include <triton/archEnums.hpp>
 #include <triton/callbacks.hpp>
+#include <triton/concreteMemory.hpp>
 #include <triton/cpuInterface.hpp>
+#include <triton/decodeCache.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/register.hpp>
+#include <triton/registerFile.hpp>
 #include <triton/tritonTypes.hpp>
 #include <triton/x86Specifications.hpp>
 
@@ -69,147 +72,23 @@ namespace triton {
           void disassInit(void);
 
         protected:
-          /*! \brief map of address -> concrete value
-           *
-           * \details
-           *
-           * **item1**: memory address<br>
-           * **item2**: concrete value
-           */
-          std::unordered_map<triton::uint64, triton::uint8, IdentityHash<triton::uint64>> memory;
-
-          //! Concrete value of eax
-          triton::uint8 eax[triton::size::dword];
-          //! Concrete value of ebx
-          triton::uint8 ebx[triton::size::dword];
-          //! Concrete value of ecx
-          triton::uint8 ecx[triton::size::dword];
-          //! Concrete value of edx
-          triton::uint8 edx[triton::size::dword];
-          //! Concrete value of edi
-          triton::uint8 edi[triton::size::dword];
-          //! Concrete value of esi
-          triton::uint8 esi[triton::size::dword];
-          //! Concrete value of ebp
-          triton::uint8 ebp[triton::size::dword];
-          //! Concrete value of esp
-          triton::uint8 esp[triton::size::dword];
-          //! Concrete value of eip
-          triton::uint8 eip[triton::size::dword];
-          //! Concrete value of eflags
-          triton::uint8 eflags[triton::size::dword];
-          //! Concrete value of st0
-          triton::uint8 st0[triton::size::fword];
-          //! Concrete value of st1
-          triton::uint8 st1[triton::size::fword];
-          //! Concrete value of st2
-          triton::uint8 st2[triton::size::fword];
-          //! Concrete value of st3
-          triton::uint8 st3[triton::size::fword];
-          //! Concrete value of st4
-          triton::uint8 st4[triton::size::fword];
-          //! Concrete value of st5
-          triton::uint8 st5[triton::size::fword];
-          //! Concrete value of st6
-          triton::uint8 st6[triton::size::fword];
-          //! Concrete value of st7
-          triton::uint8 st7[triton::size::fword];
-          //! Concrete value of ymm0
-          triton::uint8 ymm0[triton::size::qqword];
-          //! Concrete value of ymm1
-          triton::uint8 ymm1[triton::size::qqword];
-          //! Concrete value of ymm2
-          triton::uint8 ymm2[triton::size::qqword];
-          //! Concrete value of ymm3
-          triton::uint8 ymm3[triton::size::qqword];
-          //! Concrete value of ymm4
-          triton::uint8 ymm4[triton::size::qqword];
-          //! Concrete value of ymm5
-          triton::uint8 ymm5[triton::size::qqword];
-          //! Concrete value of ymm6
-          triton::uint8 ymm6[triton::size::qqword];
-          //! Concrete value of ymm7
-          triton::uint8 ymm7[triton::size::qqword];
-          //! Concrete value of cr0
-          triton::uint8 cr0[triton::size::dword];
-          //! Concrete value of cr1
-          triton::uint8 cr1[triton::size::dword];
-          //! Concrete value of cr2
-          triton::uint8 cr2[triton::size::dword];
-          //! Concrete value of cr3
-          triton::uint8 cr3[triton::size::dword];
-          //! Concrete value of cr4
-          triton::uint8 cr4[triton::size::dword];
-          //! Concrete value of cr5
-          triton::uint8 cr5[triton::size::dword];
-          //! Concrete value of cr6
-          triton::uint8 cr6[triton::size::dword];
-          //! Concrete value of cr7
-          triton::uint8 cr7[triton::size::dword];
-          //! Concrete value of cr8
-          triton::uint8 cr8[triton::size::dword];
-          //! Concrete value of cr9
-          triton::uint8 cr9[triton::size::dword];
-          //! Concrete value of cr10
-          triton::uint8 cr10[triton::size::dword];
-          //! Concrete value of cr11
-          triton::uint8 cr11[triton::size::dword];
-          //! Concrete value of cr12
-          triton::uint8 cr12[triton::size::dword];
-          //! Concrete value of cr13
-          triton::uint8 cr13[triton::size::dword];
-          //! Concrete value of cr14
-          triton::uint8 cr14[triton::size::dword];
-          //! Concrete value of cr15
-          triton::uint8 cr15[triton::size::dword];
-          //! Concrete value of CS
-          triton::uint8 cs[triton::size::dword];
-          //! Concrete value of DS
-          triton::uint8 ds[triton::size::dword];
-          //! Concrete value of ES
-          triton::uint8 es[triton::size::dword];
-          //! Concrete value of FS
-          triton::uint8 fs[triton::size::dword];
-          //! Concrete value of GS
-          triton::uint8 gs[triton::size::dword];
-          //! Concrete value of SS
-          triton::uint8 ss[triton::size::dword];
-          //! Concrete value of dr0
-          triton::uint8 dr0[triton::size::dword];
-          //! Condete value of dr1
-          triton::uint8 dr1[triton::size::dword];
-          //! Condete value of dr2
-          triton::uint8 dr2[triton::size::dword];
-          //! Condete value of dr3
-          triton::uint8 dr3[triton::size::dword];
-          //! Condete value of dr6
-          triton::uint8 dr6[triton::size::dword];
-          //! Condete value of dr7
-          triton::uint8 dr7[triton::size::dword];
-          //! Concrete value of the x87 FPU Control Word
-          triton::uint8 fcw[triton::size::word];
-          //! Concrete value of the x87 FPU Status Word
-          triton::uint8 fsw[triton::size::word];
-          //! Concrete value of the x87 FPU Tag Word
-          triton::uint8 ftw[triton::size::word];
-          //! Concrete value of the x87 FPU Opcode
-          triton::uint8 fop[triton::size::word];
-          //! Concrete value of the x87 FPU Instruction Pointer Offset
-          triton::uint8 fip[triton::size::qword];
-          //! Concrete value of the x87 FPU Instruction Pointer Selector
-          triton::uint8 fcs[triton::size::word];
-          //! Concrete value of the x87 FPU Instruction Operand Pointer Offset
-          triton::uint8 fdp[triton::size::qword];
-          //! Concrete value of the x87 FPU Instruction Operand Pointer Selector
-          triton::uint8 fds[triton::size::word];
-          //! Concrete value of the EFER MSR Register
-          triton::uint8 efer[triton::size::qword];
-          //! Concrete value of the SSE Register State
-          triton::uint8 mxcsr[triton::size::dword];
-          //! Concrete value of the SSE Register State Mask
-          triton::uint8 mxcsr_mask[triton::size::dword];
-          //! Concrete value of the TSC Register
-          triton::uint8 tsc[triton::size::qword];
+          //! The concrete memory state (paged).
+          triton::arch::ConcreteMemory memory;
+
+          //! The layout of the concrete register file.
+          static constexpr triton::arch::RegisterFileLayout layout = triton::arch::x86::registerFileLayout(false);
+
+          //! The concrete register file. Registers are located in it by `layout`.
+          triton::uint8 registerFile[layout.getSize()];
+
+          //! The cache of disassembled instructions.
+          triton::arch::DecodeCache decodeCache;
+
+          //! Returns true if `reg` has a storage and no callback of `kind` to call.
+          TRITON_EXPORT bool isDirectConcreteRegister(const triton::arch::Register& reg, triton::callbacks::callback_e kind, bool execCallbacks) const;
+
+          //! Returns the concrete register file, to write the direct registers into.
+          TRITON_EXPORT triton::uint8* getWritableConcreteRegisterFile(void);
 
         public:
           //! Constructor.
@@ -264,7 +143,11 @@ namespace triton {
           TRITON_EXPORT bool isThumb(void) const;
           TRITON_EXPORT bool isMemoryExclusive(const triton::arch::MemoryAccess& mem) const;
           TRITON_EXPORT const std::unordered_map<triton::arch::register_e, const triton::arch::Register>& getAllRegisters(void) const;
-          TRITON_EXPORT const std::unordered_map<triton::uint64, triton::uint8, IdentityHash<triton::uint64>>& getConcreteMemory(void) const;
+          TRITON_EXPORT const triton::arch::ConcreteMemory& getConcreteMemory(void) const;
+          TRITON_EXPORT const triton::arch::RegisterSlot& getConcreteRegisterSlot(triton::arch::register_e id) const;
+          TRITON_EXPORT const triton::uint8* getConcreteRegisterFile(void) const;
+          TRITON_EXPORT triton::usize getConcreteRegisterFileSize(void) const;
+          TRITON_EXPORT triton::arch::DecodeCache& getDecodeCache(void);
           TRITON_EXPORT const triton::arch::Register& getParentRegister(const triton::arch::Register& reg) const;
           TRITON_EXPORT const triton::arch::Register& getParentRegister(triton::arch::register_e id) const;
           TRITON_EXPORT const triton::arch::Register& getProgramCounter(void) const;
@@ -273,6 +156,7 @@ namespace triton {
           TRITON_EXPORT const triton::arch::Register& getStackPointer(void) const;
           TRITON_EXPORT std::set<const triton::arch::Register*> getParentRegisters(void) const;
           TRITON_EXPORT std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
+          TRITON_EXPORT void readConcreteMemory(triton::uint64 baseAddr, void* area, triton::usize size, bool execCallbacks=true) const;
           TRITON_EXPORT triton::arch::endianness_e getEndianness(void) const;
           TRITON_EXPORT triton::uint32 numberOfRegisters(void) const;
           TRITON_EXPORT triton::uint32 gprBitSize(void) const;
@@ -282,11 +166,16 @@ namespace triton {
           TRITON_EXPORT triton::uint8 getConcreteMemoryValue(triton::uint64 addr, bool execCallbacks=true) const;
           TRITON_EXPORT void clear(void);
           TRITON_EXPORT void disassembly(triton::arch::Instruction& inst);
+          TRITON_EXPORT triton::arch::DecodeInfo decode(const triton::uint8* opcode, triton::uint32 size, triton::uint64 addr);
           TRITON_EXPORT void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values, bool execCallbacks=true);
           TRITON_EXPORT void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const void* area, triton::usize size, bool execCallbacks=true);
+          TRITON_EXPORT void mapConcreteMemoryArea(triton::uint64 baseAddr, const void* area, triton::usize size, const std::shared_ptr<const void>& owner);
+          TRITON_EXPORT void writeConcreteMemory(triton::uint64 baseAddr, const void* area, triton::usize size, bool execCallbacks=true);
           TRITON_EXPORT void setConcreteMemoryValue(const triton::arch::MemoryAccess& mem, const triton::uint512& value, bool execCallbacks=true);
           TRITON_EXPORT void setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value, bool execCallbacks=true);
           TRITON_EXPORT void setConcreteRegisterValue(const triton::arch::Register& reg, const triton::uint512& value, bool execCallbacks=true);
+          TRITON_EXPORT void setConcreteRegisterFile(const triton::uint8* file, triton::usize size);
+          TRITON_EXPORT void swapConcreteMemory(triton::arch::ConcreteMemory& memory);
           TRITON_EXPORT void setThumb(bool state);
           TRITON_EXPORT void setMemoryExclusiveTag(const triton::arch::MemoryAccess& mem, bool tag);
           TRITON_EXPORT bool isConcreteMemoryValueDefined(const triton::arch::MemoryAccess& mem) const;
@@ -94,6 +94,9 @@ namespace triton {
           //! Control flow semantics. Used to represent IP.
           void controlFlow_s(triton::arch::Instruction& inst);
 
+          //! Executes all the iterations of a string instruction with a REP prefix and a concrete counter (BULK_STRING_INSTRUCTIONS mode). Returns false if the semantics of one iteration must be used.
+          bool repString_s(triton::arch::Instruction& inst);
+
           //! Update the FPU x87 Tag Word (whenever an MMX register changes)
           void updateFTW(triton::arch::Instruction& inst, const triton::engines::symbolic::SharedSymbolicExpression& parent);
 
@@ -767,6 +770,9 @@ namespace triton {
           //! The LZCNT semantics.
           void lzcnt_s(triton::arch::Instruction& inst);
 
+          //! The INT semantics.
+          void int_s(triton::arch::Instruction& inst);
+
           //! The INT3 semantics.
           void int3_s(triton::arch::Instruction& inst);
 
@@ -10,11 +10,13 @@
 
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 #include <triton/archEnums.hpp>
 #include <triton/architecture.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/register.hpp>
+#include <triton/registerFile.hpp>
 
 
 
@@ -44,10 +46,30 @@ namespace triton {
       //! \class x86Specifications
       /*! \brief The x86Specifications class defines specifications about the x86 and x86_64 CPU */
       class x86Specifications {
+        private:
+          //! The registers specification of an architecture.
+          struct RegisterTables {
+            //! The registers <id : register>.
+            std::unordered_map<triton::arch::register_e, const triton::arch::Register> id2reg;
+
+            //! The register ids <name : id>.
+            std::unordered_map<std::string, triton::arch::register_e> name2id;
+
+            //! The registers indexed by id, nullptr if not available.
+            std::vector<const triton::arch::Register*> id2ptr;
+          };
+
+          //! Returns the registers specification of an architecture, built once on the first call and shared by every instance.
+          static const RegisterTables& getRegisterTables(triton::arch::architecture_e arch);
+
+          //! Converts a capstone's instruction id, the cases from which the table of capstoneInstructionToTritonInstruction() is built.
+          static triton::uint32 convertInstruction(triton::uint32 id);
+
         protected:
-          //! List of registers specification available for this architecture.
-          std::unordered_map<triton::arch::register_e, const triton::arch::Register> id2reg;
-          std::unordered_map<std::string, triton::arch::register_e> name2id;
+          //! List of registers specification available for this architecture (immutable, shared by every instance).
+          const std::unordered_map<triton::arch::register_e, const triton::arch::Register>& id2reg;
+          const std::unordered_map<std::string, triton::arch::register_e>& name2id;
+          const std::vector<const triton::arch::Register*>& id2ptr;
 
         public:
           //! Constructor.
@@ -63,6 +85,101 @@ namespace triton {
           TRITON_EXPORT triton::arch::x86::prefix_e capstonePrefixToTritonPrefix(triton::uint32 id) const;
       };
 
+      //! Returns the layout of the concrete register file of the x86 (`is64` false) or x86_64 (`is64` true) CPU.
+      constexpr triton::arch::RegisterFileLayout registerFileLayout(bool is64) {
+        triton::arch::RegisterFileLayout layout;
+
+        /* Parent registers have their own storage, except flags */
+        #define REG_SPEC(UPPER_NAME, _1, X86_64_UPPER, _3, X86_64_PARENT, X86_UPPER, _6, X86_PARENT, X86_AVAIL)                                    \
+        if (is64 && triton::arch::ID_REG_X86_##X86_64_PARENT == triton::arch::ID_REG_X86_##UPPER_NAME && (X86_64_UPPER) >= 7)                         \
+          layout.addRegister(triton::arch::ID_REG_X86_##UPPER_NAME, (X86_64_UPPER) + 1);                                                                \
+        if (!is64 && (X86_AVAIL) && triton::arch::ID_REG_X86_##X86_PARENT == triton::arch::ID_REG_X86_##UPPER_NAME && (X86_UPPER) >= 7)              \
+          layout.addRegister(triton::arch::ID_REG_X86_##UPPER_NAME, (X86_UPPER) + 1);
+        #define REG_SPEC_NO_CAPSTONE REG_SPEC
+        #include "triton/x86.spec"
+
+        /* Sub-registers are stored in their parent */
+        #define REG_SPEC(UPPER_NAME, _1, X86_64_UPPER, X86_64_LOWER, X86_64_PARENT, X86_UPPER, X86_LOWER, X86_PARENT, X86_AVAIL)                    \
+        if (is64 && triton::arch::ID_REG_X86_##X86_64_PARENT != triton::arch::ID_REG_X86_##UPPER_NAME)                                                 \
+          layout.addSubRegister(triton::arch::ID_REG_X86_##UPPER_NAME, triton::arch::ID_REG_X86_##X86_64_PARENT, (X86_64_LOWER), (X86_64_UPPER) - (X86_64_LOWER) + 1); \
+        if (!is64 && (X86_AVAIL) && triton::arch::ID_REG_X86_##X86_PARENT != triton::arch::ID_REG_X86_##UPPER_NAME)                                   \
+          layout.addSubRegister(triton::arch::ID_REG_X86_##UPPER_NAME, triton::arch::ID_REG_X86_##X86_PARENT, (X86_LOWER), (X86_UPPER) - (X86_LOWER) + 1);
+        #define REG_SPEC_NO_CAPSTONE REG_SPEC
+        #include "triton/x86.spec"
+
+        /* Flags are stored in their status or control register */
+        layout.addSubRegister(triton::arch::ID_REG_X86_SSE_IE, triton::arch::ID_REG_X86_MXCSR, 0, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_SSE_DE, triton::arch::ID_REG_X86_MXCSR, 1, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_SSE_ZE, triton::arch::ID_REG_X86_MXCSR, 2, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_SSE_OE, triton::arch::ID_REG_X86_MXCSR, 3, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_SSE_UE, triton::arch::ID_REG_X86_MXCSR, 4, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_SSE_PE, triton::arch::ID_REG_X86_MXCSR, 5, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_SSE_DAZ, triton::arch::ID_REG_X86_MXCSR, 6, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_SSE_IM, triton::arch::ID_REG_X86_MXCSR, 7, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_SSE_DM, triton::arch::ID_REG_X86_MXCSR, 8, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_SSE_ZM, triton::arch::ID_REG_X86_MXCSR, 9, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_SSE_OM, triton::arch::ID_REG_X86_MXCSR, 10, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_SSE_UM, triton::arch::ID_REG_X86_MXCSR, 11, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_SSE_PM, triton::arch::ID_REG_X86_MXCSR, 12, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_SSE_RL, triton::arch::ID_REG_X86_MXCSR, 13, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_SSE_RH, triton::arch::ID_REG_X86_MXCSR, 14, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_SSE_FZ, triton::arch::ID_REG_X86_MXCSR, 15, 1);
+
+        layout.addSubRegister(triton::arch::ID_REG_X86_CF, triton::arch::ID_REG_X86_EFLAGS, 0, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_PF, triton::arch::ID_REG_X86_EFLAGS, 2, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_AF, triton::arch::ID_REG_X86_EFLAGS, 4, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_ZF, triton::arch::ID_REG_X86_EFLAGS, 6, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_SF, triton::arch::ID_REG_X86_EFLAGS, 7, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_TF, triton::arch::ID_REG_X86_EFLAGS, 8, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_IF, triton::arch::ID_REG_X86_EFLAGS, 9, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_DF, triton::arch::ID_REG_X86_EFLAGS, 10, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_OF, triton::arch::ID_REG_X86_EFLAGS, 11, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_NT, triton::arch::ID_REG_X86_EFLAGS, 14, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_RF, triton::arch::ID_REG_X86_EFLAGS, 16, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_VM, triton::arch::ID_REG_X86_EFLAGS, 17, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_AC, triton::arch::ID_REG_X86_EFLAGS, 18, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_VIF, triton::arch::ID_REG_X86_EFLAGS, 19, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_VIP, triton::arch::ID_REG_X86_EFLAGS, 20, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_ID, triton::arch::ID_REG_X86_EFLAGS, 21, 1);
+
+        layout.addSubRegister(triton::arch::ID_REG_X86_FCW_IM, triton::arch::ID_REG_X86_FCW, 0, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FCW_DM, triton::arch::ID_REG_X86_FCW, 1, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FCW_ZM, triton::arch::ID_REG_X86_FCW, 2, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FCW_OM, triton::arch::ID_REG_X86_FCW, 3, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FCW_UM, triton::arch::ID_REG_X86_FCW, 4, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FCW_PM, triton::arch::ID_REG_X86_FCW, 5, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FCW_PC, triton::arch::ID_REG_X86_FCW, 8, 2);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FCW_RC, triton::arch::ID_REG_X86_FCW, 10, 2);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FCW_X, triton::arch::ID_REG_X86_FCW, 12, 1);
+
+        layout.addSubRegister(triton::arch::ID_REG_X86_FSW_IE, triton::arch::ID_REG_X86_FSW, 0, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FSW_DE, triton::arch::ID_REG_X86_FSW, 1, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FSW_ZE, triton::arch::ID_REG_X86_FSW, 2, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FSW_OE, triton::arch::ID_REG_X86_FSW, 3, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FSW_UE, triton::arch::ID_REG_X86_FSW, 4, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FSW_PE, triton::arch::ID_REG_X86_FSW, 5, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FSW_SF, triton::arch::ID_REG_X86_FSW, 6, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FSW_ES, triton::arch::ID_REG_X86_FSW, 7, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FSW_C0, triton::arch::ID_REG_X86_FSW, 8, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FSW_C1, triton::arch::ID_REG_X86_FSW, 9, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FSW_C2, triton::arch::ID_REG_X86_FSW, 10, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FSW_TOP, triton::arch::ID_REG_X86_FSW, 11, 3);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FSW_C3, triton::arch::ID_REG_X86_FSW, 14, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_FSW_B, triton::arch::ID_REG_X86_FSW, 15, 1);
+
+        layout.addSubRegister(triton::arch::ID_REG_X86_EFER_SCE, triton::arch::ID_REG_X86_EFER, 0, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_EFER_LME, triton::arch::ID_REG_X86_EFER, 8, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_EFER_LMA, triton::arch::ID_REG_X86_EFER, 10, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_EFER_NXE, triton::arch::ID_REG_X86_EFER, 11, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_EFER_SVME, triton::arch::ID_REG_X86_EFER, 12, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_EFER_LMSLE, triton::arch::ID_REG_X86_EFER, 13, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_EFER_FFXSR, triton::arch::ID_REG_X86_EFER, 14, 1);
+        layout.addSubRegister(triton::arch::ID_REG_X86_EFER_TCE, triton::arch::ID_REG_X86_EFER, 15, 1);
+
+        return layout;
+      }
+
+
       //! x86 NOP instruction
       const triton::arch::Instruction nop = triton::arch::Instruction("\x90", 1);
 
@@ -0,0 +1,125 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_X86TAINTSEMANTICS_H
+#define TRITON_X86TAINTSEMANTICS_H
+
+#include <triton/archEnums.hpp>
+#include <triton/architecture.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/memoryAccess.hpp>
+#include <triton/operandWrapper.hpp>
+#include <triton/taintEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The x86 namespace
+    namespace x86 {
+    /*!
+     *  \ingroup arch
+     *  \addtogroup x86
+     *  @{
+     */
+
+      /*! \class x86TaintSemantics
+       *  \brief The taint propagation of the common x86 instructions, without their semantics (TAINT_ONLY).
+       *
+       *  \details The taint is spread from the decoded operands by a rule per opcode, which follows the
+       *  x86 semantics: same handling of the flags, of `xor reg, reg` and of the effective addresses. The
+       *  addresses of the memory operands are computed from the concrete registers, and the concrete state
+       *  is not updated: it is expected to be synchronized by the caller, as a tracer does. An instruction
+       *  without a rule is left untouched and goes through the x86 semantics.
+       */
+      class x86TaintSemantics {
+        private:
+          //! Architecture API
+          triton::arch::Architecture* architecture;
+
+          //! Taint Engine API
+          triton::engines::taint::TaintEngine* taintEngine;
+
+          //! Returns true if the operand is tainted.
+          bool isTainted(const triton::arch::OperandWrapper& op) const;
+
+          //! Defines the address of a memory operand from the concrete registers.
+          void initAddress(triton::arch::MemoryAccess& mem) const;
+
+          //! Returns the memory access of `size` bytes at the top of the stack, moved by `offset` bytes.
+          triton::arch::MemoryAccess getStack(triton::uint32 size, triton::sint64 offset) const;
+
+          //! Sets the taint of the PF, SF and ZF flags, and of the AF, CF and OF flags unless `logical` (the logical instructions clear them).
+          void setFlags(bool tainted, bool logical=false);
+
+          //! The MOV, MOVSX, MOVSXD, MOVZX and vector MOV instructions.
+          bool mov_s(triton::arch::Instruction& inst);
+
+          //! The ADC, ADD, SBB, SUB and shift instructions. The carry is spread with ADC and SBB.
+          bool arith_s(triton::arch::Instruction& inst, bool carry);
+
+          //! The AND, OR and XOR instructions.
+          bool logic_s(triton::arch::Instruction& inst);
+
+          //! The CALL instruction.
+          bool call_s(void);
+
+          //! The CMOVcc instructions.
+          bool cmov_s(triton::arch::Instruction& inst);
+
+          //! The CMP and TEST instructions. CF and OF are cleared by TEST.
+          bool compare_s(triton::arch::Instruction& inst, bool logical);
+
+          //! The IMUL instruction, with two or three operands.
+          bool imul_s(triton::arch::Instruction& inst);
+
+          //! The LEA instruction.
+          bool lea_s(triton::arch::Instruction& inst);
+
+          //! The POP instruction.
+          bool pop_s(triton::arch::Instruction& inst);
+
+          //! The PUSH instruction.
+          bool push_s(triton::arch::Instruction& inst);
+
+          //! The DEC, INC, NEG and NOT instructions. NOT does not write the flags.
+          bool unary_s(triton::arch::Instruction& inst, bool flags);
+
+          //! The XCHG instruction.
+          bool xchg_s(triton::arch::Instruction& inst);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT x86TaintSemantics(triton::arch::Architecture* architecture, triton::engines::taint::TaintEngine* taintEngine);
+
+          //! Spreads the taint of the instruction. Returns false, before anything is written, if it must go through the semantics.
+          TRITON_EXPORT bool propagate(triton::arch::Instruction& inst);
+      };
+
+    /*! @} End of x86 namespace */
+    };
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_X86TAINTSEMANTICS_H */
@@ -8,6 +8,7 @@
 #ifndef TRITON_Z3SOLVER_H
 #define TRITON_Z3SOLVER_H
 
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -18,7 +19,10 @@
 #include <triton/dllexport.hpp>
 #include <triton/solverEnums.hpp>
 #include <triton/solverInterface.hpp>
+#include <triton/solverInterrupt.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/solverSession.hpp>
+#include <triton/tritonToZ3.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -47,9 +51,14 @@ namespace triton {
       //! \class Z3Solver
       /*! \brief Solver engine using z3. */
       class Z3Solver : public SolverInterface {
+          friend class Z3Session;
+
           //! Wrapper to handle variadict number of arguments or'd together.
           static z3::expr mk_or(z3::expr_vector args);
 
+          //! Returns the value of a numeral, read from its machine words.
+          static triton::uint512 getNumeralValue(const z3::expr& expr);
+
         private:
           //! The SMT solver timeout. By default, unlimited. This global timeout may be changed for a specific query (isSat/getModel/getModels) via argument `timeout`.
           triton::uint32 timeout;
@@ -57,6 +66,18 @@ namespace triton {
           //! The SMT solver memory limit. By default, unlimited.
           triton::uint32 memoryLimit;
 
+          //! The converter kept between the queries, so that the nodes converted by a previous query are not converted again.
+          mutable triton::ast::TritonToZ3 translator;
+
+          //! Protects the converter. A concurrent query converts into its own context.
+          mutable std::mutex translatorLock;
+
+          //! The configurations of the classes of queries.
+          triton::engines::solver::QueryConfigurations queries;
+
+          //! Returns a new z3 solver configured for the class of `node`.
+          z3::solver newSolver(z3::context& ctx, const triton::ast::SharedAbstractNode& node) const;
+
           //! Writes back the status code of the solver into the pointer pointed by status.
           void writeBackStatus(z3::solver& solver, z3::check_result res, triton::engines::solver::status_e* status) const;
 
@@ -82,9 +103,18 @@ namespace triton {
            */
           TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+          //! Computes and returns several models from a symbolic constraint. The search stops with an unknown status once `interrupt` is interrupted, from another thread.
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime, triton::engines::solver::SolverInterrupt* interrupt) const;
+
+          //! Enumerates the models of a symbolic constraint, distinct on the `projection` variables, and streams them to `callback`. The models are blocked in one incremental solver.
+          TRITON_EXPORT triton::usize enumerateModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, const ModelCallback& callback, triton::uint32 limit = 0, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+          //! Returns the sorted positions in `nodes` of constraints whose conjunction is unsatisfiable, extracted from the assumptions tracking each constraint.
+          TRITON_EXPORT std::vector<triton::usize> getUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 timeout = 0) const;
+
           //! Converts a Triton's AST to a Z3's AST, perform a Z3 simplification and returns a Triton's AST.
           TRITON_EXPORT triton::ast::SharedAbstractNode simplify(const triton::ast::SharedAbstractNode& node) const;
 
@@ -99,6 +129,40 @@ namespace triton {
 
           //! Defines a solver memory consumption limit (in megabytes).
           TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
+
+          //! Sets the configurations of the classes of queries: the logic of the solver, or its tactics.
+          TRITON_EXPORT void setQueryConfigurations(const triton::engines::solver::QueryConfigurations& configurations);
+
+          //! Returns a new incremental solving session keeping a live z3 solver, owned by the caller.
+          TRITON_EXPORT SolverSession* newSession(void) const;
+      };
+
+      //! \class Z3Session
+      /*! \brief Incremental solving session using a live z3 solver, with one push/pop scope per constraint. */
+      class Z3Session : public SolverSession {
+        private:
+          //! The solver of the session, which gives the timeout and the memory limit.
+          const Z3Solver* parent;
+
+          //! The converter of the constraints. It owns the z3 context and keeps the variables of the models.
+          triton::ast::TritonToZ3 z3Ast;
+
+          //! The live z3 solver.
+          z3::solver solver;
+
+        protected:
+          //! Asserts a constraint in a new scope.
+          void push(const triton::ast::SharedAbstractNode& node);
+
+          //! Removes the scope of the last constraint.
+          void pop(void);
+
+          //! Checks `node` on top of the asserted constraints, and returns a model if `model` is true and it is satisfiable.
+          std::unordered_map<triton::usize, SolverModel> check(const triton::ast::SharedAbstractNode& node, bool model, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT Z3Session(const Z3Solver* parent);
       };
 
     /*! @} End of solver namespace */
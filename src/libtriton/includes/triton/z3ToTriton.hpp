@@ -8,10 +8,12 @@
 #ifndef TRITON_Z3TOTRITONAST_H
 #define TRITON_Z3TOTRITONAST_H
 
+#include <vector>
 #include <z3++.h>
 
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/tritonToZ3.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -38,11 +40,17 @@ namespace triton {
         //! The Triton's AST context
         triton::ast::SharedAstContext astCtxt;
 
+        //! The translator whose kept conversions map back to their original nodes, if any.
+        const triton::ast::TritonToZ3* translator;
+
+        //! Builds the node of a z3's application from its converted arguments.
+        triton::ast::SharedAbstractNode build(const z3::expr& expr, const std::vector<triton::ast::SharedAbstractNode>& args);
+
       public:
-        //! Constructor.
-        TRITON_EXPORT Z3ToTriton(const triton::ast::SharedAstContext& ctxt);
+        //! Constructor. The subexpressions translated by `translator` are converted back to their original nodes.
+        TRITON_EXPORT Z3ToTriton(const triton::ast::SharedAstContext& ctxt, const triton::ast::TritonToZ3* translator=nullptr);
 
-        //! Converts to Triton's AST
+        //! Converts to Triton's AST. Each subexpression is converted once.
         TRITON_EXPORT triton::ast::SharedAbstractNode convert(const z3::expr& expr);
     };
 
@@ -0,0 +1,346 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+
+#if defined(_WIN32)
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <triton/binaryLoader.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+namespace triton {
+  namespace loaders {
+
+    /* ELF constants */
+    static constexpr triton::uint32 ELF_MAGIC = 0x464c457f;
+    static constexpr triton::uint16 ET_CORE   = 4;
+    static constexpr triton::uint32 PT_LOAD   = 1;
+
+    /* PE constants */
+    static constexpr triton::uint16 MZ_MAGIC   = 0x5a4d;
+    static constexpr triton::uint32 PE_MAGIC   = 0x00004550;
+    static constexpr triton::uint16 PE32_MAGIC = 0x10b;
+    static constexpr triton::uint16 PE64_MAGIC = 0x20b;
+
+    /* Mach-O constants */
+    static constexpr triton::uint32 MH_MAGIC      = 0xfeedface;
+    static constexpr triton::uint32 MH_MAGIC_64   = 0xfeedfacf;
+    static constexpr triton::uint32 MH_CIGAM      = 0xcefaedfe;
+    static constexpr triton::uint32 MH_CIGAM_64   = 0xcffaedfe;
+    static constexpr triton::uint32 FAT_MAGIC     = 0xbebafeca;
+    static constexpr triton::uint32 LC_SEGMENT    = 0x1;
+    static constexpr triton::uint32 LC_SEGMENT_64 = 0x19;
+
+    /* Minidump constants */
+    static constexpr triton::uint32 MDMP_MAGIC           = 0x504d444d;
+    static constexpr triton::uint32 MEMORY_LIST_STREAM   = 5;
+    static constexpr triton::uint32 MEMORY64_LIST_STREAM = 9;
+
+
+    /* Reads an integer of `size` bytes at `offset` in the file */
+    static triton::uint64 readInteger(const MappedFile& file, triton::uint64 offset, triton::usize size, bool bigEndian=false) {
+      if (offset > file.getSize() || size > file.getSize() - offset)
+        throw triton::exceptions::Loader("BinaryLoader: Truncated file.");
+
+      triton::uint64 value = 0;
+      for (triton::usize i = 0; i < size; i++) {
+        triton::usize index = bigEndian ? i : size - 1 - i;
+        value = (value << 8) | file.getData()[offset + index];
+      }
+
+      return value;
+    }
+
+
+    MappedFile::MappedFile(const std::string& path) {
+      this->data = nullptr;
+      this->size = 0;
+
+      #if defined(_WIN32)
+      this->mapping = nullptr;
+
+      HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (handle == INVALID_HANDLE_VALUE)
+        throw triton::exceptions::Loader("MappedFile::MappedFile(): Cannot open " + path);
+
+      LARGE_INTEGER size;
+      if (!GetFileSizeEx(handle, &size)) {
+        CloseHandle(handle);
+        throw triton::exceptions::Loader("MappedFile::MappedFile(): Cannot get the size of " + path);
+      }
+
+      this->size = static_cast<triton::usize>(size.QuadPart);
+      if (this->size) {
+        this->mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (this->mapping)
+          this->data = static_cast<const triton::uint8*>(MapViewOfFile(this->mapping, FILE_MAP_READ, 0, 0, 0));
+      }
+      CloseHandle(handle);
+
+      if (this->size && this->data == nullptr) {
+        if (this->mapping)
+          CloseHandle(this->mapping);
+        throw triton::exceptions::Loader("MappedFile::MappedFile(): Cannot map " + path);
+      }
+      #else
+      int fd = open(path.c_str(), O_RDONLY);
+      if (fd < 0)
+        throw triton::exceptions::Loader("MappedFile::MappedFile(): Cannot open " + path);
+
+      struct stat st;
+      if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw triton::exceptions::Loader("MappedFile::MappedFile(): Cannot get the size of " + path);
+      }
+
+      this->size = static_cast<triton::usize>(st.st_size);
+      if (this->size) {
+        void* area = mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (area != MAP_FAILED)
+          this->data = static_cast<const triton::uint8*>(area);
+      }
+      close(fd);
+
+      if (this->size && this->data == nullptr)
+        throw triton::exceptions::Loader("MappedFile::MappedFile(): Cannot map " + path);
+      #endif
+    }
+
+
+    MappedFile::~MappedFile() {
+      #if defined(_WIN32)
+      if (this->data)
+        UnmapViewOfFile(this->data);
+      if (this->mapping)
+        CloseHandle(this->mapping);
+      #else
+      if (this->data)
+        munmap(const_cast<triton::uint8*>(this->data), this->size);
+      #endif
+    }
+
+
+    const triton::uint8* MappedFile::getData(void) const {
+      return this->data;
+    }
+
+
+    triton::usize MappedFile::getSize(void) const {
+      return this->size;
+    }
+
+
+    BinaryLoader::BinaryLoader(const std::string& path) {
+      this->file   = std::make_shared<MappedFile>(path);
+      this->format = triton::loaders::FORMAT_INVALID;
+
+      triton::uint32 magic = static_cast<triton::uint32>(readInteger(*this->file, 0, 4));
+
+      if (magic == ELF_MAGIC) {
+        this->format = triton::loaders::FORMAT_ELF;
+        this->parseElf();
+      }
+      else if (magic == MH_MAGIC || magic == MH_MAGIC_64) {
+        this->format = triton::loaders::FORMAT_MACHO;
+        this->parseMacho();
+      }
+      else if (magic == MDMP_MAGIC) {
+        this->format = triton::loaders::FORMAT_MINIDUMP;
+        this->parseMinidump();
+      }
+      else if ((magic & 0xffff) == MZ_MAGIC) {
+        this->format = triton::loaders::FORMAT_PE;
+        this->parsePe();
+      }
+      else if (magic == MH_CIGAM || magic == MH_CIGAM_64 || magic == FAT_MAGIC) {
+        throw triton::exceptions::Loader("BinaryLoader::BinaryLoader(): Big endian and fat Mach-O files are not supported.");
+      }
+      else {
+        throw triton::exceptions::Loader("BinaryLoader::BinaryLoader(): Unknown file format.");
+      }
+    }
+
+
+    void BinaryLoader::addSegment(triton::uint64 address, triton::uint64 size, triton::uint64 offset, triton::uint64 fileSize) {
+      if (size == 0)
+        return;
+
+      if (fileSize > size)
+        fileSize = size;
+
+      if (offset > this->file->getSize() || fileSize > this->file->getSize() - offset)
+        throw triton::exceptions::Loader("BinaryLoader::addSegment(): The content of a segment is outside of the file.");
+
+      if (address + (size - 1) < address)
+        throw triton::exceptions::Loader("BinaryLoader::addSegment(): A segment wraps around the address space.");
+
+      this->segments.push_back(Segment{address, size, offset, fileSize});
+    }
+
+
+    void BinaryLoader::parseElf(void) {
+      const MappedFile& f = *this->file;
+      triton::uint64 elfClass = readInteger(f, 4, 1);
+      triton::uint64 elfData  = readInteger(f, 5, 1);
+
+      if ((elfClass != 1 && elfClass != 2) || (elfData != 1 && elfData != 2))
+        throw triton::exceptions::Loader("BinaryLoader::parseElf(): Invalid ELF identification.");
+
+      bool is64 = (elfClass == 2);
+      bool be   = (elfData == 2);
+
+      triton::uint64 type   = readInteger(f, 0x10, 2, be);
+      triton::uint64 phoff  = is64 ? readInteger(f, 0x20, 8, be) : readInteger(f, 0x1c, 4, be);
+      triton::uint64 phsize = readInteger(f, is64 ? 0x36 : 0x2a, 2, be);
+      triton::uint64 phnum  = readInteger(f, is64 ? 0x38 : 0x2c, 2, be);
+
+      for (triton::uint64 i = 0; i < phnum; i++) {
+        triton::uint64 ph = phoff + i * phsize;
+        if (readInteger(f, ph, 4, be) != PT_LOAD)
+          continue;
+
+        triton::uint64 offset   = is64 ? readInteger(f, ph + 0x08, 8, be) : readInteger(f, ph + 0x04, 4, be);
+        triton::uint64 vaddr    = is64 ? readInteger(f, ph + 0x10, 8, be) : readInteger(f, ph + 0x08, 4, be);
+        triton::uint64 fileSize = is64 ? readInteger(f, ph + 0x20, 8, be) : readInteger(f, ph + 0x10, 4, be);
+        triton::uint64 memSize  = is64 ? readInteger(f, ph + 0x28, 8, be) : readInteger(f, ph + 0x14, 4, be);
+
+        /* Bytes of core dumps which are not in the file have not been dumped, they are not zeros */
+        if (type == ET_CORE)
+          memSize = fileSize;
+
+        this->addSegment(vaddr, memSize, offset, fileSize);
+      }
+    }
+
+
+    void BinaryLoader::parsePe(void) {
+      const MappedFile& f = *this->file;
+      triton::uint64 pe   = readInteger(f, 0x3c, 4);
+
+      if (readInteger(f, pe, 4) != PE_MAGIC)
+        throw triton::exceptions::Loader("BinaryLoader::parsePe(): Invalid PE signature.");
+
+      triton::uint64 nsections = readInteger(f, pe + 4 + 2, 2);
+      triton::uint64 optSize   = readInteger(f, pe + 4 + 16, 2);
+      triton::uint64 opt       = pe + 24;
+      triton::uint64 magic     = readInteger(f, opt, 2);
+      triton::uint64 imageBase = 0;
+
+      if (magic == PE32_MAGIC)
+        imageBase = readInteger(f, opt + 28, 4);
+      else if (magic == PE64_MAGIC)
+        imageBase = readInteger(f, opt + 24, 8);
+      else
+        throw triton::exceptions::Loader("BinaryLoader::parsePe(): Invalid optional header.");
+
+      triton::uint64 headers = readInteger(f, opt + 60, 4);
+      this->addSegment(imageBase, headers, 0, std::min<triton::uint64>(headers, f.getSize()));
+
+      for (triton::uint64 i = 0; i < nsections; i++) {
+        triton::uint64 section = opt + optSize + i * 40;
+        triton::uint64 vsize   = readInteger(f, section + 8, 4);
+        triton::uint64 vaddr   = readInteger(f, section + 12, 4);
+        triton::uint64 rawSize = readInteger(f, section + 16, 4);
+        triton::uint64 rawPtr  = readInteger(f, section + 20, 4);
+
+        this->addSegment(imageBase + vaddr, vsize ? vsize : rawSize, rawPtr, rawSize);
+      }
+    }
+
+
+    void BinaryLoader::parseMacho(void) {
+      const MappedFile& f  = *this->file;
+      bool is64            = (readInteger(f, 0, 4) == MH_MAGIC_64);
+      triton::uint64 ncmds = readInteger(f, 16, 4);
+      triton::uint64 cmd   = is64 ? 32 : 28;
+
+      for (triton::uint64 i = 0; i < ncmds; i++) {
+        triton::uint64 type = readInteger(f, cmd, 4);
+        triton::uint64 size = readInteger(f, cmd + 4, 4);
+
+        if (size == 0)
+          throw triton::exceptions::Loader("BinaryLoader::parseMacho(): Invalid load command.");
+
+        if (type == LC_SEGMENT || type == LC_SEGMENT_64) {
+          bool seg64 = (type == LC_SEGMENT_64);
+          triton::uint64 vmaddr   = seg64 ? readInteger(f, cmd + 24, 8) : readInteger(f, cmd + 24, 4);
+          triton::uint64 vmsize   = seg64 ? readInteger(f, cmd + 32, 8) : readInteger(f, cmd + 28, 4);
+          triton::uint64 fileoff  = seg64 ? readInteger(f, cmd + 40, 8) : readInteger(f, cmd + 32, 4);
+          triton::uint64 filesize = seg64 ? readInteger(f, cmd + 48, 8) : readInteger(f, cmd + 36, 4);
+          triton::uint64 initprot = seg64 ? readInteger(f, cmd + 60, 4) : readInteger(f, cmd + 44, 4);
+
+          /* Segments without access rights (e.g. __PAGEZERO) are not loaded */
+          if (initprot != 0)
+            this->addSegment(vmaddr, vmsize, fileoff, filesize);
+        }
+
+        cmd += size;
+      }
+    }
+
+
+    void BinaryLoader::parseMinidump(void) {
+      const MappedFile& f     = *this->file;
+      triton::uint64 nstreams = readInteger(f, 8, 4);
+      triton::uint64 dir      = readInteger(f, 12, 4);
+
+      for (triton::uint64 i = 0; i < nstreams; i++) {
+        triton::uint64 entry = dir + i * 12;
+        triton::uint64 type  = readInteger(f, entry, 4);
+        triton::uint64 rva   = readInteger(f, entry + 8, 4);
+
+        if (type == MEMORY_LIST_STREAM) {
+          triton::uint64 count = readInteger(f, rva, 4);
+          for (triton::uint64 j = 0; j < count; j++) {
+            triton::uint64 desc  = rva + 4 + j * 16;
+            triton::uint64 start = readInteger(f, desc, 8);
+            triton::uint64 size  = readInteger(f, desc + 8, 4);
+            triton::uint64 data  = readInteger(f, desc + 12, 4);
+            this->addSegment(start, size, data, size);
+          }
+        }
+
+        else if (type == MEMORY64_LIST_STREAM) {
+          triton::uint64 count = readInteger(f, rva, 8);
+          triton::uint64 data  = readInteger(f, rva + 8, 8);
+          for (triton::uint64 j = 0; j < count; j++) {
+            triton::uint64 desc  = rva + 16 + j * 16;
+            triton::uint64 start = readInteger(f, desc, 8);
+            triton::uint64 size  = readInteger(f, desc + 8, 8);
+            this->addSegment(start, size, data, size);
+            data += size;
+          }
+        }
+      }
+    }
+
+
+    triton::loaders::format_e BinaryLoader::getFormat(void) const {
+      return this->format;
+    }
+
+
+    const std::vector<triton::loaders::Segment>& BinaryLoader::getSegments(void) const {
+      return this->segments;
+    }
+
+
+    const std::shared_ptr<MappedFile>& BinaryLoader::getFile(void) const {
+      return this->file;
+    }
+
+  }; /* loaders namespace */
+}; /* triton namespace */
@@ -0,0 +1,357 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <cstdio>
+
+#include <sys/socket.h>
+#include <sys/types.h>
+
+#include <triton/concreteMemory.hpp>
+#include <triton/context.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/gdbRemote.hpp>
+#include <triton/remoteProtocol.hpp>
+
+
+
+namespace triton {
+  namespace loaders {
+
+    /* A register of the `g` packet: its name in Triton, nullptr for the bytes skipped, and its size in bytes */
+    struct GdbRegister {
+      const char* name;
+      triton::uint32 size;
+    };
+
+
+    /* The name of the registers holding the flags, split into the flag registers of Triton on ARM */
+    static const char* cpsr = "cpsr";
+
+
+    /* The general purpose registers, program counter and flags, in the layout of the `g` packet of gdb */
+    static const std::vector<GdbRegister>& getLayout(triton::arch::architecture_e arch) {
+      static const std::vector<GdbRegister> x86 = {
+        {"eax", 4}, {"ecx", 4}, {"edx", 4}, {"ebx", 4}, {"esp", 4}, {"ebp", 4}, {"esi", 4}, {"edi", 4},
+        {"eip", 4}, {"eflags", 4},
+      };
+
+      static const std::vector<GdbRegister> x8664 = {
+        {"rax", 8}, {"rbx", 8}, {"rcx", 8}, {"rdx", 8}, {"rsi", 8}, {"rdi", 8}, {"rbp", 8}, {"rsp", 8},
+        {"r8",  8}, {"r9",  8}, {"r10", 8}, {"r11", 8}, {"r12", 8}, {"r13", 8}, {"r14", 8}, {"r15", 8},
+        {"rip", 8}, {"eflags", 4},
+      };
+
+      static const std::vector<GdbRegister> arm32 = {
+        {"r0", 4}, {"r1", 4}, {"r2",  4}, {"r3",  4}, {"r4",  4}, {"r5", 4}, {"r6",  4}, {"r7", 4},
+        {"r8", 4}, {"r9", 4}, {"r10", 4}, {"r11", 4}, {"r12", 4}, {"sp", 4}, {"r14", 4}, {"pc", 4},
+        /* The legacy FPA registers f0-f7 and fps */
+        {nullptr, 8 * 12 + 4}, {cpsr, 4},
+      };
+
+      static const std::vector<GdbRegister> aarch64 = {
+        {"x0",  8}, {"x1",  8}, {"x2",  8}, {"x3",  8}, {"x4",  8}, {"x5",  8}, {"x6",  8}, {"x7",  8},
+        {"x8",  8}, {"x9",  8}, {"x10", 8}, {"x11", 8}, {"x12", 8}, {"x13", 8}, {"x14", 8}, {"x15", 8},
+        {"x16", 8}, {"x17", 8}, {"x18", 8}, {"x19", 8}, {"x20", 8}, {"x21", 8}, {"x22", 8}, {"x23", 8},
+        {"x24", 8}, {"x25", 8}, {"x26", 8}, {"x27", 8}, {"x28", 8}, {"x29", 8}, {"x30", 8}, {"sp",  8},
+        {"pc",  8}, {cpsr, 4},
+      };
+
+      static const std::vector<GdbRegister> none;
+
+      switch (arch) {
+        case triton::arch::ARCH_X86:      return x86;
+        case triton::arch::ARCH_X86_64:   return x8664;
+        case triton::arch::ARCH_ARM32:    return arm32;
+        case triton::arch::ARCH_AARCH64:  return aarch64;
+        default:                          return none;
+      }
+    }
+
+
+    /* Returns the value of a hexadecimal digit, -1 if it is not one */
+    static int fromHex(char c) {
+      if (c >= '0' && c <= '9') return c - '0';
+      if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+      if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+      return -1;
+    }
+
+
+    /* Decodes the hexadecimal bytes of a reply. Returns false if it is not only made of them */
+    static bool decodeHex(const std::string& hex, std::vector<triton::uint8>& out) {
+      if (hex.size() % 2)
+        return false;
+
+      out.resize(hex.size() / 2);
+      for (triton::usize i = 0; i < out.size(); i++) {
+        int high = fromHex(hex[2 * i]);
+        int low  = fromHex(hex[2 * i + 1]);
+        /* The bytes of the registers which are not available are `xx` */
+        if (hex[2 * i] == 'x' && hex[2 * i + 1] == 'x')
+          high = low = 0;
+        if (high < 0 || low < 0)
+          return false;
+        out[i] = static_cast<triton::uint8>((high << 4) | low);
+      }
+
+      return true;
+    }
+
+
+    GdbRemote::GdbRemote(const std::string& endpoint, triton::usize prefetch)
+      : acks(true), packetSize(0x400), prefetch(prefetch), packets(0), fetched(0) {
+      this->socket = triton::engines::solver::remote::connectTo(endpoint);
+      if (this->socket == -1)
+        throw triton::exceptions::Loader("GdbRemote::GdbRemote(): Unable to connect to " + endpoint + ".");
+
+      try {
+        std::string features = this->request("qSupported:swbreak+;hwbreak+");
+        triton::usize pos = features.find("PacketSize=");
+
+        if (pos != std::string::npos)
+          this->packetSize = std::max<triton::usize>(std::strtoull(features.c_str() + pos + 11, nullptr, 16), 0x40);
+
+        if (features.find("QStartNoAckMode+") != std::string::npos && this->request("QStartNoAckMode") == "OK")
+          this->acks = false;
+      }
+      catch (...) {
+        triton::engines::solver::remote::closeSocket(this->socket);
+        throw;
+      }
+    }
+
+
+    GdbRemote::~GdbRemote() {
+      triton::engines::solver::remote::closeSocket(this->socket);
+    }
+
+
+    char GdbRemote::receiveByte(void) {
+      if (this->input.empty()) {
+        char buffer[0x1000];
+        auto received = ::recv(this->socket, buffer, sizeof(buffer), 0);
+        if (received <= 0)
+          throw triton::exceptions::Loader("GdbRemote::receiveByte(): The connection to the stub is lost.");
+        this->input.assign(buffer, received);
+        std::reverse(this->input.begin(), this->input.end());
+      }
+
+      char c = this->input.back();
+      this->input.pop_back();
+      return c;
+    }
+
+
+    std::string GdbRemote::request(const std::string& command) {
+      triton::uint8 checksum = 0;
+      char trailer[4];
+
+      for (char c : command)
+        checksum += static_cast<triton::uint8>(c);
+
+      std::snprintf(trailer, sizeof(trailer), "#%02x", checksum);
+      std::string packet = "$" + command + trailer;
+
+      while (true) {
+        this->packets++;
+        if (triton::engines::solver::remote::sendBuffer(this->socket, packet) == false)
+          throw triton::exceptions::Loader("GdbRemote::request(): The connection to the stub is lost.");
+
+        if (this->acks == false)
+          break;
+
+        /* Waits for the acknowledgment, a `-` asks for the packet again */
+        char ack = this->receiveByte();
+        while (ack != '+' && ack != '-')
+          ack = this->receiveByte();
+        if (ack == '+')
+          break;
+      }
+
+      while (true) {
+        std::string reply;
+        triton::uint8 sum = 0;
+
+        /* Skips the acknowledgments and notifications up to the start of the reply */
+        while (this->receiveByte() != '$');
+
+        for (char c = this->receiveByte(); c != '#'; c = this->receiveByte()) {
+          sum += static_cast<triton::uint8>(c);
+
+          if (c == '}') {
+            char escaped = this->receiveByte();
+            sum += static_cast<triton::uint8>(escaped);
+            reply.push_back(escaped ^ 0x20);
+          }
+          else if (c == '*' && !reply.empty()) {
+            /* Run-length encoding, the count is the next character minus 29 */
+            char count = this->receiveByte();
+            sum += static_cast<triton::uint8>(count);
+            reply.append(static_cast<triton::usize>(count - 29), reply.back());
+          }
+          else {
+            reply.push_back(c);
+          }
+        }
+
+        int high = fromHex(this->receiveByte());
+        int low  = fromHex(this->receiveByte());
+
+        if (this->acks == false)
+          return reply;
+
+        if (high >= 0 && low >= 0 && static_cast<triton::uint8>((high << 4) | low) == sum) {
+          triton::engines::solver::remote::sendBuffer(this->socket, "+");
+          return reply;
+        }
+
+        triton::engines::solver::remote::sendBuffer(this->socket, "-");
+      }
+    }
+
+
+    bool GdbRemote::readMemory(triton::uint64 addr, triton::usize size, triton::uint8* out) {
+      /* Each byte is two characters, within the framing of the reply */
+      triton::usize chunk = (this->packetSize - 8) / 2;
+      std::vector<triton::uint8> bytes;
+      char command[64];
+
+      while (size) {
+        triton::usize length = std::min(size, chunk);
+
+        std::snprintf(command, sizeof(command), "m%llx,%llx", static_cast<unsigned long long>(addr), static_cast<unsigned long long>(length));
+        std::string reply = this->request(command);
+
+        if (reply.empty() || reply[0] == 'E' || decodeHex(reply, bytes) == false || bytes.empty())
+          return false;
+
+        /* The stub may reply with less bytes than asked */
+        length = std::min(length, bytes.size());
+        std::copy(bytes.begin(), bytes.begin() + length, out);
+
+        addr += length;
+        out  += length;
+        size -= length;
+      }
+
+      return true;
+    }
+
+
+    std::vector<triton::uint8> GdbRemote::readRegisters(void) {
+      std::vector<triton::uint8> registers;
+      std::string reply = this->request("g");
+
+      if (reply.empty() || reply[0] == 'E' || decodeHex(reply, registers) == false)
+        throw triton::exceptions::Loader("GdbRemote::readRegisters(): The stub refused to give the registers.");
+
+      return registers;
+    }
+
+
+    triton::usize GdbRemote::syncRegisters(triton::Context& ctx) {
+      const auto& layout = getLayout(ctx.getArchitecture());
+      std::vector<triton::uint8> registers = this->readRegisters();
+      triton::usize offset = 0;
+      triton::usize count = 0;
+
+      if (layout.empty())
+        throw triton::exceptions::Loader("GdbRemote::syncRegisters(): The architecture is not supported.");
+
+      for (const auto& reg : layout) {
+        if (offset + reg.size > registers.size())
+          break;
+
+        triton::uint64 value = 0;
+        for (triton::uint32 i = reg.size; i > 0; i--)
+          value = (value << 8) | registers[offset + i - 1];
+        offset += reg.size;
+
+        if (reg.name == nullptr)
+          continue;
+
+        if (reg.name == cpsr) {
+          ctx.setConcreteRegisterValue(ctx.getRegister("n"), (value >> 31) & 1, false);
+          ctx.setConcreteRegisterValue(ctx.getRegister("z"), (value >> 30) & 1, false);
+          ctx.setConcreteRegisterValue(ctx.getRegister("c"), (value >> 29) & 1, false);
+          ctx.setConcreteRegisterValue(ctx.getRegister("v"), (value >> 28) & 1, false);
+        }
+        else {
+          ctx.setConcreteRegisterValue(ctx.getRegister(reg.name), value, false);
+        }
+
+        count++;
+      }
+
+      return count;
+    }
+
+
+    std::vector<triton::uint8> GdbRemote::fetchPage(triton::uint64 addr) {
+      const triton::usize pageSize = triton::arch::ConcreteMemory::pageSize;
+      std::vector<triton::uint8> page;
+
+      addr &= ~static_cast<triton::uint64>(pageSize - 1);
+
+      auto it = this->pages.find(addr);
+      if (it != this->pages.end()) {
+        page = std::move(it->second);
+        this->pages.erase(it);
+        return page;
+      }
+
+      if (this->unmapped.find(addr) != this->unmapped.end())
+        return page;
+
+      /* The following pages are read with the page asked for, up to the first one already known or the end of the address space */
+      triton::usize count = 1;
+      while (count <= this->prefetch) {
+        triton::uint64 next = addr + count * pageSize;
+        if (next < addr || this->pages.find(next) != this->pages.end() || this->unmapped.find(next) != this->unmapped.end())
+          break;
+        count++;
+      }
+
+      std::vector<triton::uint8> bytes(count * pageSize);
+      if (count > 1 && this->readMemory(addr, bytes.size(), bytes.data()) == false) {
+        /* A page which follows is not mapped, only the page asked for is read */
+        count = 1;
+        bytes.resize(pageSize);
+      }
+
+      if (count == 1 && this->readMemory(addr, pageSize, bytes.data()) == false) {
+        this->unmapped[addr] = true;
+        return page;
+      }
+
+      this->fetched += count;
+      for (triton::usize i = 1; i < count; i++)
+        this->pages[addr + i * pageSize].assign(bytes.begin() + i * pageSize, bytes.begin() + (i + 1) * pageSize);
+
+      page.assign(bytes.begin(), bytes.begin() + pageSize);
+      return page;
+    }
+
+
+    void GdbRemote::flush(void) {
+      this->pages.clear();
+      this->unmapped.clear();
+    }
+
+
+    triton::usize GdbRemote::getNumberOfPackets(void) const {
+      return this->packets;
+    }
+
+
+    triton::usize GdbRemote::getNumberOfFetchedPages(void) const {
+      return this->fetched;
+    }
+
+  }; /* loaders namespace */
+}; /* triton namespace */
@@ -0,0 +1,228 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+
+#include <triton/archEnums.hpp>
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/traceReader.hpp>
+
+
+
+namespace triton {
+  namespace loaders {
+
+    /* Trace constants */
+    static constexpr triton::uint32 TRACE_MAGIC   = 0x43525454; /* "TTRC" */
+    static constexpr triton::uint16 TRACE_VERSION = 1;
+
+
+    /* Returns the little endian integer of `size` bytes */
+    static triton::uint64 toInteger(const triton::uint8* bytes, triton::usize size) {
+      triton::uint64 value = 0;
+      for (triton::usize i = size; i > 0; i--)
+        value = (value << 8) | bytes[i - 1];
+      return value;
+    }
+
+
+    TraceReader::TraceReader(const std::string& path)
+      : offset(0),
+        stream(nullptr) {
+      this->file = std::make_unique<triton::loaders::MappedFile>(path);
+      this->init();
+    }
+
+
+    TraceReader::TraceReader(std::istream& stream)
+      : offset(0),
+        stream(&stream) {
+      this->init();
+    }
+
+
+    TraceReader::~TraceReader() {
+      {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->stopping = true;
+      }
+      this->changed.notify_all();
+      if (this->prefetcher.joinable())
+        this->prefetcher.join();
+    }
+
+
+    void TraceReader::init(void) {
+      triton::uint8 header[8];
+
+      this->arch       = triton::arch::ARCH_INVALID;
+      this->frontCount = 0;
+      this->backCount  = 0;
+      this->position   = 0;
+      this->backReady  = false;
+      this->finished   = false;
+      this->stopping   = false;
+
+      if (!this->read(header, sizeof(header)) || toInteger(header, 4) != TRACE_MAGIC)
+        throw triton::exceptions::Loader("TraceReader::init(): Not a trace.");
+
+      if (toInteger(header + 4, 2) != TRACE_VERSION)
+        throw triton::exceptions::Loader("TraceReader::init(): Unsupported version of trace.");
+
+      this->arch = static_cast<triton::arch::architecture_e>(toInteger(header + 6, 2));
+      this->front.resize(batchSize);
+      this->back.resize(batchSize);
+      this->prefetcher = std::thread(&TraceReader::prefetch, this);
+    }
+
+
+    bool TraceReader::read(void* dst, triton::usize size) {
+      if (this->file) {
+        triton::usize available = this->file->getSize() - this->offset;
+        if (available == 0)
+          return false;
+        if (available < size)
+          throw triton::exceptions::Loader("TraceReader::read(): Truncated trace.");
+        std::memcpy(dst, this->file->getData() + this->offset, size);
+        this->offset += size;
+        return true;
+      }
+
+      this->stream->read(static_cast<char*>(dst), static_cast<std::streamsize>(size));
+      triton::usize count = static_cast<triton::usize>(this->stream->gcount());
+      if (count == 0 && size != 0)
+        return false;
+      if (count != size)
+        throw triton::exceptions::Loader("TraceReader::read(): Truncated trace.");
+
+      return true;
+    }
+
+
+    void TraceReader::readRecord(void* dst, triton::usize size) {
+      if (!this->read(dst, size))
+        throw triton::exceptions::Loader("TraceReader::readRecord(): Truncated trace.");
+    }
+
+
+    bool TraceReader::decode(triton::loaders::TraceRecord& record) {
+      triton::uint8 buffer[triton::size::dqqword];
+
+      /* The vectors keep their capacity from a batch to another */
+      record.registers.clear();
+      record.memory.clear();
+      record.bytes.clear();
+
+      if (!this->read(buffer, 9))
+        return false;
+
+      record.address = toInteger(buffer, 8);
+      if (buffer[8] == 0 || buffer[8] > 16)
+        throw triton::exceptions::Loader("TraceReader::decode(): Invalid opcode size.");
+      record.opcode.resize(buffer[8]);
+      this->readRecord(record.opcode.data(), record.opcode.size());
+
+      this->readRecord(buffer, 2);
+      for (triton::usize count = toInteger(buffer, 2); count > 0; count--) {
+        this->readRecord(buffer, 3);
+        triton::usize id   = toInteger(buffer, 2);
+        triton::usize size = buffer[2];
+        if (id == triton::arch::ID_REG_INVALID || id >= triton::arch::ID_REG_LAST_ITEM)
+          throw triton::exceptions::Loader("TraceReader::decode(): Invalid register.");
+        if (size == 0 || size > triton::size::dqqword)
+          throw triton::exceptions::Loader("TraceReader::decode(): Invalid register size.");
+
+        this->readRecord(buffer, size);
+        triton::uint512 value = 0;
+        for (triton::usize i = size; i > 0; i--)
+          value = (value << 8) | buffer[i - 1];
+        record.registers.emplace_back(static_cast<triton::arch::register_e>(id), value);
+      }
+
+      this->readRecord(buffer, 2);
+      for (triton::usize count = toInteger(buffer, 2); count > 0; count--) {
+        this->readRecord(buffer, 12);
+        triton::uint64 address = toInteger(buffer, 8);
+        triton::uint32 size    = static_cast<triton::uint32>(toInteger(buffer + 8, 4));
+        triton::uint32 offset  = static_cast<triton::uint32>(record.bytes.size());
+
+        record.bytes.resize(offset + static_cast<triton::usize>(size));
+        this->readRecord(record.bytes.data() + offset, size);
+        record.memory.push_back({address, offset, size});
+      }
+
+      return true;
+    }
+
+
+    void TraceReader::prefetch(void) {
+      try {
+        while (true) {
+          {
+            std::unique_lock<std::mutex> guard(this->lock);
+            this->changed.wait(guard, [this] { return !this->backReady || this->stopping; });
+            if (this->stopping)
+              return;
+          }
+
+          /* `back` belongs to the thread until it is ready */
+          triton::usize count = 0;
+          while (count < batchSize && this->decode(this->back[count]))
+            count++;
+
+          {
+            std::lock_guard<std::mutex> guard(this->lock);
+            this->backCount = count;
+            this->backReady = (count != 0);
+            this->finished  = (count < batchSize);
+          }
+          this->changed.notify_all();
+
+          if (count < batchSize)
+            return;
+        }
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->error    = std::current_exception();
+        this->finished = true;
+        this->changed.notify_all();
+      }
+    }
+
+
+    triton::arch::architecture_e TraceReader::getArchitecture(void) const {
+      return this->arch;
+    }
+
+
+    const triton::loaders::TraceRecord* TraceReader::next(void) {
+      if (this->position == this->frontCount) {
+        {
+          std::unique_lock<std::mutex> guard(this->lock);
+          this->changed.wait(guard, [this] { return this->backReady || this->finished; });
+
+          if (!this->backReady) {
+            if (this->error)
+              std::rethrow_exception(this->error);
+            return nullptr;
+          }
+
+          std::swap(this->front, this->back);
+          this->frontCount = this->backCount;
+          this->position   = 0;
+          this->backReady  = false;
+        }
+        this->changed.notify_all();
+      }
+
+      return &this->front[this->position++];
+    }
+
+  }; /* loaders namespace */
+}; /* triton namespace */
@@ -14,11 +14,13 @@ namespace triton {
   namespace modes {
 
     Modes::Modes() {
+      this->version = 0;
       this->setMode(triton::modes::PC_TRACKING_SYMBOLIC, true); /* This mode is enabled by default */
     }
 
 
     Modes::Modes(const Modes& other) {
+      this->version = 0;
       this->copy(other);
     }
 
@@ -31,6 +33,7 @@ namespace triton {
 
     void Modes::copy(const Modes& other) {
       this->enabledModes = other.enabledModes;
+      this->version++;
     }
 
 
@@ -42,15 +45,24 @@ namespace triton {
 
 
     void Modes::setMode(triton::modes::mode_e mode, bool flag) {
-      if (flag == true)
-        this->enabledModes.insert(mode);
-      else
-        this->enabledModes.erase(mode);
+      if (flag == true) {
+        if (this->enabledModes.insert(mode).second)
+          this->version++;
+      }
+      else if (this->enabledModes.erase(mode)) {
+        this->version++;
+      }
     }
 
 
     void Modes::clearModes(void) {
       this->enabledModes.clear();
+      this->version++;
+    }
+
+
+    triton::usize Modes::getVersion(void) const {
+      return this->version;
     }
 
   }; /* modes namespace */
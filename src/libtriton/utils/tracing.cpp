@@ -0,0 +1,292 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <triton/tracing.hpp>
+
+
+
+namespace triton {
+  namespace utils {
+
+    /* An event, its times in nanoseconds since the origin of the trace */
+    struct TraceEvent {
+      const char* category;
+      const char* name;
+      triton::uint64 start;
+      triton::uint64 duration;
+    };
+
+
+    /*
+     * The events of a thread. Only its thread appends to it: an event is
+     * written then published by the release of the count of its chunk, so
+     * that the writers read the published events without a lock.
+     */
+    class TraceBuffer {
+      public:
+        static constexpr triton::usize chunkSize = 4096;
+
+        struct Chunk {
+          std::array<TraceEvent, chunkSize> events;
+          std::atomic<triton::usize> count{0};
+          std::atomic<Chunk*> next{nullptr};
+        };
+
+        /* The chunks, linked from the first one */
+        std::unique_ptr<Chunk> head;
+
+        /* The chunk written by the thread */
+        Chunk* tail;
+
+        /* The index of the thread in the trace */
+        triton::uint32 thread;
+
+        TraceBuffer(triton::uint32 thread) : head(new Chunk), tail(head.get()), thread(thread) {
+        }
+
+        ~TraceBuffer() {
+          this->clear();
+        }
+
+        void push(const TraceEvent& event) {
+          triton::usize index = this->tail->count.load(std::memory_order_relaxed);
+
+          if (index == chunkSize) {
+            Chunk* chunk = new Chunk;
+            this->tail->next.store(chunk, std::memory_order_release);
+            this->tail = chunk;
+            index = 0;
+          }
+
+          this->tail->events[index] = event;
+          this->tail->count.store(index + 1, std::memory_order_release);
+        }
+
+        template <typename F>
+        void forEach(F fn) const {
+          for (const Chunk* chunk = this->head.get(); chunk != nullptr; chunk = chunk->next.load(std::memory_order_acquire)) {
+            triton::usize count = chunk->count.load(std::memory_order_acquire);
+            for (triton::usize index = 0; index < count; index++)
+              fn(chunk->events[index]);
+          }
+        }
+
+        void clear(void) {
+          Chunk* chunk = this->head->next.exchange(nullptr);
+          while (chunk != nullptr) {
+            Chunk* next = chunk->next.load();
+            delete chunk;
+            chunk = next;
+          }
+          this->head->count.store(0);
+          this->tail = this->head.get();
+        }
+    };
+
+
+    /* The state of the trace, shared by the threads */
+    static std::atomic<bool> tracingEnabled{false};
+    static std::mutex tracingLock;
+    static std::vector<std::shared_ptr<TraceBuffer>> traceBuffers;
+    static const std::chrono::steady_clock::time_point traceOrigin = std::chrono::steady_clock::now();
+
+
+    /* Returns the buffer of the calling thread, registered on its first event */
+    static TraceBuffer& getTraceBuffer(void) {
+      thread_local std::shared_ptr<TraceBuffer> buffer;
+
+      if (buffer == nullptr) {
+        std::lock_guard<std::mutex> guard(tracingLock);
+        buffer = std::make_shared<TraceBuffer>(static_cast<triton::uint32>(traceBuffers.size()));
+        traceBuffers.push_back(buffer);
+      }
+
+      return *buffer;
+    }
+
+
+    /* Returns the time since the origin of the trace, never 0 */
+    static triton::uint64 getTraceTime(void) {
+      return static_cast<triton::uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - traceOrigin).count()) + 1;
+    }
+
+
+    void enableTracing(bool flag) {
+      tracingEnabled.store(flag, std::memory_order_relaxed);
+    }
+
+
+    bool isTracingEnabled(void) {
+      return tracingEnabled.load(std::memory_order_relaxed);
+    }
+
+
+    void clearTrace(void) {
+      std::lock_guard<std::mutex> guard(tracingLock);
+      for (const auto& buffer : traceBuffers)
+        buffer->clear();
+    }
+
+
+    triton::usize getTraceSize(void) {
+      std::lock_guard<std::mutex> guard(tracingLock);
+      triton::usize size = 0;
+
+      for (const auto& buffer : traceBuffers)
+        buffer->forEach([&size](const TraceEvent&) { size++; });
+
+      return size;
+    }
+
+
+    void writeChromeTrace(std::ostream& stream) {
+      std::lock_guard<std::mutex> guard(tracingLock);
+      bool first = true;
+
+      stream << "{\"traceEvents\":[";
+      for (const auto& buffer : traceBuffers) {
+        buffer->forEach([&](const TraceEvent& event) {
+          /* The times are in microseconds */
+          stream << (first ? "\n" : ",\n")
+                 << "{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category << "\",\"ph\":\"X\""
+                 << ",\"ts\":" << event.start / 1000 << "." << event.start % 1000 / 100 << event.start % 100 / 10 << event.start % 10
+                 << ",\"dur\":" << event.duration / 1000 << "." << event.duration % 1000 / 100 << event.duration % 100 / 10 << event.duration % 10
+                 << ",\"pid\":1,\"tid\":" << buffer->thread + 1 << "}";
+          first = false;
+        });
+      }
+      stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    }
+
+
+    /* The protobuf encoding of the few messages of a Perfetto trace */
+    static void putVarint(std::string& out, triton::uint64 value) {
+      while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+      }
+      out.push_back(static_cast<char>(value));
+    }
+
+
+    static void putField(std::string& out, triton::uint32 field, triton::uint64 value) {
+      putVarint(out, static_cast<triton::uint64>(field) << 3);
+      putVarint(out, value);
+    }
+
+
+    static void putField(std::string& out, triton::uint32 field, const std::string& bytes) {
+      putVarint(out, (static_cast<triton::uint64>(field) << 3) | 2);
+      putVarint(out, bytes.size());
+      out.append(bytes);
+    }
+
+
+    void writePerfettoTrace(std::ostream& stream) {
+      /* The fields of Trace, TracePacket, TrackDescriptor, ThreadDescriptor and TrackEvent */
+      enum : triton::uint32 {
+        tracePacket                  = 1,
+        packetTimestamp              = 8,
+        packetSequenceId             = 10,
+        packetTrackEvent             = 11,
+        packetSequenceFlags          = 13,
+        packetTrackDescriptor        = 60,
+        descriptorUuid               = 1,
+        descriptorName               = 2,
+        descriptorThread             = 4,
+        threadPid                    = 1,
+        threadTid                    = 2,
+        eventType                    = 9,
+        eventTrackUuid               = 11,
+        eventCategories              = 22,
+        eventName                    = 23,
+      };
+
+      enum : triton::uint64 {
+        sliceBegin                   = 1,
+        sliceEnd                     = 2,
+        incrementalStateCleared      = 1,
+      };
+
+      std::lock_guard<std::mutex> guard(tracingLock);
+      std::string out;
+
+      for (const auto& buffer : traceBuffers) {
+        triton::uint64 uuid = buffer->thread + 1;
+        std::string packet, descriptor, thread;
+
+        putField(thread, threadPid, 1);
+        putField(thread, threadTid, uuid);
+        putField(descriptor, descriptorUuid, uuid);
+        putField(descriptor, descriptorName, "thread " + std::to_string(uuid));
+        putField(descriptor, descriptorThread, thread);
+        putField(packet, packetSequenceId, uuid);
+        putField(packet, packetSequenceFlags, incrementalStateCleared);
+        putField(packet, packetTrackDescriptor, descriptor);
+        putField(out, tracePacket, packet);
+
+        /*
+         * The events are recorded as their scope ends, inner first. They are
+         * split into slice begins and ends in timestamp order, at a same time
+         * the ends first, outer begins before inner ones and inner ends
+         * before outer ones.
+         */
+        std::vector<std::tuple<triton::uint64, bool, triton::uint64, const TraceEvent*>> slices;
+        buffer->forEach([&slices](const TraceEvent& event) {
+          slices.emplace_back(event.start, true, ~event.duration, &event);
+          slices.emplace_back(event.start + event.duration, false, event.duration, &event);
+        });
+        std::sort(slices.begin(), slices.end(), [](const auto& a, const auto& b) {
+          return std::make_tuple(std::get<0>(a), std::get<1>(a), std::get<2>(a)) < std::make_tuple(std::get<0>(b), std::get<1>(b), std::get<2>(b));
+        });
+
+        for (const auto& slice : slices) {
+          std::string event;
+          packet.clear();
+
+          putField(event, eventType, std::get<1>(slice) ? sliceBegin : sliceEnd);
+          putField(event, eventTrackUuid, uuid);
+          if (std::get<1>(slice)) {
+            putField(event, eventCategories, std::get<3>(slice)->category);
+            putField(event, eventName, std::get<3>(slice)->name);
+          }
+
+          putField(packet, packetTimestamp, std::get<0>(slice));
+          putField(packet, packetSequenceId, uuid);
+          putField(packet, packetTrackEvent, event);
+          putField(out, tracePacket, packet);
+        }
+      }
+
+      stream.write(out.data(), static_cast<std::streamsize>(out.size()));
+    }
+
+
+    TraceScope::TraceScope(const char* category, const char* name) {
+      this->category = category;
+      this->name     = name;
+      this->start    = isTracingEnabled() ? getTraceTime() : 0;
+    }
+
+
+    TraceScope::~TraceScope() {
+      if (this->start != 0)
+        getTraceBuffer().push({this->category, this->name, this->start, getTraceTime() - this->start});
+    }
+
+  }; /* utils namespace */
+}; /* triton namespace */
@@ -0,0 +1,182 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <type_traits>
+
+#include <triton/wideArithmetic.hpp>
+
+
+
+namespace triton {
+  namespace utils {
+
+    /* Calls `f` with the number of limbs of `size` bits, as a constant */
+    template <typename F>
+    static inline auto dispatch(triton::uint32 size, F&& f) {
+      if (size <= 128)
+        return f(std::integral_constant<triton::uint32, 2>());
+      if (size <= 256)
+        return f(std::integral_constant<triton::uint32, 4>());
+      return f(std::integral_constant<triton::uint32, 8>());
+    }
+
+
+    triton::uint512 wideAdd(const triton::uint512& a, const triton::uint512& b, triton::uint32 size) {
+      return dispatch(size, [&](auto n) {
+        FixedUint<decltype(n)::value> x, y;
+        fixedLoad(x, a);
+        fixedLoad(y, b);
+        fixedAdd(x, x, y);
+        fixedMask(x, size);
+        return fixedStore(x);
+      });
+    }
+
+
+    triton::uint512 wideSub(const triton::uint512& a, const triton::uint512& b, triton::uint32 size) {
+      return dispatch(size, [&](auto n) {
+        FixedUint<decltype(n)::value> x, y;
+        fixedLoad(x, a);
+        fixedLoad(y, b);
+        fixedSub(x, x, y);
+        fixedMask(x, size);
+        return fixedStore(x);
+      });
+    }
+
+
+    triton::uint512 wideMul(const triton::uint512& a, const triton::uint512& b, triton::uint32 size) {
+      return dispatch(size, [&](auto n) {
+        FixedUint<decltype(n)::value> x, y;
+        fixedLoad(x, a);
+        fixedLoad(y, b);
+        fixedMul(x, x, y);
+        fixedMask(x, size);
+        return fixedStore(x);
+      });
+    }
+
+
+    triton::uint512 wideShl(const triton::uint512& a, const triton::uint512& shift, triton::uint32 size) {
+      if (shift >= size)
+        return 0;
+
+      return dispatch(size, [&](auto n) {
+        FixedUint<decltype(n)::value> x;
+        fixedLoad(x, a);
+        fixedShl(x, x, static_cast<triton::uint32>(shift));
+        fixedMask(x, size);
+        return fixedStore(x);
+      });
+    }
+
+
+    triton::uint512 wideLshr(const triton::uint512& a, const triton::uint512& shift, triton::uint32 size) {
+      if (shift >= size)
+        return 0;
+
+      return dispatch(size, [&](auto n) {
+        FixedUint<decltype(n)::value> x;
+        fixedLoad(x, a);
+        fixedMask(x, size);
+        fixedLshr(x, x, static_cast<triton::uint32>(shift));
+        return fixedStore(x);
+      });
+    }
+
+
+    triton::uint512 wideAshr(const triton::uint512& a, const triton::uint512& shift, triton::uint32 size) {
+      return dispatch(size, [&](auto n) {
+        FixedUint<decltype(n)::value> x, fill;
+        triton::uint32 s = (shift >= size) ? size : static_cast<triton::uint32>(shift);
+
+        fixedLoad(x, a);
+        fixedMask(x, size);
+        bool sign = fixedBit(x, size - 1);
+
+        if (s == size) {
+          x = {};
+        }
+        else {
+          fixedLshr(x, x, s);
+        }
+
+        /* The `s` high bits of `size` take the sign */
+        if (sign && s) {
+          for (auto& limb : fill.limbs)
+            limb = ~static_cast<triton::uint64>(0);
+          fixedShl(fill, fill, size - s);
+          fixedMask(fill, size);
+          fixedOr(x, x, fill);
+        }
+
+        return fixedStore(x);
+      });
+    }
+
+
+    triton::uint512 wideRol(const triton::uint512& a, triton::uint32 rot, triton::uint32 size) {
+      return dispatch(size, [&](auto n) {
+        FixedUint<decltype(n)::value> x, high;
+        fixedLoad(x, a);
+        fixedMask(x, size);
+        if (rot == 0)
+          return fixedStore(x);
+        fixedLshr(high, x, size - rot);
+        fixedShl(x, x, rot);
+        fixedOr(x, x, high);
+        fixedMask(x, size);
+        return fixedStore(x);
+      });
+    }
+
+
+    triton::uint512 wideRor(const triton::uint512& a, triton::uint32 rot, triton::uint32 size) {
+      return wideRol(a, (rot == 0) ? 0 : size - rot, size);
+    }
+
+
+    bool wideUlt(const triton::uint512& a, const triton::uint512& b, triton::uint32 size) {
+      return dispatch(size, [&](auto n) {
+        FixedUint<decltype(n)::value> x, y;
+        fixedLoad(x, a);
+        fixedLoad(y, b);
+        fixedMask(x, size);
+        fixedMask(y, size);
+        return fixedUlt(x, y);
+      });
+    }
+
+
+    bool wideSlt(const triton::uint512& a, const triton::uint512& b, triton::uint32 size) {
+      return dispatch(size, [&](auto n) {
+        FixedUint<decltype(n)::value> x, y;
+        fixedLoad(x, a);
+        fixedLoad(y, b);
+        fixedMask(x, size);
+        fixedMask(y, size);
+        bool sx = fixedBit(x, size - 1);
+        bool sy = fixedBit(y, size - 1);
+        if (sx != sy)
+          return sx;
+        return fixedUlt(x, y);
+      });
+    }
+
+
+    triton::uint512 wideExtract(const triton::uint512& a, triton::uint32 high, triton::uint32 low) {
+      return dispatch(high + 1, [&](auto n) {
+        FixedUint<decltype(n)::value> x;
+        fixedLoad(x, a);
+        fixedMask(x, high + 1);
+        fixedLshr(x, x, low);
+        return fixedStore(x);
+      });
+    }
+
+  }; /* utils namespace */
+}; /* triton namespace */
@@ -0,0 +1,100 @@
+#!/usr/bin/env python
+## -*- coding: utf-8 -*-
+##
+## Copyright (C) - Triton
+## This program is under the terms of the Apache License 2.0.
+##
+## Generate a database of precomputed expressions for the synthesis
+## Usage: gen_synthesis_database.py <output> [variables] [bits] [size]
+## Load it with TritonContext.loadSynthesisDatabase()
+##
+
+import sys
+
+from triton import *
+from random import randrange
+
+HOW_MANY_INPUTS = 16
+
+ctx = TritonContext(ARCH.X86_64) # does not matter of the architecture, we just need an AstContext
+ast = ctx.getAstContext()
+
+
+unary_operators = [
+    ast.bvneg,
+    ast.bvnot,
+]
+
+
+binary_operators = [
+    ast.bvadd,
+    ast.bvand,
+    ast.bvmul,
+    ast.bvor,
+    ast.bvsub,
+    ast.bvxor,
+]
+
+
+def signature(node, variables, inputs):
+    # Expressions with the same outputs on the inputs are observationally equivalent,
+    # only the first one, the smallest, is kept.
+    outputs = list()
+    for values in inputs:
+        for v, value in zip(variables, values):
+            ctx.setConcreteVariableValue(v.getSymbolicVariable(), value)
+        outputs.append(node.evaluate())
+    return tuple(outputs)
+
+
+def enumerate_expressions(variables, bits, size, inputs):
+    seen  = set()
+    exprs = list()
+    terms = {1: list()}
+
+    def add(n, node):
+        s = signature(node, variables, inputs)
+        if s not in seen:
+            seen.add(s)
+            terms[n].append(node)
+            exprs.append(node)
+
+    for v in variables:
+        add(1, v)
+    add(1, ast.bv(1, bits))
+
+    # Bottom-up, an expression of size n is an operator on smaller ones
+    for n in range(2, size + 1):
+        terms[n] = list()
+        for op in unary_operators:
+            for a in terms[n - 1]:
+                add(n, op(a))
+        for i in range(1, n - 1):
+            for op in binary_operators:
+                for a in terms[i]:
+                    for b in terms[n - 1 - i]:
+                        add(n, op(a, b))
+
+    return exprs
+
+
+def main(argv):
+    if len(argv) < 2:
+        print('Usage: %s <output> [variables] [bits] [size]' %(argv[0]))
+        return -1
+
+    arity = int(argv[2]) if len(argv) > 2 else 3
+    bits  = int(argv[3]) if len(argv) > 3 else 8
+    size  = int(argv[4]) if len(argv) > 4 else 5
+
+    variables = [ast.variable(ctx.newSymbolicVariable(bits, 'v%d' %(i))) for i in range(arity)]
+    inputs    = [[randrange(0, 1 << bits) for v in variables] for i in range(HOW_MANY_INPUTS)]
+    exprs     = enumerate_expressions(variables, bits, size, inputs)
+
+    count = ctx.writeSynthesisDatabase(argv[1], variables, inputs, exprs)
+    print('%d expressions written to %s' %(count, argv[1]))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,56 @@
+#!/usr/bin/env python
+## -*- coding: utf-8 -*-
+##
+## Copyright (C) - Triton
+## This program is under the terms of the Apache License 2.0.
+##
+## Run a script, e.g. an example of src/examples/python/ctf-writeups, and dump
+## every solver query of its contexts into a corpus file per context.
+## Usage: harvest_solver_queries.py <directory> <script.py> [args...]
+## Replay the corpus with triton-solver-replay (cmake -DBUILD_BENCHMARKS=ON)
+##
+## A reset of a context stops its dump, as it creates a new solver engine.
+##
+
+import itertools
+import os
+import runpy
+import sys
+import triton
+
+
+def main():
+    if len(sys.argv) < 3:
+        print('Usage: %s <directory> <script.py> [args...]' % sys.argv[0])
+        return -1
+
+    directory = sys.argv[1]
+    script    = sys.argv[2]
+    name      = os.path.splitext(os.path.basename(script))[0]
+    counter   = itertools.count()
+    context   = triton.TritonContext
+
+    os.makedirs(directory, exist_ok=True)
+
+    # The contexts of the script are created by this function instead of the class
+    def harvest(*args, **kwargs):
+        ctx  = context(*args, **kwargs)
+        path = os.path.join(directory, '%s-%d.corpus' % (name, next(counter)))
+        ctx.dumpSolverQueries(path)
+        print('[+] Dumping the queries into %s' % path)
+        return ctx
+
+    triton.TritonContext = harvest
+
+    # The script runs as if it was run itself, from its directory
+    sys.argv = sys.argv[2:]
+    sys.path.insert(0, os.path.dirname(os.path.abspath(script)))
+    try:
+        runpy.run_path(script, run_name='__main__')
+    except SystemExit as e:
+        return e.code
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -53,3 +53,22 @@ class TestDeep(unittest.TestCase):
     def test_symbolic_variable_update(self):
         self.triton.setConcreteVariableValue(self.sym_var.getSymbolicVariable(), 0xdeadbeaf)
         self.assertEqual(self.complex_ast_tree.evaluate(), 0xdeadbeaf)
+
+
+
+class TestDeepRelease(unittest.TestCase):
+
+    """Test the release of deep ASTs."""
+
+    def test_reference_chain(self):
+        """A long chain of references is released without recursion."""
+        ctx = TritonContext(ARCH.X86_64)
+        ast = ctx.getAstContext()
+
+        node = ast.variable(ctx.newSymbolicVariable(64))
+        for _ in range(200000):
+            node = ast.reference(ctx.newSymbolicExpression(node + 1))
+        self.assertEqual(len(ctx.getSymbolicExpressions()), 200000)
+
+        del node
+        self.assertEqual(len(ctx.getSymbolicExpressions()), 0)
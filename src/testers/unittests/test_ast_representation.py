@@ -2,6 +2,10 @@
 # coding: utf-8
 """Test AST representation."""
 
+import os
+import shutil
+import subprocess
+import tempfile
 import unittest
 
 from triton import TritonContext, ARCH, AST_REPRESENTATION, VERSION
@@ -280,3 +284,153 @@ class TestAstRepresentation(unittest.TestCase):
                 self.assertNotEqual(len(self.ctx.liftToLLVM(n, fname="test", optimize=True)), 0)
             # Dot
             self.assertNotEqual(len(self.ctx.liftToDot(n)), 0)
+            self.assertNotEqual(len(self.ctx.liftToDot(n, maxNodes=4)), 0)
+            # BTOR2
+            self.assertNotEqual(len(self.ctx.liftToBTOR2(n)), 0)
+
+    def test_lifting_dot_budget(self):
+        # A chain of additions sharing its previous links
+        node = self.v1
+        for i in range(300):
+            node = node + node
+
+        dot = self.ctx.liftToDot(node, maxNodes=10)
+        self.assertTrue(dot.startswith("digraph triton {"))
+        self.assertEqual(dot.count(" [label="), 11)
+        self.assertEqual(dot.count("style=dashed"), 1)
+        self.assertIn("BVADD ... >256 nodes", dot)
+
+        # The shared links are emitted once, everything fits without limit
+        dot = self.ctx.liftToDot(node, maxNodes=0, maxDepth=0)
+        self.assertEqual(dot.count(" [label="), 301)
+        self.assertEqual(dot.count("style=dashed"), 0)
+
+        dot = self.ctx.liftToDot(node, maxDepth=3)
+        self.assertEqual(dot.count(" [label="), 4)
+        self.assertEqual(dot.count("style=dashed"), 1)
+
+        # A small subtree is summarized with its exact size
+        dot = self.ctx.liftToDot(self.ast.bvnot(self.v1 + self.v2), maxDepth=1)
+        self.assertIn("BVADD ... 3 nodes", dot)
+
+    def test_lifting_btor2(self):
+        btor2 = self.ctx.liftToBTOR2(self.v1 + self.v2 == 3)
+        self.assertEqual(btor2, "1 sort bitvec 8\n"
+                                "2 consth 1 3\n"
+                                "3 input 1 SymVar_1\n"
+                                "4 input 1 SymVar_0\n"
+                                "5 add 1 4 3\n"
+                                "6 sort bitvec 1\n"
+                                "7 eq 6 5 2\n"
+                                "8 bad 7\n")
+
+        # The shared nodes and the references are lifted once
+        node = self.ast.reference(self.ref) * self.ast.reference(self.ref)
+        btor2 = self.ctx.liftToBTOR2(node)
+        self.assertEqual(btor2.count(" input "), 2)
+        self.assertEqual(btor2.count(" add "), 1)
+        self.assertTrue(btor2.endswith("5 mul 1 4 4\n6 output 5\n"))
+
+        # The arrays are states initialized to zero
+        mem = self.ast.store(self.ast.array(32), self.ast.bv(0x1000, 32), self.v1)
+        btor2 = self.ctx.liftToBTOR2(self.ast.select(mem, self.ast.zx(24, self.v2)) == self.v2)
+        for op in [" sort array ", " state ", " init ", " write ", " read "]:
+            self.assertEqual(btor2.count(op), 1)
+
+        with self.assertRaises(Exception):
+            self.ctx.liftToBTOR2(self.ast.forall([self.v1], 1 == self.v1))
+
+    def test_lifting_c(self):
+        self.ctx.setAstRepresentationMode(AST_REPRESENTATION.C)
+        self.assertEqual(str(self.v1 + self.v2), "(((uint64_t)SymVar_0 + SymVar_1) & 0xffull)")
+        self.assertEqual(str(self.ast.sx(8, self.v1)), "(((uint64_t)triton_sx64(SymVar_0, 8)) & 0xffffull)")
+        self.assertEqual(str(self.ast.reference(self.ref)), "ref_0")
+        self.ctx.setAstRepresentationMode(AST_REPRESENTATION.SMT)
+
+        v3 = self.ast.variable(self.ctx.newSymbolicVariable(128))
+        nodes = [
+            self.ast.bvsdiv(self.v1, self.v2),
+            self.ast.bvsmod(self.v1, self.v2),
+            self.ast.bvsrem(self.v1, self.v2),
+            self.ast.bvashr(self.v1, self.ast.bv(3, 8)),
+            self.ast.bvrol(self.v1, self.ast.bv(3, 8)),
+            self.ast.bswap(self.ast.concat([self.v1, self.v2])),
+            self.ast.bvslt(self.v1, self.v2),
+            self.ast.sx(56, self.v1),
+            self.ast.reference(self.ref) * self.ast.reference(self.ref),
+            self.ast.bvmul(v3, v3),
+            self.ast.extract(127, 64, v3 + self.ast.zx(120, self.v1)),
+            self.ast.bvudiv(v3, self.ast.bv(0, 128)),
+        ]
+
+        # The 128-bit helpers are only defined when needed
+        code = self.ctx.liftToC(nodes[:9], fname="test")
+        self.assertNotIn("__int128", code)
+        self.assertIn("void test(uint8_t SymVar_0, uint8_t SymVar_1, uint8_t* out_0", code)
+        self.assertIn("const uint8_t ref_0 = (((uint64_t)SymVar_0 + SymVar_1) & 0xffull); // ref test", code)
+
+        code = self.ctx.liftToC(nodes, fname="test")
+        self.assertIn("typedef unsigned __int128 triton_uint128;", code)
+        self.assertTrue(self.ctx.liftToC(self.v1 == 1).startswith("#include"))
+
+        cc = shutil.which("cc")
+        if cc is None:
+            return
+
+        # The compiled function matches the evaluation of the nodes
+        inputs = {0: 0xc3, 1: 0x05, 2: 0x8000000000000001fedcba9876543210}
+        types = ["bool" if n.isLogical() else "uint8_t" if n.getBitvectorSize() <= 8 else "uint16_t" if n.getBitvectorSize() <= 16 else
+                 "uint32_t" if n.getBitvectorSize() <= 32 else "uint64_t" if n.getBitvectorSize() <= 64 else "triton_uint128" for n in nodes]
+
+        main  = "#include <stdio.h>\nint main(void) {\n"
+        main += "".join("  %s o%d;\n" % (t, i) for i, t in enumerate(types))
+        main += "  test(0x%x, 0x%x, ((triton_uint128)0x%xull << 64) | 0x%xull, " % (inputs[0], inputs[1], inputs[2] >> 64, inputs[2] & 0xffffffffffffffff)
+        main += ", ".join("&o%d" % i for i in range(len(nodes))) + ");\n"
+        main += "".join('  printf("%%llx %%llx\\n", (unsigned long long)((triton_uint128)o%d >> 64), (unsigned long long)o%d);\n' % (i, i) for i in range(len(nodes)))
+        main += "  return 0;\n}\n"
+
+        with tempfile.TemporaryDirectory() as tmp:
+            src = os.path.join(tmp, "test.c")
+            exe = os.path.join(tmp, "test")
+            with open(src, "w") as f:
+                f.write(code + main)
+            subprocess.check_call([cc, "-O1", "-o", exe, src])
+            output = subprocess.check_output([exe]).decode().split("\n")
+
+        for i, n in enumerate(nodes):
+            high, low = output[i].split()
+            self.assertEqual((int(high, 16) << 64) | int(low, 16), self.ctx.evaluateAstViaModel(n, inputs))
+
+    def test_parse_smt(self):
+        # A round trip of the SMT lifting, with its bswap functions and its references
+        node = self.ast.bswap(self.ast.concat([self.v1, self.v2])) + self.ast.zx(8, self.ast.reference(self.ref))
+        swap = self.ctx.newSymbolicExpression(node, "swap")
+        cond = self.ctx.newSymbolicExpression(self.ast.land([self.ast.reference(swap) == 0x1234, self.ast.bvrol(self.v1, self.ast.bv(3, 8)) != self.v2]))
+
+        asserts = self.ctx.parseSmt(self.ctx.liftToSMT(cond, assert_=True))
+        self.assertEqual(len(asserts), 2)
+        self.assertFalse(self.ctx.isSat(self.ast.lnot(self.ast.iff(self.ast.land(asserts), cond.getAst()))))
+
+        # The declared constants are the variables of the context
+        for inputs in [{0: 0x10, 1: 0x02}, {0: 0xc3, 1: 0x05}]:
+            self.assertEqual(self.ctx.evaluateAstViaModel(self.ast.land(asserts), inputs), self.ctx.evaluateAstViaModel(cond.getAst(), inputs))
+
+        # New constants become new variables, aliased by their name
+        asserts = self.ctx.parseSmt("""
+            (set-logic QF_ABV)
+            (declare-fun input () (_ BitVec 16))
+            (define-fun Memory () (Array (_ BitVec 64) (_ BitVec 8)) ((as const (Array (_ BitVec 64) (_ BitVec 8))) (_ bv0 8)))
+            (assert (let ((low ((_ extract 7 0) input)) (high ((_ extract 15 8) input)))
+              (and (= (concat high low) #x4142) (=> (bvult low high) (= (select (store Memory #x0000000000001000 low) (_ bv4096 64)) #b01000010)))))
+            (check-sat)
+            (get-model)
+        """)
+        self.assertEqual(len(asserts), 1)
+        var = self.ctx.getSymbolicVariable("input")
+        self.assertEqual(var.getBitSize(), 16)
+        self.assertEqual(self.ctx.getModel(asserts[0])[var.getId()].getValue(), 0x4142)
+
+        with self.assertRaises(Exception):
+            self.ctx.parseSmt("(assert (forall ((x (_ BitVec 8))) (= x x)))")
+        with self.assertRaises(Exception):
+            self.ctx.parseSmt("(assert (= unknown (_ bv1 8)))")
@@ -740,3 +740,143 @@ class TestAstSimplificationLLVM(unittest.TestCase):
             r = str(o) == "(bvxor y x)" or str(o) == "(bvxor x y)"
             self.assertTrue(r)
         return
+
+    def test_batch(self):
+        if VERSION.LLVM_INTERFACE is True:
+            x = self.ast.variable(self.ctx.newSymbolicVariable(8, 'x'))
+            y = self.ast.variable(self.ctx.newSymbolicVariable(8, 'y'))
+            n1 = (x & ~y) | (~x & y)
+            n2 = (x | y) - (x & y)
+            o = self.ctx.simplify([n1, n2], llvm=True)
+            self.assertEqual(len(o), 2)
+            for n in o:
+                self.assertTrue(str(n) == "(bvxor y x)" or str(n) == "(bvxor x y)")
+        return
+
+    def test_lift_block(self):
+        if VERSION.LLVM_INTERFACE is True:
+            block = BasicBlock([
+                Instruction(b"\x48\x01\xd8"), # add rax, rbx
+                Instruction(b"\x48\x31\xc1"), # xor rcx, rax
+            ])
+            self.ctx.symbolizeRegister(self.ctx.registers.rax, 'rax')
+            self.ctx.symbolizeRegister(self.ctx.registers.rbx, 'rbx')
+            self.ctx.symbolizeRegister(self.ctx.registers.rcx, 'rcx')
+            self.ctx.processing(block)
+            ir = self.ctx.liftToLLVM(block, fname="block", optimize=True)
+            self.assertIn("@block(", ir)
+            self.assertIn("memory", ir)
+        return
+
+    def test_batch_duplicates(self):
+        if VERSION.LLVM_INTERFACE is True:
+            x = self.ast.variable(self.ctx.newSymbolicVariable(8, 'x'))
+            y = self.ast.variable(self.ctx.newSymbolicVariable(8, 'y'))
+            o = self.ctx.simplify([(x & ~y) | (~x & y), (x & ~y) | (~x & y), x + 0], llvm=True)
+            self.assertEqual(len(o), 3)
+            self.assertEqual(str(o[0]), str(o[1]))
+            self.assertEqual(str(o[2]), "x")
+        return
+
+
+class TestAstSimplificationMBA(unittest.TestCase):
+
+    """Testing the normalization of the linear MBA"""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setMode(MODE.MBA_SIMPLIFICATION, True)
+        self.ast = self.ctx.getAstContext()
+        self.x = self.ast.variable(self.ctx.newSymbolicVariable(8, 'x'))
+        self.y = self.ast.variable(self.ctx.newSymbolicVariable(8, 'y'))
+        self.z = self.ast.variable(self.ctx.newSymbolicVariable(8, 'z'))
+
+    def proof(self, n):
+        return self.ctx.isSat(self.ast.lnot(n)) == False
+
+    def test_sum(self):
+        n = (self.x ^ self.y) + 2 * (self.x & self.y)
+        self.assertEqual(str(self.ctx.simplify(n)), "(bvadd x y)")
+
+    def test_bitwise(self):
+        n = (self.x | self.y) - (self.x & self.y)
+        self.assertEqual(str(self.ctx.simplify(n)), "(bvxor x y)")
+
+    def test_constant(self):
+        n = (self.x & ~self.x) + 3
+        self.assertEqual(str(self.ctx.simplify(n)), "(_ bv3 8)")
+
+    def test_atoms(self):
+        m = self.x * self.y
+        n = ((m ^ self.z) + 2 * (m & self.z)) * 5
+        s = self.ctx.simplify(n)
+        self.assertTrue(self.proof(s == n))
+        self.assertEqual(str(s), "(bvmul (bvadd (bvmul x y) z) (_ bv5 8))")
+
+    def test_equivalence(self):
+        n = (self.x + self.y) - 2 * (self.x | ~self.z) + 3 * (~self.x & self.y & self.z) - (self.y ^ self.z)
+        s = self.ctx.simplify(n)
+        self.assertTrue(self.proof(s == n))
+
+    def test_disabled(self):
+        self.ctx.setMode(MODE.MBA_SIMPLIFICATION, False)
+        n = (self.x ^ self.y) + 2 * (self.x & self.y)
+        self.assertEqual(str(self.ctx.simplify(n)), str(n))
+
+
+class TestAstBalancing(unittest.TestCase):
+
+    """Testing the balancing of the associative chains."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.vars = [self.ast.variable(self.ctx.newSymbolicVariable(32, 'v%d' % i)) for i in range(8)]
+        for i, v in enumerate(self.vars):
+            self.ctx.setConcreteVariableValue(v.getSymbolicVariable(), i * 0x1234567 + 1)
+
+    def chain(self, count):
+        n = self.vars[0]
+        for i in range(1, count):
+            n = n + self.vars[i % len(self.vars)]
+        return n
+
+    def test_builders(self):
+        self.assertGreater(self.chain(1024).getLevel(), 1000)
+        self.ctx.setMode(MODE.AST_BALANCING, True)
+        n = self.chain(1024)
+        self.assertLess(n.getLevel(), 32)
+        self.ctx.setMode(MODE.AST_BALANCING, False)
+        self.assertEqual(n.evaluate(), self.chain(1024).evaluate())
+
+    def test_balance(self):
+        n = self.chain(1000)
+        b = self.ast.balance(n)
+        self.assertEqual(b.getLevel(), 11)
+        self.assertEqual(b.evaluate(), n.evaluate())
+
+        c = self.ast.equal(self.vars[0], self.vars[0])
+        for v in self.vars:
+            c = self.ast.land(c, self.ast.bvult(v, self.ast.bv(0x80000000, 32)))
+        b = self.ast.balance(c)
+        self.assertEqual(b.getType(), AST_NODE.LAND)
+        self.assertEqual(len(b.getChildren()), len(self.vars) + 1)
+        self.assertEqual(b.evaluate(), c.evaluate())
+
+    def test_references(self):
+        self.ctx.setMode(MODE.AST_BALANCING, True)
+        self.ctx.symbolizeRegister(self.ctx.registers.rax)
+        self.ctx.symbolizeRegister(self.ctx.registers.rbx)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rbx, 3)
+        for _ in range(256):
+            # add rax, rbx
+            self.ctx.processing(Instruction(b"\x48\x01\xd8"))
+        rax = self.ctx.getSymbolicRegister(self.ctx.registers.rax).getAst()
+        self.assertLess(rax.getLevel(), 64)
+        self.assertEqual(rax.evaluate(), self.ctx.getConcreteRegisterValue(self.ctx.registers.rax))
+
+    def test_solver(self):
+        self.ctx.setMode(MODE.AST_BALANCING, True)
+        n = self.ast.balance(self.chain(1000))
+        model = self.ctx.getModel(n == 0)
+        self.assertGreater(len(model), 0)
@@ -55,3 +55,100 @@ class TestAstUtils(unittest.TestCase):
         self.assertEqual(str(self.astCtxt.dereference(r2)), "SymVar_0")
         self.assertEqual(str(self.astCtxt.dereference(r1)), "SymVar_0")
         self.assertEqual(str(self.astCtxt.dereference(self.v1)), "SymVar_0")
+
+    def test_substitute(self):
+        five = self.astCtxt.bv(5, 8)
+        shared = self.v1 * 3
+        n = (shared + self.v2) ^ shared
+        before = str(n)
+
+        m = self.astCtxt.substitute(n, [(self.v2, five)])
+        self.assertEqual(m.evaluate(), 5)
+        self.assertEqual(str(n), before)
+        self.assertTrue(str(shared) in str(m))
+
+        # The unchanged references are kept, the others are unrolled
+        r = self.astCtxt.reference(self.ctx.newSymbolicExpression(self.v1 + 1))
+        node = r * self.v2
+        self.assertTrue("ref!" in str(self.astCtxt.substitute(node, [(self.v2, five)])))
+        m = self.astCtxt.substitute(node, [(self.v1, self.astCtxt.bv(2, 8)), (self.v2, five)])
+        self.assertEqual(m.evaluate(), 15)
+        self.assertFalse("ref!" in str(m))
+
+        # Several roots at once
+        l = self.astCtxt.substitute([n, shared], [(self.v1, five)])
+        self.assertEqual(len(l), 2)
+        self.assertEqual(l[1].evaluate(), 15)
+
+        # In place on an owned node
+        owned = self.v1 + self.v2
+        self.assertEqual(self.astCtxt.substitute(owned, [(self.v2, five)], True).evaluate(), 5)
+        self.assertEqual(owned.evaluate(), 5)
+
+        self.assertRaises(TypeError, self.astCtxt.substitute, n, [(self.v1, self.astCtxt.bv(1, 16))])
+
+
+class TestAstNodeWrappers(unittest.TestCase):
+
+    """Testing the AstNode objects shared by node and the native walk."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.x = self.ast.variable(self.ctx.newSymbolicVariable(8))
+        self.y = self.ast.variable(self.ctx.newSymbolicVariable(8))
+
+    def test_same_object(self):
+        node = (self.x + self.y) ^ self.x
+        children = node.getChildren()
+        self.assertIsInstance(children, tuple)
+        self.assertIs(children[1], self.x)
+        self.assertIs(node.getChildren()[0], children[0])
+        self.assertIs(children[0].getChildren()[1], self.y)
+
+    def test_walk(self):
+        node = (self.x + self.y) ^ self.x
+        nodes = node.walk()
+        self.assertIs(nodes[0], node)
+        self.assertEqual(len(nodes), 4)
+        self.assertEqual(len(set(nodes)), 4)
+
+        leaves = node.walk(True)
+        self.assertIs(leaves[-1], node)
+        self.assertEqual(leaves[0].getType(), AST_NODE.VARIABLE)
+
+    def test_walk_unroll(self):
+        expr = self.ctx.newSymbolicExpression(self.x + 1)
+        node = self.ast.reference(expr) * self.y
+        self.assertFalse(any(n.getType() == AST_NODE.BVADD for n in node.walk()))
+        self.assertTrue(any(n.getType() == AST_NODE.BVADD for n in node.walk(False, True)))
+
+    def test_summaries(self):
+        z = self.ast.variable(self.ctx.newSymbolicVariable(8))
+        ids = sorted(n.getSymbolicVariable().getId() for n in [self.x, self.y])
+
+        node = (self.x + self.y) ^ self.x
+        self.assertEqual(node.getVariableIds(), ids)
+        # The shared x is counted under both of its parents
+        self.assertEqual(node.getDagSizeEstimate(), 5)
+        self.assertTrue(node.sharesVariablesWith(self.y))
+        self.assertFalse(node.sharesVariablesWith(z * 3))
+        self.assertFalse(node.containsArray())
+
+        # The references and the children set afterwards are included
+        expr = self.ctx.newSymbolicExpression(z + 1)
+        ref = self.ast.reference(expr) * self.y
+        self.assertEqual(ref.getVariableIds(), sorted([z.getSymbolicVariable().getId(), self.y.getSymbolicVariable().getId()]))
+        self.assertEqual(ref.getDagSizeEstimate(), 6)
+        node.setChild(1, z)
+        self.assertTrue(node.sharesVariablesWith(ref))
+
+        mem = self.ast.select(self.ast.store(self.ast.array(32), 0x1000, self.x), 0x1000)
+        self.assertTrue(mem.containsArray())
+        self.assertEqual(mem.getVariableIds(), [self.x.getSymbolicVariable().getId()])
+
+        # Past 256 variables, the set is gathered from the subtrees
+        big = self.x
+        for i in range(300):
+            big = big + self.ast.variable(self.ctx.newSymbolicVariable(8))
+        self.assertEqual(len(big.getVariableIds()), 301)
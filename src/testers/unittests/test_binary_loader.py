@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the binary loader."""
+
+import os
+import struct
+import tempfile
+import unittest
+from triton import *
+
+
+class TestBinaryLoader(unittest.TestCase):
+
+    """Testing loadBinary."""
+
+    def setUp(self):
+        """Write a small ELF64 file with one PT_LOAD segment."""
+        self.ctx = TritonContext(ARCH.X86_64)
+
+        header  = b"\x7fELF\x02\x01\x01" + b"\x00" * 9
+        header += struct.pack("<HHIQQQIHHHHHH", 2, 0x3e, 1, 0x400078, 0x40, 0, 0, 0x40, 0x38, 1, 0x40, 0, 0)
+        phdr    = struct.pack("<IIQQQQQQ", 1, 5, 0, 0x400000, 0x400000, 0x80, 0x2000, 0x1000)
+        code    = b"\x48\xc7\xc0\x2a\x00\x00\x00\x90"  # mov rax, 42; nop
+
+        fd, self.path = tempfile.mkstemp()
+        with os.fdopen(fd, "wb") as f:
+            f.write(header + phdr + code)
+
+    def tearDown(self):
+        """Remove the file."""
+        os.remove(self.path)
+
+    def test_load(self):
+        """Map the file and execute its code."""
+        self.assertEqual(self.ctx.loadBinary(self.path), [(0x400000, 0x2000)])
+        self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x400078, 8), b"\x48\xc7\xc0\x2a\x00\x00\x00\x90")
+        self.assertTrue(self.ctx.isConcreteMemoryValueDefined(0x400000, 0x2000))
+        self.assertEqual(self.ctx.getConcreteMemoryValue(0x401fff), 0)
+
+        inst = Instruction(0x400078, self.ctx.getConcreteMemoryAreaValue(0x400078, 7))
+        self.ctx.processing(inst)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 42)
+
+    def test_write(self):
+        """Writes do not modify the file."""
+        self.ctx.loadBinary(self.path)
+        self.ctx.setConcreteMemoryValue(0x400078, 0xcc)
+        self.assertEqual(self.ctx.getConcreteMemoryValue(0x400078), 0xcc)
+        with open(self.path, "rb") as f:
+            self.assertEqual(f.read()[0x78], 0x48)
+
+    def test_invalid(self):
+        """Invalid files raise an exception."""
+        with open(self.path, "wb") as f:
+            f.write(b"\x00" * 16)
+        self.assertRaises(Exception, self.ctx.loadBinary, self.path)
@@ -2,6 +2,7 @@
 # coding: utf-8
 """Test callback."""
 
+import ctypes
 import unittest
 
 from triton import (TritonContext, ARCH, CALLBACK, Instruction, MemoryAccess)
@@ -28,6 +29,29 @@ class TestCallback(unittest.TestCase):
         self.Triton.processing(Instruction(b"\x48\xa1\x00\x10\x00\x00\x00\x00\x00\x00"))
         self.assertFalse(flag)
 
+    def test_get_concrete_memory_page(self):
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+
+        faults = []
+        def cb_page(api, addr):
+            faults.append(addr)
+            return b"\x41" * 0x1000 if addr == 0x1000 else None
+
+        self.Triton.addCallback(CALLBACK.GET_CONCRETE_MEMORY_PAGE, cb_page)
+        # movabs rax, qword ptr [0x1ffc]
+        self.Triton.processing(Instruction(b"\x48\xa1\xfc\x1f\x00\x00\x00\x00\x00\x00"))
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rax), 0x41414141)
+        self.assertEqual(faults, [0x1000, 0x2000])
+
+        # Pages fault only once
+        self.Triton.processing(Instruction(b"\x48\xa1\xfc\x1f\x00\x00\x00\x00\x00\x00"))
+        self.assertEqual(faults, [0x1000, 0x2000])
+
+        self.Triton.removeCallback(CALLBACK.GET_CONCRETE_MEMORY_PAGE, cb_page)
+        self.assertEqual(self.Triton.getConcreteMemoryValue(0x3000), 0)
+        self.assertEqual(faults, [0x1000, 0x2000])
+
     def test_get_concrete_register_value(self):
         global flag
         self.Triton = TritonContext()
@@ -54,6 +78,35 @@ class TestCallback(unittest.TestCase):
         self.Triton.processing(Instruction(b"\x48\x89\xd8"))  # mov rax, rbx
         self.assertFalse(flag)
 
+    def test_watched_callbacks(self):
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+
+        loads = []
+        regs = []
+        def cb_load(api, mem):
+            loads.append(mem.getAddress())
+        def cb_reg(api, reg):
+            regs.append(reg.getName())
+
+        self.Triton.addCallback(CALLBACK.GET_CONCRETE_MEMORY_VALUE, cb_load, [(0x2000, 0x10), MemoryAccess(0x2010, 8)])
+        self.Triton.addCallback(CALLBACK.GET_CONCRETE_REGISTER_VALUE, cb_reg, [self.Triton.registers.rbx])
+        # movabs rax, qword ptr [0x1000]
+        self.Triton.processing(Instruction(b"\x48\xa1\x00\x10\x00\x00\x00\x00\x00\x00"))
+        # movabs rax, qword ptr [0x2014]
+        self.Triton.processing(Instruction(b"\x48\xa1\x14\x20\x00\x00\x00\x00\x00\x00"))
+        self.assertEqual(loads, [0x2014])
+
+        self.Triton.processing(Instruction(b"\x48\x89\xc8"))  # mov rax, rcx
+        self.assertEqual(regs, [])
+        self.Triton.processing(Instruction(b"\x89\xd8"))      # mov eax, ebx
+        self.assertIn("ebx", regs)
+
+        # The filtered callbacks are removed as the others
+        self.Triton.removeCallback(CALLBACK.GET_CONCRETE_MEMORY_VALUE, cb_load)
+        self.Triton.processing(Instruction(b"\x48\xa1\x14\x20\x00\x00\x00\x00\x00\x00"))
+        self.assertEqual(loads, [0x2014])
+
     @staticmethod
     def cb_flag(api, x):
         global flag
@@ -109,3 +162,50 @@ class TestCallback(unittest.TestCase):
 
         test_call(False)
         test_call(True)
+
+
+GET_MEMORY = ctypes.CFUNCTYPE(ctypes.c_int, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32)
+SET_REGISTER = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32)
+
+
+class TestNativeCallback(unittest.TestCase):
+
+    """Testing callbacks given as C functions."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.stores = []
+
+        def load(user, addr, value, size):
+            for i in range(size):
+                value[i] = 0xcc
+            return 1
+
+        def put(user, rid, value, size):
+            self.stores.append((user, bytes(value[:size])))
+
+        # The C functions must outlive the callbacks
+        self.load = GET_MEMORY(load)
+        self.put = SET_REGISTER(put)
+
+    def address(self, function):
+        return ctypes.cast(function, ctypes.c_void_p).value
+
+    def test_get_memory(self):
+        self.ctx.addNativeCallback(CALLBACK.GET_CONCRETE_MEMORY_VALUE, self.address(self.load))
+        self.assertEqual(self.ctx.getConcreteMemoryValue(MemoryAccess(0x1000, 4)), 0xcccccccc)
+        self.assertTrue(self.ctx.isConcreteMemoryValueDefined(0x1000, 4))
+
+        self.ctx.removeNativeCallback(CALLBACK.GET_CONCRETE_MEMORY_VALUE, self.address(self.load))
+        self.assertEqual(self.ctx.getConcreteMemoryValue(MemoryAccess(0x2000, 4)), 0)
+
+    def test_set_register(self):
+        self.ctx.addNativeCallback(CALLBACK.SET_CONCRETE_REGISTER_VALUE, self.address(self.put), 42)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.ax, 0x1234)
+        self.assertEqual(self.stores, [(42, b"\x34\x12")])
+
+    def test_invalid(self):
+        with self.assertRaises(TypeError):
+            self.ctx.addNativeCallback(CALLBACK.SYMBOLIC_SIMPLIFICATION, self.address(self.load))
+        with self.assertRaises(TypeError):
+            self.ctx.addNativeCallback(CALLBACK.GET_CONCRETE_MEMORY_VALUE, 0)
@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the checkpoints of a context."""
+
+import os
+import tempfile
+import unittest
+from triton import *
+
+
+class TestCheckpoint(unittest.TestCase):
+
+    """Testing save and load."""
+
+    def setUp(self):
+        """Build a state to save."""
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setMode(MODE.ALIGNED_MEMORY, True)
+        self.ctx.setConcreteMemoryAreaValue(0x1000, b"\x11" * 0x2000)
+        self.ctx.setConcreteMemoryAreaValue(0x8010, b"\x22\x33")
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rbx, 0x8010)
+
+        self.ctx.symbolizeRegister(self.ctx.registers.rax, "rax")
+        # add rax, 1 ; mov word ptr [rbx], ax
+        self.ctx.processing(Instruction(0x400000, b"\x48\x83\xc0\x01"))
+        self.ctx.processing(Instruction(0x400004, b"\x66\x89\x03"))
+
+        rax = self.ctx.getSymbolicRegister(self.ctx.registers.rax).getAst()
+        self.ctx.pushPathConstraint(rax == 10, "rax is 10")
+
+        self.ctx.taintMemoryWithLabel(0x1008, 4, 7)
+        self.ctx.taintRegisterWithLabel(self.ctx.registers.rcx, 65)
+
+        fd, self.path = tempfile.mkstemp()
+        os.close(fd)
+        self.ctx.save(self.path)
+
+    def tearDown(self):
+        """Remove the file."""
+        os.remove(self.path)
+
+    def test_concrete(self):
+        """The memory and the registers are restored."""
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setConcreteMemoryAreaValue(0x50000, b"\xff")
+        ctx.load(self.path)
+        self.assertTrue(ctx.isModeEnabled(MODE.ALIGNED_MEMORY))
+        self.assertEqual(ctx.getConcreteMemoryAreaValue(0x1000, 0x2000), b"\x11" * 0x2000)
+        self.assertEqual(ctx.getConcreteMemoryAreaValue(0x8010, 2), self.ctx.getConcreteMemoryAreaValue(0x8010, 2))
+        self.assertFalse(ctx.isConcreteMemoryValueDefined(0x8012))
+        self.assertFalse(ctx.isConcreteMemoryValueDefined(0x50000))
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rbx), 0x8010)
+
+        # The mapped pages are copied when written
+        ctx.setConcreteMemoryValue(0x1000, 0x42)
+        self.assertEqual(ctx.getConcreteMemoryValue(0x1000), 0x42)
+        self.assertEqual(ctx.getConcreteMemoryValue(0x1001), 0x11)
+
+    def test_symbolic(self):
+        """The expressions keep their ids and their variables."""
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.load(self.path)
+        self.assertTrue(ctx.isRegisterSymbolized(ctx.registers.rax))
+        self.assertTrue(ctx.isMemorySymbolized(MemoryAccess(0x8010, 2)))
+        self.assertFalse(ctx.isRegisterSymbolized(ctx.registers.rbx))
+        self.assertEqual(len(ctx.getSymbolicVariables()), 1)
+
+        expr = ctx.getSymbolicRegister(ctx.registers.rax)
+        self.assertEqual(expr.getId(), self.ctx.getSymbolicRegister(self.ctx.registers.rax).getId())
+        self.assertEqual(str(expr.getAst()), str(self.ctx.getSymbolicRegister(self.ctx.registers.rax).getAst()))
+
+        # The new expressions and variables do not reuse the saved ids
+        var = ctx.symbolizeRegister(ctx.registers.rdx)
+        self.assertNotEqual(var.getId(), 0)
+
+    def test_path_constraints(self):
+        """The path constraints are restored and solved."""
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.load(self.path)
+        pcs = ctx.getPathConstraints()
+        self.assertEqual(len(pcs), 1)
+        self.assertEqual(pcs[0].getComment(), "rax is 10")
+        model = ctx.getModel(ctx.getPathPredicate())
+        self.assertEqual(list(model.values())[0].getValue(), 9)
+
+    def test_taint(self):
+        """The taint and its labels are restored."""
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.load(self.path)
+        self.assertTrue(ctx.isMemoryTainted(MemoryAccess(0x1008, 4)))
+        self.assertFalse(ctx.isMemoryTainted(0x100c))
+        self.assertTrue(ctx.isRegisterTainted(ctx.registers.rcx))
+        self.assertEqual(ctx.getMemoryTaintLabels(0x1008, 4), [7])
+        self.assertEqual(ctx.getRegisterTaintLabels(ctx.registers.ecx), [65])
+
+    def test_modes(self):
+        """The modes are restored by name, whatever their position in the enum."""
+        enabled = [MODE.ALIGNED_MEMORY, MODE.LAZY_FLAGS, MODE.MEMORY_ARRAY, MODE.PC_TRACKING_SYMBOLIC, MODE.TAINT_THROUGH_POINTERS]
+        disabled = [MODE.AST_BALANCING, MODE.CONSTANT_FOLDING, MODE.LAZY_SUBREGISTERS, MODE.ONLY_ON_TAINTED, MODE.SYMBOLIZE_LOAD, MODE.TAINT_ONLY]
+
+        src = TritonContext(ARCH.X86_64)
+        for mode in enabled:
+            src.setMode(mode, True)
+
+        fd, path = tempfile.mkstemp()
+        os.close(fd)
+        try:
+            src.save(path)
+            ctx = TritonContext(ARCH.X86_64)
+            ctx.setMode(MODE.TAINT_ONLY, True)
+            ctx.load(path)
+        finally:
+            os.remove(path)
+
+        for mode in enabled:
+            self.assertTrue(ctx.isModeEnabled(mode))
+        for mode in disabled:
+            self.assertFalse(ctx.isModeEnabled(mode))
+
+    def test_invalid(self):
+        """A checkpoint must be of the architecture of the context."""
+        ctx = TritonContext(ARCH.AARCH64)
+        with self.assertRaises(Exception):
+            ctx.load(self.path)
+
+    def test_register_layout(self):
+        """A register file of another layout is rejected, even of the same size."""
+        src = TritonContext(ARCH.X86_64)
+        fd, path = tempfile.mkstemp()
+        os.close(fd)
+        try:
+            src.save(path)
+            # Header (24 bytes), no enabled mode (8 bytes), register count (8 bytes), then the layout digest
+            with open(path, "r+b") as f:
+                f.seek(40)
+                digest = f.read(1)
+                f.seek(40)
+                f.write(bytes([digest[0] ^ 0xff]))
+            ctx = TritonContext(ARCH.X86_64)
+            with self.assertRaises(Exception):
+                ctx.load(path)
+        finally:
+            os.remove(path)
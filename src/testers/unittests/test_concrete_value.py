@@ -181,6 +181,25 @@ class TestX86ConcreteMemoryValue(unittest.TestCase):
         self.ctx.setConcreteMemoryAreaValue(0x1006, [0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc])
         self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x1000, 12), b"\x11\x22\x33\x44\x55\x66\x77\x88\x99\xaa\xbb\xcc")
 
+    def test_buffer_protocol(self):
+        data = bytearray(range(256)) * 16
+
+        # Any bytes-like object is accepted
+        self.ctx.setConcreteMemoryAreaValue(0x2000, memoryview(data)[16:32])
+        self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x2000, 16), bytes(range(16, 32)))
+        self.ctx.setConcreteMemoryAreaValue(0x3000, data)
+        self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x3000, len(data), callbacks=False), bytes(data))
+
+        # The memory is read into the caller buffer
+        out = bytearray(64)
+        self.assertEqual(self.ctx.readConcreteMemoryInto(0x3000, out), 64)
+        self.assertEqual(out, data[:64])
+        self.assertEqual(self.ctx.readConcreteMemoryInto(0x2000, memoryview(out)[8:24]), 16)
+        self.assertEqual(out[8:24], bytes(range(16, 32)))
+
+        with self.assertRaises(TypeError):
+            self.ctx.readConcreteMemoryInto(0x2000, b"read-only")
+
 
 class TestAArch64ConcreteMemoryValue(unittest.TestCase):
 
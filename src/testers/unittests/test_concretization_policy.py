@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the concretization policy."""
+
+import unittest
+from triton import *
+
+
+class TestConcretizationPolicy(unittest.TestCase):
+
+    """Testing the concretization rules."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.ctx = TritonContext(ARCH.X86_64)
+
+    def test_large_expressions(self):
+        self.ctx.addConcretizationRule(CONCRETIZATION.LARGE_EXPRESSIONS, 20)
+        self.ctx.symbolizeRegister(self.ctx.registers.rax)
+        for _ in range(30):
+            self.ctx.processing(Instruction(b"\x48\x01\xc0"))  # add rax, rax
+        events = [e for e in self.ctx.getConcretizationEvents() if e['register'] == self.ctx.registers.rax]
+        self.assertGreater(len(events), 0)
+        self.assertEqual(events[0]['rule'], CONCRETIZATION.LARGE_EXPRESSIONS)
+        self.assertEqual(events[0]['size'], 0)
+
+    def test_outside_regions(self):
+        self.ctx.addConcretizationRule(CONCRETIZATION.OUTSIDE_REGIONS)
+        self.ctx.addSymbolicRegion(0x1000, 8)
+        self.ctx.symbolizeRegister(self.ctx.registers.rax)
+        self.ctx.processing(Instruction(0x100, b"\x48\x89\x04\x25\x00\x10\x00\x00"))  # mov [0x1000], rax
+        self.ctx.processing(Instruction(0x108, b"\x48\x89\x04\x25\x00\x20\x00\x00"))  # mov [0x2000], rax
+        self.assertTrue(self.ctx.isMemorySymbolized(MemoryAccess(0x1000, 8)))
+        self.assertFalse(self.ctx.isMemorySymbolized(MemoryAccess(0x2000, 8)))
+        events = self.ctx.getConcretizationEvents()
+        self.assertEqual(len(events), 1)
+        self.assertEqual(events[0]['address'], 0x108)
+        self.assertEqual(events[0]['register'], None)
+        self.assertEqual(events[0]['memory'], 0x2000)
+        self.assertEqual(events[0]['size'], 8)
+
+    def test_hot_addresses(self):
+        self.ctx.addConcretizationRule(CONCRETIZATION.HOT_ADDRESSES, 2)
+        self.ctx.symbolizeRegister(self.ctx.registers.rbx)
+        for _ in range(2):
+            self.ctx.processing(Instruction(0x100, b"\x48\x89\xd8"))  # mov rax, rbx
+            self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+        self.ctx.processing(Instruction(0x100, b"\x48\x89\xd8"))
+        self.assertFalse(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+        events = self.ctx.getConcretizationEvents()
+        self.assertEqual(len(events), 1)
+        self.assertEqual(events[0]['rule'], CONCRETIZATION.HOT_ADDRESSES)
+        self.assertEqual(events[0]['register'], self.ctx.registers.rax)
+
+    def test_clear(self):
+        self.ctx.addConcretizationRule(CONCRETIZATION.HOT_ADDRESSES, 0)
+        self.ctx.clearConcretizationPolicy()
+        self.ctx.symbolizeRegister(self.ctx.registers.rbx)
+        self.ctx.processing(Instruction(0x100, b"\x48\x89\xd8"))  # mov rax, rbx
+        self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+        self.assertEqual(len(self.ctx.getConcretizationEvents()), 0)
+        with self.assertRaises(TypeError):
+            self.ctx.addConcretizationRule(CONCRETIZATION.HOOK)
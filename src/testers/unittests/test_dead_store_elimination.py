@@ -485,3 +485,54 @@ class TestDeadStoreElimination(unittest.TestCase):
         sblock = self.ctx.simplify(block)
         self.ctx.disassembly(sblock)
         self.assertEqual(str(sblock), '0x0: mov dword ptr [rsp], eax')
+
+    def test_lifted(self):
+        self.ctx.setArchitecture(ARCH.X86_64)
+        block = BasicBlock([
+            Instruction(b"\x48\xc7\xc0\x01\x00\x00\x00"),   # mov rax, 1
+            Instruction(b"\x48\xc7\xc0\x02\x00\x00\x00"),   # mov rax, 2
+            Instruction(b"\x48\x89\xc3"),                   # mov rbx, rax
+        ])
+        self.ctx.processing(block)
+        sblock = self.ctx.simplify(block)
+        self.assertEqual(str(sblock), '0x7: mov rax, 2\n'
+                                      '0xe: mov rbx, rax')
+
+    def test_region(self):
+        self.ctx.setArchitecture(ARCH.X86_64)
+        block1 = BasicBlock([
+            Instruction(b"\x48\xc7\xc0\x01\x00\x00\x00"),   # mov rax, 1
+            Instruction(b"\x48\xc7\xc1\x02\x00\x00\x00"),   # mov rcx, 2
+            Instruction(b"\x74\x0f"),                       # je 0x1f
+        ])
+        block2 = BasicBlock([
+            Instruction(b"\x48\xc7\xc0\x03\x00\x00\x00"),   # mov rax, 3
+            Instruction(b"\x48\xc7\xc1\x04\x00\x00\x00"),   # mov rcx, 4
+            Instruction(b"\xc3"),                           # ret
+        ])
+        block3 = BasicBlock([
+            Instruction(b"\x48\xc7\xc1\x05\x00\x00\x00"),   # mov rcx, 5
+            Instruction(b"\x48\x89\xc3"),                   # mov rbx, rax
+            Instruction(b"\xc3"),                           # ret
+        ])
+        self.ctx.disassembly(block1, 0x0)
+        self.ctx.disassembly(block2, 0x10)
+        self.ctx.disassembly(block3, 0x1f)
+
+        # Alone, the block ends on its branch and all its writes are live
+        sblock = self.ctx.simplify(block1)
+        self.assertEqual(str(sblock), '0x0: mov rax, 1\n'
+                                      '0x7: mov rcx, 2\n'
+                                      '0xe: je 0x1f')
+
+        # rcx is written again on both paths, rax is read on one of them
+        sblocks = self.ctx.simplify([block1, block2, block3])
+        self.assertEqual(len(sblocks), 3)
+        self.assertEqual(str(sblocks[0]), '0x0: mov rax, 1\n'
+                                          '0xe: je 0x1f')
+        self.assertEqual(str(sblocks[1]), '0x10: mov rax, 3\n'
+                                          '0x17: mov rcx, 4\n'
+                                          '0x1e: ret')
+        self.assertEqual(str(sblocks[2]), '0x1f: mov rcx, 5\n'
+                                          '0x26: mov rbx, rax\n'
+                                          '0x29: ret')
@@ -2,6 +2,8 @@
 # coding: utf-8
 """Test disassembly."""
 
+import os
+import tempfile
 import unittest
 from triton import *
 
@@ -114,6 +116,20 @@ class TestAArch64Disass(unittest.TestCase):
         self.assertEqual(op2.getExtendType(), EXTEND.ARM.SXTX)
         self.assertEqual(op2.getExtendSize(), 0)
 
+    def test_decode(self):
+        # b.eq #0x1008; bl #0x1104; cbz x0, #0x1010; br x1; ret
+        code = b"\x40\x00\x00\x54\x40\x00\x00\x94\x40\x00\x00\xb4\x20\x00\x1f\xd6\xc0\x03\x5f\xd6"
+        self.ctx.setConcreteMemoryAreaValue(0x1000, code)
+        infos = self.ctx.decode(0x1000, len(code))
+        self.assertEqual([i['flow'] for i in infos], [FLOW.COND_JUMP, FLOW.CALL, FLOW.COND_JUMP, FLOW.JUMP, FLOW.RETURN])
+        self.assertEqual([i['target'] for i in infos], [0x1008, 0x1104, 0x1010, 0, 0])
+
+        for info in infos:
+            inst = self.ctx.disassembly(info['address'], 1)[0]
+            self.assertEqual(info['type'], inst.getType())
+            self.assertEqual(info['branch'], inst.isBranch())
+            self.assertEqual(info['controlFlow'], inst.isControlFlow())
+
 
 class TestArm32Disass(unittest.TestCase):
 
@@ -353,6 +369,98 @@ class TestX64Disass(unittest.TestCase):
         self.ctx.processing(block, 0x112233)
         self.assertEqual(block.getInstructions()[0].getAddress(), 0x112233)
 
+    def test_decode_cache(self):
+        self.ctx.enableDecodeCache(True)
+        self.assertTrue(self.ctx.isDecodeCacheEnabled())
+
+        self.ctx.setConcreteMemoryAreaValue(0x1000, b"\x48\xff\xc1\xc3") # inc rcx; ret
+        first = self.ctx.disassembly(0x1000, 2)
+        again = self.ctx.disassembly(0x1000, 2)
+        self.assertEqual(str(first), str(again))
+        self.assertEqual(again[0].getOperands()[0].getName(), "rcx")
+
+        # Modified code is decoded again
+        self.ctx.setConcreteMemoryAreaValue(0x1000, b"\x48\xff\xc0") # inc rax
+        self.assertEqual(str(self.ctx.disassembly(0x1000, 1)), '[0x1000: inc rax]')
+
+        self.ctx.clearDecodeCache()
+        self.ctx.enableDecodeCache(False)
+        self.assertFalse(self.ctx.isDecodeCacheEnabled())
+
+    def test_persistent_decode_cache(self):
+        path = os.path.join(tempfile.mkdtemp(), "decode.cache")
+        try:
+            self.ctx.openPersistentDecodeCache(path, slots=64)
+        except TypeError as e:
+            if "not built" in str(e):
+                self.skipTest("Triton not built with the persistent decode cache")
+            raise
+
+        self.ctx.setConcreteMemoryAreaValue(0x1000, b"\x48\x8b\x44\xd8\x10\xc3") # mov rax, qword ptr [rax + rbx*8 + 0x10]; ret
+        first = self.ctx.disassembly(0x1000, 2)
+        self.ctx.closePersistentDecodeCache()
+
+        # Another context decodes from the file
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.openPersistentDecodeCache(path)
+        ctx.setConcreteMemoryAreaValue(0x1000, b"\x48\x8b\x44\xd8\x10\xc3")
+        again = ctx.disassembly(0x1000, 2)
+        self.assertEqual(str(first), str(again))
+        mem = again[0].getOperands()[1]
+        self.assertEqual(mem.getBaseRegister().getName(), "rax")
+        self.assertEqual(mem.getIndexRegister().getName(), "rbx")
+        self.assertEqual(mem.getScale().getValue(), 8)
+        self.assertEqual(mem.getDisplacement().getValue(), 0x10)
+
+        # Modified code is decoded again
+        ctx.setConcreteMemoryAreaValue(0x1000, b"\x48\xff\xc0") # inc rax
+        self.assertEqual(str(ctx.disassembly(0x1000, 1)), '[0x1000: inc rax]')
+        ctx.closePersistentDecodeCache()
+
+    def test_disassembly_blocks(self):
+        code = b"\x48\xff\xc1\x48\x31\xc0\x75\xf8" * 0x1000 # inc rcx; xor rax, rax; jne -8
+        self.ctx.setConcreteMemoryAreaValue(0x10000, code)
+
+        serial = self.ctx.disassemblyBlocks(0x10000, len(code), 1)
+        parallel = self.ctx.disassemblyBlocks(0x10000, len(code), 4)
+        self.assertEqual(len(serial), 0x1000)
+        self.assertEqual([str(b.getInstructions()) for b in serial], [str(b.getInstructions()) for b in parallel])
+        self.assertEqual(parallel[-1].getFirstAddress(), 0x10000 + len(code) - 8)
+
+        # Undecodable bytes end the current block and are skipped
+        self.ctx.setConcreteMemoryAreaValue(0x20000, b"\x48\xff\xc1\x06\x48\xff\xc0") # inc rcx; (bad); inc rax
+        blocks = self.ctx.disassemblyBlocks(0x20000, 7)
+        self.assertEqual(len(blocks), 2)
+        self.assertEqual(blocks[1].getFirstAddress(), 0x20004)
+
+    def test_decode(self):
+        info = self.ctx.decode(b"\x74\x10", 0x1000) # je 0x1012
+        self.assertEqual(info['size'], 2)
+        self.assertEqual(info['type'], OPCODE.X86.JE)
+        self.assertEqual(info['flow'], FLOW.COND_JUMP)
+        self.assertTrue(info['branch'] and info['controlFlow'] and info['direct'])
+        self.assertEqual(info['target'], 0x1012)
+
+        # inc rcx; call 0x100a; jmp rax; ret; (bad); nop
+        code = b"\x48\xff\xc1\xe8\x00\x00\x00\x00\xff\xe0\xc3\x06\x90"
+        self.ctx.setConcreteMemoryAreaValue(0x1000, code)
+        infos = self.ctx.decode(0x1000, len(code))
+        self.assertEqual([i['address'] for i in infos], [0x1000, 0x1003, 0x1008, 0x100a, 0x100c])
+        self.assertEqual([i['flow'] for i in infos], [FLOW.NONE, FLOW.CALL, FLOW.JUMP, FLOW.RETURN, FLOW.NONE])
+        self.assertEqual(infos[1]['target'], 0x1008)
+        self.assertFalse(infos[2]['direct'])
+
+        # The same as a full disassembly
+        for info in infos:
+            inst = self.ctx.disassembly(info['address'], 1)[0]
+            self.assertEqual(info['size'], inst.getSize())
+            self.assertEqual(info['type'], inst.getType())
+            self.assertEqual(info['branch'], inst.isBranch())
+            self.assertEqual(info['controlFlow'], inst.isControlFlow())
+
+        with self.assertRaises(Exception):
+            self.ctx.decode(b"\x06")
+
 
 class TestAArch64VAS(unittest.TestCase):
     """Test aarch64 VAS type"""
@@ -564,3 +564,45 @@ class TestEmulationARM32(unittest.TestCase):
         self.ctx.setMode(MODE.SYMBOLIZE_INDEX_ROTATION, True)
         self.ctx.setMode(MODE.TAINT_THROUGH_POINTERS, True)
         self.start()
+
+
+class TestNativeEmulate(unittest.TestCase):
+
+    """Testing the native loop of TritonContext.emulate."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        # mov eax, 0; inc eax; cmp eax, 10; jne 0x1005; hlt
+        self.ctx.setConcreteMemoryAreaValue(0x1000, b"\xb8\x00\x00\x00\x00\xff\xc0\x83\xf8\x0a\x75\xf9\xf4")
+
+    def test_stops(self):
+        self.assertEqual(self.ctx.emulate(0x1000, stops=[0x100c]), (EXCEPTION.NO_FAULT, 31))
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.eax), 10)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rip), 0x100c)
+
+    def test_count(self):
+        self.assertEqual(self.ctx.emulate(0x1000, count=5), (EXCEPTION.NO_FAULT, 5))
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.eax), 2)
+
+    def test_undefined_memory(self):
+        self.assertEqual(self.ctx.emulate(0x2000), (EXCEPTION.NO_FAULT, 0))
+
+    def test_hooks(self):
+        seen = []
+        def hook(ctx, addr):
+            seen.append(ctx.getConcreteRegisterValue(ctx.registers.eax))
+            return ctx.getConcreteRegisterValue(ctx.registers.eax) != 3
+        self.assertEqual(self.ctx.emulate(0x1000, hooks={0x1007: hook}), (EXCEPTION.NO_FAULT, 8))
+        self.assertEqual(seen, [1, 2, 3])
+
+    def test_hook_redirects(self):
+        def hook(ctx, addr):
+            ctx.setConcreteRegisterValue(ctx.registers.rip, 0x100c)
+        self.assertEqual(self.ctx.emulate(0x1000, stops=[0x100c], hooks={0x1007: hook}), (EXCEPTION.NO_FAULT, 2))
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.eax), 1)
+
+    def test_hook_error(self):
+        def hook(ctx, addr):
+            raise ValueError("stop")
+        with self.assertRaises(ValueError):
+            self.ctx.emulate(0x1000, hooks={0x1005: hook})
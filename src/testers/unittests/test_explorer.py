@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the concolic exploration."""
+
+import threading
+import unittest
+from triton import *
+
+
+def setup(ctx):
+    """A program checking its input byte by byte."""
+    ctx.setArchitecture(ARCH.X86_64)
+    # cmp byte ptr [0x2000], 0x41 ; jne 0x101a ;
+    # cmp byte ptr [0x2001], 0x42 ; jne 0x101a ;
+    # mov eax, 1 ; nop ; nop
+    code  = b"\x80\x3c\x25\x00\x20\x00\x00\x41\x75\x10"
+    code += b"\x80\x3c\x25\x01\x20\x00\x00\x42\x75\x06"
+    code += b"\xb8\x01\x00\x00\x00\x90\x90"
+    ctx.setConcreteMemoryAreaValue(0x1000, code)
+
+
+def inject(ctx, data):
+    """The input is at 0x2000."""
+    ctx.setConcreteMemoryAreaValue(0x2000, data)
+    return [ctx.symbolizeMemory(MemoryAccess(0x2000 + i, CPUSIZE.BYTE)) for i in range(len(data))]
+
+
+class TestExplorer(unittest.TestCase):
+
+    """Testing the Explorer."""
+
+    def setUp(self):
+        self.explorer = Explorer(setup, inject)
+        self.explorer.setTerminationHook(lambda ctx, inst: inst.getAddress() >= 0x1019)
+
+    def test_explore(self):
+        """Every path is explored once."""
+        self.explorer.setWorkers(4)
+        self.assertEqual(self.explorer.explore(0x1000, b"\x00\x00"), 3)
+        inputs = self.explorer.getInputs()
+        self.assertEqual(len(inputs), 3)
+        self.assertEqual(inputs[0], b"\x00\x00")
+        self.assertIn(b"AB", inputs)
+        self.assertIn(0x1014, self.explorer.getCoverage())
+
+    def test_input_hook(self):
+        """The input hook sees the runs and ends the exploration."""
+        seen = []
+        lock = threading.Lock()
+
+        def hook(data, coverage):
+            with lock:
+                seen.append((data, coverage))
+            return False
+
+        self.explorer.setInputHook(hook)
+        self.assertEqual(self.explorer.explore(0x1000, b"\x00\x00"), 1)
+        self.assertEqual(seen, [(b"\x00\x00", True)])
+
+    def test_max_runs(self):
+        """The number of runs is bounded."""
+        self.explorer.setWorkers(1)
+        self.explorer.setMaxRuns(2)
+        self.assertEqual(self.explorer.explore(0x1000, b"\x00\x00"), 2)
+
+    def test_hook_error(self):
+        """An error raised by a hook ends the exploration."""
+        def fail(ctx):
+            raise ValueError("setup failed")
+
+        explorer = Explorer(fail, inject)
+        with self.assertRaises(TypeError):
+            explorer.explore(0x1000, b"\x00")
+
+    def test_schedulers(self):
+        """Every scheduler explores every path once."""
+        for scheduler in [SCHEDULER.DFS, SCHEDULER.COVERAGE, SCHEDULER.BFS, SCHEDULER.COST]:
+            self.explorer.setScheduler(scheduler)
+            self.explorer.setWorkers(2)
+            self.assertEqual(self.explorer.explore(0x1000, b"\x00\x00"), 3)
+            self.assertIn(b"AB", self.explorer.getInputs())
+            self.assertGreater(self.explorer.getEdgeCount(), 0)
+
+    def test_bfs(self):
+        """The inputs of a generation are run before the next one."""
+        self.explorer.setScheduler(SCHEDULER.BFS)
+        self.explorer.setWorkers(1)
+        self.explorer.explore(0x1000, b"\x00\x00")
+        self.assertEqual(self.explorer.getInputs(), [b"\x00\x00", b"A\x00", b"AB"])
+
+    def test_priority_hook(self):
+        """The custom scheduler orders the tasks with the priority hook."""
+        infos = []
+        lock = threading.Lock()
+
+        def priority(info):
+            with lock:
+                infos.append(info)
+            return -info["depth"]
+
+        self.explorer.setScheduler(SCHEDULER.CUSTOM)
+        self.explorer.setPriorityHook(priority)
+        self.assertEqual(self.explorer.explore(0x1000, b"\x00\x00"), 3)
+        self.assertEqual(sorted(info["depth"] for info in infos), [0, 1, 2])
+        self.assertFalse(any(info["deferred"] for info in infos))
+
+    def test_max_depth(self):
+        """Only the first path constraints are flipped."""
+        self.explorer.setMaxDepth(1)
+        self.assertEqual(self.explorer.explore(0x1000, b"\x00\x00"), 2)
+        self.assertNotIn(b"AB", self.explorer.getInputs())
+
+    def test_invalid_scheduler(self):
+        """An unknown scheduler is refused."""
+        with self.assertRaises(TypeError):
+            self.explorer.setScheduler(1234)
@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the GDB remote protocol bridge."""
+
+import socket
+import struct
+import threading
+import unittest
+from triton import *
+
+
+class Stub(threading.Thread):
+
+    """A gdb stub of a stopped x86-64 target, serving one connection."""
+
+    def __init__(self, registers, memory):
+        threading.Thread.__init__(self, daemon=True)
+        self.registers = registers
+        self.memory = memory
+        self.server = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        self.server.bind(("127.0.0.1", 0))
+        self.server.listen(1)
+        self.port = self.server.getsockname()[1]
+
+    def reply(self, packet):
+        if packet.startswith("qSupported"):
+            return "PacketSize=4000;QStartNoAckMode+"
+        if packet == "QStartNoAckMode":
+            return "OK"
+        if packet == "g":
+            return self.registers.hex()
+        if packet.startswith("m"):
+            addr, size = [int(x, 16) for x in packet[1:].split(",")]
+            data = b""
+            for a in range(addr, addr + size):
+                if a not in self.memory:
+                    return "E14" if not data else data.hex()
+                data += bytes([self.memory[a]])
+            return data.hex()
+        return ""
+
+    def run(self):
+        conn, _ = self.server.accept()
+        acks = True
+        data = b""
+        while True:
+            chunk = conn.recv(0x1000)
+            if not chunk:
+                break
+            data += chunk
+            while b"#" in data and len(data) >= data.index(b"#") + 3:
+                start = data.index(b"$")
+                end = data.index(b"#")
+                packet = data[start + 1:end].decode()
+                data = data[end + 3:]
+                if acks:
+                    conn.sendall(b"+")
+                if packet == "QStartNoAckMode":
+                    acks = False
+                body = self.reply(packet)
+                checksum = sum(body.encode()) & 0xff
+                conn.sendall(("$%s#%02x" % (body, checksum)).encode())
+                if acks or packet == "QStartNoAckMode":
+                    # Waits for the acknowledgment of the reply
+                    while b"+" not in data:
+                        data += conn.recv(1)
+                    data = data[data.index(b"+") + 1:]
+        conn.close()
+
+
+class TestGdbRemote(unittest.TestCase):
+
+    """Testing attachGdbRemote."""
+
+    def setUp(self):
+        # rax, rbx, rcx, rdx, rsi, rdi, rbp, rsp, r8-r15, rip, eflags
+        values = [0x1122, 0x1000, 0, 0, 0, 0, 0, 0x7ff0] + [0] * 8 + [0x400000]
+        registers = struct.pack("<17QI", *values, 0x202)
+        memory = {0x1000 + i: i & 0xff for i in range(0x3000)}
+        self.stub = Stub(registers, memory)
+        self.stub.start()
+        self.ctx = TritonContext(ARCH.X86_64)
+        try:
+            self.ctx.attachGdbRemote("127.0.0.1:%d" % self.stub.port, prefetch=2)
+        except TypeError as e:
+            if "not built" in str(e):
+                self.skipTest("Triton not built with the remote interface")
+            raise
+
+    def tearDown(self):
+        self.ctx.detachGdbRemote()
+
+    def test_registers(self):
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 0x1122)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rip), 0x400000)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rsp), 0x7ff0)
+
+    def test_pages(self):
+        # mov rax, qword ptr [rbx]
+        self.ctx.processing(Instruction(0x400000, b"\x48\x8b\x03"))
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 0x0706050403020100)
+        stats = self.ctx.getGdbRemoteStats()
+        self.assertEqual(stats["pages"], 3)
+
+        # The following pages have been prefetched
+        packets = stats["packets"]
+        self.assertEqual(self.ctx.getConcreteMemoryValue(MemoryAccess(0x2008, CPUSIZE.BYTE)), 0x08)
+        self.assertEqual(self.ctx.getGdbRemoteStats()["packets"], packets)
+
+        # The target does not map the page
+        self.assertEqual(self.ctx.getConcreteMemoryValue(MemoryAccess(0x8000, CPUSIZE.BYTE)), 0)
+
+        self.ctx.detachGdbRemote()
+        self.assertIsNone(self.ctx.getGdbRemoteStats())
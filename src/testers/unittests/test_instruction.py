@@ -63,6 +63,18 @@ class TestInstruction(unittest.TestCase):
         self.assertFalse(self.inst.isControlFlow(), "It is not a jmp, ret or call")
         self.assertFalse(self.inst.isBranch(), "It is not a jmp")
 
+    def test_update_flag(self):
+        """Check the update of the flags."""
+        self.assertTrue(self.inst.isUpdateFlag(), "add writes the flags")
+
+        inst = Instruction(b"\x48\x89\xd8")  # mov rax, rbx
+        self.ctx.disassembly(inst)
+        self.assertFalse(inst.isUpdateFlag(), "mov does not write the flags")
+
+        inst = Instruction(b"\x74\x00")  # je 2
+        self.ctx.disassembly(inst)
+        self.assertFalse(inst.isUpdateFlag(), "je only tests the flags")
+
     def test_condition(self):
         """Check condition flags."""
         self.assertFalse(self.inst.isConditionTaken())
@@ -164,3 +164,24 @@ class TestOnlySymbolizedMode(unittest.TestCase):
 
         self.assertEqual(inst.getOperands()[1].getAddress(), 0x1337)
         self.assertIsNotNone(inst.getOperands()[1].getLeaAst())
+
+    def test_9(self):
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.AARCH64)
+        ctx.setMode(MODE.ONLY_ON_SYMBOLIZED, True)
+
+        # The nodes of an instruction without symbolized input are all dropped
+        inst = Instruction(b"\x20\x00\x02\x8b") # add x0, x1, x2
+        self.assertTrue(ctx.processing(inst) == EXCEPTION.NO_FAULT)
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertEqual(len(inst.getReadRegisters()), 0)
+        self.assertEqual(len(inst.getWrittenRegisters()), 0)
+        self.assertIsNone(ctx.getSymbolicRegister(ctx.registers.x0))
+
+        ctx.symbolizeRegister(ctx.registers.x1)
+        inst = Instruction(b"\x20\x00\x02\x8b") # add x0, x1, x2
+        self.assertTrue(ctx.processing(inst) == EXCEPTION.NO_FAULT)
+        self.assertTrue(checkAstIntegrity(inst))
+        self.assertEqual(len(inst.getReadRegisters()), 1)
+        self.assertEqual(len(inst.getWrittenRegisters()), 1)
+        self.assertIsNotNone(ctx.getSymbolicRegister(ctx.registers.x0))
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the basic block optimization passes."""
+
+import unittest
+from triton import *
+
+
+class TestPassManager(unittest.TestCase):
+
+    """Testing TritonContext.optimize()."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.ctx = TritonContext(ARCH.X86_64)
+
+    def test_redundant_writes(self):
+        block = BasicBlock([
+            Instruction(b"\x48\x89\xd8"),                   # mov rax, rbx
+            Instruction(b"\x48\x89\xd8"),                   # mov rax, rbx
+            Instruction(b"\x48\x89\xc9"),                   # mov rcx, rcx
+            Instruction(b"\x48\xc7\xc2\x05\x00\x00\x00"),   # mov rdx, 5
+            Instruction(b"\x48\xc7\xc2\x05\x00\x00\x00"),   # mov rdx, 5
+        ])
+        self.ctx.disassembly(block)
+        sblock, stats = self.ctx.optimize(block, [PASS.REDUNDANT_WRITES])
+        self.assertEqual(str(sblock), '0x0: mov rax, rbx\n'
+                                      '0x9: mov rdx, 5')
+        self.assertEqual(stats['instructions'], 5)
+        self.assertEqual(stats['kept'], 2)
+        self.assertEqual(stats['redundantWrites'], 3)
+
+    def test_opaque_predicate(self):
+        block1 = BasicBlock([
+            Instruction(b"\x31\xc0"),                       # xor eax, eax
+            Instruction(b"\x85\xc0"),                       # test eax, eax
+            Instruction(b"\x75\x0a"),                       # jne 0x10
+        ])
+        block2 = BasicBlock([
+            Instruction(b"\x48\xc7\xc3\x01\x00\x00\x00"),   # mov rbx, 1
+            Instruction(b"\xc3"),                           # ret
+        ])
+        block3 = BasicBlock([
+            Instruction(b"\x48\xc7\xc3\x02\x00\x00\x00"),   # mov rbx, 2
+            Instruction(b"\xc3"),                           # ret
+        ])
+        self.ctx.disassembly(block1, 0x0)
+        self.ctx.disassembly(block2, 0x6)
+        self.ctx.disassembly(block3, 0x10)
+
+        blocks, stats = self.ctx.optimize([block1, block2, block3], [PASS.OPAQUE_PREDICATES, PASS.DEAD_STORES])
+        self.assertEqual(len(blocks), 3)
+        self.assertEqual(str(blocks[0]), '0x0: xor eax, eax\n'
+                                         '0x2: test eax, eax')
+        self.assertEqual(str(blocks[1]), '0x6: mov rbx, 1\n'
+                                         '0xd: ret')
+        self.assertEqual(blocks[2].getSize(), 0)
+        self.assertEqual(stats['opaquePredicates'], 1)
+        self.assertEqual(stats['unreachableBlocks'], 1)
+        self.assertEqual(stats['instructions'], 7)
+        self.assertEqual(stats['kept'], 4)
+
+        # Without the pass, both sides are kept
+        blocks, stats = self.ctx.optimize([block1, block2, block3], [PASS.DEAD_STORES])
+        self.assertEqual(blocks[0].getSize(), 3)
+        self.assertEqual(blocks[2].getSize(), 2)
+        self.assertEqual(stats['opaquePredicates'], 0)
+
+    def test_input_predicate(self):
+        # The loaded byte is an input, whatever its concrete value
+        self.ctx.setConcreteMemoryValue(0x2000, 0x41)
+        block = BasicBlock([
+            Instruction(b"\x80\x3c\x25\x00\x20\x00\x00\x41"), # cmp byte ptr [0x2000], 0x41
+            Instruction(b"\x75\x10"),                         # jne 0x1a
+        ])
+        self.ctx.disassembly(block, 0x1000)
+        sblock, stats = self.ctx.optimize(block, [PASS.OPAQUE_PREDICATES, PASS.DEAD_STORES])
+        self.assertEqual(sblock.getSize(), 2)
+        self.assertEqual(stats['opaquePredicates'], 0)
+        # The condition varies on the samples, the solver is not queried
+        self.assertEqual(stats['sampledPredicates'], 1)
+
+    def test_padding(self):
+        block1 = BasicBlock([
+            Instruction(b"\x31\xc0"),                       # xor eax, eax
+            Instruction(b"\x85\xc0"),                       # test eax, eax
+            Instruction(b"\x75\x0a"),                       # jne 0x10
+        ])
+        block2 = BasicBlock([
+            Instruction(b"\xc3"),                           # ret
+        ])
+        self.ctx.disassembly(block1, 0x0)
+        self.ctx.disassembly(block2, 0x6)
+        blocks, stats = self.ctx.optimize([block1, block2], [PASS.OPAQUE_PREDICATES], padding=True)
+        # The branch never taken is replaced by NOP instructions
+        self.assertEqual(blocks[0].getSize(), 4)
+        self.assertEqual(str(blocks[0].getInstructions()[2]).split(': ')[1], 'nop')
+        self.assertEqual(stats['kept'], 3)
@@ -2,6 +2,8 @@
 # coding: utf-8
 """Test Path Constraint."""
 
+import os
+import tempfile
 import unittest
 from triton import *
 
@@ -80,7 +82,7 @@ class TestPathConstraint(unittest.TestCase):
         self.ctx.pushPathConstraint(ast.equal(ast.bvtrue(), ast.bvtrue()))
 
         pc  = self.ctx.getPathPredicate()
-        self.assertEqual(str(pc), "(and (and (= (_ bv1 1) (_ bv1 1)) (= ref!35 (_ bv1 1))) (= (_ bv1 1) (_ bv1 1)))")
+        self.assertEqual(str(pc), "(and (= (_ bv1 1) (_ bv1 1)) (= ref!35 (_ bv1 1)) (= (_ bv1 1) (_ bv1 1)))")
 
         self.ctx.popPathConstraint()
         pc  = self.ctx.getPathPredicate()
@@ -108,6 +110,20 @@ class TestPathConstraint(unittest.TestCase):
 
         self.assertEqual(ctx.getModel(ctx.getPredicatesToReachAddress(0x1337)[0])[0].getValue(), 0x1336)
 
+    def test_reachingBatch(self):
+        preds = self.ctx.getPredicatesToReachAddresses([108, 23, 20])
+        self.assertEqual([len(p) for p in preds], [1, 1, 0])
+        self.assertEqual(str(preds[0][0]), str(self.ctx.getPredicatesToReachAddress(108)[0]))
+
+        models = self.ctx.getModelsToReachAddresses([23, 20], 2)
+        self.assertEqual(len(models), 2)
+        self.assertTrue(len(models[0]) > 0)
+        self.assertEqual(models[1], {})
+
+        # The popped branches are no longer indexed
+        self.ctx.popPathConstraint()
+        self.assertEqual(len(self.ctx.getPredicatesToReachAddress(108)), 0)
+
     def test_pushPathConstraintComment(self):
         ast = self.ctx.getAstContext()
 
@@ -118,3 +134,96 @@ class TestPathConstraint(unittest.TestCase):
         pc = self.ctx.getPathConstraints()[-1]
 
         self.assertEqual(pc.getComment(), "Some comment")
+
+
+class TestStateMerging(unittest.TestCase):
+
+    """Testing the merge of the sides of short branches."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setMode(MODE.STATE_MERGING, True)
+
+    def run_until(self, code, al, end):
+        """Processes `code` at 0x1000 with a symbolic al up to `end`."""
+        self.ctx.setConcreteMemoryAreaValue(0x1000, code)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.al, al)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rip, 0x1000)
+        var = self.ctx.symbolizeRegister(self.ctx.registers.al, 'al')
+        pc = 0x1000
+        while pc != end:
+            self.ctx.processing(Instruction(pc, self.ctx.getConcreteMemoryAreaValue(pc, 16)))
+            pc = self.ctx.getConcreteRegisterValue(self.ctx.registers.rip)
+        return var
+
+    def test_triangle(self):
+        """The branch jumping to the join point is merged at once."""
+        # cmp al, 0x41 ; jne +2 ; mov bl, 1 ; nop
+        var = self.run_until(b"\x3c\x41\x75\x02\xb3\x01\x90", 0x00, 0x1006)
+        self.assertEqual(len(self.ctx.getPathConstraints()), 0)
+        self.assertEqual(len(self.ctx.getMergedPathConstraints()), 1)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.bl), 0)
+
+        ast = self.ctx.getAstContext()
+        model = self.ctx.getModel(ast.equal(self.ctx.getRegisterAst(self.ctx.registers.bl), ast.bv(1, 8)))
+        self.assertEqual(model[var.getId()].getValue(), 0x41)
+
+    def test_diamond(self):
+        """Both sides of an if-then-else continue as one state."""
+        # cmp al, 0x41 ; jne +4 ; mov bl, 1 ; jmp +2 ; mov bl, 2 ; nop
+        var = self.run_until(b"\x3c\x41\x75\x04\xb3\x01\xeb\x02\xb3\x02\x90", 0x41, 0x100a)
+        self.assertEqual(len(self.ctx.getPathConstraints()), 0)
+        self.assertEqual(self.ctx.getMergedPathConstraints()[0].getSourceAddress(), 0x1002)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.bl), 1)
+        self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.bl))
+
+        ast = self.ctx.getAstContext()
+        model = self.ctx.getModel(ast.equal(self.ctx.getRegisterAst(self.ctx.registers.bl), ast.bv(2, 8)))
+        self.assertNotEqual(model[var.getId()].getValue(), 0x41)
+
+    def test_disabled(self):
+        """Without the mode, the branch stays in the path predicate."""
+        self.ctx.setMode(MODE.STATE_MERGING, False)
+        self.run_until(b"\x3c\x41\x75\x02\xb3\x01\x90", 0x00, 0x1006)
+        self.assertEqual(len(self.ctx.getPathConstraints()), 1)
+        self.assertEqual(len(self.ctx.getMergedPathConstraints()), 0)
+
+    def test_distance(self):
+        """The sides longer than the merge distance are not merged."""
+        self.assertEqual(self.ctx.getMergeDistance(), 64)
+        self.ctx.setMergeDistance(1)
+        self.run_until(b"\x3c\x41\x75\x02\xb3\x01\x90", 0x00, 0x1006)
+        self.assertEqual(len(self.ctx.getPathConstraints()), 1)
+
+
+class TestSmtStream(unittest.TestCase):
+
+    """Testing the streamed SMT export."""
+
+    def test_stream(self):
+        ctx = TritonContext(ARCH.X86)
+        ctx.symbolizeRegister(ctx.registers.eax, 'a')
+
+        path = os.path.join(tempfile.mkdtemp(), 'trace.smt2')
+        self.assertFalse(ctx.isSmtStreamEnabled())
+        ctx.startSmtStream(path)
+        self.assertTrue(ctx.isSmtStreamEnabled())
+
+        ctx.symbolizeRegister(ctx.registers.ebx, 'b')
+        for opcodes in [b"\x31\xD8", b"\x0F\x84\x55\x00\x00\x00"]: # xor eax, ebx; je 0x55
+            ctx.processing(Instruction(opcodes))
+
+        ctx.stopSmtStream()
+        self.assertFalse(ctx.isSmtStreamEnabled())
+
+        with open(path) as f:
+            lines = f.read().splitlines()
+        os.remove(path)
+
+        # Each variable and expression is written once, the references by name
+        self.assertIn('(declare-fun a () (_ BitVec 32))', lines)
+        self.assertIn('(declare-fun b () (_ BitVec 32))', lines)
+        defines = [l.split()[1] for l in lines if l.startswith('(define-fun ref!')]
+        self.assertEqual(len(defines), len(set(defines)))
+        self.assertGreaterEqual(len(defines), len(ctx.getSymbolicExpressions()))
+        self.assertEqual(len([l for l in lines if l.startswith('(assert')]), len(ctx.getPathConstraints()))
@@ -166,6 +166,22 @@ class TestRegisterValues(unittest.TestCase):
         self.assertTrue(self.ctx.registers.al.isOverlapWith(self.ctx.registers.ax))
         self.assertFalse(self.ctx.registers.eax.isOverlapWith(self.ctx.registers.edx))
 
+    def test_register_file(self):
+        """Check saving and restoring the concrete register file."""
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 0x1122334455667788)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.zf, 1)
+        state = self.ctx.getConcreteRegisterFile()
+        self.assertIsInstance(state, bytes)
+
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 0)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.zf, 0)
+        self.ctx.setConcreteRegisterFile(state)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 0x1122334455667788)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.zf), 1)
+
+        with self.assertRaises(Exception):
+            self.ctx.setConcreteRegisterFile(state[1:])
+
 
 class TestAArch64Registers(unittest.TestCase):
     """Test AArch64 registers"""
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test Context snapshots and forks."""
+
+import unittest
+from triton import *
+
+
+class TestSnapshot(unittest.TestCase):
+
+    """Testing snapshot, restore and fork."""
+
+    def setUp(self):
+        """Define the arch and an initial state."""
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 1)
+        self.ctx.setConcreteMemoryValue(0x1000, 0x11)
+        self.ctx.symbolizeRegister(self.ctx.registers.rax)
+        self.ctx.taintRegister(self.ctx.registers.rax)
+
+    def test_restore(self):
+        """Restore a snapshot after processing instructions."""
+        expr = self.ctx.getSymbolicRegister(self.ctx.registers.rax)
+        sid  = self.ctx.snapshot()
+
+        self.ctx.processing(Instruction(b"\x48\x83\xc0\x01"))                          # add rax, 1
+        self.ctx.processing(Instruction(b"\x48\xa3\x00\x10\x00\x00\x00\x00\x00\x00"))  # movabs [0x1000], rax
+        self.ctx.untaintRegister(self.ctx.registers.rax)
+        ast = self.ctx.getAstContext()
+        self.ctx.pushPathConstraint(ast.equal(self.ctx.getRegisterAst(self.ctx.registers.rax), ast.bv(2, 64)))
+        self.assertEqual(self.ctx.getConcreteMemoryValue(0x1000), 2)
+        self.assertTrue(self.ctx.isMemorySymbolized(0x1000))
+
+        for _ in range(2):
+            self.ctx.restore(sid)
+            self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 1)
+            self.assertEqual(self.ctx.getConcreteMemoryValue(0x1000), 0x11)
+            self.assertEqual(self.ctx.getSymbolicRegister(self.ctx.registers.rax).getId(), expr.getId())
+            self.assertFalse(self.ctx.isMemorySymbolized(0x1000))
+            self.assertTrue(self.ctx.isRegisterTainted(self.ctx.registers.rax))
+            self.assertEqual(len(self.ctx.getPathConstraints()), 0)
+            self.ctx.setConcreteMemoryValue(0x1000, 0x22)
+
+    def test_reset(self):
+        """Reset to a snapshot many times, copying back only the changed pages."""
+        self.ctx.setConcreteMemoryAreaValue(0x10000, b"\x41" * 0x4000)
+        sid = self.ctx.snapshot()
+
+        for i in range(3):
+            self.ctx.processing(Instruction(b"\x48\x83\xc0\x01"))                          # add rax, 1
+            self.ctx.processing(Instruction(b"\x48\xa3\x00\x10\x00\x00\x00\x00\x00\x00"))  # movabs [0x1000], rax
+            self.ctx.setConcreteMemoryValue(0x12000 + i, 0x42)
+            self.ctx.setConcreteMemoryValue(0x40000, 0x43)
+            self.ctx.untaintRegister(self.ctx.registers.rax)
+
+            self.ctx.resetToSnapshot(sid)
+            self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 1)
+            self.assertEqual(self.ctx.getConcreteMemoryValue(0x1000), 0x11)
+            self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x10000, 0x4000), b"\x41" * 0x4000)
+            self.assertFalse(self.ctx.isConcreteMemoryValueDefined(0x40000))
+            self.assertFalse(self.ctx.isMemorySymbolized(0x1000))
+            self.assertTrue(self.ctx.isRegisterTainted(self.ctx.registers.rax))
+
+        # Cleared pages are brought back
+        self.ctx.clearConcreteMemoryValue(0x10000, 0x4000)
+        self.ctx.resetToSnapshot(sid)
+        self.assertTrue(self.ctx.isConcreteMemoryValueDefined(0x10000, 0x4000))
+
+        # Another snapshot is fully restored first
+        sid2 = self.ctx.snapshot()
+        self.ctx.setConcreteMemoryValue(0x1000, 0x55)
+        self.ctx.resetToSnapshot(sid)
+        self.ctx.resetToSnapshot(sid2)
+        self.assertEqual(self.ctx.getConcreteMemoryValue(0x1000), 0x11)
+        self.assertRaises(Exception, self.ctx.resetToSnapshot, 1000)
+
+    def test_remove(self):
+        """Remove snapshots."""
+        sid1 = self.ctx.snapshot()
+        sid2 = self.ctx.snapshot()
+        self.assertNotEqual(sid1, sid2)
+        self.assertTrue(self.ctx.isSnapshotExists(sid1))
+
+        self.ctx.removeSnapshot(sid1)
+        self.assertFalse(self.ctx.isSnapshotExists(sid1))
+        self.assertRaises(Exception, self.ctx.restore, sid1)
+        self.assertRaises(Exception, self.ctx.removeSnapshot, sid1)
+
+        self.ctx.clearSnapshots()
+        self.assertFalse(self.ctx.isSnapshotExists(sid2))
+
+    def test_fork(self):
+        """Fork a context and diverge."""
+        fork = self.ctx.fork()
+        fork.setConcreteMemoryValue(0x1000, 0x33)
+        fork.processing(Instruction(b"\x48\x83\xc0\x01"))  # add rax, 1
+
+        self.assertEqual(self.ctx.getConcreteMemoryValue(0x1000), 0x11)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 1)
+        self.assertEqual(fork.getConcreteMemoryValue(0x1000), 0x33)
+        self.assertEqual(fork.getConcreteRegisterValue(fork.registers.rax), 2)
+        self.assertTrue(fork.isRegisterTainted(fork.registers.rax))
+        self.assertTrue(fork.isRegisterSymbolized(fork.registers.rax))
+
+        # Both contexts share the AST context, variable names must not collide
+        var1 = self.ctx.newSymbolicVariable(8)
+        var2 = fork.newSymbolicVariable(8)
+        self.assertNotEqual(var1.getName(), var2.getName())
+
+        # The fork outlives the original context
+        del self.ctx
+        self.assertEqual(fork.getConcreteMemoryValue(0x1000), 0x33)
+
+    def test_step_back(self):
+        """Undo processed instructions with the undo journal."""
+        expr = self.ctx.getSymbolicRegister(self.ctx.registers.rax)
+        self.ctx.enableUndoJournal(True)
+        self.assertTrue(self.ctx.isUndoJournalEnabled())
+
+        self.ctx.processing(Instruction(b"\x48\x83\xc0\x01"))                          # add rax, 1
+        self.ctx.processing(Instruction(b"\x48\xa3\x00\x10\x00\x00\x00\x00\x00\x00"))  # movabs [0x1000], rax
+        self.assertEqual(self.ctx.getUndoJournalSize(), 2)
+        self.assertEqual(self.ctx.getConcreteMemoryValue(0x1000), 2)
+
+        self.ctx.stepBack()
+        self.assertEqual(self.ctx.getConcreteMemoryValue(0x1000), 0x11)
+        self.assertFalse(self.ctx.isMemorySymbolized(0x1000))
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 2)
+
+        self.ctx.stepBack(1)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 1)
+        self.assertEqual(self.ctx.getSymbolicRegister(self.ctx.registers.rax).getId(), expr.getId())
+
+        with self.assertRaises(Exception):
+            self.ctx.stepBack()
+
+        self.ctx.enableUndoJournal(False)
+        self.assertFalse(self.ctx.isUndoJournalEnabled())
@@ -2,6 +2,9 @@
 # coding: utf-8
 """Test Solvers."""
 
+import os
+import tempfile
+import threading
 import unittest
 
 from triton import *
@@ -60,3 +63,223 @@ class TestSolvers(unittest.TestCase):
         if 'BITWUZLA' in dir(SOLVER):
             self.solve_a_query(SOLVER.BITWUZLA)
             self.solve_bswap(SOLVER.BITWUZLA)
+
+        # The embedded SAT solver is always built
+        self.solve_a_query(SOLVER.BITBLAST)
+        self.solve_bswap(SOLVER.BITBLAST)
+
+    def test_bit_blasting(self):
+        x = self.ast.variable(self.ctx.newSymbolicVariable(16, "x"))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(16, "y"))
+
+        self.assertFalse(self.ctx.isBitBlastingEnabled())
+        self.ctx.enableBitBlasting(True)
+        self.assertTrue(self.ctx.isBitBlastingEnabled())
+
+        model = self.ctx.getModel(self.ast.land([x * 3 == 0x1236, self.ast.bvudiv(y, x) == 2, self.ast.bvsrem(y, x) == 1]))
+        self.assertEqual((model[0].getValue() * 3) & 0xffff, 0x1236)
+        self.assertEqual(model[1].getValue(), model[0].getValue() * 2 + 1)
+
+        # Blocked models are distinct
+        models = self.ctx.getModels(self.ast.bvult(x, 4), 10)
+        self.assertEqual(sorted(m[x.getSymbolicVariable().getId()].getValue() for m in models), [0, 1, 2, 3])
+
+        models, status, _ = self.ctx.getModels(self.ast.land([x > 5, x < 3]), 10, status=True)
+        self.assertEqual(status, SOLVER_STATE.UNSAT)
+        self.assertEqual(len(models), 0)
+
+        # Too large for the embedded solver, solved by the current one
+        self.ctx.enableBitBlasting(True, 2)
+        self.assertTrue(self.ctx.isSat(self.ast.bvrol(x, 4) == 0x2341))
+        self.ctx.enableBitBlasting(False)
+
+    def test_opaque_predicate(self):
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+        # x * (x + 1) is always even
+        self.assertTrue(self.ctx.isOpaquePredicate(((x * (x + 1)) & 1) == 0))
+        # Varies on the samples, rejected without query
+        self.assertFalse(self.ctx.isOpaquePredicate(x == 0x41))
+        self.assertFalse(self.ctx.isOpaquePredicate(x == 0x41, 0))
+        self.assertTrue(self.ctx.isOpaquePredicate(self.ast.equal(self.ast.bv(1, 8), self.ast.bv(1, 8))))
+
+    def test_shared_query_cache(self):
+        path = os.path.join(tempfile.mkdtemp(), "query.cache")
+        try:
+            self.ctx.openSharedQueryCache(path, slots=64)
+        except TypeError as e:
+            if "not built" in str(e):
+                self.skipTest("Triton not built with the persistent caches")
+            raise
+
+        self.assertTrue(self.ctx.isSharedQueryCacheOpen())
+        self.ctx.enableQueryCache(True)
+        x = self.ast.variable(self.ctx.newSymbolicVariable(16, "x"))
+        model = self.ctx.getModel(x * 3 == 0x1236)
+        self.assertEqual(self.ctx.getQueryCacheMisses(), 1)
+        self.ctx.closeSharedQueryCache()
+        self.assertFalse(self.ctx.isSharedQueryCacheOpen())
+
+        # Another context, with other variables, reads the result from the file
+        ctx = TritonContext(ARCH.X86_64)
+        ast = ctx.getAstContext()
+        ctx.openSharedQueryCache(path)
+        ctx.enableQueryCache(True)
+        ctx.newSymbolicVariable(8, "unused")
+        y = ast.variable(ctx.newSymbolicVariable(16, "y"))
+        again = ctx.getModel(3 * y == 0x1236)
+        self.assertEqual(ctx.getQueryCacheHits(), 1)
+        self.assertEqual(ctx.getQueryCacheMisses(), 0)
+        self.assertEqual(again[0].getValue(), model[0].getValue())
+        self.assertEqual(again[0].getVariable().getId(), y.getSymbolicVariable().getId())
+        ctx.closeSharedQueryCache()
+
+    def test_query_canonicalization(self):
+        self.ctx.enableQueryCache(True)
+        x = self.ast.variable(self.ctx.newSymbolicVariable(16, "x"))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(16, "y"))
+        model = self.ctx.getModel(x * 3 == 0x1236)
+        self.assertEqual(self.ctx.getQueryCacheMisses(), 1)
+
+        # The same query on another variable, its operands swapped
+        again = self.ctx.getModel(0x1236 == 3 * y)
+        self.assertEqual(self.ctx.getQueryCacheHits(), 1)
+        self.assertEqual(list(again.keys()), [y.getSymbolicVariable().getId()])
+        self.assertEqual(again[y.getSymbolicVariable().getId()].getValue(), model[x.getSymbolicVariable().getId()].getValue())
+
+        # The constant of a comparison goes to the right
+        self.assertTrue(self.ctx.isSat(self.ast.bvult(x, self.ast.bv(5, 16))))
+        self.assertTrue(self.ctx.isSat(self.ast.bvugt(self.ast.bv(5, 16), y)))
+        self.assertEqual(self.ctx.getQueryCacheHits(), 2)
+
+        # The references are followed
+        expr = self.ctx.newSymbolicExpression(y + 1)
+        self.assertTrue(self.ctx.isSat(self.ast.reference(expr) == 2))
+        self.assertTrue(self.ctx.isSat(1 + x == 2))
+        self.assertEqual(self.ctx.getQueryCacheHits(), 3)
+
+        # Not the same query
+        self.assertTrue(self.ctx.isSat(x - 1 == 2))
+        self.assertTrue(self.ctx.isSat(1 - x == 2))
+        self.assertEqual(self.ctx.getQueryCacheHits(), 3)
+
+    def test_adaptive_timeout(self):
+        x = self.ast.variable(self.ctx.newSymbolicVariable(32, "x"))
+        node = x * 3 == 0x1236
+        self.assertTrue(self.ctx.predictSolvingTime(node) > 0)
+        # The multiplications cost more than the plain comparisons
+        self.assertTrue(self.ctx.predictSolvingTime(node) > self.ctx.predictSolvingTime(x == 1))
+
+        self.assertFalse(self.ctx.isAdaptiveTimeoutEnabled())
+        self.ctx.enableAdaptiveTimeout(True)
+        self.assertTrue(self.ctx.isAdaptiveTimeoutEnabled())
+        self.assertRaises(TypeError, self.ctx.setAdaptiveTimeoutBounds, 0, 100)
+        self.ctx.setAdaptiveTimeoutBounds(100, 5000)
+
+        self.ctx.startTimeoutRound(60000)
+        model, status, _ = self.ctx.getModel(node, status=True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual((model[0].getValue() * 3) & 0xffffffff, 0x1236)
+        self.assertTrue(self.ctx.getTimeoutRoundRemaining() <= 60000)
+
+        # A timed out query asks the callback before its retry
+        self.ctx.setTimeoutRetryCallback(lambda node, timeout: False, 1)
+        self.assertTrue(self.ctx.isSat(x == 1))
+        self.ctx.setTimeoutRetryCallback(None)
+
+        self.ctx.startTimeoutRound(0)
+        self.assertEqual(self.ctx.getTimeoutRoundRemaining(), 0)
+        self.ctx.enableAdaptiveTimeout(False)
+
+    def test_dense_model(self):
+        m0 = self.ctx.symbolizeMemory(MemoryAccess(0x1000, CPUSIZE.WORD))
+        m1 = self.ctx.symbolizeMemory(MemoryAccess(0x1002, CPUSIZE.BYTE))
+        r0 = self.ctx.symbolizeRegister(self.ctx.registers.rax)
+        node = self.ast.land([
+            self.ast.variable(m0) == 0x4142,
+            self.ast.variable(m1) == 0x43,
+            self.ast.variable(r0) == 0x1234,
+        ])
+        model = self.ctx.getDenseModel(node)
+        self.assertEqual(model, [(m0.getId(), 0x4142), (m1.getId(), 0x43), (r0.getId(), 0x1234)])
+        # Only the memory variables are written, clipped to the buffer
+        buf = bytearray(b"\x00" * 4)
+        self.assertEqual(self.ctx.applyModelToBuffer(model, 0x1000, buf), 3)
+        self.assertEqual(bytes(buf), b"\x42\x41\x43\x00")
+        buf = bytearray(2)
+        self.assertEqual(self.ctx.applyModelToBuffer(self.ctx.getModel(node), 0x1001, buf), 2)
+        self.assertEqual(bytes(buf), b"\x41\x43")
+
+    def test_symbolize_buffer(self):
+        self.ctx.setConcreteMemoryAreaValue(0x2000, b"A" * 100)
+        buf = self.ctx.symbolizeBuffer(0x2000, 100, "input")
+        # One variable per chunk of 64, 32 and 4 bytes
+        self.assertEqual([v.getBitSize() for v in buf], [512, 256, 32])
+        self.assertEqual([v.getOrigin() for v in buf], [0x2000, 0x2040, 0x2060])
+        self.assertEqual(buf[2].getAlias(), "input_2")
+        self.assertEqual(len(self.ctx.getSymbolicVariables()), 3)
+        self.assertTrue(all(self.ctx.isMemorySymbolized(MemoryAccess(0x2000 + i, CPUSIZE.BYTE)) for i in range(100)))
+        # A load across two chunks, and its model written back to the buffer
+        node = self.ctx.getMemoryAst(MemoryAccess(0x203e, CPUSIZE.DWORD))
+        self.assertEqual(node.evaluate(), 0x41414141)
+        out = bytearray(b"A" * 100)
+        self.ctx.applyModelToBuffer(self.ctx.getModel(node == 0x64636261), 0x2000, out)
+        self.assertEqual(bytes(out[0x3e:0x42]), b"abcd")
+
+
+
+class TestSolvingThreads(unittest.TestCase):
+
+    """Testing the solving of contexts driven by several threads."""
+
+    def solve(self, results, index):
+        ctx = TritonContext(ARCH.X86_64)
+        ast = ctx.getAstContext()
+        var = ast.variable(ctx.newSymbolicVariable(32, "x"))
+        model = ctx.getModel(ast.bswap(var) == 0x44332211 + index)
+        results[index] = model[0].getValue()
+
+    def test_threads(self):
+        results = [None] * 4
+        threads = [threading.Thread(target=self.solve, args=(results, i)) for i in range(4)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        self.assertEqual(results, [0x11223344, 0x12223344, 0x13223344, 0x14223344])
+
+    def test_callbacks(self):
+        # The callbacks take the GIL back while the simplification runs without it
+        ctx = TritonContext(ARCH.X86_64)
+        ast = ctx.getAstContext()
+        seen = []
+        def cb(ctx, node):
+            seen.append(node)
+            return node
+        ctx.addCallback(CALLBACK.SYMBOLIC_SIMPLIFICATION, cb)
+        var = ast.variable(ctx.newSymbolicVariable(32, "x"))
+        self.assertEqual(str(ctx.simplify(var + 1)), str(var + 1))
+        self.assertTrue(len(seen) > 0)
+
+
+class TestSolverCorpus(unittest.TestCase):
+
+    """Testing the dump of the solver queries."""
+
+    def test_dump(self):
+        path = os.path.join(tempfile.mkdtemp(), 'queries.corpus')
+        ctx = TritonContext()
+        # The dump outlives the engines created by setArchitecture
+        ctx.dumpSolverQueries(path)
+        ctx.setArchitecture(ARCH.X86_64)
+        ast = ctx.getAstContext()
+        var = ast.variable(ctx.newSymbolicVariable(32, "x"))
+        ctx.isSat(var == 1)
+        size = os.path.getsize(path)
+        self.assertTrue(size > 0)
+        ctx.getModel(var == 2)
+        self.assertTrue(os.path.getsize(path) > size)
+        size = os.path.getsize(path)
+        ctx.dumpSolverQueries("")
+        ctx.isSat(var == 3)
+        self.assertEqual(os.path.getsize(path), size)
+        os.remove(path)
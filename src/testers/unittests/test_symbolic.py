@@ -4,7 +4,7 @@
 
 import unittest
 
-from triton import ARCH, Instruction, CPUSIZE, MemoryAccess, Immediate, TritonContext
+from triton import ARCH, AST_NODE, BasicBlock, Instruction, CPUSIZE, MemoryAccess, Immediate, TritonContext, MODE, VERSION
 
 
 class TestSymbolic(unittest.TestCase):
@@ -62,6 +62,307 @@ class TestSymbolic(unittest.TestCase):
             self.Triton.assignSymbolicExpressionToRegister(expr1, self.Triton.registers.rax)
 
 
+    def test_semantics_cache(self):
+        """Check replayed semantics match the lifted ones."""
+        code = [
+            (0x1000, b"\x48\x01\xd8"), # add rax, rbx
+            (0x1003, b"\x48\x31\xc1"), # xor rcx, rax
+            (0x1006, b"\x48\xff\xc3"), # inc rbx
+        ]
+        ref = TritonContext(ARCH.X86_64)
+        self.Triton.enableSemanticsCache(True)
+        self.assertTrue(self.Triton.isSemanticsCacheEnabled())
+
+        for ctx in [ref, self.Triton]:
+            ctx.setConcreteRegisterValue(ctx.registers.rax, 0x41)
+            ctx.symbolizeRegister(ctx.registers.rbx)
+            for _ in range(3):
+                for addr, opcode in code:
+                    ctx.processing(Instruction(addr, opcode))
+
+        self.assertEqual(self.Triton.getSemanticsCacheSize(), 3)
+        for reg in ["rax", "rbx", "rcx", "zf", "sf"]:
+            r1 = ref.getRegister(reg)
+            r2 = self.Triton.getRegister(reg)
+            self.assertEqual(ref.getConcreteRegisterValue(r1), self.Triton.getConcreteRegisterValue(r2))
+            self.assertEqual(ref.getSymbolicRegister(r1).getAst().getHash(), self.Triton.getSymbolicRegister(r2).getAst().getHash())
+
+        self.Triton.clearSemanticsCache()
+        self.assertEqual(self.Triton.getSemanticsCacheSize(), 0)
+
+    def test_concrete_memo(self):
+        """Check replayed executions match the lifted ones."""
+        code = [
+            (0x1000, b"\x48\x8b\x0b"),     # mov rcx, [rbx]
+            (0x1003, b"\x48\x01\xd1"),     # add rcx, rdx
+            (0x1006, b"\x48\x89\x4b\x08"), # mov [rbx + 8], rcx
+            (0x100a, b"\x31\xc0"),         # xor eax, eax
+        ]
+        ref = TritonContext(ARCH.X86_64)
+        self.Triton.enableConcreteMemo(True, capacity=0x100)
+        self.assertTrue(self.Triton.isConcreteMemoEnabled())
+
+        for ctx in [ref, self.Triton]:
+            ctx.setConcreteRegisterValue(ctx.registers.rax, 0x41)
+            ctx.setConcreteRegisterValue(ctx.registers.rbx, 0x2000)
+            ctx.setConcreteRegisterValue(ctx.registers.rdx, 0x10)
+            ctx.setConcreteMemoryValue(MemoryAccess(0x2000, CPUSIZE.QWORD), 0x1234)
+            for _ in range(3):
+                for addr, opcode in code:
+                    ctx.processing(Instruction(addr, opcode))
+
+        stats = self.Triton.getConcreteMemoStats()
+        self.assertEqual(stats["records"], 4)
+        self.assertEqual(stats["hits"], 8)
+        self.assertEqual(stats["size"], 4)
+        self.assertEqual(stats["capacity"], 0x100)
+
+        for reg in ["rax", "rcx", "rip", "zf", "sf", "cf"]:
+            r1 = ref.getRegister(reg)
+            r2 = self.Triton.getRegister(reg)
+            self.assertEqual(ref.getConcreteRegisterValue(r1), self.Triton.getConcreteRegisterValue(r2))
+        self.assertEqual(self.Triton.getConcreteMemoryValue(MemoryAccess(0x2008, CPUSIZE.QWORD)), 0x1244)
+
+        # New values or symbolized inputs go through the semantics
+        self.Triton.setConcreteMemoryValue(MemoryAccess(0x2000, CPUSIZE.QWORD), 0x2000)
+        self.Triton.symbolizeRegister(self.Triton.registers.rdx)
+        for addr, opcode in code[:3]:
+            self.Triton.processing(Instruction(addr, opcode))
+
+        self.assertEqual(self.Triton.getConcreteMemoStats()["hits"], 8)
+        self.assertEqual(self.Triton.getConcreteMemoryValue(MemoryAccess(0x2008, CPUSIZE.QWORD)), 0x2010)
+        self.assertTrue(self.Triton.isMemorySymbolized(MemoryAccess(0x2008, CPUSIZE.QWORD)))
+
+        self.Triton.clearConcreteMemo()
+        self.assertEqual(self.Triton.getConcreteMemoStats()["size"], 0)
+
+    def test_lazy_flags(self):
+        """Check deferred flags match the eager ones."""
+        code = [
+            (0x1000, b"\x48\x01\xd8"), # add rax, rbx
+            (0x1003, b"\x48\x29\xc1"), # sub rcx, rax
+            (0x1006, b"\x48\x39\xc8"), # cmp rax, rcx
+            (0x1009, b"\x74\x00"),     # je 0x100b
+            (0x100b, b"\x48\xff\xc0"), # inc rax
+        ]
+        ref = TritonContext(ARCH.X86_64)
+        self.Triton.setMode(MODE.LAZY_FLAGS, True)
+
+        for ctx in [ref, self.Triton]:
+            ctx.setConcreteRegisterValue(ctx.registers.rax, 0x41)
+            ctx.symbolizeRegister(ctx.registers.rbx)
+            for addr, opcode in code:
+                ctx.processing(Instruction(addr, opcode))
+
+        # Flags overwritten before being read never get an expression
+        self.assertLess(len(self.Triton.getSymbolicExpressions()), len(ref.getSymbolicExpressions()))
+
+        for reg in ["rax", "rcx", "zf", "sf", "of", "cf", "af", "pf"]:
+            r1 = ref.getRegister(reg)
+            r2 = self.Triton.getRegister(reg)
+            self.assertEqual(ref.getConcreteRegisterValue(r1), self.Triton.getConcreteRegisterValue(r2))
+            self.assertEqual(ref.getAstContext().unroll(ref.getSymbolicRegister(r1).getAst()).getHash(),
+                             self.Triton.getAstContext().unroll(self.Triton.getSymbolicRegister(r2).getAst()).getHash())
+
+    def test_block_flags(self):
+        """Check the flags overwritten in a basic block are not built."""
+        code = [
+            b"\x48\x01\xd8", # add rax, rbx
+            b"\x48\x29\xc1", # sub rcx, rax
+            b"\x48\x39\xc8", # cmp rax, rcx
+            b"\x74\x00",     # je 0x100b
+        ]
+        ref = TritonContext(ARCH.X86_64)
+        block = BasicBlock([Instruction(opcode) for opcode in code])
+
+        for ctx in [ref, self.Triton]:
+            ctx.setConcreteRegisterValue(ctx.registers.rax, 0x41)
+            ctx.symbolizeRegister(ctx.registers.rbx)
+
+        addr = 0x1000
+        for opcode in code:
+            inst = Instruction(addr, opcode)
+            ref.processing(inst)
+            addr += inst.getSize()
+        self.Triton.processing(block, 0x1000)
+
+        self.assertLess(len(self.Triton.getSymbolicExpressions()), len(ref.getSymbolicExpressions()))
+
+        # The flags read by the branch are listed by the comparison
+        flags = [r.getName() for r, _ in block.getInstructions()[2].getWrittenRegisters()]
+        self.assertIn("zf", flags)
+        self.assertEqual(len([r for r, _ in block.getInstructions()[0].getWrittenRegisters() if r.getName() == "zf"]), 0)
+
+        for reg in ["rax", "rcx", "zf", "sf", "of", "cf", "af", "pf"]:
+            r1 = ref.getRegister(reg)
+            r2 = self.Triton.getRegister(reg)
+            self.assertEqual(ref.getConcreteRegisterValue(r1), self.Triton.getConcreteRegisterValue(r2))
+            self.assertEqual(ref.getAstContext().unroll(ref.getSymbolicRegister(r1).getAst()).getHash(),
+                             self.Triton.getAstContext().unroll(self.Triton.getSymbolicRegister(r2).getAst()).getHash())
+
+    def test_concrete_fast_path(self):
+        """Check instructions on concrete values are emulated without expressions."""
+        code = [
+            (0x1000, b"\x48\x89\x03"),     # mov [rbx], rax
+            (0x1003, b"\x48\x83\xc0\x01"), # add rax, 1
+            (0x1007, b"\x48\x8b\x0b"),     # mov rcx, [rbx]
+            (0x100a, b"\x48\x01\xd1"),     # add rcx, rdx
+        ]
+        self.Triton.setMode(MODE.CONCRETE_FAST_PATH, True)
+        self.Triton.setConcreteRegisterValue(self.Triton.registers.rax, 0x41)
+        self.Triton.setConcreteRegisterValue(self.Triton.registers.rbx, 0x2000)
+        self.Triton.setConcreteRegisterValue(self.Triton.registers.rdx, 0x10)
+        self.Triton.symbolizeMemory(MemoryAccess(0x2000, CPUSIZE.QWORD))
+        self.Triton.symbolizeRegister(self.Triton.registers.rdx)
+
+        insts = []
+        for addr, opcode in code:
+            inst = Instruction(addr, opcode)
+            self.Triton.processing(inst)
+            insts.append(inst)
+
+        # The symbolic memory is overwritten by a concrete value
+        self.assertEqual(len(insts[0].getSymbolicExpressions()), 0)
+        self.assertEqual(insts[0].getStoreAccess()[0][0].getAddress(), 0x2000)
+        self.assertFalse(self.Triton.isMemorySymbolized(MemoryAccess(0x2000, CPUSIZE.QWORD)))
+        self.assertEqual(len(insts[1].getSymbolicExpressions()), 0)
+        self.assertEqual(len(insts[2].getSymbolicExpressions()), 0)
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rax), 0x42)
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rip), 0x100d)
+
+        # Reading a symbolic register goes through the semantics
+        self.assertNotEqual(len(insts[3].getSymbolicExpressions()), 0)
+        self.assertTrue(self.Triton.isRegisterSymbolized(self.Triton.registers.rcx))
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rcx), 0x51)
+
+    def test_bulk_string_instructions(self):
+        """Check a REP string instruction with a concrete counter runs in one processing."""
+        ref = TritonContext(ARCH.X86_64)
+        self.Triton.setMode(MODE.BULK_STRING_INSTRUCTIONS, True)
+        for ctx in [ref, self.Triton]:
+            ctx.setConcreteMemoryAreaValue(0x3000, bytes(range(0x40)))
+            ctx.symbolizeMemory(MemoryAccess(0x3010, CPUSIZE.BYTE))
+            ctx.taintMemory(0x3020)
+            ctx.setConcreteRegisterValue(ctx.registers.rsi, 0x3000)
+            ctx.setConcreteRegisterValue(ctx.registers.rdi, 0x4000)
+            ctx.setConcreteRegisterValue(ctx.registers.rcx, 0x40)
+
+        # rep movsb
+        inst = Instruction(0x1000, b"\xf3\xa4")
+        self.Triton.processing(inst)
+        while ref.getConcreteRegisterValue(ref.registers.rip) != 0x1002:
+            ref.processing(Instruction(0x1000, b"\xf3\xa4"))
+
+        self.assertEqual(len(inst.getStoreAccess()), 1)
+        for ctx in [ref, self.Triton]:
+            self.assertEqual(ctx.getConcreteMemoryAreaValue(0x4000, 0x40), bytes(range(0x40)))
+            self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rsi), 0x3040)
+            self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rdi), 0x4040)
+            self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rcx), 0)
+            self.assertTrue(ctx.isMemorySymbolized(0x4010))
+            self.assertFalse(ctx.isMemorySymbolized(0x4011))
+            self.assertTrue(ctx.isMemoryTainted(0x4020))
+            self.assertFalse(ctx.isMemoryTainted(0x4021))
+
+        # repne scasb stops on the symbolic byte, then on the matching one
+        for ctx in [ref, self.Triton]:
+            ctx.setConcreteRegisterValue(ctx.registers.al, 0x18)
+            ctx.setConcreteRegisterValue(ctx.registers.rdi, 0x4000)
+            ctx.setConcreteRegisterValue(ctx.registers.rcx, 0x40)
+
+        self.Triton.processing(Instruction(0x1002, b"\xf2\xae"))
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rdi), 0x4010)
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rip), 0x1002)
+        while self.Triton.getConcreteRegisterValue(self.Triton.registers.rip) != 0x1004:
+            self.Triton.processing(Instruction(0x1002, b"\xf2\xae"))
+        while ref.getConcreteRegisterValue(ref.registers.rip) != 0x1004:
+            ref.processing(Instruction(0x1002, b"\xf2\xae"))
+
+        for reg in ["rdi", "rcx", "zf", "sf", "of", "cf", "af", "pf"]:
+            self.assertEqual(ref.getConcreteRegisterValue(ref.getRegister(reg)), self.Triton.getConcreteRegisterValue(self.Triton.getRegister(reg)))
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rdi), 0x4019)
+
+    def test_processing_jit(self):
+        """Check a register loop runs through native code."""
+        if VERSION.LLVM_INTERFACE is True:
+            block = BasicBlock([
+                Instruction(b"\x48\x01\xd8"), # add rax, rbx
+                Instruction(b"\x48\xff\xc9"), # dec rcx
+                Instruction(b"\x75\xf8"),     # jne loop
+            ])
+            self.Triton.setMode(MODE.PC_TRACKING_SYMBOLIC, True)
+            self.Triton.setConcreteRegisterValue(self.Triton.registers.rbx, 3)
+            self.Triton.setConcreteRegisterValue(self.Triton.registers.rcx, 10)
+            for _ in range(10):
+                self.Triton.processingJit(block, 0x1000)
+
+            self.assertEqual(self.Triton.getJitCacheSize(), 1)
+            self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rax), 30)
+            self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rcx), 0)
+            self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.zf), 1)
+            self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rip), 0x1008)
+
+            self.Triton.clearJitCache()
+            self.assertEqual(self.Triton.getJitCacheSize(), 0)
+
+    def test_warm_reset(self):
+        """Check a warm reset drops the state but keeps the semantics cache."""
+        code = [
+            (0x1000, b"\x48\x01\xd8"), # add rax, rbx
+            (0x1003, b"\x48\x31\xc1"), # xor rcx, rax
+            (0x1006, b"\x74\x00"),     # je 0x1008
+        ]
+        self.Triton.enableSemanticsCache(True)
+
+        for _ in range(2):
+            self.Triton.setMode(MODE.ALIGNED_MEMORY, True)
+            self.Triton.setConcreteRegisterValue(self.Triton.registers.rax, 0x41)
+            self.Triton.taintRegister(self.Triton.registers.rax)
+            var = self.Triton.symbolizeRegister(self.Triton.registers.rbx)
+            for addr, opcode in code:
+                self.Triton.processing(Instruction(addr, opcode))
+
+            self.assertEqual(var.getId(), 0)
+            self.assertEqual(len(self.Triton.getPathConstraints()), 1)
+            self.assertTrue(self.Triton.isRegisterTainted(self.Triton.registers.rcx))
+            self.assertTrue(self.Triton.getSymbolicRegister(self.Triton.registers.rcx).getAst().isSymbolized())
+
+            self.Triton.warmReset()
+
+            self.assertEqual(len(self.Triton.getSymbolicVariables()), 0)
+            self.assertEqual(len(self.Triton.getSymbolicExpressions()), 0)
+            self.assertEqual(len(self.Triton.getPathConstraints()), 0)
+            self.assertFalse(self.Triton.isRegisterTainted(self.Triton.registers.rcx))
+            self.assertFalse(self.Triton.isModeEnabled(MODE.ALIGNED_MEMORY))
+            self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rax), 0)
+            self.assertEqual(self.Triton.getSemanticsCacheSize(), 2)
+
+    def test_warm_reset_fork(self):
+        """Check a warm reset of a fork leaves the other side untouched."""
+        self.Triton.setMode(MODE.ALIGNED_MEMORY, True)
+        var = self.Triton.symbolizeRegister(self.Triton.registers.rbx)
+        self.Triton.setConcreteVariableValue(var, 0x10)
+        self.Triton.processing(Instruction(0x1000, b"\x48\x8d\x43\x01")) # lea rax, [rbx + 1]
+        rax = self.Triton.getSymbolicRegister(self.Triton.registers.rax).getAst()
+
+        fork = self.Triton.fork()
+        fork.warmReset()
+
+        # The fork starts again from zero, on its own variables and modes
+        self.assertEqual(len(fork.getSymbolicVariables()), 0)
+        self.assertFalse(fork.isModeEnabled(MODE.ALIGNED_MEMORY))
+        other = fork.newSymbolicVariable(64)
+        fork.setConcreteVariableValue(other, 0x99)
+        self.assertEqual(other.getId(), 0)
+
+        # The parent keeps its variables, their values and its modes
+        self.assertTrue(self.Triton.isModeEnabled(MODE.ALIGNED_MEMORY))
+        self.assertEqual(self.Triton.getConcreteVariableValue(var), 0x10)
+        self.assertEqual(rax.evaluate(), 0x11)
+        model = self.Triton.getModel(rax == 0x42)
+        self.assertEqual(model[var.getId()].getValue(), 0x41)
+
+
 class TestSymbolicBuilding(unittest.TestCase):
 
     """Testing symbolic building."""
@@ -102,3 +403,128 @@ class TestSymbolicBuilding(unittest.TestCase):
         node = self.Triton.getRegisterAst(self.Triton.registers.al)
         self.assertEqual(node.evaluate(), 0x88)
         self.assertEqual(node.getBitvectorSize(), CPUSIZE.BYTE_BIT)
+
+
+class TestSymbolicIterators(unittest.TestCase):
+
+    """Testing the lazy iterators over the symbolic state."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.symbolizeRegister(self.ctx.registers.rbx)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rsp, 0x1000)
+        self.ctx.processing(Instruction(b"\x48\x01\xd8"))  # add rax, rbx
+        self.ctx.processing(Instruction(b"\x50"))          # push rax
+
+    def test_expressions(self):
+        ids = sorted(expr.getId() for expr in self.ctx.iterSymbolicExpressions())
+        self.assertEqual(ids, sorted(self.ctx.getSymbolicExpressions()))
+
+    def test_variables(self):
+        ids = sorted(var.getId() for var in self.ctx.iterSymbolicVariables())
+        self.assertEqual(ids, list(self.ctx.getSymbolicVariables()))
+
+    def test_registers(self):
+        regs = dict(self.ctx.iterSymbolicRegisters())
+        self.assertEqual(sorted(regs), sorted(self.ctx.getSymbolicRegisters()))
+        self.assertEqual(regs[self.ctx.registers.rax.getId()].getId(), self.ctx.getSymbolicRegister(self.ctx.registers.rax).getId())
+
+    def test_memory(self):
+        mem = dict(self.ctx.iterSymbolicMemory())
+        self.assertEqual(sorted(mem), list(range(0xff8, 0x1000)))
+        self.assertEqual(sorted(mem), sorted(self.ctx.getSymbolicMemory()))
+
+    def test_lazy(self):
+        it = self.ctx.iterSymbolicMemory()
+        self.assertEqual(it.__length_hint__(), 8)
+        next(it)
+        self.assertEqual(it.__length_hint__(), 7)
+
+        # The entries removed in the meantime are skipped
+        self.ctx.concretizeAllMemory()
+        self.assertEqual(list(it), [])
+
+
+class TestSymbolicMemoryUsage(unittest.TestCase):
+
+    """Testing the memory accounting of the engines."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setConcreteMemoryValue(0x1000, 0x41)
+        self.ctx.symbolizeRegister(self.ctx.registers.rbx)
+        self.ctx.processing(Instruction(b"\x48\x01\xd8"))  # add rax, rbx
+
+    def test_usage(self):
+        usage = self.ctx.getMemoryUsage()
+        self.assertGreater(usage["symbolicExpressions"], 0)
+        self.assertGreater(usage["symbolicRegisters"], 0)
+        self.assertEqual(usage["concreteMemoryPages"], 1)
+        self.assertGreater(usage["totalBytes"], sum(usage["astNodesBytes"].values()))
+
+    def test_nodes(self):
+        ast = self.ctx.getAstContext()
+        before = self.ctx.getMemoryUsage()["astNodes"].get(AST_NODE.BVNAND, 0)
+        node = ast.bvnand(ast.bv(1, 8), ast.bv(2, 8))
+        self.assertEqual(self.ctx.getMemoryUsage()["astNodes"][AST_NODE.BVNAND], before + 1)
+        del node
+        self.assertEqual(self.ctx.getMemoryUsage()["astNodes"].get(AST_NODE.BVNAND, 0), before)
+
+
+class TestSymbolicIndexes(unittest.TestCase):
+
+    """Testing the indexes of the symbolic expressions."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.taintRegister(self.ctx.registers.rbx)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rsp, 0x1000)
+        self.ctx.processing(Instruction(0x100, b"\x48\x01\xd8"))  # add rax, rbx
+        self.ctx.processing(Instruction(0x103, b"\x50"))          # push rax
+        self.ctx.processing(Instruction(0x104, b"\x48\x31\xc9"))  # xor rcx, rcx
+
+    def test_tainted(self):
+        ids = sorted(e.getId() for e in self.ctx.getTaintedSymbolicExpressions())
+        ref = sorted(i for i, e in self.ctx.getSymbolicExpressions().items() if e.isTainted())
+        self.assertGreater(len(ids), 0)
+        self.assertEqual(ids, ref)
+
+    def test_types(self):
+        for kind in (SYMBOLIC.MEMORY_EXPRESSION, SYMBOLIC.REGISTER_EXPRESSION, SYMBOLIC.VOLATILE_EXPRESSION):
+            ref = sorted(i for i, e in self.ctx.getSymbolicExpressions().items() if e.getType() == kind)
+            self.assertEqual(sorted(self.ctx.getSymbolicExpressions(kind)), ref)
+
+    def test_addresses(self):
+        exprs = self.ctx.getSymbolicExpressionsAt(0x104)
+        self.assertGreater(len(exprs), 0)
+        self.assertTrue(all(e.getAddress() == 0x104 for e in exprs))
+        self.assertEqual([e.getId() for e in exprs], sorted(e.getId() for e in exprs))
+        self.assertEqual(self.ctx.getSymbolicExpressionsAt(0x200), [])
+
+
+class TestSymbolicVariableIndexes(unittest.TestCase):
+
+    """Testing the lookups of the symbolic variables."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.vars = [self.ctx.symbolizeMemory(MemoryAccess(0x1000 + i, CPUSIZE.BYTE), "input") for i in range(4)]
+        self.reg = self.ctx.symbolizeRegister(self.ctx.registers.rax, "counter")
+
+    def test_name(self):
+        for var in self.vars:
+            self.assertEqual(self.ctx.getSymbolicVariable(var.getName()).getId(), var.getId())
+
+    def test_alias(self):
+        self.assertEqual(self.ctx.getSymbolicVariable("input").getId(), self.vars[0].getId())
+        self.assertEqual(self.ctx.getSymbolicVariable("counter").getId(), self.reg.getId())
+        self.vars[2].setAlias("length")
+        self.assertEqual(self.ctx.getSymbolicVariable("length").getId(), self.vars[2].getId())
+        with self.assertRaises(Exception):
+            self.ctx.getSymbolicVariable("missing")
+
+    def test_type_and_origin(self):
+        self.assertEqual(sorted(self.ctx.getSymbolicVariables(SYMBOLIC.MEMORY_VARIABLE)), [v.getId() for v in self.vars])
+        self.assertEqual(list(self.ctx.getSymbolicVariables(SYMBOLIC.REGISTER_VARIABLE)), [self.reg.getId()])
+        self.assertEqual(list(self.ctx.getSymbolicVariables(SYMBOLIC.MEMORY_VARIABLE, 0x1002)), [self.vars[2].getId()])
+        self.assertEqual(self.ctx.getSymbolicVariables(SYMBOLIC.MEMORY_VARIABLE, 0x2000), {})
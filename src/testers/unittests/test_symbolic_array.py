@@ -199,3 +199,70 @@ class TestSymbolicArray(unittest.TestCase):
 
         x = self.ctx.getMemoryAst(MemoryAccess(0x1000, 4))
         self.assertEqual(x.evaluate(), 0xdeadbeef)
+
+
+class TestPointerResolution(unittest.TestCase):
+
+    """Testing the resolution of the symbolic pointers."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setMode(MODE.POINTER_RESOLUTION, True)
+        self.ctx.setConcreteMemoryAreaValue(0x2000, b"\x11\x00\x00\x00\x22\x00\x00\x00\x33\x00\x00\x00\x44\x00\x00\x00")
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 1)
+        self.var = self.ctx.symbolizeRegister(self.ctx.registers.rax, 'rax')
+
+    def test_interval(self):
+        """The pointer of a masked index is resolved without any query."""
+        self.ctx.processing(Instruction(0x1000, b"\x83\xe0\x03"))                 # and eax, 3
+        self.ctx.processing(Instruction(0x1003, b"\x8b\x1c\x85\x00\x20\x00\x00")) # mov ebx, [rax*4 + 0x2000]
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.ebx), 0x22)
+        self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.ebx))
+
+        ast = self.ctx.getAstContext()
+        model = self.ctx.getModel(ast.equal(self.ctx.getRegisterAst(self.ctx.registers.ebx), ast.bv(0x44, 32)))
+        self.assertEqual(model[self.var.getId()].getValue() & 3, 3)
+
+    def test_enumeration(self):
+        """The pointer of a bounded index is resolved by the solver."""
+        self.ctx.processing(Instruction(0x1000, b"\x48\x83\xf8\x03"))             # cmp rax, 3
+        self.ctx.processing(Instruction(0x1004, b"\x73\x07"))                     # jae +7
+        self.ctx.processing(Instruction(0x1006, b"\x8b\x1c\x85\x00\x20\x00\x00")) # mov ebx, [rax*4 + 0x2000]
+        self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.ebx))
+
+        ast = self.ctx.getAstContext()
+        ebx = self.ctx.getRegisterAst(self.ctx.registers.ebx)
+        path = self.ctx.getPathPredicate()
+        model = self.ctx.getModel(ast.land([path, ast.equal(ebx, ast.bv(0x33, 32))]))
+        self.assertEqual(model[self.var.getId()].getValue(), 2)
+        self.assertEqual(len(self.ctx.getModel(ast.land([path, ast.equal(ebx, ast.bv(0x44, 32))]))), 0)
+
+    def test_bound(self):
+        """The pointers with more addresses than the bound are concretized."""
+        self.assertEqual(self.ctx.getPointerResolutionBound(), 16)
+        self.ctx.setPointerResolutionBound(2)
+        self.ctx.processing(Instruction(0x1000, b"\x48\x83\xf8\x03"))             # cmp rax, 3
+        self.ctx.processing(Instruction(0x1004, b"\x73\x07"))                     # jae +7
+        self.ctx.processing(Instruction(0x1006, b"\x8b\x1c\x85\x00\x20\x00\x00")) # mov ebx, [rax*4 + 0x2000]
+        self.assertFalse(self.ctx.isRegisterSymbolized(self.ctx.registers.ebx))
+
+    def test_store(self):
+        """A store through a resolved pointer writes each address under a condition."""
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.ecx, 0x99)
+        self.ctx.processing(Instruction(0x1000, b"\x83\xe0\x03"))                 # and eax, 3
+        self.ctx.processing(Instruction(0x1003, b"\x89\x0c\x85\x00\x20\x00\x00")) # mov [rax*4 + 0x2000], ecx
+        self.assertEqual(self.ctx.getConcreteMemoryValue(MemoryAccess(0x2004, CPUSIZE.DWORD)), 0x99)
+        self.assertEqual(self.ctx.getConcreteMemoryValue(MemoryAccess(0x2008, CPUSIZE.DWORD)), 0x33)
+        self.assertTrue(self.ctx.isMemorySymbolized(MemoryAccess(0x2008, CPUSIZE.DWORD)))
+
+        ast = self.ctx.getAstContext()
+        cell = self.ctx.getMemoryAst(MemoryAccess(0x2008, CPUSIZE.DWORD))
+        model = self.ctx.getModel(ast.equal(cell, ast.bv(0x99, 32)))
+        self.assertEqual(model[self.var.getId()].getValue() & 3, 2)
+
+    def test_disabled(self):
+        """Without the mode, the pointer is concretized."""
+        self.ctx.setMode(MODE.POINTER_RESOLUTION, False)
+        self.ctx.processing(Instruction(0x1000, b"\x83\xe0\x03"))                 # and eax, 3
+        self.ctx.processing(Instruction(0x1003, b"\x8b\x1c\x85\x00\x20\x00\x00")) # mov ebx, [rax*4 + 0x2000]
+        self.assertFalse(self.ctx.isRegisterSymbolized(self.ctx.registers.ebx))
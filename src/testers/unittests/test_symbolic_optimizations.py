@@ -38,3 +38,60 @@ class TestSymbolicOptimizations(unittest.TestCase):
         self.assertEqual(rcx.getType(), AST_NODE.REFERENCE)
         self.assertEqual(rcx.evaluate(), 1)
         return
+
+
+class TestConcreteConditionalExecution(unittest.TestCase):
+
+    """Testing conditional instructions on concrete flags."""
+
+    def test_arm32_not_executed(self):
+        ctx = TritonContext(ARCH.ARM32)
+        ctx.setConcreteRegisterValue(ctx.registers.r0, 0x10)
+        ctx.setConcreteRegisterValue(ctx.registers.z, 1)
+
+        inst = Instruction(0x1000, b"\x01\x00\x80\x12") # addne r0, r0, #1
+        self.assertEqual(ctx.processing(inst), EXCEPTION.NO_FAULT)
+        self.assertFalse(inst.isConditionTaken())
+        self.assertEqual(len(inst.getSymbolicExpressions()), 1)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.r0), 0x10)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.pc), 0x1004)
+        return
+
+
+    def test_arm32_executed(self):
+        ctx = TritonContext(ARCH.ARM32)
+        ctx.setConcreteRegisterValue(ctx.registers.r0, 0x10)
+
+        inst = Instruction(0x1000, b"\x01\x00\x80\x12") # addne r0, r0, #1
+        self.assertEqual(ctx.processing(inst), EXCEPTION.NO_FAULT)
+        self.assertTrue(inst.isConditionTaken())
+        self.assertNotEqual(ctx.getSymbolicRegister(ctx.registers.r0).getAst().getType(), AST_NODE.ITE)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.r0), 0x11)
+        return
+
+
+    def test_arm32_symbolized(self):
+        ctx = TritonContext(ARCH.ARM32)
+        ctx.setConcreteRegisterValue(ctx.registers.r0, 0x10)
+        ctx.symbolizeRegister(ctx.registers.z)
+
+        inst = Instruction(0x1000, b"\x01\x00\x80\x12") # addne r0, r0, #1
+        self.assertEqual(ctx.processing(inst), EXCEPTION.NO_FAULT)
+        self.assertEqual(ctx.getSymbolicRegister(ctx.registers.r0).getAst().getType(), AST_NODE.ITE)
+        return
+
+
+    def test_aarch64_csel(self):
+        ctx = TritonContext(ARCH.AARCH64)
+        ctx.setConcreteRegisterValue(ctx.registers.x1, 0x11)
+        ctx.setConcreteRegisterValue(ctx.registers.x2, 0x22)
+        ctx.setConcreteRegisterValue(ctx.registers.z, 1)
+
+        ctx.processing(Instruction(b"\x20\x00\x82\x9a")) # csel x0, x1, x2, eq
+        self.assertNotEqual(ctx.getSymbolicRegister(ctx.registers.x0).getAst().getType(), AST_NODE.ITE)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.x0), 0x11)
+
+        ctx.symbolizeRegister(ctx.registers.z)
+        ctx.processing(Instruction(b"\x20\x00\x82\x9a")) # csel x0, x1, x2, eq
+        self.assertEqual(ctx.getSymbolicRegister(ctx.registers.x0).getAst().getType(), AST_NODE.ITE)
+        return
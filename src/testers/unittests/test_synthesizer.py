@@ -2,8 +2,10 @@
 # coding: utf-8
 """Test synthesizing."""
 
-import unittest
+import os
 import random
+import tempfile
+import unittest
 
 from triton import *
 
@@ -63,6 +65,10 @@ class TestSynth_1(unittest.TestCase):
         for org, obfu in self.obf_exprs:
             self.assertEqual(str(self.ctx.synthesize(obfu, constant=True, subexpr=True, opaque=True)), org)
 
+    def test_parallel(self):
+        for org, obfu in self.obf_exprs:
+            self.assertEqual(str(self.ctx.synthesize(obfu, constant=True, subexpr=True, opaque=True, threads=4)), org)
+
 
 class TestSynth_2(unittest.TestCase):
     def setUp(self):
@@ -105,3 +111,89 @@ class TestSynth_2(unittest.TestCase):
         ast = self.ctx.getAstContext()
         res = str(ast.unroll(self.ctx.synthesize(eax, constant=False, subexpr=True)))
         self.assertLessEqual(res, "(bvadd (bvadd a (bvmul (bvmul a b) b)) (_ bv1 32))")
+
+
+class TestSynth_3(unittest.TestCase):
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.ctx.setAstRepresentationMode(AST_REPRESENTATION.PYTHON)
+
+    def obfuscated_xor(self, ctx, x, y):
+        ast = ctx.getAstContext()
+        x = ast.variable(ctx.newSymbolicVariable(32, x))
+        y = ast.variable(ctx.newSymbolicVariable(32, y))
+        return (x & ~y) | (~x & y)
+
+    def test_cache(self):
+        self.assertFalse(self.ctx.isSynthesisCacheEnabled())
+        self.ctx.enableSynthesisCache(True)
+        self.assertTrue(self.ctx.isSynthesisCacheEnabled())
+
+        # The first gadget is synthesized and recorded
+        self.assertEqual(str(self.ctx.synthesize(self.obfuscated_xor(self.ctx, 'x', 'y'))), '(x ^ y)')
+        self.assertEqual(self.ctx.getSynthesisCacheHits(), 0)
+        size = self.ctx.getSynthesisCacheSize()
+        self.assertGreater(size, 0)
+
+        # The same gadget on other variables is answered by the cache
+        self.assertEqual(str(self.ctx.synthesize(self.obfuscated_xor(self.ctx, 'a', 'b'))), '(a ^ b)')
+        self.assertEqual(self.ctx.getSynthesisCacheHits(), 1)
+        self.assertEqual(self.ctx.getSynthesisCacheSize(), size)
+
+        # The results are kept across a reset and can be saved for another context
+        self.ctx.reset()
+        self.assertEqual(self.ctx.getSynthesisCacheSize(), size)
+
+        path = os.path.join(tempfile.mkdtemp(), 'synthesis.cache')
+        self.ctx.saveSynthesisCache(path)
+
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setAstRepresentationMode(AST_REPRESENTATION.PYTHON)
+        ctx.loadSynthesisCache(path)
+        ctx.enableSynthesisCache(True)
+        self.assertEqual(ctx.getSynthesisCacheSize(), size)
+        self.assertEqual(str(ctx.synthesize(self.obfuscated_xor(ctx, 'u', 'v'))), '(u ^ v)')
+        self.assertEqual(ctx.getSynthesisCacheHits(), 1)
+        os.remove(path)
+
+        self.ctx.clearSynthesisCache()
+        self.assertEqual(self.ctx.getSynthesisCacheSize(), 0)
+        self.assertEqual(self.ctx.getSynthesisCacheHits(), 0)
+
+    def test_database(self):
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, 'x'))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(8, 'y'))
+        z = self.ast.variable(self.ctx.newSymbolicVariable(8, 'z'))
+
+        # A three variables expression, which is out of reach of the oracles
+        inputs = [[random.randrange(0, 0x100) for i in range(3)] for j in range(16)]
+        path = os.path.join(tempfile.mkdtemp(), 'synthesis.db')
+        self.assertEqual(self.ctx.writeSynthesisDatabase(path, [x, y, z], inputs, [(x & y) + z, x, y, z]), 4)
+
+        expr = ((x & y) ^ z) + 2 * ((x & y) & z)
+        self.assertEqual(str(self.ctx.synthesize(expr)), 'None')
+
+        self.ctx.loadSynthesisDatabase(path)
+        self.assertEqual(self.ctx.getSynthesisDatabasesSize(), 1)
+        self.assertEqual(str(self.ctx.synthesize(expr)), '((x & y) + z)')
+
+        self.ctx.clearSynthesisDatabases()
+        self.assertEqual(self.ctx.getSynthesisDatabasesSize(), 0)
+        os.remove(path)
+
+    def test_enumeration(self):
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, 'x'))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(8, 'y'))
+        z = self.ast.variable(self.ctx.newSymbolicVariable(8, 'z'))
+
+        # A three variables expression, which is out of reach of the oracles
+        expr = ((x & y) ^ z) + 2 * ((x & y) & z)
+        self.assertEqual(str(self.ctx.synthesize(expr)), 'None')
+
+        # The smallest equivalent expression is of 5 nodes
+        self.assertIsNone(self.ctx.synthesizeByEnumeration(expr, maxSize=4))
+        for threads in [1, 4]:
+            output = self.ctx.synthesizeByEnumeration(expr, maxSize=5, threads=threads)
+            self.assertIn(str(output), ['(z + (x & y))', '((x & y) + z)', '(z + (y & x))', '((y & x) + z)'])
+            self.assertFalse(self.ctx.isSat(output != expr))
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the emulation of the system calls."""
+
+import unittest
+
+from triton import *
+
+
+class TestSyscallsX8664(unittest.TestCase):
+
+    """Testing the Linux system calls on x86-64."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.enableSyscallEmulation(True)
+
+    def syscall(self, number, *args):
+        regs = [self.ctx.registers.rdi, self.ctx.registers.rsi, self.ctx.registers.rdx, self.ctx.registers.r10, self.ctx.registers.r8, self.ctx.registers.r9]
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, number)
+        for reg, arg in zip(regs, args):
+            self.ctx.setConcreteRegisterValue(reg, arg)
+        self.ctx.processing(Instruction(0x1000, b"\x0f\x05"))
+        return self.ctx.getConcreteRegisterValue(self.ctx.registers.rax)
+
+    def test_disabled(self):
+        self.ctx.enableSyscallEmulation(False)
+        self.assertFalse(self.ctx.isSyscallEmulationEnabled())
+        self.assertEqual(self.syscall(39), 39)
+
+    def test_write(self):
+        self.assertTrue(self.ctx.isSyscallEmulationEnabled())
+        self.ctx.setConcreteMemoryAreaValue(0x2000, b"hello\n")
+        self.assertEqual(self.syscall(1, 1, 0x2000, 6), 6)
+        self.assertEqual(self.ctx.getVirtualFile("/dev/stdout"), b"hello\n")
+        self.assertEqual(self.syscall(1, 2, 0x2000, 5), 5)
+        self.assertEqual(self.ctx.getVirtualFile("/dev/stderr"), b"hello")
+
+    def test_read_symbolic(self):
+        self.ctx.addVirtualFile("/dev/stdin", b"AB", True)
+        self.assertEqual(self.syscall(0, 0, 0x2000, 0x10), 2)
+        self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x2000, 2), b"AB")
+        self.assertTrue(self.ctx.isMemorySymbolized(0x2000))
+        self.assertTrue(self.ctx.isMemoryTainted(0x2001))
+        self.assertFalse(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+        self.assertFalse(self.ctx.isRegisterTainted(self.ctx.registers.rax))
+        self.assertEqual(len(self.ctx.getSymbolicVariables()), 2)
+
+        # End of file
+        self.assertEqual(self.syscall(0, 0, 0x2000, 0x10), 0)
+
+    def test_open_read(self):
+        self.ctx.addVirtualFile("/etc/flag", b"flag")
+        self.ctx.setConcreteMemoryAreaValue(0x3000, b"/etc/flag\x00")
+        fd = self.syscall(2, 0x3000, 0, 0)
+        self.assertEqual(fd, 3)
+        self.assertEqual(self.syscall(0, fd, 0x2000, 2), 2)
+        self.assertEqual(self.syscall(0, fd, 0x2002, 2), 2)
+        self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x2000, 4), b"flag")
+        self.assertFalse(self.ctx.isMemorySymbolized(0x2000))
+        self.assertEqual(self.syscall(3, fd), 0)
+
+        # -EBADF and -ENOENT
+        self.assertEqual(self.syscall(0, fd, 0x2000, 2), (1 << 64) - 9)
+        self.ctx.setConcreteMemoryAreaValue(0x3000, b"/etc/none\x00")
+        self.assertEqual(self.syscall(2, 0x3000, 0, 0), (1 << 64) - 2)
+
+    def test_memory(self):
+        self.ctx.setProgramBreak(0x10000000)
+        self.assertEqual(self.syscall(12, 0), 0x10000000)
+        self.assertEqual(self.syscall(12, 0x10002000), 0x10002000)
+        self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x10001ff0, 0x10), b"\x00" * 0x10)
+
+        # mmap(NULL, 0x2000, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)
+        addr = self.syscall(9, 0, 0x2000, 3, 0x22, (1 << 64) - 1, 0)
+        self.assertEqual(addr & 0xfff, 0)
+        self.assertEqual(self.ctx.getConcreteMemoryAreaValue(addr, 0x10), b"\x00" * 0x10)
+        self.assertEqual(self.syscall(11, addr, 0x2000), 0)
+
+    def test_handler(self):
+        def getpid(ctx, number):
+            self.assertEqual(number, 39)
+            return 0x1337
+
+        self.ctx.setSyscallHandler(39, getpid)
+        self.assertEqual(self.syscall(39), 0x1337)
+        self.ctx.removeSyscallHandler(39)
+        self.assertNotEqual(self.syscall(39), 0x1337)
+
+    def test_unknown(self):
+        # -ENOSYS
+        self.assertEqual(self.syscall(0x1000), (1 << 64) - 38)
+
+    def test_exit(self):
+        self.assertFalse(self.ctx.hasProgramExited())
+        self.syscall(231, 42)
+        self.assertTrue(self.ctx.hasProgramExited())
+        self.assertEqual(self.ctx.getProgramExitStatus(), 42)
+
+
+class TestSyscallsX86(unittest.TestCase):
+
+    """Testing the Linux system calls on i386."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.ctx = TritonContext(ARCH.X86)
+        self.ctx.enableSyscallEmulation(True)
+
+    def test_write(self):
+        self.ctx.setConcreteMemoryAreaValue(0x2000, b"hi")
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.eax, 4)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.ebx, 1)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.ecx, 0x2000)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.edx, 2)
+        # int 0x80
+        self.ctx.processing(Instruction(0x1000, b"\xcd\x80"))
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.eax), 2)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.eip), 0x1002)
+        self.assertEqual(self.ctx.getVirtualFile("/dev/stdout"), b"hi")
+
+
+class TestSyscallsAArch64(unittest.TestCase):
+
+    """Testing the Linux system calls on AArch64."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.ctx = TritonContext(ARCH.AARCH64)
+        self.ctx.enableSyscallEmulation(True)
+
+    def test_write(self):
+        self.ctx.setConcreteMemoryAreaValue(0x2000, b"hi")
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.x8, 64)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.x0, 1)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.x1, 0x2000)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.x2, 2)
+        # svc #0
+        self.ctx.processing(Instruction(0x1000, b"\x01\x00\x00\xd4"))
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.x0), 2)
+        self.assertEqual(self.ctx.getVirtualFile("/dev/stdout"), b"hi")
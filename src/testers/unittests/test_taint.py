@@ -429,6 +429,138 @@ class TestTaint(unittest.TestCase):
         self.assertTrue(0x4003 in m)
         self.assertFalse(0x5000 in m)
 
+    def test_taint_memory_range(self):
+        """Taint and untaint ranges of memory"""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+
+        # A range across several pages
+        Triton.taintMemory(0x10ff0, 0x3000)
+        self.assertTrue(Triton.isMemoryTainted(0x10ff0))
+        self.assertTrue(Triton.isMemoryTainted(0x13fef))
+        self.assertFalse(Triton.isMemoryTainted(0x13ff0))
+        self.assertFalse(Triton.isMemoryTainted(0x10fe0, 0x10))
+        self.assertTrue(Triton.isMemoryTainted(0x10fe0, 0x11))
+        self.assertEqual(len(Triton.getTaintedMemory()), 0x3000)
+
+        # A hole in the middle
+        Triton.untaintMemory(0x11000, 0x2000)
+        self.assertFalse(Triton.isMemoryTainted(0x11000, 0x2000))
+        self.assertTrue(Triton.isMemoryTainted(MemoryAccess(0x10ffc, 8)))
+        self.assertEqual(sorted(Triton.getTaintedMemory()), list(range(0x10ff0, 0x11000)) + list(range(0x13000, 0x13ff0)))
+
+        Triton.untaintMemory(0x10000, 0x10000)
+        self.assertEqual(len(Triton.getTaintedMemory()), 0)
+
+    def test_taint_ranges(self):
+        """Taint intervals of memory"""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+
+        self.assertEqual(Triton.getTaintedRanges(), [])
+        self.assertTrue(Triton.taintMemoryRange(0x1000, 0x2000))
+        self.assertTrue(Triton.taintMemoryRange(0x3000, 0x10))
+        self.assertTrue(Triton.taintMemoryRange(0x5008, 3))
+        self.assertEqual(Triton.getTaintedRanges(), [(0x1000, 0x2010), (0x5008, 3)])
+
+        self.assertFalse(Triton.untaintMemoryRange(0x1800, 0x100))
+        self.assertEqual(Triton.getTaintedRanges(), [(0x1000, 0x800), (0x1900, 0x1710), (0x5008, 3)])
+
+        self.assertTrue(Triton.isAnyTainted(0x1700, 0x200))
+        self.assertFalse(Triton.isAnyTainted(0x1800, 0x100))
+        self.assertFalse(Triton.isAnyTainted(0x5000, 8))
+        self.assertTrue(Triton.isAnyTainted(0x5000, 9))
+
+    def test_taint_labels(self):
+        """Propagate the labels of the inputs"""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+
+        Triton.taintMemoryWithLabel(0x1000, 4, 1)
+        Triton.taintMemoryWithLabel(0x2000, 4, 100)
+        self.assertEqual(Triton.getMemoryTaintLabels(0x1000, 4), [1])
+        self.assertEqual(Triton.getMemoryTaintLabels(0x0ffc, 8), [1])
+        self.assertEqual(Triton.getMemoryTaintLabels(0x3000), [])
+
+        # mov eax, dword ptr [0x1000]
+        inst = Instruction(b"\x8b\x04\x25\x00\x10\x00\x00")
+        Triton.processing(inst)
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.rax), [1])
+
+        # add eax, dword ptr [0x2000]
+        inst = Instruction(b"\x03\x04\x25\x00\x20\x00\x00")
+        Triton.processing(inst)
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.rax), [1, 100])
+
+        # mov dword ptr [0x3000], eax
+        inst = Instruction(b"\x89\x04\x25\x00\x30\x00\x00")
+        Triton.processing(inst)
+        self.assertEqual(Triton.getMemoryTaintLabels(MemoryAccess(0x3000, 4)), [1, 100])
+
+        # A register with a label and an untainted register
+        Triton.taintRegisterWithLabel(Triton.registers.rbx, 2)
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.rbx))
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.rbx), [2])
+
+        # Untainting drops the labels
+        Triton.untaintRegister(Triton.registers.rax)
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.rax), [])
+        Triton.untaintMemory(0x3000, 4)
+        self.assertEqual(Triton.getMemoryTaintLabels(0x3000, 4), [])
+
+    def test_taint_only(self):
+        """Spread the taint without the semantics"""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+        Triton.setMode(MODE.TAINT_ONLY, True)
+
+        Triton.setConcreteRegisterValue(Triton.registers.rsi, 0x1000)
+        Triton.setConcreteMemoryValue(MemoryAccess(0x1008, CPUSIZE.QWORD), 0x41)
+        Triton.taintMemory(0x1008, 8)
+
+        # mov rax, qword ptr [rsi + 8]
+        inst = Instruction(b"\x48\x8b\x46\x08")
+        Triton.processing(inst)
+        self.assertTrue(inst.isTainted())
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.rax))
+        self.assertEqual(Triton.getConcreteRegisterValue(Triton.registers.rax), 0)
+
+        # add rbx, rax
+        inst = Instruction(b"\x48\x01\xc3")
+        Triton.processing(inst)
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.rbx))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.zf))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.cf))
+
+        # test rcx, rcx
+        inst = Instruction(b"\x48\x85\xc9")
+        Triton.processing(inst)
+        self.assertFalse(inst.isTainted())
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.zf))
+
+        # push rbx
+        Triton.setConcreteRegisterValue(Triton.registers.rsp, 0x8000)
+        inst = Instruction(b"\x53")
+        Triton.processing(inst)
+        self.assertTrue(Triton.isMemoryTainted(MemoryAccess(0x7ff8, CPUSIZE.QWORD)))
+
+        # xor rax, rax
+        inst = Instruction(b"\x48\x31\xc0")
+        Triton.processing(inst)
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.rax))
+
+        # lea rdx, [rbx + rcx]
+        inst = Instruction(b"\x48\x8d\x14\x0b")
+        Triton.processing(inst)
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.rdx))
+
+        # Without rule, the instruction goes through its semantics - bswap rdx
+        inst = Instruction(b"\x48\x0f\xca")
+        Triton.processing(inst)
+        self.assertNotEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.rdx))
+
     def test_taint_set_register(self):
         """Set taint register"""
         Triton = TritonContext()
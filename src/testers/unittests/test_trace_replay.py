@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the replay of execution traces."""
+
+import os
+import struct
+import tempfile
+import unittest
+from triton import *
+
+
+def record(address, opcode, registers=(), memory=()):
+    """Encode a trace record."""
+    data  = struct.pack("<QB", address, len(opcode)) + opcode
+    data += struct.pack("<H", len(registers))
+    for reg, size, value in registers:
+        data += struct.pack("<HB", reg, size) + value.to_bytes(size, "little")
+    data += struct.pack("<H", len(memory))
+    for addr, value in memory:
+        data += struct.pack("<QI", addr, len(value)) + value
+    return data
+
+
+class TestTraceReplay(unittest.TestCase):
+
+    """Testing replayTrace."""
+
+    def setUp(self):
+        """Write a trace of two instructions."""
+        self.ctx = TritonContext(ARCH.X86_64)
+
+        trace  = b"TTRC" + struct.pack("<HH", 1, ARCH.X86_64)
+        # mov rax, qword ptr [rbx]
+        trace += record(0x400000, b"\x48\x8b\x03", [(REG.X86_64.RBX, 8, 0x1000)], [(0x1000, struct.pack("<Q", 42))])
+        # add rax, rcx
+        trace += record(0x400003, b"\x48\x01\xc8", [(REG.X86_64.RCX, 8, 1)])
+
+        fd, self.path = tempfile.mkstemp()
+        with os.fdopen(fd, "wb") as f:
+            f.write(trace)
+        self.trace = trace
+
+    def tearDown(self):
+        """Remove the file."""
+        os.remove(self.path)
+
+    def test_replay(self):
+        """The deltas are set without concretizing the registers."""
+        self.ctx.symbolizeRegister(self.ctx.registers.rcx)
+        self.assertEqual(self.ctx.replayTrace(self.path), 2)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 43)
+        self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+        self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.rcx))
+
+    def test_count(self):
+        """Only the first records are processed."""
+        self.assertEqual(self.ctx.replayTrace(self.path, 1), 1)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 42)
+
+    def test_invalid(self):
+        """Invalid traces raise an exception."""
+        with open(self.path, "wb") as f:
+            f.write(self.trace[:-2])
+        self.assertRaises(Exception, self.ctx.replayTrace, self.path)
+
+        ctx = TritonContext(ARCH.AARCH64)
+        with open(self.path, "wb") as f:
+            f.write(self.trace)
+        self.assertRaises(Exception, ctx.replayTrace, self.path)
+
+    def test_taint_trace(self):
+        """The summaries of the chunks give the taint of the replay."""
+        for tainted in ["mem", "rax", "rcx"]:
+            for chunkSize in [1, 2]:
+                results = []
+                for method in ["replayTrace", "taintTrace"]:
+                    ctx = TritonContext(ARCH.X86_64)
+                    if tainted == "mem":
+                        ctx.taintMemory(MemoryAccess(0x1000, CPUSIZE.QWORD))
+                    else:
+                        ctx.taintRegister(ctx.getRegister(tainted))
+                    if method == "replayTrace":
+                        self.assertEqual(ctx.replayTrace(self.path), 2)
+                    else:
+                        self.assertEqual(ctx.taintTrace(self.path, chunkSize=chunkSize, threads=2), 2)
+                    results.append([ctx.isRegisterTainted(ctx.registers.rax), ctx.isRegisterTainted(ctx.registers.rcx)])
+                self.assertEqual(results[0], results[1])
+
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.taintRegister(ctx.registers.rax)
+        self.assertEqual(ctx.taintTrace(self.path, chunkSize=1), 2)
+        self.assertFalse(ctx.isRegisterTainted(ctx.registers.rax))
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rcx), 1)
+
+    def test_process_trace(self):
+        """The summaries of the segments give the symbolic state of the replay."""
+        for symbolized in ["mem", "rcx", None]:
+            for segmentSize in [1, 2]:
+                results = []
+                for method in ["replayTrace", "processTrace"]:
+                    ctx = TritonContext(ARCH.X86_64)
+                    if symbolized == "mem":
+                        ctx.symbolizeMemory(MemoryAccess(0x1000, CPUSIZE.QWORD))
+                    elif symbolized == "rcx":
+                        ctx.symbolizeRegister(ctx.registers.rcx)
+                    if method == "replayTrace":
+                        self.assertEqual(ctx.replayTrace(self.path), 2)
+                    else:
+                        self.assertEqual(ctx.processTrace(self.path, segmentSize=segmentSize, threads=2), 2)
+                    rax = ctx.registers.rax
+                    results.append([ctx.isRegisterSymbolized(rax), ctx.getConcreteRegisterValue(rax), ctx.getRegisterAst(rax).evaluate()])
+                self.assertEqual(results[0], results[1])
+
+        # The AST of rax is composed over the variable of rcx
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.symbolizeRegister(ctx.registers.rcx)
+        self.assertEqual(ctx.processTrace(self.path, segmentSize=1), 2)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rax), 43)
+        model = ctx.getModel(ctx.getRegisterAst(ctx.registers.rax) == 0x100)
+        self.assertEqual(list(model.values())[0].getValue(), 0x100 - 42)
+
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.MEMORY_ARRAY, True)
+        self.assertRaises(TypeError, ctx.processTrace, self.path)